@@ -0,0 +1,138 @@
+/**************************************************************************************************
+Background thread for fft-blk processing, see AsyncBlkWorker.h
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include "AsyncBlkWorker.h"
+
+using namespace std;
+
+enum {
+  // the audio thread never takes _mx so a wakeup can be missed, the worker polls at this rate
+  // to pick up anything that was missed
+  WORKER_POLL_MSEC = 2
+};
+
+//-------------------------------------------------------------------------------------------------
+AsyncBlkWorker::AsyncBlkWorker()
+{
+  headroom_n = 0;
+  chunk_n = 0;
+  in_abs = 0;
+  skip_n = 0;
+  xruns = 0;
+  _running = false;
+  _quit = false;
+  _wake = false;
+  _run_fn = NULL;
+  _run_ctx = NULL;
+  _time_state = TIME_IDLE;
+  _time_samp_abs = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void AsyncBlkWorker::start(void (*run_fn)(void* ctx), void* ctx)
+{
+  stop();
+
+  _run_fn = run_fn;
+  _run_ctx = ctx;
+  _quit = false;
+  _wake = false;
+
+  // the audio thread answers this before it writes the first input so the worker never
+  // processes with the tempo from before it was started
+  _time_state = TIME_REQ;
+
+  _thread = thread(&AsyncBlkWorker::threadFn, this);
+  _running.store(true, memory_order_release);
+}
+
+//-------------------------------------------------------------------------------------------------
+void AsyncBlkWorker::stop()
+{
+  if (!_thread.joinable())
+    return;
+
+  _running.store(false, memory_order_release);
+  {
+    lock_guard<mutex> lk(_mx);
+    _quit = true;
+  }
+  _cv.notify_all();
+  _out_cv.notify_all();
+  _thread.join();
+}
+
+//-------------------------------------------------------------------------------------------------
+void AsyncBlkWorker::wake()
+// audio thread
+{
+  _wake.store(true, memory_order_release);
+  _cv.notify_one();
+}
+
+//-------------------------------------------------------------------------------------------------
+void AsyncBlkWorker::waitOutput(long n)
+// audio thread, only when rendering offline
+{
+  unique_lock<mutex> lk(_mx);
+  while (out.readAvail() < n && !_quit) {
+    wake();
+    _out_cv.wait_for(lk, chrono::milliseconds(WORKER_POLL_MSEC));
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void AsyncBlkWorker::threadFn()
+{
+  while (1) {
+    {
+      unique_lock<mutex> lk(_mx);
+      _cv.wait_for(lk, chrono::milliseconds(WORKER_POLL_MSEC), [this] {
+        return _quit.load() || _wake.load();
+      });
+      if (_quit)
+        return;
+    }
+    _wake.store(false, memory_order_relaxed);
+    (*_run_fn)(_run_ctx);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+bool AsyncBlkWorker::takeTimeInfo(VstTimeInfo* dst, long* samp_abs)
+// worker
+{
+  int state = _time_state.load(memory_order_acquire);
+  if (state == TIME_RDY) {
+    *dst = _time_info;
+    *samp_abs = _time_samp_abs;
+    _time_state.store(TIME_IDLE, memory_order_relaxed);
+    return true;
+  }
+  if (state == TIME_IDLE)
+    _time_state.store(TIME_REQ, memory_order_release);
+  return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+void AsyncBlkWorker::putTimeInfo(const VstTimeInfo* ti, long samp_abs)
+// audio thread, only after timeInfoRequested() returns true
+{
+  if (ti)
+    _time_info = *ti;
+  else
+    _time_info.flags = 0;
+  _time_samp_abs = samp_abs;
+  _time_state.store(TIME_RDY, memory_order_release);
+}
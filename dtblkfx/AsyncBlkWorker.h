@@ -0,0 +1,187 @@
+#ifndef _DT_ASYNC_BLK_WORKER_H_
+#define _DT_ASYNC_BLK_WORKER_H_
+/**************************************************************************************************
+Background thread for fft-blk processing
+
+In async mode the host's audio callback only moves samples: input is written into the "in" FIFO
+and output is read from the "out" FIFO. The worker thread drains "in" through the normal
+DtBlkFx::_process (in chunks of at most one host block) and writes the result into "out".
+
+"out" starts with "headroom_n" samples of silence. This is the extra latency reported to the host
+and is the time that the worker has to finish a blk before the audio thread needs it, so a large
+fft blk landing in a small host buffer costs the callback no more than any other buffer.
+
+If the worker is late the audio thread outputs silence and the late samples are dropped when they
+arrive (so latency stays constant), unless the host says it is rendering offline in which case the
+audio thread waits for the worker.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <valarray>
+#include <vstsdk/public.sdk/source/vst2.x/audioeffectx.h>
+
+#include "BlkFxParam.h"
+#include "wrapprocessfloatvec.h"
+
+//-------------------------------------------------------------------------------------------------
+template <int CHANNELS>
+class AsyncFifo
+//
+// single producer/single consumer FIFO of multi-channel samples, neither side ever blocks
+//
+{
+public:
+  AsyncFifo() { clear(); }
+
+  // set size & clear (neither side may be using the FIFO)
+  void resize(long sz)
+  {
+    for (int i = 0; i < CHANNELS; i++)
+      _x[i].resize(sz);
+    clear();
+  }
+
+  // empty the FIFO (neither side may be using the FIFO)
+  void clear()
+  {
+    _n = 0;
+    _w = 0;
+    _r = 0;
+  }
+
+  long size() const { return (long)_x[0].size(); }
+
+  // number of samples that can be read (consumer) or written (producer)
+  long readAvail() const { return _n.load(std::memory_order_acquire); }
+  long writeAvail() const { return size() - _n.load(std::memory_order_acquire); }
+
+  // producer: call p[ch].process() on the next "n" free samples of each channel, n<=writeAvail()
+  template <class P> void write(P* p, long n)
+  {
+    if (n <= 0)
+      return;
+    for (int i = 0; i < CHANNELS; i++)
+      wrapProcess(p[i], _x[i], _w, n);
+    _w = wrap(_w + n, _x[0]);
+    _n.fetch_add(n, std::memory_order_release);
+  }
+
+  // consumer: call p[ch].process() on the next "n" samples of each channel & then free them,
+  // n<=readAvail()
+  template <class P> void read(P* p, long n)
+  {
+    if (n <= 0)
+      return;
+    for (int i = 0; i < CHANNELS; i++)
+      wrapProcess(p[i], _x[i], _r, n);
+    _r = wrap(_r + n, _x[0]);
+    _n.fetch_sub(n, std::memory_order_release);
+  }
+
+protected:
+  std::valarray<float> _x[CHANNELS];
+  long _w;              // write index (producer only)
+  long _r;              // read index (consumer only)
+  std::atomic<long> _n; // number of samples in the FIFO
+};
+
+//-------------------------------------------------------------------------------------------------
+class AsyncBlkWorker
+//
+// thread & FIFOs for async processing, owned by DtBlkFx
+//
+{
+public:
+  enum { AUDIO_CHANNELS = BlkFxParam::AUDIO_CHANNELS };
+  typedef AsyncFifo<AUDIO_CHANNELS> Fifo;
+
+  AsyncBlkWorker();
+  ~AsyncBlkWorker() { stop(); }
+
+  // start the thread, "run_fn(ctx)" is called on the thread every time it is woken
+  void start(void (*run_fn)(void* ctx), void* ctx);
+
+  // stop & join the thread (must not be called from the thread itself)
+  void stop();
+
+  // whether the audio thread should be using the FIFOs
+  bool isRunning() const { return _running.load(std::memory_order_acquire); }
+
+  // audio thread: new input is available
+  void wake();
+
+  // worker: new output is available
+  void outputRdy() { _out_cv.notify_all(); }
+
+  // audio thread: wait until "out" contains at least "n" samples (used when rendering offline)
+  void waitOutput(long n);
+
+public: // the worker can't call the host so it gets tempo info via the audio thread
+  // worker: get the time info most recently fetched by the audio thread along with the
+  // absolute input sample position it corresponds to, if there isn't any then ask for it and
+  // return false
+  bool takeTimeInfo(VstTimeInfo* dst, long* samp_abs);
+
+  // audio thread: whether the worker has asked for time info
+  bool timeInfoRequested() const
+  {
+    return _time_state.load(std::memory_order_acquire) == TIME_REQ;
+  }
+
+  // audio thread: supply time info ("ti" may be NULL if the host didn't give us any)
+  void putTimeInfo(const VstTimeInfo* ti, long samp_abs);
+
+public:
+  // input from the audio thread & output from the worker
+  Fifo in, out;
+
+  // silence at the start of "out" (extra latency)
+  long headroom_n;
+
+  // max number of samples the worker processes in one go (i.e. while holding DtBlkFx::_protect)
+  long chunk_n;
+
+  // audio thread only: total samples written to "in" (same sample count as
+  // DtBlkFx::_curr_samp_abs on the worker)
+  long in_abs;
+
+  // audio thread only: number of output samples that were replaced with silence because the
+  // worker was late and must be dropped when they arrive
+  long skip_n;
+
+  // number of audio callbacks where the worker was late (or input was lost)
+  std::atomic<long> xruns;
+
+protected:
+  void threadFn();
+
+  std::thread _thread;
+  std::atomic<bool> _running;
+  std::atomic<bool> _quit;
+  std::atomic<bool> _wake;
+  std::mutex _mx;
+  std::condition_variable _cv;
+  std::condition_variable _out_cv;
+
+  void (*_run_fn)(void* ctx);
+  void* _run_ctx;
+
+  enum { TIME_IDLE, TIME_REQ, TIME_RDY };
+  std::atomic<int> _time_state;
+  VstTimeInfo _time_info;
+  long _time_samp_abs;
+};
+
+#endif
@@ -0,0 +1,149 @@
+/**************************************************************************************************
+One allocation that the per-channel buffers of an instance are carved out of, see ChanArena.h
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include "ChanArena.h"
+
+#ifndef _WIN32
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------------------------
+static size_t RoundUp(size_t n, size_t g)
+{
+  return (n + g - 1) / g * g;
+}
+
+//-------------------------------------------------------------------------------------------------
+size_t ChanArena::Layout::add(size_t bytes)
+{
+  size_t offs = RoundUp(n_bytes, pageSize()) + (n_bufs % CACHE_COLOURS) * CACHE_COLOUR_BYTES;
+  n_bytes = offs + bytes;
+  n_bufs++;
+  return offs;
+}
+
+//-------------------------------------------------------------------------------------------------
+ChanArena::ChanArena()
+{
+  _ptr = NULL;
+  _n_bytes = 0;
+  _huge = false;
+}
+
+#ifdef _WIN32
+
+//-------------------------------------------------------------------------------------------------
+/*static*/ size_t ChanArena::pageSize()
+{
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  return si.dwPageSize;
+}
+
+//-------------------------------------------------------------------------------------------------
+/*static*/ size_t ChanArena::hugePageSize()
+{
+  return GetLargePageMinimum();
+}
+
+//-------------------------------------------------------------------------------------------------
+void ChanArena::resize(size_t n_bytes, bool huge_pages)
+{
+  if (_ptr) {
+    VirtualFree(_ptr, 0, MEM_RELEASE);
+    _ptr = NULL;
+  }
+  _n_bytes = 0;
+  _huge = false;
+  if (!n_bytes)
+    return;
+
+  // large pages need the "lock pages in memory" privilege, without it this fails & we use normal
+  // pages
+  size_t huge_sz = huge_pages ? hugePageSize() : 0;
+  if (huge_sz && n_bytes >= huge_sz) {
+    size_t n = RoundUp(n_bytes, huge_sz);
+    _ptr = VirtualAlloc(NULL, n, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    if (_ptr) {
+      _n_bytes = n;
+      _huge = true;
+      return;
+    }
+  }
+
+  n_bytes = RoundUp(n_bytes, pageSize());
+  _ptr = VirtualAlloc(NULL, n_bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+  if (!_ptr)
+    throw 0;
+  _n_bytes = n_bytes;
+}
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+/*static*/ size_t ChanArena::pageSize()
+{
+  return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+//-------------------------------------------------------------------------------------------------
+/*static*/ size_t ChanArena::hugePageSize()
+{
+#  if defined(__linux__) && defined(MADV_HUGEPAGE)
+  return 2 * 1024 * 1024;
+#  else
+  return 0;
+#  endif
+}
+
+//-------------------------------------------------------------------------------------------------
+void ChanArena::resize(size_t n_bytes, bool huge_pages)
+{
+  if (_ptr) {
+    munmap(_ptr, _n_bytes);
+    _ptr = NULL;
+  }
+  _n_bytes = 0;
+  _huge = false;
+  if (!n_bytes)
+    return;
+
+  size_t huge_sz = huge_pages ? hugePageSize() : 0;
+  bool huge = huge_sz && n_bytes >= huge_sz;
+  size_t g = huge ? huge_sz : pageSize();
+  n_bytes = RoundUp(n_bytes, g);
+
+  // transparent huge pages need a huge page aligned range, map extra & trim either side
+  size_t map_n = huge ? n_bytes + huge_sz : n_bytes;
+  char* addr = (char*)mmap(NULL, map_n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (addr == MAP_FAILED)
+    throw 0;
+
+  if (huge) {
+    char* start = (char*)RoundUp((size_t)addr, huge_sz);
+    if (start > addr)
+      munmap(addr, start - addr);
+    if (addr + map_n > start + n_bytes)
+      munmap(start + n_bytes, addr + map_n - (start + n_bytes));
+    addr = start;
+#  ifdef MADV_HUGEPAGE
+    _huge = madvise(addr, n_bytes, MADV_HUGEPAGE) == 0;
+#  endif
+  }
+  _ptr = addr;
+  _n_bytes = n_bytes;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef _DT_CHAN_ARENA_H_
+#define _DT_CHAN_ARENA_H_
+/**************************************************************************************************
+One allocation that the per-channel buffers of an instance are carved out of
+
+Each buffer starts on a page boundary plus a "cache colour" offset that is different for
+consecutive buffers, so buffers that are stepped through together (e.g. x1 & the x2 scratch) don't
+land on the same cache sets. Large arenas can ask for huge pages (2M on linux, large pages on
+windows) to cut down TLB misses, if they're not available normal pages are used.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include <stddef.h>
+
+//-------------------------------------------------------------------------------------------------
+class ChanArena
+//
+// the allocation (bytes)
+//
+{
+public:
+  enum {
+    CACHE_COLOURS = 8,        // number of different offsets
+    CACHE_COLOUR_BYTES = 512  // step between offsets (spreads buffers across a 4k page)
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  struct Layout
+  // work out where each buffer goes before allocating
+  {
+    size_t n_bytes; // total so far
+    int n_bufs;
+
+    Layout()
+    {
+      n_bytes = 0;
+      n_bufs = 0;
+    }
+
+    // add a buffer of "bytes", return its byte offset from the start of the arena
+    size_t add(size_t bytes);
+  };
+
+  ChanArena();
+  ~ChanArena() { resize(0, false); }
+
+  // allocate at least "n_bytes" or 0 to free, original data is destroyed, throw error if failure
+  // "huge_pages" asks for huge pages (falls back to normal pages)
+  void resize(size_t n_bytes, bool huge_pages);
+
+  // bytes allocated (rounded up to the page size)
+  size_t size() const { return _n_bytes; }
+
+  // start of the arena (NULL if nothing allocated), page aligned
+  void* ptr() const { return _ptr; }
+
+  // buffer at byte offset "offs" (from Layout::add)
+  template <class T> T* at(size_t offs) const { return (T*)((char*)_ptr + offs); }
+
+  // true if backed by huge pages (on linux this is only a hint to the kernel)
+  bool isHugePages() const { return _huge; }
+
+  // normal page size
+  static size_t pageSize();
+
+  // huge page size or 0 if huge pages aren't available
+  static size_t hugePageSize();
+
+protected:
+  void* _ptr;
+  size_t _n_bytes;
+  bool _huge;
+
+  // can't copy or assign
+  ChanArena(const ChanArena&) {}
+  void operator=(const ChanArena&) {}
+};
+
+#endif
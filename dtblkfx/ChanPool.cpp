@@ -0,0 +1,187 @@
+/**************************************************************************************************
+Worker pool for per-channel work, see ChanPool.h
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ChanPool.h"
+#include "misc_stuff.h"
+
+enum {
+  // max number of pool threads (more than the number of channels doesn't help a single instance,
+  // a few more lets several instances overlap)
+  MAX_POOL_THREADS = 4,
+
+  // task slots, if they're all in use the caller runs the task itself
+  NUM_SLOTS = 64,
+
+  // longest a pool thread sleeps before looking at the slots again (covers a missed wake up)
+  POOL_POLL_MSEC = 2
+};
+
+namespace {
+
+// slot states, a caller only uses slots that it moved from SLOT_FREE & is the only one that moves
+// them back so a slot is never reused while its caller is still looking at it
+enum {
+  SLOT_FREE,    // not in use
+  SLOT_FILLING, // caller is writing the task
+  SLOT_QUEUED,  // waiting for a pool thread (or the caller to take it back)
+  SLOT_RUNNING, // a pool thread is running it
+  SLOT_DONE     // finished by a pool thread
+};
+
+struct ChanTask {
+  std::atomic<int> state;
+  ChanTaskFn fn;
+  void* ctx;
+  int ch;
+};
+
+// tasks are handed over through the slots without any locks (the audio thread never waits for a
+// lock that a pool thread could be holding)
+ChanTask g_slot[NUM_SLOTS];
+std::atomic<int> g_queued_n(0); // number of slots in SLOT_QUEUED
+std::atomic<bool> g_pool_quit(true);
+
+// only for pool threads to sleep on
+std::mutex g_pool_mx;
+std::condition_variable g_pool_cv;
+
+// users & threads, protected by g_pool_users_mx
+std::mutex g_pool_users_mx;
+int g_pool_users = 0;
+std::vector<std::thread> g_pool_threads;
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=this thread has the task*/ ClaimTask(ChanTask& t, int new_state)
+// move a task out of SLOT_QUEUED
+{
+  int state = SLOT_QUEUED;
+  if (!t.state.compare_exchange_strong(state, new_state, std::memory_order_acquire))
+    return false;
+  g_queued_n.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+static void PoolThreadFn()
+{
+  SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+
+  while (!g_pool_quit.load(std::memory_order_relaxed)) {
+    bool ran = false;
+    for (int i = 0; i < NUM_SLOTS; i++) {
+      ChanTask& t = g_slot[i];
+      if (t.state.load(std::memory_order_relaxed) != SLOT_QUEUED || !ClaimTask(t, SLOT_RUNNING))
+        continue;
+      (*t.fn)(t.ctx, t.ch);
+      t.state.store(SLOT_DONE, std::memory_order_release);
+      ran = true;
+    }
+    if (ran)
+      continue;
+
+    std::unique_lock<std::mutex> lk(g_pool_mx);
+    g_pool_cv.wait_for(lk, std::chrono::milliseconds(POOL_POLL_MSEC), [] {
+      return g_pool_quit.load() || g_queued_n.load() > 0;
+    });
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void RunChanTasks(ChanTaskFn fn, void* ctx, int n)
+{
+  if (n <= 0)
+    return;
+
+  // hand over channels 1..n-1, any that don't get a slot are run here
+  int slot[NUM_SLOTS];
+  int queued_n = 0;
+  int next_ch = 1;
+  if (n > 1 && !g_pool_quit.load(std::memory_order_relaxed)) {
+    for (int i = 0; i < NUM_SLOTS && next_ch < n; i++) {
+      ChanTask& t = g_slot[i];
+      int state = SLOT_FREE;
+      if (t.state.load(std::memory_order_relaxed) != SLOT_FREE ||
+          !t.state.compare_exchange_strong(state, SLOT_FILLING, std::memory_order_acquire))
+        continue;
+      t.fn = fn;
+      t.ctx = ctx;
+      t.ch = next_ch++;
+      g_queued_n.fetch_add(1, std::memory_order_relaxed);
+      t.state.store(SLOT_QUEUED, std::memory_order_release);
+      slot[queued_n++] = i;
+    }
+  }
+  if (queued_n == 1)
+    g_pool_cv.notify_one();
+  else if (queued_n > 1)
+    g_pool_cv.notify_all();
+
+  (*fn)(ctx, 0);
+  for (int i = next_ch; i < n; i++)
+    (*fn)(ctx, i);
+
+  // take back our tasks that haven't been started & wait for the ones that were (short, they're
+  // the same size as the ones we ran)
+  for (int i = 0; i < queued_n; i++) {
+    ChanTask& t = g_slot[slot[i]];
+    if (ClaimTask(t, SLOT_FILLING))
+      (*fn)(ctx, t.ch);
+    else
+      while (t.state.load(std::memory_order_acquire) != SLOT_DONE)
+        std::this_thread::yield();
+    t.state.store(SLOT_FREE, std::memory_order_release);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartChanPool()
+{
+  std::lock_guard<std::mutex> users_lk(g_pool_users_mx);
+  if (g_pool_users++ > 0)
+    return;
+
+  int threads_n = std::max(1, std::min((int)std::thread::hardware_concurrency() - 1,
+                                       (int)MAX_POOL_THREADS));
+  g_pool_quit = false;
+  for (int i = 0; i < threads_n; i++)
+    g_pool_threads.push_back(std::thread(PoolThreadFn));
+}
+
+//-------------------------------------------------------------------------------------------------
+void StopChanPool()
+{
+  std::lock_guard<std::mutex> users_lk(g_pool_users_mx);
+  if (--g_pool_users > 0)
+    return;
+
+  // tasks still queued are taken back by their callers
+  {
+    std::lock_guard<std::mutex> lk(g_pool_mx);
+    g_pool_quit = true;
+  }
+  g_pool_cv.notify_all();
+  for (size_t i = 0; i < g_pool_threads.size(); i++)
+    g_pool_threads[i].join();
+  g_pool_threads.clear();
+}
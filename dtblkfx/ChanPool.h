@@ -0,0 +1,42 @@
+#ifndef _DT_CHAN_POOL_H_
+#define _DT_CHAN_POOL_H_
+/**************************************************************************************************
+Small worker pool shared by all instances for running independent per-channel work in parallel
+
+An instance hands over one task per channel & runs channel 0 itself. Any task that no worker has
+started by the time the caller is done with its own is taken back & run by the caller, so a busy
+pool (lots of instances) is never slower than running the channels one after the other, it just
+doesn't help. Tasks are handed over through a fixed set of slots without taking any locks, so
+the audio thread never waits on a lock held by another instance or a pool thread.
+
+The pool only runs while there are users (each instance with parallel channels turned on is a
+user), without any users tasks are run by the caller.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+// task for channel "ch"
+typedef void (*ChanTaskFn)(void* ctx, int ch);
+
+// call "fn(ctx, ch)" for ch=0..n-1 & return when they're all done, channels other than 0 may run
+// on pool threads (any thread, doesn't allocate)
+extern void RunChanTasks(ChanTaskFn fn, void* ctx, int n);
+
+// call "obj->FN(ch)" for ch=0..n-1, see RunChanTasks
+template <class T, void (T::*FN)(int ch)> void ChanTaskThunk(void* ctx, int ch)
+{
+  (((T*)ctx)->*FN)(ch);
+}
+
+// the pool threads run while there are any users
+extern void StartChanPool();
+extern void StopChanPool();
+
+#endif
@@ -0,0 +1,145 @@
+/**************************************************************************************************
+Quality governor: trade fft size & overlap for time when processing can't keep up
+
+The audio thread reports the time taken by each _process call against the time the host buffer
+lasts (its real-time budget). Every WINDOW_SEC of audio the governor looks at the worst call &
+the average:
+
+- the worst call is mostly one big fft blk landing in a single host buffer, it goes with the fft
+  size so the plan is dropped (each step halves the fft)
+- the average goes with the number of blks so the overlap is dropped (each step halves it)
+
+Once both have been well under their limits for RECOVER_WINDOWS windows in a row the last step is
+undone (overlap first). The recover thresholds are under half of the degrade thresholds so that
+undoing a step doesn't take it straight back over.
+
+Live use would rather lose some frequency resolution than drop out, offline rendering has no
+deadline & is never degraded (see DtBlkFx::setGovernor).
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#ifndef _DT_CPU_GOVERNOR_H_
+#define _DT_CPU_GOVERNOR_H_
+
+#include <atomic>
+#include <math.h>
+
+//-------------------------------------------------------------------------------------------------
+class CpuGovernor
+//
+// single writer (audio thread), the drops can be read from any thread
+//
+{
+public:
+  enum {
+    MAX_PLAN_DROP = 3,    // at most 1/8 of the fft size
+    MAX_OVERLAP_DROP = 3, // at most 1/8 of the overlap
+    RECOVER_WINDOWS = 8   // 2 sec of headroom before undoing a step
+  };
+
+  CpuGovernor() { reset(); }
+
+  // writer: back to full quality
+  void reset()
+  {
+    _plan_drop = 0;
+    _overlap_drop = 0;
+    _audio_sec = 0.0;
+    _busy_sec = 0.0;
+    _peak_load = 0.0;
+    _good_n = 0;
+  }
+
+  // writer: a _process call took "busy_sec" to do "audio_sec" of audio, return true if the
+  // drops changed
+  bool add(double busy_sec, double audio_sec)
+  {
+    double load = busy_sec / audio_sec;
+    if (load > _peak_load)
+      _peak_load = load;
+    _busy_sec += busy_sec;
+    _audio_sec += audio_sec;
+    if (_audio_sec < WINDOW_SEC)
+      return false;
+
+    double avg_load = _busy_sec / _audio_sec;
+    double peak_load = _peak_load;
+    _audio_sec = 0.0;
+    _busy_sec = 0.0;
+    _peak_load = 0.0;
+
+    int plan_drop = _plan_drop.load(std::memory_order_relaxed);
+    int overlap_drop = _overlap_drop.load(std::memory_order_relaxed);
+
+    if (peak_load > PEAK_DEGRADE || avg_load > AVG_DEGRADE) {
+      _good_n = 0;
+      if (peak_load > PEAK_DEGRADE && plan_drop < MAX_PLAN_DROP)
+        plan_drop++;
+      else if (overlap_drop < MAX_OVERLAP_DROP)
+        overlap_drop++;
+      else if (plan_drop < MAX_PLAN_DROP)
+        plan_drop++;
+      else
+        return false; // nothing left to drop
+    }
+    else if (peak_load < PEAK_RECOVER && avg_load < AVG_RECOVER && (plan_drop || overlap_drop)) {
+      if (++_good_n < RECOVER_WINDOWS)
+        return false;
+      _good_n = 0;
+      if (overlap_drop)
+        overlap_drop--;
+      else
+        plan_drop--;
+    }
+    else {
+      _good_n = 0;
+      return false;
+    }
+    _plan_drop.store(plan_drop, std::memory_order_relaxed);
+    _overlap_drop.store(overlap_drop, std::memory_order_relaxed);
+    return true;
+  }
+
+  // number of times the fft size is halved
+  int planDrop() const { return _plan_drop.load(std::memory_order_relaxed); }
+
+  // number of times the overlap is halved
+  int overlapDrop() const { return _overlap_drop.load(std::memory_order_relaxed); }
+
+  bool isDegraded() const { return planDrop() || overlapDrop(); }
+
+  // overlap part (0..1, see BlkFxParam::getOverlapPart) after "overlap_drop" steps
+  static float dropOverlap(float overlap_part, int overlap_drop)
+  {
+    return ldexpf(overlap_part, -overlap_drop);
+  }
+
+protected:
+  static constexpr double WINDOW_SEC = 0.25;
+
+  // fraction of the budget used by the worst call & on average
+  static constexpr double PEAK_DEGRADE = 0.8;
+  static constexpr double AVG_DEGRADE = 0.6;
+  static constexpr double PEAK_RECOVER = 0.35;
+  static constexpr double AVG_RECOVER = 0.25;
+
+  std::atomic<int> _plan_drop;
+  std::atomic<int> _overlap_drop;
+
+  // current window
+  double _audio_sec;
+  double _busy_sec;
+  double _peak_load;
+
+  // windows in a row with headroom
+  int _good_n;
+};
+
+#endif
@@ -29,13 +29,26 @@ General Public License for more details.
 ***************************************************************************************************/
 #include <StdAfx.h>
 
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 
-#include "WrapProcessFloatVec.h"
+#include "wrapprocessfloatvec.h"
 
+#include "ChanPool.h"
 #include "DtBlkFx.hpp"
+#ifndef DTBLKFX_HEADLESS
 #include "Gui.h"
+#else
+// no editor in the command line tool (gui() is always NULL)
+class Gui {
+public:
+  void close() {}
+  void resume() {}
+  void suspend() {}
+  void setParameter(long index, float value) {}
+};
+#endif
 #include "rfftw_float.h"
 
 // filled by BlkFxMain.cpp
@@ -47,6 +60,12 @@ extern vector<VstProgram<BlkFxParam::TOTAL_NUM>> g_blk_fx_presets;
 std::ofstream f_param("/tmp/param.dat");
 #endif
 
+// samples of headroom for processing fft blks on a worker thread (see AsyncBlkWorker.h), 0 to
+// process in the host's audio callback
+#ifndef ASYNC_HEADROOM_DEFAULT
+#  define ASYNC_HEADROOM_DEFAULT 0
+#endif
+
 #define LOG(a, b)                                                                                  \
   {                                                                                                \
   }
@@ -99,13 +118,29 @@ enum {
   // minimum number of samples that we move forward through blks
   MIN_BLK_FWD_N = FFTW_ALIGNMENT + /*arbitrary*/ 16,
 
+  // x3 space for a host block is at least this (arbitrary)
+  MIN_X3_BLK_N = 2048,
+
   // value saved into chunks
-  CHUNK_TAG = 0x99887766
+  CHUNK_TAG = 0x99887766,
+
+  // tag of the random seed saved at the end of project chunks (see getChunk)
+  CHUNK_SEED_TAG = 0x99887767
 };
 
+// input & output below this are treated as silence (-120 dB), see silentBlk
+static const float SILENCE_LEVEL = 1e-6f;
+
 // from BlkFxMain.cpp
 extern bool GlobalInitOk();
 
+// time the enclosing scope as stage "ID" when stage timing is on (see StageTimer.h)
+#define SCOPE_STAGE_TIMER(ID)                                                                    \
+  ScopeStageTimer _scope_stage_timer_(_stage_times, ID, _stage_timing_on)
+
+// whether all channels are transformed by one call of a batched plan (see FFT_BATCH_N)
+#define BATCH_FFT (FFT_BATCH_N > 1 && FFT_BATCH_N == AUDIO_CHANNELS)
+
 //-------------------------------------------------------------------------------------------------
 DtBlkFx::DtBlkFx(audioMasterCallback audioMaster)
     : AudioEffectX(audioMaster,
@@ -119,11 +154,36 @@ DtBlkFx::DtBlkFx(audioMasterCallback audioMaster)
 
   _vst_param_idx_focus = -1;
 
-  _params.init(/*n params*/ BlkFxParam::TOTAL_NUM, /*delay length*/ 140);
+  _stage_timing = false;
+  _stage_timing_on = false;
+
+  _async_headroom_n = ASYNC_HEADROOM_DEFAULT;
+  _async_worker_active = false;
+
+  _par_chans = false;
+  _par_chans_on = false;
 
+  _governor = false;
+  _governor_on = false;
+  _offline = false;
+
+  _blk_pipeline = false;
+  _blk_out_i = 0;
+  _blk_out_pending = false;
+  _mix_out = NULL;
+
+  // instances get seeds in creation order so they all differ, the seed is saved with the project
+  // (see getChunk) because hosts also create instances for scanning, probing & undo
+  static std::atomic<unsigned> g_instance_n(0);
+  _rand_seed = CtrRand32(g_instance_n++);
+
+  _params.init(/*n params*/ BlkFxParam::TOTAL_NUM, /*initial length (grows)*/ 256);
+
+#ifndef DTBLKFX_HEADLESS
   // set GUI if we've loaded images ok
   if (GlobalInitOk())
     setEditor(new Gui(this));
+#endif
 
   //
   for (i = 0; i < _fx1_0.size(); i++)
@@ -132,22 +192,12 @@ DtBlkFx::DtBlkFx(audioMasterCallback audioMaster)
   //
   configParams1_0();
 
-  // get buffer space
-  _x0_sz = X0_INDEX_ROUNDING_MASK & (8 * 44100); // length of buffer is arbitrary
-  _x0_force_out_sz = _x0_sz - MAX_FFT_SZ;        // force output when x0 contains this much data
-  _x3_sz = 5 * 44100;
-  for (i = 0; i < AUDIO_CHANNELS; i++) {
-    _chan[i].x0.resize(
-        _x0_sz + MAX_FFT_SZ); // input buffer with extra space at end to unwrap data for processing
-    _chan[i].x1.resize(MAX_FFT_SZ / 2 +
-                       32 * 2); // FFT'd complex data with space either side for shift overflow
-    _chan[i].x2.resize(
-        MAX_FFT_SZ +
-        32 * 2); // inverse FFT & temporary buffer with space either side for shift overflow
-    _chan[i].x3.resize(
-        _x3_sz); // output buffer (length is arbitrary, as long as > MAX_FFT_SZ plus a few)
-  }
-  _max_delay_n = _x3_sz - MAX_FFT_SZ - 2048;
+  // get buffer space (x0 & x3 are sized again on resume for the host's sample rate)
+  _huge_pages = false;
+  _max_delay_msec = MAX_DELAY_MSEC_DEFAULT;
+  _x0_sz = 0;
+  _x3_sz = 0;
+  sizeBuffers();
 
   // copy presets into the program
   _program.reserve(/*AudioEffect::*/ numPrograms);
@@ -169,7 +219,7 @@ DtBlkFx::DtBlkFx(audioMasterCallback audioMaster)
 
   // didn't work in fl studio or renoise for delay of 4096
   _initial_delay = 0;
-  setInitialDelay(_initial_delay);
+  setInitialDelay(_initial_delay + _async_headroom_n);
 
   // these were registered from steinberg
   if (AUDIO_CHANNELS == 2)
@@ -184,12 +234,25 @@ DtBlkFx::DtBlkFx(audioMasterCallback audioMaster)
   _params.put(/*samp abs*/ 0, BlkFxParam::FFT_LEN, BlkFxParam::getFFTLenParam(16));
   _params.put(/*samp abs*/ 0, BlkFxParam::OVERLAP, 0.35f);
 
+  // fft plans are created in the background as we need them
+  StartFFTWfPlanner();
+
   resume(); // flush buffer
 }
 
 //-------------------------------------------------------------------------------------------------
 DtBlkFx::~DtBlkFx()
 {
+  // worker uses everything, stop it first
+  _async.stop();
+
+  // no longer a channel pool user
+  setParallelChans(false);
+  if (_blk_pipeline)
+    StopChanPool();
+
+  StopFFTWfPlanner();
+
   // make sure gui is closed, probably don't need to
   // TODO: check whether we need to do this
   if (gui())
@@ -279,9 +342,8 @@ void DtBlkFx::init()
 
   // absolute sample position of start of current fft blk at x0[x0_i]/x1[0]/x2[0]
   _blk_samp_abs = 0;
-  _x0_n_past_end = 0; // number of samples copied past end of buffer
-  _x0_i = 0;          // pre-fft buffer offset
-  _x0_n = 0;          // number of samples in the pre-fft buffer
+  _x0_i = 0; // pre-fft buffer offset
+  _x0_n = 0; // number of samples in the pre-fft buffer
 
   _x3_o = 0;       // output FIFO output index
   _x3_end_abs = 0; // no data in _x3
@@ -291,6 +353,8 @@ void DtBlkFx::init()
     Clear(_chan[i].x3);
 
   _x3_is_clear = true;
+  _loud_end_abs = 0;
+  _fx_gain = 1.0f;
 
   // these will be updated on first poll
   _prev_poll_abs = 0;
@@ -299,6 +363,7 @@ void DtBlkFx::init()
 
   _params_state = PARAMS_CHK_SYNC;
   _params_need_processing = true;
+  _blk_params_ok = false;
 
   // these variables will be updated on first paramsChk()
   _dst_fft_abs = 0;
@@ -320,8 +385,9 @@ VstInt32 DtBlkFx::getChunk(void** vdata, bool is_preset)
   // get enough space to copy current data and all presets
   int payload_bytes =
       PackedBytesPerVstProgram(BlkFxParam::TOTAL_NUM) * (num_programs + 1 /*curr params*/);
+  int seed_bytes = is_preset ? 0 : /*seed tag*/ 4 + /*seed*/ 4;
   _chunk_data.resize(/*tag field*/ 4 + /*vers field*/ 4 + /*n programs field*/ 4 +
-                     /*curr program field*/ 4 + payload_bytes);
+                     /*curr program field*/ 4 + payload_bytes + seed_bytes);
 
   // cast to what we need
   LittleEndianMemStr le_data(_chunk_data);
@@ -351,6 +417,11 @@ VstInt32 DtBlkFx::getChunk(void** vdata, bool is_preset)
     LOG("", "DtBlkFx::getChunk saving" << VAR(chunk_data->num_programs));
     for (i = 0; i < num_programs; i++)
       _program[i].saveLittleEndian(&le_data, 4 + 5 * 8);
+
+    // random seed so that the project renders the same when it's loaded again (added after
+    // version 101 without changing it, older versions stop reading after the programs)
+    le_data.put32((int)CHUNK_SEED_TAG);
+    le_data.put32(_rand_seed);
   }
 
   *vdata = &_chunk_data[0];
@@ -363,13 +434,13 @@ VstInt32 /*1=success*/ DtBlkFx::setChunk(void* vdata, VstInt32 n_bytes, bool isP
 {
   LittleEndianMemStr le_data(vdata, n_bytes);
 
-  unsigned long tag;
+  unsigned int tag;
   if (!le_data.get32(&tag))
     return 0;
   if (tag != CHUNK_TAG)
     return 0;
 
-  unsigned long vers;
+  unsigned int vers;
   if (!le_data.get32(&vers))
     return 0;
 
@@ -389,11 +460,11 @@ VstInt32 /*1=success*/ DtBlkFx::setChunk(void* vdata, VstInt32 n_bytes, bool isP
 
   // these versions are nearly the same
   if (vers == 100 || vers == 101) {
-    long num_programs;
+    VstInt32 num_programs;
     if (!le_data.get32(&num_programs))
       return 0;
 
-    long curr_program;
+    VstInt32 curr_program = 0;
     if (vers == 101)
       if (!le_data.get32(&curr_program))
         return 0;
@@ -419,11 +490,15 @@ VstInt32 /*1=success*/ DtBlkFx::setChunk(void* vdata, VstInt32 n_bytes, bool isP
       if (!curr.loadLittleEndian(&le_data, num_params))
         return 0;
 
+      // where the programs end according to the header (the seed trailer must be exactly there)
+      long programs_end = /*fields*/ 16 + PackedBytesPerVstProgram(num_params) * (num_programs + 1);
+
       // max number of programs that we can load
-      long max_num_programs = AudioEffect::numPrograms - 1;
+      VstInt32 max_num_programs = AudioEffect::numPrograms - 1;
 
       // calculate the number of programs based on the number of bytes
-      num_programs = min((long)le_data.n / PackedBytesPerVstProgram(num_programs), num_programs);
+      num_programs =
+          min((VstInt32)le_data.n / PackedBytesPerVstProgram(num_programs), num_programs);
 
       // don't load more than what we have space for
       num_programs = min(max_num_programs, num_programs);
@@ -448,6 +523,16 @@ VstInt32 /*1=success*/ DtBlkFx::setChunk(void* vdata, VstInt32 n_bytes, bool isP
       curProgram = currProgramNum(); // limit range
       LOG("", "DtBlkFx::setChunk v1.0" << VAR(curProgram));
 
+      // random seed if it was saved, older chunks end with the programs so only take the tag when
+      // the chunk is exactly 8 bytes longer (program names can hold anything, they could look
+      // like the tag), otherwise keep ours
+      if (vers == 101 && n_bytes == programs_end + 8) {
+        LittleEndianMemStr seed_data((char*)vdata + programs_end, 8);
+        unsigned int seed_tag, seed;
+        if (seed_data.get32(&seed_tag) && seed_tag == CHUNK_SEED_TAG && seed_data.get32(&seed))
+          _rand_seed = seed;
+      }
+
       // set all of the current params
       for (i = 0; i < BlkFxParam::TOTAL_NUM; i++)
         setParameter(i, curr.params[i]);
@@ -501,9 +586,25 @@ void DtBlkFx::resume()
   LOG("", "DtBlkFx::resume");
   AudioEffectX::resume();
 
+  // restarted below (stop before taking the lock, the worker takes it while processing)
+  _async.stop();
+
   ScopeCriticalSection scs(_protect);
+
+  // sample rate & block size are set while suspended
+  sizeBuffers();
+
+  // param records can't grow on the audio thread
+  _params.growIfNearlyFull();
+
+  // start at full quality
+  _gov.reset();
+
   if (gui())
     gui()->resume();
+
+  if (_async_headroom_n > 0)
+    asyncStart();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -514,9 +615,14 @@ void DtBlkFx::suspend()
   LOG("", "DtBlkFx::suspend");
   AudioEffectX::suspend();
 
+  // stop the worker before taking the lock (it takes the lock while processing)
+  _async.stop();
+
   ScopeCriticalSection scs(_protect);
 
-  // roll back params to just contain most recent and reset sample position
+  // roll back params to just contain most recent and reset sample position (grow first if the
+  // records were close to full, they can't grow on the audio thread)
+  _params.growIfNearlyFull();
   _params.resetAndCopyIn();
 
   // clear buffers
@@ -532,7 +638,100 @@ void DtBlkFx::setBlockSize(VstInt32 sz)
 // called by vst-host to indicate max number of samples that will be passed to process
 {
   AudioEffectX::setBlockSize(sz);
-  _max_delay_n = _x3_sz - MAX_FFT_SZ - sz;
+  updateMaxDelay();
+
+  // param records can't grow on the audio thread
+  ScopeCriticalSection scs(_protect);
+  _params.growIfNearlyFull();
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::updateMaxDelay()
+// internal method
+// limit the delay to what was asked for & what fits in x3 with a host block
+{
+  long max_n = _x3_sz - MAX_FFT_SZ - max((long)blockSize, (long)MIN_X3_BLK_N);
+  _max_delay_n = min((long)(_max_delay_msec * 1e-3f * sampleRate), max_n);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::sizeBuffers()
+// internal method, called with _protect held (or before processing starts)
+// size x0 & x3 for the current sample rate, block size & max delay, if either changes size then
+// everything is cleared
+{
+  long delay_n = (long)(_max_delay_msec * 1e-3f * sampleRate);
+  long blk_n = max((long)blockSize, (long)MIN_X3_BLK_N);
+
+  // output buffer: the delay plus the largest fft blk & a host block
+  long x3_sz = delay_n + MAX_FFT_SZ + blk_n;
+
+  // input buffer: blks can be held back until the delay forces them out, x0 holds that plus room
+  // to force out the largest fft blk (rounded up to the mapping granularity)
+  long x0_sz = delay_n + 2 * MAX_FFT_SZ + blk_n;
+
+  // x0 is only remapped if it's too small or more than twice the size needed (mapping is slow)
+  bool resized = false;
+  if (_x0_sz < x0_sz || _x0_sz > 2 * x0_sz) {
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      _chan[i].x0.resize(x0_sz);
+    _x0_sz = _chan[0].x0.size();            // a multiple of the page size so always aligned
+    _x0_force_out_sz = _x0_sz - MAX_FFT_SZ; // force output when x0 contains this much data
+    resized = true;
+  }
+  if (_x3_sz != x3_sz) {
+    _x3_sz = x3_sz;
+    carveArena();
+    resized = true;
+  }
+  updateMaxDelay();
+
+  if (resized)
+    init();
+}
+
+//-------------------------------------------------------------------------------------------------
+size_t DtBlkFx::getMemBytes() const
+{
+  size_t n = sizeof(*this);
+
+  // x1 & x2 (1 or 2 sets, see setBlkPipeline), x3, the power caches & the pending gain
+  n += _arena.size();
+
+  // x0 (physical memory, it's mapped twice)
+  n += AUDIO_CHANNELS * _chan[0].x0.size() * sizeof(float);
+
+  // async FIFOs & worker copy
+  n += AUDIO_CHANNELS * (_async.in.size() + _async.out.size() + _async_tmp[0].size()) *
+       sizeof(float);
+
+  // spectrogram snapshots
+  n += _spec_snap.memBytes();
+
+  // param delay records
+  n += _params.memBytes();
+
+  // programs & the chunk last given to the host
+  n += _program.capacity() * sizeof(BlkFxProgram) + _chunk_data.size();
+
+  // morph anchors
+  const MorphParam* morph[] = {&_mixback_param,
+                               &_delay_param,
+                               &_fft_len_param,
+                               &_overlap_param,
+                               &_pwr_match_param,
+                               &_beat_sync_param,
+                               &_param_sync_param,
+                               &_blk_shoulder_frac_param,
+                               &_blk_shoulder_wdw_param,
+                               &_blk_mix_param};
+  for (size_t i = 0; i < NUM_ELEMENTS(morph); i++)
+    n += morph[i]->memBytes();
+  for (int i = 0; i < BlkFxParam::NUM_FX_SETS; i++)
+    for (int j = 0; j < BlkFxParam::NUM_FX_PARAMS; j++)
+      n += _fx1_0[i]._param[j].memBytes();
+
+  return n;
 }
 
 struct MyInfo : public VstTimeInfo {
@@ -603,18 +802,35 @@ inline void DtBlkFx::pollUpdate(bool force)
     return;
 
   // ask host for tempo
-  VstTimeInfo* ti = getTimeInfo(kVstTempoValid | kVstPpqPosValid);
+  VstTimeInfo* ti;
+  VstTimeInfo worker_ti;
+  long ti_samp_abs = _curr_samp_abs;
+  if (_async_worker_active) {
+    // the worker can't call the host, it gets the info (and the sample position that it
+    // corresponds to) from the audio thread so it will be ready some time later
+    if (!_async.takeTimeInfo(&worker_ti, &ti_samp_abs))
+      return;
+    ti = &worker_ti;
+  }
+  else {
+    ti = getTimeInfo(kVstTempoValid | kVstPpqPosValid);
+
+    // the governor is off when rendering offline (the worker keeps the level from the audio thread)
+    _offline = getCurrentProcessLevel() == kVstProcessLevelOffline;
+  }
+
   if (ti) {
     //((MyInfo*)ti)->dbgprint();
     if (ti->flags & kVstTempoValid)
       _samps_per_beat = (float)(60.0 * sampleRate / ti->tempo);
 
-    float ppq_pos = (float)ti->ppqPos;
-    float ppq_frac = ppq_pos - floorf(ppq_pos);
+    double ppq_frac = ti->ppqPos - floor(ti->ppqPos);
 
-    // work out sample position of the start of the current beat
+    // work out sample position of the start of the current beat (rounded, the async worker
+    // gets the info at a different sample position to the audio thread & must get the same
+    // beat start)
     if (ti->flags & kVstPpqPosValid)
-      _beat_start_abs = _curr_samp_abs - (long)(ppq_frac * _samps_per_beat);
+      _beat_start_abs = ti_samp_abs - (long)floor(ppq_frac * _samps_per_beat + 0.5);
   }
 
   // calculate samples per tick (based on tempo)
@@ -624,7 +840,7 @@ inline void DtBlkFx::pollUpdate(bool force)
   _params.setExpectedDist((long)(_samps_per_beat * .25f));
 
   // LOG("", "pollUpdate"
-  // <<VAR(_samps_per_beat)<<VAR(ppq_pos)<<VAR(ppq_frac)<<VAR(_beat_start_abs));
+  // <<VAR(_samps_per_beat)<<VAR(ppq_frac)<<VAR(_beat_start_abs));
 
   // poll every beat
   _samps_per_poll = (long)(_samps_per_beat);
@@ -646,6 +862,11 @@ void DtBlkFx::setParameter(VstInt32 index, float value)
   // safety
   value = limit_range(value, 0.0f, 1.0f);
 
+  // start measuring the fft plan now rather than when the first blk of the new size is processed
+  // (this happens for every program or chunk loaded, nothing to do unless measuring)
+  if (index == _fft_len_param.vstParamIdx())
+    RequestFFTWfPlan(BlkFxParam::getPlan(value));
+
   //
   ScopeCriticalSection scs(_protect);
 
@@ -880,15 +1101,18 @@ bool DtBlkFx::getVendorString(char* text)
 inline void DtBlkFx::copyInBuf(float** in_buf_, long buf_n)
 // internal method
 // copy input data into the pre-fft buffer
-// note that we are allowed to copy data beyond the end of our normal wrap position. The x0 buffer
-// contains extra memory corresponding to the length of largest fft blk.
+// note that we are allowed to copy data beyond the end of our normal wrap position, x0 is mapped
+// twice so it lands at the start of the buffer
 //
 // assume that we don't get blocks bigger than our buffer size (several seconds worth of data)
 {
+  SCOPE_STAGE_TIMER(STAGE_COPY_IN_BUF);
+
   long in_buf_offs = 0;
   while (buf_n) {
-    // how many samples to copy
-    long n = buf_n;
+    // how many samples to copy, can't write more than one copy of the buffer at a time - I don't
+    // expect this to ever happen (this is the only way that the loop could run more than once)
+    long n = min(buf_n, _x0_sz);
 
     // offset into buffer at which to write data
     long t = _x0_i + _x0_n;
@@ -897,26 +1121,20 @@ inline void DtBlkFx::copyInBuf(float** in_buf_, long buf_n)
     if (t >= _x0_sz)
       t -= _x0_sz;
 
-    // find how much the copy will overflow past _x0_sz
-    long overflow = t + buf_n - _x0_sz;
-
-    // don't overflow at all if there's too much data - I don't expect this to ever happen
-    // (this is the only way that the loop could run more than once)
-    if (overflow > MAX_FFT_SZ) {
-      n -= overflow;
-      overflow = 0;
-    }
-    if (overflow >= 0)
-      _x0_n_past_end = overflow;
-
     // copy all data into buffer (note that this may be past _x0_sz, which is fine)
     for (int i = 0; i < AUDIO_CHANNELS; i++) {
       float* x0_dat = _chan[i].x0;
       Copy(x0_dat + t, in_buf_[i] + in_buf_offs, n);
 
-      // copy any overflowed data to start of buffer
-      if (overflow > 0)
-        Copy(x0_dat, x0_dat + _x0_sz, overflow);
+      // find the last sample that isn't silent (from the end, so each input sample is only
+      // looked at once & loud input stops straight away)
+      const float* in = in_buf_[i] + in_buf_offs;
+      for (long j = n - 1; j >= 0; j--) {
+        if (fabsf(in[j]) >= SILENCE_LEVEL) {
+          _loud_end_abs = max(_loud_end_abs, _blk_samp_abs + _x0_n + j + 1);
+          break;
+        }
+      }
     }
 
     buf_n -= n;
@@ -991,20 +1209,38 @@ inline void DtBlkFx::paramsChk()
   if (_params_state == PARAMS_NONINTERP && _params.setOutPos(src_fft_abs))
     _params_state = PARAMS_INTERP_OK;
 
+  // output position has (probably) moved
+  _blk_params_ok = false;
+  const BlkParams& bp = blkParams();
+
   // number of samples to do fft blk
-  _plan = BlkFxParam::getPlan(get(&GetInterp, _fft_len_param));
+  _plan = BlkFxParam::getPlan(bp.fft_len);
+
+  // the governor halves the fft for each step it has dropped
+  if (_governor_on && _gov.planDrop())
+    _plan = reducePlan(_plan, (g_fft_sz[_plan] / 2) >> _gov.planDrop());
+
+  // every size has an estimated plan, the measured plan might not have been made yet: on the
+  // worker thread or when rendering offline we can wait for it, otherwise the planner thread
+  // swaps it in when it's ready
+  if (!FFTWfPlanFinal(_plan)) {
+    if (_async_worker_active || _offline)
+      WarmFFTWfPlan(_plan);
+    else
+      RequestFFTWfPlan(_plan);
+  }
   _freq_fft_n = g_fft_sz[_plan];
 
   // this is how much of the blk we want to process
   _time_fft_n =
-      (int)((float)_freq_fft_n * lin_interp(get(&GetInterp, _blk_shoulder_frac_param), 1.0f, .25f));
+      (int)((float)_freq_fft_n * lin_interp(bp.blk_shoulder_frac, 1.0f, .25f));
 
   // center the data to be processed (this will be adjusted if there isn't enough data to fill
   // the blk)
   _data_pre_x0_n = (_freq_fft_n - _time_fft_n) / 2;
 
   // find (possible) output position of the current blk using current delay
-  _delay_n = getDelaySamps(get(&GetInterp, _delay_param));
+  _delay_n = getDelaySamps(bp.delay);
   _dst_fft_abs = src_fft_abs + _delay_n;
 
   // make sure dest position isn't in data that we've already output (i.e. behind current sample
@@ -1066,6 +1302,118 @@ inline void DtBlkFx::findBlkInPos()
     }
   }
 }
+//-------------------------------------------------------------------------------------------------
+inline bool /*true=skip the blk*/ DtBlkFx::silentBlk()
+// internal method
+// check whether the input of the current blk (everything the fft would see) is silent & the
+// output from the blks before it that this blk would cross-fade with has decayed, if so the blk
+// adds nothing & is skipped (x3 is zero filled by zeroFillOutput, the next blk that isn't silent
+// fades in from there as it would after a gap)
+//
+// the input is silent if it stays below SILENCE_LEVEL after the gain of the effects (_fx_gain,
+// from prepareFx) so input that the effects boost over it isn't dropped
+{
+  // doFFT can round the start of the fft down by up to ~X0_INDEX_ROUNDING_MASK samples (for
+  // alignment), those are checked too (there's no input before sample 0)
+  long pre_n = _data_pre_x0_n + ~X0_INDEX_ROUNDING_MASK;
+  if (_loud_end_abs > max(0L, _blk_samp_abs - pre_n))
+    return false;
+
+  // quiet at the fixed level, check it again at the level that the effects boost to
+  if (_fx_gain > 1.0f) {
+    PPeak p;
+    for (int i = 0; i < AUDIO_CHANNELS; i++) {
+      Rng<float> x0(_chan[i].x0, _x0_sz);
+      wrapProcess(p, x0, _x0_i - pre_n, pre_n + _x0_n);
+    }
+    if (p.peak * _fx_gain >= SILENCE_LEVEL)
+      return false;
+  }
+
+  // the blk before may still be held by the pipeline
+  flushBlkOut();
+  if (_x3_is_clear)
+    return true;
+
+  // output from _dst_fft_abs on (_dst_fft_abs is never before _curr_samp_abs)
+  long tail_n = _x3_end_abs - _dst_fft_abs;
+  if (tail_n > 0) {
+    PPeak p;
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      wrapProcess(p, _chan[i].x3, _x3_o + _dst_fft_abs - _curr_samp_abs, tail_n);
+    if (p.peak >= SILENCE_LEVEL)
+      return false;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline float* DtBlkFx::xformBuf(int ch)
+// internal method
+// time-domain buffer that channel "ch" is transformed from/to, each channel has its own x2 when
+// they are transformed together (or in parallel) otherwise always use channel 0 to improve
+// caching performance
+{
+  return _chan[BATCH_FFT || _par_chans_on ? ch : 0].x2;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::shoulderToX2(int ch)
+// internal method
+// copy x0 data of channel "ch" to its xformBuf() applying the shoulder window
+{
+  // position within x0
+  long x0_x = _xform_x0_i;
+
+  // get x0 data range excluding overflow region
+  Rng<float> x0(_chan[ch].x0, _x0_sz);
+
+  // apply window to left shoulder
+  PLinInterp<PScaleCopyOut> p0(_shoulder_fn, _shoulder_fn_n);
+  p0.proc.dst = xformBuf(ch);
+  x0_x = wrapProcess(p0, x0, x0_x, _shoulder_n);
+
+  // copy mid section directly
+  PCopyOut p1;
+  p1.dst = p0.proc.dst;
+  x0_x = wrapProcess(p1, x0, x0_x, _freq_fft_n - _shoulder_n * 2);
+
+  // apply window to right shoulder
+  PLinInterp<PScaleCopyOut, /*reverse*/ 1> p2(_shoulder_fn, _shoulder_fn_n);
+  p2.proc.dst = p1.dst;
+  x0_x = wrapProcess(p2, x0, x0_x, _shoulder_n);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::scaleSpectrum(int ch)
+// internal method
+// scale spectrum of channel "ch" and find power for power matching, nothing is in its power cache
+{
+  float acc = g_spec_kernels->scalePwr(FFTdata(ch), _freq_fft_n / 2 + 1, 1.0f / (float)_freq_fft_n);
+  _chan[ch].total_out_pwr = acc;
+  _chan[ch].total_in_pwr = acc;
+  _chan[ch].pwr.reset(FFTdata(ch), _freq_fft_n / 2 + 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::doFFTChan(int ch)
+// internal method (may be called on a ChanPool thread)
+// window & fft channel "ch" on its own
+{
+  if (_shoulder_n > 0) {
+    shoulderToX2(ch);
+    FFTWf::execute_dft_r2c(g_fft_plan[_plan], xformBuf(ch), to_fftwf_complex(FFTdata(ch)));
+  }
+  else {
+    // no windowing of data, do the fft straight out of x0 (contiguous even if it has wrapped
+    // past the end because x0 is mapped twice)
+    float* x0_dat = _chan[ch].x0;
+    FFTWf::execute_dft_r2c(
+        g_fft_plan[_plan], x0_dat + _xform_x0_i, to_fftwf_complex(FFTdata(ch)));
+  }
+  scaleSpectrum(ch);
+}
+
 //-------------------------------------------------------------------------------------------------
 inline void DtBlkFx::doFFT()
 // internal method
@@ -1073,57 +1421,33 @@ inline void DtBlkFx::doFFT()
 // perform windowing on shoulder (if need be) and FFT on all channels
 //
 {
+  SCOPE_STAGE_TIMER(STAGE_DO_FFT);
+
   int i;
 
   // work out where we'll transform from
-  long x0_xform_i = _x0_i - _data_pre_x0_n;
-  if (x0_xform_i < 0)
-    x0_xform_i += _x0_sz;
+  _xform_x0_i = _x0_i - _data_pre_x0_n;
+  if (_xform_x0_i < 0)
+    _xform_x0_i += _x0_sz;
 
   // find the amount of shoulder data that we can apply a window function to (window is symmetrical)
-  int shoulder_n =
+  _shoulder_n =
       min(/*right*/ _data_pre_x0_n, /*left*/ _freq_fft_n - _time_fft_n - _data_pre_x0_n);
 
   // if the shoulder windowing needs to be applied then we'll copy input data to "x2", window and
   // then transform
-  if (shoulder_n > /*arbirary*/ 12) {
-
+  if (_shoulder_n > /*arbirary*/ 12) {
     // get the shoulder function to apply
-    Array<float, 48> shoulder_fn;
-    int shoulder_fn_n = get(&GetInterp, _blk_shoulder_wdw_param, shoulder_fn);
-
-    for (i = 0; i < AUDIO_CHANNELS; i++) {
-      // position within x0
-      long x0_x = x0_xform_i;
-
-      // get x0 data range excluding overflow region
-      Rng<float> x0(_chan[i].x0, _x0_sz);
-
-      // apply window to left shoulder
-      PLinInterp<PScaleCopyOut> p0(shoulder_fn, shoulder_fn_n);
-      p0.proc.dst = _chan[0].x2; // always channel 0 to improve caching performance
-      x0_x = wrapProcess(p0, x0, x0_x, shoulder_n);
-
-      // copy mid section directly
-      PCopyOut p1;
-      p1.dst = p0.proc.dst;
-      x0_x = wrapProcess(p1, x0, x0_x, _freq_fft_n - shoulder_n * 2);
-
-      // apply window to right shoulder
-      PLinInterp<PScaleCopyOut, /*reverse*/ 1> p2(shoulder_fn, shoulder_fn_n);
-      p2.proc.dst = p1.dst;
-      x0_x = wrapProcess(p2, x0, x0_x, shoulder_n);
-
-      // and do the fft
-      FFTWf::execute_dft_r2c(g_fft_plan[_plan], _chan[0].x2, to_fftwf_complex(FFTdata(i)));
-    }
+    _shoulder_fn_n = _blk_shoulder_wdw_param.get(blkParams().vst, _shoulder_fn);
   }
   else {
+    _shoulder_n = 0;
+
     // do some data alignment to keep fftw happy
 
     // adjust pre-data to do the rounding
-    int round_down = x0_xform_i & ~X0_INDEX_ROUNDING_MASK;
-    x0_xform_i -= round_down;
+    int round_down = _xform_x0_i & ~X0_INDEX_ROUNDING_MASK;
+    _xform_x0_i -= round_down;
     _extra_data += round_down;
     _data_pre_x0_n += round_down;
     _time_fft_n -= round_down;
@@ -1132,40 +1456,50 @@ inline void DtBlkFx::doFFT()
     ASSERTX(_time_fft_n >= 0, VAR(_time_fft_n));
     if (_time_fft_n < 0)
       _time_fft_n = 0;
+  }
 
-    // no windowing of data, make sure it is contiguous in x0 if it has wrapped past the end
-    long x0_sz_ext = _x0_sz + _x0_n_past_end;
-    long split_n = (x0_xform_i + _freq_fft_n) - x0_sz_ext;
-    if (split_n > 0) {
-      for (i = 0; i < AUDIO_CHANNELS; i++) {
-        float* x0_dat = _chan[i].x0;
-        Copy(x0_dat + x0_sz_ext, x0_dat + _x0_n_past_end, split_n);
-      }
-      _x0_n_past_end += split_n;
-    }
-
-    // do the fft
-    for (i = 0; i < AUDIO_CHANNELS; i++) {
-      float* x0_dat = _chan[i].x0;
-      FFTWf::execute_dft_r2c(g_fft_plan[_plan], x0_dat + x0_xform_i, to_fftwf_complex(FFTdata(i)));
-    }
+  // each channel on its own thread
+  if (_par_chans_on)
+    RunChanTasks(&ChanTaskThunk<DtBlkFx, &DtBlkFx::doFFTChan>, this, AUDIO_CHANNELS);
+
+  // windowed channels all at once
+  else if (BATCH_FFT && _shoulder_n > 0) {
+    for (i = 0; i < AUDIO_CHANNELS; i++)
+      shoulderToX2(i);
+    FFTWf::execute_dft_r2c(g_fft_batch_plan[_plan], _chan[0].x2, to_fftwf_complex(FFTdata(0)));
+    for (i = 0; i < AUDIO_CHANNELS; i++)
+      scaleSpectrum(i);
   }
 
-  // scale spectrum and find power for power matching
-  float scale = 1.0f / (float)_freq_fft_n;
-  for (i = 0; i < AUDIO_CHANNELS; i++) {
-    // find power of spectrum (so that we can match to this afterwards)
-    float acc = 0.0f;
+  // one channel at a time
+  else {
+    for (i = 0; i < AUDIO_CHANNELS; i++)
+      doFFTChan(i);
+  }
+}
 
-    CplxfPtrPair in(FFTdata(i), _freq_fft_n / 2 + 1);
-    for (; !in.equal(); in.a++) {
-      in() = in() * scale;
-      acc += norm(*in.a);
-    }
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::snapSpectrum(int in_out // SpecSnap::IN after doFFT, SpecSnap::OUT after
+                                             // procFFT (which commits the snapshot)
+)
+// internal method, copy the power spectrum of the current blk for the spectrogram display
+{
+  SCOPE_STAGE_TIMER(STAGE_GUI_SNAP);
+  SpecSnap& snap = _spec_snap.pending();
 
-    _chan[i].total_out_pwr = acc;
-    _chan[i].total_in_pwr = acc;
+  // if the gui is behind this blk is merged with the pending one (unless the fft size differs)
+  bool merge = _spec_snap.pendingBlks() > 0 && snap.plan == _plan;
+  for (int i = 0; i < AUDIO_CHANNELS; i++) {
+    float pwr_scale = in_out == SpecSnap::OUT ? _chan[i].out_pwr_scale : 1.0f;
+    snap.set(in_out, i, FFTdata(i), _freq_fft_n, pwr_scale, merge);
   }
+  if (in_out != SpecSnap::OUT)
+    return;
+
+  snap.plan = _plan;
+  snap.samp_pos = _blk_samp_abs;
+  snap.time_fft_n = _time_fft_n;
+  _spec_snap.commit();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1176,6 +1510,8 @@ inline void DtBlkFx::prepMixOut()
 // with the previous blk (_fadein_n & _fadeout_n)
 //
 {
+  SCOPE_STAGE_TIMER(STAGE_PREP_MIX_OUT);
+
   // the amount of xfade-in corresponds to the overlap of this fft blk with existing data
   _fadein_n = _x3_end_abs - _dst_fft_abs;
 
@@ -1256,61 +1592,177 @@ inline void DtBlkFx::prepMixOut()
     _fadein_n = _time_fft_n;
 }
 
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::flushGain()
+// internal method
+{
+  if (_gain_b0 > _gain_b1)
+    return;
+
+  long n = _gain_b1 - _gain_b0 + 1;
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+    g_spec_kernels->scaleBins(FFTdata(ch) + _gain_b0, n, _gain + _gain_b0);
+  pwrDirty(_gain_b0, _gain_b1);
+
+  std::fill(_gain + _gain_b0, _gain + _gain_b1 + 1, 1.0f);
+  _gain_b0 = 1;
+  _gain_b1 = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::outPwrChan(int ch)
+// internal method (may be called on a ChanPool thread)
+// work out the output scaling of channel "ch" after the effects
+{
+  // whatever the last slots only read is already in the power cache
+  double out_pwr = bandPwr(ch, 0, _freq_fft_n / 2);
+
+  // match the output to the input power
+  // power match mode, scale output to match input power
+  double pwr_scale = 1.0f;
+  if (out_pwr > 1e-30)
+    pwr_scale *= _chan[ch].total_in_pwr / out_pwr;
+
+  if (pwr_scale > 1e30)
+    pwr_scale = 1.0f; // too big
+  if (pwr_scale < 1e-30)
+    pwr_scale = 0.0f; // too small (or worse, negative)
+
+  _chan[ch].out_pwr_scale = lin_interp(_pwr_match, 1.0f, (float)pwr_scale);
+  _chan[ch].out_scale = sqrtf(_chan[ch].out_pwr_scale);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::compileBlkParams()
+// internal method
+// work out all of the morphed params for the current _params output position
+{
+  using namespace BlkFxParam;
+  BlkParams& bp = _blk_params;
+
+  // each vst param is interpolated once, the morph params index these
+  _params.getInterpAll(bp.vst);
+
+  bp.mixback = _mixback_param(bp.vst);
+  bp.delay = _delay_param(bp.vst);
+  bp.fft_len = _fft_len_param(bp.vst);
+  bp.overlap = _overlap_param(bp.vst);
+  bp.pwr_match = _pwr_match_param(bp.vst);
+  bp.beat_sync = _beat_sync_param(bp.vst);
+  bp.blk_shoulder_frac = _blk_shoulder_frac_param(bp.vst);
+
+  for (int i = 0; i < NUM_FX_SETS; i++) {
+    float* fx = bp.fx[i];
+    for (int j = 0; j < NUM_FX_PARAMS; j++)
+      fx[j] = _fx1_0[i]._param[j](bp.vst);
+
+    // don't interpolate the effect type
+    fx[FX_TYPE] = _fx1_0[i]._param[FX_TYPE](GetPrev(_params));
+  }
+  _blk_params_ok = true;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline bool /*true=the effects leave the spectrum as it is*/ DtBlkFx::prepareFx()
+// internal method
+// collect the params of all of the 1.0 effects for the current blk & work out the most that
+// they can boost the input by (_fx_gain, see silentBlk)
+{
+  bool identity = true;
+  _fx_gain = 1.0f;
+  for (int i = 0; i < BlkFxParam::NUM_FX_SETS; i++) {
+    FxState1_0& s = _fx1_0[i];
+    s.prepare();
+    if (!s.temp.fft_fx->isIdentity(&s))
+      identity = false;
+    if (s.temp.fft_fx->paramUsed(BlkFxParam::FX_AMP) && s.temp.amp > 1.0f)
+      _fx_gain *= s.temp.amp;
+  }
+  return identity;
+}
+
 //-------------------------------------------------------------------------------------------------
 inline void DtBlkFx::procFFT()
 // internal method
 // process the FFT'd data (x1) using the fx_params
 {
+  SCOPE_STAGE_TIMER(STAGE_PROC_FFT);
+
   int i;
 
-  // run all of the 1.0 effects (collect params first & then process)
-  for (i = 0; i < BlkFxParam::NUM_FX_SETS; i++)
-    _fx1_0[i].prepare();
-  for (i = 0; i < BlkFxParam::NUM_FX_SETS; i++)
+  // run all of the 1.0 effects (their params were collected by prepareFx)
+  for (i = 0; i < BlkFxParam::NUM_FX_SETS; i++) {
+    ScopeStageTimer slot_timer(_stage_times, STAGE_FX_SLOT_0 + i, _stage_timing_on);
+    FxRun1_0* fx = _fx1_0[i].temp.fft_fx;
+
+    // amplitude-only slots just collect their gain, consecutive ones are applied in one pass
+    // (masks that look at the data apply what's pending first)
+    if (fx->gainOnly()) {
+      _fx1_0[i].processGain();
+      continue;
+    }
+    flushGain();
     _fx1_0[i].process();
 
+    // the mask drivers drop the bins written by well behaved effects from the power cache
+    if (!fx->writesRunBinsOnly())
+      pwrDirtyAll();
+  }
+  flushGain();
+
   // power match amount
-  float pwr_match = get(&GetInterp, _pwr_match_param);
+  _pwr_match = blkParams().pwr_match;
 
   // post process, work pwr out scaling
-  for (i = 0; i < AUDIO_CHANNELS; i++) {
-
-    float out_pwr = GetPwr(FFTdata(i), _freq_fft_n / 2 + 1);
-
-    // match the output to the input power
-    // power match mode, scale output to match input power
-    double pwr_scale = 1.0f;
-    if (out_pwr > 1e-30)
-      pwr_scale *= _chan[i].total_in_pwr / out_pwr;
-
-    if (pwr_scale > 1e30)
-      pwr_scale = 1.0f; // too big
-    if (pwr_scale < 1e-30)
-      pwr_scale = 0.0f; // too small (or worse, negative)
-
-    _chan[i].out_pwr_scale = lin_interp(pwr_match, 1.0f, (float)pwr_scale);
-    _chan[i].out_scale = sqrtf(_chan[i].out_pwr_scale);
+  if (_par_chans_on)
+    RunChanTasks(&ChanTaskThunk<DtBlkFx, &DtBlkFx::outPwrChan>, this, AUDIO_CHANNELS);
+  else {
+    for (i = 0; i < AUDIO_CHANNELS; i++)
+      outPwrChan(i);
   }
 }
 
 //-------------------------------------------------------------------------------------------------
-template <class SRC> inline void DtBlkFx::mixToX3(SRC src, int ch)
+inline void DtBlkFx::latchBlkOut()
 // internal method
+// take everything needed to mix the current blk to x3 (after prepMixOut)
+{
+  BlkOut& o = _blk_out[_blk_out_i];
+  o.plan = _plan;
+  o.x3_o = _dst_fft_abs - _curr_samp_abs + _x3_o;
+  o.time_fft_n = _time_fft_n;
+  o.data_pre_x0_n = _data_pre_x0_n;
+  o.fadein_n = _fadein_n;
+  o.fadeout_n = _fadeout_n;
+  o.x0_i = _x0_i;
+  o.mixback = _mixback;
+  o.mix_fn = _blk_mix_fn;
+  o.mix_fn_n = _blk_mix_fn_n;
+  for (int i = 0; i < AUDIO_CHANNELS; i++) {
+    o.fft_data[i] = FFTdata(i);
+    o.xform_buf[i] = xformBuf(i);
+    o.out_scale[i] = _chan[i].out_scale;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+template <class SRC> inline void DtBlkFx::mixToX3(BlkOut& o, SRC src, int ch)
+// internal method (may be called on a ChanPool thread)
 //
 {
   // position to start fade-in
-  long x3_o = _dst_fft_abs - _curr_samp_abs + _x3_o;
+  long x3_o = o.x3_o;
 
   // use lerp'd mix function for fade in
-  if (_fadein_n > 0) {
-    PLinInterp<PMix<SRC>> p(_blk_mix_fn, _blk_mix_fn_n);
+  if (o.fadein_n > 0) {
+    PLinInterp<PMix<SRC>> p(o.mix_fn, o.mix_fn_n);
     p.proc.src = src;
-    x3_o = wrapProcess(p, _chan[ch].x3, x3_o, _fadein_n);
+    x3_o = wrapProcess(p, _chan[ch].x3, x3_o, o.fadein_n);
     src = p.proc.src;
   }
 
   // number of samples in mid section
-  long cp_n = _time_fft_n - _fadein_n - _fadeout_n;
+  long cp_n = o.time_fft_n - o.fadein_n - o.fadeout_n;
 
   // copy mid section
   if (cp_n > 0) {
@@ -1321,11 +1773,11 @@ template <class SRC> inline void DtBlkFx::mixToX3(SRC src, int ch)
   }
 
   // linear cross-mix
-  if (_fadeout_n > 0) {
+  if (o.fadeout_n > 0) {
     PSrcDstWrap<SRC, PMixDst> p;
     p.src = src;
     p.dst.setMix(/*start*/ 0, /*end*/ 1);
-    wrapProcess(p, _chan[ch].x3, x3_o, _fadeout_n);
+    wrapProcess(p, _chan[ch].x3, x3_o, o.fadeout_n);
   }
 }
 
@@ -1458,47 +1910,143 @@ void LineMix(float* data_0,   // in data array
 }
 
 //-------------------------------------------------------------------------------------------------
-inline void DtBlkFx::ifftAndMixOut()
-// internal method
-// perform ifft & mix to output
+void DtBlkFx::mixOutChan(int ch)
+// internal method (may be called on a ChanPool thread)
+// fade-in, direct copy and fade-out of channel "ch" of *_mix_out to output buffer (after the ifft)
 {
-  // do iFFT, then fade-in, direct copy and fade-out to output buffer
-  for (int i = 0; i < AUDIO_CHANNELS; i++) {
-    Chan& chan = _chan[i];
-    float* x2 = _chan[0].x2; // always use x2 from ch0 to help cache performance
-
-    // inverse fft, always ifft into channel-0 x2 to improve cache hits
-    FFTWf::execute_dft_c2r(g_ifft_plan[_plan], /*in*/ to_fftwf_complex(FFTdata(i)), /*out*/ x2);
+  BlkOut& o = *_mix_out;
 
-    // skip pre data
-    x2 += _data_pre_x0_n;
+  // skip pre data
+  float* x2 = o.xform_buf[ch] + o.data_pre_x0_n;
 
 #if 0
-    // scale data
-    for(int j = 0; j < _time_fft_n; j++) x2[j] *= chan.out_scale;
+  // scale data
+  for(int j = 0; j < o.time_fft_n; j++) x2[j] *= o.out_scale[ch];
 
-    // line mixer
-    float* x1 = (float*)chan.x1.ptr;
-    LineMix(/*in*/x2, /*in*/chan.x0+_x0_i, /*out*/x1, _time_fft_n, _mixback, /*yscale*/100);
-    mixToX3(P1Src(x1, /*scale*/1), i);
+  // line mixer
+  float* x1 = (float*)_chan[ch].x1;
+  LineMix(/*in*/x2, /*in*/_chan[ch].x0+o.x0_i, /*out*/x1, o.time_fft_n, o.mixback, /*yscale*/100);
+  mixToX3(o, P1Src(x1, /*scale*/1), ch);
 #endif
 
-    // output data is completely fft blk
-    float x2_scale = (1.0f - _mixback) * chan.out_scale;
-    if (_mixback <= 0.0f)
-      mixToX3(P1Src(x2, x2_scale), i);
+  // output data is completely fft blk
+  float x2_scale = (1.0f - o.mixback) * o.out_scale[ch];
+  if (o.mixback <= 0.0f)
+    mixToX3(o, P1Src(x2, x2_scale), ch);
 
-    else {
-      // output data is a mix of original and processed
-      P2Src src;
-      float* x0_dat = chan.x0;
-      src.a = P1Src(x0_dat + _x0_i, _mixback);
-      src.b = P1Src(x2, x2_scale);
-      mixToX3(src, i);
-    }
+  else {
+    // output data is a mix of original and processed
+    P2Src src;
+    float* x0_dat = _chan[ch].x0;
+    src.a = P1Src(x0_dat + o.x0_i, o.mixback);
+    src.b = P1Src(x2, x2_scale);
+    mixToX3(o, src, ch);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::ifftChan(int ch)
+// internal method (may be called on a ChanPool thread)
+// inverse fft channel "ch" of *_mix_out on its own & mix to output
+{
+  BlkOut& o = *_mix_out;
+  FFTWf::execute_dft_c2r(
+      g_ifft_plan[o.plan], /*in*/ to_fftwf_complex(o.fft_data[ch]), /*out*/ o.xform_buf[ch]);
+  mixOutChan(ch);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::ifftAndMixOut(BlkOut& o)
+// internal method (may be called on a ChanPool thread)
+// perform ifft of blk "o" & mix to output
+{
+  SCOPE_STAGE_TIMER(STAGE_IFFT_MIX_OUT);
+
+  _mix_out = &o;
+
+  // each channel on its own thread
+  if (_par_chans_on)
+    RunChanTasks(&ChanTaskThunk<DtBlkFx, &DtBlkFx::ifftChan>, this, AUDIO_CHANNELS);
+
+  // inverse fft of all channels at once, each into its own x2
+  else if (BATCH_FFT) {
+    FFTWf::execute_dft_c2r(g_ifft_batch_plan[o.plan],
+                           /*in*/ to_fftwf_complex(o.fft_data[0]),
+                           /*out*/ o.xform_buf[0]);
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      mixOutChan(i);
+  }
+
+  // otherwise inverse fft one channel at a time
+  else {
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      ifftChan(i);
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::directMixChan(int ch)
+// internal method (may be called on a ChanPool thread)
+// mix x0 of channel "ch" straight to output (no ffts because 100% mixback)
+{
+  BlkOut& o = *_mix_out;
+  float* x0_dat = _chan[ch].x0;
+  mixToX3(o, P1Src(x0_dat + o.x0_i), ch);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::directMixOut(BlkOut& o)
+// internal method
+// mix blk "o" straight from the input to output
+{
+  SCOPE_STAGE_TIMER(STAGE_IFFT_MIX_OUT);
+
+  _mix_out = &o;
+  if (_par_chans_on)
+    RunChanTasks(&ChanTaskThunk<DtBlkFx, &DtBlkFx::directMixChan>, this, AUDIO_CHANNELS);
+  else {
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      directMixChan(i);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::fftAndEffects()
+// internal method
+// fft the current blk & run the effects
+{
+  doFFT();
+  bool snap = _spec_snap.producerBegin();
+  if (snap)
+    snapSpectrum(SpecSnap::IN);
+
+  procFFT();
+  if (snap)
+    snapSpectrum(SpecSnap::OUT);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::pipelineTask(int i)
+// internal method (may be called on a ChanPool thread)
+// blk pipeline: 0=fft & effects of the current blk (calling thread), 1=mix the previous blk
+{
+  if (i == 0)
+    fftAndEffects();
+  else
+    ifftAndMixOut(_blk_out[_blk_out_i ^ 1]);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void DtBlkFx::flushBlkOut()
+// internal method
+// mix the previous blk if the pipeline is still holding it
+{
+  if (!_blk_out_pending)
+    return;
+  ifftAndMixOut(_blk_out[_blk_out_i ^ 1]);
+  _blk_out_pending = false;
+}
+
 //-------------------------------------------------------------------------------------------------
 inline void DtBlkFx::nextBlk()
 // internal method
@@ -1506,12 +2054,19 @@ inline void DtBlkFx::nextBlk()
 //
 {
   // get next blk forward
-  _next_blk_fwd_n = BlkFxParam::getBlkShiftFwd(get(&GetInterp, _overlap_param), _time_fft_n);
+  const BlkParams& bp = blkParams();
+  float overlap = bp.overlap;
+
+  // the governor halves the overlap for each step it has dropped (bp.overlap is already the
+  // overlap part, beat sync is _beat_sync_param)
+  if (_governor_on && _gov.overlapDrop())
+    overlap = CpuGovernor::dropOverlap(overlap, _gov.overlapDrop());
+  _next_blk_fwd_n = BlkFxParam::getBlkShiftFwd(overlap, _time_fft_n);
 
   // get the next overlap param to see if blksync is on
 
   // synchronize next blk to start-of-beat position if beat_sync
-  float beat_sync = get(&GetInterp, _beat_sync_param) * _samps_per_beat;
+  float beat_sync = bp.beat_sync * _samps_per_beat;
   if (beat_sync > /*arbitrary*/ 16) {
     // next blk sample position as determined from current overlap param
     long next_blk_samp_abs = _blk_samp_abs + _next_blk_fwd_n;
@@ -1538,6 +2093,8 @@ inline void DtBlkFx::zeroFillOutput()
 // increased in some cases
 //
 {
+  SCOPE_STAGE_TIMER(STAGE_ZERO_FILL);
+
   long zero_n = _buf_end_abs - _x3_end_abs;
   if (zero_n <= 0 || _x3_is_clear)
     return;
@@ -1573,8 +2130,27 @@ inline void DtBlkFx::zeroFillOutput()
 inline void DtBlkFx::_process(float** in_buf, long buf_n)
 // internal method
 {
+  // latch stage timing & the governor for the whole call
+  bool timing = _stage_timing;
+  bool governor = _governor && !_offline;
+  StageTicks t_enter = timing || governor ? GetStageTicks() : 0;
+
   ScopeCriticalSection scs(_protect);
 
+  _stage_timing_on = timing;
+  _par_chans_on = _par_chans;
+  if (_governor_on && !governor)
+    _gov.reset();
+  _governor_on = governor;
+
+  // params & morph anchors may have been edited since the last call
+  _blk_params_ok = false;
+  if (timing) {
+    if (_stage_stats.takeResetRequest())
+      _stage_times.clear();
+    _stage_times.add(STAGE_LOCK_WAIT, GetStageTicks() - t_enter);
+  }
+
   pollUpdate(/*force*/ false);
 
   copyInBuf(in_buf, buf_n);
@@ -1601,33 +2177,59 @@ inline void DtBlkFx::_process(float** in_buf, long buf_n)
 
     findBlkInPos();
 
-    _mixback = get(&GetInterp, _mixback_param);
+    const BlkParams& bp = blkParams();
+    _mixback = bp.mixback;
 
     // blk mix update
-    _blk_mix_fn_n = get(&GetInterp, _blk_mix_param, _blk_mix_fn);
+    _blk_mix_fn_n = _blk_mix_param.get(bp.vst, _blk_mix_fn);
+
+    // if the effects do nothing then the ifft would give back the input (the power match has
+    // nothing to match & the mix is between the input & itself), unless the spectrogram is
+    // showing & needs the ffts
+    bool fx_identity = prepareFx() && !_spec_snap.isEnabled();
 
-    if (_mixback >= 1.0f) {
+    // nothing to do for a silent blk (after prepareFx, silentBlk needs the gain of the effects)
+    bool silent = silentBlk();
+
+    if (silent) {
+      if (_stage_timing_on)
+        _stage_times.silent_blks++;
+    }
+    else if (_mixback >= 1.0f || fx_identity) {
+      // no ffts because 100% mixback or the effects do nothing
+      flushBlkOut();
       prepMixOut();
-      // no ffts because 100% mixback
-      for (int i = 0; i < AUDIO_CHANNELS; i++) {
-        float* x0_dat = _chan[i].x0;
-        mixToX3(P1Src(x0_dat + _x0_i), i);
-      }
+      latchBlkOut();
+      directMixOut(_blk_out[_blk_out_i]);
+    }
+    else if (_blk_pipeline) {
+      // mix the previous blk while doing this one (the previous blk is in the other x1/x2 set)
+      if (_blk_out_pending)
+        selectXSet(_x_set ^ 1);
+      RunChanTasks(
+          &ChanTaskThunk<DtBlkFx, &DtBlkFx::pipelineTask>, this, _blk_out_pending ? 2 : 1);
+      prepMixOut();
+      latchBlkOut();
+
+      // hold this blk until the next one (or flushBlkOut)
+      _blk_out_i ^= 1;
+      _blk_out_pending = true;
     }
     else {
       // normal case, we need to do the FFTs
-      doFFT();
-      if (gui())
-        gui()->FFTDataRdy(0 /*input*/);
+      fftAndEffects();
       prepMixOut();
-
-      procFFT();
-      if (gui())
-        gui()->FFTDataRdy(1 /*output*/);
-      ifftAndMixOut();
+      latchBlkOut();
+      ifftAndMixOut(_blk_out[_blk_out_i]);
     }
     nextBlk();
 
+    if (_stage_timing_on) {
+      _stage_times.blks++;
+      if (_governor_on && _gov.isDegraded())
+        _stage_times.degraded_blks++;
+    }
+
     // ensure stop if we run out of data to process
     if (_extra_data <= 0)
       break;
@@ -1637,11 +2239,28 @@ inline void DtBlkFx::_process(float** in_buf, long buf_n)
   ASSERTX(_buf_end_abs == _curr_samp_abs + buf_n,
           VAR(_buf_end_abs) << VAR(_curr_samp_abs) << VAR(buf_n));
 
+  // the last blk has to be in x3 before it's output
+  flushBlkOut();
+
   //
   zeroFillOutput();
 
   // update absolute sample position
   _curr_samp_abs = _buf_end_abs;
+
+  StageTicks t_exit = timing || governor ? GetStageTicks() : 0;
+
+  // compare with the time the buffer lasts
+  if (governor && buf_n > 0 &&
+      _gov.add((double)(t_exit - t_enter) / StageTicksPerSec(), (double)buf_n / sampleRate)) {
+    LOG("", "DtBlkFx governor" << VAR(_gov.planDrop()) << VAR(_gov.overlapDrop()));
+  }
+
+  // make times available to other threads
+  if (timing) {
+    _stage_times.add(STAGE_PROCESS, t_exit - t_enter);
+    _stage_stats.publish(_stage_times);
+  }
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1651,6 +2270,11 @@ void DtBlkFx::process(float** inputs, float** outputs, VstInt32 samps)
 {
   SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
 
+  if (_async.isRunning()) {
+    processAsync(inputs, outputs, samps, /*replacing*/ false);
+    return;
+  }
+
   _process(inputs, samps);
   for (int i = 0; i < AUDIO_CHANNELS; i++) {
     PAddOut p(outputs[i]);
@@ -1666,6 +2290,11 @@ void DtBlkFx::processReplacing(float** inputs, float** outputs, VstInt32 samps)
 {
   SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
 
+  if (_async.isRunning()) {
+    processAsync(inputs, outputs, samps, /*replacing*/ true);
+    return;
+  }
+
   _process(inputs, samps);
   for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
     PCopyOut p(outputs[ch]);
@@ -1674,3 +2303,236 @@ void DtBlkFx::processReplacing(float** inputs, float** outputs, VstInt32 samps)
 
   _x3_o = wrap(samps + _x3_o, _chan[0].x3);
 }
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::setParallelChans(bool on)
+{
+  if (_par_chans.exchange(on) == on)
+    return;
+  if (on)
+    StartChanPool();
+  else
+    StopChanPool();
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::setBlkPipeline(bool on)
+// must be called while suspended
+{
+  if (on == _blk_pipeline)
+    return;
+
+  // a second set of x1 & x2 for the blk being mixed
+  _blk_pipeline = on;
+  carveArena();
+  init();
+
+  _blk_out_pending = false;
+  if (on)
+    StartChanPool();
+  else
+    StopChanPool();
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::selectXSet(int i)
+{
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+    _chan[ch].x1 = _x1_set[i] + ch * FFT_BATCH_FREQ_DIST; // FFT'd complex data with space
+                                                          // either side for shift overflow
+    _chan[ch].x2 = _x2_set[i] + ch * FFT_BATCH_TIME_DIST; // inverse FFT & temporary buffer with
+                                                          // space either side for shift overflow
+  }
+  _x_set = i;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::carveArena()
+// internal method, called while suspended (or before processing starts)
+// lay out x1 & x2 (1 or 2 sets), x3, the power caches & the pending gain for all channels in one
+// allocation, the contents of all of them are lost
+{
+  int sets = _blk_pipeline ? 2 : 1;
+
+  // x1 & x2 of a set are stepped through together (x2 is also scratch while x1 is read) so they
+  // get different cache colours, the same goes for the x3's of each channel
+  ChanArena::Layout l;
+  size_t x1_offs[2], x2_offs[2], x3_offs[AUDIO_CHANNELS], pwr_offs[AUDIO_CHANNELS];
+  for (int i = 0; i < sets; i++) {
+    x1_offs[i] = l.add(AUDIO_CHANNELS * FFT_BATCH_FREQ_DIST * sizeof(cplxf));
+    x2_offs[i] = l.add(AUDIO_CHANNELS * FFT_BATCH_TIME_DIST * sizeof(float));
+  }
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+    x3_offs[ch] = l.add(_x3_sz * sizeof(float));
+
+  // the effects only run on one blk at a time so one set is enough
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+    pwr_offs[ch] = l.add(PwrCache::MAX_BINS * sizeof(float));
+  size_t gain_offs = l.add(PwrCache::MAX_BINS * sizeof(float));
+
+  _arena.resize(l.n_bytes, _huge_pages);
+
+  for (int i = 0; i < 2; i++) {
+    _x1_set[i] = _arena.at<cplxf>(x1_offs[i < sets ? i : 0]);
+    _x2_set[i] = _arena.at<float>(x2_offs[i < sets ? i : 0]);
+  }
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+    _chan[ch].x3 = Rng<float>(_arena.at<float>(x3_offs[ch]), (int)_x3_sz);
+    _chan[ch].pwr.setBuf(_arena.at<float>(pwr_offs[ch]));
+  }
+  _gain = _arena.at<float>(gain_offs);
+  std::fill(_gain, _gain + PwrCache::MAX_BINS, 1.0f);
+  _gain_b0 = 1;
+  _gain_b1 = 0;
+  selectXSet(0);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::setHugePages(bool on)
+// must be called while suspended
+{
+  if (on == _huge_pages)
+    return;
+  _huge_pages = on;
+  carveArena();
+  init();
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::setAsyncHeadroom(long samps)
+// must be called while suspended, the worker is started by resume()
+{
+  _async.stop();
+
+  ScopeCriticalSection scs(_protect);
+  _async_headroom_n = max(0L, samps);
+
+  // the headroom is extra latency
+  setInitialDelay(_initial_delay + _async_headroom_n);
+  ioChanged();
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::asyncStart()
+// internal method, called with _protect held & the worker stopped
+// size the FIFOs, fill the headroom with silence & start the worker
+{
+  long chunk_n = max((long)blockSize, 64L);
+  long fifo_n = _async_headroom_n + 4 * chunk_n;
+
+  _async.in.resize(fifo_n);
+  _async.out.resize(fifo_n);
+  for (int i = 0; i < AUDIO_CHANNELS; i++)
+    _async_tmp[i].resize(chunk_n);
+
+  PZero pzero[AUDIO_CHANNELS];
+  _async.out.write(pzero, _async_headroom_n);
+
+  _async.headroom_n = _async_headroom_n;
+  _async.chunk_n = chunk_n;
+  _async.in_abs = _curr_samp_abs;
+  _async.skip_n = 0;
+  _async.xruns = 0;
+
+  _async.start(&asyncRunCallback, this);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::asyncRun()
+// internal method, called on the worker thread
+// process everything waiting in the input FIFO (as long as there's space for the output)
+{
+  SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+
+  while (1) {
+    long n = min(min(_async.in.readAvail(), _async.out.writeAvail()), _async.chunk_n);
+    if (n <= 0)
+      return;
+
+    float* tmp[AUDIO_CHANNELS];
+    PCopyOut copy_in[AUDIO_CHANNELS];
+    PCopyIn copy_out[AUDIO_CHANNELS];
+    for (int i = 0; i < AUDIO_CHANNELS; i++) {
+      tmp[i] = &_async_tmp[i][0];
+      copy_in[i] = PCopyOut(tmp[i]);
+      copy_out[i] = PCopyIn(tmp[i]);
+    }
+    _async.in.read(copy_in, n);
+
+    {
+      ScopeCriticalSection scs(_protect);
+      _async_worker_active = true;
+      _process(tmp, n);
+      _async_worker_active = false;
+
+      // input has been copied into x0 so the same buffer can take the output
+      for (int i = 0; i < AUDIO_CHANNELS; i++) {
+        PCopyOut p(tmp[i]);
+        wrapProcess(p, _chan[i].x3, _x3_o, n);
+      }
+      _x3_o = wrap(n + _x3_o, _chan[0].x3);
+    }
+
+    _async.out.write(copy_out, n);
+    _async.outputRdy();
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void DtBlkFx::processAsync(float** in_buf, float** out_buf, long n, bool replacing)
+// internal method, called on the audio thread when the worker is running
+// only moves samples in & out of the FIFOs, never takes _protect
+{
+  // answer the worker's tempo request (info is for the first sample of this buffer)
+  if (_async.timeInfoRequested())
+    _async.putTimeInfo(getTimeInfo(kVstTempoValid | kVstPpqPosValid), _async.in_abs);
+
+  // input, anything that doesn't fit is lost (worker is a long way behind)
+  long in_n = min(n, _async.in.writeAvail());
+  PCopyIn copy_in[AUDIO_CHANNELS];
+  for (int i = 0; i < AUDIO_CHANNELS; i++)
+    copy_in[i] = PCopyIn(in_buf[i]);
+  _async.in.write(copy_in, in_n);
+  _async.in_abs += in_n;
+  if (in_n < n) {
+    // output for the lost input will never arrive so it doesn't need to be dropped
+    _async.xruns++;
+    _async.skip_n = max(0L, _async.skip_n - (n - in_n));
+  }
+  _async.wake();
+
+  // when rendering offline there is no deadline so wait for the worker
+  long want_n = _async.skip_n + n;
+  if (_async.out.readAvail() < want_n && getCurrentProcessLevel() == kVstProcessLevelOffline)
+    _async.waitOutput(want_n);
+
+  // drop late output that has already been replaced with silence
+  long drop_n = min(_async.skip_n, _async.out.readAvail());
+  PZero pzero[AUDIO_CHANNELS];
+  _async.out.read(pzero, drop_n);
+  _async.skip_n -= drop_n;
+
+  // output
+  long out_n = min(n, _async.out.readAvail());
+  if (replacing) {
+    PCopyOut p[AUDIO_CHANNELS];
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      p[i] = PCopyOut(out_buf[i]);
+    _async.out.read(p, out_n);
+  }
+  else {
+    PAddOut p[AUDIO_CHANNELS];
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      p[i] = PAddOut(out_buf[i]);
+    _async.out.read(p, out_n);
+  }
+
+  // worker is late, output silence & drop the late samples when they arrive
+  if (out_n < n) {
+    _async.xruns++;
+    _async.skip_n += n - out_n;
+    if (replacing)
+      for (int i = 0; i < AUDIO_CHANNELS; i++)
+        memset(out_buf[i] + out_n, 0, (n - out_n) * sizeof(float));
+  }
+}
@@ -24,10 +24,17 @@ General Public License for more details.
 #include <vector>
 #include <vstsdk/public.sdk/source/vst2.x/audioeffectx.h>
 
+#include "AsyncBlkWorker.h"
 #include "BlkFxParam.h"
+#include "ChanArena.h"
+#include "CpuGovernor.h"
 #include "FxState1_0.h"
+#include "MirrorBuf.h"
 #include "MorphParam.h"
 #include "ParamsDelay.h"
+#include "PwrCache.h"
+#include "SpecSnap.h"
+#include "StageTimer.h"
 #include "VstProgram.h"
 #include "misc_stuff.h"
 
@@ -36,7 +43,14 @@ class Gui;
 //------------------------------------------------------------------------
 class DtBlkFx : public AudioEffectX {
 public:
-  enum { MAX_FX = 16, AUDIO_CHANNELS = BlkFxParam::AUDIO_CHANNELS };
+  enum {
+    MAX_FX = 16,
+    AUDIO_CHANNELS = BlkFxParam::AUDIO_CHANNELS,
+
+    // default for setMaxDelayMsec (a little over what the fixed size buffers used to give at
+    // 44.1kHz)
+    MAX_DELAY_MSEC_DEFAULT = 3200
+  };
 
   DtBlkFx(audioMasterCallback audioMaster);
   ~DtBlkFx();
@@ -101,13 +115,53 @@ public: // our own methods
   {
     VecPtr<cplxf, CHANNELS> fft_tmp;
     for (int i = 0; i < CHANNELS; i++)
-      fft_tmp.data[i] = _chan[i].x2.cast<cplxf>() + 32; // allow room for FrqShiftFft overrun
+      fft_tmp.data[i] = (cplxf*)_chan[i].x2 + 32; // allow room for FrqShiftFft overrun
     return fft_tmp;
   }
 
   VecPtr<cplxf, AUDIO_CHANNELS> FFTdata() { return _FFTdata<AUDIO_CHANNELS>(); }
   VecPtr<cplxf, AUDIO_CHANNELS> FFTdataTmp() { return _FFTdataTmp<AUDIO_CHANNELS>(); }
 
+  // power of the FFT'd data of channel "ch" for the current blk
+  PwrCache& pwrCache(int ch) { return _chan[ch].pwr; }
+
+  // total power of bins b0..b1 (inclusive) of channel "ch" from its power cache
+  double bandPwr(int ch, long b0, long b1) { return _chan[ch].pwr.bandPwr(b0, b1); }
+
+  // FFT'd data bins b0..b1 (inclusive) of all channels have been written
+  void pwrDirty(long b0, long b1)
+  {
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      _chan[i].pwr.dirty(b0, b1);
+  }
+
+  // any FFT'd data may have been written
+  void pwrDirtyAll()
+  {
+    for (int i = 0; i < AUDIO_CHANNELS; i++)
+      _chan[i].pwr.dirtyAll();
+  }
+
+  // multiply the pending gain of bins b0..b1 (inclusive) by "amp", the amplitude-only slots collect
+  // their gain here (see GainProcess in FxRun1_0.cpp) & it's applied to all channels by flushGain
+  void mulGain(long b0, long b1, float amp)
+  {
+    if (_gain_b0 > _gain_b1) {
+      _gain_b0 = b0;
+      _gain_b1 = b1;
+    }
+    else {
+      _gain_b0 = min(_gain_b0, b0);
+      _gain_b1 = max(_gain_b1, b1);
+    }
+    for (long i = b0; i <= b1; i++)
+      _gain[i] *= amp;
+  }
+
+  // apply the pending gain to the FFT'd data of all channels, must be done before the data is
+  // looked at (does nothing if there is no pending gain)
+  void flushGain();
+
   // for debugging
   bool chkInRng(int ch, cplxf* p, int& offs)
   {
@@ -133,6 +187,25 @@ public: // our own methods
   // get the most recently set param
   float getCurrParam(int idx) { return _params.getInput(idx); }
 
+  // everything needed to inverse fft a blk & mix it to x3, taken once the blk has been through
+  // the effects so that the next blk can go ahead while it's mixed
+  struct BlkOut {
+    long plan;
+    long x3_o;          // x3 position to start fade-in
+    long time_fft_n;    // see _time_fft_n
+    long data_pre_x0_n; // see _data_pre_x0_n
+    long fadein_n;      // see _fadein_n
+    long fadeout_n;     // see _fadeout_n
+    long x0_i;          // see _x0_i
+    float mixback;      // see _mixback
+    Array<float, 32> mix_fn;
+    long mix_fn_n;
+
+    cplxf* fft_data[AUDIO_CHANNELS];  // FFTdata()
+    float* xform_buf[AUDIO_CHANNELS]; // xformBuf()
+    float out_scale[AUDIO_CHANNELS];  // Chan::out_scale
+  };
+
 protected: // internal methods
   void configParams1_0();
   void init();
@@ -141,16 +214,124 @@ protected: // internal methods
   void paramsChkSync();
   void paramsChk();
   void findBlkInPos();
+  bool silentBlk();
   void prepMixOut();
+  float* xformBuf(int ch);
+  void shoulderToX2(int ch);
+  void scaleSpectrum(int ch);
+  void doFFTChan(int ch);
   void doFFT();
+  void outPwrChan(int ch);
+  bool prepareFx();
   void procFFT();
-  template <class SRC> void mixToX3(SRC src, int ch);
-  void ifftAndMixOut();
+  void latchBlkOut();
+  template <class SRC> void mixToX3(BlkOut& o, SRC src, int ch);
+  void mixOutChan(int ch);
+  void ifftChan(int ch);
+  void directMixChan(int ch);
+  void ifftAndMixOut(BlkOut& o);
+  void directMixOut(BlkOut& o);
+  void fftAndEffects();
+  void pipelineTask(int i);
+  void flushBlkOut();
+  void snapSpectrum(int in_out);
   void nextBlk();
   void zeroFillOutput();
 
   void _process(float** in_buf, long buf_n);
 
+public: // parallel channels, see ChanPool.h
+  // run independent per-channel work (transforms, output power & mixing to x3) on the shared
+  // channel pool, the effects still run all channels on the calling thread
+  // safe from any thread (takes effect from the next _process)
+  void setParallelChans(bool on);
+  bool isParallelChans() const { return _par_chans; }
+
+protected:
+  // requested
+  std::atomic<bool> _par_chans;
+
+  // _par_chans latched for the current _process call
+  bool _par_chans_on;
+
+public: // buffer sizes
+  // longest delay (msec) that x0 & x3 are sized for, longer delays are limited to this
+  // must be called while suspended (buffers are sized on resume)
+  void setMaxDelayMsec(float msec) { _max_delay_msec = msec; }
+  float getMaxDelayMsec() const { return _max_delay_msec; }
+
+  // bytes of memory used by this instance (the object plus all of its buffers)
+  size_t getMemBytes() const;
+
+  // back x1, x2 & x3 with huge pages if the system has them (fewer TLB misses with large ffts)
+  // must be called while suspended
+  void setHugePages(bool on);
+  bool isHugePages() const { return _arena.isHugePages(); }
+
+protected:
+  void sizeBuffers();
+  void updateMaxDelay();
+  void carveArena();
+
+  // requested max delay
+  float _max_delay_msec;
+
+  // requested huge pages
+  bool _huge_pages;
+
+public: // blk pipeline
+  // overlap the inverse fft & mix to x3 of each fft-blk with the fft & effects of the next one (on
+  // the shared channel pool), blks are still mixed to x3 in order so the output is the same
+  // must be called while suspended (a second set of x1 & x2 is allocated while it's on)
+  void setBlkPipeline(bool on);
+  bool isBlkPipeline() const { return _blk_pipeline; }
+
+protected:
+  // point the channels at x1 & x2 set "i"
+  void selectXSet(int i);
+
+  // requested (not changed while processing)
+  bool _blk_pipeline;
+
+  // current blk & the previous blk (if _blk_out_pending, waiting to be mixed)
+  BlkOut _blk_out[2];
+  int _blk_out_i;
+  bool _blk_out_pending;
+
+  // blk being mixed by ifftChan/directMixChan
+  BlkOut* _mix_out;
+
+  // x1 & x2 set in use
+  int _x_set;
+
+public: // async processing, see AsyncBlkWorker.h
+  // set the number of samples of headroom given to the worker thread (this is added to the
+  // latency reported to the host), 0 to process in the host's audio callback (the default)
+  // must be called while suspended
+  void setAsyncHeadroom(long samps);
+  long getAsyncHeadroom() const { return _async_headroom_n; }
+
+  // number of audio callbacks where the worker was late since the last resume
+  long getAsyncXRuns() const { return _async.xruns; }
+
+protected:
+  void asyncStart();
+  void asyncRun();
+  static void asyncRunCallback(void* ctx) { ((DtBlkFx*)ctx)->asyncRun(); }
+  void processAsync(float** in_buf, float** out_buf, long n, bool replacing);
+
+  // requested headroom
+  long _async_headroom_n;
+
+  // true while the worker is running _process (protected by _protect)
+  bool _async_worker_active;
+
+  // worker thread & FIFOs
+  AsyncBlkWorker _async;
+
+  // worker only: linear copy of a chunk of input/output
+  std::valarray<float> _async_tmp[AUDIO_CHANNELS];
+
 public: //
   // critical section is used to protect against gui & audio processing thread
   CriticalSectionWrapper _protect;
@@ -174,15 +355,20 @@ public: //
   long _x0_sz;           // wraping position of x0
   long _x0_force_out_sz; // force output if x0_n exceeds this
 
-  long _x0_i;          // first sample of current blk in _x0
-  long _x0_n;          // number of samples in the pre-fft buffer
-  long _x0_n_past_end; // number of samples copied past _x0_sz
+  long _x0_i; // first sample of current blk in _x0
+  long _x0_n; // number of samples in the pre-fft buffer
 
   long _x3_sz;       // total size of x3
   long _x3_o;        // output FIFO output index
   long _x3_end_abs;  // 1 + abs sample position of final sample in _x3
   bool _x3_is_clear; // true when x3 is initialized with 0's
 
+  // 1 + abs sample position of the last input sample that isn't silent (see silentBlk)
+  long _loud_end_abs;
+
+  // product of the gains above 0dB of the effects for the current blk (see prepareFx)
+  float _fx_gain;
+
   enum {
     PARAMS_CHK_SYNC,  // params need to be processed for the current blk
     PARAMS_NONINTERP, // params have been gathered but can't be interpolated
@@ -205,11 +391,13 @@ public: //
 
   // channel specific data
   struct Chan {
-    ScopeFFTWfMalloc<float> x0; // pre FFT circular buffer, note: special alignment
-    ScopeFFTWfMalloc<cplxf> x1; // FFT'd data (frequency-domain), note: special alignment
-    ScopeFFTWfMalloc<float> x2; // IFFT'd data (time-domain) and may be used as a temporary buffer
-                                // during effects, note: special alignment
-    std::valarray<float> x3;    // output FIFO
+    MirrorBuf<float> x0; // pre FFT circular buffer, mapped twice so that a blk that wraps past
+                         // _x0_sz is still contiguous
+    cplxf* x1; // FFT'd data (frequency-domain), in _arena
+    float* x2; // IFFT'd data (time-domain) and may be used as a temporary buffer during effects,
+               // in _arena
+    Rng<float> x3; // output FIFO (_x3_sz samples), in _arena
+    PwrCache pwr;  // power of the x1 bins for the effects of the current blk, buffer in _arena
 
     float total_in_pwr;  // x1 input power
     float total_out_pwr; // current x1 output power after effects
@@ -219,6 +407,21 @@ public: //
     float out_scale;     // sqrt(out_pwr_scale)
   } _chan[AUDIO_CHANNELS];
 
+  // x1, x2, x3, the power caches & the pending gain for all channels (x0 is mapped separately, see
+  // MirrorBuf.h), see carveArena
+  ChanArena _arena;
+
+  // x1 & x2 for all channels, channels are FFT_BATCH_FREQ_DIST & FFT_BATCH_TIME_DIST apart so
+  // that the batched fft plans can do all channels in one call
+  // (there are 2 sets of all channels when the blk pipeline is on, see selectXSet)
+  cplxf* _x1_set[2];
+  float* _x2_set[2];
+
+  // pending gain of each bin for all channels (see mulGain), in _arena
+  // it's 1 outside of _gain_b0.._gain_b1 & there's nothing pending if _gain_b0 > _gain_b1
+  float* _gain;
+  long _gain_b0, _gain_b1;
+
 public: // temporary variables used during blk processing
   // sample position of next call to _process() (1+end of current buffer)
   long _buf_end_abs;
@@ -247,6 +450,74 @@ public: // temporary variables used during blk processing
   // mixback multiplier
   float _mixback;
 
+  // power match amount (0=filter mode, 1=pwr match)
+  float _pwr_match;
+
+  // x0 position that the current blk is transformed from
+  long _xform_x0_i;
+
+  // number of samples windowed at each end of the current blk (0 if not windowed) & the window
+  int _shoulder_n;
+  Array<float, 48> _shoulder_fn;
+  int _shoulder_fn_n;
+
+public: // random numbers, see CtrRand32
+  // seed for the counter-based random numbers, different for each instance & saved in project
+  // chunks. Set it before processing (e.g. so that instances render the same as each other)
+  void setRandSeed(unsigned seed) { _rand_seed = seed; }
+  unsigned getRandSeed() const { return _rand_seed; }
+
+protected:
+  unsigned _rand_seed;
+
+public: // spectrogram display, see SpecSnap.h
+  // power spectra for the gui (audio thread produces, gui idle consumes)
+  SpecSnapRing _spec_snap;
+
+public: // per-stage timing, see StageTimer.h
+  // turn timing on/off, safe from any thread (takes effect from the next _process)
+  void setStageTiming(bool on) { _stage_timing = on; }
+  bool isStageTiming() const { return _stage_timing; }
+
+  // get the most recently published stage times, safe from any thread without taking _protect
+  void getStageTimes(StageTimes* dst) const { _stage_stats.read(dst); }
+
+  // clear the stage times (done by the audio thread at the start of the next _process)
+  void resetStageTimes() { _stage_stats.requestReset(); }
+
+  // timing requested
+  std::atomic<bool> _stage_timing;
+
+  // _stage_timing latched for the current _process call
+  bool _stage_timing_on;
+
+  // times accumulated by the audio thread & the copy published for other threads
+  StageTimes _stage_times;
+  StageStatsBlock _stage_stats;
+
+public: // quality governor, see CpuGovernor.h
+  // drop the fft size & overlap when _process gets near its real-time budget, off by default
+  // safe from any thread (takes effect from the next _process), never applies offline
+  void setGovernor(bool on) { _governor = on; }
+  bool isGovernor() const { return _governor; }
+
+  // number of times the fft size & overlap are currently halved (both 0 at full quality)
+  int getGovernorPlanDrop() const { return _gov.planDrop(); }
+  int getGovernorOverlapDrop() const { return _gov.overlapDrop(); }
+  bool isGovernorDegraded() const { return _gov.isDegraded(); }
+
+protected:
+  // requested
+  std::atomic<bool> _governor;
+
+  // _governor latched for the current _process call (false when rendering offline)
+  bool _governor_on;
+
+  // process level is offline (polled on the audio thread)
+  bool _offline;
+
+  CpuGovernor _gov;
+
 public: // polled variables that are updated periodically
   // samples per beat
   float _samps_per_beat;
@@ -295,6 +566,40 @@ public:
     return result[0];
   }
 
+public: // per-blk param snapshot
+  // the morphed params used by the blk loop, worked out in one pass from the interpolated vst
+  // params at the current _params output position
+  struct BlkParams {
+    // interpolated vst params (for the morph params with more than one value)
+    float vst[BlkFxParam::TOTAL_NUM];
+
+    float mixback;
+    float delay;
+    float fft_len;
+    float overlap;
+    float pwr_match;
+    float beat_sync;
+    float blk_shoulder_frac;
+
+    // params of each 1.0 effect (FX_TYPE isn't interpolated, it's from the previous param)
+    float fx[BlkFxParam::NUM_FX_SETS][BlkFxParam::NUM_FX_PARAMS];
+  };
+
+  // snapshot for the current output position, worked out on first use after the position has
+  // moved or since the start of the _process call (params & morph anchors may have been edited)
+  const BlkParams& blkParams()
+  {
+    if (!_blk_params_ok)
+      compileBlkParams();
+    return _blk_params;
+  }
+
+protected:
+  void compileBlkParams();
+
+  BlkParams _blk_params;
+  bool _blk_params_ok;
+
 public: // preview access
   // during preview all params attached to the vst param will be output immediately
 
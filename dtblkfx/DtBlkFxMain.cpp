@@ -5,14 +5,18 @@
 #include <StdAfx.h>
 
 #include "DtBlkFx.hpp"
-#include "Gui.h"
-#include "PngVstGui.h"
-#include "VstGuiSupport.h"
+#include "HarmData.h"
 #include "fftw_support.h"
 #include "misc_stuff.h"
 #include "rfftw_float.h"
 #include <sstream>
 
+#ifndef DTBLKFX_HEADLESS
+#include "Gui.h"
+#include "PngVstGui.h"
+#include "VstGuiSupport.h"
+#endif
+
 #include "Debug.h"
 
 #ifdef _DEBUG
@@ -65,6 +69,14 @@ bool GlobalInitOk()
 #  define FILE_PREFIX BLKFX_DIR "mono_"
 #endif
 
+// fftw planning on load: estimate unless there are better plans in the <dll path>\BLKFX_DIR
+// wisdom file ("dtblkfx_tool wisdom" measures them ahead of time). Measuring while loading is
+// opt-in at build time, see InitFFTWfPlans
+#ifndef FFTW_PLAN_MODE_DEFAULT
+#  define FFTW_PLAN_MODE_DEFAULT FFTW_PLAN_ESTIMATE
+#endif
+
+#ifndef DTBLKFX_HEADLESS
 //-------------------------------------------------------------------------------------------------
 struct {
   VstGuiRef<CContextRGBA>* dst;
@@ -78,6 +90,7 @@ struct {
     {&Images::g_splash_bg, FILE_PREFIX "splash.png"},
     {&Images::g_glob_bg, FILE_PREFIX "global_ctrl.png"},
     {&Images::g_fx_bg, FILE_PREFIX "fx_bg.png"}};
+#endif
 
 vector<VstProgram<BlkFxParam::TOTAL_NUM>> g_blk_fx_presets;
 
@@ -158,29 +171,37 @@ VST_EXPORT AEffect* VSTPluginMain(audioMasterCallback audioMaster)
       }
 #endif
 
-      CreateFFTWfPlans();
+      InitFFTWfPlans(FFTW_PLAN_MODE_DEFAULT,
+                     (g_plugin_path.toString() + BLKFX_DIR FFTW_WISDOM_FILE_NAME).c_str());
+
+      // decode the harmonic tables here rather than on the first HarmMatch blk
+      InitHarmData();
 
       //
       g_load_state = GLOBAL_LOAD_STATE_MISSING_FILES;
 
       // now try to load images
       bool image_error = false;
+#ifndef DTBLKFX_HEADLESS
       for (int i = 0; i < NUM_ELEMENTS(g_load_images); i++) {
         if (!ReadPng(g_load_images[i].dst->New(),
                      g_plugin_path.toString() + g_load_images[i].file_name,
                      &err_str))
           image_error = true;
       }
+#endif
 
       // load presets from the text file
       if (!LoadPresets(&err_str))
         image_error = true;
 
       // check for error
-      if (image_error)
-        MessageBox(NULL, err_str.str().c_str(), "DtBlkFx image loading error", MB_OK);
-      else
+      if (!image_error)
         g_load_state = GLOBAL_LOAD_STATE_INIT_OK;
+#ifdef _WIN32
+      else
+        MessageBox(NULL, err_str.str().c_str(), "DtBlkFx image loading error", MB_OK);
+#endif
     }
     // Create the AudioEffect
     AEffect* t = (new DtBlkFx(audioMaster))->getAeffect();
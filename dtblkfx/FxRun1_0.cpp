@@ -54,7 +54,7 @@ TODO:
 #define LOG_FILE_NAME "c:\\fx1_0.html"
 #include "Debug.h"
 
-#include "SinCosTable.h"
+#include "sincostable.h"
 
 #include "DtBlkFx.hpp"
 #include "FxRun1_0.h"
@@ -66,8 +66,6 @@ using namespace std;
 // constants
 enum { AUDIO_CHANNELS = BlkFxParam::AUDIO_CHANNELS };
 
-long g_rand_i = 1;
-
 //*************************************************************************************************
 class PhaseCorrect
 // find phase correction for bin shifting operations (old one, use other one)
@@ -168,6 +166,11 @@ class ProcessBase
 // base class for effects, we use templates for everything so methods are not virtual
 {
 public:
+  // run() writes nothing but bins b0..b1 of the FFT'd data (processes that write anywhere else,
+  // e.g. shifting, must set this to 0 so that the mask drivers drop the whole power cache)
+  // WRITES_DATA is 0 for processes that don't touch the FFT'd data at all (GainProcess)
+  enum { WRITES_RUN_BINS_ONLY = 1, WRITES_DATA = 1 };
+
   // which state called us
   _Ptr<FxState1_0> _s;
 
@@ -217,12 +220,46 @@ public:
   // apply scaling from bin b0 to b1
   void run(long b0, long b1)
   {
-    VecPtr<cplxf, AUDIO_CHANNELS> d = _b->FFTdata();
-    for (int i = b0; i <= b1; i++)
-      d[i] *= _amp;
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+      g_spec_kernels->scale(_b->FFTdata(ch) + b0, b1 - b0 + 1, _amp);
+  }
+};
+
+//*************************************************************************************************
+class GainProcess
+    : public AmpProcess
+//
+// AmpProcess for DtBlkFx::procFFT's fused amplitude-only slots, multiplies the pending gain
+// instead of the data (see FxRun1_0::gainOnly)
+//
+{
+public:
+  enum { WRITES_DATA = 0 };
+
+  GainProcess(FxState1_0* s)
+      : AmpProcess(s)
+  {
   }
+
+  void run(long b0, long b1) { _b->mulGain(b0, b1, _amp); }
 };
 
+//-------------------------------------------------------------------------------------------------
+inline bool AmpIs0dB(FxState1_0* s)
+// for FxRun1_0::isIdentity, compare the param because temp.amp isn't exactly 1 at 0dB (the dB
+// conversion rounds)
+{
+  return s->temp.amp_param == BlkFxParam::getAmpParam0dB();
+}
+
+//-------------------------------------------------------------------------------------------------
+inline bool MixAmountIs0(FxState1_0* s)
+// for FxRun1_0::isIdentity of amp mix mode effects, they mix in 1-amp of the original bins so at
+// 0 amount they leave the data as it is
+{
+  return s->temp.amp_param <= 0.0f;
+}
+
 //*************************************************************************************************
 template <class T>
 class MaskProcessBase
@@ -233,11 +270,25 @@ public:
   // process that we're driving
   _Ptr<T> _process;
 
+  enum { WRITES_RUN_BINS_ONLY = T::WRITES_RUN_BINS_ONLY, WRITES_DATA = T::WRITES_DATA };
+
   MaskProcessBase(FxState1_0* s)
       : ProcessBase(s)
   {
   }
 
+  // run the process over b0..b1 & take what it wrote out of the power cache
+  void runProcess(long b0, long b1)
+  {
+    _process->run(b0, b1);
+    if (!WRITES_DATA)
+      return;
+    if (WRITES_RUN_BINS_ONLY)
+      _b->pwrDirty(b0, b1);
+    else
+      _b->pwrDirtyAll();
+  }
+
   // default these to calling through to next processing
   bool reverse() { return _process->reverse(); }
 
@@ -392,7 +443,7 @@ public:
           v1 = p;
         // process if range is good
         if (v1 >= v0) {
-          MaskProcessBase<T>::_process->run(v0, v1);
+          MaskProcessBase<T>::runProcess(v0, v1);
           p = v0 - 1;
         }
         _curr_cent -= _spacing;
@@ -417,7 +468,7 @@ public:
           v0 = p;
         // process if range is good
         if (v1 >= v0) {
-          MaskProcessBase<T>::_process->run(v0, v1);
+          MaskProcessBase<T>::runProcess(v0, v1);
           p = v1 + 1;
         }
         _curr_cent += _spacing;
@@ -462,6 +513,9 @@ public:
     if (b0 > b1)
       swap(b0, b1);
 
+    // the peak is found in the data as the slots before have left it
+    base::_b->flushGain();
+
     // always peak find on the left channel for stereo
     base::init(fx_val,
                PeakFindFft(base::_b->FFTdata(/*left*/ 0),
@@ -503,7 +557,7 @@ public:
       long v0 = max(b0, _param_bin[0]);
       long v1 = min(b1, _param_bin[1]);
       if (v1 >= v0)
-        base::_process->run(v0, v1);
+        base::runProcess(v0, v1);
     }
     else {
       // freqA > freqB : process outside region
@@ -511,15 +565,15 @@ public:
       long v0 = max(b0, _param_bin[0]);
       if (base::reverse()) {
         if (v1 >= b0)
-          base::_process->run(b0, v1);
+          base::runProcess(b0, v1);
         if (b1 >= v0)
-          base::_process->run(v0, b1);
+          base::runProcess(v0, b1);
       }
       else {
         if (b1 >= v0)
-          base::_process->run(v0, b1);
+          base::runProcess(v0, b1);
         if (v1 >= b0)
-          base::_process->run(b0, v1);
+          base::runProcess(b0, v1);
       }
     }
   }
@@ -547,6 +601,9 @@ public:
   // width_bins*2 + 1
   long _width2_bins;
 
+  // channel 0 power from the cache (indexed by bin) while searching or NULL to use the data
+  const float* _pwr;
+
   //
   ThreshMaskProcess(FxState1_0* s, //
                     T& process,
@@ -559,16 +616,18 @@ public:
     //_width_bins = (long)(width_frac*(float)b->_freq_fft_n);
     _width_bins = 1;
     _width2_bins = _width_bins * 2 + 1;
+    _pwr = NULL;
 
     // arbitrary function on thresh param
     _thresh_param = powf(thresh_param, 0.8f);
   }
 
   template <int DIR /*1=fwd, -1=rev*/>
-  bool /*peak found*/ findThreshBrk(float thresh_val, CplxfPtrPair& /*in-out*/ dat)
+  bool /*peak found*/ findThreshBrk(float thresh_val, const cplxf* dat_0,
+                                    CplxfPtrPair& /*in-out*/ dat)
   {
     while (!dat.equal()) {
-      float t = norm(*dat.a);
+      float t = _pwr ? _pwr[dat.a - dat_0] : norm(*dat.a);
       if (SELECT_BELOW ? t < thresh_val : t >= thresh_val)
         return true;
       dat.a += DIR;
@@ -578,12 +637,17 @@ public:
 
   void run(long b0, long b1)
   {
+    // the threshold comes from the data as the slots before have left it
+    base::_b->flushGain();
 
     // find min & max pwr of channel 0
-    CplxfPtrPair dat(base::_b->FFTdata(/*channel*/ 0), b0, b1 + 1);
+    PwrCache& pwr_cache = base::_b->pwrCache(/*channel*/ 0);
     FindMinMax<float> pwr_lim(1e30f, 1e-30f);
-    for (; !dat.equal(); dat.a++)
-      pwr_lim(norm(*dat.a));
+    pwr_cache.minMax(b0, b1, &pwr_lim.min(), &pwr_lim.max());
+
+    // the search only runs the process on bins it has passed so the cached power ahead of it stays
+    // good, unless the process writes anywhere else
+    _pwr = base::WRITES_RUN_BINS_ONLY ? pwr_cache.get(b0, b1) : NULL;
 
     // determine threshold by lerp min & max values
     float thresh_val = exp_interp(_thresh_param, pwr_lim);
@@ -591,13 +655,14 @@ public:
     //
     long v0 = -1, v1 = -1;
     cplxf* dat_0 = base::_b->FFTdata(/*channel*/ 0);
+    CplxfPtrPair dat;
 
     // find points breaking the threshold and include "width" data either side
     if (base::reverse()) {
       // find first bin to break threshold
       dat = CplxfPtrPair(base::_b->FFTdata(/*channel*/ 0), b1, b0 - 1);
 
-      if (findThreshBrk</*DIR*/ -1>(thresh_val, dat))
+      if (findThreshBrk</*DIR*/ -1>(thresh_val, dat_0, dat))
         v1 = std::min<long>(dat.a - dat_0 + _width_bins, b1);
 
       cplxf* prev_dat_a = dat.a;
@@ -606,7 +671,7 @@ public:
       while (!dat.equal()) {
         prev_dat_a = dat.a;
         dat.a--;
-        if (!findThreshBrk</*DIR*/ -1>(thresh_val, dat))
+        if (!findThreshBrk</*DIR*/ -1>(thresh_val, dat_0, dat))
           break;
 
         // distance from previous theshold breaker
@@ -615,7 +680,7 @@ public:
           // run prev range
           v0 = std::max<long>(prev_dat_a - dat_0 - _width_bins, b0);
           if (v0 <= v1)
-            base::_process->run(v0, v1);
+            base::runProcess(v0, v1);
 
           // set start position for this rng
           v1 = dat.a - dat_0 + _width_bins;
@@ -628,7 +693,7 @@ public:
       // find initial threshold break
       dat = CplxfPtrPair(base::_b->FFTdata(/*channel*/ 0), b0, b1 + 1);
 
-      if (findThreshBrk</*DIR*/ 1>(thresh_val, dat))
+      if (findThreshBrk</*DIR*/ 1>(thresh_val, dat_0, dat))
         v0 = std::max<long>(dat.a - dat_0 - _width_bins, b0);
 
       cplxf* prev_dat_a = dat.a;
@@ -637,7 +702,7 @@ public:
       while (!dat.equal()) {
         prev_dat_a = dat.a;
         dat.a++;
-        if (!findThreshBrk</*DIR*/ 1>(thresh_val, dat))
+        if (!findThreshBrk</*DIR*/ 1>(thresh_val, dat_0, dat))
           break;
 
         // distance from previous theshold breaker
@@ -646,7 +711,7 @@ public:
           // run prev range
           v1 = std::min<long>(prev_dat_a - dat_0 + _width_bins, b1);
           if (v0 <= v1)
-            base::_process->run(v0, v1);
+            base::runProcess(v0, v1);
 
           // set start position for this rng
           v0 = dat.a - dat_0 - _width_bins;
@@ -658,7 +723,7 @@ public:
 
     // run final rng
     if (v0 >= 0 && v0 <= v1)
-      base::_process->run(v0, v1);
+      base::runProcess(v0, v1);
   }
 };
 
@@ -699,6 +764,11 @@ public:
   }
 
   virtual bool isMask() { return true; }
+
+  // masks don't write anything
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0*) { return true; }
 };
 HarmMaskFx g_harm_mask("HarmMask", /*freq_b_param_used*/ false);
 HarmMaskFx g_auto_harm_mask("AutoHarmMask", /*freq_b_param_used*/ true);
@@ -735,6 +805,10 @@ public:
 
   virtual bool isMask() { return true; }
 
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0*) { return true; }
+
 } g_thresh_mask;
 
 //-------------------------------------------------------------------------------------------------
@@ -874,12 +948,13 @@ public:
     InitHarmValuePresets(this);
   }
 
-  virtual void process(FxState1_0* s)
+  // AMP is AmpProcess or GainProcess
+  template <class AMP> void runAmp(FxState1_0* s)
   {
     float f_cent = min(s->temp.fbin[0], s->temp.fbin[1]);
 
-    AmpProcess amp(s);
-    HarmMaskProcess<AmpProcess> harm(s,
+    AMP amp(s);
+    HarmMaskProcess<AMP> harm(s,
                                      amp,
                                      s->temp.val, // value
                                      f_cent       // centre
@@ -894,11 +969,18 @@ public:
     MaskedRun(s, harm);
   }
 
+  virtual void process(FxState1_0* s) { runAmp<AmpProcess>(s); }
+  virtual void processGain(FxState1_0* s) { runAmp<GainProcess>(s); }
+
   virtual Rng<char> /*updated*/ dispVal(FxState1_0*, Rng<char> /*out*/ text, float /*0..1*/ val)
   {
     return HarmDispVal(text, val);
   }
 
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return AmpIs0dB(s); }
+
 } g_harm_filt_fx;
 
 //*************************************************************************************************
@@ -910,6 +992,10 @@ public:
   {
     memset(_params_used, 0, sizeof(_params_used));
   }
+
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0*) { return true; }
 } g_no_fx;
 
 //*************************************************************************************************
@@ -922,12 +1008,20 @@ public:
     _params_used[BlkFxParam::FX_VAL] = false;
   }
 
-  virtual void process(FxState1_0* s)
+  // AMP is AmpProcess or GainProcess
+  template <class AMP> void runAmp(FxState1_0* s)
   {
-    AmpProcess amp(s);
+    AMP amp(s);
     MaskedRun(s, amp);
   }
 
+  virtual void process(FxState1_0* s) { runAmp<AmpProcess>(s); }
+  virtual void processGain(FxState1_0* s) { runAmp<GainProcess>(s); }
+
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return AmpIs0dB(s); }
+
 } g_filter_fx;
 
 //*************************************************************************************************
@@ -971,14 +1065,10 @@ struct ContrastProcess
   void run(long b0, long b1)
   {
     for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
-      CplxfPtrPair dat(_b->FFTdata(ch), b0, b1 + 1), x;
+      CplxfPtrPair dat(_b->FFTdata(ch), b0, b1 + 1);
 
       // input power for this range
-      float in_pwr = 0;
-
-      // find input power
-      for (x = dat; !x.equal(); x.a++)
-        in_pwr += norm(*x.a);
+      double in_pwr = _b->bandPwr(ch, b0, b1);
 
       // find scale factor to normalize power to make sure powf works correctly
       float scale = MatchPwr(/*scale*/ 1.0f, /*target*/ (float)(b1 - b0 + 1), /*current*/ in_pwr);
@@ -1029,16 +1119,28 @@ public:
     return text << spr_percent(val * 2 - 1);
   }
 
+  virtual bool writesRunBinsOnly() { return true; }
+
 } g_contrast_fx;
 
 //******************************************************************************************
 struct SmearProcess : public AmpProcess {
   float _smear;
 
+  // random number key for each channel
+  unsigned _rand_key[AUDIO_CHANNELS];
+
   SmearProcess(FxState1_0* s)
       : AmpProcess(s)
   {
     _smear = s->temp.val;
+
+    // the phase of each bin only depends on the instance, blk position, fx slot, channel & bin so
+    // renders don't depend on anything else running
+    unsigned key = CtrRand32(_b->getRandSeed() ^ CtrRand32((unsigned)_b->_blk_samp_abs)) +
+                   CtrRand32((unsigned)s->_fx_set);
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+      _rand_key[ch] = CtrRand32(key + ch);
   }
 
   void run(long b0, long b1)
@@ -1046,14 +1148,17 @@ struct SmearProcess : public AmpProcess {
   // randomize the phase
   //
   {
-    long rand_i = g_rand_i;
+    float keep = 1.0f - _smear;
     for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
-      for (CplxfPtrPair x(_b->FFTdata(ch), b0, b1 + 1); !x.equal(); x.a++) {
-        *x = /*AmpProcess::*/ _amp * (*x) * (g_sincos_table[rand_i] * _smear + 1.0f - _smear);
-        rand_i = prbs32(rand_i);
+      cplxf* x = _b->FFTdata(ch);
+      unsigned key = _rand_key[ch];
+
+      // no dependency between bins
+      for (long i = b0; i <= b1; i++) {
+        cplxf r = g_sincos_table[CtrRand32(key + (unsigned)i)];
+        x[i] = /*AmpProcess::*/ _amp * x[i] * (r * _smear + keep);
       }
     }
-    g_rand_i = rand_i;
   }
 };
 
@@ -1077,6 +1182,8 @@ public:
     return text << spr_percent(val);
   }
 
+  virtual bool writesRunBinsOnly() { return true; }
+
 } g_smear_fx;
 
 //-------------------------------------------------------------------------------------------------
@@ -1089,26 +1196,34 @@ public:
     _fillValues(/*num*/ 5, /*min*/ 0.5f, /*max*/ 1.0f);
   }
 
-  virtual void process(FxState1_0* s)
+  // AMP is AmpProcess or GainProcess
+  template <class AMP> void runAmp(FxState1_0* s)
   {
-    AmpProcess amp(s);
+    AMP amp(s);
 
     SplitParam<2> split(s->temp.val);
     if (split.i_part) {
-      ThreshMaskProcess<AmpProcess, /*SELECT_BELOW*/ 1> thresh_mask(s, amp, split.f_part);
+      ThreshMaskProcess<AMP, /*SELECT_BELOW*/ 1> thresh_mask(s, amp, split.f_part);
       MaskedRun(s, thresh_mask);
     }
     else {
-      ThreshMaskProcess<AmpProcess, /*SELECT_BELOW*/ 0> thresh_mask(s, amp, split.f_part);
+      ThreshMaskProcess<AMP, /*SELECT_BELOW*/ 0> thresh_mask(s, amp, split.f_part);
       MaskedRun(s, thresh_mask);
     }
   }
 
+  virtual void process(FxState1_0* s) { runAmp<AmpProcess>(s); }
+  virtual void processGain(FxState1_0* s) { runAmp<GainProcess>(s); }
+
   virtual Rng<char> /*updated*/ dispVal(FxState1_0*, Rng<char> /*out*/ text, float /*0..1*/ val)
   {
     return ThreshDispVal(text, val);
   }
 
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return AmpIs0dB(s); }
+
 } g_thresh_fx;
 
 //*************************************************************************************************
@@ -1131,32 +1246,19 @@ struct ClipProcess
   {
     for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
 
-      CplxfPtrPair fft_data(_b->FFTdata(ch), b0, b1 + 1), x;
+      CplxfPtrPair fft_data(_b->FFTdata(ch), b0, b1 + 1);
 
-      // find min & max pwr of channel 0
+      // find min & max pwr of the channel
       FindMinMax<float> pwr_lim(1e30f, 1e-30f);
-      for (x = fft_data; !x.equal(); x.a++)
-        pwr_lim(norm(*x.a));
+      _b->pwrCache(ch).minMax(b0, b1, &pwr_lim.min(), &pwr_lim.max());
 
       // determine clip-threshold by interpolating min & max values (note that a thresh param of
       // 0 means not very much clipping should be done)
       float thresh = exp_interp(1.0f - _thresh_param, pwr_lim);
-      float sqrt_thresh = sqrtf(thresh);
 
       // do cliping
-      float in_pwr = 0;
-      float out_pwr = 0;
-      for (x = fft_data; !x.equal(); x.a++) {
-        float t0 = norm(*x.a);
-        in_pwr += t0;
-        if (t0 >= thresh) {
-          float t1 = sqrt_thresh / sqrtf(t0);
-          *x.a = *x.a * t1;
-          out_pwr += thresh;
-        }
-        else
-          out_pwr += t0;
-      }
+      float in_pwr, out_pwr;
+      g_spec_kernels->clipPwr(fft_data.a, fft_data.size(), thresh, &in_pwr, &out_pwr);
 
       // adjust pwr to match that before clipping
       MatchPwr(AmpProcess::_amp, in_pwr, out_pwr, fft_data);
@@ -1184,6 +1286,8 @@ public:
     return text << spr_percent(val);
   }
 
+  virtual bool writesRunBinsOnly() { return true; }
+
 } g_clip_fx;
 
 //*************************************************************************************************
@@ -1199,6 +1303,9 @@ class ShiftProcess
 //
 {
 public:
+  // writes the shifted bins
+  enum { WRITES_RUN_BINS_ONLY = 0 };
+
   // max bin
   long _max_bin;
 
@@ -1516,6 +1623,7 @@ public:
   }
 
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
 
 } g_shift_fx;
 
@@ -1525,6 +1633,9 @@ class ConstShiftProcess
 // shift frequency up or down by a constant number of Hz
 {
 public:
+  // the shifted bins are flushed from the temp buffer as it goes
+  enum { WRITES_RUN_BINS_ONLY = 0 };
+
   static float /*Hz*/ paramToHz(float v /*0..1*/)
   //
   // Convert freq shift param to Hz
@@ -1573,7 +1684,7 @@ public:
 
   void run(long b0, long b1)
   {
-    _shift.run</*CONJ*/ 0>(/*src first*/ b0, /*src last*/ b1, /*dst first*/ b0 + _frq_shift);
+    _shift.template run</*CONJ*/ 0>(/*src first*/ b0, /*src last*/ b1, /*dst first*/ b0 + _frq_shift);
   }
 
   void done() { _shift.flush(); }
@@ -1605,6 +1716,7 @@ public:
   }
 
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
 
 } g_const_shift_fx;
 
@@ -1617,25 +1729,33 @@ public:
     InitHarmValuePresets(this);
   }
 
-  virtual void process(FxState1_0* s)
+  // AMP is AmpProcess or GainProcess
+  template <class AMP> void runAmp(FxState1_0* s)
   {
     DtBlkFx* b = s->_b;
 
     //
-    AmpProcess amp(s);
+    AMP amp(s);
 
     // find a peak is in the first 1/8th of the spectrum
-    AutoHarmMaskProcess<AmpProcess> harm(
+    AutoHarmMaskProcess<AMP> harm(
         s, amp, /*value*/ s->temp.val, /*multiplier*/ 1.0f, /*b0*/ 0, /*b1*/ b->_freq_fft_n / 8);
 
     MaskedRun(s, harm);
   }
 
+  virtual void process(FxState1_0* s) { runAmp<AmpProcess>(s); }
+  virtual void processGain(FxState1_0* s) { runAmp<GainProcess>(s); }
+
   virtual Rng<char> /*updated*/ dispVal(FxState1_0*, Rng<char> /*out*/ text, float /*0..1*/ val)
   {
     return HarmDispVal(text, val);
   }
 
+  virtual bool writesRunBinsOnly() { return true; }
+  virtual bool gainOnly() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return AmpIs0dB(s); }
+
 } g_auto_harm_fx;
 
 //*************************************************************************************************
@@ -1644,6 +1764,9 @@ class ResizeProcess
 // resize can resize in the freq & time domains
 {
 public:
+  // the resized bins are flushed from the temp buffer as it goes
+  enum { WRITES_RUN_BINS_ONLY = 0 };
+
   //
   FrqShiftFft<AUDIO_CHANNELS> _shift;
 
@@ -1672,7 +1795,7 @@ public:
                              /*dst*/ (b0 + b1 - (b1 - b0 + 1) * _frq_mult) / 2,
                              /*dst scale*/ _frq_mult);
     else
-      _shift.run</*CONJ*/ 0>(/*src first*/ b0,
+      _shift.template run</*CONJ*/ 0>(/*src first*/ b0,
                              /*src last*/ b1,
                              /*dst*/ (b0 + b1 - (b1 - b0 + 1) * _frq_mult) / 2,
                              /*dst scale*/ _frq_mult);
@@ -1727,6 +1850,7 @@ public:
     return text << spr_percent(p.f_part) << " time " << (p.i_part ? "rev" : "fwd");
   }
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
 
 } g_resize_fx;
 
@@ -1785,13 +1909,13 @@ public:
       return;
 
     for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
-      _pwr_scale[ch] = GetPwr(_b->FFTdata(ch), f0, f1) / harm0_pwr;
+      _pwr_scale[ch] = (float)(_b->bandPwr(ch, f0, f1) / harm0_pwr);
       if (_copy_mode)
         _pwr_scale[ch] *= _amp * _amp;
     }
   }
 
-  HarmMatchProcess(FxState1_0* s, HarmData harm_data)
+  HarmMatchProcess(FxState1_0* s, const HarmData& harm_data)
       : AmpProcess(s)
   {
     // default for pwr scale
@@ -1883,7 +2007,7 @@ public:
       // scale mode
       for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
         // find what we need to scale the existing data by to match the harmonic power
-        float orig_pwr = GetPwr(_b->FFTdata(ch), b0, b1);
+        double orig_pwr = _b->bandPwr(ch, b0, b1);
         float target_pwr = _pwr_scale[ch] * harm_pwr;
 
         // attempt to match to harmonic pwr
@@ -1899,18 +2023,18 @@ public:
 //-------------------------------------------------------------------------------------------------
 class HarmMatchFx : public FxRun1_0 {
 public:
-  HarmData _data;
-  HarmMatchFx(const char* name, HarmData data)
+  int _table; // HARM_TRIANGLES...
+  HarmMatchFx(const char* name, int table)
       : FxRun1_0(name)
   {
-    _data = data;
+    _table = table;
     _fillValues(5, 0, 0.4999f);
     _fillValues(5, 0.5f, 1.0f);
   }
 
   virtual void process(FxState1_0* s)
   {
-    HarmMatchProcess match(s, _data);
+    HarmMatchProcess match(s, GetHarmData(_table));
     AutoHarmMaskRun(s, match);
   }
   virtual Rng<char> /*updated*/ dispVal(FxState1_0*, Rng<char> /*out*/ text, float /*0..1*/ val)
@@ -1919,28 +2043,24 @@ public:
     return text << (v.i_part ? "copy0" : "scale") << "/" << spr_percent(v.f_part);
   }
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
+  virtual bool writesRunBinsOnly() { return true; }
 };
 
-extern HarmData sweep1_coeff;
-HarmMatchFx g_sweep1_fx("Triangles", sweep1_coeff);
-
-extern HarmData sweep2_coeff;
-HarmMatchFx g_sweep2_fx("Squares", sweep2_coeff);
-
-extern HarmData sweep3_coeff;
-HarmMatchFx g_sweep3_fx("Saws", sweep3_coeff);
-
-extern HarmData sweep4_coeff;
-HarmMatchFx g_sweep4_fx("Pointy", sweep4_coeff);
-
-extern HarmData sweep5_coeff;
-HarmMatchFx g_sweep5_fx("Sweep", sweep5_coeff);
+HarmMatchFx g_sweep1_fx("Triangles", HARM_TRIANGLES);
+HarmMatchFx g_sweep2_fx("Squares", HARM_SQUARES);
+HarmMatchFx g_sweep3_fx("Saws", HARM_SAWS);
+HarmMatchFx g_sweep4_fx("Pointy", HARM_POINTY);
+HarmMatchFx g_sweep5_fx("Sweep", HARM_SWEEP);
 
 //*************************************************************************************************
 
 //-------------------------------------------------------------------------------------------------
 template <int CHANNELS> class HarmShiftProcess : public AmpProcess {
 public:
+  // the shifted bins are flushed from the temp buffer as it goes
+  enum { WRITES_RUN_BINS_ONLY = 0 };
+
   FrqShiftFft<CHANNELS> _shift;
 
   // scaling to get bin shift (frq_mult-1)
@@ -2020,7 +2140,7 @@ public:
   {
     // determine offset to apply to bins
     FixPoint<12> bin_shift = _parent->_curr_cent * _shift_mult;
-    _shift.run</*CONJ*/ 0>(/*src first*/ b0, /*src last*/ b1, /*dst first*/ b0 + bin_shift);
+    _shift.template run</*CONJ*/ 0>(/*src first*/ b0, /*src last*/ b1, /*dst first*/ b0 + bin_shift);
   }
 
   void done() { _shift.flush(); }
@@ -2055,6 +2175,7 @@ public:
   }
 
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
 } g_harm_shift;
 
 //-------------------------------------------------------------------------------------------------
@@ -2145,11 +2266,15 @@ public:
   }
 
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
 } g_harm_repitch;
 
 //*************************************************************************************************
 class ResampleProcess : public AmpProcess {
 public:
+  // the resampled bins are flushed from the temp buffer as it goes
+  enum { WRITES_RUN_BINS_ONLY = 0 };
+
   FrqShiftFft<AUDIO_CHANNELS> _shift;
 
   FixPoint<12> _frq_mult;
@@ -2173,7 +2298,7 @@ public:
 
   void run(long b0, long b1)
   {
-    _shift.run</*CONJ*/ 0>(
+    _shift.template run</*CONJ*/ 0>(
         /*src first*/ b0, /*src last*/ b1, /*dst first*/ b0 * _frq_mult, /*dst scale*/ _frq_mult);
   }
 
@@ -2209,6 +2334,7 @@ public:
   }
 
   virtual bool ampMixMode() { return true; }
+  virtual bool isIdentity(FxState1_0* s) { return MixAmountIs0(s); }
 } g_resample_fx;
 
 //*************************************************************************************************
@@ -2326,19 +2452,24 @@ public:
         if (dst.b > dst_end)
           break;
 
+        // bins of the segments (dst is written as we go so its power is taken out of the cache)
+        long s0 = src.a - b->FFTdata(0), s1 = src.b - b->FFTdata(0) - 1;
+        long d0 = dst.a - b->FFTdata(1), d1 = dst.b - b->FFTdata(1) - 1;
+
         // get the power from the src segment (or from src start bin if empty)
-        float src_pwr;
+        double src_pwr;
         if (src.equal())
           src_pwr = norm(*src);
         else
-          src_pwr = GetPwr(src);
+          src_pwr = b->bandPwr(0, s0, s1);
 
-        float dst_in_pwr = GetPwr(dst);
+        double dst_in_pwr = b->bandPwr(1, d0, d1);
         float dst_scale = MatchPwr(voc_amp, src_pwr, dst_in_pwr) + voc_mixback;
 
         // scale the dst segment to match the src segment
         for (; !dst.equal(); dst.a++)
           *dst = (*dst) * dst_scale;
+        b->pwrCache(1).dirty(d0, d1);
 
         // next segment
         src.a = src_next;
@@ -2440,7 +2571,7 @@ public:
       return;
 
     // power in destination harmonic
-    float dst_in_pwr = GetPwr(_b->FFTdata(_dst_ch), b0, b1);
+    double dst_in_pwr = _b->bandPwr(_dst_ch, b0, b1);
 
     // determine src harmonic
     long s0, s1;
@@ -2452,9 +2583,9 @@ public:
       s1 = _max_bin;
 
     // get src harmonic pwr
-    float src_pwr = dst_in_pwr;
+    double src_pwr = dst_in_pwr;
     if (s1 >= s0)
-      src_pwr = GetPwr(_b->FFTdata(_src_ch), s0, s1);
+      src_pwr = _b->bandPwr(_src_ch, s0, s1);
 
     // attempt to match dst pwr to src pwr
     float scale = MatchPwr(_amp, src_pwr, dst_in_pwr) + _mix_back;
@@ -2903,7 +3034,7 @@ struct WeirdMixProcess
     _bins_processed += n_bins;
 
     cplxf* fft_data[2] = {_b->FFTdata(0) + b0, _b->FFTdata(1) + b0};
-    cplxf* temp_buf = _b->_chan[0].x2.cast<cplxf>();
+    cplxf* temp_buf = (cplxf*)_b->_chan[0].x2;
 
     if (_mode)
       runMode1(n_bins, fft_data, temp_buf);
@@ -2954,6 +3085,9 @@ public:
   // actually distortion amount
   virtual bool ampMixMode() { return true; }
 
+  // the mix is copied back to both channels over the bins being run
+  virtual bool writesRunBinsOnly() { return true; }
+
 } g_warpmix_fx;
 
 #endif
@@ -9,6 +9,9 @@ morphing, can't store effect specific params and have become clumsy to deal with
 
 FxRun1_0 : run time object to do the effect, one object per effect
 FxRun only exists during the processing of a block. It has no data that persists between blocks.
+The FxRun1_0 objects are globals shared by all instances so they must not be changed after they
+are constructed (process() keeps everything it needs on the stack or in the FxState1_0), this is
+what lets instances run on different threads at the same time.
 
 
 History
@@ -81,6 +84,23 @@ public:
   // default is amp is dB all the time
   virtual bool ampMixMode() { return false; }
 
+  // return true if process() only writes the FFT'd data through processes that write nothing but
+  // the bins they're run over (the mask drivers take those out of the power cache), otherwise the
+  // whole power cache is dropped after process()
+  virtual bool writesRunBinsOnly() { return false; }
+
+  // return true if process() does nothing to the FFT'd data but multiply bins by a real gain (the
+  // same on all channels), DtBlkFx::procFFT then calls processGain() instead so that the gains of
+  // consecutive slots are applied in one pass
+  virtual bool gainOnly() { return false; }
+
+  // as process() but multiplying the blk's pending gain (DtBlkFx::mulGain) instead of the data
+  virtual void processGain(FxState1_0* s) {}
+
+  // return true if process() would leave the FFT'd data as it is with the params in s->temp, if
+  // all of the effects do then the blk skips the ffts (see DtBlkFx::prepareFx)
+  virtual bool isIdentity(FxState1_0* s) { return false; }
+
 public: // methods for the GUI
   // is this a mask effect or a normal?
   virtual bool isMask() { return false; }
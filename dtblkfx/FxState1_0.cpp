@@ -99,18 +99,18 @@ void FxState1_0::prepare()
 {
   using namespace BlkFxParam;
 
-  temp.fft_fx = getFxRun(false);
-
-  // copy param values to temporaries
+  // copy param values to temporaries (from the blk's snapshot, see DtBlkFx::blkParams)
   //
-  temp.amp_param = _b->get(&GetInterp, _param[FX_AMP]);
-  temp.val = _b->get(&GetInterp, _param[FX_VAL]);
+  const float* p = _b->blkParams().fx[_fx_set];
+  temp.fft_fx = GetFxRun1_0(getEffectType(p[FX_TYPE]));
+  temp.amp_param = p[FX_AMP];
+  temp.val = p[FX_VAL];
 
   temp.amp = BlkFxParam::getEffectAmpMult(temp.amp_param, temp.fft_fx->ampMixMode());
 
   // freq stuff
   for (int i = 0; i < 2; i++) {
-    temp.freq_param[i] = _b->get(&GetInterp, _param[i]);
+    temp.freq_param[i] = p[FX_FREQ_A + i];
     temp.fbin[i] = _b->getFFTBin(temp.freq_param[i]);
     temp.bin[i] = RndToInt(temp.fbin[i]);
   }
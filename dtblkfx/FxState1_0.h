@@ -64,6 +64,9 @@ public:
   // perform the effect
   void process() { temp.fft_fx->process(this); }
 
+  // perform an amplitude-only effect by collecting its gain (see FxRun1_0::gainOnly)
+  void processGain() { temp.fft_fx->processGain(this); }
+
   // get previous fx state from blkfx (or NULL)
   FxState1_0* prevFxState();
 
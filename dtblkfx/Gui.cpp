@@ -34,7 +34,7 @@ General Public License for more details.
 #include <valarray>
 
 #include "BlkFxParam.h"
-#include "DTBlkFx.hpp"
+#include "DtBlkFx.hpp"
 
 #include "Gui.h"
 #include "Spectrogram.h"
@@ -275,10 +275,7 @@ bool Gui::open(void* system_window)
 
   // build pixel to bin range mapping
   for (i = 0; i < BlkFxParam::AUDIO_CHANNELS; i++)
-    _pix_bin[i].init(_pix_hz, //
-                     blkFx()->getSampleRate(),
-                     blkFx()->FFTdata(i) // FFT data buffer
-    );
+    _pix_bin[i].init(_pix_hz, blkFx()->getSampleRate());
 
   // temporary bitmap for children to use as an offscreen buffer
   _temp_bm.create(rect.right, max(Images::g_glob_bg->getHeight(), Images::g_fx_bg->getHeight()));
@@ -319,6 +316,9 @@ bool Gui::open(void* system_window)
 
   _ok = true;
 
+  // start getting spectrum snapshots from the audio thread
+  blkFx()->_spec_snap.enable(true);
+
   // load params from the effect
   for (i = 0; i < BlkFxParam::TOTAL_NUM; i++)
     setParameter(i, blkFx()->getCurrParam(i));
@@ -327,28 +327,18 @@ bool Gui::open(void* system_window)
 }
 
 //-------------------------------------------------------------------------------------------------
-void Gui::FFTDataRdy(int a // 0=input data, 1=output data
-)
-// preconditions:
-//   DtBlkFx::_protection is locked
+void Gui::showSnap(const SpecSnap& snap)
+// called from idle() for each snapshot taken out of DtBlkFx::_spec_snap
 {
-  // note that there is a potential race if the gui is open, closed & re-opened during this
-  // method but I think that it being closed & reopened so quickly as to cause a problem is
-  // unlikely
-
-  if (!_ok)
-    return;
-
-  int plan = blkFx()->_plan;
-  long samp_pos = blkFx()->_blk_samp_abs;
-  long time_fft_n = blkFx()->_time_fft_n;
+  int plan = snap.plan;
   if (BlkFxParam::AUDIO_CHANNELS == 1) {
     // mono, input data always goes into upper sgram & output into lower sgram
-    if (!_sgram[a]->rdy())
-      return;
-
-    _sgram[a]->newData(_pix_bin[/*channel*/ 0].getMap(plan), /*scale*/ 1.0f);
-    _sgram[a]->blkDone(samp_pos, time_fft_n);
+    for (int a = 0; a < 2; a++) {
+      if (!_sgram[a]->rdy())
+        continue;
+      _sgram[a]->newData(_pix_bin[/*channel*/ 0].getMap(plan), snap.pwr[a][/*channel*/ 0]);
+      _sgram[a]->blkDone(snap.samp_pos, snap.time_fft_n);
+    }
     return;
   }
 
@@ -367,18 +357,17 @@ void Gui::FFTDataRdy(int a // 0=input data, 1=output data
 
     // update spectrogram with audio data
     bool update = false;
-    for (int ch = 0; ch < 2; ch++) {
-      if (g_stereo_ch_menu_map[a][menu_val][ch]) {
-        float pwr_scale = 1.0f;
-        if (a == 1)
-          pwr_scale = blkFx()->_chan[ch].out_pwr_scale;
-        _sgram[sgram_i]->newData(_pix_bin[ch].getMap(plan), pwr_scale);
-        update = true;
+    for (int a = 0; a < 2; a++) {
+      for (int ch = 0; ch < 2; ch++) {
+        if (g_stereo_ch_menu_map[a][menu_val][ch]) {
+          _sgram[sgram_i]->newData(_pix_bin[ch].getMap(plan), snap.pwr[a][ch]);
+          update = true;
+        }
       }
     }
 
     if (update)
-      _sgram[sgram_i]->blkDone(samp_pos, time_fft_n);
+      _sgram[sgram_i]->blkDone(snap.samp_pos, snap.time_fft_n);
   }
 }
 
@@ -479,11 +468,8 @@ void Gui::close()
 
   _ok = false;
 
-  // assume blkfx hasn't been deleted yet, make sure that we are sync'd with it before going on
-  // since it might be currently updating the sgrams (which are about to be deleted)
-  {
-    ScopeCriticalSection scs(blkFx()->_protect);
-  }
+  // the audio thread never touches the sgrams, just stop it making snapshots
+  blkFx()->_spec_snap.enable(false);
 
   // release these things
   _sgram[0] = NULL;
@@ -518,6 +504,12 @@ void Gui::idle()
   // inject these events so that we can catch the mouse leaving the window
   GenerateMouseMoved(frame);
 
+  // draw the spectrum snapshots made since the last idle
+  while (const SpecSnap* snap = blkFx()->_spec_snap.front()) {
+    showSnap(*snap);
+    blkFx()->_spec_snap.pop();
+  }
+
   // update the spectrograms
   CViewDrawContext dc(frame);
   for (int i = 0; i < 2; i++) {
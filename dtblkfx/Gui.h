@@ -61,10 +61,7 @@ public:
 
   DtBlkFx* blkFx() { return (DtBlkFx*)effect; }
 
-public:                 // methods called by DtBlkFx class
-  void FFTDataRdy(int a // 0=input data, 1=output data
-  );
-
+public: // methods called by DtBlkFx class
   void suspend();
   void resume();
   // bool keysRequired ();
@@ -87,6 +84,9 @@ public
 public: // internal stuff
   bool openSgram(int i, CPoint* p);
 
+  // draw a power spectrum snapshot from DtBlkFx into the spectrograms
+  void showSnap(const SpecSnap& snap);
+
   // gradient colour map to draw spectrum with
   std::valarray<unsigned long> _col_map;
 
@@ -0,0 +1,160 @@
+/**************************************************************************************************
+Harmonic power tables for the HarmMatch effects, see HarmData.h
+
+The tables were written as floats with 6 significant digits, so each value is stored exactly as
+the digits & a power of 10:
+
+1. each value "mant * 10^(exp10 - 5)" (6 digit "mant") becomes HarmValueCode(mant, exp10), codes
+   go up with the value so neighbouring waveforms give close codes
+2. the tables follow each other, each one [waveform][harmonic], & every code is stored as the
+   difference from the same harmonic of the previous waveform (zig-zag, so small negatives are
+   small)
+3. the 32 bit differences are split into 4 byte planes (all the low bytes then the next ...), the
+   upper planes are mostly 0
+4. zlib compressed then base64
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <string.h>
+#include <vector>
+
+#include "HarmData.h"
+#include "zlib.h"
+
+namespace {
+
+enum { TABLE_N = HARM_SWEEP_N * HARM_N, TOTAL_N = NUM_HARM_TABLES * TABLE_N };
+
+//-------------------------------------------------------------------------------------------------
+int Base64Val(char c)
+{
+  if (c >= 'A' && c <= 'Z')
+    return c - 'A';
+  if (c >= 'a' && c <= 'z')
+    return c - 'a' + 26;
+  if (c >= '0' && c <= '9')
+    return c - '0' + 52;
+  if (c == '+')
+    return 62;
+  if (c == '/')
+    return 63;
+  return -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void Base64Decode(const char* const* src, std::vector<unsigned char>& dst)
+// decode all of the strings in "src" (up to a NULL) as one, padding is ignored
+{
+  unsigned bits = 0;
+  int bits_n = 0;
+  for (; *src; src++) {
+    for (const char* s = *src; *s; s++) {
+      int v = Base64Val(*s);
+      if (v < 0)
+        continue;
+      bits = (bits << 6) | v;
+      bits_n += 6;
+      if (bits_n >= 8) {
+        bits_n -= 8;
+        dst.push_back((unsigned char)(bits >> bits_n));
+      }
+    }
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+struct HarmTables {
+  // all tables, rows of HARM_N start on a cache line
+  alignas(64) float data[TOTAL_N];
+  HarmData table[NUM_HARM_TABLES];
+
+  HarmTables()
+  {
+    std::vector<unsigned char> z;
+    z.reserve(g_harm_z_n);
+    Base64Decode(g_harm_z64, z);
+
+    std::vector<unsigned char> planes(TOTAL_N * 4);
+    uLongf planes_n = (uLongf)planes.size();
+    if ((long)z.size() != g_harm_z_n ||
+        uncompress(&planes[0], &planes_n, &z[0], (uLong)z.size()) != Z_OK ||
+        planes_n != planes.size())
+      throw 0;
+
+    unsigned prev[HARM_N];
+    for (int i = 0; i < TOTAL_N; i++) {
+      int h = i % HARM_N;
+      if (i % TABLE_N == 0)
+        memset(prev, 0, sizeof(prev));
+
+      unsigned zz = planes[i] | planes[i + TOTAL_N] << 8 | planes[i + TOTAL_N * 2] << 16 |
+                    (unsigned)planes[i + TOTAL_N * 3] << 24;
+      prev[h] += (zz >> 1) ^ (0u - (zz & 1));
+      data[i] = HarmCodeToValue(prev[h]);
+    }
+
+    for (int i = 0; i < NUM_HARM_TABLES; i++) {
+      table[i].data = data + i * TABLE_N;
+      table[i].n_tables = HARM_SWEEP_N;
+      table[i].n_harms = HARM_N;
+    }
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+const HarmTables& Tables()
+{
+  // decoded by the first caller (thread safe static init)
+  static HarmTables t;
+  return t;
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+float HarmCodeToValue(unsigned code)
+// powers of 10 up to 10^22 are exact doubles so the division is correctly rounded, giving the same
+// double as the compiler made from the original literal (which was then cast to float)
+{
+  static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                 1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  int exp10 = (int)(code / 900000u) - 17;
+  double mant = (double)(code % 900000u + 100000u);
+  return (float)(mant / pow10[5 - exp10]);
+}
+
+//-------------------------------------------------------------------------------------------------
+unsigned HarmDataHash(const float* data, int n)
+// FNV-1a of the float bits
+{
+  unsigned h = 2166136261u;
+  for (int i = 0; i < n; i++) {
+    unsigned v;
+    memcpy(&v, data + i, sizeof(v));
+    for (int j = 0; j < 4; j++, v >>= 8)
+      h = (h ^ (v & 0xff)) * 16777619u;
+  }
+  return h;
+}
+
+//-------------------------------------------------------------------------------------------------
+const HarmData& GetHarmData(int i)
+{
+  return Tables().table[i];
+}
+
+//-------------------------------------------------------------------------------------------------
+void InitHarmData()
+{
+  Tables();
+}
@@ -1,5 +1,22 @@
 #ifndef _HARMDATA_H_
 #define _HARMDATA_H_
+/**************************************************************************************************
+Harmonic power tables for the HarmMatch effects ("Triangles", "Squares", "Saws", "Pointy" &
+"Sweep")
+
+Each table is a sweep of HARM_SWEEP_N waveforms, each with the power of HARM_N harmonics. They're
+stored compressed (HarmDataZ.cpp, written by "dtblkfx_tool harm-tables -write") & decoded once into
+one shared aligned buffer, see HarmData.cpp for the format.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
 
 struct HarmData {
   float* data;
@@ -7,4 +24,40 @@ struct HarmData {
   int n_harms;
 };
 
+enum {
+  HARM_TRIANGLES,
+  HARM_SQUARES,
+  HARM_SAWS,
+  HARM_POINTY,
+  HARM_SWEEP,
+  NUM_HARM_TABLES,
+
+  HARM_SWEEP_N = 120, // waveforms in each table
+  HARM_N = 128        // harmonics of each waveform
+};
+
+// table "i" (HARM_TRIANGLES...), all tables are decoded by the first call (thread safe), call
+// InitHarmData() at load time so that it isn't done on the audio thread
+extern const HarmData& GetHarmData(int i);
+
+// decode the tables now, throw error if the stored data is bad
+extern void InitHarmData();
+
+// hash of a table's float bits (to check the decoded tables)
+extern unsigned HarmDataHash(const float* data, int n);
+
+// encoding of one value (see HarmData.cpp), "mant" 100000..999999 & "exp10" -17..0 for the value
+// mant * 10^(exp10 - 5)
+inline unsigned HarmValueCode(unsigned mant, int exp10)
+{
+  return (unsigned)(exp10 + 17) * 900000u + mant - 100000u;
+}
+extern float HarmCodeToValue(unsigned code);
+
+// the stored data (HarmDataZ.cpp): zlib stream of "g_harm_z_n" bytes in base64, split into
+// strings (the last is NULL) & the HarmDataHash of each table
+extern const char* const g_harm_z64[];
+extern const long g_harm_z_n;
+extern const unsigned g_harm_hash[NUM_HARM_TABLES];
+
 #endif
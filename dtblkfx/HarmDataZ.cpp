@@ -0,0 +1,2721 @@
+// harmonic tables for the HarmMatch effects, see HarmData.cpp for the format
+// written by "dtblkfx_tool harm-tables -write", don't edit
+#include <StdAfx.h>
+
+#include "HarmData.h"
+
+const long g_harm_z_n = 186792;
+
+const unsigned g_harm_hash[NUM_HARM_TABLES] = {
+    0x21e23054, 0xbbc85184, 0x48e2b2ef, 0x48eb5235, 0xa0a9502c};
+
+const char* const g_harm_z64[] = {
+    "eNrEl4N2KIqCQ2vbtm3btm3b7alt27Zt27Ztm3PnK15+ISs7CdkgzmQnkAxTp4nd9bdWp8ev0P4mSfhoIV/8fO9wrIka"
+    "kNJiJhUJU339Itnu7D3BvoYCWmbnPheYWHurC0ggCEw0ikJwIZvR82J4aL+YA4T36vF0JwhLcnlo/Gy0ksHmM45KfT2e"
+    "wnImG1gqEZ+/W2+od6ec1eivxXXx6DIL1zuIz689rBaGnldcKbz8cA6OUEk540044zNsViq5vRk2kKzrrl/C7dIu6lyv"
+    "eipfXU3OEn6Z2SbiP3zclxXx2t+1hgNQx4QZvQ3BJ+iQtg62mC+fpZylG5+PnJAodFh1d0dz539bgD9bb3+C5GHQVabS"
+    "/EfcVyVNmnv4CTHaNagjVZQT/YbvsQg8r1VuH4LPs4fTC1hFC6FLFqBxMszImSO5AwNc+mGP5gKmY/MB9L0Vqvo9bz/Q"
+    "NgNR4PBb+gOM+7DGZdzO7h1yktRDK9yiLx7MUW2elnFB+NYPYY6iwH5dY1FV1tqqPbCFhgOGPcaiIYb6iG3Q5m+e9EUJ"
+    "hnsJxC2gUZzB7mCb2x7llqPmavfNzaeWybiKGj6LFWVqxqAMWRILX7PQLwHSv7aU5kXyP6zvwl0BbYjWZqRVXVcFqF94"
+    "svby2D53GSwfysjm7Lb8QBmUA3dPWc7mgl1Z5O41kvb12GNFvK60A2JPERmAJ/qcCy8fH3XcZ0FdzAdzWzF5B2dRrjDA"
+    "owzNGuUHNMhulQCdpeCVgv6v+i4BxMU7aaKWj6BTEIrSFwmvIQXWRcpRXKPoYdAfyopgK/w/R2FBrs/iFZDWWz/kjX3M"
+    "nOBXO4Y8uKAT3OLiriNPjvg1GXk8ATj6KewNxhOwe4gtCe6eE/AjOV3soneYSbzwC08DQ4K2J0N7NC/37/1qYLL5eff7"
+    "FhTzwL4zbnZiaK59hRElMaLfol+Mymm4/uGwWz/a4NCzzNLmXStPGXIbnpKqwhlf36olMwd5eWlO/FFzwPNlwAw/oH/6"
+    "2xNb+OasiBMXOZdvEhf/eZ2V0OEnWGPs+SIZQaxrr8t4gllmu3RlPKB7AT3iR6z30pv/3CsxEiv+vmt3aS25PNeepuGV"
+    "FyG6s1BB9q5JeDb3srav+6dtCx1Qki28hQOJuxXnYin+LjtManrTBCp5AqPIfYCvePCmoV0j+gFe4ycctlEV48k5MNLn"
+    "TJ7xo/igvvFv4ynlA1SfN8BnrgJ/DP5M0fRqaqiPd2enxFSrzKkLhs23sbJIJcJjW6XfPYegKJq6rJ4fEtHxKwrCgluk"
+    "wI//xAuQlcwVPiXukbttIYFc8eS5L68xCOSszzxpxTEvPkhXnzav6F82ObTuWg0wZ/wVN6u7ahD3Fn3dWEYfIWTNlXNY"
+    "2lJNmb0zKDDryJOgYNRfluPXjHLCWI1o23ZAct8ijG+ox0G8qj8rGdbDymveNmiMv2oV482FJlxS1PxK1UvdO/8Rliv9"
+    "ASVaTJp9SRMpNd8I44c0xsiGZdRQUQgKMTin9ttBPs5YWYZxw4DZMGrEAHfbHoV23VWUYlTWibU0cwfuyZy1u21WxVcG"
+    "qHzR11LVjOvaRpjwRNMX5IBMj/epmkb6WjHzZMIsufREjKgAI3gIfdOEvOkdQpy8QR/5iOWu6tO0rW1K3f4Zq4/0nyAm"
+    "U8RWjiheUsnKmfQfYCWhH3pI1lqmEDD41pulMAnsXIMfbxh3rWfHn7C8ZcuSalwerKXu0kaSNiEk+Y6tM6S8ICh2mn3G"
+    "HidqxZqktsfFuBKPf8VeKOb+D7TPg+DVw/3Dd47giSYo/Emm5JgSbcHYh0Zc3+WbILkyRoVtlWTKG3mp69ZLw8uQIC6r"
+    "9l8U5hNgzpemn4C8OvYI5I+omuidtfpagPmhdoyr9k+XbNII45WfT8pdQR70j/XHjs+UOfEJsK18A/UKYyYpbJSrQAmf"
+    "/exYneotJtBPSQNizJzfJqkUMb41/5bwmEIVsqf6gK1+57gjrKzwQ8X7AO8qNDh2lan8TYustOAZ4g0/NTQm6cRaETqt"
+    "3N5C31zDBymZ5FzW3EaYoPyE5D9qUteRPWbaiEVgS9y1hyjdIlFuSePwgry7iipG2d0HVtIZTu3tESz6fszvmnp5Mso0"
+    "+uyoB1X5KbO736I/0Ly+1j9feX3iu5zzHd6+G7RZwd+ygznIfcuLt7mUEu0PYklp0KK7ckDMtoCkn47CCNiMvTxmyvgt"
+    "xq2jqKGqHEBt59uNrzT7mBVaNlXZGnJ7+Rkt9SXeh6s33MkzfNx/zpj4jj1FxqEretqNE8nS1LzpM+QVLF2IZ81/wZLP"
+    "6iUFXHkkwhUNDmAs7unE1D0Nw/WczqB9muqFF/LEO1NxppaO/xQlfSbcQAe0ReGF9WN5X5x5nC+EN1jTJvpuBFltzXes"
+    "ZRTLgvKwTVFVfaTNvyABW4pRyZ94w9jDDn20OWQnCGUrOK8gq7MWrZfNS3GFQbnQFScq6VlZ97HrEe2ebHFPnZ8tizX1"
+    "PD79gCxxrePWpTyN4YPEd2gcr4y5ewoC8KGXBD8NM0jmqjQzn9kZSR58utyQOxxHMv7gWygdyx4U6eYqMZdGpg5yApwF"
+    "YfcRzbTZl6OEfdEDlswfJakT9+BJVR8YVjaWjVOBp1A31fmtVzQ9TfsVhYG3G1qFkcpanlczTBg3hI21NAqakxSDuIkI"
+    "yMkPJKH9OrBDmCHRhxx4V4zlO0n9CLpQF65dykwvT0Y2O0mXwM9G5IhpAjifGKkHP+q62DPdN7gbTPOyrAApFhI+CgFx"
+    "SJG/iLstcBUqykQVJR9JBW0Ms3GJg5yAFZ0RFVWxi2ldQ8jgDcD76Rd7X0H51pIHpnCkfviqJiFHgi9dU/6q1IWTZBnz"
+    "Mm/gqYRx9erZKDHtprAvOFLGWgoQ5VEN+YNtMwLI7AkkiXJtqkpZSEcqQBI1hnT6LNBPFFWg8aqIhO9rBckHLzhZe8+O"
+    "3HMfjktoVdK4U4xXWvGZNek/btY2adWp+8FZfobn8MAiP87XaJJevDI59txx5TVlcl3OxKu+DDWx4EYCEcMeUa+Amh1+"
+    "slf9bI/TFU2tA+YURY2zLg/ZTyo4dfCpWHhi8tzv5rPBtr0qGPQ7zVsFtbJKA9LmJGIwSVP37PIAj6zokdwp4DGBCGMe"
+    "Yq6qhbO04/Szj3y59TIC/VbpcVQRimn6zmXD/1nvvybCx6BTzu0nonxcLBnb0kLc/9usQ7c5WnnMxVCXRPvDsGLFXeNx"
+    "FpZJOwuo9op44q25zR+8ToHICeEX2WKeJ9gpoOm0+gvCptwHf4QOLb7vecVWufMr1SKM7ljHtT2ljnG0tJaa8iP1Iww8"
+    "+K4A6882JxHPx6+OVOBHUiQYwL9HysYnJZbU9Vjed3cm3JNTbnd7RqEn1Lpy0AKI58Q2ZjXJJn1BM4c+WOcjYsqtbs/8"
+    "ZTkVeKNz7oz63d5ERdbKJ/9Y6dw9IOUWFGbnM9M4LV+jf8usyBylEZELyZ7ZGNwaoufvY+LEByVVDx0ZNp90AzOeVg3k"
+    "hgim62/BHTmwdtPajSqBJFUPGGDg9Fzzo0Plm7QajeBPfXlUbnQ5E04DDd+3FbYyr7ssGB3ft9vMJsrK/di9/Q3Tqwn/"
+    "Bl1Qj6FCPSwTBQKGOIImJDgt/cvczHFkz6dZPm9l+6s0k22a5h26mqNMB60IWeuimStNiLe5zgmvYEHmsCAx2jOOe+t4"
+    "30vOeaEfEbdcIzJdSeSxSdG/XU88jY20HBwDon8RTpoyEF8ApOPfClW6FqM5vb60+Wkn9t0LtFMj6a6N8NyLeYFudERM"
+    "om5MTCESmcwBjINKVAC3OP70HPGC99Yd5BWTz9jKoVyn1V0RXPkOcpGlKISx50uyemGyWiQpwd44a7sveD+BDLFs/NjY"
+    "5sTCyMfyY/QnSieJ1OhIoirbgxr4s7W7PDjL3b9NRuEPdao0DKPh1fD12fiCW+eZxrC9NMrgP6Rz9wBXxeNrHy/1RT9a"
+    "YXC4b8sHYcqpgWBmSvXKMRJ1t5UGtmBd0t8o6qXtJSSigHAFk/1lZ82H0nD00Td1X0ZUUSYE/cGS1HVmnzZ7N3jYE9n9"
+    "9eIAD+kvvtDm8nd8ns3uFHq2GPyE6MFV6rNfy6ZnVVDcFXewkco198LQY3DsrAhpj6AkdZp+hTtU4YdQUQDi7+vU1hNk"
+    "aSzvZJEMZO0jHnjpLgHW7NKdBfcY0JkMiN8aC0IeS2zBEPf8AJwjs+8FBxyZCTYFFMZ9J6DI74CbYpCjijA84qlckg8c"
+    "yRLKlgM5B5tWEsFvnvDBQNySmeJUaQIR1k5Q4J1ZXr3+Hf30Y5hMe+Z2cZo4g+fkEpvzp9IH9Y77rpwc/4TPjErO4J0o"
+    "eBELAIsHJs2Vhwgphpo5NgfOeCip9LP5wZ04wu1bg7Lv+SNCUnYGtrk/RyvNSA+yyvUauII1AFq54g47+ZVrrOfQwDZ2"
+    "Q3eAPH7ni5T4JgnV3yXCdhVYQX1d+Iz9FRjzIKCbry7GMsdc8Ii/p4LyXnX+zDk2C/71bPM35lDFj1sIsuG9zB54C7/g"
+    "yhBgGj7+kaYqotSCS1/5SjnIIb3QZr6bgzleuCFbVJACSDeihaEEmCAvikp3G0Nt5c/3kPRKJKO3X/HWbHwIGJDKV0Oo"
+    "+cbsBfgmJ6WkXgeRXikZfowcSRCTnPkmxT7iCt0ViidAIVBxJTPzwVE94iy7dF8jX5hDd1WSAZbmOhn+J1Ofu064ZCC/"
+    "M9gemoa+IWzbRC2LSK4l4r8DPJqv0ITXKkzUfzTllxpRvv9aKB11XI63JGPc2Fbm0/3n73KRq3SNff/QMVlJh9Ilm+/U"
+    "iQj7R4703UzMe/xsCjQUQUwCJZsYHuBxMdXr5b/h2odb0wGQd5BhdHHwI4CUVk7A3KnvCZYqBt4iap+zHBU5ZY36xuBs"
+    "7NoG0xhLliFYzoWBfR/YURTPq+7pHyAHcy1xglCoZgdzwz/bJs9KkDtp1Lz/kD8lw+tuQJNsVzbH2qvaQUbYAUKByc/d"
+    "rdRcMqWfEFqe40/DKUbd9Ai1yUSyAdnRtpkgyEhBvi4czYW76i25UmDPMbka4vgvGHV5qNPS7+eZassZPyZ/G2C9JMtg"
+    "Eyv2r44Q/Ma8balnZ1+n9Brieyr5mnZoBrEVi4WxOHQ0XN74D5Fkoq2ds9R7+rftm9nldezzrZK8jMDT5d5Wa7DBqGyG"
+    "TmPPbyZlU+/fLSZ1cgbA/1ifBVDt55bX38HCObWV5yB6wTv36LlioGoCNgTn893q4cmZswhEXh/viRaD4ducWW6/ArPn"
+    "JD9yeve+EMteg0iv1dqMt0S572jRGtP+AITtlQSPMoVyUHuvYt0UvsEKK3x49QBQ1d/NQr35hXCPww6jbIfl4yC7ZjQo"
+    "xvP9SGYCCKM9n5mb3fkMApTRt9PN382tJvGn/QLHcolqYiBux07Z5+WLzxbLVr4K5qHvZokxNmoeApPL2Tmrk6NsNAK1"
+    "eLc8elwuCFpGbm5AmiAytaXt5wS3m4cWvVCbAs0YvTROHG7MenKXcAKTkShWbo23IGQm21o4RIyd383xg98YyTzL/j+B"
+    "t4HNNnTLl7uTg49qVr0Q0eP+n2ACXOMoEI+RApUmoyTeizrxzQKFsZEmQDB8SEM2q7OvEsskN3DDiwYiJptcl7OJyOGB"
+    "IlqDzRa/DnQ2tW6VUtG3WL8UWIUi+6OnwTrH3r6jw5fpFPUEqdv9AK3pr2J848kITKseMJuJt97L0HQefPNWyb9wowKB"
+    "j2wClW4Kh+HjkXxyKlJE4aqbPMXn+zKL67Hf3q9S0Sbd+8s0tqmJBRJYLHw29SQgQHByFt+RBBi3o14+s7/7Vkr9s77p"
+    "LquXw2Q2WtVYi50AKOk0bgbBEMyrMgLjmVLtig7ZUhIcoSqRIK+/ekiFkeFWnfkNwy7x8wzDj5NmNDyf7RyJCu3HIgRe"
+    "PKvJGngu/Ier9xYQ2bcWg3j33fUAKLPj3vVep9lmxflMZhR2Jt5UqeMyuaPtnWDBWL+ABLvtGCDxJKuJifmNRCBQ6WLn"
+    "MO9cZizHnUYu5wKHdq3T2xJc6Y/739lqtXCjNErF2R4cEN3lfD/3w+PXse3Hjw4CRhiVvhwoNLN0HsEyBjjBwRBUj6vD"
+    "XsNK06/+ICzrHBoaat+zSumPkzSe2xg0/mb1idFgXPFG22avre3Rz0QavjQGOFTZwVAEnXDJdjbtwzCDl2As2c00VIkU"
+    "aPkSDsku8bEuAnh8RhhQ+wgqcGwM+8HLwTKVqBDdjbuvQs0ichheEkjLrY/bAr84t9OTqXLxk3LhUHr7FsnJPAQsq81i"
+    "z2oGJmwodkTVeDY45aqx/rP9KpU8NsWPOLVqSJdIAL58PBiRUHrxq6fvWstml4F4s400SGjLPI0qseHe71rDHrehsRSl"
+    "Ti6F7/tG6aEch4X1ZjZIvxhPs0RodBRGrwKbAhLTNJlO9UjrVkSH3euVoUgspWZcJoOhp/7pkaP7FL6L4Qh0mzZY6d6f"
+    "LpG5g0pItlI4nXaPbFKv7TgU5bN4LHpMqSRyKt5yaFLvudfXh7Mqw/5otQ4qgVJaNCKfdq10+5XtLKub8e9MZIm+KreB"
+    "PKXnx8OfQO7VRC6BhTzp34HLnavJEon+zVgyxRRgXOEYGulwz3JKFq/70acQn16DJkhMOrWV95V6XGh6WOGnctm9BgBI"
+    "JNsy+QhmBlpytWoCXAhgn3rf83LhCComma2DnYmJiXg86Wx4bkRi5zLL/a0uANHpzTQci2wYZkwY18F0kygE1Z00VZPt"
+    "xxpE7/6b4/m9q8lwrdvXSEYI79ksBumtga0SUuvBDlxeEijxvRq1GCKxDv5CcgadAEIWJlgSLnoKIuU0KAqd+yqdAFjr"
+    "NI2bDpupy1y+CmjxwzIaMFI6OO1ynxqFDJvP1cte8b/FCkRW6eM8eFiVs7N6Tqf+hYP1EIvb8TIJXPvFervpAuti+YP5"
+    "y/c2cBRK6Zf7uU4kZrkYRP0YnyA4Tmib4xoUNPXLEu2Xeo+bbnx6JL/3+dn5qZfL2YlqatVsKiabJAzXNgaxoSRWixaL"
+    "3q0YeAaNzTpOk/M4jadir8nP5aWtZFqNFuUOOmx0Movdq/fnHNFAqxwqwaUAqyv+TNEs8QRejQ6HbCLfcgAwxd9Oi1bf"
+    "BGRyqdPL8Zn/8fb9sri2222wvHoTSWR/vLrRC62eDOfyEAett96oWkpJxwlHTgyFy+KeLNDoU04oHYXi0wtmmGuQ7LA4"
+    "nsEFi4KAQksvkkHlMPsVovExk4So+1rr+BNITKXee3A0lYUDNNUi0krvOX7/24hj3Xc8ODY2U+tYRsF/EKxR5Xz3lgxt"
+    "91ajc1AJRiz8cFKH6fK6fVLEG4eEAEDEJZzLG86tkc7kmenVLlCGIpHA7jo9XIJgvN7M5dPXKP1Tpr4YTIuH5Jeq3Lc2"
+    "EiB/MpNsP1/oMtsiVc4I5VGpEClRxW0awhcYZXDR5FBrmkDsfbdyXWH2XOa0XSZTw5vi+hPg0QGOKPfZ26LSYj2dAEVt"
+    "F0aMZXh8vzO8vTDzMbszs5WAbnUUhWlbTuqcqvA62AOFC8hrVm2aY1votxHoWeuWRwLnezTdAI/mUQzHAo8DbxZLjExM"
+    "4JvGjKU3UMCIxGZWAsuEpELASGGvtdKbrbvbYzabxMTOpBAuH8DFhkiOC0xFhIyHA0hAiYcoOp5EJbGZQKazt9Wt36Le"
+    "SSm38tG/my32nWq8sFDHQO9T6v1YSg7LQApvPVoBZrS33BsBAu3T/7STKvaydLA3Fypxe5eim4xDwsTNpFlF57LSRaV3"
+    "NvdYbVH0vOeoNskDB89L5Ls6VYONhEYuWQyg1WgWJKGdhsTLQ8ii3/tRpf+8GsFFdJbhfHk3FJ2J44MGJsNfadjF//bc"
+    "bTYaxkwUJtvLn6O63Qmvnq82vvycpvY0kAIODKXzcBmJLhUqPNXs2WyZAOgYhERmeB6oEUjMNxwLDA0Ga9clQBrOdKzv"
+    "T/KLwyPyWSLZ3wHELlUDafjX7DGzwkXO3xzMfn3Sa92lm90lxchVBJ/B+Hc6xcwrK7m2i1svnX67N8Xq2/ALB5630N9x"
+    "NbeiPrekhQ/ytAdoFQwreUbpUfJDyagIisFpvZjvqv5YOMbt7NNEZuSV9B6AC0yGJcz/aT3v4bzMlbzpSrbrhLjcBa6y"
+    "8pxHqky/2usOwyoFGaTxhmMK+Wpc/DeTa7iCJe7v7nguabrvhWG3ZnciCfIcm1g6ayD88m51fyXJbO1iE8WHMQ1Y8q8n"
+    "pARYSfjZZGt4W2TDrQ/zIQKbtZgTE84JbF3CfEMIEfKG9iUqEi3lSegqzpg819Z6DpSzipMYfvLVtlhkCB2GN+odhDPj"
+    "EvUoN/TPrKGuDH6JtA4Q2bfqL8daQDerJqjF5SWjvvRJ1/9fCelBl27NkiSZe0YqvTg2CKjuiw51bd0d4tCLfkYHoyeF"
+    "5o6lzV+6hzlkatAHexk16Cj6gM9silKJuDo3Mf1FFWOCqK2HLeMZ8knGxg7wUWJNY+u9bOP7mmhui2TpSAeLd5lDhay1"
+    "ZNeIO+jIQ5b8nT1Uw9FfVNRPXZO258cflR+/tp10WUPOjX3Hkw9dk6CbZ4D+KzM4btSDnz120E+/T0aJc5MW7E+fQdDD"
+    "zgG7IkbeiSfxxE0Dt+0WIq86Oiozs7lwkcUELKt43F2RKukPSgp3pxsrUDXxOJzuzrbsxJkQahXryU5dxBdoGjwq49tB"
+    "TiNo3wrjFvqFD+1Qx8zIXs8Qw5KgAp0u8xLt0wcyoKc6/ck1Jb9h9EZM6VjBih8jq+oCdQN7mz7dXh97Djs8W9YFfGWD"
+    "j48qLTp91gLwyhoA5Ukc2FmAuzz6QJus4BOZoijcsyzTdHnhrxVjoMlGUOhR3UU+u2MNYNORomhHAPAU6MKCeHzMm+FR"
+    "1omsdACg7JiPNLH6tLDoOsxBC/FcAiT2mKbpSoih1I58PtC4dr9hxlawvHjA2c5GWkUZ8cpVXx3uQqz6h0pg0Ymusp/x"
+    "njpuU81pz08BSoK+5Qe9KqC+Ozk3biobBUc9F4GViSrEKvsd2/nLzoXxl7jtlXbOF2EM8B88YN1LSiV024p8RIi4Njrv"
+    "VYwmpfUVyEih0rvgPVzFzMfJP9Qb+Qd38o45LkHm11lmh3edNmC7qTxCbP482S/ouh1x6CnKiaqzjQaTE+2mBq2nGnw3"
+    "Q8AmTt0mVfQpZPOiUhoLhWmkcJdnr2ESi3kLhjT3q9EkVExgwBNJYUDAmQdb2DvLvwk/0vMvW9E5V1pdZ9WdCec4QlrJ"
+    "YcM9XLew01CA7qLyKMKrDMQ4ac8+yTZN0nYJ9UsWoSU61Bw/mihI+xzZuSNgWFTqvKWYOfgrtCVo23TDhDHyo4+kkSDH"
+    "AlGs/HquUZdRJhapwWq1dL19Eiy5VtMURE1jV8keYVDEvhH5oBXbn7KWiAn0p7A4yv6cpXnqv0rwiBuUFPgFsYmlWSwj"
+    "jGyibrxkdvlGlz7anKs3avsYUn78GCtffXYXr/Hi2fBoFHtg4TnqIveLCVIQRk/MeVbrjRDJPnTGsIWOBnMCPZdxhWw0"
+    "Nze4dYz50mA+t85WAqv+4ivgEvUkbr+FD1n5ih7mL3bslTp7fk7OJIwrm9jTgXi4OloiNu22BWpW6JgF9Um/tYXwT4Tc"
+    "8EEuLRIYrVSSGG6BIEzaNUN30KmyJdI90zfXGicThcXyWpsMwa7MPmFUS8Snj5e9CULCMtijCK1RAy45Ew+zwE+iyuJI"
+    "pclUmU6N4kkkmQWsuKIva0JbRVLQtaawJ9IO8LUh7JCLwkdkr9HSYoNTvnYhlerKxfBPvd/mA2/CNuMsn7eCuZO7f7iS"
+    "CxBbB810Iwr7ZtK9FbL0gJATO0nSnnmxKuZj1KcTQS2qoPpb6ncn2mP0KykH+Ga7agqhQunzYolap2ZGqZGv6WgkaiyB"
+    "CO0mZD6HK8oT9PxxAQHgIdqIE8RZaeQP/aCIv40I2jxIkRQYu6O9z2JMv0x4SAK556uNCEQ870rZRkrjhwTPP1yse/qS"
+    "W3E3//gHNJN40cVv5BnEXJFdT6O4ca31x8hNbeN6BAvwb4gDvpZyJBhq0Q79uaSsojFA8pls8HatSExAeHBuHYhyE4lq"
+    "UT7/dGFBudc2juqSjOmtA9xTBNJlymkaM5MzVwE0nMrBlIrbqfZNenFwMGqFKG7TA2dvsczOQSpL220MwqhFaePmNLeW"
+    "ZhSX/tf/l4WUBF4+Q2MQTGuYebHSbqPbbj96eXKfM5KjoGwLds7R9qiq419P0o31w9Vc3ofyRR34QRI3LiK9ZAHOsV3o"
+    "539bA+oa77dx1sTNyaTDsGZKFdgYUZJ1D1K0RpfyAN45rKuHndN0r2hlqo+1ImLM/e7gjBzek4jjmcPMgk3m0Luw09os"
+    "aO00NISDrBWzm8MoYP8SrojilvtksZPdk1G6ZiDHmLSJ/chc1HnNz/MjAN0zgZT1h1NQKDffP3Q7/FrNZB4iX4IOrJhu"
+    "qi2bV/QphPSDsQg0o0+TuMPQ9iCPcgP0I6rHNWruI+LpaKNJMHomPq3WiIrhWA8nHCRVh4jqmEuCsF0J3PD5yQDBV5DI"
+    "JJtfaRmS3ssxjxiVcMj+qYMZOS5AuIv77Z+ffNaN89EfbYCVlBZQpZmXAon3KItFuhLTm3N6FvoMpbI4/s+Vnz6uOTi8"
+    "e9nmmCy6AO1wyF4URH4QnBKbsi9XYJXBOAnyg6TLZBv1+eX+FsZ3JsleeDNJEM3HI5ryJ9DPq1DpE1h12sfsPulkOGCe"
+    "SEgOZ8Sa4AbiFaZphT24OTc49I4xXJ8PAQkZX7+OznQtxyfCoeg6V5Snlrr91sCFO4i4585A1gr2wdzmWJvs8BAvbXoI"
+    "YUaP5QP/B01qxUxvXmUWw1A41Wvn+7jYaLOTFoy3libcg9GUy0w8lqaDWoiEwzltLhB0SnouMDd0xV6To/XQwBak8dkb"
+    "+5sgNrky//Lfy32i2W8xWq+ZjgcVjfcHjHkMtOjZH9AMsliwbtgqQQwVD4lI4FJD8H3QiciIz0qWH8UYeBTV3l6dWMOL"
+    "KujtuCcgApG47a9M9uAtIgiHrVYtBm1wcbveyGi/e2SkH8BnLahaZ8nxLH9CpLaoqGYdZcnPmCm28UOG7N5uS8DCopXL"
+    "dKNJPYlGOFrpBEedtkOAtESyvO5qrDaY/cHmLfKKN9BUdWgY1KDoHt3Zme7sRZt4jSBdnCfsI+3GMRZ4V/FCZi1hAJaR"
+    "tu6s5ZzeXExyPLtvcK7beOHNMRANnQrhdzFjGwyPokvkA/LNByzt3IvnmDmqYgVsRsY/Uy7OdySUyMl9skwWZ5naMW1t"
+    "x7DarSRcsJzUeW27wFz571Be1O44wd8QQAs246QkaMzkHOE/mzH12FpUuU7gdzRs2E7cnbX1FMofcnwm3i/pR12+x5IV"
+    "Az7lylVACePQdl/Cd3s+IvTbyD1ar4oGXVrioBhi8zjeKG3YO1omZerkd41enmyAcmx3hjPcOtwzmbADwMWCVCq/+UUq"
+    "9lILg56jvW2mPHKHhyXyHuBCGeUZvVn77sntiyPcjNGHMvGKOuA9wgmskbKwYj+MKLzt6oTr/VDxJSJIOsadvESmMG/v"
+    "ypj4HxoYdJh5adZ7R/I47p4VWcOggo+CEWD1LzJmFSoDDl8kJyJf2QzPEDtg/AZrenY9aioxsw8dICojgTchIuI774Ec"
+    "WtySOvg18BFMed80Gajqg6PBq+IRP2SUOP4VaUzbAssOckJilS6Rkv6618YpzWF2TuSfsICOtmrLw+/kKdglJH9075UY"
+    "WX/Wqw3FPcmfNtqvqBGXp5NEq0yt8RT/w6Ap+rGiLPG8eEvinzojvmlMnnq4Xvmn7bG3hiZyTswxz/AWfRsst2uSNR4c"
+    "xbozXJ8fdMmMk4qUqpeT1JFdojf+X7S3U7+RDjFNd82QmqeRndM7ZOhmstelcNZGDIgsvwYsaGqOGV1hWtJ/+lPg2j5l"
+    "KzPiJ8N/o81fOr5DIzqq6phn8OHQOaY9X+1nJx6RG5MjR/s4ZQtKtDNVEX0WwJxyyDUqRVWzK7z6hlmDd9pNpTVZ/GdF"
+    "R1G8tluq93l33xTie5B7wF+ygtDWWbxvBfKcrMzZ4IbYNM2xJYpwMNDCQ88fb1hffpY+OxdZBx2y9AGJpJqWKexKW0uH"
+    "JIDmnrBPL+wJ4LZwhC9CIjUk+ehgn2+qgrT2AUMFLLZ3NP/QyET1NSrY7yqEs8Wz5Fd6fHLs661Ew9AGkEiQtROzPpa6"
+    "bAkYiVuCgtDTNCO/ZH0DxkzA1HX/Wmrwr1oHhpJrYbdeKmJWjhvEM8YwxS1rnvZ6kmoFSVQ3sts5LX/Fn9Q51w7svw6u"
+    "QJWOMi7v4I5/ejREj3YcPSGMj8RWREcoCY2C/ka4wTWySpjJIfkHXHHEAV2rkva581pYSdntewxesUH1b6zvBhzPPbUR"
+    "diKSlwbc0pjTV/KEiUkJNbQXJjvjskx7JnzcwXMKVIt+fKw3SnpouyYq0ZmNamUvNCNkRyp+MmzJEixh7kVt+saAdHOM"
+    "xUewFHVjktSh8ElZatAD7tg/t4ou2PEvjniZ/gFDc1JHh011GIb8jbA27RRFBJWxuSt3RQBGb6h6vglPiTpHjQl6dugD"
+    "vcIHRfzFfsBTlh/pW2/9Z8mN8cXLhm5Sgqjzkrwh8nTPS5Gt+FgBfwDkSJFPRvYVlcsTsKQysSd5TIt5Sk+M6JZhbxY2"
+    "4dxVBvNYVl/MRcXNEDa0M3GKHHlHVlEHqSTixFXJFvKfob55hmDYEb5gCKJ4iWJGyJUP4oS061cKuyfnxL8ixsGGqjOR"
+    "Hfvpmin2G+WhLXY//LknP17Qqo7jRdYVbtA5QWjEFl3djT1j2DCCPdiYqrUfxxTujqSwnSnHgYClDdSQgSRD442djLY7"
+    "XNS7ucwkVMa5EsyZA8gu9x3aFkJmy6kEzcqrgrWbgaQ68hhITnlh1SZdSUdin4SMf0uquAMvevRZa/htMxQPsrh5hH3y"
+    "PsJvY54vE9XGCTva/JRvU1OminnooLHsU343p9quDR9r//XcDj9+QoJx4Zj7jl9fk/OCovWdpZ+5z9N1QBDokmnLTFjY"
+    "BvEG75FlnIX42YV4CTe8cMzIBXZawE+SYt1CyZHPTQAuPnzdw93KDHNbHuym8gIucp7fq/CGZMcUreOc+xfvDj/tvGDX"
+    "0p9iTNuUbgT4GrnshC7kxEeP9cVSQ9vbUIDrgd3UwwI7cM7JmfSGui52Rd/ZvwrEtAj2jClVTnbgtrq5PdSrnwxR96ay"
+    "sD4F5auJLmjBiBj1IdeWK+4D+6OvH+QRVcWVvQnFDkx2+ecWZl72qaDfPm7hhX+Of/KWTX3iJYaxe+rUC641RYDUrEtR"
+    "ARs7QZ6g+l0B5p5PoMZP1JIZU8wZK1HWkgNHhBeAJTt5W2kBovbocQl9pg9JRQXklM6e0m26Pfy65DPqpuLgESF5E9D0"
+    "KT0DgC/URYqKnhdvxAkJuOgvF9aCA9yUerqe+AW2a2IxmMQ1ivr27mXCgi1fgg1r6rCs1Lr/ZfmnzVPcMmLNdANRc0i0"
+    "LEjf0s8ZllkaW1LUkbMuQFnbcM7WdY4ackO7Ky3rKAT6IiAlwrDvzqfiylMTFr/rpSDNc+LMHp3xQfTOBzHuyVa4AjMr"
+    "4Up0q8M87klbFTHKr4amjjGBUtXZAFMyjZm7oMx9APf+bYH/Bp2xaIAS3sdnrgMVeA0/pUp1aOHm6MFWNQH0zdHQnD6I"
+    "tqanThs6AJHyQPTAXDpFXBMc/ipp72MjhPhl46YJe+XfjObcwRyoOn8f8IuyIT89cggj81hdjmHWBCa+rOsAurOfH6S6"
+    "4r8tv2PBohJZyLiFCGNn1xdL6YWrol9k/rokfmxZ+T7xI13SlYARbMCeC3D9FEXukwdJ4p4KauWKGOy/iYMR6jfxuTr5"
+    "Pm1Tc0Zp8L0AQUnNIltncdotSdJ/UwFV4PxrLepj6pK2triqd36cpBWc9hHy2hkD7hk3L1PiZ8K0Z1fEwAWiHIBTO5Bz"
+    "K9gDF2+imJJ7fxG26j/WFV/GT4I/uJophD5dJVVrwhm6LQuGB+aqtJzUeY762D3yFdh70Hd5a8im3MwTeRUdDVFDLfCm"
+    "TTtZWfTwKW+mPrpfflG4qvxvD0NV/AVDd/YVipx7BTXueTHYkjnc0vqipkkLEbiqMcruR55w2B1xQUmewBkLGQ8xIxkl"
+    "jheCHUV+kH6uC/YtJ45x+Kx5zkPWwnklV84x5F9F2BU9Q1+kaw1HFZ6Y1HOMDV/GuAvWKU3I1ISimi3AF2PCR2u8hJ72"
+    "7H1bvNoFf32CORecouj29pYbMX4vGcoBjNhXUfTIf3thlmV3SX5FrDF3d5cBbXPi+sR+Jcj0awukA3E19mcfgOxFhndp"
+    "mLp/b+xn0qxN1NwTC+xH7lkBJzXIqjs7tBG8G7CiYUF3oD19uDVLF5aKZ0HmUf9uxFE//phDAjz1JVPm/ombh7Af/SyQ"
+    "Qx6MiObpai613FCmHIBy668oo7tG8JLfwQ+kGF5F7Y2tlZ5E5FBHuAeVbOALBlnDCxtb1+RBh3x5boBayjLGySuvKacp"
+    "fvQQRrirM279gArCC+PTP2BHkKMGgdcxA6qGGKZ0WE91dUAW0UJX1eVpKwvuub9J7uRYjnA+oGs75rFLHvlg7xj/NVAz"
+    "N9lr+j31Sf8Lu6J/YF1QrLBM2NGkhH6TqdrAB98ib1jKMF14wCZc8Ds5AUR3zXrZiXv6Rwm+8xLyJxlDa8wuXvIAWCVL"
+    "X7GQQyvZVEAO26JLHmf7teSOLf/wgNzmCe8JLV0yUTeX9i8jZOLv7IMaN+9mTlLUsOrjqyjPXFuR/yShp6tJmPgnrkUb",
+    "F3hlRjXP/KZCvYzfB3BRVjjoY4l7Cd25xNH5ADEojxF6zPxoAjMC/yKEvGcJseqHdKQNWBhctkCz7wbVXXau7S/jHzU6"
+    "o35Qjf7Dv5efmiBk7Cdl0jr+OvIL8RBL3hh23T7ukzRDwx1O+hQfe2VRReKhAPurHc8lQ0xPXFNLP3xBS3J06wtSwyv5"
+    "G/qyIh7UIPWsIGzHgyPSJAVAZ9eULV1hVGrCOUZSReCCtD11zKn/4PkH6vkDSjilOyL9FaOubx4zwHoBbK9dh46NSo/9"
+    "k1RjSnlRJcx9lRaiie5YpctP/7RTJS4eAtxX98UfIToSQ5131of7BoxdMAeJit23F0dPmQVa0+XcQGnN2QP8v/6/Ye0a"
+    "cgIKn83Voc90TLm5ah75ZomhyCadRm4ou/5ibEyR5fNSHN0G/b6vywizt267Bh5sg/mtbrOx/sU0ZPN0vo3ZDEzZ1cuT"
+    "oVokxf5wHpWrVOEkMCwoDO9Qv1ZIZK/n99lcnceneKm7g17Dm3govWJuRoEO5UIwBBo8sSJKq5Ub2b23LEijVOlICqHh"
+    "wfkKm+sas6HoQtM0EnwScs+pepto1+diiSSbwd9seATlOOlQ9de1g7vpo4EW3dta6Vr9oyyraA7l5de3z8GJ4YEgxVoi"
+    "Qrcuh5PnEgAuNG5OFts2l3JstVzD1f1AHG7lGtH5TsEgpVzJMslu3cfNRhAoKJKvvxqPeiQqiZ9mMrFwQho4r9f9MHIw"
+    "KiCdteV0xbXDVGgyajzlVPG7aKXNdEKJfADrDItmw0ge2f5iLu/573J0aBKv1Y+bcudAw76z67dIXmoeWr7J4bEEvmLP"
+    "UrWD/kaxtRj+PHoqlVYQWu8u2bUUu9EwSLGX4QixcNevox6Bf5uLBlLVx5ebiYEOvXgCKFq51VhwKkwIbCC+hZkGvvEi"
+    "r3BAPAi5sSAei7fvv1YM650seuneGqEU+VL9pYGTgTSL/vkoehYUBhL9LNu9sa39TgIWwb75bC4cHjYus/OJWiDVmWQE"
+    "iUqn4ZU4KNeXBt3ty41o15ntlZ0cTO/XNnx+OIWpAlJs16uxVCAcWEAk68lOJjzl882rvl77ZJu1kbf3WudmLFjP3zYi"
+    "OmAAgRAKIHxmQrU4bt/PEI3rbkixEqtQm3YEHmixq2yPgTx4wzDPKKmvNkilOuOzQIVeUBxGockw5aHTUFqN62rBhy73"
+    "aHalxdnNhRBorcXVr50YNm9kTl77UA4IRnwaJC79Lp/XDsGBEuc4udGH480s9+cMyzjP52TRx4F0Oo/Nh4XVLMdsmyII"
+    "+yrhAtsa2XCx1fs6Mv7H6zIYOvVi6Zm5yQI8AlA6cmoqnZMe+07rg3xAqzCjOru1LkJ8XsmJWAZelQpKOtWNvdvtGtmX"
+    "ub5s/pG1jN+FDFRYZlAoAPutj6Ue+0L9oVTxEDiRUAJaq0TW2dPrQMONkYXj170QJr7xFB8ExeGd2xzPvyqZNOGLjcnp"
+    "h3Ch2bH5ZOPLBDrVJrGHwQhaEp/9Uibpi/sY7d4SMnCLEhbZbsm/9cF6n5G1BpkkAGIqid6bagbFnfPNyRrpONMjrRTb"
+    "ldHlkXjFGEwEGMP9ZKcIgQJ4DKcUJs2CdMyZOv2naoW//SBKHK9ISBRQbiSLn4WnYHLDdosaXL/RSDpW6YNcyzRsWq3v"
+    "4b54EHzVKlbdUqVUxXqTeLPbBio8cqHF2Rb1+afVsd8atV7BSInNj14qRvcEGPXjl4v992b+WObdZNmL3r2Byd+9q2Iq"
+    "o1Z8AIdMpZM09bNR66jzowAGNB67314YAA4icL/Lx7k26xapAkZfKNuvsUb+2zrhRC5ONNkKOCSrTnIKKEaARmhoYNfr"
+    "gc+rQvXV17tOSserm5Yom7l4Lkgw/rndrd9MXloapafpLrcUJC7PAHCXKA54zotMuwbBo1bRMoU4/XAUGPORCtVygcOd"
+    "81fnc69eRK2JMB7Dz1ZeTDJCyVbnNOV6cihq+fJ4y5W5GCTYXuc2GqkydFLfUIs6JEQnWsUUYDCr8ziTq+cEEhpsv25s"
+    "iYv+rYdMZMGHOkCnj8XdgalAQIOFm5+5wzitct2DnRD+u938ECiVvZWnFiShbgjDWKteJlaDEDKNv3YgpATf80wqaMFy"
+    "DMJEJjYYaL2ntzY2avW3nbfPvZutRcF2ufPZ488m3moCOPVUJt1qs9WRs9evpdDnqv52QwK7ZqVe+bW7GMG3youHDfUn"
+    "lU5galxMOnBOGVQoDJeDKPnrx27XdKnlUeCXiwgSWB5EiaeNKNGnEgzlQDiHg8s2x7Ms5RhUgY3B7WVw+mjr3bvZ7cGh"
+    "8YFCKv2jm2yJqN3iU27g3yBi72hMVt4OelJq3qHDLCLVh5mLoBRsY5+lOkgu0TKLq2R0HHLr9hp6m9drbjoPyzbjh5+T"
+    "hZd2bkZC24FaHLfNXNl8kgytKDrxMB7+egy3l6mHTlRK40RmCAylfNerep+VfEynS8mOlSwJv0qGyfMK5b9SHDAgdv04"
+    "DIN2EsIKw96xRxpUcA4/yzLvm4N8NHrH8Upyh1bVnYVAHE7iVJFytWq+AFTlctfx84GHEIFkvQL78/1gVxaMryz913Q6"
+    "6Xx4DnjwlE4ky63dONH3CjiX23hIAN2pKpe97b+ZoTa+LgoYalye6Ua9RHVyPE/FXm5y2Z1U/duNnSz5GC4eKNvzLS3y"
+    "eAJczShraOzhnfMuw/Hz5XrJg+lqTC+4h0VG15OhTrnV27t0wcP1bLX1RF4oMG5qc69POpUJQhfVHtOj9YluoxU9Dnhf"
+    "MfPXqbdmwasU3XLnLDBqmTDV35d4Qt3N4ef2/Z10TOR2GcAmE+tuUiIAkwQMbNU0Eqk6refxGcXzqJ16GjTzLM8Mw9ep"
+    "YiQG851K5QYCvkryZPaN0Q1Ge90URS4Sy25q3aubj5/xTBz7jqdywO2JXJVFn6MQq2q5dkbVDYYEYIA732go5YcI5RbX"
+    "BMOJMFDRVoE2ldcG/bNACv3T/asm9SixwJvgZ4/ITlwh/slUGECx+7Wpy6tq1UY4AOdkm2XquwHFXpsaK3LZX4mBy3Z6"
+    "rYvraE5Skzga0lDFm0BM2LFNClwSMuHpUlg846e1cFKXFPcYxWqJj3FcMgU/PlS3T1sibBiL+GtskRA8n9mHhaHpvl79"
+    "7bEK34ev/umP3yxk19UX7zBHs6g/OthAoTb31+PfRgrzzSqWmaWVBCWT3uJzB2hoTJkXC1y/kakOPNm/n0QoejSTTVw3"
+    "2MdlzCA+4HHDramRUhgWcI1knbHZbJHe30Z2UHKDMbbeTtCcdpGC+FhMNPt//zR4wNZTgfREiLBwjLzPp/tzb0fDhwHq"
+    "reQyrMpaS+OISMV1kGO2s3I1sjVyw387PUaKgyu9+xJYWkyWTwWEOwIlbQ6PO2m5zGhBUKKl8lrXc9EGt4edj+0tfSul"
+    "qMoA9DwC95WQPFAqGM4fLr3ENaJ21Vqw/FaKUVuCCmleAWTrOn2Z5JQ47NIBhjMXv7cVil/ZmmdZyCIhvlkCk8/sKCLM"
+    "6mJb8aeDRuDskxM7X5nqDeqxtA53ue8zfT4TAw4Rj3IXINpYwpVl6tkl5OiSa1p9IVwIohmo0Iwamw1jE7D5Vj6YVFc2"
+    "71x07kkE+bCc6qW0pCLtpZNljZX5USbdGAGXY8XE3CMXew/3l6dnPbzkdlcbbQKDJ3PvwXRClSAwyiJXQB9p9yrSfEs/"
+    "CDrjBYS2yyHaL6l6sdKdXCtD0M/JD/lLfPivTVnV9pAf3TMFuFAiv13QsmO1WoNCK7PUZiPmV0KSBkD38VOuxIa3KRp1"
+    "FNY9BnETgALsN05SFWrXjOvxWMgEL6d7WydXPbZt9vMxeCTyfXFc8gcJwERQ8GCOsulCHhlXXiXx1t2PfK5YLqIB+IBU"
+    "5QyuKmWUd7mpDS6TpyF5ISlLA2WM2sxUFW5fw4mS5Do/x+fbzcy94Tg4IHl47NMTkQhgcCiU+KwiJRC3q2u1rNtKQ9p+"
+    "kmZKOT39VAx+zdA/b+H4Wj0suBz0Ah+XGcKHlVistEZTJbyG8+28InMU6Jzf/SQzS+paYhBsMWcudHOnkmfjL5m5UrMZ"
+    "4mGjdzvR8CkcUphXWIIJDfW1nRhRez3juknBJLAuhQCal49/qWyepzf1TyH+cs0jpg9KOkXZhzheKKmh6U7jBBM8ZWYP"
+    "RCu5hvuZ6tSEkEq7mZy8MChk5k+XaT6tDJw8oLb5lvlR4gjXabdyilgRqW87siDC5g+Pe9/XAwcuwysvC0PUPmFslmZe"
+    "gC+kX37XPnQFzWLzVh2FhTCCsbAGve4vTVJbzdZvFWlSTVge1kTIb5bCJNGbGv8x3710tJtyJxCuhytrwmPAf7MRLsMB"
+    "TdKMK0G8c/0SBFM5gLGoTFZnc4l0Op1uenCpT3jHRSUSmorWXe2MBHErAv4x4C5ufxV1h3z+/kGUrw02Lyr9oNka6Y2L"
+    "wUSwzFcYbH4wFck6gdhHJG7aEVVLwMx6JVuFV0OIzX4ekwuNw6N/dXDUk7rDerbMEr/FEJQz1BEeTxvQlcN6vJKlItm0"
+    "r8LYWPkve0MREMXGD5dTcLU+K5jlKBXom19RhxAK31FTXmD7BeCR35HVwdEoDtb6WcDYqZncidVb4ZTrpYhWN4kQPcGy"
+    "W6oRBSDy1yHcpSsRbeJl1zbDiagM07gB6shcZOT1FZIAj8qzaoYPRIkKD9kQPiBlwto5Bcm1V+9Wbq+DzKokCpBBLf6u"
+    "o9X7erCFAyG8f7edZyVBaoY1w4pTa4Yl0G/EFFgF1aP9sBTeeO16oPxq443EXyM8O2gigRTFN/xsOjqHJ0ADw6oMpzT2"
+    "Od13V+o1Fp4SzJ5zcYUh6PmsSeqbsHCbWOszyqK3LZHLJ408zHtJ81zCM6zXVW7HsNW241gdFqptE4T6w9GdyjwmGqQX"
+    "r4Ic+5Ze40oVMw8V3GmENMCCO2MS84bUGTvaezeNqZpeXd4UpPps4eW/snUTOAX3H/cL7B27fOuR8M461JVnzkiZvI0e"
+    "QKl8crvIEavgnqFRuWsEsEraagN4VqmqbtDqbp38TMLiKMBiaNWITerdg+D9/8yD8BjMNfENZAnnqDYJdsC5LAVD2U5F"
+    "fFUdaVg5AQb9t5FlKOsjyoy8V5dVkfGT1EfWhGti9YOlEq6zyYLkJaRyiiLk32uVf+4FwKCXDNBd/zjm3WlvFiiMUbBA"
+    "IzUCVl+1JaoOtnFW0zPEDds0FEbGyaFCNn25iDEohXO7SaJwb+Ny7TROAuaRLqb1GhxNAVApIxI4yofQygTLNF+E+ob5"
+    "AjnUsrCmuKMoqbxx416UsXMMy1SOCuNC2nlJ5lQvhgVmV5r9nV5/601EM+gfaVHdawaHo/TN5L1LVr9IBVd/CYfGFbtd"
+    "H53Icy8XjNLf+DooVvz7/Z3KQlR/6ISwboDBJvT9uM41Wb3udY/DJcDEQFO6bQLivXlKM8yGR3bsNq9T+15+H15N06jg"
+    "9fxKlfjYfMzH1MpmJ/NJonOp0ustNg5gw8C2XRj+uSqQyaHzPl+be882rn5fM9+wnNOYBwc61AsOB53NOs15KnhdGlD+"
+    "Eft22rMpbrNBC+dj9jKqqhPwWrXv3RVMnSaTFW7vC3mrOGei7VTQ3LTcQldzata0LIqAaLHWyijVxNlvH+/HcPFOHUur"
+    "YNUq93TttH+MG64xPu/Y60lDHR3T/UEydmrnHtjgILuoeb0llQMCr7DEcSPUd3gEwNj8U4/8BSUKNDBdAPI0ejfNyWRL"
+    "8qU14TIgZUlLoUl0ZLLyIZWyXcayRlBmNSAWko4tB82YO2SibJKzjWwBzxBDVYc04U1/bk08lvbeNqlPJ6lwg6cvTZ5V"
+    "zV3p9/rvueWzp+Mf+3lVaZReDJTfsRk/SRrOE0uZ1AQCt1AQhvq67SJ2/QBQWbp+u3v6CUxdOq1QUHGdnW0rZGidWR0Q"
+    "IANkPXLnx0FuDMU/JE6BpElhOvr7D70fHflo82ofFMJk23xsp6fottw9gKfhrfEECUEs2XbXWVGVmA1GH5WtXMDUA6Yq"
+    "f1yNleyJzKVu6UZiqVxPHkeOOR18Gu5gVjTK5orZH5yD/pX7vn13DcJZ8+lfzkDjWfbplOaJZ1kATiRajR8kUgKALgE/"
+    "qr/6Nqm8XLUCE+DKiUF6o7XIiNUPKnENaqM9sDy7I5Cf8Q2siN6qaooIth0k3XFTIcjspOKwU2eUreVppFV4AMjZDZaj"
+    "zCpgoLDQs2FLLXCEMwH62ucvBOhzcY2hUr9lwfgaJ1/k2QCGCC78+iAa6/wYp9yt5KPrKgppiM0sNONB7VcbcgR8jCix"
+    "qvCbzpzz7jQCU4B/hVerMcU1hx3bOC94D8Ogk0OF2B5ayf6C72WBqipwdOnK7w1KjDBBlWlIpxNchOGqMAlQed7EZh16"
+    "wEuxrNWgGLjJwCn38Jt+/q5gRZ+fyGodIjmfS0IW3EZHj6DnETJK7qVlAGAFGPLR9+pCgGId2z0smJaFwArwjQ/NTzk4"
+    "5qes310WafkCsr+AJEGde/H5ht+midIugVsYWmgKqFJ167a73dRcbb0JcIp2F1v3vJHmI4U+tWNE6S/Ja88Bg6N+OncO"
+    "rL31xMWi/RfdKiVAvIu65SwnvpBQM49PV8kFKgOBa3XHByKUirLtDUqujzfa4RPhMSKSzLuQsUnb2rDf0CR5ENCy42do"
+    "pEY7G8vKII54/FGI3K1hx1338PNRdXuELNDXaWLqgPOusXXfhGuh5tXy+fgyrEkCY7lZ/SRRWBV4Qg2vFXIDgsNnRAsJ"
+    "ejHtGy40tFKUGkRBmciXgCP9lo+8KYcz5dyiQTygWq5jheA8omrt9h4LEhqKOC/5mrhaSWIl6N11qUdmgWMcUc1T7hrA"
+    "xRVlaBGbbXSSsA4DIOgkrsg8STqez3I5256bW8Cp/C3bK0yPK2iykU6g88S2BEG9lgdKXxZo3CC0Mv0+ZPi72V3BvH14"
+    "kvcRZyAjast7Svh2kS0uqdpqUk10xZj+HZtg5pGeGFaqNNRVWnNC+E/98BrdwlR/g2TwwVGZoYShEcjfwv5GJxb6UipV"
+    "FK03x1WpmS96o7pmN8UeJeO8RGjYxvV3rVAv8XSiJrRl5SP9MGONnA/D9r25pEBhK82auzDO/T8z3dTJUPjvEGUY1KO/"
+    "fy4oLcHH9vsG8MU0V254sOmEDMOqoyKsPOBxXln7TNJWEarHuiYWzsNYrhistZ1NXoPsPNXEhW6AOHaoFF3Xh4Ctn1ep"
+    "D7Sfa+v+oumbMb3MjZhJbBHqNoT11yP/R5w5sNXBMGC4lmvhZKylpWUt17LtTnUylq1l82Tbtm0snuyT3Vp2fe+/+H7E"
+    "c1/3fT3y/vV9pcmnRzEjOkiTbwJuD7j7TJNi+pONEn+JxLGDvJYkBsTggk1CvLFzUr9RoRhbzH/WgaZV2o3V9+kpxKUW"
+    "ixNRffOL4IRroqHSpG0+5LcuO0NndBzh3My7owKdMNpnzu7kbNgeI1w+m5l9raTAePo3oCJsHJTNM+qcxtHJKiWhR0+R"
+    "tMfEl2yfZQUy9Vz9hSaM1ahQ0hywQWS1DcSzyz05tmcpCJgg75yT69jgUv5x5vXDeY4mRLwttwc1avI0CNGje+Vbuqx4"
+    "dUrKMC4a2JLBZL89gObK9W+hybTjZujRALTwG/dd8NNmDdh9w2z95xGCPJD5a8T+Ess/WWu2nhl7GKVszXSpnlP7wMmp"
+    "37psNwOd9jkS8+xI3Jxfq3GrguxQK6u2itv7EOPeCG0KjY8ho0OgoM/LBL9+7/GMAP+IRiiJH5ASNlr05b79Y7SF+UQm"
+    "L23dVmUC0Oa10uR25wmWWknTKPsaw8guiNVioZwhu/1+HpPgqzS2FDKeoe4zwGqroih448THwod1WW1MoIXrG++15epn"
+    "jpadUcB1eKpPII56QSkas1yxH7o4JJRr65ZlZXC8J9DXuy5ZsPNV9jKqxJMr1mEv2gvd+Xyl0kbaJE/7bV70J6TrC372"
+    "ewmFeI/LDCFGJ9O3X0Q17LwrXaWlJbJMN17M7cusjL0Odq0HRR1sTB0qQa/mF6MZweAuOjBvDZ9SoV5ImO6QCNPxu98s"
+    "sYRUoD8/HPI3fHphRU0k1ttl18iGkK6uzurPDXJPv53CZO85nJNw2Rz87e8MJJcvcDM6BTSZl5fuWfG+6eYAJhMSfe7h"
+    "k2W+k7NVESpMjXjR9yqvNv2Nf1Nnf7rqoBwGqHYpyUlXvMxYEi8uiEOTnUoS69v0+AOYq2ihX5jxlvFVyQSF0OMz7hqn"
+    "xQSbXkOsUclf+kUdeqFluK1nTkQP1/itCL9wbxzt3k1ym8qmgENaKs5/Xj5QzYHe8mrjVVdaJriJAfDstY3s2yzrfd9A"
+    "eAN7Rnd8fzHAvHo2sJWnxDsTwX/LA7C2ZsIy7HTEvm07osPu5kRRLR3i4H3Ta67EHqKoNLexv2o5RTNMtvpq7uYXhLhw"
+    "FbG2Vel+/GhVnxNZr9HToESwFamg34eNp3A5STlu/88UIfH7NWT+h03nTSzK3rqLj0nKABWDcUr1Tl0D8IDrT6nvwHkA"
+    "kenGmysTHx/t0/lPWt5e0RT3B+UMnRnI2NfM1gVxCMhZ3CHTWZyv/CAozbh/0O71X/AF1RdO/NKH1+DSYSYY1FSmyXO0"
+    "cbh9l3k01Ir+6gfykZgdxjafTTPNDZWJBT3TGZWCR0xrt6IeUsd7ZJhkuQpcYxyOMf+Ifua+7PelLoZSGRt2is1E4ppq"
+    "bguhPit95rHvrpjqBUutexU8iDK0ecpxCGQZXcy2jT9b/mkMJnW8Xq8BgzBK/q7qePC0fSy63WcjdX/K6uayXemBOLJ2"
+    "IKMRMbIOsdWfzkUCdvJQRx6jRFt+6MalbsgbOKAFTGYw4jB9fcVH8fblOeL+wPv9r29GpanCQwG0vksDY60Q+bfMvjs9"
+    "5ysRDtOcsmFQvLlk1klAhOn+CkRHfHcjFXMZWXRA932e9kVXYFChUuARVUlDDv8Tm5Tf2lKfSkAWMyN9s35gYAiDu0Mw"
+    "1iK0RfUUVgfiMf60nZRuQhHbUaUvtmHYRaAgN0Jcq2ah+LNfZEB2YxOH+xen23ArkjhfAsPlcsaXwFaUOyddAXScGLto"
+    "zdL5fGwM4xeFxJqVBsfV4Q1sB+B3h+9cnvNZrPxWw0Rx4cKVTCJ1NgCl6mx5GPQ7KbyS4CMSaO+Sw0zhFfs18h4CqKSB"
+    "xAKzjtJdTaL2T8+yyUQSZaggHIh44R3ddrn//EfbM5TtLU9gyKFUhZrxlw057SiZi39WaHnjMBbN0ARJo7uLl7gROH6J"
+    "2eAvWalO2R9FbOW56e7Nt7S1UFWFRAtGG/F8FSNS3cgtktr1Jb6scOCFhum9jTSRFG0DYYUY+K28y8X0wlVNfA3DstqM"
+    "bhtR2kIsbmGSz6ddi1VWRI0guCDrGBjRmL22UWEzWk7L4GBoqks/v/65BTf80u9pHoMx+u9RI/1Rl2qO6h0RrZb241rO"
+    "O50/A4ER+w/O2RGu9Yut6FMHrGYWtI5nOw8Max9rzlNtw7PuowMn1ZGGXypy7uyf9Nru9U7g0iUTCO8TVOjVKB0MFsKh"
+    "6HfhDnG57kbkGzQLXiMHSECmsq403F2NQerUaHLlEgMG0KVYzavQs6/tsMXEn4VQaWVrOf6r+1hUxjL8sY4ksP6HVtVA"
+    "gSHzARK1YOTa3wHNA5k9o4Jg0U8eLN1aNwWqquHP8t4igyThI5J5/gX3hDE4M1niTcgpc3tP9qVj532G2/IchQgU/R+R"
+    "0RjvnIe5avb9cBglgVjq2O2CcEHe8sElApH3xQgvL/WTP2rEtzmvWBR27o7X/O+Dx8iPCWkwIAfZB4vOqpHBIxUfi9Qs"
+    "IRxfxii1R674L5qd61ryWgw68BTKXReN22aP6yGJEZPYJcy8lZjVy1WahEM0zgjVU46t04RCT/ylhaAxN+Qh1HMa5tx2"
+    "tLB8GX9WxFl8m4zz0Qfr/GrgZFHokrg0Kx+blEiUhBxPGbyd8vciDPw+PX/pkrPhE2pq69Dp82kb8RQ6901qqBUV4vs+"
+    "fkl4BmQ5lb+f40A97U/sMWtqvfADQGjJEsuJTWSYawYtboUTa6VnVwJl+Y5oWN/KPfv3OerPR+0G0z9dv9Laaa/SZfA0"
+    "9EU1p0Pha7TNURdET6r7EznyLXoVfbvKDqO/brm4CGBJk3ewy/pKnCgJa8zAsbiRS4Zrn2JNfnb4TMakFcFPfQaW/cKq"
+    "Gjt3uIKVxFhmBC5loaDSkmXU/fG3ZHLEwSWrhaaiTp23V7iz887dRBiv1dNVyPi702Nbyv7aj/2GJew4wzVFP5OAC2u0"
+    "sEQLDcA8lr+e8RjM7w26SV/43Za00AWhJuKWHIP7LAdcxYSHeTRuDpAtWSLSzXeMMg9NzS9/m/xbBv46IGNjaOcxfz2t"
+    "SSuRVc2cMbOK4Jai/lBpO/UlPH5XjVS32SVlqYT1nrB1X+RgW69l4H/J77WwRkHxuL/GbftJeT+kfPrL49awqG32r7/H"
+    "RkKe/9xtXdzGv0ivYHhs7PM0cnViys8CAu/GkxX779iyhpaGK6+qAogNuEVZfOra6qfKv7E83GD0Tg2bvhfZ0X3/Y/CT"
+    "PTJybhtmaBqxKxxXviNSe+z//f/yUCqyo2Y4nMf9qAg+DbVE5GMO7ITjyG32tOeHcliMBlTrdHtDuakWQSebL/arbFed"
+    "QYtwJK1oEwGOKlLpwtZm3k9RmTIgkd4HKg1QiEmnGS/eZuk8r9ngAZ67bZinGke2hY8ExTKAFrMUhKM0QWARlMvRzpF8"
+    "5y18xGKxrBSPvl3wXKXZg3iFMh9AYTWTHcYfBnfy9sT75Aipv0JzhVtnGCerZ6gFnhnoovL5O70PmW6z5rTPONfSAstJ"
+    "Lcx0+rP5B3uharTovZ3Jm2Lxg0+1J7Zmb2Z7Hxci9It3N96AhDHV8B/e7fwPZu/TZZik1JiOgHbP/Cj9/sVxCz/bRopP"
+    "4eJFkPbMmIv2caBXRIQP/fgF+AL2w7rzSH96KHarBVn8eLdmSU3fOVPOsZ1XJPuD5MlW7KnptO5HMKG/HqJxvIn+Kl4I"
+    "BdMgAKq0YxIxAblkgktepzBp1E9lEVGrDNT0jfwhnvJ+/HOl8Qhnyk/nwT7+cgKJPtNHh3Pj21ZKyb4TJxpL/wUlRhol"
+    "9yXVmX53q9wiW1O4oYesR6TyzgN/GLVOejmVVsSBMrnl2Gsa3Sc6HQIw4ITjZVzD+0hYOvhXBQYf4rXtpdool7enbWUl"
+    "wHE0pDfKKlFwXS4wJ5x40tiw5TiLVEFMa9kiXiEMxfNfi2kwoujhfQfhRe0O1L4UJiH+gwP7r/JY9XiEJ1JiYeE3Stxo"
+    "7D8u1dwMpM4yImJExLg8Az8Yhzy6leKHWXiz++8aXELZd03T4CSmvLMLoa3jO3/Xymaz+Dqwh6leblQAJy+r8cBqJnD/"
+    "QhybPruiGww/wovS8vJZZpjAqy5h0XfJknyglNWUhAhgO2939zGN4+Nu7WdP5YW1XAAL0HzMy0BvFtXUQiWetJax6dYU"
+    "w3+gq/Akph7UDrGM/aFdEpr+4BifLbP8z8OL3QX32Na5UWa9uyWEtYkd3vI6VCsEmv/WU3PApWT7p0mfRg++oSBqQg6P"
+    "JSQAUzPShYbuHw29VSWeCsoYKjmPgBtDrhmVdQ3UMZYdI4qi/Co3wHw/ziEh6ZfaputbNIas4mFcChSK1Bj/wRf4uwr/"
+    "p7fKoF+6X3fHyHHdxF7UMPq36R+7zLGTn/DGIct/K/A3kxglJVdxLNS0+MaHvXWZa1LIAha8JIcLxb7o9eQ1KOrSmXNH"
+    "6WS6Mpepbh/bTKNInBTujd8bsy+2dAjdDBYfyVkeL50LYQGi8q+Ua9a+qIrTWXBcjO/5lqgutA3OpLLo1z4vIVdiIlXb"
+    "4/Mp/ByT/2gmgzQcM5s2XBMOj19mtzlJZ9KEj9yTRmisspcZ6XKGWCdoTxSu36wLgNtpwreNo/oHnTNKYNemnT7M9J+G"
+    "RxR5BEms0WcyWfRKYG4Cpp5EPSrYozGCXqCIX2jSsOoiTowuf8uz36egDss1OsrTSBueuk5Z/ylgdHJo1Jrx+aVYF5o1"
+    "lgpXLiDp5CKp6guu5eWR5Xu6vu+2Gp2yaVgZz4YvI4CmWY06nmZuR97ePOf2G6X8VkuY2+sHZQdHI/+0t7ce95s/7xMe"
+    "Ni1520Ep5fSnMYx88Ev/0fQ48PczCZdEllBRVjjy+jympGFOILFZ5XoUlmQiFAj4Kfn+q46r12ymRVme79MEyOSa0EAT"
+    "npX4Be0QcY7TmDKUQupvMMygOx9a/aGD6yK78xgt3G6sY6ev3uxO5jFpDHW0qX0hVpDYVHXcrQqtgQZWkkAQiP9vzvu7"
+    "IoO33NZsk4PBoIJVdCidk7pG/Y4HD81sJEWnfdZIFfvlPOJhSx+BY2LK97aaZ36E0qovlpk1PGLcXoGIu4gVHA9DCV/W"
+    "4w66fVzJPfXnUuexXfp1UmaPfJr88VRqWInGQ4deSuHTKGxD6D7T8pGTvG3IcBcl5IYa4+B0Znr5a27oSzxvWM56yQgG"
+    "fCK3M6gi6zdxmjT1RyoUU7QYiCPJy28Qp78sV5YuWYGKsJE3/ak6lcMZoFnxMOWKf5iOfTPPyFRYHitd/kZCOkGgkdNI"
+    "cTRXkXv+jeoHu83Nop0tmekK10fcJJJIgi53RBNJlPKXqL/YCNcB2b6zjZ02P+oSZIMaz4NbYAbMeg/Z4bEqQNSMhFvG"
+    "PRfxLKk0BipMU7BX4EpZU5iv8VALSg+3c4te2JIOYklopqLiY9H9KPTeQG6fkUVfz3853OxKhAWxmuIyZ7ge7xmip0ju"
+    "LLJ2oi2Z88CCOoxtcFAaswLoEWJgo5cc181jSi5knpto3jW87bAOSnCpkX8dD8LYiAwfty3rG9iNTx8n+Y1/rHNEAhf4"
+    "7+vu60l6v2iD5dcQ+hQv+JVeHCpf8sjPyVq4ZeDt0VwE+eaiOXeqNMmDqkJSOLcL/XAjEgmJB2pVYT8KGCrEn70vaZL4"
+    "BTHOCOR9AjTxbA5LhC1oRqe3NPqBbE9mJd3yqnDXAga/02SMRH/0BWZyBRd9+82QGILbBcMdUwzV/izEUCxjpD6nGsGg"
+    "EVhTFUV15tRAg9mr0BU4klPoaRrLgy+n9j2mx3YCoay3G5i9Jr4n2CExdEkMLZPbBs4+ZZ1/rU44jpzzKDafu21BXyeW"
+    "JPWCmD8zI1h279W5b35VDy8CeJcs2PH8N6dwzYAp6V/K4qkAwXsXX5YDhvN/hK1wezdp4gBHbm54VGn6kDVd1S10fawx"
+    "GyKKpN+w/gFPGTxusSaYj7zyUcvR32jSTaFdZOp73+xxTKMK+Jx7vheXkITZderqiUD0PAM1Ur20FHlQCkuMKJuZjMcA"
+    "0wqXXp5VFKSxAn1bnqWeeayJgolec1cUtG/vbWh4Eh1VsSJE1MwZvmIESHFZx5WFkzmziU9p2HWYR/Fp2uQX1Jo/t8eV"
+    "8LtSPSGDouAK3vRjGSaiKzI+2zgSQdABhhU4d6i54MFZdB6xfrOP4hiv+Texli+X2+NIAAqcfIH1olFD6WCgfII9Wkef"
+    "KhqC6b0dJvpeUbgzAgMqNvX66vNpWcDUz/3AIDTbHO3Tt4AiGNwo0m+THptiW5rvVDK39x6lGqod8ChMX1MMiuM/OaWZ"
+    "lI+UWIJXyxUnp4Y/kLX7TO6czsk1QnRxdhtN8G0FuIBLL20cC9popbShk7P2mRgVxQX9Nh00P62b8qfJZHwtg8uHxXwR"
+    "/egry5KECcDyrOVsV9+8kt0LI3usHvjrPAA7OeRzTN2TbvhktJR2s80MJbx7Yf8w8lFA2NqGT86fnK1tBxtEIQjO9+bC"
+    "QH0b50LoEKVVFOj26zxFoqlE/HpcdK4KGDf4pFgMq1oiLLDDbHlGV2yLzLTQqG5Wtty3PNIMVOz1hQ3a60A10XpNh+MN"
+    "OG65sPcc+Vt4pBkbmMhLLNnf79+G3R3xxYDG1qHOh8tze0NpLw3XApINLyLRzSprTCHoJHs0yK4uOWyMq50eMJQWNIEZ"
+    "m9AOx/wXCZalgtN9mTnlTQmO/BrdvcMGJNJ+GksX4k/6k+vwLYVgsF5TdvWyIPZCbPbQfSfiN6JnfVeO/1H1UhLgIjbn"
+    "ZH68wDLgbqCJgpv8V11ihB2YIdv/qRVwaiodgnR4/dQ9m2r9dAhJjJEwc1jznklYstWxYosjiUqMtJqG3b0LzsX9KIuJ"
+    "mCj6dLH3GyuV4wcjtHyA8dRs98pI4FfSYA3xFvi2QrfQtM6rcVCZMBd2lFFIypOd8mFmxGXP1m3fzYTq8/dV0qR3jSvy"
+    "jspcOiEusO9YO17TJCDbzW0Up2Z2jmURl0cMOJ3VXTgqQdR9aYINdsjmFFkzYSZVb/4zHqvF5q7aCBjGph0+rSr0mewo"
+    "VHOoGfQ7bNCmEBNqMEMPSpsga/48U8xR4Ved6qHQntSgBQcvjTHqULWi8CFv2agjz0NPO6n8IoHagYC3/zAsZCnhevpJ"
+    "8CChYPNBr5cNZdYoJOq2M540oeTB/kDZCnjzB30Sv9P98XGCP/tXKW3OnA59jyVXK4918x6zFixMXW9vnekeCKNuSvYF"
+    "HBoL0UOZlfjawqdD4SGIQjKULjX7y3l4u6CUqo/T3dlym0pOWvtCWL7vY94BAn2ti4J0rdh3Z8DOv0m3h8X9zpOLbrVe"
+    "DUZ9sS0wUKmNFRn8Ld0vAt5isdeL+E5N6Si7sjRPWJDLpqsY1H8U+8ZTg173d0S45LTmQT6FdoK8q7cWMMQVGC1qsYx/"
+    "Y+6RhDmexUaWmIT09Ft+mApbszTx+4+Qc/OjgxUe71JV/2G7PDLuqt93tCkcTw4ZYWwFqJlDyC+8Ql6lUzCUKjXP3iAq",
+    "yx319wAzSbDzhov3ulDYP7dZBVsFniNBTo6mYmYtjS2xcbIlfXYshEYfrAE72uQNtBfPH1asrzcd5ZpBB5bu7jmPEWh1"
+    "7tweTmRcJXaCc3TlyeKoHM4bbPzmNj6RzPWXgccv26KuwtKuDFtzKpcY0S9fkt+mOGXhln7DdmY6IfF7EchdjvMN44TD"
+    "7mhbmJaSV3yo67xymMVNSE5nOSP9i4n9PudIVIFJV6bwhlmeyyCbXs/rEH8kgHLutiON1YXTOo3QuIJJzTxr6y1+DHwk"
+    "NnpTrc/9e830635w1Gs8pmttCl+59qoGGFM03Io7abT86DF479XNjyaIycssB5uGMm8stUzia18PuVzCv8ffdTUB6HN/"
+    "e65ifuWm5VwGql7+wurw/azuKm62GNOrlvFNFsNehzLseVVSHwTP5PLTymF3vfF95JK1YaYdOZnUBSPAoINUYxttAveX"
+    "a1mC1G/kN15ctFqPp6iRwUWBleYSmnyyZ8d2G1mKPnN6ahqV4YF8pyg5Vd7D3tgIfiBeciq72xdNqUB8Wl5qNKz4R7qk"
+    "+2U1+Gwd0cy6+9pH34diKXoyyXhAdLu3XfnzRWFPrbifDJZZuQNsyC2b3PMEi/87EudGwBZj5UMKl6fu1YHLE8mKQ8SA"
+    "z8WrWW5Ho5RNkZTy2F69Q+mDP/0q4aKgkG2IlWwrt/QoXuiXtsrJnCBcJLmMbt6/TBXmvf9+CB4ydap23+wTCL9D9TTt"
+    "B7DMenrcp6f/3/3rI6RK1iBEn6UeNlulS+05CeSa1RFfIrMbEfyd4DovVHlnQxLUblc+7PSwSH3iDA0ZIHkIVsrUfSH1"
+    "3+Qvu1h2OXP/IZ2tUfOFPzCuk/BLMqJX89Js0YKHbOZ4SzmKqQQ4ZxA9QeLubzPL18qJbYCfpIby53Jf84eBgvRwaYKs"
+    "aQXwYaRR2TtahSFqPhGnxroxASwtlzYvwuhlMSiVgUpJ7mEi5kj/qn32UoPHzVpo2ijYNH9JedLGRVKv4pyI+qkRPXeH"
+    "aL2/Nwrl5cXImyD5MpkoxLY8Oh+xKWDuM8qjYkAFDcvPhPSOhY+XqgBVfFAGBhyDh4iwdvXHb7/RxYe9CxHKP2IlhLb4"
+    "waEsJwn9vBozkUru3BKr3fWLUzu2Mqs4joi75WNVbbcJ2DzvKyB7fxkOV4AKvdggmxJQqdDpG7+bJHXWO4VNhf+KZV8S"
+    "asw8ldnmp4jyaGH32wf6f66810847AdXP12tsEg+HNYvvlBTzSI0OpVMbSEjpfiKCdyzjaIi2jPO2V0hyAumy3kTyk1Q"
+    "CutTly5aVPcejXn8KjssK5vbYtNlvrCoDFAo9bxKv7p8u/ukui0Ubd4WmQf51GAdn+s+nxjRUkHEN1AhDsP3p2NArgG+"
+    "1Ezlph2OZQcgYvCPjXmbBJdHJjFdwsdHQMPm/UX+tv+amW/tGjvHoM8u2zCBSP7zBiSVsdW+/cO0WQMDXV8ZvfYY1z90"
+    "oeUcPo91OQTHKBeso/Fyc0M7h52HSoH7Ha44Cox+1Jp8smBjXPPVJTD3PQcUBZwPsriqR7d6mCpSNk9C17Wpl5prt8+M"
+    "EuEaccVpA60zXlz643D9ZkNjVYHnkvqjhawQZXhEatecoQhKWsJ2XbSO8lCCJaR3nl31ptTb/UOc98f7NJm3fjS3Omr0"
+    "bKeizUEofh1WC02QZJP7/lyJuOE4wRYub7OcKXkzu0d5NIePyiOSQbI5TOII5Lzd2Sme5LqEh8Ra/oIxmFF6GGkibm4v"
+    "i6pQB7tniiAV/xFqv/0+f+9bWJMjQ4qsfnBI9i7RCbF6p8huA3DMtSROmzq5HHzKRbM+cxa2Qh0wmVz5STu+N/zmLKOZ"
+    "E8N8XhW8ORMhAjrZ+vLUYMehSv4X21nkQsq4EHuFYzrDxzQoexyUc+nPs7f9V/aZ06HwzCSeu79cSrCXJh01aWQlhMY8"
+    "0S8nXbg3s7YRWvgJiN9l3AbbQaSUPyN7mVi0UC1aYoc0oI0Uke0pww/alu+ZfWbWoOpODT44KsLGeg1l11hVuJy75hD4"
+    "CtMSSu4zGmPCF53rUfE1JlnXPcSM6V90iUdKx5VQ02C9AlmvvukN2AYiIVCZIK0xyR850puWyR2poo8T5vBGp+THyW81"
+    "W0rNtxCoHaQFjQswyfperZ0XaDa7BA2jgH3xfGB/T8GwrgORCLrHljX3NdC8oS03w61FOVk6db3n+Ill07KO+fPoKZeu"
+    "e2ooaWX8jn9ewywgyw2C+9KepepTEzT1+cxcakQXXNNHn9E4b9boVo/7w/PXphPLrXj+LA6MvPAjPTivEahrCg8igswH"
+    "dudOm68i6RXgdVfHX95IMF/bzIkPmdAmZpecLgR6LGXjKOFECw0NdGGF9HObCVv19JjKV6cKszhTtfw5MT8ZruRVIHsO"
+    "9Gvp6vw63wgUazJbIybltvcr52DFG8j7VM9k/uJugScgYlhvAoNQi1x7iHAuFFRXlro1qs13nWhPzTLQQqK9b+oNX7UK"
+    "sShcW2BGfS/o/uDIpNsvISRv+0hObHZRxSKZLvKpBVpV1b+uc2Xe+W0yT7qyW/vdSTm6Vr1PYXzTaMXkaBYSRd5+0CSo"
+    "JK3fuMV1t8jYlGoX9J1ow9yMHhRHcf0p5zEEVeVPjaDff5iBqx09qfiIdWJtTDWiFi0CzE+XINSqDXNpZR4+7h4Br8Zf"
+    "he5zUCVbE2mHNTXVR8WcwQCzWMrR273iYdLZUqcxEuJ4ZzLDvn7KhapMKYWzfwnBrjtjUAWTVdGJBOGr/6QzZLLJW/0k"
+    "4A59w7kI685BrTGXpRiWiTuaYsMxkLh9CNq+Q0JJbzzXxBsS9fHnOJqoKokrxMexpWkh9p5Q5WAvX/uUBk4LM3cVw5yt"
+    "HIWMNPOZ0EoeRBHwqneSMueZCgC0c7ooNhbz6pi7rlygxLHVO6YE49nVlr8BLTPHCi5F8mVMKHw7sxx7RGjJzqNM6PBE"
+    "5DB10Y+j89PFPER47Vj+gS47LCLOf7+6gj33olm7xnHsbe39uBa+fuaHneLV9mf2THS0WrS4xva4upS6bEIOW4kxYSN8"
+    "/ZvAkTpFMR73/T9kK6AZHtfmKcX4YeZInEJUgKVCb+RpDCyt61b6e+z5g4FfG/Y2Ps6+Tuxo+BhbZBjv23L8FYFa1HVb"
+    "+xRzv+2dcuwbDmJ4vRZqXmJ2MffxgiWgBrOWnDDmi2dGs6HYNM3JVhsLjDY7alqhWNBTCx1SN/Vz5GoiIHi0J36YZ2+M"
+    "aGWFf4aWHvotoVMWxzf3Ne0aCRgT1YkpSju6cPWDwYvqTUwQkqhvfkYjl4Uy2uN5k4xZKidc2Fqsu2cOhQm0xkQXsTdb"
+    "yHYz00XvRVn6hZP/oP+VUtQ+CGQVjVg0zzEqo5pCdxKvRZVnJju6qoFNHJvQvLx32ay9x5WZLS5xSjFvTYrlakz78AYx"
+    "uH3PjOeOF6TYe1oQ27LomMWbtC+XQMDHlMObcI0WjGPblE7815wboU+w+C9Tlu0x8uQF1FkMizGbuT7mGK2Ssp/7cTkD"
+    "oECoHkhKUok4aLDDRU9Mt/2q6BFzMkxFLLGDuRf+68cj3jyvhct6897J7dW1hpW9CB115AMbG/b0H647NXTRdLsdvzex"
+    "ezxiTCUAfV07Ne3o6g/7ARmIGBNMY7UEuhzLYzJttmRCMZN+rUkUkRvQaTrGPmCuOrhd5GT/j+kZ0HZ9Rn4kY5DFD/DQ"
+    "BvIspU1B9LI9IBkgDPfE8xk/ljQe3IuSnJLBhGvjGKFe3rS4xmxGEO5NGjucl2nOH2rmSQRAtjzAm+urtk9iSsnWvJNA"
+    "th7binRLaC9SQEXiKALX66ZygQpZyPoCdBKyCSbg0skmeD0juRCCCsZ3BEtyAJZvUua+QFHq79QbWoI4gN/99awVrlXy"
+    "qjPZlkSZY8pnSGp6f/ig6gx97OnTxu99PLU2Y+ts5Gpz42GcGPO7gxibIqiNdhTMABFiNAo1IDG8MEvAql93O2TdeRUY"
+    "IQeU6y/FBLKLgRvHo2tJXzp1cS5RzLjAUiS/bT8ap2+3bJWmGr3cjukDxCbzgwhILJB/rnLtYQ35suW7S2IjZL580BuP"
+    "gyW8pi/dqRgOiC77D3QvpjenawUKVRCyJWKGTT5EdK4MyfpcWx/V2FVYFADD0EauQaqTelcwG0mIFvZVnBKasIjGEToK"
+    "UQk8daPC3WhE+UeUVHSihS7IHeUPMhZ/JcoVNiUCODsddaKz//j8W6WOCbTQZDysAKsgVar5FGARsPFr5IG2cFEpX258"
+    "4KNmIg6aiL7OkNxaqJR94t0tZijcP1/VrZJ5h3vZHfKElljKtXhJpMV0WU5dVOwZ5IgEJs1Un1b7FpTZzkIP7MRpYFKg"
+    "IkqX6ZzvIuoX3sLmUeDYFL3ynPDGpusIgwP3uNhTxKpLf7TC4q6TKBhh6S+Wkw/uJrvKxb/cnMjehLJwmwVwo/tZpDaC"
+    "B1MjaFOfkIx3Fife6stNyyn0SWbK0ajjkxdp5PadnbNP8rOpP4D9ABhkKg3gpaffyWKnj4UzzowWVOKJDAw6wE3Ohghq"
+    "pP8zenw20p+nKtrJ9+PlUY+g9WsMUbJSRTaPSY9vilBg0z18aoRCuUHxLJZWl287X/WXTZT8NDTM3iIsdi6LUgn0czOz"
+    "CwEzi08t9Uyu40RHo60ZcOkz1J4Ro2Bryqg6APV6bu0ipF/hhRuKQ1J5wytCsRSopAOS0n9mAfqEzZQ3RX8L74qwyuG3"
+    "hRtQnMs9aiF2zj/7pMIStkqHroHSVWcy85Hdjrd8JJrYSuGUOdEZwlR65W7FJ+MYQ/bmcxeR7MlG0Nt75cagAtRftz+Q"
+    "+7lRaL8uRs9G2uzFhJ0JQ5v8Vmp2Vr9cLbk4bAu8WAy6w1l8wZuH18BLZoxX0kFzNmo+/JwhREV8DAd34wUfcvK7cXlC"
+    "rcmDmqHyZykBg5NrrlExbfHwXG8CPVN3VHt1ESOvY2PeEcA9jFTio7qbDO+CLEQn66ifirtYZ10hegsWTamWhN7aqstV"
+    "iL4zbDwE58jVChxP1QglEclK9lYR8bkqhAB5YVm0SmNy5Mxa2URu2PB3JSqCCn5wyV/v59MXx9zszK3kFb5s3VARaToA"
+    "/D6aItaJYFlgBc9Y7xhkiSZCYowIvPWBaoW0Ly8v4ClN4T5+2cY9o+49qz+vKk8cKolvMyZ3UMrGyuqgSkCx2aGVxmK7"
+    "bbY7a/nEjArbnn5o8Ul+6UT6AT/tg4F3JjUk/uQjqt2d63dUIuOPdwOd/i6pE2LF3AuicSMtLfMuzOTM0gvhnIfBu4OJ"
+    "xaCTjm41gqPKeXMJFJVlx02OVAok1YtQtBsK5+KjAWYiPG7IlD2e1hO/k60GmTIvAVK310tQqcWJbD0S3ryZWpif363Y"
+    "+MFvCZJiErf45G5AHGYU2L39TOECoh8zWxzGnrhKjZBA0sVI9TyOMKrLYT9bTy8z5wpHZrOKYiGGCFa34/bUwLIA5UPb"
+    "B8WwPddn5gEx2RtPLEF3jSqGVzJPHNZAIzJ9580gfCQOq2Q2mQqmRNiIRuKpBhymwmoscDaso3dqObnk+oOKNxpbkJk5"
+    "EXPAMoJ1arKnwVR1NgUp9ZHvW/3cC38yCkVrEsVbo2o/gHmntNkMP0iHX0Pq895W+Y3FqnNryATYtTsGXdAK2MtE7ppp"
+    "UW/WuUbcG1OsdJMdRuYuRr0+nqpT7SNnw6BGdkY7rONdmExLSatl1BnAgEefJyMjka00NStSnRql//T/7t+lo7KfefnR"
+    "gZ9vujb0vvz6ilWPiEHugsxOZl4OKVrZFOV5p6MsqkAd+9M8Z7O9+C1IUt5N4NXhPK+CabhtJTD88dof2rKV1aJZhf9d"
+    "Mc23pGh2wrTIThGD8Ba3QyDFnxl5AFnAoZnx3NxtpE1ZXZbw1kDe2p4Tmw9f/DowrXmfkzy0U7Rq4xarRNT+teq7wcL+"
+    "ksDCP/KS6ayy09M0WOzYa9T8ijRlD0EXFx40chIDr5Qgkstw9rlIUCDh8cNjjjF7Cy5ls5subnpG4LVpHvLtJC6j4c+u"
+    "MiMBL3zmMed36SqhFFHs8F9Rhk3R8DnEqDfaXr9ODbakDccPt0JVtZsZlYXe+niIZ7fIVwzmxOHJbx8tJwfm0gpMajUZ"
+    "Yz2oJaQDnb4VL9vEIf+8m0w6JDheNG27/3SPKNsBz8q+8A2R0yQodCjWpUR8UmgeyiHe9nzzkYcsvkKjTt4+OQXh/LlE"
+    "TL6gfU5n2SdbFe0n/6ViC1+0jlm9LzKlSNkUZdzXGwu3j1Pry/vr1w06gayh+08xXYaMPwHYVB2O/cujHv1xe5QR5sdO"
+    "lSqs5tvR+Iaqs6a9/L5fdMOpYUObYExxI0WqUGUz62Ipk56HpJcEgsee0+iq+p4rjZ2CcaOP0671dsdi5Y2F6DcYy9Lg"
+    "9Riv7fRYIMYJjDam7GFrWJPieuZxevVOW+ucxkvTp3FComOMk0zCt3dfZn3QfYyZX6OcbHZdkyjqt16PXxHgv4l/7yJi"
+    "NO1yMLxae05LcprsGjpdYUs5Pfz7i8esbs3NPyN40iaWe9LqX0GFpsQh5danZ98CztC2F2v/pgrKDDs7UcsBwmzKJt08"
+    "u18fBm0OxuLmLF10I0Njep7+32SDZyd5XMx7Xv0YWI86CNPtYXdpPtVJZilLVtjox/jjrjgRnZDQ7VracBunYe0YQ85X"
+    "tjE2wYjEhzRjKfF0/yilLX5L4n4X13GngzmnDAX2r5huoB2oNpDfBu/+bsJgv7qDeVYf0pXPRC3T/uKfsCX73WbgZ+Qk"
+    "zwZnhaocqufkfYk8xv7rd1E9LQBDFFleTdJDZcc/ZvwqIjTaH1/KAHJ//F+Tsm3rM5z0cn7SkBTNtdAn5Q2IHgPR+sJT"
+    "aop4FC3/wUdud6f0EA7ZlR6iViQ8Oh7IGrp1IBLvERKnvHLi60X+uFJuu/5U1mFI8zrroI26PZB7Hvv3XVf8c3Qf7sdr"
+    "kmWB7I8lfHJKi9nKqT7Mb7KU3wQSsDrCJdDThzvohga/M6mbzu3WBxDzzVVgIRqFfHtNuuE80G6pmpxvFIqdNE355kmm"
+    "qZdgSMj8q6DJHJ+5xzDJtGGW5LNk9GfRtGfqyLbrfYGlU2VFuvN30TR2rMB/11GhDUJLNU2//j4arxXXrESSYxneH8qV"
+    "UGQoXvR43m7rcX5GcLk83N8y5Tq25xTtQppHOlxD3lq27S2zSdMEP350f27KAmGcBjb8PBeHoqgmpOjxpQJ//Pnd4n+k"
+    "PI1sSPNC25AhKykUjxOeRs6D/YWH7zu75Kf9wGH2fy26xKcLefBtOcoB24qnQtXjS280iAIF7F4XhlHqysGKnJQ41nl1"
+    "f+suJM4+YZv/vTyx4sbLWQrLRqOD6YtUDaEq+ZyGCNMWA7v3dS4Qroz00aElGMuE35WSRlF7ZzScVbzntuv6ERUroaNE"
+    "e+/jJ9ZyJLmoOflfHtWTLHjx7k9efTb4GU11NHa45HltnyXvDeMgPRe/nn21a36+SEMtVTt+G7h3qjEcl/sOzYOYZqdb"
+    "eFg/dQLun9d2USTHgz6rnssSAqZCFpq8NCEjo0iK59I/Rd1/rf0m7OlOzOdM+/IHGowwEay3ofmdLUvXK006BeMz9TXr"
+    "2qYLYn+LW40sciTdM2Rh9qs5p3+vv8fu0BCP14/IMhDMuW9Nm0fUMterLB0r3bw02iAdCaVpmUS2X06B+nHbEJhEyVp0"
+    "LNoAhZd72th8/3nHtliyKG/7ORiC1zVGmLKR2jiHXMLH41LGtohTpjwUqXQe9plTlVK3ptDv/TbBmKynt3E1LjqO79DS"
+    "QBJXb+7weZyAvqQ+dK4Ky4v1NqNN/5uk24jbZOEEHu7z1w3tppZfCLT2pHmTr76CUmwBuJziqpPLFrTJt4htuxQTFmc/"
+    "tEs2ZF1dKWYD9bBv/xjNc+zTqUrbwnT6SCfFhmbcJPPnjwmx5rwnO5KvxCU5fFXGbKnKOa362kHwhHpPSI//HVkouqYO"
+    "VZd8gGJD+21l7bbozgbLUilV+j+prpBkf9Q+pZ5cAoyw0Zb9wqIxzA1Ib4lbWWs6vvLrlihA7AnUH9axTiJHJSbEB5QX"
+    "yuy0zY7sr1JdTY3ARNrpeotl0qjvFsTu9KosxtvduqzwIIRKf/Fq+lfwGCbFHZHjhEBM9cyeQavnqz7nQYmkKnoWGxPL"
+    "maVAp87LwSQpEw/Pe0zSY43IEL5F+2e0G0nX1dLAMuzjctyGac0/LytCpjjET+B10mb9shmsW1PTJpAyDFjOqQ7bjuXR"
+    "S7UiXwRVwM9uQMyOUksoe+Zt+mXgZj7aXtdWdrMXeJXU+f/oHkdEquglQAL3e3BeCbqBr9G7PxhUOZaYqcxty0fP9nc/"
+    "zHmTtUT5vbIo1U1vxv12PkReacy/I/2h2IEbOP0bfK68elbe2kzzyctA6ZCEH48r0CP8eZ/dbz0Akyze76/NjVcnLAPT"
+    "6y0lwjsmm1lQ38ofH2miEaXEZBH3L3wrom3m+a7o+OzOczzh3Eej2aWCX7+6vRb4niMkyKxQZE/5DOXcxPIeiF3P031+"
+    "LE4JFkAtd/WxZhHLEBbH2hRshkp9G07621NDLUyN55hxSxfuixykALjUp/hyCjOwqe6M3l+b510mOckiuck0YA/va5lQ"
+    "xvUW0m46/zPZoGbWKxlrXqmR84U4+ncHrE03rz3/S5Pl0x0Hsr/dWZ45i2cIUfqZYeR03aVgSDPb9rNJP80xU+CY5O1E"
+    "feJKhKiypMHF9vwoHpJO6O+a6PomBB0m/uHNJTVWLEYYqJShEdenfx4CLqwLvSQfrWoHe8ZjSabw+KjDu07h1zQM/75B"
+    "dgeLT1TqJDuDp7mEYsbxusmuh1afy2MNyRR+X0ZpS7hMk1LcUcw/H2bcU3xvJBDGUKe1HN9AeBzCKrHCAbGVZv6BmcPP"
+    "+bJk6LmklM0/ySD/49G3WCi9E65xUVSZkVi3hXLqgmReECgSSOPCZ45+xqtAYn3wb84XkViRL6qnG8kws1ZIVgUV0qwM"
+    "rgDKMEbeChXRbUDgV/XvDnz2O0aPe0oiind2PPfziE0ZmPHiheKtcNTz+fqT2b6+DyWNiWOFuKpZ+sUNETfU/MKYmOlP"
+    "JyleFufNON0NpOAJq77hLw3q+Vy1gayNbipWGpZry26go0vIysyvMJgKG8AlX6vY9+l+JC2KD7AdRCAKthFH30y1Jc6v"
+    "t0wNCccmxFJ6Pb749I+WiGAPxc4XnzqIXC73F8BywqE53OZqpy7vlPJ2gZVhxPnjw7syl5lUD+MeF0WTDKF6D1/JGi0u"
+    "CgM1Rz5I/HyT9yEl7rgyml0Wiz5a44RosNJeK0B3QlNaRTrxq82BxnD+d0KNgttfPYlpP1xzkeanam+UcIyxlCGiPpzM"
+    "mM0hOUH02Sj1uk7SxZ7nTWjh+ZEyXFcoG0eJCMRM9SrKNre4bWWf8fh1uPgPfPiCEZLY2ZPMksL0UaYESDyPDJPDU7ra"
+    "/EZ69nsua1hsKkmVqwjDtuMLWqilR2nXTRpV9JNHlDn9zRP8tuglw40ohlse3FVs2hbIKTgESt4H+4lyqaozMDtv8N6w"
+    "huC9kw2wWDfUDsfrE8KyEh/7KZujLPSPP5ZwBTKK/gms7aIRahCUU5GHOOUzKlKef/e4G/LF8TUq9oMd7NRQnt3KOZ37"
+    "7WjafaY4ypcPZkhN6DUUp4n1dYBzwlw+Aru5o50lNHilZRAHEsM/3i5raij1KuRTncFCp0KdmZDg+Ixz+Ow91SdF/5H8"
+    "y1OAD7seIh5u/U5VD+swCnZusIxjZv01du+fJe+Q2sJO/7aXJoU3iPCp4u3PAH6deqbyA6K1c2RnNokY+5MQZQOz/HHS"
+    "hr8TW9lEMs14/6Br3mBtd2RNTXB0bFWCUc3nTAmu6exSeKmv6NANnj6XiJZMBSsi9dbSerza4J4/OJkrA2sGEu9FZkP0"
+    "koqqMlLDeMVgwyjhcXU3Qg8YxTLx/R+PC4aKdFhKIv8ChpOp4lJt7y5/Bv+FwbLsQQxStlopfhGQkT/JpOnsCybY0Jo+"
+    "/bOw2/cJVhPx3W1HnMAvY7SShSkuHvy90dBQLYHydRJVpmxcCj3kp8gm2aCEB0wwldzQfvR1p4NLiw1b+ONQlhmWebBg"
+    "NhPcxzhhtklQfUZkL0UDVBcmfNppOnZgQNZGkZHXLIWaCLLXSTpltkeqVs12CHQpeanLYt0NaMCZxPrYRT8FBOhE+CI8"
+    "cCXCXpE8mYLg8QOyXraNjW5JVA2G68T45puJ+Cy9k7VCZGdVcdAAqnqGie1tOtrGHK+vhuoKTrK3BlPYoZZTQAVcbI6c"
+    "KGtH2rv0ic0DOe2YWo/h5096zKNDZSOzcXxdRXaHCWFVX7Zj3YnqzZDFCM4ceZvVkrfJ0uet1VOfES0FqG5Na5HZHEDW"
+    "Q1LYe6BgaDjmzNaL4MZNefYaz6AV10ObgoE9oLwB936Q2u0k/CG/TUlZtLeK/duaWQ5+MCOtw08PbIrEpHP14lS9UxS/"
+    "/DEVdzngCuadj75H9xHKk6r+6+gfeRYDQT3Do/App2NCRQ9JslvDd2TnjUj/x7C8/WN1BSxWoRw1D3GH0u5TAzgOcDS5"
+    "SXzqdw6fqCLtRH248RVBI0HYSdbzGZVUZVMR65kEa3e0oVD9i8CVP8LV0nErVZOSbYwLx99Y+7SHirzVjuNmF7KfUzaE"
+    "ZOhCgXxT3+1Su8KI+dUKLp1O5JR7P/dOoeLdxqNFV1pucmmfdnj/whXH+4kV/If31/VvoU/PBg2pY6zXOaWSylusGZSU"
+    "hx5OP5QdND97lNBdN2k3iaLanYafDsH4n6eoO6R0kfOUiT5ukcNvkwv0/BCPHciYY3ZxgTnFkHbx4IxzGnGzy7k1XpIs"
+    "OYQ5jLtFnWRlHjpMGnLJ4pMdqrjOKcOY3pWFF0pauV3z6ivCRbQT9UDcx/Cg/ISv+8f8O75+W7x75cyg/Zk300SlM2QT"
+    "s7VZp7gzfw+90fEjxFYrcbg/VZ+Uvz4kOTnXE4mUdyp/Pqq8NMIKQnoFGFbReROjAmqIBCA9QDYrQwjQiFRUGNQcoUQ6"
+    "F0y1IulPmwxTtO53E5kf7q1i3GRItZkROq0qIkdGVzsMIRRk3jIPRi8ggshqn1azUivbymFXpdxiGdpEoE5Ys2Oh/dmR"
+    "mrO71lG8RGX3TJDPBQR6VB7yQlLa2e79QDUMArkOz5xk6j9JnFFE+OwxLYtwIVwVv/AXvgWM945bJL+RWXGpgIhWwWFH"
+    "8dCbZaaHKFDEpicEGhRPq2JvS6+hwms7qBQyMeideva5luWCH5JcXC8XdXdQ/xClpSOy+vJQfvEkuCfjCet+FGOtMr53"
+    "hrfpefPmPcjSShVmQbQ6iKa2/GYtIicIbuUYXSZJpX2B3lEjVMvox5gMb0JkSKYE54/OGvPdTyAoqWo+RuDRQXuwxA4F"
+    "f+KV1MwR0fKeybJSrn3IJrScqf0Clf9F2EdLCmC2+kLSXavVWu2OAGDSX0Y30yLFBGQCzrTW7RFgzzy5lUygU0YKMmGb"
+    "vCxkzQeOkJPC7J3UeYr6/iMRM2ejK24u9EzhoMZcbhlYgv6nIMH8ZRNYV8/h+Rvh6napPTAZqXd9LjpJ98ugVZQzko5P"
+    "o7u9J8c8rQXcmbGjSvdE9VVmWHxY51VpDAmClQng4sDKCE8OZ/3g6QXEwgQ4ASl0YgYUsn2EjRZb35C+EAEYpPykDsZP"
+    "jGBNXgiQwMUWZOMymcBBvM2IRbA3/WCzxjwLWiIAIZm+uJu/OrGWCh0AkOPiDZsgTR7ecYcQBRldgEovFAQhYIvcEBum"
+    "RotkHRZnhhfS8ieoyuoiXmPQFQCHYbw+XQuHwduiW0QqcRhz1d4EbmZ0YvnyTgxlBo5BpNf2jAR22J3rKAJFjkns4KBw"
+    "xht6lx/hKEyVToRAtDNFVjzI7xNB4blJ7UO/ya9/KQWsjBI2K47QwLyTmycy8qkdjXBOb6beQ+t+lpAp5NXxlBHc7D5D"
+    "8w67bOQYnDfRT0QZZ/KEmox/0KIBiWCjMnes7Atf8NDSuZGQTKgdXcUS94xmZhT21B5ENsHtZnLdl4J38WJoKOnZkKcA"
+    "GUyI3Jlap5lKZyktVW4rwwxR7aj9C4WP9VRmqVg+iKzZaJwEZ0fFaqLzJB7UvL1YXzxItqNv3zreDOunUU9dzI8C1xpP"
+    "ctkN8qMlRUJpfnIVvuouBvrZr++gOEpQxVCJ0V/5QEo7kYgilFRm0DzNOMBIPtTjaIBN8Lzfx5NYKUJhefYeCaaJxER6"
+    "tqDMXq6j4J29zuaHNbqK7fgH3slqRGVjb296K9Og0l2hq7MkB8Ve9QHFzCi6vpLWopjcDdJgVCtp5Z1remcxyIhjleWk"
+    "VWYneS+IzDqxf5RCjknGmxTdZ4cqHyFAp5GCxEqQoHiPl+sEofJFZVlNrP9pPQjAUb3ZOajmWN0eBk40Ibjx4Z2oLZ5R"
+    "gXVM1ACxzXROxWsZNaOoHCFJxHdzaOB4usHBlffSUlRqnJXKJL/MZxaK+Pksl9+hX0W5Gokw3QimN6eaOL5dUAEuRi00"
+    "BEWkwkZtR6WAU1LrcsNvzkzCPkq9mJ7DDJdA+xi8qCMT2nyFK+pussThj5BxDa0pescA2wudbvpqboQLHbAztcjblDOv"
+    "s1TzhRKQSS3d56Y0OZ7VOhtkSOT5oYOm088AnloNClCKsSpN1uFXIdLIB2kcDSIdCR+0XqIHzCfuYJLlHvDPL2YW4wxf"
+    "FZLA2bqXE/QDTYpHqSrLNfStXT0r9VHYXH3WL6PApXcTuaAgXjnal+VNzGo/JldhAFHlRDsVaasndTI6ztkgIHUCzNQ7"
+    "2ByjymZCJZkrokRwBLrC4W+vPAuxhYZZWdBrWLSqUNNPNVaWu+aOHkDc4/XL52citJhi/mMqQe9lPJ7UpRrEFcG2dibo"
+    "LeotIAYEsE3m7SRKbAy4qw1rJ8ArtiCRK42CZCYT4bwkO2ZHyKSPU3E759YHkFIwcQszCLty1LuzObcrfSnMB3zGkYn6"
+    "KLRCsABV1w57FlrJkTF0Q/eSAzytLCAa+s5MCoInez4Qvz2jpxteEo3xUcFcWFI2fYRxCQj3QaFCJwVvMlCJiSAGXR+u"
+    "kx7Btp7iBgE0GoOwyWU/qFNIYXJFAKKH1T/pxqGH8Mejnx347eWTIlB34ml4Vr6kPnwneBFMAF4gRYWccYvZD9K/uPfn"
+    "QubJfCLkWPoBnYts4Oza3MyP9hfMXDE8CTxhKwgbKZkg9zrVHRUsgsxOGJrFPAA2RlDm6EnOqLo7PnXR6q4W881sotZi"
+    "T0VLRg6ayTVIVI3jHVK912m/Dp0vnKjM3+lNhrvy9sxXuKMipa0teop/gxGhP+Ow5k6Fko1+TF2qpLbLeLIVP0mpAAup"
+    "/MaZ+kFgBD+SSlCnnBQ6yWLvqE9jKUeySOsblIH2yaefJbEyl8GW+yICVv+BSAooNU/vKHbW7hclxSEswh+1HgL0sb7s"
+    "LvXzRiuNmc880FlVIWVgKd4MemoFKyyrebsuDgStd3a5VA4uNceIHdh7e1vZo+U/KKj1Rh1RqOgooJVWR8XbviANks7v"
+    "pRZaLBsZMYiNAwU7B1lUriSuuLzXjwqLCVwtWt/CeBe90Wh9qHg1Znr5I8IYcJRkQD7W3LVcYqS23PNEiwiuDGHLYckh"
+    "m7XrUn6JcFfFzRdwcq4WjfYrnToWvV6ffTPoXV0dvfEaa/3SqQcDZaZSZ1w7DySM0NIV8AqRQvq5VShmzh6a9Y90PC/Y"
+    "jviHE7nQdp6knlia9XuLpV7oi0HFIVRXDGrWQCgJNboafyuBxKWMMPXlqnNzNq8W1QsXUTr//ATmZvxL6xFtEICIV8UI"
+    "D4UNwkVKFhrR656oSS7qcE9oGkpN1rmcDe3PVeA9CbD2ieEuTB3He8KR4BptbgTNKE0V7qQeJKNM2VOnCgbZW6vBcZON"
+    "W/Ab3XSalKI9Obr7BFRj7r29JM4rKZA16lMonKHJEJG1Kw0TIFlYtD6cBdBbFYeETGU/BDF4r1ayLDNsirVmY1qH97MV"
+    "KqhmUeKWfG3Z/ZhTM9/5EEPI5MUEwdjzFzZC+J8243uJribwhI+YpKgVEOAwXYlQmJ64dConWFZx0BRocdz55zmQwugF"
+    "hZVWXYMqZxJVtNY9jXRsRdbTZ85MYJnUZByhPk/FvBqLH2YhJjNPckAlqR01PEeumWE1fcBByLTaG1SLXFe74S/dWuyY"
+    "Zc3XxKWMLQ4QWQQxR3LAYepqpoww5EhmVSGMmmq8W02Llz/bemYQL74aWF5LNRgATHfmApeecaWCN0ujYrxzbXfuwGHW"
+    "zVrWw2zDADy/bHeEcj+ZegjCwzBXq9QBA8RPjRs4yBYjFqUDC1ZTENQvrjWMhxNTG/gUqNwgYCOK+pzQgco4Kf/gwL7B"
+    "a4isTLwJ5fblYDDhpV7P5lBi4zCaOBHrzrXnP2kFXQGtfUjMgMvl1X9Fys8Zb4i+/0hU4rVRfkCwb1t80Q9X/CaRop7S"
+    "yo26kXtR/OTF/yAG/hgPqs5UqYUji2mcmDC7qwXg1avo7G9WOxbHOUkiq6ZQlpQ1NBj+jzh70K5EUbYAGtu2bdtGx7Zt"
+    "28aObdu2badj21Yneed9xf2GGrVqzFrygWCaJDM4fBskWOrpym1dsXV0lnBodeYc7lORsWh3mEFJf7HiePevF5qZerzZ"
+    "S25B+oNravjwPkfuj42VX+95/maVJNl/br/yVRVUnBPkGDM8Mnir14H567+HGpaxcOGxfEphSK0FCg21VPQZ79c3ITu0"
+    "TjqOdKyVFAm8hjeFtomgdDS9d20ihYNFC/X6Ejye8JHV+bZBtYRn8TX1NcztwoCdum8El7BoI9lnGLNVUG2O9f3QaJKc",
+    "9zBYC6ChzdW8Q7zKeN/n4CFNlPlDHXsuZdTFNjFZzrz2RD+W0Xl6bsYehuvDtWSVjWTct0klBK3Qlqpshe2TyKX1FBBZ"
+    "P4LNaOu+Kr8OGMMYxgnB6N6WwO3xwN99X/ubFwnMpVmav4dr/q2Yyns+V7ayngKT+WE5NESp42qwX3BE0gxd21XFo4q+"
+    "Lbq83hToKrA1FaC5do+DqbqcUZxwxTn+W9Ck35CRY6htG6eaRWSeFDnUINMyHjzOyN8728emR6S+EJuQZJxzPwJhbtwj"
+    "JiAz5YnjfOvNNTWWAmMmLS5e2+zuzAUBh/ConPFZREVx7ywEx1Lo+RpYM0C3u12XF/dJZeuoHlkVXVG2lCVv6VuWg0Fg"
+    "jvZsyuY+o2npqTpBd5pTZNglMeAYrOhoTGEOxhUZ3Yf2CKMyEOSUaQP7hjc7865Z8l7FJ5QUOEDi7Hz+t4QH5rRMM4Fk"
+    "rQhkhmDonodQTSsxdRJyEOaTDenH1n6gK1xiKcs3LQOaqSR0HctRpsr5sulnqC9txPyfpoTxu3ek/6UlTVqwYRKd1OlY"
+    "nXPsOUEGmytZizkM0fsplylV3gw7h2eaF7wIIwB0WMktiHnyyZfa1XEkUP8274doIhhGCq1N850AT8i8z3JK5rOgxtq1"
+    "oOdKFltlB9NPD5g7oIvq1rWPjuPeMTKS45xroOfZtOP0z2GLPw4ZzHlBl6YIUhyKqu5aSkdbuOa1om7Dj3WR8mues3cg"
+    "D9j2+6ZreFNkknkPEtVMLVV5CDyt5Anmzpsspc7LjWkYUM09xn4S0vPANYntKUzJEp9QVlr49SHa3Lu3I8xfd5FuYvR0"
+    "QLGPQuZF8Qd/rwicvjddHkf4HMfEwrPl5XmfbYrQGIT6EkNCg6mjZd1aDVZ0TRxQgj9dTazmZw0PD02dOZ5pk3bB0O0H"
+    "lrFvd89PPKedHzxv5zT0jQqoTTrirwknZ8+6ctZfFlURjIUWFM+apXOZAUcikYHLqRmeGU/9f2lSDK6RKdZVN2rZaqDZ"
+    "9A/DL0cnRvTf0d4gaE1slgXBEFhLOdcCQylFYOGmHCJJ7muvqmgFcDh/RFiSsgRGKBaqGkz97jkHdWSn7VJlGf/X/W8q"
+    "JYFrfVy04bwpzmmj4TtbgH20O1vo8I98uNz9GmzygX8trYOrk9OGb2dm8hqw3scYoYJKS2kMSdpbdAUM9oP9yaTP5oeo"
+    "hQTnIjWZS4zbyQd0TKoBN62BljA8ozORGIAh1PLMH818eeQUKiVh5NKVbkKCjuWV7mVEDfg/8ZY2mi2T7QbBOINdYZQF"
+    "2ty7xmL2GYwcTt9oy5iYqWzFRIDaLRtYzUMOz5MDkF2IiTfo4xmzuiBE0y7hhm7XOCyWCev7xSvp86lVYkCBsacVFBD7"
+    "ebVapauBJW14C1DdXoiM+4Zkwc6HzNI6Mr6EcibSdf/Eju/ndYvSVHg5FEM/KP1+/xoOnQDlGT9mzNR4JWCVQenSnvuL"
+    "KvBMTdrx9qULn7igFru/4dtsP20ximywIyCIRuVEDlJY/h2Y8z2/ZDqk5HRLLEWkNIkgTo7w+pCkAf3O/NoI4GWvpu9X"
+    "G2Y/++i8ane7WmfMXPtiDAJL+CgWiXmBLFIwYadTIJyXcNBL0Aa0zu3XqNpfzsBO/bBhEFnbR/SDMGMDtCu/i4/fxgdj"
+    "gxSQ3UorKZBawZ81pbUSttUFMB7Vtyl63lNWdt//bWo4b66xHvEsjY+CNSYjhb9kstF0unzg78kGdALXpovGzHcXd/7G"
+    "uL0zH8EbN6IWDaRHmN+qHFFB5AIP0Jwdstmhnw3eMhj/tVQGKo2OrqBhMv9hH6dSiIqQIE7PbwNFvesL0XnxKrTCA0eV"
+    "MZ1ERIK6Cu4w/5dnXlHTkkHkOIIlbxmaRuzGA8CuV/zwO2tZNFL0nWzHh3IQlNVYJLWan4Y/c4ogLr9p1+gMwhyuvUg3"
+    "QxSrNZIk8GltRgtBZeMFXT+sZe5CGlq47np8E1rDyqL3t72b/HzQI6bb4SXf2cFUqDEZLFFCFJxilGPjasaxf0RWTCti"
+    "p4AJL7L2pAl8vBSCs1zT9/ys/HL+HrzRNStMJOHGHuVPLb6C1zLw0BHv9htu9XpgRfTDhPeYNAhY1VqPciiUhb6at1qV"
+    "tbDxPpNsRcLGLULaXCDxNYzv0IeJzhZDu3GzbrYZD2HWA7nAXkcSj7eDg73b9jVrTPDde3+UFcaqKDMD0U/j8710byE6"
+    "VMb4I+P4D0u2KEWrf21SunSiM+xOnV483knQghBSLuwunntPtvzNij2THHAUbMSuJ4/84YF3tveFAsjsWUiNWuG4qxMl"
+    "O/VOoxEpI43l+EWQTlEKKMaA3UovroRuaIy/TIAmNwaCTvUvLocrMKRKWoFFiANv5XPk0RIyxmDLKlqw/3yFwTgcVTeM"
+    "VIBTom2PRGZl9ZbeenMeDrmYheZlZv6llU5cR/eALc838Av7Zt/KJ/d16LwIxtSZSwMlnMvQybusWTT8QZMBemWL7Sk6"
+    "eoVkCglzwtGzyoYk9vPivrJlhvY1jzqZqyivb/Kf724jvzItmT+kk0HEgxKpLNkkcZwBWVAm4SUhySFKNP8bE3T24E1s"
+    "lXxDm877i4hcbuDEW15KeidoFmAiXtkPrhZDia5xBjjR07laVOaXlacYezs2z3Btfc5QBcnhuj9mC77CUCPAdYHRJa4d"
+    "Kn4prmr85nlY1pXhL11DSKct28AfyNt5iDJPVDS8MXxkU/Jv8s79zGpRJquJHSF5MdSHQT543vaAfhtOnd1ZxY2pHNxR"
+    "y84PoacuJ91z6uz/6VfaGyukb0bp1Bqxy3Sw+mZ94EXe+7G0yNGoOPZWLbDsCufbHZV6F2yW9lQz+IKCHRQ3R0+Edllk"
+    "+/KCUES/g8DYSHUO9orpFQI8qZHC/EkcgjMXJHFMmeiTn3pOCc/RpHFwTVIiz69XOGMV1Ojm31JgzQRuztx6MMuFd0Gm"
+    "hvi9sqxrdMBAdyoi8LHbPryKz6FdbVtK7IFhor2fqflzvVHRBUT09G/k44Iw+iRZCGgw9fAlvpHch/2VmJYNk5AsC7uy"
+    "M6+8HwyhMr3+GW98LJhCPjNtiCifb+J9+Jyo7ke3xLSeSuPUtv6Dz80pk/vFJmzvgl9ysvZieNGld9lhR5xy5yQbgIkJ"
+    "Czz8YEnZKnaopaFqq2ZE8w+hdxeIJvzPGYz8kgAgAa29HSwUth8u/AbdUu4GvMjpa5IWIE9t44s6CszR7WBF4NSaZ28i"
+    "DFvWEEExxbTkAlHgedqQYV5/aGnIkHGfBdmyRDEtXROuhlmH3Xr2oeQADe6Fjf5EKNus4nLnZTR9pYF5pDN4sAdumpvf"
+    "ss9+C9HQ/9zcQMHl/F5u/PrPHdHwZwvBuvIKMUWFMAUB0L40qLXj+aDQ2+iQ1Un9Y6Cnc1rEW00nzdmyb71T72lYeKue"
+    "4tx5LMRo730qosFHcCTARXKKH6f9lrwbKbca3Mu4mlgPWNVgtut0qG21GfRyujEZtIsfq0desUc8HAqgbVqiVQttIkXx"
+    "GCLiQATL0SKuQdHv9bXOzNWN/FhcQBE9wJk9eLa7Yu1eI71ycdldF+zqS4b9J3ayXjSrxuJZNEhCEr4Vu7RAreoJd6I7"
+    "BlXhLDTyi3Afv2X4B7Ld/K8WYVKhiwbG3lGxxwa6357Kkc9VP3U/ByesPoTgGd9w6nFN2st+2ugStXnm636kQ8frF+9h"
+    "SxujcV7vdDQ0vW2opFrVefP61IcotwjhA6DArNbsBQy33v75yNuyIWrwh93ktiXxT5slTrVxy1YNE5W5Xk5S0P0l3jic"
+    "sbkCNRulHom+YC+0NaTSgImJlZbHh5v4Qb6f/3Qrjf3kcBbqcrDhupo91NXp+c/3poK5vd+NlDG0NoSrcDcUlUIeTDbl"
+    "DM1gsvNHa/S1MHPDS/qRPSE/+aaBG7xeT6PKXMowzBIzrZDvstYKx1uN0O7xfJMp7yVO3T95x97KW2tsOLYLy4GAaAG/"
+    "HwmbVai0EyNV5Lev2i+Vy1GDEbJxZarqZGeEh+4+60Gyps7nolFVNzaqM5CGtXj5UCu7sbLcnTm2gLdAp7cEAqfUteiT"
+    "zXCrLV1xWGEyft7U3eyndLdIF2J5l3KginaWcJlSlNP3SXNjhZVnW76qKbH5FM83sevfQ9dpEyz/RmLLsVQhAsGlbbw9"
+    "Lq5AfzYHQ6GLU64Oi+4E+Bg282Xvjpx2PP/zZX3u4BJh5bKfUTgi5lyqSFByjLFc2y6LTAw7Wu+VAEnfuh3KuHT4LMSY"
+    "s0gT/FoJj+XwxpMvS4JWOaBaYh5jRk/L8FR5KLu1vnwAWFnTnz9pjaqG6ANC6hF/5qK+onetDveNKec4kEQkMApi3qt8"
+    "/YDe18QpqH4DTptijnresQXYc05sEzCnxK4BMGgqmqGdktEs9PhlAtnmbLQuIIyIfwUCssVoqoW6zi7Q0JHJJLS8Wqzf"
+    "fqUWDbKWhnl/PFXmuBLxUWY6f/iG3e8xL2hMBY8zeAJW0ohhnhEImGxHAIpF058SYuECNBKBLbp1Nl48N7ShIGFS2x1g"
+    "pUv3H3EYXbN4wyH6alIydj8jfKg1p+KLIG/TMyiQwAIrk2X/iMdlVMj5uLrnVGXxbTtEHXq+V8/vEB/bnKrB0OpZKx4U"
+    "PK2/sjxJBYHSgipeje5c7Yjd/93EwmQOovHxBitDMSDhcJWSlG04ppRoU/h27Utu8sg6SyzXY6i7lbVsal08tv2ujc45"
+    "BTy+OCIIXsfmobzuahmfAva4lgIo4GTjCja3OFL2zlZO3CKJZiEcm5G3TYUv9Z2+uYYjElq49W2XSwkkch17NOQcP/ZA"
+    "AhezSnpx57C6axbaucFAjoxJOIlcf0rS9u1lzJ1J4LNSBPwG0qBZlJ2zExrc84ksSWOC78clszoYyTjJZ0QnrCHbHKn6"
+    "WFgmxlboSyXa9ZwmVxkOmYciNU2F+sCB+7zKbbVeloro4zE+uqkIvHIa1OqPJxsLjEhHhKp1e5QC+gbCOCbw+eVnQOm2"
+    "Uff/CIMijGOMQOfY15qvUXNAVPdyUDGGSkw/CrjB0YiVXAbRPC6aNsz/d9uuovtxbkb/yw+Sh1OUuxYxECi2LBz3tdow"
+    "OY8taFZqsySjQFcvGoaFU76yE3h7YIvzdSv9vN5PKmQ182XGhOB6GqKzv646/PdthEkYEcMZkh5wO6twbPY5PGkzqz9s"
+    "3JHWNZW2JNJtRaiLZbhh1mSyhkOxzjZDVdDe2zG8OG1+8IZji4Q3vUjkfJfoEHR3CUzYpnVx/v7mnknmHLReUc2gEcQv"
+    "elHoPJn+bOyPHVL5mjPfEu4niWyrnSnQ32TqBlUU9YZE0FJdSgFcGnT64As53xm6uFL31I59dt6RirnGCPm8t2dH2lxa"
+    "7xCFREyCWHh/enrhwr9vpo7BIQSiuF9x6IU+OFMdWKCfok1YlEtnltT+4Ng4tqmLUTWUEIzszrdWKIFD3VxxksKffG9F"
+    "a302fC1Zv2no+lqhWXMfGg9yHMPSwICCxp5xJj/mb5UUHJKwlAS5JaUGUF15XS+343EJHjsqOC6ADoC8h7y+G3uUpJR/"
+    "G88lx6ojutf4hdGJLn4mK48Su4HGyWImDKtv486QpN5qin4ad2u2DG8CyUI8Vg11QTHN5DwmeVrfVxhFJeWSXy5WFpxn"
+    "N/k269/uQEAh+idcAXU1ozU0m+/73LcZNW26jPRUprQQj2xWR5n6cJ/jddM4Fr+XNINo45mjLvmyKi9ZmLob3JOBc0lN"
+    "iIXwsdXvv6X6RpnktLoqU3tWRQ/8KcnpCM7pC7TdGIqe58O7Mc3AZmmKzIP7u2JJt4Ak8m8pAeP6eMB3BcGnKM7oM0XS"
+    "bQgTEQ8vBGkbE2QAO/Ln5QHITqPD85uOoLADYxaET0s5CbEg5TcJm7BCPCDUZfpRJx0vADnwpYvELae3N7Ib9B9fJWsb"
+    "Om6DTtPnEZMmcwUK/UQDeorroVS0K9CEhDMMDMdoBp0f1R81hkej68f1hZRWkNfSOdsbKSraP3RREmtRnvOyLbNyeNWJ"
+    "9pWJSVuj9l/gzl7Q+w8rqk4oS5iBsoLvd72q3Bo5HsLBrdLHU6g59+kIODL8Vb561Q0KKghibv9r/3bId43AHPM4R0ls"
+    "Ew+s1e8kzTqZPpmcDO6YPfSb5QOuVMQJv80ppXdbmyPvzrTl3q7PHhDWnYjw4ad5X9jFu9s+2oiqxeQXnaOb0UguFnD8"
+    "klQSeeefulW2ZPkDPq5UtZKxFECR6ATBlNPByI4qcDS9ZO+36GdGYePS8DGiqZr4/hZ1bSrGP9o66Str/HFnJP272ptJ"
+    "KGcTowfYAKVlbfZ7CL7ITKiMUbSxiguR1Mc00Bk1QY9o54hPDAQob8+qD0la1uSaqoPaipQiv7MLBjcYcP5ANqesN4Oo"
+    "gnfsXhVuNu01TDVri/yWLHTiYIsMzRpvQrMscWvW2cz0JE6w6LTwwfzZDC90nsgegVJJqUF9Yu8OQbYDiMtdTELexX+7"
+    "54vq4754Jm4QtlW7aObuBWv1zaH1ERJts+6nuVApKk0O9S5eZN19jWXfzQR8ee8wG0P7ltpb0g+M8YfHDu/snluMzMCx"
+    "ZinSasuLzkBlWj0PqOD0uWV+Tl4gHT6WCB2vyHdRAMm8OjAJWDDVCELjI15V4n6dvRQOH4FOM14rhPjXRt0apq+j6c0K"
+    "EXf2sdnPub6qODsKt3Qe6MgFViKGc4fkybX/BbahoTM/bfjBXkiYPRqIGoXxN8Ff+FIpiqj9JJzCay0Cz++iPJESbjwu"
+    "OS2ZCJYKV0/R2Q5FNpQA35Tyecewh2IjvNRUuFYUFdS5al5/+cUlp02m5ZpNSYIi5WO7Kw/vxU37hMvjiNXB4zXgU/GR"
+    "EMSg+7h3Jyeqi7ENBleFeBd1tpelKmuf6U/CqR3CKk8B2RpAoxbzvgfuVYzsDyxadq7b/xXQhFXVhMYZ0IcIoHCvbwPi"
+    "Pd2fK2PqkepZE2JION3gYZqXSU4ud2g3YN9ZvjNWpT899Q2X/5uwHxrN0CWm3To34jAzfoAnR42BOfYJiwYCkHpX0wTK"
+    "AndEKX+1fd284/N1GwBqn4BIlI8d80G7BRx4x3IJw1G8aR82U1Hxmet/sgUsVECGG7+8kD1z0+HIqZO4CzSBKCsXudcl"
+    "YUtd9s7NMb9Xa+HPXqRnCucx3zr3bV6q3urikG2P/CyA8ogEYayQS7EjhOd7Mint8hQhhNO80GyqCOn7FUjX2DOX2Nqg"
+    "oX3s8BlXZlSoYIRSUXQh0HRg3duDJ6TsfTPV9rsGJedcTBlH2JIEChg3STwmiGEozx0mpYDAvzYJBycst2WULsx4eZaO"
+    "a2U+ZSv9Peec43ols9zdPW1DCXUIzQi4l1E6bZhq2mLiYtheUF9+tmx3xwAG+ow0j6j6V8pG1YOfN5UMNlI5d1mgmHG4"
+    "T5om8uNrzLB8i/N8TzFz6qozlnVVYX250FTys4+hmERZY4hKI+CXoIirXqCrzyQGk0X/U0NYssQZ2O5h19wQaEC3EEy0"
+    "khWHVHE6hy41dSdlbOdrm7UNwiWjuYI24yB06sTgOc1xCsXiG86bNZAeij7/Q8yrOpLi7k2Goox2D9Ou69mqixUlYYrG"
+    "Fls2dV3Gw+BnqJ4EllDkrHt7Gug/UEWG+RcD8fre2dT5XD7tnoMg0KMATOlTW82tG7Nb7zPULfozTl1GOcc+X4jlgWNG"
+    "6RrN8DESJidySoTPxtf2LHDg1f30fLstw8fV34bD4yyY6xaBjY8EZeQVBsrXfrSLY+OVA441Rapgqm8m2hvKXMCZBgdE"
+    "27ING5eq7KaXCeaU598SyB/NiqW1Id1pa6RSy4QSZDJbfLiNh/RRUIhaMnP5xxWURwoZmZ5Z/QRuVQrAQpq2zuM1UBeu"
+    "cZfLWlWHSMdI6R88WvesEwwKFw6ZdzYSFDcqFKLHm7mGMBgMjkzzqXTVGk8OdYo/NemfbUF6BLvEeRcoCNyRKw2xNUjr"
+    "SUmeaXJcGSc1NCvstv/IMCiapo4jlv6Wdzh0Jpspag4LGaOI+RaEavsoi3XzldnAqdvvM/1Uyetpt0FiHKrP1XAxC5C5"
+    "HR9To1gmDL1SURBEApkLvO8285lG5uF0vIjQuQeGsmGgXcJdB25jEGze5o0NGGyy1DCJgNUpXlPtkiBg0OJtn5Z5K688"
+    "Qii3heLQQARLgBg9Qz3JxxsBJvfdX6yxElbIdMucv5rY6pGmqHYAIyDbvmkMeRNQ+mwuS7ujgR85ZCbXm/emBQRfjhA5"
+    "KRO7rmt5n22gx9b4qt6OgSt9mqefEyDH3a72y9ZFJMZTkQt4qkT6SPrRZXN4r5JNvqvbXAiqcCJS71LqU8OPPeXKM3BI"
+    "7X0MPgOw8X4HxpqxsSlTf5hwhqw/OIiGBZ6LWMJN/4QiddEMrEShRNKKMBpew8yh8DGFGxIy+JLkRWuPBNflwOGpi2Hd"
+    "ZiBUbIpNzaB0tWlPB4Yf/jmX+Az/nMuQMTyX2r/jcmUoWZ55jOVyblnyh9J/VHlHUg9HJ3KXsOark8BRMzdWC+zGjpZE"
+    "ExnwDyeKLGv1v2W9LRrjLs+oEVszjZMCs9V2rO4S4isTu8XIct+cwI1NI8Jbounel5FmgrB07BkUI6oyVPZ1TsPsEpjj"
+    "DeVJ5VvzdyRZed5MCb40nHM1gvP3vpwi2asQy6IqZhgaiwzTvFQM/s+NhxPqC9gDKFf6Ock3nFNV6+/y20Vt9wtDmf44"
+    "mRXI6pc+20LWPVSBKT+DZO+9SQxEZe6HJBj5WX+hEiw/6wPrjkq4sGg4iOKul4QCdXcHQIxrSFpV5Yf2NXmYZjbxpGa+"
+    "J9y1udtNUe57yBQR3mcEQkGrYCm6XZBS/tqkKU+UKCGou77iKmqmFGoyEDs4wXUQgsRKhWmC5f1c0My9S4/uemIVuUpZ"
+    "BiIWNbDnlW3j9Sw440Gql4n1vXralIHtQa1RpLER3UtYS1AwGAuscbHVpfcMmJ4TDZEZM0w34dl5X+NNGLq2edqLyVTl"
+    "NO4e7EbbBMJsqo5EZuARl71it9pOHJgWQOQchl5HHEvkgiqY5znSzRD4xcHB7RrZ8hZcMGY45j0HitnyyVJNnZ2bB/7Z"
+    "xrSdO8QLvq23NiR9LdO8nHDsWeGzjpsZ2hRgQtCcQYaq8IWJ9k3JERvYJuLcr4gbkhrAM59o8GQDWLpJ1GkrVxhjvHPI"
+    "I3VKHQ1RqK9xrN2AwBBVRFRNCGQm/ct+OqLwX8nzXwFq8oKg+C2067MdP29jCJ/gvQSLMqX5Y/EuNjT0J/yz5y4hOESq"
+    "QLWDKgVccywpK7jPmWAujWWNuwolfUCXILBvR0IiKyTJ9uswjcRyG8ory5f/E/m/LCIVOQ7MErL+Zx2MW+dNVQqFNybU"
+    "+2fTFti7TsNRBjYjLWTwLDTJOdNyjepWHCtrFxb+sYXlp2j7HWtdtya3kMG9SJO1xFsbzQ+uUJNs6p+ILfJfuBygCg65"
+    "qlNqX+1vpDLg8ykgCW+y54H3afwxjD8ydFjaC6O+h224os8r93MSkUCnAWXJHZW82yCBpdenRV30OaBLevGEfQtGfxOe"
+    "qTMVsOe7C7r2sXX/BRr3rpy4p2vcg9EVzMWDGN5wEBzT01VN4K31zfOd4bsm3j7z7ciYtjIFFqSq1qyfaisQZVydD9SJ"
+    "pexAEIAszvuq5mCIsOFUdJJcVgg+a74vTaKd67JXFkX0qA74wWXhetOKbCSt7x3zrRE/5r3eR60syISO6xkojGpRNZ23"
+    "C6SYv9/0K2WIsW+i3Afm3F2TbOUvy9hsBgSr1rF9cVCa3/gqZDgDgKt+DlJkdtIyun0UR4cNfyg/hUL/8UTxTjwHu4yI"
+    "jHGQtsdm0LObQ3FkdNUGglWb7IwZxNW7HtaAy0GRs7nVmyxQQIuNmHPjaeEZD4q485BCCt68vNDAfELC4mlSkCaClwWu"
+    "pG3aEumz67r3nei6JiRRKavwYCtoQYaYMGmVStAhqyb5vf4jtLF8AZDAaZTpJmXpqI0mZUXp0egT1ewwqxPNLhewYBQY"
+    "BcG8sdsF2Xp7mzWgOGJCQgHOSbEPKtQdoA6g1D6rxYW2BMmD9cRQRH2CIr6n7CaUl1n1OHdI2mOU5wgMSE6mxlCNlExn"
+    "G6a7QkM1k2drRW8EIEMMe0TH81KxOd6MIp3MNkbOeMWwNCr/A2jWx6+iDK/ix9MXRGOmPMO99MCRMU5p0EaOjj0yIuMp"
+    "+/zinQWlfHWKxETzRSVn8qrWBYO8BQuoZKmIuyJzs5eUzPuioevNCeKwG4Ys4y7MPWESPlnqnUXE4ShIyPTeYSr2Dqvs"
+    "BUZ++olGrSh8dkD7lXTIJHBhwnS+XIrL781ec1nzN1r+vk79w1HymPuqNz5YdDniA/H4rl82bN2DxQY2vjTGorgNCCSl"
+    "FrmifIQfnezUOCq1hy29p54j2CT6ekscBKIZmJsXMOegb7NDwEBeJ3l6CGNOemEUIT+1ngGnbMTs9Xc/rEU9pwd8Zifr"
+    "KnFu9TioMHSu/ocGOqwHq53TTb8K7EuysOi2XXUHffoN7yy1RvPZBvgO3CC0EaeSCf9vyAZTUGF51Hx59QY6MUphiBHv"
+    "3kexCedilPW7ETK9dSdctwnKstJioVfV5KpZpc5D5h3hDsZLf3nMbOoWYMOFNFcuMb6X9WC+tB59nJq2khlRQ1Q45A70"
+    "xg4X1uwrsTZebcckBPvryao3u1Quk5I10+EjPqZZMsRBmtBN/M0FdRj6QHR9lVRj1IPXI6I/CvHMiTbzo9dlGDhA94f9"
+    "gBFW0NKA8RGavBoXGGz1RRY/GXgUeqefeef3q/wpuRhUzSm1H5uVfD79xGUvN8DlV4naA/PLiHpaZ3z5pFnDIgR0mhaw"
+    "SGigFkI/z7z1NF9bWB0W83DA7CAKno2tldvKDDAzMrHTA4eXk9UKidmrJZWVg5UU9xmGbK1kHgaTSPaSi1lH2tGLUNDQ"
+    "2UifNDtapiSWw24vJhSV/QbeCaNk7S6W1Wql/Ajaav192hDGrz+R2+Ft/c7OlzT4FuZUeqG16FYAFzZDd8oGDjE5YFVR"
+    "AdaiLF2FVFivJq/2Ir7LHT8BlS1dzA8pPpJVmMfO7NRTQv1CltSCD4HE3SHl/V/7dz5U3/Bp2/oWqq4J29hfwpZgYkIi"
+    "K2+l7FhsU1V/27tDwt43Y4zhhyUudh/qmKJjyF2IAgKBgeR8YIpiTvm4ybmvJjptCu701lkoyxwnKakOjAbMmsK0iaWL"
+    "5j6QKkHb9nzpjyucTI76O5N/6GGDogScANo/Pm/XvBTtx6YlY6Dgo6Z/euiKuFxjA9UK1zx9dUyyJZb+ZGtdMGgDfF2u"
+    "sYpkc2lJoV0QbUx0bDRlQ4EiItoDYNpFbEwwafsZbNdN53XuBWkdEEgc1udcFVg0fOY5/wJxAk2dq0rYgo0pcpCcWRb+"
+    "kTiqQ8iv7Tb0/NiKTfleGzOZI4wQzfE829silaXc+DLlfwdigylT+fwjAb2uglJjQZNQgTDeWABZYKdaie26v2Rpcueq"
+    "GWAhc3yNu02AiVsh0bdfSdLH0De/5vphudY9vR6iqYObGUtKstwua+Dj6VqJ3i3xJNv2R4FrSIGoGSHZp6D50wHnv9JQ"
+    "1uLvvhBMEh1Jtw23RgTB11awGd0YmaGC7ttqq53nRnNTKGWKoPeoMtgqA0lVAVad1AFprF9hQ/cXqK6ljJRmrUSsA+sM"
+    "JYMk2tA5+Mebc/eRQYKPabXm1dxEd4EaYenR5cexqI7uMhxiTODQGqfI+19MSqxAOIQu/sCu/0oLn4Bt1ditAJCnRMtE"
+    "xwxP12H03xo8mT1HIOk7FGE+tjFJEqVGlLrVhuCYt+OsfDoWYV4mM0zjP5hwOdy3YC2VfNpaeSk9yz8QV1UFg7ol0g/3"
+    "E8U9A63jkUD893A5TgVmpMElh7dlnbs822quE9S2z0ziwWAqyh1KJOHKeVCfzAQJp38ZXh8ICKIPC2JMGURk5HuI0d45"
+    "QMPL0OOvuFW1rFyH2EejKhP/dSiULIdUovX2mKqta3vf4TXwAnfBf/SNmYnNLTZRJN3pA4SXstA/je8qf+qKY/UPCmN1"
+    "+ueo6clMxyeCJyn/CtlgjNPmb5brRw8CY01pyVRCtg/5Ad2GTmNEh5C5mgKSjKYcgCZfj+/wkIdubKG7kTggvKUPEHz0"
+    "TKWwG/w80hNujAzT98JEmJPuVx8Mq5+4lMwa0qa9JxMH7AVxa1op/T2Fe4KWxe/bIXJuaiPFr/TzB98f/aArPDrf7/Z+"
+    "+iEh0864RDJrsfFZ2c5GB6V1FEPX+Coab6RHC/aRFqkVMjHlOy1PvD4wl1av2XeDosOMuT/tcdc7NEbxIqMsrRK1QOy8"
+    "q/qZOVXEbwmRqAaroXqB3++JmROyP9Gkp92rofnIF/2T1gO1Wj0kfKJbjMgFYPvX1nl7li7QNgYt35fxDx8IzbC7qdwE"
+    "FUJ6qbVHBSaBu3OJNdc4iK2c1IiAh8x0D9gJRXXKUNbBPwYBG/m3biDQfUC/7R3l3drgOw35NrQvhX+l71q+pNUKHRBy"
+    "KS9EPNIcdzC4LH4jGaU1k8EXVN4kFKK2+69CZYOuCv1ShO/kPlnXDXiVB840SPSyTYLaExDH2xOBQ14vnJ2Sex3S83Lr"
+    "7c5eylu3siA7DnAQP/CxluVFkwWVgMOKmIMzTSZxDV9+uNjvHqwcFpWcJmbjm0u/Sdr9a4Jwv0LiFyjZEvJBn/38dIux"
+    "d6Uhi6bRfWkfLhHPVFYR9YOiLAmfUhJFwXSAI0MwJ+A5d9ODqPiBS0zMioVacyIiyvuD7pHLTd3oJ/W0UOAb90Z5+RmL"
+    "RQstBuWEg3xuarfwh5ExC3GtoJKpcqlQ2nvLe6PqZ2/z2vc7F8PQeVvoR6GE9UCK6fOU5NCkpVkOSmHiV1W9zDzTT4w5"
+    "M5eeRKflGMc0Up6F69uSHawXF+oaGxGaWRjHKwksQsnLA7g/bOrEs/aezAIumqJ47bWUbLbWNa2CuEGbp6T5CT9Opq+C"
+    "svmlGVGvbgAu4BxhircPRryrQZPrQ62L5xvo3aXV5ndxjd8PKrhMHowElNyWyfiGpPgFco14ja3z48hc40AVjXztzKgm"
+    "jde95Z9qZ2AX1FDTjfegb0QnH3tHPgXdUC/QwJlXWGfNl1oqskq0WcnlKtnlhuC/JsySJ29K+MJXKoXcg9+f1ItG/FZH"
+    "VX5dtqPPHifVGyqecoXhe30uN+CzhV3U6YdfANU7jYbqOF+DXcB3KLAen83iiPAyoPDtDzCXjdrli9UE5tnCaN2QQuN6"
+    "KkehZMKBBkHnBXvEIGT9lbWP6lN28a/aqzBq+xexeGeiipHGRZCD25egST0ufKdz6gc+dbpZP76WgVHbOlHwvG3YoBtr"
+    "7uoqAfrDlHD1Q/XvggnYG3N+QKPyTjWJLIp5sbJZPV6MrMyN8Olw3NmJAnt1lwVdVS94NijjzglJ7h0GcfO5U6PWbG1C"
+    "7z9OPcB60FMuI2q9+7ifH6WR2IEqusL0d2knMzlhqyh/+cP6jV+3tBKRUZbonpGNKN1DJDdEmbBLkKRXrmiJcLVppdF4"
+    "9hFvhIzK4Z3sFS+8rQt1ita6N2ea4OQZaOVUdoIUflViWObV2buKfqNNxAvmfSsnMWH3jEakleDB7w37m8B0c16nxt3J"
+    "jRlw0TjsuFq9HWKIE3GYYDFo/ujg1jxpMSO6loIsZryVR6es0TpnWWqaH4U/a6WkwhZyNg8/khL52t0V8MmNU7YQ+XXg"
+    "omxt727lCynwH/8Agd98WjVApJt/LSdWJTZwyFAAMJggCm62b4woyvwsLbK+ndsKcXuxTnLvjfdGpbSLdLrbw+L4eK+G"
+    "mxppIjY1fZgK8FaQRhR48vcio0cEdGaxuJtfrw5O6bbgCtIXBL24UxAjfDnJA3GO9D3luIHgNI+GDL8fHHu3AqRp40E1"
+    "/H5FDBsv3ze9Qf9iReoQOD2MAztXPMdFSI+T4dLgdfc6EyJvJXQLci3JbBYifXnmL8PJY/ERZOq35FOkRj+rz3clNOjd"
+    "E3s6dbbsrMO3gJK1nDYvsJt4dk52AoCHhlUq08+pf5S0PhaeSVRhcxK9fBQuKmiHdE6yci1ECDldvhmm3QrGCrfvDcYO"
+    "8+SbXnYdq9w1VaXqiLuh2L/3ivBblUi0JTFR9mQ5xOPy7Y8Hf0NUY0g+ujSvX204eusGv16pgew0tYGcVhCo5rwQvUPM"
+    "utu6GZGwCPB/c05zE7JWJNk7qI1QeVG5NZPh5jOL3x/cI03epi58GpYffpojVwyg3SmFqnX6pxf8NL3CS4Ed8aFSe7A6"
+    "Nu/aX5rycpP4ZppYTZoMQt+MZjLlBV8JWQ5aDaWDtEEOi0st6sNN/XVTjVkKbd4MQB6vnJ399boYH628CCTsV7MRdLvu"
+    "L/qAwhCSX6zDzDZ40fDRKeEWAx1bZj62AZ2oRYOvI50EYX18dNBtlpr/nb566gfVr39GPRtyg+wFfEqeCsohbLwTBrly"
+    "s+goiFJCJ1ZzqfwlB1xnP0+SYmJT1/vRJE6YvN9MTu/VA7Y4XHIijvdYvJYQddWkT9xK4Xo1G6ciiPqB8sHy5pqeEN62"
+    "jLqfBMWN2h+Z/QOIpkmbUhO3bRRbO1ipA8sPh1Yh+MEe5HeAleq3gnVEQHliRtzYS12gh37zdKo2jubKuZlmxUL+gruN"
+    "1uu5/YZ6OPYHi3cjYgZZ2BwHpNAaIcfUmzcqszvbhFejx3Sv0vUyAf5MI8hC51MPcbctWqZaM5ElLBp340uCVvr1RiUa"
+    "QwvInvKGaGOSut10HaVAdzFyv+rMDPRfz+f8smMiMroFVWJLnB3T11WXR9LLHVlB5IoQd7JXkyCDbeAP6ORESSqdTbN2",
+    "znr9OUoAjV/9hUklz+fmZjcThFYZP0BVwz5C16HVYiec16kszNc1ct0ii1871A0ec6a3DAPXixl9uSGvR7ogklN+cpqw"
+    "azqAnF5vcXO8qo5NnrOpu1IiscuQrTGbxEo3x2ahPrG+6oIVUv7+1yrvoIaLHJZMGHM2kunba0ipYfUraiMe4kfz9Iy5"
+    "srcJGl0M4aPu9HPy0zhtJ1jsNF7yjcX/eYcy7UJNJDvl9EOTIsU11LQLStMbpCUny9xYzpiWeyr6V3RB3UImfRMesIyd"
+    "zTkVZVBiReVCV4x1Z/pzV1SduwGAOLI/UuzFEvSzZDX10kphVB81nw3BN/FLP0UflmI1Zj9tDbvd+5Fty50E37rawzbK"
+    "R5uUIDe2kJjcPov0AMOXgs3UuTO96BGFi82o2CbavP0ccWuhfrC7kPgu0Mh/2xBrDJ6KFDgNn3zPX8IeKDWJWjfzyYRW"
+    "ALkq8PNOBnLDq6nlcgMb13CJodFg8VCGVcDqPI4BayYycSBEbW4k7DfIpdaHVjezFG44edmkJpw9I8enjiEMItQxWgxB"
+    "dUkgyoNqIqYunzvQVKux+OdZ5274Hgrx7P7pvTJsr2fe2rEqlq15ZUpKYw7kHwoyNNpmMlW67aR7gVj9oMQ8ruUnnnqN"
+    "LfX9mn8eykzkpDiYN9ywbAiu5lG7EYRsK+zsBPZd8R340oFr1x7kFaTCjS1O3kjhg9AZasVXvNl5eQEzLYGtyThAKp2M"
+    "UeloRtTb1zI1hWT/6P1XfgatiKHvmqF0rhyv9TJo4eCVX0yYGMRrpKkPLVYKZa5cmX0uRFG0VkCYY7xrPRy+RJAiPR/2"
+    "F5QwoXeRn58izJy9RU0aO0gxfb9eBr4GUZG8bBkpudYrOeBMizwxuxW/nx+nfob9XWPmN8NghrAwuf2JN2Nnya0o9W/R"
+    "GF8J2/nuFEqsom/HBAPbDIOM/bIj5q1Pg9qtqKlhz7auqor/qC3zGLjIsCrtXyZjbzg0kpaqiCo7omQJOaDmrd8DYRUU"
+    "E6KQ1wcBL8VWe4VMPq+Z1OObBRd7DV6fEwIXMrfLVPdxnmzBz+a/yaq1LUGHO16lyLL54YM/Ok1OcReOYHEVMlBAMzxL"
+    "KKpCUznuLbYzgZaxQDMJNAsiBWIJyvefEk1U+qpNEgtuZLkSrYYqloQE3FzhxxQ5j6qW4cG6Ivf3Ym22P1Q9Wd5xU1Cf"
+    "WdaxRTVByun71c/FmthS5dbn2hUYf6oIcsrmDTVGVrOYMXauf8RQTAUKooFAkppMa6LBcOaoKGaISNZEzCVOpZyNierg"
+    "hGSYHlOwgpdgmETEuIiYkjo6iuKia/7jKgVR3elmjtCaI8k/JEcaxWeic3VfU5wasuhrxT6hzRRn3yactuiMfVMqKvPD"
+    "nJQJrtO5W6ntkpJNscOWjlv1246mbbY+d0OOppGkDkU0Fk8WfRnv6IE6W8UyGJUzPxMnv2n2M438sOpJwT2NpwBibGwz"
+    "tY2PB8Fpr/zVzH7sh8X5biPOk3iF3GHQTtAodh0TrcrcB0pmxEH+gKenQm7RyV/IdXHm5FK3/JNB1LsHjw3gZDuF5Yun"
+    "nVQdJy3ElyBpt3Gtp/GH3r4VCT6IT4rXanbm9LdCF+i9xuL5h+UAWsG7DTt+Hdnsv1LKXOiVCumkSvCppZjd7DoBd1vV"
+    "onrEpAG8iLMav8ijvLPpT2HEOp0XvMTJ/QGpajfj4MvQalrzHumIHlGd6cAbxeJqpdyE1Y1aLxsfNp3jaunsFyYX4KDQ"
+    "zLKdJl9bqmVL2xnJ7bizRuW/ornSd4yVzXmbVFxgnvoi/3rFq9sjWkshTy5GcYMsXiQNwMsL2LwAW8CIIdDdAXftRm+Z"
+    "G4h3b9msABdU0MrmQQN48lxsxEXi0VUXNUlSk6+7IPJWF/A94lwdcgVmcacoratut/5UC1lJq0zZZsZMq+5cI8ihPppa"
+    "4Bi3oIfU1Zd8yp+4530pV20ys9RCyuXfIBVkfdO8jGrG4k5o+GTkJQ4w/U0Zo1ZOQrPe30qFu/L59N4A1vVS6JvBwYOA"
+    "yRi3F6XqXjMvBxMFZl4rLWCbJwMtp1pxUe7enb1i1iPIUsqbGB3eUfiwdW7+0V7uwtk3HdZBwgb98fWL5Nlknz2rR3tP"
+    "5VMhHYX01GJw7vDdaD/Rs1psl0U2fdcuXbRWK9CzndZmEy0t6PZV4kboRVzCKNj+vYBKQWSt73FRcWG3edp1kzBB9CgX"
+    "4mZgQHmtAz6iBu2ZGetsv1KtMDN/6W+Uk6xojMcGtw+wTkyjxs7sluBTr5kOXG+MXaGLw/heSngF0hyzTXyUx1EFg3M6"
+    "sFMUMPvKVCSOZZSK3Ab5xYfgnrhowHqh1rfTlUr6xzp0shLxL/ZySK/KNzs8Pfy6UtBB/4va1vhkY/tdmB1AzgBfFj2+"
+    "3GA6oFVph/7oLJUSFdvFrbs1QIGyFrY9E1M8iJjcYRKymbOJ3YaeHJN5Xmot4zNmHhuxPvrzSbDbprGZjMgXLMThitsD"
+    "V5Y9f+utvb91+SLqxYc1c6/wJd2A10BXxevo7vOCUJx9S1LvO/+XMIacEb7aQBx89cnqpNpvEXe8wSc1tZn7d9WtktRA"
+    "2k4UWBhbq/4MV++btfGj+axZA7wcAJt7Yym6FzGqowaGBaKrwDr+UtKRSuj2zN9qmbGlByvOtUdt54cccce4841+Qr3V"
+    "qPNitRhKxengFy0u3dqpr5HqNytHzjrLuSXHGIQY4MUpGvEQQlpvE4x+YdR+Jvg2qYCrY5aeLK2R/6ARdYX+YmdVqcM6"
+    "XLlnsAUQ/m+XrL4OxBkrUqUvlFQGJOBm4A0ieMTerhamkd+RVC20yv6hyylcQMJTOvCK6mjN0uLGpA9Jqj3GLVo9tQjm"
+    "U6K61Rc+8tZXZyqIU1cyAnKnMYcBX7j131HpG4169PHguW7cWsJ3yMDiUaly38lRi/zQZzYeHzbLpPP1O4LdGlvTxC96"
+    "gtOgLgzV8+lnMvqfKJx+g1hB/WQ5v2VdqJ3UFKOcvGGilYfsOr+yhUrrlMfIJnJrMbWGG4I69S68J1iTk+Iy+VeY79N+"
+    "+DLFwhpKq8iUAUcRv1SJ3Fb41MXiuWHAVtzjVxqZ7Dbjo0uE2Jywwy9+842AYuBG2Mz09LvvDcFmDbdJN0pYNa85ej9X"
+    "AaQDYI+5wmUYAKS53hHHX/LZWDNwd0T0iDArnUZE+FlC/9h5q9xBleJWryX63lH8Qg0knSiGW7OowmLUmmoHcWXRMMT1"
+    "O4ASY3fmU6nJshMnq3R1x5Mb/aYspEYQreDLB30MaCXzqtosYWn2R291av+iggHlEXNxCL7BNR1z1sJtRLL07i+0vrT9"
+    "p1UE0K9XMzI0UP000o3BFqMPsbiUqQ3mEyYpv+dnCD18uge5x1ubqyQuMeqMPTw9AaYs4xag0sOh8Uz8xk7PSw8j6u7L"
+    "QDB9tcJmPgpZrtAFPQpgNapE3bzYbnOwvgebzZspevHdeFZfm3oEKzj6h7OmvHNKStbJhyOs/hV/qTsTRxpzd/wJI/M9"
+    "DxK/NaC4kKwgm/ihMQg/cL7SA5i0F388VNLAbPhtil6+y26wOj+Z9ftYVPKulpLRRPcInzMCPzl8z2BSD3YnOTMAVXC4"
+    "WEVyuBvdQbUzRo/Vh/PJx6g+yAMAv4a3xbxbX+sDKi1uQ0HfAte0ziuCSFyVuAQ6vSCtbmFi3aqHJgceQarGGyzPj0hJ"
+    "DWBAeYLsVPviPA4DxnDiHxilM5TDHvdCdTuo/c3Wk/NynFEAF4/6OKM8Ky0tbvxuPGCfVzLxQIcN+NWFT14M6UeUS1xn"
+    "godtdlJgp1RQIw4aPHJoFkTn6rWSRVr0bZzD2eN8Weuk4S9S+Obovz0w9q1egTVQ+YbGzbgIGkdU4ooGfEGj6qFq1+v0"
+    "fltiJJXhe0QtOsyKGcH+AufHcZit8Eq3z2/PInJO827Ev/EW7x18Kyn5+UHyJg+2EgesdhQzt8Y4hTiKw7sANHReEAnR"
+    "Q7pzTebTsTMtfMSxRzMURBbclpmO1F9gnkdvD7qGde9GgFZjf8ck/xSW/r4kyxzOopvhrwNtWWUqbWFNZPEGRBCDzpVI"
+    "BjngK86qbYJL8sPM+6FESM4T//b2v1TSYrPTl8Z7jFGitxqJWMy5XeDCwrRflLf3z34AgiZdiD7OxkIKwOmV+L8BFpNv"
+    "dqvEnvQ/ronzux9riXVaY6Wn3BSFqkYAbOobhCl+716QvmdKYk9k0Yz0RiXuLAkNF0ps7myUBUpho2KM9JHB1s4xiSHM"
+    "dY3BkP4r5rfh1C3wh1zouDPioJZEC0WVKyMcbO6YadkQJdEjj42ri73v8crmg7YXSNItJUly8Cnq+dX4xVKc01OTA9f0"
+    "67uC5O3OvyfmFlLExt9zw2Cc7j57HpqLnFVR2WObVgoH4VPElPiy2Vw9Bh8694y1LYOAGH1GiXirDW5CAwWVzrN2wmnJ"
+    "9MwwpRPJICtIcFCybK29325+1nyNrfMrNYCqpFVr5vQe4fiNuBvn6Ev6dFAdPl9QD/3KydoQhQVk33zLG5eeRwZ8MHeF"
+    "SUbumqiEMJlPzYgE7QSgm8hb6VdUM4j3RkeHHGbW6f+/KXWouBbPq+tb9Db/cRGW0WcZkrx90eFsxyDmT7Mv6gK1XvaG"
+    "S3pq+foW52T+zlA5oYLRt5XTOni1HSrzDTsrKqzNEn3XDWGxTb7mZHxalyEsavZxyJJGgkGIT7PElS59S3zoydWhG0Ot"
+    "2Dh/c+NXrqBhsWk7ISonh9+6nYTVLSPvtHOlTv3Dm1vrUau0Xn9j6pkP9TI0pMs3Vam/93R8rxU6+zzkvJ1JZ81sZeNn"
+    "d/f36Bu3C6sPup5fFGmrKEZr/Rb1YMsN/XRvYe6WeK3xttIp6Hlz2MhR3Owr59HUtyKYvs5RxdGjtNRwjGaHkxeDCRkT"
+    "vUKE/Ch4+9u8viiARTPKJhOx+ziedZg1dRYzdzjXrTLzQw9cRpt01IkUQGt0kkh4MSLbhe5b+J3fLDfIfVJ+0b1DP6oH"
+    "MHUZ/fotrMWOmrVyWCb2s4hnjRkFV4Z2Orz7Tmq8pGQGkwu0g62RlYlr5UnutBnsVlKHBXRx/YwcYLepNncTJ885yyrZ"
+    "azeOHc06Jy5vNSNu2NVODyKjCmISIweGYAcpoAynYmLqfd8KvvFqx/RnB8yH6VzVEq5b4YdkzxHO8arGZ/KHqNBGaKCj"
+    "chN+5wWdbPQWAwijKw1GCpCbFgp/djJbMnNVIV+3TgqEXnapFeqKBB1a0j2/OvGz+oslxzM06tvPE3KF2hcne00skHcs"
+    "v50+kucgn+r1KtBhEqEb7boVIPyodHRiSoJKx9lBldLFM89A4xELKUc2sn9MAjN5a8v7DYpTwUoNauMpr+F9sEVTK5sb"
+    "b/CejBrjUMH3hd7AdnQ0gfZ+CkEvS/BTrJh511Hp/7GYzla3sTRWF1Y+CIOv4dkJgkY8Tz4gphNXJ96Jau3vgA8LdAam"
+    "3gHf8Lb2Z9EP741RHexF0Q6fwRYWFnd+DC8rvesIHZUOSw9SexTqhe3AFoybXenogeOev8fI4dM+NdIys+CaU9owoF70"
+    "mDBbAssC33oJ9qz7xWGCrTxZZKxeZu49z8nB+lgQvSXCsPN/C4qhRQGiuPsiyuXEPyGTQ/5cHtI23slJozsUIJbHrEQ4"
+    "wCYznupp7aCqPDycpLmv0oGRS4GffZX26kA2SgR9x2ODnsJ60EUJjp4c4PqZEIySEqdbEztaqJFddre+nn517geH3L+7"
+    "XhFUFsqHZavfhObTG0nYaWISnTq98sjRnWk0k5fHJAYvA4uzw5skr07MQ4rmu+Xhd+ImK3ydwnMvI7JioqC2QoqmjnYf"
+    "AJZA8+WjnnyaM0sQvgdEa8uZe6RHLRvjR224XSJSpTCs0tOhJQGIsP5BaepOB44j1Gpr77S8GZ7s8ar7V9SjqPF0Bz3o"
+    "iD9zRoTAo9XAUk8KAG6Bb2HttjR8k/SYpEIyaOXY8Y/Vb+63SZoPq9zTyp2tvq/AweXqrINx4Fh8Xory3qju6lBaUbkp"
+    "YaeNlzkrGx5xWZXZ5NLu2fwYp3kT2Y1JzKBebDVmMC0zSwO9gLM0IGDiscfVTmySg6WoPvCW6gNSRp/YPUxQDIaDPPoL"
+    "JeqhcptKUfrsI0CrvPEuxvP3oMuSlElp5tdLd9skNGpxf1BzO7YlMsF8JMx0Ue/DR3Z2/hUMKLKTNldiKb/v+En17ywo"
+    "KmefYT/720MjazX2khtuaKKvw6Q+4bKDDm1HuUd6X1bJ5Fyu/YGIiV7j4WbP5NFJUnq6joXMBxG/oXT8O3tiv3Nblc6q"
+    "l8J4AtFk+x9vLuTM4kKrVOBT6CuG6tna2rsHV7uMRdiFXnyzm17B8LCVTnQ0A2PipBD+/OL6wrbVfBVmjbPHahdFn2Cb"
+    "/klOrWS/N6X/df9rf93ec/0vrURTxNJ56OrDLkUeekiZZOL+gjzcogpIlKBibsZc86VNF+70jIX6df3Iz/e2lAgsQPpQ"
+    "3vrEhhtGzPH4gt42CyzTN8NeMy15EZ4p9vLKxFzTmm/uhCnKvSBgRhbKQt1a6TYbJihxHkTgFuE5w30UO+KEh/wQT7FR"
+    "ID5yJXNOigwDJhoJJ6Sr1cTVfW58AReQ4cQ9ElXCZrlitriqznQSm5wjTz/gRONp6Ts4Ltdi3H093yvqG/etkn+dReyZ"
+    "YsN4Z10Xn6JU7RRrKocp0SzBzPiwj6c551/ceYOeZeM53uDCKFRhd+n5zHLxQY/7sO8pQEQ1IU4pTpXVFIsmhwBFkZAR"
+    "elTfkX7oLCOFizUM6GpjG4788HN+0Wuiljq1uwFsEBR2pN261r4Pcc1l9ynhwnFi3X6MxCLU6ET1bLLAKLua5W/A9M2j"
+    "YedXUSzybPHhZpScQftNgGr35Mn+S8GY7Nt1AwrUiezwMC+XeByCHNHipRyqwgt3XUVlc30ZgNs0B7sKznVHedzPf7zw"
+    "3Ja7ntw8v1GqehLDUsCJolX+P+LMWUsUBQFgY9u2bdu2bd2xbdu2bdu2bdvG7l+8Nl3KnNhbK9LLDiTCBvavgt46mPTR"
+    "X4PZAf8jyQ/iw8Ba1heVAIcwyraPp3ZxvKaM2/j+hEJqfE0DprDJpDSwrPSWK/fxsZrh+K0Q7G4zj0uAMqZYbcA533pk"
+    "DkA0L+ICeY6lpmg3E64nFmumI9G3C+oCo9GbrJMMUPM/pGsrI6PFOo3p8C6oLE0Zpe/RSlJ3L1LWAbJiOPpVQDTlYZh0"
+    "aTAM1QDpcuPOJix1f26hTN7c0WqSCZX/AUMPuAAknWifjXrznH9qVdCTXguh1YuLD/Uw1jdubX1uY+6jQi6fhEM2Ox14"
+    "ZFvGH3UPd/5wfOYUARqG8qrtAHzXVzjnFoLbMzD4QLuDdwZ5NhN8aWA8kepumhSnBGv/Nhgobr4i5zBT0dw46bLubuMe"
+    "XOsAwvEkOgDElMTb7gGNg3qc6nOet2uRMyx71PHz4KoHwJDq4vfqKCcCFOuNEeV4XI+nSLzo0jmVMnfNbv2wb+SO5W3J"
+    "lkY6/6L+rm6/kpZE9MqdVg9Lwk/u5LkUDEgxguuk6QB+gj49hh7fYX5l6GllV8AamuE/3xXir6O3EIN5vaxZnEmOJEbZ"
+    "BU/oNng7/0EEeynfvtl7W4PPwOiVzeR83WPC9hNQRvbmVa6HWu0x1ISgDQRQ0DlU1iOrPcuUurehaUsniGkTm/52VUQp"
+    "c/C0nePNXVUA/kc2qE8WCU8KLjkdL3c2jy/sDhTX6zfXTRGp4EqMRjbysFvKdO7GPtNqxdCLLhM0GWNtsiuFGOKmct63"
+    "Lri7aESuMF30xrvGiI7NKRSJFnK6j5kMLs8sMKWgZUEq9VdxDBBBZNbOhP866HbOthDsDtlIkfPXTzOfQj58YCK11ai0"
+    "GhBjpeRRCZuQLmangKPX9mjp54LBhd7s9MdxHCJ2JWhCoKBwYB2PdwL6pC5mDVjfic84NTcts20ua+rrfNKcdx0yA9bx"
+    "qtel3qNqCUcKsyom2FpavX0Syz63pMKn1tOrI8w2eWtLjIqhzwj1kRVJR+gS/1kM2bM/iGv0PkFUmcMhVTI31J6cMCl4"
+    "wJcNqAii89z+luNSzGAoBpwi1U6TKAnepGqil5dkAqa8yhxw/AZYDzbsJ7rcgjBgnV/tlXE8TETDvb+U4GhrzkI/ENOo"
+    "z+iZNnat1KTQ3SJONNO1cpgakjw/OLqpa99K+z19BEw3rHu4ezOvZskd7e8mxULMVkgJtwzpRS1daICsSnmNkOcDVvko"
+    "6P4U91CJUw/l/O9v8XLfJgeE6GHKkh6wWP6s8l1fejLbLLSPSOVviJHNgBEppegrNJe43hBHfaZ+nr5wSSJusIS5gXCz"
+    "COJT6/lFhGxBvnBb45w4tl7jTmA4ZoyOQfnulm1JJr7zZGE+WcWrJp9ReHw2QHOtIf2xAr0JZSZoZ7L8mJ3Ek9JPGAPO"
+    "7LjoSrM2VU2nNoViPle7refEdtE3zEo/4rtjD2L8VppzXhpuTJGEZTccuLDOwDT4PES4vm9R00GJn81aqu3YkcQMa6rq"
+    "BKFxUspnsvgDW+y8cKTjsEpQHA7smztQoCAKIlHKEplrgOWRAdfgH3u7CKQJVKY6Lj+aEpYllS0NNCXqPMtz5A6gG9sg"
+    "QH/6j7GW/wfe3pklsAhqwb7ImhloJySYLNBiITX/xOZsqc8rVDq0gQ+krUlinfq+rZr5Qu2MzWHl09aQgQbJsgv+oNJa"
+    "jP1pgk3txIMsfwpY/fURhRC8D5gtmMMQZ9q0EB66aZH2sFDDPhruCvZq2ptwJoTisY4NtF1arLNMdlkDfiNIscHzJHEF"
+    "F9XTxk457xKPPDHUr1PNmAt5FXv2GNry7tTamO+6Fq0/v2AsZqzPAe6txyzHbyl6tE8g0zvQKDrvsqtxwitY79z7YkwO"
+    "1nLIbiYigHWrsMM0HA98+hHgjCmdma6wrlGIKsF7BwZZJHf9iCt3jsGokf3LgrRuaKA30+mBNqWakFOqay0nnTnK4YB5"
+    "OeIShtwJlth7Dx+5Ors0M3B+/UQ6PayEiL8Mv9gqII4D54WSPSIKfVKoQi5PPr0UEayumTOHFkiXyX2nW/rPwDvg63N7"
+    "sCnjE9Uxx0aSTtkZ1r6YWgnbm35u59J6bZsCr9rq1F10yTxTHgmM/NGKcqEhHlov1s+R43uBWDvbq4LdB11QcAxgmJnK"
+    "wGaSCBUa58PO7kUXvL90RJdJQIQMiRLF53k2s04Eu1X2fHcmr6LUkpmqMgffYfxKAcDtr/CmPkpjmAJUhUIJbxAGUOXB"
+    "rGbeVt5VpC2brN8PF3LCfQdPO64Vprc1hDbXEgCSmjOPOsebdLbluNL7ORt99/qV7KN95BBqtZC3krbi5niR/FS/lhk0"
+    "hkgiIa2O1Zcrt7th/VqBRGWcRkXBB8ir5zbJPmzwcFFnMHC3yF0pvKjWoSOtB/41TequA5oKnBxhi7vaeXdc2R521dy6"
+    "uIw1vvVB8NOEQg3X+3aqUh/T2cJiXYbKQ3+gqiuU+E7Rl0dPXW+wFYbSuCOBFziMntFCx6/ZNFrBFlpm/VVAaCsEDi9+"
+    "l+dcBJxGZlO5KvVPDtp1+/A5lC36uok/YmgWnlz/LjrktahRggf/VpIa0Cm08GUx3pbxlIWMxHO74YCQEybv0uv4si8x"
+    "rX7RoR/htUEpgea1kiY2Z4X3zJIcgg5QojXmdvZRn65wHJbkKfZSyO8nnqriwbX3zuvQDxmfNuIWYql4u93ykuflANAR"
+    "pj52vVB/rrUCzZZRG968Sk83LBxc6yH5KbMCSNcpJzk5cHimnNracHoSCimgF/y0UPnwLF4aJiH/Tc45Sfk1znjJQp8T"
+    "28Irxp53cvGlhX6evgf3VvPGQDUemwrNDBXfyrL5w9Bfgz6KuODWRGinxjJVRGz+LODP14BQUTwlDDNPCLAUOE6qFU47"
+    "h7UkqrrBZOfLekoegEy0p8yOgMv+L9vZ6Q2+4DGDxO8vy3bs/fLFGrkuiHVjuqstkt0dJ+HRxp9JLZpjo3vhc4R4wx+0"
+    "ymqqnD2NP4/9uE0oOHH2UVW+2yZmNGslBylUOKkGDfirrhPA8KeNEamzFMUOzIz/PxTxtPkRIy6zfaDh6FIqnwQo1L73"
+    "lvilFL0vHKbVchUjlyJNSrgkhIakPunaRBZr/XD8er6KYHpI/J647czA/crE1nXaO5su4rqtDJTKb7pAhmDbq7u5Cmfa"
+    "zYx1syGWcQweCQ7K1PYs1+kyKGg+x+UKlNSLfCPS4K4cvyeeKqIYz74EkKxMRJH19cPkxlKxy+MvOlWw4DqQ+y0p/UOC"
+    "VCA2pubUp3NRXrIwNSLoZFP4NGwNDcfT0U5ld+Zaqj3/ExhZMQit6tflb38ULN8FzoUYRGDKQtBrpxPNcCU2HaTUzbJA"
+    "y36e92tuEk0eQJ1MwV7gyl1WJBdh9wf3mJeydfn9IfZrVQbj77PY5HSScapojUGgRysvUFnjbzxMvKHPjXEs/m241Fn/"
+    "yl+gOYAtrgzY5LyfOW6Bt2X+7ONoMaPl0l8O7kfl3pMl6KcNf3LP6F8tL3fRVK7xyPzLi+cSbfQKj6T5RUZ2S1re/otH"
+    "Nr7p8sxT+nxKks+bYmnFqa1c9NMxnkLgwYTNv+4wvfgUIoL4W5lXEiE1GQyGOKAKsCxsrKzs1xaQAKi/QpA1+00imViw"
+    "RpDp7Tr/MeuSHcA55Ze4yLdgeSLKIaT8eppMq0yMRQGE6lOkVfhBRfD3lNvZfXuWq+qgc+/Z5FhnMLhMslotWRAXpmQV"
+    "6V0HhQCX/aIkAeLZ7AvXqsaHR0gVigsYeOsZhn6GdEcBBg2rXazv5m8xPCFeIcH7lb0dVSDJpw/E8zWtuO/qOxguADos"
+    "MaFpErpLKhgtqdLJ/G6XJ0n4OTd02jPwLZGX4JBoKeXVktvIVxg7DJRYnPHj+HXlUq9D7m7pyQv3wEd+tOdv6Dc2QsCV"
+    "LcyqE6ycUyc+FbjEXSF2nBwM1nYUg0dTlJ/IzF8Frs1imcdoPQWg9uBddw4E+8qM8zwaUxsg1tC3n5Qzw5xdhygcdqSC"
+    "8V6VU6pb22eVWKZXdziCGoNkuEz/2Q8gu0uFW0f95pLsFExwl7ccgL1eUxSU/loa6cyhzwpjWK6JC7cVU+YNzYuZm428"
+    "Vbl3A1IAxfHA+Uy6w33nAKQO314FmFsUAgZgGhyc/MNltNNJEB4zvPVMDIVQgWE0CyoruOPt/gsOwHBcnQsvrblBabYY"
+    "5K0XBvFVt8ILHVwUFSwY7+ZQz9xBvstgsMx4pEghJol3rnQMOX80oEbv7xdwHWVxO1xSrw1ikS0byh5N2qg9+YjpNOch"
+    "CuV8cZ2tWd/jU+tIKy5zhaJAA7Vnk8HsRZv1ajQcrdRNMhkCOg6Z6fRVs+XcTIjtUjM0JiCB0MVUnmkKEDUaKyBHmfvK"
+    "cQa+bnfP7lBHMgrTZQBbqlOrbKsbtTsYi3w0g3GV0xvb/7p/hSRKF0USwfy9O13Hab7LpRL7q92tm2mljkgeGvn5qqY3"
+    "4IOMmRc2KmAWdAiBp5AfYiYOanSVUedOVO+CeE1XtsTJ1yKmIBWJmXnUP/y2XJrgzc0/WHyuIkpcKkCNA4amn8SjXshN"
+    "5+TVa/IwSWdwF4I+xpwIUw5+PuZy4sY0z14kBEjA3C0YSvVWh90newhGWHRnq5Z5DdlvsCkbNIdEUVfyfPrQR5JMz0os"
+    "QcED1jLosyTtFqzgC3XVyQOg5FXAkDtCfggxgbOEM4hlp3pUIY3n+BeUTUmL5Aem1u64fWTVfT64UzGz335houIHMCNx"
+    "Aw4Q6xaE9P9x4jL+sOa1MUOtf7YLqCBUsyAgE0nL5yTk1Zmap+QwK88RB1SgesSERbxzUFnnW0D0VoUmFc+kQfodgSI7"
+    "qOJmIYP76NdA08+BPbw2e/oW+SrqCJ3vwwBQpBYd1JyJK4ZM6UcBrqyIN2yx+hHqwnrtVIR8MFpA+uN7Bh12xeOu9/xm"
+    "+LKlEwC0q1iJ+FYuY3oyVj9psK7M1e1p/sWwIgNDQjymS2E1kxLNddoEaYp/cFbA9zkoc1Lps0B2JLMxCDj/RiaSnVpL"
+    "oXL+1Pmx5jzX/KH+4E61dMTlGDERnTbOiw4TB8YF5DVBpMQajTb7fvgO1OJro4IyOrg4uMCPQHvlqmNowpzIJckN3r/L"
+    "7Rf7yNcpvr0Z3/HmodZIg+hgNa/ebelPHZSsDAADe2EgCp1FncmZSLBZ8aw3zxMJG0bIZsRMNET4MGtCAldRsJMoD54V"
+    "/s2V0JOoYCCwhbAkeUgOIA7FHXMw0kl3dfXZUf7gkjT57t6i0pOrhyrW78k1J4usfwi6OC1EZHC1AtSD8T61qR5VqWd4"
+    "Id/z1ZYLIumWjai6xV7kr4Cg1yD34yhpFSZnbiXk5KjatcXgQ7Mb3ZNyyGKNfWYoSMYr+ovirT1oS15cBInnEsuiYmPa"
+    "McZQXA4asFR6AeY59CW3UlQMIQMSW1Ly5dX6FL0QD6zhaLfCAt0BAErTepz5Hbub2ES87Si6SZuHDXyWO5eqbzFmrXyV"
+    "IbjV/jjZXQxq4RT7g0aIxsEDcMoBKqjpPs91usSixxfoLIC4KECwzMMKa1r+QOsDSmJOoqWvNh8NeIVTIPmHueX85SBS"
+    "Z6No/nvxyWg2m6f5+9LnRRbIKrbo+BemiZ0H2GWH/YBiuVzAkuUuuTCDvZUWAXxzbM8NKlkV0KWbibeyYzkn583yDEvc"
+    "oK2oi9h74HkR8HRsw3RU8TWViNjOgcCpqx1HnNNj2nH56nqpc1hYA7NGTP8TVMFwfcgpLdkj+8I222zuNXVCs1kc4fTl"
+    "NNfAVn/lApp1Z8Fki0tL7SXfEXf/z7KP/LqX1KCFM+XIJk8S7rxY89/TUFPbdYCHIRnDKob42c1R1/WBnJSx/U/xnxlo"
+    "gEPGIhxR44KwH7amcBY/2nHy8HIhL2RB1YB0AgBqsar6gA8I2bXqDzTwux7ZB+PClZkhwD3k3UW/TjyWaNK/lncJ6oAT"
+    "uIHKCimufyx7NCVGFYiy6vlH5+x76H6KtNutzQtVCThdtTU5nKfzg3ATkHZOAeskR4nCZmFcfdDhC6/51nWElGV7QXH5"
+    "FqNiRDxuBfINe3XppEA/WWfEhfEau5IyBHcKQ1E26gQu6eQZba5mybQuEUp/ytxONh+BWhQ1DneBgSphiqwcwtkn4MVF"
+    "MFn1t//a3302XWBBuZlpostSzvDj3P9GnOhlbvdumtai9p1KOvQdt9apbe1GDSht3vibjjE1SawEkACPwFfsDsPoL7HL"
+    "oVfaG/Y7MIii/thzTJkNME3rVH+HxTxmyMgOhEcSrsKzFapSqk0G2/A3Bi6DLdaSBnUt3HyY0sTOH2LHWIjnpHIK99ZV"
+    "AQmNgTYf18JYl5OHnv4orl96hs4BhxUdHIEPT+ZeImTMKoFblnBZCD1SvVXgD1BbbEF6OMEvM8CXIZu5aF38OLUhmfJB"
+    "8Z+IWKac8deLK/zWJsq3FyFXoIKXmoIaaKgy0zQRqhWgnQgE66sXNrew+D0O479dF05nKMmoJXqX4KJMK+CtjU4GFlbH"
+    "afN0AJTlL/qFx0kv0htah/hfxVBcQj5UUZzEHe/7jfA/WHehnA4YfcnBN+/el4wdjrpbDOfFi+LFsKQNxe6yDkhJ2hma"
+    "C2yNlvCN710L4WFX1HJEj3reKUBBc8So/AwZvbGQfUlGQSbejCXpaOGL76ns5N6c2J1+8qNHjAlDZwF/d7dhSwQThh9F"
+    "4VR3UJE1ogMHPgyPCicBTt+hfVbG+y21Ua6r6yBT/TXhpzZy7dJoHSq7F7KZswzDjBcqRchprXEchEE1/HU9XjF27xBd"
+    "WaQAc3j4ZMyj7RW8b8g7k0+QzW4DNZ0XP++SBggTddfrdidAnEYegjRhSE3nSpGaOK9VKpQHoL6bAPgGBDVzeSbAG5CZ"
+    "ri4OzfbftLNl3HgB30flQ5UEPKgRRF6AFYHGf94rDyh/jGGtyveJ80C+NHk67+bulDaS4l0v8hb4TlhuarHCA7ZS3bFZ"
+    "85rR6n0g7KMPAmXMLkKKWFH7dVKBiE9KHnjqEqacyrufvNJdt/7pbKa0VKdjw6SPzEVA4NWFYyI7Kp7jLDfNaAr5y7MA"
+    "SN65LVPiu6I5LcR8G/UF5l7cQcZoDZ8+og7oypY+HwizC0znpTKdKA7JjiNX7ypi0FIOSW8dWFtc1RKxgAcYlTkcSWy9"
+    "7XwHHtXQNbqJOZAubUK30/1zuxPXGEYdyfSXVsC7Ih/v7XJj3M56+56VMQXddGM6tEhyiRquZi0pJ28C8aw7t3eWhwXL"
+    "S4kE8PLCFK47XpAVBpcl6fLLuD7kDQseoRbC95M2eYf3wVykxvw2P09MBdLidICz3lEHKGBHqgzxtN3sEZWDksx2PXD5"
+    "UL0ejtey+qAsIlcLWjNJ12c+nJE+rR5ijIQ1vYwv8JD3t2mc2HzIUr2v5b+SY61ioT+BSyaWD6NOF7i9kd5M1tmfLlga"
+    "FdI2sMnCMXZXSPisnCBW6GlNi6MtGpfoiAuEaGBWfsrWjvk7hjXVRFypdHKwac1B3r0asrkO0yW3SlIpnBrpn1IZyKLM"
+    "roDlNLmqe493ymZboTQmdx91TgugSGoXtA5MaNmK5HuiJ7paPQHG864BtHY6RADm9RCF29TN2Fo8BZBm1WVAKbsJyWFB"
+    "zJYAfLoJCgLLEd5MzSPNW0rrbc6U6NBvzWY0kGWvHvzQTX8TJ0NvIxju9qfTjcHBp0bPB7/18F+Qh8aIAj+2CgAIbaDu"
+    "l48j6P9rL4q61HzbuG8dwmf+ZjpBerkx8oJ/HxVdEs7Jb84LotzDuv4CvvnRw+C19Kq7djnUexFkGyF8RW2yrbWUsrZL",
+    "VYaG08lsFBTcDsQkkSCMMYYOHSdtYwyG9qQu5TngVMA+ohkUwL2SZ0k7lSQaXVFkp8HMETpDJ/noYKKsio44H0RN4Z5S"
+    "uBzf0owygQvMElUt39kLda2xq/rlywWtMw6QEsv4VtO28neaTWDWShLXoadlihZ1AlpmJ9jEHO5Q7q5uYJtg/4RZ0wm5"
+    "c1xNPt8sKYZoz+AD4bOsJMrG9aHp3Zmx95I/8mXIdbEtuLRXPRB83YmzIk6EYY9FaUvuTDMipUVCNzTQFGgNqe/6UeGS"
+    "t1U1lwniDFbyv56LyqoXIoSd5e8B+qc0/fKGJq1F1b214zU2eJtwP3mpMCLbKEQn2cNR4TDqujepeqOmySxcXpVHtxA5"
+    "WrECjm5YuOZkZgC/okG53W1L7J2nI8pTvo++NjMPvCk7lj2ShKZLaZGnYtsBTjrNoKN44gOfQSFXwH8gb3bMqkFk6Kpf"
+    "g+2ORJmBQVjQssFE9pZ6/BFWumRP6wT2N3P7mVtEjhMu2F1zMcUpRqAzSevDM7GK0iUk66HHWztRnVYy/nxjAKI0M/9N"
+    "u7CF2g7hQffzO7CqvZpFo2kOJjlVXPLPI64X9CuZES9derK+DS1lJtzGkWcQsQT0H88mvUxXyy1nk5lWZR86QoYj6D8m"
+    "6SKyfjtVmiPxq+kfhxj/5NCSFbERl5dI8RsUjaDspnMUFbM13X9N2yoxME4pnGyusnqBphzW/is3IcRW9Tw274CEFB0p"
+    "WEIeJ7ybAVnZjDlm3MEu6O8l7YNhGMJeTWSfQzRb6pPScwyT6ccGgMaWXzKJoL4ybG1zI+J0px9q/0hjFcNapkFSYHjK"
+    "vBSr/z7e4CT27aaER5D4Vn0U39/yZKg809ZbgzypNUVehu+Dj3/kvE6GiQtQu4MD82MYd4XNp9B0bTticXN7jrdB9Tlf"
+    "5p900XwIPuzm6UvlPS+vFh8ANxZqb0L7SImHngCxJCob7eRXOD7oi/Cyy//EhCWGiWGzo38UQQr3KlAVipzmHmXQ3vjL"
+    "IC5TLQHnXzkz7HCQxYRuVGXGR06JgsgivmveNxlRHPTqfxiKiibwv7MYehWMoUXDuM1Y52dskR7GaJPcCXOw9Vct0fA1"
+    "NOnlnuidKOhQ7+PY9APf4B1VarqkoDl7yl/i8vSswLZG0hA+eSGPkV4mlDjW4naah+bITUAuSW/U4AQ3jv7NHU4bqul2"
+    "QfWitgCJK4DxvWbdjqCIk3FHqCypXQE0I0e2Xo9AgeCqPBSvpMbwc6I1ZJ/x9BG7zQGPnI1M0daZHPAQjiWFqlIvtBFX"
+    "3FPWlWWuwS8bE0c9a1X0NmCzBP4sWFpDhmGC7aA+aEm4ITNxsA/Q0hBcVtxNo3pMWbDDdip4QUMbyND1LPlg2HC2TEQZ"
+    "lz5ywt7ryVyPhVxIhJyUuqCjl68ReCk9SLAFCp5sHLxwJ2gVUfdItg0V6ZvbXSmPmHbXE/OWl/7jt5ULUIQc6YrfmLn9"
+    "dWNWKX/LwZdXBwioGv388iFV6ntl5282o1+LeOWR9RnDK1OMb/7YyuV/UPbl/SOPIL+BENxDvC5zyV2JSXzyUO/hUf/i"
+    "SucW0T47E5zRngVOiDHuWY3wt08KuYwq+a/7F7uc51MjHpGpV0KFbL0we3BUSCLzTKbTXdBg3DpRMHx5ELY3D2Cv3SRV"
+    "Wo3NdOMRdF2+XgQv44PnPgSb5Dv+kR5FYnULoLv1oke9UKXyk/i4tVzVUIUiOrKVJH9cXCTcsGLElUqEQF0qzi5kuxJn"
+    "h1r+46Z0MJsrtc+IiAbinS/cbtREw1Fhtn3wXEVjHYIlGBcR6r0b/9wVw5xNLOEa88/3qkw1zwjRRyKfkyD2NBUDD5+o"
+    "e66w8G2gCKIKG01kOAruGArsSU3o1QrsVGLMuv/mCnnBIIa4ZY8Clc9ZH/1gmIFJilpNAS78ejI9x/0WlyaIWd8tJaCU"
+    "yM/pG6sGKmxl0WS1PnDwsFZkMdyXxvMFp46WyfsB4GFVDXd0xvcSKqAyle/Scb84JlxO8iLiI9/0GfOzEk0pM1vbZlWt"
+    "ViFEqDvowc7j/GboAdT7050Cdt+YQevKGuXWHIhLV2alxWfEO8XO8VmNmkhNJ1AsGSk+7Fe1/zTqzJbwWF4IL2FtRr5y"
+    "k83Ct9pMrx9ys0WVJQy3Demx2D4uKEILq8SquvV7E/Ycpe1to8TesHXQhPg++NGEgY+UxMPMcFRrq8WmZxU6GmW2kq47"
+    "dpID/NblYGhqgZf5eoYPRJvmK5phE8J4Ujnph1ljZmUS+1mp21KiEXwe6W7lqj32RP8Jso8eXMHxIpVvP7adit7VdS+c"
+    "tcog0i9pVdhzubueCyVTLMx5GN5OFbSNAIDhchCiEDtCwcXBn/HN1AIbL0tdcolDBS4IQgQ+ZcNyuqWcnfF00truXGB9"
+    "H1vVUvccXulwkfPFKBmID4Bkbb1GgRYV6+xf6yKCoMxkcnuBWUZK/thrcZ8JRlcclu2+53nt2RVewvCAIycWzQNXmUPd"
+    "qabrOnCZwd9Ty6pzZfLK9ozShg9tJgk+E4vkXfU9psyyVyFzSM4UczrNXMN5PwRNqnKmFz5tFFeUimYsEE063CYYZWSE"
+    "L69WBHTqmMynR3GDTw5MLj9pnbiICIWsksuko+9UfNTCWzMgirF1c6ICAYdiiLpQ/8DsHkd1uOamQG1g4BQn+1B9sCTK"
+    "o4h0WCMx5PPsm9u6LN3TNxBWPPF8nuQl8XmDAGihmRfTJTbnghYh1iST932toftJotPz0HJDf2nzo9nFaNumceJT0Y78"
+    "9K+VJuGgMXFa8wextqYiwpg8H6CLc78oOwF6CMmpVPBWKNOLIZ8C4ysyziDV141Yd08gDBeSCFlesjMrbFw4RqwO6NAE"
+    "BLSFPhuRYBAZT3s51KQIqIx2akS7jY6CavMnFDDzsXo1nBUTt5kZWID+zY5crfKhgsX4LdKrvCu4+xaeuK7YRCpMtRk0"
+    "0sRstk4NpggMjk6Z4SvZbVXPNQ/Iq+LaJLGtUjHUnbdGFwgWb0fxQxTV+eqHwwV3qpUfD190oKSnKN/ndlYA596ogZyy"
+    "IJudRqjjWVJH6l+7jr+scMmdBpaVSlYzoatB3zQ2ym1iSlMBz4HEzDNluURQq06KpuWjXu/7Y3VymBXudIDh8iqKiu0r"
+    "hiPf2fCFkObk5HiiMa2IkI6S8znisXOtDVTvt6RiNErY+nTbz3qoebbrBjoRQsvqBi9sIZnBVRniDBjP5iP6s6XOp1WW"
+    "4snZtZTeDutLyst6ZPszurRD869BFI+OuBVe8g3TXbCyc/QG0v3rhyRJVi7hyGE9wSXjIyqbh6OiZSYsULhOsV4N5u0w"
+    "gXfT3TKVWYmcVn28WW3NrGgsoRMdH/teuqeEYshlY7ByCW9EVqG3I0NdgAeemSmoYEF6uzVmOntKFQhGu2IdJuXhbLXd"
+    "5lgTu/UM36HqACLbCdd4w9UZ3fqzWt+BI7u/hhaClwcq56H3gfhVl6jiJcrCV47mGep8z0ar4HpPwbiU7f2Zs4W3l1xZ"
+    "clhdkVf2jkDnfR6tcmZsixnT0o6BtgITrhdw4H2bo1x9aIv67CD1gyh7FMg2iIKTKn16K519vDhrFJOw/zrLj4thhQ3N"
+    "fJOIB/MunlixxLAyMaNTRMWDBxsI0KeEiVcVLX40mrzs3CSjxrTrPeWxIT1/wtC38/ywwZ2WYy4t3I4QonSeFUpl3Eji"
+    "PGagO7z0ja3e9d4ZBc1edY6buhhE6ApNq57UgVexWhcrs5firgyW2Jq9Yymtn/3nSaiXISWNEIn9t48fQb2fhpWqaciO"
+    "txwI3O9irNV7GfXJqe5f4NxxYafDrjX+Lxd5QXlzUwDd5iRGyO8wEs4gz2YoE1jhLl70Rv2MmOsHyZaUkpH4SkX23pj8"
+    "97ODG+AkmqI9vbKLnBWoTu6sVa9g/TEIP6wH90+8C1fycL5rGz8KlIAGRZ257OxQg45vucsPOx7O32ppCWiklsf46XWy"
+    "9Q43mwN8NJ0hdTbX0yMZeHv3UuWOjbinh0NDcmatHo4SDiuIK1dik78NQg67E4jQOD1u5LZEeH8P6HAEjxjSOy08yKLR"
+    "VxWkOTYbWttzYHh70M30uHnap01CiZW29SGaCX0um9TFv/huwDOZiUZ0FDyF0RqrswXLd7RKCFZeZGv2ym+OUgkcyHZJ"
+    "ZIC+GtBryiNlMkGq+uh+0zOyVCWMfTOBjnmQ2UHOYxqy5y/cBM9PL/owOtfztMzb7S6bUqP5R69m6ZrlWSyC+ANosFVo"
+    "81UuOq2d21JyCQKDBtYp7LX9NLReBStHoZlh8rZCzYuHz5jx5cdkEoqmWrubB6KGsn1w3pAESuzqtWX3v3h7GoP82uEN"
+    "15gvZCd/Vtf3SwKE4WZED18oBXMGC73jK7x008p4riQOG56PSgtLXw26DJvhQkwU/88/aUuZIbLVrCd7wAxHf7p4CNVL"
+    "Ur/eekY6T1HXIBd1/90xsF/3/lar1TTo6sEgae0to36XYEeI8MZPjbMQJK3xLEbG2FjT1D3IxTKg+X7rUedxLhDKXI14"
+    "IACdZpk8EOt6oPLzuzgwbzzoiVQeMqJZF39LrTD3X7/QelTGXjkwFy0dqhcGfjAwcZk6OuEkfwyplmm1l1hjIu+/x3sG"
+    "1v1/+sPwIeiFnGCNQNGVsfdDSIjRPUpaNiXqXGrHUGJsEOHrl3QzM9nxfDeM6JEkmzDnrBpwGDtG+TL1fME8nbivgPlk"
+    "Qibkv+6pt4kY+aykj7131Rpr6h9Irq8pHHw8AW6V5l0cbHzu4J+N7BUMKrEGbdG76k2XFrvZTI0KZoK+iF3bLKjl1X7e"
+    "QG7Iu59nrvmRMhmJgUy/3hemyuZ2jkGQWyZnhyRxZBydnvZiL0TAyXHWGPzG7IH2UER4u/eBc0IvzXjBtuQCWg1MtsGe"
+    "nyv6U1ieDI/WDV6QA7fbZNoC91FQ9giYNpEYM5k4tf9uQZ9n4z4RC0qfeGTv5PjMnA3UyFHgu74hF7ObYnimQP0Dwsex"
+    "H9Ok0q4zHTcBD20BdqcmczAlVWX+6rQCkDv0vr6ZteIXgOZhsfwvH73RjuWKPE8wg2f4HIlQ4nWcY3UUzAImN6MC4pEY"
+    "xGb15415tXSzg+L1yLszm3Qvn/NwIA5PAXaDE9Ui0Szja/k1iN8iQR2tmSft4Qa/g/fThblSAcVWzDdBX8kja8Rd4Z0v"
+    "be05mz8opvOTUacclfGgW7z3c2gdWcOvaceS1x01kg2Gr2fzK4eAknKrEMQW7elk8l0vAiev/e+x0JkVYANATl12KxQ3"
+    "hTciap32Gboa1Zr3QVpLmimcXUo1EFITk1noHkYPy75oT25ZOwOIrplx0mM1Fl/HRbDiE2XSE/Hd76alUL9NsUBRnj3w"
+    "0Nozj3DO32uZIiE+HU+4/rpVmmmsoBhqy2+PvTbHmHCAQaIafyWYGho19N9wCKIjnQPmTYJEB+UZ8nePwW5m9CZqco25"
+    "3RDkLJLrz3kIRFR/bew0bhoYfsuq2WgdC7mD7DtSyguCWragl9YxP8t9jqchwpemL6Yzezx7pEHYu/wmlNMKYU+r3tqH"
+    "kMBo0Gpdjn3n3tNtgTxVrNNTep85rCpQdBVx+h3NnHsHax8VkKb3Aew9rh2hQNPmi3h/hpeMlAqhIGyjMWc3EsIX7gSF"
+    "jCBdOc7YYHhULtv3TejJaqNZSCx4t+udxZ7VO1Xcbm7s6DC3cs17feaj1VmGlbRqDYKz3CE8b198cWqdaEb4eYJwSBg/"
+    "5/UELPJdm+MVlg1e2zWkxhK1917Zb2+/b8kw3C1yX4PJ1DcC618P6Yp5nFWBR12qnI0TOj8hyxdl+G5aTzV358oWG+zQ"
+    "Ht9saczOxSyuJa6zLRhEUonSeXxJ6tfAjKJBatJhEpyTiMHCHhhWENodmlWA5e7/ehHYXsGGPfRWDZmI7jlylU6BakNZ"
+    "QpMhMkfFpRCb5LKu86Oq/4SkDpTcKew/h5UwppczWarNbDVEZwsT8x9DS1fVqN2V1fMU6UPmYVDR3N0ywoXfiDQN5La4"
+    "Kfw+jHprg58RnivK+XQeESzwk2/fu2mus7MfAdwTY9u/t2SVlirt6PfQkn0WnopOKLT9qt0UwOYVqJQWv5EWqbiyTTYm"
+    "PWVaD8Of4dmWHE5pZzurbiGNsIDRiAIFQDetgwXGwfJZOu3vr99/z70lDk+jRQhYdaS8SlvLIuNrBGQ5befIcwhfTKd4"
+    "N1hvZkS1jb/jlPds9r15lyPZHaBozPg0+B5bl73zUMZNbNeYm7p6UE1Hd0qON4rUqAprrYU2R32HF3V0OqEY6nFWrao1"
+    "IxmuqfKJFkfoAnMw2iOFzn6t4FPvHs59rfQuv6Wnh1GNQnX8Iwat/LVIvvevS7d/X5MpUmHw6i2GqUY7aIqP/89jZ+eH"
+    "g1QWq611Qk1IpzYVgSF7TtBBCRpwR9D/mk6ySrYgXRjzckQT2WXj1F2+lr6ARSHKOKHY8/y/PqZXBitfeVpHN5FMZuO7"
+    "K2EuGfDksGJMTAhSiUh2Q6O3+QEkyD7F5iGCC/mqdKT2H9FI1L5DrzVfq+8P+QiMUBobWTqPieD6l0c/vZOBZGicq1Nt"
+    "46W0EIxWE/UqkxVITlGWI+9BWD47sx+h+jWeBVIBwPBEEAgiJ01MkMaX23GmS0tLNZ7BWHKtP2EYllXsszHiix/Pu2sb"
+    "zaC0qE71TNofMbjGUY5jXdnSIxftKawRtnOdDUDQ3mmk2tvTA2MR6BaPmbgajSC4vp8JwDbv3fcbY1dBup+JFpOR8MID"
+    "UbrTx2tVQ4HbWu+bGMr3RPzOENgSR0kzv3tplC8kIGLLO7krYGtZH+tuG5ukQN686ljKibOAKTOkHtlwl+kBHDUn1Xsa"
+    "y30FVwf/BvKEBnkyccJCsC90jHLBoM5zzZ8+Ue+7X6Q3GDrVeAbsai1tdKdd9wmtx7Y10/o1DqlbVRY8caFrk43fA6xP"
+    "ecrAGAriPTCjYWrh2OnSn7vnUBfTsbITW2auawGcEUXSzbp13nto9fKSXIZ90dr+wd9IjGGQ0aqoLtPoMX5M8mvpBDtL"
+    "30/RryAW5eSDx06rkdl7VM0m8o5jg6dUbrK0NiDpt6bnhWbr8MRgb2ln02tmg8tYFHaQywFRaeb+8zRBA5fLxLl0PMIC"
+    "olkE3BRLf21TR3iMft/tu/rubbweEiHKlXGNLJ+mjmD8JtCL9ghyo19nvmc2ptnPvmefO9XgGQer1mDMwOYcqJ371Aan"
+    "LYTxVUe9voMBdynPIdC5wFeu2ngRSZ1UuhQQDiILG92itpROvQNLbiZly36dau/BSR61kGkl4Km+YhOaRTqToG4lmHgq"
+    "V/np39OvNTq2khGGldisdjYLBGN1y4knuUWx7KtLsx2ZGUG4T0QCcuCIhUMgMYlYK2LRdxTRCIy2jNPPVGHa8fOfbM1v"
+    "2UxwgcpR3vLkCw43iFCtAlTNaN9MJx8l8rgoqYK7dcCxReBX2NNbtHBFuQ2fH7d+5xsXIyavY7od+dFJXaLhhiRKPfVn"
+    "M5WtYfJcBK3MdlUmJvgWuqoD5bYmc11IAEIFs//7MDXkvd8Ng5S9nYxZhgLxOxk62w1LFmuubHz2WZN9iylqOxR3Kb9S"
+    "k01+b7G9urBUY3sjfdSOSWHP8GL/5kBDyfq+VtG4rPUtjRxz7pTYknEPU9V3fiSNmqFpKDZvmTZgU5tWXoDnQouKllYD"
+    "UawIZBESA3QGBklZdln5PrAPBXwRU6wkOO3A6Ym2RhLllLEieTIioEUME6kv7bZMSUuoUVL3bTS53jd/Glc43J7ZHqxP"
+    "JeWG87M3abk8cXFl7UWQnlYRM8GLZpn/hU2tvF6qZfCSdeGo3U4YaBNeXuqpfXSUc0XNaEnW8PEOZmh+Orj2ueo8oUOH"
+    "mJnid3luyPeQlhbcqnzVOJyNg0BLLJXWE2nVCr33tkQu9FHRrYSrc5d6hVxw+pfK8bY1Xx1cdZBLGUU78eYAmw0mlhsC"
+    "yjK2SFT3XPeaayCjFIkA+xkq+RHrL0iO72zSCnyGDP5LrFYp84rL35rn96izFdgyrqRhTY1zxiT/nou2nizs192lLAoe"
+    "H+GfeSO5vtuMIjrj7ae0v1ptGL6tSOhqo88DMY9zbyasTKyOPiAnA0CyDkIJhCBbzqssdzU6lJkLqF4FfVEK4EVT209E"
+    "BCPFFYLr2Qgqi7B2P+f1BhuehAsZY0Gbjh87rDwHpKBZhidNE2D1i/PcNRHaiYaVuk8bqBoBINKsX5VE8EiA7JUKtR1I"
+    "XldfoaflvzQwDqbTZbz9NVEJ1MkKbXNTIs0xdF59HspHLZoFmWgclh3L+DoKA1OmlbzCcCiGu4qjdJ9NpaenXPBYuXeS"
+    "bgqHP+BBHqv6FDVFf8DUmAjEm6LnDZl9QLk4BMBg3U9CptqojVHU2GIwFkZwjig+fOQdnSIpOtYbak0LED5uW8Gb5ILC"
+    "VQ2WgtPjUow7aGwfd5XpUC/Cm6ompLXzZsDkzNrHd5jddqyOG/SulwSzejug5Jw5/irHBxdzqJJKTL6xAIetDs0djltS"
+    "wn3HecnDlZdSUtjt/BUg+wtn4PgZCbevYytKHhXemoxl7Gt1kZaZc+wyNr3Jj+b7BLtaUqvEvpE5XQqhGH+NFT4X+LSm"
+    "QiknfgqEKyi8HLrU59nGsgofs7kL6Sg4qA7I2VzIUSCXLpi/z/HJAYXFs4FhZCaf3hdDBvuCflLtxrr0otzQWDZOW4P4"
+    "nNxpM/GnJ0ZkikAWSlHuqOxB28DRGx445r5VAlDFAa8utFK/mXTE3yyP15ES68VkaaJpBleo90FK4jE/psOjxvGrig96"
+    "xWsYOAhxeAN8bEjhWsFFGvfI9y1px+J7EgDIYvueDMAZgjdoIbkccaYj2n+x1UBaoO3c0SL9PVpQ9QVuQRHPyQutY5UC"
+    "bCbyWmzjzRA30m51pYdnNoGs5sSuN2/S4GdNzOyLE5J8JWgmwpUArvfjWjfDl6LRQjFPCbeTbLHw3sJepT6LcS/0i0Bc"
+    "4kITz2wLzOaP6Yzsf6ts7FJaboWfbaNrFjth42irmSqeqtpmI1kLqsWZBX+M9K/gQB3sHLsDUZyLwBTgmuRTSpuDpUff"
+    "w2rPE2tfiao1kzM52IOXlnwrz6XNKTUjn4lYhTFmry/m66MyUAdlr97yjPxfolJgt9ROGQAUNbMJg1TzEIjnW+2yJsDW"
+    "XVApGeMQYr96dYpNyTZP6Q8mWnhKPGhtkTi4q6O4OSMrsj3FX3FHTg1JM+nOj0qmjbOIUjPmEfa8ZJWmlNex1E42hu+j"
+    "h++gpRHn1euMJfg0+8czttKI300TacbHGwUFLAo559ilre5bf1LrIGErYyq1qNWtIVXxqXnAKF+LbIBjaIyJbsFDjqEX"
+    "YpNpIR3g3IFOa17j1jStCH33/p1imo+0CloVG/RDy/mlB/RCIbUgNKfRo6Jxt3cxOvEG82U7LYB6fPB9kFyaQKKDOzpO"
+    "jOm/WuciOvWgC+PooC2mOR3S+ANpR4D30Si6MQG5EB1oa/QI78jjhGGAsbkQa2nhyj+eoXJM0zxZ9b23oYHdcf0zmREp"
+    "uH73Z0F37sT3gZU0xqFITXMRWvQTTW9amDXDMPx6wu0H8jQRhMFy8Ri78RXS0wcfiH5IRC62VR/oHza3/o6yXOjeKg1M"
+    "r7ivA/kpVl4niEZr1QMevgmPvzfqUQ6oqbLexUQnsyFmczuOBHnL7XJzGuSagwy3vTrYHpZeWsXUp8tnyziwstOd4MsO"
+    "3D3RQAzqI9+jRbuTJ1ShMQ/po9eBcfMHXgkct2vauXpJL8HBH15JHZAxvBIicvqL03/d1G3beTvuh29ELYbUkCIr4z6f"
+    "w5xvC00srIchpOtLXMSArjEy7GRiR4czzsS4Mja7BX1G9AE58EkxC5LEgc2WkucTdBRprO0S90t5g7yaAz8Gk0OQ9e4s"
+    "adQLQwp2Pl+mg3VJkDtMBpIrGremkVdp8goSKKJg0wc6bpINuqIGExKWpFohrojVYk6STQZRo2UUvEISZaNUhjK2agML"
+    "RsIKZ5jLMyKFSu4pkzdYL1dkJ1DyhJGsohszR0F1wtT2lieADKAkuQVLwb2R3F6DC+nzkbMiBfLmt1TwYV6X9mUvGw4t"
+    "/yx+KHmmYSIn7XteU/S/Eph8lfOQULO9LlhtqHjg12Tryt6X5+6cMnxtKnG8nrDZY3PwNb4sLEl1KGvY8CrGoFP/EHRI"
+    "lKZMTQlaFnm71AfOmF7eDAu403wMq/4v+JDiRED2w1HkigH99Zrt37aItUkJkRZnZGXohPzFJ2unjtvALL4GJEL6HrAs"
+    "zMUPaWL428+bYzz0HvxyXGDkyvE2EB8gRqhhupENjbWVaJigbkpgPpeIvKq8LDWQn9OdtMVSlV8QG7qSicthyZwbApag"
+    "qp5veSR8UMcvSJ9UfHMQAohLgfPv2Q0CFj6HQ8m3C+55Q7dV9EtkeYw4Zm6cc0k66CjnK8QW/urTEgxcqBEdqyJqHxvT"
+    "D7P9MqT+YnWZkMcbjtlJ/RB6rZIg+MjT42AsCE+12X9k0qH4E9bgIZ0ase/I25xktSBS05ZUT17eO+eN83jqjraM02VH"
+    "vCmBvQx8BRNxRhod2J+b8cbRN/eIivBK108e4cOesYEozP2xi8sU9sbt7Ra7b5S5EJkYfaMNsqzCZrYDJWzjl1VLbcQR"
+    "f4qp6qQB/L0VT50+tgIapaW44ecUudTOKVgelV8ivgSEgb2fUhY9zfXCb6ZKMcZZ7YbUv8POrw57rG9sz6cqIk8Q3cVt"
+    "4iRhkBl2zwC0WvJz3TxENCOg7NTnTqcj73KJgp6O++XdVDiNbIAs1+njfgO+YEmWgRyN/kRL8NrTa5Pb4cvYmBfygVIF"
+    "/4tn+uAzjq/GAy5G7EGC9Adr4H2ItpGdjHmB10GEFinne8qnq+w8yEEFMaAjLCuFkXUGcCHE4wpwps4mBR+zbIsbSrXp"
+    "QoGFl7ehJk+xhPXOW3SFCml/ZTtBhfjr7ViwEa+xgl6nodqek3w9yLsgpduUTzbktcjNvC59ekVx5bQm2oYPNrLFQrSL"
+    "oEcu593PU+I89CqoWfekLe+rBu5MJoQW1/3Fb7rJRuVIMONPPc+p/MEFvSbttqEGVrpjxwY5JisZvIxeAfOuaSoPgpIW"
+    "UVpnCv7oH8NNo4eEN3JazdfgSM2B/tFb+KYdAv0RfmLUFrdlkT+gl+YOV/ZgaR9yEDF5yZbv06ipG1dEJy6NL/orvkR0"
+    "G29QugcoTx6kliBVAi5S/EGD+jDpesPRDG1JhWXjEaCst0a5ix+noa940r9KFKGADkGOGfqOhK7oNh/BIpCgnBs+MdHm"
+    "KQaKFjD0mVXUeco8gbrwnSotUqi2ZEvWEVjzzv11IPL5Uj4RDVNTyljRK4uE3ImaVnlP2FyLEPdCKsWkI9x6YtrCXcTo"
+    "kBBu4vqYGe0mlapz7jx5A0Bidap7zisAivpySlVUMruBlm7HCg9+cWphYP4szjheKmrfwhObBbFg8NgfKJ0ZqYEFtSSr"
+    "8hgLypGandA9gKvFGdV/JaJYBLNG2stv4oGVYIYZbC/SORMK0DlJaUJLBkJBrfNhwG6q7NkE2kjzXsIrb1MKg6ZsfQ0i"
+    "vZPqmEHv9H94FlgfXToqj8WEbzvjyap9QJkhk09Rd1esJFPmP5DWVdsXvLlNUNjgw9QxAOw7TgmIkLVgq6864spQrDv3"
+    "UyXJPhRZQr5kl4Vl+IppyJztiJU0dxqYcroRNMwygihKqr6ABO85052H4qpOkCO85mHCnaUO4iL0NPz/9f9tlO9fxCoA"
+    "SS6NJBM4nA9ji05wC7Z3a7fYZlA8U0H/DVwkCgOmmkxhULyBgPUmVzWguHqu+Cak964ujn/I41guBBKUhp6XCUZ4tAkq"
+    "T+D9pvIva9mo6+8Tqk5mQ9ilxqciDmbT/SHk2EWh/isJPR6mGxvyGno2q009Lopi8ZWwcubi73e/foUqTz3sDU72pfiO"
+    "fBS1XuBQZVcLfMKb75Ki3vciHCNFIUFabcJ1p4t2/gEsXDhHEj+9OoCamz4Wce0gEoKejXOadOe51Gmls2cCFw/4BwG1"
+    "ZCKewK1oSTN/zKcd1TnqDmVVtcIgZxGfEaQCIdpuhijcI66klglGD6J+qUKpci3yHovRybKMEyYl5aNixkCs5o7+E9gu"
+    "I0RNUmfFFpk/6KxaWuuKOKqOD2Lnf3UwuQ3NU8OGtH76zWBbMlZgdLz7muKA6aIt59sXiGxNt6p0RmTKl5kI5DnHHgF+"
+    "IQav1WJMLBzovg/qU0DBN+gV6/JlEDrXcvSHfIleVx6beCDzLbSOVnktahH+BlT84USXTKJIqYUt/Ug22Ol4k8pmllfP"
+    "xN6TNFX6kLsBC2AlZl8eo6/d+kGdb7nlkZTIkpz9ZZlcjROuwMEf62/Tfmbj4aYzpAedaxfOgNB5SoCydZETwc4BL5PX"
+    "YOHlblfX1KFHhmcECz55oxklWC/4LKcUcSulZoaAQbKwaWxoZG/fKVyYXPmB4vBTpjUI1NR94ZERuvla+pkCK8RloucK"
+    "Lc6O/tZpZraHIdQj4osn4J+990NtBRYkBHCZ4LJC/VlsZi1y470B3jAndKT2PMH+SmZB1omHaei+pycMVwdr5tvfoTDD"
+    "KCu064P22dgrul82ROMQCcIzauI6b/deVX4hne4OHXzMBxzEAuRytV8UAbkVDBbbbD4T4ilDbTiwpafm4wB0zKUBiUCa"
+    "9PuSC07bFO3RzJIKZ1JDXGREQrJyt+ZjibcvIEDEMtXH2xbkCzem6spuK5TtyUute2oYyrJXdJwgwyo2SQj+jFmxAHeg"
+    "HQs3ia5jf5+5J2vVDNrB48ZB5Emz4KJXwUQ7PuYUg2at5xnqf4MIAfxdyqbksmng+7R5+WTnd9eqjYCZwZKi1J/dUuar"
+    "WQYp7Xlpxga2cWgwvmjzdWT48C7AY7zfsZCj7ZRWxbipSN5gNdvmF53yES6RK3H0PKF+RRAYkuMfV2xwtLgvbnu9j2DK"
+    "vpcetpjaRWMY7r3zF/e+nN/wcgTtmW9NmjD1Inz7Ckc+MaInRZl1X8OQoza+o72JkU5OGbC11FuJpSpWX/mCDgtZw8fh"
+    "29ETFWsxMxuHaMpM0FsuAs3Ln+ETkKcOY+vE/Gt9ETve4rMFICRYOQvQ1SJzPO6XUyWzMhnQ6qvy7KVPTtBLBEpFYAq1"
+    "mLq40SuJlVEUP1/COoEcECim8ZBYw7UOMSIaOeUxclCOQ+L+5RMCD+L4bd/1M2FHhU/yVC1i4rD3ZG14kjreLVpHMT+u"
+    "knDDaEwbiNE+CoIowjRTYwadOCFFj/e9jRYLaSmCWtk3jPpJCI9xTHiwK2oisTg4LC1oRbQL7nv+e2TsWKp16uDJseoW"
+    "EjUgmD84X6q+m0fje0YamnjcqXN5JopNaGkQHpw7kvDPi4IgGjPZPcu5j4g//pRG9Nfq+SwPi2Y9lj4ogYHA4G8K0NxS"
+    "KPqx2noypWCLdsTb14paLHQ+e8S8k05mzPHrkN0JS+H9ahruWU7mWt+/PBqfxXBeVPwqi0GnVjD7FsC8oasWWn+CLp3P"
+    "ZOVs3aUdRx60o9pw3mHw1Ao6TiVdIHpjAfxgNc/u3d93KTLmndW2qPmNRkuOsAStFoym76LK6vso/mxPe2xqFY3lfXba"
+    "w5y2GyUU828B99QrouAdBwf9xlmPZ7ri8ZvMqPz4JIgmmEAO39syo1B0/4bEtK5DznnyI4ufpggWco0AR0xNpcw4U2Nx"
+    "Ybun1ZssSNI0urmTAKhV6eMGR0GoDlmPbzwM48je4VlZjhdCH6DH5SFrsHd3S13RWkToSusrA/rSkBjOlSbZ1ianv9M5"
+    "gRXIVglV7cNfzJ22/mbclgLPqPK7bHx1M8hVXrQWwPmFrmL1MVY/09N2ajrt/ijC7SHQqa6YHYuIPiFdB8KO9yfcPts4"
+    "gVIRZxFUZkKDNiz3AX1Ir95gYV4vbN8YBxdCO55/skX2zXAerssLQ218JUCsFJsRLtMMVvW2WSk0yZkFY4d+5obfLEQz"
+    "KHoVGsP+l69QZNDJDGxWWybCiiG+8c5qrZjO/kLXXoWqEFoxkkxqRlzK47UJOhK2UNl7a7bj+ov3c78/YcZtQhr0/kqg"
+    "q/B2dgicl0fGYRvFP9fTLQ9DiGB6TymLbaYd+9seJlZPDgt0TIkfSGMzVbygDXsGa6xtDgSIQW4SnEhhhyQpV0jiXKJ8"
+    "VJMSkW7onUAvxijpIZShjy3VMVe9bGje2RNO9n/E2VN3HYoWBeBwx7aNxrZt27Zt7ti20Rg7bGxbjdVYjZ30nn9xX9fz"
+    "nGPMb6xFHbGVViq6Wx0tSyBL6l7i1zOfLPW5hT4ImJwGPYST7fF6jNlOhzoaPCxre/I9xCXBi5Hz+pK6JQPtYPfK3GT0"
+    "tDA+A8nCP7acYO/7clGirQfUQlT0tUvB5QBAzFkzOO0LfeK6AJzRegvXbtqpC3aUlKY+8Olb7eDT/bIesRqG3cQ3go3W"
+    "sgYFc4svGRNHRP4rZCfEwLaJM4xtPIcZgIKM4mBKYqutZzNgO8UY2poijS0/Cg30iLxthhFFeKhSxjCs0RX7ZmLXmgI8"
+    "oh8ICX1STegp9doQBm1nF1IPfm6jRpphkjotObtrcQncWuAFcd5q9jzSXFbtV1bhc65dJvEwENj1Ln8sOTEe004HpeHt"
+    "Kheo1XJcXjECwi+MhtGKcjcnKIOvHNr0Nq5Oqo413nch8pTYlb9I9aFlmuJMouUPNLH3ZJAQryAya/qXsFTR4z5h+OVW"
+    "y3WUfywWra0eeoXIedVQa8SXyP5Cf22pGZBCmq5Y2PILqn+zdkUk86LFrgNtBRWj0H6aw+ELzpsT1/ykDnRudTnBGnnz",
+    "yYOd3tbDDmQgyP3ZdNFUQVVAddnvctwR/bsuse8MuV78wGBxcbZzcuWmzaqO6m/Zjw0o0VwRUhiBq5Tbf1QNPwd32w9q"
+    "RvJIJ1wqhd5HqSGJUNoqv+UGrFHDz/tBeHkSoqc39V1SSxK4UyfgdaOZkdS/mRe+clVScpHngB8vNlSiQHsLP5JXG5cF"
+    "piKLgHH7wtyGgaqNBhN/eKSzNMCltgv1EKoacisop+rulH8dlny9ztDDwBI7HTQ4JHBP06dT3uBGkmzl+t0VoFP8LDxw"
+    "j2FdynZrwAQlpv6wUH1gn47fj7/MTUftVZVv1Xof2FrIXZPoyvNuf73e5g96P3nz6wh0QyiAZkuanhLNZ5sbIBTgDCCk"
+    "+eHJ6CQ+QqWX9lcgzntUdfWf6byEsRtiVufs6p9lkQSYs/7wqEe/QCupTnenZMCLRuQP2O3d3c+ziVZspO2AMuU+Fbmm"
+    "e+1bfS+WKLzWTZnkhXlncFNNh/2iq9SluXeP5tcHI8UN56A/lksEFiLXiNRdwgr7jj0v5qI0tM7b6C5XIlVgGhS1reBA"
+    "izT7wCWcEAc/QJBVch5+IM/PALal5Nt5lWmT8M8T91c02v7jnkmnTRRqF6dUBrkrpldDQqdQzcp54wmZI461bQEsjYmk"
+    "CwPqg07rQcJGihNTJJtv9IYeHxdQXqEAyuaU+mFVWlsmJ/eaJRjILBnjM1VQpsOiKKYchQfJp8ufRcVOBf+CVubYu2nV"
+    "wyOCRU8WF1YQBX/upRMC7N/ievUuTU2mxtyCq0osSuzSUYjGI+ikXW9GQOsCyKhLMh363DTTY1Euc81TxB3AGjmCKxN3"
+    "P3/Zp2r/wLBDWrmkYxQP37c2oecQoM4FFOZWbqteYVKPXN1iK9YJ/cSUfPbRATYCirDg3Jn6xSwKUCEHMJ0D6OLBdke8"
+    "FxxG3U51ZRQTI6qI4oxgxoRVvK5H/u4yiRXmMZECVFTY+Kb2L9yV+aYjVNI80PsMWrNz29GGIms54g0JlW5CbQrM73/c"
+    "HfE9cWl9CaeHOqHiie36leM3+Kk7WNkSkqP1Q75EwTzyu81TWWzoTWBXLRaiLOGG68kEI2djJpHLlwGLdC08h0wMupAW"
+    "oiEmW3o0+7mFI9jIrAJfaC2Z2GKN8M/EBkA9lvedMJFS8hhaho2tWSNOmNTE29u3kbvRUZ2BxJir6zzxhbe0o0xLtjLf"
+    "LxcyBMdqMC96mq0h+59dXZ/PK4eIfLs7AVDTXfl5GgUH9yq2lbCNESHQS7nAzA4hJg+9WUBkKOwhE9kiSzLLRq1rN1aK"
+    "o6xWxiIHp/iCCWCGuA4We6lRYc2CjW5ExyVMrxfyJm06O2ax+IdpT+tQzUyNGyU6lB7ukfRZtQ368WfyTD7DTLmU0Fui"
+    "ySjuuqmfUdjIl8XaD2qv6aWJuMexC6GTs1i5qwUFFS6JoVx54qMyLwJwVE0O0GImKDWV1kE2qjrOsIiCuR6hG/j4b2FA"
+    "5PDCS6MLCvdzVy8ZBDbU/olLz3BrKUBshCkURb0zX9gbyvPWoEUmtVbOkunQVSViYkCavXDkwFMR6Rfd900aEZd9sPPd"
+    "F6vxmNr1VcdUjicF0SIup+dBD3Kx9Ci8y84dVaoX3R5iGrl3EYiNTU8aEknLcR+H7r+rD+6QXpuVo9GccD0U9L4pzmJz"
+    "wNdJfdRIDCJ/HEKdY1CjDsv0MK6Sa5VKxtwHy8eHLC4WtCmGY7HzRiU/Rq5Ls8oMyGaZWIt8N6B2q1Os0nucsGlHjT26"
+    "SDYyCFhYb0cOo9p+fB6JxcX3FLPhcJlzKkKNZvMU2MxPm9Zlb5vlRgmvJRrl5pe+Y9Ueh/wd1V9xvqdrvHU6REEhMLM8"
+    "xeRDahumHmqhoUDKZfAqZHfePxDYegZmUripFY0hZ/qO6STxugKcwlEyF7Ai7YmPhv0smmnQkEE0sLuFT3TCXEfWsKEG"
+    "7qIC01foEKsgqjqHzqSqqvCjGS4i36H+3/4Faz3Jr9yG92IrLpRK4VFK1vH6XPmEkoKp4oPjKQ7+fJ9eG6x+4m8b3UAz"
+    "n03qrkY4ZyZSxEs0NyfJIKPYiYjbEvknTfUmOQ8TXiJYpy+7d4dFofkRcan3VPv3QJDEFKO5mf3XHzKk/uXRN/80cHl6"
+    "99oMxyRZXRTT1RTD6jRliuN1jtaePmyr0d3KP5vlmj9K6u1FN0YDhxf19X/BMTcSrNrW6sUwX/4oIlscYwwtxOmIET37"
+    "skXNuL0/DbQ1PP9QmB7GNo3QD44dtA3WpfjYu6zY+npKo8lAIGq0Hv4x2kVf9ue/e8Ls/DBQfbHWXj/CnHpmQw0Kvu8E"
+    "F0ACIh7DXXosP6ExCKn1UYaeV/6huviBtviDN898c9JXvu0g6gGVc8XtmGn2V901vCkeFBZZqDBgwz5ceBy6iP2X89/L"
+    "l69Tf+mD4zhxEi592YCKtqqYpAZhJT7HBdpC8merGaFNrps5KQOLj2SNfac9f6HlGB43OHpLQW3Bu7Zl/2KMcXNHP8NV"
+    "M1ayv9wFqsfg9RHsEWkwOaMysuitivmXRfG1YKKyh6reNM5vw6o408s57LWWjtpSsyUpRXcRFauaDN4aOsVqLJHzCNhY"
+    "3j65URKvZHrGitsCNCHvpr314Q8oDzU/BfXvUKxJ065fuukv8/Lu/nmnJHR8bCuprlS7sOxjpQUBCSjY3uYNha2LPFuS"
+    "lJeNnzq0ZSdSDPafeK6vP66pcLytC57CqXQ2QxufDhjL+N21oEa96twtUn+9wf9clBe8aTvW21moWgS5YN29OtJbnkpa"
+    "X/4nCGtm8QyyLP5AisZ1aNM4yIYshFT3dEro6HvmNZQOtxZ1KMW/YL0onE/Qw15/AhdeshzBfdXtszJ7H7htazCM1Aj6"
+    "XS3dewfr75TRpvf+OftdusIBsufLhb6HV0xVS+BgHOPwZzdTo5ZuxURN4T25zzgR+NXPO/bMWajq49gprIW2Gt0lH3R+"
+    "qfvc3Lgw4m8X2PQGzcfpsA+r6tYbh+d7w/hePwcS1HvQj4nwg3Wrt9DbwjHX/7z+E7AxwUoABRnf/CXNCmrWNnklIImL"
+    "cQ+bNwdKDaowF+38gb6ZM5xqKLAQ8EFRtE5rPOUnEdf6cnLRvgExf1XVcjK5lggAnbsyf5YC27cRV37jv/0M+jMNE7Uy"
+    "fTGd0+fbpwDJ0xMypZFdgnxc99oxggZNj1U/kfbbVTvNePhytqh6BDy9oA5FctGZUb7I8yJ08jL4Lx4uhzJyGOSx106N"
+    "2obEZmy9xx5zT7Nmyx5kW2ULjbtXhTZKRkoaO+P9fzD9ZDq55voVRnbJQZCVoL34NC6Ol5Qin5VC6n07LYv9YYUHwHjw"
+    "I8LqyDkiOH2pZ42BeXM94UXGCz6/88f6o1jue4IfPifoSoaRpO+eoK9sGTa5ER+WhMYsOWsybyGka5QHTDKk7c5pNTp/"
+    "KCaAOTj+txOeohmDZZdUL6JN+RoDcLXnmHRGGvwI38uS4M2AkFyz2QA80cY0yHiiup87OvO1vNNMF6Vhz7hqECG2++8V"
+    "MrlyRV0y8YQ6w5ER7fwNXRB9biEKd6QV1gWxOob7vq2ZzOD5Mt/ZgwLgh663qAyE/8bDOaPgO8XgzOUQ1DtcAx5mk9/Q"
+    "Syse+ZVuFQUt3Y01aTFQez7gF/NaE/lnAMFhUeOEd9my2Zc5rhsQB47/dmYmC/HltOTBmnTDMLsMPz84dJOWwOd3TYvk"
+    "GwXD+X8RP0EUUYma0355Z1yn4BRxUd/13tZqr+u8o3k+ZXIL8of5VNv0cHMKesO+NfPUMKsnGHfG7ei0nlvv5LE2K1uK"
+    "BaL3bLFj/6wN8Qf3wdx5O/MsipHPTQll/fK/sNKwcXEFwm+bnx1QJFNx//J1lnwmg0pLtscRsaAr0E4C/6ffIl8Mad8I"
+    "/vP0NhnanwhxKoOfimzWK9hON9r7KySiEZutVxHaS1f/xzOzCDS0jHwTo0R6MI5s+7Tmc4IFmT/Y3V9mrj0Hk2HUSNwS"
+    "Puhm8LjqhL8jaOhxfaq6TpU6vJp/4CQ5YaJ+nzPOzeUlCd6w4cZQbCCccmkj4XB5vpyToAy3oPsFwinbMFsb/rkiyrKq"
+    "TuJN53bif6+2tgvUZsx1Gi7Bxwh+A1Owkx+hWs1/dIbIdQ1mTILROqcO6W1kY/SV8gR66QTvTEB/efe32a5mI9YOAhUM"
+    "tk37vcJdYaKa37TPItF0x/PZ2BISrDL24RerwOf77Ufdx3khz6gyVHH2LIW75iFnB/n+0FM9fBKn+r4FsEQzep5m51xv"
+    "9ThVmM7fBbQoNCzP4pEkHSJCryLarPIy6u5eV9BKkxiDuGYI1/eysXqVbV1F54ZpO0v0Lu7fEseX79IoaFrrXW7uyUBV"
+    "e7BCkal0hLXry95gSc70xkX1w5ueiZ+YHsGgtJx6QwJVAi5IT96U1mAnlEIeD0jRcRbimC3pqP4+wHAsvyTaCxMq5KLp"
+    "Zx28DSEnVudDaFQH8GZ63Cb7zSm10tbA/gDLnKWAU/bCIakb4kx+qhkXg0h5tMH2bMnuBasahksI056n+oO7QpoAvkMO"
+    "899AA+CS7kiDSuxHY1y/VeTXMBrBIP9GBCt0yQ5R3GbjnKTnO8W2rKqpzFpN3v6EyseDmw/EJJaaM4uGl6ItQL9g1rZX"
+    "rPEPpAiyn8B3khdv2nCRZ6cIBpywNk2TjdLsCEg/8KfXNw8RAdhqRSUgRtdv/PgyzX5XgNMNNY7RjCGP9/GOCraje6V6"
+    "10nG189t5MN9ftj4Vte1gAlpVxRdodgWozp5LGUeP9QbVeHG0fBy/4yGfr+20EdHEiZijb7NUPYwoEyzh4sjQG1HHk9y"
+    "3dm1ginE+e0kIsCMjl6UwvkjKISkMUTbVssqctdfERLpazHB9qWK4eTYCCx04U/JL7cde9IvXtrSny2tYYwbkzh9peOy"
+    "jn/P3K39AxSr0qKbygPydoV//S1m0shJaLdkXdk1NlBmJQ6ACv3b6arYGNGuMzvIcC/FEw+5BansocWS1cbonCTDFc8q"
+    "Efyb/dvLrMaJfr5V3I9jh0iyTHpYg5LNI7bm3o8TEvxN2jygjok0DktFaWGSTXva8y/dHzMWkVT862ES/9bb5R+WlYq6"
+    "jUmW9Q2zUgnkHoyCPPtZvtJqkefN4RqVQrH5Jf6uzE1hfkSWVgCx0qwOe/wsnsw6SJwOtSZ8uoPZWpeNiVYe+znBA60h"
+    "dM4T3nHQ1Rnj7wfNgUNXnmBtXZQAP2y+A/9DmaseKbVzjKXPQr0z7Pm+zTax33qTk+MpFkziovqq7qfof9zrneB6P+TU"
+    "4jCif093fv+OsMnz3MQlQ2lf3RRCLqEyvqpCn4Pm37jDfbDTf7PNVzs5u5Q13OV6znz+HdPxgKvg1vJlHM+vL2NLlHbD"
+    "ehuu4R63ifb36V2OIr+AfOygkeSc7Q6b089VzS4HGTxKv8ywoe+SH/JJbX2S0lG1DO7WX7sHEk+oq+w+/sfp6rvbhUCG"
+    "bQi/YFyonK+U4NtWfhjf/qixooYYp4t2hOtZelcGWId+sJJE5a02nq16fgu5p/HANCHGdUpmayn/ofTcA91PaWCbfqae"
+    "3Z1h78tdbVq0LfF0mNnyKoa64xOOq+DZ8IVoJMWxbPh2BOuzmaAy2xMmweCPzxvJ7r5QBF40cariNHcu5OQonAR9wMgU"
+    "DKK1CSeZGJCKv+Mn3KQ4QN4gI7bDSV9Zq+UNDorjj04tki2rgKUldJjJza5ivcaBsvX4NdqTiies9zaRjJHkVAZCrSUi"
+    "2tRsnn4DvjgCgX6V2RPVdZ2FfUuKMgm3WqSOaP/Q7D53bZTehnB9aOgMH89IY7gcxp24QnQzJfzD7KvPbyXGxw9wvCTK"
+    "+WK5c8pTkDCgxDKA9ZyQb0mXHG+S1f9vvZn3SYrHw8gyqL+i5c7yYrRzwyLlsXxXZfrLVo980IIyu+Wd0kBPDWVCRRDC"
+    "y71fiocENxnPcc/3tP7siih1eMiVD4/+nrfKrelYz/M3VJUx2GP7qnt12trWnOpmEFMOBSkru9xt7V98+eWAEo7IwhmO"
+    "LPoF0Gk/DH2GRk4AKVM8b7y6XgI4fRbSBjRdTGygkG4sYsaE/JtfGSioEKFAhLpJRlycRknVa9I1cCYpfum1BQLjIkNw"
+    "L6HjB4un534UV51xTEj6qoTvcncjL0aOZLT7MKqLFqCT5B/z+SBMCWGsspdbMNurlTUhUb6O3Aq3OhIQRhw1c9Nuuv0n"
+    "D9vxpL3LqfDvPUItO6NTVNWDRb5n0zRwwX8U678blJmw8c4c2hZRxOQn0zpKLXMziyaeygbMcXpUqjc4rQNrLQ374Tfa"
+    "tdijiTvR7sqck4GxuniVtrVtHxvIpxidr5uVzmZtg+aUf8PvzJkFqSn8LM1GdbfbnfpWEeMwZqsZuxMmuWGvvQ5HZpaE"
+    "OC7nBCEN6D/jmDdgLCY10r85tOfWJgkfVLvtpJth59Fu1646Ek5MHuEHWGCVXdcWzVcbQwcP6sUXowLpfZ8JmphY/e//"
+    "3a9qEo/OBZ7DhVVnCJ677pUlRinKXcS+F1k94L9VY6nm5Bk4rWrWK0eKdgPvXfxOb0buAf5v3jTIexbMulf2GNc24LxG"
+    "8mvtQWP+mS6uD5oMZJr6oZJpaEnRX1r9x/FnjuR/VESJUtfnXEbNtV2VZzsGT9W1f8OwhxOjw710k5564thwSqZe4oMF"
+    "XlVpFZuiB0kX8ZEkHGfgEJGSdS+UlLwOlcPUEWKJD8cj/YGDftQUfbKFPpaesO+/ucJcMk6kbN+nwRZ0N8E9HGZmlWXQ"
+    "VEaKupzMKvS+JqYHcpj4ZIZVkIV4fOA1wEUT/uR/005CZ+2VVqf6XZI3OCoqnXMm/8tbzHjcPkUsankQubf4336HeYaC"
+    "JqfV5h3gt0qjOFHuO//fSEKKj6Q7Fgzp1e1/3W0XfTol6tVvlH/afmqZqdPExbRRFI3LiEeZ1Yx5/hAn0ZFNdoncqibY"
+    "ZVB5v6kYzOPNGDAlo4d5EYz6f/P3buyEganhT1MrOjjfZzzkpbb5BIirettmmcCG1kt0XiVf3J6l/EuUhekJy8A4KLXN"
+    "kuskiRyjJf7RHW/7uaR/ns0HSfdei/H3PgNB1DP0Q2yscnJr6LIbBLiK+bD+FdB2wAGDU++QhZmeK/yhOIh+2XbuPEXI"
+    "I5+guHPjZBPSj9K6MrFUxeCTyesGscHopqtHgONzhVItMjtAYTt9IehoKiS6FB03dsYtt93Jzez+XmAE+ShVrryGOn/O"
+    "Dx8zMnMmhPaG5RtCTga7cKoBO9FOTGm7XUOlz4wtuqG97z6IWkZizK34RMgLPpOQtHDKic1nhUHIAFCnAiLXiA0yuzHQ"
+    "Its1WVAziHy/uRIiZIEA4F6JgWAbPkVfa5VMmNa4Jm6Eoi1QAZmPPDebSyIOmUb7EG4XoL7HqyuomRsGP0p0p3clIFiV"
+    "Wo9AKXUfbuLEOiKxkJnQ91m0WiporLyrQYrBjq6Bi3i9TsJoDpvaCdQlwHdzOLRWDgaaoKzTCdFa6RNd4+nMJ/az8ZFY"
+    "325R8TKbYNHQG8OE+qZlo/Vbb6cEfGJKsEd6iBTbhCHW7XKIPdPy0dGq8ZlQqpnQnumtgElNVeK7regIRc6kp4L21XCH"
+    "otPp+GxmHqHoFLy4oKDO/tswwCA6kNr2exVd0w2lnxsUImDp2W5CTIZWqPWdaamKft9BwuMM1eH+ExZTEf1Vyq+9ge0q"
+    "3WjgdlCB+ZbJSs3LnSW2NbPLCNiTjK70DIE607SkQM1lEX//CeTaNqqxohRC/t7vAU19DpBiEiK7eNFGQwy0arSP5Euk"
+    "R4vBRuaj292ulEIcNZiw8XwmEuZDpAv5XC0wyUjQrjF4DYQ8th7rfCuY7XsUFmZSV8Kq3Ho8akUdFr8bbUwlVY0QYocZ"
+    "SAHOvldGvnANXlOJSykRfbDTAJ0+DIQNK3RQId9LTvDlrT43EvfpFwMeChOvXVrFdJ8QaxB6kgp6BsBnYsqbuciqEKtt"
+    "EaVHFr8x1MT7OYULsAAzdOLWYgGmENzbOrnW40wbuRX8s7NyKcI66ptHHvTXhmIIq9QP1NAFt3Z0Fw2QAbeJZmWVjsS+"
+    "R+YaHaAQG8xuLiw3HkDbwzGmM2cDLGdYt8uf4bNHnYF4F1LbPTHjcHGRkJKCYsgUYGMqJsTArTvBBxsofPWRooCXWOCT"
+    "cDssR19QiB6qoSRmqmkdWqffdZkaM9AQgLgFl4PgG/Cuk60r9RCPXiSO5ADIXlw3kOJaF0+kkuJtk2EuEV5VzniUOvfZ"
+    "SdkMBDRs64URSGmljuFOaMRSWiC2U73C8sWGLNEGqWmQit2/c0ULtDoAixeqUiOn6kbCDOrk1BLHesz4BByOmJNXDtfs"
+    "6B47pa56AyHGLCxSxT41kHgRb7cFwqkd5J5XxC1CXiMnZ6K8lp4LC5Ft3Sa7BCmXbsxmrLQApPk28N8ZsB3UQHQJMDqp"
+    "FbWhbB9cVEQ/uoZ3g67gKju17VxAGBSuCpXWWGpANrLQiFp7d2Vu8gqLVAjD82sAE0FAn6+X9KNOqhRQxoE4XQatwSzd"
+    "oLJSIVmi8PmqKTnnveL7Pp297/uo2BrMC1EixMF+P1DiSeBCkLgE3qKh58iBkEnY5ysM6meYQ+QVlJoC7eZZG+26w207"
+    "JrGGVw+5DKDVKQT+UyqfBb3vPZrSB0Ae5ebS5RX6mXwfpGOhx+fFstl+5qDTrlbzzLLwqhSSWr+wsOATPbY0lg/73GoD"
+    "SNXZMXpf+gwxI0k81TvLABaANYjdONCGwp8GsPKVHw6EtHsh3sPGD36mdNUkMzwb9O2ijNj1waooId++Tg2Y3UxhQ4zc"
+    "rL9XMVNHY5+xmQW5aZk9atglOlkLXNFNrRACytXGlrpi/bz20TnkdNRuYifEV44mzkZQYV9h759ddSndXIQHeXD5jHy4"
+    "99/Dct80RL3Qv/M1oWaBFRs6NNTcCmY35NhrciJdVk4JdZCg9ohsryComxAwqETKLT2e9GxSLoEwljqG4Ec7vYGXxGS/"
+    "qTUFaqjEUstW6pLOuyGZOsJIchsX4MkcIrCgPN9kCBEYYE8LNTeikZ0arWAHAi+hW9C4uV3RBVtPRukN2+J7Gmnqhl8U"
+    "uoJwsyH+ySFcpLD6OV9DFz/gwHN+pGMwgMUGT54/wNRTfI160MOjutTKhg+262WQ6baSyfaLS0JzYmNAir62rlyCwZaJ"
+    "iQUeV4AWnk1B8Vnmr8fMudLJNqCPUikRBRv+Sqbwhg5ewcOuHXzseQDXZSxL6TafEhoxCujEtguTCogPGyRX1bN8F9gL"
+    "agvQkUoUAvJWQQnIJRCTxq6EnGh+G3Vud9sVPboEcvlMZOOXcki1nqTHJ+cFYG9GZlVWWhBnZoqsxVuB9QXRGbn4FA4Z"
+    "N3WGihTeQlBOBICw48OhVtodGnLvQbudyCIK8Xia8VwSq8jUJEMUWpCjlc5coipDZLk51DNQ7T+Ke9fc1Cuz9O6TnbR4"
+    "+gMELs56fWaWtO7gqdo9zMymX/sdSlO2MSV8cLOBdLm3dDN6GWK7pHzII9vfOyEQDEHa0WvvEmLUVjUnInabuJx8ISpg"
+    "zbSkEQ35+bxu95mJQX0i7wKdqpZzvnM2pWPSQr2xNedgzBw63vvuQkcB2Al0UR6Hx+QtYMiyTR1NFXQKiFyNWlpoZr3A"
+    "oa9iIS9jiZVIfLgwo0u+F5WZPyMsKwFXPEsznNF+r5SWyDY5eGMVhV36VfC5WiKEkbBddVVgzzh9xYPP65D6LNh6CUOv"
+    "TVIuoHYph0eO41ZFcFRkYrx8Y/pc4R5IVhaMdu7O1rwleLHvDcCfvvKS3K+J95g+54ZBm/tTxEyAAZUZ5wQQfowKG79v"
+    "oExjbga5eyWxXEnt2cjK3uAsp2GK2CS4cH/IKfUXMuYWKRSDVyJoSirn+VmCK5RSKbLvhpGCY/NvKU8w6PD2UaDuWcu5"
+    "SRah7sGumE/IfIT77vaOfJAIrAXZlzbTA/9B4r1IpvG2bmu9JQ99IfqDa0ruM7irVOHeGd/rWIQtcj9Sb6zLf8CIm3zw"
+    "trU3DHBVp7quJnAOZbGusP5Kivf9WH/rRVTeZF8aS58sW7epIsmw4rdi2PiM/9Un0S0EgAhKtQNEHtlo1NrxMyfuO2QR"
+    "8radzI/ZxRyx6u5vW+R5wFP2oIkwWVodVFAKu8lL3qNrOL4alVkoKx3iqUXion7YqB3c50Kp4wNVmVRlHlE4+CaAdMjf"
+    "lCf4fNuvsbRM7Myf+75X3iCE6t2AGC46qGfyrwE3Vs/6fWPl1nJvKCifzBoRV/Qume27gGE4MJh1fHwxcB9ubyj5gKV/"
+    "mCj9OrvF/CN2kwPOWheLflXiuXkNbxlA5fWUrujmIKhAlo/d4hYrXAgVbvjCtaka0LRG5m9i5pewX3dsPM8fUkNBC0V6"
+    "+4GpUk6Pv9mchtMZHu1rPv2vQB0To/YqJKHZArI9TMnwlcS+EunoFyfZyM0uvyepvzz0Ha7KNlX7V1SjE7eC+MfrXn0S"
+    "uBaWCSP4fODWxnxLh6H4y17TuJbmfSrsLGRhlW63iYp5uO2W9m3aHkN5icEHZr/s6Olwfw3BwO+L0irteywkl49NJeXe"
+    "B+qI5FvEccWpOjeJvsAqN07sEklRih5WZKMbXPErZPashX3zJb9wptbXyu1AsHRPiDYf/VIttERXXLKoT+3e7NzC5psd"
+    "Ul3QobiIoKiEKcUzRUSY+97JHf/02oCAerhNYxsYrpOdaQ1uj2OmG8yXCb215B37HSnN4bZYd0wPxEL/FGUTqaAL1FdB"
+    "Y4TJk+pWb0CskBDyrFO8CSJjMrwF2BMruGUaGawjqisqdCTsnuv6LVuN0je4F7ldseFNfaN9i3xldixhZj2fEDEI33Yg"
+    "rVvWOekipwx7PEnzzOuhcFoVLTQNwr6N1aXdm+mXUjiU9roUlckgRG6gWPGSpYNLZJ14XCqcoMH/fDRQ/Lc34Z+V6eeM"
+    "zaSr5ww7wZq5DTPTqHT14mTTEEmbrKMnF7dUmgeKTzuTnlmUz084hbd4ZqFdwwHzq7DLj2lFw8/9OUapj3g596cMSFUW"
+    "2Zvt557fop55fpY4LbNal27f18Nc/sQ2fAwyHx+5Rh8ikNmBBvxzjA0HFsX78crc0mMm2DqJw7kZpPHVoWk5aQAf2jHv"
+    "xCgplvLexzpw5d8X8FTgpQg/evBPHYhTpIZqs+y4Mp5FYPAHyhJBXhMkiVOrM/Dm8OiIE/5eRngzt5RNcRAozTNxKHTs"
+    "vF7+pEnZS2/rAq7vMRLkq1MCcFwWFOv9M0JlQBYMWH+j3xQXluJGwXmuUZZIYfZbcpgJWqUXqfh+r5DfSggyDbY3t0jU"
+    "qD3dVt9pciowOiukDcGA3CS+YlFq3OmUIcpGBwnIbBaiIa5/bg6RJ4oAu8V7i+awKx+WHTBLLKCsIu44r77zmWywwg5+"
+    "UAWpbP4mzQSsLwjijxytR0NUNqBFT/RSLEbZfq+wgmarvllLOaOpM4F8rkvkirI1jRBq3iY6JVEDi+MC4wQov+GTn9Nn"
+    "wC+SL6vyexbW9T73GMzHPhWeVtfJp/fFbxgrE7I6hODjE3vjEcLUMxKZAN2krTOXoPiI8sgzc3eVx8XxGxhc+12TcZZJ"
+    "4pucg7Tp3H1+I9woNAxtZVwpFheM1VHfa/TUPPMjEB02koHPZ+yGr7wt9xVv7sy3AZcV0UISykScHMq6i3S20qexdfOA"
+    "r6GXXJhbhcRareTtJodMquDpEEvEp76V6osUL2cgLcWr0tLGZLeYB/5XNEvMmBen0dlTZp3EvJLVsAYljHhhku2nfcXr"
+    "t7+L0OWt3EMAqGD+pzxZ6lvcc8d4OfPkBJoVtWIXdWPskazLCkk2btRNYZSGXgGhQYpfut2CCmalQyYlfCy6gg8hhFmI"
+    "DNQVw+xSIIabNFXkzrDPv2O2zeX2zMDifQ4DMYuu3Anzo21efonfjHRUlkeuO+h8WWTfRcaVxJKIyaFma/LhdfyCkDBE"
+    "PruNnfZ+whRQbResSLk3twJcIEf5HIlugTWXKzewb8xzOmwJT8vYhKr+5E9USZg8nX+3Ln1/OwOXcWD71d0b2LG/Yhdg"
+    "6hIS8b0bLeQ1b2SyBGRYwakH8KIQND/oz2FWLvtWKkbiOp1B6o1cTXgtX51/+qZH26bLFtPXYjbDt0JhclhoS9ChUANi"
+    "IEm642UeoqZmXp1MTfFU7sXl09Dj2MLwzWU5dbZDTt5tsBjcueVghYaRG5R1ju2WiggVmEVSz19jxMGl2E1CD6102GnY"
+    "FISbpfUkYZmlqf0ENYXYKQTYJSp1FNRgyQfxpRUB2o8kjQjUXNVSLBQH6JOUsnRq1CT2bBQ/DzET3cOrO+u4haPcbW+T"
+    "4PkYJeAzYZeNOHxxjBV1VbHluiXgbeKIdA+JMR2Dbukw0FXa7g5K1bgkLdxSnu1NdeQt9TR2ZIz1aTQ1eZuFDaTg2eUE"
+    "/dTMqfigWYfFMu1jDZBJZPFw1epMbqiW4RP4fRWuKcuxWJhumHwohZQ5DGsScMPsFXV4UzwZsc13pWLzZC7t1zIP0xhG"
+    "bCGkVAycoG0xUWwpB0zMrMA3oRoZTDUpePN7Tzvtw8y9naye9G3SjRPNeA+YjXw5PEw5Wtn1JeC4NOT9LSzQxJF4doXK"
+    "HTxs4KmuSZb1HU1eSBXR9mSpFCPJSHHX+YtZjsnM35lVa/SQnc2tUHrtV9Ejj2CGBahDK5ObHabdoZf0T9h5g/JJS7G2"
+    "jsq/qzHRMCp/bknE9rvy5WSejznU5AJ9DMs1LWsSa50YPQj1wpSineguyfX4YFkNZT2PbcD18AQuOQetK/0hBYbwo3VL"
+    "j8dI6bGZdIq0EXBLCEyVBFkUcZPaeSTLHB+sq5XmxpiTbniOd4zq0znVmxI4ehL45KTWKOYjjvng0UBxNwg7NY4oCYrz"
+    "+BXSxYGJBuNFdmvdXelaumxyNe2/k5iz4OQ8rYuDaDZhdCiJOKwXDLmNUCLhdKoJKTTZS1O11rHvF7BfBsT+EMMpA2KR"
+    "GFBpmBaPK0IphjuVEDIshyVpx5Mi+1hAYQ8Mf1pSEX7esEOnb+RzwreDkYBUlPURLaFreVllDUnF0AMo7w4ZK9UAWBIJ"
+    "XNghcdwLUuK/pOArFP0pfnj5xdfLdIBTgpUvFbvlMtF5V6qkn9IIXYeR33qbqa71J9A6cDtInB+EIBjCn4i0LK2MMSJ/"
+    "PhoPhwr60+8+6k3qa/qspZhU1wvzKf8m5k9DHAyFDoco+W36+YEgAjkjxSj3C18cW559u12pVxOWLyZIQ6TsFM04kn+1"
+    "6diWFyRLtHyuUSRdDSBHfvoDPwwf+OPXvbl+AF1svP3ygKKQ+RFApFeB5dH4Gndj/Asae1p7mveNEppP0I7Fco2AqGSH"
+    "fglui+fAUA84MuYLVovjMXh1MA7QQaCeEMtoxWLy/IUBn7Ihr02GyZUZYhzqR7Llo8ciJ2yPJpEhAI9Ui8tDo8M4bEwG"
+    "ZrACywxHn1yYVFBWr/sLiSBNMUlqtALMzCvxxs44XD0Tfo21Vb7WhQCzKg5LGvIGxTfQQVL0qRzWNRBqxn4M+UztwKqE"
+    "qtImj7gpe+mGklgdpnwc0jJKUUyzjWIlkJrT6AehI9DMk+qXUhGq1bvl7QRLrokGj05YE4c6m8FKyG+bDlTyRb04DdQd"
+    "V37hhsxRinlZ/VUfXed87utLZOQ8ZA9uRaaBh378pb4JmEas02+Y9i4zadwmTBppw+3BiRADE8V/QldxxHNRGLUYUWDu"
+    "DNio6pGT8hWysERZaiADuSIcOJmuOj/k1nsTxwx6s3pOHFkRo0VX1aAtqXhBy2gNgiNqdZ086NLNcBTvvtSt57kEVDto"
+    "ZU7jSOdewSChBDm1ZRwfueIY/SBb8CN5F5ghwbLLW2Vu3IJAaii2gVQ+o8oThmgS0EgauRTX2BrMHhsJBEKOIn/iODKU"
+    "uh68yknAPgacjHJo8OCigo2ewJJ/KuN29IcpZaVfB4a/WfS5eslwm8qgpN/WwGBGoJCAVje7VFjDrvyY0YLuXYtSJzo1"
+    "a4h/whaNvNrhpEKE6U8U6/iMakw8JlyFIEz4Tsg6lZrKY7XzFQpjuBkrXo4+fpe9ID4YImR4QlwIKe5tFngYzxqYwJ5p"
+    "FmsRuQuaLi88gDSDFeuX9k9UerZEaMDh4yJR51SbOkXq45GeH54a86+VnMhMkian+FXqJDzkYl16U/YzY6/Sf3IVDWuS"
+    "3xycGJFui7yhjOwQVwGa6czxjJU8B4EfCFhI5KLLYHIKBg9PcglpwkrcuGiaCmP3hTpUIJxRArBitFIttjcFr88IOQK9"
+    "EgI7fGLGqWY7J57Ogkl8vwgWgtwMQeoFirvP1P6KJp4Y8528UGaSL2qva/pf1zKvYEOlUz9jRczb0C/dYUzTOnstu8U5"
+    "+KaaK6mQaM20YRjhpXHUP6ZGCFaFZTvEbIXgiX5yYnYQozc2T0LZxnF+EoyINv6kzCclHyrS9uzHbQkkLXctFe/rbzTO"
+    "RlulddkC2cmMIwrlDkOxw46D/hbB/DCK4ooF3lLYNxwZM84ZPyXezEZhOPaF7zIS+SjgHaNg6sE6nNAwxduPI1kqSPhC"
+    "QcERk8LgRGnhJaUR7EkEtxrBxaCj+6Nxf0vHK0ZAM26JhBhud/QyKB0lXe8h9y6VxJkM+i0x4Rom4jMh7gaDz7iP1M7C"
+    "pe08OjsF5EXhrFJm1iK/D+1K6KFUStLNIkK5nnPz97XkbbY9Pc9ka0ospNzwmLsSw6MpEeyLxiuhU0erfEQRi3E+u1xi"
+    "J6t4+2IYm7jYyRyrmUUTWsjmK8e/u7UiBodFwAiHUsnwCLtA2qbM+b3C3/denA8sy5DCovuXNm+UXB/WDfJpseik8wSW",
+    "7EEFGVOMABVWybkphDb/HieEvis4OzVA4f69zgrulw3akbs9DevfO0HluHYsyjh7O4hftiPMU0dypK7PV3cKQ+RpO7EQ"
+    "iXFTicbQLb9C3dF4WgyhOWomX/B5rsu6n1LDH+Q4UPqMSBoO/pTs+shUFH3wZprq10Bs17tWlW4AtW+XwzXeO4ebGpAz"
+    "/ob+1zAaTTW3doISeQv9sIWlk3MiNREranumRVYLgjK9ScnJbpk1jxpqg7M+8YKzxfIXMvKzMmLM5FAH2V+JnMyBHqLl"
+    "hUJOZ+LVhJl8euIHdNs/wV14NZ6GYlZgnay51YYwJFSawKbd8snBwzNGWQtkaCHLrHp/3wZ0vZFrO/e32jDzwDqPMp39"
+    "SGtR3ZFPWn7l3htmJUTnjDmNcPMxzT6qdq+oFTmPCEo4dhwajU3elaa3U/x6C/CCk4vr2Ps7eNOgao/N+TNIMGNkc5Lu"
+    "DhQ4eeuoPE2MORcjZYcjU93bSUcWBa5a+wgUy+olfJKMLPdZvNKZrMhW/R3uPZGnzDHaazQp4GO0RYBsAVO4jBBBEtbH"
+    "Z6y8/S1vpYzMI9Q3vNzOsVPh4lVaAzFuwAjqCHo+v8iyMeKW5AZTquTSsp6PHlIKh/TRoIdeXaG0gWnKteHbO5puZAgo"
+    "n8EV4fokHsegMj1HlQwDz9d6jlmHEOvmCNWoQn/56Jb+icoZUo2i0WFnoIPie0H7XZeYGVwzen2lsFTT1qXP8UYdz5AF"
+    "cF9Uyb8IK7T/E1MnVPPDcMdj5jr/vhLIdDw6gh2s2Go/TJnsZBtTNwU+7Pe14SWzXXnbLwK18oQF9QeLOXHsR1UbWDSx"
+    "1smu+KcZV46jlkf5J5YmImpb2bY/00p2BhXqzaHiWohN1V3uYdkpSJukJHWBkAixjbaqZEFTc58zCGPZ8sx3pdKhzZVE"
+    "p6MgkZCMTprQ3ahMDZruTX2LIoDStgmQNgh71LKA9wqioWpaqfveKh02S3fSHtHxXsjngsEufevRMqlhH9kIv/93LZc2"
+    "WhSIARtrwKgNzhGqZb5Pw38+VkmRq1tJatFTQyISMDFKLVfXC43ZYpkU/Ov+yumXckXRsd8PE+YcLT8l7s5fdAtkYRKx"
+    "uF0u7VqoCDBKirxXwl40ui2Mei7nIU8tE6blzWkStQIs8fGzPKkD6Z+jXHrdBtjnyS+wYIDewDFUOA1G/mVyjQHwm4/6"
+    "BwykuWkVXqcZaiXrwynA2Ui6VLmjZBY8EVewU7Z/uNJfwkEm0rqJwMIzb25f7/NhKLumlHfmmu1VgIJ8Bl5gHTLRsInS"
+    "S7sfpvnjzVbadqxQ3YNzD7O1VgFiSK+Wgano7XI4UXEjh7ka5+w4q0q7tfjDMFGpr+BdMilqoi8a207oFpNHmiNoswA7"
+    "/2/AUKkxl8Tk1Zd1CzXPZGLdA+8D6OviS7GSPED/4TAAMsiPUW7U5QWoTls3RA4X6aOtZx6JbIMuYcJqEQyh1ZUAoy0l"
+    "ieBk/slY3IZZUipbkiObg2uVwHdUiXJnZL5crzC5711kkstfbZ/7Nwj8p28uUZbsmXFLXHrbqftwE9iCJid0FJFk1AmS"
+    "MWdV9NLuDo2jG4E9Nhcd9vyPUmGvdfYoXm4fil+KieZjUsYWV+RSDaU3gv9qFMotsXuvfpFjG965O16S//F7ZW3OGBHD"
+    "yA47wZlZLrEd/bC/rGAlK9j+FR0wuNwRm4+0/OPQBQ+JDKXgB7Zx2mAHYT5Oq1gX3s/OV3SjJNRXljEFUu6pnGmegJU2"
+    "Uba0bIb5zptkfprN6ecgIywMk2p0EUFWBCpEIimdsbzJG+78C8+YMvSREZXdCzBPDbXDVkida97b59yhnWK+o3LY1MpW"
+    "N28p7t8Opo4wGvBXDFM5Mn1hdqTMk3t0n5RvBQzNvpqqaUVmC1qPDIZmo+EG3QSZykXkpPdt8V9IKH84WULUf8o2obgr"
+    "YL01CFD3qofPhIFlkN2h4OMYiqpMxSN5ZDtjtrukoEqGdtoQc6YMe9u4wF6O0uzQJE6I+QbPvcx+UW0xi1G1tVQHBLLc"
+    "wTKK8kgbmq5b5fVis/2u5M6I0YPKYhEhfBDSzul70KGOW+2E6VuZVW7SEPFYxv70tW68Hr9Re7NY3gJAp5L6IARBM6jo"
+    "Nq4ASgG4mlPg8hTh12QHkGE3hYtNysFqEQece2o0yrL4lL07kVQkSpotHsvuPQgoDC2sit+5xcdw1obi/Cf/NMRfWX3k"
+    "YbnuV0kd/iX559DR3cRzX95z7LMFsTB2fVM8wEV3ECV7IrlBbL+uD7qm8A3yypxk/7//v1AAXRgLNm2UKgz5s3fZgQ+3"
+    "06olWtyO8bX4roHaLjlnjswA/XmWr6uX+Bh3X19LbyA62UDwaigVuDm5u0XQLVEYk67Gk4lBdTuLcNBBZzpxGU5X1jPt"
+    "fS6Q2q4qab1Bkh6RsghbW6Rt5M+/1KA7Jo8bELgZzAoeFb+kCbEukFLzCI1L9Mv8wY12zsWaa6iY78TaGCHZA7HMx7BU"
+    "6bD9j7jV5MQ9mO+4b638ouDTXIyE315HLCeZ/Djm0Gd2KFam9qeY4DSCD0r3SPVdORoRtDsxBQvK9OqMDkHj7Zb2D6xZ"
+    "HaAhIM2PsyQmowQLaJLpJ+XKpNqujwoGnpAKVlRaVQZFTD2EcOwYEdy5UeEufpEuCnMwWRONtgJDw3EDU6OMj4YkSlQz"
+    "060uMK5wJNcj6S1hOCg8+1mh2yqEkhlOJ6lkfaBi0lM+UTyvjGEdOVMItHRsfOVMRRAUyuT7taEw77WutdGsumYpKxIQ"
+    "Cd9zG1ry0Dz9FmcgL09R9ICD/m/KlYA5gn1zM2sxRIAjWQVWfsVKXqW8O36AktBhn5hOHr2LRIiQP8lzZGyf+2ZMoQUN"
+    "W1UqGSnXkEnu6aDJ3LLQ9dxf6MhAZ5/I8VOk2z7KyEUNihFrCawHo75jQ/7KpsQWG+4uqKepTTvvtFJf2g7/4oXaCyZW"
+    "+gSJW9KGlZ6X0L42T0zPRD0xNOUYx3jA1thdZANmiyZZwFtLPOjJHTm2y2jVkWHj+d1ELnahTCSlw+Z6ulaY5EH54LNb"
+    "HfGnultKFSROmEXhv3jvcGhihuwIKSUvt+Qk9o7qb7NwZmNx0W8JgQ3oG0nw6XNX6XCRUS9XiHUIWGike3hjpbAJcZwX"
+    "abgLvWf5we/mazYoFR4OUBapGaw6homT4yiU1TkB97wty9/Mo9E9txNAYuSXakws6pgAV/7XOEJiUX3dLSzaDXtDa5v6"
+    "iOzQ0CqONBJkzt3FFffWITskBM4/I2nv4hMvZBWlMfyBYSQjgz0HEnCjy9S9vIocXWGbjdMHmQAzFbr07WjfcW+ipIN3"
+    "/+W0HtofRYCUjp1fn4kKTk1H2rZFndBYabEZO7JvRhOhzno3NO5OL9C88jZ2Jrdwgzjtd58nNF5f18Nnb/FDQ+a54ob0"
+    "nAWHntS2C+hDtCw3qDBy+X14BpM5y2dKXo2XLTJcRx+WVXE2J9dzTJp9Wor/bJMqZwkv3wpEblEZ0sByYPUojGdUrTSn"
+    "TPLvh51gqQ9AZp9hqRAZO0R9K4kHqLEBsRpSsS+rEw32E8fDOgpkM1GqbBqso6H5HvSq0jMcifjymOfnp2IsCId3ybXw"
+    "YxUv4jWTfRoBnw8HJoJldVgBm7I5U+nQlYql6TCDQPB9CL7+Rv7k6GDfqYU+1f5I2GfEXVKF9v63La13iFmXN4YDt883"
+    "eJzI3M+q94jhJ9etGkk4xzt9J96cASnZeI6xP/obMrMF1SBxAx2aP4mH/zJ2y92J6KpkGMqxMEdtnTzXaplEZpf4mrs5"
+    "dTaqFe5pladQfkmBE8Gq4+U8cX4yuySlT5wzZ9ZILIN92nTdS9dcKDP+7vgisKlrFRu8QV4duVgl/XWA9/SGBw6nWDcH"
+    "gGmsfrIe2mT82H/gnc+7meZDz305vEeTU6T7noFklg5fXAUTj04ixqMXfEYVFGRj2nDi/+KS4ZQzDjR0aDqqr3BLGkp4"
+    "Js3beCP1DRkvt11ZT1c1Z6BEENxa92b6yzKUCFXHEpCztl85VPIWA2bW+OqP10JtqXZq1xVK99kCNZOYRKLpnnxSjD3S"
+    "rgtgyfA9HNWDNIiu+yVzOKeU3CDZvuyyxqWqndInML0vVeOH5X1/4MmdFuqwQB+x33ic+v1jo1yhJF5GZ+Mi/Y8TpZ9y"
+    "/h3bKQ655g/3Be7GnyrM2pqO5GFMAKrder+E8tjX3lvhrYOs1+x6otJFa2RkpM9WswrUy2bGK3eoME4ebiPPPxYAHIR2"
+    "0fqq32QXiMiZEowjgexUKB+cZwpsEpBxZj/KtpTeE+1il6Ru8tayut6cuz/3uE/sXLQ+qSTIyI7F/ea3tre2BwQ9Vete"
+    "cZqkFLa0kVvzyBg26kIT36ti/gDzArq3+i/qbkZF+02+0Wiw4FY5e8or6d0N3Y3BNFKcxPirqvLUcs7wMZx4Uf0+usbR"
+    "ExR4dPK7jIeAU311aPPe/fPjle4gbFvb5gdGTwu3oSnvXA1Xtu0/DHtAZDakbnV/nIOKroFF/xg+crfvRiSoKuQv5iae"
+    "vbnHEvHbfSb0a83hqqmCyU8hsySEALhykg95P+tTcYlMTXEHWaPMJjpa5JOXmkcmAusX2l9vAU04x53UpSJy4rOZIL+f"
+    "yRrqbQs/Ga4/LsnY6FIPSeMox032yHrktjdVNF49U8P8F/HHwMSIoYHfJbPOs18YggBCcs+UyFoEF//UhpoJrAU41vpB"
+    "uOeCnkIMIlz/gA+eHrF8Si3uts5oh/gGoGjNQqLDOSarUPqfn/CjsFuRGLskOPxu/O2ohe3eBW45nH1m3ZlyCeBE09na"
+    "p5WouOb54pxhshvw+lJnK12tZsZBEKWiopICVGgTiZS30nBwtFZROnbfvH1s7JZo0x62h/mVKfcx7lHhI3r41ZasCHox"
+    "18OxogYN5FzJvqasdOjZjDgRSZyxY6gF/AoO0QoJ8bk7xUxahcKi0M2gizTZzd2KN+RSjU22e0KezCOPukvC327FIQEe"
+    "jHBTF3nWMkuK/RX/yUts/5GXRLeXR8iPoZA0coEMPnEmfFY6WRInl2mHOUthwplDJkR1/zg8TiP3ZLGIyYWQBG0LV9Jb"
+    "GJGQmtSZhhYbcXcocL2im61NlQ4NMXRkOnVOL5d5ZJCaD1wka0zJT9MTs80fkZcoS+GZzoa4kYs175G5FledmokN/lx0"
+    "DbJPx68fzjAR0seiCgwX1KACwxVJR6BAU1AcVsyIzlkVAx9ogQDvochv2oMuYbBJZkFoEWHixgaAQGNDh8NFzqtqd72x"
+    "8mXnKgCLDTPkC1KdFFEBbzeweUZ2ruq2llwFYz3TBgPzkIK1p/Vged4iMPb1ghRV6P2Exg/J5QIUAadREZPh+jCuRvOQ"
+    "hzoowJpp7fIk8MDoxDgnnvKNSrn+slvhyalBYQRNZPOvHuMm1CRaUPs4emWNoQE5ieA4iHED+jDhg6oBp+p4ARBm5o1k"
+    "rm8in18NsYtX9L1+1+a1YagxNLk18MNvf720VH4UhUoUnOc2ZInwCRqlh0PrhdF5xB4FpE/EEfAqqyqB/3Er9cRYZivA"
+    "t0Hro5qGLJ7Rk7Pi1mTAUIQg9CZzE+fvaBc0nQbT4YEW02D5EZ7ox6Evz/YujlQ6LVwGzI8BzfNqNffdlp+Rg7NDx6iz"
+    "qaJvcgMs8J7I9MWXbCBzPbLoTX85zEurQOEz6VJkZDDI6U0iOFUtQJKhvDLsNUSpvIIJ91ClgdikBXBaT9A+erHsOpvV"
+    "okIYWeF4INGfRmCpCsJLmBTGyGQuoXAxPiANIkKIHzB0gMVwTb9wTnTBvFsmSKqC9kUy/rbgWs9jM0TQYVVP+PBMB72d"
+    "oBnAQcGhV/milywwCwHNc2i5Ml3LF/kUDHFg59MaispkmXPzJ/Z8VpBUq0fKB8Q92MG7HFz2Xdsjx7WrO1H4eUiR0VUP"
+    "n6wdLWG1Lfxo5PzkCYkuifgUy/nyQFmRej8Doj8LHoNCSsUmH3ia1vPJ1wR+adxKwOoYnwpnVaAziMc4r2ki7VVjiNUv"
+    "GCGxWuAHCYMTQIArua+4dgj9F1WLmOQYCBFPbuggM8zaq60JYzq+y+Rt+yCEC6pWvcxVQgl5SDAMaVwZs9uz+t1/aBL+"
+    "uGywfHXQKCiBnsg5CmwVhGX70y9DHw45md+6MUn5OkN+f139g/h0fVqWeOEi2i5+w4+DaT9D0X1jG1r/3heJ0aPDfEpC"
+    "Tkevwm/9Uc1nUK27+6IkpPJSm4M5KVwXHwTVRebB6WTDHWXMexGoHfPEpmBNC47H4DVAQndv67521PQcQYnjZIGFRpw3"
+    "rAUVILNH2hyR2q8bYxyT3Rhz7l1pDp4YVgSkIDugDMy6t7J2TVHD6xFCboDGtUwf3DmF3af4rQ/M0OC7xJQxYVZVLA6D"
+    "82ii2uw7dflx3HU00qE8oWZGPgJQLSHp/FlQIKNm862j7iZHTIYTa0fNonqgWDjqd6642fiCw06iyRX1FEXGTBRJ2ENy"
+    "xRLgtOQgZj8cj4Mq4sxMp4/PREfjD2GEGMwzjA0SW6yNIYWGMqAUkFSx4IRLNml2We/fGguEiU9iZgQjZoPRUXH4AjDS"
+    "EcWXFaiwaBk8K/C1Md3nEGpAqql9O5rEObILYuHzIktSfj9CGNJrK9RGVBKt9/0JtMjQr23NVf8fcfeQIAiCAECwbNu2"
+    "bdu2bdu2bdu2bdu21WXs/mL+kJc45XCBJrAdlmiYd79ypObueD5f7KUExTN7Aapjw0AwTrg4FwKHqimAV+g/ZGUC7ntN"
+    "RXD5wcw0mBh3bmBCWRi2axz8F9X4oi4yEsYxW0ludsEwzUtK8hA3uYoa1HEFutdwu/gYLU12GGhoGHR05XIyzMgafASL"
+    "37KkqWdR/xWh+boIVur9eIInH+6PTI4ASQ9TTmz+mG8vHyF3EimCzAICRI3tDz7+OYnxAOvUIhWUNtv6LGV2U+cdKXqa"
+    "360kpgEoOFl1cxFwYhUAazZu/4HQ7QrLRSj08Zu6YKljd1SQsxCHqEwjC2WyS1I1fm6M7vbEGTPGM21V6mPOqdKurEpK"
+    "OlNOg6NYNjy7dvYP+JVZtViW08Wb1Xa66BqwsGsFeyRs8dr6yK8FPTFL8JIZM9N1EjGZCqR6Bvnx9aNRaMQwAT43YjHb"
+    "Adb8+UkOsRyWWgzr2hawQkjdFIVmrBktoZf9Io7E6mDPCMX6pEY49O+s4WaMtalQcTdr+nEfLdoMT9zL8SkSLU/OuY23"
+    "oT6mOnYpBAGgUeqGtl9x1MTubS4SIGnyb3RvqcD78ONWvq9cZ9Cx+BTM8ke5on+diQn1ChFy8JtCi9YhwDagcrcyKzuP"
+    "AxgDqIH/tX8vYOukvJDYwD3dw/Fs6jyBRFOUYGhrXLftIFJxSyG6qvT/cL9vY7COnvzXShQZqRGUm7uAByel2R4aA+NP"
+    "8S104ih7OJpDcPNwaTp5JUaoq6b1yMfe8E663LsA8XjtzRvwFFF91UaRXUGZBk9U2lTp8l1eUimbHzcw7khj0rjKYLiI"
+    "8KyipGioVOc1BG1fBX0F4pGNnHk3qjOlhGZ6IzKvVJlLOcuIxFkThp+FTwTj7E2R1ECHyoorNmJl+gC4RxGt8LO84yPQ"
+    "sdkBYEpssGQktuIDVQe7QoMAbdj0TKZ+sxENfFPq9pYX/VUe2e0BSXn5uMy9oR/cInngkhaQtnvttrkbhMWAHTB9tyx9"
+    "M8/oMqRtgXyxAV97mhhdDcXUpaPL9SEq2J0cvKKBhpDgW8EYX5F81mFQmQJobjRnMIWBsAU1dU/8SnzUZGRn11S9+M0w"
+    "Ea9vI3+MeZH8sLiZIMYQYhwJBY/FZwOKQOAsBGC0eQBRjCiEgKlRem/fgQ+wATQQtXo0pcWUJcyeBQwKpwHtFeXRyRAI"
+    "dmWhVmG6pS4TZaxthLUWXZXKERrmMdomHcuvfm36iqpa3rz9sR1ZXN5hcqmYetQodVMwpzlzicOq87750vIx8lqwPsHt"
+    "sEaJOUIkXY8BYETGOYihCLxZJLgcIBIUKJl8hKCkMNCtxAOxkaMDQNqwMdQ1Qm5pq5uSKQBF4UVlcNUwI5e5sTuRSJOJ"
+    "eU6QArmck/5CP80v45w+ezMISKLbHAwhTxd5MBYpb2zpSfu9c7NRtuxkwHBMNG9pgVa0KF3tR3gS0FWCtyZQQ0G1wwCq"
+    "nESDaXTEu/vKIXXz5NRYKAFidWWBAynnUpF8Neov1KEpacP8TpAEypV5OBhJ902YzE0N7O7S2hOYPcE0L45b5Z8Kn7ec"
+    "SFW0Mjuj4z7gEiRi5ED5k17bPPs5wPhOeYxh0fAueAKa7PhBWxG9/Gm4uc57MdYaxIk6101pAMVTvw2kzPFRbvHUY1Qd"
+    "ccomiOUhoTSY8uz0bTH4SbH9TsfviFBeTtOHoJVzQKXooTUmYA+5cQpRMZMtoFzzx7BFn733KpE96Ayw9hr6ewmQi1rT"
+    "jWI6XOughUKm8B9IBPch8x7akf2yqWi4Q76I6ddjKCAqced0hLcsI8t0LmrVdBlaIhU2BJcQjG/IMUMmzQ0SYAnDof0Z"
+    "gFT5EbcZMTSJfS1kwCpISxIouG0kpLNogmp2X+boU1vwW3n+XT/t7nb5krT5A+0DScwfY8VYMin4q9SfIb/KeQbgSmz2"
+    "IMoDquErCQQ5aCl+5JmSBCO/mdazF5HmU6AiguAC5fDH2Tfrc7Rph0C71Se3o2TKCEFSiObJgxXxmmKI0yOruxm76Juu"
+    "lpjQC8kkqnLL0gdju2glkhUvw/sZ+nruotMdwmxQKs37DwK1aeI0AYZjHzERBtUBCP1TQXrhLVM1R4EPdiwOZ9aNhJEc"
+    "UTQopiWG26PHk5TxnwXGQLlDCDYkjF5v0IY+yvJ5FAqcwALTsXaFpQRhJYogJiagA2SFsiJiQqqtqJQrTXXHWIgGVFQm"
+    "6j9DSeuJRhoyp7XTgurA1UhpmuJ+4FAwaH+f/OsufJGaPTQWK9KKJC22U9N7aUlTbxt2WPImTZrx41IZFnra4dR2QOcp"
+    "l/pjkzpfLWkEx1f2ZrWgJWFoFwyEUQAGQKNodmcBvbZxYIqydAVFUGCBNkFmYbi9MFOuaw9LMZNSK7Ze+QT8oCwOTllo"
+    "m1ADiAulXFZAJAf4rOBJjR7AviSTZQF2K+CnlTzVLWTloFUfhz4B6b1Qho+1q2DDIWlikU0QmacO0xNFqIGI2EVJrZd1"
+    "jkaIEADNlQMQ77LgLqBDhMNGAmeH5phxaEEGTUhFE0KGyuZSp8QxaOrH3p1hL9Rk7Dxoi9Gx1nyxLDzaI/5pB8PU1Mm1"
+    "JcRPtnZFoZeGcdCqhk8YNXSLCd2L8NP1WcM5h2UZ2fAO79NmoHlJq3/hj+IFTeBHuBtykrPK0RTTb3a0r2IhG+hRHGrQ"
+    "xVmDKOemC1SBJTITJCbgA/OBJkTnwbTsYHNU5pMe7rbj2YTd0xF/ne112rQcb2aY0zil+86mUI8OKPxW/frIfQmTmUZO"
+    "AJZI4xGqbEpM86kbt7wlithICWEMCxaHGV4/R72VW6DUvopEKcmCzKyyMrnxMReEldKWZS4WA5FGgR2ZRlhkpSv7BgKo"
+    "jRgJIORFoGriPppiJoEb7jSXhqwo6DPP0oGTS8WsYdYPH9a5dLvU0OcbG3Z66wRZgt0tMhqUs0Swwbto6RxvrPhdMh8d"
+    "02SUZuV8EZJuhrnpetcKZmsF8yJ0Kbp+khCL0DetCUzr3TBDMbBsRO5NFo2rKx6nk8HAF+H67qewOL+dkioO5Zk41Tpx"
+    "hn4JgX4aN+SP8nZ79WQrJin4xGnB3wXQ0ntkaP1m4BoJCbMC9txka1bX+PM2JDo0CXfR7yNxuWxppl2caLYgRqePEg51"
+    "xGM2A2Qypo4aBwQ9uAJ16qGovoHKbLXfesH63FUuwyIm0IdixbvCPWEkIyjltU66btUjTzvhtN/hwN9SlNtMmCcQxDmK"
+    "4YB2EtnDrj/AUG6NjuXcwu3yaTRqZUrahbocvq6pel/M/LwOhV8NHCH8FAr92DsTYB2/6GjZNQDEgO4RPL3jtKE3tz5Y"
+    "iom9UTcIkaO8UBJEAwj4g+AE7oRzltTmTcYzeVTaf3MrjJMKbcR7bI4CzaKW2758fvfNrHlBJka8+nJGh1KcQwJpKBl3"
+    "MD+CJtht/UKlrsjEEnj6J2rWBA5u5mwgEoqcw8IoN+TJO8cjff3PDYGJXLPD12atOrFDRSLBa48cXeJUzuIVfSIapzRw"
+    "nne/PZMN4A4Y3OPjqmJbQKkleOSHwL6kAOhfJlexit8seKK+80p9Rm3l0E1u3ULVHrLWFaES+V3e6Xp52NbIXaxzSogV"
+    "8qptzwxctZd2vE1MVbB0N9naHnC7mlHDozz/wKvYpUKRdXUrKsAHq9V+bUnt83tZuePWn47vtX7O/URshdMeemmq5Slw"
+    "Ej5mrHccHP+fXe3K4IwhPbwW7vaZ+ktKQ9DvI+3gQjo8WoZVlFmmaWa73jrRdeXRG4nKXVH+ukcztvf36UaQRhS/FVC8"
+    "fykNb19y14PxzXTbckrB3/Z2l+MIKtKNlynv+yukYPHl360qhrj5orfyReQo8QQNGXWfi4tduLXIrHQi7Wqqp3cyAZEu"
+    "RK2UQp8MBopRCV9EI8D5HAUHmo+Th5f4RL0oiYD3rDdcCbJSo4PkylVBrhs0ZvfDP/xHczzOqVzIzJ36OgqYPtMC6Xp6"
+    "ZqBgwRnRq2KINrg2Mk9WtyVBuzCY2kIEOx14sI3KIL+MDnqjeSZtisQ6wc2goOp7WXEXM+nGXswE4hyUBvVyutlCRZXL"
+    "TaxTayMwVZu6urQUk0qyWJCtA/XHCVW4/snaE6hkDs0RWaKNY01h5bSNlrl3q6vchLkHdvswNPAGYZ66+69bUGcwi2e3"
+    "dsMuwK6uXCbBsyL1RPtZfspKt0bHbW3D0al1fqHUTlciIWicpynspxK5zDqwkx1Svo+kUSIlki92+nb5MbwNpElkGccY"
+    "FcLiT+OEyTsfCICAEd7d6iRmF+VImNNYJ9c2BrWXd81fQaM9tbYNW5GYrUyJ8F4SudnzezTPSq9BXfWlARydWRMMm9du"
+    "69tKm+GzUojAkreJITvHk1RF+cwG53BoXR0oeWqGhChyk5CF4LZ+xwRXXnuTz4s2yv4lICl5shuoi6ZxX3TyZ6QMKpVc"
+    "ALrcF4pFXbRbZtzPPH4OxuuVe98B5Q5NMfh9jLmU6/Sgf0l9odlk23X8T4u/UsYiDlOXlNYcX+TMfTF4HuPD04eTb842"
+    "iWlX6659fy72ysIvZqDDYzrwZbtQA2YCTmwSfO/wiK5cvuevOAq/XLeiykK7xU9llhCJUJIoS/Yd8hQsZItU0RJIsUrg"
+    "a9VsqPfVcYesBvV2fYtnpZGZICukNMu6D6nFPIZ7JJeQbAgnffjt4vdFtPH9HvToRiKMxH+lpF7Hwqc6ku9gwSqISrCP"
+    "EvOiarTUz3z2xT056uOsEXYgJFUTQwh3MoV8OR77Bf+o7kOYtVDhnrc8gucyZJOOMUSD5VVIsVsDJ+I7A1Q35epyXD/r"
+    "7jnSMU8hrYKIYBd1+kDmJ/DLop3Thqw8vdYC5hlcFtggIp6x5Fw1mb4rGimfF7gNoxLx1uH8+D9AqwtFq5jK/wXz/aPw"
+    "2qTmaMHvWxnlHiSOmJ2IPOYKee03I38sBYLVjTxsCXFOqa1jTvkn0sqKfL5n8TIq6VR7iOMUd8U5OkabbPha6itqbeli"
+    "HXWU/WZGCNTjMTn+bB/9IJfE5aO1TVwyD6fKMj8OCjKyGlsaJhwAjkYeUFqxNOeEM74X5vqvc3hn6zZZ1LAZkmUXMbKB"
+    "k0g+2FedSUOCT1j+UtFbPjlW1TIjVpI+XAP/2xbikLOrJSZJQc/4jFu76EqxkPwj1UIWmaLlNVlqwg55EDlzF/4FF4DH"
+    "AiAR3N2TsQwoZOk2BTjFxQ/7KxaIOOw4MrlTaL3kM5yYVQsdQB6znH4gdmmkq3mjFKAbn/KIE4Ei3IhQgMKMWTPAgF1A"
+    "kZdLoJNI4jLnF6JeN/IRHh4AEQ/Q+q8clmOOeo6dgbNYxbZ1vZF9IIeltKOLeZapbIntE/J5GE5wqXegC6aSKl/Pt8HH"
+    "tIjn13juXhXOATVUkkFiNJlzeHHs0IEQh04byTDHTaPZFfXcWk91GbWTlLXfNxNQe/STlhPgSqE7t9uT4bdqgtSxN/Nm"
+    "BIytSP8JpJeJXylo6RiDG+Q4VJKIl2hbkZtUlV+mEwOejuYVwSd0WDzU1cudEG4/zi9aSLOXs3ohSXQpYC4qfW6eSjpA"
+    "HDpe3uWNCvJh1fy+JZKY4oyrHQdE1dJlCOi4qc7wt4WDIPO+R4AgLCAyjUd2B5+h/cGNfzDlESSgZciZbKu7Fu+/9i9Y"
+    "oSuJDePYYyqG+Nm9sM5uLSDYOAbiZbKUwPq6rHHdT7E9Ttp0BS4WBnJzD8fDo8hSVXMzjTrSOEowDQriIJnRqDLx07NL"
+    "uFwatJE38qSdniXmGQPuFYcm6qVhMFOHNvm/QQyeA8+mD/fZWKEbk2LBC11lbgFaQ6/pzNim/OLfDHSm1Ysm6XKtx9J6"
+    "3auGIm9X2SFqEQcW/2GNXEyYIQY4+NXeE9tmhK44XHWbyD9jWnnLMYcb6G38gM+E/PQt3dHqHghyRTL+89N83fe1GUE+"
+    "DzK50+oDI7aYb0HjzkfhcN+5NUZtMevDf+LuuLK7B7CMYKtyF2sex+cyb1dXiiCiNAcKTfSP/mFmFOMC1PIFXSSmzp4w"
+    "JASs6G0rtH0SK3nImRPRQTVrfPmUUoqC9E0lItoFjo9ZNcXZbEOZvcDHKLESPeU6XXdk00SAiVBCDMhNeEX5Zq8KSvwr"
+    "80k7WhqQOBTZK0lklylZfjxUt0grCjaPnab+Av28A5kgIrZT6kjCPhvDpvKSwxtISns0aMKLBGUsF+snuCVJ3x2Vctai"
+    "3m23Y/dOSiiRCde6JaBl5r2zTrR8dtZEPaYj7DrfA6SAZJZuUJjYa1xq0sE2UIPKod4YOzsoFg6D/tpq8Pv20wUxufNp"
+    "tAUZtc/PBIYPACkN9uKM25YynhiCMlV2wFQEOvoEkHVfRiKLX3Px0ExDCcHzkPZoBw/6Hi0R3TEkQmmtuUUvFm9CZVWc"
+    "bggTwq9joi55mwPyP7neSUyN0/aNh0jQGCowHBVqpWTrcuUNJ6mEO0ic20ICC3OtePegsIjt9pVIk4FMf5/iNMSFdq1U"
+    "7j9qKNNi7FDr0EshqYI03AuSfvaEq17yKt8RF243HNmaTtIsLBNmcPypzRI2+VB9OtCjysVVGmERAuSxd/o0dwBKBMRp"
+    "W5Wb7cpxxFOG7yeNgRID4b4bfsCJWhvb80hqwZFE5ezkTsZ9gz/DA2GWa+ImIBu+3kOgkuQaOPnkY9EzYNCn1C6FW/pm"
+    "18Tw/T7EjSpFocYMm2uN+CqKL551lIL2ARisNKkRQcpQGhlFCKhhDviRPMT3qmPIHLE8JEDB0KJ+CKMfGtjoqGOQ1wzD"
+    "Gvsr91BziichlPVKxN+jBoI/MxLOZOcJPDFusT+KEol/dM/rBWyF2D8oASzWCupYau1Y9GK38np4aWq7wNoVVh98ZxMR"
+    "c8oQy0L8tZlGkOCSxmXQJauRrwR3LEP6ZoXvz9qleYNVgrP+/Qo2AFKYGTD1ZV0h+4rrIYTWCYpL6pq+M1JihU0sJTwS"
+    "22eBKoXHIbC/8wkHM/X0nKLV0M5w5pk6ninCDap2OtifsYDrK6lIWR4XSabsSpyAFs6C1PH6W93Vz/5AYfBDiJZVj//8"
+    "aF3M72Wvqki1zsqh09jvY6Z2mVocEPNgMjnBuFc88hIPkJhEpSrrl4GCwJMY1J5gpSVfx2WvdtniMffcHGmeZrErnec1"
+    "JqEtU2alOKw+goho5IYmcFIrXECyMIGTN3iF5Ek/yJ5NddgAVldKAbJIIb2ljWXw1YFathrdYhsFNeYjSjKes0oxwVIg"
+    "b4EzqIqTaCzQChCqNij7IAebomsWtrqR6iABFnbaqK+hC1E3z2glRcAAcsDrwnKju8Bk5njycnXRg6bHfTPX/Xv/HoI3"
+    "cJBqdwRNaSUcRwApthzI7vww1CxXW7UYMU6xEk4opIok/UHiKmRxGdZ64ikmtpeTLrimDn6/9mCrHkKAtW10yxDeFJ5X"
+    "XMtZM8CZKZfVGhtPcrvo1/se39GRZ+HZJq1YI751+H/Mw74SxrDwUceqWalxlPvISS6DDTSkf1Mu32zc8s3y+m+saoN3"
+    "GVc4qsIIlOn/dc4ROq0vx76kpEyfWoq9clSwek/obUlYSIPzpY8W+b2TopppgDxvNV53BNjdHW8QAX0peVmYnw2Ihvei"
+    "kIJoUQFz5vb1XQ3Vat884Njgzin07Qt6gI4KQSlJnVA8VhrSfa2gLgy3dxYN2JSYmnOnMp8cd3AwkcTM3dyy7XuFwJQe"
+    "2J2bsGcEvErotzDyP1kkTN6U6EbtM8pYgB/Sy2mRE6DmxGR3mOzv48LCpNyfc6v1EsqYxZGomNiVHZss+45nbjyd0Z5x"
+    "DF5cfpcnb24yoiq7AYLoE6yWpL56BAkGgAgHNKKfDgQY0kMGizVVSLrwvDPGv/ZuXYLdpFKgv6wX/CqpRb4IT5C77/D8"
+    "vTaMk2p1sk6DtrRgoNuhkU/97f+wcAYAA6eNUP+2c7jj6UFTafGTAuD52wK9HbnUlxuv/mimgJt7b+C81XPmaUKzgIEE"
+    "YEvo58NzgiL8SkuKfpdtlk0JnZ4o77DFJ0ghjVCtzmAL94irRXROkMmt0hey0OLZ+fDH2bqpNgqsD55fm289e4IbX3is"
+    "mYGg6jI2gcNSYfHQen1Zx37XQDNIaF8YRNdF0ZxhOVrm8FKgNbNc+S6hpEEsxa7DdTZFwISfSJcA/Qtc3WKiNaFaBPU7",
+    "V/SRmJMwFY4uT2ZMTYyfd/GPiN7yFSKHbGTDUxa3bKolrSN5AwvgmjG1LrDr67a22oThNXcKBwD4fLvDIqEWPLJNR0Fe"
+    "gjtGCgx1OexudjdEGXcXByGqFNLeZtZPsuCHP8ZkjdB2C48AhMQc7+HFcEI9rs/ilEv1veWsslOhyDSXJ8UaNPYEec2p"
+    "jyHFQWumHuAFiBhMt/GCrcuR5JhH6DxydY98dYikdjehTZRluyZJCmMoeTZYRgcR/0ngUf3rfo2BAhIjAnhTSC5gJCq4"
+    "qJqBLjZFxkfNyWEAjCs1jp24ScLsPiDSafr2sibrFt00dho5RrQSqmM7Z5EkyCFwjSXFGzNn5kVgNyyzKzLaHBZZaItK"
+    "XE6GTXJD+DcFBX6oTJi5m65wCvoM7SwyDgNmCzOqDPHeYbg9AZDygwcXUmdIG/OM4/S4tVGVDUzKpvn5nSB+JD0ESKOq"
+    "C5qLjeSlSi0g4YQbi8sfAZypZgNaPkp5dlMKAAulIGPK9cBiR9vJbDIPqdgU729jVSpBzTeFp/dJrTwkwI3L3mtfAoRs"
+    "BKyX79GKJg3p/aIslQe2/ewTH5NXAZMqGf1+s3Tvgu2l72Lmes0Qd2m7rXtnH47JbIKPKiLzD/58U+njMfJhaOIrRG4x"
+    "uK7r1TpS8a9TY3lu5ZICIIUxTM6jcFQ9mm3LSLPZ0CcCh9/RgRUZuCpTD7YYQhLKR0E7qDthzhS9sbtyPDWDeDwcQrT/"
+    "ixwp1A6YCQCC5JO0CeZChXq+cw3UM588rUoiGMRCrbiIaOlGj2+PqkzMY2dabCp7s30iCiXrxOVJx352gclXWYLmFi07"
+    "pzzsQ2GUAd0Icy0cjoBUNKqOGqNIKB9TNlp/gV5ND1ARTs7LXFtn0QXSaTlOhf5jE0OZ18NVz4k2Y0xAilYUBI9JJ9Hp"
+    "tLZd9njRu6K0KSIrw8r7GuufhprAoCUiOj4Ybp1XJisOSj3fm8jGWZ2LEhRxJX4zcmpubVVBtloSjrQLRbtNRPidBi7m"
+    "zra9wzqljBNKGZPxu761MzjEHkwwOhzxW/gdbqic60Gvm5oB6GcDiFApq/8a9Ax7lXIAXQ8aJx2NkvO4IS5YMm2HG2fQ"
+    "pG/RKtwfUIItdQqeon8xvp61eUZFaAGW1ZwYBZBUUKVkfrmOLnGjv00WzCY2C+qmzYroT6nrZqS4LdS8UT0NY6ZyJEof"
+    "MvZW0c6ViFoJkm2RHA80TfwXKTd/cLq3oW3r/GIhnpe6v+t+UCqaXhNpAKNCLVlCNn6Ng4AA7Kmwqjz3YzwrIZEqEAy4"
+    "jBH5HBGGS4w/xxIycMoW/7JcGWSKq6iXOjb+oJ4Khgg/YLoZzHBLG/ByhmOOXdPaCynAhq/oCXe2Zgf/cgYXowgscjt9"
+    "l+AnI/sAl84o41KGKieBfYLClEJ+5WLc5k7PEkCamc4arAyM0F5tDNw+e96lfs0eGptKoDEwoNVbNS0gl3KXiBpSNdht"
+    "JDDlTmDwgsg/AOdPAweh6B4QTuF31GWr7amsG49iJ5sJz8hxf6dbkF93JxUqIAXRprQ5ReOGHAIyVjb4nhqp+hppL3hD"
+    "Lb7gYgQZfp1MbydLybylcnAEUGAnMzN8LyyA3C7SSFmQojJkOZ5dEQnRIBHQjDlvWQiE5cTvKkhXVU9AGJgOF+g270bB"
+    "2rZkf54sn19VDaYh6DdH8Mx32TkEM7MynmuNtk60k84ZvPGc6fzyDyPO1Fy1VsHAcoJIGKkhKjmyhb92bZm36lo1XOEd"
+    "lxEaPlyiD0AZBAhCKn0aFQ6ud0dSJcJL5ySBqFLmWJUiorXhbDYnFHC0FhUqaBEaphtScjsQ/HMqU2ahRFSY/eez+XoU"
+    "MC9Up24pktRf3gRnnLvuQOn4zjXOKoIiqSZhWipuSbxvX5E4QnXaEk5L8SW7Axj3ZlBeNdIYrCNmZkho/Vqc6YhIIj2Q"
+    "K9NcIv2gBWCIhuhvEfNHGpkmx+Xvd1cJGQBolBoSPD5EpV6YvbFwrPogUFP02hfBx10HtF045RMA8hUH9C+5qR4py7Rj"
+    "uLqQTqCUqJ9i+u+7kO/mIbBArBHcPwBlgHrFD6BFlgZQGCzUJSE1sHdpLw4cVtVcwUih6jh6zJobmAUA7iE7IT0l6XoB"
+    "ikAGaEnkcRkBBNBEmwQ6+1mAx1fYXJeRTYVXUDhN2FQJ6wXFQzZfcEhMWCBMSRUtDjt0wEidLis8fWD51p8vwQRyzptz"
+    "BG8orhrOBHo7rjEIdaH7Zsep/Hljm7Y+Nmt8LR0PKp0DWxQ2nE7mt3PKIglBNY4gPYEnUWaU1nKZCwkSGDBSH52rZaRL"
+    "wjdjJbj7ZS5CWpezmkGVSxqJZiO8uiz7FgwTdnIievh6T5jBTP2tGe7Wc/e4W3ancqp7EgOuUrHZ2VaPSmJqx2VbfQ/i"
+    "csFnscsnhjHBIzEvvQK3DH5p7Fv29XSMar1hnPk60OTbSMVKNCJIYlCZ9L+T4hpwSxewTzZYnc2Hb60L7zUXDjlpsPg2"
+    "hDEdGK7HTzY688TUQeSFRYl7hONCk2NL0Zlo7/SdR9oNuiVmMx1jlyyAZEMN3Mb0B0k5GTlddtNRu2i21LzHT92NxyWW"
+    "fub0oeiRANIcXgJobJ8pXNi5z9xwNVMYCwdwtlPfAHuaeSQvOFa3fnmsqU9Jtbvjb83YBhdTFx9N/Wc7GoiU1JmdUUvf"
+    "4FRsFnmDVu2cjzVM0lgVX4huntTMIh7SHfjOk0oSmpEboD7bcBd1xEqAtz30JFu9DdnxOPgE2LZtS8ej+tJFlM/HYQNO"
+    "jCw4ZEFcUNEQR7bnaGJvKsJJrbcMqKxT01f59gvml99RrFOp8tq0kEu/YSoZ0XpeJFSmIlKEt8OXLWSthFm4pOkm2GjZ"
+    "7brf5RrZZ8K6ItNfqWabNPYjYrxoEodRiiukkIdeu7nszNif3D1nZ6jBO1174/jgXoNFqMRNefipZsXakM8QC8XNvgOF"
+    "H7eZg7yN3tgerJg/yWxa/Pgl4HUl1YVrH6oISnzSKTbUKrPbnvPNijbZyy+JKLNZjrGtR6uln9/8QNV1wk9gzJeGq6xd"
+    "j7nh0fIF6Z9/Mj1SwKvLGjVfrSGiLBYgHMgLYbweAc8ZkMHT/F5LVOLrDbkM6sv3Zrr7ZVwHwdRrBXJCLx8j2FKEHGAA"
+    "PWlcd54QntcCZXPkxFv8oLp6JAL/EMNMCJNBXuQSN3ul28zshDSohzFVQf85D6IySr17NTP5NLoULxquEDRlLw1rThMC"
+    "8Wd3PHH+fA0BKWWwwYw0in39i+pG5DrkfazpZOWKoyIIko5W9jfLa8Q1oxZBJ83mNCtOTBQhKLFY8N12XTZjssUz3QEz"
+    "cm5t3BolQOyTE9zx+2SO0LBo1P5J8IM+eX4GkN5FrVeMCUojFENbr/RsQwZD6ybbz52XAjHemJg08xhO10dmmFapPYw/"
+    "pZOuqAPEX7QoFbzZXa4xnVB/qnXAdPqgb9L07vkJJwbOoD9sEQ/C8gW4EuH3WCVLOubB5wJfrVC+BMljBLeQUuTQ3mWl"
+    "J1ZZ072/kruEUGr9twqMihpDqCVK4WFS+Blk9yt/jgGEuLl/dGiG9mPCMBF4CQqfAXt8JB+4Kp+BideEnFmOKEQLAlJl"
+    "B6X8t17vnwN7stDh8n67I3rv+kMHwXkXUA+bARIvbAgMuewXkrLl6GIMUPLGb1aFisLmv9ySKfJhao9DCnq8AUwwijti"
+    "HQxivmp4zOozFRHMNRrTDGsCXizH2FsbS/XO2lF2K5zKXAYfiB6cw/ijQBuXQJ3PpY//K0k0pHyDcm4gfRfnsfXxh4mC"
+    "i3lrEqaSaIzvDe9j+Xv42fH2r9RBeMGMAqmkUKLNEWgvuW/UZK1KWvIEqfHIgiDm50y3ry1fAJcYZ/agc1AEo9Odklhv"
+    "bO8qZdtY27PHvG3P0UanMGoSkhGzTftClWowxo4WzSmOR/VdteB4LzIAeDemQf49Dnu2fWm1WkEGj19RS0/6nvToSMl/"
+    "vaxLzLNZpKttwj9omrztrZVZORL3yIsaAXX+R0Blb4y3AysaluKMul1t73y7Gspkq4T1qYmqwmUfSXGvav1eWpLxikDz"
+    "DwXkbKuzyf9zfqrDuvAgHhK3z5+MuOLPxoj5I4//C2n505H512j3yaH2myfTZJV8DmL1OBt7BmTtuGeQu3pzG8xLXEs3"
+    "hsyJOFzt7xs3rnfGuzWPxavOSrMw3IZXuu6oQZ+WV+cawZJBfQW8sF4/UspOL1jV3QzXdUICRyof5127VE/R0nk7XTyh"
+    "eKQ/nIDbauPI5EdY8ZliipQqCnb4WZbHENtJTmz8mvJ2b87sk0yIZY/QdcGjhr7E8T3Vz19deDPdPSBEy2YPEKFZhjZq"
+    "83rVn9aXE/euXM8YJda3ZZVAUPgMexXnld1GiGwEpAG99awD8PNbntpnZUedKBGw6ASVI7+AsjYw0VhvKhlOU6IuPQDt"
+    "FzSRL9cTFKf/qIUDjJYrajWiKquy+VCYSPLRdfGiN1WQBHhbu28hbnQoEYKBv/Emtz5+6F7KqASac74+vzXbQ+w5ewKx"
+    "2fPl+35yFaBk5zFmTqoIuWENL/djKDf0obIXunFftbK5IV5m2CJrV3Cqg0TNCZW7H41EkJwDRmKf26efh52zdzFlS85U"
+    "v547/O08Im8ugYFgtBFSnLqSGRu32DKwkR5hiyLolGH0mXaRWDk/3glErsoz4tXt1IywPdPjJdLLkJZM2N8v4XzOMOCw"
+    "oj/Q6f1ENHXaiQXQUagnGkLzSXVUvfVg1isupe+ZYbjUz5UaZLvrKjeJEkoHEHGU16U0/FgRApLloTACao98fUhqzAkv"
+    "koTNBEw7+joF9wy0Vb4YR1LGNkX/U2oPLaHTXcn6BT9TYXsJub80cDcwN6FUgASfdYxAMZARuJcuWSg2Ll1880L+xs34"
+    "kjOzymBb+3JshKX2pWarsyFb75jpwl/bfYHqLczMRioFOrNDmYrXuBm+2GfTYi0veskXfG9LA02IAPfPgR6bf3zDlC70"
+    "F43rOY2cFgWMahNV8gNatyG1fIbC8dvkSTpCfm1OiOdgzyK2ocKEB0B5jhyrgqUpehDWWYqi643/0MX3Sx0rlvBuGfrz"
+    "l7qy34poLwjLgoQq72DZO9lbuvmgB6ATQJs9u8clhKoDsO7ayuEAApFZqK7zun2q0KYAD+aNici2XZlJD6vr3E0xAHV1"
+    "mjoQAaYHhPvMYgO2ciAlS00tj1COw2kRfYZ0DXZgAwkDAzHBb2UjEDPPZdGsOkLTj6pOmpCJpUm1B079mBi1bvwvr4IP"
+    "fTWm7NaZw+48zj1pEvX3r4FjbDDI1z/iIYkXnMNv/boliY4uBc+5ptT+ROsPI6h0sXcOQ6c4qsaDRzBShIxi6ZQ3UEJK"
+    "SWpMzOQ+eP8mr49qYXYsDYvhTwTInTeIwkopW9StuRwsUg2oi1No9Ku7GOFUcGcbJGXdA1fuL+00NFZdjeXknKeMUCoN"
+    "sjuLRpifPR8osz0Cxpgbr4y6SbXG9Cm1w0krxzLtK14OmWXciBpa7f+mjpPKINB+ptHQrcBPJQ/mqc1BD97iRAY8MbmJ"
+    "ZdMtmPx61Giy07Xl/+XlZSbVVfCU9qgmrZC836InXK23W4h37IIEAsfF8RJl9EBInVKjVGPWYoAwzCRBRVp1zX32IQCW"
+    "oJY+V4+UYj0ZFE3Hqdlhy2DjoSmtZfjOjRoSAeM0SRAaMKKHlo3XcJflxvs6yWrSfsac1cNU29E68nkAxkResKTjmBDW"
+    "DJ4ikoduUR4OHxDNtr9GKSbt2B5vv4sC19hDh8R/2LLxH02SQdhS+2vz27KTuFwplwmIw0h0SRZO5+v9ka5MDrJ13zTr"
+    "D69as0iGEJBCol6IswWYZxM2u+Wkh5Ii03pOnRwJtU3sUmR78bti6+TPPjT1wlYn4kZ7FyHqbJ8vw7WEBYmQxcm/dG+u"
+    "4kulRGteBVssRpPVbGMHmwnt3i9K+Af4ISgQ4NmXDxuj0g+urYGUmuWoyxhUz72hf4c+cKr9cI2nQ8dnRxCJRRU5Vdf0"
+    "cEmQatUnuPZ9oXGjnv2TrfsCw6tsegoaeU8cLMzQ+BzTyy3wp1Ncattu+4xRf22U6OqY4ykl7malju9JHFxsiqisOL12"
+    "hRCrfEA2CcNZGf/qaFgzOwnAIv4umur3wBaU6X1uSEsISx/jwbhFwsBtxHXfawuaKRmRGDURoajY+rgPLjNwav0+heI+"
+    "VcAVrKVjdyYxhbjyyG4A/O/UNRanx13lfpcAIATrtiN4UArdJtZ33Nn4Q82LL7HwkTgWhek9sD7HUZATc56qOQbIGVab"
+    "QuPQ/4qQjuxHX0kRarF2yk+P4sNwz36cIOLHqvK43XjUhJ6YwThNbK4ziFWxJ3rEj4BggRkgBraIjfdJccnWPSD4UfGa"
+    "4FBk5QxHDHnCxydkxUgblYdLh3yJsBlYLG6sY3eKP8faoAY4kGztRzZXuZH5JYQNc/otCCx9KQGlCSpPoESfecxn25hD"
+    "s/HZAOnAdhZKzxziNStlc7192W/W1mqXtuNcxmsAlITJkWizH0/nPuIivZr2JtUbaq723SuOOZ6r1KsMbI5zk6wFzl7s"
+    "Xy4xZJPbySXgtdUcib1lM1XlHtQdo63ZpiTPB5SICIhZrIe+AB9NP8DVTDjcy174xhNhwe5dkOVE1DYN469hZmhZLa/t"
+    "mmsp/uSMBAiw3CIXTHTEXHRDun23+CAVDtytI1cNWajodtOXOJesiKj+9vx1EVzQ73mY5FaM1DMHQiCK3XvZJ9agB14m"
+    "nB+naruhO6mbkax9u9ylD4w91K9OHBKTisE/owZlFUYO1ba5ITRuJvFQiqQJiADOpxFf/jDB5GuVp42C3fvpcvkZi8hU"
+    "VuF1pKsGsqspkVlACFYJexIDZguVuK1LKOX80GncBA/k2lG5aTr5NBEUCIjj7rWzRw8Ce3boZeap6uhObPhO7NLOeThm"
+    "n9QYOYguU5cGeO/1yEaojzjNsdIaS8jCDfKaGVjfmb5NyWnJrGEUhJRsk/y5spAMC96BB9AFFyvzWsUQiigv1rlp5g0o"
+    "MFuK42i32NpybqcFEImoDVXD/F5u5l+X0Ptz3AqFT4FOWDUl/4fcTsskNelXcCGOPGkphilxi2h20GzdbDgFYR2jGVrF"
+    "WJNmh1wxiR+1dm2U5Y+1sifyaExcDqJnTNRJWYtpmW7hQzRmHjZ1QD//+iJ7bzOjPZ85RljSRuPR6jeq35V9x5uUFbBq"
+    "DnVRC3cNXeJs1K6DUEYhD/bANqNAWBGDdATMXT6JsETuBy3kSRfYiO3vo6h3djXbVKznkTkI4Ndm9rxXyfIDES8P7qEt"
+    "Ka8keeVb99yID6re0mAdg9p/BRgQLSEenBdOHP0JOuvF5ozg9xcPQBjvdoHL2PL/ml5IaTxsN7zKCp8YVIwr/QeGea6W"
+    "o1XuUjavPxg7qpxfJh4t8MGgsGm5gsnKzP55HzF98QI193yKOKqO5tNxoyRSbASjZ8J7rFI4d3xwuLV9CCVeSMiuNwav"
+    "1QDv8FKNYA4AkHZfrxh/RFXNvNK7mthnHEgsuHGggEHj8RpHNym15z+k+ObZv/Wz3HgNFbGkHrFWquVBBIDnCn/0Jbua"
+    "gHjiH5Qb/FO1ZYAW+qOaBCGkFiecUpyWPizM3nWxnkz6z/+/uJKZuzAUzMw0RNhYJNxGWafCUmP019ijnzPSkUnO7Kch"
+    "6EWkRejB5wLxy7A8xl44nUpXAajV/JCypvwT98WcMUuwvKbh5RP3hAaN6Kk0e1XxUVld59hKESsynCH4IKzd5bBgNZiW"
+    "jWDuiFsrv6oLFigz4YIv+cKHPtiDLlyokLKoyRi+x26lqpEiiSHso6JT0wG2juoRfZcACHROF8nZDXJy42p4+kHSBxjb"
+    "RK82Jf3bSA4gJ42bWR9tM4jyqpWOOZbEkILTIbT+3PypTqfBhJMhKuwnMQjvq8YGSPO39WNObpB2+K4hKmB8KoQGhEC7"
+    "CVCybo0s9P1nIdro79eLQ0CZfFfYRMg80FfkuIhRgfdT53IHtnYa2p9KJmIHo3f45BJfCA3gu9OGaPm+F+g4xlh9CAp0"
+    "qWqb4rk9rpZmx97lf0AA5+prRFayjQbdSx2f/zQEad6XV34ussEjpdV0+9606PxAOII8YHWw3U5Fl0A1QIuTGSrzJpSw"
+    "Lsd5qtXzipGoMqv1zxH6NBU85o/gzpFRBSO2UMiOQnW8NlPuEJNo0h81wXRSr0FOR1bYFeaez/IzdvwzWiN7OZwtHTH6"
+    "kZsYp2B0c20LNwRXYUVh3yuzu7hRpmY+u5+9/JY0020aCAyGNCxPBCx9rCmVPeQbG8cRJHIoBa7gPEfZ7ut60rSpDbpn"
+    "hNQ5ETaYPR5sQyzSTgAGnzZ8h1GZYFSjfY2i9YcJ07tEQ7HOpw+bMdxZoPtzT1JWwlQTsOpqx0kwb8nWbcr9xUIz55lQ"
+    "zEEgt0Hq3cki1NdY8mNdPwSlML3ZVnIXPHFqrQOxM4f6hothr1lJcLwZW1jBicFeMrMojUbJbkVYLosMXqm3UcQa04M0"
+    "tuFq+Tw/N3GlXxmyzMV45uSXW3A/2NTcpHU3AySoSqurlxTk5EEMmEHF69dpOxRHVyMjgA3gGdmy0yYdD4McCLmpAWTe"
+    "bYvvSLMCRNiHdp6Wi7K40YBX6v45sHxe1Mb+gWZl/+2/D0APTOIQNvakoqmmZ5hpc1CO+PL+UldNhAT3v/AlVdtDo+M1"
+    "cujFWPqzyK2YCmm0xiRvy1vqKqsHTF+RzCdQYImKcRi/EvRa6To+iq3RtDEw+8WGFpEsK+dr6cQWNDgmwpuDLNLRIpiZ"
+    "YBIxyhsCIuSlOJWFdx1U/vX8SO/nsasxMkNYFdreNz/1Y9BXfoN18KklWJWfMN2SBWL6G9wxERvNjw3cIlrQoCUKdz40"
+    "IuVsRFf26xzQgNu3/GrSTUfQqKpJsDEkPU/EyEAyLPo914mxkKoHpyCEO5WjnyUIe3l6aRIUC9p+Id08UtGSwe4ivFvw"
+    "OcfkAypktLz1zBWY+C65OoIJABBKkHIOELXNKyGsvRi9cU+MLUJO04RlsEGUrfaBgFhrZJ7zTW4fntDkd2GwFw0KzdeA"
+    "BkwAryatsRVLOZLaZ/FhQ+6Lmj/46qUp3w30NEad89mVFciFNFU9EJnwuvxhoi+n6NvBTaRl7xozXrMIHTF/YqA2ua30"
+    "hBvCd6SxWEu/7sbiK2CEB/j+DVk26Z4E/CRFXDtxGKJpTM8TIElRYrkrbLZ8kXZ3sOthAyEvqeafyoYrhzb9NC2RROKU"
+    "i0AFfUx/YY74aJJfDbwyrgjmSJrybwLhE0Kav34wfgeiyCzaXzim3OsAVYBAHD7HaAF+1BgnGqQ4ooXSihmRguf7FYN2"
+    "uNiuVtzK7nC80Aw0fV67Tqqa231QZ3UeKrUngSRZedh3gppQxeWcOOlKj01+o2oeO7wuPy6XpbXQOr4kjNUf5OqdTzB0"
+    "nxHzaEryIHumQSOb+ILfsTJ7FpBCEIUsH3ifilApAzSmUer7XB2bQDAeTtyUgxZtJZp6Pcxu9Sc642oSDYfcIj9fVfpO"
+    "VpRgHGMQZqK9XNznbh7Wfbs96DKb6lP1XkV9zP4KjcHaBKmYLjOGBX2sqTIZUf5KlSANenPGhhbOLk4JkyaURCGBSfFS"
+    "81wTqE5uQ8wLa1Ch0ZBVKbQLQGjjE0jrwiPy5OhiT0D+podLjraH9owVzCjtv9BOPswBl77zersI3GK0BxKpoDMrp8U5"
+    "3UIeRUXw72fndAuYE16VPI5OJLa7mdpqxsaLN56zXsZjTtdYxq4IBSkvbiSkF6VJv+S/Bc1oRFVWMtmKCT0AEDFeLLxn"
+    "tlvMkPfucuzEQN/lQi1Ihy4FHxsDp6xSPqw6lmbRiRrNveL4zgzzUUj8QavjDKQimAY+qdB85gpYaJRk1tvabfcWKwf8"
+    "8k5r+TTgceksZVQk/1q6jcKWPt0P42z11Bqd0bCadm+YY+J4L6m1ulWNZxrmerM8dkgyot7WchCun82h0LXRdKwFzz3P"
+    "F1hr5C2ZLKabqGl7tbLvQWjLnMN++tnzeJ25zLgMwnC+6pZRMbNm+oiz3fD10/1qSX9RwP45fdAKBr7VTK6cJbXIm8fs"
+    "jI7iN9kLEQMJG+WfxFcmf1tVS7cV3UkoD/I0Q7B6zYCgALkx/FYAqnXFPdjLVJfmI0x7Ec1bJzPHzluZoFgxOSmp9v/i"
+    "ce8SN+zuRXHt55JwRauOjsq+p1pJ+0HRX31mtWokGWUMyPGvJ5HAvfyIl3SyWG+DoPhau0lNe0vKxebdheE0Qur93/Cn"
+    "FF1ILQIjwdiJI2LmVH+tDG5zRRee3xCvEfJPHMNMBs8tiVrfVMXNv1E2gQwyA7zFtUdyeYqaxweUashX62YOuTJG40tj"
+    "Y2t4esiVAS+g1Agp1gf/b+AKemk6P0LobqxDjgoGyetLpUvJ43bSnDvwnE1f2W8ZZ+LXZqQq06s6NIkw457hFfSlp6+J"
+    "Lp0D+VJe5wDDIHARRufGe8cq2uUkkFBZ6IafXBidRk9B5Y+wCqO34aQLK8a1o3rt1w53AxK2egighQZcjk87TzKrJH0Z"
+    "oX21cOjq0zoIUhGYXeZrcJTK8gI8FLnh7mGyUp5ikfKlhRDd/bKRQeC34D7nx395gcSEDq6dCf1MEtlpCMU0FZTi1tw5"
+    "WCVkyVFB3BKEZqAbMl9xigEMGQApV2uA/+0u6N0DKTLYnCL9aUH6vZcYe5+JwMPyyW3pdOc2RnDD2S3p8QVO4rKpd5sR"
+    "ZtnSkkmRcUi2LYazDw6IBv/7TBlhJC1XHyiyphgNn2CzrgHbGA1elPD+X676sb4Pfr0ke8Wk5zNm4DGdzPOR+v4MGg0/"
+    "347ijFNHyQy1I3PyBuV93PiUa6vqTYCXqHm4Iicc2Z36Ee9ZhQ778tXYG5P0Deu8gwESHm9RLO9vPViCPOTs6ftPcyR2"
+    "mXNkPYUzoEK1eIsyDnyQdqHqls/MvyKl+5EeegJkVz8m4RaokE3lldWNeDlc9KigoxEuexM5qIim5qMJeyJ18wkrRTCJ"
+    "rlUy6FtirNlRFVDC2aokKWd+tpHYMEnaIa59qSIih3haiLMsIiNl+j30zN2s+TVsk7Z4ykVerAX5B47Y1brGq8JXgOCy"
+    "ib9ZJktHgCN+GwwGKWiBkR2Pup/APSJyyRQDAX5Pe1rGA22+eP32IxMfKg9mImjEYuT5OztL8UQkCka6HL9UtWYaBGTi"
+    "L1Krf8lUef3B+rztyvElZ/TWn6DzVQPnpuJs1J9oDIncAGpsy1VC4OVYxLc5WoyEB2gl9/DMMO1GKyrbsUxraNCpre52"
+    "vTbpttdnV+NfJJWpxoRpv6e4RmshbHJx9Df3BOkoqZG0CtnQlYFFdob6SZg6KmSCcHsuDytqa0oNiPjMA8VxP5VLvg0S"
+    "Cwlh9O+EoPHVKf71G2PURHdQcvSjqsfHRTtK6/Iq0cNt0K3bjEFBBLG2QGiJ/fZ0vnwz0I+xt98v6CDSUBDk/PMhe939"
+    "W/ZJCZOjqM7pT3RXDjXPiPw/f3MPmAd33Jzvpf2Wt1sU25SNjDwRofPtX1S70RO/qRU7Xn+7vdw6ltRfGxWuQwCdmi3L"
+    "iLKPFnjp2ZJXcmrTrdXGtD5y6uUTpPYnBCxkqFQp/Qi9ueEwJ+6H6R4YAhtFU+Z1AhASNJttuWDL9tovDMI/1frYBr/S"
+    "+66biEqJXLbw8+HVwL2qVHrbXNBtp0b1TT3S7UyYZGR+fFzW+7xZ4S8dZTpXlDSU7eBWVCkASyUYz8cc81jlVYPqrXk+"
+    "6nW/km8L39nb73SrO5F544vlR4IGxsyhyol3OyZwoZVQvpKVhZ5k7pH5qleEMvTvIqyhCMQR6VFAJSItxE6YI3WxhfBa"
+    "DbOjvvjqNL0ArfGMjp/fcoOTlQq3D8B6cwQ52LGIZH02uJLZSdVfGSVRu5iWrztHv1dFyHY61BA+IjGEHiYZv6keniCz"
+    "o9imroMYIQw8Fv+MLclu4W6mpec9d+CDTnZs+38siZC0M+DAYwGYm5aqpnUrsHba7Brf4v3gCqXmxZ7+9NWtKC2WKzwd"
+    "RHoo6iUTQTAxvFGfBNLiYaXUJETTepCxqErLZS8/jJO44YY87kv/4YZ1jJSeHWm3vKJPLRx20yH0C7hn6CJGAzKhBSa7"
+    "0KBcYyfPFDz4ZqsEacuqjXitJ6EyGhZTL1VZKp+ufp6Xu5ZGxxTc8/dNga/PmOQUf/dvQFsfX+XUjY5yUvV8hA0WpFfb"
+    "nkZAsRfFIgpnHhpE/mXmTMPo9vpZvcUEYi2vU31UQ5rfM0i/zrq7vDNSbDZu4qZpImtuNmaLDlA+/fxS4ur1jvpN42/Q"
+    "GV+w2eps8Ca3LGVFGmJX7OFGAdeV53qSeZbldIlZm3kSLBazPdryI7uAZ3Nwfxd4aGWuToWW+7ip1N0Ckjai4NGmpl74"
+    "ZlNxyKJ19I5RBNEM8BUt6xhyuz9vgfbrcdMB5oXpeWingmKwFbbqrZ7fiJbv1ctK9M53NRV15P1uIheM9bSt2FKlCf0b"
+    "9DcY7/2oMTS6krUMR9qf3cyejMflUMjOC5Qxt+HNv/zUOMm1BJlgYTsN8ve0ninLz7MdnLx6wpK87IbndLBW8rn8BNza"
+    "FTlUB5ktxYpFPNQ16HtAjp5xBnKl/6/9G1JGRWk0T4KdYaoqQk5R9kPvE3zdaq18OsTSp9tNLiwKIumxCH308gS02yCA"
+    "q7rCgz4AuRVE2N4CHUHP8QHjmQ6RnOxs5e15mIXMRTbLxuOcK1GxYDmzkUXrC/gK1mq6ThhbHxsjTq6Zrye4atcPHBMh"
+    "XiEQ+/eqIsqShiJ0lf+YXP3+Inag0p9PSwTZmCQvkCh3KhBc1u3NpXB8qIp4v5v9Y7KoKqudZOqqWI437IhKDusc8xSi"
+    "ayhAk90XPu6vVSyAOZ3a4jL2F4cG6adUIjWYUzPG7pdIPBNE6ogaH6jdpMDmld8MbiQP48QK3XiGLM2NFWrqp9DKyeO7"
+    "LFQ4kp/asGwF+4cvzSaZ7r82mMYTAAe1VyCByt2Oe9j9VJIe5g6ZgbHEL39xR0iuB/LnaJbD51+uhVjDjGHC2PWe000w"
+    "xII/x8f7G3Aj+SafTOSw/UTr1IhQlTgk9orSilSNhfpCv6xafInA3+OIYPojpfK+ZFeWgEIkR6W2xiym0S7QnN/D9boT"
+    "v0TuJXgLxBMvUdziYzfKLgDII8hOBxJW9oOaWx/0IjDRyCE1iXrlVYUIOxpdT+lYYwIVz34JYSCTNRZ1j2kLYCsBdT8w"
+    "jIEdkYU0zx4giQcNnD7o99QMiI+xPZ4Nwuc+pCF47X9brtDJ6EuF61qo0bsRmDhO7jnUzdxRObKEn04EnJxejLJ0+1RM"
+    "9eC3qly8vRm6jveeEtgBz4NJWwDFAzd7mLnpoXKswC0ySl6BiSg/yS1g1qnRnPnVLsMCky9X4Xdak1i8tExdR8qoa8QP"
+    "wfz2w6cw6C2SPqzsXLb2SSKFljcUHVJ70QCO2b357XPrIJnpIR7QfFVh+NI4TYkm7Gp3T83mfIoc87TLl2i0aiQEp4LC"
+    "oSgiuc3t1WaB8JYbxakvbXssyhD7OPf3mPHIU3Vn014PRWm2Nh85yUqPQQg4EKUJ5dIGq8xiBI+UboTKd61iiUwWL2P3"
+    "EglCy3YNNq+E8UwRwDhfEclnl9nhRcHIwP1l0oymtRJO27WGBuakisIuHyrLvss6wpurMJrD2P6KJyu8n0ELNm8D6ISn"
+    "axEnhAeBILAvvOQ8v8J8FKFxU1nPzqAOYQuemd1/TiaRSVHOmwi8WpVy7ozfqWBrLopt2saGKZ5Dg8zn0f542FXY4AUa"
+    "gxtYT/hCfhjyGoEevh7A5f/XrvdGkkA/sBcHBAuVaiIvhIOlsv1SfVPcEz1R1IHm1awXN+djstIQCIwvE7StC6tuKxu3"
+    "iRPyP+LucasShoECcO5k2zr5ZNu2bdepJtu2bU81abJtTDVNtjHZNX3vXXx3sNf+96z9Y7u/Z573MLyhcOFowFkRYR3D"
+    "e+keUCLMw7N8ydi15YNR1G7CDjFB5kI5M2EcAstsjFLwkmIxybaA4eglDjh2P1S7BuAc11jPv/rviTTwgKOC8aNYY5hG"
+    "eKe4sVZs0xozUXsYfyRfRr+fT4oevl1RiL4Kio2Bnt7P4fwrwtbcqmXVYxsi1fIWtD9JBYGuHiVzk0DMz8DyFhayrCxT"
+    "XmZ19E1WJ0ZJQwEz+Z74VZpXcb9MvlvhBkeEkIapxqW+7eQ6MFmtg+Hsdpy1DQa1qEmzJ83s3xBoWJRMy/bIw6oLBBXK"
+    "FbMI9jhBvn+83l4CeRoNBL4e0UVN4dNK8FCAGquHR0u8N5ZUPPj0Z37ZZbZ9h9LUf7918HTr005I+/CnyFyGbLEF1wMR"
+    "kUumODZugQ+Q+N+X/GkIWdAb7DYGIzkzLi+uDwVUVw6sSrJ1HjXWzzFsiH89ebCj4UBJNZhfTubwLaCbPwihuW+g673Z"
+    "faFmZEwFeZFd5WUcR91RcplzAmidI/cvFy0csHPspD36+rC5CIoVCz5EPs4vPHJ1R6MOtBVW4rH+eTscOrRiJA/9iB+P"
+    "RLa0/FuHMGP9Ja/by6nlJw+LnVJ/+YXijkAQWc4svHcwsfRh6ZZLfy10xvlXGLUl3rp6sYQRKUzvhNjziupXIf51aq9M"
+    "HEHXhJihbO6PKcZD6OBRkqA8jwTVfc08bfZ/v7XZdtdwpqX7Naxpc8Su+td9kjAqSD+qmQ9Zzwv7bVbb+Lj83H1E5C5B"
+    "BXB1q/uECz72dKGS7X1Qdk4LTE1sLGDyFWhZd41orcFmcx38mbNCnimAFigpANewCHOS7eLz05Z0HZS5NMHUvCYjcz6p",
+    "m0Nujnq2u7bjj+Oa9vTNhe+yHVRmFWeHTgoLrQujSKHclJN5+WC08sIc6c7X3EAzyIJx/4idSA9CzCNXg1cY4WjLTI44"
+    "evtG5vpDccZ3JZb1U/Y3PCN+hXFe6G9YMV/IP2gtPF3ipVoTIpVCVNGmBY1fXlnjfcWpeOQnTjrU4T9FJnpPwYgOqwRm"
+    "tjIkgnLP7Zmn3MllixszilMdO7bYZZgd1eymSx5bFDLSqqHE1XeZvi/uf8UwvYcya5ViRSBhK40PrrSnZ36x6lnhPlbj"
+    "0Wx18y8ioZjfIWvppzS52n7inNlUrSkLdmRV5aP5TpA9jcSJp9Vquo+nU9dtg8zCOj0CkdS7WkaJPbgtvQhzyGYf6KCQ"
+    "QlXEb0JyuVyMVapz03KzNTQDGx1R1OQJY4W8+mjSc7ianLwx5PSV3w0xuKV/T3o3v2LP05dE8vpwXXRcE2PszSFjZ3FF"
+    "BNaPiuNx5JJWJtr/HWsrYCaXg2Tm1wkNkOnPXgn3J9ix23NR0Xh+8lCrNjhABUHPztvl77ROuMfSxJ8ky5TIQskqemVx"
+    "SNV6VmJgYzw9eNQ8zZBt+9gbW7AhXuAIxC+q1PYhF1fjTCaMgr+nUqGRgyrmO3qMIYbSB17HkHhyHWinXy8fGQnmmcue"
+    "O1IWp1uNtTL0dEVjX7AHD2L0m/svjO4AH7yBVBhILvC1cEfE/rnZVddtxJ79qQwFCYoTtTJLLKZlZfZCKBGFcD0PsK9Z"
+    "lpfks56ART/aXtpJkXISAzGpN+mT5INGjaFAbdHv/EDAYPU34isr0FeDdy9AzzKpmlXK9+IUw1Xx3QR5dD2KdDDABHBZ"
+    "zRFthSlHvScMYIkCC5hse6ryomdgrxVWMo+0nrtLalFRR7Y0ztNSYb3yIY2ULZ/Iei4dl2BIWEklFuiI6d/9yOnBbEP7"
+    "5DD5rodYoPblyGmXTuq495kXzKOgdBqq14Ss3VEoDOPSBOWlVp57OPJN5Q1qzo4zaerF5WBciPxH86xH3sAjz3qDLN5t"
+    "fnFHEzLLb9hBJ0YzSlyFYrtVWWZvZ/iW6F6cC8j2eUBeZUwyW1RYOBTZL7Gjvl7JXEAwldfzKbHpp20Kx7/fLpbWoai7"
+    "roVFgtv0e8d/hQPLtYxV5JuaxayWqmjYXlKwyi5g6Nb1HiulWe/qu/0you8R9woVMKG9ApQhdNUBNfSQMZrROKQCr46m"
+    "RkGUXHxuNvkChNRsFZgjb1wdIRYwBQHsRhFmNzt/dHIY8rKIcgX2Sfwv97/M1C8E0L2zpvbHo0qaM5jWruK1exCxL8y3"
+    "kiYUA3FvjmDLnPuEp8fOS/PiBsY9p5A2lR8BrY2NCeHByHTaKzupRWqJhImWNztFlgdSzJOSkBNW3v0+DeGlztRKWzUX"
+    "UeCGQIDkJm5HaHLpc6hibwiZLHo1GbCNzqE9KVfe2Zgpg47Mdpj4dSpN39gxqail1gEiEByVYkZxJmZny56An2nQxnov"
+    "k4JLuFZ/b8w+8DIkLYxC/Pv3eN7w6oBIy+bG6e2/+XpwVpZScaymr10Wb817e1jY25mkzAVae3zrsV6NggyymmY6LlUh"
+    "HUknEYSnVoz9X/ExKpLg8jbA96ZBGMyvzWieyA509abt5Z0OHsNsO5QbJa+Vfhh3mPSwRRP0vdHXB800nVez0XlEYg/E"
+    "dnbdmjy7tN+YIFEvBNMi44HbL1mwUZlwaH+76BAF0OP46TEuNfcZKf4p8fTZic/jFzbhFp7vq2j4V4rMYzinV3CXTDlg"
+    "qwztWEt8xYgJi478jYvpEeGm8K1Mk6Wwv2peWQCzj0o5IhINnZE8w98d7s2SaBSmWzuwuKzOb2/mXDsKNzPxl6JF6P1l"
+    "aHJmhNUVuVSU/Q5CXqUkTqpdAvCNk1x9xkcQBk/MvRxvuJUCVnwLLKPnn6dINDUJbTqWn6pbyiPc8dLzUf0vNz9q784Q"
+    "p3SD7hTrRHOCuHsO6hAS4HTKhlwOOnMVwUSCxpC7/ETxf/tAP/Tl5s07Sv0TK7pf+mhalG/oRC0k06hw+/H8Lj6JIOuA"
+    "5InM9X3vSYzCsCL2cIxIMdPKk8Aw2TLOdZBdst/KB1SW7CHC4TTyWlvfxEe74AQvIRh217eqjOBH3UpLvLSml45gBmiv"
+    "dxg4C4b4VPSWQSfQCcv/MU+A+qmbTAV6aWhys6daEmVxv9zrFBjtYRikg2meUKJ3cj7+yfZMT69UQD3Y/Cn4LkJ4BfND"
+    "+jg31fJBHEH/pmPdKbqDXl5rK3+wT3S9hRyOvVC+iw+nxtB6iuWaHsmr+qqSLL3+2y+/Kd8YFgVLLgiLWBWFQp7MVcnv"
+    "tM6uxetpZHs2K6LwmSPL0HXCaNhe04taU1+U0+8p0kht7XMOCGH6vCaRadaWAumHx09ClGgWmA+hnhsQPenUpBih+P0J"
+    "blPOtrj1ZaFDxi4zgO+sQX4Ia+xBHFI/hjSSrZYN7wwD2rVp7kTqzw57QVmD+dDOE8aPdp30tB33cCGbSS5qcxxKfWHV"
+    "ocLqK9/bUZlVDMKnVzhDpSKalNk07WnamHJgJVTEuDY6dfUsY4jrUKPaYfRDBLZEOS6qVXqDyd1J6IETGSFhtuTaCAmS"
+    "2SlCz13QDenkpbkiQ5fzqonzTHOa2gbjcdD1An7x89bMZmHDepq2UL5AJOMMtr0x9DI0X0zbK7prkYEB6dY8e+fIBUKM"
+    "jEZKLD4T83TCpbonvK33ERuujVMEvogprvLcBH4LCEui4SoEV08DtO+rqo6XqoecD/c1OTPVXFLm/bgogpEViEhL50sT"
+    "n6dOCx//hrEWaM4F6GvS+qkgZv3nb/Wx4aGHGbnGHsIrFA6YKaJ9rDs7sq7hzNbIjqu+1fpwPpNfatVP5P6//YuAtnf6"
+    "780K71Q6XaR8QuoAvhYcH7bUl/EFxQQ+Cmw8aLRNoxL+RWcAIhwnULKc8yOq4MV1najXxnpMHLhQd9sHlMhmT/zhspws"
+    "U6aY/ZNaj4Ef97S30Upnk7uWsArmlVcIVBkW4RkdX+gz+kn6Dcmax147gWhrvN92UvDYTx1f5oNFbfdlG8DFknl8wnpn"
+    "ECnfMP0F7GJQxnsgFWXifIiyXtbW6KdF0JRAfM4UaOrPwG38mO2wzHrG/5iXJpAJX/pDdbe4Vk/70xErWsua24dRc0yg"
+    "he02Ji9Q8Gh4GkdbfSIcN7+EvkON/LZwXiMIDoB4aS8OkE2HisUQoq9mm579rnv8/ZZG3HM2UNvmp6+s41PVv6TMi781"
+    "4z1WxtKeTukw8RIPJr8fojEMs1d/V9rwO646qstf3+eRJmWp1yX5vjqoiLtNsQB5KX7TWreoCwQpaMAi8faUYJsGBmBZ"
+    "bHWmGgVybMhVCHB9FbPtSUaqf729t/r41Wm8PHZmDumNYGp8JkS4Z5Wgo2fw8yexDtG2l4DkhMe0Sfg8V+q2ENxcEYk2"
+    "PjIwiLKdC6mSuhR+EHi2rQ4MTVeNZH36OgWb4s6PpbZxCjCdmA1razX+ZUyvNGcdz0HNva/QJogmfX8HTUODrA7dIBP9"
+    "jWyU0s59fYJ1T8cCK4oqiWvjZ6srgiGb8SvnpLGSalx83us9IlLrtxFB18C7YC4mDwMnk5L3AMCjtOr0aqswP4fv60dm"
+    "SP4Onae7it8PW2vYiyH0PSXWmP6z1+zTAfnIqaLfxnwX1praPU5/9s/rgllDvT4zkV1REvft7dkbPy2hNPuXf8WSyTXY"
+    "18SX0TwG6No0wlyGJJQywBA7XuAi0ztkcVRr2idp7Pa61/0DXXD6p7DDc+cykp4K3TwzL2QpG9DFiQxZFxklnprrqjGN"
+    "1u5GdcrH7ort+8noqBNQk7ONm5EH3P7xfM4gyPNYMGlJw2xzvZ6T7VrVIQ4nxIqVgBM9RbWadCtLhUmKZVKsxC3HMn8L"
+    "4OqH0BgT8nxEobo4mOrXSkY3JEkgbYvgfy8NG3f1aDSHHxWNkO6mwFRkrL+wu+GpdrinE8AYvZsDx1Q4FuwoqbPga4DL"
+    "fhDpWOMg5Z/iwTjcZcUi5Go2TvYjw+An/Y3Ss8qeFPcGNZpu7cHbMaUQ7oh8yB4itr3cCX0KoYCbJPXPomF6MyFXNrE5"
+    "qnWmXNRkk60aPhD5h7kRSqaGHq2iLQQTi6S+kL3n9G7XCiZ1mOtEgiKL2c35ygo/eCGQHsDL85/P0JlAOkIVAybTDLN8"
+    "WHwFUnW5ahYk96cTlB/spWbYKGQPO88f6TT50ABf7ElVWrKF27vk4h4Jiwq5J1kMoxmo+ZOHILZYpVti1CYIRrYFPWjq"
+    "kuuEFURj0/V+6QafGhHSMdhWn7zjnKWBltUYocHTAPiqfTQ1P5OH0+10Z9lJi8zXDjm1ovidN0bIB/wXp19fIU6e13OC"
+    "j1kEv4pt1sB+5qbuUYPkT9vm2KYz4z0AK06N4AzFGYalRUM8pulueDZKBNE3v2HnOiRUAv8H78e+/pT3XrvgGVyMdwpb"
+    "RVW6xlFNjoi60M1b5Atet3wic+Jvb1D2NavEbaYLXIzyah1kunbirRkLaLL6m2a6G0ExrypzyHVdSUCdTbjWSeZgnDpc"
+    "J6MB5GdfmK13AUJtoZnDIZfIBnuKSf7LgUeYMRsSr1VRbI2SffflX5ddhyptlfFTWd5R2nGSCiw0bGl21lCXO7O+AwAz"
+    "yAPqXkUjX3qmlyqVKyhrh3M2iecYK8S/j98obb18kmL4zUJstsRkk6XEzI295C+CeSjuKbLIW+KOFrt8KHTZhk4onedd"
+    "XFUJLXIAPvElI+JxxX3zmyvBaddWQyff/TK3VFPVyhleDRFdftxTC66lh/JGzahSyPQyQA+kaf+EYKJnICZonfzrOa1y"
+    "dz0UXi52ShWPSTSubz+bEI6YyUkITpX4kW6RG9lcX8zjo06MCXGDgmp085Y4iFHIn4NK1t1iMI9/lNCHDUGeLpYVTbXh"
+    "1Ze5GIRSL4ylyYJbxxJtp9uIZ0svhKSLGqpWlYHDVs/RSWUUE3NOsWq6UpZ0q+w5jmFGigPRoiZC7kisXdl6otrZKi8/"
+    "uYPDgWdFsUWeyZlUiQwqrUlRdpxAnQALy4SfFJIGxosxJuEu9xuRS4g30J/lkzSx/LhBopIu2pDAelNGVEfNxA5VIZII"
+    "d3wky0O/MuvgQ+CUqQYPFI5OJ2/9Qlz+G3X3T7mBYCydRNL85t0tfNelqJ9i21q6ysYQYgoFpopU+Mqzw8j96hv30kYk"
+    "XaEN/tdtmOca6rdgainlyDAUhyVWIg53lj4WU1GGXbMiaq3yAhm6IZosEL5CJosIWgUq9qaUbbK6/RQFfvgbU67dpyYE"
+    "e+kff7aBbw3uM6bLClgThGrNYrjljVd4G3zUv8rfcdDu6eOqW/F515G2TRZXcZZ9SOFn1yu0oKJwKdYq4IfUbtatcj1o"
+    "UnHhJXQTFW+Z8McxOKhAYs0ImdaJQfsQ+MzQTL+OPXFE1HYRxHE6IMtzcCPJfQ9zPv7ux+oxQx+mwzOHX+ndDJ+/6URx"
+    "1UWhj6baKcb6wjtoRqTGzEfpYtEWKXviSE0VYOb1BMKkewHEcvzgfMs8kB01vqOkY/GBcgmceXbRNTdzXbWTsRt8tY+v"
+    "Df/EKNr+YtQt+8b7Mcfmp/QNh9pbqvwmDrhb7wMzg6lHhs88PExURnoTURS5aMdppE1JXIpYXA+9ke2WxXFOve3ZN99g"
+    "t2IN1Ee87uYSHS3kSq2IButl4a0L4LyYYgfAs9xo/SLxbyzhdX/ufjgOb6hzvuX21ggwDvOiO9tqmbHNFwLGMgZoTuC1"
+    "0nTzqEkHWiRCYwvVFPjI5v97pZQY4TW+Z4ZWQwGDXgvKT/Hg8dNdWoH9d8MKEghYV4J4SZl0dD86PJ1dk2kMJc4wKCbx"
+    "yGI+1SWvjG8YT7sjMgpjDCgFiQEvxDVVyqsZVUqEzZo9ZE+xdEAlOW8/gs/66BvSRUcyPS9ywu5MN9ep2L9d1D2ZytIK"
+    "puzxDMKnLsXWNVkKp9s+QawaUpiiN/P9aGJ6A8EWtJVLS5/YIDdRJZGRfMoVBBvYXA+Dzv3Cv/ElxMUAgumODlkJcu5e"
+    "Rak+1w+/vbxE7kywwnDZifauAdYBdcgk/W7iY3qtXj6HImBv1/kBAGd1FhSYpeQHtdDEqow4bJQaBMOKwPrTOK7nhZqC"
+    "n59yB2p8/59FlwKLBCfMt4BlKK5Cw5pe818WpXfIKdozTnCvxVy43yBk01iyKBaDWXnKtA2sdby9KD+VKxRjLXZTiGDu"
+    "Zb/xHuodRF+zcTyg/fbovDAdMAP5GvUlRVHqa4rpeO3pkZMucd9IXj/IpxC1STB502oxaBfYUSvCWfXDA1TU4FS8UWRr"
+    "tUjs0yFSCtfJ0l5uk+CQTKgnc345dfyz4dIZ64esnbPl0LtO+3Q0T1bb5XQmey4uJoXeqZWDiHtZa9iQlO/z4+25B2tq"
+    "mUBdqzADlMWWd8qByKcJcJDLzU/bZcnDSAgauWM/Ka0F0B3qRBAMPXfd7UEhIYULxA/BeF2+vHacJCDlsV4S6JK6w85X"
+    "emeMPyXs0HN5GoOfHL+4ERHz6uKDQ8zpip5Yl1bYnNZxsOxbsiWRm8A8C79DE20qEDqS15Y4PsEwN1/gkoeflCnclzjq"
+    "htKMYNCp86CIFmumE6tdDXVpiEOqO+x5QI2ufByUjTjpyysGL9CdrBETAhYCPctcgIYdFAhX3rIizUKyU6vz58xeEfun"
+    "oH/9ooNYpMNG+EaJHyhFHUqwseueNmxN9s80G1fxzjwSV4OuuqozxjJJIdYWsSHDMbkw7LoVlpRRJ15LDC4DDJcPg1Be"
+    "KTE+PiE20Z6mB+qkrhzFgx2PE/Ltzx83z49dto3ZJdtOi9GOnVdQN3sTooCKjukyzj/qDADaMDdmDvU3z/x5iE7w6qoo"
+    "hxF17rFrFL8kO8LUKbSPsR25mNxnLYtnkEVVSsHvbppte/OyuQn3VI5QAdIoCgWl6F6DfM3yDjdz2FzhZRVCGpHAkhJR"
+    "ucQycvsMGA7biH0YMfW56LD4YBR/Uo5daLSfUC+3v7u74PNbhkEqMnyGttdtEmBJeAIsSIkH334YyhjP/gjfQrRxt+Wd"
+    "5gFtJFK5wz80kmEBmrIWmDxMgazeQnqCLZIBGhC0my0d28iDRR0D46ggPiKebKR/dHIqEFKbn0nD02lobdhEhH3S7PBK"
+    "qu6Qbg/8CCxRDIrv5xQS9Vl0Zljh486Iac0//Cq3G7sria1fuXeBrxSDy5mFfzLR6XiN6VZKLRXKKjhqd/UUZYqpXda/"
+    "1aPEPYbXWYtejng9AlPxfHZGiYJUF90GZU7CiWQzTqkuMKbwEmoWDk6xzVovWUVTD875L7Z14VPuWMssVqb1G9sFsD4V"
+    "8FxU+/ol/coYv1dF4CFEludCptATQitRX3qkMmUunFcjL5/E44hz7Rs01u9eq/ozkas3l5eEVqjjl0RBWC3+MJQwuNuY"
+    "HuvyQGU7cpl+7O5Ai5ZG5IXtdoppoXxzX/WKWTolt0YzjZUB+oVvj6ifBwjtWwfhg6Ay+b9icipq/fF8dxp4hVCKNl5Y"
+    "1C8sEIMrY3Noav3YKZdKIGxjBi8rd8Zq8vddoI+g5CO8BBV//g6QwQcpeAtwTYJQsxUC44fLs8ro1KUS7BZKcxbq2dnR"
+    "5kAOplw/RKzDE6+gxFrxXBFSWa3cZtL8lH8URRo9O1vojv7eqy/Mj6Eq/6Z94LRWYFUvqJE0QDvT+8vHlieS1C4nNW6c"
+    "pFKDqVDAUzqI9ZEBPlXhfhYLpne6QRuhfgQtLAXhx2dpwsS+FX1wc0mQieW1bds1xgXPK9+9HZt4Q+y/xhhoKlxCv2nl"
+    "C0OjG4RvG5rIAy6seKH8f8KRKt3RGMjH32VlZZC9O2oIOfK6Jgr6XMKQ+CT0dOFEfIltmpIfEBNjjQi6471Ijr7Fws/P"
+    "v8u3cIxaYU5GW9kUwqRJYkPAkMhFLjGnwQbDptENW6N2g2l2i8zp7voSTNgR9rqzPDS58N53x+ozg+y1xFiIkd4uNmb7"
+    "m8qz40M8Hc11VaSFuVloyQmxkZcK7PlR9rsyvqlx4P07XuxvKMmICwv082XIXm4wFWHQhZ8UbIz1cmeSEOTmYKQHAudQ"
+    "/10SdQ/+rKxKTYxMd3dzMvUwNjbQ1FVVklWWlpIUkBYSFODm5+Hm4GJnY2NkBTEx0zEw0NPS0QJpKaipKWkoKCjIycjJ"
+    "yChISGTdJh8pgBREhPgoNATYJNBYmEi4mOjo6FBoqAAS/u89LZbCPJG0R6C29OBAcXlxQUZ2EOOfL2r0d5z9zdnf+cXZ"
+    "sT9CQnxd3O2sjZ309LTlDZQU5KRlpSQEpAQFBNmF+Xg42dnYOZg4WJhZaBgYGf9LAaSjAAJp6CkpKL9NQgrIeDBz8wIN"
+    "pYU5BamYWHB0udjYkenpGanFmBhYXxX6SttsBCS6FOGZ2nMjQ/Q1FaSoudhABKKyLPhPH7eHSNWN5SmNqcnRyf91YBJo"
+    "bmGibaKtrqAtryAvrCIlLsIvJCzMLcLDzc3IxcXFycrMDAKCQMxsQBqg0caHZHyTrrqeekq4g6WtnKQ0b6CXvhoLv5Sk"
+    "kKm9uiIhtZyCprrJUmSbPTfftTuIr60wxt/dVEuNkpfDE5gfYqi8jP52yTS20F1dWJSb0uwV6WsTbOtoA9Y3M1CylVdT"
+    "lVFRkJNQFRAV45ATFhLi5+TiZhTl4uKlZ2GWn8KSrngT+Z4aP97WUtQKCnCxWPLOC3aW1jDXHLSKdeU3Z7cwyfP0sAOC"
+    "Pc5s2xxY7KjztbXaSuKco53MTIF8K3sQVz/TShcIII5Bf882V1LqCuLHotOS/L28wNbRBrZ26vYGGppGMmpqwkYKEnIi"
+    "QlKi3CoifGKMXIJcC1DKraIavzFHiXEHTm6FqkfiSOeS5oqUUsNc4KpDe/XNozS9NtNT6ni+BfKmNiUmQMi1ONKWaw/5"
+    "hnZUJBlkeNmDOUSo3ovJNzo/IehR7/8hv58T5XdWJ7QV5qfVu4b6mibZO9m7GFmZyburqWvKqWmqixhJiMuySctI1w2o"
+    "r0W7adkY6mm+Huor/kO/toSYbkRXH1tJ1PvdUdZnVdamztvb0unrnVAigtLcuKcSH1GJR9/gQNrvs5fdOVCbLpMd4Fom"
+    "lahBI0Z4Ms+hrsyMNwd4uxIfn+uuKizNS5qKTIp0DvNytYq0sLdVAZsZaBgpa2gJGWooN0kHUQzBPM7V/xImEbJZsrdR"
+    "bUbcvUMZAmC8hkONTQ53zP9uEUUcH0qramuNuUX4/Scmue57cN3j5gAIvtoOuy3q/vvHTEsuT4b/RqPhVaYtBPKvPvIf"
+    "ccY6tYhXW2wnt+ubUXU5EeNxxZmZ34I9TNNNXMF2Zlamyj5KOoXyT+abSSttW3CU7dU19CZR0Zs9uqJSB/2aYlP5ZF8v"
+    "vbxEbw1lgP2xtt9nnf7NcEcNk1kT8XytsM8Nz0G965KnxdaIoRFP34W2+yqYY7rljf8ona7AHXVmLh3+iK8bRvk7/vZ0"
+    "d4Gb3V0TVJWRntXrFhdlGuFi7RCtaxMgn6ZZr567RhlCFec3vBabVoZT/hPVNgjNzvw6HKsADVTCA9qsGVOZvBR/vv25"
+    "1cX5fRK2sxX8MMzfMPOelkJ9PCB2pz2VaQ4JdDhL9b6eamad0gdkDCUxSFvPVcTJnv9IvUSn/Dyp/rs7zzIw190UkJ3o"
+    "MRKaFJfo4O2qUiBD/qrmun9qF+3OQWzVh+27nc99OfBi5MYU2jZRET4qg4kUiCsnyR4mNvvYuQf5tgeij+y7OHm9GLjF"
+    "k3G6PYF+nz9gYgFY/YgdhPvOMWpT+LXcJ8x8U1JdWyYf8njcmLpZFeW5ry9DSZa2MFwHvbQyeRibF29XEB65XC2q9FxZ"
+    "QbSuOZ468Lz/s9q14hf2k5LpGIBcnPmkDFqax2bo0jdDf9KcHDNx+wX0Zq5AduCIsvY5BkBDbKGmPXydvLiELV8gOL5b"
+    "JASnB1ohCe/FNzZCJXfoLyRw1iuaMOilk6505jlLCAX5GYmal223FtYPDnZBZLbnRws/QJ3FkgDP9rc1tgZ+kUf6Qj+m"
+    "x8k9Qz/WxJkPE6x+DfeSyBsaHCxIKsRlDSgQ1CFivkTZ8GFsSKCi9EREwJzN3J3CpxhmfS2vrC9AJ4jTuga50KASPtBz"
+    "lXAw+/gUS15dRd50b9wpfN61CeK/vOtKcPpt3K804pYJ6pZbrMa6CjE0EyA+rHLNxrCkUa3VvDm4rf5IelpTJZkrQqQu"
+    "XmZweg9MgBEBjEvujZU3OqslyTu2BSIlHOt71olUItP0FKm22kB+b39c9Wd4sT0YKWBydBFYRlbxUXTyWPVqzvElWUwr"
+    "V+cr/CcMRYzDCHnbjf35WATfPWvLksIpoJRerU7TGkFV5XAaZXZrkJrRi5pTI+QN2/qnyy7k0yLxD7ILUhAFnsbazb45"
+    "t71PmxVUmEtifKmPHSywkeS2nV7WILR98McJMitjTbzOnFXMp8jpCpOppU00ImC5KjOJnsbE2/2lqWa3rQwz5HP5H1gI"
+    "+UOf4t+J5xhsgNd1QOkPGwZ0c8TIm9P+LsBYoP5RGwvCDrQq1un7ZfW2C8G+Ky5l5Yikl1+dIPrPz/zIXP6QGbSvq5Nx"
+    "gwM3ea36lLw/ibsTVTIxniImShGRQ25FnYnWct/4qJUMX/mhJLxg1i9nAePlDAPWNFYGLl4vYd8raaERitAr2a43ptX9"
+    "d61uUMyg1bgCNcUNuG0EeHY3q6nT4q9fCTdkzvPaJBzB8hJ5WYWBT8Ydv2WwPjCK+KItz2Rp2e8gW3p6qwtI+JfG3Z+C"
+    "C6Zw1PBOngm5iTKrqTDxzMbA4B+4nLpJr7BmNnidEw/bBsPZnQ0N3hY03O4/DWTz8YihoRxMRaM531MkGPxjW9vc6Uk/"
+    "w0U9xKQDDyiM/jCaMtLP/rUKA4roW++ExGRS7Z69r96oIQotT/xyMbWX7FyFO56fFAxsxEIvFEeglF6k2uUopV8vVtIz"
+    "+1DuhebVk061S4PE1ROow+hS6fZgSGfWZ2h8t8K0ZCDXekUAZQVE6dljYHHhlTCGstNxU2Asx9y0RqPOGk+jNPjctE69"
+    "jbIgaHSxFHMPwEqV0zJbb/INY0zRBhEt+1HLfm4sGzu+9G+y9rIP4G19UN+oCXzt2/zdv+nBwWubR6c8b5xuN8nDuRD8"
+    "On3Uf3UlDGQKX650ybQZgdXzmjijSp/ovTi1fdj9onVKV4MunTWYwi155TIAJKQUabUtwqvuTZ57//zXY3WUFKj4a3CG"
+    "XWNhuJUP0905h5P4nvSjg8Gtd1MaKv02uhWGeZHDUxpsF07ydjj58YZMybuFwAtX69KmHDiXucnb+/oPfVF2hJcafyNo"
+    "nNypGqf/AsnauiqwMUPLCht0HDBVuis/2P7Hhyh+1M/WWOxImbQK/z5I2xlshSOt/vcvoyRxB1jw9/2D9I+gZ6QzCqP+"
+    "ouSTKs1cA249AM0eyMb7a67lbUKuzU3VLAGXTWNH1wuqQrgtRwdU8PGMwyK5UiA2Vb7UmJ+PzvR32K28sGlNnMPm5Vyq"
+    "ev5DBOBzkmuaxuvJSmfz81G+AFamb1yUl/2pN5GBuaXi7Z+zvlzopctqvNy0yVQ8du/HaLWlAQ0HF0RmaX0fA75cPqYF"
+    "SqBGM5nfm9l8D9y45utoHJt9+llcpPQRam60fqvP470mXtfw1+lhT1lio+8GR2n1kvURW4LY87qxwOuvNmDRHOchKkP5"
+    "eI1vdeHvSG4rGR7ozB4TQKwHvDoJm3OkZCSKbibSr880xKgd7LCTqQvlK+/0UDQQ7kkcDJlR1LiHPVN6JY7E4SR1jU68"
+    "rySL2DRI0tPdXzg6+Fti5sbLSHmse3WmjZfB70yECOciyzaQpm8www9zM+6XVn7OwxFVdIzGLIvHFfAXHnkqi93dG1Ee"
+    "GnrDfz5eTmz9WpcKtgy9CKqPqL9zpkTTzKHWhh51gyiQ+7bbDJotufOkFRPLQHtK6E7WHAy0vEPCIc2UH99ALgt4k04a"
+    "j/yPRPF359SeEUW4z3s1wSecvN4aoXLZaFAyBkTBiXnBX4NxggRVFrSubzKscXQs994iKcl9LM93BSncJKV/WtzHlqgj"
+    "f174K3/Frp30WsQI83HkQKHe8vQpjENw+kicX5KvP8yagt9n08H2KMQ0DHiOkaOQgRlnh7359ykVHcX9Qo6YjkuaQfCB"
+    "duUk8AsZW0qtkQJ8/P4v0ohshoom1jJI6Ctk8Rh55aFocbbqN9Hd5S9ITUqMAUdQ9rZ+QwQSPO7VWllvQI29F6MqcMwh"
+    "Jo2NdiJ7i8mxvu/3pz7FB3MxIgaC4Ckruz+NotqurlHjMg1/5gPQcxK/ES/CJF1iaTJbF6LmMTTvPokw9Z2Gfk9tAUqQ"
+    "AV/ITdZS6FCyYBlFoXQQ7/UhujOgCfPljvEqJHvCcjW2zxrpntQwQerSru71qRYkSVm/1MXSqLDjR+md62yOvRg+uLqT"
+    "JTjTSvXsX/dlq8bMIRWUGRwuL2/27BzffGVFv7tYMFJ5OGH/pYFE3VfKnPtJAnYWAf/ZVA+x1ldriorCTgJIBPboYbZz"
+    "ImHzUrLVADMrSs4qPGgvM7QP6n4EwKazB3ZtqpumqHh2ra0Ktd7BT8vERJv3kyi5YWihoKLib4tIAPuOXlfJ7NOTA6K1"
+    "AsjpFTOxLq06+MDhPRbuiUlORJ7cchOljJwOcy6/qpx/T0/Fe5IOroQl12+ZMCe/OsMCD3moD3y4J52FCJ0JoNHwq5b4"
+    "coKlXUcdICFzwV/brj1mTGlltTxlM+NxTidQ4Hduaw5dEiQXnIf3pG9cRaGUs+C5fCCJGU8p4W2jh3k28wtxLYqnT0oP"
+    "Tl1h1toWzFIjaMonrHnJSdyJI+yn20YOt8ezdsvbu5Sx85ClRm45wGmesvmyQCE/y0XcUE2ISrtDB8PKMDCk6uioUmm8"
+    "XYMO4sxXuDoZ2JZAw4N4/aVgbJZwKPqgjpXT6ZuRdjapd8uacxgcFJP9i9AiMfvQffXUiLSZigXyJzzLRVmZ2i8Xkco5"
+    "XlE9UiHEEuSNm64LH3oU+dcFy/C/VXutEP96l/7f+28n1nxvZQ+wxtksSIedgpgFklkkKcehSTFB8Rwy35QIMyCRiEM1"
+    "Z0GQNCWSBMYd09OkT4ZH7oMNZib7wkqfxkcfpuUNW5cuDV+JjRygEqINK2Oyz8CeJktMrW0jQQDvL06pz8smidwDYyz9"
+    "gyXgzYAh2GqJUM5KxNI3aTCs85vVpiK1R59zaXC7kFmyLJUOCQUcLr2gBJQ2PPGQkjG8BDurujUsMZ9iBxXbqi02a8gw"
+    "zHSh/R5pUULODc1aEMwkfirG9jli7EGMtGuRPd7qnASdQBIy1IAvdOvtvq4iiBcyxIuQsYlSDXyAFGszvqXI1hBEzRYi"
+    "B8GfJck6mofrRL36LARVo7k4NgfFm8YJo0GGC4mkoyJC6mLLzWuIjCqDAOOskIjpzStHpzlLi0PrGYTQc6ybQUcs0hTw"
+    "KgpKO/UnCThNQLus4U6eeuegFSQBOYmTUtytILrM7iws8SSqn/cRBtdg0DpMRSA0J0VBxZYmU1locOEF+nvWt4KkjoeD"
+    "FdENilsqVshhDQB5bGT8ZFhIODUkit7N6TmmvrgpbxTolzaatEv/uEiag9TYOACBPFESHNcGvqB4gZn7Qu0rD7TBvC4n"
+    "KHtkZ7eVJGai3IkwzAVXMgHZm+UWJLb+4tq82eVRWd9kAN0v0bT0TXzhyAlz7bjE4axbRPMEmzz3GIkLjKCuuFcyU+k6"
+    "1jQxLno8MlKaeZpaR4EAFed+Gt/TSlhBLpKUHXPWsCpMV32+rJ/mTFwRzXDdo33pBhVTQrLNA92Q3DaE2WgmwE4wv7FK"
+    "J/CuMIGioFYpwwJdVG5tnfOC2mLtc88W7sHcWJEX12lnQtDGQIiIJQBuGaZBTp4O6wfCd7ROfOWslCupaHtmfAghmjwh"
+    "MZwMJsFFDXxatEpkTCc0A6cKOkpDYV1FP6pDUcdKI17aKbzQLz7EUGUuo+OpwAo/TxolUVTOcl6ECswmcVcZcKgo6pRR"
+    "rOAnfh4y0dOSg82xGzZu6hSBOW1/NBx/J8MLvkxff7+obouECZ8pDtV63uyw4cActVJgEyIaqS35z6jvTefYcmdAE3gv"
+    "yKCPiqbb7XVMQTsEKUodcABQGx7fkFPaY0hLRF0Uzm/k5TQGYWoCc2/OP8zJg/2lMPpv3Ryq083rdZ5KaA9ZLSZvBKH7"
+    "MjKZxAODVR22f/VB+YyraUnLE2660DVAJbQOndA5C9VgSS5o85QXKQBGFEM4Hq4fzP33FnqpJ1xsCaAEAh6pxWr5dcIm"
+    "CiEgQmrCKtO4VxVRqofUnlxcoEG/OhKDmr2TNwAnFgwSWlTHLDU8M4LJZwT1xGx/K4YihMMIiIDSSIn3Cb0fjjOCbGIE"
+    "evZ/NckUvCUnGmdU5F9Wc+mvZpmkk+aHW65mZWgLJX0ZhRIYJNFl2zdzHlLMAOMWUbWiAKdIJ9SzzD57WHhcBBgU5Db1"
+    "LV2MZZi6D7PdSC2Oa6BR0XWb/N9pSJFMSgmyACwhfe8+hG+4irwXhGAWqJOZIsLIPvR899jyPOIZBb7Hve+uBitdcpsM"
+    "VJJ860WM7n0HwgFcA6x3BNpyzsP6NEJI0lpyZCKeD7iHu4IU5CzC3ctHNHHVPzXQS0loBmDJIUoU+EpdwNxFJzFV0Knf"
+    "HUZvObWJDoLYYgJtVYMaKDFI0UKfSbwvY++a/XIrozK6SBUcLMUYnd2OVQRrhswavKFlJSxrRXrB1MEfT9vIXeY9pH6R"
+    "TeZlEeIEI6btXxJQTrp8T//wASwhiO/HaWKS6PjdfO8XFSEhXMcCRzDtOXDf2PY4afNd6KztLLiUVHGeqhNw5tuVVKop",
+    "Rj9X7U1RstjM1b1/kV7wOq8cJ+pg6cQzh8QGOFqpB3MQqlZSo4J8pc9tOaU79zsyX0tVOIxOJ/+RsvtvRns059MQBGMg"
+    "nlpXdI0z1sYaTMbNiXusRlUO65GgI1C/z0U/sVl24RMNl7vgnnF8WFZ20UNdeKBybstKkARcVlUi9Ny3qHdS0Ck4q0iR"
+    "BrKgV888lhr97Yo5unGYrTzOwiAz9XLS9XS7myIvQ55dard+Ck6+U+4czWM3XPWYEn8rEdGHVjiBdJty0314BgXoSBRd"
+    "26mmKOHYiqPyWZlzSW6hPvEPKzU1aTHNjC4rHlYP6bsWEx1mDxFQmMch0eGy3/bkhqtQQEb76vT3qY8CnBqT8QeJsPAA"
+    "GdXKC9arOWsCaI8IeW3fCREbiJKiSV6uNXwTJaaPQs+JTE/U2TSV4WuhAixFwLmLqoQqHLdYTZkSIUntSWvot4Xr3bvN"
+    "ZxQgpQq/aeYLNWQiHVJtjKQjpTqF8h1d2kqyf5mZpvwNoUh4OONdQFP0qFmbBGY16WXUrHDwPYZCWmjAlry5TQc7wu4W"
+    "Y2oFmJ+75ghORDZxKFstBx6uNPG5znrwJ7yzuDhspaDnBGtuvKQrXZ9UxgB5J3vMh/D1QKq/j5I29wsx/ld9CXHCz4Zc"
+    "DahiNeC7kH+bLOGfztaSkCk2FCaCyrVzWkVaTpR9WvJKwust+BspMZG8+KpgiI0pJhwWFsoG9Smh8lLYVVxJpT9pZSfa"
+    "w3UJnzkV02yumJec0waN3iLRJLdJHnaEOOwf2YoA632CcoHzSJURH/d0wtaUd+xw2u0BKEGIGKMyoYw8Gy9SzwtJdSBj"
+    "vjqZnzgqXapQBLJhjocq7CFbbjbUciHOtGh/OxgBzNQ5TDVlYDIu5oAk5j9kAXPbDiaa1rcytxiiAec/42x5rvUJ8agx"
+    "hFRVj+znSQHm7Ct0dOFDjH5OyZwC+fQQ4xSR4+/SZnIMWHKM3Nuiq+GSP7yo0GJa0R2/ZBYKyGqyPCmQQ+P70/CYUvCt"
+    "JWssFOQnEDSp+bzJCtAhHBBYksGZwcUmaN9e4z4eCqzNxmQCJLoXst+p4HbgpP7g+xlIP/qy5O9wDwHG3+T5bAvI5sqE"
+    "hgR9gMlbwX07z79MvT7QDIYGC+IFOfuhMRlgLbkEgPdRXLBtNp/igswVmEUEW7Vu8TqMzDfBftuR1gonVDVNatATWNhW"
+    "co8lGjUKrH7J+E8AaSlIVqWp5MgiWG4IPArVRsx3LQ4kC7akTzby4v43HbhsR3G3CJJ/64R1v3ArvyEsk4TKZhIu0Bwu"
+    "NNEb2Hl+3xn83XwzOTXlQmTSNwY60Sd0b9sibHa410C8PQhD0pOxS0YsdnueFYKDwsNgv+C7I5GFLiIufCazP0ZCfGxS"
+    "NOQ3xEDWREktYq2bozYMwE6FI7XcMBIur2a5HavCrmIiL6mvxth93LavbBqEqksU+bUKEWHhpr2IwHB/zsttFZWU6n0+"
+    "J0NTgHYEK+m+XqFBi5Gp8fWzwCMgWvt4KfJl8WduXukh3V9lVarI/eG0Zm2K/nJIGE2lWi1vEVSyAx+ntJtEZC5tCXqA"
+    "1fnBzl9WeN7wB0j/7GS6X/Fleey2I0pBcF7y8FOwPp/RVMP6zTooRWNAte3JcBOD5kWZFWM4hU0UTqdoC5gK7mR1x64D"
+    "WT+ceGkEyN/NO1xlqdXd6YI09ZLdkQxssBBM1ZCT9uPotB8PapCoOWFNPaajX+zHHJMty/Wu6Mwqnlje+IznBm7zFI0L"
+    "Tr+7+Ty9F3wdiwrwniBq2OFhFzavqi8/VTZIBUkcIsXlf4+3liQ2ckCNfZ3i5q2aUdzPNaFHUA3fktjFFCwHYogcARS3"
+    "K+o0Yn4Qt7DxI57EyXjaHGigtNqgJRtcfMNCRIwe9GSEkJ0cAsj7zDR9Cit1CtoLyJQjjjm8XXdOJ11uxrCEMux1ExsF"
+    "rT9gigkMonH+uC9Nd88iZmxTBAoTGon2yU5mqFSpZaNwIlTQ/FsrVRmsJ949SLA7fXfP/rYEFqXEp6yxH4l2uxzCW5cR"
+    "HjtHSutH2z/DK/yTlk39k0swV79IsaOzsUgkrCB6EUcNXnKKgkeWawMAq/NThgqDzSa5wBSXRRUHweFJZDoLQeZaqzUr"
+    "0W5vQg9axAhtCD/nGyekYj+mFtQUTJPFSMahyz+lY+8Tt+DRLj8mWuxbWWCRz2Aox5kzQ4AYReeCbAUXREZrMFu4QwFF"
+    "TIKl5M2HEqhegUSTq4EuDde8NJ+MWmwsuJb+SqLqtTWn57bnCnxUYBj5SlZqXu8bCc9NlA0OtmETI6dWnxQqWFqj4oxD"
+    "1gygJZcremjHt4qW1CNaKEnGB43m5Ucbki2LofBUWUX/2u5fFEivYHJy26zrTAkmiO/rUUfcmvdFUilk37LYDDJNiRET"
+    "6gsH4pJ3xjCcNVrhtZQeREpBGO7zn0CLo16xpfPhYBYlPczSOXdtcFYhLLDCna9DtcjELJr0Ig9wJtLhRhAgbZmZxGCm"
+    "Uxi91Am0BEBxkdiKm2RXtXrhDy06J3tmLaX4qAUW1xkptpBPFM37QpCcX4/nNBbQC/5YzL/DRqjaLSr4LcWawqFpGczg"
+    "TyY5n2O3oToYlm0hV7lYHMyyXGX9TsKqAoKYZKKy5MRmqB2byt2GXb7+trGaqYPeLvHrEbGvH1GQ5Qri+HnjReSrWHOw"
+    "EfprJbT0CGPou8SAfT82oyOUv/AmhQ9oCbufluSG18fvWmptX0cnm2vrjR32jKE+S2BRWMXJIsbkES9BWU04Y4Gfgtwx"
+    "CfMEj6ZFfPjvUIEMMa2H4rYUMhmLZjmtVswEwNSnSdXVWoboLhhSxysLptY4S5qyWJo1k5V1npZiUKdjKQJeOApW9Jxn"
+    "htrKJx76Uf6szDSmjb//u4pKfXWAK51kSd2xaQbV4Uz9x/ctYdzykYFiG+PSuArRpfsXH8NbeiKoqvGyAZOcU/9qGohv"
+    "xMukBKyO9SnVX5yXudoVYdDfnB7genqY2YL7hTP1WNhQ0w7YbVUVbfN0jFE5bkzvlJgaUmo8lOBqhMVMc8z8qn4wJbRl"
+    "BuLEHYcTg6gJOBExRpkjwx3jdEttpouKxeTSWKNwCn2CHHFQW6sGlU5hEIar710IPX8KyV1Z/M4ff3uOJJ6jDzYmOmc7"
+    "D8kt/f03KOlP/8lHFCdg4uD//v/b6esf8gBbCQhbqaymfSrUxmN7pEfA+/lqaE8GPHmuA1q2xs5/ILDinuCQ4z6nhgf+"
+    "yo4cjCAUlD70rVGssrDRIg0AJ/JQ+RQL1TsXFqa4yHE5LONNwODaz+Jc53+hF2sYvp9uUWnkMiw6lWxW9PUZakU0DQGI"
+    "AqCVqpN4Mtt9YD3kHL+5weLJbHyGHgPNRs3IbgEIkitX50BXwYLUT1Zn+OSUlknnj9lNlgrzZ5IdfJpnWUQOZcv1CCNW"
+    "GqEGhmAE/pzJ6+UcVXLutt8+Yz7YmpHa31lta8Wco9mBkIAGqbcFi6nB5f4F7pt1OGT8Umm2oYm/YdwkUAnrjrL32v4Z"
+    "q4dGHInoajB0txOYkPzHvmKdv/WzHPYcbxcJ4vX6ZDIhLe3EFRTCyPlkHBOfNGYt0Q3XYsSOtiobT18ryg/h6DBwkmhu"
+    "W17Qn+EeULIW0oSf3m+7JhRxVRizz1EgIKbIF6CNCIfog5+GV/gnDWJB5DkSpcUBbRNlbC6Qmj5aDztDrTJnI8S2s/YD"
+    "ZPRC7Q/5DA0BO5IHI5R3e5zoAYnNJN4LHEUNanCGv2EZ0tYpkXPFMmMxpDFMaJx22Ad0tNsy+q2Yf1zNH3Fjud0SLZEW"
+    "FEYYhB3XF8pQTteefLXnR1MKZrIA6qI/R6LhkYbJeqtR/9Et5OLgA0kY960hDY28wgNkGApt6WcXSuetmIXLNlwW+8KP"
+    "sn3DMNm9tndJoIniSh+I22BRKOGEwoDqA0RXLc0PmGompRgiVOcMtFYtmtzDyHXsal/xYgx4y86tWPhhIowc9cmvNkYr"
+    "hIdY4euIEnPm3m+xepHdW8Jy9yyYmcHhzGWc5Lt6c3VFEslJ7AmocuXwze6c6yK98exyrsLvKBe/J4tnRv78PYroH7WS"
+    "KHMwhxl/3y4uDo6sxNxG2IMHl7hR8vjd7+1nFUfLWB/EfjKT2tfOHVhm/uQeWIGZ9poRguUM6SHkMbK9gkAzvSNQ+pWI"
+    "DF8XN2wet+7IYXxZJVxHlVeVkg0a6wni1hTZIfZmG8GfcRd5B805Exk4T7nefAc/Qx8sT9Kr0XGKt473rjeCrrn5vpZT"
+    "SFEUDUJyyu00HErEnXINHBlq9m6iRIHvVFWSHdxGZbyknVrO3AtqfcarAKjHEmclgsdNXxHbAAxC9wZLpEKtHRihcgpZ"
+    "QwcPPPZ2i47b69uN/CNOKkR0fcwHkbUAmXraDuQY3NhhOh+YoeL9PVGtU8gKWXNR1inHX9DuvHLvzLTdiYvVIXp3XbdU"
+    "91/lgHmHazOt9j9oQcr3QSi2C4gR9XI9foAYjNZFtDQ1lG0xjyeccE+yFw1oOiaXP1im5TmRbCdG0LdwO7T2nsFtzP4z"
+    "uZD9wdVhy18oxOR2D/4qjrg5mKRTGmVbvbvYfWomWyxKISXPndJoGlgm5VZ3CIVM1A7M+IFOPL65t3nF9kQe2Ra0bH6k"
+    "YaICXt4chuBBeQCmPYtOuUIOk8ae4EFZ/+osiPabsxR4fjn26ljGUgqcpNR4TrcYR3VU08SmaUNN7MKl7+bvf9+goRyu"
+    "lfYWQieAYiqg6sTJhCqW97vmnDizp3eJT7dFE86XTjrJT5a6SK85tRDd46elU40X4ze3RAwub74MWuETCLSrAdq1KS3v"
+    "CYNeZeHHRabG3Ml63VfKhAoDwoqwdAv/GyLJBolzLodyZQcAnh1hp9MjdXBuJAYlzlEmsl4R2BZFcz6yDyFAmweKgifc"
+    "laYYZei6n6FDcFQ0hi9YYozOexwP4HMB0YqpDCYy3iSUS0lFVHjSZJwPbfPT/3TFrO2movLnQpnDpt0h6FW3EWCZNaLK"
+    "0eJfIC4bhrxUb0r+Vitm5xwaT+ViJebFYElW6VclIqk8ICzfFiFk1tluviLBPsZ1NHwMFSwDRMrWdiG3WGufrbPHm7pb"
+    "ocAThF4kiIuf6CdHtwvlhUvlI43orjEEQaJwturs67F8mtAHftfBnZajzSS0NYU1MkFG1Y3Sk8/tTbI+TvzapMb3ZBhh"
+    "FxwIsPFldI3IbooUy7H0xMjs1Xjxpp1J1CdAk5hOMNOEIFwL4Hu/Q/ryoiHFL2AWhWvPVdzyBPoFq73rjyTo4JNQcNrp"
+    "SQfOxIJZImDPnBGUoYhv1OrCkTsiwNwLmZj7PhjxmpKC0kA2KzyaVCjkB02g8IrGObGrrHBWM7CTbVNYS5+jgHH7ZgGl"
+    "6WGp5nnb43afANHePoh1YfHPAnRUySMZTEEeEjn9OfgYjfIF5srjhX9jAYPIjcGCXqDK5QoZYxiovtAkqZJTPpICZSRv"
+    "CUlZFYU/ElLL1TkI3e3HqKepjaIhQOqAzRAkSGTgy8NuLy4pDS8ZiYHq/pcx52rWY5j8aCmP3dGKPA1QgDauMNdrbdrU"
+    "dEazimAHpqbEQ2VnGtpg5cCTEv9jmgnPMCEeoU4yZdT0RuOLa52lRMLRo3aPFX5/0ypd1eEZ3TAnSqeXTFbnPI2W+4Vd"
+    "UMol4mOCEyYLF8YG52mBKJOLAwwG8jpAkfugE6rpoInjZZi0U1upliFdUfJYe6qAufv7kxuVtiFv4KJlx2zMqHOtDl9B"
+    "vuL0zu1pxLZqbRrcUKz7gYBdfDTMmDGZSFFNb2YINGMkE6lt3Py7YEss5NAcsXTWQoEZIjdunOhJOUZfTwZfRRRXNiR9"
+    "J3i2JG4mfRFJBTQiJToEVEVqfDoBK9YRLi0oVMq8aPIEITwS7UqTEZgPQy2+f6yFSpDNAmNcOIzxLlmpp3Q8FhkkvrrJ"
+    "YsuIHA8jvirwykhOQXoR6gx8gr6sx5OWOiQ9L4StFVAU/dr+rNVyNo50zv8EcGxcxX0UgMGySGpRKMAkRgolTqA0IYSo"
+    "GASEHicxD7e0JB+yuDo1LA0N1Co5j1tkfJtTGi1Ti7bH9dY0pm84UQIEEGB7yw0XAl6zLnxMwgvRtmcGo0i7PaI1rRqj"
+    "GnLpegkjwKoR0uKDIgootk2UMqlGIQktc8h5CKQJWEnlE0GallRmktRUVlSojpxEjCrM5EyE1BxE2EIyGLjiYpSSEKQK"
+    "CMhoktDklLgGpESYNhTIZEzOQhZxon2Aqd1xgo8PGjvJ7yPztqG2hEx6eo1IwQoS+KgoZz7wccwlUnC6SDLaWCgclIZE"
+    "DdxWLVy74dzIBvrZBIMo9IpQ1HZJBGxOQnqimP8j3irfomC+9hbbvewutXR3d3d3p0h3SaM0AlISgoICKqA0UiIooYSS"
+    "KipIlyiiiIAogrzP769453yY+DDXiXvOmfuaa1C2wgAffryYLQNWnkQRJNFU1UEMOhI0fSTZCMqIU4KLMMItpMgQIxKA"
+    "SuTBp2G53clXzIJEMTfl6DlLTLpY8b33fa1R0uLr6afhijRIH7qWBXIu4UdiNpbgYWSnN7hoIdtihKC3bnv7mKCrkETH"
+    "gxS7H4WkhYgI8pEgss4IdUUy1pjKKssNoOejF9QAgRTl6ITosLxkLE6RQEHxiHELUVmZ8VQoL0gKxCgow8DAC+NBK9lF"
+    "NUTSYLP1nuVfIwb1IaBRwMHnWE4EJgppXPbZ1E1+gFdVDchohJbTYRVxQ9wWxzrzSieKFiN5juhJ5HAqRADKwG7LLqQK"
+    "hqkgefWY0TQaC68YM50YO4wXiOfG4PCCGDwdKxMvHyeBEcWARNFpgaEs4hA4mokbBKATdAExwN9BGF5WSzomKh5avt8P"
+    "j4t/qwDlZdWALu48jo0khHBziZC0XMAsNFZ2y78xza22wehrDB2M9FIeSEdlCAauyAU1xaH5WEQkOZmgbAQgJxFJ44eg"
+    "cXgYAsxNZQDheMhoPgISzcpOh4VyIVBwPjQcA2FA0iNRVGYIiQOJhoHAr6uj2vF3pFglCTwpWr2ynzWFGcG+Vlcu+YNZ"
+    "KAgCp4UVCgSmh1c8v4an6cegSNByOMDSES1MABEhumJgbjQPG1IYhaNHkhkhjAQ8FA2BQNDMFDgMxYhGMTAiEDg2IBDI"
+    "jgAgOYBQHBoMpCci8YxwOjoyGoYg0GAQerAS2AnCKK+NhC7Y3Jd8aS0LBtDkVW0cGBgBbAQ2UzkSEYHD2wV+yndL0ZBg"
+    "xgIUIXkwJElcWIxeAiCMgMuA4Hh2FAgLhDCSyCAyCs4Eg5KZyFgsDAkDE5kpQBQdBEFAwkBcMBgcCQLAWKBEFBwCRxFg"
+    "SCwSjiMDHMG5daYAeQHzCbMc0XpPZQSg+AYIo8OlxKgoyChHxeBgEA4QWr44RAgnyo9OYkNYS9MJ0ETkBFBwUTCejR4C"
+    "YybjKfQ4NCMMzATCcmPgADSIAKSjYyHDwEAkGP/fnB0Kg/7P3RgsnIQDA0E4ABCOh+JIYIRGsk8cjrloSJHdExkaJZgT"
+    "qIoEnC1IPpaXVBUwFcGwQelAUCDN6LJU/AVerDAGU85DL2gIVBaHECT58XzM9BhRVgyZE0jiRoBYGTEcJDCEGQYHk1AU"
+    "GhKIoEAwUAiCEwtG0iHoMBAYhhkOQ4NgaAQSh8GgMCCOEB15QpZOVqoHwmWGpCvrzvMtVAUK0DuwtZdSk5AyZ4Mj6f/b"
+    "AkFq6mI2Ujdmv0TmDbMWlFRAykoIU8UF+NlFWIns3PTMPDgiO41AIxCILFgsip5Mz4BCYahQHByNZ8Ih0XAcEgPGYqgY"
+    "NAKGQqNAeBQRi4FweZp66ib5PsuMEff31fe28Q56a8oRHiwHBkf8CgfJmzFJ6cJgIEYsFUOAN/bwSTkZy93QktVzFFWV"
+    "FRWU0xDmFRdmEBVmZhNhZOFip2dhYWagMeBITFQ8M4FAYUbhcHgChYTGEUhIPBKN+y+tYTFoLA6Owf23iGIwCEpxK8u/"
+    "llRh5h5XEJx6K/py+hUNFdYifxEsNG49WV3LGSosTsRCKRQGEgP4crmX9jUz4xgPAy0dFU1FIxkxJQUuaUkuAXEuHl5O"
+    "NjYOLhoLG5WBlZGehUplZCDSE8kUEplEIJGxBAKeQMbj/1MH91/DEnFYLE4jsij3Zs71oqvJ+XFFJVezC+LT8hJyrmX8"
+    "f/NfdwsHlAwrIprPmIgQ4OSBMCHRaBKeDgWP0ohy1lLVt5XRV1YRlFMSExWS4BDg52fn4Kax0jgYGBkZKRRG+v+sJhJJ"
+    "RDyW+J+9eCzmP3v/czrmf45HozH/CQr13wCNwqiFXboUEhoUFB4S4hvsG+gf5Ofj/58EhXm6QWRZwRe1POlRXEQKjhsC"
+    "RZJgSBxETC1fxNhEi0XaWUxcVI0iqCDOyiFGZeUWomdiZ6Bn5CKQ6BkwJEYCFkNGEYhEJJKAxv0HGyQai0Fh4UgkDoVC"
+    "IZD/HXgkAolAoZEISTen4IBAO9sLbr4eflZ2DhcvXvC2tkuJdcOLMxFtHH0lEUQ0ko0Dh6WDAqlogJyRDLhEhw1rRSNZ"
+    "qjIjtMiMQoo4rBCVwCSBxDMwwihcaBSOCiJR8RA0EYzHEwFoFByJwwORMDQUj6KDwtEwHBwORiIQ/50BMAqGgisKq9rY"
+    "+1sE0ywUw429bYT1FGNUivNtqXxEDk0nS0VxvCCUB42gIRAAJjA0hagnmE/SNBZR1NJAcuox0+S4sARNBISDBsZLQcAk"
+    "RhiJAw4kEOBECgpEhEEwJAQQ/1+yo6cDo0FAKBECg0EACAz0fx0SAaeDA8FwXhVtE5C0WpiYBy8Tl6mLnB9RuLZWh8wI"
+    "FUfICPDZa8pDCVgsDw0OhOEZPfU4bPjkW7jQdHamBHs2rISQPLsIAaVJRyGzQ+lkYRAshUJmBQGJMDIDFgSkwhF4BABC"
+    "jwH8V4r+y7IgCBREBAMAUAAECwIB6cAIOAQIAdJJKCsQpRGcyhqiPDSQpIBez1Oh/6KkhGSBAYIj+KBUdkEiJwpOxnCE"
+    "M7qiRhSsrZzMmdw8JfDqOrJEYQWgBIVTnY4G5GWCi/4PWzzsGDAdAwlPAQKhZBodEAClB2MRUDCEgoACgCgoDIICAJBI"
+    "KAwMpQMC/1MJTzDV5mOwoOclIilELXETwVezKBwdmwKySFrYKw8ioMMhSY9kZWMHwalEsXBXh5c8FcwMasAqXRAbo7MB"
+    "jkuKRZooJIMShLMLEjgJ9Dg8NxsABiIIgMFoMAlA+Q9CYMJ/1QCHBoCgeAgEDsJBIP/7ZY8AgIAQMAzEzEszIXKy8toy"
+    "ArDKKIw7ZOELTYYknQsTNNZSSFe94MZEr8BGEUXBOD66v+XV0eUJcPG7KuhOxz/ERaYS/e35GWRFJbCy8ixSOLIKM5UF"
+    "gxTkYmYAoUGicCojCI0BQ3mRaDCWAQNH4v8rU0gsCk4F/geJ/4KPJgNxcJh0tUqDO4sQKx2u0ScZwxm2c2rox66nA+i3"
+    "kSZZB5SacfDrq1EYiSwyFFZPda4cWeEUBYCPcEiRjNhTFC+jVHQIP0jKXJMsJMurCgfbSKAoUKwZHVQYjCMxk9TQWAgL"
+    "OxMBwcRKB6aSySgaiPe/ONBBqGQoBUZHJwbdMK6Fq7l5hGauhlqKarsPGZ8co+Ia+OxeItV10D644G6ypreClCEDvu4v"
+    "RbHpRD3SeGg1KharYSJU2OnA1yatKisdkSIEMHY0NySKyWiTtbTFxKkUemNmdQEoXJiFURrEww8EClCY2IhYYQicDMay"
+    "EjCcYCQKCtfFBw5yiGYpFX1PLs5mk880ffYsPTgSAKA0/eV34WQuFEquFVN8KHcljh/npsdBSzPM1bDUdh03NrvvddNG"
+    "1V7e/e6MD8dzRVVHrrC7aFyMlmoSM4sNCRFLRV2kQhTw2BAYuyyMoIHGa9OxiiDhCozcLMwoeQSVAiIzEUX24BcZm/nd"
+    "CaE5rXdrTaqfmtM77DrtCf93NWFesuCyd1q7IY4aMhV292g1l/XUU3UMwc6tymjJZOkhZLbkS8tyFQ10ONL7MRLsTww1"
+    "yvmkb7Er5rNAy5yURNC0JIEgOYI4H4+mKNqHTBFm57ag5xMTRBihKKx0TDxU2hBMFVDDoiwt12Zy+B02ZxFqMmwAo1cB"
+    "k8d8RW40wJhQjYza7l0OLqVtIsUQi3aQd54g6VGCsK1uHb8njQVCKpNX4W/JtiR4Wao51VGRziNqpMdhwpYCLlfpMszE"
+    "fLEYMy5YGZ2+GgiqKWAgwWAmC5dDYeSA/ApC7C6wiwTSEm1B+x6pTNbRO7VkGwfyBOens5UOnQzHJJLHIdfoSNJQBDvW"
+    "YvYpOEtyWQeYYHLDS/RSrtB73SMrPN3aw+cu0l+N/K0knobIc/jI+/PlItRKH0sbN8Rk/EcHxFi6SJohUsosBC1TUBlK"
+    "XQaPMOKzFBDRVUWpgMHSEAYUvvyjnV8bG29tBOZJBZQcUg48oZc1kTsdIkgwJLwNt+T7B7WyheMrmskXuMNrj31TqHrP"
+    "0Dy3SGr8TwicWo+rYnU+VatBK5CtZfnCQAoiQWtCh3XQ90WqaEug/FioiRhYvYhjBvQf7wa5SwWJc/uLsJuDqE4M24wl"
+    "tzc1BJgSmD1WimwSs/hl370Sc3hopWn5/c3u3wIlhf1alHTHRjJ3/MHPgNusZp8TNfHQy4JT2lsmhC2FJw/4JJAzbHUE"
+    "qh6mK5BlLkAL0E4qTVpMLrFnc8KCm9MlzMfZ9X6AsxPMy4XQAXDD64ydFDEHANZZepxB7Btf/b+Z10O2rQX9M8t5/Be2"
+    "YBVae0Zi7oB8mCdJ3Df+zZhzx/ud7wk09w/PA0Gb8zGzsmV7D/NrKoaLsvn+JGdDRd6k07nLGGqo7qbEm6SKFeQvrCUj"
+    "FWddVBiYX5KnmEXTx7vob6hFaNyPATAwJkcaZ7BA41gvxuCRgAprkWrVF/KP5vQ+jrvF4V5byB9m9cd8IT4yqKT10wXw"
+    "latuT9St4hG7o0iR9jT3TpeNrte9MV8N16YU7E423JvjHk5d2q0yySv8mapu0MHfQqLfmcn4Xixx6Y+9A0f2955CWkNI"
+    "i+0ND3YNjk/rxzmK7vjLVUxyei95wEYQLkrzKsniHpGjL1xAXPRcZrAnarROgQxApBc3IV9zOGe8xIqFWwvKxs7JaoTI"
+    "N9dJjJ8iR5WgT8sjDFz5St5s1mC2EuoEssCb7PR7quZCAGtDCvSLY1XRpRIpouMW6344mB9Tm8EyaO6YJyI1u8rBw612"
+    "r7w5kNuW61aejDNzJ/H408UovU2eAhNrfEqAYq3h+IdfDmPn4jXB73JOXFxCZ7PgE2Zxu+KU3uxQ+jUfMoRwvnUZXdgd"
+    "7WEQ5E3VEW+aENxDeQcVIz10eYNn8y/0Obnwpth9ko6n/1SmfjR6JcswQV7bXpMRdC4yHSYrP4tP/4yVZ72lK5NpnS29"
+    "+i36WmDTfChG290/alA55BQNTQo67suMZDkTs2KOtdu86l5vDnuEMwO0urpNpdSDIW2BgvgjAri41dZMJ7YA3mPMeWsw"
+    "6lIOkbYnLi3J99klI08yWvUdqCB65I1fCeO7mw4jOVIXVaGibBZHQXJ4IR3UAC/nVe7geebC6K7hO5lXQ78O3HrKOhgl"
+    "HDhRkElDB7neqKma3ssxCWMf8H32C+ZmQnH4x7qAfS0pmPs0YtfaFZB2InmhSyLhtYSUamITTIi2J1oGDRiz4wRORIOc"
+    "RsdHr75Nmq+9PvaaA8ahcojuBj19lRwyFfBB+jl4mZuqjLco7dtEBkYDCDZLf254GDmzH/BGyQlGy78saTAnjYkp4OJ/"
+    "n4vUdpt4cUibaDqCh/VuyF/Z+xjusWvaKft9XM9Hp2HpQWURLfsER5ZN6aB+eiKZdG0qrncYtH+peqLME0R1nhzpcSVB"
+    "fsbrW3nPrW+2xcTbB9uYAtQEZomoHmX+I6GCCPYwP7BY8xvdsed9L77T14zrPoQbadJ9nPrYafx8EXx0Oy6W0+ltQyTr"
+    "bYFO7iHFKe8LpaxdJ0XzENPTzYGWSxE/yYQXcYKYA+GUij52iIrDHVuuhp3nHVy+14RrKFFswnUP39/F3s5S2gs8nqwx"
+    "fMfyEdHb+aZ65+xTxvVCY1kuteKsbNNwuamVn4HnqcLMyxdNhdb238yms+WkNWQtGyp3mQA9+Ke+r7ceeg9UtDNGBUnr"
+    "P8k53jAaEtPsjIwlY3b9LD5wRoQKvuG4HEUVMh/+rpr782McIOTVmTQp2+Kb627koegYhh9kFC2XMVm18mTYYO18JcdY"
+    "1J4XA2r9xSFs8luerm3UE/nequaB+prV4vPamGLzcWMXp7VdEb97ayYhZrxfjmB/ttfSmwrfQ0BBiZZ1AzME3QqM1DQX"
+    "7vdlAWl+HX412ohOGzlTJYjmkajZamB2M2yOGRB1Y3dtXbLv1pPUnYh3aywoDs9Vz9OAnwhL+O63FdGrG41P3PhCmH5u"
+    "iz+8aj5aMp8S9TjNa4ip0CG6kzcB9aWwqCxUYKIayWA0hYmO0KJ1cFhVxNGJxysEKrtjXnbP3g6P8ThzpuMqr/614n0o"
+    "om1/ivL+M3+q8k7NOdRPOuDyfEmOIftF16UfHi21q0HKVjvlpmLLi5j3Jh8R2z17wZvLAksCHjevm/xk7HpnV171J8r5"
+    "z+sHIZQww3fRC84aq1SmGMdSH6f0N11MlTfb/z02G1/R5iu9M3d9iqyOMOeX4uUa00HWail1brElqX5bpN8ImwAc1P8Y"
+    "n+ivsoo8cL4NGLA7bOJ+TrdA5+kd7X5uXNiKszSRnkizzEu+qwm/Q1SpEL4nob/SI5Nn/opjU674ujnXP5zRxYeWGaHP"
+    "jR7lHkwOxA+JNiz6fBcUd/8STlj2uLGRWj40WOSs7/+aPyWkTdG78ukwOz8M+v5JpMxcxJ+isnVCkQrwskF2/FHdBc6M"
+    "2QYvgfFuOmgaN9/i6ObPeV2zz0t8ArcOXlI+Z626pPRcnxqZXQAWTzz3N5zkuGWpQwmzE70Z78OrMOoRiAYLTuULkMLk"
+    "fl9ZLxZ0WRLWh5RWsU75eh3ryFt8C60tLnh2D+yf//DhH+t4CPSv86j245KystKSooLc7IzkhOiwAC9XWzM9VVkRLiY8"
+    "9O/+p4WZFz1N1SWZCaEetoYq4lwUxFHYN78t9yWH95bTJuMGY/ovjSYt3jttBBwlocsF+8w240nNhp+zhGai2F5F885d"
+    "0/jTHir2oz1GHfm+JlKfdjRVn+lrJEY535kb7Wm6V3GjqDCj9+qzN+KP97SvPQVKB7btqZQeeHBUQFfDw9HqsJTGAq1B"
+    "RofL1+/WNXYPvN6BCpnDhtO0YaNXdc67g1gnYzlfhdL3jIaSakUayaF9XxGEk+kC2Sn7WZMhuU6liRDWlUfXk+ITMq7f"
+    "unv3ZrqnzO9Gq++XIWnncUeRZ3lCc8UeOkpMnop3+5nqES43G2NRPlc/Xo29se7b/9kGb/ZuSmD4OezSzUw101+95aFy"
+    "3/6i7qTCfcbrHaBs/esvZMCqpR+xgBvfDg1WHaZsVtLNeDgMsgDdFZOGf79j1S/Xt1xlDcvyoTbLD7oSV18v/hXzr9vm"
+    "tMsf/qdb/MPtvfWCw6R0YvNgVYz1cnroh/XgGOEHOqq6MGBb7hqay2P3aYTv2o/iJ4WiPm9Ywpd7b97JeHMvdd/5Uti1"
+    "81KuU3JtJHz37PZJiYvso/mpQv/r4CWImLX2SyRptSFJD9nO4exprO74ODJ1ymCU3z/eXfL3UEVqVMgFYyni8c6XP1RZ"
+    "c0dTkZNn2Z42jrFtmKVTqTdykf7YW/tkJ3oPYd9B8aiU44iKowbZJYYnLubTTo2cORbXU2Dr/mPgwBt5yodTDveH1/6e"
+    "Pk8UCb4gWSta+KL7duEVd85WtX//rLcvXLPpBwXLuM2YlJcazEdqmiT3rS52pTqZukZfr7pdVjPwjdfIXAn9oa9/hV7N"
+    "FMzPZPi47KvoKFsQJYlcrS8oqG0/+/CcptgRp/p22fPPv60VrMeh9GM2Ib+2OfH9Hjjl9wsf7xyrrrlTSQzUovt7tO9r"
+    "+7w4A9DAFdrIM2D4hxGJWBjH6w5l6ce06RPvkaUKhTOwalZXV3XuldEH5kebp6IuvQbvSjLajnnZdltLapjqexetsdZl"
+    "L74xObXCLIL64g0/fj96kX5m02wmXtys9GNl2v2l/pvB7IhT+guP7uczdyTkH+Jv6laGSrEMi819dxjNu1ZeVT5MVldV"
+    "NE+pC967O61bHvrBKSQz2SnidoH6H9/qrLdd448Go6/9kvWdde7Ww4QZCMSnLH/lTmmL3VU13Pvy/DDBqySariTrSa0g"
+    "VPlOwcrWuA17nHsN90fVdoosJ0wc1nl6+u/ky4VjTEtSUCiR7jjhlY9yiMwnFGuO5wPhoqp3oR4yv4xAGeuJ/4Kfd/kG"
+    "QivO/0MjypmfJWVMWpHmzndnSPt2aPV9eZ/JCyciHF4zG1V/Z57Gne886551Z51o9CTnXWh50E1uBnebmlwVj20Zq68U"
+    "qYHKo3vhnP+yyxDgqq1sTqXCu/Tgx64XuEyTeQdwl65YAlW4ekrNLobfvD/0SuFDVYlE6e+V6L8/696N890fWVDVlPmd"
+    "BrpeaOhb7Yz+yP4vMOmLhhx+mRG52cr37VvcIKieZz2b5W6w25hdsdY+4DbfhzvG2reyLZlbHyl3HndrBGOei7I8xhfP"
+    "bdDo7v0Ov9srirPxm0StX/M01ZX3MMILWw+x3g+WvhxN0SBeqzanvB7ze7Hz06SPPyHXoKuuaVy8cAuYV6DjGf3QRRAe"
+    "2Rm50uwvdedNP7S89qBK3Keh1naSKxsW/wNx13OJE92Vxc5EZV2l5ohUN2t83i16O51XwvxMEx5kQv9m9EuD4RGoP9a2",
+    "TLCIJ4qZm0FLM93oU0l7sZyXVFtmL25GpP69N0Oeg0SIm/qTR5ZPIPYnSGPv4QKsLMdD82h39zmtMDWen1C3pOWfiTM9"
+    "Bn8Bsmg7yiPRCKViiwfCZZZnNuisNfNrMx02nuuZn0UuAq1ZdV3ZD8wWu/pkFvns7n7w5AnJcMtixnLZNP7ip9bCkCJT"
+    "d6nRpVUBtyyGPLI6V9721Kh6D99BP9zOAlyDW+VwVwenPS4iPyDIHbiEVDrHworRlgWl4Q8eEPMDP2Y56Ke/u5u9Gzmh"
+    "h7Oz/VUzf09UcJ27tHxi+ta20LzVwP3RGU/XZOClfyvSeRm7qSuWVWIlCn2vHC+WHfvCFhDKG3MvKn2+3lk1X09W2Iw7"
+    "Y/mVBqdfWP0hzvOWvf2SSQAs6IOQbcctUw26aAYlg0ss1aM4jbJCY523e9o6/75kkEovbotF4cF69RZrSqVFKNlvt75k"
+    "rjX+1RF6XmH4kX159HXS9rGSJ06S+wTlPfphtSlC84PE+oMG4/DEiD34zN1GcecGfian0Fe96Tcq4uVnAt8Iaz8zSrQS"
+    "Wtn5ni+/Hq2+h1MxDDsa1xJxD7Q7RjPd0qr1XV/2NBNHWpKsxTYFlVftrzjP7opaPH/olMC9o1ZDDWTLDmpcPEg+DPs2"
+    "JKDgOD1Jv1P8oub4Me3zwZCGTtnLmfOcv1Le/Q9EFi67Wsv2WxAuqdjc+VhZL78xN7J+Wwc4eXci0LNoaSl5EYdkdNNS"
+    "tbqQdnkW/kqu5AQdYCzvRY/bprHyiD35hnt9WblOR4EmWRGAln/2Yu/YL9wPcgvPPWzYPHCyR4qfTqBRXXIflFtk+b1S"
+    "f++zXn+s8mMi0Uvpj2ZUuCiH2WgXczCq/J1XOY0W3LdTV0QO/G2XoJmJ9lc2ELJRREWc/ZAY5nnXHyi9Z0KYUim6SBVF"
+    "bf5SVM3jO0j6csFQmtuR4UhOxl+qd3mobWNS7GqhmesOar6lzelVqmcfPaEBL+o19POB5+9NwzbRYb5vBm5fcYVJoqyv"
+    "WogSlqXysvfFOvnwlmeJP8OYrJyjMGo5pkbLTl9sa4PJAiN09sJts/vmoXEZ/RvpBrHMtTuaxtN1OoIXg4sNbHdijynC"
+    "P56w4XVP7y8OxG/4Rc+mWELwz6fSHIVW6o0F/WYfhbVbBK7wZGxI337N7J9kczcn9IVNTKGcqGjQYov+IaImZL/k9Acx"
+    "6ze+3/BprE+3xqz3Ush3X3pxMmAsQkj2opkUJSjLMBBkRhXKxzg8FVWCXQKRyk6qIgIBci7rZ77Ll18a1SXGu73madUo"
+    "jrE/WvXZkV7kYsoPnTq8Y0SJfSkRUejkLsW73OZMX2+gO1rLUx6yJug46XqpZAn8EJbbjE4PHP7mQb3YvoZdfUqIaxej"
+    "ziZ3/Q3m0pUrwtxFRdwdJVoCIyRFKdF6LzrzGr7b4fSIuGwDHt9nj3Xf19nmxQi2kdG9tWupfIfrMHbeokeBseY5XJRP"
+    "5a61tb73bTh/2fjaP3IRb3N653un4k4cTvDXt9Cg8nQjWWWJD1070pbp/AP7eSQxMn7EOMIPwn3dDppxFXmdHTRSywJt"
+    "+WMBMYj1eGHE7qZpVS5GeeKRelhEOlTk7y5jTBGusLWIyFwzb6TCXhpe+XhsM+IX6erwI+ogcmTC67uJoP5mvr8dH/E0"
+    "xwbHtjjy/dUBsqB7IzHBAvrNViD80eTCJ+2LJxLa2m9/qlS/2T7ybIXQHQvyDqkUcm3YRp3KvS2nYygSr/Ddm9DXu1hQ"
+    "ovLdJjHzsHV/Q0RC+6vty3w7Z+/ZCLi95ufXSkk/HRl5keM2SZde9YoBomauzkY6lzamF1NLKnp6X0XdblLQatr/mFLE"
+    "d8UdUBwYEXXwIW1OuLKD8fNLRpbFV+Q7b2RluMPC8wiSnDY/ecbEaXXgnUWjh09Vfe4uUg61krhy3MMfTtId7XcJlXOU"
+    "6vfbUENDpgQarl+6pfqzxcP9dUGS0EjLo+6mEWYP+o4/zGGT+tW4HC3ZJVhY9EVp0QHskSS1RFPc9jIveyWflMu2vQjz"
+    "2CagdnirHdKTPbCpZ8NRW9sNkdn8Nq2aBRD/y1kZjbh2fvcu8drianX8WxCB9zChYe/BXEdIi3CLcEQnb81zDTpXIZoM"
+    "B4PLQei3+EtEZ+0jd2td+eXJt7Ps5iPCb/USvlI90QVqtxy1nl2P3VvL8s5dOdS7iOf1n87vuxU8v5yW+ckx7QngVXXn"
+    "vKxh+02pS3a+vg1DPo0nLeEfklLLOoeMtypHpll7i37FAPVbuB+Y+F+KDlwXONWp9F/dvkGzndLk7v+w98lzhj2tEn0h"
+    "b/2J+JVE9XMzVpnqQ5UDeyW9697f8ZeOZ8euCJdczNVSeOr4keRIFej7y//iTKBV7UrRnbzmV+zWf1TYFH5/+KVXThRN"
+    "f2gwna1Ua3pnc0mO60uoaACoTOkuNT9oega1hKzcIcsrlxNydTl26TinRSWWZWxaFI7ngP2xdAlPZDIC4Sz47OD9GW7D"
+    "qtN00ZPYJrXH3cZjI1H57tQiAQCfhtU7sa+aTi6RRE3NvJ6UErUaJyX/Hfa+J6Gae13JmUnM9KAU6yfs1beOm59ok69u"
+    "PTG3i2ssiN9c/OVBdH4l6eqx/hWOJUi0K/rx/KTNF0jmT047M3USu8I3atZNNf+ILWGnarJbeKQqFfZ9v5imvWtEHCVD"
+    "Z8secnu6rBVyR92iTJUdw5szDm3DNFgLmUxVpui8H8V+CuO3IfZf+M57Em/RuwG/8IfcLPrC0G5/hIkz6yHHsPUU//Aq"
+    "44BF/srzdfVazeG/fJWciT8huyxjE3qBUzGCov2aXAF86KRv2nMVf7+blRok/Sto/im2WjNsZA0WrXOITZrmdHvgZHaX"
+    "PiKnZ4m/e/3pO05YZNCZk5A5NoQmnIH4zrd8verG8zfwapnaIWce9N0HM2ua+UCbOFffmnswvWGfdMUqioyAsi7BJQ+v"
+    "mcoVZreT3yCIMKy0WUx66n96uYR0+3DjTYW+bm71QoLy6PmeYkFlq/TN5JTafwlV7D6/LE3t1gsEJKroUv8gXbQAjRPz"
+    "p0Q3zjrfxncqtaJddggnpH7VNdyL0Zt6kgcj3AqwtHzqj/qs/vQCHviaqTN57llLx6H4+2Ivmngl/H5cUxX6JGbtSpht"
+    "sMFxjsRH1km1XKTnkN0RPbFpeLpGEBLJ52bWwkZiONEQr3taC/oMqyubdfU6tFNpu2MTwMXwYCrttWrVVAw4OUa1zYG7"
+    "Q0xFoICSn7Er8nL3+nh/aYXvn6AtxImXBuJ3+fcAPpk3M33fhc104o+AlgTBjGCPwPQOtSu95fSzYTKVx794LWecWKxF"
+    "npA/dcTA/178XMWHJkBwLXYTjOpc3VvMN+59O/t3gUkcCuK9UXO5P1Wh1YnRjGr9//3+WzMletpS/eXTBtpchqtq4Hxj"
+    "as6085nPkYPI+4RI4crLUuGJ19i6C1edE1lDRh6ubzzo+bWvG8Typsd528oBei3JKK2GqUBV0lA76bPiiaUkXD0oawAN"
+    "+pZoLTvi8Pj7+/G4xcQ1E68ZvTGGuylHWhbnCcDIxeDsp0Gz+iR3OiDdICK+tDP2x+nIeXygTeYzbt6cAFlj8dLjhoGL"
+    "/ZfBQiwGaD3y3uXdXxyOMu3cD9n/mN2YtvzOEP6p3vZ6ZYs6Z/Az7T0gZg+y1XKv3YY12dM+68nS7gwfQeqO744gOzg5"
+    "oe5oeA+Q8lHeie/Z8vpYZLFHDvdzr1/5o301O8Odoe/GX2Gs/jL4Hvr8++Dgr1AXnfl3IOlR9+BivVdXwxbWwUrMpSCg"
+    "HuP+QiizMzhSJKBr5BSEaPjqZ/tYF+ZDdcSuius1bYzeeb34KW3BOVxjwfbUO6wkzmDps3Yh1bpVEUVuXD0SHd+7e4H7"
+    "w/WbXhacRzyuOOhgbKw3wOqwZiVeRCi444erzT0zH6er/o5/zd5F/dYyGkw5sI54T4wAXmWUvXwddK+Dr6k6vYpkGqa4"
+    "/UgmJj7FWs4vp0BFe6ELqwHuopyZ5LyN2TkufHBfVKl65ceP1gx6hKxgxNdLBB/iMaD44p/V/g333P6KmY1S90VLvwU8"
+    "1T8/4N7oQ/w7zhiPS3MZhLaO2sOkju1vh4zkb8yX08qPavuFx3cdBdfFkuer7/nCH0ppLSBfrqxySr58aG6f8dpVsaLT"
+    "h/BvfZj3BmpaUrusOPsC7WZY6XWe2pQHP976WBq1snmuGV5VnhkojkhXrz4EHogG/phxQBSrNzYqTAytLC21MyfK+M18"
+    "3XqnlRtlR+dhs93v7HPdjIPrHmvaEOX4WaDBj66n2vVQLy+JwTs3GzQmMxvxysV5mhPJMlbXCvqZS6rHTaVfgHpFofsW"
+    "gQVkjcfvLxddXvxFqxQXzBs/c4Qn0gWfpj3uqJMWea24O9P/qCB2ukgS65L4WwDwK2Dc8IsX4tFc2a1rrE0LO4qH5ptg"
+    "H6b+kHXserNKtNSdb7UiA+uGkMvsTIGhl4hSx2y7gTKOX4v2ugeNfXgfAmeDXJQL7ZJIAW8/cbuJXm3/1TB4he9KeUD4"
+    "phLFP+QJNV77oUGcLM1pzJ1ibUMSCn9RZVtMDfuqmgk+Yz+sLk7yS5UL9O5y27RYPNrO47mpVbgwWFS2qtLhuVKNuS6u"
+    "L4OtXNl0PdPMeM8SNxeq8MAkjCfLKijTFrfmValQQPeGxYQ7UEf6tuxf1saYABP6pxfFvpf+dvH+WJV9SK8rsT8bIfil"
+    "Zz9bhweG9Bhy9baG/tt6I9NutfnImX49RmRE97PJmxb4F0kVvSygMOtCzm/AxRCh67M0K+NrcsC6cPHfC+nSu41DV8xX"
+    "6FeGw6cpST5A3/Bb0mbr7ovO8e2buh1e0OOoMfd9AzMaS1Pqr77XQlqzKkvDRSHBX5y3Jv7p839EJPzu6BoYDil/MHDg"
+    "3YbYG737mJW/Pqyvol2mbohr2YPRiDGk+UzYPxI40mGs7FvjXeXHaFPzyNTmxyCptnXeEKvROVQtz5D6oJEPx61i9amX"
+    "/QZB+4MAq2xqL010U6Mq4D5PInT55jz5Tti0wKiea4urhUMMNdLooa44m1CDQZp6crGb88cHnvf5jDhi6j7a+uUg+VI+"
+    "eTlflauEtFPmPr5o4S9bq1r+HUc9rg1blldPsHy7O9/IpUotNnAh9Eg3iIZPCbaaCOxh1bwr0ep7D92VJgSH+Rsut3UO"
+    "f/uh97W4hgWqrsyTEfrF4LYo2ufkP/QAYs7Rkc8FnnQaVj+XAPCoT93X52VS5s6BlC66fn9ys3CIw3UDdl/Vgm70a2Tt"
+    "abi2zgOO89Xpvjtg1I19kJF+Z4do56MqDppwKnZW0QO1j+WQsGyQ1fX0sEGkxzA/g7rXF+kloj69mVhcKXxmvUvLpmd7"
+    "Hpilj8D9GW84bONotH7jv8STK0zu21/8/Wp9jL/l5urS8/fhdKaPlqaHGh74hKqLlsUniwgkRzGKxS0pvZPJSO+uvL/A"
+    "19B/g6HbYUQtbpC3rl3sj4Kiw/IvlujTRm8/4ftofv/4mKak5gNn17as1GUh/UP1JMq1K3OOj5cDt1+vL4tm0RlOHrl9"
+    "uV3y5q96htQr9q7EFlz4O0NipOKDRsWqsym9t8iLK7m1Y7VyhnW3TO83IM65VEu+lLvpP9F3wew1Xb2Z29bzzVChOpnB"
+    "SX2qmrH16ahQ2cAAIqo/QCH/LsPIGL6YwH6LJX93CSo4s66boq+iwvXXUHziWvmMtfXr+OxTh4l/UjAGonkcLd7Ep9Vi"
+    "9XyPqb+7ZFmzNWaL7CBpqA6x/k13YEi9xuN3ELnU1qDiHm76yIZ0tUf4wlLdyEB+efQ7fObT5zZT5s9rHGQ3IuscCjg3"
+    "Z2/sQ0Zfqd6HKugvSIqqcB013Wa8r/j2cceSS8Tl4lsXC9ISZVQhZo2jndCC1lTaLw6Zithkm6+XNopbzUPexRzCY9/K"
+    "xiq4o3/Sev6e+gtaxcrSXkZOehyca+Znu/QYKUBv29yQotaJGMbOJR+KRtp+bl9eV6EbvN/0xavii3UzxdFW1aHGrCJG"
+    "mTnML639WSJW2/OYQ6p53LSEtbH0id6Yo5NnjNNtQoSRYpL1705X07uWiLWaeyE9lo1sf/44dd9ZzJa+iWiorXPv8P/a"
+    "+9zYrfTiB7ZX5uFW0L6faXXXM6Xl5CTkrpUl7ocFelblLpQpK7gO+/Qted/fe7+Wfj3xsog3LjcZfGY5iyyca7V8dPUv"
+    "WjKEcwDMbfUolcMv1OvyynkFJOpBSVxS8sSu9Ru3qouss0smXA0P+iV4w6ccedgfXoOrCOzd/znk1shk4PkH5ZASaueh"
+    "eD19v01TcvvpaQD6TfdIs8j8+pebU60Rve9PwjnKJMdtl3OptMQo/8JHuQKMYs3zGGHMUNBnWJ8k3967T6vRkWNef9wu"
+    "fyXe2HVkaGD4etXgzxm18cp2YJ9m4FTIke226+PLSSd9DHzzoFpjJWoeW1B0YvBbOf5gC/MwlwT5KX+ivAnTtnJne+Z1"
+    "Ez9eXNtaZZOP79VpNsuhG0MKWaYoXsfS2VR1UZi8fumdR0QW14H2vmZzEVG//tBkVIymd1vpDm2ZUBJ0cJVJH95WFtyn"
+    "JPFp+1P9NfbdK/OIKTXFZADctzu0zH1XCPqHTDBBOlMAds9eBJvqlgntMIcZInat+YredNrgriFTl8Rmuks/Q9+NaKk3"
+    "HX7+4DNOjkdwM2mlGYyVcecs/2QumH6+Yxq+V5uUc+LPemz5/nhJMUqml6KZVlDUFrIbIMebRAvMcqX/cxX2t66IhkfL"
+    "fEqg7EJjo9NX4HqZvh5SBBLPSfhmivOuCh1H1QbTbItNkVrCCAbXfGt3L8q4hCzu9Gq4Rl/PZkbX5XkJ8kFq6vyvzDCi"
+    "s3XSfHDZBdUAljTde04Co0Ic+wcnyqCy3h3k51xJ8tc7v271xt4S3vdAD6c248IyBZr7e/U5F/QVOTHK6mu2oUXb1gDR"
+    "Rfjt13RMuXQX5jd7XZ8e/qP/tJnJ5Z+k7Lr9JCKounf7i/lVwSoJ/c+KDjJ3WAZzzJ7POgExmU64mEyOHx5wtVJLNk4t"
+    "Zx+Whegvfh8cvllMGNZ1YAgvdqyeXZ+Mfg8lx33y+7NUDRyI2IoO140XjvytrTu4vhP39n1T9avatlvlFyX0kTqFh8P2"
+    "aRaLj1HsyAKFcZ+dhHbnfwvyr0Vt3obsBn53b7L94e9hI2vsFputFMEml17/MnLCJWIU+MXDtChmRO97dY3CqMucr7kw"
+    "haz7MEgff9dppuFpwmSJQ77ARPETJUvog9bfFOmmOA/l/ZTnGZoJz/Tz5posDm1PjIAzbKQYnRjX7GAuWHv+3bObuj9+"
+    "B+hMP6t4e9Pf/kTy12U96fMpVzc9xgGze6IFn6sUt+LzmR5ayE0K1Lwt9MMX2vXKg6XupRyAwl2DfnGxM+s9K/7R2nL6"
+    "/qKTg/b1xdshKaftjKgaYSWGmA/BLzkvN/aYpZdoAtwtCJVaLjqEN5fS+ThVCUY5g7e/dHw5ZsIIx1u7+prlO2w8e7H1"
+    "zC9TlS6huujMt+rkLvZa23j0Umdj0Qo39vawyBuvO6iM0xzqja4eHYNBRglly8eMhSx3jFOM9ii3v+heIOtahP38ntGS"
+    "wDuYVH0AgDtrx7woQxJzb2Bf+nlcup2vFcwYA8itQCtnkeeXQn5s1A0Hjl4B+5VY9eUT3n0NvCsz6e8/f/vK95vYlaDP"
+    "/dNJ083kgn/ASGqY46/PN+qbQoQjIN/qax+qllLP35sYtQjEN4Wpi378ZFRTU/YfmzK3n5kyf/rJq3G4jIFBwuSGcW5L"
+    "bu6LedwLRStXQebcj0F/Xj2YhtmKu6TPKJd/dT+3Gf7MGpHtEHebC2D2FC2SNwbwUCmOpz7Q66reBSXNjmbUik/edvlu"
+    "nMw6kvjXlusdvVYqflEsLOnbUt2L6ejhRfabp7Dlu8JmBxyPe19Jrv/UUvmYSIl0JN+I7xS03gBy5TaxrvwOTmPCA9uy"
+    "DX5uATMrXBD5jhWdTlxKn0hR52NRr9/aVxpVH/1j8ylajfw2OpltL336vErRBTkfmPU76IfbXN6prsd6f61pzmHGIOyG"
+    "1kBEqn+WGoO0H/SW0UX7E+dF1Y+tIpUft41blwZZ10UloHls/mNGAkmZ9R18loFqPn1d4Ojjaruji6bn4wTr3c9csm9c"
+    "n1mgRKIm+dTqrmozb3GWZYitqYHsLZt/3yfqBSzG7b4EAutLJUlf5Lgs7/brKepO7Yee+5YR0iinpyFe3KL9GsPeSYUP"
+    "3jN9+/aDsvqhXrB8MM8Zu3K3Lz20Ob1pwVK2crv32as9g8+EHtX3VcjjM4h7F0b5h4q/5sYg7VuuT2m1ixeNcrbsKJg8"
+    "wal5767GE43SFkwZd7od4cP157LSJlYxWTH0uxsV+snuKSU3axTdqzpdqebPoQZ1Z8/hjGgNoavP+Ei1cUa7IiG5y6//"
+    "v/mvtKEfXcj7D2U86S2uMW2EWPO/dyZwHfmbqsPx3i0oYKfiNc7AthgJbZXZxqyG7rClGOjAZvhFuExCbl/HGkINRUjd"
+    "Y4xPfVFW3KnuJ89fmPfZNkOiLqzaxppdaNKSjTD8vuwbw1Gh9zZ3KreKe2r310u9PfQJ8BMJcaJVi8hDQkjE5jDhymBz"
+    "m4D/Vmjv46GYOnzG3D1sPbnzGSqdbLj7yT+KXitzd5eOzuXCbc4ZitmS0r4s0FFZbBVw/uhriNJZh33Pjb7PQdBr0Fcf"
+    "K7DjgE3yQ81a1ozX43bCLlXC3D07tz7p3I7O+Y1/Ys97mwNzXe+OOqlR+W9ouAeazbhMjqp7WYWCibyveq1VS1I/89aG"
+    "7we3CM7UkfUIiDqzYKZUuYKkPvf2hbD84+dc3Bc1JF4/k2gHcvfJniTja7vMQz1SNR+ldNsXHTnrcc4VqA7dD3zwdq/V"
+    "wOeXRE3jlO/seDki2uR6Y/GT9cS5XSaJrwI9bq97PCEL1QHqbqa/fxtERBZzmCOW9xynF+7t3+DgxfvcuDdp5yWhettK"
+    "7dfTrFMJSFn90+KQhgRKxw8fcbkPzvLeWqF1rnOOzoegPS7CvsvWn9jQT15v18zjOMqctx+/OGN+R2NKZ/ZaWzQdVntv"
+    "PRPZMP3nu3H3gtK/4Lp4CaXDGuwJ/3vXdbAn/VSh+X3ybydA3TF9+pJZMpexQrDOw9/wn7LTVcI7TM5Mk3wXulTltq0F"
+    "Fe4MGvvyZSyvZSuW2bR9jo/23fa0r09IAlWtVDwuDPo3/qVN6C3PaRi+Af3SI+08N/fb90c/tWQjbN1H5k/bJLbKULyI"
+    "y37c3/121wWYjESh49vef0lXZWphSeWmTDY1omXsPKRrKwyqt6Bdd16ndNyMYWB/c1784C2drYXcJQmTuUALq1qIwRyp"
+    "t+8Zm5x+d/v9BiP6hmcQJ8+L9Da39XSVE5/Fr0U7vtLQKZlWT7xn+miChTiVoS8GarF24yyyqsotYEkbASy7Qnn0yS9+"
+    "dK//bowGzV81ZhrffvKQt5JAnRRZka/igOroZw+zJrFBPx2NsAsN/BPsDeECp686n9kaZEIqarZWTkSK9gFrgZH3Ozfu"
+    "En/Xcr7dinSXvGI7LlgdmXHHnvd18YyaY8dL55KxjpTp/yD8iR/+iFazMCtm6ib/lCHp3kTZhZx/1DuXCuOi5PxerkSU"
+    "+vFrRTKFT2UMQiUZ0+RvObppDU52fLzDrTKscZSAx3VzE224dtj/dUYQaykT4f9sPo96xDInBzqPTVgUfwK3zydkcFYC"
+    "l1/wFqwcSP7QffWPht3y5T4754rCbxldGQr5cwAEbi6d0vjfKn3NYRISXfk4SLj5M3nJUmUquPmTk6aIDqeE4uq2Saod"
+    "T0px56t1vS+tPc+K9GLuPuhMMfZTrTeeon9fmnapawsuXGZkcrpy2LGfaHmTJSiJYbO7pTJCVdlTV+dK7uyWiWEB8zQF"
+    "R5VuPnzbGrr/j0ZkXP4oovwwJTvrAaOWy4fwhbAXmvvcN+nsuN5IRe61Ltzkd1k63+m0Fp5D5NSTVVtfivZcntBT3T9e"
+    "OieXUMTXQpq2XCKIDdopUbph9V+Invf7LYqmKhnyhy+7O5iX9J3n00mDf0A3dD+Z51Le7wp+LwJuBWtYS1G5Tzd6S9sB"
+    "1di3i4sCnxnLe9KU/ZzEagPkC4Zc+0Q4upMEOVtO7o4GJJ4oC8zMrrJvr4kKHQjMpmdwzDtt30MIDKsoanh8Bo3MOqiI"
+    "+BMG1g8le59mMNVesVfMo5W3Q/bdrslyVt66BsmZtGMkFahqjvXL7BSwA0wkdT9Hl6Z2xN1xPcmysnx2zxcsCeBmGiro"
+    "6dz3gu0F7Dp3ij1roEfcfvd36PfYH8S+Ur9MRvnunb/fVucZKdXqzWXQTSn+kXZxNhbqQH6pw72ZKlUC9bW4+KDZlQKH"
+    "rKH7jcXx1ukyTyx7CM4CyuFaX0qK5rkbmgkCclYVH/58EgWoDgbEtTZrL27cnn959zhn/lzmx+0qRYYPbLMdGHT6XFB+"
+    "kWtWfS8m+5V/yd5kAN3zL88PP6xzdWRwJQhtPQ3ffUFYX0ViGlxYHKFz8ybfXLgKX0S7AHbtmx+kT6WWe23eLJISSB3C"
+    "u6gYHdXR8rvFr2ZtdizhrfCc+2zGw08DlOypT7FLM3xN2iTZ9Y0rthKHTx6W9v0wrFNc5zGYrrgUtkX/it7OXlFDcrlo"
+    "CO6YeJ9G6MuAYZSFvi5nY1Kuv4HZZva8pk1b126/q/hlFxnmcUphNWnTyMyVsZuMVl6AVs5oB174+kdqH4ZzUbMaCSw2"
+    "f4kL0nvt/NbKxp5Pj6qYT6/4sqLrkbxP7JkTs9rPZYbBSlsXRfUR6AJKcXzTrUB/QK70X8vWCHsP23QqkX/sUAUqgkDx"
+    "5wR41rYKpBZWXW+Yy3+qdpvevSnsh9WGhsmZe8eM5vGPgJ4n9379YsB+N3FdOJCYdY0NeXooYDswuZb3wHk6ITZ7mByc"
+    "OsMKP9k1+vdOIORQYuN2UnGdS/cDVfXpSMVGqvx+zee7PSZKkWNRc5cP35Hwd1LYdF1RG64TkgwI4A2Uo/en6n+jmxHc"
+    "vL8rkV4GTteDhBrPnDStQCf8/fnjbdQzj++6T17fMbygsrtOZxRacDUwyCXO3mnlbE+vE+xpU5BzZE0aMw0Ke2fGm+QW"
+    "+JX++eFSm9xSaLJ6EznBqcJNuFiaSL9rUOzC8Xl7rlkzn+52q6++1Y0gq7bS8Ert2uJ/kzy57YXvQQzI2IZ6KZWrISDm"
+    "IwSTFdl8qcehUbMoQbo0KSZ32sCpmrU1ouR56oulQFBBzL10FnRr6/7BrfaTG7/xTLmd1oW3HE0RQK4FG2n7j7PsULC5"
+    "MYrI7krvIaVq2sMdanfvWkNQOET8g0oeZQN2dFuEZOW37cVx/mhB72XnF9Y7r/m1Tf24vzi/YahKeLmv4jMZID/Z3lYF"
+    "Wa8bzb/h/aU8GzBufgtor5ZhNSb71kLiAys+N8spqufs3XyK9CKDUYS49/ojSe7k8a0aFjc2pPDSrbRHhfYs8Ljxiy/6"
+    "biuK3bwoHrrq/JNJSxYbB3ciLYlbzdZtfuUyFyYb8kzNL1a4/Euhe92SUrVydjTep7BjwP43ADGEKZ6skkKzkzepq11m"
+    "UVcVJ3TVkf/Ofk3JjWramR7sHEy2hyNk6vmPXBz7zkqGcP/sKPSliqcB7y6lwZV6oxVXzSXP4xqimX5RTX3PLYLqf/vi"
+    "5y5kc0nGs0RWP0GENoluFiJ+en03nKDtbSwzXntborsP4KK+w5yhyLADgVG+OIkT+rwU4+klp8ZwyRQXL9Fzx3ZKUMlj"
+    "bxE9a9irnfmkRehnHgFYVqiXd6Mk9WUck/yPW5HrOzv7R2ue/WkquYAQ9t+HuK0w71wGzzvgqA3jWl/UklujzZaGm9XD"
+    "LStPJ9amrwcmg5Xx/ighvgTHGpPEGEg6ptu322SPnZTqyy3pe956//uAs3K3+dCbTOubFPfxCHxjbsjL76OT6GApQU/v"
+    "9WrDgIg7q2F1YOxCVHJcmdbjTi+y7ZMQI50lAyGut3wcAapM0aCq16qYlZaa1ytcuy/zD5Le/JntfkN0Xl/0kGrdPysS"
+    "P4dOBrcqyffVA9KrVx+yVyzocxCJsdcw2ZeYjMWvXVb7VIL4ECYVvEtaySxGKVJ4rwyHVKCO6jHNWir38tpzC8h/Wwom"
+    "sR/nOX8YNrfq8CtDL66iphUGKwqFw1RmF95q7UhmOwdWHsWX/f6W5fIBnSe9H6L4kiMxTyVQ3ix/kWm7ckGQY/VPfdTG"
+    "+OalmRfjKfd6HjYHHT6UTXnK8lMpd01BaLzVsvnmOB3hgE128jjBPQ2SpuBYzuvBhSPr0yihcT3AA471nPYdF59yN73P"
+    "40qc4+9PnMyeJSRZpvv9KGs4frzl+ESlF3OZDFT6StoHle3NranZxy/ffct4Zpog1+Lon73Y+/rxpok9w+y8mIlcgDDD"
+    "tzHDD5mOOx+kmRqVu61UYkcYNzwCOXu29Oy5VIIWDv/Njut7CQFa+HIEAn3WBIcGlCvVGNwvi7kysY9pz7mI8219DnLU"
+    "rZvjNFC51N2lolcPXV6JaFoo5jtr03qxTuVAyG/HUZY6zhuDx0JWC879JuN8Yz9Nr4U2CBTTOk+sacHv14ionJGD1Y9e"
+    "wBMvz8CZ26oXZP+St5+hBiNfaQJ+zg/tDVsJWrxP5nGN5tNoUu2tfrr/A/s8x/qfIg+/+Nd0FiarnUeq0f/4agdVJHtx"
+    "4S4hSfxMEu+uLr3/YPbgXStrpkxNpXnMXNoLb1IK3CI70r0JBRzXT40/y4m8pGGp1k0S9ga8OstW28uxmosDK9TxMAnH"
+    "loSWDitM4ouq09bdbXGMPP2nvhqXi14YztTX8nijnS3x1UVCEq0ohYjLkKcNozevBzoFHehqoYr6uGynKSW//XzS66Qt"
+    "WsGPRo0UNyVYZqje7/cW7A4bD2W/yhxVG45IBHo1EXe+Dzt19Ap/Kb41ef2zwjYgJlJceWJutJ1dvO/gDy34AWm/fzmv"
+    "4seqR2LJxYZ5+lfvXmk9LeO9PKTvBo/GLNJP2t0zkUx1LPm4nBOTra+kGQ6OvM6h/zFHhc0vurILMpDFYFTpmf75Yfqv"
+    "RzNNQf7P6V/8vJe3wC/oZfr07JFcuIdwXX0OHTiH8UfRGl6Gc+T0kWjbrs3L6x74k5fJqzK1R6arXPCB5nxp3lj81wZd"
+    "je9E1b9fd2ZqHugGqyvKrugB3QgsIdZlI3WQEA5r+aFpgE37lD0vWXTRdEX34g/ZRMsPkpyLy0ubIbPaAwnsl4hKr7PG"
+    "WQyb+EytLvx7tpGm+uhpTLxwx6s/sFvlG08Mxz56TSy/yWRoOOieTLvGZVKQ5f2mdQMtn1f25effnmssSLuXGnrJhkr4"
+    "n/FeleFUhJFvkFjy6nw32CWE8ZEB26ddO0mqyaKpahXUWS9GwwhlPNM4zOFn+47Q1vZ0OZ/UWUhBwLXtqgbosfdHrmRm"
+    "V02ZTXjML3g1TmD/v/kv6LNw0DygrEFnTPH6pa0mxGtHpQRYt1KcQvLVKyyHXe+XaEbLoAW0lghMBn7pgsQROvznbmVO"
+    "DBx2/9xn44JoY34tTjovMeNbfvHNp0Wbg0xvAOEtV67Zom83zO9jgqO5OeYYDV/u8kT3HFDdhNgHvlney1iXSWYaedyW"
+    "3WykuIeGhYz9HzFfHVdV1627e2+6u7u7O6RTQJCQki5FkBKUTqVBGlQUSekWBKRbQglJBQEJg867Nvi93/nO7/zuPfee"
+    "e87L+mPi2nPNZ8wxnvmMsdhzSlz6dGGzzT7CqZhJFfpTabq/ci7+eeeTpLsVGSePhBfx3uK091s0NAadTZalSRmmWeTd"
+    "qXV6tXM8+dPJguKQiVTZlxaF8SH/lffH38FyutIiwvMcJAZiLsoUFsSF/RhB0WJ9YFXj+FVmPBUgKwpx1lA8tlNoVta4"
+    "69aGYNxfwDaCskfhKUjK4eVxYH5VL2V6vaOfLyz6XEQB7OABnm+PoQCbF0e2P+t+B3NldcD0LM3orR3vpmjQgKlhE1En"
+    "xek3fm6R6+k6uL8y/+Y2bbSQqWA77Pk7mlCf2CMLOXlO5P31yesYTsXaUxKy3+2f83pMFsQs7LCK/Zrne0STmIg3R5io"
+    "vepx923hHVYVfBEYT2LzQ0mb8ENc6k7q2wyvYJ/CX7iy3XIyzcS4/8NpWNvku+gjV9XGsqCuztobg/yWtuJs3kcMvxwQ"
+    "BWUYdM2vP6k64bSEHQoJfhhnuHOUTu+73G4Uq3qKtVpRKtMxNUfK+LFMbPtOI7WES7OcZtUPxrrfP6rJEm09I27GvQoK"
+    "cv7Bsqi9oeGS8GNa9V39jXRNR3cNPBkXsGe/GsswxSGrVqiXv1JTRk5OgZJJaCaZF/OFCh7IbNn4XqlZVGMD7FFbbNxn"
+    "NRr2L9KLRqfT2Fl9mAt2ntxzpCkFW9ogplt289gc6tR3+zyiqddW4nWxipQJpcWd88xo7NhJdgbnE/DCK6S2fqxBFjWX"
+    "STiLApNxquhpSPtPa4jJFt53mrxmDFJ6pZLFHun0hcNueY75RSpxUmVb3M83kU1UFYRvxRvSNByj5ekZ7tIy+4QNxGGJ"
+    "g3xly8FsttmENE18Yhw31PQ4tbbnhMVHGOaaOXBk9ZS1zXZ8c0+Z+rmZ+E7bn36VrHn+RijkVJ7cR8x2+NGahJsvqy3R"
+    "sT+JOIhZwyB560bMm1w5KpKdwH6bFPHe4KeiWm3DLHURN8PJkd9zz7+9JMd049dgxot/m/76E6fmK9ISOn35B+oIjhxx"
+    "Ie8JO93cBRvOA/1niF+z8UY+jQndLLDWyp8V30SNqZpIOMZWyT24PVGr7G7UD9iVJXW5ic5NKsvSs8pNs3Mzsr+A7dRu",
+    "sui5O2bIDf3++UNHFHs7TgksxqrDnWIzX0ye21EbtIh/zPLYmnmzNgP0QNMg5IUav43ZgV3b4zP8QJZ12SmmD08Cll6F"
+    "342rX5n+YHT2NQvnjHdIOmzmx3d41k+hdb6IOQFPFrDkU8YvBImit8VvIqKmCfEDHN2vF5eGK9I7mRXUeJC637hNhTP+"
+    "zunZ9JFbDtOOkrBc/y9LT5pW5dyu90xrh6sF1GI6VPHHA85fzpNMZpnFvjreb49geFmHWfK+Wffz78SaJMXBEYtQVBpv"
+    "/nJgOb7RzudThQTDszLlFSNRiYIbcVqL5TSZdz6/24+7fgfxPUdr8CuBhfYjJeK3hKwVZjE3qq4VKojYDLdy0P0ePfiB"
+    "f3KHVEMAh2bfhuQtJDHv6QNV/nhN4/iia8TIyPBU1cXJ7NBGW9M7vCrZn6jnd3eJAhdvkE6C8rpPXKzkadrI2O0sxFPe"
+    "5EtWU/KS+rXjyeD03u0l/yRnHT/TQRdDlUWpFywBh/5KrxRyNMKWj6dUfyFye51Y6nf1AoyP6fe9w4s7e/RjAaREmOcD"
+    "dGn2+4yvivnpnzfG6oVYR3wtk3OYTewPL+RmwSWxNtYz0u1TVP70+GkS+GUQkdzrQ9nHuoFyR6K56TxHmozEiLQm3AxT"
+    "bSXYcjiLzkOuUjXeL7UW0bv4N5cbU7D9xBrjERgORWvX8N50rTyNp0BEaNM5vJYyVU3Pt1pfM339xuiuFdlYvfwa7+lN"
+    "06KU3Sq393ACWRvZ2lUpT67AgQZphkFtx41DbWtlzKrztA9JFi8wHjOHTj4oIHxuSgvfdPPpF37iQ976O0dL7CQxa2KC"
+    "wFUP5je/dN18eNXx9Rr5KIWWvvD3mt+UFIlrIXtm3Q8i2VsuRil8GGZaZ0EJB/NrfiGJ/bqlGc2Zs6PyBRF8cCep79g8"
+    "NSzjpcPIu/qB7NmunW9KnbqjnjhZPqYefBmE2jkQev5Rj4rQGu82L5/ngDy4rDf7vT7CYcdwgCCVdecxpoi6cFX0tvoj"
+    "kuk1aeH1fsz+1VpV5PZmT0ylY91PnKnxos4DQ5nCEN5lyuTGuQON4flwdQ55YuIJUFyYw40fFDs7TXoNc3qQT+whPu+0"
+    "jhHV9AZP1T+zBA86sDEem1c9/u7jdENC2HzHltKn+Pd4I08QfmUUzkq8gZ5lOXtc/Z1hVv7IElW9uXzs779FFPzcxCYc"
+    "zIfOSjsZ016z4irTku7FhhtFxU5XhEHcFjNy5hdUl3mg8p/JNiCNn3YmyvOKHHmEPC2oFlDGNd3PZCYUtn+drAYYPkdd"
+    "SK9SBgn1Tvpvn9jourm7nRiibipBJOyDSFbHJV4maq5rHjmTiAdeE7uI87yH5VVIS/Tya+Yo4/BroRc6ujZJF3q8zJUr"
+    "+wNGr7Cc6rNj3WOkHutAwgkOwsxfKrySnNVPZGq9ExNKHnPCo9onvveVs0VWpd1oL9EtXDHFpviCv9E3cz5XC7uR/+ti"
+    "5t5r1lkHX4totwPiqC7Vp8mGGSncVV59Xt99V1UcS4xx7b3IqQP08hiCU7Ctl/aFckm1DngopAl+jIh8lsQMmti4jVpc"
+    "zMt3Itk5MSduiO8/W/11MxTylS6Q6c1ix8WPeR5lBRIuykfnOjb2Mg0ghZEWR2/zHoyva4sZSQ/UvjA2yaB+DDdcL+0Y"
+    "lZ8e7rIWC7B97/RRI55N/xQvSv+6Mjja/zvvixtF1riM0Y8ZI2c2JUpBofTYulQorXIpyibl7Dbsa3Odz3d7C9WtqvDV"
+    "JvuDrOrc7/C/PYxcv8ZydkNpzFWU59h5NySPZuzNqwfrM/o7uxj65hvNa/zXGuXDVmZDBHDKMxQ7/AdDHm1gpxUJc57N"
+    "BX5Wy4l0PctnznI3oqFZwcBxdIXNfR8Ys2Sq1kA2Fo7SV3rXfarTwkokCattWm3aJeVreHEmgGyr+NC85pBvw5V43vqo"
+    "CUVZm9BDr3V4jeE4JEcuzL7900UQ2cTkF2iscOKKluLow3ugFxSbyG8dQglCTJIS6Rmo984tvu2xqOhKKeJuF5uli2bV"
+    "KmOdTZMbiX4g65/7G+M/nNT9fJuELw5ovCYlNtqj9C3fGt1UMY/6eY5dSJaQc+HNX5apn0Q5OBMDVpzq/F1KhvAkPapW"
+    "icSLgR8LFmQPBZKOpvNAFzhqNH95ZxYnWNvb2QwISh5RRM2LflgMns99mNrycWNDLziA7BkT/TrrI+s3Y2VqJQ7ugQ3y"
+    "m6/CSt8+E8QR5HgdrskdFZfz0NYjmb0rpawm6mY4dJXwvTCDP4/jTOs7VWKWnpr5BdrtlfzDhl8xNb4Yv38ydudI7Dq9"
+    "zKy2ajziZ2J8/NE7+iOXLQvY4Q3bdr+SuOwtWXJ32/CPLqdjFasKLbYPDY+pdr5h7zkld5/jypnZe50/eFhCInYS+Jpx"
+    "8aWaKkkAn3MQvFcy9LBABfErd669ssa1aZstdI+xeDjaoql2k8QdU8FnUXI3ym5g5j54avMbT0eXYHpgcc2IaYOnYq7T"
+    "q47oKWwJKuPwIVH6QxZeOd/2n6zkCmkUKzrNSXSOskSYR6MxlK/zME1kZgTkGLBv3UTVJzUR4idYvmixqjXTw/Wfd1Xf"
+    "FFFKyXc7Kl+MJy5DpISk0lYrhRkn7OifvXbZFX/nFBFwQTe8qo5vo3suqcimeKSOtVFBxN1thp+AEiHAWaVj99dZ77ml"
+    "z062TNaRzfLTwXHrrKvclkbfOaU/zsfA3+7DNmnCySuyyHDls9umdOf72mwbU+WpUruDtPFRGTyvn+Iwnaxj/+CzH8I3"
+    "4g0zVrq+Rr78ZaAyhn8v5YWPgbuv/uKxy7eGN0a04xO3GXpiygcubD/tfYNFWjtj1RVRKIy8t4hYLiNd9/oucB/cn9pd"
+    "tAOLbXTBH2EIa1mcGWrFTtzoUjwEfbBGqWESDpKZd7WxZrc21oRcd6I/D++MrOz8FV+F8iVJ+03nlGahLvtkviP2My1Z"
+    "n9tnpIC5Y2HVZtanigGthAlTJiveWZUxkVvvdD6P1ONP8hbCaA8baU5KqZ8ZPylhji8z2Ffy9BoW8utejWAMnvLoHGef"
+    "FtbzW9qHToaXTtqtcmsYNg8uGuBaSalSUmqScqspBmUkDMap+eqH4eNoEnatbgnzGjcZKyFKf2xQn2kykMqv46lZx8u+"
+    "WP1E33xnJFz3t/GXLaakoHoaLq/QSkxvpuVC4/iup6XOw7ccPRjf0FzXt7AVrzXdePKqUrNyzs23LZi4ViTO2vnix0hO"
+    "fdBNV02JKm7kWzNd/iDF0BdN/jSCFwiXBHhmcrWKdubWfltFAG85a9H5artLotn+5on4d1qpwk3GGv4Sb37f06lgKW+M"
+    "+lxCy7oPawfwjJJax3N/upq2BP7d0uvWUiWJI6FyFPtvxDAX6lNgjglW94Pyk7tq7EOqsrEKOizWTmp+jFNzrKjgyRLD"
+    "iX4QPeulDQmX8D1sl2c9J2y1ZYdlNkzdabEYz5G3AW3IwLpb/WbTNPoXuo06br60UrCwcpb7JIlv+rjjEd8U/wUVGfZC"
+    "T2SVc56urpXe9HZQZMibCjIqH/ZNmzuMN1PFguOb7/aCXpN7P85uKwSrF72hnRoiYzn1WbxePxKjVCI2il+QFFm/8mjS"
+    "lFxhqvwmh3yz2HWssX160486D2rIjJvrnk7eEMmiobcMb78VexHEYmObMGO3GtfVpiNa/pNT2uN2ACvmfeX9Af5ajqIB"
+    "zYNjrXNyoyksAtKHbMbDOyVEhOruqtXhyY+mGhgfMIx/iPuYHYLa+tw01TreBb+IJ3UjGlotlvhlqTjVwJYsjtOhKU97"
+    "tyBfxEBdhUtkzmRoTvZivYFLmvD7ZE9L8f6tJB71XIHQScz0j2EjT9ZbM+JiJdL2VFj5c5fuYrg376oyiZamhdQINgep"
+    "UuPer+ctqSeI/mixNua5YyXbR+7oH/m+r60806lat2gHfONGjdrs9QDitnlYh6rjvFcbUcKLcmtlRwuC2w9E07PSCfHp"
+    "ByVhuJFKpYVFsir1SfCqtxUsic13AwLBm2q7CH72b03k6Z1h29t9G/CQ+/FLp8SlbVIyeLIOEUYzyjrHxu/FRJjyLI6c"
+    "6AlUwvyIpUh1spueqA7h3btBDvUr+YD6FBlrAj69ryJ3C0k2wOr0ohDH8oV1x+10/Ozv1glSzhTJPJw5ngPT/mGLC64I"
+    "FaK0Vg7dkaK72vPu8A6QzJjX3bxkuxFH/nEzCj3Zm5nIT98kJKmu6Yjqy9SAC1NNAu5GgZNerr72LbH8JIAoFTSX6GKe"
+    "RXEZLfLkwNkjRPpcrdXTkMVf3iwsO9YETPHRcnPfkvO6554XI+IOFXMhcGhQCg53E19tGS1mMWgqO5h0GctX+yYn/uCU"
+    "sScx7T4jdTt2E89pbVmDMsegzTU3trpgIiuLQinOAivDfGe/fpatVOJv85knsTRQXCph+Zgpn1D7D6eYtVrD/ZU3jE1f"
+    "lh+A0xwoNHduq6Y83o2XCtVSFCSQLbpxby/YRJUGT4OnY9hY30Sq/+uyPRapDuc7w0jE40TV1eXrvgmK08iwE4Us5JFf"
+    "6Dp+GJ2ee9D1d+KPt3xlBeqnENFZ3CYK/nHFzL9DCWfCweL60IwBaHXmrWoxxeY6Gxf9Y5WGWBMu7ouSoMDaAPksbDdS"
+    "lAa/WOTij3ve9C2vZip7aGdZL2I/G+PMppggmdIPMDCX+I5WXX/JKRBe0Cg9FVY0mqKSHG3pzruQGCfy9thhBM98Tdhu"
+    "pP6xV/oocHqzlG6ba0ulWbdt4UmnghCNYmRDBx5NoHSHvsWzpyBPui8ED7mSLr4rFkzr8ZGTF5Qv+76dff8uhUjxYXS2"
+    "Dx6CWvklvblVYKnJmH5qToiW9G/pZhdqFn+zRVTOglO0WO1AO7kSrXDRmlsnaQrqpPbXgXFFIyT3oXFeP12jFJblC2QI"
+    "RaQuu0ocBfMufyi7MpwFsvBijHFQO7jnms6cZF0tZ/BIigsv31nZhtHXSV21+CINrb2jVgKF+okR95Hr5CMPzQ5nXJmI"
+    "RuWF+zobfw0IdrDiKS9qPINyqHDLh4XAovH2DK2ZpzXnO9OSq4e8sYLYW6LLA+Z+Qz7eV5wJ5TX9+Sgwqx0q7J4M+e72"
+    "IUSVo2f+pWeMxIa4hh/u4LuwHk1yN2czicrYOyt4rtVcAh3povcRL9Z//fLu6tokSUep4oS//S1UrWKBUTonXXdLZ49M"
+    "GwM3X8LClnAZ35udvmN5KnSi7nNOUrJ98uoMV5DR64fq9GJTSX6M7KoJRrJ2giPv5Q+zwKlgSZ53yRLLma3vwx94anQ3"
+    "It5FOLty3koeNfjV0/OS2MVuoApEWOBgWxNGCUrIVc16XMO19l6LXUQViwy/DSmg9dMEY31CLY+15RgvU5pgILRPLZ4x"
+    "8IIsylVZYawPhvFxsDSrc4yhXd+H/l5fRfGqUwPOgKgvtXI7OOoTdOOl1sCee9wo8YxCFWZxnOCF02zyemhCuWzydQFs"
+    "b0qv1ILoWAUZDcMcGsLn+Qyp2bsvV+3d3z1IU19g8YnOZohKRq7Xe7NqHNR938CAnKXz+lMW2e7Tfhe6sWamkeByH2Nj"
+    "NcH/hqgmhwm2kysFQTgxaxL9Xo3LO1oWMb7jTO4M2vfwspXv5z59muN7y1ZmFhX1HRpyauyOUuOU3AGmt3kLGXKg4i+8"
+    "0m8ZCRDd7IcacZtKqDonLlJ4xq4SNfRCSD4wHcnc68zmoPajMzXnOyKrnKQOe5okRq77xElVrjvR14UVEo6S0aKMisJa"
+    "nRalmHQ/SReGz6Q9KXxC6DHu3nRnp9nsozn3c7f8tOFe2WgxXzUQZnuODzfOeLnZQgZrfpahb2Z/aSZUiEh4/Cuc/IX1"
+    "LecfMoxvlF/GeuBu7YLNyINIph7VYNwVj1N0d4/1bvWxQnIL3HaTTj1Wy8jt7uXqq5b8HDijde/U3grzx8zC0r1EmpNY"
+    "jRhCP7zmRINXFQZfF/wb1OSolRatuCLSWm8jCTks6CsvzNRVcngHuNoxHZ5iukkmqjDtU3UvISLDJx7t4S8utYvdypl/"
+    "ujdaxsKjT+jOlpN4s94G8y5s+kMN95ueD5pkLw98G1w1PPQY4hE9KNsSrcK5FLAw/z7y4Y6LCF6UMz39MV7dI8/gnU8h"
+    "XF1NR8oWVAbvCgVjpnzHPdw5aClHZFhpeF9i4G7aBhHsdoxshv8ygb4hjAt0i9WWF15EnkZUYmwepmq6jhxYK6lhaWlj"
+    "23joBAiFGmiEj0OQyvCMW5gm8jVryqhTsoOcgVvpgsrzNHMZjkZRbSqq97CZBVpVl+zeN/k2+AtIjA5xuErrwWjiMblm"
+    "nW5SRdoaBdP310qbrjBplIW6Fj0RpwrdxfZSUAy/P5dCELqtJcQYqm14qKqjDs3MZEEqNWPo6d4TZ8bDVyb9TehH7y5d"
+    "GSOsxZyzb840M3wmKlw5d42fVWzzs+6tUtiTkqfVRLxQvC/Bm1XMv7E7ob4LPRm0pe3fDi1VKbI+KShlcE1rA+9/O1mO"
+    "BXycPm/v8zyvBy3djL5fab2eJ+T/+L746xzFacEirZoWgd6jfjzFEP4A7AgdFbkvsnAOuV0inhJ8ymRyvF+fTl/4CpgK"
+    "FKAWSN1V8qX0MQ4NE3jv0hCY5En4SDxRKBElvHe/UIRe2Hv/nNvL7IfmpPPmse6o2I4KH/fXRzL84Ts0yCq3I2HTba6l"
+    "WHDp/iOvroFPwik1uDjwnqd1oUGKqHTbpzZ38YSgGy2dA4XprFT6diI3H7qd6n2dVtdgk655Y191FK+oL6ioJdNSkB5j"
+    "xLdri3W07nIGgvgyqGPyzRA0StA9rsCqwV2eOBIJHZnkItL78Nzg+u1BSghv+xEDM7sZT5lkxq0EfQxPjz6mIw/LRzcP"
+    "FBfENX9Kq/OJsNRgNWg6RDZK3Fhu6mJ/IJP86XDdVvwWT0eFM4XB49B4Of4LEnF9zyZhSw3CArMKvqYg6teW4H0fBzV/"
+    "xjCk1+BqkE/cu+VEp0mpXn5N8p+0q8vBCMaL8XgUI79/tOaxRZOAbbxc0O/tA5oo5K1cAT7/j6EjAxX4ISIYW4JCPq+R"
+    "9bZNZKdvKrez3mhBY5O4OE5QLaUOrH7R29n3ux8IGcRNlCs6RQ5Vymmqi33W6LUaW7aDRx8OaiVSW8d8NP7BXmJsQf6M"
+    "Rlvv/E5kEm3ik28wJntkTQTlKfs9tuxWbc0wV+qkz8fRv/lsh4/CNWk0UnmIS1aclaTqw2eJMp4lrZ9m0g/cf/LocwnG"
+    "L87e0nJRb59RhgBnY1WeGpB9QIiNaGRW/AYuClMHHmYSdLBmYkyhH8rLHUSMH5l+rVD8tHNt4rmBO2VWGrZZgLHVAzr3"
+    "fCwumQd+N/kdTnPDm++ZlcL7OPEKCmkEf0pyeQQxeNLx8s2rbTUGPqge0TVuL8eUazuku6PCWNMt9rR0u/Cm2wxEJJ6B"
+    "S5oDy50gHYvUjg4ZeTe6Qd8zgUq+mpvDwugVQo0xkhXRh9VYdedQXjt+dfhFkDGLpB5O7IzfpiWT72/dL2ss+vTdpJ/A"
+    "W4TGS4/8NVetxzzMLQ5wuClustBCyd7tDZNyh5SdnXWfDTVVEbc5iU+G838JzXj8HFZA2VljUR33eriO+bz8g93adVhR"
+    "5nF/S7bZd5JBBuyM/M9gg4t41Q29HVGemwStSUEizfRFD23dqT+9yQ2QZLnFaAOtVj83FCGKst806vFf9cD8XpiiIcFv"
+    "UK6+fsZJkNsltAD5umx988eP8Ws+ysp7C2KlS4/NCMgwSCez+dn8mSlrs1/Az36dDw9ygLo5kwxjf5llPJBWW1cW8sez"
+    "d38ha/FCjHrEjb0b1Exq/xlDheJdbSUFN03/z5Th83DuMROVphS9rcTmAHwkfFP81vva2+BtygPMcQbM4OK4h2wSizNn"
+    "Z7xbfI8L7qIm1sWxjDENeXKwdEMZpWttpjGckKJyjlQdp59/+4Tkxv6kEHp6S1Z9MICdPo4It/TE0nDQsLRRJbbV7TjK"
+    "jtvbQdAwjlTc7tiHyJQE5o+9zUvpUG/8NPhNvY8+cUoQmV8ZeUAHRfFYqjDp97cE7b8HVegTs+n8Dgexk9+4JqvIcfAz"
+    "l0oYQO6nVVaRvT5WYPnBkqUu0ScNeXeoRhzkWy2Rf461HeM207vSfjH8q2tX2vft9PwdnBpChXfqLw6eS72QSBwN1PSW"
+    "Uau2dV8ZwLBBNtU9zi9WPJrCx2d6ZvnTNiA/TYNz8advQa7fVtXO56FDJh38T8O20Ft9Oql6x/WSNLLeh1wphWJFK8Pl"
+    "yv1wqkZR8EN+9lySD4uFBAc7dVa1RPOpqo2aBOOU4CJtvYaZA23BMgHLDnesiFtYa+wjdnvr1ZzmajbZcHbO38IZ4JCi"
+    "kvE9Li+be4GfgikdB18PHtzrNib1/Rk+AofNOVyMxHtkhE48zYwPyb+5FDfn99lWNynvXr5O8/CRT8QQDldU+vffVPUc"
+    "CzxL5G0dm3c+sl0wUtT2Je7yxRZadLjOhYtJVavXUPupTH3OWp2fFuctERH5GpX67GVvVk5si1L+y5oPiu39MVplIpOW"
+    "vTx6xqbvCQOXLB7q+doqniRT6nRMKg0ohBv0tpEzcjd8ytROSlpJzZaxyjWIalxP0IQ+8MYt7W2OYbyeQY40ez6fcSS4"
+    "0fSQ3T+o2EOd4gwxJyU0uzFasScV/vuBzcWqfzDr/V7hTpfEnw9uD96/vV7c23H+A1zKUbCxSZ97DX8e1KvAJbrRLPd6"
+    "M1m5uZryRlK9xnUykhv3rJ+RM1Vri5DBnhwctMDGxYPGTjkD92r61fvHM0oKkxofOPbzuZHaqQcOBs3UBRDMqtG+4PlA"
+    "gtJnT1ifnxZG/LopivmWzlKyiE7Y5uvQHdmevSpJ5ArhpMuPLP/r12sqVQIFunAkmYiGbiw6hMvssx8KsSsinB5E4Zar"
+    "pKTlnzlGTThQUW7do3Qu3pUmcXw7Lf6WZsx1qiep6Wn8uujWoyVM00dDyl2mWImpkWNkW++gkczE+Iolf/f3v1NYn0Jc"
+    "lQPdmHRZX9+nV5AZcuqxz/WVzBr/ngZTvaCznSCEhHkPBpoUyAjerw/sbDu3WVQwBPdlPY1q0q/f+GXu2+VIel0gufOX"
+    "G4H/kiq3yW9xzrBwvT7VrbByzDyzsapdrW6GXxKTWaL4vb70mrRvpZyyvXaqpE0bhJ3P42wa0rOZ+NTdKJJ5RX6EQ58w"
+    "HMrtU3xLwVEXlBQjb2QvkFAB3+BxdJM9cZF8yhvjuEVc7O0TrFxGvY9Txlh15wemb29/fWpfuiE5fpCP/Qu3ULrY89W0"
+    "igfafqAgdsLaEzGISMLDRkSFd/W3bM1b/bnbDt7VTCr4h3rFDhQrw5rDqA/qlf5SkzRyUscs1gnxmdkdrkXqz4uvsZXl"
+    "8qz8esNidO8btVSfhwCbhYKUfowhDQLXfIUuXwmjOM3h0NF2rQ3+U4KNLFxForIiNIFc2rioyoP3uQxlSVzAs/gSk6oq"
+    "axX48ThNuvsPAZnJisefho5kLb+mNcPKDnrDbEqVXWVdq5Yw2er0fc49vEWmdiPz7x8NTTlTxCxq35rPfVmhF3VG797m"
+    "EPH+AbIy5M5+EDjB+k5QdbyEFsay9L5bAytUCMfXWwY0i5gIjlS7kab+7UbvTc5rGBrd07v7QZ2e8ueZBFUTUQWiekt7"
+    "hCVLhCfPUzm2J9b9n3iF4aMYyZXcoz0tgsZKTODO9GBSzHvhBkXyd1MgX5Qtnts7O1iNRl+Lfa3q5ejDy+iPrdwmnepJ"
+    "TBXCDzMXwMM+3cwLemxRR1mq+pCojH3W5sTvAK81lvYuScdW4LIFzRu1yc8S5jpB+yzUEmmzd5/h4CwMGi7Wx3r0MZaS"
+    "bWI9QSlCgj+W8FuDUPcEsDBNBhODqylyHbqm85xDXadFkUF3bBa/PsB6RKdhSWRuQ2zuM5Au8jiD6hOUU/VFn9W1upBy"
+    "JRJ3x5Ak9tGX03WUFR59YfNkGgkjIlRRNaepuzkUjO9DaHDxfr6FQiA0bpn1LDgTlsIB8rfr9D+Q/45rxjBOb4o4cqKB"
+    "kyZMvWYpuc41JPYwnTKNuqC/1sLf29EOt1agv0mKgWXIm6y77qPFfSLCO2/CKoz6RgY09G8rfL1u5aWaKSwpctfdHtHQ"
+    "T2cW/4SZIrY0YlVzw7qRilhhSBUsEhCk0txT1PW5VrWEu4F2XVZh3XXwTbLk7YifAj9NoToRBs6g18cPtFkSlVN6Xn7S"
+    "F+t5V8ZBGTYRq0vGdIuLDSd4Wch96WPDRy7mUdMtimpmH78cPGVwV/dGXZcdL/91b0xPZv7FfMMAP3EcnxCmJ6tI1XaR"
+    "2l6wiEE90WMYNITt8WyA0zPbWwF3s5OZgkTXv6Xab53wFysReZ1cF64OWDdrTZ+59nuGAJYjkNrMcl2zIV8R2qFWNMX0"
+    "gwdr3+uVfshXdancey/nTF4z8O4JoF71rG0a3Dhu71zKHCriLNk82tIFvxH0evo1k7RkasDznC2DWHCmQHh/ped6KN3c"
+    "qlGpmCEHUQp7nfb3OGsyjt+/aHBNjkvImoxJiDw301JFmrhTzXT0ZhMFHPX8bu2+oBNlvrdkpPLRRhrZePicafh5IIWI"
+    "ZLGijMeaqXIblQffi0pURQtqlYxowvXbc7aKvXrjZ7P3i23DuOwwULyzAVP2+U4yKsVjVgqtGmFbPI4fnscjh6K6U0c9"
+    "KRsyxGof0k1v7GDmK2Kujw8k97i8Z2JZx3MSGVaJ4pnurHEbotsQnikOb3LJjV7zbSZ6fJ3vrakvvw+EiFyJPjOhqUwd"
+    "s8rAUkDvKcEzEQTi7p6nxr3c3/rUPpXEMgqv7NSbH27xs1dTFpLNifKyquBXfvkydsE09eU5m7ADUyBegPaZGc+3YSI/"
+    "qZtZPz3nN6iPMT2Uj93xqjtjK4Sb+RDtowa+1/jvKCcpj5lVjo4dh+v9bCaXbMYk13rujy3LGyP1XIXq0KTMNAFHOiZs"
+    "dJq4LFh1oZRcUWnKZIa3LXXYqVXl+hEbkvc4Q278Lmbb7f4zXStJccIP5vHXfhblSJXpHjXWKzDaj5FefFPXmnMrKx9J"
+    "JE/xJ/kR+iGus/VbyLh/qVdr7UyMbaMNmIX1Nh8JxhOIFaWcfCORp5OkWAXNKbU8h5LjVqG4M4Q3jiU4Tw9OYKJI2N6k"
+    "rcoyRz8B1vTzc57/1vJ1n+L1HGfzR1p4Um7Zqd+gacZz0G0Gahn1Q1tmvID6dbu2pe7wuqJimQnE1jPnPSkN7R+s8qQh"
+    "r1pn75ejym5SO5nfW0XVpSpfuJhRPsnXa8mWTrhvHEdmwVEf0LyzW8ifYXFalTfCOTH0+3eTAs9yqy/U+850CeLZ5H16"
+    "L2iYd8lHscXO3HUQt1Oa1ed5WQoNpYRBdoGKOuxrwsXM/X7lAq/54tsCN9U8v2LeM8iU+MUZAQkjGNONiTnZtP31/LMU"
+    "RHbQfAkjJXsnPCaFNaZEsY4zaudnaVfxg5DAl98cmrzLLNvYcykFp++szzOsDMf7yrWttKck8bV4BN0r6tsRDLvF0tGK"
+    "VewM++IXTr5XTO63KUAwb5b53i5lzu2UNv+WU45rGtGHi3uzSg5s2gy6SzEYOrjvRlvUC96JMm4NF550UNSp8Q1sGlrt"
+    "pcqkCXk38IHGVB5+v/j+a4ur/WODygvDULzvhvaeJMcFRV6pDChZNtnWoZl5bp1nSeIcphbaGmIfBOl+IxqbxWVuz/WG"
+    "tCfpNbSQYa4LjYYIvhTm0fwqb95WbkbBs1h0RujsYDQ0RyhXFhHFS9f3Zey9vE047TSDAsY9PTU6kskk10fr9tJWrVRM"
+    "ruXpJDRP/ep4tJ9ZijE4+vdHJjkMCAbm5v8s4htYruKgzB6jFGujSy7bdexjez3VvmYqVRWwUxFYPuL3xLzymPVM4niA"
+    "id19RFdzj6SF6dxn8mRUy/ZXgMar00jMOmu2k7GaJ7ehT3spoQ2bWcggzxuirre/iou9IdKmdVZR6YBJRa2bQ++Pkuuo"
+    "iTEZQZ5m3k9pDcKOZVtWg66ISffncnqFyhcEf3W7X2mqpOR0m70nQ7OOKPjcCkft4aRpvOFHYmRSuXeaMIMxpv85yzwn"
+    "h0BHgEPbB7cOeN8hJOoijqmucHsEnzDYZsW/nWhD48bLFagnO+jn44runt4x1+vUXQSKsaTw295f6sjTXm94ynC0hcvn"
+    "FTSSFgjH62y4KnUPO/nDdkBb8mDKl9FWeKdhQYVxa2GCurCumbS0Gyhjsoc5etXsXkwC7stagb/E72a8lC4KszoPH0C9"
+    "g7UrMlbFtnaWxz5uMJFyGX5vEcz4g+fVzOGF3EQ0YQqBTjXIxRDZzC5zh8DxjMxAY4+w3I8Hh9nna47MBFME3IQ30gKc"
+    "Zk3SYIDwSD+gVSP/6hoW6P5OkVGfXcW4+fjZz6zMuClin0Nbq2K1zRWZXs5kdWKDVgsbV3Ul6bxgPUPPKgSBxM3xd5o9"
+    "KQybhGUGyUYIL6MVE7mNG/z6bdeJvunc3LnnbNHVKEMhf+LKhrQNX9vWvL2jMEMRiUkk7PnJJY5FM+DGxzDOzAsdI9P8"
+    "PcK3OC1So8eSw4+LijruxWDmJfkGKUzcKBMS2X65QXCYtf3eV2ZI7eLT7WsHtVmfTN5M7j0zWHicS9OXb6YQR3LH8KJ4"
+    "qE/Apak9TtVN3Te7WcZ+1mK6yOx2Uar2z6Wh+V2Vl5PcAlZ1xSB2qLBAg7XuigRuX1SLfGfttn5ETRhvayofQYSflxEe"
+    "Sw+++p5ewdTji5rKONJ0Lr3GumehQze2ztN3neNt3jHddrGHyGoxsy4kygoWFH1JLB3xrm4ZwqpjFFSRpv1iXkgALmN8"
+    "HKviXSPxcLYwVt3tVqB5cXBIuRfkI/IhMgKFu7tZxEO8paYbSr8amkmwZy/y0imO8iecrOk6ng3VvrRyWPcKBJHtgPfN"
+    "+8Fn9gY88AK0LGaFafpTmWXMWM91h5DbedpECddP1osfTrZKU2bKI1Lju6VbJIeiSClCa/BPdIliCnw4xdwOZGgUUFji"
+    "XD6UykhLHCr2yHilhOX8JRJWj18Zn/Q4pSUtoz/+bgw5V1725GlmEB+cE3oYp0Oh9/Kb1sw5YsWwk8En+CAH3DpuWbXR"
+    "vPPhaVPerp2Syin+iL/t3Sf8twN4SYKCnEvakSqG+jNam8G6b5i2RW4SSdR+Vs6M0ZuhEXfHcu8JZKsIwo0ioDelrGsO"
+    "ez4A8ns/Nz2qoc6S69rxqknOfe237xOtISPpn47q3yEf6LgIlgpM2VXPe1aJOJ9m5pFRyA29/kHj56ifJx0+UU8uPi4R"
+    "QECCRxeS2yI8VChQ3G8vnFD7OZL0A96Q47UVkdOdw64vX5BEEEKyg4fhtmdz9V1GXPvrafdeV1ck2NpyDb51Mhn40eUt"
+    "5xL12TL9ke6Ezz50TgtSLin5Pvc5she1PXuKffMuozJuv+YDzCISTp3NNwv2pD8GKBdHWshyonnNA5tXMEZmIXGBhbfY"
+    "RuN1P9vf7hJNh7+xfY3Ariu9d/rttcy7I/kfBwE2EaQjpb6TRvlEiYmbH1sxBqW8u5ro09/O2CN1pDQ1N18Nqye2/aSb"
+    "C73nHnvE+IDXZS2ncjmdyHKMWVvYX5JdYovQ4MvLDL0zEy28CBALPcOZtWbSNyal34LnDGHBTPHR9nmOmWqzynpsq95K"
+    "jM8MitvHcGeoc3+usfhVYFjIY6fYZK140Jh1fmh1OM48VG+bxXloQvzOyc3Kutpcw3i242ae/ZOXAxQz9Tt+QU9YGQ/X"
+    "zURw05/uej4Wm9d5ef6wkEL3gy2rOnGXjtUPpjiqRo/DgSTTZLKZqrVSSh1z7JK3vyy3xF7j9pvqKxY9mqlu7ZFWiefi"
+    "6PLcSbCTJnBjCdBu7fphz7INO1Gcrq13FcovIRjQwB2wCOoQcs3wEqXSwXDaH16tHKjmnFdVXPCe4bsJBPM554tXpKsq"
+    "WFBY88enadDU35zSHDiERJ2V1xaTA9M+zpKEQDyP9lkf6XPVL28Rs4xZmaKif1FJYY3CRgiJsB2zn805Eu9bPH022r8/"
+    "F/pGWMDHRLWmxdGClVL6cIXj737/Ff+vfv9t/V/7/vvv/v7/797/8L/f/yHy/3v/R82/3//xt+1/+Xi1/+X/vP/H8L91"
+    "/4/g37z/6e/e//X/vv9t6//L/rf/qf1/Iv/Y//fpX/f//d37Hy/3f0b9F/d/uv2/7//8v9n/+vK/Yf/r//j+X5J/3f/7"
+    "P77/+dq/7n/+79v/nfaf2v/9P7f//cV/uP/9797//3eff/i7z3/8186/5P2Xz7/83ed//u7zT//b818D//3nv/5T59+Y"
+    "/wvn35L/9+ff/u7zf//x+UeR/7Hzj/+H85+B/93nP/8z51/B/4fzr7H/hfOvf/f7L/IrbmdZj+Dz1m7B7NgR18fsx4OZ"
+    "/SKIa91+XcyEX2ndXm9pxydg5A++jXCjtDXTmD+MDab3wE9NwW6qqCgo9H4PS/Vi2ErDiRD31Ip+zjBj52vG1azxjN26"
+    "9KIr7H3a5xP3oBOvQEzag5+ib2bIFgmOZzZfHYmtu+Vh2m8b7VafJlIz+opzxOKQrheNMrOpqNC0HXUQriv3D6zi1iPk"
+    "PD2caXZf4atYSd3JjX0wyiM7Ne9loK46s8sHHQv9EKXeXVH3ZHvWNvw8eJh/NUVNpcDr+e3kdpEkZegjiudQKO4gibnK"
+    "id0tBZqykp4O36ynoyJJ6S8KPHB6M6JO97p/bB1hNQvfy5ImJ1x+EVKoEnqXxzSNt8TfwejwettXxOrr6OUv18zk2+aL"
+    "/GTTHrC0yhJwjtpsVNp6fTS0eRaImnpdssAyFnzv58lT+5QTEh8c6We95v148dblLuFL1JzlE+OyjVWP98wmMW2j393C",
+    "Z32NEVJt4o2TSL/PT2rEWmlkSZXyA1Guu+QkGL7bEZz7kYJrZJ5+eTLGUMKlxniWARz+FmsxnpDBgrfWM1bw8d5zLpp1"
+    "i+C0FRZLrInQIHKGqSMkXKJa/FU5O6RIJP6z2hf2kV3cz2snpdkFTQyP9HjbU9QgFt/HuplqjUNsuqII/eY/MTPWFusE"
+    "/Frbx+wUdT58xJuvjM9wB4MoUOvkut7QhIEA/3r+um12BYdTtn6VYASXsN31u7Ve2U+Hxs8yQkj6s7EFoM8t+3IXK2oY"
+    "g/trxtgYnpPkoNwsVty63vT0Fd6rFMYJ/ND7ShKqzKZ9CJEkzGflXtdZkXVf4Equ0GqJaqGwtuolvpscmfh13zeYvpzd"
+    "ch27ZAqZwMJasjpUfBd398i972DNdTYDXmB3NgKzN7FF7FZsT1M77U3DlfrH8SINIem5+u+OECNPzlzbIkvAZELx8M4O"
+    "iQ4OZxqqUXkr75/qUDKRaitJldO6nNaCx7qPuc1pDUwbGR/u7SrsOLGVKz6a/7LPWslIgrVWFJHYF3RSwndQaVDHf6tf"
+    "ybAoxjZI/ISr2M7Om/HIS9ttI8PDHn86ZEKj+p7Up8RqUnuV9pmHn30/jGOfyzhF5zY+j2C0nLBWumG98nhSpRCxxUHc"
+    "6772/MFTogm4HYyJZ3Ul6712TFMAfIjheWtutuj+b22VL437bZyvTicYwTPNao4fQY4e+4YXk3yLQ9ULVnvVngyobHzP"
+    "lmtTJFjNq6N4YlgyBrV591a5zlBOr7qaddiIQ3zM+JYCxw9FdzatWZxyvTrKjTmR+E0CRreM530KTpKvfUOoXGjd7/e4"
+    "pxuDDTaR/1mm8TCy552FUxF5kTj5R/IXrKfkdzR4eBhsC06pN1/Rvty2Zjt6kGOFvXiwlj3UeXeFRJ9w0MG75yGiVJUi"
+    "RCty3eWhiPwTOHaLoXe7mu3reKnAmXySz8yU3b695N0+k3LfB/PuHJVybTLGt4o9rZCbyiU0HvTZ1hb5Ve2odqvb1DaT"
+    "z2sducptIa4MXRZLxHa49hh3+CvGBA3FzpQvrdDdZ0ObhlFLS/r2Ehv7CwEHwZbXy2y+m0ETbXLY2N7TPjLM/h2XbiZN"
+    "rCnG5maUi3uimSxVF19wuKmKD32nrvHszovX147OqkQFNL4Ko1JueOEhwYFLJwF4/ghQCa2+5GldyJBHHZXB632smhcE"
+    "HoaVUPwOZa82A8z99IcHoiETY6421Oa/15eeOoZT229Sj7jWM8i+cnd92dX7W7nymwong/QvhtpXSPZeDxxMcuq1MhfK"
+    "5Kg5H/07ePJv6aT1aWpulxc8X5uj1uPmc2gzZZat8PjJXUVBYiEFeXEi1YpyZHirZkIgmffhkE01j/O9dfHetcS7inky"
+    "U8i2QJUHWfhEikNmIy1YiaFijsqZBkmr8i03ebj7agWGmsj0DFK8iEk4rd4cFDAotOXdxRUXEn3t3sCnVN3CvwBdSdfb"
+    "fIIt89ENZETe3qm6543dxZVjcnsCH8+j6NY5w5Al1PK8//RdwJcoo8MIeXcUfY6Ah4ZAVySHhO6Gu82HgXoTJ8mTBJEP"
+    "hEqzoL4shfWtr6Whz+rHrRLkFXAm8Vxe1ZmTdTLe+NFZK/x+weY9blMqcsCB1M1AvkaqNZwsV+b4l5RFSTTmutNc+5Ox"
+    "shle/5Kk5NKMQhrmBzpWJ4ofi4n6tp41Lsvwc0+diI1z9bGYGwxmWkJ07tvRd+RSpn56H/6UkhT83rLJOkD8AYlhVqJt"
+    "C31oUf5UvZ87R/NaZqbNQuGvZ8wGh4VlRjSCt31sfi6OJzy7RWXQb+rOwtZjAqN7SqFQ+i3KjFXdyAJj4nEWbPJFtGwK"
+    "4lFsI74Ptxjr1E4kqcy7JAOmKau5sPsQQy/lqWIhxdLBoPWmX/3zuSzn/P76+SHVEUs0Uxpeg30yPKdSBs49BNe2E6PU"
+    "8Obfux+qtDdO1s1WhKUN7xrczk3okqnxM4bZZzWa+tcEM8rOxzLWFqX3dWK4nwvx3Tw3u81BTmEciGXFCS4mvQHbDm82"
+    "VRqj2d6n6j/knwoVbU2dSHWP9ybc7uGUY0knUBHpzcicvIv0jkoaD2885a2UvfuhqnDJYZlHne7YOpYCahZ3vVLSKFK+"
+    "b0x0agdHcqu9UjjU+X2ej0MfrNpYPd/nZkY5seo4FCQ5N+v+rSrm2jErLyvRWQmFh2fYqCCvvL2vOtE0keaLIf5Fglzn"
+    "ds2z6uKVKmMiIaWQGLL3cVusv0MCXn0h9nbJ3DD/ZR44NoC55IF9C8bkcRalr3DMGzFHNBvADr0w1SWqWIDUvnlT4thF"
+    "OqdTP7l3dH7InHM9UVf8o1lF3f6GzFRvgUlUtjBxhuphZAVOej8iWXgGt82JlESZhJLdkvTtk2JU6eT+KxtTwWdiAaBn"
+    "Co80gkv4nnF+xuOubf7Ayk8w/oFjTY3vjdT1lVwUee9LaW2ahxM7KM+XTMbBYGRFl+gqxzBG7nWME+5vvdQrnwlS79Hm"
+    "Di6XfuduIJLHnZ6V+GYiYXR/US9Xk2gNQ+qmp3hvXNFgmVcOfWEpidezzIgVoxRlvijxvQePpl2yOpOrCxmjQM4ZX4zG"
+    "uAhjzw/My1odlqezyfycl4iF5NLNFx+8tsrzJtb5JKt/h6sthaFKa8BO6bujd5WpPuEOw9q+4o8y/LW+90/scnfFlHEN"
+    "KeFZnfG/DAW1b7W98uJWirDRdjZXbYzmv2H/ycZ1hamZM5w1SCBD1rmY/fbjqrajcxmSb1FlZij5IK6P0s5U/qNc9Dc+"
+    "ni/V9M02DHa8bOHFgNoxOb5BGQiLVbtzkgiB86SiiRzJJwewjG35a0osCiMS8PITv1WGP2CNkPp6o3+UP3J5sFnCtH4i"
+    "iFe2iKCfMexzUAqv/UbAlq7Spxs3NVspjqYTTosfRGDdM+S6t20WUS2kS9BcQ0bwuxsTjBR8pc+vKGQyN5sb9F7KiIvc"
+    "/mNwYBUxwj4EBFnUisk60pbmHtV2x2Qq0NN8ov/oleUCju1oJ5xX59u1lmQSyo/h9yu+6TQdKRNK1GA9Icw3k90TF5d6"
+    "mjYjOVeFHRZCTP4o46x6SoEyJO6Qn8H8zjfUEjW/PnhXC8VpPhprvwKhJZU7YwxC+Rbo1SAVyUPZ1jUzDN9t4LwlYsqi"
+    "XsiGmLR01sjPjul3sC9tsLt4FzQZVe1ZuTD34LgPfThBPtNuP2Y66f4cKmLdoMD+cjqCbWjEUBTEHrqKYt9Y0Cz/pncD"
+    "S2vF9mb2wxdn3NlEoGMpiW8jQw21fRevnqkQ9VMs6mLsvzf9olGcUkJEQrKtvvs4ySvkWTTfuaxeT6GUeAMVjHnqyb7S"
+    "7QGtMxfdPN1GA3JHvtF3O5MTzyfSYuly4ug7cYd/3cN0iTQ65HI4UHP/8ua7NQGj4sgbrXB9xYckbdZhx3h4Mt+5sARX"
+    "F+fOK1P43jsgsJN9oZrbgfm83sLvpzxpp3P3tjzhdow/Fq6dflX/8LCCxm5N2FlYovNdAuLWgxChb3r8mia1FhwdXjiE"
+    "1pUh8hLEAzLtsQ9vik+MuRV39t2Qd39H8J5ktDwk2vdFWY78ktqTljePlPgSlfImWviOPj7rjPpi8EX7izRf7y/mxgy/"
+    "W6aMatf2qstulL52vsUgPWkmeHEPRTQt+qkniZACU+yl3dN+eqEYJq+19yyGFoOhIXe+0hVrajDa0NWIKWkaC5moicXK"
+    "L3G5iqhEs5JmyVTyrlkZJnssWFpJFj8n/3zXt5CS4yfrorPygvWp3pqZu27EybNs2h3rX+mUddrvcXVqT3eVQ84UbmBZ"
+    "iH/adXkCeSqQ5u5xbXP80B8pI/iS1vijeNL61wdgO8knz0jfURAq5TGHrJI2pErwSx682rbMKzXC/mwVw9pHvJfa/Go9"
+    "BONBneWKU0DOPL3bE21rHNZHMAbcZkPDWWWdIBkMoeUSW25tSL3LfRom7z6zmeFFksmoLINPknK4L1WqBm7qq4fX7Vp1"
+    "D/l2JHxiqgJhGqvFmvN+w47IzPzqQhMr5bxrPasSsss59lH+6DrrMv8L6P51t+jF6984yat72Dp6biZmrNydCE99/7Re"
+    "M2+evjuIwMsv8FOK0cJ10w0ZHQs41ozHS4qYSm1uTJIv4yU4aiam20/CzVWO70+f4vETU0Zw3ll/7ODx8NDkAZ5ak7Nu"
+    "Aw3dbfdIArJiBzWenJdcBCRf8QY/OOGT5fN2u65aEigpcQWzkxDzL1xPi5ForwryNMjK6BgjmIxdyHrUrx56gvS5FmhY"
+    "06uVI4BcwCn86v6gVOZOSvWB4vrw8Ci22CHOsoLweglpU+LHPgJh9aA6DlWC7LF8MbGmFiesM1wXc/PpcnXtIFnngAnH"
+    "Z32qtOtPqBZ+XIMTw0GWFjjd/oOuoCafAo3nNQNlOfYW3zltq0cUSw7mVsM4Cu05ZhigLfgEEt9A3223HfgHfZ5/oerh"
+    "84326KdWj5WV+aC+1D8fLoL10JQot5NmlzNFRtW83P0ih5NjrxDLrmbNPYlFHbc99nvkOrSNl6vU2oMnu+FMmpMtBlwP"
+    "3V8b806MG+PI5gjhuMvhwG7ObsCmzarJqs6iwCzFJMYozCDIwE/PR8dHy0vDTc1OxULJRMlAQUdOQ05NRkVGSUZJSkFK"
+    "TkpOQgZcpMCF/iH+cxGhL2L0RfivF9G/v0A3QTAQAwQOwoHCwUgwGISCQiAYEBAYAfyOAIFBUOAlGQoCA3dAwB2gvfoB"
+    "/6ffsK96QtCDXLaQy3vgf3yGA8IAYQP3iCBgMC6AAIGCIXAADQZ8BgM6QC4fusRHPwD+v/3/vYBBQJdTgP3Bh6KH+9MC"
+    "g+MCv+ACLRTAh17iA2Dgfzx8Oek/U/9jMfg/jfwPXNBfuFct9A/+pUegYDiADcwVmDh6zlDIPzFgVyOA/gX53+HD//GH"
+    "jH+B/eM40CXKv+LDQNDL2cCuPAKHIEEALhiOvoDPIZB/YiD/LT7kP/YA6t+1iH/tDb0K3qWvAdei8SGAq69adB8kBAME"
+    "B2gGB3oB+H/5/i/6QP7EHAz+Fwug/2xBf7Wwy/lfxRf8F9NgMPRMwRAAGG0PFHzVwsBog1DAhBFAX/gl3wCUv+YHvpwT"
+    "gA/9j/Ah/2yBQeBXJsARV1ZcMhgEQ6BnCgbDoACnL4kNvsQFAS0AfokPRt9E40P+OeZfcUYDAx/AwP8B/mWLcYULRl3h"
+    "gmHoFYvGhUMv8eFw9LyhECj0L3wwugXmj2Ybmmt/HP5vx4ZA/xDrH/iQP4wC/9Xnj4swLhmKBMNhaNthCAgMClgCw4bB"
+    "0HgAPtqjV/hor1+1kCsT0C0w4l/4fwZGL0H0qAhgarBLfNA/8f9SlMsAA8RB0wqKRD8EOB+OCzwCB8FhQEzRcQYsQM8S"
+    "QIHCIDBA0CBwOPJyTjAEAnLV/lt8dKDR/wTMA6YPu1pbgNehkH+dNfIygCA4EoyBdhcCjgFCcxcOw0SbDMSeAIJ+Cggb"
+    "EH8MtLeBERFIwAEwOCaaomAogvCPHZDLwF9F9Gq+wFMIdFBhIATiChcKBf9ZWlctCgw4BzACBiFC+x0KwQEGRAEtDQQQ"
+    "ciTa0wAUFE0+KASFZj0IikJiQdE+AYy+tIfmcuaEsH+s90t8wOWABoIgmOBLvyP+sZYhV59j/mE8AgxHyxoUhgtYiwFg"
+    "EF+mCyiYCAKEDgUBlAQKwYZeOgGJxEavKCgCig30AQaFA5AgPAia/RDAuMvp/1mtwBoEo0eHIMGXCxHxxzLcP/jIS4qj"
+    "HYueAgiGhYUPRmKDoFh4ECB1Ae7GB+NcqhoGBBcbhYHWMgSSAAtIK4D/gZskaAqSQSEEwDCkgI0oNEv+wodfKgIYhvyH"
+    "4oDhf3QUC3KliITopY0CgcnRSxG4CIiwAW8DFmPAAKuh6MWFSwZQEoSHhY2LjQskNig+As4IBvrAkCAcMDmAi8ELA6MF"
+    "F0WEg4d3tQT+JDgYmnsQMC5aHsCXAYBd5UsI7j9WPHp1IIFuWEAAATvABPBLucLDBOFioMUKjAOiA34Dk+BhQNFkhmJA"
+    "kXA6IFpgIuAhMB4UoA4dFj4ccAcKik0AQysK+AofBL/Ke2AkGh09KgxCeJU3IDh/uI+H7g5wBAcLcBM+CEQBoACRB2ED"
+    "ZsCA6OJDcDCoSDEBhwAeQGGhOYwBxiFE6yE2CgsAh4Fw4QDzLsWJEMmIhwUHwFD/xP8Hzy+lDgEhusqfl/GAXBUfaO+C"
+    "sagBbqBtxUKzFwUmBrwCpFF0XFAIFAqMCywPTBAW4HMkDIJCAXQGYwG0BBwFQkAJcAE4LAI4CBcHggXBuGIZGh9yuf4B"
+    "O8BYaHwgMeFe5csr/KtuUCxMwAB8tHSiTUT8ySRA5PHIIOwQJJKEAgnCB2EgQbjkwEdgKBZgNRKdHXEwEQgsIHqEhAAi"
+    "CgNCiAAiiU0Ivlr06PwP8B8YG4X8k0JhYJo/eRugKggtNegUBvgdWBAogBVoV0ABlYCjBQEDAxetv0CYocRAFgAYSw0D"
+    "6AGUN2A0GEB0HFwUMT56fviAskEveQtA0aB5Ar+sO4COADAw0j9Kij+RAV+WJoDIX+rCpaagZQ9y2QsGAWMD2oaJjSQh"
+    "B13Wj2jewgDq08AuxRCDHAQnQIFgmPgQJA2wtACyALkehA3EmAgTE8QOzATQGQADD3ypN2juEV1lcjDmX/iXIgXkFfSs"
+    "wVAoJjpq6GDBkAgwAeAcIMYUcPBl/QC+XBMQEP5VSsKD4OJAMSBwYIngkwI3UHjAPQxAUpAoIkBn8dGaCkfjY6MlH3pZ"
+    "YdJe4V7pz2VChIDQVAdhQi5TNvQy3UAvdRyMIAaWPhYEH4FxKaHYgKoAfMBBgS/Ji0tMRghMDKAJAhOFrkIwAclAXBZe"
+    "WMCKhKBdBIIBZQOU+R+1GhhE/m/y8WWyA7IY2ucA7mUKvZICgIFA3YzAw4TCUOjFg3lZr2DhAVbDEXACIK4QJFAJIAGt"
+    "AQbAQoGusgshlAgoSMAQfCLAJyBgxgA2DEgeLCC0Xl0iY4H+qkMuiyh0ZQpFxx4LCC306h0AnVOhwDrDJsAAI7CuegFD"
+    "QXDw0Q5CgC71GIbmKTYUSQKDYqF5g54AILNgJBxMhgfYdhlygI2EwIPA/HD/VGz4oD/l3WUELwsfCAp9A/NyKV4qFhiC"
+    "AUVnOxosLNBl2fpHypEotIxhARwCnsVCXtVdaKOhaOqDsXDQGQcPnb4gl+qHh6YKHVqhICDiPxUyBPRHFtEug13VP5fa"
+    "g3VlHxzNCAgKEAZKEAX0sq6GYkKuSmw0aSBQAvDVawMwLvAyhQ+keRAGAowHuOryPQQwFgMND8G51FYMMkBUgRCi/s0b"
+    "0lXqQYcMMB8bLUKgq8INUEd0ngTYCRgCpAu0XF8WdSB0IQRDZ2IQ4n+x92ZNkmXJedjZ97uvcSMil8qsvaqruruquzmD"
+    "wRAwmAnDwUKDIAiiIAkEODNYhgRIiaKJpgUbjTKZZMYHCiRBAKYHvUrv+gN60o+Su597IyOrqofTJIh5IKKrqjMjI+/Z"
+    "/Pj6ubsnHQ7WHPHBcONGVoMWMSKJo/RMQJIwBc/lx/Cppi9J+QibhbSqA6iDAIvBfZfrFUQBAROGKbiSKT+Siq+AYZaG"
+    "WCXSnkTNCI9aOrzRRyBZeeAGSJjmSqfEowIpZrX8Ucd/r9nlcRwOw+idmgQvAuyl9Vy3cEu0g1cTYrtTQdkiNUYVOs0V"
+    "iJR9UzrpwqW+nnhI01K2JZsqGVPfl+UAekBR76q+Z321XFir6uvCN93lNz3cSNctu4e+VLYxV6MZWGObEp7chmCETDXu"
+    "W5DSgWTyMtZVK0LRSri+dV2WoFKzNoULbm2AWXDXFx+jSh+KEvQgpWrrnPKhaYJVyqXaFUFpX7S8ijFq65u+6+De8KYu"
+    "xzKFqm5BfgRbKxi7LBKYDaCmaQ+0neCOeFBGQGGW3hYgvYQpGl8W3MY0iFiAiPcRGE1RORDqRrYxwNFr65SzoHeAGAau"
+    "B99EuKSuAA4HH7LwCVBBwSoBola6UMQpovbG+9nJoJxSlQJSShYeJBzXWiYDVF5IYPzwqrwG3s9VB/wVtDVQs4ILsDRg"
+    "NLwqmtqYIGNhgjV1DDZymEVtfQF2imp8CFzDIFYH4+AjynEHmwhM3RcexEGplQbFWgvfoqSTWjUCBLwNXgMpCIvGhJQm"
+    "oqMATGXQPeAmGlLgY3AdsoxYFh5EgiwcKF4x+uRsIZMLLZwEPqgqonPRengbdNcEhwN3HvYXt6pU3loQybho1HZAc5E8"
+    "AZNRDs9QBGPJvDJoZsAcLCpXsI8SpSPyKLyoJBXgHWnJwAL7QpOuDIoRmttw3YKCn4HCCouB1biKFD2BTEK6CIeCOgqs"
+    "ANiU8ipJ4Nvwuw7mYZwPWhtjHWgXcJyoWml4lsSXRmmgUa+E7+HZcDZSrQYfviTxKHrx9V++fgFaD3zIwwQESip4N4BE"
+    "AxMD9jhkc5GDfl3gg4OHfbAGjrtAg8c7HQ0QOszaKKvR7NUwujBKwe5oHFzhbDRuCbyvaGvwD0gEofPkUErCsTr4FYGa"
+    "IkwW6DSA5UDEgLu7TpVsF5iOAR1NFkDbyhlZAJkBQQO9Rtwa44GYNVASnJaHaUmgeJiaga9A7QVShkdaBb8AY8LcDGw0"
+    "7J4Cm0A7RYOhryBZgzYWbLZ0SiPZgREnsmGAfzUpyGBYga6NbMrDH6BUuEXWWetC8KAGi2ht9C4aeDI8HX8CDzQOvoVr"
+    "C9OEuwKzg4OxaIaCJoPXX+LXKCHg2LkHvQqnjlOlQ8b50YYQf6dZkAmRp4WuDp5lk0B7APmBAoksPRCOVTADBzQObAJm"
+    "G+AKGmBiaKDjcUkrPJ6h1mSw4uNQ6gGJWgvbK2DDDBIaHRr94SdaymZU/n+eyfZi2x+Zv6GfogQmgkSpKvNKFG6uxpMi"
+    "imYiL45+D8QY7KDCk5QGNSCxEjaZsDB//JP9Geu2cHGaiuD51GijxL1p0Rci+x9ofLhUQCEClfrtihjyX8FVUGAugJ5u"
+    "gXjxYkm07nFYhbxAoouDdiF7VdZff2cO60ucz2Bz50rFNtUK3SaMzgDPc3V6kNan6expdnhs6D4SNFXUGPCb06D5eq97"
+    "QX4bmkP+c778zduGFs6q8MpsCotVBznzNiqZR2J527YnrlZs9hlkR2P+Rb6+sT2Gb3rN6blZj1+VzW387If7gLOVZzt4"
+    "cxVl13BeG88K4+rKOXOhZk3yntf83jMV6sny/D15muE7H0Un4urZzG47uenC7zjG+Z2X7N/osqbxBTvzusr3fPcnBzBo"
+    "+OhZ2nziIrvoOd+shbN1821K2wzFuxNb/cPkcNqOexufn41/NodM6TpbYXy1gvIlPT2U85Ojjt+f0npg984TXVTo6Tkb"
+    "X3woupF1e+JLaBHQ1c8zon8yLzpb7clfKN4lYn7PlUj+HYkW7tks7+jlbnxFDk2+kiDSQnainlxD2VMuVkI8WyQ/0el7"
+    "q4LPgv1hMABxNr7g748Pn1DkUsQPro/KDO3sjW3ya5iIvxsF4neextP7nqHzWPL748t3liFJtKyM/3wOd8PxD6zuS8JU"
+    "528m5lQ+2vMjkqtv+pwmFbH3kxKT3dF307g32r0LfP5Dfn/3uWqYJXEn7v0IB5dZtmX/3HpDJF83YJsef39l/N0tuBv7"
+    "TDBuCwPrWQj27qNINKwvmqZyjnz3dGMdKMboVBJZeG3XnKaYtc13rtwHTwHPTYp6jUa9F/dZ57DKNHiF4EBtpRgSr5u2"
+    "q+po+dltP7tb70gg/t6NBpVRWwtaktXMruOfghBi84re2wawW7wvy1Q4W471CAr88ev9xdShF1msnyeVG8Q3qjEGlT74"
+    "q1HZgxeqyXzdGs1tSKGs67r5Udu/yNJpd9RdEEbcCbt7G+l8kVJhbbPrlyrK8evzbuqUyzr+GqABbV6AsgTqCiibpHDC"
+    "CxXevP58yqAcgjVWwqsJ5OTgH7ifq8DedF5ufUB7M8jWgAyY4AwSBtho6HzKq+KzaqlSbhN/nw2gUQAKMJiqJntK3rk8"
+    "PF85uf7F0HQJ5KJRM+R+mNvBGJc3ZeP/Iv9C9kK9L40/QP0Ul5R349+TnlmLyyuAeQYw+3RW1NDxRRM75/zr3ztV54cK"
+    "0aPxh1rEmRqxsXZg9zwfGNp/huKZpJtKdFSfBcTEGWvj5+FLfpI9PyBALgw9jMt7a5cU86Lbb5iiI0KVFGXQvePiJ0F/"
+    "Pi4/03jeYWvvhpaZcHkxd0F2cntxcpES6UmLujms2uCGrLsk2F0wkt/j7nff/nA4gRyEXkEC6+/h2BQ9Y6QZUGwF1W62"
+    "MSpxAlXcqZ331D3+jjT48rmgfbOOvz0F1y7J/mGeQokYVmaZ958U81XynsiAv6sFsB8OKLKOL8+UdPRoyDu2bVfNV65G"
+    "CVvj5OxMp+fvS0D+wx0B3xAu26d1JnvGYVyMcUiZLVyy1M/Vy0355u8YC5y9t/0/YDMoknlmMViCR+DO6hzxRAMFTW+9"
+    "4hD4OfXz98T9h4nvXUpYARl0pemX6k0cmOyl39RQTdwFNDSVpfBpmPuCnb+77ve+3QbNayY1WrFs6OJzPH1eoaMN9zsS"
+    "/kCQeaIJRyHPov+Z2d+/2PwdeNC7q6XfQsMfPQ2wICRpy9k2PgVfwQxQFOsCSxx1HgqwWcXR7t3mzvOtO/uW3//2pBtn"
+    "NorRNSk08HDQc9Fzb/A6wcMxKputZ1yLJXiKWt1N+fQN6rzojlHshBE4t2JPhpqi6+vIr0EIGIeMU3tQM0BgwrKIiTgt"
+    "URDLNYyAbgahTXYXYOROSJDk6OBg0ubwPnoCjZLyzqBe912zzc5GXxvsmkXmjN4tI4OB7xTIVc007DR6wmALYMMZ7QOo"
+    "Ueh+U6TJZ+cLKvcO9kWicWnAIkEfGUb6YO8FgVQYv6N3RYOjC1SQRw30LzhLdANq5tBfh7/l0DELVwZxCvgSFleLMkWS"
+    "f0MKvY6exzcGx1f0lsFQMJyQ5uieE5nxrePDsA7GZgapyHgZFHovDQarLQJC8LTQRYMHrfHE8doadM0K9DlyTUoQnjpy"
+    "WMLg0PgWTVDSD0XA8CkngqGtX+19kIOgNEpl8Yo6IYI2eHzovDUIIwEWoTFMCAPCzilkVjAkPhWdaIR4QquV+DmZNyxH"
+    "jTA4iEgHpHHPYfKOkaCjQKtFW9+SmqB4BF2WR9w22GaYhOXZjypphehCQ9rVBLehd+nLDKcjgZbNheymywAgpGUETnjJ"
+    "4MBF5B6mjgEumS1sA+IfzDPLopfROKBJdCzCYeLpqRyKRcaEHrvV+Sayx1iS7iTv/IE0NimDXGw+SyIoIFJuyZdvdQh4"
+    "0zXpfiD6nIrocXRgKaCL0hCSSZEewvMJkvYpVkslu/n4yemWGRUthVyn5GGE51i8MQItEOk1EpTF0w4iWLiiAVUfeJiL"
+    "vNRwESNq0x7d2ISg4iQetMjeRPjPIZOAGybQ7Q0n5LkHvRtdwd7J5KK1wfvovDcRQ0DeWw/L8TGCUof6NMg449APDDcw"
+    "AXeIDB4gZIgqODRlHDrQ6XrTqQFfgWnAHXeigCfFUrgUk7WxiEkX1kVXGhuiDwpGKRQsKYCOrWBlUaH7l1zPTnt4B64P"
+    "OjVLmWCyutIRaKoQ2sZoixi0CEhQaDcBTSuJD7SlLEJRhaRSYUrnfMRggHFwTgZd79ZYsOqUh+Vo9Llr5A4KXcoSvgcu"
+    "qBW8g5wCH2vATgPS8vCRArZf+krWpuIebpZ3eKcqOOuykin10bWpsrFyDdJCQK4avIAJYegdPdMYHDIYD4dzgG3D04Wn"
+    "a4x14R4CFxQJXbbAsKKQCQ4rGu4dcCo2VOPkVH3odCiAyrUzuLyxaEbXF20Za19N2tWwt1bXtTJtp3XyZgoiDY0rUtvG"
+    "sotpgI+2/VjHph66opnqpm/qrq+bYWyKcWi62PX9AG+mYYhtN1ZlU7Zt07Fbd32xK45snAfT2yHMIzzrQSiai5cXvr99"
+    "6/z+5033i7vpcu4vfrwd/XE+VtWrpRpvLnd9dXwSy4fXTXm4aA6TDw+u4nwYp2UaDkNo31zFdj9dTsPFrtnNy3F/bMdD"
+    "N11cHPpx6i/HdHn9o7Z/WfXo4u2j9Fju41wc4lDtWzOaC1tXD189aKrHb0Isf9kNPzfPx13/9Mf7qbmdL+L8aJmn6+P1"
+    "sLt60vaPHzTtxbG7mF11c1kul7v9cugPY9G9vi7mZbma56u5P07L8bj0u0O3v7w6jstuOM7V5SWr2ia0yo81nHlbNKr0"
+    "wA4qnup6bKIb69QNVVF2cEWCtJWJRaFDJatRqmL0QLVtskUfQt+VoWmbuqjqrgptBwdfNmNfFn3XNF3X1XU/lN3QN0PV"
+    "9nXXdEAnQ9WNzBa2Vg54h9IYOgYjGwMxAQMeQpeqlLJtjW1lZSpjO5Ni8EVUycEd8MLgtbIqaLgHcAeQ5C2qLPAVXgqD"
+    "fA5jgyjx4cN4KTjiNoDdIkuDK8MCgucKClABb9GlSDoFX+OzkM1bCtxxXYjEGy0iS0WCW+kaHW1yMgJnCd6WwLqN08So"
+    "HUeGA195DdOB+2lwYhyjYPAfzIkcMjhH4AYWRLlBqWd8KECGO5QlvHcRHRj4a8CFnCCEDwar+crtQbQl4GilMBH4G7BR"
+    "OB2XilgEr5ORwGwxFmiB4YVkiF8AZ4IJKovcL0T0jCjk1yBcgcWCvoV4GZhFAI3BiMALhVvLYYedSvBzik5SpICsA3J7"
+    "gFKBGEdDUEmUfqARCAcTgH2AqToDzDfCY0AI4F6hdJA+OeDbwDlNAjZqEXClUUlaA1cYtLelqEH0Ez7SSx7QnwNMFZ1Y"
+    "mpO5isF7joA7ngNl2Q7NuBFSo0md3py4GnGdDpVQAqlqhLGCngdvBoTpgW2LIp9gwvB4YMco41V+HiofEv5JBk7ESkdq"
+    "VJb6UmSVUvE1O0Hy7JEmHy0BrcWKYMqRSjKkV11SrHPWhGdRzNH4OGGNbm6T0QYMxxcYl0OMPOjTTtFsUUNB2YgSRGie"
+    "nT5ZN8a1y81xukYI7pxDkp+8IqtrkfZI0twluh3wAaBDS03aTdisW86zSugFqgKIdsRlA6U4ECmoXWQgIst2Gq5Y5RAF"
+    "xo6z0p4ph9GYBIcSq6Mzay04vsvuVEfhdFRrxQlqTeBIzkAncBh0tmSogJ0Bcg6O1nFHqAiW1UyJ6ogkjVfm93AXKBNA"
+    "YQydMhBoFmINYeGxZY8PuruAXGRYw4p8Q/nnkB+6YtDOIB9itju8lQU6xyRGS+lhcNktasPInHQeZ1s8Ov5wo/Wa/cBP"
+    "4+fgBherMxoJVGSjd435rUkg8F9CcKgleCMSmUNL0hCEAB7CkAJYVk1xTYoAL4pwbwTJZixreHg0hM+n8aXKru7V24Co"
+    "DNCPcq7GKey4ch9YCd73kyVIIHCQDqDe4G0xGKVD/SarncDVQbsD+kUP1qqyatokOLvT/qO1q9YwQ3Z/ICbDMrFhAMlT"
+    "wtcp4DcWzRRxilji76M7LaCGSChFMK8RvyDxGIBKHCIM8p6gOY/cRSFoMV8Jk8GkK02iC0AAL7AEeluTFLYrxtlGs/zO"
+    "cbY6PgjdBkMA91fILPIH0LLSqEEbjcgchadvcqRgw3rj+Jp8rizfXISvSuKsZwEmsaZh8PVC6PsRU77mKYGJi/dNkhmf"
+    "01wIWswcHblB1Z/ME74FS2gWegUEiNXHRzzWy2z/85ybtNJCnkwe7RTEP/l+N/AigWsRQHy3Rets5erjJY5EaS+bM3Gz"
+    "lXIUMIB4Qm/I6s/gW2h8C4XT/809Vxc/c4twTFow7/u98tEh0IGiS2vMjW3js9P4Gi3TTOwbr7qL7m6UKD7k6eJn/rkv"
+    "z0zj747PV/MwO+Zo4cBvswto8zydx5fv8lI4+5Dv6Qf6XonwzsZfwQN8o6S8wWADS+3IIc82WSvu/GtidUqJsyAGfyeS"
+    "ze/25N1wtCcTnYl3xt9uWP4Xrww6IU++rntOeHYnUe+HPu8dxvqpd5yTVm7jn7yq92aaJ4UQb+Sua+bHRmCCs80tdEJB"
+    "8K/kfsa0AORD5y7lUxDhbnz8QqN7BzGC8oQ1ceS6FWe+R7Eenbg/OP+AIz5vFqhEolL8nejJer3uIC40HvB3j5xDZp+5"
+    "oPERj3byRa+wGvHh3T/HZmzPRuTkmJURdj4+uw/lWHHoTIBRTaYz6VgVuR09zzCOrMqIO2Lk55eE3/vu9CoFK3sK7yF8"
+    "mPP3AsZ3GC76A5IEjG+L+DmdFTZKQmt9GRQ6K1Fz5PcgCSdo0B0e7GyJQbAQmUUPHqZ+bBTP7u/UvT9gxwQH1rg36Fi1"
+    "wuRchVD5oR/aovA2kuNc3HmEMwhoDUdmZr5K8v/vz//vP/+zP/unf/qbf/y9/+33/skf/t4f/eYfHf7ge7//9//hP/6N"
+    "/+ln/oef+0ff+53v/8bv/if/4OXv/tL3v/u93/rPv//j3/8bv/Ur3/vur/7Gz/zmx7/x89/91V/77t/83tvvfeu7v/jr"
+    "v/Yff+c/+u7b7/zsr//yL/36t7/z6Xf+xq/9wi//ys/9+te/842//bP/2S/9zf/yW7/22d/+9t/6hV/4W9/+rz7/1Z/+"
+    "lZ//xf/0Z/+LH/tVhmqBq8OF3fFJfKZvl+XvdGPBeVXvXrx4+ml5qa1o7Nd9H/QkrikBiFSsml+ChP9IH8fp42oPqmjd"
+    "7i8+ff3xPCfNYnzWLmN38JdEJUSwmnVqF67aZmwephK3fbh58jHreccbVaUihKP73F6bCXGtLpRV2972r4831/UD/9A8"
+    "ljPIqZ43qGUCyVmve7mIZ6JE84G1Ydfvl6tPHn/8dHncXxU1MEyma3vh26g8Al+dTKY4pkOEE+NeV2nXXD+4/Yi9Zhds",
+    "YbMYxQD/9aLjnWvLpqrKsgCLbgx7f+FuzRN9VIscRYvqL8wgsIr3cvRzuWuXYZn2YPTvL/cP94+Wm+Ww6+cWrOuiDiVY"
+    "h2BA4hbAPFEZ02B7ucKVBQzSVuxjfs0v+YU/uoPdd8theb17M99O6M+xmpyYSS/myhz1hMY4WiOaxDpcPFJuDIu6jkOz"
+    "G5fdsiy73Th2bVWibww1EEQkoP8dVWElVqDNKueQFHHdXVWlcKN3cIl3+tX45uXD10tfgXJt47F8MU5X/oHaw69cwAZY"
+    "ThnEJUfszKjmrt/Xj0KCy9g2u2X/0X631A3628pdM/axAuNAWB86yn3wqnD1rvIBYwxl6JaBtAAxyJ5f2Yuufitb1lYv"
+    "bj9+PhdKx+btTfvcVXwyR2tGccGmnAdlYO2t6Hr7EQiPXfHiuNxWgTfj/s2r3QIa3tDc7torVfAD2MDoR0TrWKdQXIC1"
+    "d1nvr6dDwVXdPXmNUIAetuOQ4kNY19tpfqlYunn6fJdY6l59Vjk2hOOF27GjiqW8YDlSBazXAynwR37cq8SH4faqLkK/"
+    "fLr0Raj2l+PijR2q5tJi4mFMDqYHynY4NgE2J/TjYXTOh/kJA6P9yIaqeMFvXPupKOyrt6Uqn75dompefVQI+/AQR37h"
+    "7CXQm2ooK5/kFnesMqlnwc8L0MDl0roAJFDzYp46raqm9cKG0hsEsFq0LLREkx34lUbFyqLL3oEaz4+8WsTzEC7Zp7Ov"
+    "xNs3Ne/fPkzu6uNaxKePwRIYrvhi9J7twLzAwKiF24u5ij2PvpnYOHRJLvtOFsvS6nbXutROnpVlxSWwQ6WDQBVCIvFg"
+    "jEQGBLID6/WWadjgyOtYvOIP9qqN08zffF5Ux0cxPppd/PypnKpQ2P6CvTQYM6rRAZCYSHwsgHKaJ+z6YIt2acXx47p+"
+    "cPBxmari5YGPQ1QhlWqpVOXQwcLKUbVLiKnjern2/cNJpT1jHeYyVqV8Hc3grXH70Xyx58dXQHydfvm5vLpyXfTS2GdC"
+    "TSyR2ThgzENdiPEh+/jI93vv5zn0n3T1zcT7pXCHZ+zmAd+3uvK+xpwzDKUGtm/V0BW8GVL5fLFPHqnqCUUgI48lTNX6"
+    "Qrcp7mJ7DOMrP7x13Su7PDLHg75o1dHJvRIlhYFBBSmA8AOfal71vJxcsSvT0ob9aPeDXjqx27FpL9pJFaXxYJrKwFiU"
+    "PBlVeFNEVzShmGNaGKvh0rds2bHdJ3Ka9KD6rnjQjG/Dbs/2tX1gjzf8wbUYjlK3FKLKANlUsaZhVRKFjNENvlvsbmHL"
+    "6JeiXmTfq77wjYkFSw5d+RYDuRkBdU8HpIWU1xw4kPn0mh9GUzfX+vqQPnNXS3quh7J4yG6vrbdO3hbctIIljhFUW2Pe"
+    "mlj2bCpdXe7NsjcHO0/VTRzbuBNXfWpEI9vaOhWYDSjotXGlhjdDUbV8lKH3M2e65eLYsfro/cU134dJXh/ihf08XDfz"
+    "szTxvXp2HTzcK3up+eCQ9fKyYCBO+PRM6P2RHWLn9zfqwnxa7Ov51u7Vjn3y0CY/sKoxDFifbODaYWJooafHpvdHexuH"
+    "cXzFH8N1Pgg+PQzh5rX1F29k273lF/qN/MK8iRfpo7IrHz4J6Xil/BwYyj5KjwTDexikeLWXcjiIwR/5rTmyT9Kh2pX7"
+    "XVkvn4i6XOBsS141cPkmjzmALPokH/VFUS3lqPfFS7mHC7mA0nbbmPL1C+s+PRr1tt+ZN+kj+4Z/yj5Vs35mq+mBdRdH"
+    "rXpgAGrNShdg7OswcNcvIiy7FJd+SPti5/d2BxIVRINsbKMKG2XQlnmhsdIDCHerI2jzBQswObD/zTAJPqhGls/fOP3A"
+    "XPJ52o/VK/2Z+bQdb6tJLOLa+asLzzC+wguXSUh0nRAN65gHli/2Ys/GfuzLnYDtL5qh6UG0jT4kX0rgwDBXHhxTIoDy"
+    "aqI0HCgCLgNa6z0I1GmqZfH51LLqOO0ZKDVH91k9vgwvY/e0HnR6dZmEudmBKerRNSUxEqx7rma2cH1hLnhzDM/ZMtlP"
+    "+LHUr83eiod2EKzScGM1VbkAvgeL5H4SV6rasedq2IlXaCHfTMAJb/vahKvw15wA7eGGz0fxYO4/St1b9ro17f51Kdy0"
+    "oGuFsnKbWjI1iknJcb6tWHeRHsniJV/29o1VV8XrktUPLxouRlCYUK9GpG1RcT6YJbD+pltE81o87ItPEWCTgJ+x9IDd"
+    "JJ6+xr4o2HzDLhf5YGG7l+KLkQ3P+MOSxdmVhgEv55SibSWTE5vAPr/lB8/qW74fGHCAcScu4Tbt2OPIPCpUXCZlUd9o"
+    "peOYGl9pNaW2j+Em1QOu3ywLTCCMR2CkMn3NLVdKXoOweV3MrxozveLP52DKywZT11RbZDQgbKvQo57BHqv3bolwj9qw"
+    "1DC+DlOTdjXzfawH0JNqXpZYokN68iZjtjOKPvIwa6oroJ+Nuwh08LibbkFOX13x8YueLZ+0rP+0i2/noNqL7qIqDUYR"
+    "EmU8NRYYirL9NM+amf5gp6Pm1RHo8ViE3SBZtQ99D9wC5H2JKXcMff0YWNWgCpiiTmEoTdmQ38f65/zFlEQYHt7w/ctS"
+    "quXrAytvnlTdm0PJ7Pi8G25AnHGtJ/ihNtYCH6k0V6G4HuvPOy3D9Y0V+08LPt2OoCEeb/RhdrA61/EaAyASVLAKLrqO"
+    "u0W+2QFLWC7hhnxBqC4DR/BSfLb0qPM8fh359NcuPasevoDTS8uno3j2ePBIKH4uSvSKCbBEX8XZB8NM3H+tlMebDlSJ"
+    "y88aqcLxsmWHJyVG601Xx8lmg664kG0BFhOTw2cTqE2jF2L+WraatTHl/ieTevhybDxz5fU3HyQhyuPbY6vnt1djwLzX"
+    "uh6GqfdgeWHg2Nld23beO8VtLK+vEtPdrgcdy+6vRgSwGFck1cyDXVFbrOjawHJwgMdhagjWh55XRBXCpsIpfvq20bp6"
+    "9PVHA1qT7YOvPdwng/5j3+6uLmR9UbeVV5QTVICBMDe8HSvQtGHU1HQX17uEUALXdCXCFOq2DN6BgpdRdZosQEmAFLW6"
+    "gkVKkVZEiByldTnur9/+9Cc3Uw1mrbK+nC8effpoV8j24avjri/tiiUGiVq043J8ett5ocL88OnDXYuE5sp+vnl8u1/m"
+    "se+auoyg0yAECebTjENlEMQmFCiGTT/Oy6GACcQYYJ7OYuKaXCG60qW6H3f7qxeffuPb33zz6un1ftnN8zQOfde1d69u"
+    "Pl4/fPLs7Y//9a9/9Pj2+gKsvip5fBohf41DWTtMy+Hi+sUnbz95cX3c78a+AXvD4bR+5Pm/TVXiFsD6120i4aYcqGMI"
+    "Mu97ENMTXPJ5t0PrCu0r+GaiF+5F2zQ1PgL2MK+aXs651Azz/ngBryOexdC1NZqUBYyWdxw+j68YvaHwz0oV0vh0mpOL"
+    "dT+0SVF9EIItZGcT5tmGVDUwP5gBPhh+I2D4gYJPOlQtbLHXd5nsG+I1jwMcBEZp+wePyVtEKZu59EYB6ylibLoCuaON"
+    "Td/X6KSXrpmPF0CBwLgwNuRiUTWVR2yiCxGWBXRm0aSJsD6H7lJdxbyZQiIWA2ugwGJTKrplqQLo8trF+UiVbmR2cul6"
+    "aCMY3ww0s6k1VEjAjsfD3GO2dezmZQZiF66anu+ntirgsoW6Lixl8BQlqKGIUFYZb19VKhCm0BjMccb97JYeFmUK0FMc"
+    "WkUBKJkTBBdTQHTbelczPRHHgO/7Cxg5Vct+6urSiWr/2WFsHDdV3194KcPytMZDUsIhYsaJcvSeLHYMQFS88OgxUzAO"
+    "8IA49ZyXc6cJBAg202EABgPnTBVGEONX9mDu2zFQxNwsN0sjwZTvQUHh3SdXfRXU8MkQwIQ+/PgUMGnUj5dC1bc7lysZ"
+    "IU8IlbcEOBJgockN0Vk23vG+F4Rpt5dgLHJfDQ0yveYSacmDNdYglA10I5dkuHkw8GVsC6CJ8vN936gXR2BkYvi4QTTb"
+    "8NrI+HBUtLdxX6ZXNWw5PDwkxTu1IXmNsBjstV1pHFVlAJI4zIr1HcXj7FM0ZdOByuxIW8MheqPLUvTPRgOMC8NEF5ed"
+    "eja1TZLjdRm1f+yZhH/AAFHXjR7fOgTJifQw7ndOIRzfIlzUUsRYG2mRgqNMDImNc3csphgxFunHnVIXWDel73PhE28R"
+    "/VgUfHzRV11ttOGXl10cqzrxCcwqt8PofKMZtw+YLy8xjFV9JKo3zoA2WncSFA1tqfqEyk5JMG/x7lnpE9WzEFNIcL1A"
+    "KE4dCFKeIu92AouhwGa5EgF1lbS3e9D3QU+x3wRzsqwsB4o3SUYXPN45KSmw6fYyPcTiCeERu5gkXokQ95h5DuqZLNbo"
+    "IaIOpee8QFIYG0x3gfeX0lU6GlBdpUo10ChcvFBh3aySp1e8LmX04W3zqK69bcCY97FWzqOniWtUPZX2C1ZZupCXFwqM"
+    "4cE96FUE/lSMEQtYgJEBPMwrX1iQr6OBpwUpHlcwPuvsx3GAGQUx6r4hsCC5fAMcl0wiveqCcbV+3e9jE8V+Aik/FAV8"
+    "iRg49FuB6LWWT6re+cD7sf0JLO20k7cBZKj3vcNyIuRk0LkAWgkyHZFdu4c18Hn1WB8Gu7OvhIbfW94I1qiUQ+6grkn1"
+    "5gCXPHZXXaiTXAapgQr7hmH9HIa+Oy5AfQhw42Hs8Jol4z+ZnvIExhXY2xVMtne8bSnxpCxA2wQ2xkpegB7qB9vIqR2G"
+    "0OqluKpdhJv63Iqdj6iEdlzA559dS9HrY5di4dyOib6RHZxlC/cSg81wi1SyBqgj3YhaP9CPXWXjuD/awrTlDo5dsFqD"
+    "eoyRWG4sxgpnpiNjtyCMFJtBA4msA24I9n9CzA5/YmWC3ypwz9gIhDyJx9YVJb9sRNGxvpJmUCCEOIg1MJdYStrWug6z"
+    "uVRtmP0jPYIafgs6uOVHWYPqMyAWQFSga+GGRdBLmYCdVNq9Ap4VZQM0WDtpImtbJ25Y/Qwm6xQDrevKsZE9MDyWdsdV"
+    "H5rW+FHDXoCkEzEwX/NUcNCom+d+dOy5wQSwZ3pQy8MiVWBFStD+sLAMw2QVBIwIEIDRVkJhraknoYmXQGSNmntT8q9z"
+    "sPTgiA9BAjmCarYsrJQ7xeoqDbzoeRf4Dms0pGgt8LdaeTBqIgNGVF6XP1HUo34pZtteFw/YsG9cg/6Qx/Cv1EdC7cbI"
+    "uXeBKeCiZVF3xdjc7IBDfqsDte7z8GPSXrqlKROwrYhA6wnMpKqTCQt+9KVpbTOYrnCNCy3wUN4bsPbavZmW+q2fnrff"
+    "LNqyf1JUejyESnQVfKSyQANRwkFbjsgRHjBaBsMZvwejpmmvFJj6P6HkS/Exly/MY1HO+hrrx7BGDCOf+OPou7JRgys6"
+    "PdvQi7F0Iw+DmWQa/NxOi3vC9o+KHyuXw+F42YcbfcPkXh5FH2wne12XPPIZNALWKe5FwgSSkttwKVk5PLL2GObQglGd"
+    "9vIj4ADVobj+jKMyoj/ncBtG3YVRja6u+cKathr5EspRHxnoOZPeN8eb8TI+k8fj+PzxIB/Lvejnx4rt+RXrXFXCkT6W"
+    "AQNZAcQfyFGs/zWWcIWs9/zlpKeXfrTu6dxePbSzGXfVIp+8YRHUFuAJg2jNKOCRvizUTgwOxp7cYJ6oYr4e3EHs54tj"
+    "//3dPn5j2JuP+LHYlU+EnIbazmyRs30E7InqAoBYLIAQXQlyLoEcbO0k+qGXy7Uvf6ps90vxyUMfQI+0OznXwMe9nIBn"
+    "7ivfjGBXxEqOapI7NscWWEa7c5flnt0My/zg1fyr+8eH2/7Ro7l58Lpp9kdddLBUtIUj1eERKG8QFwYGnwj2aEv3Yij0"
+    "xd6L5loV6ltiZFdiil7OIONmgbVEWC2fslnUYSyTnWLDd3riO74Xs3vE2uKRmNPteLm/efjg+W3/wIPMkY/Ezj7Qgzum"
+    "Noy1ANsHtNGOh8ohfEtjoT/D0EPt4YImsM5B4U26kJYfQBpfAzMpuB01hzsG5OfdrVZjHfWlOQAbOQCpz+hZd1ftXHXV"
+    "/nHfPb68unx8HB6ZZ+NV/eLhVBweTos6igs5sGERvrh2KAOoGgIr8VJx5yQ7hJ16BobkvmZy/gbcSlPrwKb4CAsmFhg3"
+    "QkABKM6WPRC71tk0BqBmMYvruW37bngKhHBT3iwX3dOrn7ziTy+u22cP7FGM8vYzPXQHvkiux0VjRakygcGLeCzUMQyz"
+    "fuCfuMktH1OttPGnPgpNxYobFlKc7eQNejNGoJgCzntUB8Ev/FLrSdZAbNd92bu+eF4tQ9mOl/bxg9vdT13Vt8PTC387"
+    "LOl4eXHT9aZaOPoHknMtV6ClKvSOVRVsKRM7B4utQCAfyuYxaIof8fbQyeUIJJbYZc9LqwvMRDB7jAEu4qIE/tNZMD6O"
+    "AjhTbyf9sF9eqGNY6gdX9avdx5fTs4v9Vbuv5p25+gY/8qZsJgVXE0zpMYpWigAr5UnJ0Ao+iLKxZc8KXolJg23CLm0A"
+    "bQykUwjVeMMSrzgQvqsF71FyfNMsB3ntiz0bVdP6Rd/247Pm6nl5u8wHezt8fHt4MFVXzeXBXd+8OF7zHXDZulOgVUe3"
+    "wK0HlRRUbV4gxlCoAYSPiX0tlBuAucJRz1jZD+s7ViGIy+YjXR0TiL5dEIVKO3azYwHuPE8j31fmQtcP6rnf76rnM382"
+    "FI99eCSAcOrHvH+Sxm/r6SimFEDAuLaqKhAVMpZCJzLREMbPNPvEsAshJhPKQrhLYQ7Wooo+gJHh9XgLky1+5PhngkdG"
+    "AhFoyh/CcmdKYbCgpmJiWGcpct0qP5tuH8ZHU/f4urjZuwuQvSWvEdxWg1ngbFtrOEyNlfRAOd0F99GFmR6K9oFIC3cg"
+    "xwrmChPqInVNNbX1rql3jDJNSwxjClSGsXodZ5FqHKqKq4G7ifmnQnzTAbepu9BwHUG9o5q4cHBT193s268dxqt5ACMJ"
+    "gQEU+0cD1CpQYeaRdT2LNQPtB+wCCcZIZHBositZj+afdIS3Ah0U03rQLmSitEIlERoGDMkXGgRl/EyaHagwKqEatFh1"
+    "zdk+iWLfqScL+wZciEJUCFd1GJsCM8nDhWTAxcUuqaEzVaOUXxEecOuM4dYJ66hqLqHfgGEIh2WUcDODBoUR3pZpB4YG"
+    "xdvBSCjmMsGF8VJ5bSosXstYw/ge1C2BZiZLEYxqGMVUXDZr9iAToBNg2TmOtSBrhgBtTKISeq3FBuYmldrhn2O9ogbM"
+    "dlbCFAzmXHAqu2CT71swQHkn9MAo7WrQDovQMDZwcUALAjiAFYnnXFoOHLhsDeiuWFkQhiiAPlAWK5DSEus9cx+YA/0S"
+    "TCMNE7ZAbvpzrWLnTdfKpJTEmuCYvtTUoMXbVkg0MqxplC5Ayb8QDLicBH7jUd+XjcLqqqm2cPsjaV+xF6H1CoFT6N8w"
+    "JnEXsEIeJjBjBjlmZ1Dh7YoSEI1PTeM6MGa8cC1lWltTNEAlHMv7ouZthgCaKdYHxagtWOYWJhkpiRCMvWSUBisnwaE5"
+    "+JXAfUTLE7a+EmijZfCUWWF+kp8VhUGasLYKngFv6DtCEDoXU19SYRCglkGx0IBGjSWXgW2CioE/wUehmSklolHBhg7w"
+    "fASyM1cbzCTjykdnvCNgMJAc4rg0mt9IcIpn9CSVl7WIyy1ZlaQsQBzoIg4Fei5BUOrZAS/QCMpuBENMLQYNJAo1NKs1"
+    "1t1FcG8D59HCHEDhM6kyAcxFOH/QMDDp0RBOSa4oQ0kFXzE5jxBE8GZ9AOUVLJiAyXR1sass5XobvfNKRVBtDJgVG+ra"
+    "IlniIeLRgLKBxmUhjA26gzsUgVSwZBOwdrJM0RTBqme5kqileSNEV4s8PqGTDbCHILD8akhdwCrOmCm0w0wC2BGE5GME"
+    "FWwVvdY6p8wz2H2F4F8QbAXoUlZYSc6jAkGLiCqCO6+xKq2ymF3HsZoX5uMJdQZalBSMnxFRCnfFeP3IRg/68ASzslIn"
+    "1E6wHheW84RlWyoITthWvDgwvsQ8MiN1AMuzhs2ROiqER2tCnCDylaDllISXSzWJXIwTsTyI6g3RERgVU5KG5K5gLI85"
+    "fsp7LG4NIhzxGqDTondjbQqQfXbo7gGmGrgBARGZchGFiDWYRAk3U56KMiEsOkPPc9GftUyTzsB9dMehBxB+/ZFLcHX0"
+    "AyVL2CYMWcNxYaYcwV9NBmRrvhaPQZgtXDkDrCMgnJUgDsYJt+KDqUopnJeWQm8ANHQLMbUhiHEZcZfLGGmY5C0dH8at"
+    "qPYZavNguGJWHjMZnWzz1fX4R7NSYFoHsm7MiMT4Zq4PhkXfDaPa+luxIipVRKmDGc9K5XuplC5HJB1QwQTGPzNgc4AE"
+    "0mArA1sEKwqLASIxiZworXN6MJAemK6wVkwPQXKIyNUxDZASDn0G4/MNjpePfC2IgQkspx2Afd2haHIF5iSC4aCPGCHR"
+    "OmHFO06F0OkRiBU1JL+Af1DeL6YkMMqxwxrwJid9YtrtmtbPc5IkFUqTuWQAouD1mk7N1Tq+oSuo0XNgBsbg8keH7jy4"
+    "yVQFlaD/cLpUkx+oFn0iwDLxeDxV7sMIK2EQ6UnZrSRzaRnKvl0hkVTCRmbM9FpAgz6BZdc4XPjEbLgCeZGUAVZnFeVP"
+    "kEqEScYCm0XgvuLuWQurABbvGR0zuZpzzQrcZZULG6hTISSekau5jsGKUhW5qgOVKeeiMOjiCeYWVPYObzVm3yBkAmU4"
+    "8D5bgOaOqdJYadEarkDT8Dkhhg6XatJTdRy14dQ3RHdu/cC2yuJ8qzsuMkBdIN0mMFdAyIC0ciHOcB8tXuwS3UkRlAuZ"
+    "IipmXjnYLDhsDeIUB5dYdZkGz2keOMiWrZAXT+WqqHjVWm5BrmBT+kvj4xcFqj4GAwrtGGFJWPC3cLhw2HIPch9xlxHY"
+    "YgQKR3015xebTFrr4PKUpZHLG9CQMvM5ErprdOsulV0ha8CTGMEIsVUFzFDLAG9VIFaAsfAGqBvTuoDS4GaBmoIp7yon"
+    "P1FCRaaufKc3Be8EiceSxYboHNMi1ood+lQ+QawPgQc2wO1cV4uxKAouWlZ19Tzj1cBqojBiwtRSjJpwNLLgbiPWdW0i"
+    "wtcChzRixRL+hEUNWq7D+kaWBxNAxQvAyH1h6RIp6w1IZo9ljR2W7sQFOpHM5QS3ERh++QiEDwlW2A3M2pHKwa4G0HUk"
+    "lSOPhILkucmAqWFacAU7XWFRAdlUmFwsQKuoRPJFwkBrVEFjdeqYYvQRrhxwexgL9UyNJbhhDcnW1x3c81LHiytZcMeD"
+    "SsAYQAHRJVYs5xNiv0BACJ5qioOBxlfMrKqM8J3plNNgYJQFXkmJzsACNGIerI0RQUig+ICaJTxuBAzqsca7LDFz0ZHB"
+    "wAjSCxbaZT+1oGkyvXuL6TQ8mQKshoOGY9Jed6wNA/DoQYIxMIugvCrbUKUIMrIuNSbKgVYascJxYTHhJFJ2lA5wHsg8"
+    "4aJrYUFoyjqwFpVr9Lu1sIclLFnseL2DPQU6YF+Et6npWHFMpl/UzF40fKwGOVYlg3HA/DEF8CAVwDi1ZS3aSSN1wMCR"
+    "H4Q6yjbywekW+PVxD2fQ8LbrigJzL3rZu7rRb9jx8m11dXha1w+/4OHQsXTA/O566ZXqmgt2I8z4aQL68f7BDLMH462r"
+    "1Yz+/aK8mp9Gb+N+mY8ti0Mo5cEU3W5yczWL8Uq4breEWInl48Xw6ean4wFkVEjz291edL66nHY/auv3yF5dXukXHz+o"
+    "pos3IAN2stjvh6k2O9Pq6/0sbqbm0Rjc3An/MdDelMa58v66EtVo7dXVs4U5EAJXddCujVMdvernrprVkObLyYyV35W6"
+    "PTyb1W64/gwsWKCRYfdmr+reiVdzU4KtUhahbIq2qsXQFaDBgvrhylGMQtwWE2jsoQRy6QfDO9VWLW/Gq2pnq6lQeix3"
+    "3Pqu7MS+kQ0Xad/NoClzMB1cK4DqQ+icmbApSAOMq2e9r7ojqGXdoNywsArYQlU61yZ9oQJY+UjmlONnRYGlrhQQvpVd"
+    "N5nqutWBD+0OuxnoW6C7drDAQQrb2HpyIMDiiJUcll0owEQDMuYXyrjGlajne4Rjg1ECOqFCXjp6qoJWgd0oZQkfsbA8"
+    "uOB4N0Hwj8PEkp9L5nwqrbNNa8AeV+gxqieM7VRDgOtfFiCmwgBTTaAta9b4MLDSl6mAVQfYRVFrK2OcHVhBqgQWCwZC"
+    "5z2vQeMNdQQBb7HaCGYxoghGB1aBdkrx6FCKtrSNtj62mFRsGzSXdAPiwSJoDGYtqI4YSnqvRMPgqlFqI1jkYCu6Cs1Q"
+    "jGp6kNra2K4BPQkddNzGwUcbhUhJUrllTKiQYGewoMGqxYzd0i2et54nLGbSVA0qXk3SATOaQcP2I4pyrFDAqTos5Rg6"
+    "arxDxYwcpRi0oDoYLBkL1gPqzjIGzNnjZa78U2AjEWCs3mOBB7BXnXjZs0uWuAaTEawOYBK6w1ouXKGu6arOWuopAoPG"
+    "Cu1zo2uyRPC0sSyJIfcrMD/MLqSaVfDulkaTC+UxSVWUWM58Rc81Kh9Ys54l9ZkUE5N1Ae8lUdSwPI25FGh9UC+IkCLs"
+    "sK88ZgOVvcHuF6ArYb5uQfnItqQ0Xi2pPEygglGYmE65i2hBAIunPZM5TxbrzHAsNU2AxmUaiwZkQIiUutcNnuq3IOgS"
+    "Tk5Rm4m6Iv2RtC64AtgPQdUSHWRUkoULsNsdno3ALGi0hEjtxuLOMtd1hDUpHDHHNNeEV9JTIgbDSsZakBmgXFahp+J4"
+    "nrqDoN6XkxMJUITgBpxHicmoCJSoQeh7FmrMEIBtRdi/jZj9xx3Gb9Fic1TORhqUnmCYY1SRCn1lqIBXAyngCG4Cww9k"
+    "LIhwncuNKDo3V1BZFbS/71pugQ3sa0pMdBYL44B4tEkJzMr1aLVgcBee4LEAtYMDgx33ai25BFxmA7TABxXcNlOEqmIl"
+    "xu0DqhdlK7HTDWJNETkmEUmnGN80ulyljLKS4C6iNkgZqdwBNaNujAVrUMtKHhQWLAuUkAitsVgqSDvN0zo+CWOpaltq"
+    "1vEZsSjoflO89BYVfioSTrWD3JoWLNRa9CXbE1hGPFdLXutgM6x1YCNuIFbswyZZyE8pg8OALk+1pymFKeef5gJVoIZX"
+    "Lu1hOyusTRJQV4CjhtuENXhMrn3rct3AVd/PNsXa5Q19Kczn0sykDhpCamJTKrOlXQbs0UXmgjkV/uUsUS0AxMhHygS2"
+    "QUUNpAOLT9aiQYuVElB9kWjr0TNIkdV3OdpreS9/V5tv9XIouBxrBu1aXRZZHnoP1g8IDdKHYZZhI0112bietcBXGw76"
+    "HChLGu1qrAGOzoWcVI+zz7XACf7C70r6nTUP0WsZLkr2XVM4c0+htQ7ZqQhfUh7T1q0c4GSfgOlXtahDc+tAoBgg2xI9"
+    "O3B3sW4YHltuJ4hNvnj2hLLVqZNLHmypyXd2iFBbKV/Upu/VWkYfK9kT6LQByum5LFmnFcZzXWzgxLQjIitRRkqDhOnk"
+    "mg9MThi+WdirbSnylyud5EltFck0Els+9HXbEDyDvFvpGu8YMCDpa9uI4Cy6xFhAkcgQM4DWmyPPseKUz0wNC0XuF3Yy"
+    "vE5Vl1YzlJwlVKVMZueBoNYiW+qywPHhuuqdQacu9VsxckFBK10osN8ZiJaBoQsOG0OgWxgLdxJuC/1vuZJ6Th/M7R0p"
+    "j/6uex86/tmpWjLti75LAiSnkUe6DQptfKxCUWBnhlDriKFU9FhguTHNWgReMq+pRwI2CMisiGqxE01ouVneWw5o7q20"
+    "JjWr7HuQ57mu1F8Jd9CNL0GKRNaB2aDAbIIf9LVskmypYAZuqkWJXkps8IDlSHHzbI7drMnClCGQy0hsjbzWayCpqF2u"
+    "n3ueD87W/nqod12jUAgFD0+F16Pq8OKAgtCm0okOLSSHDwyYxF6hv0yhhACWnn0AVJcBRRVxd72V0yXPGnV35MxLdVZ7"
+    "Vqrc4ZKa8fGSI6DeyMpxf4Fur/0XyiRZg7HGTaH6snDY0EOolvNcyg3LinBK25TYOoKS9te0tux98obSZrcy5Vslb6JA"
+    "JrMjClUanLcJCA0Hc0aK1DasDM/DFw2L04wZtzUDTUeVsk1gy1bY8CxhXapIFSwEuW5VdrQJgkoxQn+BRY0Fds1d1rzE"
+    "Lj/wDjoE9HYCgnga4slB2YLdBuEEOlVAPKKZx6FkdXIV6BAVet4xgcKbgs01XM7J5ET+hI0uajx6hOULiqdQaXe6/gkf"
+    "XdboWwYFFGRx4Jnj5LILqOfD2VtLraiw8SKwOhCXEcVXpeuomroCa9dh4zzmGiBU0KYxnQGrvxnWK1PIBQ30Hl2Z2GGL"
+    "iRZjFRHD8NQ0DeihQUReDd/HIIwvYPeLMvNE3E7QNjrkBIkySywCBrHUisJ4UdsgDrqOTRiLWPN+qDUYVqVyj03lzWcC"
+    "FI0jg+lXFmsFtQlWNUpRiE7oSo3MVAoM4BJd8QnbfYBVLn3kqLVJajWGvXY43iYh4eBhKxC9hHQDahN6KEoUTWDdsBAn"
+    "r4rQl2WhQtuH4pO2Vo+W0bG5P3CTqou6V+ly6HV45OBqXGPQJaLspx5liM5AbTMAz7JAZ7CNl//v//N//Z//x5//6Z/8"
+    "83/2v/4v//M//Sd/9Id/+Ad/8Pu///u/93v/43//j/+7f/Tf/sP/5r/+B3//d3/nd/7e3/u7f/f73//t3/7t3/qt3/pN"
+    "eP0Gvb6XX989e33nS15/B1+/nl+/dvZiX9ZXl3+VHr8/RJnVL3l9+fj8L2Z8/gNfZxna7wTFOedfrc/xVx77bP3infH5"
+    "qbo7//c28vn4Unx4/H+bM9gqIApx3nDk3hfvdGh5b/y7Li5fkQ45P+sJw8VdBfj35yC+bHx+ar7ylc7grlD8u31pTvvw"
+    "oY14f3z1lcfn4q4zwlpnc51Drp6+NWVZS7vc+yI/XN7V9qUkBHE2vx9YR0Pknr7y1JaHbzM56x/wwT98ayB0b3wqnEil"
+    "oN5pVfChysmUiEWdbmkC/NRsaqvYf+rWsFWxP1/8Vlh+67eQa+asz9u60/AP8gFOw1ILJ5l78citKZC8a9Agzqhg63V8"
+    "Rw9nOjImJ+duP+QdyVkc74x/mgPVJ6NUEJWnqu5v/7sksDVaFndkcH8fqE0latVgoFO1a7nOeyvHcyrggT2QNFWCwR4H"
+    "UuWJqq3a/rr9gm87sPZv4O9eR3HvElA2AKVRWEPji20L1+vvcO6KmipobF6l1Xbq6/av9fBE7jF9b8vXZkziro3A2fLX"
+    "8WFIB6p9tFjbJNefQn89FRPDek1gBLuAK8cVY/BHy9wDCgPO8p379oED/jdxYIEgEtB5jB9MrltrsHtciQVGseIMpuc5"
+    "zKWiYVFrlSpX2BX3WpLkx8mtB1MO+UtCuuA3VNKaI1qLashyKsq4mg3Ys1n23V5jEWDEi0Tv6yKGgJF1KuOmcx1FydcG"
+    "C2olM6p5J7RNoMA57ayO1qELo0yhSC4F6wrjSlhNFcpkXbQ6+JBSKEsfEJqSxw+oZll1o3zyRAcw3OceM6nQxEJfHtbt"
+    "JmKntAEOp+WjK4pClUXSVfC28rGMqaxMEb0B2ygaUBptTMF7dDlrFYzD6pZRY2EMIGUY3Ke1xau2oPQ2Q5U9eziIM89j"
+    "hSlquayxhUH7VJVlVRSyiElF73QNj6tDTD54J73VGJAejY2FhnlXcHAF/LbF6ou1xStLrfEwduuwNQYW5MjNlBB+YzD0"
+    "ZJgvy+w3VdyWYIiVyfOA1alhr2BI18Si6NHBjQ3fOjibvh1Hv7u+UftlH3bDzk7D5et5/3i/f7Xrn+/7emn6eir3y7B/"
+    "uO+WcWraom9SMY7VMC/DYnKFOUa9xywV242+EDo56m8BdidD1zLcfJHg9Od+6Yvnn/6k/+Llp+bJ4wf8UdLdG2H3P8NF"
+    "6vDXYWMf6xgq3XK9EOKECoA90kHP/nhlDte35vXxSv/Y7hif9Qe92sLwKUu9/DQo6FQNdO6Kmlp+obWEmLMec4XtZHRz"
+    "+Ii9vHpevzjM33raFOl115lv7aZmt+yWZn94WVw8+jheL0256wtM0du3w/RFc3HzoHr82ByOB/mynfTXmn31vL9UW7dT"
+    "ssqIyuGY2rqqX9mUKyQjkgMOWQK9pnn/ulMxSSA735d18+2y6VKIAU02MCOxrDGo90Z7pW2pNRAYvgP3GC6Ub8qqGbp+"
+    "7MdpGoax69NQ59qPd0Ag5DNYRtVI7DUDwzsqD4aAFSxHU5Sps0PZKkIH4pA+BKA45WICsyxI7PyHHlggsQJ2NGBAFCtn"
+    "Yblwg1VZJfVJpPrTPAkr7taPwoWYbJYuhUuYnIi9X+3apptxDzMoqroOIQpsVuc1WMtwXAlYpIOroOBui5Ccjkk7uGsF"
+    "XI3K2RBhSwxVgZBUtRNngOmmzm8eq1WoY718deqYU6W6DAGMfoVhf5+wdB7YZAbmllpfFPDkgITLnKIWzZzCuFS6EoEa"
+    "iD0zTjrcJY9zgV+EX8GONNRkD5jZO+OTV0JuObqkWVRl08TovAhwmqHsTJ1SbhQBJC+wv2+umcjOVQZ+p1/IDKJEro1O"
+    "GUXBByzJIy1euFPlsXMd9jSHLOOAFtq2LCJWmNppWdzOyzyA1buWP6OuLCiP6a+g52+dm/hZUTb02OVxsSQvFn1FB6DZ"
+    "1M6ztmNbdVKaxjqHWNRN19ZNv794Oy+FSrc/tVzMvfJSbkUZUULCLbbBeQ8EjymumMRKjJyKYFL7Nsz/w0rDRVPW9Y8c"
+    "/cy8UJy/s/4v66d15zzj2AeoLDGGkd9DRkd/z3visFODQCbOmrToNXJSTbVgQSbOPzzuhxq3rXOEI/Tu9lZYrNJ513vr",
+    "rHnVl6/iZO5KdcNZoeSHxj8fm7/bvhCVJi3L46WYFXbRvXPti7umjj+w6czqnEWnk9bvNv/i7+zXHXdY67OhVzoY3c3B"
+    "CI54FLn1E2Jb77mzUnIr1OmuHiJfcUAOAVzSJPH++FuhyXtbQ3U51wZnWC8beElHVZOtWNtlne3b9s89AlhnYPg6xtGu"
+    "+KP7Be/4qcUQf6fNSS5TmQuwJoMhLURvccn43erXud91h+T3zxPkATpQQYciVGN22J+3ZVvL4H24cxZbp0A+xBjxDLk4"
+    "a3yyTmGtKcjPqqdus3EYjkIXbcs+xu8kE3eW5lmLUPF+M0aMt6xRD0wc0onpwvOtwOlayzbHh/jaAoIJcdckkEw8R4XQ"
+    "mKgq9ZMUGr43Pts6Yr3XPpIYgFw7q69lemVUmFxy/94IsZqU4mwTTpasXJu1Av0NCGVmW5VfszYEUvcY93lFzwyhJEhg"
+    "LsaZfev8ftOdvP/bGfBTC1LUJNAF6uVaSdQzTMclQcApSIJr1zgfeUct/P1+pLn7ZI5r3O0cv9cl9Z59l+NhoFqVTHis"
+    "JELwWGYZartMrZ1a9RoRI4p+t10kz1WP2Fr1E7VyteLo+ftdh06VcFeCVgg/AE2FWac5hps0Bc4wVfJEIBQ2pDiNErkl"
+    "5v1WdBSBzjdd5m5FuSmXzAd+vwAs2dVYwYM50NydT2B8GODV6ACm+KcCtl+tq9nuGu4I1stFk4dAC2d9mzI8HIHGmkZT"
+    "PJcWVncUfsd3QMzDSTNReAUGEChJ2K8CzDpjCX6AlZuESgoLn6/jy7wCn7Hi8DO+UgFlLOQAt2E5SGlZLhex1mummuOS"
+    "nTf+BFUvGsrUsIiLV1aLRqN2yeDOW48AWqQ0rezqAEEwPe4/fAIR86CniJYTah2fHKm7kURgCoblKOZHHcypFKqkjSDo"
+    "yXYMmsC/TmhjMXWDy2Hg6VCzsYUlUs/X3GV4BUjLHLUytARswg5ng8HmAR5MOALGfO5Aj8V3wFpGNkA9s7k424C1S1SG"
+    "A4AhgawVdKio1Myn/rNYX01+8h4D31ih3Cq5djJdNy/my6WtQyU4YlsfNoKGUViGKBh0PRC9SYNYacLecgInr2jeU79D"
+    "QZUGOCm7GlOEeHcwD8USBtNh2VjszG0IqavW8U++EDxwQZ2FEqJSETDTsaLGPABiNZoSrCiHADs9ZEkqcldmwU+iE9+s"
+    "hCwt/h4LB86Xg5Vh4BXRlSIvE/qyVhKn60f0n+PSeHUUFstCh2Jkl6yowJByjPxM2OooF88WmMpDxfmpKQ/dS8m27nVg"
+    "8qui0AZkvC7BBIpt1HseAs+IcHWK4me1BS9cpCwRvFyoP3sZLe9hHrCIT2QsZQoO6x9iiBqMcmxgg42eBDUMwJAYPlTk"
+    "/uJZipZSYiaOwnhgxXUD17DEoBAp3Nh5Iscj1dbrmwqPU0fqvMuyqDWswfB69PatU6NIBUzKIqgXu0KAaWaNIISEWdsY"
+    "ZYj71peXoO0JWEqgVB30+lA6jKa6oARdNysBZ27KnKEUwFyAHKu5h1Q0db2z6YmKOkighahSISqPTh8se4EduBAXjQkP"
+    "aCxgUFZt9cmNMpUTvbBlwIAadojH/gHYF5VCxChuUAIgsyEwnSHhTCIc1lV7MNoa2L9wKcbK7WxRywpDiCXCA4JDRKHG"
+    "QhIITbHE1+W5+keSwpRO9cp2CDQQ1B8LUxIkKT/rduesDAKwYcOl7JkGrgkmdcOUt05MmE9bDLxpZF36wqTAC2Oi8BZh"
+    "EHq9Rdn7SR0sqYA78TYpfJKmwjw8rMMEnAl5oaCC83Ktrk+mokUFB+O3liOnYibChelmt5+NbxAMAnuOkU0TTLDYEsNx"
+    "pTdBKdamcIaaeiHEG11ZMsMeqKmlc4JhH6YYWeUk9fLa4DInXTl3ak2YplfXvG3NfN0eD1OUo+NNssYlTGizNQ8V0mKK"
+    "BjsmwU2LXqYki6DhQ15SFwJsjiFX1yQDlqf7WE6hr02DzVdg80JHTf7uOjqy3GEE96WysvKuVe1et/tmWvqLedyNU51G"
+    "i4HmirJ1YFEJk2VMYUMSKYikdAQJo5zR2eVGXdCA0GH7OjnVZh/1iDXDmiItffsImG7uVrJmwyANCOxwwUTkAesN8/6F"
+    "7eaiaYvK44JbnkaWJpVGk6xLOqXhInZ/PZWHJha9caPEGhQtqjYdk+Okp1d26eOlrPcydIjFFyVvvs52Puz8jzz/l6/w"
+    "hZPkwtYalrLqAhczXFvlH5W+b3xboRYjwN4FivcN8yMLnmNqXj/G9ou67Kag9prvmVtU3ZhR6kWr/YHv37J+pwoDoghI"
+    "E9hVcSGKn2H66FlZGET1kfxeSUBT6z3skNWJQqc4dL5snbl0bG9YHZitmapREEWXmtRMsd+ZbserRjpMPAB+iNl0OqdG"
+    "yLXnF3XSk9RjJWhdOWBJiKyF6+oEodDWyvbYFwNb5ommwX5DtqiMv9QK+E9v2BxYZTCVFvgSmLwFMKWMQsOmYM4ba3KT"
+    "NyypCxyf0I8sN6mTuTnd1ntGU26uIvsAW7yuZjO+i63CesyxaJQPAusSHQRfPO55bkwJLCtgkxHEOyZtK+UKbFMDbwSB"
+    "SdueU0scufWHJ/I2aGbhmJrltipy7eixQmW2otBwZSspjrLSsECsYl5gpWGB6MOAj8DCRggrMRVQAAemJrCqr85ecoYf"
+    "FBY3X+RODVkQnrXAoTr/Gbqz9p6RWyNbwg/C4jtscwgsCoQJppaRO27NmSKgpmXJoejDVqno9nPoCAUp5JRFWNwKfCN7"
+    "AzVMKjtLnRPk1rokSwfKFQMd7DQ+IsASguiKGi0AT82HcifBzcgwhJhDDAnTaLhLQ1lr1EyG6ggiJgbtMUP3SOZO9mI9"
+    "dcyrpwDO1r6BsM934xPL0Q3oM2irOL6GWpQ4D0FaxNIR5Cw3fqH1ahT8ODJbRxZibfEhacZqncfaBokCZjmBc4MCMkqz"
+    "E+joRjeip96JK+7tzhCzxKv5mTeMpoNyFwHV6FVAmUYK6eaCwMpqLDdMFKfGFmJtyYOteLauCUhAJXaLcfgupQnKFR7L"
+    "79rH8ve9VNTmEv2qea+y9YszwgwgwpyvUFQSxxi5IsSY2PAFPONFKd8cW39iR0yKQ5+y9/gHBr/fcoVEvaZErtzVU2eI"
+    "YwaFiVxXgVrCrNPIqvva4Cgj0vABVLcNeYLWa4Yv42f9NvgPaCVCObmCzBpF68tARHKZUf6dyFDNzdCVW28d+n5jDC4j"
+    "VCV2p+Wni/meH+TDrlR6Zm5fvcGzkaNu5JANhdznKyd1nuzfrCyemnBQcjvbFBrxVeBIq8UvcuNNvoI+V5U49wZd6wfn"
+    "VmWbc5A6aZwoe2s6dd6Z+isIVWJBa5J0NgtlbivEV2BwVg+39vTizCl6dpxi1cw4/6HbmdzzE69NJ0inYhknvbbXkWLF"
+    "oG6X8ryb+jY+XyUW51958HsO87WHLWENNl6++vlOTkYu7g2QaXlruPPvjEdbccinDl65fTFf2yCctZK5w+Cwv4DFv+eC"
+    "3/wjZ82WNu+VeO96nx/8XxgS77Qizu71Tv8A0ou/H0j4i5vF+z5F9iEE4r9v5fcHDsf/0ob+S1ruV53Rfxgv+SNe/I96"
+    "fPEf8uH/1euvXn/1+qBh85fJEsSXyUP+oxuf8b+UGWw9JD+owP8l6CEfHn/FWdxLU/uL0PnuY5lPTUK3BqP3kA7Z+jmf"
+    "Af93GVqcBahPodVNyRbiHc9CxjHIe5Hkf8sZ8Lv0Ds5PSIsNA5MdFvL+CZC5dr+R5FefQTZxtwRUyU59KsXmBctetTw+"
+    "v1eOLldKOkvq/WrJIHmLswm3luZhW9tetrXg3mwxkTtLbidADgSVq5St9ZLuSOKHyYY4NUvmuZ3vGpOUbEuo4PxEA3eI"
+    "mTMYIGWH6gxmWtsu36GmvtxmWTE41HWZmmBnlEiO5Ymtn2e2enPNoOzZEHftVvPoPBey0ivYTJz3uH0/IeQ0F0H+bix/"
+    "kPEAnLqBy80/hVnG65q3skVb6+F8CtulyN4zwajV+YqoEScf8Qc5s8oJlpR3Sv7zXIwrN9amulMngpTrFeA50SZ34c7B"
+    "e0rhNMwZvbpNdM6oZ1vX5fN7cDYR8jJixTtCaOQwtsr+77zbefm5+iDRY44OoI9I52dqRJRxERAZY7CT9uohUPxUqW9r"
+    "DHzPVUMh8dWNp6XjJheAFjq7oqntpWZbiSh8ev769JXa2gnC4K4yPlJjd3jJlTzl1rX+buAtaYer9ZQN81hlKsfzKBgq"
+    "NOUR0RXMN5BO/ATWWW/ARh6UGaxkEMHrJLAwolZ6hbUKviaxb8tWOWq+OpEID6CVlxiKpLJYmCwgc/0vzKO0hPagDaS4"
+    "q1p3nxJGpNyurMHWdsWRGS8T9znHgC7QSqqnxsBcZUQ01VPQhSswiUDk2hhGIhZP5j2nEP4KaaIaKUQOOWMG/fzoLzeb"
+    "6w8RJaIWczFS6SYWKPV5bWi79uS+QxQZrBeKzmJ0lVuEQnhpKdSD2GmKcOCAknDb8syNI9fqgEycw5twfKztEEVtdxUG"
+    "yHmJpXC4YScwI8zcY6NADIqvVAAUbzTWvRPa2mCCxB+RTxHzVugIVT74jfZX7CPGwfAksmMwl2zD6IYShaisa3VUXiX9"
+    "WF/oVmoh18k7bAdOB4DvKGdL37jGJOz0cSIRmbdMckyygP8kTWJrKy7W+gCIbyKwubmbm8G9El5UMlS2MZN5aneOucZF"
+    "i2ntmYUFXvKKFwwTizHAuyI3EJRk0O+NhQCdxAiKWneNn3qeii3h6QRwFhSAz1dx2yb4POag6Bq7tanJTLbyQN5BYlAZ"
+    "q3GIxEtZVXVfv6weNb5lbWj7dmn33b7bxdmOutedL71LqmKN6NSAVe3FwDpRY+vFWvZ8NLPfYbfXP/vS159+6PWv//Wf"
+    "/Mm/+lf/8l/+i3/xx3/8v///xL2HkibJdh6W3md5X/X79t3T3WN6Ztbv3l3gwtx7AyBIgiIZkhhBRSgoRfAd5GAIEnR6"
+    "Mb2AQk8hihEAdU5W9+wFX2A61sy0q6qszHO+L/Oc7/s//+N//A//4d//+3/37/7tv/3rv/7rf/Nv/vW//qu/+qt/9a/+"
+    "8i//8i/+4i/+/M///M/+7M/+D/j43/Hjf8OP//X543/5+WOMn9yf1M/uTyirFHP0P2rb7uePZHoEH23bNvBRJyeoEr4N"
+    "fZJa/NY2fQk/X5ZFUeR/9yNbDZDSFdEtCT64Nyg9mw4psPsDLluUJZoXoZnzz4W38EVX1G3X1mUesRMGnYawEwE+sujd"
+    "s33TWnDJpdL4Dd7/1qXQbMnhh08uRDHL8JYwWD9fmysXgkHkIVUyLEIh/34amswqqYzT4nlsUpMGX2Hr2oOIAsNwRfts"
+    "6mRe7iattOdehucPxj41Lq7zL10d/iYdmpdFGCWDreT7XWPQMwnrm1yMHta5Qn8LbA6CKKPxWugb9vLbnpsGGeMv/Zuf"
+    "WgD+6w/28pV0/ecfsJqFLMAlY388LzitIoN7iXhPKKrOkmcU/AnjqljTE1sr/z/9vt/as6arKzr9O32Uq1YL/RkMryEx"
+    "PYPnAeWPZHe747EleYFX5sZBVjHWrGf1L1dNJxl8Pdj7Obb+Vkc3fXa1w2MEbHyha38kTx2Ea/OHwt4y+E+CHqilaeG7"
+    "+fCo6kqXEaGbjegYjOqMqe8tldanrLcW1f524/gnNUmpUfkPkiiXeLIsrYEsoLTC6aFT1yTWPWH3l3ieGKnsjbmARYrl"
+    "o5hpXmAZVYgsC6lJb20wfB5R9qkknK4VqOsRk0YxJ+eUTAo1eJqHpV745AxrYLDUJrl+yeQgxtdrr627KSFkqHIkh8PI"
+    "0K/UqYoUaLqTjnJfRvb5RPe5SOS5agciM49oYoSeK6h2haeePHVkai2em0ekWIuikvBX+uK6bNKiSAsqt5boSQ281aww"
+    "ta4JSoIhDlnB+W+dPqJqBqQJiSbjWI1h01ltUl5FWUqGEplY9YSfwz+lJxTiZf5hRufpWPm5RQYnSmYghfVCywriAURv"
+    "9JVNqiJrGfdLJTR2rkDaVJGiRIl26ZhSp3o/7N5kz73L8IPrqXaqqV3PO9exfl4oL6XRbD0IJ7zIYGmjdHjW+dgIjTWr"
+    "61EpW6uOV/dwwBKomh7g0gl2GlRPFVhOltyO8MKrngpbq03SAW8SKPqkxUN+XqwvxbqEdFYQ94R9TV1NGoslhUnUJmFH"
+    "j8AahlfDeEtAWt6iaZNhySQAe7GwekU9X/m5ASThxoThV26TLrWe/9Ofz+2fO4Phh3Ki6wPvi6lXmUO7cJwW+LxSAywE"
+    "bC4lsdoJ5RHZWzxfTjrDSb2dsxUqv5wxU8E/NT88X/05/7/8u9YIfDr35D0l4UKO/VAqZx1qsSDk8YRorD6FlcQUxH5r"
+    "8X7R0w2LGbBpg6zrlz2Xf5MXReFnTp8q+f8OQXsphqc/U338LZHS7GiiVTR3AC94MiMQvsXWAA8Q0mtifGoSXXlqUo9a"
+    "tXOep8jabfCp9D65Tf/WsR62nqWaTqlWzXCaPNfY6pZSe6J+j29VVzbOyRzwDWogFaRxJIeJGBWJqPemVpQoEfujAC55"
+    "jglkZVwvbTkQuxxbK9KxlkAYzBuEOyzkAX4nPXyDwTpLRZ3wHN6oh8t9ZbpqbCBaOp9ruHg1NSWx2JojaM4TNUzV2gl9"
+    "Pr9gth5vrzEwHbYrLmKqHFEMRe8BxBuA8ljLYoCbyaRaxrAuHbA7cgzDbaDoneD9Rtb4WwwzWSW6WM0lrxgW/paIZXMi"
+    "1/odxsxaXWrXwjkU6+IKq0ql9J4li+MMdWZoREU7nZS7UfxGoxVeyvIcCywJWjkrlLyjJKf0gRfl1BisHZHYwpxsoYTv"
+    "DEqAs0DiGgtSF7RBTy+s+REGXqVC9WuF/lRY3wUUEi4b4UIwtBjkNE8ELdXBaKyFWxk1vkiN09il6SA33h/hm+WAkjQN"
+    "kGCLVce5qvEhTeBJYowXPKIwcwlY2yZVG28xJUtpsWkB1p0OLMM2U5+aKIHFpiyXYhDipZUHJOy/Fh5j/Tmu6CzM9LyA"
+    "Aep6Y7cF3FCFtTeoWMc3qZQJ1kMLI5wxW6JbusFQaDGmKJVKvOCTjDlYJLTgqQM0Gfzq5xIz1OBbNyFY0gzDRJTcBUiS"
+    "XADibxu4KCtt19qqMQzAhyEZ5qZszgSMkoGQG5xsgoEl5IAbOlw6RhqeFBsyQVECEd6BUHzt35TPMiKo1LZWIGHhMV3F"
+    "sVLvUtp0S7Rzb7IZIEcsTaFNCcBUqhA3nXAwsNT4yrLBouqxwgL0HHWKcFuF47wSKJEOvJWlmp+1gBpj87pASh7XzSQE"
+    "WSikDyMOL67CyI44AT0XkadaMvWc5X2ki5gj+ve5SvWiZtfaBt60mXSSTIrlSNm4tGghggKKATecCgzHqLePik+poA9I"
+    "GkRMNxJjkK5mjXZo8CIBZQRECJlK+BuIo0GFf2Z2GXqnFKSXC21SSV4dA5nncF7vpb7CHsuNrBy8OhoBpqGzXkfrIm9g"
+    "qdNAF9RZLuAloQUHKbOcdBymVx6l7RqYtDhfgSNUBOaMgQUGWA97HBypsUsV67t7Q9i+ZXQGDlrnllYXpnf9lEt28uO4"
+    "EOk6+GSbphFf3H4DN8278mgpIJechUYqWkIehJkzkr1DH6IMBsu1EHsD0S1zsBS9MRDL25SmWcSsBhi0jNQrFjeaZ2TL"
+    "JvKupf1CzEICZNxmnysbD+0oYifmgvbNYHpq8o6pgtEvquC6THo7AHyxVsiNGegR1QPzmuuBu9/FXZU9tlnA2HPZ8QGd"
+    "BCsS6cD5juaeWfXr78j3766U9HdbjPQzsKOq33XCeCcqusmyU8HMNBggNq9EKZwUr8icBZpvzK7VcxxneOVHjHWyQdH2"
+    "hhaBjLebvqPF3TiRqrOkqUiPOzt0mqdz6yvKs+ItTJE6Ovm5T75+VZLmi+4+kOZtPLesPFPekriFsVe8khehm2Cp7+oo"
+    "w3LHm9oV/pY3bCyqgWaKL2IBtFi2EoaSmprqrKJAzOZ+6QSJcRiCmUxsClUpYy4YGeYtrUPdd/4N512HPeyGlF3MIL7A"
+    "UNT8CtAYqXy3hZU6lbwfFWlpuSdkGDYdqzAWZ7FnGZ18oXitTStqUQDj8DaJwTrcEAmLsLwqaVvA5JtLGwn7MBP6JN+x"
+    "fhQd6YbtTOSTLiH0wmIRK4ymotobJeiwQDx41GXb+5zk37tOhm3GyFjE9n2P3+rVzvDIGuejXJiI4SD06GINTMdX6O9V"
+    "lQHFVu0sSI/VyiXzeVPZjKF9ELDompTANj6Gon6/Ra8K7NQH+hUayGbsEgJNpcnypfFqmeXbt7V4s4U7AbRAr1k3EsX9"
+    "hYbZ6VnryD3K3olRZUrXKi8IyyEEZNapUVGfF5TCbAsz2bGGyFhCKmlYDVEnxyXYSvLmgCqOkPAkhD2NjaT8DrlH/p58"
+    "K/31DrLHa00tfHUPacObCuBIA7ksL7vdhgTVqjBWDp55/PWARttsTtKvDWlolGZceLHNSbmYwzCQQubEosLhvJOiyoZU"
+    "tT2hSCyFVd4IBwywBxLHGuPIEwDQoTz1vAfMckdrfigH6uSmh5XYAWLz5dkpf0SsVRUz4Az3KzcE0VHZSW3k4FgNybDI"
+    "hzLwXr8Xpm7pBHlLlJC1B3YreTFDDitZI1EB2ZZmhBcjchgLgwzMBXaCCDHiZngsl0sgJbsJGLFftlPWl69aIXwQt+6g"
+    "CNz7YVCbTJOSNszKATDbQ6AcEEnMpgkAdQQWER36SIwAdmwR5QXyoQCREwYFMwe2sTAZA4Uf5hJwJyTKjZGXM2cH3Fl+"
+    "NPi+dvHcldlZP+ltQM4CeWingYr5AZYg99NUt8S411pXCqJrCXPOs0WYC+J33bWBzGg3To+URtq4HG6DbyT2kKB37VZz"
+    "B4wbwOC1NxDMmuxhtNMZy0TH/siO5QmBHrnD/o/NcAVJwUkWauw+g98LQ4SV5EXVHzu6gVs/NjUZBcBdePIc1qxtq7dH"
+    "r2vIBIIBpoIFQeKtYstz6wkRlSfZhhqb6z1QAKVo+25oxBYWeRS/w/4gv+ywmvyOjJAWfAzVw3WWQFxnOO50d+yQO2Ws"
+    "qfKou6a44moiejPK3M6EZfnMqMrtlmaSuwDwITqaz9S7r16aX6UV7IS9QUSbEaF6h4YIUrgOt+K+6w+a9BkAqQV4btac"
+    "1Z1yCpa+gIjVkmLWokCyfYEWeEtf2DPRzcrIGwPzaJNRPQDYKoBYlDLziIjQf5f1Nly/XF/nI6ms4W30scw03KOKhjYy"
+    "6jhBVF22G2Le9RMAK/jBxg4L0F52fF/HEi4jZmPT7u9M5Z1H94tSZPsdmhhuKBmjZ93AeuCNSjOg1wDOG14UsoWwq+Kq"
+    "16ALwCUVzOpAaKikVig+XTvXhyq/PstyP8viOpuqfoYIhV5ZCKnqU4y2Nj7sXU7RZyHm9gDxLCtg8aszueV6x9wSwl3b"
+    "v9ID7UfOJmshdaPIuEXbcERQaT9Fw2PyAubDWEYDUJgWriZ2YF3hzm5uF39bwa2RTTzKFpIKRA1EO50BGC5a+6GshvDW"
+    "y4rGXmsvXZZbdtCKA8+ZIcBdj+RKEXk2EnEeWjaj+rguSYZtUM8SwLxqeiIG7L/YFnFQJ06XmBE30tbyxzdOjIxP84Km"
+    "lObx8ASz3gEuGCphNbPGDdX0vS9a3mFnWQOMFoAa8rVwN81ULX4vR3amcQ9oW7KKt1vuiglPJ3HPPzXpcfSoUI3BzSiT"
+    "u1v7Y0ZDMZAua+Lolkevrob3Rb2RMjvlZQ13VqFztFSSt8ZDjBmHCojV4OSxF0JVwaOufjFJLbab6gwI1+JkJrLD2exC"
+    "8Ugr35aclVWyo0F87EZIcsuOzA6PrKL9rrgW5hLoMPFb3w1+eU8msg0DZbPhHogqCTQbYUIazu/GAUBRBkinGzlQJ1W9"
+    "ohX7fcjWM/mJXG/JQQQvGsBfmtj3yuulsbxzdmT/lKSjPzTCsRta3EgyctlECI653877s2i1OTE9KHkx6nm+YALmPcSp"
+    "roN1TVA02/Qmv+koQK/hJo8AELtasg7es/0JMKm3/wjwN7/Q3JaniXbHUgJJLhs0lQHmEH5EpeW0JyFcaWDR01ZWGh0Z"
+    "dt/VlLx9A0uQFg2g3LMidkOrz6e+9Dt63rZCTjKwYDI0AOlYnx1cw+WDG+dJzGcwRxvjxdKeWUhoot2rzLTn/eu6+gDh"
+    "BzDA2Y4ZZ/5eUpRIJ4xS+FncAFOe/AIsT/14q+a+i06J75SY0RW5Hb6oFz8O+1fDyZgpn9xDF1pXAAR4Y3zHuw1zD/m2"
+    "IOXFB/KmaVnav4e0XlvRXIxlcZ53Qo4bTVhLdxLQAv8XaYd41eYGqG7f6Neaiz4feroX/Xg8GVWzN3DDt73MvfkTCRxj"
+    "BBTzyvr9WdtdVHFzmZU6nhRE7ZzN6rFUgapTn5/cBKxS6S/gRW3bwV8ys6fzIBW8575Cy7hOZwMaHaHCWZKBEty25TdR"
+    "F7B8MvlATpyUY3/F7B28q8Mk3JbqzjU7chT3ZchKX9S02N+72fWZve0v3NQ1e8snfmBHQe17U8+qeEdrl+2LxQM4KAyd"
+    "kDeXxkEg7HSLuwZ+7dFEDo0y03m+nUQYgFKSS97IDFhmfX+TfUuHbA5A3kZxSVSvwr6uFnWeZap3jYJseKqv1ONyl4fo"
+    "zuoKBbK211ZlthrFQA1fBkhBvX6C4D8fXpk4ke4cKNTakobbG7hngS1Q6JdR70QPYGSUjkbT90LRCxHH8zcXbmZz2fen"
+    "RTHaiPNBQrzZ6r6uD2xpcH1rZgwMTX1ozeXy1UUB4B0DHqoKf6WmjX4gudZvOdyMeHVFBbyItXoABeABYhRIraOwvonl"
+    "RXcRohh3DaAKQKUjn9F7qqzy7eM3SzOLIzvlZNqaMcNLTNVC3uZl3LEP5EO+/6o+s6VK3YENHQBkVNUP4eLLqenLOlee"
+    "KMdsHLs33SeFFsCEeFIaqVC25UFYI/NsnNwbeQYYyfKmqieWoy8dObDawLLN63z5w3dv5ytyTR70xej+IQAXfXfmvlYL"
+    "avLYgqILAw2deFNfNfOcDazSrpeXeooQ4ao8YLnBp+YHmwoKmBZGupL2zlSkoguZXDd02+a4ry/CVg9yoicKMD8iF3Yh"
+    "etz/A04paFn4od7PH/a/utyfi/PxGv5tb9nNCBzjTTHt2dhkG9XhhrVli3zgf+h/bAvcx5BJTTOsUu2c2aS0qAstQ1ex"
+    "Xo2Vn9Q2v+DHZtl2J3NGD/Xmfv4xvHM3cWrszB74qap75hUvDoO9ZUBk4lXTFhm1k/4KQNU0TDfz1auL19dnb+pfZ79T"
+    "3M/zbf7kv73IPUw7menOBC1wJUY+rjUqWEJxgqfzJInscACoRd7KhrW874ehmJuFbu3F9uri+LB9J55Orz/ef/vw3e1X"
+    "/Onbx6eHx8frzSU535wdLnbbvdrTbb5M/RKWAJM4q8pYhVZ3n5v/ugyitNKZ6xyxRsMyrMUJPTbRNMHSe9rTAlC7R2ec"
+    "s3JbzXqmS7P5+uqLi292v9P96vh7P3346fy75Ym9Od6+P97MN9XN9vJ4erU7ny/ipTg/3Lx+9f7sq+zX/vfOPvzO3a82"
+    "H9Tb84f3lxf7y83l/rKV1GPnpg6Srj4tEAZVVJkcqtHPfrt9+Pvvf/H4eH7T7u+6i3IqOwGwj6oRzfiwgyvUh/F6vMt3"
+    "fB/217un/dfjl/lxmd81ryFcNLCc2ChKFuH7Mc26++xr9g/Y/zz/T4c/vnl7L9f9YoB7MAUdelxEPPRfPrz5eLYZMrib"
+    "ap6mQQRAZH23Pf7O4e181h3J3px27z4UExDjeBgBmI8sl0E4yn1+R1vv+KDnMG12r78YngD26fdsJlUMWtem2D5Ov6H/"
+    "iPxG/gY79VcRD5L0wJt6091dTgsphmVSMCYN8Larh+Ndv2sO9EEvSMBJofNynKbLxu/cxevj7YbOdjefDptb32Vxfse3"
+    "sbqYL0hdWnrTQsI2ctqfk3MzwNsOdVmc8ZIG0Zq+8GS1QEUVByCz7/almdpmQ5meuvP+Y7kjva8B4QI1yuqH5fbcKffm"
+    "9ng7zE2flbmQr+71qzhHU4cw2wDZj5MgxvFMEhj9oth8NfcFmnM6xvK8nVhXkbPlhtolr0rg7Ek5AU+xqJLTZbn0dQkp"
+    "SYzugpTS1nkNr2Dv3w5Nbd7Pr/6bfomKt27T3Dbj0C9D4Q8opobyd/6hD3RqH386bRndTQ0z+XHv59NA+Lb4yc5SV4TU"
+    "r2hvlUe7TmOW4E1qxsZNzRxibQ/A3IfBX5uxkPRmomQz7YTt2Ov+VthzYr8cyq4rgoOwBBDYSxhZfifm4vZUjMtThEUT"
+    "iekJsLTt/A1RS2XuPhRzwcZz4l5tWsL2BTnPL3wvKvF622R9lWwRpOCNa9HxQfspfw0cIgLeed9XRJ+m4zcQbgq3AXJo"
+    "dNVyAOS99va6u8rn+U09oEdtxAMFZ5rNSPWu4B8vMj4ebJbHB4ANYfFbLdkcM9dS4i1x15DqabvktF7ri4AWLnOLHpNL"
+    "reURWE3ucOtpqr6cQrcp3XhV7q76Ghj8QOjj/uT7nIWCZcXN60oq0ZaU16V8mjLewetflpKoYX6QlL46mDlTwvTL1Ja+"
+    "nS4pRNCK5rhTfRUBDaWDMglUw2P9Watjk0eregNA541jxfnAX1WGVO+VfQ1g5r6/5FMOtC28ImNeQsq8r0kVtvsscm5w"
+    "M6Uzb8jA1Bc97baEdgvg/+XjqKrKxzn39/CrBOOu29NhljVAi3R6J0Lf5dQ17VToUrABOEVVl7tID87r4ZHo3S3lX3e1"
+    "BkrCl1fqdxsF6TsCOJlFo0szVhkFVhY7w3bDBaduM0RdfhwM5CSb052duk6MXrxaYMWN8FaPgPE3dVa0Wzzsg2HHOqS4"
+    "Hzjt9q3XZS+Hcsl0sz0GQ64MO558Mzjhu838o9D5+QHAm91xSPFO2CAXB7/kcuiZWEgP9F9NHS3sCCl8zqIQppng+0ch"
+    "n4CRPGp925ClBdImSBvwZI/lpCS2cZDH5+0Jvl0P3AwXmd5cLCJnxfxQsSqPE4Lb4XrS8JOlJyddkJrmWkQyEMtVC1Dt"
+    "7bCF1x+KBn5ZRUdfjtQ5Aw+illxH2xnbTdKeDTVwpT21Pqh0wO16SuMensUZScpqEnyBiay+v6yF2MkGpks3ZpuGXT1d"
+    "AzKogCpVxtLhKIXYS2aKjlQlKTPa7qhopra9AAToK0CHsnsE3oyCIHq78WScRc1KHvCcCzBhfBYMcrUgprNUjz735aa2"
+    "XdCWPXSvGLvSrCJFS6bFBZHVP/FRe2f7WG6oLQ7Ssk7YDIih+yEAxNs7eU23LKsC3/e1Kq3wr/kMaP7B8anT/DzPaaaG"
+    "QfMhuIW0Uj5hsV/g1BQBaDFkWWAdeG7Hdv4I6CPkGWkaM42tvOQ4PDPpOataJeDVk1oE3NcUjpH+2zYGCtO/zfIvMB7G"
+    "FrBTBYFhuBaC3rLzseKzt7mjGdB7wUoAV8qpFq4PgYWEB0PaMtNDxflOxon1lGyddg5JeONNwc4qF9WROF2YEUD78FNg"
+    "HKjOjyTIicQD3NW2KvtCMf9LYHqBZBDRtxBozbUoIbSfk8JuUXYmc8G6vN8Fi63me/Sc/V5QfwQC68zOuTzfXdx0EaaX"
+    "zQuYHu0RJldltLWPD0V9EjRo1uwr8gQZKbfkiZsNJWHrPbtrVSTqB2ZugNMA5Sjy47WCbEkPisgPXXUg/grggtOhxzQd"
+    "auCwHZ7fvqesiWwKNO8AfJb6tKMwABXNqM+/VTvUiJXycPq4FNR/m8fW9izjouCQnAvtSXR4xJhBVtkFJd6TmzEnF5sd"
+    "vB6+OfuiaWmebY4P0S97MtYqg1urOjpJ5nNCR4L6KUCyWa2F3Vi7bcn3lgt3/kRsXyzLl5jetGrlfnHa98MXPZ/e7Yaj"
+    "kGdCdVRbD7DjbpxzodvNnvVGsv32Tt2Qhi+uMMUTMC5rxhLdzKuRTkVGdK4yQUkeIes/APHKmIJHMKVZZjSdyj+SLxda"
+    "f7Abo6qZJZs4Ar++VqLsMpOHh0MF4R7Gh1bOXUK2N4vupWfzrERhghGHnZQwf8ZykrgDW66Wb12v0zm4QvsrmxvCPcVy"
+    "CuBs8gMKbriRwNS8LpR7L4MveAcB6iadVgOxdqRSrOpaM3sgeIL1LFakru1ryJ96U1lN6UgPA6pLifthtCTynC4wf3Ms"
+    "EyZN7QkpSlqW0meoe4kVPi26zqKTWf4a1Wre6+aMQrI/dKLPJBmPnLubjk9HeLuzCmxZAmCOANHAZW1VRTUy+DaDhbvo"
+    "5FZwKUYO6UNHNywtgKOeSD7AgoPkpF3ZuggzFriPThV0DN49qhihemluzJbke6IuK0+rHR6I58pud+z8TJD5jNiuFfmQ"
+    "bcu2UqX2cuFty6erkaDRfZCiozn60lOnlgKd8iKp21yS3uJ7CBFyvUFldgDLFuIZHv4W8N05tyKZN9HfcHngAJAcyYpx"
+    "oDbjtalnwCbtUkJGrsquEF2rswIyOUCVOtRsynrcBRY1RB/3BheIYLK2KP+tA561xzpvz7PKsL72U1XjhidEWiuCl5rG"
+    "Fq2EtXEFQWPjb0gZy05vSKtU1VV1VzLAV6HRlHdA6m1HgB6Y+hL3ecWJN35mJaudh5BYSHir95oKg+GkYaKgeQDoAow/"
+    "79pisSVic1JrgnvsDg0Wazx/LwH5NEj+UdrZAJFwkMk1zzv2QXGYL4XmNideDa4D4J95YLfmKKUsQ5c1QanCcJUlF1DI"
+    "Tz6kem+YA7WKC2dGZzC/Ib53kWdCjpMsZYDp7vAQCxZMocYAuDbDM7+s0YUqeZY2gGw2qffFTEvTwFIuCIoIOl6ljhTO",
+    "IZ9Q5rUKNjOAAiD75UxJ0hpIw5xlwOW1p7IA1J8Hl1FA3y0hgFN1m9EgR0MLkZmuhekaIEwA0gGkQTan6YMfmkM20rxu"
+    "rK/6DJ0b4TsvDfHnT25a/vuK/9OMmBD7B8iknTQ0bEYOYCSz1J9oDTw4GzsF8ZJGT1QHYLQhoqRmXrwKleAxEJlZ26ED"
+    "NSzMkXaAHDiyPv/ZWx9VfDos+f2maxzONDoMZFaXWICxnbQ6hwSV/bOb4ieJ9tDyHQSMhnV8sxsBMWwCPMCBKD/SVTEL"
+    "oChEVp6ZorAAacu7CVJxnWlFPTpg9iTpA0qF1ZUyMGXUTHwem7jz6Ahb12ihSgbOhIU12DB+Gdr+jy/pq54uQ1MxSKDl"
+    "H0KGEooCRTgBbbULzOgWAicejnhAaY3IFK1aCDnowMVHDzdq2aAy3zGIoLJEOXdA3R61g1G7BxNI1nivsXtFwRLubTUS"
+    "oWLDgKtG2v/pW8r76ZFvPhLhyfEfcMXphRi8eRUE53s6k3Jhoi+oQaezLr/ekEK2jPGZt5wV5FRxI3oUZM+9AmBAxGAP"
+    "8Pbhugrbb0JST4SEVHDmd5R2LNuhdlp78M3sGPy1brPDI3NPs6p4b52s5BteNCEAMoCnOJH2EqhKDxFUyCsYVL41kuYu"
+    "n2NN0dRRQ+xKMqaKwyKEiF2QFuvFbLKDpShaJVL3DCyM7ZUIRucRvlJNO+Y6QncmdLSWEkDqdgH6abt5/HqkjOZvjPKu"
+    "lMVQzrxkOwp07wKAU80ECl7SDFZ0S+ixs0mr82AtEaOoCpgELKKtH7HwCijKsUPExl24nGd3eJbZAjymFckH77vpuKlV"
+    "gGdjteTVG7j/LjsjZSe8v8WAWFRjSXtfSq29QjAkBmB50bOj3HMA5t4dWTYzSPIQAiusB4qqsIDcSu9p4+D6wIGBN2Dn"
+    "lq60XWwwvaogF8rtgJ8zfP7nbZ7Vd04aADuoenc241ZWd3fMOtqQ0HCOnmpYnA44G9IPZ0GZBoBJufMG2J3dzgqJsc7x"
+    "G33FBc2ZzGUVxrW+lc2yCNhIA0tokzEfGCnrJqrcQLQa5T95C1D8sWIMXkdgvm3nwTfb/jfE7SEsFQtuW2FpbFbGZvtE"
+    "4GFcR0M3+cxm7l1uVU6KfBCdnCpNi0w0XdbVM0QllydfTEp6jR7IbMA2KFqpXi9YkpObARAeOuh9VIq7x2EKNofkVDYc"
+    "iARS6X0bdrlzoRHyVl3lkFrYG9FEGuZeNWg5+50x/krPWO4lGDAUyHNUY+2d2fqCZJerFjhDe0sOiBreUwWAXy1AqMju"
+    "bCh5R0bdHa2ISiwnIiHq9BbtOCvdNf0sm7DZQBAubH8FUIDzWsLvoS7Q7lBOlOx/lLf6C+wYMtGSyzIEYG6xKVVdBjlb"
+    "+bRuPwuI+5Cd0eJ4FLS3FAjE++nwDTxnljUFvNHhSub2gVXCQu4lTYmGoLSZIpn87aRfD27R5gCsKodpYDeeyxZ3E/nG"
+    "55RkeEWNtLr0f1rtsG+n7s+YhHV6nopUuXQcKzILrOxsGEAjI66/BZzUHY2Q7SivLeNNdjjtgTB/JbKclkDhiaVVIaS+"
+    "rtl4LxZZAajc8kFFeFZRHnoSS3PFKM0PrHHVBoihFPV/p08iz7N9P8OoL+wmXR/rfOE1n+mSX/WygvXZQIbmAzCI8gzI"
+    "ZzaR8rp2jLlxmuYJIkBmt2OeVwaC1lxaPin2Xk7jrq6k+xgcKcieiYEdpyMZ6QLsFda8X6i+ssbcNjzu3lLHiqCr71OF"
+    "MlaTmly/JqG7lkhHJ23HTJGTCOMdYMotvfReVMcmgxDZ78MhnyUQkEr3OcAnl+9rZfeyUpDBif5jIno5x0hHWRWLeLLs"
+    "EHp4wnIgALNqYQY11ndwdRWaTbb6R2DBt+QjkcfiilM+L0TCBITUoR8J9dkHACftrFjWDH1WtUVfbLvdPnh1Cey1a7Kv"
+    "G0gyXZ0HDUADJupJ3kWqStJDePuFOkndH4B97C+aPKq6hbgnO0Kmw4YDj8O+LllQTow0in9wBw9gDvBBiFnXYJppICcs"
+    "OPHYe61hcWB/xHiWEVUCn21YrqbrqjpnNdsShbXDEPJs3Wh4V+FRRqAbORm3ALi9U50+asDCpZwb1twCld4msXWuOWvh"
+    "pvLQtCSnEY9BLhigalpVnZgBFEAKm6xsVXE4sXwxGdXThqiG1UtTblUBHPuPTOb74qTHLgyRjCqO+UmSYczDsGFPQr5V"
+    "o5jY6K2NB4gWpRo5eeRGovWXsIK32I0nTYRFEIoSp74MowMW0Pl8KFk/OGbHiW8uVRSs8roJshLn83sg5V239Jd/L4Nx"
+    "V7s+72u+9Qtk33yEKY0qpxXQuuYphkzOx7zN4w6gWixiJx7ZTZc6SCHxAyRBal2XXc0h4pD7HOBDR1XMjey4OECyfkPl"
+    "fq5LUhIC80xUJ/KjZle5yfedCW29NegJu7mHhKBod5oehltIhIA5/RllZti55iE2Qzmw9nG3gfhO+CNgjLVJT5voUesR"
+    "AEXlYGZT8p7JgbBSvCLkEphnMdRLELaoec+uF2unAWbaxlYtN4UXANHL+e2wCD1+PZGZNvzy9pL6ThyLbb2//go1YcdC"
+    "LZ7sPtIMQgWj3UIHTaZ5bQlQTCk9EIif3BVuECJUkW1G1VK4/9fM3jYA8LK2cJfwmV9QPU+8FXPgLbMD4XjJedBv2XIx"
+    "vRrmeab0YsyanWaHaVfqZmkkTO5b8mokN79qQzNVA6ARgETeipfWeJPFHY0OC6pV7XqAinPOeSOXR9yhuCODVrHHOok4"
+    "hQ7SSRNKPAyYesNPTuw0iQYSI6PzYuZ8N1ZX/f2+mfwVJAu7KVRG7/N9Iyf/P9xubrqHbXVg76jpgB+v/S3UlqzhLiNb"
+    "1DIOriTnwAMWQm4PRLR6LgC+5p0ijX/oMsgO8P5vsixvHdtywPMsL3vV+bYeYCAsh6g3aF5+qQvvY18c9xnpqi2zzZnp"
+    "x3q4niGXZK97Rcaf3Tokky7bk34ndBJuBaq368ah6IbBFRsLcXRaqB3pIyAKXhla1wCdgUzwbUbHSZsHY7q6GZQpdiXE"
+    "67HsybtaZJFN1Zloc9Vt9ufsNj/MZqfmim5cXfqwNM+yA9jvoyQPIju4vLURYgNACqH7Gl71+WkyZ6V5mox7TfoILD+M"
+    "YtYyFng4HoRoRAR2SaYT11lX0PdHZeQw2F1c5nG22yxsnR+BtwEiNvxIKynvpLjpdBxy9mJNIiCTCW9co0qaA3sy9C4A"
+    "PBVoT6um8/riVB2uG/sq311u2e2VchvcuoS4THloZTlA5GgUuvjtiG/Ya04XYRzbXNFLSIP8vHJfN/Oxm/K+5QCqyYG7"
+    "EpLqPxfPVslJApg7yQoIdXJmYSPbqZjvuge+ydkbr3IJEcJ7F76sh5umvy7zh4q8O85f3OzOu8MmXF11N1t9UPa27oqq"
+    "t13lJl3Mqh3zukVzLACJtaXwkoW4+kZ8cbEX+7PlXyrFkhWDlNSkUiC09FaMyuhR2/aV/kY013Y+VtfDwMR1Kf6IZJBq"
+    "JNlbMYymDkDHoujjaVIfhuZdM72ftz88vH77/be3b378QL/5+v7j6/v3m8N9NwFwqRysvHZjgQjk7tSXefkj0wPllfBB"
+    "XSuY1qyEmMeW5Hel0OCpEOiJh9quSAHLspkjhEBLh6U5zP397ezozVx8XUzj9szTN2M4LH2hbgpzPcbpy03FLtr2NM/L"
+    "l/Cfm83569d3b96/f3//5dcff/HD97+8f/r7/9c//vX3v/zpf/z49psv/uAfP10+/PIXf/SwvPv4Bz++WR6+ebpv6vuL"
+    "t/O+OmzYYHaHm5o50h8flnq7eZgb+7e87Bkt2tpXnjVzFxp3aP8/8p//9m9rSf+W1KyJzX8BdiL/U8Pr//v//U//uf0v"
+    "qqii+H/+Jv+bv3G0bBZg6/MWYBvLSmKxlUUJWqf+HkjE1AF2tERG7WPFPZW802WARWsp1g1RHnMI3AHuADfZIZQXElmn"
+    "HiHHDcRpIQD9OXiRAPn3RGVAeq6ikRLPaxrsP6iAIZGTLTs7TBw4ik+dDCpp2GJwMhTdedC1Gr5/C3/adqlkrURhXylV"
+    "ZzVFkzagUxA4ROVzXNFOGGojHq0qTLDYjA68z7TRK1LjZX2G7hjAuSGGwMPk/A4gOycd0G7sqLLyWSWECWJWX3VGM4rT"
+    "4hY3RDXMlE7QSxkBTosBpq/SOFk0V7pYFX6BdMMCxOIm3EBFFwVGk/30W4hfLgnkWzQDQQeAnIsr6jxKVtAke+LEs1SF"
+    "YM8qyXhXsiciyTNQg9WXhHumgamSmCyQgOEG0cBy1kWOJTWADIFSoUMDiqTzHU39IuiiHjKUac8YemkobH2H2JvB7RMy"
+    "YJnp2qIiUlSI6c/Y4Yl9HQJrpFlOmYP/KB0c0+gETnFbt6Q2h1GzGgKFTSFVCwfP0+4p/BUQC81QmV2ziIYO8IjwjFnA"
+    "Vh5UK9AhdSWuosnsRRaPAUrG6jytsEoM7tO4alXLFcDotSnRDJ2SGmZJC1MEFqYPDm08MaYoI2bi6HTFHbYx8txiR2TD"
+    "sXAOkM5SSGsLKpIDA1cs6SJr7CXLU0pMHb90FqmxFXfhCLYtnXdYK6iTX2+SksAqCZyQOkoYYNysCzqZkeCeRh1NtvPY"
+    "cAc0ygoKqLeDL1ZMUVkXtMQOXkOTAnmyw+B4Co/2PNhLKFYJ1kiflcIBIHPadzAvvHoW7cF2u4bkAIJ04EolmVmdIC3B"
+    "jUGC6uzSwL21SV4C+4PQkR6iWaSoooDLGH+VTArlMH2woDz1bqGABGpJj+kiIVmTAPCk7YDlykgXgKdhQ1Eo4L6oU4JZ"
+    "5dJpPk06JJF4tJlopPLcZjCIvhY8wAAEMhsNEwfWIHbMrQ5GSaqcHpIuOuuYX69PV+VaStCtZG2rFNgTpsJqXIJGtKIk"
+    "KAhPsaLKi2ftniTC7YDkUt5mwDvh6xqeWGArYWkqC5MO5mSu8mTymlRpMWo08MAzhYHUqcvzWbMCAgjWXIi0JlLhAFoL"
+    "KhRx5t7gIAF6xpfBZ2wcRpUTknqUtEODrOBhuXmcG4L61FHbJPc04ckn+Z9V3ySDOAK5h9uIAS6F1yTeAQwaIgVPnQUQ"
+    "OeALY1rUSf8DF1deYBs5LC0esBnL1NjpJqiF99MWR+URrWFAlRn2DCfJDAjfAWA9/9S7SpIdGHHAxNDJNCmjs1WWX7IU"
+    "QzV6mKRO7zQr1u7W1d/C0xKnfg6TWSRvK47bSYCK4b+X2uQ29i6ZoazVZhzPXeyEBoo1+eS9RpOSuCSB1qVZy6JTgyWB"
+    "MJ+qM2nyasS+M57mLc2SRAvrrJQObdT82v3LkgUGrJyIMip4TAlXAvKO6+25/RW9bApYEvxTAy1+P+6GAsAG5CRRXT91"
+    "7MGwOx+fe0+TPWVq2i09/j/NShx77FlMNfBJdwm9+TDswzBUFSGmRJV4jorywXE0DeIOTQS81IR8uj7D9gOSJUsgXPsW"
+    "D6ddD3/LjMFtUpz6z7Z52I0g4XtTdhG9Iz4TCt2C0ghBOkGpfhTkgZsPDmcsZGHWwZ+ACGAzN7w6XyDVaJOHDllNl9Gi"
+    "CzOmf5bKh8zSJ9GBJ3wzIsOXio9cRkG0p+cY92EJMbu2XAKESM3NctXUqDEx0CwYIIu0PjC+xW5YGBu9xfZLWB3wdl5E"
+    "yrFLHgZSZdimyPiLLPuwSXnwEst00AbWY4RGOxujCn7iwJ/RsKdm1uEv4DE5KerkLyCS4wMAWpYXnNSR+dRDbXFW08pg"
+    "Cb5T5rlXO7XKw4RH+RyzSmUnVSusEYZ7KbBSQFZou4MN3xk8iNO8QU2MmNSA0AiBNtpYQVe3LM7yVXoMxqLPKzKVdOgx"
+    "ouAcHUnjJsdMfFbhwGTDkvKUWJ3Q6YsV3fgsS39M/e3Woa6TwvxVUOzphqiQdk3h0WFWAeBTGH4VJnVY2zqpwaOXNWMN"
+    "cS2jzytWkQw7ZSH8A4zC66vksoT/T8rn7llxXq4qdDAQTfKtAZADscBBisApBgkPvYOwcBgASU6fxYrwfm2qKbPApyXG"
+    "AofDmJU8ozVBuwarqmyE6aogMcCCpqvWQuq7Xx931QFLPnTP16cwx2zNPAo1Wdy7h6jGgT5KmXSfiIfFpMkqZ4UmGhgF"
+    "AOUbGBYho7CNgDgsYDpj4NBALksUFnCZQu917Pd3BVpqJIkXk4SzEP9/0ubFSCtYRACHLfn4TasthQqpvx6LJbVGywa0"
+    "L0vgGbugYci4ZXJySnoJATTAKoQohE4R2CcC49bb5BrAjPWom2WxUFljppZrLsOYn9YR8A+YHpDcSZ+omkaTW0EvFviz"
+    "AxCAmmkFX90hCtSYgnH1gIEcRMbWMvJDNkeSog+KhQBuR09rpSaNQgAIuO+CMMh1UCUgFQWtU1AlWzTM6SL5aiWZO5dO"
+    "K7CbOWswktFewRTiPUBsNDFeuExyFQiivVglXm4xr1jgkHIVnYJPA4HHAyChee1lfi/gDwAqUaYFe9GfhRMUVuGKCpWh"
+    "wiraIPmzblmDyVyk+yxQ7slgryEaGt/TESafk0A2YUVJrbAbnPQy4P5STIpQGIrgs/JVIIXkW8cbwPEQjwOeRJnklrL2"
+    "Z0PUQ0KKczs8ywUi+vIiMdVMkjrpXEjsA4tYRSlW9XqAtV6oXAOEDJ7TsoVHRluitMeFEQ7uDIhRtkEPk95VIaN5myPp"
+    "SlFcsXUeUD4gC3CYfACX4uF+ktCKMAoZg3XJV5cXPMSBF8dwGxsS3IAIUqHRHAAujCczFhUVJRqoSRS4wzUGENNBtH2Q"
+    "rL5aBsiVO7geYGjEcCa5RWDDtbEkDgXMIHbI8dFgoqFEh4DEIkyrM1w9+RpZ8DQN8qdCTQd87d7gKjlh8OwhpSrM4Mms"
+    "D8gCtp/j+/ncx7/nZKg/qlfz5OjygZJxAH5S0sqXBf+9vikH7H/IgoyoPjDkWfS+Zy1ne0gGfaVKf82NzXL0lHoL+CYU"
+    "C0zj2ojIaqfzCfDZBMFHhx5ifVt8tJjTAfruR4dEYPCsIl1WR9UNeYTAWmM1jEBjIav5r2AxBlZul+WEgV9vZV0hgiiY"
+    "1tVMPsSALoTyBjdKZ0VukFt0C6fLnWB5NcHr34dihJe55GTOtZoU6bC/wA2jHJWPEN6sgxgPLFWjI6wnyMxy+O1kghcM"
+    "E2vjoy3PH4wtMlko7XRP7zpV6nPRjnD9CibWgT7C++2/YDa0Wsa66X1NTvUcYXBuL+owuZZKz0eYFkLQI6zGRZ3VBeor"
+    "QIjLAwAnH9EgHZafZRBiuckKVuIwwMQCSFpqNp13hhfU8GxyTxtyT3zJy3zY/FFjyn3tac3rDesaUuY2929yYi8dhMYs"
+    "f7ykYmvlTnvToKFYzotZmhGtnzR65gk0TcJlBtgJ5Q8Bl4yQSTKICDXwsA7ojjx4If1Qf8e7HtbvEVIXPISJZOsn9d9C"
+    "zlDI9h6NZWFPYJzmAIvkcApGF4JXyhRDwKo2IEGxVjlTe457DnaKCvIh3EHLsbkAfSJLGnboZgi4b86bDkYLsNVrehBR"
+    "w/v9JWnpJbxaigqNposkq/qxaKhsAAiJ14y39sivHpue1MeybXnWwYXMJvG59t4rvWWikGqGpOH7aOVi5QOkVEx6KAjF"
+    "cCDKBoNCDwnLIFGqK0W/NyInesA+wfABpg+WqhkF3Jn/w2zi1QYpc9jsdMinaLfjx464rPs9euh63LrwLa8ArQNtLyZ4"
+    "dsDgSxWrurXBMnoYdC3aPNFo3PELNJmiM4/ppmROQL4gQRdwN36Oi48f9kOdZx4mXR8i/Rdkb++UpmdtJBdu2gL0WjoK"
+    "F2zpPVt203YsmRmYnvRc2ODFKYNrxf2/jJoBVPBjtng3aoy2aNjDsPVtTMwWwrFf2FJc1aWA2BmiADg0HEKbqQagrDjv"
+    "WEM37St2qA8tOxxGc2ypveRYGVL6ilk9UTd4/3pTlvczMxWN5xWJPhaQb8++IlcAY1uSw/oiGoIAS+pUDFK/t/DoyBAh"
+    "QxdyuJ/0pM50H8mGE+C3PMN2XL8t7IbNc3/4QWd8Q48z00ufzZBrJGmDVqMt4aGqtr82+7bLSH1XdxXZ7mlHVKW2vVqa"
+    "cqcgMSECHufkDgPwI5lX5cZUwluaI4LQl3tqLjSp2YGzMzEb7IseSpVfV8j17NfW7CDZfJmRXGy/EsMkeC8jJOCCkNi8"
+    "Ajb35ZZEoSAqaPXYLaoon0SjK2C+51G2pM6ImkLKnZAk6hpgac8cYPuBehlzLovz6Qc1Jp8u9sCoA8K6LIM7vpbqLYFZ"
+    "qNhIfQX4or7JvyedI5tDMZc6jPDOwlZD6LKIZX3raZvH2BL5schQmUxm1TjMfSViIS5S96dMykDCKimOgIOlJRWAIF7/"
+    "8aCoORQAkd6wnLSwss/ru2lUl85eoRXoEMpJ0DCymIAuE2exqCgr/PWteed81WUZ7ltaIPXZJSfLKyAjsA7boR8Wvqfu"
+    "sblO4qAKAjrgNuf67g5RchiyrM4yZcZNaMuS+4t3IeSztltWzwfqXWXqhgAg7vmHBY9D1PUkxOUS9jCFtoCFv5TkDaIv"
+    "03iY4SOTymAhxxkQzF6Yy4zTGeZy0bFNur50ABMB0EFo9EDQCjQq5mUB7LEgTrCaLUQeO1hQUdBCvjEbzyA4VYH25Ly1"
+    "VuRwfQBcpDjnDtBuBTOB3Y+9LjsLi4ZNnva6CpAiLIqftDdustPvE1ET0qwqwVRF3Dbd+xECzjToaoSohJbFIqMLi6/I"
+    "QfWcWhSGAPLTq1B3pK/pfSvyIDOdL6LZjHm5bEQp6N6yjWBfoVGoyQmrBIw0zOlJyYJu6tuFT2czFz9QCLJ18eKZDDFY"
+    "hACEsHs4wCcAqCOzqtDbk8qv1MaJH4LVHQCoUJkBIFTBp82PmbaRQ2zv7HlXA4BW5LJnW8hklJ0C4Di3AeIHc1x16oGY"
+    "5cRYkQP6u4YwqYZh1t3ly/XRXbZCIb3wseFuKXCLRvcilC22x40mlt/RYp6I6QZa7lM/GnmovoKUaO6MV30W0bTasdjl"
+    "Rd+HqyMjixMjbVtINJZsuks+zBtSTZdsmYxtmqwve1OdPV+fCZfRzTeA0YAm9bsHS+fejjed2VDrIGIEWMREL3RXL0OZ"
+    "AWdSKCd2HcbdO+AeXa+2SrZ6q7nfXbvtNN+aAt7txVtWzdk7ugCbuCT6cCgu5h9qQg/NNLe1Vhc35tP1ARvmfxg3eMTp"
+    "ryPnl9LKRn7Z9DAHWRXVdc2VnnbTpiB6C0EHYvNvfsndTujM0nja3jakOI1lXpd8MxREqbEUX7yivSws9swM394cAZ7m"
+    "pKn5YMhWygKle1+MkIAOQHoY/VIZyOnRD2X3UJ4p8R4WBpcQgbfMv+6GshoQfZUAXMyp/ZPbEngHTHcTxNJQgHLVDS0a"
+    "vammmZ9r3M2FiTQ0YcNkvLjMUR0YVufCFe7I0/ORyv2LsHMSUbJ0aOIb7oD+tOV70fcXUWeBdNdhfhj9D8C0nIh7MpyK"
+    "5rzshrYWvogwWSzMhk5PhqKii4d5M7/rTdRVeTb5jW02R1mNj5DZFT8DEr+t8hpYQiivW/30yV4ct/TKOtjse2sB/gHg"
+    "FMUhL8ki+WuAGZWkrYu1OFN0A2+mLd2mb0+0XDI1R4+ST/7oSW2B3i6jvQDSTz0AjOinfuJXubyTy6536uvQQtAxW6/1"
+    "Yy9s5X/W+ccmXOdDVsr5rWV7FwBmK9NkLSts3NbHmpUNpW/k+FFe7OkXVF0ZX7khjFtxPWcHGu73rAPwgjKiRvHFDVYA"
+    "vJ6JFdtLWNy8/qoS9a5vd6T9w+bUfQyKtxVZ/dhWzzfgrRC1hYMcOw1haHufBQUcds7KqS3tZMX+Jr8T1TlXHyv+YP2N"
+    "OV6oP630Y4QpkBXjTHb7ccyK5Wv23vcV7dlJCwvRC2KB55tOdVX3qMzUc/MKLhibw3r9JFSMm6soQS5ihKzVz2F6Y8yV"
+    "q17XyzbHjYboRPmhKbq+N0PG5oPdCHtB458M8mlSN2W3j3wR8HribvPxbMfOqrCwbwex3Yp58me8+7p56orFkWrumOck"
+    "kNAkciiS3wDuAMqVrKNyW1Hmvhf9VN127F3NT15ehVfvu/KyJBFCrjmqD0e91GUdx6pGDS53bTMWWqZHLYch2wz2rFSb"
+    "EmAfz7TMBwDzGq1MxZbavu54lU2v2O/aDHf6sf83bSukDSQglgmRG0zLRrq5qcZJLrP8aR5et/N1VtxxeiWyPZkHcub7"
+    "JxGfuN/KrpwfnD+3pNkYt/wiL9tN4+eHspTb2l7vi/xqieLillb3m8Lezm31p9Pvf7zQLSB1KSZA5DKglppomfJ4FIXN"
+    "47jLjjtbHCIJCm22jhVANNhctudFtZD9rJ+m4nejfc/qN2S5yT6M8ndL9otyflOf7c3NTG+G+Yt+/4U+beJpvPxq2L8N"
+    "h827x/n063l79s8+N//93Offn/v8/3PXP3zu+o/PXf/yuet/Pnf90+eu//rs9W+fu/7vc9c/fu76z89d//q5638/d/3z"
+    "567//uz175+//v/z9j987v6Pz93/8pn7fz53/9Nn7//63P1vn7n/73P3P37u/s/P3f/6uT82l7cfTF75FmX/IzNjLIhu"
+    "IEmqO33jrsr72/1PJ/9PxFzKqn89S9+i+mcPGacdVBmKbdsOxUBG1sKcq3qSFy7A8gIQCAlB1LwtIKnkIq8lVhHAeAdW"
+    "US09sDAVnSJFlRWNaHKY64HX/fgYXDuKgVzUrnnV1d3D2zhXBzXfPbSX2TAv1QhUe6q6D3Pvz24OXb69b8azKt9cneXt"
+    "tlmGot1dd0VbHMZtvVlye7ffxHJ/CIfNrpnrsT/b5cDV827e1bt6Q1y0AIyCUDpqTR38RUOc1rPLtC+MqrOehrrVJuTC"
+    "Kt9JwCFWcaDcXOWZMTyrlbaVQ9lWX/Q2r0LVwPuviyLLqqauy6ryXV3VtugDhl1TlXWLX+7ypmgg69oAs77RFgB4wQpf"
+    "yAgR1X8nM5rpirVSyRxF3CsfdGFqiF4xelkYY5EtS62sMNJK9OzTaAaANlYCTxKxUlFwoXmymRMWzzkhL2OS5dirzzRa"
+    "02DdoHBYs2wZfBWrTqWwTnfEYwEdVv4EhsWcEsYmcGFoYTiswExkOocbAOJiZRABUpWy8I82BpKAVminZWCCY9WUQnEE"
+    "dBtCeTEtUG0Khns1AyIKcD/TWDHFucYtEMIKWpBGRjwDpQIVfgNNzjJY1eNXH0ss9LDAHSzgI+2cAYLnlQtaBwVPEkjh"
+    "jDEAmXPUyfboSsU9NQ5NLxyW32YK63KpwuNvgL4Ca8FkGRUkYIs1egbLpKWDdW3hZyxWrMtU/YcGVOhil8zY+OqquVq6"
+    "EYO1YBBRnaBAkdGCA1UO4daE0QaFYRl8JqJcrMlY0CojQSYjEGlViscuFawkcwLFIUij1RqLaDbkgZSo1b1IYdU6blYC"
+    "UkErQvbJV+7ZZTPdD01FZDy5hjx7UCmKFVRYHUNWyx50kEvGe3BLWGgG90YBdUkUwwSUQeHyEhII5BKYC/DjOTrjMIdb"
+    "VRZPzVnatZSpejp5C/FUSLxW85H099UjZbUhTX/kq5lmsi7BP6rVmE4mMxcsBHNYT4cFoPD68MpYEW4l/A93ahW8O4ay"
+    "0hJVwxncLAycwfI1ydZiP441jMn/Dy+VRoS9/DGV+rHVCpWy1VxyNYxBf45kq2U4i0wk30sU7qZJHRteO88QJeMZoYIM"
+    "yjQNBFsXOQ6nwmpT9BgR6Z2wVBmWLP7QjEykrWX+s88tT2ZcaEbKXgxoYR7DekUJ+mDxfWPhpQBO6IXEbTk04AEo4fGG"
+    "ZbIFgdkK6RrWJEGfTYslVPBjcF94mk1T5ZzCW03eI/hmZJqoq8gqzhom03Z/GgaUEUbvzgynnmNT8jXCKnoWUqH+WvbL"
+    "pHixSU7FiR6FU7FoBbizhslCDHrCKI6mkA5uGKIL7qpLvGV4O6iOQtJbSr6ZqDqHgIt/8inCZYdXxbI1nWrk0JWJZCzJ"
+    "AwJC0zg9XryqscQZCxdtMnRSmPrhZyF+UYw2cEmDVeiI7JNljsEwJ3HIkxdIMiZlq1/Vzw7M6B8FX88lHRXq0wRBgMwA"
+    "K0MvVTyEF/Znv9K0a5rOLOSLsa/B3+6QTePZoEVCjTEXq7eTJS7GFBwwLF9G25hkiyt/9mnCIkiejNYWwM9YZCpy1EPF"
+    "aluYMhp3h1I7AH8xNuJpAr9YOady9fRKKN6pY5CcrEADKZ26RyB8aFTxtMi/sXhRsGev43UlCIIproHVBSDZWTQNgmeO"
+    "OEN86sSBH2drGfhqnfvsScs/GbKyFzdPktpYiNAYInB14l+VShOBYUkj2m+ilRl9MVlOhqUU65Ig5DmsYWZFAQvBJD18"
+    "maqScRak2kn57Cn9fK31Xfy2MS/7dKaFZc2OotcmNqQQrGdXq3MS1gpqLO9cr69TZOBh5H1Pauxp0bhhjYK8BQUOhC5y"
+    "WLXNsJgeD5/XvqRk8ryamj3fwrqbnFQdX9ydU6eAQxmmtf6YrUcqEDX0OnSogrzOAx2547TFOgHMQFyaSsMXCwCNnKa1"
+    "hqFCk9VN7Hn3hr84qj0/+2pE9l/bqWPowVfoMDqJ1CTyMmTiedSwc4wCWbpx/EbxZFhXcmtznME5tv1QaTgWjSffUpHa"
+    "hPizrXFyoKLsk8M0/m54PPnitstWZ+fkHibWDX+iXpx8yfMxIA4ryuvU4oaRCZNjR+DKMkYsGHbo84v9eRawo0lOuynZ"
+    "4O9a3e1WU8SXJZoi0t+xksf/ofg7rvSk8PpbTtZUP/ehYN02Fs53uliqRngIrfDyArw9B0lYOKdgKJKj4dqkhGEs1aFK"
+    "NLCiz2ZkaYby5/5e9umYeb0iFwlBwIBZ8sn/3aXljFZSuBapCLSZ2MVNGeoaDdcwBGMTHpD9CEgUyC6qI6Hh0loQrHCG"
+    "Y9dC6ljhqyXci1/yagSNU4+vy5OsC4g9VwCwNSfjYW+KtyR1YEBu1bcQR4x7aG1VpHANo2Ok44HQQovCoiMO5nd89NQN"
+    "AuGPY6BfbbP5s0Hk6v+XwsjPduYw/FY+L5HVjc7gxYEfBIgEuM0MuFdyoFdhT9FatG0MoE0UTKxoE1iN7Q/YAyCEF9gB"
+    "kEqVsYdGsp+Ng9fDdXTJenkNNM2BtcWOpz6yl+trks46Jas1gMEIIDfDAmDA3zmzqanGWVS7wq40ikqnpVODMhOsUI3m"
+    "CSLywstgcBcpHSw7QQoErfiQgr1EB0yquKbgH7vOevZpzSQxdrRojDKvVJ+7Mdaz70vjlKwYHyStIuk72iw2exXMZHkO"
+    "6wTeiKiVaISY0AOGMMeBL9y5cqd6xSqY3IBF3UTCXIb8yplbnZXYlVBYtV7/xX19XYUrXoN4wVUd7HVtWWtsYY5R33m1"
+    "88D+WZ6wiv//27efFQKiKIDD15hpxtQY3PyLIllQ7HgBDyDv/zSIRNlZmMX3rU6n212fza9KR7HejYvzJGxGaYxF3i2z"
+    "shwk+apon6pwXKazQ9YfdvK0ak3zzrxXxe062V+S/uJ2EtetPwsAAAAAAAAAAAAAAAAAAMCL/hcAAAAAAAAAAAAAAAAA"
+    "AJpD/wsAAAAAAAAAAAAAAAAAAM2h/wUAAAAAAAAAAAAAAAAAgOb4ud/9vnz8HN7ehGfs+1zeh6D/BQAAAAAAAAAAAAAA"
+    "AACAD1e54GH9",
+    NULL};
@@ -0,0 +1,175 @@
+/**************************************************************************************************
+Ring buffer memory that is mapped twice back-to-back, see MirrorBuf.h
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include "MirrorBuf.h"
+
+#ifndef _WIN32
+#  include <atomic>
+#  include <fcntl.h>
+#  include <stdio.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------------------------
+MirrorMem::MirrorMem()
+{
+  _ptr = NULL;
+  _n_bytes = 0;
+#ifdef _WIN32
+  _map_handle = NULL;
+#endif
+}
+
+#ifdef _WIN32
+
+enum {
+  // the address space for both copies is found first & then mapped into, another thread can grab
+  // the space in between so try a few times
+  MAP_TRIES = 8
+};
+
+//-------------------------------------------------------------------------------------------------
+/*static*/ size_t MirrorMem::granularity()
+{
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  return si.dwAllocationGranularity;
+}
+
+//-------------------------------------------------------------------------------------------------
+void MirrorMem::resize(size_t n_bytes)
+{
+  if (_ptr) {
+    UnmapViewOfFile((char*)_ptr + _n_bytes);
+    UnmapViewOfFile(_ptr);
+    _ptr = NULL;
+  }
+  if (_map_handle) {
+    CloseHandle(_map_handle);
+    _map_handle = NULL;
+  }
+  _n_bytes = 0;
+  if (!n_bytes)
+    return;
+
+  size_t g = granularity();
+  n_bytes = (n_bytes + g - 1) / g * g;
+
+  _map_handle = CreateFileMappingA(INVALID_HANDLE_VALUE,
+                                   NULL,
+                                   PAGE_READWRITE,
+                                   (DWORD)((unsigned long long)n_bytes >> 32),
+                                   (DWORD)n_bytes,
+                                   NULL);
+  if (!_map_handle)
+    throw 0;
+
+  for (int i = 0; i < MAP_TRIES; i++) {
+    // find space for both copies
+    char* addr = (char*)VirtualAlloc(NULL, n_bytes * 2, MEM_RESERVE, PAGE_NOACCESS);
+    if (!addr)
+      break;
+    VirtualFree(addr, 0, MEM_RELEASE);
+
+    void* a = MapViewOfFileEx(_map_handle, FILE_MAP_ALL_ACCESS, 0, 0, n_bytes, addr);
+    void* b = a ? MapViewOfFileEx(_map_handle, FILE_MAP_ALL_ACCESS, 0, 0, n_bytes, addr + n_bytes)
+                : NULL;
+    if (a && b) {
+      _ptr = addr;
+      _n_bytes = n_bytes;
+      return;
+    }
+    if (a)
+      UnmapViewOfFile(a);
+  }
+
+  CloseHandle(_map_handle);
+  _map_handle = NULL;
+  throw 0;
+}
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+/*static*/ size_t MirrorMem::granularity()
+{
+  return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+//-------------------------------------------------------------------------------------------------
+static int /*-1=failure*/ CreateMirrorFile(size_t n_bytes)
+// anonymous file of "n_bytes" to map
+{
+#  if defined(__linux__)
+  int fd = memfd_create("dtblkfx_mirror", MFD_CLOEXEC);
+#  else
+  // no memfd, use a shared memory object that is unlinked straight away
+  static std::atomic<int> g_count(0);
+  char name[64];
+  snprintf(name, sizeof(name), "/dtblkfx_mirror_%d_%d", (int)getpid(), (int)g_count++);
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd >= 0)
+    shm_unlink(name);
+#  endif
+  if (fd >= 0 && ftruncate(fd, (off_t)n_bytes) != 0) {
+    close(fd);
+    fd = -1;
+  }
+  return fd;
+}
+
+//-------------------------------------------------------------------------------------------------
+void MirrorMem::resize(size_t n_bytes)
+{
+  if (_ptr) {
+    munmap(_ptr, _n_bytes * 2);
+    _ptr = NULL;
+  }
+  _n_bytes = 0;
+  if (!n_bytes)
+    return;
+
+  size_t g = granularity();
+  n_bytes = (n_bytes + g - 1) / g * g;
+
+  int fd = CreateMirrorFile(n_bytes);
+  if (fd < 0)
+    throw 0;
+
+  // reserve space for both copies & map the file over each half (MAP_FIXED replaces the
+  // reservation so nothing else can get in between)
+  char* addr = (char*)mmap(NULL, n_bytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  bool ok = addr != MAP_FAILED;
+  for (int i = 0; ok && i < 2; i++)
+    ok = mmap(addr + i * n_bytes,
+              n_bytes,
+              PROT_READ | PROT_WRITE,
+              MAP_SHARED | MAP_FIXED,
+              fd,
+              0) != MAP_FAILED;
+
+  // the mappings keep the file alive
+  close(fd);
+
+  if (!ok) {
+    if (addr != MAP_FAILED)
+      munmap(addr, n_bytes * 2);
+    throw 0;
+  }
+  _ptr = addr;
+  _n_bytes = n_bytes;
+}
+
+#endif
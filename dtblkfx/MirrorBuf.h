@@ -0,0 +1,77 @@
+#ifndef _DT_MIRROR_BUF_H_
+#define _DT_MIRROR_BUF_H_
+/**************************************************************************************************
+Ring buffer memory that is mapped twice back-to-back
+
+The same physical pages appear at ptr[0..size) and again at ptr[size..2*size), so any run of up to
+"size" elements starting anywhere in the first copy is contiguous: data written past the end shows
+up at the start & reading past the end gives the start without any copying.
+
+The size is rounded up to the virtual memory mapping granularity (page size, or 64k on windows)
+so it's only worth using for large buffers.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include <stddef.h>
+
+//-------------------------------------------------------------------------------------------------
+class MirrorMem
+//
+// the mapping (bytes)
+//
+{
+public:
+  MirrorMem();
+  ~MirrorMem() { resize(0); }
+
+  // map at least "n_bytes" twice (rounded up to granularity()) or 0 to unmap, original data is
+  // destroyed, throw error if failure
+  void resize(size_t n_bytes);
+
+  // bytes in one copy of the mapping
+  size_t size() const { return _n_bytes; }
+
+  // start of the first copy (NULL if nothing mapped)
+  void* ptr() const { return _ptr; }
+
+  // mapping sizes are a multiple of this
+  static size_t granularity();
+
+protected:
+  void* _ptr;
+  size_t _n_bytes;
+#ifdef _WIN32
+  void* _map_handle;
+#endif
+
+  // can't copy or assign
+  MirrorMem(const MirrorMem&) {}
+  void operator=(const MirrorMem&) {}
+};
+
+//-------------------------------------------------------------------------------------------------
+template <class T>
+struct MirrorBuf
+    : public MirrorMem
+//
+// typed access to MirrorMem
+//
+{
+  // at least "n_elements" (rounded up), throw error if failure
+  void resize(long n_elements) { MirrorMem::resize(n_elements * sizeof(T)); }
+
+  // number of elements in one copy
+  long size() const { return (long)(MirrorMem::size() / sizeof(T)); }
+
+  operator T*() const { return (T*)_ptr; }
+};
+
+#endif
@@ -66,6 +66,9 @@ public:
     return *this;
   }
 
+  // memory used by the anchor data
+  size_t memBytes() const { return anchor_data.size() * sizeof(float); }
+
   void setModeFixed() { mode = MODE_FIXED; }
   void setModeLin(int vst_param_idx_)
   {
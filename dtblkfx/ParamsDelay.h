@@ -13,14 +13,28 @@ This is completely free software
 Notes,
 was previously a template based on number of params but this made is clumsy
 when moving functions outside because they would all need to be templated
+
+The records are a ring (structure of arrays) that starts small & doubles when it gets close to
+full, so dense automation isn't lost. setParameter can be on the audio thread so it never
+allocates, the ring is grown by DtBlkFx from suspend/resume/setBlockSize (see growIfNearlyFull).
+The output position is found by binary search & nearly straight runs of closely spaced updates
+are merged (see ParamsDelay::coalesce).
 ******************************************************************************/
 
 #ifndef _DT_PARAMS_DELAY_H_
 #define _DT_PARAMS_DELAY_H_
 
 #include "misc_stuff.h"
+#include <algorithm>
 #include <vector>
 
+// usual thing that VstParamIdx's are constructed from (declared first, ints have no associated
+// namespace for the lookup in VstParamIdx)
+inline int toVstParamIdx(int i)
+{
+  return i;
+}
+
 //-------------------------------------------------------------------------------------------------
 struct VstParamIdx
     : public BuiltinWrapper<int>
@@ -30,17 +44,27 @@ struct VstParamIdx
   template <class T> VstParamIdx(const T& t) { val = toVstParamIdx(t); }
 };
 
-// usual thing that VstParamIdx's are constructed from
-inline int toVstParamIdx(int i)
-{
-  return i;
-}
-
 //-------------------------------------------------------------------------------------------------
 class ParamsDelay {
 protected:
-  // delay length
+  enum {
+    // most records kept, when full the oldest record still in use is dropped
+    MAX_LENGTH = 1 << 14,
+
+    // host updates closer than this (samples) that lie on a straight line with the previous
+    // record are merged into the most recent record (see put)
+    COALESCE_DIST = 32
+  };
+
+  // how far (0..1 param units) a merged record can be from the line
+  static constexpr float COALESCE_TOL = 1.0f / 16384.0f;
+
+  // delay length (power of 2, grows up to MAX_LENGTH, see growIfNearlyFull)
   int _length;
+  int _mask;
+
+  // most records in use since the last growIfNearlyFull
+  int _max_used;
 
   // number of params
   int _n_params;
@@ -48,7 +72,8 @@ protected:
   // current input position
   int _in;
 
-  // current output position (we interpolate between these)
+  // current output position (we interpolate between these), records before _out_a aren't used
+  // again so the records in use are _out_a.._in
   int _out_a, _out_b;
 
   // expected distance between samp_abs_new in Params (normally matches a fraction of the
@@ -61,78 +86,90 @@ protected:
   float _interp_frac;
 
   // increment index "i", wrapping to 0 if need be
-  void incIndex(int& i)
-  {
-    if (++i >= _length)
-      i = 0;
-  }
+  void incIndex(int& i) const { i = (i + 1) & _mask; }
 
-  // memory for array of param record, records have the following structure
+  // number of records from _out_a to "i"
+  int outAge(int i) const { return (i - _out_a) & _mask; }
+
+  // records are stored as a structure of arrays, record "i" is
   //
-  // struct Record
-  // {
-  //     long samp_abs; // absolute sample position
-  //     float vals[_n_params];
-  //     bool any_explicit_set;
-  //     bool explicit_set[_n_params];
-  // };
-  std::vector<char> _data;
-
-  // std::vector<long> _samp_abs;
-  // std::vector<float> _vals;
+  //   _samp_abs[i]                    absolute sample position (increases from _out_a to _in)
+  //   _vals[p * _length + i]          value of param "p"
+  //   _any_explicit_set[i]            true if any param was set by the host at this position
+  //   _explicit_set[p * _length + i]  true if param "p" was set by the host at this position
+  std::vector<long> _samp_abs;
+  std::vector<float> _vals;
+  std::vector<char> _any_explicit_set;
+  std::vector<char> _explicit_set;
 
   // params can be overridden
   std::vector<bool> _use_override_param;
   std::vector<float> _override_param;
 
-  // offset of each field in each data record
-  int _field_byte_offs[2], _record_len_bytes;
-
 protected:
-  // access a record from _data (which is just an array of bytes) & cast
-  template <class T> T* data(int i, int byte_offs) const
+  // access various things in a record
+  long samp_abs(int row) const { return _samp_abs[row]; }
+  float& val(int row, int param_idx) { return _vals[param_idx * _length + row]; }
+  float val(int row, int param_idx) const { return _vals[param_idx * _length + row]; }
+  char& explicit_set(int row, int param_idx) { return _explicit_set[param_idx * _length + row]; }
+  bool explicit_set(int row, int param_idx) const
   {
-    return (T*)(begin(_data) + i * _record_len_bytes + byte_offs);
+    return _explicit_set[param_idx * _length + row] != 0;
   }
 
-  // access various things in _data, do all this stuff our selves so that we create
-  // contiguous records of any size
-  long& samp_abs(int row) const { return *data<long>(row, 0); }
-  float* vals(int row) const { return data<float>(row, sizeof(long)); }
-  bool& any_explicit_set(int row) const { return *data<bool>(row, _field_byte_offs[0]); }
-  bool* explicit_set(int row) const { return data<bool>(row, _field_byte_offs[1]); }
-
   // get param "param_idx" value from "row" using override if need be
   float /*0..1: ok*/ getVal(int row, int param_idx, bool allow_override = true) const
   {
     return _use_override_param[param_idx] && !allow_override ? _override_param[param_idx]
-                                                             : vals(row)[param_idx];
+                                                             : val(row, param_idx);
+  }
+
+  // size the records for "length" (power of 2), keeping the records in use (now from 0)
+  void resize(int length)
+  {
+    int n = _samp_abs.empty() ? 0 : outAge(_in) + 1;
+    std::vector<long> samp_abs_new(length, 0);
+    std::vector<float> vals_new(_n_params * length, 0.0f);
+    std::vector<char> any_explicit_set_new(length, 0);
+    std::vector<char> explicit_set_new(_n_params * length, 0);
+
+    for (int i = 0; i < n; i++) {
+      int row = (_out_a + i) & _mask;
+      samp_abs_new[i] = _samp_abs[row];
+      any_explicit_set_new[i] = _any_explicit_set[row];
+      for (int p = 0; p < _n_params; p++) {
+        vals_new[p * length + i] = val(row, p);
+        explicit_set_new[p * length + i] = explicit_set(row, p);
+      }
+    }
+    _samp_abs.swap(samp_abs_new);
+    _vals.swap(vals_new);
+    _any_explicit_set.swap(any_explicit_set_new);
+    _explicit_set.swap(explicit_set_new);
+
+    int out_b_age = n ? outAge(_out_b) : 0;
+    _length = length;
+    _mask = length - 1;
+    _out_a = 0;
+    _out_b = out_b_age;
+    _in = n ? n - 1 : 0;
   }
 
 public:
   bool isParamIdxOk(int idx) { return idx >= 0 && idx < _n_params; }
 
-  // must call init before use!
+  // must call init before use! "length" is the initial number of records
   void init(int n_params, int length)
   {
-
-    _length = length;
     _n_params = n_params;
 
-    // find offsets for data in our array
-    _field_byte_offs[0] =
-        sizeof(long) +
-        sizeof(float) * _n_params; // any_explicit_set array: skip samp_abs_new field & vals array
-    _field_byte_offs[1] =
-        _field_byte_offs[0] + sizeof(bool); // explicit_set array: skip any_explicit_set
-    _record_len_bytes =
-        _field_byte_offs[1] + sizeof(bool) * _n_params; // total length: skip explicit_set
-
-    // allocate required memory
-    _data.resize(_record_len_bytes * _length);
-
-    // clr first record
-    memset(&begin(_data), 0, _record_len_bytes);
+    // allocate required memory (first record is cleared)
+    int pow2 = 2;
+    while (pow2 < length && pow2 < MAX_LENGTH)
+      pow2 *= 2;
+    _samp_abs.clear();
+    resize(pow2);
+    _max_used = 1;
 
     // by default no values are forced
     _override_param.resize(n_params, 0.0f);
@@ -148,6 +185,26 @@ public:
 
   void setExpectedDist(int n) { _expected_dist = n; }
 
+  // grow (keeping the records) if more than 3/4 of the records have been in use since the last
+  // call, not on the audio thread (this allocates)
+  void growIfNearlyFull()
+  {
+    int length = _length;
+    while (_max_used * 4 > length * 3 && length < MAX_LENGTH)
+      length *= 2;
+    if (length != _length)
+      resize(length);
+    _max_used = outAge(_in) + 1;
+  }
+
+  // memory used by the records & overrides
+  size_t memBytes() const
+  {
+    return _samp_abs.capacity() * sizeof(long) + _vals.capacity() * sizeof(float) +
+           _any_explicit_set.capacity() + _explicit_set.capacity() +
+           _use_override_param.capacity() / 8 + _override_param.capacity() * sizeof(float);
+  }
+
   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 public: // parameter override (use for param preview)
   void setOverride(VstParamIdx idx, bool state) { _use_override_param[idx] = state; }
@@ -176,6 +233,13 @@ public:
     return lin_interp(_interp_frac, getPrev(idx), getNext(idx));
   }
 
+  // getInterp of every param into "dst" (_n_params long)
+  void getInterpAll(float* dst) const
+  {
+    for (int i = 0; i < _n_params; i++)
+      dst[i] = lin_interp(_interp_frac, val(_out_a, i), val(_out_b, i));
+  }
+
   // get the absolute sample position for the current param or next out param
   long getOutSampAbs(bool next_param = false) const
   {
@@ -188,13 +252,13 @@ public:
   // return true if "getNonInterp()" corresponds to an explicitly set parameter
   bool isExplicitlySet(VstParamIdx idx, bool next_param = false) const
   {
-    return explicit_set(next_param ? _out_b : _out_a)[idx];
+    return explicit_set(next_param ? _out_b : _out_a, idx);
   }
 
   // return true if any param is explicitly set
   long isAnyExplicitSet(bool next_param = false) const
   {
-    return any_explicit_set(next_param ? _out_b : _out_a);
+    return _any_explicit_set[next_param ? _out_b : _out_a];
   }
 
   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -202,12 +266,14 @@ public:
   // reset the params vector and copy the most recent params but reset abs time to 0
   {
     // copy current input params to time 0
-    memcpy(data<char>(/*idx*/ 0, /*byte offs*/ 0),
-           data<char>(/*idx*/ _in, /*byte offs*/ 0),
-           _record_len_bytes);
+    for (int p = 0; p < _n_params; p++) {
+      val(0, p) = val(_in, p);
+      explicit_set(0, p) = explicit_set(_in, p);
+    }
+    _any_explicit_set[0] = _any_explicit_set[_in];
 
     // reset sample abs time
-    samp_abs(0) = 0;
+    _samp_abs[0] = 0;
 
     init_();
   }
@@ -240,6 +306,8 @@ public:
     long samp_diff = samp_abs_new - samp_abs(_in);
     if (samp_diff <= 0)
       already_exists = true;
+    else if (coalesce(samp_abs_new, idx, value))
+      return false;
     else {
       // make a new Params entry if the time is different
 
@@ -247,15 +315,15 @@ public:
       // parameter distance
       if (samp_diff > _expected_dist) {
         cpInNode();
-        any_explicit_set(_in) = false;
-        samp_abs(_in) = samp_abs_new - _expected_dist;
+        _any_explicit_set[_in] = false;
+        _samp_abs[_in] = samp_abs_new - _expected_dist;
       }
       cpInNode();
-      any_explicit_set(_in) = true;
-      samp_abs(_in) = samp_abs_new;
+      _any_explicit_set[_in] = true;
+      _samp_abs[_in] = samp_abs_new;
     }
-    vals(_in)[idx] = value;
-    explicit_set(_in)[idx] = true;
+    val(_in, idx) = value;
+    explicit_set(_in, idx) = true;
     return already_exists;
   }
 
@@ -266,59 +334,104 @@ public:
   // Note, only move forward (don't try to go backwards)
   //
   {
-    // look for params
-    while (1) {
-
-      if (samp_abs(_out_b) > samp_abs_new) {
-        // find distance from requested sample to _out_a position
-        long numer = samp_abs_new - samp_abs(_out_a);
-
-        // can't go in reverse, samp_abs_new lies before "_out_a"
-        if (numer < 0) {
-          _interp_frac = 0.0f;
-          return false;
-        }
-        // can interpolate ok
-
-        // don't do fraction calculation unless needed
-        if (!find_fraction)
-          return true;
-
-        // distance between params
-        float denom = (float)(samp_abs(_out_b) - samp_abs(_out_a));
-
-        // denominator should never be <=0, but just in case
-        if (denom <= 0.0f) {
-          _interp_frac = 0.0f;
-          return true;
-        }
-
-        _interp_frac = (float)numer / denom;
-        return true;
-      }
+    // binary search _out_b.._in for the first record at or after "samp_abs_new" (the positions
+    // increase from _out_a so search by age)
+    int lo = outAge(_out_b);
+    int hi = outAge(_in) + 1;
+    while (lo < hi) {
+      int mid = (lo + hi) >> 1;
+      if (samp_abs((_out_a + mid) & _mask) < samp_abs_new)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
 
-      // is it an exact match?
-      if (samp_abs(_out_b) == samp_abs_new) {
-        _out_a = _out_b;
-        if (_out_b != _in)
-          incIndex(_out_b);
-        _interp_frac = 0.0f;
-        return true;
-      }
+    // have we hit the end? Put both out ptrs at the end
+    if (lo > outAge(_in)) {
+      _out_a = _out_b = _in;
+      _interp_frac = 0.0f;
+      return false;
+    }
 
-      // have we hit the end? Put both out ptrs at the end
-      if (_out_b == _in) {
-        _out_a = _out_b;
-        _interp_frac = 0.0f;
-        return false;
-      }
+    int found = (_out_a + lo) & _mask;
 
-      _out_a = _out_b;
-      incIndex(_out_b);
+    // is it an exact match?
+    if (samp_abs(found) == samp_abs_new) {
+      _out_a = _out_b = found;
+      if (_out_b != _in)
+        incIndex(_out_b);
+      _interp_frac = 0.0f;
+      return true;
     }
+
+    // samp_abs_new lies between the previous record & "found"
+    if (found != _out_b) {
+      _out_b = found;
+      _out_a = (found - 1) & _mask;
+    }
+
+    // find distance from requested sample to _out_a position
+    long numer = samp_abs_new - samp_abs(_out_a);
+
+    // can't go in reverse, samp_abs_new lies before "_out_a"
+    if (numer < 0) {
+      _interp_frac = 0.0f;
+      return false;
+    }
+    // can interpolate ok
+
+    // don't do fraction calculation unless needed
+    if (!find_fraction)
+      return true;
+
+    // distance between params
+    float denom = (float)(samp_abs(_out_b) - samp_abs(_out_a));
+
+    // denominator should never be <=0, but just in case
+    if (denom <= 0.0f) {
+      _interp_frac = 0.0f;
+      return true;
+    }
+
+    _interp_frac = (float)numer / denom;
+    return true;
   }
 
 protected:
+  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  bool /*true=merged*/ coalesce(long samp_abs_new, int idx, float value)
+  //
+  // dense automation (e.g. a curve sent every sample) makes a record for each update, if the
+  // most recent record only has "idx" set & lies on the line from the record before it to the
+  // new update then move it to the new update instead
+  //
+  // merged records span at most COALESCE_DIST so param sync sees (nearly) the same positions
+  //
+  {
+    // the output has to be behind the most recent record (it's about to be moved)
+    if (_in == _out_a || _in == _out_b)
+      return false;
+    int prev = (_in - 1) & _mask;
+    long span = samp_abs_new - samp_abs(prev);
+    if (span > COALESCE_DIST || span > _expected_dist || !explicit_set(_in, idx))
+      return false;
+
+    float v0 = val(prev, idx);
+    float on_line = v0 + (value - v0) * (float)(samp_abs(_in) - samp_abs(prev)) / (float)span;
+    if (fabsf(on_line - val(_in, idx)) > COALESCE_TOL)
+      return false;
+
+    // anything else set by the host at the most recent record has to stay where it is
+    for (int p = 0; p < _n_params; p++) {
+      if (p != idx && explicit_set(_in, p))
+        return false;
+    }
+
+    _samp_abs[_in] = samp_abs_new;
+    val(_in, idx) = value;
+    return true;
+  }
+
   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   void cpInNode()
   //
@@ -328,22 +441,24 @@ protected:
     int next = _in;
     incIndex(next);
 
-    // copy previous _in to new _in
-    memcpy(vals(next), vals(_in), sizeof(float) * _n_params);
-
-    // clear explicit sets
-    memset(explicit_set(next), 0, sizeof(bool) * _n_params);
-
-    // check whether we've filled the buffer & need to bump the pointers
+    // when full bump the output pointers (the oldest record still in use is dropped), the ring is
+    // grown later by growIfNearlyFull
     if (next == _out_a) {
       _interp_frac = 0.0f;
       incIndex(_out_a);
+      if (next == _out_b)
+        incIndex(_out_b);
+    }
+
+    // copy previous _in to new _in & clear explicit sets
+    for (int p = 0; p < _n_params; p++) {
+      val(next, p) = val(_in, p);
+      explicit_set(next, p) = false;
     }
-    if (next == _out_b)
-      incIndex(_out_b);
 
     // done
     _in = next;
+    _max_used = std::max(_max_used, outAge(_in) + 1);
   }
 
   // internal init
@@ -9,9 +9,7 @@ using namespace std;
 
 //-------------------------------------------------------------------------------------------------
 void PixelFreqBin::init(Rng<float> pixel_to_hz, // Hz for each pixel (and number of pixels)
-                        float sample_freq,      //
-                        cplxf* fft_dat          // output from FFT to build pointers to
-)
+                        float sample_freq)
 {
   float n_pixels = (float)pixel_to_hz.n;
   float octave_per_pix = BlkFxParam::octaveSpan() / n_pixels;
@@ -27,12 +25,13 @@ void PixelFreqBin::init(Rng<float> pixel_to_hz, // Hz for each pixel (and number
 
     int fft_len = g_fft_sz[i];
     int max_bin = fft_len / 2; // max bin is 1/2 fft len
+    int decim = SpecSnap::decimation(fft_len);
 
     // find scaling to turn pixel_to_hz[x-0.5] into fft bin position
     float hz_to_bin = half_pix * (float)fft_len / sample_freq;
 
     // first range starts at bin 0
-    map[i][0] = fft_dat;
+    map[i][0] = 0;
     int prev_bin = 0;
     int x;
     // find the start bin for each pixel
@@ -40,10 +39,10 @@ void PixelFreqBin::init(Rng<float> pixel_to_hz, // Hz for each pixel (and number
       int bin = limit_range(
           RndToInt(pixel_to_hz[x] * hz_to_bin), prev_bin, max_bin // gaurantee increasing
       );
-      map[i][x] = fft_dat + bin;
+      map[i][x] = bin / decim;
       prev_bin = bin;
     }
     // end of final pixel range
-    map[i][x] = fft_dat + max_bin + 1;
+    map[i][x] = SpecSnap::numBins(fft_len);
   }
 }
@@ -1,25 +1,26 @@
 #ifndef _FREQ_PIXEL_MAP_H_
 #define _FREQ_PIXEL_MAP_H_
+#include "SpecSnap.h"
 #include "rfftw_float.h"
 
 struct PixelFreqBin
 //
-// build fft bin to pixel mapping for each fft blk sz that we support for a fixed cplxf array
+// build power spectrum bin to pixel mapping for each fft blk sz that we support (bins are those
+// of a SpecSnap, i.e. decimated for large ffts)
 //
 {
-  struct BinRngMap : public std::valarray<cplxf*> {
+  struct BinRngMap : public std::valarray<int> {
   }; // do this to stop MSVC debug complaining
   // map for each
   BinRngMap map[NUM_FFT_SZ];
 
-  // return cplx ranges to map to pixels (note: don't use const version of [] since "&"
-  // will return the address of result on the stack)
-  cplxf** getMap(int fft_idx) { return begin(map[fft_idx]); }
+  // return bin ranges to map to pixels, pixel "x" is the max of bins [map[x], map[x+1]) (and
+  // always at least bin map[x]) (note: don't use const version of [] since "&" will return the
+  // address of result on the stack)
+  const int* getMap(int fft_idx) { return begin(map[fft_idx]); }
 
   void init(Rng<float> pixel_to_hz, // Hz for each pixel
-            float sample_freq,
-            cplxf* fft_dat // output from FFT to build pointers to
-  );
+            float sample_freq);
 };
 
-#endif
\ No newline at end of file
+#endif
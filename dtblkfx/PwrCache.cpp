@@ -0,0 +1,154 @@
+/**************************************************************************************************
+Power (norm) of each bin of one channel's spectrum, see PwrCache.h
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <string.h>
+
+#include "PwrCache.h"
+#include "SpecKernels.h"
+
+//-------------------------------------------------------------------------------------------------
+PwrCache::PwrCache()
+{
+  _x = NULL;
+  _n_bins = 0;
+  _n_chunks = 0;
+  _pwr = NULL;
+  _cum[0] = 0.0;
+  _cum_n = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void PwrCache::setBuf(float* pwr)
+{
+  _pwr = pwr;
+  reset(NULL, 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+void PwrCache::reset(const cplxf* x, long n_bins)
+{
+  _x = x;
+  _n_bins = n_bins;
+  _n_chunks = (n_bins + CHUNK_N - 1) >> CHUNK_SHIFT;
+  dirtyAll();
+}
+
+//-------------------------------------------------------------------------------------------------
+void PwrCache::dirty(long b0, long b1)
+{
+  if (b0 < 0)
+    b0 = 0;
+  if (b1 >= _n_bins)
+    b1 = _n_bins - 1;
+  if (b0 > b1)
+    return;
+
+  // any chunk with a written bin must be worked out again, & the totals from there on
+  long c0 = b0 >> CHUNK_SHIFT;
+  memset(_valid + c0, 0, ((b1 >> CHUNK_SHIFT) - c0 + 1) * sizeof(bool));
+  if (_cum_n > c0)
+    _cum_n = c0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void PwrCache::dirtyAll()
+{
+  memset(_valid, 0, _n_chunks * sizeof(bool));
+  _cum_n = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void PwrCache::fill(long c0, long c1)
+{
+  if (c1 >= _n_chunks)
+    c1 = _n_chunks - 1;
+
+  // consecutive invalid chunks are done in one go
+  long c = c0;
+  while (c <= c1) {
+    if (_valid[c]) {
+      c++;
+      continue;
+    }
+    long e = c;
+    while (e <= c1 && !_valid[e])
+      _valid[e++] = true;
+
+    long b0 = c << CHUNK_SHIFT;
+    long b1 = e << CHUNK_SHIFT;
+    if (b1 > _n_bins)
+      b1 = _n_bins;
+    g_spec_kernels->normTo(_x + b0, b1 - b0, _pwr + b0);
+    c = e;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+const float* PwrCache::get(long b0, long b1)
+{
+  if (b0 <= b1)
+    fill(b0 >> CHUNK_SHIFT, b1 >> CHUNK_SHIFT);
+  return _pwr;
+}
+
+//-------------------------------------------------------------------------------------------------
+void PwrCache::minMax(long b0, long b1, float* min_pwr, float* max_pwr)
+{
+  if (b0 > b1)
+    return;
+  fill(b0 >> CHUNK_SHIFT, b1 >> CHUNK_SHIFT);
+  g_spec_kernels->minMax(_pwr + b0, b1 - b0 + 1, min_pwr, max_pwr);
+}
+
+//-------------------------------------------------------------------------------------------------
+double PwrCache::cumTo(long c)
+{
+  // extend the totals up to chunk "c"
+  if (_cum_n < c) {
+    fill(_cum_n, c - 1);
+    for (long i = _cum_n; i < c; i++)
+      _cum[i + 1] = _cum[i] + g_spec_kernels->sum(_pwr + (i << CHUNK_SHIFT), CHUNK_N);
+    _cum_n = c;
+  }
+  return _cum[c];
+}
+
+//-------------------------------------------------------------------------------------------------
+double PwrCache::bandPwr(long b0, long b1)
+{
+  if (b0 < 0)
+    b0 = 0;
+  if (b1 >= _n_bins)
+    b1 = _n_bins - 1;
+  if (b0 > b1)
+    return 0.0;
+
+  // narrow bands are quicker to sum directly
+  if (b1 - b0 < CHUNK_N * 2) {
+    fill(b0 >> CHUNK_SHIFT, b1 >> CHUNK_SHIFT);
+    return g_spec_kernels->sum(_pwr + b0, b1 - b0 + 1);
+  }
+
+  // whole chunks from the totals, the part chunks at either end are summed (rather than taken off
+  // a chunk total) so a quiet band next to a loud one keeps its precision
+  long c0 = (b0 + CHUNK_N - 1) >> CHUNK_SHIFT;
+  long c1 = (b1 + 1) >> CHUNK_SHIFT;
+  long e0 = c0 << CHUNK_SHIFT, e1 = c1 << CHUNK_SHIFT;
+  fill(b0 >> CHUNK_SHIFT, b1 >> CHUNK_SHIFT);
+  double pwr = cumTo(c1) - cumTo(c0);
+  if (pwr < 0.0)
+    pwr = 0.0;
+  pwr += g_spec_kernels->sum(_pwr + b0, e0 - b0);
+  return pwr + g_spec_kernels->sum(_pwr + e1, b1 + 1 - e1);
+}
@@ -0,0 +1,91 @@
+#ifndef _DT_PWR_CACHE_H_
+#define _DT_PWR_CACHE_H_
+/**************************************************************************************************
+Power (norm) of each bin of one channel's spectrum, shared by the effect slots of an fft-blk
+
+Most effects look at the power of the bins before they change them (threshold masks, clipping,
+power matching) & a lot of slots only read. The cache works the power out a chunk of bins at a time
+the first time it is read & keeps it until those bins are written. Anything that writes the
+spectrum must say which bins it wrote (dirty) or drop the lot (dirtyAll), see the mask drivers in
+FxRun1_0.cpp & DtBlkFx::procFFT.
+
+The cached values are exactly norm() of each bin so min/max & threshold searches give the same
+results as working from the data.
+
+Band power comes from a running total (double so that differences of large totals keep their
+precision) of the power before each chunk, plus sums over the part chunks at either end. The
+totals are good up to the first chunk that has been written, so effects that work up the spectrum
+only extend them as they go.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include "cplxf.h"
+#include "rfftw_float.h"
+
+//-------------------------------------------------------------------------------------------------
+class PwrCache
+//
+// one channel, the buffer is owned by the caller (it's carved out of DtBlkFx::_arena)
+//
+{
+public:
+  enum {
+    CHUNK_SHIFT = 6,
+    CHUNK_N = 1 << CHUNK_SHIFT, // bins worked out at a time
+    MAX_BINS = MAX_FFT_SZ / 2 + 1,
+    MAX_CHUNKS = (MAX_BINS + CHUNK_N - 1) / CHUNK_N
+  };
+
+  PwrCache();
+
+  // use "pwr" (MAX_BINS floats) for the cached values, nothing is cached
+  void setBuf(float* pwr);
+
+  // start of an fft-blk, "x" is the spectrum of "n_bins" bins, nothing is cached
+  void reset(const cplxf* x, long n_bins);
+
+  // bins b0..b1 (inclusive) have been written
+  void dirty(long b0, long b1);
+
+  // any bins may have been written
+  void dirtyAll();
+
+  // power of bins b0..b1 (inclusive), index the return by bin (only b0..b1 are guaranteed to be
+  // up to date)
+  const float* get(long b0, long b1);
+
+  // lower "min_pwr" & raise "max_pwr" to take in the power of bins b0..b1 (inclusive)
+  void minMax(long b0, long b1, float* min_pwr, float* max_pwr);
+
+  // total power of bins b0..b1 (inclusive, clipped to the spectrum), 0 if b1 < b0
+  double bandPwr(long b0, long b1);
+
+protected:
+  const cplxf* _x; // spectrum
+  long _n_bins;
+  long _n_chunks;
+  float* _pwr;
+
+  // true if the chunk of _pwr is up to date
+  bool _valid[MAX_CHUNKS];
+
+  // _cum[c] is the power of all bins before chunk c, for c <= _cum_n
+  double _cum[MAX_CHUNKS + 1];
+  long _cum_n;
+
+  // work out the power of chunks c0..c1 (inclusive) that aren't valid
+  void fill(long c0, long c1);
+
+  // power of all bins before chunk "c"
+  double cumTo(long c);
+};
+
+#endif
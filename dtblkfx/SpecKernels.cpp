@@ -0,0 +1,843 @@
+/**************************************************************************************************
+Vectorized kernels for the passes over the spectrum, see SpecKernels.h
+
+The vector versions process as many whole vectors as they can & hand the remainder to the scalar
+version. Power is the sum of the squares of all floats (re & im), min/max & clipping need the norm
+of each complex value in both of its lanes which is done by adding the squares to a copy with re &
+im swapped (so the sums over those lanes are halved at the end). normTo separates the squares of
+re & im before adding them so each bin gets exactly the value norm() gives.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include "SpecKernels.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#  define SPEC_KERNELS_X86
+#  include <immintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+// msvc allows any intrinsics in any function
+#    define SPEC_TARGET(t)
+#  else
+#    include <cpuid.h>
+#    define SPEC_TARGET(t) __attribute__((target(t)))
+#  endif
+#endif
+
+#ifdef _MSC_VER
+#  define SPEC_NOINLINE __declspec(noinline)
+#else
+#  define SPEC_NOINLINE __attribute__((noinline))
+#endif
+
+//*************************************************************************************************
+// scalar versions (also do the remainder for the vector versions)
+
+//-------------------------------------------------------------------------------------------------
+static float PwrScalar(const cplxf* x, long n)
+{
+  float acc = 0.0f;
+  for (long i = 0; i < n; i++)
+    acc += norm(x[i]);
+  return acc;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void ScaleScalar(cplxf* x, long n, float s)
+{
+  for (long i = 0; i < n; i++)
+    x[i] = x[i] * s;
+}
+
+//-------------------------------------------------------------------------------------------------
+static float ScalePwrScalar(cplxf* x, long n, float s)
+{
+  float acc = 0.0f;
+  for (long i = 0; i < n; i++) {
+    x[i] = x[i] * s;
+    acc += norm(x[i]);
+  }
+  return acc;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void MinMaxPwrScalar(const cplxf* x, long n, float* min_pwr, float* max_pwr)
+{
+  for (long i = 0; i < n; i++) {
+    float t = norm(x[i]);
+    if (t < *min_pwr)
+      *min_pwr = t;
+    if (t > *max_pwr)
+      *max_pwr = t;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+static void ClipPwrScalar(cplxf* x, long n, float thresh, float* in_pwr, float* out_pwr)
+{
+  float sqrt_thresh = sqrtf(thresh);
+  float in_acc = 0.0f;
+  float out_acc = 0.0f;
+  for (long i = 0; i < n; i++) {
+    float t = norm(x[i]);
+    in_acc += t;
+    if (t >= thresh) {
+      x[i] = x[i] * (sqrt_thresh / sqrtf(t));
+      out_acc += thresh;
+    }
+    else
+      out_acc += t;
+  }
+  *in_pwr = in_acc;
+  *out_pwr = out_acc;
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_NOINLINE static void NormToScalar(const cplxf* x, long n, float* pwr)
+// not inlined into the fma versions' remainder where the compiler could fuse the multiply & add
+{
+  for (long i = 0; i < n; i++)
+    pwr[i] = norm(x[i]);
+}
+
+//-------------------------------------------------------------------------------------------------
+static void MinMaxScalar(const float* x, long n, float* min_v, float* max_v)
+{
+  for (long i = 0; i < n; i++) {
+    if (x[i] < *min_v)
+      *min_v = x[i];
+    if (x[i] > *max_v)
+      *max_v = x[i];
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+static float SumScalar(const float* x, long n)
+{
+  float acc = 0.0f;
+  for (long i = 0; i < n; i++)
+    acc += x[i];
+  return acc;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void ScaleBinsScalar(cplxf* x, long n, const float* g)
+{
+  for (long i = 0; i < n; i++)
+    x[i] = x[i] * g[i];
+}
+
+static const SpecKernels g_scalar_kernels = {"scalar",
+                                             PwrScalar,
+                                             ScaleScalar,
+                                             ScalePwrScalar,
+                                             MinMaxPwrScalar,
+                                             ClipPwrScalar,
+                                             NormToScalar,
+                                             MinMaxScalar,
+                                             SumScalar,
+                                             ScaleBinsScalar};
+
+#ifdef SPEC_KERNELS_X86
+
+//*************************************************************************************************
+// SSE2: 2 complex values per vector
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static inline float HSumSse2(__m128 v)
+{
+  __m128 t = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static inline __m128 NormSse2(__m128 v)
+// norm of each complex value in both of its lanes
+{
+  __m128 sq = _mm_mul_ps(v, v);
+  return _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static float PwrSse2(const cplxf* x, long n)
+{
+  const float* p = x->data;
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 a = _mm_loadu_ps(p + i * 2);
+    __m128 b = _mm_loadu_ps(p + i * 2 + 4);
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(a, a));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(b, b));
+  }
+  return HSumSse2(_mm_add_ps(acc0, acc1)) + PwrScalar(x + i, n - i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static void ScaleSse2(cplxf* x, long n, float s)
+{
+  float* p = x->data;
+  __m128 vs = _mm_set1_ps(s);
+  long i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_ps(p + i * 2, _mm_mul_ps(_mm_loadu_ps(p + i * 2), vs));
+  ScaleScalar(x + i, n - i, s);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static float ScalePwrSse2(cplxf* x, long n, float s)
+{
+  float* p = x->data;
+  __m128 vs = _mm_set1_ps(s);
+  __m128 acc = _mm_setzero_ps();
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128 a = _mm_mul_ps(_mm_loadu_ps(p + i * 2), vs);
+    _mm_storeu_ps(p + i * 2, a);
+    acc = _mm_add_ps(acc, _mm_mul_ps(a, a));
+  }
+  return HSumSse2(acc) + ScalePwrScalar(x + i, n - i, s);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2")
+static void MinMaxPwrSse2(const cplxf* x, long n, float* min_pwr, float* max_pwr)
+{
+  const float* p = x->data;
+  __m128 vmin = _mm_set1_ps(*min_pwr);
+  __m128 vmax = _mm_set1_ps(*max_pwr);
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128 t = NormSse2(_mm_loadu_ps(p + i * 2));
+    vmin = _mm_min_ps(vmin, t);
+    vmax = _mm_max_ps(vmax, t);
+  }
+  vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+  *min_pwr = _mm_cvtss_f32(_mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, 1)));
+  *max_pwr = _mm_cvtss_f32(_mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, 1)));
+  MinMaxPwrScalar(x + i, n - i, min_pwr, max_pwr);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2")
+static void ClipPwrSse2(cplxf* x, long n, float thresh, float* in_pwr, float* out_pwr)
+{
+  float* p = x->data;
+  __m128 vthresh = _mm_set1_ps(thresh);
+  __m128 vsqrt_thresh = _mm_set1_ps(sqrtf(thresh));
+  __m128 one = _mm_set1_ps(1.0f);
+  __m128 in_acc = _mm_setzero_ps();
+  __m128 out_acc = _mm_setzero_ps();
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128 a = _mm_loadu_ps(p + i * 2);
+    __m128 t = NormSse2(a);
+    __m128 clip = _mm_cmpge_ps(t, vthresh);
+    __m128 mul = _mm_div_ps(vsqrt_thresh, _mm_sqrt_ps(t));
+    mul = _mm_or_ps(_mm_and_ps(clip, mul), _mm_andnot_ps(clip, one));
+    _mm_storeu_ps(p + i * 2, _mm_mul_ps(a, mul));
+    in_acc = _mm_add_ps(in_acc, t);
+    out_acc = _mm_add_ps(out_acc, _mm_or_ps(_mm_and_ps(clip, vthresh), _mm_andnot_ps(clip, t)));
+  }
+  ClipPwrScalar(x + i, n - i, thresh, in_pwr, out_pwr);
+  *in_pwr += HSumSse2(in_acc) * 0.5f;
+  *out_pwr += HSumSse2(out_acc) * 0.5f;
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static void NormToSse2(const cplxf* x, long n, float* pwr)
+// squares of 4 complex values, then re^2 + im^2 (the same sum as norm())
+{
+  const float* p = x->data;
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 a = _mm_loadu_ps(p + i * 2);
+    __m128 b = _mm_loadu_ps(p + i * 2 + 4);
+    a = _mm_mul_ps(a, a);
+    b = _mm_mul_ps(b, b);
+    __m128 re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    _mm_storeu_ps(pwr + i, _mm_add_ps(re, im));
+  }
+  NormToScalar(x + i, n - i, pwr + i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static void MinMaxSse2(const float* x, long n, float* min_v, float* max_v)
+{
+  __m128 vmin = _mm_set1_ps(*min_v);
+  __m128 vmax = _mm_set1_ps(*max_v);
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 t = _mm_loadu_ps(x + i);
+    vmin = _mm_min_ps(vmin, t);
+    vmax = _mm_max_ps(vmax, t);
+  }
+  vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+  *min_v = _mm_cvtss_f32(_mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, 1)));
+  *max_v = _mm_cvtss_f32(_mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, 1)));
+  MinMaxScalar(x + i, n - i, min_v, max_v);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static float SumSse2(const float* x, long n)
+{
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    acc0 = _mm_add_ps(acc0, _mm_loadu_ps(x + i));
+    acc1 = _mm_add_ps(acc1, _mm_loadu_ps(x + i + 4));
+  }
+  return HSumSse2(_mm_add_ps(acc0, acc1)) + SumScalar(x + i, n - i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("sse2") static void ScaleBinsSse2(cplxf* x, long n, const float* g)
+{
+  float* p = x->data;
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    // each gain to both lanes of its complex value
+    __m128 vg = _mm_loadu_ps(g + i);
+    __m128 lo = _mm_unpacklo_ps(vg, vg);
+    __m128 hi = _mm_unpackhi_ps(vg, vg);
+    _mm_storeu_ps(p + i * 2, _mm_mul_ps(_mm_loadu_ps(p + i * 2), lo));
+    _mm_storeu_ps(p + i * 2 + 4, _mm_mul_ps(_mm_loadu_ps(p + i * 2 + 4), hi));
+  }
+  ScaleBinsScalar(x + i, n - i, g + i);
+}
+
+static const SpecKernels g_sse2_kernels = {"sse2",
+                                           PwrSse2,
+                                           ScaleSse2,
+                                           ScalePwrSse2,
+                                           MinMaxPwrSse2,
+                                           ClipPwrSse2,
+                                           NormToSse2,
+                                           MinMaxSse2,
+                                           SumSse2,
+                                           ScaleBinsSse2};
+
+//*************************************************************************************************
+// AVX2 (and FMA): 4 complex values per vector
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static inline float HSumAvx2(__m256 v)
+{
+  __m128 t = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  t = _mm_add_ps(t, _mm_movehl_ps(t, t));
+  return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static inline __m256 NormAvx2(__m256 v)
+{
+  __m256 sq = _mm256_mul_ps(v, v);
+  return _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static float PwrAvx2(const cplxf* x, long n)
+{
+  const float* p = x->data;
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 a = _mm256_loadu_ps(p + i * 2);
+    __m256 b = _mm256_loadu_ps(p + i * 2 + 8);
+    acc0 = _mm256_fmadd_ps(a, a, acc0);
+    acc1 = _mm256_fmadd_ps(b, b, acc1);
+  }
+  float r = HSumAvx2(_mm256_add_ps(acc0, acc1));
+  _mm256_zeroupper();
+  return r + PwrScalar(x + i, n - i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static void ScaleAvx2(cplxf* x, long n, float s)
+{
+  float* p = x->data;
+  __m256 vs = _mm256_set1_ps(s);
+  long i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_ps(p + i * 2, _mm256_mul_ps(_mm256_loadu_ps(p + i * 2), vs));
+  _mm256_zeroupper();
+  ScaleScalar(x + i, n - i, s);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static float ScalePwrAvx2(cplxf* x, long n, float s)
+{
+  float* p = x->data;
+  __m256 vs = _mm256_set1_ps(s);
+  __m256 acc = _mm256_setzero_ps();
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256 a = _mm256_mul_ps(_mm256_loadu_ps(p + i * 2), vs);
+    _mm256_storeu_ps(p + i * 2, a);
+    acc = _mm256_fmadd_ps(a, a, acc);
+  }
+  float r = HSumAvx2(acc);
+  _mm256_zeroupper();
+  return r + ScalePwrScalar(x + i, n - i, s);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma")
+static void MinMaxPwrAvx2(const cplxf* x, long n, float* min_pwr, float* max_pwr)
+{
+  const float* p = x->data;
+  __m256 vmin = _mm256_set1_ps(*min_pwr);
+  __m256 vmax = _mm256_set1_ps(*max_pwr);
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256 t = NormAvx2(_mm256_loadu_ps(p + i * 2));
+    vmin = _mm256_min_ps(vmin, t);
+    vmax = _mm256_max_ps(vmax, t);
+  }
+  __m128 mn = _mm_min_ps(_mm256_castps256_ps128(vmin), _mm256_extractf128_ps(vmin, 1));
+  __m128 mx = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+  _mm256_zeroupper();
+  mn = _mm_min_ps(mn, _mm_movehl_ps(mn, mn));
+  mx = _mm_max_ps(mx, _mm_movehl_ps(mx, mx));
+  *min_pwr = _mm_cvtss_f32(_mm_min_ss(mn, _mm_shuffle_ps(mn, mn, 1)));
+  *max_pwr = _mm_cvtss_f32(_mm_max_ss(mx, _mm_shuffle_ps(mx, mx, 1)));
+  MinMaxPwrScalar(x + i, n - i, min_pwr, max_pwr);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma")
+static void ClipPwrAvx2(cplxf* x, long n, float thresh, float* in_pwr, float* out_pwr)
+{
+  float* p = x->data;
+  __m256 vthresh = _mm256_set1_ps(thresh);
+  __m256 vsqrt_thresh = _mm256_set1_ps(sqrtf(thresh));
+  __m256 one = _mm256_set1_ps(1.0f);
+  __m256 in_acc = _mm256_setzero_ps();
+  __m256 out_acc = _mm256_setzero_ps();
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256 a = _mm256_loadu_ps(p + i * 2);
+    __m256 t = NormAvx2(a);
+    __m256 clip = _mm256_cmp_ps(t, vthresh, _CMP_GE_OQ);
+    __m256 mul = _mm256_blendv_ps(one, _mm256_div_ps(vsqrt_thresh, _mm256_sqrt_ps(t)), clip);
+    _mm256_storeu_ps(p + i * 2, _mm256_mul_ps(a, mul));
+    in_acc = _mm256_add_ps(in_acc, t);
+    out_acc = _mm256_add_ps(out_acc, _mm256_blendv_ps(t, vthresh, clip));
+  }
+  float in_sum = HSumAvx2(in_acc) * 0.5f;
+  float out_sum = HSumAvx2(out_acc) * 0.5f;
+  _mm256_zeroupper();
+  ClipPwrScalar(x + i, n - i, thresh, in_pwr, out_pwr);
+  *in_pwr += in_sum;
+  *out_pwr += out_sum;
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static void NormToAvx2(const cplxf* x, long n, float* pwr)
+// no fma so that the sum is rounded the same as norm()
+{
+  const float* p = x->data;
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 a = _mm256_loadu_ps(p + i * 2);
+    __m256 b = _mm256_loadu_ps(p + i * 2 + 8);
+    a = _mm256_mul_ps(a, a);
+    b = _mm256_mul_ps(b, b);
+
+    // shuffles work within each 128 bit half, giving bins 0 1 4 5 2 3 6 7
+    __m256 re = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 im = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256d t = _mm256_castps_pd(_mm256_add_ps(re, im));
+    t = _mm256_permute4x64_pd(t, _MM_SHUFFLE(3, 1, 2, 0));
+    _mm256_storeu_ps(pwr + i, _mm256_castpd_ps(t));
+  }
+  _mm256_zeroupper();
+  NormToScalar(x + i, n - i, pwr + i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static void MinMaxAvx2(const float* x, long n, float* min_v, float* max_v)
+{
+  __m256 vmin = _mm256_set1_ps(*min_v);
+  __m256 vmax = _mm256_set1_ps(*max_v);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 t = _mm256_loadu_ps(x + i);
+    vmin = _mm256_min_ps(vmin, t);
+    vmax = _mm256_max_ps(vmax, t);
+  }
+  __m128 mn = _mm_min_ps(_mm256_castps256_ps128(vmin), _mm256_extractf128_ps(vmin, 1));
+  __m128 mx = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+  _mm256_zeroupper();
+  mn = _mm_min_ps(mn, _mm_movehl_ps(mn, mn));
+  mx = _mm_max_ps(mx, _mm_movehl_ps(mx, mx));
+  *min_v = _mm_cvtss_f32(_mm_min_ss(mn, _mm_shuffle_ps(mn, mn, 1)));
+  *max_v = _mm_cvtss_f32(_mm_max_ss(mx, _mm_shuffle_ps(mx, mx, 1)));
+  MinMaxScalar(x + i, n - i, min_v, max_v);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static float SumAvx2(const float* x, long n)
+{
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(x + i));
+    acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(x + i + 8));
+  }
+  float r = HSumAvx2(_mm256_add_ps(acc0, acc1));
+  _mm256_zeroupper();
+  return r + SumScalar(x + i, n - i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx2,fma") static void ScaleBinsAvx2(cplxf* x, long n, const float* g)
+{
+  float* p = x->data;
+  const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 vg = _mm256_loadu_ps(g + i);
+    __m256 lo = _mm256_permutevar8x32_ps(vg, lo_idx);
+    __m256 hi = _mm256_permutevar8x32_ps(vg, hi_idx);
+    _mm256_storeu_ps(p + i * 2, _mm256_mul_ps(_mm256_loadu_ps(p + i * 2), lo));
+    _mm256_storeu_ps(p + i * 2 + 8, _mm256_mul_ps(_mm256_loadu_ps(p + i * 2 + 8), hi));
+  }
+  _mm256_zeroupper();
+  ScaleBinsScalar(x + i, n - i, g + i);
+}
+
+static const SpecKernels g_avx2_kernels = {"avx2",
+                                           PwrAvx2,
+                                           ScaleAvx2,
+                                           ScalePwrAvx2,
+                                           MinMaxPwrAvx2,
+                                           ClipPwrAvx2,
+                                           NormToAvx2,
+                                           MinMaxAvx2,
+                                           SumAvx2,
+                                           ScaleBinsAvx2};
+
+//*************************************************************************************************
+// AVX-512F: 8 complex values per vector
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static inline __m512 NormAvx512(__m512 v)
+{
+  __m512 sq = _mm512_mul_ps(v, v);
+  return _mm512_add_ps(sq, _mm512_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static float PwrAvx512(const cplxf* x, long n)
+{
+  const float* p = x->data;
+  __m512 acc0 = _mm512_setzero_ps();
+  __m512 acc1 = _mm512_setzero_ps();
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 a = _mm512_loadu_ps(p + i * 2);
+    __m512 b = _mm512_loadu_ps(p + i * 2 + 16);
+    acc0 = _mm512_fmadd_ps(a, a, acc0);
+    acc1 = _mm512_fmadd_ps(b, b, acc1);
+  }
+  float r = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+  _mm256_zeroupper();
+  return r + PwrScalar(x + i, n - i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static void ScaleAvx512(cplxf* x, long n, float s)
+{
+  float* p = x->data;
+  __m512 vs = _mm512_set1_ps(s);
+  long i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_ps(p + i * 2, _mm512_mul_ps(_mm512_loadu_ps(p + i * 2), vs));
+  _mm256_zeroupper();
+  ScaleScalar(x + i, n - i, s);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static float ScalePwrAvx512(cplxf* x, long n, float s)
+{
+  float* p = x->data;
+  __m512 vs = _mm512_set1_ps(s);
+  __m512 acc = _mm512_setzero_ps();
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512 a = _mm512_mul_ps(_mm512_loadu_ps(p + i * 2), vs);
+    _mm512_storeu_ps(p + i * 2, a);
+    acc = _mm512_fmadd_ps(a, a, acc);
+  }
+  float r = _mm512_reduce_add_ps(acc);
+  _mm256_zeroupper();
+  return r + ScalePwrScalar(x + i, n - i, s);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f")
+static void MinMaxPwrAvx512(const cplxf* x, long n, float* min_pwr, float* max_pwr)
+{
+  const float* p = x->data;
+  __m512 vmin = _mm512_set1_ps(*min_pwr);
+  __m512 vmax = _mm512_set1_ps(*max_pwr);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512 t = NormAvx512(_mm512_loadu_ps(p + i * 2));
+    vmin = _mm512_min_ps(vmin, t);
+    vmax = _mm512_max_ps(vmax, t);
+  }
+  *min_pwr = _mm512_reduce_min_ps(vmin);
+  *max_pwr = _mm512_reduce_max_ps(vmax);
+  _mm256_zeroupper();
+  MinMaxPwrScalar(x + i, n - i, min_pwr, max_pwr);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f")
+static void ClipPwrAvx512(cplxf* x, long n, float thresh, float* in_pwr, float* out_pwr)
+{
+  float* p = x->data;
+  __m512 vthresh = _mm512_set1_ps(thresh);
+  __m512 vsqrt_thresh = _mm512_set1_ps(sqrtf(thresh));
+  __m512 one = _mm512_set1_ps(1.0f);
+  __m512 in_acc = _mm512_setzero_ps();
+  __m512 out_acc = _mm512_setzero_ps();
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512 a = _mm512_loadu_ps(p + i * 2);
+    __m512 t = NormAvx512(a);
+    __mmask16 clip = _mm512_cmp_ps_mask(t, vthresh, _CMP_GE_OQ);
+    __m512 mul = _mm512_mask_div_ps(one, clip, vsqrt_thresh, _mm512_sqrt_ps(t));
+    _mm512_storeu_ps(p + i * 2, _mm512_mul_ps(a, mul));
+    in_acc = _mm512_add_ps(in_acc, t);
+    out_acc = _mm512_add_ps(out_acc, _mm512_mask_blend_ps(clip, t, vthresh));
+  }
+  float in_sum = _mm512_reduce_add_ps(in_acc) * 0.5f;
+  float out_sum = _mm512_reduce_add_ps(out_acc) * 0.5f;
+  _mm256_zeroupper();
+  ClipPwrScalar(x + i, n - i, thresh, in_pwr, out_pwr);
+  *in_pwr += in_sum;
+  *out_pwr += out_sum;
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static void NormToAvx512(const cplxf* x, long n, float* pwr)
+{
+  const float* p = x->data;
+  const __m512i re_idx =
+      _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+  const __m512i im_idx =
+      _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 a = _mm512_loadu_ps(p + i * 2);
+    __m512 b = _mm512_loadu_ps(p + i * 2 + 16);
+    a = _mm512_mul_ps(a, a);
+    b = _mm512_mul_ps(b, b);
+    __m512 re = _mm512_permutex2var_ps(a, re_idx, b);
+    __m512 im = _mm512_permutex2var_ps(a, im_idx, b);
+    _mm512_storeu_ps(pwr + i, _mm512_add_ps(re, im));
+  }
+  _mm256_zeroupper();
+  NormToScalar(x + i, n - i, pwr + i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f")
+static void MinMaxAvx512(const float* x, long n, float* min_v, float* max_v)
+{
+  __m512 vmin = _mm512_set1_ps(*min_v);
+  __m512 vmax = _mm512_set1_ps(*max_v);
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 t = _mm512_loadu_ps(x + i);
+    vmin = _mm512_min_ps(vmin, t);
+    vmax = _mm512_max_ps(vmax, t);
+  }
+  *min_v = _mm512_reduce_min_ps(vmin);
+  *max_v = _mm512_reduce_max_ps(vmax);
+  _mm256_zeroupper();
+  MinMaxScalar(x + i, n - i, min_v, max_v);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static float SumAvx512(const float* x, long n)
+{
+  __m512 acc0 = _mm512_setzero_ps();
+  __m512 acc1 = _mm512_setzero_ps();
+  long i = 0;
+  for (; i + 32 <= n; i += 32) {
+    acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(x + i));
+    acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(x + i + 16));
+  }
+  float r = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+  _mm256_zeroupper();
+  return r + SumScalar(x + i, n - i);
+}
+
+//-------------------------------------------------------------------------------------------------
+SPEC_TARGET("avx512f") static void ScaleBinsAvx512(cplxf* x, long n, const float* g)
+{
+  float* p = x->data;
+  const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+  const __m512i hi_idx =
+      _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 vg = _mm512_loadu_ps(g + i);
+    __m512 lo = _mm512_permutexvar_ps(lo_idx, vg);
+    __m512 hi = _mm512_permutexvar_ps(hi_idx, vg);
+    _mm512_storeu_ps(p + i * 2, _mm512_mul_ps(_mm512_loadu_ps(p + i * 2), lo));
+    _mm512_storeu_ps(p + i * 2 + 16, _mm512_mul_ps(_mm512_loadu_ps(p + i * 2 + 16), hi));
+  }
+  _mm256_zeroupper();
+  ScaleBinsScalar(x + i, n - i, g + i);
+}
+
+static const SpecKernels g_avx512_kernels = {"avx512",
+                                             PwrAvx512,
+                                             ScaleAvx512,
+                                             ScalePwrAvx512,
+                                             MinMaxPwrAvx512,
+                                             ClipPwrAvx512,
+                                             NormToAvx512,
+                                             MinMaxAvx512,
+                                             SumAvx512,
+                                             ScaleBinsAvx512};
+
+//*************************************************************************************************
+// cpu detection
+
+//-------------------------------------------------------------------------------------------------
+static void CpuId(unsigned leaf, unsigned sub, unsigned r[4])
+{
+#  ifdef _MSC_VER
+  int t[4];
+  __cpuidex(t, (int)leaf, (int)sub);
+  for (int i = 0; i < 4; i++)
+    r[i] = (unsigned)t[i];
+#  else
+  __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#  endif
+}
+
+//-------------------------------------------------------------------------------------------------
+static unsigned long long XGetBv0()
+// which register states the OS saves (only call if cpuid says OSXSAVE)
+{
+#  ifdef _MSC_VER
+  return _xgetbv(0);
+#  else
+  unsigned lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return ((unsigned long long)hi << 32) | lo;
+#  endif
+}
+
+//-------------------------------------------------------------------------------------------------
+static int /*SpecKernelLevel*/ DetectSpecKernelLevel()
+{
+  unsigned r[4];
+  CpuId(0, 0, r);
+  unsigned max_leaf = r[0];
+
+  CpuId(1, 0, r);
+  bool sse2 = (r[3] & (1u << 26)) != 0;
+  bool fma = (r[2] & (1u << 12)) != 0;
+  bool osxsave = (r[2] & (1u << 27)) != 0;
+  bool avx = (r[2] & (1u << 28)) != 0;
+  if (!sse2)
+    return SPEC_KERNELS_SCALAR;
+
+  // OS must save the ymm (& zmm) registers
+  if (!osxsave || !avx || max_leaf < 7)
+    return SPEC_KERNELS_SSE2;
+  unsigned long long xcr0 = XGetBv0();
+  if ((xcr0 & 0x06) != 0x06)
+    return SPEC_KERNELS_SSE2;
+
+  CpuId(7, 0, r);
+  bool avx2 = (r[1] & (1u << 5)) != 0;
+  bool avx512f = (r[1] & (1u << 16)) != 0;
+  if (avx512f && fma && (xcr0 & 0xe6) == 0xe6)
+    return SPEC_KERNELS_AVX512;
+  if (avx2 && fma)
+    return SPEC_KERNELS_AVX2;
+  return SPEC_KERNELS_SSE2;
+}
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+static int /*SpecKernelLevel*/ DetectSpecKernelLevel()
+{
+  return SPEC_KERNELS_SCALAR;
+}
+
+#endif
+
+//*************************************************************************************************
+
+// start with scalar so that the kernels can be used during static init
+const SpecKernels* g_spec_kernels = &g_scalar_kernels;
+
+//-------------------------------------------------------------------------------------------------
+const SpecKernels* GetSpecKernels(int level)
+{
+  static int best = DetectSpecKernelLevel();
+  if (level < 0 || level > best)
+    return NULL;
+
+  switch (level) {
+#ifdef SPEC_KERNELS_X86
+  case SPEC_KERNELS_SSE2:
+    return &g_sse2_kernels;
+  case SPEC_KERNELS_AVX2:
+    return &g_avx2_kernels;
+  case SPEC_KERNELS_AVX512:
+    return &g_avx512_kernels;
+#endif
+  default:
+    return &g_scalar_kernels;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ SelectSpecKernels(int level)
+{
+  const SpecKernels* k = GetSpecKernels(level);
+  if (!k)
+    return false;
+  g_spec_kernels = k;
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+// select the best kernels at load time
+static struct SelectBestSpecKernels {
+  SelectBestSpecKernels()
+  {
+    for (int i = NUM_SPEC_KERNEL_LEVELS - 1; i >= 0; i--)
+      if (SelectSpecKernels(i))
+        break;
+  }
+} g_select_best_spec_kernels;
@@ -0,0 +1,81 @@
+#ifndef _DT_SPEC_KERNELS_H_
+#define _DT_SPEC_KERNELS_H_
+/**************************************************************************************************
+Vectorized kernels for the passes over the spectrum that every effect slot makes (power sums,
+scaling, clipping)
+
+There is a scalar version of each kernel plus SSE2, AVX2 & AVX-512 versions on x86. The best set
+that the cpu supports is chosen by cpuid when the plugin is loaded & called through
+g_spec_kernels. The vector versions sum in a different order so results can differ from the scalar
+versions in the last few bits.
+
+All kernels work on "n" complex values (floats for minMax & sum), n may be anything (including 0)
+& they don't need any particular alignment. normTo works out each norm exactly as norm() does so
+the cached power (see PwrCache.h) is the same whichever set is in use.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include "cplxf.h"
+
+//-------------------------------------------------------------------------------------------------
+struct SpecKernels {
+  // name for display
+  const char* name;
+
+  // sum of norm(x[i])
+  float (*pwr)(const cplxf* x, long n);
+
+  // x[i] *= s
+  void (*scale)(cplxf* x, long n, float s);
+
+  // x[i] *= s, return the sum of norm(x[i]) after scaling
+  float (*scalePwr)(cplxf* x, long n, float s);
+
+  // lower "min_pwr" & raise "max_pwr" to take in each norm(x[i]) (the initial values are kept if
+  // nothing is beyond them)
+  void (*minMaxPwr)(const cplxf* x, long n, float* min_pwr, float* max_pwr);
+
+  // reduce the magnitude of x[i] to sqrt(thresh) where norm(x[i]) >= thresh, return the sum of
+  // norm(x[i]) before & after
+  void (*clipPwr)(cplxf* x, long n, float thresh, float* in_pwr, float* out_pwr);
+
+  // pwr[i] = norm(x[i])
+  void (*normTo)(const cplxf* x, long n, float* pwr);
+
+  // lower "min_v" & raise "max_v" to take in each x[i] (floats, e.g. from normTo)
+  void (*minMax)(const float* x, long n, float* min_v, float* max_v);
+
+  // sum of x[i] (floats)
+  float (*sum)(const float* x, long n);
+
+  // x[i] *= g[i] (a real gain for each complex value)
+  void (*scaleBins)(cplxf* x, long n, const float* g);
+};
+
+// kernel sets in order of preference
+enum SpecKernelLevel {
+  SPEC_KERNELS_SCALAR,
+  SPEC_KERNELS_SSE2,
+  SPEC_KERNELS_AVX2,
+  SPEC_KERNELS_AVX512,
+  NUM_SPEC_KERNEL_LEVELS
+};
+
+// kernels in use, the best supported set is selected at load time
+extern const SpecKernels* g_spec_kernels;
+
+// kernel set for "level" or NULL if the cpu (or build) doesn't support it
+extern const SpecKernels* GetSpecKernels(int level);
+
+// use the kernel set for "level" (for testing, not while processing), false if not supported
+extern bool /*true=success*/ SelectSpecKernels(int level);
+
+#endif
@@ -0,0 +1,167 @@
+/**************************************************************************************************
+Hand-off of fft-blk power spectra from the audio thread to the spectrogram display
+
+The audio thread fills a SpecSnap with the power of the input & output spectrum of every channel
+for each fft-blk & commits it to a SpecSnapRing. The GUI idle timer takes snapshots out of the ring
+& does all the pixel mapping & colouring, so the audio thread never touches the spectrograms and
+doesn't need any lock for the hand-off.
+
+Large ffts are decimated (max power of each group of bins) so a snapshot is a bounded size. If the
+GUI falls behind, the audio thread merges further blks into the snapshot it is filling (max power,
+which is how the spectrogram merges blks into a line anyway) rather than dropping them.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#ifndef _DT_SPEC_SNAP_H_
+#define _DT_SPEC_SNAP_H_
+
+#include <atomic>
+#include <vector>
+
+#include "BlkFxParam.h"
+#include "cplxf.h"
+
+//-------------------------------------------------------------------------------------------------
+struct SpecSnap
+// power spectra of one (or more merged) fft-blks
+{
+  enum {
+    MAX_BINS = 4096, // max power values per spectrum
+    IN = 0,
+    OUT = 1
+  };
+
+  // number of fft bins in each stored power value for an fft of "fft_n" samples
+  static int decimation(long fft_n) { return (int)((fft_n / 2 + MAX_BINS) / MAX_BINS); }
+
+  // number of power values stored for an fft of "fft_n" samples
+  static int numBins(long fft_n)
+  {
+    int d = decimation(fft_n);
+    return (int)((fft_n / 2 + d) / d);
+  }
+
+  int plan;        // fft size index of the most recent blk
+  long samp_pos;   // absolute sample position of the most recent blk
+  long time_fft_n; // samples in the most recent blk (time-domain)
+
+  // [in-out][channel][bin] power (output power is scaled by DtBlkFx::Chan::out_pwr_scale)
+  float pwr[2][BlkFxParam::AUDIO_CHANNELS][MAX_BINS];
+
+  // fill pwr[in_out][ch] from fft data "x" of "fft_n" samples, if "merge" then take the max
+  // with the existing values
+  void set(int in_out, int ch, const cplxf* x, long fft_n, float pwr_scale, bool merge)
+  {
+    int d = decimation(fft_n);
+    int n = numBins(fft_n);
+    long x_n = fft_n / 2 + 1;
+    float* dst = pwr[in_out][ch];
+    for (int i = 0; i < n; i++, x += d, x_n -= d) {
+      float v = norm(x[0]);
+      for (int j = 1; j < d && j < x_n; j++) {
+        float t = norm(x[j]);
+        if (t > v)
+          v = t;
+      }
+      v *= pwr_scale;
+      if (!merge || v > dst[i])
+        dst[i] = v;
+    }
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+class SpecSnapRing
+//
+// single producer (audio thread), single consumer (GUI thread), neither ever blocks
+//
+{
+public:
+  enum { NUM_SLOTS = 4 };
+
+  SpecSnapRing()
+      : _slot(NUM_SLOTS)
+  {
+    _wr = 0;
+    _rd = 0;
+    _enabled = false;
+    _producer_on = false;
+    _pending_n = 0;
+  }
+
+  // consumer: start/stop taking snapshots (enable when the display opens, the producer does
+  // nothing while disabled)
+  void enable(bool on)
+  {
+    if (on)
+      _rd.store(_wr.load(std::memory_order_acquire), std::memory_order_release);
+    _enabled.store(on, std::memory_order_release);
+  }
+
+  // any thread: whether snapshots are wanted (the display is open)
+  bool isEnabled() const { return _enabled.load(std::memory_order_acquire); }
+
+  // producer: true if snapshots are wanted, call once per blk before pending()
+  bool producerBegin()
+  {
+    bool on = _enabled.load(std::memory_order_acquire);
+    if (on && !_producer_on)
+      _pending_n = 0; // anything pending is from before the display opened
+    _producer_on = on;
+    return on;
+  }
+
+  // producer: snapshot being filled (never visible to the consumer until commit())
+  SpecSnap& pending() { return _slot[_wr.load(std::memory_order_relaxed) % NUM_SLOTS]; }
+
+  // producer: number of blks already in pending() (0 means pending() must be overwritten, not
+  // merged)
+  int pendingBlks() const { return _pending_n; }
+
+  // producer: pass pending() to the consumer, or keep it to merge the next blk if the ring is full
+  void commit()
+  {
+    _pending_n++;
+    unsigned long wr = _wr.load(std::memory_order_relaxed);
+    if (wr - _rd.load(std::memory_order_acquire) >= NUM_SLOTS - 1)
+      return;
+    _wr.store(wr + 1, std::memory_order_release);
+    _pending_n = 0;
+  }
+
+  // consumer: oldest committed snapshot or NULL if none
+  const SpecSnap* front()
+  {
+    unsigned long rd = _rd.load(std::memory_order_relaxed);
+    if (rd == _wr.load(std::memory_order_acquire))
+      return NULL;
+    return &_slot[rd % NUM_SLOTS];
+  }
+
+  // consumer: finished with front()
+  void pop() { _rd.store(_rd.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // memory used by the snapshots
+  size_t memBytes() const { return _slot.size() * sizeof(SpecSnap); }
+
+protected:
+  std::vector<SpecSnap> _slot;
+
+  // snapshots committed & consumed (the pending snapshot is _slot[_wr % NUM_SLOTS])
+  std::atomic<unsigned long> _wr, _rd;
+
+  std::atomic<bool> _enabled;
+
+  // producer only
+  bool _producer_on;
+  int _pending_n;
+};
+
+#endif
@@ -203,9 +203,9 @@ inline unsigned long Spectrogram::mapCol(float in)
 
 //-------------------------------------------------------------------------------------------------
 inline void Spectrogram::getMaxVals(
-    cplxf** bin_rng, // appropriate bin rng's from PixelFreqBin
-    bool empty_line, // whether this is a new line (pass as constant to help optimizer)
-    float pwr_scale  // pwr scale to apply
+    const int* bin_rng, // appropriate bin rng's from PixelFreqBin
+    const float* pwr,   // power spectrum
+    bool empty_line     // whether this is a new line (pass as constant to help optimizer)
 )
 //
 // get maximum values for each pixel from bin ranges
@@ -216,12 +216,12 @@ inline void Spectrogram::getMaxVals(
   float* curr_max_end = curr_max + _curr_max.size();
 
   // find max power in for each pixel "n" in the bin range [rng[n], rng[n+1])
-  cplxf* bin_a = *bin_rng++; // get first bin
+  const float* bin_a = pwr + *bin_rng++; // get first bin
   while (curr_max < curr_max_end) {
-    cplxf* bin_b = *bin_rng++; // get end of this bin range
+    const float* bin_b = pwr + *bin_rng++; // get end of this bin range
 
     // always do at least one bin for every output pixel
-    float v = norm(*bin_a++) * pwr_scale;
+    float v = *bin_a++;
     float max_v;
     if (empty_line)
       max_v = v;
@@ -233,7 +233,7 @@ inline void Spectrogram::getMaxVals(
 
     // check any other bins up to the next bin position
     while (bin_a < bin_b) {
-      v = norm(*bin_a++) * pwr_scale;
+      v = *bin_a++;
       if (v > max_v)
         max_v = v;
     }
@@ -247,18 +247,18 @@ inline void Spectrogram::getMaxVals(
 }
 
 //------------------------------------------------------------------------------------------
-void Spectrogram::newData(cplxf** bin_rng, // appropriate mapping from PixelFreqBin
-                          float pwr_scale  // scaling to apply to data
+void Spectrogram::newData(const int* bin_rng, // appropriate mapping from PixelFreqBin
+                          const float* pwr    // power spectrum
 )
 // add some new data to the spectrogram
 {
   //	LOG("", "newData" << VAR(samp_pos) << VAR(time_fft_n) << VAR(fft_idx));
   if (!_curr_line_is_empty) {
-    getMaxVals(bin_rng, /*empty_line*/ false, pwr_scale);
+    getMaxVals(bin_rng, pwr, /*empty_line*/ false);
   }
   else {
     _curr_line_is_empty = false;
-    getMaxVals(bin_rng, /*empty_line*/ true, pwr_scale);
+    getMaxVals(bin_rng, pwr, /*empty_line*/ true);
   }
 }
 
@@ -516,8 +516,6 @@ void Spectrogram::update(CDrawContext* context)
   // work out the number of lines to scroll
   int new_disp_i = _disp_i[1];
 
-  // note: _disp_i[1] may be updated asynchronously to this function - ensure code is multi-thread
-  // safe
   int scroll_n = new_disp_i - _disp_i[0];
   if (scroll_n < 0)
     scroll_n += _image.getHeight();
@@ -70,10 +70,10 @@ public: // initialization routines that MUST be called before use
   // only call newData & blkDone if rdy() returns true
   bool rdy() { return _ok && !paused; }
 
-  // supply new FFT data
-  void newData(cplxf** bin_rng, // appropriate bin rng's from PixelFreqBin (must match pix_freq
-                                // passed to init)
-               float pwr_scale  // scaling to apply to data
+  // supply new power spectrum
+  void newData(const int* bin_rng, // appropriate bin rng's from PixelFreqBin (must match pix_freq
+                                   // passed to init)
+               const float* pwr    // power spectrum (from SpecSnap)
   );
 
   // call after "newData()" has been called for each channel to update sample position
@@ -154,10 +154,9 @@ protected: // internals
 
   unsigned long mapCol(float in);
 
-  void
-  getMaxVals(cplxf** bin_rng, // appropriate bin rng's from PixelFreqBin
-             bool empty_line, // whether this is a new line (pass as constant to help optimizer)
-             float pwr_scale  // pwr scale to apply
+  void getMaxVals(const int* bin_rng, // appropriate bin rng's from PixelFreqBin
+                  const float* pwr,   // power spectrum
+                  bool empty_line // whether this is a new line (pass as constant to help optimizer)
   );
 
   void drawBm(CDrawContext* context, //
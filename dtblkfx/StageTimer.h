@@ -0,0 +1,212 @@
+/**************************************************************************************************
+Per-stage timing of the fft-blk processing loop
+
+The audio thread accumulates tick counts for each stage of DtBlkFx::_process into a private
+StageTimes and publishes a copy into StageStatsBlock at the end of every _process call. The
+published copy is protected by a sequence counter so that a host, the GUI or a command line tool
+can read it at any time without taking DtBlkFx::_protect (and without ever blocking the audio
+thread).
+
+Timing is off by default, in which case each stage costs a single test of a bool.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#ifndef _DT_STAGE_TIMER_H_
+#define _DT_STAGE_TIMER_H_
+
+#include <atomic>
+#include <chrono>
+#include <string.h>
+
+#include "BlkFxParam.h"
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#  define STAGE_TIMER_RDTSC
+#elif defined(__i386__) || defined(__x86_64__)
+#  include <x86intrin.h>
+#  define STAGE_TIMER_RDTSC
+#endif
+
+//-------------------------------------------------------------------------------------------------
+typedef unsigned long long StageTicks;
+
+// read the tick counter (cycle counter where available)
+inline StageTicks GetStageTicks()
+{
+#ifdef STAGE_TIMER_RDTSC
+  return __rdtsc();
+#else
+  return (StageTicks)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+// number of ticks per second, measured on first call (takes ~20msec)
+inline double StageTicksPerSec()
+{
+  struct Calibrate {
+    double ticks_per_sec;
+    Calibrate()
+    {
+      typedef std::chrono::steady_clock Clock;
+      Clock::time_point t0 = Clock::now();
+      StageTicks c0 = GetStageTicks();
+      while (Clock::now() - t0 < std::chrono::milliseconds(20)) {
+      }
+      StageTicks c1 = GetStageTicks();
+      ticks_per_sec = (double)(c1 - c0) / std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+  };
+  static Calibrate cal;
+  return cal.ticks_per_sec;
+}
+
+//-------------------------------------------------------------------------------------------------
+// stages that are timed
+enum StageId {
+  STAGE_PROCESS,        // whole _process call (including waiting for _protect)
+  STAGE_LOCK_WAIT,      // waiting for _protect
+  STAGE_COPY_IN_BUF,    // copyInBuf
+  STAGE_DO_FFT,         // doFFT
+  STAGE_PREP_MIX_OUT,   // prepMixOut
+  STAGE_PROC_FFT,       // procFFT (all slots plus power matching)
+  STAGE_IFFT_MIX_OUT,   // ifftAndMixOut (or the direct mix when mixback is 100%)
+  STAGE_GUI_SNAP,       // DtBlkFx::snapSpectrum (both calls)
+  STAGE_ZERO_FILL,      // zeroFillOutput
+  STAGE_FX_SLOT_0,      // FxState1_0::process for each slot
+  NUM_STAGES = STAGE_FX_SLOT_0 + BlkFxParam::NUM_FX_SETS
+};
+
+// name of a stage for display
+inline const char* StageName(int stage)
+{
+  static const char* names[STAGE_FX_SLOT_0] = {"process",
+                                               "lock wait",
+                                               "copyInBuf",
+                                               "doFFT",
+                                               "prepMixOut",
+                                               "procFFT",
+                                               "ifftAndMixOut",
+                                               "snapSpectrum",
+                                               "zeroFillOutput"};
+  static const char* slot_names[BlkFxParam::NUM_FX_SETS] = {
+      "fx slot 0", "fx slot 1", "fx slot 2", "fx slot 3",
+      "fx slot 4", "fx slot 5", "fx slot 6", "fx slot 7"};
+
+  if (stage >= 0 && stage < STAGE_FX_SLOT_0)
+    return names[stage];
+  if (stage >= STAGE_FX_SLOT_0 && stage < NUM_STAGES)
+    return slot_names[stage - STAGE_FX_SLOT_0];
+  return "?";
+}
+
+//-------------------------------------------------------------------------------------------------
+struct StageTimes
+// accumulated times for all stages since the last reset
+{
+  struct Stage {
+    StageTicks n;     // number of times the stage ran
+    StageTicks total; // total ticks
+    StageTicks max;   // worst single run
+    StageTicks last;  // most recent run
+  } stage[NUM_STAGES];
+
+  // number of fft blks processed, how many of those were skipped because they were silent & how
+  // many were done at reduced quality by the governor (see CpuGovernor.h)
+  StageTicks blks;
+  StageTicks silent_blks;
+  StageTicks degraded_blks;
+
+  StageTimes() { clear(); }
+  void clear() { memset(this, 0, sizeof(*this)); }
+
+  void add(int id, StageTicks t)
+  {
+    Stage& s = stage[id];
+    s.n++;
+    s.total += t;
+    s.last = t;
+    if (t > s.max)
+      s.max = t;
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+class StageStatsBlock
+//
+// single writer (audio thread), any number of readers on other threads, neither ever blocks
+//
+{
+public:
+  StageStatsBlock()
+  {
+    _seq = 0;
+    _reset_req = false;
+  }
+
+  // writer: publish "src" (normally called at the end of _process)
+  void publish(const StageTimes& src)
+  {
+    _seq.fetch_add(1, std::memory_order_relaxed); // odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    _data = src;
+    _seq.fetch_add(1, std::memory_order_release); // even: consistent
+  }
+
+  // reader: get a consistent copy of the most recently published times
+  void read(StageTimes* dst) const
+  {
+    while (1) {
+      unsigned long s0 = _seq.load(std::memory_order_acquire);
+      if (s0 & 1)
+        continue; // writer busy
+      *dst = _data;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (_seq.load(std::memory_order_relaxed) == s0)
+        return;
+    }
+  }
+
+  // reader: ask the writer to clear its accumulated times before the next _process
+  void requestReset() { _reset_req.store(true, std::memory_order_relaxed); }
+
+  // writer: check (and acknowledge) a reset request
+  bool takeResetRequest() { return _reset_req.exchange(false, std::memory_order_relaxed); }
+
+protected:
+  std::atomic<unsigned long> _seq;
+  std::atomic<bool> _reset_req;
+  StageTimes _data;
+};
+
+//-------------------------------------------------------------------------------------------------
+class ScopeStageTimer
+// time the scope into "times" if "on"
+{
+public:
+  ScopeStageTimer(StageTimes& times, int id, bool on)
+  {
+    _times = on ? &times : NULL;
+    _id = id;
+    _t0 = _times ? GetStageTicks() : 0;
+  }
+  ~ScopeStageTimer()
+  {
+    if (_times)
+      _times->add(_id, GetStageTicks() - _t0);
+  }
+
+protected:
+  StageTimes* _times;
+  int _id;
+  StageTicks _t0;
+};
+
+#endif
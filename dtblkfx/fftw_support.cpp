@@ -18,6 +18,15 @@ void(__cdecl* free)(void* p);
 void*(__cdecl* malloc)(size_t n);
 fftwf_plan(__cdecl* plan_dft_c2r_1d)(int n, fftwf_complex* in, float* out, unsigned flags);
 fftwf_plan(__cdecl* plan_dft_r2c_1d)(int n, float* in, fftwf_complex* out, unsigned flags);
+fftwf_plan(__cdecl* plan_many_dft_c2r)(int rank, const int* n, int howmany, fftwf_complex* in,
+                                       const int* inembed, int istride, int idist, float* out,
+                                       const int* onembed, int ostride, int odist, unsigned flags);
+fftwf_plan(__cdecl* plan_many_dft_r2c)(int rank, const int* n, int howmany, float* in,
+                                       const int* inembed, int istride, int idist,
+                                       fftwf_complex* out, const int* onembed, int ostride,
+                                       int odist, unsigned flags);
+int(__cdecl* export_wisdom_to_filename)(const char* filename);
+int(__cdecl* import_wisdom_from_filename)(const char* filename);
 }; // namespace FFTWf
 
 static HMODULE g_fftwf_dll = NULL;
@@ -75,6 +84,10 @@ bool /*true=success*/ LoadFFTWfDll(std::vector<std::string> paths, std::ostream*
   LOAD_FN(malloc);
   LOAD_FN(plan_dft_c2r_1d);
   LOAD_FN(plan_dft_r2c_1d);
+  LOAD_FN(plan_many_dft_c2r);
+  LOAD_FN(plan_many_dft_r2c);
+  LOAD_FN(export_wisdom_to_filename);
+  LOAD_FN(import_wisdom_from_filename);
 
   return ok;
 }
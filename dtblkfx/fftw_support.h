@@ -3,6 +3,7 @@
 
 #include "../fftw/fftw3.h"
 #include "FixPoint.h"
+#include "SpecKernels.h"
 #include "cplxf.h"
 #include "fft_frac_shift.h"
 #include "misc_stuff.h"
@@ -33,6 +34,16 @@ extern void(__cdecl* free)(void* p);
 extern void*(__cdecl* malloc)(size_t n);
 extern fftwf_plan(__cdecl* plan_dft_c2r_1d)(int n, fftwf_complex* in, float* out, unsigned flags);
 extern fftwf_plan(__cdecl* plan_dft_r2c_1d)(int n, float* in, fftwf_complex* out, unsigned flags);
+extern fftwf_plan(__cdecl* plan_many_dft_c2r)(int rank, const int* n, int howmany,
+                                              fftwf_complex* in, const int* inembed, int istride,
+                                              int idist, float* out, const int* onembed,
+                                              int ostride, int odist, unsigned flags);
+extern fftwf_plan(__cdecl* plan_many_dft_r2c)(int rank, const int* n, int howmany, float* in,
+                                              const int* inembed, int istride, int idist,
+                                              fftwf_complex* out, const int* onembed, int ostride,
+                                              int odist, unsigned flags);
+extern int(__cdecl* export_wisdom_to_filename)(const char* filename);
+extern int(__cdecl* import_wisdom_from_filename)(const char* filename);
 }; // namespace FFTWf
 
 // load fftw dll, eeror message written to "err_str"
@@ -70,6 +81,46 @@ inline fftwf_plan plan_dft_r2c_1d(int n, float* i, fftwf_complex* o, unsigned fl
 {
   return fftwf_plan_dft_r2c_1d(n, i, o, flags);
 }
+inline fftwf_plan plan_many_dft_c2r(int rank,
+                                    const int* n,
+                                    int howmany,
+                                    fftwf_complex* i,
+                                    const int* inembed,
+                                    int istride,
+                                    int idist,
+                                    float* o,
+                                    const int* onembed,
+                                    int ostride,
+                                    int odist,
+                                    unsigned flags)
+{
+  return fftwf_plan_many_dft_c2r(
+      rank, n, howmany, i, inembed, istride, idist, o, onembed, ostride, odist, flags);
+}
+inline fftwf_plan plan_many_dft_r2c(int rank,
+                                    const int* n,
+                                    int howmany,
+                                    float* i,
+                                    const int* inembed,
+                                    int istride,
+                                    int idist,
+                                    fftwf_complex* o,
+                                    const int* onembed,
+                                    int ostride,
+                                    int odist,
+                                    unsigned flags)
+{
+  return fftwf_plan_many_dft_r2c(
+      rank, n, howmany, i, inembed, istride, idist, o, onembed, ostride, odist, flags);
+}
+inline int export_wisdom_to_filename(const char* filename)
+{
+  return fftwf_export_wisdom_to_filename(filename);
+}
+inline int import_wisdom_from_filename(const char* filename)
+{
+  return fftwf_import_wisdom_from_filename(filename);
+}
 }; // namespace FFTWf
 
 #endif
@@ -173,10 +224,7 @@ public:
 //*************************************************************************************************
 inline float /*pwr*/ GetPwr(CplxfPtrPair x /*must be fwd*/)
 {
-  float pwr = 0.0f;
-  for (; !x.equal(); x.a++)
-    pwr += norm(*x);
-  return pwr;
+  return g_spec_kernels->pwr(x.a, x.size());
 }
 inline float /*pwr*/ GetPwr(cplxf* x, long b0, long b1 /*b0 <= b1*/)
 {
@@ -209,9 +257,7 @@ inline void MatchPwr(float amp, double target_pwr, double curr_pwr,
                      CplxfPtrPair x // must be fwd
 )
 {
-  amp = MatchPwr(amp, target_pwr, curr_pwr);
-  for (; !x.equal(); x.a++)
-    *x = (*x) * amp;
+  g_spec_kernels->scale(x.a, x.size(), MatchPwr(amp, target_pwr, curr_pwr));
 }
 
 //*************************************************************************************************
@@ -24,6 +24,9 @@ Free software!
 #ifdef _WIN32
 #  include <windows.h>
 #  include <xmmintrin.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <xmmintrin.h>
 #else // assume MAC
 #  include <Accelerate/Accelerate.h>
 #  include <libkern/OSAtomic.h>
@@ -75,9 +78,11 @@ Free software!
         }                                                                                          \
       }
 
-#  else // mac
+#  else // mac or linux
 #    ifdef __ppc__
 #      define BRK asm { trap}
+#    elif defined(__linux__)
+#      define BRK __builtin_trap();
 #    else
 #      define BRK __asm { int 3}
 #    endif
@@ -187,6 +192,49 @@ template <class T> inline bool GetProcAddress(T& result, HMODULE module, const c
   return t ? true : false;
 }
 
+#elif defined(__linux__)
+
+// wrap the gcc builtins to look like windows
+inline long InterlockedIncrement(long* v)
+{
+  return __sync_add_and_fetch(v, 1);
+}
+inline long InterlockedDecrement(long* v)
+{
+  return __sync_sub_and_fetch(v, 1);
+}
+
+//------------------------------------------------------------------------------------------
+struct CriticalSectionWrapper
+// wrap a pthread mutex, recursive to behave like a windows critical section
+{
+  pthread_mutex_t mx;
+  CriticalSectionWrapper()
+  {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mx, &attr);
+    pthread_mutexattr_destroy(&attr);
+  }
+  ~CriticalSectionWrapper() { pthread_mutex_destroy(&mx); }
+  void lock() { pthread_mutex_lock(&mx); }
+  void unlock() { pthread_mutex_unlock(&mx); }
+  operator pthread_mutex_t*() { return &mx; }
+};
+
+//------------------------------------------------------------------------------------------
+class ScopeCriticalSection {
+public:
+  pthread_mutex_t* mx;
+  ScopeCriticalSection(pthread_mutex_t* mx_)
+  {
+    mx = mx_;
+    pthread_mutex_lock(mx_);
+  }
+  ~ScopeCriticalSection() { pthread_mutex_unlock(mx); }
+};
+
 #else // assume MAC OS X
 
 // wrap the MAC functions to look like windows
@@ -439,6 +487,16 @@ inline long prbs32(long x)
   return ((unsigned long)x >> 1) ^ (-(x & 1) & 0xd0000001UL);
 }
 
+//------------------------------------------------------------------------------------------
+inline unsigned CtrRand32(unsigned x)
+// counter-based random number, a hash of "x" (lowbias32 from Chris Wellons) so successive counter
+// values give independent numbers without any state carried between them
+{
+  x = (x ^ (x >> 16)) * 0x7feb352dU;
+  x = (x ^ (x >> 15)) * 0x846ca68bU;
+  return x ^ (x >> 16);
+}
+
 //------------------------------------------------------------------------------------------
 // these are a bit impolite but make things easy
 template <class T> T* begin(const std::vector<T>& v)
@@ -621,9 +679,9 @@ public:
     n = last - first + 1;
   }
 
-  // attempt to construct using toRng() conversion (for some reason we need to explicitly call
-  // conversion)
-  template <class T2> Rng(T2& src) { *this = toRng(src).operator Rng<T>(); }
+  // attempt to construct using toRng() conversion (defined after the toRng's below so that they
+  // are visible at the point of definition)
+  template <class T2> Rng(T2& src);
 
   void adjStart(int i)
   {
@@ -652,7 +710,7 @@ public:
   // get that returns "out_of_bounds" if "i" out of bounds
   const T& get(int i, const T& out_of_bounds) const
   {
-    return idx_within(i, *this) ? data[i] : out_of_bounds;
+    return idx_within(i, *this) ? base::ptr[i] : out_of_bounds;
   }
 
   // cast to compatible types
@@ -682,6 +740,13 @@ template <class T> inline Rng<T> toRng(std::valarray<T>& v)
 {
   return Rng<T>(&v[0], (int)v.size());
 }
+
+template <class T> template <class T2> inline Rng<T>::Rng(T2& src)
+{
+  // for some reason we need to explicitly call conversion
+  *this = toRng(src).operator Rng<T>();
+}
+
 // return true if the 0 <= idx < rng.size()
 template <class T> bool withinRng(int idx, const T& rng)
 {
@@ -841,7 +906,7 @@ inline void MaybeSwap32(void* /*4-byte*/ dst, void* /*4-byte*/ src)
   dstc[3] = srcc[0];
 #else
   // little-endian (assume non word aligned is ok)
-  *(unsigned long*)dst = *(unsigned long*)src;
+  *(unsigned int*)dst = *(unsigned int*)src;
 #endif
 }
 
@@ -886,7 +951,7 @@ struct LittleEndianMemStr
     // NOTE: if there's a compile error here then "dst" does not point to a 4 byte quantity
     typedef char chk_type[sizeof(T) == 4 ? 1 : -1];
 
-    unsigned long v;
+    unsigned int v;
     MaybeSwap32(&v, &src);
     return ShiftDst(/*dst*/ this, /*src*/ &v);
   }
@@ -896,7 +961,7 @@ struct LittleEndianMemStr
     // NOTE: if there's a compile error here then "dst" does not point to a 4 byte quantity
     typedef char chk_type[sizeof(T) == 4 ? 1 : -1];
 
-    unsigned long v;
+    unsigned int v;
     if (!ShiftSrc(/*dst*/ &v, /*src*/ this))
       return false;
     MaybeSwap32(dst, &v);
@@ -927,7 +992,7 @@ struct LittleEndianMemStr
 };
 
 //-------------------------------------------------------------------------------------------------
-inline Rng<char> v_rng_sprf(Rng<char> dst, const char* fmt, const va_list args)
+inline Rng<char> v_rng_sprf(Rng<char> dst, const char* fmt, va_list args)
 //
 // wrapper for vsnprintf to print into a range & return remaining
 //
@@ -938,7 +1003,7 @@ inline Rng<char> v_rng_sprf(Rng<char> dst, const char* fmt, const va_list args)
 
 //
 #ifdef _WIN32
-  int n = _vsnprintf_s(dst, dst.n, _TRUNCATE, fmt, const_cast<va_list>(args));
+  int n = _vsnprintf_s(dst, dst.n, _TRUNCATE, fmt, args);
 
   // check for truncation
   if (n < 0) {
@@ -946,7 +1011,7 @@ inline Rng<char> v_rng_sprf(Rng<char> dst, const char* fmt, const va_list args)
     dst[n] = 0;
   }
 #else
-  int n = vsnprintf(dst, dst.n, fmt, const_cast<va_list>(args));
+  int n = vsnprintf(dst, dst.n, fmt, args);
 
   // check for truncation
   if (n > dst.n - 1)
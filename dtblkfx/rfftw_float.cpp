@@ -13,6 +13,14 @@ This software is completely free software
 ***************************************************************************************************/
 #include <StdAfx.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <thread>
+
 #include "rfftw_float.h"
 
 // these blocks were found by choosing the fastest 4 block sizes between each pwr-of-2 (including
@@ -22,28 +30,313 @@ int g_fft_sz[NUM_FFT_SZ] = {256,   320,   384,   448,   512,   640,   768,   896
                             6144,  7168,  8192,  9600,  12288, 13440, 16384, 20480, 24576,
                             28672, 32768, 40500, 49152, 57600, 65536, 80640};
 
-ScopeFFTWfPlan g_fft_plan[NUM_FFT_SZ], g_ifft_plan[NUM_FFT_SZ];
+FFTWfPlanTable g_fft_plan, g_ifft_plan;
+FFTWfPlanTable g_fft_batch_plan, g_ifft_batch_plan;
+
+// plans pointed to by the tables: the ones created by InitFFTWfPlans & the measured ones that
+// replace them, replaced plans are kept because a plan can be swapped while it's being run
+enum { PLAN_INIT, PLAN_FINAL, NUM_PLAN_STAGES };
+static ScopeFFTWfPlan g_fft_store[NUM_PLAN_STAGES][NUM_FFT_SZ];
+static ScopeFFTWfPlan g_ifft_store[NUM_PLAN_STAGES][NUM_FFT_SZ];
+static ScopeFFTWfPlan g_fft_batch_store[NUM_PLAN_STAGES][NUM_FFT_SZ];
+static ScopeFFTWfPlan g_ifft_batch_store[NUM_PLAN_STAGES][NUM_FFT_SZ];
+
+enum {
+  // the planner thread isn't always woken when a plan is requested (the audio thread never takes
+  // a lock), it checks for requests at this rate
+  PLANNER_POLL_MSEC = 10
+};
+
+// fftw's planner isn't thread safe, everything to do with planning is protected by this
+static std::mutex g_plan_mx;
+
+// flags used to create plans & wisdom file (protected by g_plan_mx)
+static unsigned g_plan_flags = FFTW_ESTIMATE;
+static std::string g_wisdom_path;
+static bool g_have_wisdom = false;
+
+// set once InitFFTWfPlans has created the plans for every size (protected by g_plan_mx)
+static bool g_plans_init = false;
+
+// set (release) once the final plan is in the tables, never cleared
+static std::atomic<bool> g_plan_final[NUM_FFT_SZ];
+
+// bit per requested plan (any thread)
+static std::atomic<unsigned long long> g_plan_req;
+
+// planner thread
+static std::mutex g_planner_users_mx; // protects g_planner_users & starting/stopping the thread
+static int g_planner_users = 0;
+static std::thread g_planner;
+static std::mutex g_planner_mx; // protects g_planner_quit
+static std::condition_variable g_planner_cv;
+static bool g_planner_quit = false;
+
+//-------------------------------------------------------------------------------------------------
+static bool CanWriteFile(const char* path)
+// probe with a temporary file next to "path" so that "path" itself isn't touched (opening it to
+// append would leave an empty file behind if it didn't exist)
+{
+  std::string tmp = std::string(path) + ".tmp";
+  FILE* f = fopen(tmp.c_str(), "w");
+  if (!f)
+    return false;
+  fclose(f);
+  remove(tmp.c_str());
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void SetPlanMode(FFTWfPlanMode mode, const char* wisdom_path)
+// g_plan_mx must be held
+{
+  g_plan_flags = FFTW_ESTIMATE;
+  if (mode == FFTW_PLAN_MEASURE)
+    g_plan_flags = FFTW_MEASURE;
+  else if (mode == FFTW_PLAN_PATIENT)
+    g_plan_flags = FFTW_PATIENT;
+
+  // wisdom from a previous run, a missing or bad file just means there's no wisdom
+  g_wisdom_path = wisdom_path ? wisdom_path : "";
+  g_have_wisdom = false;
+  if (!g_wisdom_path.empty()) {
+    g_have_wisdom = FFTWf::import_wisdom_from_filename(wisdom_path) != 0;
+    if (g_plan_flags != FFTW_ESTIMATE && !CanWriteFile(wisdom_path))
+      g_plan_flags = FFTW_ESTIMATE;
+  }
+}
 
 //-------------------------------------------------------------------------------------------------
-void CreateFFTWfPlans()
+static fftwf_plan /*NULL=failure*/ PlanFFT(int n,
+                                           int howmany,
+                                           float* a,
+                                           fftwf_complex* b,
+                                           bool inverse,
+                                           unsigned plan_flags,
+                                           int* planned)
+// plan "howmany" transforms of length "n" between "a" & "b" (channels are FFT_BATCH_TIME_DIST &
+// FFT_BATCH_FREQ_DIST apart if there is more than 1), wisdom is tried first & "planned" is
+// incremented if it had to be planned with "plan_flags"
+// g_plan_mx must be held
 {
-  // dummy arrays that we use to create the plan
-  ScopeFFTWfMalloc<float> a;
-  a.resize(MAX_FFT_SZ);
+  // wisdom from a more patient run satisfies a measure request
+  unsigned wisdom_flags =
+      FFTW_WISDOM_ONLY | (g_plan_flags == FFTW_ESTIMATE ? FFTW_MEASURE : g_plan_flags);
 
-  ScopeFFTWfMalloc<cplxf> b;
-  b.resize(MAX_FFT_SZ / 2 + 1);
+  fftwf_plan p = NULL;
+  for (int pass = g_have_wisdom ? 0 : 1; pass < 2 && !p; pass++) {
+    unsigned flags = pass == 0 ? wisdom_flags : plan_flags;
+    if (howmany == 1)
+      p = inverse ? FFTWf::plan_dft_c2r_1d(n, b, a, flags) : FFTWf::plan_dft_r2c_1d(n, a, b, flags);
+    else if (inverse)
+      p = FFTWf::plan_many_dft_c2r(/*rank*/ 1,
+                                   &n,
+                                   howmany,
+                                   b,
+                                   /*inembed*/ NULL,
+                                   /*istride*/ 1,
+                                   FFT_BATCH_FREQ_DIST,
+                                   a,
+                                   /*onembed*/ NULL,
+                                   /*ostride*/ 1,
+                                   FFT_BATCH_TIME_DIST,
+                                   flags);
+    else
+      p = FFTWf::plan_many_dft_r2c(/*rank*/ 1,
+                                   &n,
+                                   howmany,
+                                   a,
+                                   /*inembed*/ NULL,
+                                   /*istride*/ 1,
+                                   FFT_BATCH_TIME_DIST,
+                                   b,
+                                   /*onembed*/ NULL,
+                                   /*ostride*/ 1,
+                                   FFT_BATCH_FREQ_DIST,
+                                   flags);
 
-  // create the plans
-  for (int i = 0; i < NUM_FFT_SZ; i++) {
-    g_fft_plan[i] = FFTWf::plan_dft_r2c_1d(g_fft_sz[i], a, to_fftwf_complex(b), FFTW_ESTIMATE);
-    // g_fft_plan[i] = FFTWf::plan_dft_r2c_1d(g_fft_sz[i], (float*)NULL, (fftwf_complex*)NULL,
-    // FFTW_ESTIMATE);
-    g_ifft_plan[i] = FFTWf::plan_dft_c2r_1d(g_fft_sz[i], to_fftwf_complex(b), a, FFTW_ESTIMATE);
-    // g_ifft_plan[i] = FFTWf::plan_dft_c2r_1d(g_fft_sz[i], (fftwf_complex*)NULL, (float*)NULL,
-    // FFTW_ESTIMATE);
-
-    if (!g_fft_plan[i] || !g_ifft_plan[i])
+    // not in the wisdom
+    if (pass == 1)
+      (*planned)++;
+  }
+  return p;
+}
+
+//-------------------------------------------------------------------------------------------------
+static int /*number of plans not found in the wisdom*/ MakePlan(int i,
+                                                                int stage,
+                                                                unsigned plan_flags)
+// create the "stage" plans for size "i" (replacing any existing ones) & point the tables at them,
+// throw error if failure
+// g_plan_mx must be held
+{
+  int n = g_fft_sz[i];
+
+  // dummy arrays that we use to create the plan, big enough for batched plans (note that
+  // measuring overwrites these)
+  ScopeFFTWfMalloc<float> a(FFT_BATCH_N * FFT_BATCH_TIME_DIST);
+  ScopeFFTWfMalloc<cplxf> b(FFT_BATCH_N * FFT_BATCH_FREQ_DIST);
+  fftwf_complex* bc = to_fftwf_complex(b);
+
+  int planned = 0;
+  ScopeFFTWfPlan& fft = g_fft_store[stage][i];
+  ScopeFFTWfPlan& ifft = g_ifft_store[stage][i];
+  fft = PlanFFT(n, 1, a, bc, /*inverse*/ false, plan_flags, &planned);
+  ifft = PlanFFT(n, 1, a, bc, /*inverse*/ true, plan_flags, &planned);
+  if (!fft || !ifft)
+    throw 0;
+
+  ScopeFFTWfPlan& fft_batch = g_fft_batch_store[stage][i];
+  ScopeFFTWfPlan& ifft_batch = g_ifft_batch_store[stage][i];
+  if (FFT_BATCH_N > 1) {
+    fft_batch = PlanFFT(n, FFT_BATCH_N, a, bc, /*inverse*/ false, plan_flags, &planned);
+    ifft_batch = PlanFFT(n, FFT_BATCH_N, a, bc, /*inverse*/ true, plan_flags, &planned);
+    if (!fft_batch || !ifft_batch)
       throw 0;
   }
+
+  // swap the new plans in
+  g_fft_plan.plan[i].store(fft, std::memory_order_release);
+  g_ifft_plan.plan[i].store(ifft, std::memory_order_release);
+  g_fft_batch_plan.plan[i].store(fft_batch, std::memory_order_release);
+  g_ifft_batch_plan.plan[i].store(ifft_batch, std::memory_order_release);
+  return planned;
+}
+
+//-------------------------------------------------------------------------------------------------
+static int /*number of plans measured*/ MakeFinalPlan(int i)
+// measure plan "i" (or take it from the wisdom), throw error if failure
+// g_plan_mx must be held
+{
+  int measured = 0;
+  if (g_plan_flags != FFTW_ESTIMATE)
+    measured = MakePlan(i, PLAN_FINAL, g_plan_flags);
+  g_plan_final[i].store(true, std::memory_order_release);
+  return measured;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void SaveWisdom()
+// g_plan_mx must be held
+{
+  if (!g_wisdom_path.empty())
+    FFTWf::export_wisdom_to_filename(g_wisdom_path.c_str());
+}
+
+//-------------------------------------------------------------------------------------------------
+void InitFFTWfPlans(FFTWfPlanMode mode, const char* wisdom_path)
+{
+  std::lock_guard<std::mutex> lk(g_plan_mx);
+  SetPlanMode(mode, wisdom_path);
+  if (g_plans_init)
+    return;
+
+  // estimate everything that isn't in the wisdom (fast), those plans are final unless we're
+  // going to measure
+  for (int i = 0; i < NUM_FFT_SZ; i++) {
+    if (!MakePlan(i, PLAN_INIT, FFTW_ESTIMATE) || g_plan_flags == FFTW_ESTIMATE)
+      g_plan_final[i].store(true, std::memory_order_release);
+  }
+  g_plans_init = true;
+}
+
+//-------------------------------------------------------------------------------------------------
+bool FFTWfPlanFinal(int plan)
+{
+  return g_plan_final[plan].load(std::memory_order_acquire);
+}
+
+//-------------------------------------------------------------------------------------------------
+void RequestFFTWfPlan(int plan)
+{
+  if (FFTWfPlanFinal(plan))
+    return;
+  g_plan_req.fetch_or(1ULL << plan, std::memory_order_relaxed);
+  g_planner_cv.notify_one();
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ WarmFFTWfPlan(int plan)
+{
+  if (FFTWfPlanFinal(plan))
+    return true;
+
+  std::lock_guard<std::mutex> lk(g_plan_mx);
+  try {
+    // might have been measured while we were waiting for the lock
+    if (!g_plan_final[plan].load(std::memory_order_relaxed) && MakeFinalPlan(plan))
+      SaveWisdom();
+  }
+  // allocation or planning failure
+  catch (...) {
+    return false;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+int /*number of plans measured*/ CreateFFTWfPlans(FFTWfPlanMode mode, const char* wisdom_path)
+{
+  std::lock_guard<std::mutex> lk(g_plan_mx);
+  SetPlanMode(mode, wisdom_path);
+
+  int measured = 0;
+  for (int i = 0; i < NUM_FFT_SZ; i++) {
+    int planned = MakePlan(i, PLAN_FINAL, g_plan_flags);
+    if (g_plan_flags != FFTW_ESTIMATE)
+      measured += planned;
+    g_plan_final[i].store(true, std::memory_order_release);
+  }
+
+  // save anything new for next time
+  if (measured)
+    SaveWisdom();
+
+  return measured;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void PlannerThreadFn()
+{
+  std::unique_lock<std::mutex> lk(g_planner_mx);
+  while (!g_planner_quit) {
+    g_planner_cv.wait_for(lk, std::chrono::milliseconds(PLANNER_POLL_MSEC));
+
+    unsigned long long req = g_plan_req.exchange(0, std::memory_order_relaxed);
+    for (int i = 0; i < NUM_FFT_SZ && !g_planner_quit; i++) {
+      if (!(req & (1ULL << i)))
+        continue;
+
+      // don't hold up StopFFTWfPlanner while planning
+      lk.unlock();
+      WarmFFTWfPlan(i);
+      lk.lock();
+    }
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartFFTWfPlanner()
+{
+  std::lock_guard<std::mutex> users_lk(g_planner_users_mx);
+  if (g_planner_users++ > 0)
+    return;
+
+  g_planner_quit = false;
+  g_planner = std::thread(PlannerThreadFn);
+}
+
+//-------------------------------------------------------------------------------------------------
+void StopFFTWfPlanner()
+{
+  std::lock_guard<std::mutex> users_lk(g_planner_users_mx);
+  if (--g_planner_users > 0)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lk(g_planner_mx);
+    g_planner_quit = true;
+  }
+  g_planner_cv.notify_all();
+  g_planner.join();
 }
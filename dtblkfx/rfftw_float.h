@@ -20,6 +20,7 @@ This is completely free software
 #endif
 
 #include "fftw_support.h"
+#include <atomic>
 
 // constants
 enum { NUM_FFT_SZ = 34, MIN_FFT_SZ = 256, MAX_FFT_SZ = 80640 };
@@ -27,10 +28,70 @@ enum { NUM_FFT_SZ = 34, MIN_FFT_SZ = 256, MAX_FFT_SZ = 80640 };
 // array of block sizes that we have plans built for
 extern int g_fft_sz[NUM_FFT_SZ];
 
-// array of plans that we have built
-extern ScopeFFTWfPlan g_fft_plan[NUM_FFT_SZ], g_ifft_plan[NUM_FFT_SZ];
+// plan in use for each fft size, indexed like an array of plans (any thread)
+// every size has a plan once InitFFTWfPlans has been called, the planner thread may later swap in
+// a measured plan (the plan it replaces stays valid so a plan can be used while it's swapped)
+struct FFTWfPlanTable {
+  std::atomic<fftwf_plan> plan[NUM_FFT_SZ];
+  fftwf_plan operator[](int i) const { return plan[i].load(std::memory_order_acquire); }
+};
+extern FFTWfPlanTable g_fft_plan, g_ifft_plan;
 
-// create plans, throw error if failure
-extern void CreateFFTWfPlans();
+// number of channels transformed by one call of a batched plan (1 = no batched plans), define as 1
+// to do each channel separately in the stereo build
+#ifndef FFT_BATCH_N
+#  ifdef STEREO
+#    define FFT_BATCH_N 2
+#  else
+#    define FFT_BATCH_N 1
+#  endif
+#endif
+
+// distance between channels for batched plans: time-domain data in floats & frequency-domain data
+// in complex values (enough for the largest fft blk plus 32 either side for shift overflow)
+enum { FFT_BATCH_TIME_DIST = MAX_FFT_SZ + 32 * 2, FFT_BATCH_FREQ_DIST = MAX_FFT_SZ / 2 + 32 * 2 };
+
+// batched plans (FFT_BATCH_N channels per call, only created if FFT_BATCH_N > 1), swapped along
+// with the plans above
+extern FFTWfPlanTable g_fft_batch_plan, g_ifft_batch_plan;
+
+// how hard fftw tries to find fast plans
+enum FFTWfPlanMode {
+  FFTW_PLAN_ESTIMATE, // guess (plans are created instantly)
+  FFTW_PLAN_MEASURE,  // time a few algorithms for each size (seconds)
+  FFTW_PLAN_PATIENT   // time many algorithms for each size (minutes)
+};
+
+// name of the wisdom file (normally kept in the plugin's data dir)
+#define FFTW_WISDOM_FILE_NAME "fftw_wisdom.txt"
+
+// set up planning & create a plan for every size, throw error if failure
+// if "wisdom_path" is given, wisdom is imported from the file first (plans found there are used
+// regardless of "mode"). Sizes missing from the wisdom are estimated here (fast) & if "mode"
+// measures then the measured plans replace them when they're first needed (see
+// RequestFFTWfPlan). Measured plans are saved back to the wisdom file, measuring is skipped if the
+// file can't be written, otherwise we would be measuring on every load.
+extern void InitFFTWfPlans(FFTWfPlanMode mode = FFTW_PLAN_ESTIMATE, const char* wisdom_path = NULL);
+
+// whether "plan" is as good as it's going to get: from the wisdom, measured or estimated when
+// not measuring (any thread, never blocks)
+extern bool FFTWfPlanFinal(int plan);
+
+// ask the planner thread to measure "plan" & swap it in, the estimated plan can be used until then
+// (any thread, never blocks)
+extern void RequestFFTWfPlan(int plan);
+
+// measure "plan" now if it isn't final yet (blocks while planning so not for the audio thread)
+extern bool /*true=success*/ WarmFFTWfPlan(int plan);
+
+// create (or re-create) all final plans now using "mode", throw error if failure
+// must not be called while anything is using the plans
+extern int /*number of plans measured*/ CreateFFTWfPlans(FFTWfPlanMode mode = FFTW_PLAN_ESTIMATE,
+                                                         const char* wisdom_path = NULL);
+
+// the planner thread measures requested plans in the background, it runs while there are any
+// users (each DtBlkFx instance is a user)
+extern void StartFFTWfPlanner();
+extern void StopFFTWfPlanner();
 
 #endif
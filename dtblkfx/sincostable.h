@@ -41,19 +41,23 @@ protected:
 
   static cplxf* table_()
   {
-    static bool init_table = true;
-    static cplxf ext_table[LEN + 2];
-    cplxf* table = ext_table + 1;
-    if (init_table) {
-      init_table = false;
-      for (long i = 0; i < LEN; i++)
-        table[i] = std::polar((float)1.0, (float)(i * 2.0 * 3.14159265358979323846 / LEN));
-
-      // allow overflows of 1 or -1
-      table[LEN] = table[0];
-      table[-1] = table[LEN - 1];
-    }
-    return table;
+    // filled by the first caller (thread safe static init) so tables can be used by any number
+    // of threads & from other static constructors
+    struct Table {
+      cplxf ext_table[LEN + 2];
+      Table()
+      {
+        cplxf* table = ext_table + 1;
+        for (long i = 0; i < LEN; i++)
+          table[i] = std::polar((float)1.0, (float)(i * 2.0 * 3.14159265358979323846 / LEN));
+
+        // allow overflows of 1 or -1
+        table[LEN] = table[0];
+        table[-1] = table[LEN - 1];
+      }
+    };
+    static Table t;
+    return t.ext_table + 1;
   }
 };
 
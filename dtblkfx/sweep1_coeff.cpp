@@ -1,15366 +0,0 @@
-#include <StdAfx.h>
-/*file generated by write_harm_data.m*/
-#include "HarmData.h"
-static float harm_data[120*128]={
-    (float)0.985267,
-    (float)8.60609e-07,
-    (float)0.012283,
-    (float)8.55749e-07,
-    (float)0.00162237,
-    (float)8.47713e-07,
-    (float)0.000433958,
-    (float)8.36601e-07,
-    (float)0.000164317,
-    (float)8.22546e-07,
-    (float)7.66039e-05,
-    (float)8.05718e-07,
-    (float)4.10142e-05,
-    (float)7.86317e-07,
-    (float)2.42301e-05,
-    (float)7.64572e-07,
-    (float)1.54015e-05,
-    (float)7.40737e-07,
-    (float)1.03568e-05,
-    (float)7.15085e-07,
-    (float)7.28146e-06,
-    (float)6.87908e-07,
-    (float)5.30723e-06,
-    (float)6.59505e-07,
-    (float)3.98559e-06,
-    (float)6.30184e-07,
-    (float)3.06984e-06,
-    (float)6.00255e-07,
-    (float)2.41698e-06,
-    (float)5.70023e-07,
-    (float)1.94034e-06,
-    (float)5.39787e-07,
-    (float)1.58529e-06,
-    (float)5.09833e-07,
-    (float)1.31625e-06,
-    (float)4.80429e-07,
-    (float)1.10933e-06,
-    (float)4.51826e-07,
-    (float)9.48089e-07,
-    (float)4.24248e-07,
-    (float)8.2092e-07,
-    (float)3.97897e-07,
-    (float)7.19475e-07,
-    (float)3.72943e-07,
-    (float)6.37639e-07,
-    (float)3.49528e-07,
-    (float)5.70864e-07,
-    (float)3.2776e-07,
-    (float)5.15724e-07,
-    (float)3.0772e-07,
-    (float)4.69611e-07,
-    (float)2.89453e-07,
-    (float)4.30525e-07,
-    (float)2.72976e-07,
-    (float)3.96925e-07,
-    (float)2.58275e-07,
-    (float)3.67619e-07,
-    (float)2.45308e-07,
-    (float)3.41691e-07,
-    (float)2.3401e-07,
-    (float)3.18434e-07,
-    (float)2.24289e-07,
-    (float)2.97314e-07,
-    (float)2.16038e-07,
-    (float)2.77926e-07,
-    (float)2.0913e-07,
-    (float)2.59976e-07,
-    (float)2.03426e-07,
-    (float)2.43249e-07,
-    (float)1.98779e-07,
-    (float)2.27601e-07,
-    (float)1.95034e-07,
-    (float)2.12937e-07,
-    (float)1.92036e-07,
-    (float)1.99203e-07,
-    (float)1.89632e-07,
-    (float)1.86371e-07,
-    (float)1.87672e-07,
-    (float)1.74436e-07,
-    (float)1.86014e-07,
-    (float)1.63403e-07,
-    (float)1.8453e-07,
-    (float)1.53286e-07,
-    (float)1.83101e-07,
-    (float)1.44098e-07,
-    (float)1.81626e-07,
-    (float)1.3585e-07,
-    (float)1.8002e-07,
-    (float)1.28547e-07,
-    (float)1.78216e-07,
-    (float)1.22183e-07,
-    (float)1.76166e-07,
-    (float)1.16745e-07,
-    (float)1.7384e-07,
-    (float)1.12205e-07,
-    (float)1.71226e-07,
-    (float)1.08526e-07,
-    (float)1.6833e-07,
-    (float)1.05656e-07,
-    (float)1.65176e-07,
-    (float)1.03535e-07,
-    (float)1.618e-07,
-    (float)1.0209e-07,
-    (float)1.58253e-07,
-    (float)1.01243e-07,
-    (float)1.54595e-07,
-    (float)1.00907e-07,
-    (float)1.50897e-07,
-    (float)1.00991e-07,
-    (float)1.47232e-07,
-    (float)1.01403e-07,
-    (float)1.43679e-07,
-    (float)1.02051e-07,
-    (float)1.40318e-07,
-    (float)1.02845e-07,
-    (float)1.37223e-07,
-    (float)1.03701e-07,
-    (float)1.34467e-07,
-    (float)1.04543e-07,
-    (float)1.32116e-07,
-    (float)1.05302e-07,
-    (float)1.30226e-07,
-    (float)1.05923e-07,
-    (float)1.28842e-07,
-    (float)1.06362e-07,
-    (float)1.27997e-07,
-    (float)1.06588e-07,
-    (float)1.27714e-07,
-    (float)0.984308,
-    (float)0.00131136,
-    (float)0.011663,
-    (float)7.1955e-07,
-    (float)0.0018289,
-    (float)1.31373e-05,
-    (float)0.000500053,
-    (float)1.0255e-06,
-    (float)0.000148373,
-    (float)3.66149e-06,
-    (float)6.67343e-05,
-    (float)6.3787e-07,
-    (float)4.66944e-05,
-    (float)5.38942e-07,
-    (float)2.84299e-05,
-    (float)8.28477e-07,
-    (float)1.36652e-05,
-    (float)1.28821e-06,
-    (float)8.79127e-06,
-    (float)6.17686e-07,
-    (float)8.0783e-06,
-    (float)3.80555e-07,
-    (float)6.08797e-06,
-    (float)6.56298e-07,
-    (float)3.55473e-06,
-    (float)8.57843e-07,
-    (float)2.6562e-06,
-    (float)5.57831e-07,
-    (float)2.60565e-06,
-    (float)3.71097e-07,
-    (float)2.11827e-06,
-    (float)5.0058e-07,
-    (float)1.4183e-06,
-    (float)6.11576e-07,
-    (float)1.18889e-06,
-    (float)4.71012e-07,
-    (float)1.17836e-06,
-    (float)3.42152e-07,
-    (float)9.7636e-07,
-    (float)3.75085e-07,
-    (float)7.2584e-07,
-    (float)4.29992e-07,
-    (float)6.73351e-07,
-    (float)3.75706e-07,
-    (float)6.7607e-07,
-    (float)3.01952e-07,
-    (float)5.63737e-07,
-    (float)2.85441e-07,
-    (float)4.49058e-07,
-    (float)2.99768e-07,
-    (float)4.44567e-07,
-    (float)2.91296e-07,
-    (float)4.52906e-07,
-    (float)2.62855e-07,
-    (float)3.85599e-07,
-    (float)2.28947e-07,
-    (float)3.21268e-07,
-    (float)2.18305e-07,
-    (float)3.21232e-07,
-    (float)2.3039e-07,
-    (float)3.28249e-07,
-    (float)2.30432e-07,
-    (float)2.89014e-07,
-    (float)1.97261e-07,
-    (float)2.47989e-07,
-    (float)1.77383e-07,
-    (float)2.42383e-07,
-    (float)1.94777e-07,
-    (float)2.43018e-07,
-    (float)2.07786e-07,
-    (float)2.20964e-07,
-    (float)1.82713e-07,
-    (float)1.96303e-07,
-    (float)1.63102e-07,
-    (float)1.8608e-07,
-    (float)1.78276e-07,
-    (float)1.7975e-07,
-    (float)1.92691e-07,
-    (float)1.67965e-07,
-    (float)1.7616e-07,
-    (float)1.55276e-07,
-    (float)1.61768e-07,
-    (float)1.44119e-07,
-    (float)1.71475e-07,
-    (float)1.35147e-07,
-    (float)1.80539e-07,
-    (float)1.29709e-07,
-    (float)1.70853e-07,
-    (float)1.23616e-07,
-    (float)1.6253e-07,
-    (float)1.14363e-07,
-    (float)1.65279e-07,
-    (float)1.08765e-07,
-    (float)1.67252e-07,
-    (float)1.07668e-07,
-    (float)1.63494e-07,
-    (float)1.0194e-07,
-    (float)1.59564e-07,
-    (float)9.5153e-08,
-    (float)1.53911e-07,
-    (float)9.9368e-08,
-    (float)1.51194e-07,
-    (float)1.00942e-07,
-    (float)1.53773e-07,
-    (float)9.1097e-08,
-    (float)1.51247e-07,
-    (float)8.93447e-08,
-    (float)1.41035e-07,
-    (float)9.67369e-08,
-    (float)1.36045e-07,
-    (float)9.70133e-08,
-    (float)1.39679e-07,
-    (float)9.14001e-08,
-    (float)1.3888e-07,
-    (float)9.32327e-08,
-    (float)1.30228e-07,
-    (float)9.81979e-08,
-    (float)1.25462e-07,
-    (float)9.65519e-08,
-    (float)1.2762e-07,
-    (float)9.43661e-08,
-    (float)1.27851e-07,
-    (float)9.80149e-08,
-    (float)1.24147e-07,
-    (float)9.97007e-08,
-    (float)1.22522e-07,
-    (float)9.63238e-08,
-    (float)1.22829e-07,
-    (float)0.980239,
-    (float)0.00570912,
-    (float)0.0110181,
-    (float)1.19066e-06,
-    (float)0.00204337,
-    (float)5.53525e-05,
-    (float)0.000568179,
-    (float)1.20849e-06,
-    (float)0.000133567,
-    (float)1.05568e-05,
-    (float)5.8005e-05,
-    (float)5.81517e-07,
-    (float)5.2185e-05,
-    (float)1.04837e-06,
-    (float)3.25244e-05,
-    (float)8.78627e-07,
-    (float)1.21827e-05,
-    (float)2.0781e-06,
-    (float)7.50021e-06,
-    (float)5.66509e-07,
-    (float)8.74713e-06,
-    (float)2.09185e-07,
-    (float)6.80145e-06,
-    (float)6.47591e-07,
-    (float)3.21353e-06,
-    (float)1.08153e-06,
-    (float)2.31802e-06,
-    (float)5.30813e-07,
-    (float)2.72674e-06,
-    (float)2.3327e-07,
-    (float)2.27394e-06,
-    (float)4.64771e-07,
-    (float)1.29573e-06,
-    (float)6.86997e-07,
-    (float)1.07449e-06,
-    (float)4.60576e-07,
-    (float)1.20773e-06,
-    (float)2.67092e-07,
-    (float)1.00328e-06,
-    (float)3.33562e-07,
-    (float)6.58924e-07,
-    (float)4.43408e-07,
-    (float)6.22726e-07,
-    (float)3.7197e-07,
-    (float)6.87557e-07,
-    (float)2.72939e-07,
-    (float)5.59854e-07,
-    (float)2.50065e-07,
-    (float)4.02243e-07,
-    (float)2.83516e-07,
-    (float)4.1372e-07,
-    (float)2.85914e-07,
-    (float)4.55392e-07,
-    (float)2.60454e-07,
-    (float)3.75289e-07,
-    (float)2.05775e-07,
-    (float)2.90412e-07,
-    (float)1.89395e-07,
-    (float)3.00448e-07,
-    (float)2.19797e-07,
-    (float)3.21312e-07,
-    (float)2.39376e-07,
-    (float)2.76207e-07,
-    (float)1.82619e-07,
-    (float)2.29345e-07,
-    (float)1.45865e-07,
-    (float)2.28629e-07,
-    (float)1.82301e-07,
-    (float)2.31661e-07,
-    (float)2.17425e-07,
-    (float)2.07999e-07,
-    (float)1.71171e-07,
-    (float)1.85453e-07,
-    (float)1.34707e-07,
-    (float)1.76834e-07,
-    (float)1.66081e-07,
-    (float)1.67979e-07,
-    (float)1.97743e-07,
-    (float)1.57059e-07,
-    (float)1.6521e-07,
-    (float)1.47888e-07,
-    (float)1.39051e-07,
-    (float)1.36002e-07,
-    (float)1.59627e-07,
-    (float)1.26121e-07,
-    (float)1.79243e-07,
-    (float)1.23127e-07,
-    (float)1.6126e-07,
-    (float)1.1574e-07,
-    (float)1.46857e-07,
-    (float)1.03832e-07,
-    (float)1.52605e-07,
-    (float)1.03965e-07,
-    (float)1.59734e-07,
-    (float)1.06928e-07,
-    (float)1.57152e-07,
-    (float)9.11358e-08,
-    (float)1.51062e-07,
-    (float)8.01212e-08,
-    (float)1.40172e-07,
-    (float)9.75921e-08,
-    (float)1.39411e-07,
-    (float)1.02815e-07,
-    (float)1.49756e-07,
-    (float)8.03225e-08,
-    (float)1.47998e-07,
-    (float)7.59208e-08,
-    (float)1.30489e-07,
-    (float)9.1255e-08,
-    (float)1.2369e-07,
-    (float)9.3962e-08,
-    (float)1.34895e-07,
-    (float)8.21448e-08,
-    (float)1.37508e-07,
-    (float)8.15969e-08,
-    (float)1.22624e-07,
-    (float)9.00831e-08,
-    (float)1.15673e-07,
-    (float)9.02391e-08,
-    (float)1.2293e-07,
-    (float)8.5706e-08,
-    (float)1.25114e-07,
-    (float)8.75589e-08,
-    (float)1.18186e-07,
-    (float)9.00989e-08,
-    (float)1.16543e-07,
-    (float)8.82339e-08,
-    (float)1.18151e-07,
-    (float)0.972274,
-    (float)0.0139842,
-    (float)0.0103465,
-    (float)2.29277e-06,
-    (float)0.00226206,
-    (float)0.000130435,
-    (float)0.000636847,
-    (float)1.37573e-06,
-    (float)0.000119818,
-    (float)2.13827e-05,
-    (float)5.03198e-05,
-    (float)6.21624e-07,
-    (float)5.73298e-05,
-    (float)2.18207e-06,
-    (float)3.63862e-05,
-    (float)9.14326e-07,
-    (float)1.09102e-05,
-    (float)3.01836e-06,
-    (float)6.42742e-06,
-    (float)5.48804e-07,
-    (float)9.27365e-06,
-    (float)1.3437e-07,
-    (float)7.43098e-06,
-    (float)6.3381e-07,
-    (float)2.93877e-06,
-    (float)1.27396e-06,
-    (float)2.02824e-06,
-    (float)5.11994e-07,
-    (float)2.7833e-06,
-    (float)1.42568e-07,
-    (float)2.4087e-06,
-    (float)4.31642e-07,
-    (float)1.20487e-06,
-    (float)7.30108e-07,
-    (float)9.62899e-07,
-    (float)4.46373e-07,
-    (float)1.20068e-06,
-    (float)2.20846e-07,
-    (float)1.03015e-06,
-    (float)2.98819e-07,
-    (float)6.12695e-07,
-    (float)4.38748e-07,
-    (float)5.653e-07,
-    (float)3.59642e-07,
-    (float)6.74886e-07,
-    (float)2.59856e-07,
-    (float)5.60106e-07,
-    (float)2.22127e-07,
-    (float)3.68869e-07,
-    (float)2.61051e-07,
-    (float)3.75228e-07,
-    (float)2.73489e-07,
-    (float)4.44458e-07,
-    (float)2.64985e-07,
-    (float)3.67974e-07,
-    (float)1.85721e-07,
-    (float)2.66126e-07,
-    (float)1.59709e-07,
-    (float)2.76815e-07,
-    (float)2.0609e-07,
-    (float)3.04546e-07,
-    (float)2.52063e-07,
-    (float)2.60936e-07,
-    (float)1.68483e-07,
-    (float)2.16249e-07,
-    (float)1.14491e-07,
-    (float)2.16918e-07,
-    (float)1.68869e-07,
-    (float)2.1264e-07,
-    (float)2.29611e-07,
-    (float)1.89698e-07,
-    (float)1.58585e-07,
-    (float)1.78147e-07,
-    (float)1.05855e-07,
-    (float)1.7079e-07,
-    (float)1.53994e-07,
-    (float)1.52459e-07,
-    (float)2.044e-07,
-    (float)1.42134e-07,
-    (float)1.52773e-07,
-    (float)1.41135e-07,
-    (float)1.15891e-07,
-    (float)1.29352e-07,
-    (float)1.47901e-07,
-    (float)1.17359e-07,
-    (float)1.78039e-07,
-    (float)1.16182e-07,
-    (float)1.50414e-07,
-    (float)1.06062e-07,
-    (float)1.31093e-07,
-    (float)9.25436e-08,
-    (float)1.39718e-07,
-    (float)1.01752e-07,
-    (float)1.51102e-07,
-    (float)1.0868e-07,
-    (float)1.4997e-07,
-    (float)7.84538e-08,
-    (float)1.43044e-07,
-    (float)6.49117e-08,
-    (float)1.26289e-07,
-    (float)9.6105e-08,
-    (float)1.26002e-07,
-    (float)1.0413e-07,
-    (float)1.44898e-07,
-    (float)7.07284e-08,
-    (float)1.43953e-07,
-    (float)6.33895e-08,
-    (float)1.18726e-07,
-    (float)8.33014e-08,
-    (float)1.11373e-07,
-    (float)9.07899e-08,
-    (float)1.30676e-07,
-    (float)7.45931e-08,
-    (float)1.35207e-07,
-    (float)6.89033e-08,
-    (float)1.1325e-07,
-    (float)7.97675e-08,
-    (float)1.05751e-07,
-    (float)8.52377e-08,
-    (float)1.1868e-07,
-    (float)7.87315e-08,
-    (float)1.21938e-07,
-    (float)7.49527e-08,
-    (float)1.10563e-07,
-    (float)7.82125e-08,
-    (float)1.10286e-07,
-    (float)8.20143e-08,
-    (float)1.13857e-07,
-    (float)0.959543,
-    (float)0.0270152,
-    (float)0.00964679,
-    (float)4.03584e-06,
-    (float)0.0024799,
-    (float)0.000240349,
-    (float)0.000704219,
-    (float)1.51865e-06,
-    (float)0.000107033,
-    (float)3.57977e-05,
-    (float)4.35732e-05,
-    (float)7.44179e-07,
-    (float)6.19847e-05,
-    (float)3.76543e-06,
-    (float)3.99027e-05,
-    (float)9.31561e-07,
-    (float)9.79914e-06,
-    (float)4.01121e-06,
-    (float)5.52213e-06,
-    (float)5.56548e-07,
-    (float)9.6512e-06,
-    (float)1.1781e-07,
-    (float)7.97172e-06,
-    (float)6.15313e-07,
-    (float)2.71203e-06,
-    (float)1.41302e-06,
-    (float)1.76729e-06,
-    (float)4.97198e-07,
-    (float)2.77655e-06,
-    (float)8.84563e-08,
-    (float)2.52639e-06,
-    (float)4.02199e-07,
-    (float)1.13857e-06,
-    (float)7.37408e-07,
-    (float)8.48426e-07,
-    (float)4.26367e-07,
-    (float)1.15855e-06,
-    (float)2.00037e-07,
-    (float)1.05826e-06,
-    (float)2.7072e-07,
-    (float)5.8343e-07,
-    (float)4.17702e-07,
-    (float)4.99938e-07,
-    (float)3.37968e-07,
-    (float)6.39488e-07,
-    (float)2.62061e-07,
-    (float)5.62637e-07,
-    (float)2.00867e-07,
-    (float)3.47425e-07,
-    (float)2.33013e-07,
-    (float)3.33631e-07,
-    (float)2.55783e-07,
-    (float)4.19969e-07,
-    (float)2.79452e-07,
-    (float)3.60443e-07,
-    (float)1.66105e-07,
-    (float)2.46799e-07,
-    (float)1.29771e-07,
-    (float)2.51403e-07,
-    (float)1.922e-07,
-    (float)2.82727e-07,
-    (float)2.71897e-07,
-    (float)2.44004e-07,
-    (float)1.53038e-07,
-    (float)2.0434e-07,
-    (float)8.29605e-08,
-    (float)2.05928e-07,
-    (float)1.55814e-07,
-    (float)1.9086e-07,
-    (float)2.47876e-07,
-    (float)1.67714e-07,
-    (float)1.44479e-07,
-    (float)1.72358e-07,
-    (float)7.61627e-08,
-    (float)1.67088e-07,
-    (float)1.42363e-07,
-    (float)1.3577e-07,
-    (float)2.14414e-07,
-    (float)1.24711e-07,
-    (float)1.3869e-07,
-    (float)1.35658e-07,
-    (float)9.20245e-08,
-    (float)1.24964e-07,
-    (float)1.36345e-07,
-    (float)1.09876e-07,
-    (float)1.76916e-07,
-    (float)1.09788e-07,
-    (float)1.38453e-07,
-    (float)9.63934e-08,
-    (float)1.1603e-07,
-    (float)8.30511e-08,
-    (float)1.26326e-07,
-    (float)1.0191e-07,
-    (float)1.39517e-07,
-    (float)1.11894e-07,
-    (float)1.42242e-07,
-    (float)6.56079e-08,
-    (float)1.36232e-07,
-    (float)5.2602e-08,
-    (float)1.13055e-07,
-    (float)9.39701e-08,
-    (float)1.10251e-07,
-    (float)1.03634e-07,
-    (float)1.37209e-07,
-    (float)6.16825e-08,
-    (float)1.40552e-07,
-    (float)5.18123e-08,
-    (float)1.07273e-07,
-    (float)7.46641e-08,
-    (float)9.82053e-08,
-    (float)8.82456e-08,
-    (float)1.26501e-07,
-    (float)6.74797e-08,
-    (float)1.32363e-07,
-    (float)5.52038e-08,
-    (float)1.01866e-07,
-    (float)6.79006e-08,
-    (float)9.61773e-08,
-    (float)8.1817e-08,
-    (float)1.156e-07,
-    (float)7.33834e-08,
-    (float)1.1836e-07,
-    (float)6.05942e-08,
-    (float)1.00481e-07,
-    (float)6.43212e-08,
-    (float)1.04087e-07,
-    (float)7.77404e-08,
-    (float)1.10687e-07,
-    (float)0.941127,
-    (float)0.045731,
-    (float)0.00891852,
-    (float)6.41912e-06,
-    (float)0.00268978,
-    (float)0.000385469,
-    (float)0.000768134,
-    (float)1.65052e-06,
-    (float)9.52594e-05,
-    (float)5.31881e-05,
-    (float)3.76516e-05,
-    (float)9.33483e-07,
-    (float)6.58743e-05,
-    (float)5.58739e-06,
-    (float)4.29511e-05,
-    (float)9.38833e-07,
-    (float)8.85064e-06,
-    (float)4.95008e-06,
-    (float)4.74542e-06,
-    (float)5.78751e-07,
-    (float)9.84119e-06,
-    (float)1.24629e-07,
-    (float)8.40575e-06,
-    (float)5.92726e-07,
-    (float)2.53059e-06,
-    (float)1.48039e-06,
-    (float)1.52596e-06,
-    (float)4.79067e-07,
-    (float)2.7016e-06,
-    (float)6.4568e-08,
-    (float)2.61725e-06,
-    (float)3.74772e-07,
-    (float)1.09251e-06,
-    (float)7.10887e-07,
-    (float)7.33056e-07,
-    (float)3.96979e-07,
-    (float)1.08416e-06,
-    (float)2.01381e-07,
-    (float)1.0807e-06,
-    (float)2.47929e-07,
-    (float)5.65528e-07,
-    (float)3.87111e-07,
-    (float)4.32948e-07,
-    (float)3.09676e-07,
-    (float)5.84954e-07,
-    (float)2.76116e-07,
-    (float)5.60691e-07,
-    (float)1.82781e-07,
-    (float)3.37517e-07,
-    (float)2.06423e-07,
-    (float)2.97428e-07,
-    (float)2.34541e-07,
-    (float)3.78036e-07,
-    (float)2.99971e-07,
-    (float)3.44334e-07,
-    (float)1.47868e-07,
-    (float)2.34986e-07,
-    (float)1.04256e-07,
-    (float)2.31017e-07,
-    (float)1.78555e-07,
-    (float)2.55209e-07,
-    (float)2.95959e-07,
-    (float)2.20153e-07,
-    (float)1.34011e-07,
-    (float)1.93229e-07,
-    (float)5.55956e-08,
-    (float)1.99448e-07,
-    (float)1.46262e-07,
-    (float)1.69024e-07,
-    (float)2.71229e-07,
-    (float)1.40162e-07,
-    (float)1.26105e-07,
-    (float)1.66238e-07,
-    (float)4.80153e-08,
-    (float)1.68344e-07,
-    (float)1.32807e-07,
-    (float)1.20792e-07,
-    (float)2.27622e-07,
-    (float)1.04104e-07,
-    (float)1.22559e-07,
-    (float)1.30538e-07,
-    (float)6.95685e-08,
-    (float)1.2597e-07,
-    (float)1.2498e-07,
-    (float)1.05158e-07,
-    (float)1.73188e-07,
-    (float)1.0308e-07,
-    (float)1.25242e-07,
-    (float)8.71765e-08,
-    (float)1.04025e-07,
-    (float)7.90586e-08,
-    (float)1.14215e-07,
-    (float)1.03947e-07,
-    (float)1.22241e-07,
-    (float)1.13082e-07,
-    (float)1.30861e-07,
-    (float)5.36053e-08,
-    (float)1.32603e-07,
-    (float)4.55892e-08,
-    (float)1.02097e-07,
-    (float)9.00332e-08,
-    (float)9.23886e-08,
-    (float)9.84882e-08,
-    (float)1.26168e-07,
-    (float)5.23554e-08,
-    (float)1.37686e-07,
-    (float)4.2155e-08,
-    (float)9.80526e-08,
-    (float)6.78252e-08,
-    (float)8.52064e-08,
-    (float)8.57862e-08,
-    (float)1.18006e-07,
-    (float)5.80149e-08,
-    (float)1.28476e-07,
-    (float)4.19789e-08,
-    (float)9.26103e-08,
-    (float)5.79921e-08,
-    (float)8.78489e-08,
-    (float)7.83683e-08,
-    (float)1.09862e-07,
-    (float)6.66132e-08,
-    (float)1.13318e-07,
-    (float)4.68885e-08,
-    (float)9.08146e-08,
-    (float)5.15479e-08,
-    (float)9.82961e-08,
-    (float)7.28025e-08,
-    (float)1.06143e-07,
-    (float)0.916149,
-    (float)0.0710285,
-    (float)0.00816209,
-    (float)9.38327e-06,
-    (float)0.0028813,
-    (float)0.000562359,
-    (float)0.000825957,
-    (float)1.7392e-06,
-    (float)8.49071e-05,
-    (float)7.21264e-05,
-    (float)3.25408e-05,
-    (float)1.16295e-06,
-    (float)6.83174e-05,
-    (float)7.28778e-06,
-    (float)4.52412e-05,
-    (float)9.22139e-07,
-    (float)8.21155e-06,
-    (float)5.66282e-06,
-    (float)4.12614e-06,
-    (float)6.01755e-07,
-    (float)9.65355e-06,
-    (float)1.26081e-07,
-    (float)8.62012e-06,
-    (float)5.62182e-07,
-    (float)2.46462e-06,
-    (float)1.47364e-06,
-    (float)1.33541e-06,
-    (float)4.51186e-07,
-    (float)2.50107e-06,
-    (float)6.52483e-08,
-    (float)2.63129e-06,
-    (float)3.51431e-07,
-    (float)1.09234e-06,
-    (float)6.74035e-07,
-    (float)6.44632e-07,
-    (float)3.53848e-07,
-    (float)9.65428e-07,
-    (float)2.13141e-07,
-    (float)1.06487e-06,
-    (float)2.34873e-07,
-    (float)5.64842e-07,
-    (float)3.65168e-07,
-    (float)3.92878e-07,
-    (float)2.70571e-07,
-    (float)5.09991e-07,
-    (float)2.88098e-07,
-    (float)5.23793e-07,
-    (float)1.74223e-07,
-    (float)3.39835e-07,
-    (float)1.90546e-07,
-    (float)2.92805e-07,
-    (float)2.03583e-07,
-    (float)3.16268e-07,
-    (float)3.05789e-07,
-    (float)2.90265e-07,
-    (float)1.37336e-07,
-    (float)2.35878e-07,
-    (float)9.03225e-08,
-    (float)2.39819e-07,
-    (float)1.60488e-07,
-    (float)2.15478e-07,
-    (float)2.93024e-07,
-    (float)1.70911e-07,
-    (float)1.16216e-07,
-    (float)1.86152e-07,
-    (float)4.30913e-08,
-    (float)2.08414e-07,
-    (float)1.37645e-07,
-    (float)1.45314e-07,
-    (float)2.62156e-07,
-    (float)1.06098e-07,
-    (float)1.04944e-07,
-    (float)1.56269e-07,
-    (float)3.65981e-08,
-    (float)1.72868e-07,
-    (float)1.27513e-07,
-    (float)1.05601e-07,
-    (float)2.11971e-07,
-    (float)8.54987e-08,
-    (float)1.00411e-07,
-    (float)1.21235e-07,
-    (float)6.06661e-08,
-    (float)1.25808e-07,
-    (float)1.20304e-07,
-    (float)9.39513e-08,
-    (float)1.5211e-07,
-    (float)9.43361e-08,
-    (float)1.04701e-07,
-    (float)7.91608e-08,
-    (float)9.84216e-08,
-    (float)7.51831e-08,
-    (float)1.08743e-07,
-    (float)9.23121e-08,
-    (float)1.00973e-07,
-    (float)1.02765e-07,
-    (float)1.1179e-07,
-    (float)4.73676e-08,
-    (float)1.2749e-07,
-    (float)4.15144e-08,
-    (float)9.71652e-08,
-    (float)7.52558e-08,
-    (float)7.88353e-08,
-    (float)8.22968e-08,
-    (float)1.10861e-07,
-    (float)4.78117e-08,
-    (float)1.27315e-07,
-    (float)3.61342e-08,
-    (float)8.90511e-08,
-    (float)5.94603e-08,
-    (float)7.48577e-08,
-    (float)7.78398e-08,
-    (float)1.10881e-07,
-    (float)4.68005e-08,
-    (float)1.19672e-07,
-    (float)3.24421e-08,
-    (float)7.98883e-08,
-    (float)5.30728e-08,
-    (float)7.78726e-08,
-    (float)7.06125e-08,
-    (float)1.0848e-07,
-    (float)5.3829e-08,
-    (float)1.0503e-07,
-    (float)3.80406e-08,
-    (float)7.50083e-08,
-    (float)4.55464e-08,
-    (float)8.91998e-08,
-    (float)6.2391e-08,
-    (float)1.0798e-07,
-    (float)0.883809,
-    (float)0.103718,
-    (float)0.00738419,
-    (float)1.28829e-05,
-    (float)0.00304669,
-    (float)0.000766838,
-    (float)0.000874558,
-    (float)1.79509e-06,
-    (float)7.55037e-05,
-    (float)9.16378e-05,
-    (float)2.81051e-05,
-    (float)1.42083e-06,
-    (float)6.94932e-05,
-    (float)8.70772e-06,
-    (float)4.67868e-05,
-    (float)8.94687e-07,
-    (float)7.69748e-06,
-    (float)6.11354e-06,
-    (float)3.58132e-06,
-    (float)6.23969e-07,
-    (float)9.24501e-06,
-    (float)1.18573e-07,
-    (float)8.72212e-06,
-    (float)5.3463e-07,
-    (float)2.42617e-06,
-    (float)1.39803e-06,
-    (float)1.14668e-06,
-    (float)4.16756e-07,
-    (float)2.25333e-06,
-    (float)9.31143e-08,
-    (float)2.63821e-06,
-    (float)3.34633e-07,
-    (float)1.09524e-06,
-    (float)6.20578e-07,
-    (float)5.51512e-07,
-    (float)3.08632e-07,
-    (float)8.34753e-07,
-    (float)2.4533e-07,
-    (float)1.05078e-06,
-    (float)2.26654e-07,
-    (float)5.65245e-07,
-    (float)3.38997e-07,
-    (float)3.51142e-07,
-    (float)2.31968e-07,
-    (float)4.34911e-07,
-    (float)3.11899e-07,
-    (float)4.87667e-07,
-    (float)1.65555e-07,
-    (float)3.36914e-07,
-    (float)1.80873e-07,
-    (float)2.86257e-07,
-    (float)1.75382e-07,
-    (float)2.60089e-07,
-    (float)3.15895e-07,
-    (float)2.33209e-07,
-    (float)1.26376e-07,
-    (float)2.36991e-07,
-    (float)8.30199e-08,
-    (float)2.57357e-07,
-    (float)1.44244e-07,
-    (float)1.71862e-07,
-    (float)2.8478e-07,
-    (float)1.17205e-07,
-    (float)9.86541e-08,
-    (float)1.83919e-07,
-    (float)3.53137e-08,
-    (float)2.25638e-07,
-    (float)1.30027e-07,
-    (float)1.18003e-07,
-    (float)2.3958e-07,
-    (float)7.14619e-08,
-    (float)8.27584e-08,
-    (float)1.48891e-07,
-    (float)3.10367e-08,
-    (float)1.8229e-07,
-    (float)1.23781e-07,
-    (float)8.80283e-08,
-    (float)1.821e-07,
-    (float)6.80287e-08,
-    (float)7.83364e-08,
-    (float)1.12145e-07,
-    (float)5.85e-08,
-    (float)1.26648e-07,
-    (float)1.15834e-07,
-    (float)8.06619e-08,
-    (float)1.20723e-07,
-    (float)8.48709e-08,
-    (float)8.39538e-08,
-    (float)7.01046e-08,
-    (float)9.82906e-08,
-    (float)7.02953e-08,
-    (float)1.03471e-07,
-    (float)7.68281e-08,
-    (float)7.73289e-08,
-    (float)8.91712e-08,
-    (float)9.3451e-08,
-    (float)4.25019e-08,
-    (float)1.22109e-07,
-    (float)3.64625e-08,
-    (float)9.20846e-08,
-    (float)6.07732e-08,
-    (float)6.62973e-08,
-    (float)7.00012e-08,
-    (float)9.68131e-08,
-    (float)4.04558e-08,
-    (float)1.14559e-07,
-    (float)2.66566e-08,
-    (float)7.91381e-08,
-    (float)5.5364e-08,
-    (float)6.58847e-08,
-    (float)7.35875e-08,
-    (float)1.04638e-07,
-    (float)3.38347e-08,
-    (float)1.07479e-07,
-    (float)2.28516e-08,
-    (float)6.64669e-08,
-    (float)5.02824e-08,
-    (float)6.8764e-08,
-    (float)6.40916e-08,
-    (float)1.07714e-07,
-    (float)4.04299e-08,
-    (float)9.46236e-08,
-    (float)3.03661e-08,
-    (float)5.92927e-08,
-    (float)4.15313e-08,
-    (float)7.94555e-08,
-    (float)5.20906e-08,
-    (float)1.0873e-07,
-    (float)0.843552,
-    (float)0.144368,
-    (float)0.00659219,
-    (float)1.67846e-05,
-    (float)0.00317603,
-    (float)0.000990901,
-    (float)0.000910849,
-    (float)1.83281e-06,
-    (float)6.6878e-05,
-    (float)0.000110274,
-    (float)2.42736e-05,
-    (float)1.69027e-06,
-    (float)6.93753e-05,
-    (float)9.64359e-06,
-    (float)4.75049e-05,
-    (float)8.65766e-07,
-    (float)7.24969e-06,
-    (float)6.22997e-06,
-    (float)3.08388e-06,
-    (float)6.49167e-07,
-    (float)8.66386e-06,
-    (float)1.03014e-07,
-    (float)8.72276e-06,
-    (float)5.12699e-07,
-    (float)2.39587e-06,
-    (float)1.2493e-06,
-    (float)9.57077e-07,
-    (float)3.86431e-07,
-    (float)1.96488e-06,
-    (float)1.54926e-07,
-    (float)2.62979e-06,
-    (float)3.23299e-07,
-    (float)1.11036e-06,
-    (float)5.50071e-07,
-    (float)4.6029e-07,
-    (float)2.67293e-07,
-    (float)6.84521e-07,
-    (float)3.01262e-07,
-    (float)1.02358e-06,
-    (float)2.20652e-07,
-    (float)5.80234e-07,
-    (float)3.15258e-07,
-    (float)3.15918e-07,
-    (float)1.97807e-07,
-    (float)3.50794e-07,
-    (float)3.39686e-07,
-    (float)4.45228e-07,
-    (float)1.54343e-07,
-    (float)3.32634e-07,
-    (float)1.7823e-07,
-    (float)2.79255e-07,
-    (float)1.56163e-07,
-    (float)2.10915e-07,
-    (float)3.28086e-07,
-    (float)1.8383e-07,
-    (float)1.10735e-07,
-    (float)2.32898e-07,
-    (float)8.02129e-08,
-    (float)2.72729e-07,
-    (float)1.32625e-07,
-    (float)1.32841e-07,
-    (float)2.75255e-07,
-    (float)7.14159e-08,
-    (float)8.08907e-08,
-    (float)1.81661e-07,
-    (float)3.11598e-08,
-    (float)2.4472e-07,
-    (float)1.22329e-07,
-    (float)9.18415e-08,
-    (float)2.05119e-07,
-    (float)4.30541e-08,
-    (float)6.2778e-08,
-    (float)1.4161e-07,
-    (float)3.15439e-08,
-    (float)1.93568e-07,
-    (float)1.17921e-07,
-    (float)7.24167e-08,
-    (float)1.37095e-07,
-    (float)5.44941e-08,
-    (float)5.86667e-08,
-    (float)1.00272e-07,
-    (float)6.44955e-08,
-    (float)1.2777e-07,
-    (float)1.09807e-07,
-    (float)6.74326e-08,
-    (float)8.18514e-08,
-    (float)7.31943e-08,
-    (float)6.55382e-08,
-    (float)5.84326e-08,
-    (float)1.03022e-07,
-    (float)6.49275e-08,
-    (float)9.81239e-08,
-    (float)6.25699e-08,
-    (float)5.52931e-08,
-    (float)7.26167e-08,
-    (float)7.67144e-08,
-    (float)3.73357e-08,
-    (float)1.12138e-07,
-    (float)3.13499e-08,
-    (float)8.46312e-08,
-    (float)4.84186e-08,
-    (float)5.76224e-08,
-    (float)6.01693e-08,
-    (float)8.57168e-08,
-    (float)3.23814e-08,
-    (float)9.96329e-08,
-    (float)1.70506e-08,
-    (float)6.79454e-08,
-    (float)5.08634e-08,
-    (float)5.76458e-08,
-    (float)6.92357e-08,
-    (float)9.85361e-08,
-    (float)2.3876e-08,
-    (float)9.47279e-08,
-    (float)1.56626e-08,
-    (float)5.43199e-08,
-    (float)4.6035e-08,
-    (float)6.0013e-08,
-    (float)5.60941e-08,
-    (float)1.04199e-07,
-    (float)3.03327e-08,
-    (float)8.26319e-08,
-    (float)2.53033e-08,
-    (float)4.59133e-08,
-    (float)3.73356e-08,
-    (float)6.95777e-08,
-    (float)4.2478e-08,
-    (float)1.06805e-07,
-    (float)0.795199,
-    (float)0.193174,
-    (float)0.00579764,
-    (float)2.09508e-05,
-    (float)0.00326038,
-    (float)0.00122304,
-    (float)0.000931885,
-    (float)1.84381e-06,
-    (float)5.88672e-05,
-    (float)0.000126356,
-    (float)2.0943e-05,
-    (float)1.9524e-06,
-    (float)6.79984e-05,
-    (float)9.89806e-06,
-    (float)4.73237e-05,
-    (float)8.36032e-07,
-    (float)6.81604e-06,
-    (float)5.94126e-06,
-    (float)2.62529e-06,
-    (float)6.69807e-07,
-    (float)7.96089e-06,
-    (float)8.83458e-08,
-    (float)8.58897e-06,
-    (float)4.92835e-07,
-    (float)2.35657e-06,
-    (float)1.02301e-06,
-    (float)7.73741e-07,
-    (float)3.595e-07,
-    (float)1.65904e-06,
-    (float)2.57846e-07,
-    (float)2.59067e-06,
-    (float)3.12635e-07,
-    (float)1.1198e-06,
-    (float)4.63447e-07,
-    (float)3.69262e-07,
-    (float)2.34042e-07,
-    (float)5.40468e-07,
-    (float)3.84189e-07,
-    (float)9.92459e-07,
-    (float)2.12082e-07,
-    (float)5.91216e-07,
-    (float)2.92035e-07,
-    (float)2.78615e-07,
-    (float)1.70596e-07,
-    (float)2.6917e-07,
-    (float)3.7743e-07,
-    (float)4.0556e-07,
-    (float)1.42284e-07,
-    (float)3.27323e-07,
-    (float)1.74608e-07,
-    (float)2.65175e-07,
-    (float)1.39234e-07,
-    (float)1.6559e-07,
-    (float)3.43087e-07,
-    (float)1.46257e-07,
-    (float)9.54177e-08,
-    (float)2.22835e-07,
-    (float)7.81742e-08,
-    (float)2.74792e-07,
-    (float)1.19495e-07,
-    (float)1.00758e-07,
-    (float)2.6222e-07,
-    (float)3.88411e-08,
-    (float)6.52197e-08,
-    (float)1.75389e-07,
-    (float)2.91885e-08,
-    (float)2.57093e-07,
-    (float)1.1156e-07,
-    (float)6.81807e-08,
-    (float)1.61075e-07,
-    (float)2.49994e-08,
-    (float)4.74102e-08,
-    (float)1.34846e-07,
-    (float)3.91676e-08,
-    (float)2.00001e-07,
-    (float)1.06143e-07,
-    (float)5.65955e-08,
-    (float)8.23993e-08,
-    (float)4.51761e-08,
-    (float)4.4223e-08,
-    (float)8.7851e-08,
-    (float)8.43629e-08,
-    (float)1.23411e-07,
-    (float)9.82951e-08,
-    (float)5.31645e-08,
-    (float)4.07442e-08,
-    (float)5.90088e-08,
-    (float)5.22194e-08,
-    (float)4.90472e-08,
-    (float)1.17573e-07,
-    (float)5.76126e-08,
-    (float)8.74778e-08,
-    (float)4.72227e-08,
-    (float)3.37089e-08,
-    (float)5.37071e-08,
-    (float)6.31539e-08,
-    (float)3.4677e-08,
-    (float)1.02688e-07,
-    (float)2.6904e-08,
-    (float)7.5344e-08,
-    (float)3.70442e-08,
-    (float)4.99289e-08,
-    (float)4.89128e-08,
-    (float)7.38849e-08,
-    (float)2.51132e-08,
-    (float)8.6758e-08,
-    (float)1.07584e-08,
-    (float)5.79312e-08,
-    (float)4.41289e-08,
-    (float)4.91077e-08,
-    (float)5.92241e-08,
-    (float)8.72098e-08,
-    (float)1.66129e-08,
-    (float)8.39061e-08,
-    (float)1.17965e-08,
-    (float)4.53047e-08,
-    (float)3.96445e-08,
-    (float)5.10143e-08,
-    (float)4.59295e-08,
-    (float)9.44475e-08,
-    (float)2.13415e-08,
-    (float)7.35106e-08,
-    (float)2.19257e-08,
-    (float)3.71168e-08,
-    (float)3.37889e-08,
-    (float)6.00588e-08,
-    (float)3.26624e-08,
-    (float)9.73104e-08,
-    (float)0.739089,
-    (float)0.24981,
-    (float)0.00501567,
-    (float)2.51464e-05,
-    (float)0.00329151,
-    (float)0.00144862,
-    (float)0.000934509,
-    (float)1.79304e-06,
-    (float)5.13936e-05,
-    (float)0.000138327,
-    (float)1.81257e-05,
-    (float)2.20056e-06,
-    (float)6.54257e-05,
-    (float)9.40648e-06,
-    (float)4.61398e-05,
-    (float)7.90855e-07,
-    (float)6.38947e-06,
-    (float)5.286e-06,
-    (float)2.21704e-06,
-    (float)7.00135e-07,
-    (float)7.1264e-06,
-    (float)1.18496e-07,
-    (float)8.3245e-06,
-    (float)4.75522e-07,
-    (float)2.3311e-06,
-    (float)7.8376e-07,
-    (float)6.07466e-07,
-    (float)3.42212e-07,
-    (float)1.33021e-06,
-    (float)4.03715e-07,
-    (float)2.53398e-06,
-    (float)3.09719e-07,
-    (float)1.14069e-06,
-    (float)3.87264e-07,
-    (float)2.86493e-07,
-    (float)2.08214e-07,
-    (float)3.99671e-07,
-    (float)4.70889e-07,
-    (float)9.83043e-07,
-    (float)2.10962e-07,
-    (float)5.95045e-07,
-    (float)2.72583e-07,
-    (float)2.35318e-07,
-    (float)1.47792e-07,
-    (float)1.91816e-07,
-    (float)4.19682e-07,
-    (float)3.85123e-07,
-    (float)1.39285e-07,
-    (float)3.26085e-07,
-    (float)1.65355e-07,
-    (float)2.41292e-07,
-    (float)1.17094e-07,
-    (float)1.17186e-07,
-    (float)3.44962e-07,
-    (float)1.23158e-07,
-    (float)8.90323e-08,
-    (float)2.10424e-07,
-    (float)7.02165e-08,
-    (float)2.55597e-07,
-    (float)9.81125e-08,
-    (float)6.93269e-08,
-    (float)2.40061e-07,
-    (float)2.1776e-08,
-    (float)5.83671e-08,
-    (float)1.65917e-07,
-    (float)2.18087e-08,
-    (float)2.45048e-07,
-    (float)8.86382e-08,
-    (float)4.37966e-08,
-    (float)1.1786e-07,
-    (float)2.00972e-08,
-    (float)4.13257e-08,
-    (float)1.25822e-07,
-    (float)5.07932e-08,
-    (float)1.92153e-07,
-    (float)8.29331e-08,
-    (float)3.84693e-08,
-    (float)3.5439e-08,
-    (float)4.483e-08,
-    (float)3.80151e-08,
-    (float)7.42539e-08,
-    (float)1.18136e-07,
-    (float)1.12112e-07,
-    (float)7.99151e-08,
-    (float)3.99879e-08,
-    (float)1.24518e-08,
-    (float)4.9654e-08,
-    (float)4.39825e-08,
-    (float)3.90196e-08,
-    (float)1.32918e-07,
-    (float)4.86224e-08,
-    (float)7.57715e-08,
-    (float)3.786e-08,
-    (float)2.07251e-08,
-    (float)3.79504e-08,
-    (float)5.15093e-08,
-    (float)3.11915e-08,
-    (float)8.57974e-08,
-    (float)2.35533e-08,
-    (float)6.77767e-08,
-    (float)2.98004e-08,
-    (float)4.54297e-08,
-    (float)3.73609e-08,
-    (float)5.93494e-08,
-    (float)1.61284e-08,
-    (float)7.28619e-08,
-    (float)7.94768e-09,
-    (float)5.38602e-08,
-    (float)3.90346e-08,
-    (float)4.16015e-08,
-    (float)4.1778e-08,
-    (float)6.81139e-08,
-    (float)8.33746e-09,
-    (float)7.25295e-08,
-    (float)1.08441e-08,
-    (float)4.32549e-08,
-    (float)3.78794e-08,
-    (float)4.32957e-08,
-    (float)3.1204e-08,
-    (float)7.34387e-08,
-    (float)9.1659e-09,
-    (float)6.40364e-08,
-    (float)2.0955e-08,
-    (float)3.56807e-08,
-    (float)3.38862e-08,
-    (float)5.10201e-08,
-    (float)1.87737e-08,
-    (float)7.55562e-08,
-    (float)0.676182,
-    (float)0.31333,
-    (float)0.00425836,
-    (float)2.91303e-05,
-    (float)0.00326023,
-    (float)0.00165061,
-    (float)0.000918409,
-    (float)1.74352e-06,
-    (float)4.47845e-05,
-    (float)0.000144846,
-    (float)1.56668e-05,
-    (float)2.38745e-06,
-    (float)6.13938e-05,
-    (float)8.30229e-06,
-    (float)4.40061e-05,
-    (float)7.61406e-07,
-    (float)6.00476e-06,
-    (float)4.45552e-06,
-    (float)1.84904e-06,
-    (float)7.23028e-07,
-    (float)6.21997e-06,
-    (float)2.35653e-07,
-    (float)7.95312e-06,
-    (float)4.66546e-07,
-    (float)2.26144e-06,
-    (float)5.94544e-07,
-    (float)4.48892e-07,
-    (float)3.41282e-07,
-    (float)1.04377e-06,
-    (float)5.73995e-07,
-    (float)2.49344e-06,
-    (float)3.09453e-07,
-    (float)1.126e-06,
-    (float)3.34868e-07,
-    (float)2.11004e-07,
-    (float)2.00607e-07,
-    (float)2.83143e-07,
-    (float)5.6199e-07,
-    (float)9.84935e-07,
-    (float)2.10393e-07,
-    (float)5.84414e-07,
-    (float)2.61024e-07,
-    (float)2.01236e-07,
-    (float)1.37431e-07,
-    (float)1.29523e-07,
-    (float)4.68446e-07,
-    (float)3.56354e-07,
-    (float)1.36822e-07,
-    (float)3.27344e-07,
-    (float)1.56133e-07,
-    (float)2.31176e-07,
-    (float)1.00568e-07,
-    (float)7.71468e-08,
-    (float)3.20207e-07,
-    (float)9.3083e-08,
-    (float)8.47708e-08,
-    (float)1.97021e-07,
-    (float)5.59534e-08,
-    (float)2.47879e-07,
-    (float)7.90372e-08,
-    (float)4.48033e-08,
-    (float)1.88596e-07,
-    (float)8.16969e-09,
-    (float)5.22711e-08,
-    (float)1.48487e-07,
-    (float)1.53185e-08,
-    (float)2.32619e-07,
-    (float)6.85147e-08,
-    (float)2.52777e-08,
-    (float)7.07224e-08,
-    (float)1.77466e-08,
-    (float)3.45277e-08,
-    (float)1.10055e-07,
-    (float)6.84355e-08,
-    (float)1.74633e-07,
-    (float)6.35562e-08,
-    (float)2.42901e-08,
-    (float)9.05998e-09,
-    (float)4.23251e-08,
-    (float)3.2409e-08,
-    (float)6.01208e-08,
-    (float)1.42859e-07,
-    (float)9.37707e-08,
-    (float)6.19591e-08,
-    (float)3.06233e-08,
-    (float)4.42782e-09,
-    (float)4.06191e-08,
-    (float)3.87917e-08,
-    (float)3.08627e-08,
-    (float)1.24942e-07,
-    (float)3.80139e-08,
-    (float)6.15598e-08,
-    (float)3.21834e-08,
-    (float)2.00701e-08,
-    (float)2.72221e-08,
-    (float)4.32858e-08,
-    (float)2.56776e-08,
-    (float)5.34534e-08,
-    (float)1.93139e-08,
-    (float)5.86864e-08,
-    (float)2.20367e-08,
-    (float)4.81026e-08,
-    (float)2.96679e-08,
-    (float)4.64289e-08,
-    (float)1.05589e-08,
-    (float)5.21919e-08,
-    (float)5.41719e-09,
-    (float)5.0346e-08,
-    (float)2.87131e-08,
-    (float)3.44125e-08,
-    (float)2.70289e-08,
-    (float)5.01525e-08,
-    (float)4.87981e-09,
-    (float)5.66141e-08,
-    (float)1.13501e-08,
-    (float)4.22868e-08,
-    (float)3.02682e-08,
-    (float)3.71141e-08,
-    (float)1.87923e-08,
-    (float)5.27965e-08,
-    (float)3.09717e-09,
-    (float)5.29605e-08,
-    (float)2.31037e-08,
-    (float)3.54766e-08,
-    (float)3.25651e-08,
-    (float)4.26726e-08,
-    (float)9.3749e-09,
-    (float)5.37293e-08,
-    (float)0.60804,
-    (float)0.382176,
-    (float)0.00354313,
-    (float)3.27156e-05,
-    (float)0.00316271,
-    (float)0.00181285,
-    (float)0.000883068,
-    (float)1.75758e-06,
-    (float)3.91438e-05,
-    (float)0.000145318,
-    (float)1.34612e-05,
-    (float)2.49004e-06,
-    (float)5.59389e-05,
-    (float)6.77833e-06,
-    (float)4.10725e-05,
-    (float)7.7198e-07,
-    (float)5.70582e-06,
-    (float)3.52759e-06,
-    (float)1.47613e-06,
-    (float)7.10828e-07,
-    (float)5.22439e-06,
-    (float)4.58424e-07,
-    (float)7.49368e-06,
-    (float)4.73969e-07,
-    (float)2.19406e-06,
-    (float)4.71792e-07,
-    (float)3.10265e-07,
-    (float)3.26866e-07,
-    (float)7.79129e-07,
-    (float)7.86822e-07,
-    (float)2.41792e-06,
-    (float)3.10412e-07,
-    (float)1.08848e-06,
-    (float)3.33028e-07,
-    (float)1.76938e-07,
-    (float)1.96903e-07,
-    (float)1.81688e-07,
-    (float)6.60666e-07,
-    (float)9.43096e-07,
-    (float)2.03322e-07,
-    (float)5.56158e-07,
-    (float)2.54761e-07,
-    (float)2.02527e-07,
-    (float)1.3843e-07,
-    (float)8.17906e-08,
-    (float)4.90333e-07,
-    (float)3.22606e-07,
-    (float)1.20709e-07,
-    (float)3.03176e-07,
-    (float)1.30144e-07,
-    (float)2.37432e-07,
-    (float)9.87331e-08,
-    (float)5.01015e-08,
-    (float)2.77843e-07,
-    (float)7.04166e-08,
-    (float)6.78801e-08,
-    (float)1.7313e-07,
-    (float)3.15008e-08,
-    (float)2.44554e-07,
-    (float)7.2405e-08,
-    (float)3.07836e-08,
-    (float)1.1739e-07,
-    (float)1.81318e-09,
-    (float)3.85285e-08,
-    (float)1.15983e-07,
-    (float)2.29941e-08,
-    (float)2.11242e-07,
-    (float)5.84782e-08,
-    (float)1.81645e-08,
-    (float)2.74775e-08,
-    (float)1.26448e-08,
-    (float)2.46206e-08,
-    (float)8.12586e-08,
-    (float)9.75508e-08,
-    (float)1.43332e-07,
-    (float)5.10499e-08,
-    (float)1.73576e-08,
-    (float)8.32062e-10,
-    (float)3.31779e-08,
-    (float)2.3536e-08,
-    (float)4.26723e-08,
-    (float)1.47411e-07,
-    (float)6.89533e-08,
-    (float)4.9003e-08,
-    (float)2.44171e-08,
-    (float)3.32844e-09,
-    (float)3.24969e-08,
-    (float)2.86315e-08,
-    (float)2.32509e-08,
-    (float)8.87775e-08,
-    (float)2.58154e-08,
-    (float)4.90112e-08,
-    (float)2.36656e-08,
-    (float)2.5074e-08,
-    (float)2.52912e-08,
-    (float)3.3046e-08,
-    (float)1.68636e-08,
-    (float)2.58254e-08,
-    (float)1.09612e-08,
-    (float)4.61189e-08,
-    (float)1.49944e-08,
-    (float)4.99357e-08,
-    (float)2.93436e-08,
-    (float)3.64154e-08,
-    (float)7.22878e-09,
-    (float)2.81131e-08,
-    (float)1.75711e-09,
-    (float)3.927e-08,
-    (float)1.82196e-08,
-    (float)3.73866e-08,
-    (float)1.92549e-08,
-    (float)3.88011e-08,
-    (float)3.03374e-09,
-    (float)3.04004e-08,
-    (float)9.71143e-09,
-    (float)3.36088e-08,
-    (float)2.14859e-08,
-    (float)3.98634e-08,
-    (float)1.13439e-08,
-    (float)3.97133e-08,
-    (float)2.52774e-10,
-    (float)3.26151e-08,
-    (float)1.95779e-08,
-    (float)3.04833e-08,
-    (float)2.45507e-08,
-    (float)3.67149e-08,
-    (float)3.40275e-09,
-    (float)3.89627e-08,
-    (float)0.536694,
-    (float)0.454307,
-    (float)0.00288414,
-    (float)3.57411e-05,
-    (float)0.00300353,
-    (float)0.00192254,
-    (float)0.000831255,
-    (float)1.81848e-06,
-    (float)3.40712e-05,
-    (float)0.000139536,
-    (float)1.13333e-05,
-    (float)2.56248e-06,
-    (float)4.97718e-05,
-    (float)4.97973e-06,
-    (float)3.78512e-05,
-    (float)8.06182e-07,
-    (float)5.35032e-06,
-    (float)2.52782e-06,
-    (float)1.10377e-06,
-    (float)7.19238e-07,
-    (float)4.29767e-06,
-    (float)7.8617e-07,
-    (float)7.07091e-06,
-    (float)4.83819e-07,
-    (float)2.07586e-06,
-    (float)3.75069e-07,
-    (float)2.13288e-07,
-    (float)3.36367e-07,
-    (float)5.64393e-07,
-    (float)1.02264e-06,
-    (float)2.33694e-06,
-    (float)3.00343e-07,
-    (float)1.01719e-06,
-    (float)3.36156e-07,
-    (float)1.79117e-07,
-    (float)2.07809e-07,
-    (float)1.06364e-07,
-    (float)7.51622e-07,
-    (float)8.79334e-07,
-    (float)1.83076e-07,
-    (float)5.12031e-07,
-    (float)2.49936e-07,
-    (float)2.25409e-07,
-    (float)1.41462e-07,
-    (float)4.64981e-08,
-    (float)4.86819e-07,
-    (float)2.89835e-07,
-    (float)1.00133e-07,
-    (float)2.68187e-07,
-    (float)1.09364e-07,
-    (float)2.48521e-07,
-    (float)9.15278e-08,
-    (float)2.72495e-08,
-    (float)2.35329e-07,
-    (float)5.25111e-08,
-    (float)5.48139e-08,
-    (float)1.56034e-07,
-    (float)1.74413e-08,
-    (float)2.41045e-07,
-    (float)6.14169e-08,
-    (float)1.56094e-08,
-    (float)5.55141e-08,
-    (float)1.67713e-09,
-    (float)3.16358e-08,
-    (float)9.79274e-08,
-    (float)5.30672e-08,
-    (float)1.85383e-07,
-    (float)4.63725e-08,
-    (float)1.02495e-08,
-    (float)5.053e-09,
-    (float)1.19272e-08,
-    (float)1.89852e-08,
-    (float)5.95834e-08,
-    (float)1.34075e-07,
-    (float)1.07205e-07,
-    (float)3.96456e-08,
-    (float)1.23726e-08,
-    (float)5.60828e-09,
-    (float)2.62729e-08,
-    (float)1.49995e-08,
-    (float)2.76545e-08,
-    (float)1.39494e-07,
-    (float)4.22498e-08,
-    (float)3.97794e-08,
-    (float)2.06822e-08,
-    (float)1.3806e-09,
-    (float)2.59826e-08,
-    (float)1.6929e-08,
-    (float)1.42498e-08,
-    (float)4.73384e-08,
-    (float)1.3727e-08,
-    (float)4.17297e-08,
-    (float)1.86298e-08,
-    (float)3.28986e-08,
-    (float)2.24583e-08,
-    (float)2.12232e-08,
-    (float)8.22682e-09,
-    (float)9.22782e-09,
-    (float)6.12414e-09,
-    (float)3.95986e-08,
-    (float)1.12301e-08,
-    (float)4.8421e-08,
-    (float)2.30269e-08,
-    (float)2.60308e-08,
-    (float)5.02538e-09,
-    (float)1.52365e-08,
-    (float)6.73274e-10,
-    (float)3.28187e-08,
-    (float)8.85497e-09,
-    (float)4.31548e-08,
-    (float)1.06266e-08,
-    (float)2.96599e-08,
-    (float)2.81876e-09,
-    (float)1.22469e-08,
-    (float)8.31811e-09,
-    (float)2.57852e-08,
-    (float)1.26087e-08,
-    (float)4.01051e-08,
-    (float)4.91776e-09,
-    (float)3.16831e-08,
-    (float)3.19234e-10,
-    (float)1.82624e-08,
-    (float)1.44094e-08,
-    (float)2.15728e-08,
-    (float)1.5574e-08,
-    (float)2.886e-08,
-    (float)9.54166e-10,
-    (float)3.15397e-08,
-    (float)0.464497,
-    (float)0.527353,
-    (float)0.00229712,
-    (float)3.80172e-05,
-    (float)0.00279051,
-    (float)0.00197096,
-    (float)0.000764003,
-    (float)1.87051e-06,
-    (float)2.95385e-05,
-    (float)0.000128366,
-    (float)9.46898e-06,
-    (float)2.62037e-06,
-    (float)4.3089e-05,
-    (float)3.25004e-06,
-    (float)3.42699e-05,
-    (float)8.49659e-07,
-    (float)5.0288e-06,
-    (float)1.61363e-06,
-    (float)7.88654e-07,
-    (float)7.55574e-07,
-    (float)3.36953e-06,
-    (float)1.23698e-06,
-    (float)6.6497e-06,
-    (float)5.07298e-07,
-    (float)1.99016e-06,
-    (float)3.28806e-07,
-    (float)1.72569e-07,
-    (float)3.7053e-07,
-    (float)3.64015e-07,
-    (float)1.23762e-06,
-    (float)2.26857e-06,
-    (float)3.02985e-07,
-    (float)9.45482e-07,
-    (float)3.40043e-07,
-    (float)2.14249e-07,
-    (float)2.30334e-07,
-    (float)5.24892e-08,
-    (float)8.42887e-07,
-    (float)8.46001e-07,
-    (float)1.69621e-07,
-    (float)4.61417e-07,
-    (float)2.4308e-07,
-    (float)2.57773e-07,
-    (float)1.44955e-07,
-    (float)2.10456e-08,
-    (float)4.78449e-07,
-    (float)2.67427e-07,
-    (float)8.47619e-08,
-    (float)2.30775e-07,
-    (float)8.58213e-08,
-    (float)2.52639e-07,
-    (float)8.12565e-08,
-    (float)1.16473e-08,
-    (float)1.82159e-07,
-    (float)4.48409e-08,
-    (float)4.67532e-08,
-    (float)1.31505e-07,
-    (float)1.0574e-08,
-    (float)2.18117e-07,
-    (float)4.67091e-08,
-    (float)6.91444e-09,
-    (float)1.73668e-08,
-    (float)7.0659e-09,
-    (float)2.62805e-08,
-    (float)7.41245e-08,
-    (float)9.48226e-08,
-    (float)1.60831e-07,
-    (float)3.42935e-08,
-    (float)6.29842e-09,
-    (float)1.16353e-08,
-    (float)1.87106e-08,
-    (float)1.29792e-08,
-    (float)3.61313e-08,
-    (float)1.81197e-07,
-    (float)8.4798e-08,
-    (float)3.40841e-08,
-    (float)1.10064e-08,
-    (float)1.94391e-08,
-    (float)2.04479e-08,
-    (float)6.22382e-09,
-    (float)1.3748e-08,
-    (float)1.19683e-07,
-    (float)2.66389e-08,
-    (float)3.97154e-08,
-    (float)1.67518e-08,
-    (float)7.42033e-10,
-    (float)1.68797e-08,
-    (float)5.87697e-09,
-    (float)6.18606e-09,
-    (float)1.90767e-08,
-    (float)7.41421e-09,
-    (float)4.22568e-08,
-    (float)1.08626e-08,
-    (float)4.11887e-08,
-    (float)1.52122e-08,
-    (float)8.97854e-09,
-    (float)5.76311e-09,
-    (float)3.34904e-09,
-    (float)2.47373e-09,
-    (float)3.49443e-08,
-    (float)5.31212e-09,
-    (float)4.222e-08,
-    (float)1.5254e-08,
-    (float)1.56237e-08,
-    (float)5.61786e-09,
-    (float)1.07428e-08,
-    (float)9.99597e-10,
-    (float)2.44429e-08,
-    (float)1.66877e-09,
-    (float)4.90662e-08,
-    (float)8.90612e-09,
-    (float)2.28597e-08,
-    (float)3.61427e-09,
-    (float)2.44473e-09,
-    (float)7.16674e-09,
-    (float)1.63794e-08,
-    (float)4.63219e-09,
-    (float)4.04884e-08,
-    (float)3.45307e-09,
-    (float)2.74313e-08,
-    (float)1.43403e-09,
-    (float)8.8936e-09,
-    (float)1.09398e-08,
-    (float)1.14845e-08,
-    (float)7.82033e-09,
-    (float)2.21919e-08,
-    (float)1.66318e-09,
-    (float)2.8585e-08,
-    (float)0.39386,
-    (float)0.598883,
-    (float)0.00178974,
-    (float)3.93943e-05,
-    (float)0.00253577,
-    (float)0.0019533,
-    (float)0.000685528,
-    (float)1.96888e-06,
-    (float)2.53869e-05,
-    (float)0.000112846,
-    (float)7.82492e-06,
-    (float)2.61418e-06,
-    (float)3.64157e-05,
-    (float)1.90031e-06,
-    (float)3.05784e-05,
-    (float)9.16187e-07,
-    (float)4.67127e-06,
-    (float)9.12977e-07,
-    (float)5.48268e-07,
-    (float)7.91652e-07,
-    (float)2.53024e-06,
-    (float)1.75373e-06,
-    (float)6.28712e-06,
-    (float)5.35851e-07,
-    (float)1.90228e-06,
-    (float)3.12459e-07,
-    (float)1.95731e-07,
-    (float)4.15437e-07,
-    (float)1.98946e-07,
-    (float)1.41348e-06,
-    (float)2.24528e-06,
-    (float)3.00572e-07,
-    (float)8.96936e-07,
-    (float)3.37817e-07,
-    (float)2.8687e-07,
-    (float)2.6289e-07,
-    (float)1.55275e-08,
-    (float)9.26433e-07,
-    (float)8.36071e-07,
-    (float)1.52556e-07,
-    (float)4.27943e-07,
-    (float)2.3729e-07,
-    (float)2.85822e-07,
-    (float)1.53163e-07,
-    (float)5.04228e-09,
-    (float)4.66525e-07,
-    (float)2.39154e-07,
-    (float)6.93086e-08,
-    (float)2.06577e-07,
-    (float)5.90373e-08,
-    (float)2.42562e-07,
-    (float)7.50599e-08,
-    (float)2.1167e-09,
-    (float)1.19029e-07,
-    (float)3.87092e-08,
-    (float)4.00192e-08,
-    (float)1.07215e-07,
-    (float)1.98212e-08,
-    (float)1.97478e-07,
-    (float)3.83656e-08,
-    (float)1.2205e-09,
-    (float)4.26332e-09,
-    (float)2.15515e-08,
-    (float)2.35906e-08,
-    (float)5.05917e-08,
-    (float)1.49618e-07,
-    (float)1.48833e-07,
-    (float)2.59212e-08,
-    (float)4.29801e-09,
-    (float)4.17271e-08,
-    (float)3.19772e-08,
-    (float)9.35756e-09,
-    (float)1.48398e-08,
-    (float)2.1421e-07,
-    (float)7.23449e-08,
-    (float)2.93254e-08,
-    (float)1.35261e-08,
-    (float)3.14676e-08,
-    (float)1.45452e-08,
-    (float)1.62372e-09,
-    (float)2.64996e-09,
-    (float)8.27439e-08,
-    (float)1.69522e-08,
-    (float)4.11401e-08,
-    (float)1.5342e-08,
-    (float)3.49447e-09,
-    (float)6.88444e-09,
-    (float)1.77172e-09,
-    (float)1.56788e-09,
-    (float)6.70262e-09,
-    (float)2.78039e-09,
-    (float)4.41865e-08,
-    (float)6.91701e-09,
-    (float)4.10007e-08,
-    (float)9.21724e-09,
-    (float)3.48706e-09,
-    (float)8.01412e-09,
-    (float)1.623e-09,
-    (float)9.21632e-11,
-    (float)3.14725e-08,
-    (float)2.80499e-09,
-    (float)3.15013e-08,
-    (float)1.47084e-08,
-    (float)8.98847e-09,
-    (float)7.92751e-09,
-    (float)1.06915e-08,
-    (float)5.40065e-09,
-    (float)1.81732e-08,
-    (float)2.73332e-10,
-    (float)4.82985e-08,
-    (float)1.46085e-08,
-    (float)1.72916e-08,
-    (float)6.76193e-09,
-    (float)5.09222e-11,
-    (float)5.62424e-09,
-    (float)9.9954e-09,
-    (float)2.02337e-09,
-    (float)4.3109e-08,
-    (float)4.95887e-09,
-    (float)2.3065e-08,
-    (float)4.14291e-09,
-    (float)2.40059e-09,
-    (float)5.6477e-09,
-    (float)4.92826e-09,
-    (float)2.83304e-09,
-    (float)1.76442e-08,
-    (float)2.46439e-09,
-    (float)2.49223e-08,
-    (float)0.327011,
-    (float)0.666649,
-    (float)0.00136173,
-    (float)3.97477e-05,
-    (float)0.0022489,
-    (float)0.00186992,
-    (float)0.000602006,
-    (float)2.06929e-06,
-    (float)2.18795e-05,
-    (float)9.42405e-05,
-    (float)6.33954e-06,
-    (float)2.51169e-06,
-    (float)2.9922e-05,
-    (float)1.07172e-06,
-    (float)2.69162e-05,
-    (float)9.90253e-07,
-    (float)4.27552e-06,
-    (float)4.22678e-07,
-    (float)4.02793e-07,
-    (float)8.21751e-07,
-    (float)1.84664e-06,
-    (float)2.26621e-06,
-    (float)5.857e-06,
-    (float)5.83947e-07,
-    (float)1.74716e-06,
-    (float)3.14996e-07,
-    (float)2.73522e-07,
-    (float)4.93384e-07,
-    (float)9.53535e-08,
-    (float)1.54947e-06,
-    (float)2.15204e-06,
-    (float)3.29958e-07,
-    (float)8.20807e-07,
-    (float)3.25171e-07,
-    (float)3.69828e-07,
-    (float)3.32047e-07,
-    (float)5.83596e-09,
-    (float)9.35808e-07,
-    (float)7.83249e-07,
-    (float)1.62769e-07,
-    (float)3.7725e-07,
-    (float)2.05191e-07,
-    (float)3.0048e-07,
-    (float)1.7632e-07,
-    (float)5.02633e-09,
-    (float)4.17426e-07,
-    (float)1.89618e-07,
-    (float)6.43208e-08,
-    (float)1.72869e-07,
-    (float)3.52899e-08,
-    (float)2.25976e-07,
-    (float)7.13056e-08,
-    (float)1.36893e-09,
-    (float)6.51333e-08,
-    (float)3.95233e-08,
-    (float)3.20201e-08,
-    (float)9.08519e-08,
-    (float)4.73817e-08,
-    (float)1.78884e-07,
-    (float)3.24505e-08,
-    (float)1.70481e-09,
-    (float)1.1522e-08,
-    (float)3.80662e-08,
-    (float)1.72141e-08,
-    (float)4.48944e-08,
-    (float)2.12393e-07,
-    (float)1.18907e-07,
-    (float)2.01854e-08,
-    (float)8.11156e-10,
-    (float)7.54195e-08,
-    (float)3.15601e-08,
-    (float)4.7588e-09,
-    (float)7.51091e-09,
-    (float)1.98385e-07,
-    (float)4.4056e-08,
-    (float)2.70558e-08,
-    (float)1.07474e-08,
-    (float)2.61251e-08,
-    (float)5.891e-09,
-    (float)1.91366e-09,
-    (float)1.27117e-10,
-    (float)3.43906e-08,
-    (float)7.67121e-09,
-    (float)4.22428e-08,
-    (float)1.14452e-08,
-    (float)1.48855e-08,
-    (float)1.77943e-09,
-    (float)4.79269e-09,
-    (float)2.71171e-09,
-    (float)7.23692e-09,
-    (float)1.51105e-09,
-    (float)4.4246e-08,
-    (float)7.07855e-09,
-    (float)2.99524e-08,
-    (float)6.22233e-09,
-    (float)2.25229e-09,
-    (float)1.47686e-08,
-    (float)3.35941e-09,
-    (float)1.64748e-09,
-    (float)2.77507e-08,
-    (float)4.51425e-09,
-    (float)2.12133e-08,
-    (float)1.8784e-08,
-    (float)2.48339e-09,
-    (float)7.29276e-09,
-    (float)9.12026e-09,
-    (float)9.18603e-09,
-    (float)1.32446e-08,
-    (float)7.96867e-10,
-    (float)3.74867e-08,
-    (float)1.6031e-08,
-    (float)7.96658e-09,
-    (float)7.31353e-09,
-    (float)6.25629e-10,
-    (float)1.98871e-09,
-    (float)4.4464e-09,
-    (float)3.9661e-09,
-    (float)3.46109e-08,
-    (float)3.81298e-09,
-    (float)1.73407e-08,
-    (float)6.85874e-09,
-    (float)1.25511e-09,
-    (float)1.43152e-09,
-    (float)8.26238e-10,
-    (float)4.45175e-09,
-    (float)1.13985e-08,
-    (float)3.28729e-09,
-    (float)2.24692e-08,
-    (float)0.265676,
-    (float)0.728899,
-    (float)0.00101281,
-    (float)3.90791e-05,
-    (float)0.00194479,
-    (float)0.0017299,
-    (float)0.000516011,
-    (float)2.26092e-06,
-    (float)1.89083e-05,
-    (float)7.46667e-05,
-    (float)5.06805e-06,
-    (float)2.33225e-06,
-    (float)2.39319e-05,
-    (float)9.27949e-07,
-    (float)2.32702e-05,
-    (float)1.10202e-06,
-    (float)3.84137e-06,
-    (float)1.91594e-07,
-    (float)3.23283e-07,
-    (float)8.59479e-07,
-    (float)1.29748e-06,
-    (float)2.79383e-06,
-    (float)5.42181e-06,
-    (float)6.30893e-07,
-    (float)1.57972e-06,
-    (float)3.49315e-07,
-    (float)4.11765e-07,
-    (float)5.82157e-07,
-    (float)3.34146e-08,
-    (float)1.67863e-06,
-    (float)2.06904e-06,
-    (float)3.47516e-07,
-    (float)7.40605e-07,
-    (float)3.14808e-07,
-    (float)4.85601e-07,
-    (float)4.00092e-07,
-    (float)1.21e-08,
-    (float)9.14704e-07,
-    (float)7.20213e-07,
-    (float)1.60706e-07,
-    (float)3.16154e-07,
-    (float)1.61626e-07,
-    (float)3.31878e-07,
-    (float)2.03151e-07,
-    (float)1.10595e-08,
-    (float)3.46782e-07,
-    (float)1.60398e-07,
-    (float)5.87698e-08,
-    (float)1.35623e-07,
-    (float)1.62386e-08,
-    (float)2.10571e-07,
-    (float)7.77325e-08,
-    (float)5.849e-09,
-    (float)2.71458e-08,
-    (float)4.9181e-08,
-    (float)2.61568e-08,
-    (float)7.66883e-08,
-    (float)1.01554e-07,
-    (float)1.54169e-07,
-    (float)3.17731e-08,
-    (float)1.18482e-08,
-    (float)4.20206e-08,
-    (float)5.11278e-08,
-    (float)1.22222e-08,
-    (float)4.67326e-08,
-    (float)2.70228e-07,
-    (float)8.05979e-08,
-    (float)1.69543e-08,
-    (float)3.13318e-09,
-    (float)9.41919e-08,
-    (float)2.50664e-08,
-    (float)4.23861e-09,
-    (float)6.10109e-09,
-    (float)1.57232e-07,
-    (float)2.12744e-08,
-    (float)2.22517e-08,
-    (float)4.77263e-09,
-    (float)1.69809e-08,
-    (float)1.3859e-09,
-    (float)4.97147e-09,
-    (float)1.13502e-09,
-    (float)4.99686e-09,
-    (float)4.27806e-09,
-    (float)3.92007e-08,
-    (float)9.38519e-09,
-    (float)3.54597e-08,
-    (float)1.55655e-09,
-    (float)9.93594e-09,
-    (float)6.54941e-09,
-    (float)1.14026e-08,
-    (float)6.69594e-10,
-    (float)4.41228e-08,
-    (float)6.85395e-09,
-    (float)1.70124e-08,
-    (float)7.67617e-09,
-    (float)5.36987e-09,
-    (float)1.92873e-08,
-    (float)7.73811e-09,
-    (float)7.58985e-09,
-    (float)2.71662e-08,
-    (float)6.10041e-09,
-    (float)2.11445e-08,
-    (float)2.86109e-08,
-    (float)7.32799e-10,
-    (float)1.16727e-08,
-    (float)5.34137e-09,
-    (float)1.21688e-08,
-    (float)1.06e-08,
-    (float)1.86486e-09,
-    (float)2.1429e-08,
-    (float)1.58314e-08,
-    (float)3.2065e-09,
-    (float)9.25949e-09,
-    (float)5.26614e-10,
-    (float)1.17482e-10,
-    (float)2.19981e-09,
-    (float)5.63213e-09,
-    (float)2.36429e-08,
-    (float)4.00937e-09,
-    (float)1.11119e-08,
-    (float)6.76913e-09,
-    (float)4.09973e-10,
-    (float)3.90245e-09,
-    (float)6.03782e-11,
-    (float)9.50144e-09,
-    (float)6.23781e-09,
-    (float)5.03597e-09,
-    (float)1.54924e-08,
-    (float)0.211007,
-    (float)0.784452,
-    (float)0.000738608,
-    (float)3.78304e-05,
-    (float)0.00163894,
-    (float)0.00154359,
-    (float)0.000430773,
-    (float)2.45634e-06,
-    (float)1.66137e-05,
-    (float)5.56509e-05,
-    (float)3.95783e-06,
-    (float)2.15873e-06,
-    (float)1.81671e-05,
-    (float)1.49499e-06,
-    (float)1.98668e-05,
-    (float)1.23449e-06,
-    (float)3.54667e-06,
-    (float)2.06745e-07,
-    (float)3.22054e-07,
-    (float)8.72984e-07,
-    (float)8.30388e-07,
-    (float)3.28002e-06,
-    (float)5.01453e-06,
-    (float)7.08475e-07,
-    (float)1.42313e-06,
-    (float)3.95147e-07,
-    (float)6.20487e-07,
-    (float)6.53475e-07,
-    (float)5.92258e-09,
-    (float)1.74635e-06,
-    (float)1.96241e-06,
-    (float)3.70368e-07,
-    (float)6.28543e-07,
-    (float)2.84546e-07,
-    (float)6.24977e-07,
-    (float)4.62423e-07,
-    (float)2.12977e-08,
-    (float)8.59144e-07,
-    (float)6.5627e-07,
-    (float)1.43286e-07,
-    (float)2.40997e-07,
-    (float)1.20818e-07,
-    (float)3.81142e-07,
-    (float)2.32792e-07,
-    (float)1.69485e-08,
-    (float)2.63201e-07,
-    (float)1.49785e-07,
-    (float)4.15688e-08,
-    (float)9.64149e-08,
-    (float)1.46971e-08,
-    (float)1.86484e-07,
-    (float)8.28017e-08,
-    (float)9.70044e-09,
-    (float)2.425e-09,
-    (float)5.47983e-08,
-    (float)1.96456e-08,
-    (float)5.70135e-08,
-    (float)1.8148e-07,
-    (float)1.13991e-07,
-    (float)3.06872e-08,
-    (float)1.82731e-08,
-    (float)8.05565e-08,
-    (float)5.94362e-08,
-    (float)9.29506e-09,
-    (float)4.00729e-08,
-    (float)2.84319e-07,
-    (float)5.30523e-08,
-    (float)2.09363e-08,
-    (float)9.79227e-09,
-    (float)8.84292e-08,
-    (float)2.15449e-08,
-    (float)1.85673e-09,
-    (float)7.18683e-09,
-    (float)1.01878e-07,
-    (float)9.4887e-09,
-    (float)2.81307e-08,
-    (float)5.76163e-10,
-    (float)1.16957e-08,
-    (float)1.01405e-09,
-    (float)7.59505e-09,
-    (float)3.26939e-09,
-    (float)2.18401e-09,
-    (float)1.40324e-09,
-    (float)3.52936e-08,
-    (float)4.59584e-09,
-    (float)5.6054e-08,
-    (float)3.24695e-09,
-    (float)9.94075e-09,
-    (float)1.03603e-08,
-    (float)1.00895e-08,
-    (float)1.54238e-09,
-    (float)2.82557e-08,
-    (float)4.25232e-09,
-    (float)1.5422e-08,
-    (float)1.20835e-08,
-    (float)3.73933e-09,
-    (float)1.22959e-08,
-    (float)1.47195e-08,
-    (float)1.35353e-08,
-    (float)1.81567e-08,
-    (float)2.5924e-09,
-    (float)2.57547e-08,
-    (float)3.24986e-08,
-    (float)2.00468e-09,
-    (float)1.15575e-08,
-    (float)2.57719e-09,
-    (float)9.30922e-09,
-    (float)1.00091e-08,
-    (float)2.49062e-09,
-    (float)6.17518e-09,
-    (float)1.77251e-08,
-    (float)1.01124e-09,
-    (float)1.34688e-08,
-    (float)2.1204e-09,
-    (float)5.85954e-10,
-    (float)2.01582e-09,
-    (float)5.90344e-09,
-    (float)1.39135e-08,
-    (float)7.68467e-09,
-    (float)4.25399e-09,
-    (float)4.88049e-09,
-    (float)4.16328e-10,
-    (float)8.52626e-09,
-    (float)1.75477e-11,
-    (float)1.22534e-08,
-    (float)2.45704e-09,
-    (float)5.98809e-09,
-    (float)7.42973e-09,
-    (float)0.163592,
-    (float)0.832695,
-    (float)0.000529562,
-    (float)3.58777e-05,
-    (float)0.00134653,
-    (float)0.00132674,
-    (float)0.000350463,
-    (float)2.66791e-06,
-    (float)1.44147e-05,
-    (float)3.84413e-05,
-    (float)3.00404e-06,
-    (float)1.98785e-06,
-    (float)1.32758e-05,
-    (float)2.65916e-06,
-    (float)1.69243e-05,
-    (float)1.37527e-06,
-    (float)3.2975e-06,
-    (float)3.95804e-07,
-    (float)4.38118e-07,
-    (float)9.24262e-07,
-    (float)4.41472e-07,
-    (float)3.69876e-06,
-    (float)4.63145e-06,
-    (float)7.87659e-07,
-    (float)1.32441e-06,
-    (float)4.27617e-07,
-    (float)8.81804e-07,
-    (float)7.34923e-07,
-    (float)1.1837e-09,
-    (float)1.75796e-06,
-    (float)1.86728e-06,
-    (float)3.88176e-07,
-    (float)5.39486e-07,
-    (float)2.55986e-07,
-    (float)7.86761e-07,
-    (float)5.19904e-07,
-    (float)3.09055e-08,
-    (float)8.04088e-07,
-    (float)6.13115e-07,
-    (float)1.29572e-07,
-    (float)1.72608e-07,
-    (float)8.17379e-08,
-    (float)4.02578e-07,
-    (float)2.49026e-07,
-    (float)1.77405e-08,
-    (float)1.78533e-07,
-    (float)1.24639e-07,
-    (float)2.89463e-08,
-    (float)5.77861e-08,
-    (float)4.80066e-08,
-    (float)1.55594e-07,
-    (float)8.50893e-08,
-    (float)1.18871e-08,
-    (float)7.92638e-09,
-    (float)7.09785e-08,
-    (float)1.49712e-08,
-    (float)4.61702e-08,
-    (float)2.73045e-07,
-    (float)9.44497e-08,
-    (float)3.09488e-08,
-    (float)2.41912e-08,
-    (float)1.19709e-07,
-    (float)8.00002e-08,
-    (float)8.17605e-09,
-    (float)3.32235e-08,
-    (float)2.75053e-07,
-    (float)4.1056e-08,
-    (float)2.33605e-08,
-    (float)1.68393e-08,
-    (float)7.47825e-08,
-    (float)2.11102e-08,
-    (float)3.01268e-09,
-    (float)6.85735e-09,
-    (float)4.99984e-08,
-    (float)1.73205e-09,
-    (float)3.78183e-08,
-    (float)1.0381e-08,
-    (float)1.90958e-08,
-    (float)3.50134e-09,
-    (float)1.13152e-08,
-    (float)1.18737e-08,
-    (float)1.69053e-08,
-    (float)3.78609e-09,
-    (float)3.70215e-08,
-    (float)1.0489e-08,
-    (float)5.76015e-08,
-    (float)6.46391e-09,
-    (float)7.34367e-09,
-    (float)1.1489e-08,
-    (float)5.16357e-09,
-    (float)9.61883e-09,
-    (float)1.97495e-08,
-    (float)4.35727e-09,
-    (float)2.80154e-08,
-    (float)1.7048e-08,
-    (float)2.60386e-09,
-    (float)6.36901e-09,
-    (float)1.6708e-08,
-    (float)1.78313e-08,
-    (float)1.09355e-08,
-    (float)9.04523e-10,
-    (float)2.33248e-08,
-    (float)3.37111e-08,
-    (float)4.88451e-09,
-    (float)1.07782e-08,
-    (float)7.16356e-10,
-    (float)5.9118e-09,
-    (float)7.75418e-09,
-    (float)9.48964e-10,
-    (float)2.5525e-09,
-    (float)2.2285e-08,
-    (float)3.31447e-09,
-    (float)1.54956e-08,
-    (float)8.28987e-09,
-    (float)2.7727e-09,
-    (float)1.51682e-09,
-    (float)3.89744e-09,
-    (float)1.22371e-08,
-    (float)1.55008e-08,
-    (float)1.22978e-09,
-    (float)5.65822e-09,
-    (float)1.16363e-09,
-    (float)1.77416e-08,
-    (float)4.37399e-11,
-    (float)1.32173e-08,
-    (float)1.99813e-09,
-    (float)1.02215e-08,
-    (float)1.51254e-09,
-    (float)0.123547,
-    (float)0.873496,
-    (float)0.00037406,
-    (float)3.33719e-05,
-    (float)0.00107621,
-    (float)0.00109346,
-    (float)0.000278175,
-    (float)2.95104e-06,
-    (float)1.22998e-05,
-    (float)2.38989e-05,
-    (float)2.19761e-06,
-    (float)1.7803e-06,
-    (float)9.45418e-06,
-    (float)4.30079e-06,
-    (float)1.43672e-05,
-    (float)1.49401e-06,
-    (float)2.9117e-06,
-    (float)6.80833e-07,
-    (float)6.90977e-07,
-    (float)9.40393e-07,
-    (float)2.13326e-07,
-    (float)3.99802e-06,
-    (float)4.3315e-06,
-    (float)8.07052e-07,
-    (float)1.19099e-06,
-    (float)4.39653e-07,
-    (float)1.19982e-06,
-    (float)7.76546e-07,
-    (float)1.75778e-08,
-    (float)1.75705e-06,
-    (float)1.76729e-06,
-    (float)3.66829e-07,
-    (float)4.66925e-07,
-    (float)2.44924e-07,
-    (float)8.98308e-07,
-    (float)5.46445e-07,
-    (float)4.90414e-08,
-    (float)7.46418e-07,
-    (float)5.04744e-07,
-    (float)1.12799e-07,
-    (float)1.39437e-07,
-    (float)5.07063e-08,
-    (float)3.58993e-07,
-    (float)2.43425e-07,
-    (float)1.78069e-08,
-    (float)1.18472e-07,
-    (float)9.31906e-08,
-    (float)2.19211e-08,
-    (float)4.33413e-08,
-    (float)1.05273e-07,
-    (float)1.33055e-07,
-    (float)9.03404e-08,
-    (float)1.32284e-08,
-    (float)3.58867e-08,
-    (float)1.00572e-07,
-    (float)1.20459e-08,
-    (float)3.7015e-08,
-    (float)3.61056e-07,
-    (float)7.74902e-08,
-    (float)3.91017e-08,
-    (float)2.20878e-08,
-    (float)1.4591e-07,
-    (float)9.01436e-08,
-    (float)7.10993e-09,
-    (float)1.94217e-08,
-    (float)2.42721e-07,
-    (float)2.42877e-08,
-    (float)2.59145e-08,
-    (float)1.70937e-08,
-    (float)4.8089e-08,
-    (float)1.65884e-08,
-    (float)6.26057e-09,
-    (float)3.88723e-09,
-    (float)9.32312e-09,
-    (float)1.89962e-09,
-    (float)3.77974e-08,
-    (float)2.54949e-08,
-    (float)3.98674e-08,
-    (float)1.04326e-08,
-    (float)1.63511e-08,
-    (float)2.1203e-08,
-    (float)2.67691e-08,
-    (float)1.42434e-08,
-    (float)3.13433e-08,
-    (float)2.42697e-08,
-    (float)3.6277e-08,
-    (float)1.17702e-08,
-    (float)8.21526e-09,
-    (float)1.17321e-08,
-    (float)4.67169e-10,
-    (float)2.2513e-08,
-    (float)1.40704e-08,
-    (float)1.01939e-08,
-    (float)4.65496e-08,
-    (float)1.68429e-08,
-    (float)2.53497e-09,
-    (float)1.61721e-09,
-    (float)1.12609e-08,
-    (float)1.80254e-08,
-    (float)7.36448e-09,
-    (float)3.22972e-09,
-    (float)1.5406e-08,
-    (float)2.59764e-08,
-    (float)5.9802e-09,
-    (float)1.0586e-08,
-    (float)2.57832e-09,
-    (float)1.02362e-09,
-    (float)5.08148e-09,
-    (float)2.61075e-10,
-    (float)8.0157e-09,
-    (float)2.41141e-08,
-    (float)3.5073e-09,
-    (float)1.38572e-08,
-    (float)1.14664e-08,
-    (float)8.26883e-09,
-    (float)8.57427e-10,
-    (float)2.28407e-09,
-    (float)1.12615e-08,
-    (float)2.80272e-08,
-    (float)1.4476e-09,
-    (float)8.18472e-09,
-    (float)2.38591e-09,
-    (float)1.89155e-08,
-    (float)5.09618e-11,
-    (float)7.38029e-09,
-    (float)4.34138e-09,
-    (float)1.20186e-08,
-    (float)9.95311e-11,
-    (float)0.0905825,
-    (float)0.907134,
-    (float)0.000261005,
-    (float)3.06869e-05,
-    (float)0.000833423,
-    (float)0.000858202,
-    (float)0.000215434,
-    (float)3.1182e-06,
-    (float)1.02771e-05,
-    (float)1.26904e-05,
-    (float)1.5787e-06,
-    (float)1.60386e-06,
-    (float)6.61164e-06,
-    (float)6.34645e-06,
-    (float)1.21808e-05,
-    (float)1.54732e-06,
-    (float)2.46425e-06,
-    (float)1.04105e-06,
-    (float)1.00791e-06,
-    (float)9.66623e-07,
-    (float)9.19071e-08,
-    (float)4.19838e-06,
-    (float)4.02089e-06,
-    (float)8.28326e-07,
-    (float)1.02193e-06,
-    (float)4.45569e-07,
-    (float)1.49346e-06,
-    (float)8.34548e-07,
-    (float)4.63059e-08,
-    (float)1.72777e-06,
-    (float)1.60423e-06,
-    (float)3.56901e-07,
-    (float)3.78225e-07,
-    (float)2.31135e-07,
-    (float)9.5616e-07,
-    (float)5.41725e-07,
-    (float)6.39992e-08,
-    (float)6.66723e-07,
-    (float)3.92877e-07,
-    (float)9.62471e-08,
-    (float)1.17322e-07,
-    (float)2.51795e-08,
-    (float)3.26044e-07,
-    (float)2.18357e-07,
-    (float)2.59238e-08,
-    (float)6.58357e-08,
-    (float)8.71255e-08,
-    (float)2.34388e-08,
-    (float)5.08195e-08,
-    (float)1.66255e-07,
-    (float)1.11732e-07,
-    (float)7.74332e-08,
-    (float)2.22387e-08,
-    (float)6.62079e-08,
-    (float)1.33925e-07,
-    (float)1.4771e-08,
-    (float)4.34349e-08,
-    (float)4.29349e-07,
-    (float)6.10497e-08,
-    (float)4.2017e-08,
-    (float)2.1809e-08,
-    (float)1.51927e-07,
-    (float)8.83236e-08,
-    (float)5.54454e-09,
-    (float)1.23399e-08,
-    (float)1.88375e-07,
-    (float)7.26391e-09,
-    (float)3.57497e-08,
-    (float)1.20725e-08,
-    (float)2.80337e-08,
-    (float)7.27195e-09,
-    (float)1.48736e-08,
-    (float)1.30899e-09,
-    (float)2.35498e-09,
-    (float)1.08717e-08,
-    (float)3.90559e-08,
-    (float)2.94747e-08,
-    (float)6.47669e-08,
-    (float)1.51068e-08,
-    (float)2.07402e-08,
-    (float)2.26996e-08,
-    (float)2.888e-08,
-    (float)2.4028e-08,
-    (float)2.45082e-08,
-    (float)3.84741e-08,
-    (float)2.30144e-08,
-    (float)1.19813e-08,
-    (float)5.03334e-09,
-    (float)1.3825e-08,
-    (float)5.45656e-09,
-    (float)3.71989e-08,
-    (float)1.4661e-08,
-    (float)1.61937e-08,
-    (float)6.16111e-08,
-    (float)1.49288e-08,
-    (float)1.83164e-09,
-    (float)7.64649e-10,
-    (float)1.95642e-09,
-    (float)1.51203e-08,
-    (float)5.62746e-09,
-    (float)9.07509e-09,
-    (float)7.75475e-09,
-    (float)2.46443e-08,
-    (float)4.4537e-09,
-    (float)6.4731e-09,
-    (float)8.01921e-09,
-    (float)1.96899e-09,
-    (float)2.57833e-09,
-    (float)3.40932e-09,
-    (float)1.53764e-08,
-    (float)2.85146e-08,
-    (float)2.81147e-09,
-    (float)1.17963e-08,
-    (float)6.02688e-09,
-    (float)1.17352e-08,
-    (float)8.61084e-10,
-    (float)3.30463e-09,
-    (float)8.47235e-09,
-    (float)3.03492e-08,
-    (float)5.4321e-09,
-    (float)1.36709e-08,
-    (float)1.85154e-09,
-    (float)1.29664e-08,
-    (float)2.43151e-10,
-    (float)3.99461e-09,
-    (float)7.90552e-09,
-    (float)1.13355e-08,
-    (float)5.22256e-09,
-    (float)0.0641218,
-    (float)0.934177,
-    (float)0.000182501,
-    (float)2.77096e-05,
-    (float)0.000621217,
-    (float)0.000634379,
-    (float)0.000161397,
-    (float)3.25752e-06,
-    (float)8.48508e-06,
-    (float)5.20873e-06,
-    (float)1.21027e-06,
-    (float)1.49089e-06,
-    (float)4.41025e-06,
-    (float)8.51475e-06,
-    (float)1.03566e-05,
-    (float)1.58374e-06,
-    (float)2.09394e-06,
-    (float)1.42269e-06,
-    (float)1.42728e-06,
-    (float)1.02981e-06,
-    (float)2.81703e-08,
-    (float)4.31901e-06,
-    (float)3.81151e-06,
-    (float)8.38875e-07,
-    (float)8.70358e-07,
-    (float)4.5097e-07,
-    (float)1.81271e-06,
-    (float)8.78045e-07,
-    (float)8.18789e-08,
-    (float)1.68214e-06,
-    (float)1.44537e-06,
-    (float)3.52184e-07,
-    (float)2.99133e-07,
-    (float)2.08515e-07,
-    (float)9.89816e-07,
-    (float)5.22828e-07,
-    (float)7.95892e-08,
-    (float)6.00048e-07,
-    (float)2.98152e-07,
-    (float)8.73956e-08,
-    (float)9.90645e-08,
-    (float)2.55084e-08,
-    (float)2.94175e-07,
-    (float)1.95464e-07,
-    (float)3.95412e-08,
-    (float)2.60376e-08,
-    (float)9.59332e-08,
-    (float)3.27072e-08,
-    (float)6.94131e-08,
-    (float)2.64316e-07,
-    (float)9.50868e-08,
-    (float)6.55267e-08,
-    (float)3.45715e-08,
-    (float)1.0232e-07,
-    (float)1.85713e-07,
-    (float)1.94576e-08,
-    (float)6.42162e-08,
-    (float)4.54481e-07,
-    (float)5.00836e-08,
-    (float)4.04864e-08,
-    (float)2.44735e-08,
-    (float)1.31875e-07,
-    (float)7.4514e-08,
-    (float)7.84731e-09,
-    (float)8.23878e-09,
-    (float)1.34743e-07,
-    (float)1.37408e-09,
-    (float)4.7992e-08,
-    (float)1.3185e-08,
-    (float)2.35168e-08,
-    (float)4.43175e-09,
-    (float)2.20879e-08,
-    (float)4.83779e-09,
-    (float)1.82593e-08,
-    (float)2.89399e-08,
-    (float)4.54313e-08,
-    (float)2.62075e-08,
-    (float)8.41912e-08,
-    (float)1.60597e-08,
-    (float)2.26303e-08,
-    (float)1.68963e-08,
-    (float)2.35612e-08,
-    (float)4.20142e-08,
-    (float)2.09851e-08,
-    (float)4.18577e-08,
-    (float)2.80639e-08,
-    (float)1.07974e-08,
-    (float)4.31929e-09,
-    (float)1.26988e-08,
-    (float)1.70079e-08,
-    (float)5.09825e-08,
-    (float)1.63152e-08,
-    (float)2.38583e-08,
-    (float)6.28795e-08,
-    (float)1.20561e-08,
-    (float)3.19345e-09,
-    (float)3.6377e-09,
-    (float)1.00205e-09,
-    (float)5.67075e-09,
-    (float)1.10091e-08,
-    (float)1.10316e-08,
-    (float)4.60791e-09,
-    (float)3.23431e-08,
-    (float)2.60278e-09,
-    (float)3.15491e-09,
-    (float)8.14736e-09,
-    (float)6.79746e-09,
-    (float)8.03973e-09,
-    (float)1.65896e-08,
-    (float)2.27575e-08,
-    (float)3.01081e-08,
-    (float)2.55535e-09,
-    (float)7.30489e-09,
-    (float)1.06197e-09,
-    (float)1.26848e-08,
-    (float)1.14228e-09,
-    (float)8.46295e-09,
-    (float)5.51591e-09,
-    (float)3.06132e-08,
-    (float)1.24876e-08,
-    (float)2.15198e-08,
-    (float)8.37395e-10,
-    (float)7.51177e-09,
-    (float)8.89427e-10,
-    (float)2.70155e-09,
-    (float)1.17393e-08,
-    (float)1.60278e-08,
-    (float)1.70285e-08,
-    (float)0.0434419,
-    (float)0.955346,
-    (float)0.000129346,
-    (float)2.47724e-05,
-    (float)0.000441706,
-    (float)0.000432485,
-    (float)0.000116339,
-    (float)3.3182e-06,
-    (float)6.97825e-06,
-    (float)1.16543e-06,
-    (float)1.05363e-06,
-    (float)1.38996e-06,
-    (float)2.70063e-06,
-    (float)1.06194e-05,
-    (float)8.81559e-06,
-    (float)1.63845e-06,
-    (float)1.82753e-06,
-    (float)1.79278e-06,
-    (float)1.92156e-06,
-    (float)1.11689e-06,
-    (float)1.8094e-09,
-    (float)4.34976e-06,
-    (float)3.57304e-06,
-    (float)8.53338e-07,
-    (float)7.81498e-07,
-    (float)4.39935e-07,
-    (float)2.16167e-06,
-    (float)9.12226e-07,
-    (float)1.16337e-07,
-    (float)1.58173e-06,
-    (float)1.34618e-06,
-    (float)3.4484e-07,
-    (float)2.36106e-07,
-    (float)1.67623e-07,
-    (float)1.05026e-06,
-    (float)4.85059e-07,
-    (float)8.07326e-08,
-    (float)5.11558e-07,
-    (float)2.26839e-07,
-    (float)8.62433e-08,
-    (float)6.8127e-08,
-    (float)3.83225e-08,
-    (float)2.44986e-07,
-    (float)1.64057e-07,
-    (float)3.72442e-08,
-    (float)8.07068e-09,
-    (float)1.37386e-07,
-    (float)3.80883e-08,
-    (float)7.82447e-08,
-    (float)3.81484e-07,
-    (float)9.42043e-08,
-    (float)6.00499e-08,
-    (float)4.51733e-08,
-    (float)1.41343e-07,
-    (float)2.36528e-07,
-    (float)2.12557e-08,
-    (float)7.66734e-08,
-    (float)4.47309e-07,
-    (float)3.83777e-08,
-    (float)4.29536e-08,
-    (float)3.29297e-08,
-    (float)9.66734e-08,
-    (float)6.21574e-08,
-    (float)9.8828e-09,
-    (float)8.6823e-09,
-    (float)8.14142e-08,
-    (float)8.04666e-09,
-    (float)6.79447e-08,
-    (float)1.9452e-08,
-    (float)3.51997e-08,
-    (float)8.35272e-09,
-    (float)2.87561e-08,
-    (float)1.08119e-08,
-    (float)3.80066e-08,
-    (float)6.08628e-08,
-    (float)5.03085e-08,
-    (float)2.36636e-08,
-    (float)8.39849e-08,
-    (float)1.6179e-08,
-    (float)1.82687e-08,
-    (float)6.69931e-09,
-    (float)1.29648e-08,
-    (float)7.09372e-08,
-    (float)1.39939e-08,
-    (float)3.42262e-08,
-    (float)4.36327e-08,
-    (float)1.07805e-08,
-    (float)8.88488e-09,
-    (float)7.3268e-09,
-    (float)2.25047e-08,
-    (float)5.40983e-08,
-    (float)1.65621e-08,
-    (float)2.40326e-08,
-    (float)5.04071e-08,
-    (float)1.46606e-08,
-    (float)7.88349e-09,
-    (float)1.26473e-08,
-    (float)8.67973e-09,
-    (float)8.51082e-10,
-    (float)1.47816e-08,
-    (float)1.00247e-08,
-    (float)2.50932e-09,
-    (float)4.50755e-08,
-    (float)1.68817e-09,
-    (float)3.14702e-09,
-    (float)5.88413e-09,
-    (float)1.32571e-08,
-    (float)1.85163e-08,
-    (float)3.06051e-08,
-    (float)2.48574e-08,
-    (float)3.47914e-08,
-    (float)2.64409e-09,
-    (float)3.83449e-09,
-    (float)5.00697e-09,
-    (float)1.30602e-08,
-    (float)3.50556e-09,
-    (float)1.5916e-08,
-    (float)4.06407e-09,
-    (float)2.8658e-08,
-    (float)1.73481e-08,
-    (float)1.98384e-08,
-    (float)8.47426e-10,
-    (float)3.60104e-09,
-    (float)9.58573e-10,
-    (float)6.55396e-09,
-    (float)1.56133e-08,
-    (float)2.30003e-08,
-    (float)2.25095e-08,
-    (float)0.027771,
-    (float)0.971411,
-    (float)9.43559e-05,
-    (float)2.17932e-05,
-    (float)0.000295384,
-    (float)0.000261508,
-    (float)8.0412e-05,
-    (float)3.47146e-06,
-    (float)5.69614e-06,
-    (float)7.11933e-08,
-    (float)1.04806e-06,
-    (float)1.25334e-06,
-    (float)1.49184e-06,
-    (float)1.24857e-05,
-    (float)7.51251e-06,
-    (float)1.69921e-06,
-    (float)1.60896e-06,
-    (float)2.07484e-06,
-    (float)2.52289e-06,
-    (float)1.10856e-06,
-    (float)9.77172e-09,
-    (float)4.25266e-06,
-    (float)3.38132e-06,
-    (float)8.50072e-07,
-    (float)6.99952e-07,
-    (float)4.17819e-07,
-    (float)2.508e-06,
-    (float)9.08423e-07,
-    (float)1.41309e-07,
-    (float)1.45849e-06,
-    (float)1.24573e-06,
-    (float)3.13099e-07,
-    (float)2.12809e-07,
-    (float)1.19135e-07,
-    (float)1.07605e-06,
-    (float)4.72331e-07,
-    (float)8.71421e-08,
-    (float)3.82786e-07,
-    (float)1.66038e-07,
-    (float)7.12446e-08,
-    (float)5.87471e-08,
-    (float)6.95867e-08,
-    (float)2.04231e-07,
-    (float)1.4204e-07,
-    (float)2.43e-08,
-    (float)7.60077e-09,
-    (float)1.94342e-07,
-    (float)4.52451e-08,
-    (float)8.61187e-08,
-    (float)4.90876e-07,
-    (float)8.2355e-08,
-    (float)6.67578e-08,
-    (float)4.35247e-08,
-    (float)1.65559e-07,
-    (float)2.47575e-07,
-    (float)2.24354e-08,
-    (float)7.21481e-08,
-    (float)4.06172e-07,
-    (float)2.54639e-08,
-    (float)5.2211e-08,
-    (float)4.11686e-08,
-    (float)5.697e-08,
-    (float)5.35518e-08,
-    (float)1.10745e-08,
-    (float)6.64867e-09,
-    (float)3.09872e-08,
-    (float)2.42875e-08,
-    (float)7.84613e-08,
-    (float)3.51871e-08,
-    (float)6.39615e-08,
-    (float)1.055e-08,
-    (float)3.96108e-08,
-    (float)1.31517e-08,
-    (float)4.26059e-08,
-    (float)9.44918e-08,
-    (float)4.39197e-08,
-    (float)2.61686e-08,
-    (float)5.73892e-08,
-    (float)1.40991e-08,
-    (float)1.98187e-08,
-    (float)3.01666e-09,
-    (float)5.0717e-09,
-    (float)9.2445e-08,
-    (float)1.35741e-08,
-    (float)3.40185e-08,
-    (float)6.18385e-08,
-    (float)7.95619e-09,
-    (float)1.54506e-08,
-    (float)1.6919e-09,
-    (float)1.63945e-08,
-    (float)4.26094e-08,
-    (float)1.93693e-08,
-    (float)1.68871e-08,
-    (float)2.59744e-08,
-    (float)2.966e-08,
-    (float)9.99016e-09,
-    (float)2.47679e-08,
-    (float)2.2538e-08,
-    (float)1.02349e-09,
-    (float)1.83525e-08,
-    (float)7.18071e-09,
-    (float)3.14316e-09,
-    (float)5.65032e-08,
-    (float)1.11141e-09,
-    (float)6.96008e-09,
-    (float)3.14079e-09,
-    (float)1.39541e-08,
-    (float)3.24996e-08,
-    (float)2.80222e-08,
-    (float)2.1825e-08,
-    (float)3.15522e-08,
-    (float)1.8566e-09,
-    (float)4.39158e-09,
-    (float)1.9542e-08,
-    (float)9.25026e-09,
-    (float)9.9894e-09,
-    (float)2.10125e-08,
-    (float)2.53271e-09,
-    (float)1.57169e-08,
-    (float)2.13607e-08,
-    (float)1.01672e-08,
-    (float)4.94624e-09,
-    (float)1.15165e-08,
-    (float)2.52466e-09,
-    (float)1.1556e-08,
-    (float)1.66114e-08,
-    (float)2.08747e-08,
-    (float)3.60596e-08,
-    (float)0.0163464,
-    (float)0.983133,
-    (float)7.1577e-05,
-    (float)1.88973e-05,
-    (float)0.000181107,
-    (float)0.000129971,
-    (float)5.25725e-05,
-    (float)3.62797e-06,
-    (float)4.65485e-06,
-    (float)1.33824e-06,
-    (float)1.30094e-06,
-    (float)1.10996e-06,
-    (float)7.22637e-07,
-    (float)1.41832e-05,
-    (float)6.42283e-06,
-    (float)1.75045e-06,
-    (float)1.38813e-06,
-    (float)2.32398e-06,
-    (float)3.22182e-06,
-    (float)1.09601e-06,
-    (float)4.54886e-08,
-    (float)4.09854e-06,
-    (float)3.26994e-06,
-    (float)8.38475e-07,
-    (float)6.54391e-07,
-    (float)4.00584e-07,
-    (float)2.85445e-06,
-    (float)8.95047e-07,
-    (float)1.76435e-07,
-    (float)1.37018e-06,
-    (float)1.1227e-06,
-    (float)2.73958e-07,
-    (float)1.99895e-07,
-    (float)9.37328e-08,
-    (float)1.07253e-06,
-    (float)4.61215e-07,
-    (float)9.6077e-08,
-    (float)2.66378e-07,
-    (float)1.32279e-07,
-    (float)5.7011e-08,
-    (float)6.94752e-08,
-    (float)1.32388e-07,
-    (float)1.70013e-07,
-    (float)1.27902e-07,
-    (float)1.6479e-08,
-    (float)2.52835e-08,
-    (float)2.65758e-07,
-    (float)6.04119e-08,
-    (float)1.15438e-07,
-    (float)5.91823e-07,
-    (float)8.02865e-08,
-    (float)7.21158e-08,
-    (float)3.60301e-08,
-    (float)1.8622e-07,
-    (float)2.67238e-07,
-    (float)2.33759e-08,
-    (float)6.36264e-08,
-    (float)3.70214e-07,
-    (float)1.43272e-08,
-    (float)6.71278e-08,
-    (float)5.17415e-08,
-    (float)3.43801e-08,
-    (float)3.50312e-08,
-    (float)1.08795e-08,
-    (float)2.40735e-09,
-    (float)6.40669e-09,
-    (float)5.50586e-08,
-    (float)8.44428e-08,
-    (float)5.70712e-08,
-    (float)1.09879e-07,
-    (float)1.31256e-08,
-    (float)4.9036e-08,
-    (float)1.16271e-08,
-    (float)4.05657e-08,
-    (float)1.22801e-07,
-    (float)3.21169e-08,
-    (float)2.69294e-08,
-    (float)3.55647e-08,
-    (float)1.54801e-08,
-    (float)2.83559e-08,
-    (float)7.58273e-09,
-    (float)1.47655e-08,
-    (float)1.22918e-07,
-    (float)1.57243e-08,
-    (float)3.88459e-08,
-    (float)7.36468e-08,
-    (float)5.95251e-09,
-    (float)1.73945e-08,
-    (float)4.07927e-09,
-    (float)1.01467e-08,
-    (float)2.82803e-08,
-    (float)2.49405e-08,
-    (float)1.50972e-08,
-    (float)1.09717e-08,
-    (float)5.82035e-08,
-    (float)9.69343e-09,
-    (float)3.2806e-08,
-    (float)3.15947e-08,
-    (float)5.1822e-09,
-    (float)2.81861e-08,
-    (float)4.61971e-09,
-    (float)1.13384e-08,
-    (float)7.02904e-08,
-    (float)2.10108e-09,
-    (float)1.7384e-08,
-    (float)3.50645e-09,
-    (float)1.48455e-08,
-    (float)4.40593e-08,
-    (float)1.85194e-08,
-    (float)1.18269e-08,
-    (float)2.70489e-08,
-    (float)2.25272e-09,
-    (float)5.2627e-09,
-    (float)3.76788e-08,
-    (float)9.51927e-09,
-    (float)1.92897e-08,
-    (float)2.71243e-08,
-    (float)4.87746e-09,
-    (float)8.79319e-09,
-    (float)2.61092e-08,
-    (float)2.44473e-09,
-    (float)9.99954e-09,
-    (float)2.49104e-08,
-    (float)4.56052e-09,
-    (float)2.19367e-08,
-    (float)1.30469e-08,
-    (float)1.82159e-08,
-    (float)5.62516e-08,
-    (float)0.0084607,
-    (float)0.991225,
-    (float)5.69551e-05,
-    (float)1.61309e-05,
-    (float)9.76203e-05,
-    (float)4.22762e-05,
-    (float)3.21755e-05,
-    (float)3.69891e-06,
-    (float)3.84558e-06,
-    (float)4.33333e-06,
-    (float)1.8662e-06,
-    (float)1.01043e-06,
-    (float)2.45585e-07,
-    (float)1.54572e-05,
-    (float)5.51286e-06,
-    (float)1.84034e-06,
-    (float)1.26576e-06,
-    (float)2.4523e-06,
-    (float)3.85183e-06,
-    (float)1.14051e-06,
-    (float)9.88248e-08,
-    (float)3.87455e-06,
-    (float)3.0622e-06,
-    (float)8.6896e-07,
-    (float)5.48197e-07,
-    (float)3.67923e-07,
-    (float)3.0725e-06,
-    (float)9.3755e-07,
-    (float)1.97503e-07,
-    (float)1.23983e-06,
-    (float)9.43792e-07,
-    (float)2.49691e-07,
-    (float)1.69574e-07,
-    (float)7.82497e-08,
-    (float)1.02882e-06,
-    (float)4.25514e-07,
-    (float)9.16052e-08,
-    (float)1.69968e-07,
-    (float)1.17439e-07,
-    (float)4.90518e-08,
-    (float)9.86982e-08,
-    (float)2.35158e-07,
-    (float)1.40852e-07,
-    (float)1.12167e-07,
-    (float)2.29321e-08,
-    (float)5.86892e-08,
-    (float)3.21222e-07,
-    (float)6.88764e-08,
-    (float)1.73294e-07,
-    (float)6.33115e-07,
-    (float)8.05346e-08,
-    (float)6.68911e-08,
-    (float)4.09715e-08,
-    (float)1.56759e-07,
-    (float)2.70182e-07,
-    (float)2.07546e-08,
-    (float)5.76468e-08,
-    (float)2.83988e-07,
-    (float)7.3485e-09,
-    (float)7.94874e-08,
-    (float)6.15138e-08,
-    (float)2.64469e-08,
-    (float)1.56381e-08,
-    (float)1.30006e-08,
-    (float)1.84159e-10,
-    (float)1.05421e-08,
-    (float)9.3119e-08,
-    (float)8.16231e-08,
-    (float)7.58293e-08,
-    (float)1.2736e-07,
-    (float)1.47147e-08,
-    (float)4.00096e-08,
-    (float)9.23671e-09,
-    (float)2.83822e-08,
-    (float)1.40527e-07,
-    (float)2.3562e-08,
-    (float)3.36583e-08,
-    (float)2.9575e-08,
-    (float)1.49488e-08,
-    (float)2.54534e-08,
-    (float)1.02022e-08,
-    (float)4.13079e-08,
-    (float)1.24625e-07,
-    (float)1.94243e-08,
-    (float)3.20916e-08,
-    (float)7.89458e-08,
-    (float)2.29542e-09,
-    (float)2.09624e-08,
-    (float)1.42679e-08,
-    (float)1.20409e-08,
-    (float)1.92543e-08,
-    (float)2.25962e-08,
-    (float)1.47367e-08,
-    (float)6.29279e-09,
-    (float)8.14463e-08,
-    (float)1.25153e-08,
-    (float)2.54038e-08,
-    (float)2.92032e-08,
-    (float)4.49401e-09,
-    (float)4.01639e-08,
-    (float)5.18412e-09,
-    (float)2.76269e-08,
-    (float)6.02197e-08,
-    (float)1.98003e-09,
-    (float)2.24947e-08,
-    (float)2.50256e-09,
-    (float)1.16608e-08,
-    (float)4.46863e-08,
-    (float)8.95991e-09,
-    (float)4.84239e-09,
-    (float)2.33511e-08,
-    (float)5.92789e-09,
-    (float)9.78177e-09,
-    (float)4.62019e-08,
-    (float)1.4348e-08,
-    (float)2.65673e-08,
-    (float)3.19899e-08,
-    (float)1.06412e-08,
-    (float)1.00807e-08,
-    (float)2.69454e-08,
-    (float)1.06942e-09,
-    (float)1.18789e-08,
-    (float)3.34147e-08,
-    (float)4.17589e-09,
-    (float)3.11413e-08,
-    (float)1.06874e-08,
-    (float)1.18813e-08,
-    (float)5.11287e-08,
-    (float)0.00346914,
-    (float)0.996334,
-    (float)4.76051e-05,
-    (float)1.35217e-05,
-    (float)4.20407e-05,
-    (float)2.90721e-06,
-    (float)1.78547e-05,
-    (float)3.67191e-06,
-    (float)3.16531e-06,
-    (float)8.38878e-06,
-    (float)2.73826e-06,
-    (float)9.98737e-07,
-    (float)4.81995e-08,
-    (float)1.62409e-05,
-    (float)4.79363e-06,
-    (float)1.8554e-06,
-    (float)1.21778e-06,
-    (float)2.46804e-06,
-    (float)4.54519e-06,
-    (float)1.2309e-06,
-    (float)1.65156e-07,
-    (float)3.62094e-06,
-    (float)2.86274e-06,
-    (float)9.27504e-07,
-    (float)4.84925e-07,
-    (float)3.28004e-07,
-    (float)3.27315e-06,
-    (float)9.67594e-07,
-    (float)2.12546e-07,
-    (float)1.06371e-06,
-    (float)7.91844e-07,
-    (float)2.47278e-07,
-    (float)1.44452e-07,
-    (float)6.26282e-08,
-    (float)9.27016e-07,
-    (float)3.64308e-07,
-    (float)7.54989e-08,
-    (float)1.04423e-07,
-    (float)1.02443e-07,
-    (float)5.01315e-08,
-    (float)1.3028e-07,
-    (float)3.29686e-07,
-    (float)1.17701e-07,
-    (float)8.47941e-08,
-    (float)3.0622e-08,
-    (float)9.77756e-08,
-    (float)3.94094e-07,
-    (float)6.57954e-08,
-    (float)2.04797e-07,
-    (float)6.52918e-07,
-    (float)7.47712e-08,
-    (float)6.97216e-08,
-    (float)5.94131e-08,
-    (float)1.16453e-07,
-    (float)2.40896e-07,
-    (float)1.20954e-08,
-    (float)6.43103e-08,
-    (float)1.99695e-07,
-    (float)1.18326e-08,
-    (float)9.49098e-08,
-    (float)6.62621e-08,
-    (float)3.45318e-08,
-    (float)1.95415e-09,
-    (float)1.22896e-08,
-    (float)1.30993e-09,
-    (float)2.17633e-08,
-    (float)1.41925e-07,
-    (float)8.02173e-08,
-    (float)8.24763e-08,
-    (float)1.16558e-07,
-    (float)1.48516e-08,
-    (float)2.71492e-08,
-    (float)5.90275e-09,
-    (float)1.92367e-08,
-    (float)1.60205e-07,
-    (float)1.6074e-08,
-    (float)3.60967e-08,
-    (float)4.10752e-08,
-    (float)1.35803e-08,
-    (float)3.24245e-08,
-    (float)1.40847e-08,
-    (float)6.35533e-08,
-    (float)9.96067e-08,
-    (float)1.99739e-08,
-    (float)2.23003e-08,
-    (float)6.86453e-08,
-    (float)8.18571e-09,
-    (float)2.62573e-08,
-    (float)1.81102e-08,
-    (float)1.75843e-08,
-    (float)1.76961e-08,
-    (float)2.15043e-08,
-    (float)1.90583e-08,
-    (float)6.48152e-09,
-    (float)9.6598e-08,
-    (float)1.126e-08,
-    (float)1.61871e-08,
-    (float)2.1536e-08,
-    (float)1.23237e-09,
-    (float)4.72816e-08,
-    (float)1.5473e-08,
-    (float)4.19975e-08,
-    (float)3.80355e-08,
-    (float)1.15668e-09,
-    (float)2.36837e-08,
-    (float)5.69226e-09,
-    (float)8.16493e-09,
-    (float)4.98832e-08,
-    (float)3.94261e-09,
-    (float)1.68906e-09,
-    (float)1.96373e-08,
-    (float)7.93511e-09,
-    (float)2.07462e-08,
-    (float)4.38812e-08,
-    (float)2.92545e-08,
-    (float)2.98125e-08,
-    (float)2.85402e-08,
-    (float)1.73928e-08,
-    (float)8.7333e-09,
-    (float)2.62568e-08,
-    (float)4.08093e-09,
-    (float)2.0077e-08,
-    (float)3.77603e-08,
-    (float)3.30568e-09,
-    (float)3.0201e-08,
-    (float)9.18714e-09,
-    (float)5.90894e-09,
-    (float)4.30944e-08,
-    (float)0.000811109,
-    (float)0.999022,
-    (float)4.11331e-05,
-    (float)1.12832e-05,
-    (float)1.17738e-05,
-    (float)1.49298e-05,
-    (float)8.90398e-06,
-    (float)3.56454e-06,
-    (float)2.66868e-06,
-    (float)1.28862e-05,
-    (float)3.88779e-06,
-    (float)9.98661e-07,
-    (float)7.63295e-08,
-    (float)1.66649e-05,
-    (float)4.15721e-06,
-    (float)1.87553e-06,
-    (float)1.18402e-06,
-    (float)2.43799e-06,
-    (float)5.31962e-06,
-    (float)1.31485e-06,
-    (float)2.40967e-07,
-    (float)3.36234e-06,
-    (float)2.68263e-06,
-    (float)9.25805e-07,
-    (float)4.70021e-07,
-    (float)3.08469e-07,
-    (float)3.41629e-06,
-    (float)9.32196e-07,
-    (float)2.35911e-07,
-    (float)9.26397e-07,
-    (float)6.42158e-07,
-    (float)2.45219e-07,
-    (float)1.35496e-07,
-    (float)6.42818e-08,
-    (float)8.05102e-07,
-    (float)3.18178e-07,
-    (float)6.20018e-08,
-    (float)6.04331e-08,
-    (float)1.21009e-07,
-    (float)6.57436e-08,
-    (float)1.78351e-07,
-    (float)4.08553e-07,
-    (float)1.03288e-07,
-    (float)7.81348e-08,
-    (float)4.34688e-08,
-    (float)1.35769e-07,
-    (float)4.64634e-07,
-    (float)5.64116e-08,
-    (float)2.09909e-07,
-    (float)6.71159e-07,
-    (float)5.25411e-08,
-    (float)6.55918e-08,
-    (float)6.75227e-08,
-    (float)8.36326e-08,
-    (float)1.81716e-07,
-    (float)9.56509e-09,
-    (float)7.02175e-08,
-    (float)1.34478e-07,
-    (float)3.19709e-08,
-    (float)1.09904e-07,
-    (float)6.68755e-08,
-    (float)5.17642e-08,
-    (float)1.25028e-09,
-    (float)1.7884e-08,
-    (float)6.12738e-09,
-    (float)3.04844e-08,
-    (float)1.9062e-07,
-    (float)8.50947e-08,
-    (float)7.85732e-08,
-    (float)8.87374e-08,
-    (float)1.82411e-08,
-    (float)2.00104e-08,
-    (float)4.83611e-09,
-    (float)1.52404e-08,
-    (float)1.69309e-07,
-    (float)1.72723e-08,
-    (float)4.71788e-08,
-    (float)6.67825e-08,
-    (float)1.81717e-08,
-    (float)4.75269e-08,
-    (float)1.16534e-08,
-    (float)6.71197e-08,
-    (float)7.92957e-08,
-    (float)2.60065e-08,
-    (float)2.01724e-08,
-    (float)4.82745e-08,
-    (float)2.32603e-08,
-    (float)2.80131e-08,
-    (float)2.58232e-08,
-    (float)2.74714e-08,
-    (float)1.57549e-08,
-    (float)2.08795e-08,
-    (float)1.49596e-08,
-    (float)7.50135e-09,
-    (float)9.34833e-08,
-    (float)6.44123e-09,
-    (float)1.73026e-08,
-    (float)1.62991e-08,
-    (float)8.34984e-10,
-    (float)6.02226e-08,
-    (float)3.29854e-08,
-    (float)4.15098e-08,
-    (float)2.64227e-08,
-    (float)2.67478e-10,
-    (float)2.60483e-08,
-    (float)1.94451e-08,
-    (float)9.39207e-09,
-    (float)3.73309e-08,
-    (float)3.35151e-09,
-    (float)3.3785e-10,
-    (float)1.73772e-08,
-    (float)9.6817e-09,
-    (float)3.4681e-08,
-    (float)3.25581e-08,
-    (float)4.50689e-08,
-    (float)3.33731e-08,
-    (float)1.87581e-08,
-    (float)2.54987e-08,
-    (float)4.66908e-09,
-    (float)2.40078e-08,
-    (float)6.35158e-09,
-    (float)3.24551e-08,
-    (float)4.08176e-08,
-    (float)6.36001e-09,
-    (float)3.99436e-08,
-    (float)6.10893e-09,
-    (float)5.31113e-09,
-    (float)3.04515e-08,
-    (float)1.04617e-05,
-    (float)0.999771,
-    (float)3.59802e-05,
-    (float)9.10399e-06,
-    (float)4.45297e-06,
-    (float)8.06086e-05,
-    (float)4.15498e-06,
-    (float)3.57202e-06,
-    (float)2.61202e-06,
-    (float)1.7194e-05,
-    (float)5.31272e-06,
-    (float)9.76246e-07,
-    (float)2.18218e-07,
-    (float)1.67479e-05,
-    (float)3.6218e-06,
-    (float)1.86678e-06,
-    (float)1.15249e-06,
-    (float)2.32863e-06,
-    (float)6.23382e-06,
-    (float)1.31714e-06,
-    (float)3.48978e-07,
-    (float)2.98919e-06,
-    (float)2.51438e-06,
-    (float)8.62639e-07,
-    (float)4.74311e-07,
-    (float)2.79658e-07,
-    (float)3.42119e-06,
-    (float)8.8269e-07,
-    (float)2.66468e-07,
-    (float)8.07816e-07,
-    (float)4.8427e-07,
-    (float)2.22564e-07,
-    (float)1.4573e-07,
-    (float)7.57399e-08,
-    (float)6.96192e-07,
-    (float)3.01096e-07,
-    (float)5.58434e-08,
-    (float)2.69796e-08,
-    (float)1.82401e-07,
-    (float)7.66346e-08,
-    (float)2.48879e-07,
-    (float)4.84309e-07,
-    (float)9.28325e-08,
-    (float)7.77942e-08,
-    (float)4.39344e-08,
-    (float)1.6007e-07,
-    (float)4.92935e-07,
-    (float)6.14107e-08,
-    (float)2.05045e-07,
-    (float)6.34335e-07,
-    (float)2.86034e-08,
-    (float)6.12266e-08,
-    (float)6.52196e-08,
-    (float)5.26514e-08,
-    (float)1.21848e-07,
-    (float)8.76147e-09,
-    (float)5.14176e-08,
-    (float)7.70815e-08,
-    (float)7.80493e-08,
-    (float)1.15582e-07,
-    (float)8.22822e-08,
-    (float)8.18944e-08,
-    (float)8.55784e-09,
-    (float)2.11478e-08,
-    (float)5.92924e-09,
-    (float)3.25398e-08,
-    (float)2.2005e-07,
-    (float)7.51468e-08,
-    (float)6.41378e-08,
-    (float)5.14919e-08,
-    (float)1.41058e-08,
-    (float)2.40515e-08,
-    (float)9.71816e-09,
-    (float)3.81678e-08,
-    (float)1.58532e-07,
-    (float)2.46917e-08,
-    (float)5.03599e-08,
-    (float)8.05268e-08,
-    (float)2.29913e-08,
-    (float)4.65629e-08,
-    (float)1.1546e-08,
-    (float)5.00317e-08,
-    (float)5.65364e-08,
-    (float)3.85651e-08,
-    (float)1.97527e-08,
-    (float)3.04989e-08,
-    (float)4.94711e-08,
-    (float)2.2903e-08,
-    (float)3.72363e-08,
-    (float)3.27128e-08,
-    (float)1.95795e-08,
-    (float)2.79834e-08,
-    (float)9.20736e-09,
-    (float)1.30325e-08,
-    (float)7.31159e-08,
-    (float)8.70869e-09,
-    (float)2.04125e-08,
-    (float)1.56235e-08,
-    (float)9.14053e-09,
-    (float)5.30166e-08,
-    (float)4.44371e-08,
-    (float)3.1063e-08,
-    (float)1.60079e-08,
-    (float)3.08806e-09,
-    (float)1.95142e-08,
-    (float)3.95597e-08,
-    (float)2.01503e-08,
-    (float)3.06566e-08,
-    (float)6.47516e-09,
-    (float)4.26907e-10,
-    (float)1.37203e-08,
-    (float)1.19419e-08,
-    (float)2.98982e-08,
-    (float)2.2551e-08,
-    (float)5.3084e-08,
-    (float)3.66799e-08,
-    (float)1.59309e-08,
-    (float)2.23179e-08,
-    (float)2.09781e-09,
-    (float)1.82531e-08,
-    (float)1.10179e-08,
-    (float)4.7423e-08,
-    (float)3.35154e-08,
-    (float)1.21272e-08,
-    (float)3.92127e-08,
-    (float)3.72279e-09,
-    (float)7.24467e-09,
-    (float)1.86678e-08,
-    (float)1.04617e-05,
-    (float)0.999771,
-    (float)3.59802e-05,
-    (float)9.10399e-06,
-    (float)4.45297e-06,
-    (float)8.06086e-05,
-    (float)4.15498e-06,
-    (float)3.57202e-06,
-    (float)2.61202e-06,
-    (float)1.7194e-05,
-    (float)5.31272e-06,
-    (float)9.76246e-07,
-    (float)2.18218e-07,
-    (float)1.67479e-05,
-    (float)3.6218e-06,
-    (float)1.86678e-06,
-    (float)1.15249e-06,
-    (float)2.32863e-06,
-    (float)6.23382e-06,
-    (float)1.31714e-06,
-    (float)3.48978e-07,
-    (float)2.98919e-06,
-    (float)2.51438e-06,
-    (float)8.62639e-07,
-    (float)4.74311e-07,
-    (float)2.79658e-07,
-    (float)3.42119e-06,
-    (float)8.8269e-07,
-    (float)2.66468e-07,
-    (float)8.07816e-07,
-    (float)4.8427e-07,
-    (float)2.22564e-07,
-    (float)1.4573e-07,
-    (float)7.57399e-08,
-    (float)6.96192e-07,
-    (float)3.01096e-07,
-    (float)5.58434e-08,
-    (float)2.69796e-08,
-    (float)1.82401e-07,
-    (float)7.66346e-08,
-    (float)2.48879e-07,
-    (float)4.84309e-07,
-    (float)9.28325e-08,
-    (float)7.77942e-08,
-    (float)4.39344e-08,
-    (float)1.6007e-07,
-    (float)4.92935e-07,
-    (float)6.14107e-08,
-    (float)2.05045e-07,
-    (float)6.34335e-07,
-    (float)2.86034e-08,
-    (float)6.12266e-08,
-    (float)6.52196e-08,
-    (float)5.26514e-08,
-    (float)1.21848e-07,
-    (float)8.76147e-09,
-    (float)5.14176e-08,
-    (float)7.70815e-08,
-    (float)7.80493e-08,
-    (float)1.15582e-07,
-    (float)8.22822e-08,
-    (float)8.18944e-08,
-    (float)8.55784e-09,
-    (float)2.11478e-08,
-    (float)5.92924e-09,
-    (float)3.25398e-08,
-    (float)2.2005e-07,
-    (float)7.51468e-08,
-    (float)6.41378e-08,
-    (float)5.14919e-08,
-    (float)1.41058e-08,
-    (float)2.40515e-08,
-    (float)9.71816e-09,
-    (float)3.81678e-08,
-    (float)1.58532e-07,
-    (float)2.46917e-08,
-    (float)5.03599e-08,
-    (float)8.05268e-08,
-    (float)2.29913e-08,
-    (float)4.65629e-08,
-    (float)1.1546e-08,
-    (float)5.00317e-08,
-    (float)5.65364e-08,
-    (float)3.85651e-08,
-    (float)1.97527e-08,
-    (float)3.04989e-08,
-    (float)4.94711e-08,
-    (float)2.2903e-08,
-    (float)3.72363e-08,
-    (float)3.27128e-08,
-    (float)1.95795e-08,
-    (float)2.79834e-08,
-    (float)9.20736e-09,
-    (float)1.30325e-08,
-    (float)7.31159e-08,
-    (float)8.70869e-09,
-    (float)2.04125e-08,
-    (float)1.56235e-08,
-    (float)9.14053e-09,
-    (float)5.30166e-08,
-    (float)4.44371e-08,
-    (float)3.1063e-08,
-    (float)1.60079e-08,
-    (float)3.08806e-09,
-    (float)1.95142e-08,
-    (float)3.95597e-08,
-    (float)2.01503e-08,
-    (float)3.06566e-08,
-    (float)6.47516e-09,
-    (float)4.26907e-10,
-    (float)1.37203e-08,
-    (float)1.19419e-08,
-    (float)2.98982e-08,
-    (float)2.2551e-08,
-    (float)5.3084e-08,
-    (float)3.66799e-08,
-    (float)1.59309e-08,
-    (float)2.23179e-08,
-    (float)2.09781e-09,
-    (float)1.82531e-08,
-    (float)1.10179e-08,
-    (float)4.7423e-08,
-    (float)3.35154e-08,
-    (float)1.21272e-08,
-    (float)3.92127e-08,
-    (float)3.72279e-09,
-    (float)7.24467e-09,
-    (float)1.86678e-08,
-    (float)0.000286598,
-    (float)0.998922,
-    (float)0.000487007,
-    (float)9.61659e-05,
-    (float)2.79109e-05,
-    (float)1.11505e-05,
-    (float)4.44256e-05,
-    (float)1.47376e-05,
-    (float)1.03668e-05,
-    (float)7.74562e-06,
-    (float)2.59449e-06,
-    (float)2.37101e-06,
-    (float)1.03967e-06,
-    (float)2.42475e-05,
-    (float)4.19526e-06,
-    (float)6.44837e-06,
-    (float)4.57587e-06,
-    (float)1.0488e-06,
-    (float)6.77774e-06,
-    (float)9.39286e-07,
-    (float)5.83553e-07,
-    (float)5.96938e-06,
-    (float)1.95243e-06,
-    (float)1.51994e-06,
-    (float)1.91559e-06,
-    (float)9.20224e-07,
-    (float)3.98711e-06,
-    (float)1.38454e-06,
-    (float)4.523e-07,
-    (float)1.93862e-06,
-    (float)2.1261e-07,
-    (float)4.98984e-07,
-    (float)4.14604e-07,
-    (float)4.33732e-07,
-    (float)1.39847e-06,
-    (float)6.732e-07,
-    (float)2.74771e-07,
-    (float)1.95201e-07,
-    (float)9.1882e-08,
-    (float)2.24358e-07,
-    (float)4.1164e-07,
-    (float)7.31657e-07,
-    (float)4.71942e-07,
-    (float)2.85946e-07,
-    (float)1.11998e-07,
-    (float)8.47945e-08,
-    (float)3.48857e-07,
-    (float)1.55382e-07,
-    (float)3.85908e-07,
-    (float)1.29887e-06,
-    (float)1.76793e-07,
-    (float)2.28478e-07,
-    (float)9.30614e-08,
-    (float)2.36979e-08,
-    (float)2.03935e-07,
-    (float)8.65666e-08,
-    (float)1.7148e-07,
-    (float)3.42302e-07,
-    (float)1.46993e-07,
-    (float)2.28712e-07,
-    (float)1.97827e-07,
-    (float)2.62849e-07,
-    (float)1.02321e-07,
-    (float)3.79153e-08,
-    (float)7.90994e-08,
-    (float)4.658e-09,
-    (float)1.75865e-07,
-    (float)1.90019e-07,
-    (float)1.65971e-07,
-    (float)3.8095e-07,
-    (float)1.04926e-07,
-    (float)7.2091e-08,
-    (float)6.85006e-08,
-    (float)8.46618e-08,
-    (float)1.66698e-07,
-    (float)1.16773e-07,
-    (float)1.23919e-07,
-    (float)6.83395e-08,
-    (float)6.09397e-08,
-    (float)8.6277e-08,
-    (float)7.917e-08,
-    (float)2.58742e-07,
-    (float)1.47962e-07,
-    (float)8.63812e-08,
-    (float)9.17182e-08,
-    (float)4.08418e-08,
-    (float)4.30855e-08,
-    (float)7.07617e-08,
-    (float)8.15278e-08,
-    (float)8.56374e-08,
-    (float)1.28583e-07,
-    (float)7.92921e-08,
-    (float)6.94466e-08,
-    (float)8.13373e-08,
-    (float)7.0878e-08,
-    (float)6.35092e-08,
-    (float)7.01164e-08,
-    (float)1.09827e-07,
-    (float)1.01701e-07,
-    (float)7.79899e-08,
-    (float)6.76649e-08,
-    (float)4.52964e-08,
-    (float)6.92649e-08,
-    (float)5.13351e-08,
-    (float)6.46309e-08,
-    (float)7.19645e-08,
-    (float)7.9128e-08,
-    (float)9.47853e-08,
-    (float)7.79573e-08,
-    (float)7.22237e-08,
-    (float)4.38059e-08,
-    (float)3.63742e-08,
-    (float)4.60545e-08,
-    (float)4.45015e-08,
-    (float)7.93196e-08,
-    (float)1.02035e-07,
-    (float)1.12175e-07,
-    (float)1.69626e-07,
-    (float)5.25448e-08,
-    (float)4.82201e-08,
-    (float)5.76493e-08,
-    (float)3.34276e-08,
-    (float)5.76922e-08,
-    (float)6.82264e-08,
-    (float)6.00136e-08,
-    (float)5.37802e-08,
-    (float)5.50003e-08,
-    (float)3.94174e-08,
-    (float)0.00104009,
-    (float)0.996651,
-    (float)0.001511,
-    (float)0.000299432,
-    (float)8.68658e-05,
-    (float)5.83023e-05,
-    (float)0.000132496,
-    (float)3.586e-05,
-    (float)2.39892e-05,
-    (float)1.58349e-06,
-    (float)6.01535e-06,
-    (float)5.78084e-06,
-    (float)3.07589e-06,
-    (float)3.32933e-05,
-    (float)5.38436e-06,
-    (float)1.45567e-05,
-    (float)1.11406e-05,
-    (float)1.50882e-06,
-    (float)7.22774e-06,
-    (float)1.06345e-06,
-    (float)7.00385e-07,
-    (float)9.39498e-06,
-    (float)2.95197e-06,
-    (float)2.71201e-06,
-    (float)4.69136e-06,
-    (float)3.27083e-06,
-    (float)4.5225e-06,
-    (float)1.81208e-06,
-    (float)7.76199e-07,
-    (float)3.15576e-06,
-    (float)6.02171e-07,
-    (float)1.31926e-06,
-    (float)9.19296e-07,
-    (float)1.49368e-06,
-    (float)2.31088e-06,
-    (float)1.31978e-06,
-    (float)7.00807e-07,
-    (float)8.00619e-07,
-    (float)1.42649e-07,
-    (float)6.00357e-07,
-    (float)6.95712e-07,
-    (float)7.22005e-07,
-    (float)1.23049e-06,
-    (float)8.18166e-07,
-    (float)6.02161e-07,
-    (float)4.33138e-07,
-    (float)2.32946e-07,
-    (float)2.95212e-07,
-    (float)5.98175e-07,
-    (float)1.58491e-06,
-    (float)7.90073e-07,
-    (float)6.39459e-07,
-    (float)3.65184e-07,
-    (float)3.24321e-07,
-    (float)1.61488e-07,
-    (float)2.20621e-07,
-    (float)4.03517e-07,
-    (float)6.94913e-07,
-    (float)4.4142e-07,
-    (float)5.10334e-07,
-    (float)2.79907e-07,
-    (float)2.98392e-07,
-    (float)3.8368e-07,
-    (float)1.45768e-07,
-    (float)3.49264e-07,
-    (float)2.79927e-07,
-    (float)1.83702e-07,
-    (float)3.14365e-07,
-    (float)2.00155e-07,
-    (float)4.61891e-07,
-    (float)4.34575e-07,
-    (float)2.70889e-07,
-    (float)2.68905e-07,
-    (float)3.61467e-07,
-    (float)1.35805e-07,
-    (float)2.36071e-07,
-    (float)2.57205e-07,
-    (float)8.18266e-08,
-    (float)2.34408e-07,
-    (float)2.06958e-07,
-    (float)1.578e-07,
-    (float)5.25382e-07,
-    (float)2.85297e-07,
-    (float)2.60753e-07,
-    (float)3.70959e-07,
-    (float)9.9279e-08,
-    (float)1.14118e-07,
-    (float)1.46566e-07,
-    (float)1.48219e-07,
-    (float)1.09878e-07,
-    (float)2.90465e-07,
-    (float)1.83109e-07,
-    (float)1.98913e-07,
-    (float)4.42931e-07,
-    (float)9.73669e-08,
-    (float)1.87344e-07,
-    (float)1.40167e-07,
-    (float)8.61833e-08,
-    (float)2.77492e-07,
-    (float)1.75618e-07,
-    (float)2.21566e-07,
-    (float)1.58411e-07,
-    (float)7.32233e-08,
-    (float)1.2558e-07,
-    (float)1.24362e-07,
-    (float)1.99175e-07,
-    (float)2.72389e-07,
-    (float)2.1444e-07,
-    (float)1.25934e-07,
-    (float)1.29556e-07,
-    (float)1.14317e-07,
-    (float)1.34737e-07,
-    (float)1.92147e-07,
-    (float)1.82181e-07,
-    (float)1.94041e-07,
-    (float)2.10721e-07,
-    (float)2.01024e-07,
-    (float)1.25185e-07,
-    (float)1.84645e-07,
-    (float)1.06615e-07,
-    (float)1.35463e-07,
-    (float)1.73292e-07,
-    (float)1.54459e-07,
-    (float)1.75606e-07,
-    (float)9.4818e-08,
-    (float)1.50132e-07,
-    (float)1.95825e-07,
-    (float)1.04968e-07,
-    (float)0.00235657,
-    (float)0.992684,
-    (float)0.00319869,
-    (float)0.000652063,
-    (float)0.000199507,
-    (float)0.000236713,
-    (float)0.000277574,
-    (float)7.03327e-05,
-    (float)4.52862e-05,
-    (float)2.47554e-06,
-    (float)1.88174e-05,
-    (float)1.25289e-05,
-    (float)7.15622e-06,
-    (float)4.39934e-05,
-    (float)7.32271e-06,
-    (float)2.62868e-05,
-    (float)2.18125e-05,
-    (float)5.44998e-06,
-    (float)7.84412e-06,
-    (float)2.96013e-06,
-    (float)1.17121e-06,
-    (float)1.22567e-05,
-    (float)5.5952e-06,
-    (float)4.29441e-06,
-    (float)8.63277e-06,
-    (float)8.23695e-06,
-    (float)5.5722e-06,
-    (float)2.11676e-06,
-    (float)1.72128e-06,
-    (float)3.70173e-06,
-    (float)1.71067e-06,
-    (float)2.66411e-06,
-    (float)1.85362e-06,
-    (float)3.80507e-06,
-    (float)3.3773e-06,
-    (float)2.34056e-06,
-    (float)1.17584e-06,
-    (float)1.56153e-06,
-    (float)5.92641e-07,
-    (float)1.37055e-06,
-    (float)1.31104e-06,
-    (float)9.44166e-07,
-    (float)1.98384e-06,
-    (float)1.44027e-06,
-    (float)1.37667e-06,
-    (float)1.14259e-06,
-    (float)5.36696e-07,
-    (float)7.69227e-07,
-    (float)1.32872e-06,
-    (float)1.13721e-06,
-    (float)1.44207e-06,
-    (float)1.08078e-06,
-    (float)7.84743e-07,
-    (float)1.44828e-06,
-    (float)2.4818e-07,
-    (float)5.92567e-07,
-    (float)8.52559e-07,
-    (float)6.86858e-07,
-    (float)9.34867e-07,
-    (float)8.9008e-07,
-    (float)5.91692e-07,
-    (float)6.64264e-07,
-    (float)5.56386e-07,
-    (float)3.5241e-07,
-    (float)5.26397e-07,
-    (float)7.3474e-07,
-    (float)6.85579e-07,
-    (float)5.889e-07,
-    (float)6.83044e-07,
-    (float)2.77049e-07,
-    (float)5.58547e-07,
-    (float)4.88042e-07,
-    (float)3.93739e-07,
-    (float)9.61448e-07,
-    (float)4.98782e-07,
-    (float)5.77025e-07,
-    (float)4.38249e-07,
-    (float)1.41113e-07,
-    (float)3.52992e-07,
-    (float)3.87717e-07,
-    (float)4.00158e-07,
-    (float)8.01565e-07,
-    (float)4.38828e-07,
-    (float)5.54726e-07,
-    (float)6.07156e-07,
-    (float)2.09852e-07,
-    (float)4.10557e-07,
-    (float)2.52691e-07,
-    (float)4.18426e-07,
-    (float)3.91242e-07,
-    (float)3.3067e-07,
-    (float)4.03478e-07,
-    (float)3.25027e-07,
-    (float)5.18307e-07,
-    (float)3.62408e-07,
-    (float)3.33635e-07,
-    (float)4.30025e-07,
-    (float)3.33335e-07,
-    (float)3.70918e-07,
-    (float)3.62176e-07,
-    (float)2.31997e-07,
-    (float)4.48046e-07,
-    (float)2.71243e-07,
-    (float)2.98881e-07,
-    (float)3.29238e-07,
-    (float)2.15067e-07,
-    (float)4.53469e-07,
-    (float)3.1404e-07,
-    (float)3.46681e-07,
-    (float)3.89762e-07,
-    (float)2.94765e-07,
-    (float)3.51953e-07,
-    (float)3.21646e-07,
-    (float)2.70449e-07,
-    (float)3.18452e-07,
-    (float)4.06468e-07,
-    (float)3.82687e-07,
-    (float)3.00901e-07,
-    (float)2.27087e-07,
-    (float)2.14527e-07,
-    (float)1.72736e-07,
-    (float)3.24823e-07,
-    (float)3.16695e-07,
-    (float)3.42396e-07,
-    (float)4.76577e-07,
-    (float)3.13917e-07,
-    (float)2.54568e-07,
-    (float)2.17798e-07,
-    (float)0.00435827,
-    (float)0.986662,
-    (float)0.00566292,
-    (float)0.00119099,
-    (float)0.000391282,
-    (float)0.000559633,
-    (float)0.000493563,
-    (float)0.000125065,
-    (float)7.64285e-05,
-    (float)1.41673e-05,
-    (float)4.57073e-05,
-    (float)2.42057e-05,
-    (float)1.53607e-05,
-    (float)5.72151e-05,
-    (float)1.04042e-05,
-    (float)4.21108e-05,
-    (float)3.62338e-05,
-    (float)1.46177e-05,
-    (float)9.25764e-06,
-    (float)7.7587e-06,
-    (float)3.37733e-06,
-    (float)1.40587e-05,
-    (float)9.77381e-06,
-    (float)6.63456e-06,
-    (float)1.3074e-05,
-    (float)1.66937e-05,
-    (float)8.48073e-06,
-    (float)2.81069e-06,
-    (float)4.39716e-06,
-    (float)3.27762e-06,
-    (float)3.3732e-06,
-    (float)4.54089e-06,
-    (float)2.87716e-06,
-    (float)7.81775e-06,
-    (float)5.38034e-06,
-    (float)4.05486e-06,
-    (float)2.01529e-06,
-    (float)2.04005e-06,
-    (float)1.43784e-06,
-    (float)2.60829e-06,
-    (float)2.25374e-06,
-    (float)2.15169e-06,
-    (float)2.94421e-06,
-    (float)2.34977e-06,
-    (float)2.12981e-06,
-    (float)2.02801e-06,
-    (float)1.30504e-06,
-    (float)1.67061e-06,
-    (float)3.07102e-06,
-    (float)6.77026e-07,
-    (float)1.95482e-06,
-    (float)1.42583e-06,
-    (float)7.32182e-07,
-    (float)2.8784e-06,
-    (float)8.76673e-07,
-    (float)1.28049e-06,
-    (float)2.46094e-06,
-    (float)7.4848e-07,
-    (float)1.23019e-06,
-    (float)1.33842e-06,
-    (float)6.3739e-07,
-    (float)1.44937e-06,
-    (float)9.64073e-07,
-    (float)8.41025e-07,
-    (float)8.69873e-07,
-    (float)1.04946e-06,
-    (float)1.42512e-06,
-    (float)9.6114e-07,
-    (float)1.54768e-06,
-    (float)6.66288e-07,
-    (float)6.9343e-07,
-    (float)7.64199e-07,
-    (float)3.6142e-07,
-    (float)1.02511e-06,
-    (float)1.14365e-06,
-    (float)1.16817e-06,
-    (float)1.12638e-06,
-    (float)6.77474e-07,
-    (float)5.64032e-07,
-    (float)5.94924e-07,
-    (float)7.28413e-07,
-    (float)9.05705e-07,
-    (float)8.02022e-07,
-    (float)1.07697e-06,
-    (float)8.03881e-07,
-    (float)5.61694e-07,
-    (float)6.42384e-07,
-    (float)4.71497e-07,
-    (float)9.66183e-07,
-    (float)7.79552e-07,
-    (float)6.67963e-07,
-    (float)6.63167e-07,
-    (float)6.9888e-07,
-    (float)5.71683e-07,
-    (float)6.38002e-07,
-    (float)5.98671e-07,
-    (float)4.63967e-07,
-    (float)8.8853e-07,
-    (float)6.1647e-07,
-    (float)6.81218e-07,
-    (float)6.80513e-07,
-    (float)4.24852e-07,
-    (float)5.77398e-07,
-    (float)4.49831e-07,
-    (float)4.8991e-07,
-    (float)7.93471e-07,
-    (float)7.60106e-07,
-    (float)6.50845e-07,
-    (float)6.88021e-07,
-    (float)3.53625e-07,
-    (float)4.88613e-07,
-    (float)6.45791e-07,
-    (float)4.24851e-07,
-    (float)6.13269e-07,
-    (float)5.48752e-07,
-    (float)5.88039e-07,
-    (float)7.19497e-07,
-    (float)5.27018e-07,
-    (float)4.90897e-07,
-    (float)4.18298e-07,
-    (float)5.09375e-07,
-    (float)5.67558e-07,
-    (float)4.54048e-07,
-    (float)6.10125e-07,
-    (float)5.1671e-07,
-    (float)5.79713e-07,
-    (float)5.95997e-07,
-    (float)5.01923e-07,
-    (float)0.00717891,
-    (float)0.978125,
-    (float)0.0090559,
-    (float)0.00196981,
-    (float)0.00069689,
-    (float)0.00103897,
-    (float)0.000805011,
-    (float)0.000209259,
-    (float)0.000123094,
-    (float)4.06862e-05,
-    (float)9.28036e-05,
-    (float)4.30495e-05,
-    (float)2.98149e-05,
-    (float)7.48276e-05,
-    (float)1.51622e-05,
-    (float)6.25936e-05,
-    (float)5.54027e-05,
-    (float)3.10953e-05,
-    (float)1.19424e-05,
-    (float)1.75888e-05,
-    (float)9.46023e-06,
-    (float)1.48283e-05,
-    (float)1.5821e-05,
-    (float)1.02174e-05,
-    (float)1.72191e-05,
-    (float)2.81443e-05,
-    (float)1.43317e-05,
-    (float)4.26876e-06,
-    (float)9.98622e-06,
-    (float)2.4453e-06,
-    (float)5.57849e-06,
-    (float)6.62836e-06,
-    (float)4.13404e-06,
-    (float)1.25155e-05,
-    (float)8.7135e-06,
-    (float)7.28252e-06,
-    (float)3.96976e-06,
-    (float)2.68825e-06,
-    (float)2.87241e-06,
-    (float)4.34156e-06,
-    (float)3.08694e-06,
-    (float)4.71263e-06,
-    (float)4.13677e-06,
-    (float)3.74241e-06,
-    (float)3.29855e-06,
-    (float)2.59096e-06,
-    (float)2.4222e-06,
-    (float)2.95763e-06,
-    (float)5.29782e-06,
-    (float)1.59423e-06,
-    (float)3.01965e-06,
-    (float)2.12165e-06,
-    (float)7.96105e-07,
-    (float)3.30802e-06,
-    (float)1.69393e-06,
-    (float)1.93098e-06,
-    (float)4.33921e-06,
-    (float)2.19572e-06,
-    (float)1.90146e-06,
-    (float)2.20804e-06,
-    (float)8.44684e-07,
-    (float)1.92318e-06,
-    (float)1.48244e-06,
-    (float)1.59237e-06,
-    (float)1.66903e-06,
-    (float)1.73505e-06,
-    (float)2.24787e-06,
-    (float)1.39568e-06,
-    (float)2.07853e-06,
-    (float)1.59379e-06,
-    (float)1.39096e-06,
-    (float)1.41588e-06,
-    (float)1.00907e-06,
-    (float)1.0187e-06,
-    (float)1.50989e-06,
-    (float)1.55328e-06,
-    (float)1.64954e-06,
-    (float)1.54958e-06,
-    (float)1.31746e-06,
-    (float)1.30964e-06,
-    (float)1.38447e-06,
-    (float)1.18708e-06,
-    (float)1.17135e-06,
-    (float)1.58842e-06,
-    (float)9.08793e-07,
-    (float)1.11191e-06,
-    (float)9.26177e-07,
-    (float)7.98923e-07,
-    (float)1.77036e-06,
-    (float)1.25772e-06,
-    (float)1.34462e-06,
-    (float)1.35891e-06,
-    (float)1.02374e-06,
-    (float)9.73343e-07,
-    (float)9.32687e-07,
-    (float)8.36802e-07,
-    (float)8.97657e-07,
-    (float)1.14724e-06,
-    (float)1.10419e-06,
-    (float)9.73875e-07,
-    (float)1.17083e-06,
-    (float)1.1492e-06,
-    (float)9.9663e-07,
-    (float)1.04056e-06,
-    (float)7.66573e-07,
-    (float)9.00954e-07,
-    (float)1.06352e-06,
-    (float)9.86827e-07,
-    (float)1.08185e-06,
-    (float)8.60278e-07,
-    (float)9.29137e-07,
-    (float)1.06616e-06,
-    (float)7.14755e-07,
-    (float)8.75795e-07,
-    (float)9.10302e-07,
-    (float)8.18098e-07,
-    (float)1.1616e-06,
-    (float)8.20145e-07,
-    (float)7.21652e-07,
-    (float)8.56464e-07,
-    (float)8.79848e-07,
-    (float)9.44728e-07,
-    (float)1.04014e-06,
-    (float)1.11977e-06,
-    (float)9.45666e-07,
-    (float)9.39013e-07,
-    (float)7.36251e-07,
-    (float)5.03159e-07,
-    (float)0.0110018,
-    (float)0.966478,
-    (float)0.0135502,
-    (float)0.00304983,
-    (float)0.00116606,
-    (float)0.00169295,
-    (float)0.00124346,
-    (float)0.000337991,
-    (float)0.000195144,
-    (float)8.66247e-05,
-    (float)0.000169404,
-    (float)7.32607e-05,
-    (float)5.3423e-05,
-    (float)0.000100448,
-    (float)2.36571e-05,
-    (float)8.92239e-05,
-    (float)7.95975e-05,
-    (float)5.74131e-05,
-    (float)1.62838e-05,
-    (float)3.42263e-05,
-    (float)2.22174e-05,
-    (float)1.62423e-05,
-    (float)2.37764e-05,
-    (float)1.60196e-05,
-    (float)2.05519e-05,
-    (float)4.25585e-05,
-    (float)2.38743e-05,
-    (float)6.92542e-06,
-    (float)2.0397e-05,
-    (float)3.03815e-06,
-    (float)9.64626e-06,
-    (float)9.31231e-06,
-    (float)5.75166e-06,
-    (float)1.77184e-05,
-    (float)1.31704e-05,
-    (float)1.15653e-05,
-    (float)7.53302e-06,
-    (float)4.14612e-06,
-    (float)4.80585e-06,
-    (float)7.29838e-06,
-    (float)3.92432e-06,
-    (float)8.16203e-06,
-    (float)6.42697e-06,
-    (float)6.14029e-06,
-    (float)5.44043e-06,
-    (float)3.42339e-06,
-    (float)3.75466e-06,
-    (float)4.19514e-06,
-    (float)7.34111e-06,
-    (float)3.63019e-06,
-    (float)4.85894e-06,
-    (float)3.75722e-06,
-    (float)2.49279e-06,
-    (float)3.29333e-06,
-    (float)2.85983e-06,
-    (float)2.78998e-06,
-    (float)4.88855e-06,
-    (float)4.71028e-06,
-    (float)3.19221e-06,
-    (float)3.52988e-06,
-    (float)2.41845e-06,
-    (float)2.5562e-06,
-    (float)1.87543e-06,
-    (float)2.79842e-06,
-    (float)2.22783e-06,
-    (float)2.95026e-06,
-    (float)3.66593e-06,
-    (float)2.30243e-06,
-    (float)2.82856e-06,
-    (float)2.49838e-06,
-    (float)2.29556e-06,
-    (float)2.0169e-06,
-    (float)2.35045e-06,
-    (float)1.76511e-06,
-    (float)2.51001e-06,
-    (float)2.54079e-06,
-    (float)1.8456e-06,
-    (float)2.18622e-06,
-    (float)1.9448e-06,
-    (float)1.93961e-06,
-    (float)2.43869e-06,
-    (float)2.12342e-06,
-    (float)2.11604e-06,
-    (float)2.6369e-06,
-    (float)1.40342e-06,
-    (float)1.7699e-06,
-    (float)1.27499e-06,
-    (float)1.60994e-06,
-    (float)2.2189e-06,
-    (float)2.00488e-06,
-    (float)2.15328e-06,
-    (float)1.89145e-06,
-    (float)1.97447e-06,
-    (float)1.541e-06,
-    (float)1.65554e-06,
-    (float)1.43676e-06,
-    (float)1.71559e-06,
-    (float)1.72926e-06,
-    (float)1.79305e-06,
-    (float)1.64008e-06,
-    (float)1.42116e-06,
-    (float)1.8214e-06,
-    (float)1.41441e-06,
-    (float)1.4868e-06,
-    (float)1.57297e-06,
-    (float)1.45906e-06,
-    (float)1.7593e-06,
-    (float)1.85317e-06,
-    (float)1.20289e-06,
-    (float)1.54269e-06,
-    (float)1.46187e-06,
-    (float)1.35192e-06,
-    (float)1.6229e-06,
-    (float)1.28018e-06,
-    (float)1.28239e-06,
-    (float)1.58878e-06,
-    (float)1.56997e-06,
-    (float)1.30177e-06,
-    (float)1.44348e-06,
-    (float)1.17146e-06,
-    (float)1.42031e-06,
-    (float)1.52275e-06,
-    (float)1.52678e-06,
-    (float)1.57401e-06,
-    (float)1.54276e-06,
-    (float)1.42799e-06,
-    (float)1.17405e-06,
-    (float)1.22877e-06,
-    (float)0.0160279,
-    (float)0.950979,
-    (float)0.0193746,
-    (float)0.00451381,
-    (float)0.00185943,
-    (float)0.00253246,
-    (float)0.00186037,
-    (float)0.000533864,
-    (float)0.000309282,
-    (float)0.000157129,
-    (float)0.000286563,
-    (float)0.000118827,
-    (float)8.99859e-05,
-    (float)0.0001385,
-    (float)3.88004e-05,
-    (float)0.000124185,
-    (float)0.000111234,
-    (float)9.58124e-05,
-    (float)2.24004e-05,
-    (float)5.95351e-05,
-    (float)4.51165e-05,
-    (float)2.13381e-05,
-    (float)3.45915e-05,
-    (float)2.72682e-05,
-    (float)2.28148e-05,
-    (float)5.85916e-05,
-    (float)3.8099e-05,
-    (float)1.00966e-05,
-    (float)3.55495e-05,
-    (float)7.20622e-06,
-    (float)1.63638e-05,
-    (float)1.32228e-05,
-    (float)9.54477e-06,
-    (float)2.27728e-05,
-    (float)1.83596e-05,
-    (float)1.76783e-05,
-    (float)1.24864e-05,
-    (float)7.08658e-06,
-    (float)8.85849e-06,
-    (float)1.17608e-05,
-    (float)5.40123e-06,
-    (float)1.27109e-05,
-    (float)9.16396e-06,
-    (float)9.39527e-06,
-    (float)8.76758e-06,
-    (float)5.20947e-06,
-    (float)5.53436e-06,
-    (float)6.47765e-06,
-    (float)9.31369e-06,
-    (float)5.99746e-06,
-    (float)7.57655e-06,
-    (float)5.85728e-06,
-    (float)6.2331e-06,
-    (float)4.07211e-06,
-    (float)4.80557e-06,
-    (float)4.76842e-06,
-    (float)4.64108e-06,
-    (float)7.03419e-06,
-    (float)4.73653e-06,
-    (float)4.49475e-06,
-    (float)5.36341e-06,
-    (float)4.48942e-06,
-    (float)2.90924e-06,
-    (float)5.24352e-06,
-    (float)2.87989e-06,
-    (float)4.23748e-06,
-    (float)4.89978e-06,
-    (float)3.58257e-06,
-    (float)4.13119e-06,
-    (float)3.66105e-06,
-    (float)4.18237e-06,
-    (float)2.59407e-06,
-    (float)3.4603e-06,
-    (float)3.27295e-06,
-    (float)3.57944e-06,
-    (float)4.29854e-06,
-    (float)3.53934e-06,
-    (float)2.90954e-06,
-    (float)3.12949e-06,
-    (float)2.55662e-06,
-    (float)2.9166e-06,
-    (float)3.15582e-06,
-    (float)3.23455e-06,
-    (float)4.21501e-06,
-    (float)2.73842e-06,
-    (float)3.00171e-06,
-    (float)1.98261e-06,
-    (float)2.98261e-06,
-    (float)2.85239e-06,
-    (float)3.00905e-06,
-    (float)3.47311e-06,
-    (float)2.31488e-06,
-    (float)3.15808e-06,
-    (float)2.43978e-06,
-    (float)2.34299e-06,
-    (float)2.53767e-06,
-    (float)2.95697e-06,
-    (float)2.58076e-06,
-    (float)2.71938e-06,
-    (float)2.59282e-06,
-    (float)2.17707e-06,
-    (float)2.62848e-06,
-    (float)2.62207e-06,
-    (float)2.11652e-06,
-    (float)2.13022e-06,
-    (float)2.53524e-06,
-    (float)2.1567e-06,
-    (float)2.80156e-06,
-    (float)2.1802e-06,
-    (float)2.32804e-06,
-    (float)2.33247e-06,
-    (float)2.18603e-06,
-    (float)2.41195e-06,
-    (float)1.90284e-06,
-    (float)2.24192e-06,
-    (float)2.50906e-06,
-    (float)2.28533e-06,
-    (float)2.06642e-06,
-    (float)2.3428e-06,
-    (float)1.60989e-06,
-    (float)2.17451e-06,
-    (float)2.17796e-06,
-    (float)1.98967e-06,
-    (float)2.41329e-06,
-    (float)2.41111e-06,
-    (float)2.34629e-06,
-    (float)1.86534e-06,
-    (float)2.1862e-06,
-    (float)0.0224931,
-    (float)0.930761,
-    (float)0.0267577,
-    (float)0.00645958,
-    (float)0.00286306,
-    (float)0.00357205,
-    (float)0.00270409,
-    (float)0.000828825,
-    (float)0.000492829,
-    (float)0.000256489,
-    (float)0.000462032,
-    (float)0.000188875,
-    (float)0.000143127,
-    (float)0.000197482,
-    (float)6.60538e-05,
-    (float)0.000170086,
-    (float)0.000154939,
-    (float)0.000149604,
-    (float)3.01837e-05,
-    (float)9.43107e-05,
-    (float)8.09874e-05,
-    (float)3.36662e-05,
-    (float)4.9118e-05,
-    (float)4.70408e-05,
-    (float)2.65888e-05,
-    (float)7.78641e-05,
-    (float)5.67681e-05,
-    (float)1.46287e-05,
-    (float)5.51617e-05,
-    (float)1.65025e-05,
-    (float)2.80681e-05,
-    (float)1.98049e-05,
-    (float)1.71903e-05,
-    (float)2.88881e-05,
-    (float)2.52911e-05,
-    (float)2.33986e-05,
-    (float)1.84832e-05,
-    (float)1.21822e-05,
-    (float)1.4579e-05,
-    (float)1.85291e-05,
-    (float)9.83883e-06,
-    (float)1.75769e-05,
-    (float)1.32427e-05,
-    (float)1.48688e-05,
-    (float)1.16858e-05,
-    (float)8.66299e-06,
-    (float)8.79987e-06,
-    (float)9.7005e-06,
-    (float)1.22559e-05,
-    (float)9.49711e-06,
-    (float)1.00803e-05,
-    (float)8.07998e-06,
-    (float)1.13195e-05,
-    (float)5.63301e-06,
-    (float)7.54034e-06,
-    (float)9.12633e-06,
-    (float)5.66733e-06,
-    (float)9.2618e-06,
-    (float)7.53086e-06,
-    (float)4.39052e-06,
-    (float)8.3769e-06,
-    (float)7.21852e-06,
-    (float)4.61129e-06,
-    (float)9.10071e-06,
-    (float)5.0123e-06,
-    (float)6.73119e-06,
-    (float)6.35935e-06,
-    (float)4.94956e-06,
-    (float)5.54651e-06,
-    (float)5.06279e-06,
-    (float)6.40977e-06,
-    (float)4.62755e-06,
-    (float)4.95381e-06,
-    (float)5.60014e-06,
-    (float)5.3141e-06,
-    (float)5.63533e-06,
-    (float)5.80391e-06,
-    (float)4.19157e-06,
-    (float)5.06375e-06,
-    (float)4.27989e-06,
-    (float)3.9615e-06,
-    (float)4.48124e-06,
-    (float)4.83494e-06,
-    (float)5.17896e-06,
-    (float)4.88919e-06,
-    (float)4.53255e-06,
-    (float)3.30692e-06,
-    (float)5.53099e-06,
-    (float)4.04781e-06,
-    (float)4.63706e-06,
-    (float)5.1983e-06,
-    (float)3.18826e-06,
-    (float)4.39938e-06,
-    (float)3.66666e-06,
-    (float)3.10598e-06,
-    (float)4.00798e-06,
-    (float)4.26313e-06,
-    (float)4.20294e-06,
-    (float)4.31875e-06,
-    (float)3.69911e-06,
-    (float)3.894e-06,
-    (float)3.4927e-06,
-    (float)3.82561e-06,
-    (float)3.45537e-06,
-    (float)2.94485e-06,
-    (float)4.12591e-06,
-    (float)3.56109e-06,
-    (float)3.65388e-06,
-    (float)3.75033e-06,
-    (float)3.17376e-06,
-    (float)3.32217e-06,
-    (float)3.7103e-06,
-    (float)3.16696e-06,
-    (float)3.09396e-06,
-    (float)3.74332e-06,
-    (float)3.17363e-06,
-    (float)3.5156e-06,
-    (float)3.54683e-06,
-    (float)2.67239e-06,
-    (float)3.20775e-06,
-    (float)3.1613e-06,
-    (float)2.90821e-06,
-    (float)3.87285e-06,
-    (float)3.29348e-06,
-    (float)3.47083e-06,
-    (float)3.51479e-06,
-    (float)2.69576e-06,
-    (float)3.00537e-06,
-    (float)0.0305956,
-    (float)0.904845,
-    (float)0.0359823,
-    (float)0.00899671,
-    (float)0.00427804,
-    (float)0.00480022,
-    (float)0.00385946,
-    (float)0.00126487,
-    (float)0.000786537,
-    (float)0.000389223,
-    (float)0.000719889,
-    (float)0.000291381,
-    (float)0.000218484,
-    (float)0.000286421,
-    (float)0.00011274,
-    (float)0.000234762,
-    (float)0.000215812,
-    (float)0.000226212,
-    (float)3.99463e-05,
-    (float)0.00014168,
-    (float)0.00013276,
-    (float)5.80456e-05,
-    (float)6.86912e-05,
-    (float)8.03723e-05,
-    (float)3.60253e-05,
-    (float)9.89909e-05,
-    (float)8.29325e-05,
-    (float)2.10971e-05,
-    (float)7.49581e-05,
-    (float)3.31816e-05,
-    (float)4.61795e-05,
-    (float)2.83336e-05,
-    (float)3.35272e-05,
-    (float)3.75973e-05,
-    (float)3.5057e-05,
-    (float)3.16658e-05,
-    (float)2.4263e-05,
-    (float)1.86065e-05,
-    (float)2.25794e-05,
-    (float)2.78984e-05,
-    (float)1.7124e-05,
-    (float)2.50234e-05,
-    (float)1.99165e-05,
-    (float)2.28185e-05,
-    (float)1.47731e-05,
-    (float)1.41833e-05,
-    (float)1.25226e-05,
-    (float)1.42967e-05,
-    (float)1.75031e-05,
-    (float)1.39908e-05,
-    (float)1.42578e-05,
-    (float)1.13979e-05,
-    (float)1.63894e-05,
-    (float)8.32148e-06,
-    (float)1.08767e-05,
-    (float)1.40061e-05,
-    (float)1.0448e-05,
-    (float)1.19531e-05,
-    (float)1.24524e-05,
-    (float)5.96459e-06,
-    (float)9.88906e-06,
-    (float)1.05628e-05,
-    (float)6.8053e-06,
-    (float)1.16969e-05,
-    (float)9.391e-06,
-    (float)1.12101e-05,
-    (float)8.70383e-06,
-    (float)8.84468e-06,
-    (float)7.36718e-06,
-    (float)6.99095e-06,
-    (float)8.37502e-06,
-    (float)7.11242e-06,
-    (float)6.87724e-06,
-    (float)8.10425e-06,
-    (float)9.0661e-06,
-    (float)7.63882e-06,
-    (float)8.15151e-06,
-    (float)7.02808e-06,
-    (float)7.12324e-06,
-    (float)6.30276e-06,
-    (float)7.1218e-06,
-    (float)6.14756e-06,
-    (float)7.81005e-06,
-    (float)7.39788e-06,
-    (float)6.66207e-06,
-    (float)6.31217e-06,
-    (float)4.7679e-06,
-    (float)7.44408e-06,
-    (float)6.23368e-06,
-    (float)6.99067e-06,
-    (float)7.24723e-06,
-    (float)6.40051e-06,
-    (float)5.97963e-06,
-    (float)5.70771e-06,
-    (float)5.29877e-06,
-    (float)5.23068e-06,
-    (float)5.97013e-06,
-    (float)6.28193e-06,
-    (float)5.5797e-06,
-    (float)5.22674e-06,
-    (float)6.28521e-06,
-    (float)5.44121e-06,
-    (float)5.84405e-06,
-    (float)5.52295e-06,
-    (float)5.17055e-06,
-    (float)5.12911e-06,
-    (float)5.76488e-06,
-    (float)5.38246e-06,
-    (float)4.73465e-06,
-    (float)5.17766e-06,
-    (float)4.97157e-06,
-    (float)4.4728e-06,
-    (float)4.83758e-06,
-    (float)4.92848e-06,
-    (float)4.71333e-06,
-    (float)5.5355e-06,
-    (float)5.149e-06,
-    (float)5.2459e-06,
-    (float)4.4544e-06,
-    (float)5.02931e-06,
-    (float)4.66264e-06,
-    (float)4.14791e-06,
-    (float)5.15436e-06,
-    (float)4.66537e-06,
-    (float)4.64597e-06,
-    (float)5.04327e-06,
-    (float)4.74974e-06,
-    (float)4.25942e-06,
-    (float)0.0404282,
-    (float)0.872503,
-    (float)0.047154,
-    (float)0.0121875,
-    (float)0.00622734,
-    (float)0.00620226,
-    (float)0.00538795,
-    (float)0.00189331,
-    (float)0.00126089,
-    (float)0.000558932,
-    (float)0.00109653,
-    (float)0.000445957,
-    (float)0.000316499,
-    (float)0.000421056,
-    (float)0.000191662,
-    (float)0.000322321,
-    (float)0.000304479,
-    (float)0.000333074,
-    (float)5.22589e-05,
-    (float)0.000204921,
-    (float)0.000200137,
-    (float)0.000100944,
-    (float)9.415e-05,
-    (float)0.000130361,
-    (float)5.84151e-05,
-    (float)0.000126821,
-    (float)0.000116921,
-    (float)3.38166e-05,
-    (float)9.49454e-05,
-    (float)5.59875e-05,
-    (float)7.23079e-05,
-    (float)3.84877e-05,
-    (float)5.97652e-05,
-    (float)5.08263e-05,
-    (float)5.24322e-05,
-    (float)4.37007e-05,
-    (float)3.01827e-05,
-    (float)2.85173e-05,
-    (float)3.25004e-05,
-    (float)3.66992e-05,
-    (float)2.91271e-05,
-    (float)3.47174e-05,
-    (float)2.77972e-05,
-    (float)3.84101e-05,
-    (float)1.75669e-05,
-    (float)2.132e-05,
-    (float)1.90178e-05,
-    (float)2.04471e-05,
-    (float)2.38936e-05,
-    (float)2.12779e-05,
-    (float)2.0189e-05,
-    (float)1.6668e-05,
-    (float)2.27126e-05,
-    (float)1.22005e-05,
-    (float)1.49011e-05,
-    (float)1.75183e-05,
-    (float)1.89741e-05,
-    (float)1.51183e-05,
-    (float)1.86278e-05,
-    (float)1.20698e-05,
-    (float)1.2389e-05,
-    (float)1.47902e-05,
-    (float)1.1815e-05,
-    (float)1.22367e-05,
-    (float)1.37158e-05,
-    (float)1.71021e-05,
-    (float)1.01932e-05,
-    (float)1.54436e-05,
-    (float)1.07992e-05,
-    (float)1.10868e-05,
-    (float)1.28094e-05,
-    (float)1.00663e-05,
-    (float)9.82744e-06,
-    (float)1.15631e-05,
-    (float)1.22411e-05,
-    (float)1.11671e-05,
-    (float)1.15655e-05,
-    (float)1.01029e-05,
-    (float)1.12815e-05,
-    (float)8.67566e-06,
-    (float)1.05841e-05,
-    (float)8.46243e-06,
-    (float)1.18229e-05,
-    (float)1.09751e-05,
-    (float)1.00359e-05,
-    (float)9.64883e-06,
-    (float)7.99516e-06,
-    (float)9.5514e-06,
-    (float)8.9307e-06,
-    (float)9.93632e-06,
-    (float)7.97217e-06,
-    (float)1.09729e-05,
-    (float)8.34215e-06,
-    (float)8.09658e-06,
-    (float)9.0261e-06,
-    (float)8.34024e-06,
-    (float)8.71142e-06,
-    (float)1.02489e-05,
-    (float)7.77215e-06,
-    (float)7.1582e-06,
-    (float)9.12895e-06,
-    (float)6.96419e-06,
-    (float)8.28434e-06,
-    (float)7.34511e-06,
-    (float)8.04158e-06,
-    (float)7.60417e-06,
-    (float)8.7016e-06,
-    (float)7.71735e-06,
-    (float)7.22734e-06,
-    (float)7.42226e-06,
-    (float)7.25737e-06,
-    (float)6.80782e-06,
-    (float)6.95869e-06,
-    (float)7.71389e-06,
-    (float)6.6073e-06,
-    (float)8.36789e-06,
-    (float)6.59515e-06,
-    (float)7.15613e-06,
-    (float)6.69753e-06,
-    (float)6.8583e-06,
-    (float)6.40536e-06,
-    (float)7.22456e-06,
-    (float)7.17773e-06,
-    (float)6.67841e-06,
-    (float)7.93689e-06,
-    (float)6.10544e-06,
-    (float)6.66956e-06,
-    (float)6.5027e-06,
-    (float)0.0517856,
-    (float)0.833774,
-    (float)0.0600465,
-    (float)0.0160899,
-    (float)0.00877024,
-    (float)0.00769521,
-    (float)0.00736026,
-    (float)0.00276959,
-    (float)0.00197801,
-    (float)0.00077152,
-    (float)0.0016204,
-    (float)0.000670037,
-    (float)0.000443572,
-    (float)0.000606224,
-    (float)0.000314904,
-    (float)0.000441353,
-    (float)0.000434709,
-    (float)0.000481689,
-    (float)7.19217e-05,
-    (float)0.000283042,
-    (float)0.000288149,
-    (float)0.000165573,
-    (float)0.000122892,
-    (float)0.000199176,
-    (float)0.000100336,
-    (float)0.000164471,
-    (float)0.000162668,
-    (float)6.10885e-05,
-    (float)0.000111802,
-    (float)8.68372e-05,
-    (float)0.000109127,
-    (float)4.66937e-05,
-    (float)9.30833e-05,
-    (float)7.37129e-05,
-    (float)7.43856e-05,
-    (float)6.34184e-05,
-    (float)4.26254e-05,
-    (float)4.01762e-05,
-    (float)4.7448e-05,
-    (float)4.69308e-05,
-    (float)4.33243e-05,
-    (float)4.6022e-05,
-    (float)3.94796e-05,
-    (float)5.77487e-05,
-    (float)2.28953e-05,
-    (float)3.14412e-05,
-    (float)2.80919e-05,
-    (float)2.9335e-05,
-    (float)3.15985e-05,
-    (float)3.1196e-05,
-    (float)2.73629e-05,
-    (float)2.51319e-05,
-    (float)3.08197e-05,
-    (float)1.83719e-05,
-    (float)2.07122e-05,
-    (float)2.19591e-05,
-    (float)2.88509e-05,
-    (float)1.95805e-05,
-    (float)2.36534e-05,
-    (float)2.08325e-05,
-    (float)1.80455e-05,
-    (float)1.89992e-05,
-    (float)2.12692e-05,
-    (float)1.48808e-05,
-    (float)1.79953e-05,
-    (float)2.55032e-05,
-    (float)1.2429e-05,
-    (float)1.96063e-05,
-    (float)1.64098e-05,
-    (float)1.70694e-05,
-    (float)1.75307e-05,
-    (float)1.60841e-05,
-    (float)1.55216e-05,
-    (float)1.58885e-05,
-    (float)1.66369e-05,
-    (float)1.63047e-05,
-    (float)1.40046e-05,
-    (float)1.41544e-05,
-    (float)1.71585e-05,
-    (float)1.27363e-05,
-    (float)1.47674e-05,
-    (float)1.31895e-05,
-    (float)1.66718e-05,
-    (float)1.45269e-05,
-    (float)1.4845e-05,
-    (float)1.28639e-05,
-    (float)1.24939e-05,
-    (float)1.357e-05,
-    (float)1.31271e-05,
-    (float)1.45306e-05,
-    (float)1.10383e-05,
-    (float)1.56378e-05,
-    (float)1.2478e-05,
-    (float)1.11874e-05,
-    (float)1.17952e-05,
-    (float)1.26625e-05,
-    (float)1.24729e-05,
-    (float)1.31836e-05,
-    (float)1.25402e-05,
-    (float)1.1055e-05,
-    (float)1.16569e-05,
-    (float)1.19191e-05,
-    (float)1.13349e-05,
-    (float)9.0817e-06,
-    (float)1.21393e-05,
-    (float)1.07758e-05,
-    (float)1.10537e-05,
-    (float)1.12427e-05,
-    (float)1.12738e-05,
-    (float)1.0161e-05,
-    (float)1.06871e-05,
-    (float)1.04777e-05,
-    (float)9.39348e-06,
-    (float)1.05411e-05,
-    (float)1.04131e-05,
-    (float)1.10835e-05,
-    (float)8.76198e-06,
-    (float)1.08725e-05,
-    (float)9.71181e-06,
-    (float)9.12034e-06,
-    (float)9.7123e-06,
-    (float)9.88953e-06,
-    (float)9.25368e-06,
-    (float)1.00797e-05,
-    (float)1.05059e-05,
-    (float)8.6661e-06,
-    (float)1.01759e-05,
-    (float)9.34814e-06,
-    (float)0.0637643,
-    (float)0.790659,
-    (float)0.0737617,
-    (float)0.0204828,
-    (float)0.0119046,
-    (float)0.00914571,
-    (float)0.00969826,
-    (float)0.00391919,
-    (float)0.00302054,
-    (float)0.00101753,
-    (float)0.00232368,
-    (float)0.000993478,
-    (float)0.000596815,
-    (float)0.00085125,
-    (float)0.000496918,
-    (float)0.000593456,
-    (float)0.000616213,
-    (float)0.000677279,
-    (float)0.000105635,
-    (float)0.000379424,
-    (float)0.000394574,
-    (float)0.000259246,
-    (float)0.000151745,
-    (float)0.000284166,
-    (float)0.000164864,
-    (float)0.000216714,
-    (float)0.000217619,
-    (float)0.000107888,
-    (float)0.00013264,
-    (float)0.000126302,
-    (float)0.000155151,
-    (float)5.6711e-05,
-    (float)0.000131056,
-    (float)0.000100969,
-    (float)0.000105591,
-    (float)8.86724e-05,
-    (float)6.02755e-05,
-    (float)5.86804e-05,
-    (float)7.05991e-05,
-    (float)5.65018e-05,
-    (float)6.19798e-05,
-    (float)5.97149e-05,
-    (float)5.23392e-05,
-    (float)7.88901e-05,
-    (float)3.27878e-05,
-    (float)4.29365e-05,
-    (float)3.86041e-05,
-    (float)4.6447e-05,
-    (float)3.88661e-05,
-    (float)4.22382e-05,
-    (float)3.86998e-05,
-    (float)3.45972e-05,
-    (float)3.86544e-05,
-    (float)2.82879e-05,
-    (float)2.75621e-05,
-    (float)2.86549e-05,
-    (float)4.10226e-05,
-    (float)2.69774e-05,
-    (float)2.9146e-05,
-    (float)2.95376e-05,
-    (float)2.73606e-05,
-    (float)2.27072e-05,
-    (float)3.08229e-05,
-    (float)2.15966e-05,
-    (float)2.47318e-05,
-    (float)3.39809e-05,
-    (float)1.98576e-05,
-    (float)2.34648e-05,
-    (float)2.21968e-05,
-    (float)2.52269e-05,
-    (float)2.14638e-05,
-    (float)2.31123e-05,
-    (float)2.22701e-05,
-    (float)2.23833e-05,
-    (float)2.38809e-05,
-    (float)2.2553e-05,
-    (float)1.82607e-05,
-    (float)2.13529e-05,
-    (float)2.13182e-05,
-    (float)1.93322e-05,
-    (float)1.98267e-05,
-    (float)1.77283e-05,
-    (float)2.37512e-05,
-    (float)1.98921e-05,
-    (float)2.09375e-05,
-    (float)1.71452e-05,
-    (float)1.89713e-05,
-    (float)1.86742e-05,
-    (float)1.77636e-05,
-    (float)1.95835e-05,
-    (float)1.7005e-05,
-    (float)1.98219e-05,
-    (float)1.88094e-05,
-    (float)1.64554e-05,
-    (float)1.45368e-05,
-    (float)1.78779e-05,
-    (float)1.81318e-05,
-    (float)1.63728e-05,
-    (float)1.72394e-05,
-    (float)1.67274e-05,
-    (float)1.4887e-05,
-    (float)1.8055e-05,
-    (float)1.53226e-05,
-    (float)1.35938e-05,
-    (float)1.67771e-05,
-    (float)1.54975e-05,
-    (float)1.54391e-05,
-    (float)1.44806e-05,
-    (float)1.50246e-05,
-    (float)1.43171e-05,
-    (float)1.43984e-05,
-    (float)1.41846e-05,
-    (float)1.34214e-05,
-    (float)1.46772e-05,
-    (float)1.52609e-05,
-    (float)1.37449e-05,
-    (float)1.35347e-05,
-    (float)1.36999e-05,
-    (float)1.32106e-05,
-    (float)1.38499e-05,
-    (float)1.28609e-05,
-    (float)1.29571e-05,
-    (float)1.38736e-05,
-    (float)1.43995e-05,
-    (float)1.27172e-05,
-    (float)1.29525e-05,
-    (float)1.37546e-05,
-    (float)1.22904e-05,
-    (float)0.0744935,
-    (float)0.74816,
-    (float)0.0864028,
-    (float)0.0248784,
-    (float)0.0153675,
-    (float)0.01032,
-    (float)0.0122481,
-    (float)0.00527337,
-    (float)0.0043883,
-    (float)0.00129641,
-    (float)0.00320046,
-    (float)0.00142807,
-    (float)0.000778859,
-    (float)0.0011443,
-    (float)0.000747861,
-    (float)0.000774932,
-    (float)0.000841943,
-    (float)0.000923622,
-    (float)0.000158314,
-    (float)0.000493677,
-    (float)0.000516859,
-    (float)0.000385696,
-    (float)0.000176231,
-    (float)0.000379694,
-    (float)0.00025248,
-    (float)0.000280043,
-    (float)0.000275606,
-    (float)0.000181833,
-    (float)0.00015713,
-    (float)0.000171474,
-    (float)0.000220542,
-    (float)6.67709e-05,
-    (float)0.000168835,
-    (float)0.000136436,
-    (float)0.000139622,
-    (float)0.000112411,
-    (float)8.71727e-05,
-    (float)8.07569e-05,
-    (float)9.89224e-05,
-    (float)7.17379e-05,
-    (float)8.54684e-05,
-    (float)7.42976e-05,
-    (float)6.99204e-05,
-    (float)0.000100342,
-    (float)4.38443e-05,
-    (float)5.60483e-05,
-    (float)4.95122e-05,
-    (float)6.79755e-05,
-    (float)4.68395e-05,
-    (float)5.61994e-05,
-    (float)5.25723e-05,
-    (float)4.65814e-05,
-    (float)4.73646e-05,
-    (float)4.01037e-05,
-    (float)3.51671e-05,
-    (float)3.71685e-05,
-    (float)5.38226e-05,
-    (float)3.7144e-05,
-    (float)3.59486e-05,
-    (float)3.7506e-05,
-    (float)4.12003e-05,
-    (float)2.6195e-05,
-    (float)3.89388e-05,
-    (float)3.13689e-05,
-    (float)3.36751e-05,
-    (float)3.98072e-05,
-    (float)3.32002e-05,
-    (float)2.85586e-05,
-    (float)2.64489e-05,
-    (float)3.90632e-05,
-    (float)2.58725e-05,
-    (float)2.83924e-05,
-    (float)3.12083e-05,
-    (float)3.01549e-05,
-    (float)2.96482e-05,
-    (float)3.07978e-05,
-    (float)2.41286e-05,
-    (float)3.03503e-05,
-    (float)2.68042e-05,
-    (float)2.9387e-05,
-    (float)2.57567e-05,
-    (float)2.25299e-05,
-    (float)3.27596e-05,
-    (float)2.58273e-05,
-    (float)2.67666e-05,
-    (float)2.25526e-05,
-    (float)2.70094e-05,
-    (float)2.42357e-05,
-    (float)2.46037e-05,
-    (float)2.42119e-05,
-    (float)2.49151e-05,
-    (float)2.53681e-05,
-    (float)2.52054e-05,
-    (float)2.35932e-05,
-    (float)1.93115e-05,
-    (float)2.24392e-05,
-    (float)2.61476e-05,
-    (float)2.21346e-05,
-    (float)1.98377e-05,
-    (float)2.48063e-05,
-    (float)2.01434e-05,
-    (float)2.24133e-05,
-    (float)2.00545e-05,
-    (float)2.07943e-05,
-    (float)1.95931e-05,
-    (float)2.16879e-05,
-    (float)2.2566e-05,
-    (float)1.73427e-05,
-    (float)1.99929e-05,
-    (float)2.10611e-05,
-    (float)1.83232e-05,
-    (float)1.76311e-05,
-    (float)1.91035e-05,
-    (float)1.90242e-05,
-    (float)2.01173e-05,
-    (float)1.73236e-05,
-    (float)1.96954e-05,
-    (float)1.58168e-05,
-    (float)1.88692e-05,
-    (float)1.95964e-05,
-    (float)1.55402e-05,
-    (float)1.78164e-05,
-    (float)1.89049e-05,
-    (float)1.8426e-05,
-    (float)1.64334e-05,
-    (float)1.76944e-05,
-    (float)1.7016e-05,
-    (float)1.78076e-05,
-    (float)0.0812198,
-    (float)0.714878,
-    (float)0.0951078,
-    (float)0.0283441,
-    (float)0.0186164,
-    (float)0.0109266,
-    (float)0.0145122,
-    (float)0.00665622,
-    (float)0.00598548,
-    (float)0.00156025,
-    (float)0.00416849,
-    (float)0.00196307,
-    (float)0.000984154,
-    (float)0.00145235,
-    (float)0.00106017,
-    (float)0.000977468,
-    (float)0.0010819,
-    (float)0.0011961,
-    (float)0.000234768,
-    (float)0.000617056,
-    (float)0.000636759,
-    (float)0.000542662,
-    (float)0.000196404,
-    (float)0.000471002,
-    (float)0.000350334,
-    (float)0.000353535,
-    (float)0.000321036,
-    (float)0.000265798,
-    (float)0.000191306,
-    (float)0.000220235,
-    (float)0.000287286,
-    (float)8.85316e-05,
-    (float)0.000205588,
-    (float)0.000168643,
-    (float)0.000182112,
-    (float)0.000128089,
-    (float)0.000116035,
-    (float)0.000101062,
-    (float)0.00013062,
-    (float)8.90031e-05,
-    (float)0.000105032,
-    (float)9.5048e-05,
-    (float)9.37166e-05,
-    (float)0.000114209,
-    (float)6.11738e-05,
-    (float)7.03593e-05,
-    (float)5.47125e-05,
-    (float)9.31685e-05,
-    (float)5.39405e-05,
-    (float)6.65518e-05,
-    (float)6.58699e-05,
-    (float)6.26419e-05,
-    (float)5.38098e-05,
-    (float)5.21193e-05,
-    (float)4.4852e-05,
-    (float)4.75954e-05,
-    (float)6.40107e-05,
-    (float)4.83006e-05,
-    (float)4.56731e-05,
-    (float)4.13025e-05,
-    (float)5.66846e-05,
-    (float)3.26606e-05,
-    (float)4.38051e-05,
-    (float)4.0186e-05,
-    (float)4.70866e-05,
-    (float)4.27394e-05,
-    (float)4.53883e-05,
-    (float)3.56096e-05,
-    (float)3.18032e-05,
-    (float)4.97165e-05,
-    (float)3.33849e-05,
-    (float)3.58057e-05,
-    (float)3.71172e-05,
-    (float)4.19171e-05,
-    (float)3.521e-05,
-    (float)3.8919e-05,
-    (float)2.9544e-05,
-    (float)3.875e-05,
-    (float)3.44331e-05,
-    (float)3.70091e-05,
-    (float)3.13606e-05,
-    (float)3.17502e-05,
-    (float)3.81842e-05,
-    (float)3.29469e-05,
-    (float)3.63648e-05,
-    (float)2.57687e-05,
-    (float)3.65837e-05,
-    (float)3.12206e-05,
-    (float)3.17974e-05,
-    (float)2.80385e-05,
-    (float)3.3342e-05,
-    (float)3.15496e-05,
-    (float)3.21716e-05,
-    (float)2.86528e-05,
-    (float)2.63273e-05,
-    (float)2.82758e-05,
-    (float)3.06631e-05,
-    (float)3.15502e-05,
-    (float)2.35417e-05,
-    (float)3.0491e-05,
-    (float)2.76464e-05,
-    (float)2.85182e-05,
-    (float)2.28484e-05,
-    (float)2.83733e-05,
-    (float)2.39503e-05,
-    (float)2.81406e-05,
-    (float)2.73432e-05,
-    (float)2.24898e-05,
-    (float)2.4944e-05,
-    (float)2.59136e-05,
-    (float)2.42787e-05,
-    (float)2.12426e-05,
-    (float)2.49182e-05,
-    (float)2.23042e-05,
-    (float)2.75283e-05,
-    (float)2.09866e-05,
-    (float)2.30413e-05,
-    (float)2.07858e-05,
-    (float)2.54067e-05,
-    (float)2.16637e-05,
-    (float)2.14442e-05,
-    (float)2.25189e-05,
-    (float)2.15307e-05,
-    (float)2.49466e-05,
-    (float)1.99637e-05,
-    (float)2.17556e-05,
-    (float)2.03709e-05,
-    (float)2.47246e-05,
-    (float)0.0816568,
-    (float)0.699817,
-    (float)0.096967,
-    (float)0.0300642,
-    (float)0.0208092,
-    (float)0.0107746,
-    (float)0.0159549,
-    (float)0.00779755,
-    (float)0.0074837,
-    (float)0.00178324,
-    (float)0.00504239,
-    (float)0.00254769,
-    (float)0.0011967,
-    (float)0.00171962,
-    (float)0.00140015,
-    (float)0.00116526,
-    (float)0.00130384,
-    (float)0.00144369,
-    (float)0.000334274,
-    (float)0.000714161,
-    (float)0.000755166,
-    (float)0.000697878,
-    (float)0.000216628,
-    (float)0.000539028,
-    (float)0.000452404,
-    (float)0.00042216,
-    (float)0.000336819,
-    (float)0.000347235,
-    (float)0.000223437,
-    (float)0.000260213,
-    (float)0.000344152,
-    (float)0.000124855,
-    (float)0.000225586,
-    (float)0.000206047,
-    (float)0.000225889,
-    (float)0.000135161,
-    (float)0.000139244,
-    (float)0.000124644,
-    (float)0.000148045,
-    (float)0.000102229,
-    (float)0.000123024,
-    (float)0.000105538,
-    (float)0.00011964,
-    (float)0.000122602,
-    (float)7.97428e-05,
-    (float)8.28537e-05,
-    (float)6.30875e-05,
-    (float)0.000111138,
-    (float)6.3486e-05,
-    (float)7.00937e-05,
-    (float)7.63334e-05,
-    (float)7.65523e-05,
-    (float)5.57094e-05,
-    (float)6.15873e-05,
-    (float)5.35489e-05,
-    (float)5.75579e-05,
-    (float)6.9817e-05,
-    (float)6.15187e-05,
-    (float)5.17652e-05,
-    (float)4.63009e-05,
-    (float)6.67676e-05,
-    (float)4.20585e-05,
-    (float)4.4209e-05,
-    (float)4.70464e-05,
-    (float)6.09511e-05,
-    (float)4.42086e-05,
-    (float)5.27052e-05,
-    (float)4.45009e-05,
-    (float)3.85662e-05,
-    (float)5.17437e-05,
-    (float)4.55496e-05,
-    (float)4.06182e-05,
-    (float)3.91305e-05,
-    (float)5.32191e-05,
-    (float)4.37334e-05,
-    (float)3.96011e-05,
-    (float)3.85335e-05,
-    (float)4.65593e-05,
-    (float)4.01083e-05,
-    (float)4.54864e-05,
-    (float)3.55861e-05,
-    (float)4.01194e-05,
-    (float)4.14808e-05,
-    (float)3.98757e-05,
-    (float)4.22406e-05,
-    (float)3.1001e-05,
-    (float)4.09836e-05,
-    (float)4.07394e-05,
-    (float)3.72052e-05,
-    (float)3.15209e-05,
-    (float)4.02032e-05,
-    (float)3.93715e-05,
-    (float)3.74577e-05,
-    (float)3.27936e-05,
-    (float)3.35708e-05,
-    (float)3.32259e-05,
-    (float)3.48764e-05,
-    (float)3.76117e-05,
-    (float)3.0235e-05,
-    (float)3.16641e-05,
-    (float)3.51057e-05,
-    (float)3.47741e-05,
-    (float)2.55699e-05,
-    (float)3.07546e-05,
-    (float)3.28152e-05,
-    (float)3.26828e-05,
-    (float)2.85703e-05,
-    (float)3.06582e-05,
-    (float)2.82558e-05,
-    (float)2.79891e-05,
-    (float)3.16671e-05,
-    (float)2.5355e-05,
-    (float)2.58064e-05,
-    (float)2.96317e-05,
-    (float)3.12837e-05,
-    (float)2.449e-05,
-    (float)2.56055e-05,
-    (float)2.58848e-05,
-    (float)2.9156e-05,
-    (float)2.47442e-05,
-    (float)2.56356e-05,
-    (float)2.59151e-05,
-    (float)2.49322e-05,
-    (float)2.87457e-05,
-    (float)2.4554e-05,
-    (float)2.3495e-05,
-    (float)2.47784e-05,
-    (float)2.93687e-05,
-    (float)0.0751253,
-    (float)0.707229,
-    (float)0.0912487,
-    (float)0.0294128,
-    (float)0.0214707,
-    (float)0.00994744,
-    (float)0.0161785,
-    (float)0.00838521,
-    (float)0.00861537,
-    (float)0.00191825,
-    (float)0.00565969,
-    (float)0.00307631,
-    (float)0.00141004,
-    (float)0.00190597,
-    (float)0.00171035,
-    (float)0.00134089,
-    (float)0.00145122,
-    (float)0.00161671,
-    (float)0.000449385,
-    (float)0.000772091,
-    (float)0.000832257,
-    (float)0.000832278,
-    (float)0.000238351,
-    (float)0.000584773,
-    (float)0.000524315,
-    (float)0.000489106,
-    (float)0.000325226,
-    (float)0.000397631,
-    (float)0.000253795,
-    (float)0.000285191,
-    (float)0.000361877,
-    (float)0.000166003,
-    (float)0.000237395,
-    (float)0.000228371,
-    (float)0.000263105,
-    (float)0.000142135,
-    (float)0.000157797,
-    (float)0.000140174,
-    (float)0.000160557,
-    (float)0.000108617,
-    (float)0.000128486,
-    (float)0.00010785,
-    (float)0.000139154,
-    (float)0.000116807,
-    (float)9.31547e-05,
-    (float)9.43889e-05,
-    (float)7.14831e-05,
-    (float)0.000118028,
-    (float)7.50939e-05,
-    (float)7.59116e-05,
-    (float)7.61274e-05,
-    (float)8.83948e-05,
-    (float)5.64674e-05,
-    (float)6.0602e-05,
-    (float)5.82103e-05,
-    (float)6.58529e-05,
-    (float)6.55597e-05,
-    (float)6.98835e-05,
-    (float)5.68381e-05,
-    (float)5.15587e-05,
-    (float)6.96022e-05,
-    (float)5.06665e-05,
-    (float)4.80865e-05,
-    (float)4.81588e-05,
-    (float)6.9533e-05,
-    (float)4.83021e-05,
-    (float)5.35442e-05,
-    (float)4.78423e-05,
-    (float)4.73905e-05,
-    (float)4.94618e-05,
-    (float)5.18222e-05,
-    (float)4.57844e-05,
-    (float)4.33478e-05,
-    (float)5.60159e-05,
-    (float)4.98546e-05,
-    (float)4.17217e-05,
-    (float)4.17299e-05,
-    (float)5.0021e-05,
-    (float)4.54602e-05,
-    (float)4.98472e-05,
-    (float)3.83796e-05,
-    (float)4.73217e-05,
-    (float)4.45856e-05,
-    (float)4.67961e-05,
-    (float)4.2969e-05,
-    (float)3.94768e-05,
-    (float)4.39107e-05,
-    (float)4.22357e-05,
-    (float)4.26901e-05,
-    (float)3.45309e-05,
-    (float)4.05623e-05,
-    (float)4.54006e-05,
-    (float)4.21947e-05,
-    (float)3.48509e-05,
-    (float)3.84973e-05,
-    (float)3.81005e-05,
-    (float)3.96389e-05,
-    (float)3.819e-05,
-    (float)3.69113e-05,
-    (float)3.42502e-05,
-    (float)3.81077e-05,
-    (float)3.67656e-05,
-    (float)3.01702e-05,
-    (float)3.16884e-05,
-    (float)3.55083e-05,
-    (float)3.69558e-05,
-    (float)3.10167e-05,
-    (float)3.27703e-05,
-    (float)3.16848e-05,
-    (float)3.29685e-05,
-    (float)3.20657e-05,
-    (float)2.94804e-05,
-    (float)2.86834e-05,
-    (float)3.27653e-05,
-    (float)3.20134e-05,
-    (float)2.81725e-05,
-    (float)2.67448e-05,
-    (float)2.83075e-05,
-    (float)2.98791e-05,
-    (float)2.88214e-05,
-    (float)2.71985e-05,
-    (float)2.64786e-05,
-    (float)3.02325e-05,
-    (float)2.91559e-05,
-    (float)2.62705e-05,
-    (float)2.61685e-05,
-    (float)2.84834e-05,
-    (float)2.92342e-05,
-    (float)0.0634735,
-    (float)0.733348,
-    (float)0.0797364,
-    (float)0.0267788,
-    (float)0.0205523,
-    (float)0.0087788,
-    (float)0.0152916,
-    (float)0.00835451,
-    (float)0.00914045,
-    (float)0.00197773,
-    (float)0.00594326,
-    (float)0.00346537,
-    (float)0.00160368,
-    (float)0.00200399,
-    (float)0.00196699,
-    (float)0.00148353,
-    (float)0.0015178,
-    (float)0.00170942,
-    (float)0.000564148,
-    (float)0.000782503,
-    (float)0.000860938,
-    (float)0.000927224,
-    (float)0.000255246,
-    (float)0.000602616,
-    (float)0.000567956,
-    (float)0.000541663,
-    (float)0.000295701,
-    (float)0.000424441,
-    (float)0.000274186,
-    (float)0.000291143,
-    (float)0.000347489,
-    (float)0.000202358,
-    (float)0.000233371,
-    (float)0.000230655,
-    (float)0.000291238,
-    (float)0.000145268,
-    (float)0.000166737,
-    (float)0.000155464,
-    (float)0.000168715,
-    (float)0.000107053,
-    (float)0.000132128,
-    (float)0.000102911,
-    (float)0.000143299,
-    (float)0.00010254,
-    (float)9.69341e-05,
-    (float)9.38753e-05,
-    (float)7.50439e-05,
-    (float)0.000116442,
-    (float)8.1225e-05,
-    (float)8.16818e-05,
-    (float)7.45199e-05,
-    (float)9.77183e-05,
-    (float)5.85855e-05,
-    (float)5.82006e-05,
-    (float)5.88577e-05,
-    (float)7.14552e-05,
-    (float)5.46831e-05,
-    (float)6.93429e-05,
-    (float)5.70604e-05,
-    (float)5.17199e-05,
-    (float)6.46718e-05,
-    (float)5.64631e-05,
-    (float)5.06944e-05,
-    (float)4.62825e-05,
-    (float)7.54519e-05,
-    (float)5.27435e-05,
-    (float)5.15681e-05,
-    (float)4.72281e-05,
-    (float)5.64543e-05,
-    (float)4.37138e-05,
-    (float)5.13327e-05,
-    (float)4.98117e-05,
-    (float)4.66438e-05,
-    (float)5.19142e-05,
-    (float)5.50749e-05,
-    (float)4.4264e-05,
-    (float)4.0723e-05,
-    (float)5.15914e-05,
-    (float)4.98329e-05,
-    (float)4.83413e-05,
-    (float)3.81145e-05,
-    (float)5.29184e-05,
-    (float)4.30107e-05,
-    (float)5.0238e-05,
-    (float)4.22299e-05,
-    (float)4.64017e-05,
-    (float)4.58542e-05,
-    (float)4.32088e-05,
-    (float)4.58402e-05,
-    (float)3.83527e-05,
-    (float)3.92208e-05,
-    (float)4.57887e-05,
-    (float)4.44468e-05,
-    (float)3.4156e-05,
-    (float)3.78576e-05,
-    (float)4.00886e-05,
-    (float)4.2767e-05,
-    (float)3.43034e-05,
-    (float)4.23774e-05,
-    (float)3.78366e-05,
-    (float)3.91758e-05,
-    (float)3.72628e-05,
-    (float)3.73208e-05,
-    (float)3.23315e-05,
-    (float)3.53685e-05,
-    (float)3.9947e-05,
-    (float)3.18601e-05,
-    (float)3.00277e-05,
-    (float)3.16393e-05,
-    (float)3.54064e-05,
-    (float)2.76509e-05,
-    (float)3.10545e-05,
-    (float)3.11332e-05,
-    (float)3.28843e-05,
-    (float)3.08131e-05,
-    (float)3.32792e-05,
-    (float)2.67045e-05,
-    (float)2.98555e-05,
-    (float)3.11591e-05,
-    (float)3.09747e-05,
-    (float)2.71988e-05,
-    (float)2.67896e-05,
-    (float)3.25135e-05,
-    (float)2.69219e-05,
-    (float)2.73009e-05,
-    (float)2.60667e-05,
-    (float)2.91854e-05,
-    (float)2.7511e-05,
-    (float)0.0498166,
-    (float)0.769688,
-    (float)0.065648,
-    (float)0.0229969,
-    (float)0.0185407,
-    (float)0.00759006,
-    (float)0.0136158,
-    (float)0.00782164,
-    (float)0.00908191,
-    (float)0.00195354,
-    (float)0.00587524,
-    (float)0.00368125,
-    (float)0.00177962,
-    (float)0.00201686,
-    (float)0.00212784,
-    (float)0.00161238,
-    (float)0.00153304,
-    (float)0.00172252,
-    (float)0.000677337,
-    (float)0.000772563,
-    (float)0.000853338,
-    (float)0.000972494,
-    (float)0.000279371,
-    (float)0.000600192,
-    (float)0.000576672,
-    (float)0.00058626,
-    (float)0.000267722,
-    (float)0.000420207,
-    (float)0.000286988,
-    (float)0.000294816,
-    (float)0.000301802,
-    (float)0.00021941,
-    (float)0.000220981,
-    (float)0.000216053,
-    (float)0.00028472,
-    (float)0.000146136,
-    (float)0.000166445,
-    (float)0.000157767,
-    (float)0.000175192,
-    (float)0.000109386,
-    (float)0.000133378,
-    (float)9.99754e-05,
-    (float)0.000145117,
-    (float)8.84324e-05,
-    (float)9.14941e-05,
-    (float)8.49801e-05,
-    (float)7.65017e-05,
-    (float)9.85874e-05,
-    (float)7.66352e-05,
-    (float)8.32408e-05,
-    (float)6.73039e-05,
-    (float)9.70148e-05,
-    (float)6.38743e-05,
-    (float)5.82117e-05,
-    (float)5.70826e-05,
-    (float)7.64071e-05,
-    (float)5.02058e-05,
-    (float)6.20395e-05,
-    (float)5.21703e-05,
-    (float)5.27683e-05,
-    (float)5.22672e-05,
-    (float)5.23653e-05,
-    (float)4.96666e-05,
-    (float)4.29851e-05,
-    (float)6.98358e-05,
-    (float)5.39279e-05,
-    (float)5.2911e-05,
-    (float)4.40673e-05,
-    (float)5.9921e-05,
-    (float)4.51458e-05,
-    (float)4.91716e-05,
-    (float)4.74107e-05,
-    (float)5.12441e-05,
-    (float)4.77434e-05,
-    (float)5.23368e-05,
-    (float)4.42749e-05,
-    (float)4.13512e-05,
-    (float)4.86155e-05,
-    (float)4.87168e-05,
-    (float)4.83337e-05,
-    (float)3.81143e-05,
-    (float)5.14299e-05,
-    (float)4.21019e-05,
-    (float)5.01261e-05,
-    (float)3.75768e-05,
-    (float)4.58814e-05,
-    (float)4.43692e-05,
-    (float)4.38273e-05,
-    (float)4.2688e-05,
-    (float)4.11681e-05,
-    (float)4.28482e-05,
-    (float)4.45617e-05,
-    (float)4.60054e-05,
-    (float)3.89542e-05,
-    (float)3.78994e-05,
-    (float)3.92457e-05,
-    (float)4.37457e-05,
-    (float)3.18746e-05,
-    (float)3.91505e-05,
-    (float)3.44837e-05,
-    (float)3.88361e-05,
-    (float)3.23462e-05,
-    (float)3.53469e-05,
-    (float)3.30309e-05,
-    (float)3.52888e-05,
-    (float)3.79105e-05,
-    (float)3.35504e-05,
-    (float)3.26318e-05,
-    (float)3.18444e-05,
-    (float)3.55708e-05,
-    (float)2.94977e-05,
-    (float)3.09341e-05,
-    (float)2.86903e-05,
-    (float)3.31308e-05,
-    (float)2.77914e-05,
-    (float)3.07571e-05,
-    (float)2.47086e-05,
-    (float)2.9674e-05,
-    (float)2.86636e-05,
-    (float)2.86253e-05,
-    (float)2.76537e-05,
-    (float)2.67907e-05,
-    (float)3.02404e-05,
-    (float)2.63977e-05,
-    (float)2.8661e-05,
-    (float)2.40709e-05,
-    (float)2.83078e-05,
-    (float)2.7186e-05,
-    (float)0.0367074,
-    (float)0.807911,
-    (float)0.0516905,
-    (float)0.0190363,
-    (float)0.0159703,
-    (float)0.00662107,
-    (float)0.0116161,
-    (float)0.0070451,
-    (float)0.00854658,
-    (float)0.00188424,
-    (float)0.00556924,
-    (float)0.00374754,
-    (float)0.00191141,
-    (float)0.00198431,
-    (float)0.00222338,
-    (float)0.00171768,
-    (float)0.00152694,
-    (float)0.00169808,
-    (float)0.000791775,
-    (float)0.000746932,
-    (float)0.000833812,
-    (float)0.00098017,
-    (float)0.000306637,
-    (float)0.000570851,
-    (float)0.000573523,
-    (float)0.000604425,
-    (float)0.000245951,
-    (float)0.000401917,
-    (float)0.000299867,
-    (float)0.000299747,
-    (float)0.000253546,
-    (float)0.000233413,
-    (float)0.000205788,
-    (float)0.000196637,
-    (float)0.000259292,
-    (float)0.000143952,
-    (float)0.000149443,
-    (float)0.000150964,
-    (float)0.000171392,
-    (float)0.000108233,
-    (float)0.000126712,
-    (float)0.000103657,
-    (float)0.000141959,
-    (float)8.02788e-05,
-    (float)8.90542e-05,
-    (float)7.48883e-05,
-    (float)7.66329e-05,
-    (float)7.73091e-05,
-    (float)6.79106e-05,
-    (float)7.33249e-05,
-    (float)5.77869e-05,
-    (float)8.28361e-05,
-    (float)6.42001e-05,
-    (float)5.33354e-05,
-    (float)5.37725e-05,
-    (float)7.76703e-05,
-    (float)5.14813e-05,
-    (float)5.65105e-05,
-    (float)5.17432e-05,
-    (float)5.74979e-05,
-    (float)4.25202e-05,
-    (float)4.8261e-05,
-    (float)4.64391e-05,
-    (float)3.97354e-05,
-    (float)5.4492e-05,
-    (float)5.21568e-05,
-    (float)4.69503e-05,
-    (float)3.77591e-05,
-    (float)5.60901e-05,
-    (float)4.75669e-05,
-    (float)4.43272e-05,
-    (float)4.43694e-05,
-    (float)5.57956e-05,
-    (float)4.55522e-05,
-    (float)4.73924e-05,
-    (float)4.40687e-05,
-    (float)4.3105e-05,
-    (float)4.15624e-05,
-    (float)4.67409e-05,
-    (float)4.61454e-05,
-    (float)3.82469e-05,
-    (float)4.56549e-05,
-    (float)4.52978e-05,
-    (float)4.70581e-05,
-    (float)3.60544e-05,
-    (float)4.47797e-05,
-    (float)4.33354e-05,
-    (float)4.32902e-05,
-    (float)3.73712e-05,
-    (float)3.95092e-05,
-    (float)4.19685e-05,
-    (float)3.92728e-05,
-    (float)3.97401e-05,
-    (float)4.09274e-05,
-    (float)3.56677e-05,
-    (float)3.73018e-05,
-    (float)4.29212e-05,
-    (float)3.58992e-05,
-    (float)3.50801e-05,
-    (float)3.56945e-05,
-    (float)4.07365e-05,
-    (float)3.06642e-05,
-    (float)3.20056e-05,
-    (float)3.41904e-05,
-    (float)3.36182e-05,
-    (float)3.08068e-05,
-    (float)3.20628e-05,
-    (float)3.0857e-05,
-    (float)2.89238e-05,
-    (float)3.07065e-05,
-    (float)3.1402e-05,
-    (float)2.83729e-05,
-    (float)2.69014e-05,
-    (float)3.27789e-05,
-    (float)2.85313e-05,
-    (float)2.64616e-05,
-    (float)2.57495e-05,
-    (float)2.86673e-05,
-    (float)2.53704e-05,
-    (float)2.57153e-05,
-    (float)2.61915e-05,
-    (float)2.47153e-05,
-    (float)2.54636e-05,
-    (float)2.61428e-05,
-    (float)2.59516e-05,
-    (float)2.34284e-05,
-    (float)2.62909e-05,
-    (float)2.68497e-05,
-    (float)0.0255403,
-    (float)0.842915,
-    (float)0.0394226,
-    (float)0.0152834,
-    (float)0.0133603,
-    (float)0.00596177,
-    (float)0.00962798,
-    (float)0.00612785,
-    (float)0.00777493,
-    (float)0.00178841,
-    (float)0.00511098,
-    (float)0.003676,
-    (float)0.00202094,
-    (float)0.00192712,
-    (float)0.00224859,
-    (float)0.00181715,
-    (float)0.0015307,
-    (float)0.00166185,
-    (float)0.0009054,
-    (float)0.00075128,
-    (float)0.000819112,
-    (float)0.000971559,
-    (float)0.000347036,
-    (float)0.000547336,
-    (float)0.00055019,
-    (float)0.000612316,
-    (float)0.000233436,
-    (float)0.00037584,
-    (float)0.000299893,
-    (float)0.000311073,
-    (float)0.000213526,
-    (float)0.000234109,
-    (float)0.000197255,
-    (float)0.000185846,
-    (float)0.000220326,
-    (float)0.000138667,
-    (float)0.000132581,
-    (float)0.000132689,
-    (float)0.000155716,
-    (float)0.000101574,
-    (float)0.000114965,
-    (float)9.93936e-05,
-    (float)0.000135481,
-    (float)7.70748e-05,
-    (float)8.81846e-05,
-    (float)6.81627e-05,
-    (float)8.19838e-05,
-    (float)6.48714e-05,
-    (float)6.05392e-05,
-    (float)6.46721e-05,
-    (float)5.28135e-05,
-    (float)6.44483e-05,
-    (float)5.58802e-05,
-    (float)4.77714e-05,
-    (float)4.45603e-05,
-    (float)6.71057e-05,
-    (float)5.03744e-05,
-    (float)5.09556e-05,
-    (float)4.60216e-05,
-    (float)6.0572e-05,
-    (float)4.04146e-05,
-    (float)4.52882e-05,
-    (float)4.27225e-05,
-    (float)4.30305e-05,
-    (float)4.4005e-05,
-    (float)4.55308e-05,
-    (float)4.1911e-05,
-    (float)3.3412e-05,
-    (float)4.56078e-05,
-    (float)4.32477e-05,
-    (float)4.08107e-05,
-    (float)3.829e-05,
-    (float)5.18085e-05,
-    (float)4.56313e-05,
-    (float)4.61034e-05,
-    (float)4.04686e-05,
-    (float)4.62469e-05,
-    (float)4.11339e-05,
-    (float)4.55696e-05,
-    (float)4.20062e-05,
-    (float)4.09472e-05,
-    (float)4.10443e-05,
-    (float)4.19822e-05,
-    (float)4.18086e-05,
-    (float)3.45626e-05,
-    (float)3.9558e-05,
-    (float)3.95018e-05,
-    (float)4.2043e-05,
-    (float)3.50018e-05,
-    (float)3.81202e-05,
-    (float)3.93062e-05,
-    (float)4.01912e-05,
-    (float)3.5433e-05,
-    (float)3.75917e-05,
-    (float)3.53266e-05,
-    (float)3.67072e-05,
-    (float)3.52194e-05,
-    (float)3.63517e-05,
-    (float)3.31722e-05,
-    (float)3.37746e-05,
-    (float)3.68869e-05,
-    (float)3.16162e-05,
-    (float)3.0847e-05,
-    (float)3.16055e-05,
-    (float)3.34663e-05,
-    (float)2.93875e-05,
-    (float)2.99096e-05,
-    (float)2.81905e-05,
-    (float)2.89634e-05,
-    (float)2.69993e-05,
-    (float)2.79217e-05,
-    (float)2.51924e-05,
-    (float)2.63364e-05,
-    (float)2.66376e-05,
-    (float)2.62922e-05,
-    (float)2.47247e-05,
-    (float)2.47225e-05,
-    (float)2.54874e-05,
-    (float)2.53594e-05,
-    (float)2.4908e-05,
-    (float)2.3782e-05,
-    (float)2.42373e-05,
-    (float)2.35808e-05,
-    (float)2.38633e-05,
-    (float)2.20322e-05,
-    (float)2.2517e-05,
-    (float)2.22409e-05,
-    (float)2.32751e-05,
-    (float)0.0166745,
-    (float)0.872407,
-    (float)0.0293645,
-    (float)0.0120699,
-    (float)0.0109384,
-    (float)0.00560685,
-    (float)0.00785318,
-    (float)0.00523577,
-    (float)0.00689219,
-    (float)0.00168302,
-    (float)0.00461031,
-    (float)0.00351089,
-    (float)0.00207864,
-    (float)0.00186365,
-    (float)0.00223677,
-    (float)0.00188976,
-    (float)0.00153513,
-    (float)0.00163854,
-    (float)0.00102297,
-    (float)0.000776454,
-    (float)0.00081807,
-    (float)0.000976395,
-    (float)0.000399907,
-    (float)0.000530521,
-    (float)0.000529471,
-    (float)0.000618314,
-    (float)0.000223669,
-    (float)0.000350395,
-    (float)0.000295553,
-    (float)0.000320322,
-    (float)0.000183435,
-    (float)0.000233511,
-    (float)0.000194156,
-    (float)0.000183299,
-    (float)0.000188087,
-    (float)0.000138195,
-    (float)0.000120736,
-    (float)0.000115539,
-    (float)0.000139329,
-    (float)9.32122e-05,
-    (float)9.83853e-05,
-    (float)8.93189e-05,
-    (float)0.000124192,
-    (float)6.88192e-05,
-    (float)8.28485e-05,
-    (float)6.1486e-05,
-    (float)8.42455e-05,
-    (float)5.59495e-05,
-    (float)5.69584e-05,
-    (float)5.84406e-05,
-    (float)5.16718e-05,
-    (float)5.13301e-05,
-    (float)4.78022e-05,
-    (float)4.21917e-05,
-    (float)3.54404e-05,
-    (float)5.35994e-05,
-    (float)4.49374e-05,
-    (float)4.27799e-05,
-    (float)3.65905e-05,
-    (float)5.97429e-05,
-    (float)3.84962e-05,
-    (float)4.22195e-05,
-    (float)4.04215e-05,
-    (float)4.98937e-05,
-    (float)3.93992e-05,
-    (float)4.28779e-05,
-    (float)4.21966e-05,
-    (float)3.39775e-05,
-    (float)3.73471e-05,
-    (float)3.94307e-05,
-    (float)3.72545e-05,
-    (float)2.95709e-05,
-    (float)4.26827e-05,
-    (float)4.0806e-05,
-    (float)3.8832e-05,
-    (float)3.13165e-05,
-    (float)4.4628e-05,
-    (float)3.79423e-05,
-    (float)4.26232e-05,
-    (float)3.85003e-05,
-    (float)4.54134e-05,
-    (float)4.0927e-05,
-    (float)4.19278e-05,
-    (float)4.16885e-05,
-    (float)3.80768e-05,
-    (float)3.73967e-05,
-    (float)3.79459e-05,
-    (float)4.22817e-05,
-    (float)3.2931e-05,
-    (float)3.54497e-05,
-    (float)3.54171e-05,
-    (float)3.93912e-05,
-    (float)3.04641e-05,
-    (float)3.3045e-05,
-    (float)3.33639e-05,
-    (float)3.61847e-05,
-    (float)2.79724e-05,
-    (float)3.44228e-05,
-    (float)3.1723e-05,
-    (float)3.16662e-05,
-    (float)3.09301e-05,
-    (float)3.23609e-05,
-    (float)2.9863e-05,
-    (float)2.71287e-05,
-    (float)3.31691e-05,
-    (float)2.92772e-05,
-    (float)2.72572e-05,
-    (float)2.63081e-05,
-    (float)3.11933e-05,
-    (float)2.49563e-05,
-    (float)2.58236e-05,
-    (float)2.42572e-05,
-    (float)2.69465e-05,
-    (float)2.13807e-05,
-    (float)2.42891e-05,
-    (float)2.21584e-05,
-    (float)2.18638e-05,
-    (float)2.06723e-05,
-    (float)2.26446e-05,
-    (float)2.14624e-05,
-    (float)1.94606e-05,
-    (float)2.20636e-05,
-    (float)2.10718e-05,
-    (float)2.17534e-05,
-    (float)1.95638e-05,
-    (float)2.33746e-05,
-    (float)2.0754e-05,
-    (float)2.26108e-05,
-    (float)0.0101009,
-    (float)0.896218,
-    (float)0.0214169,
-    (float)0.00940762,
-    (float)0.00882348,
-    (float)0.00546181,
-    (float)0.00630938,
-    (float)0.00440792,
-    (float)0.00598119,
-    (float)0.00157127,
-    (float)0.00406598,
-    (float)0.00327415,
-    (float)0.00209803,
-    (float)0.00178772,
-    (float)0.00216474,
-    (float)0.00193079,
-    (float)0.00155427,
-    (float)0.00161511,
-    (float)0.0011269,
-    (float)0.000838252,
-    (float)0.000849514,
-    (float)0.00098966,
-    (float)0.000479522,
-    (float)0.000543502,
-    (float)0.000528422,
-    (float)0.000629515,
-    (float)0.000236519,
-    (float)0.00033467,
-    (float)0.000290495,
-    (float)0.000329861,
-    (float)0.000167705,
-    (float)0.000223823,
-    (float)0.000190455,
-    (float)0.000187091,
-    (float)0.000157979,
-    (float)0.000134426,
-    (float)0.000113225,
-    (float)0.000105682,
-    (float)0.000118247,
-    (float)8.59048e-05,
-    (float)8.329e-05,
-    (float)7.72066e-05,
-    (float)0.000104771,
-    (float)6.05439e-05,
-    (float)7.18659e-05,
-    (float)5.27846e-05,
-    (float)7.93812e-05,
-    (float)5.09214e-05,
-    (float)5.37223e-05,
-    (float)5.31506e-05,
-    (float)5.48022e-05,
-    (float)4.64334e-05,
-    (float)4.28746e-05,
-    (float)4.01132e-05,
-    (float)3.45842e-05,
-    (float)4.11884e-05,
-    (float)3.85387e-05,
-    (float)3.55056e-05,
-    (float)2.77803e-05,
-    (float)4.71412e-05,
-    (float)3.32225e-05,
-    (float)3.52268e-05,
-    (float)3.11187e-05,
-    (float)4.58426e-05,
-    (float)3.70274e-05,
-    (float)3.85241e-05,
-    (float)3.91202e-05,
-    (float)3.81349e-05,
-    (float)3.72413e-05,
-    (float)3.83008e-05,
-    (float)3.84813e-05,
-    (float)3.25283e-05,
-    (float)3.85882e-05,
-    (float)3.88641e-05,
-    (float)3.67182e-05,
-    (float)2.77989e-05,
-    (float)3.75039e-05,
-    (float)3.38074e-05,
-    (float)3.75914e-05,
-    (float)3.05159e-05,
-    (float)3.93929e-05,
-    (float)3.65571e-05,
-    (float)3.84739e-05,
-    (float)3.55506e-05,
-    (float)3.59087e-05,
-    (float)3.76436e-05,
-    (float)3.709e-05,
-    (float)4.00633e-05,
-    (float)3.56014e-05,
-    (float)3.6653e-05,
-    (float)3.55935e-05,
-    (float)3.87594e-05,
-    (float)3.17537e-05,
-    (float)3.27073e-05,
-    (float)3.17434e-05,
-    (float)3.53673e-05,
-    (float)2.79918e-05,
-    (float)3.07964e-05,
-    (float)2.8417e-05,
-    (float)3.16469e-05,
-    (float)2.66433e-05,
-    (float)2.7601e-05,
-    (float)2.71385e-05,
-    (float)2.56747e-05,
-    (float)2.75414e-05,
-    (float)2.51984e-05,
-    (float)2.53866e-05,
-    (float)2.36606e-05,
-    (float)2.67527e-05,
-    (float)2.36667e-05,
-    (float)2.40612e-05,
-    (float)2.24125e-05,
-    (float)2.51824e-05,
-    (float)2.14134e-05,
-    (float)2.34655e-05,
-    (float)2.06483e-05,
-    (float)2.2572e-05,
-    (float)2.07428e-05,
-    (float)2.10236e-05,
-    (float)2.01965e-05,
-    (float)1.91999e-05,
-    (float)1.98706e-05,
-    (float)1.80446e-05,
-    (float)1.89452e-05,
-    (float)1.69926e-05,
-    (float)1.88774e-05,
-    (float)1.69381e-05,
-    (float)1.85826e-05,
-    (float)0.00544858,
-    (float)0.914765,
-    (float)0.0153146,
-    (float)0.00730331,
-    (float)0.00702299,
-    (float)0.00547599,
-    (float)0.00502609,
-    (float)0.00370472,
-    (float)0.0050949,
-    (float)0.00145482,
-    (float)0.00354606,
-    (float)0.00300108,
-    (float)0.00206218,
-    (float)0.0017002,
-    (float)0.00206814,
-    (float)0.00192675,
-    (float)0.00155397,
-    (float)0.00159064,
-    (float)0.00121853,
-    (float)0.000906887,
-    (float)0.000891518,
-    (float)0.00102232,
-    (float)0.000575866,
-    (float)0.000573227,
-    (float)0.000550582,
-    (float)0.000657984,
-    (float)0.000269209,
-    (float)0.000332451,
-    (float)0.000299203,
-    (float)0.000345712,
-    (float)0.000164605,
-    (float)0.000217303,
-    (float)0.000191506,
-    (float)0.000194631,
-    (float)0.00013584,
-    (float)0.000133675,
-    (float)0.000111188,
-    (float)0.000103712,
-    (float)0.000102121,
-    (float)8.44036e-05,
-    (float)7.32749e-05,
-    (float)6.86828e-05,
-    (float)8.63925e-05,
-    (float)5.33424e-05,
-    (float)5.66341e-05,
-    (float)4.25941e-05,
-    (float)6.74573e-05,
-    (float)4.15004e-05,
-    (float)4.45575e-05,
-    (float)4.34346e-05,
-    (float)5.23189e-05,
-    (float)3.9935e-05,
-    (float)3.82031e-05,
-    (float)3.81473e-05,
-    (float)3.65127e-05,
-    (float)3.46598e-05,
-    (float)3.73903e-05,
-    (float)3.37413e-05,
-    (float)2.59459e-05,
-    (float)3.85839e-05,
-    (float)3.20894e-05,
-    (float)2.94632e-05,
-    (float)2.29989e-05,
-    (float)3.95054e-05,
-    (float)3.23011e-05,
-    (float)3.03843e-05,
-    (float)3.09467e-05,
-    (float)3.7388e-05,
-    (float)3.28232e-05,
-    (float)3.34826e-05,
-    (float)3.61783e-05,
-    (float)3.52165e-05,
-    (float)3.45719e-05,
-    (float)3.89874e-05,
-    (float)3.84247e-05,
-    (float)3.01281e-05,
-    (float)3.45054e-05,
-    (float)3.65714e-05,
-    (float)3.77201e-05,
-    (float)2.79602e-05,
-    (float)3.61058e-05,
-    (float)3.5431e-05,
-    (float)3.53136e-05,
-    (float)2.89396e-05,
-    (float)3.20932e-05,
-    (float)3.43805e-05,
-    (float)3.35276e-05,
-    (float)3.23072e-05,
-    (float)3.4277e-05,
-    (float)3.3899e-05,
-    (float)3.2717e-05,
-    (float)3.4653e-05,
-    (float)3.35102e-05,
-    (float)3.1552e-05,
-    (float)3.12032e-05,
-    (float)3.56356e-05,
-    (float)3.11381e-05,
-    (float)2.89634e-05,
-    (float)2.86018e-05,
-    (float)3.35537e-05,
-    (float)2.68783e-05,
-    (float)2.54414e-05,
-    (float)2.68055e-05,
-    (float)2.79842e-05,
-    (float)2.37296e-05,
-    (float)2.30272e-05,
-    (float)2.46425e-05,
-    (float)2.24816e-05,
-    (float)2.13095e-05,
-    (float)2.25195e-05,
-    (float)2.12157e-05,
-    (float)1.92383e-05,
-    (float)2.09066e-05,
-    (float)2.0611e-05,
-    (float)1.91536e-05,
-    (float)1.74831e-05,
-    (float)2.03826e-05,
-    (float)1.87742e-05,
-    (float)1.74887e-05,
-    (float)1.76136e-05,
-    (float)1.83849e-05,
-    (float)1.76574e-05,
-    (float)1.62417e-05,
-    (float)1.73235e-05,
-    (float)1.70488e-05,
-    (float)1.64851e-05,
-    (float)1.65111e-05,
-    (float)1.70888e-05,
-    (float)0.00243073,
-    (float)0.92889,
-    (float)0.0106944,
-    (float)0.00559364,
-    (float)0.00553931,
-    (float)0.00559818,
-    (float)0.0039696,
-    (float)0.00307751,
-    (float)0.00427864,
-    (float)0.00134317,
-    (float)0.00304255,
-    (float)0.00268658,
-    (float)0.00199775,
-    (float)0.0016028,
-    (float)0.00193528,
-    (float)0.00187545,
-    (float)0.00155217,
-    (float)0.00155782,
-    (float)0.00127568,
-    (float)0.000987549,
-    (float)0.000948914,
-    (float)0.0010624,
-    (float)0.000679648,
-    (float)0.00063698,
-    (float)0.000596858,
-    (float)0.00070553,
-    (float)0.000329491,
-    (float)0.000361696,
-    (float)0.000321829,
-    (float)0.000377218,
-    (float)0.000181681,
-    (float)0.000222015,
-    (float)0.000194502,
-    (float)0.000208735,
-    (float)0.000122964,
-    (float)0.000130927,
-    (float)0.000108894,
-    (float)0.000107651,
-    (float)8.83903e-05,
-    (float)8.19065e-05,
-    (float)6.8896e-05,
-    (float)6.53546e-05,
-    (float)7.1698e-05,
-    (float)4.91325e-05,
-    (float)4.72224e-05,
-    (float)3.56275e-05,
-    (float)5.53612e-05,
-    (float)3.32443e-05,
-    (float)3.61248e-05,
-    (float)3.11473e-05,
-    (float)4.46206e-05,
-    (float)3.16271e-05,
-    (float)3.04215e-05,
-    (float)2.98348e-05,
-    (float)3.45543e-05,
-    (float)2.91329e-05,
-    (float)3.23535e-05,
-    (float)3.0757e-05,
-    (float)2.74807e-05,
-    (float)3.31697e-05,
-    (float)3.08167e-05,
-    (float)2.94469e-05,
-    (float)2.11709e-05,
-    (float)3.45587e-05,
-    (float)3.02636e-05,
-    (float)2.869e-05,
-    (float)2.39393e-05,
-    (float)3.36845e-05,
-    (float)2.99321e-05,
-    (float)2.97349e-05,
-    (float)2.80189e-05,
-    (float)3.32765e-05,
-    (float)3.14726e-05,
-    (float)3.44027e-05,
-    (float)3.38258e-05,
-    (float)3.15843e-05,
-    (float)3.26445e-05,
-    (float)3.55106e-05,
-    (float)3.73986e-05,
-    (float)3.03725e-05,
-    (float)3.53054e-05,
-    (float)3.56217e-05,
-    (float)3.75475e-05,
-    (float)2.90036e-05,
-    (float)3.24098e-05,
-    (float)3.30795e-05,
-    (float)3.54304e-05,
-    (float)2.98298e-05,
-    (float)3.14465e-05,
-    (float)3.09304e-05,
-    (float)3.26069e-05,
-    (float)2.85081e-05,
-    (float)2.97782e-05,
-    (float)2.87962e-05,
-    (float)3.00323e-05,
-    (float)3.06596e-05,
-    (float)2.92272e-05,
-    (float)2.7879e-05,
-    (float)2.78549e-05,
-    (float)3.05438e-05,
-    (float)2.71435e-05,
-    (float)2.63666e-05,
-    (float)2.55723e-05,
-    (float)2.85975e-05,
-    (float)2.4769e-05,
-    (float)2.40161e-05,
-    (float)2.25839e-05,
-    (float)2.41479e-05,
-    (float)2.11932e-05,
-    (float)2.10268e-05,
-    (float)1.89565e-05,
-    (float)1.97141e-05,
-    (float)1.81092e-05,
-    (float)1.81785e-05,
-    (float)1.61912e-05,
-    (float)1.60416e-05,
-    (float)1.65771e-05,
-    (float)1.58326e-05,
-    (float)1.50965e-05,
-    (float)1.4695e-05,
-    (float)1.58754e-05,
-    (float)1.53139e-05,
-    (float)1.52283e-05,
-    (float)1.47555e-05,
-    (float)1.59886e-05,
-    (float)1.52236e-05,
-    (float)1.60655e-05,
-    (float)1.45792e-05,
-    (float)0.000748971,
-    (float)0.939269,
-    (float)0.00724086,
-    (float)0.00424318,
-    (float)0.0043202,
-    (float)0.0058127,
-    (float)0.00311279,
-    (float)0.00254814,
-    (float)0.00353012,
-    (float)0.00123801,
-    (float)0.00258061,
-    (float)0.00236021,
-    (float)0.00188437,
-    (float)0.00149557,
-    (float)0.0017887,
-    (float)0.00178016,
-    (float)0.00151296,
-    (float)0.00151523,
-    (float)0.00130525,
-    (float)0.00105293,
-    (float)0.000995338,
-    (float)0.00111133,
-    (float)0.000784195,
-    (float)0.000712942,
-    (float)0.000658525,
-    (float)0.000780947,
-    (float)0.000415277,
-    (float)0.000419717,
-    (float)0.00037031,
-    (float)0.000439896,
-    (float)0.000224348,
-    (float)0.000249995,
-    (float)0.000216949,
-    (float)0.000240463,
-    (float)0.000125926,
-    (float)0.000137468,
-    (float)0.000112901,
-    (float)0.000118622,
-    (float)7.78636e-05,
-    (float)8.0171e-05,
-    (float)6.57591e-05,
-    (float)6.36221e-05,
-    (float)5.81634e-05,
-    (float)4.52482e-05,
-    (float)4.02939e-05,
-    (float)3.0626e-05,
-    (float)4.5169e-05,
-    (float)2.75608e-05,
-    (float)2.91735e-05,
-    (float)2.15633e-05,
-    (float)3.74427e-05,
-    (float)2.34823e-05,
-    (float)2.24533e-05,
-    (float)2.05825e-05,
-    (float)2.98896e-05,
-    (float)2.17218e-05,
-    (float)2.44219e-05,
-    (float)2.49751e-05,
-    (float)2.56818e-05,
-    (float)2.63116e-05,
-    (float)2.73339e-05,
-    (float)2.86155e-05,
-    (float)1.97433e-05,
-    (float)3.06731e-05,
-    (float)2.97239e-05,
-    (float)2.98644e-05,
-    (float)2.03218e-05,
-    (float)3.30851e-05,
-    (float)3.04801e-05,
-    (float)2.92335e-05,
-    (float)2.31549e-05,
-    (float)3.33106e-05,
-    (float)3.0269e-05,
-    (float)3.09654e-05,
-    (float)2.89115e-05,
-    (float)3.23021e-05,
-    (float)3.0141e-05,
-    (float)3.19514e-05,
-    (float)3.51097e-05,
-    (float)3.12208e-05,
-    (float)3.26201e-05,
-    (float)3.34223e-05,
-    (float)3.93114e-05,
-    (float)2.94145e-05,
-    (float)3.24787e-05,
-    (float)3.31319e-05,
-    (float)3.98926e-05,
-    (float)3.02923e-05,
-    (float)3.22239e-05,
-    (float)3.18151e-05,
-    (float)3.69151e-05,
-    (float)2.72253e-05,
-    (float)2.90958e-05,
-    (float)2.89203e-05,
-    (float)3.18813e-05,
-    (float)2.61444e-05,
-    (float)2.69593e-05,
-    (float)2.64375e-05,
-    (float)2.50783e-05,
-    (float)2.48098e-05,
-    (float)2.43381e-05,
-    (float)2.38266e-05,
-    (float)2.06884e-05,
-    (float)2.52292e-05,
-    (float)2.29738e-05,
-    (float)2.21841e-05,
-    (float)1.86984e-05,
-    (float)2.47292e-05,
-    (float)2.11995e-05,
-    (float)2.0638e-05,
-    (float)1.83137e-05,
-    (float)2.30863e-05,
-    (float)1.92417e-05,
-    (float)1.92125e-05,
-    (float)1.75818e-05,
-    (float)1.92903e-05,
-    (float)1.66607e-05,
-    (float)1.64156e-05,
-    (float)1.56351e-05,
-    (float)1.43182e-05,
-    (float)1.40832e-05,
-    (float)1.32241e-05,
-    (float)1.32083e-05,
-    (float)1.04525e-05,
-    (float)1.20892e-05,
-    (float)1.084e-05,
-    (float)1.15994e-05,
-    (float)8.83131e-06,
-    (float)0.000182168,
-    (float)0.946695,
-    (float)0.00471517,
-    (float)0.00320065,
-    (float)0.00335495,
-    (float)0.00600958,
-    (float)0.00242132,
-    (float)0.0021124,
-    (float)0.00286983,
-    (float)0.00113238,
-    (float)0.0021476,
-    (float)0.00203413,
-    (float)0.00174473,
-    (float)0.00137244,
-    (float)0.0016101,
-    (float)0.00163959,
-    (float)0.00144675,
-    (float)0.00143626,
-    (float)0.00127785,
-    (float)0.00108637,
-    (float)0.00102681,
-    (float)0.00112983,
-    (float)0.000858663,
-    (float)0.000783126,
-    (float)0.000723883,
-    (float)0.000844958,
-    (float)0.000513896,
-    (float)0.000497216,
-    (float)0.000441357,
-    (float)0.000516676,
-    (float)0.000299624,
-    (float)0.000304755,
-    (float)0.000266824,
-    (float)0.000294545,
-    (float)0.000162437,
-    (float)0.000165175,
-    (float)0.000137314,
-    (float)0.000147769,
-    (float)8.60188e-05,
-    (float)8.80099e-05,
-    (float)7.09527e-05,
-    (float)7.13487e-05,
-    (float)4.94092e-05,
-    (float)4.2944e-05,
-    (float)3.50376e-05,
-    (float)2.95592e-05,
-    (float)3.28352e-05,
-    (float)2.2233e-05,
-    (float)2.14743e-05,
-    (float)1.49608e-05,
-    (float)2.61918e-05,
-    (float)1.6592e-05,
-    (float)1.50125e-05,
-    (float)1.23052e-05,
-    (float)2.17521e-05,
-    (float)1.59976e-05,
-    (float)1.67933e-05,
-    (float)1.66651e-05,
-    (float)2.12644e-05,
-    (float)2.01953e-05,
-    (float)2.15011e-05,
-    (float)2.32979e-05,
-    (float)1.89465e-05,
-    (float)2.55886e-05,
-    (float)2.67386e-05,
-    (float)2.89354e-05,
-    (float)2.0835e-05,
-    (float)2.99629e-05,
-    (float)3.11895e-05,
-    (float)3.12886e-05,
-    (float)2.34352e-05,
-    (float)3.18545e-05,
-    (float)3.2529e-05,
-    (float)3.34237e-05,
-    (float)2.72259e-05,
-    (float)3.19414e-05,
-    (float)3.18707e-05,
-    (float)3.28629e-05,
-    (float)3.10859e-05,
-    (float)3.10068e-05,
-    (float)3.18928e-05,
-    (float)3.23321e-05,
-    (float)3.47391e-05,
-    (float)2.94139e-05,
-    (float)3.091e-05,
-    (float)3.1419e-05,
-    (float)3.67522e-05,
-    (float)3.05456e-05,
-    (float)3.11551e-05,
-    (float)3.13947e-05,
-    (float)3.61494e-05,
-    (float)3.02913e-05,
-    (float)3.02475e-05,
-    (float)2.99579e-05,
-    (float)3.52556e-05,
-    (float)3.04392e-05,
-    (float)2.94394e-05,
-    (float)2.83988e-05,
-    (float)3.02796e-05,
-    (float)2.8242e-05,
-    (float)2.61307e-05,
-    (float)2.53543e-05,
-    (float)2.47279e-05,
-    (float)2.52694e-05,
-    (float)2.25443e-05,
-    (float)2.11955e-05,
-    (float)1.88552e-05,
-    (float)2.07546e-05,
-    (float)1.81902e-05,
-    (float)1.70005e-05,
-    (float)1.46293e-05,
-    (float)1.66814e-05,
-    (float)1.48709e-05,
-    (float)1.4105e-05,
-    (float)1.22212e-05,
-    (float)1.36243e-05,
-    (float)1.28869e-05,
-    (float)1.26761e-05,
-    (float)1.17199e-05,
-    (float)1.17787e-05,
-    (float)1.26756e-05,
-    (float)1.22838e-05,
-    (float)1.24444e-05,
-    (float)1.11622e-05,
-    (float)1.29262e-05,
-    (float)1.25592e-05,
-    (float)1.27491e-05,
-    (float)1.11343e-05,
-    (float)0.000547951,
-    (float)0.951741,
-    (float)0.00290704,
-    (float)0.00239392,
-    (float)0.00259881,
-    (float)0.00622539,
-    (float)0.00187252,
-    (float)0.0017575,
-    (float)0.00228732,
-    (float)0.00102945,
-    (float)0.00176095,
-    (float)0.00171803,
-    (float)0.00157068,
-    (float)0.00123041,
-    (float)0.00142594,
-    (float)0.00145938,
-    (float)0.00133138,
-    (float)0.00132217,
-    (float)0.00120661,
-    (float)0.00107094,
-    (float)0.00101159,
-    (float)0.00111506,
-    (float)0.000893012,
-    (float)0.000818937,
-    (float)0.000759643,
-    (float)0.000888379,
-    (float)0.000600847,
-    (float)0.000567666,
-    (float)0.000510153,
-    (float)0.000599799,
-    (float)0.000387241,
-    (float)0.000374384,
-    (float)0.000334425,
-    (float)0.000373478,
-    (float)0.000227799,
-    (float)0.00021926,
-    (float)0.000188811,
-    (float)0.000206494,
-    (float)0.000122439,
-    (float)0.000120041,
-    (float)9.8802e-05,
-    (float)0.000102811,
-    (float)6.00926e-05,
-    (float)5.54341e-05,
-    (float)4.38193e-05,
-    (float)4.11342e-05,
-    (float)2.88695e-05,
-    (float)2.27847e-05,
-    (float)1.86127e-05,
-    (float)1.31222e-05,
-    (float)1.59392e-05,
-    (float)1.02122e-05,
-    (float)7.72092e-06,
-    (float)4.58389e-06,
-    (float)1.20072e-05,
-    (float)8.43765e-06,
-    (float)7.98618e-06,
-    (float)7.55247e-06,
-    (float)1.37674e-05,
-    (float)1.20989e-05,
-    (float)1.36425e-05,
-    (float)1.60128e-05,
-    (float)1.53148e-05,
-    (float)1.82282e-05,
-    (float)2.1659e-05,
-    (float)2.57e-05,
-    (float)1.9272e-05,
-    (float)2.50922e-05,
-    (float)3.0333e-05,
-    (float)3.28199e-05,
-    (float)2.39081e-05,
-    (float)3.09063e-05,
-    (float)3.62215e-05,
-    (float)3.86688e-05,
-    (float)2.92822e-05,
-    (float)3.5636e-05,
-    (float)3.86467e-05,
-    (float)4.05544e-05,
-    (float)3.38922e-05,
-    (float)3.748e-05,
-    (float)3.92433e-05,
-    (float)3.96963e-05,
-    (float)3.73845e-05,
-    (float)3.68976e-05,
-    (float)3.67445e-05,
-    (float)3.6341e-05,
-    (float)3.81343e-05,
-    (float)3.57343e-05,
-    (float)3.32414e-05,
-    (float)3.24789e-05,
-    (float)3.58821e-05,
-    (float)3.26271e-05,
-    (float)2.88506e-05,
-    (float)2.77087e-05,
-    (float)3.32794e-05,
-    (float)2.9369e-05,
-    (float)2.54523e-05,
-    (float)2.38168e-05,
-    (float)2.87995e-05,
-    (float)2.54156e-05,
-    (float)2.18952e-05,
-    (float)2.14639e-05,
-    (float)2.41585e-05,
-    (float)2.20167e-05,
-    (float)1.97502e-05,
-    (float)1.93162e-05,
-    (float)1.94956e-05,
-    (float)1.8286e-05,
-    (float)1.80509e-05,
-    (float)1.71887e-05,
-    (float)1.56172e-05,
-    (float)1.55579e-05,
-    (float)1.61933e-05,
-    (float)1.49866e-05,
-    (float)1.23159e-05,
-    (float)1.31725e-05,
-    (float)1.39716e-05,
-    (float)1.26676e-05,
-    (float)1.03464e-05,
-    (float)1.10851e-05,
-    (float)1.19203e-05,
-    (float)1.06577e-05,
-    (float)9.34231e-06,
-    (float)9.61719e-06,
-    (float)1.01156e-05,
-    (float)9.71282e-06,
-    (float)9.15686e-06,
-    (float)9.18975e-06,
-    (float)0.0017359,
-    (float)0.954727,
-    (float)0.00166876,
-    (float)0.00176316,
-    (float)0.00204819,
-    (float)0.00639422,
-    (float)0.00144911,
-    (float)0.00146628,
-    (float)0.00180641,
-    (float)0.000934678,
-    (float)0.00142812,
-    (float)0.00142315,
-    (float)0.00140062,
-    (float)0.00108661,
-    (float)0.0012481,
-    (float)0.00126239,
-    (float)0.00120548,
-    (float)0.00118805,
-    (float)0.00110013,
-    (float)0.00102123,
-    (float)0.00097126,
-    (float)0.00106657,
-    (float)0.000881988,
-    (float)0.000827052,
-    (float)0.000767306,
-    (float)0.000891494,
-    (float)0.000657591,
-    (float)0.000623925,
-    (float)0.000561514,
-    (float)0.000658755,
-    (float)0.000465937,
-    (float)0.000446227,
-    (float)0.000396706,
-    (float)0.000450707,
-    (float)0.00030433,
-    (float)0.000290351,
-    (float)0.000250684,
-    (float)0.000279401,
-    (float)0.000181132,
-    (float)0.000174052,
-    (float)0.000144672,
-    (float)0.000155302,
-    (float)9.50256e-05,
-    (float)8.87312e-05,
-    (float)7.06251e-05,
-    (float)7.19247e-05,
-    (float)4.27071e-05,
-    (float)3.71299e-05,
-    (float)2.80641e-05,
-    (float)2.47593e-05,
-    (float)1.52417e-05,
-    (float)1.06075e-05,
-    (float)6.92369e-06,
-    (float)4.02155e-06,
-    (float)4.88643e-06,
-    (float)2.54813e-06,
-    (float)2.06842e-06,
-    (float)1.05447e-06,
-    (float)5.19849e-06,
-    (float)4.85628e-06,
-    (float)6.57925e-06,
-    (float)8.24029e-06,
-    (float)9.91022e-06,
-    (float)1.22753e-05,
-    (float)1.53513e-05,
-    (float)1.9695e-05,
-    (float)1.69218e-05,
-    (float)2.1219e-05,
-    (float)2.5275e-05,
-    (float)3.06062e-05,
-    (float)2.39945e-05,
-    (float)2.91908e-05,
-    (float)3.32126e-05,
-    (float)3.97055e-05,
-    (float)3.07119e-05,
-    (float)3.58672e-05,
-    (float)3.82965e-05,
-    (float)4.4743e-05,
-    (float)3.61075e-05,
-    (float)3.97269e-05,
-    (float)4.09989e-05,
-    (float)4.61871e-05,
-    (float)4.0058e-05,
-    (float)4.13875e-05,
-    (float)4.09268e-05,
-    (float)4.42508e-05,
-    (float)4.15042e-05,
-    (float)4.11128e-05,
-    (float)3.91421e-05,
-    (float)4.03406e-05,
-    (float)4.04532e-05,
-    (float)3.86568e-05,
-    (float)3.58682e-05,
-    (float)3.51662e-05,
-    (float)3.75406e-05,
-    (float)3.48069e-05,
-    (float)3.22452e-05,
-    (float)2.93344e-05,
-    (float)3.26924e-05,
-    (float)2.97066e-05,
-    (float)2.77316e-05,
-    (float)2.422e-05,
-    (float)2.70591e-05,
-    (float)2.45432e-05,
-    (float)2.31719e-05,
-    (float)1.95438e-05,
-    (float)2.12221e-05,
-    (float)1.91068e-05,
-    (float)1.88567e-05,
-    (float)1.56656e-05,
-    (float)1.60681e-05,
-    (float)1.46592e-05,
-    (float)1.47869e-05,
-    (float)1.25242e-05,
-    (float)1.16338e-05,
-    (float)1.11263e-05,
-    (float)1.13148e-05,
-    (float)1.00829e-05,
-    (float)8.65162e-06,
-    (float)8.70787e-06,
-    (float)8.68066e-06,
-    (float)8.36036e-06,
-    (float)6.82637e-06,
-    (float)7.2924e-06,
-    (float)6.92536e-06,
-    (float)7.52494e-06,
-    (float)6.30383e-06,
-    (float)6.88791e-06,
-    (float)0.00358062,
-    (float)0.955914,
-    (float)0.000825537,
-    (float)0.00124594,
-    (float)0.00161752,
-    (float)0.00662449,
-    (float)0.00108745,
-    (float)0.00120486,
-    (float)0.00136338,
-    (float)0.00086064,
-    (float)0.00111532,
-    (float)0.00113671,
-    (float)0.00119306,
-    (float)0.000935906,
-    (float)0.00106195,
-    (float)0.00104279,
-    (float)0.00103685,
-    (float)0.00103284,
-    (float)0.000959756,
-    (float)0.000926203,
-    (float)0.000883205,
-    (float)0.000987951,
-    (float)0.000826499,
-    (float)0.000792366,
-    (float)0.000731488,
-    (float)0.000859159,
-    (float)0.000677339,
-    (float)0.000648909,
-    (float)0.000584513,
-    (float)0.000694606,
-    (float)0.00052621,
-    (float)0.000504915,
-    (float)0.000446527,
-    (float)0.000525368,
-    (float)0.000385023,
-    (float)0.000369653,
-    (float)0.000322248,
-    (float)0.000370411,
-    (float)0.00026262,
-    (float)0.000251133,
-    (float)0.000216022,
-    (float)0.000240309,
-    (float)0.000164159,
-    (float)0.000154917,
-    (float)0.000131005,
-    (float)0.000139681,
-    (float)9.11681e-05,
-    (float)8.34689e-05,
-    (float)6.85391e-05,
-    (float)6.89184e-05,
-    (float)4.21913e-05,
-    (float)3.61836e-05,
-    (float)2.78848e-05,
-    (float)2.5474e-05,
-    (float)1.3778e-05,
-    (float)1.00116e-05,
-    (float)6.39236e-06,
-    (float)4.88292e-06,
-    (float)1.52233e-06,
-    (float)4.25837e-07,
-    (float)5.22558e-08,
-    (float)1.60474e-06,
-    (float)9.07696e-07,
-    (float)2.43765e-06,
-    (float)4.25308e-06,
-    (float)9.76004e-06,
-    (float)7.8369e-06,
-    (float)1.14068e-05,
-    (float)1.45308e-05,
-    (float)2.37814e-05,
-    (float)1.88563e-05,
-    (float)2.35139e-05,
-    (float)2.71266e-05,
-    (float)3.89556e-05,
-    (float)3.11759e-05,
-    (float)3.59004e-05,
-    (float)3.92603e-05,
-    (float)5.18042e-05,
-    (float)4.26121e-05,
-    (float)4.65838e-05,
-    (float)4.91346e-05,
-    (float)6.02489e-05,
-    (float)5.15473e-05,
-    (float)5.42878e-05,
-    (float)5.5762e-05,
-    (float)6.35448e-05,
-    (float)5.69339e-05,
-    (float)5.82988e-05,
-    (float)5.87392e-05,
-    (float)6.20151e-05,
-    (float)5.83174e-05,
-    (float)5.83908e-05,
-    (float)5.80655e-05,
-    (float)5.66686e-05,
-    (float)5.5824e-05,
-    (float)5.47972e-05,
-    (float)5.4045e-05,
-    (float)4.88046e-05,
-    (float)5.0076e-05,
-    (float)4.81729e-05,
-    (float)4.72549e-05,
-    (float)3.96972e-05,
-    (float)4.20342e-05,
-    (float)3.95012e-05,
-    (float)3.85256e-05,
-    (float)3.04085e-05,
-    (float)3.28052e-05,
-    (float)2.99369e-05,
-    (float)2.88842e-05,
-    (float)2.17316e-05,
-    (float)2.34667e-05,
-    (float)2.06197e-05,
-    (float)1.94416e-05,
-    (float)1.4223e-05,
-    (float)1.49544e-05,
-    (float)1.25135e-05,
-    (float)1.1244e-05,
-    (float)8.26983e-06,
-    (float)8.02023e-06,
-    (float)6.3166e-06,
-    (float)5.13178e-06,
-    (float)4.14556e-06,
-    (float)3.24064e-06,
-    (float)2.45802e-06,
-    (float)1.6507e-06,
-    (float)2.03527e-06,
-    (float)1.03366e-06,
-    (float)1.15117e-06,
-    (float)0.00358062,
-    (float)0.955914,
-    (float)0.000825537,
-    (float)0.00124594,
-    (float)0.00161752,
-    (float)0.00662449,
-    (float)0.00108745,
-    (float)0.00120486,
-    (float)0.00136338,
-    (float)0.00086064,
-    (float)0.00111532,
-    (float)0.00113671,
-    (float)0.00119306,
-    (float)0.000935906,
-    (float)0.00106195,
-    (float)0.00104279,
-    (float)0.00103685,
-    (float)0.00103284,
-    (float)0.000959756,
-    (float)0.000926203,
-    (float)0.000883205,
-    (float)0.000987951,
-    (float)0.000826499,
-    (float)0.000792366,
-    (float)0.000731488,
-    (float)0.000859159,
-    (float)0.000677339,
-    (float)0.000648909,
-    (float)0.000584513,
-    (float)0.000694606,
-    (float)0.00052621,
-    (float)0.000504915,
-    (float)0.000446527,
-    (float)0.000525368,
-    (float)0.000385023,
-    (float)0.000369653,
-    (float)0.000322248,
-    (float)0.000370411,
-    (float)0.00026262,
-    (float)0.000251133,
-    (float)0.000216022,
-    (float)0.000240309,
-    (float)0.000164159,
-    (float)0.000154917,
-    (float)0.000131005,
-    (float)0.000139681,
-    (float)9.11681e-05,
-    (float)8.34689e-05,
-    (float)6.85391e-05,
-    (float)6.89184e-05,
-    (float)4.21913e-05,
-    (float)3.61836e-05,
-    (float)2.78848e-05,
-    (float)2.5474e-05,
-    (float)1.3778e-05,
-    (float)1.00116e-05,
-    (float)6.39236e-06,
-    (float)4.88292e-06,
-    (float)1.52233e-06,
-    (float)4.25837e-07,
-    (float)5.22558e-08,
-    (float)1.60474e-06,
-    (float)9.07696e-07,
-    (float)2.43765e-06,
-    (float)4.25308e-06,
-    (float)9.76004e-06,
-    (float)7.8369e-06,
-    (float)1.14068e-05,
-    (float)1.45308e-05,
-    (float)2.37814e-05,
-    (float)1.88563e-05,
-    (float)2.35139e-05,
-    (float)2.71266e-05,
-    (float)3.89556e-05,
-    (float)3.11759e-05,
-    (float)3.59004e-05,
-    (float)3.92603e-05,
-    (float)5.18042e-05,
-    (float)4.26121e-05,
-    (float)4.65838e-05,
-    (float)4.91346e-05,
-    (float)6.02489e-05,
-    (float)5.15473e-05,
-    (float)5.42878e-05,
-    (float)5.5762e-05,
-    (float)6.35448e-05,
-    (float)5.69339e-05,
-    (float)5.82988e-05,
-    (float)5.87392e-05,
-    (float)6.20151e-05,
-    (float)5.83174e-05,
-    (float)5.83908e-05,
-    (float)5.80655e-05,
-    (float)5.66686e-05,
-    (float)5.5824e-05,
-    (float)5.47972e-05,
-    (float)5.4045e-05,
-    (float)4.88046e-05,
-    (float)5.0076e-05,
-    (float)4.81729e-05,
-    (float)4.72549e-05,
-    (float)3.96972e-05,
-    (float)4.20342e-05,
-    (float)3.95012e-05,
-    (float)3.85256e-05,
-    (float)3.04085e-05,
-    (float)3.28052e-05,
-    (float)2.99369e-05,
-    (float)2.88842e-05,
-    (float)2.17316e-05,
-    (float)2.34667e-05,
-    (float)2.06197e-05,
-    (float)1.94416e-05,
-    (float)1.4223e-05,
-    (float)1.49544e-05,
-    (float)1.25135e-05,
-    (float)1.1244e-05,
-    (float)8.26983e-06,
-    (float)8.02023e-06,
-    (float)6.3166e-06,
-    (float)5.13178e-06,
-    (float)4.14556e-06,
-    (float)3.24064e-06,
-    (float)2.45802e-06,
-    (float)1.6507e-06,
-    (float)2.03527e-06,
-    (float)1.03366e-06,
-    (float)1.15117e-06,
-    (float)0.00486088,
-    (float)0.954231,
-    (float)0.00144435,
-    (float)0.000949578,
-    (float)0.00146096,
-    (float)0.00660068,
-    (float)0.00148469,
-    (float)0.00121479,
-    (float)0.00151829,
-    (float)0.00106989,
-    (float)0.0012891,
-    (float)0.00109805,
-    (float)0.00133235,
-    (float)0.00123799,
-    (float)0.00121738,
-    (float)0.00103914,
-    (float)0.00112611,
-    (float)0.00122283,
-    (float)0.00103132,
-    (float)0.000927809,
-    (float)0.000954607,
-    (float)0.00110068,
-    (float)0.000841587,
-    (float)0.000764305,
-    (float)0.000745637,
-    (float)0.000892979,
-    (float)0.000658186,
-    (float)0.000612345,
-    (float)0.000563283,
-    (float)0.000660807,
-    (float)0.00046953,
-    (float)0.00045033,
-    (float)0.000401544,
-    (float)0.000459846,
-    (float)0.000315689,
-    (float)0.000304536,
-    (float)0.000259082,
-    (float)0.00028686,
-    (float)0.000193682,
-    (float)0.000189318,
-    (float)0.000152224,
-    (float)0.000158396,
-    (float)0.000103881,
-    (float)0.000101053,
-    (float)7.58413e-05,
-    (float)7.38372e-05,
-    (float)4.80151e-05,
-    (float)4.39308e-05,
-    (float)2.81463e-05,
-    (float)2.40284e-05,
-    (float)1.68616e-05,
-    (float)1.32002e-05,
-    (float)5.97058e-06,
-    (float)3.09797e-06,
-    (float)3.72811e-06,
-    (float)1.41212e-06,
-    (float)1.16959e-06,
-    (float)1.05107e-06,
-    (float)2.67063e-06,
-    (float)2.65151e-06,
-    (float)6.85237e-06,
-    (float)9.50941e-06,
-    (float)8.40333e-06,
-    (float)1.09233e-05,
-    (float)1.66186e-05,
-    (float)2.12357e-05,
-    (float)1.69903e-05,
-    (float)2.19658e-05,
-    (float)2.66539e-05,
-    (float)3.20373e-05,
-    (float)2.579e-05,
-    (float)3.21002e-05,
-    (float)3.40564e-05,
-    (float)3.95247e-05,
-    (float)3.35496e-05,
-    (float)3.9963e-05,
-    (float)3.83294e-05,
-    (float)4.27369e-05,
-    (float)3.87762e-05,
-    (float)4.43976e-05,
-    (float)3.99783e-05,
-    (float)4.26615e-05,
-    (float)4.12127e-05,
-    (float)4.51989e-05,
-    (float)3.94895e-05,
-    (float)4.02205e-05,
-    (float)4.08971e-05,
-    (float)4.28103e-05,
-    (float)3.75517e-05,
-    (float)3.6688e-05,
-    (float)3.86391e-05,
-    (float)3.83439e-05,
-    (float)3.43358e-05,
-    (float)3.23094e-05,
-    (float)3.4839e-05,
-    (float)3.28768e-05,
-    (float)3.0714e-05,
-    (float)2.80975e-05,
-    (float)3.01436e-05,
-    (float)2.69092e-05,
-    (float)2.64882e-05,
-    (float)2.40572e-05,
-    (float)2.53988e-05,
-    (float)2.16089e-05,
-    (float)2.20674e-05,
-    (float)1.99285e-05,
-    (float)2.05017e-05,
-    (float)1.71796e-05,
-    (float)1.79717e-05,
-    (float)1.61152e-05,
-    (float)1.58191e-05,
-    (float)1.34653e-05,
-    (float)1.41183e-05,
-    (float)1.27266e-05,
-    (float)1.18292e-05,
-    (float)1.06055e-05,
-    (float)1.07131e-05,
-    (float)9.80984e-06,
-    (float)8.65667e-06,
-    (float)8.56038e-06,
-    (float)8.1119e-06,
-    (float)7.72751e-06,
-    (float)6.56532e-06,
-    (float)7.22501e-06,
-    (float)6.4306e-06,
-    (float)6.69816e-06,
-    (float)5.83428e-06,
-    (float)6.7379e-06,
-    (float)0.00821285,
-    (float)0.949825,
-    (float)0.00213862,
-    (float)0.000804872,
-    (float)0.00128324,
-    (float)0.00669655,
-    (float)0.00186936,
-    (float)0.00116036,
-    (float)0.00162737,
-    (float)0.00133504,
-    (float)0.00140265,
-    (float)0.00101472,
-    (float)0.00147281,
-    (float)0.00155315,
-    (float)0.00130107,
-    (float)0.000987849,
-    (float)0.00120915,
-    (float)0.00140704,
-    (float)0.00105571,
-    (float)0.000915183,
-    (float)0.00102115,
-    (float)0.00117995,
-    (float)0.000813909,
-    (float)0.000742302,
-    (float)0.000765326,
-    (float)0.000902544,
-    (float)0.000616942,
-    (float)0.000586172,
-    (float)0.000539066,
-    (float)0.000610593,
-    (float)0.000417091,
-    (float)0.000420281,
-    (float)0.000357817,
-    (float)0.000387732,
-    (float)0.000261782,
-    (float)0.000264382,
-    (float)0.000205038,
-    (float)0.000216858,
-    (float)0.000151774,
-    (float)0.000149731,
-    (float)0.000100966,
-    (float)0.00010056,
-    (float)7.43337e-05,
-    (float)6.97504e-05,
-    (float)4.01424e-05,
-    (float)3.69539e-05,
-    (float)2.98123e-05,
-    (float)2.28431e-05,
-    (float)1.04622e-05,
-    (float)8.10281e-06,
-    (float)9.59277e-06,
-    (float)4.41411e-06,
-    (float)3.75589e-06,
-    (float)2.2298e-06,
-    (float)4.26476e-06,
-    (float)3.26635e-06,
-    (float)8.98351e-06,
-    (float)8.44115e-06,
-    (float)8.01146e-06,
-    (float)1.10477e-05,
-    (float)1.78521e-05,
-    (float)1.89683e-05,
-    (float)1.622e-05,
-    (float)2.09763e-05,
-    (float)2.45394e-05,
-    (float)2.81865e-05,
-    (float)2.55231e-05,
-    (float)3.00974e-05,
-    (float)2.84866e-05,
-    (float)3.37784e-05,
-    (float)3.26462e-05,
-    (float)3.57249e-05,
-    (float)3.00654e-05,
-    (float)3.62387e-05,
-    (float)3.69878e-05,
-    (float)3.78607e-05,
-    (float)3.03899e-05,
-    (float)3.58383e-05,
-    (float)3.77967e-05,
-    (float)3.69205e-05,
-    (float)3.06218e-05,
-    (float)3.4275e-05,
-    (float)3.62765e-05,
-    (float)3.42802e-05,
-    (float)3.04578e-05,
-    (float)3.12765e-05,
-    (float)3.26366e-05,
-    (float)3.13141e-05,
-    (float)3.0976e-05,
-    (float)2.87471e-05,
-    (float)2.8112e-05,
-    (float)2.7299e-05,
-    (float)2.9771e-05,
-    (float)2.64449e-05,
-    (float)2.50233e-05,
-    (float)2.43389e-05,
-    (float)2.72071e-05,
-    (float)2.35849e-05,
-    (float)2.19805e-05,
-    (float)2.17321e-05,
-    (float)2.4254e-05,
-    (float)2.12052e-05,
-    (float)1.94087e-05,
-    (float)1.89268e-05,
-    (float)2.04296e-05,
-    (float)1.88419e-05,
-    (float)1.7406e-05,
-    (float)1.64666e-05,
-    (float)1.65476e-05,
-    (float)1.6135e-05,
-    (float)1.53352e-05,
-    (float)1.42533e-05,
-    (float)1.33171e-05,
-    (float)1.34777e-05,
-    (float)1.31525e-05,
-    (float)1.2182e-05,
-    (float)1.08563e-05,
-    (float)1.11818e-05,
-    (float)1.1189e-05,
-    (float)1.0466e-05,
-    (float)9.17242e-06,
-    (float)9.38385e-06,
-    (float)9.70207e-06,
-    (float)9.45779e-06,
-    (float)8.41989e-06,
-    (float)8.28941e-06,
-    (float)8.69878e-06,
-    (float)9.17275e-06,
-    (float)0.0145961,
-    (float)0.942256,
-    (float)0.00302018,
-    (float)0.000911793,
-    (float)0.0011936,
-    (float)0.00669222,
-    (float)0.00234162,
-    (float)0.00112714,
-    (float)0.00178785,
-    (float)0.00161416,
-    (float)0.00153768,
-    (float)0.000952671,
-    (float)0.00166882,
-    (float)0.00184805,
-    (float)0.00136073,
-    (float)0.000935593,
-    (float)0.00130556,
-    (float)0.00154762,
-    (float)0.0010531,
-    (float)0.000899159,
-    (float)0.00105632,
-    (float)0.0011781,
-    (float)0.000749573,
-    (float)0.00071822,
-    (float)0.000742531,
-    (float)0.000830719,
-    (float)0.000536332,
-    (float)0.000540932,
-    (float)0.000464448,
-    (float)0.00050106,
-    (float)0.000341929,
-    (float)0.000369711,
-    (float)0.000270833,
-    (float)0.000277203,
-    (float)0.000195188,
-    (float)0.000210016,
-    (float)0.000132432,
-    (float)0.000136606,
-    (float)0.000104608,
-    (float)0.000101283,
-    (float)5.24382e-05,
-    (float)5.41474e-05,
-    (float)4.8901e-05,
-    (float)4.0023e-05,
-    (float)2.02782e-05,
-    (float)1.82403e-05,
-    (float)1.99028e-05,
-    (float)1.2379e-05,
-    (float)1.36163e-05,
-    (float)8.78158e-06,
-    (float)1.07962e-05,
-    (float)7.63844e-06,
-    (float)1.65338e-05,
-    (float)1.12151e-05,
-    (float)1.22761e-05,
-    (float)1.31187e-05,
-    (float)2.00609e-05,
-    (float)1.70993e-05,
-    (float)1.74781e-05,
-    (float)2.02151e-05,
-    (float)2.14541e-05,
-    (float)2.31103e-05,
-    (float)2.28033e-05,
-    (float)2.46012e-05,
-    (float)2.04182e-05,
-    (float)2.70415e-05,
-    (float)2.67211e-05,
-    (float)2.71712e-05,
-    (float)2.0319e-05,
-    (float)2.83921e-05,
-    (float)2.77801e-05,
-    (float)2.80663e-05,
-    (float)2.25354e-05,
-    (float)2.86979e-05,
-    (float)2.77975e-05,
-    (float)2.85561e-05,
-    (float)2.60187e-05,
-    (float)2.77183e-05,
-    (float)2.71584e-05,
-    (float)2.90561e-05,
-    (float)3.03014e-05,
-    (float)2.7503e-05,
-    (float)2.67089e-05,
-    (float)2.79614e-05,
-    (float)3.22223e-05,
-    (float)2.80281e-05,
-    (float)2.80887e-05,
-    (float)2.72553e-05,
-    (float)3.12096e-05,
-    (float)2.7132e-05,
-    (float)2.84546e-05,
-    (float)2.65371e-05,
-    (float)2.91198e-05,
-    (float)2.63355e-05,
-    (float)2.75581e-05,
-    (float)2.45517e-05,
-    (float)2.54085e-05,
-    (float)2.5032e-05,
-    (float)2.56838e-05,
-    (float)2.25668e-05,
-    (float)2.13442e-05,
-    (float)2.21203e-05,
-    (float)2.20356e-05,
-    (float)2.05717e-05,
-    (float)1.83474e-05,
-    (float)1.88979e-05,
-    (float)1.75952e-05,
-    (float)1.77996e-05,
-    (float)1.57274e-05,
-    (float)1.59693e-05,
-    (float)1.41667e-05,
-    (float)1.50271e-05,
-    (float)1.334e-05,
-    (float)1.32125e-05,
-    (float)1.18959e-05,
-    (float)1.27056e-05,
-    (float)1.17128e-05,
-    (float)1.12314e-05,
-    (float)1.06276e-05,
-    (float)1.07232e-05,
-    (float)1.07096e-05,
-    (float)1.01566e-05,
-    (float)1.01969e-05,
-    (float)9.45283e-06,
-    (float)1.01801e-05,
-    (float)9.63559e-06,
-    (float)1.00968e-05,
-    (float)9.05945e-06,
-    (float)0.0246463,
-    (float)0.930611,
-    (float)0.00391739,
-    (float)0.001215,
-    (float)0.00109718,
-    (float)0.00678307,
-    (float)0.00277555,
-    (float)0.00103371,
-    (float)0.00191964,
-    (float)0.00192553,
-    (float)0.00162043,
-    (float)0.000874725,
-    (float)0.00187493,
-    (float)0.00210875,
-    (float)0.00135869,
-    (float)0.000888492,
-    (float)0.00141027,
-    (float)0.00164986,
-    (float)0.00102347,
-    (float)0.000904124,
-    (float)0.00107748,
-    (float)0.00113713,
-    (float)0.000688437,
-    (float)0.00072811,
-    (float)0.000708416,
-    (float)0.00073784,
-    (float)0.000469231,
-    (float)0.000516927,
-    (float)0.000389332,
-    (float)0.000405667,
-    (float)0.000290492,
-    (float)0.000327206,
-    (float)0.000191483,
-    (float)0.00019783,
-    (float)0.000153793,
-    (float)0.000165643,
-    (float)8.09016e-05,
-    (float)8.90554e-05,
-    (float)7.31916e-05,
-    (float)6.52197e-05,
-    (float)3.25722e-05,
-    (float)3.551e-05,
-    (float)3.31331e-05,
-    (float)2.33268e-05,
-    (float)2.26085e-05,
-    (float)1.56579e-05,
-    (float)1.84501e-05,
-    (float)1.45182e-05,
-    (float)2.64437e-05,
-    (float)1.41761e-05,
-    (float)1.87353e-05,
-    (float)1.83172e-05,
-    (float)2.84424e-05,
-    (float)1.99493e-05,
-    (float)2.44207e-05,
-    (float)2.28426e-05,
-    (float)2.49149e-05,
-    (float)2.5291e-05,
-    (float)2.76549e-05,
-    (float)2.49496e-05,
-    (float)2.0785e-05,
-    (float)2.78827e-05,
-    (float)2.59806e-05,
-    (float)2.44406e-05,
-    (float)1.84025e-05,
-    (float)2.75836e-05,
-    (float)2.27999e-05,
-    (float)2.47592e-05,
-    (float)1.92072e-05,
-    (float)2.45808e-05,
-    (float)2.00244e-05,
-    (float)2.61659e-05,
-    (float)2.28556e-05,
-    (float)2.28191e-05,
-    (float)2.05082e-05,
-    (float)2.65354e-05,
-    (float)2.5561e-05,
-    (float)2.27185e-05,
-    (float)2.49589e-05,
-    (float)2.70323e-05,
-    (float)2.70645e-05,
-    (float)2.34222e-05,
-    (float)2.86398e-05,
-    (float)2.59162e-05,
-    (float)2.86291e-05,
-    (float)2.60018e-05,
-    (float)3.04025e-05,
-    (float)2.36359e-05,
-    (float)2.80065e-05,
-    (float)2.70401e-05,
-    (float)2.98702e-05,
-    (float)2.29208e-05,
-    (float)2.65965e-05,
-    (float)2.58798e-05,
-    (float)2.68318e-05,
-    (float)2.28568e-05,
-    (float)2.4462e-05,
-    (float)2.35312e-05,
-    (float)2.27657e-05,
-    (float)2.2569e-05,
-    (float)2.15053e-05,
-    (float)2.12414e-05,
-    (float)1.94781e-05,
-    (float)2.1298e-05,
-    (float)1.78914e-05,
-    (float)1.90344e-05,
-    (float)1.71778e-05,
-    (float)1.93764e-05,
-    (float)1.5052e-05,
-    (float)1.68977e-05,
-    (float)1.49112e-05,
-    (float)1.6473e-05,
-    (float)1.34517e-05,
-    (float)1.50681e-05,
-    (float)1.29299e-05,
-    (float)1.32339e-05,
-    (float)1.23627e-05,
-    (float)1.28276e-05,
-    (float)1.14781e-05,
-    (float)1.08557e-05,
-    (float)1.16574e-05,
-    (float)1.047e-05,
-    (float)1.04958e-05,
-    (float)9.3167e-06,
-    (float)1.10896e-05,
-    (float)9.14158e-06,
-    (float)1.04473e-05,
-    (float)8.70643e-06,
-    (float)0.0395385,
-    (float)0.914124,
-    (float)0.00490627,
-    (float)0.00177577,
-    (float)0.00106217,
-    (float)0.00681435,
-    (float)0.00321502,
-    (float)0.000959272,
-    (float)0.00208896,
-    (float)0.00222945,
-    (float)0.00167919,
-    (float)0.000820046,
-    (float)0.00210356,
-    (float)0.00229692,
-    (float)0.00130743,
-    (float)0.000855521,
-    (float)0.00149935,
-    (float)0.00166985,
-    (float)0.000960745,
-    (float)0.000894366,
-    (float)0.0010403,
-    (float)0.0010262,
-    (float)0.000619589,
-    (float)0.000710484,
-    (float)0.000615815,
-    (float)0.000599162,
-    (float)0.000400141,
-    (float)0.000460382,
-    (float)0.000288614,
-    (float)0.000302622,
-    (float)0.000238858,
-    (float)0.000257074,
-    (float)0.000118143,
-    (float)0.00013585,
-    (float)0.000118597,
-    (float)0.00011633,
-    (float)5.39434e-05,
-    (float)6.1367e-05,
-    (float)5.16578e-05,
-    (float)4.55685e-05,
-    (float)4.08388e-05,
-    (float)3.22972e-05,
-    (float)2.85256e-05,
-    (float)2.63212e-05,
-    (float)4.08174e-05,
-    (float)2.36758e-05,
-    (float)2.82164e-05,
-    (float)2.6776e-05,
-    (float)3.82208e-05,
-    (float)2.44256e-05,
-    (float)3.23084e-05,
-    (float)2.66546e-05,
-    (float)3.0778e-05,
-    (float)2.79386e-05,
-    (float)3.22181e-05,
-    (float)2.2964e-05,
-    (float)2.19712e-05,
-    (float)2.79668e-05,
-    (float)2.68817e-05,
-    (float)2.13585e-05,
-    (float)1.81092e-05,
-    (float)2.40776e-05,
-    (float)1.96714e-05,
-    (float)2.30326e-05,
-    (float)1.90042e-05,
-    (float)2.05461e-05,
-    (float)1.70773e-05,
-    (float)2.63371e-05,
-    (float)2.12234e-05,
-    (float)1.93153e-05,
-    (float)1.97616e-05,
-    (float)2.8967e-05,
-    (float)2.42652e-05,
-    (float)2.18392e-05,
-    (float)2.38639e-05,
-    (float)2.68968e-05,
-    (float)2.68428e-05,
-    (float)2.71379e-05,
-    (float)2.7999e-05,
-    (float)2.31689e-05,
-    (float)2.703e-05,
-    (float)2.94192e-05,
-    (float)2.98038e-05,
-    (float)2.2108e-05,
-    (float)2.712e-05,
-    (float)2.7426e-05,
-    (float)2.78838e-05,
-    (float)2.28616e-05,
-    (float)2.61526e-05,
-    (float)2.34611e-05,
-    (float)2.55118e-05,
-    (float)2.45996e-05,
-    (float)2.37961e-05,
-    (float)2.00426e-05,
-    (float)2.32792e-05,
-    (float)2.45613e-05,
-    (float)2.111e-05,
-    (float)1.90784e-05,
-    (float)2.10417e-05,
-    (float)2.25725e-05,
-    (float)1.93204e-05,
-    (float)1.97699e-05,
-    (float)1.85906e-05,
-    (float)1.96209e-05,
-    (float)1.84665e-05,
-    (float)2.0222e-05,
-    (float)1.62629e-05,
-    (float)1.69827e-05,
-    (float)1.74848e-05,
-    (float)1.9037e-05,
-    (float)1.47924e-05,
-    (float)1.52771e-05,
-    (float)1.54868e-05,
-    (float)1.60703e-05,
-    (float)1.40385e-05,
-    (float)1.39092e-05,
-    (float)1.28994e-05,
-    (float)1.28267e-05,
-    (float)1.32831e-05,
-    (float)1.20489e-05,
-    (float)1.06663e-05,
-    (float)1.05129e-05,
-    (float)1.21557e-05,
-    (float)1.02466e-05,
-    (float)9.84505e-06,
-    (float)9.33296e-06,
-    (float)1.06859e-05,
-    (float)9.52271e-06,
-    (float)0.0603304,
-    (float)0.891625,
-    (float)0.00585958,
-    (float)0.00254345,
-    (float)0.00104749,
-    (float)0.00686752,
-    (float)0.00360099,
-    (float)0.000843752,
-    (float)0.00225024,
-    (float)0.00252254,
-    (float)0.0017031,
-    (float)0.000779083,
-    (float)0.00231775,
-    (float)0.00240409,
-    (float)0.0012298,
-    (float)0.000862803,
-    (float)0.0015631,
-    (float)0.00162217,
-    (float)0.00089936,
-    (float)0.000907235,
-    (float)0.000964816,
-    (float)0.000891097,
-    (float)0.000573858,
-    (float)0.000698151,
-    (float)0.000503343,
-    (float)0.000470373,
-    (float)0.00034809,
-    (float)0.000404063,
-    (float)0.000204546,
-    (float)0.000230507,
-    (float)0.000190588,
-    (float)0.00019072,
-    (float)8.10022e-05,
-    (float)0.000106077,
-    (float)8.5843e-05,
-    (float)7.96442e-05,
-    (float)5.49657e-05,
-    (float)5.17067e-05,
-    (float)3.97601e-05,
-    (float)4.24476e-05,
-    (float)5.67469e-05,
-    (float)3.37617e-05,
-    (float)3.55586e-05,
-    (float)3.7237e-05,
-    (float)5.18087e-05,
-    (float)3.21928e-05,
-    (float)4.37004e-05,
-    (float)3.51106e-05,
-    (float)4.00428e-05,
-    (float)3.41732e-05,
-    (float)4.23191e-05,
-    (float)2.85061e-05,
-    (float)2.98463e-05,
-    (float)3.30102e-05,
-    (float)3.12109e-05,
-    (float)2.28954e-05,
-    (float)2.27832e-05,
-    (float)2.60915e-05,
-    (float)2.04523e-05,
-    (float)2.36917e-05,
-    (float)1.96654e-05,
-    (float)1.8352e-05,
-    (float)1.56731e-05,
-    (float)2.63969e-05,
-    (float)1.98049e-05,
-    (float)1.76103e-05,
-    (float)1.78456e-05,
-    (float)2.50643e-05,
-    (float)2.10457e-05,
-    (float)2.28846e-05,
-    (float)2.34343e-05,
-    (float)2.27196e-05,
-    (float)2.34865e-05,
-    (float)2.67606e-05,
-    (float)2.61424e-05,
-    (float)2.22018e-05,
-    (float)2.76578e-05,
-    (float)2.72086e-05,
-    (float)2.56754e-05,
-    (float)2.3387e-05,
-    (float)2.86013e-05,
-    (float)2.45133e-05,
-    (float)2.59526e-05,
-    (float)2.61423e-05,
-    (float)2.6366e-05,
-    (float)2.11808e-05,
-    (float)2.54599e-05,
-    (float)2.64559e-05,
-    (float)2.34017e-05,
-    (float)2.11991e-05,
-    (float)2.45994e-05,
-    (float)2.41557e-05,
-    (float)2.14248e-05,
-    (float)2.27969e-05,
-    (float)2.19792e-05,
-    (float)2.07152e-05,
-    (float)2.10965e-05,
-    (float)2.32761e-05,
-    (float)1.91322e-05,
-    (float)1.9336e-05,
-    (float)2.05606e-05,
-    (float)2.07184e-05,
-    (float)1.72718e-05,
-    (float)1.92147e-05,
-    (float)1.87307e-05,
-    (float)1.71779e-05,
-    (float)1.66546e-05,
-    (float)1.8105e-05,
-    (float)1.56911e-05,
-    (float)1.46657e-05,
-    (float)1.62401e-05,
-    (float)1.56404e-05,
-    (float)1.33574e-05,
-    (float)1.35056e-05,
-    (float)1.44968e-05,
-    (float)1.28927e-05,
-    (float)1.27738e-05,
-    (float)1.29594e-05,
-    (float)1.21463e-05,
-    (float)1.14018e-05,
-    (float)1.26961e-05,
-    (float)1.19281e-05,
-    (float)1.09369e-05,
-    (float)1.16481e-05,
-    (float)1.20411e-05,
-    (float)1.06975e-05,
-    (float)1.11654e-05,
-    (float)1.21363e-05,
-    (float)0.0881657,
-    (float)0.862194,
-    (float)0.0067708,
-    (float)0.00350346,
-    (float)0.00109123,
-    (float)0.00689335,
-    (float)0.00391373,
-    (float)0.000716119,
-    (float)0.00244478,
-    (float)0.00277168,
-    (float)0.00168877,
-    (float)0.000768367,
-    (float)0.00251749,
-    (float)0.00241079,
-    (float)0.00113467,
-    (float)0.000901645,
-    (float)0.00157787,
-    (float)0.00150832,
-    (float)0.000840982,
-    (float)0.000905452,
-    (float)0.000837587,
-    (float)0.000752466,
-    (float)0.000537483,
-    (float)0.000644671,
-    (float)0.00036946,
-    (float)0.000368808,
-    (float)0.000296406,
-    (float)0.000325163,
-    (float)0.000137719,
-    (float)0.000182722,
-    (float)0.000137383,
-    (float)0.000132601,
-    (float)7.40953e-05,
-    (float)8.98864e-05,
-    (float)5.97888e-05,
-    (float)6.49575e-05,
-    (float)7.09174e-05,
-    (float)4.95406e-05,
-    (float)4.65693e-05,
-    (float)5.38149e-05,
-    (float)7.04439e-05,
-    (float)4.1551e-05,
-    (float)5.55623e-05,
-    (float)4.66434e-05,
-    (float)5.73402e-05,
-    (float)4.44757e-05,
-    (float)5.59526e-05,
-    (float)3.46952e-05,
-    (float)4.02898e-05,
-    (float)3.95323e-05,
-    (float)3.99923e-05,
-    (float)2.65687e-05,
-    (float)2.85873e-05,
-    (float)2.79357e-05,
-    (float)2.22953e-05,
-    (float)2.44017e-05,
-    (float)2.0545e-05,
-    (float)1.93897e-05,
-    (float)1.63292e-05,
-    (float)2.53816e-05,
-    (float)1.70719e-05,
-    (float)1.87563e-05,
-    (float)1.87555e-05,
-    (float)2.59315e-05,
-    (float)2.06424e-05,
-    (float)2.3748e-05,
-    (float)2.12455e-05,
-    (float)2.30379e-05,
-    (float)2.74071e-05,
-    (float)2.85105e-05,
-    (float)2.3188e-05,
-    (float)2.11057e-05,
-    (float)2.87567e-05,
-    (float)2.62158e-05,
-    (float)2.55759e-05,
-    (float)2.29697e-05,
-    (float)2.59615e-05,
-    (float)2.07189e-05,
-    (float)2.61286e-05,
-    (float)2.39913e-05,
-    (float)2.25675e-05,
-    (float)1.94371e-05,
-    (float)2.54332e-05,
-    (float)2.27625e-05,
-    (float)2.09247e-05,
-    (float)2.15594e-05,
-    (float)2.28152e-05,
-    (float)2.19981e-05,
-    (float)2.25313e-05,
-    (float)2.39949e-05,
-    (float)1.99686e-05,
-    (float)2.23977e-05,
-    (float)2.35567e-05,
-    (float)2.39832e-05,
-    (float)1.90085e-05,
-    (float)2.29335e-05,
-    (float)2.22066e-05,
-    (float)2.20855e-05,
-    (float)1.9759e-05,
-    (float)2.16411e-05,
-    (float)1.88056e-05,
-    (float)1.96937e-05,
-    (float)2.00459e-05,
-    (float)1.83812e-05,
-    (float)1.60316e-05,
-    (float)1.69623e-05,
-    (float)1.79326e-05,
-    (float)1.50767e-05,
-    (float)1.51898e-05,
-    (float)1.4333e-05,
-    (float)1.45485e-05,
-    (float)1.3066e-05,
-    (float)1.46783e-05,
-    (float)1.22737e-05,
-    (float)1.2641e-05,
-    (float)1.27225e-05,
-    (float)1.32083e-05,
-    (float)1.12267e-05,
-    (float)1.22902e-05,
-    (float)1.30395e-05,
-    (float)1.20734e-05,
-    (float)1.18918e-05,
-    (float)1.20297e-05,
-    (float)1.24576e-05,
-    (float)1.18193e-05,
-    (float)1.35092e-05,
-    (float)1.18033e-05,
-    (float)1.1829e-05,
-    (float)0.124157,
-    (float)0.824896,
-    (float)0.00758683,
-    (float)0.00462054,
-    (float)0.00118914,
-    (float)0.0068855,
-    (float)0.00413001,
-    (float)0.000580255,
-    (float)0.00265501,
-    (float)0.00295617,
-    (float)0.00163745,
-    (float)0.000776038,
-    (float)0.00265642,
-    (float)0.00231751,
-    (float)0.00103844,
-    (float)0.000954186,
-    (float)0.0015207,
-    (float)0.00134103,
-    (float)0.000786151,
-    (float)0.000877141,
-    (float)0.000675265,
-    (float)0.000627728,
-    (float)0.000498628,
-    (float)0.000560045,
-    (float)0.000248064,
-    (float)0.000299232,
-    (float)0.000240439,
-    (float)0.000251877,
-    (float)0.000106313,
-    (float)0.000152635,
-    (float)9.07983e-05,
-    (float)0.00010429,
-    (float)9.00338e-05,
-    (float)8.09478e-05,
-    (float)5.1633e-05,
-    (float)6.87025e-05,
-    (float)8.63666e-05,
-    (float)5.44474e-05,
-    (float)6.62652e-05,
-    (float)5.99491e-05,
-    (float)7.37541e-05,
-    (float)5.2303e-05,
-    (float)7.13275e-05,
-    (float)4.37364e-05,
-    (float)5.70014e-05,
-    (float)4.95469e-05,
-    (float)5.4597e-05,
-    (float)3.07769e-05,
-    (float)3.9257e-05,
-    (float)3.46284e-05,
-    (float)3.23519e-05,
-    (float)2.88125e-05,
-    (float)2.56365e-05,
-    (float)2.11276e-05,
-    (float)1.91464e-05,
-    (float)2.86874e-05,
-    (float)1.89881e-05,
-    (float)2.10356e-05,
-    (float)1.67025e-05,
-    (float)2.44536e-05,
-    (float)1.98599e-05,
-    (float)2.77268e-05,
-    (float)1.89752e-05,
-    (float)2.16407e-05,
-    (float)2.39403e-05,
-    (float)2.81308e-05,
-    (float)2.16471e-05,
-    (float)2.19788e-05,
-    (float)2.65765e-05,
-    (float)2.35585e-05,
-    (float)2.46326e-05,
-    (float)2.22602e-05,
-    (float)2.44351e-05,
-    (float)1.97498e-05,
-    (float)2.76039e-05,
-    (float)2.16648e-05,
-    (float)2.22133e-05,
-    (float)1.90401e-05,
-    (float)2.58759e-05,
-    (float)2.08295e-05,
-    (float)2.38684e-05,
-    (float)2.16809e-05,
-    (float)2.14482e-05,
-    (float)2.06786e-05,
-    (float)2.46798e-05,
-    (float)2.36049e-05,
-    (float)1.90208e-05,
-    (float)2.22763e-05,
-    (float)2.2759e-05,
-    (float)2.40571e-05,
-    (float)1.95857e-05,
-    (float)2.23607e-05,
-    (float)1.82816e-05,
-    (float)2.31691e-05,
-    (float)2.0836e-05,
-    (float)2.15006e-05,
-    (float)1.66302e-05,
-    (float)2.08659e-05,
-    (float)1.90337e-05,
-    (float)1.93027e-05,
-    (float)1.76406e-05,
-    (float)1.79929e-05,
-    (float)1.66266e-05,
-    (float)1.68607e-05,
-    (float)1.82729e-05,
-    (float)1.50708e-05,
-    (float)1.55818e-05,
-    (float)1.48139e-05,
-    (float)1.71564e-05,
-    (float)1.33538e-05,
-    (float)1.53945e-05,
-    (float)1.29438e-05,
-    (float)1.51918e-05,
-    (float)1.31679e-05,
-    (float)1.4672e-05,
-    (float)1.1704e-05,
-    (float)1.32969e-05,
-    (float)1.33115e-05,
-    (float)1.30777e-05,
-    (float)1.17431e-05,
-    (float)1.17556e-05,
-    (float)1.28023e-05,
-    (float)1.14276e-05,
-    (float)1.27031e-05,
-    (float)1.07032e-05,
-    (float)1.19877e-05,
-    (float)1.05281e-05,
-    (float)1.33211e-05,
-    (float)0.16911,
-    (float)0.779132,
-    (float)0.00818777,
-    (float)0.00581412,
-    (float)0.00131799,
-    (float)0.00682463,
-    (float)0.00421521,
-    (float)0.000439328,
-    (float)0.00284083,
-    (float)0.00306503,
-    (float)0.00156181,
-    (float)0.000818668,
-    (float)0.00271762,
-    (float)0.00214945,
-    (float)0.000967593,
-    (float)0.00101922,
-    (float)0.00140493,
-    (float)0.00115523,
-    (float)0.000748447,
-    (float)0.000823479,
-    (float)0.00051709,
-    (float)0.000527397,
-    (float)0.000449693,
-    (float)0.000449276,
-    (float)0.000166462,
-    (float)0.000250895,
-    (float)0.000179258,
-    (float)0.000183316,
-    (float)0.000100326,
-    (float)0.000123833,
-    (float)6.11491e-05,
-    (float)9.43748e-05,
-    (float)0.000103909,
-    (float)7.3342e-05,
-    (float)6.41172e-05,
-    (float)7.68838e-05,
-    (float)9.21186e-05,
-    (float)6.7583e-05,
-    (float)8.82619e-05,
-    (float)6.10892e-05,
-    (float)7.41182e-05,
-    (float)6.44135e-05,
-    (float)7.46234e-05,
-    (float)4.20045e-05,
-    (float)5.66481e-05,
-    (float)4.6648e-05,
-    (float)4.41199e-05,
-    (float)3.12048e-05,
-    (float)3.4316e-05,
-    (float)2.5846e-05,
-    (float)2.57894e-05,
-    (float)2.79623e-05,
-    (float)1.92213e-05,
-    (float)2.00496e-05,
-    (float)1.93815e-05,
-    (float)2.5562e-05,
-    (float)1.9771e-05,
-    (float)2.64407e-05,
-    (float)1.77956e-05,
-    (float)2.31227e-05,
-    (float)2.66741e-05,
-    (float)3.11957e-05,
-    (float)2.06541e-05,
-    (float)2.3092e-05,
-    (float)2.60299e-05,
-    (float)2.63904e-05,
-    (float)2.558e-05,
-    (float)2.31709e-05,
-    (float)2.15443e-05,
-    (float)2.01161e-05,
-    (float)2.55732e-05,
-    (float)1.97417e-05,
-    (float)2.01136e-05,
-    (float)1.85187e-05,
-    (float)2.22392e-05,
-    (float)1.78037e-05,
-    (float)2.17565e-05,
-    (float)1.88601e-05,
-    (float)1.97467e-05,
-    (float)2.02275e-05,
-    (float)2.34745e-05,
-    (float)2.07452e-05,
-    (float)2.04714e-05,
-    (float)2.23105e-05,
-    (float)2.20482e-05,
-    (float)2.36471e-05,
-    (float)2.26053e-05,
-    (float)2.25409e-05,
-    (float)1.97013e-05,
-    (float)2.38409e-05,
-    (float)2.12722e-05,
-    (float)2.11073e-05,
-    (float)1.87122e-05,
-    (float)2.138e-05,
-    (float)1.80776e-05,
-    (float)1.92468e-05,
-    (float)1.7796e-05,
-    (float)1.74411e-05,
-    (float)1.61377e-05,
-    (float)1.73208e-05,
-    (float)1.60496e-05,
-    (float)1.49068e-05,
-    (float)1.57763e-05,
-    (float)1.52014e-05,
-    (float)1.57076e-05,
-    (float)1.47287e-05,
-    (float)1.5503e-05,
-    (float)1.36346e-05,
-    (float)1.5785e-05,
-    (float)1.48556e-05,
-    (float)1.52187e-05,
-    (float)1.3472e-05,
-    (float)1.51323e-05,
-    (float)1.38559e-05,
-    (float)1.4228e-05,
-    (float)1.34571e-05,
-    (float)1.37538e-05,
-    (float)1.28533e-05,
-    (float)1.26636e-05,
-    (float)1.23417e-05,
-    (float)1.174e-05,
-    (float)1.2121e-05,
-    (float)1.12986e-05,
-    (float)1.13336e-05,
-    (float)1.02612e-05,
-    (float)1.13412e-05,
-    (float)1.02884e-05,
-    (float)1.10975e-05,
-    (float)0.223468,
-    (float)0.724679,
-    (float)0.00861642,
-    (float)0.00700962,
-    (float)0.00150945,
-    (float)0.00667129,
-    (float)0.00418442,
-    (float)0.000314294,
-    (float)0.00301884,
-    (float)0.00306695,
-    (float)0.00145801,
-    (float)0.000862122,
-    (float)0.00267303,
-    (float)0.00190426,
-    (float)0.000905346,
-    (float)0.00104546,
-    (float)0.00121266,
-    (float)0.000958573,
-    (float)0.000697778,
-    (float)0.00072283,
-    (float)0.000361074,
-    (float)0.00044864,
-    (float)0.00037827,
-    (float)0.0003368,
-    (float)0.000122151,
-    (float)0.000216721,
-    (float)0.000122868,
-    (float)0.000146737,
-    (float)0.000111648,
-    (float)0.000104767,
-    (float)5.88592e-05,
-    (float)0.000102445,
-    (float)0.000111514,
-    (float)7.64217e-05,
-    (float)8.77761e-05,
-    (float)7.79178e-05,
-    (float)9.08823e-05,
-    (float)7.97622e-05,
-    (float)9.47244e-05,
-    (float)5.19562e-05,
-    (float)7.0844e-05,
-    (float)6.20175e-05,
-    (float)6.27222e-05,
-    (float)3.88731e-05,
-    (float)4.91395e-05,
-    (float)3.419e-05,
-    (float)3.46783e-05,
-    (float)3.24792e-05,
-    (float)2.68611e-05,
-    (float)2.37706e-05,
-    (float)2.46247e-05,
-    (float)2.61999e-05,
-    (float)1.96998e-05,
-    (float)2.86927e-05,
-    (float)2.07997e-05,
-    (float)2.44599e-05,
-    (float)2.4254e-05,
-    (float)2.95727e-05,
-    (float)2.01003e-05,
-    (float)2.50522e-05,
-    (float)2.55565e-05,
-    (float)2.55771e-05,
-    (float)2.31611e-05,
-    (float)2.16484e-05,
-    (float)2.00527e-05,
-    (float)2.15303e-05,
-    (float)2.50974e-05,
-    (float)1.80233e-05,
-    (float)1.89302e-05,
-    (float)1.8502e-05,
-    (float)2.1544e-05,
-    (float)1.86604e-05,
-    (float)2.26164e-05,
-    (float)1.76648e-05,
-    (float)1.91368e-05,
-    (float)2.06251e-05,
-    (float)2.24874e-05,
-    (float)2.00308e-05,
-    (float)2.11921e-05,
-    (float)2.05237e-05,
-    (float)1.94189e-05,
-    (float)2.28858e-05,
-    (float)2.142e-05,
-    (float)1.90424e-05,
-    (float)1.80714e-05,
-    (float)2.26883e-05,
-    (float)1.9647e-05,
-    (float)1.98082e-05,
-    (float)1.75894e-05,
-    (float)1.82973e-05,
-    (float)1.79021e-05,
-    (float)2.07028e-05,
-    (float)1.76383e-05,
-    (float)1.65203e-05,
-    (float)1.73917e-05,
-    (float)1.7907e-05,
-    (float)1.72077e-05,
-    (float)1.69688e-05,
-    (float)1.67596e-05,
-    (float)1.49685e-05,
-    (float)1.68927e-05,
-    (float)1.65597e-05,
-    (float)1.56103e-05,
-    (float)1.41742e-05,
-    (float)1.57587e-05,
-    (float)1.47298e-05,
-    (float)1.5209e-05,
-    (float)1.41581e-05,
-    (float)1.34874e-05,
-    (float)1.33225e-05,
-    (float)1.45438e-05,
-    (float)1.35395e-05,
-    (float)1.21198e-05,
-    (float)1.24675e-05,
-    (float)1.27899e-05,
-    (float)1.28104e-05,
-    (float)1.19787e-05,
-    (float)1.14971e-05,
-    (float)1.11561e-05,
-    (float)1.22666e-05,
-    (float)1.19563e-05,
-    (float)1.1085e-05,
-    (float)1.0632e-05,
-    (float)1.11922e-05,
-    (float)1.15502e-05,
-    (float)1.15863e-05,
-    (float)1.09663e-05,
-    (float)1.04725e-05,
-    (float)0.28664,
-    (float)0.662188,
-    (float)0.00874787,
-    (float)0.00809902,
-    (float)0.00173221,
-    (float)0.00643627,
-    (float)0.00401226,
-    (float)0.000196957,
-    (float)0.00314953,
-    (float)0.00297217,
-    (float)0.00134771,
-    (float)0.000915782,
-    (float)0.00253504,
-    (float)0.00163243,
-    (float)0.000873312,
-    (float)0.00104395,
-    (float)0.000989375,
-    (float)0.000789423,
-    (float)0.000644098,
-    (float)0.000607656,
-    (float)0.000243822,
-    (float)0.000389202,
-    (float)0.000289375,
-    (float)0.00024558,
-    (float)0.000111036,
-    (float)0.00018385,
-    (float)7.7528e-05,
-    (float)0.000129598,
-    (float)0.000116994,
-    (float)9.12095e-05,
-    (float)7.62771e-05,
-    (float)0.000104711,
-    (float)0.000106396,
-    (float)8.62567e-05,
-    (float)0.000108128,
-    (float)6.9204e-05,
-    (float)9.01044e-05,
-    (float)8.49508e-05,
-    (float)8.96641e-05,
-    (float)4.62174e-05,
-    (float)6.72203e-05,
-    (float)4.91931e-05,
-    (float)5.24046e-05,
-    (float)3.98655e-05,
-    (float)3.86429e-05,
-    (float)2.43133e-05,
-    (float)2.9886e-05,
-    (float)3.04217e-05,
-    (float)2.27653e-05,
-    (float)2.76326e-05,
-    (float)2.04019e-05,
-    (float)2.32572e-05,
-    (float)2.4173e-05,
-    (float)3.40372e-05,
-    (float)2.01104e-05,
-    (float)2.51868e-05,
-    (float)2.36681e-05,
-    (float)2.84477e-05,
-    (float)2.59355e-05,
-    (float)2.51944e-05,
-    (float)1.93529e-05,
-    (float)2.22386e-05,
-    (float)2.55844e-05,
-    (float)1.86765e-05,
-    (float)1.898e-05,
-    (float)1.80529e-05,
-    (float)2.00089e-05,
-    (float)1.66057e-05,
-    (float)2.10858e-05,
-    (float)1.45338e-05,
-    (float)1.79059e-05,
-    (float)1.91251e-05,
-    (float)2.0337e-05,
-    (float)1.69905e-05,
-    (float)2.01266e-05,
-    (float)1.87737e-05,
-    (float)1.83316e-05,
-    (float)2.26907e-05,
-    (float)2.0631e-05,
-    (float)1.88054e-05,
-    (float)1.82109e-05,
-    (float)2.19977e-05,
-    (float)1.79306e-05,
-    (float)2.12537e-05,
-    (float)1.7957e-05,
-    (float)1.76661e-05,
-    (float)1.68092e-05,
-    (float)2.00725e-05,
-    (float)1.56735e-05,
-    (float)1.60495e-05,
-    (float)1.69133e-05,
-    (float)1.59424e-05,
-    (float)1.58509e-05,
-    (float)1.63041e-05,
-    (float)1.56439e-05,
-    (float)1.38079e-05,
-    (float)1.71382e-05,
-    (float)1.49482e-05,
-    (float)1.57569e-05,
-    (float)1.49805e-05,
-    (float)1.59759e-05,
-    (float)1.41669e-05,
-    (float)1.69541e-05,
-    (float)1.49314e-05,
-    (float)1.37071e-05,
-    (float)1.41298e-05,
-    (float)1.49909e-05,
-    (float)1.39677e-05,
-    (float)1.31416e-05,
-    (float)1.30795e-05,
-    (float)1.11735e-05,
-    (float)1.28322e-05,
-    (float)1.19784e-05,
-    (float)1.17453e-05,
-    (float)1.01709e-05,
-    (float)1.13737e-05,
-    (float)9.96623e-06,
-    (float)1.12458e-05,
-    (float)1.10881e-05,
-    (float)1.04205e-05,
-    (float)1.00464e-05,
-    (float)1.08008e-05,
-    (float)1.14846e-05,
-    (float)1.09486e-05,
-    (float)1.14173e-05,
-    (float)9.96009e-06,
-    (float)1.17109e-05,
-    (float)1.15951e-05,
-    (float)0.357495,
-    (float)0.592985,
-    (float)0.00862458,
-    (float)0.00898229,
-    (float)0.00197675,
-    (float)0.00607397,
-    (float)0.00372904,
-    (float)0.000105211,
-    (float)0.00322115,
-    (float)0.00276484,
-    (float)0.00123255,
-    (float)0.000954835,
-    (float)0.00229698,
-    (float)0.00134507,
-    (float)0.000849963,
-    (float)0.000986412,
-    (float)0.000748112,
-    (float)0.000644538,
-    (float)0.000567092,
-    (float)0.000478007,
-    (float)0.000164753,
-    (float)0.000335787,
-    (float)0.000194887,
-    (float)0.000184331,
-    (float)0.000115589,
-    (float)0.000151447,
-    (float)5.87971e-05,
-    (float)0.000128777,
-    (float)0.000113719,
-    (float)9.00675e-05,
-    (float)0.000103964,
-    (float)9.84505e-05,
-    (float)9.92338e-05,
-    (float)9.65208e-05,
-    (float)0.000112114,
-    (float)5.74919e-05,
-    (float)8.87296e-05,
-    (float)7.36167e-05,
-    (float)7.30234e-05,
-    (float)4.23268e-05,
-    (float)5.64176e-05,
-    (float)3.26527e-05,
-    (float)4.44101e-05,
-    (float)3.54363e-05,
-    (float)2.66182e-05,
-    (float)2.4506e-05,
-    (float)2.80411e-05,
-    (float)2.78878e-05,
-    (float)2.40102e-05,
-    (float)3.24232e-05,
-    (float)1.86012e-05,
-    (float)2.82382e-05,
-    (float)2.70226e-05,
-    (float)3.22952e-05,
-    (float)2.17235e-05,
-    (float)2.63897e-05,
-    (float)1.87917e-05,
-    (float)2.57042e-05,
-    (float)2.55738e-05,
-    (float)1.89585e-05,
-    (float)1.59041e-05,
-    (float)1.82897e-05,
-    (float)1.9789e-05,
-    (float)1.59036e-05,
-    (float)2.0557e-05,
-    (float)1.30426e-05,
-    (float)1.75649e-05,
-    (float)1.77727e-05,
-    (float)2.04652e-05,
-    (float)1.50981e-05,
-    (float)2.1031e-05,
-    (float)1.72016e-05,
-    (float)1.80922e-05,
-    (float)2.01181e-05,
-    (float)1.93117e-05,
-    (float)1.70045e-05,
-    (float)1.75388e-05,
-    (float)1.93414e-05,
-    (float)1.55076e-05,
-    (float)1.96196e-05,
-    (float)1.47257e-05,
-    (float)1.56667e-05,
-    (float)1.54434e-05,
-    (float)1.97838e-05,
-    (float)1.36723e-05,
-    (float)1.6303e-05,
-    (float)1.48045e-05,
-    (float)1.56509e-05,
-    (float)1.65783e-05,
-    (float)1.72708e-05,
-    (float)1.46186e-05,
-    (float)1.44892e-05,
-    (float)1.72728e-05,
-    (float)1.41184e-05,
-    (float)1.63104e-05,
-    (float)1.42961e-05,
-    (float)1.46796e-05,
-    (float)1.25372e-05,
-    (float)1.6801e-05,
-    (float)1.24895e-05,
-    (float)1.37106e-05,
-    (float)1.29659e-05,
-    (float)1.33095e-05,
-    (float)1.21867e-05,
-    (float)1.38111e-05,
-    (float)1.19897e-05,
-    (float)1.09571e-05,
-    (float)1.33698e-05,
-    (float)1.14838e-05,
-    (float)1.19977e-05,
-    (float)1.10059e-05,
-    (float)1.23894e-05,
-    (float)9.73915e-06,
-    (float)1.25842e-05,
-    (float)9.97103e-06,
-    (float)1.09602e-05,
-    (float)1.04622e-05,
-    (float)1.11625e-05,
-    (float)9.29373e-06,
-    (float)1.05663e-05,
-    (float)1.04691e-05,
-    (float)9.39484e-06,
-    (float)1.07119e-05,
-    (float)9.40622e-06,
-    (float)1.00642e-05,
-    (float)9.39602e-06,
-    (float)1.10181e-05,
-    (float)8.37529e-06,
-    (float)0.433746,
-    (float)0.519416,
-    (float)0.00819992,
-    (float)0.00956031,
-    (float)0.00221698,
-    (float)0.00560542,
-    (float)0.00332346,
-    (float)4.53024e-05,
-    (float)0.00320366,
-    (float)0.00247997,
-    (float)0.00111372,
-    (float)0.000964037,
-    (float)0.00198121,
-    (float)0.00108231,
-    (float)0.000825694,
-    (float)0.000873416,
-    (float)0.000523715,
-    (float)0.000532758,
-    (float)0.000476031,
-    (float)0.000356704,
-    (float)0.000125719,
-    (float)0.000276539,
-    (float)0.000117992,
-    (float)0.000154945,
-    (float)0.000121564,
-    (float)0.000119158,
-    (float)6.40597e-05,
-    (float)0.000123614,
-    (float)0.000102474,
-    (float)9.84081e-05,
-    (float)0.00012044,
-    (float)8.00028e-05,
-    (float)9.27261e-05,
-    (float)9.76215e-05,
-    (float)9.7995e-05,
-    (float)5.10157e-05,
-    (float)8.0162e-05,
-    (float)5.41066e-05,
-    (float)5.81902e-05,
-    (float)4.13427e-05,
-    (float)4.07064e-05,
-    (float)2.58433e-05,
-    (float)3.92788e-05,
-    (float)2.88325e-05,
-    (float)2.24195e-05,
-    (float)2.97069e-05,
-    (float)2.39849e-05,
-    (float)2.70353e-05,
-    (float)2.61851e-05,
-    (float)3.01328e-05,
-    (float)2.04579e-05,
-    (float)3.01696e-05,
-    (float)2.21459e-05,
-    (float)2.67817e-05,
-    (float)2.42751e-05,
-    (float)2.17654e-05,
-    (float)1.57467e-05,
-    (float)2.19811e-05,
-    (float)2.05505e-05,
-    (float)1.61876e-05,
-    (float)1.77989e-05,
-    (float)1.33183e-05,
-    (float)1.58736e-05,
-    (float)1.76223e-05,
-    (float)1.88695e-05,
-    (float)1.21303e-05,
-    (float)1.74014e-05,
-    (float)1.52746e-05,
-    (float)1.77115e-05,
-    (float)1.80598e-05,
-    (float)1.74788e-05,
-    (float)1.41552e-05,
-    (float)1.70839e-05,
-    (float)1.74527e-05,
-    (float)1.55097e-05,
-    (float)1.81737e-05,
-    (float)1.45358e-05,
-    (float)1.43027e-05,
-    (float)1.5249e-05,
-    (float)1.75184e-05,
-    (float)1.2754e-05,
-    (float)1.55483e-05,
-    (float)1.34753e-05,
-    (float)1.43251e-05,
-    (float)1.50305e-05,
-    (float)1.50194e-05,
-    (float)1.17836e-05,
-    (float)1.40578e-05,
-    (float)1.52513e-05,
-    (float)1.31546e-05,
-    (float)1.47962e-05,
-    (float)1.3539e-05,
-    (float)1.28232e-05,
-    (float)1.31237e-05,
-    (float)1.56549e-05,
-    (float)1.22078e-05,
-    (float)1.37808e-05,
-    (float)1.24804e-05,
-    (float)1.25547e-05,
-    (float)1.27503e-05,
-    (float)1.38893e-05,
-    (float)1.04557e-05,
-    (float)1.07108e-05,
-    (float)1.19771e-05,
-    (float)1.1124e-05,
-    (float)1.13059e-05,
-    (float)1.03563e-05,
-    (float)9.46817e-06,
-    (float)9.82525e-06,
-    (float)1.20349e-05,
-    (float)9.44462e-06,
-    (float)1.01704e-05,
-    (float)9.91331e-06,
-    (float)1.00643e-05,
-    (float)9.8065e-06,
-    (float)1.139e-05,
-    (float)9.31172e-06,
-    (float)9.43944e-06,
-    (float)1.00344e-05,
-    (float)9.50035e-06,
-    (float)9.64345e-06,
-    (float)9.68488e-06,
-    (float)8.50084e-06,
-    (float)8.02942e-06,
-    (float)9.96e-06,
-    (float)8.39488e-06,
-    (float)8.5413e-06,
-    (float)8.13832e-06,
-    (float)0.51251,
-    (float)0.444234,
-    (float)0.00753199,
-    (float)0.00977636,
-    (float)0.00242271,
-    (float)0.00503382,
-    (float)0.00286316,
-    (float)1.38349e-05,
-    (float)0.00308495,
-    (float)0.00213336,
-    (float)0.00101325,
-    (float)0.000944905,
-    (float)0.00162149,
-    (float)0.000855064,
-    (float)0.000786317,
-    (float)0.000730141,
-    (float)0.000342513,
-    (float)0.000442135,
-    (float)0.000365888,
-    (float)0.00026129,
-    (float)0.000110506,
-    (float)0.000213864,
-    (float)6.46185e-05,
-    (float)0.000142762,
-    (float)0.000113534,
-    (float)9.93713e-05,
-    (float)8.29482e-05,
-    (float)0.00010901,
-    (float)9.05296e-05,
-    (float)0.00010781,
-    (float)0.000121039,
-    (float)6.42037e-05,
-    (float)8.92712e-05,
-    (float)8.1681e-05,
-    (float)7.95305e-05,
-    (float)4.97574e-05,
-    (float)6.45745e-05,
-    (float)3.34389e-05,
-    (float)4.70031e-05,
-    (float)3.45766e-05,
-    (float)2.94881e-05,
-    (float)2.62292e-05,
-    (float)2.97483e-05,
-    (float)2.32464e-05,
-    (float)2.47881e-05,
-    (float)3.22661e-05,
-    (float)2.17158e-05,
-    (float)2.91911e-05,
-    (float)2.29243e-05,
-    (float)2.74348e-05,
-    (float)2.50532e-05,
-    (float)2.76433e-05,
-    (float)1.63268e-05,
-    (float)2.23607e-05,
-    (float)2.03675e-05,
-    (float)1.75187e-05,
-    (float)1.64264e-05,
-    (float)1.46938e-05,
-    (float)1.41458e-05,
-    (float)1.53357e-05,
-    (float)1.68315e-05,
-    (float)1.10227e-05,
-    (float)1.60277e-05,
-    (float)1.45999e-05,
-    (float)1.64868e-05,
-    (float)1.53073e-05,
-    (float)1.62407e-05,
-    (float)1.35966e-05,
-    (float)1.70138e-05,
-    (float)1.5731e-05,
-    (float)1.41224e-05,
-    (float)1.57293e-05,
-    (float)1.33737e-05,
-    (float)1.26829e-05,
-    (float)1.34244e-05,
-    (float)1.51629e-05,
-    (float)1.14366e-05,
-    (float)1.33694e-05,
-    (float)1.10648e-05,
-    (float)1.24977e-05,
-    (float)1.39725e-05,
-    (float)1.42493e-05,
-    (float)1.12735e-05,
-    (float)1.26733e-05,
-    (float)1.31076e-05,
-    (float)1.2598e-05,
-    (float)1.45554e-05,
-    (float)1.27454e-05,
-    (float)1.17083e-05,
-    (float)1.19165e-05,
-    (float)1.34473e-05,
-    (float)1.12667e-05,
-    (float)1.25672e-05,
-    (float)1.06946e-05,
-    (float)1.04938e-05,
-    (float)1.13156e-05,
-    (float)1.19521e-05,
-    (float)1.0245e-05,
-    (float)1.04614e-05,
-    (float)1.01965e-05,
-    (float)9.67385e-06,
-    (float)1.14312e-05,
-    (float)1.03976e-05,
-    (float)9.50225e-06,
-    (float)9.69674e-06,
-    (float)1.05566e-05,
-    (float)9.38538e-06,
-    (float)1.04103e-05,
-    (float)9.44528e-06,
-    (float)8.75922e-06,
-    (float)9.14833e-06,
-    (float)9.38476e-06,
-    (float)8.67137e-06,
-    (float)8.92765e-06,
-    (float)8.61447e-06,
-    (float)7.67442e-06,
-    (float)8.57886e-06,
-    (float)8.52708e-06,
-    (float)8.07159e-06,
-    (float)8.07382e-06,
-    (float)8.03996e-06,
-    (float)7.57112e-06,
-    (float)8.51493e-06,
-    (float)8.34297e-06,
-    (float)7.4972e-06,
-    (float)8.05246e-06,
-    (float)8.23085e-06,
-    (float)7.88232e-06,
-    (float)0.590533,
-    (float)0.370509,
-    (float)0.00669991,
-    (float)0.00961871,
-    (float)0.00257459,
-    (float)0.00439012,
-    (float)0.00238012,
-    (float)9.00311e-06,
-    (float)0.00287521,
-    (float)0.0017592,
-    (float)0.00091528,
-    (float)0.00088011,
-    (float)0.00125678,
-    (float)0.000668134,
-    (float)0.000716696,
-    (float)0.000570658,
-    (float)0.000211332,
-    (float)0.000365032,
-    (float)0.000255478,
-    (float)0.000197601,
-    (float)0.000104327,
-    (float)0.00015787,
-    (float)4.17215e-05,
-    (float)0.000136578,
-    (float)9.73293e-05,
-    (float)9.35847e-05,
-    (float)9.77552e-05,
-    (float)8.60691e-05,
-    (float)8.26069e-05,
-    (float)0.000107344,
-    (float)0.000105496,
-    (float)5.15921e-05,
-    (float)7.87396e-05,
-    (float)5.64441e-05,
-    (float)6.53065e-05,
-    (float)4.53477e-05,
-    (float)4.4926e-05,
-    (float)2.20242e-05,
-    (float)3.91997e-05,
-    (float)2.75815e-05,
-    (float)2.66004e-05,
-    (float)2.7517e-05,
-    (float)2.14549e-05,
-    (float)2.47333e-05,
-    (float)2.60099e-05,
-    (float)2.98219e-05,
-    (float)2.12548e-05,
-    (float)2.77026e-05,
-    (float)1.66609e-05,
-    (float)2.5129e-05,
-    (float)2.27559e-05,
-    (float)2.05117e-05,
-    (float)1.36445e-05,
-    (float)1.65148e-05,
-    (float)1.47943e-05,
-    (float)1.618e-05,
-    (float)1.59689e-05,
-    (float)9.78387e-06,
-    (float)1.35407e-05,
-    (float)1.35583e-05,
-    (float)1.5969e-05,
-    (float)1.27346e-05,
-    (float)1.45735e-05,
-    (float)1.09377e-05,
-    (float)1.58323e-05,
-    (float)1.39913e-05,
-    (float)1.29393e-05,
-    (float)1.29489e-05,
-    (float)1.24672e-05,
-    (float)1.18938e-05,
-    (float)1.23482e-05,
-    (float)1.31725e-05,
-    (float)9.68002e-06,
-    (float)1.26072e-05,
-    (float)1.05487e-05,
-    (float)1.21558e-05,
-    (float)1.13628e-05,
-    (float)1.19088e-05,
-    (float)9.5381e-06,
-    (float)1.19799e-05,
-    (float)1.17819e-05,
-    (float)1.1221e-05,
-    (float)1.14054e-05,
-    (float)9.74361e-06,
-    (float)1.07815e-05,
-    (float)1.11694e-05,
-    (float)1.17568e-05,
-    (float)9.30593e-06,
-    (float)1.13736e-05,
-    (float)9.5436e-06,
-    (float)1.06176e-05,
-    (float)1.01942e-05,
-    (float)1.04306e-05,
-    (float)9.37999e-06,
-    (float)1.00348e-05,
-    (float)9.43514e-06,
-    (float)9.08929e-06,
-    (float)1.01121e-05,
-    (float)8.33942e-06,
-    (float)8.67001e-06,
-    (float)8.39052e-06,
-    (float)9.45031e-06,
-    (float)8.10884e-06,
-    (float)9.11071e-06,
-    (float)7.68186e-06,
-    (float)8.70365e-06,
-    (float)8.84583e-06,
-    (float)8.32446e-06,
-    (float)7.99724e-06,
-    (float)8.24383e-06,
-    (float)8.19176e-06,
-    (float)7.51391e-06,
-    (float)8.2227e-06,
-    (float)6.91047e-06,
-    (float)7.76648e-06,
-    (float)7.05481e-06,
-    (float)7.19417e-06,
-    (float)6.41854e-06,
-    (float)7.46172e-06,
-    (float)6.69016e-06,
-    (float)6.68881e-06,
-    (float)6.96412e-06,
-    (float)6.77224e-06,
-    (float)7.2598e-06,
-    (float)6.89075e-06,
-    (float)7.21216e-06,
-    (float)6.65435e-06,
-    (float)7.84111e-06,
-    (float)0.664486,
-    (float)0.3013,
-    (float)0.00575441,
-    (float)0.00911067,
-    (float)0.00264661,
-    (float)0.00371957,
-    (float)0.00190596,
-    (float)2.38493e-05,
-    (float)0.00259018,
-    (float)0.00139594,
-    (float)0.000827316,
-    (float)0.000785783,
-    (float)0.00092426,
-    (float)0.00052634,
-    (float)0.000627882,
-    (float)0.000421766,
-    (float)0.000127684,
-    (float)0.000292184,
-    (float)0.000161934,
-    (float)0.000160999,
-    (float)9.47687e-05,
-    (float)0.000109199,
-    (float)3.94556e-05,
-    (float)0.000123948,
-    (float)7.86192e-05,
-    (float)9.42361e-05,
-    (float)9.96345e-05,
-    (float)6.35768e-05,
-    (float)7.91914e-05,
-    (float)9.44722e-05,
-    (float)8.49461e-05,
-    (float)4.52969e-05,
-    (float)6.34275e-05,
-    (float)3.46067e-05,
-    (float)5.55776e-05,
-    (float)3.61098e-05,
-    (float)2.98557e-05,
-    (float)1.88195e-05,
-    (float)2.96272e-05,
-    (float)2.25911e-05,
-    (float)2.64034e-05,
-    (float)2.47899e-05,
-    (float)1.65201e-05,
-    (float)2.72437e-05,
-    (float)2.22995e-05,
-    (float)2.66212e-05,
-    (float)2.04029e-05,
-    (float)2.27148e-05,
-    (float)1.34629e-05,
-    (float)2.22747e-05,
-    (float)1.65294e-05,
-    (float)1.64082e-05,
-    (float)1.29631e-05,
-    (float)1.06815e-05,
-    (float)1.18173e-05,
-    (float)1.3818e-05,
-    (float)1.36538e-05,
-    (float)9.17229e-06,
-    (float)1.23062e-05,
-    (float)9.37054e-06,
-    (float)1.56553e-05,
-    (float)1.25832e-05,
-    (float)1.21562e-05,
-    (float)1.01046e-05,
-    (float)1.28944e-05,
-    (float)1.09352e-05,
-    (float)1.22023e-05,
-    (float)1.15616e-05,
-    (float)8.87534e-06,
-    (float)1.05645e-05,
-    (float)8.78603e-06,
-    (float)1.02976e-05,
-    (float)9.4103e-06,
-    (float)1.08032e-05,
-    (float)7.2528e-06,
-    (float)9.91339e-06,
-    (float)8.713e-06,
-    (float)1.06696e-05,
-    (float)1.03551e-05,
-    (float)9.11437e-06,
-    (float)8.81488e-06,
-    (float)9.82489e-06,
-    (float)1.03454e-05,
-    (float)9.00422e-06,
-    (float)1.04986e-05,
-    (float)7.49447e-06,
-    (float)9.35535e-06,
-    (float)8.6518e-06,
-    (float)9.47082e-06,
-    (float)7.50396e-06,
-    (float)8.41841e-06,
-    (float)6.83327e-06,
-    (float)8.38583e-06,
-    (float)8.90494e-06,
-    (float)7.61602e-06,
-    (float)7.67973e-06,
-    (float)7.04411e-06,
-    (float)8.18392e-06,
-    (float)7.97289e-06,
-    (float)9.12654e-06,
-    (float)6.44246e-06,
-    (float)8.03382e-06,
-    (float)7.16696e-06,
-    (float)8.138e-06,
-    (float)7.20217e-06,
-    (float)7.18611e-06,
-    (float)6.04175e-06,
-    (float)6.59114e-06,
-    (float)6.84325e-06,
-    (float)6.05114e-06,
-    (float)6.84235e-06,
-    (float)5.56663e-06,
-    (float)6.35484e-06,
-    (float)5.75036e-06,
-    (float)7.10382e-06,
-    (float)5.87418e-06,
-    (float)6.81108e-06,
-    (float)5.66277e-06,
-    (float)6.52586e-06,
-    (float)6.39129e-06,
-    (float)6.37704e-06,
-    (float)5.99055e-06,
-    (float)5.62858e-06,
-    (float)6.07986e-06,
-    (float)5.35944e-06,
-    (float)6.24433e-06,
-    (float)4.99066e-06,
-    (float)5.829e-06,
-    (float)0.732245,
-    (float)0.238556,
-    (float)0.00477699,
-    (float)0.00830703,
-    (float)0.00261701,
-    (float)0.00305049,
-    (float)0.00147357,
-    (float)4.94257e-05,
-    (float)0.00223825,
-    (float)0.00106275,
-    (float)0.000739237,
-    (float)0.000666407,
-    (float)0.000636627,
-    (float)0.000413604,
-    (float)0.000516354,
-    (float)0.000294471,
-    (float)8.29634e-05,
-    (float)0.000222428,
-    (float)9.02474e-05,
-    (float)0.00013777,
-    (float)8.17132e-05,
-    (float)7.77034e-05,
-    (float)4.9845e-05,
-    (float)0.000102394,
-    (float)6.35463e-05,
-    (float)9.38922e-05,
-    (float)8.89803e-05,
-    (float)4.73688e-05,
-    (float)7.27765e-05,
-    (float)7.0639e-05,
-    (float)6.39695e-05,
-    (float)3.97315e-05,
-    (float)4.3672e-05,
-    (float)2.14058e-05,
-    (float)4.44336e-05,
-    (float)2.48062e-05,
-    (float)2.2073e-05,
-    (float)1.9697e-05,
-    (float)2.13684e-05,
-    (float)2.23377e-05,
-    (float)2.44002e-05,
-    (float)2.08356e-05,
-    (float)1.71588e-05,
-    (float)2.62407e-05,
-    (float)1.65336e-05,
-    (float)2.17867e-05,
-    (float)1.63328e-05,
-    (float)1.67904e-05,
-    (float)1.26913e-05,
-    (float)1.47595e-05,
-    (float)1.02319e-05,
-    (float)1.32611e-05,
-    (float)1.14495e-05,
-    (float)8.40911e-06,
-    (float)1.117e-05,
-    (float)1.00347e-05,
-    (float)1.25096e-05,
-    (float)1.06398e-05,
-    (float)1.06962e-05,
-    (float)8.57634e-06,
-    (float)1.2905e-05,
-    (float)9.38344e-06,
-    (float)1.02906e-05,
-    (float)9.11868e-06,
-    (float)8.21526e-06,
-    (float)8.68959e-06,
-    (float)8.72478e-06,
-    (float)8.36106e-06,
-    (float)7.93462e-06,
-    (float)8.69528e-06,
-    (float)6.46219e-06,
-    (float)9.28172e-06,
-    (float)8.13351e-06,
-    (float)8.99622e-06,
-    (float)8.04246e-06,
-    (float)7.63178e-06,
-    (float)7.0445e-06,
-    (float)9.15557e-06,
-    (float)8.21813e-06,
-    (float)7.11194e-06,
-    (float)7.61973e-06,
-    (float)6.38194e-06,
-    (float)7.80282e-06,
-    (float)7.61474e-06,
-    (float)7.46957e-06,
-    (float)6.60469e-06,
-    (float)7.8477e-06,
-    (float)6.28861e-06,
-    (float)7.5036e-06,
-    (float)7.19879e-06,
-    (float)6.77545e-06,
-    (float)6.84275e-06,
-    (float)6.59347e-06,
-    (float)6.2913e-06,
-    (float)6.65997e-06,
-    (float)6.80897e-06,
-    (float)5.45224e-06,
-    (float)6.4633e-06,
-    (float)5.90177e-06,
-    (float)6.60204e-06,
-    (float)6.27407e-06,
-    (float)6.14355e-06,
-    (float)5.53123e-06,
-    (float)6.4585e-06,
-    (float)5.74861e-06,
-    (float)5.66482e-06,
-    (float)5.83568e-06,
-    (float)5.27712e-06,
-    (float)5.5462e-06,
-    (float)5.19906e-06,
-    (float)5.12866e-06,
-    (float)5.02948e-06,
-    (float)5.59082e-06,
-    (float)4.60541e-06,
-    (float)5.20183e-06,
-    (float)4.88153e-06,
-    (float)5.31461e-06,
-    (float)5.21333e-06,
-    (float)5.06786e-06,
-    (float)4.80833e-06,
-    (float)5.16879e-06,
-    (float)5.13943e-06,
-    (float)4.75071e-06,
-    (float)4.87947e-06,
-    (float)4.4555e-06,
-    (float)4.95829e-06,
-    (float)4.46122e-06,
-    (float)4.62317e-06,
-    (float)0.791746,
-    (float)0.183986,
-    (float)0.00383642,
-    (float)0.00729952,
-    (float)0.00250171,
-    (float)0.00242249,
-    (float)0.00110301,
-    (float)7.6702e-05,
-    (float)0.00186031,
-    (float)0.000779094,
-    (float)0.00065344,
-    (float)0.000538698,
-    (float)0.000412397,
-    (float)0.000326669,
-    (float)0.000400841,
-    (float)0.000200927,
-    (float)6.07878e-05,
-    (float)0.00015907,
-    (float)4.58411e-05,
-    (float)0.000122939,
-    (float)6.34316e-05,
-    (float)5.96275e-05,
-    (float)5.77658e-05,
-    (float)7.70553e-05,
-    (float)5.42569e-05,
-    (float)8.59328e-05,
-    (float)7.01771e-05,
-    (float)3.81999e-05,
-    (float)6.27598e-05,
-    (float)4.55034e-05,
-    (float)4.92905e-05,
-    (float)3.20084e-05,
-    (float)2.87275e-05,
-    (float)1.67462e-05,
-    (float)3.28004e-05,
-    (float)1.60746e-05,
-    (float)2.03923e-05,
-    (float)1.87269e-05,
-    (float)1.56933e-05,
-    (float)2.18508e-05,
-    (float)1.83741e-05,
-    (float)1.79815e-05,
-    (float)1.71109e-05,
-    (float)2.06161e-05,
-    (float)1.21443e-05,
-    (float)1.72449e-05,
-    (float)1.07943e-05,
-    (float)1.36964e-05,
-    (float)1.16677e-05,
-    (float)9.08361e-06,
-    (float)8.13838e-06,
-    (float)1.01064e-05,
-    (float)9.72654e-06,
-    (float)8.7079e-06,
-    (float)9.35822e-06,
-    (float)6.5181e-06,
-    (float)1.11295e-05,
-    (float)8.86178e-06,
-    (float)9.18256e-06,
-    (float)7.89331e-06,
-    (float)8.32327e-06,
-    (float)7.42516e-06,
-    (float)8.9778e-06,
-    (float)7.01583e-06,
-    (float)6.29098e-06,
-    (float)7.48464e-06,
-    (float)5.89328e-06,
-    (float)7.48341e-06,
-    (float)6.3119e-06,
-    (float)6.4106e-06,
-    (float)6.24909e-06,
-    (float)7.10103e-06,
-    (float)5.69502e-06,
-    (float)7.4057e-06,
-    (float)6.40465e-06,
-    (float)5.87534e-06,
-    (float)6.88373e-06,
-    (float)6.23231e-06,
-    (float)6.4577e-06,
-    (float)6.25661e-06,
-    (float)6.00281e-06,
-    (float)5.47056e-06,
-    (float)6.63838e-06,
-    (float)5.10506e-06,
-    (float)6.01189e-06,
-    (float)5.66405e-06,
-    (float)5.19671e-06,
-    (float)5.42087e-06,
-    (float)5.34553e-06,
-    (float)5.09754e-06,
-    (float)5.82662e-06,
-    (float)5.85527e-06,
-    (float)4.76729e-06,
-    (float)5.59542e-06,
-    (float)4.98889e-06,
-    (float)5.64449e-06,
-    (float)5.61008e-06,
-    (float)4.9704e-06,
-    (float)4.57195e-06,
-    (float)5.20967e-06,
-    (float)4.63601e-06,
-    (float)4.69197e-06,
-    (float)4.6541e-06,
-    (float)3.89269e-06,
-    (float)4.51782e-06,
-    (float)4.42022e-06,
-    (float)4.39982e-06,
-    (float)4.56101e-06,
-    (float)4.54305e-06,
-    (float)4.09964e-06,
-    (float)4.76356e-06,
-    (float)4.42035e-06,
-    (float)4.31282e-06,
-    (float)4.49291e-06,
-    (float)3.90521e-06,
-    (float)4.03546e-06,
-    (float)4.10619e-06,
-    (float)3.73522e-06,
-    (float)3.75927e-06,
-    (float)3.84408e-06,
-    (float)3.47172e-06,
-    (float)3.90823e-06,
-    (float)3.8281e-06,
-    (float)3.70274e-06,
-    (float)4.10769e-06,
-    (float)3.94696e-06,
-    (float)3.9387e-06,
-    (float)4.15941e-06,
-    (float)0.8423,
-    (float)0.138071,
-    (float)0.00298496,
-    (float)0.00618689,
-    (float)0.00230559,
-    (float)0.00185955,
-    (float)0.000801595,
-    (float)9.91275e-05,
-    (float)0.00148815,
-    (float)0.000552376,
-    (float)0.000566238,
-    (float)0.000411361,
-    (float)0.000249647,
-    (float)0.000256468,
-    (float)0.000291657,
-    (float)0.000137655,
-    (float)4.88785e-05,
-    (float)0.00010586,
-    (float)2.34187e-05,
-    (float)0.000107543,
-    (float)4.47481e-05,
-    (float)5.27234e-05,
-    (float)5.93473e-05,
-    (float)5.41577e-05,
-    (float)4.80445e-05,
-    (float)7.00586e-05,
-    (float)5.21186e-05,
-    (float)3.37908e-05,
-    (float)4.78775e-05,
-    (float)2.5028e-05,
-    (float)3.81032e-05,
-    (float)2.21502e-05,
-    (float)2.03408e-05,
-    (float)1.511e-05,
-    (float)2.0851e-05,
-    (float)1.22281e-05,
-    (float)1.96006e-05,
-    (float)1.62838e-05,
-    (float)1.38051e-05,
-    (float)1.94639e-05,
-    (float)1.2025e-05,
-    (float)1.67095e-05,
-    (float)1.40807e-05,
-    (float)1.47344e-05,
-    (float)9.65327e-06,
-    (float)1.12612e-05,
-    (float)6.61197e-06,
-    (float)1.16481e-05,
-    (float)8.85683e-06,
-    (float)6.18063e-06,
-    (float)7.20248e-06,
-    (float)6.49539e-06,
-    (float)9.58113e-06,
-    (float)8.456e-06,
-    (float)7.365e-06,
-    (float)5.51125e-06,
-    (float)8.82676e-06,
-    (float)6.41116e-06,
-    (float)8.39738e-06,
-    (float)5.84878e-06,
-    (float)5.05574e-06,
-    (float)6.1261e-06,
-    (float)5.68931e-06,
-    (float)5.62074e-06,
-    (float)5.42697e-06,
-    (float)5.54717e-06,
-    (float)4.58273e-06,
-    (float)6.19621e-06,
-    (float)4.23592e-06,
-    (float)6.37912e-06,
-    (float)5.82988e-06,
-    (float)5.00276e-06,
-    (float)4.77158e-06,
-    (float)4.95438e-06,
-    (float)4.98697e-06,
-    (float)5.57765e-06,
-    (float)5.06901e-06,
-    (float)3.68588e-06,
-    (float)5.10097e-06,
-    (float)4.03379e-06,
-    (float)5.29031e-06,
-    (float)4.76575e-06,
-    (float)4.28938e-06,
-    (float)4.20629e-06,
-    (float)4.87979e-06,
-    (float)4.20424e-06,
-    (float)4.72785e-06,
-    (float)4.59179e-06,
-    (float)3.5697e-06,
-    (float)4.68187e-06,
-    (float)3.9255e-06,
-    (float)4.44808e-06,
-    (float)4.25381e-06,
-    (float)3.89839e-06,
-    (float)3.40509e-06,
-    (float)4.47022e-06,
-    (float)3.81644e-06,
-    (float)4.15756e-06,
-    (float)4.05542e-06,
-    (float)3.20196e-06,
-    (float)3.93633e-06,
-    (float)3.58888e-06,
-    (float)3.66076e-06,
-    (float)3.67101e-06,
-    (float)3.76699e-06,
-    (float)3.00615e-06,
-    (float)3.82797e-06,
-    (float)3.153e-06,
-    (float)3.52806e-06,
-    (float)3.74614e-06,
-    (float)2.9989e-06,
-    (float)3.22698e-06,
-    (float)3.25001e-06,
-    (float)3.33518e-06,
-    (float)3.3498e-06,
-    (float)3.37886e-06,
-    (float)2.49961e-06,
-    (float)3.47081e-06,
-    (float)3.05198e-06,
-    (float)3.11689e-06,
-    (float)3.11576e-06,
-    (float)2.76524e-06,
-    (float)3.02565e-06,
-    (float)3.22092e-06,
-    (float)2.96816e-06,
-    (float)2.87207e-06,
-    (float)3.35472e-06,
-    (float)2.62448e-06,
-    (float)0.883947,
-    (float)0.100648,
-    (float)0.00224707,
-    (float)0.00504625,
-    (float)0.00204238,
-    (float)0.00137388,
-    (float)0.000570319,
-    (float)0.000112302,
-    (float)0.00113544,
-    (float)0.000378027,
-    (float)0.000478028,
-    (float)0.000298634,
-    (float)0.000141958,
-    (float)0.000196516,
-    (float)0.000196113,
-    (float)9.84347e-05,
-    (float)4.03069e-05,
-    (float)6.63042e-05,
-    (float)1.6721e-05,
-    (float)8.7318e-05,
-    (float)2.92347e-05,
-    (float)4.96481e-05,
-    (float)5.29256e-05,
-    (float)3.73661e-05,
-    (float)4.16785e-05,
-    (float)4.90787e-05,
-    (float)3.86247e-05,
-    (float)2.97822e-05,
-    (float)3.218e-05,
-    (float)1.31802e-05,
-    (float)2.81536e-05,
-    (float)1.36275e-05,
-    (float)1.75121e-05,
-    (float)1.28608e-05,
-    (float)1.20641e-05,
-    (float)1.17125e-05,
-    (float)1.61649e-05,
-    (float)1.38449e-05,
-    (float)1.25015e-05,
-    (float)1.4134e-05,
-    (float)8.13933e-06,
-    (float)1.44686e-05,
-    (float)9.03674e-06,
-    (float)1.0795e-05,
-    (float)7.3566e-06,
-    (float)6.6808e-06,
-    (float)5.54507e-06,
-    (float)8.59249e-06,
-    (float)6.47422e-06,
-    (float)5.88047e-06,
-    (float)6.01022e-06,
-    (float)4.519e-06,
-    (float)8.36487e-06,
-    (float)5.81626e-06,
-    (float)6.47654e-06,
-    (float)4.80688e-06,
-    (float)5.39473e-06,
-    (float)4.70435e-06,
-    (float)6.27997e-06,
-    (float)4.26838e-06,
-    (float)4.31653e-06,
-    (float)4.34648e-06,
-    (float)3.55125e-06,
-    (float)5.27721e-06,
-    (float)3.89377e-06,
-    (float)4.68518e-06,
-    (float)3.9063e-06,
-    (float)4.08829e-06,
-    (float)3.46258e-06,
-    (float)5.04915e-06,
-    (float)3.85503e-06,
-    (float)4.07046e-06,
-    (float)3.57128e-06,
-    (float)3.14882e-06,
-    (float)4.49723e-06,
-    (float)3.74355e-06,
-    (float)3.84978e-06,
-    (float)3.29798e-06,
-    (float)3.66364e-06,
-    (float)3.11282e-06,
-    (float)4.24252e-06,
-    (float)3.01018e-06,
-    (float)3.58233e-06,
-    (float)3.36437e-06,
-    (float)3.01747e-06,
-    (float)3.46505e-06,
-    (float)3.13852e-06,
-    (float)3.44117e-06,
-    (float)3.40269e-06,
-    (float)3.4795e-06,
-    (float)2.63647e-06,
-    (float)3.694e-06,
-    (float)2.85127e-06,
-    (float)3.421e-06,
-    (float)2.94604e-06,
-    (float)2.73506e-06,
-    (float)2.93391e-06,
-    (float)2.93159e-06,
-    (float)2.71154e-06,
-    (float)2.6894e-06,
-    (float)2.90837e-06,
-    (float)2.40591e-06,
-    (float)3.30627e-06,
-    (float)2.46234e-06,
-    (float)2.99907e-06,
-    (float)2.79176e-06,
-    (float)2.78596e-06,
-    (float)2.5622e-06,
-    (float)2.6654e-06,
-    (float)2.33119e-06,
-    (float)2.56336e-06,
-    (float)2.60021e-06,
-    (float)1.98908e-06,
-    (float)2.64576e-06,
-    (float)2.07291e-06,
-    (float)2.58536e-06,
-    (float)2.37382e-06,
-    (float)2.47899e-06,
-    (float)2.28689e-06,
-    (float)2.65045e-06,
-    (float)2.23696e-06,
-    (float)2.5413e-06,
-    (float)2.50551e-06,
-    (float)2.04801e-06,
-    (float)2.51239e-06,
-    (float)1.99969e-06,
-    (float)2.3224e-06,
-    (float)2.11545e-06,
-    (float)0.917249,
-    (float)0.0710512,
-    (float)0.00163242,
-    (float)0.00395112,
-    (float)0.00173369,
-    (float)0.000978977,
-    (float)0.000395541,
-    (float)0.000114142,
-    (float)0.000825243,
-    (float)0.000253958,
-    (float)0.000390272,
-    (float)0.000203888,
-    (float)7.45736e-05,
-    (float)0.000144851,
-    (float)0.000123325,
-    (float)7.43519e-05,
-    (float)3.12348e-05,
-    (float)3.91027e-05,
-    (float)1.71682e-05,
-    (float)6.488e-05,
-    (float)1.9765e-05,
-    (float)4.52289e-05,
-    (float)4.22257e-05,
-    (float)2.64721e-05,
-    (float)3.32024e-05,
-    (float)2.99217e-05,
-    (float)2.97574e-05,
-    (float)2.38665e-05,
-    (float)1.91744e-05,
-    (float)7.88795e-06,
-    (float)1.85985e-05,
-    (float)8.85003e-06,
-    (float)1.56596e-05,
-    (float)9.69461e-06,
-    (float)7.60543e-06,
-    (float)1.09977e-05,
-    (float)1.14657e-05,
-    (float)1.21222e-05,
-    (float)9.89345e-06,
-    (float)9.09329e-06,
-    (float)6.60235e-06,
-    (float)1.03237e-05,
-    (float)5.35427e-06,
-    (float)7.88956e-06,
-    (float)5.08339e-06,
-    (float)4.72057e-06,
-    (float)4.9136e-06,
-    (float)4.98088e-06,
-    (float)5.34395e-06,
-    (float)5.21619e-06,
-    (float)4.89349e-06,
-    (float)3.87979e-06,
-    (float)5.59187e-06,
-    (float)3.94338e-06,
-    (float)5.69636e-06,
-    (float)3.58553e-06,
-    (float)3.4265e-06,
-    (float)3.48228e-06,
-    (float)3.74725e-06,
-    (float)3.73928e-06,
-    (float)3.26943e-06,
-    (float)2.95191e-06,
-    (float)2.92908e-06,
-    (float)3.75892e-06,
-    (float)2.79824e-06,
-    (float)3.84387e-06,
-    (float)2.78005e-06,
-    (float)3.17001e-06,
-    (float)3.05388e-06,
-    (float)3.02984e-06,
-    (float)2.98299e-06,
-    (float)2.93593e-06,
-    (float)2.68932e-06,
-    (float)2.67642e-06,
-    (float)2.90501e-06,
-    (float)2.31561e-06,
-    (float)3.06914e-06,
-    (float)2.38921e-06,
-    (float)2.74863e-06,
-    (float)2.50927e-06,
-    (float)2.5233e-06,
-    (float)2.59679e-06,
-    (float)2.73516e-06,
-    (float)2.47102e-06,
-    (float)2.53913e-06,
-    (float)2.43835e-06,
-    (float)2.06993e-06,
-    (float)2.77111e-06,
-    (float)2.38278e-06,
-    (float)2.51393e-06,
-    (float)2.04919e-06,
-    (float)2.01991e-06,
-    (float)2.21279e-06,
-    (float)2.55569e-06,
-    (float)2.1904e-06,
-    (float)2.21122e-06,
-    (float)2.05487e-06,
-    (float)1.94085e-06,
-    (float)2.41847e-06,
-    (float)2.0797e-06,
-    (float)2.20516e-06,
-    (float)1.99855e-06,
-    (float)2.00427e-06,
-    (float)1.94768e-06,
-    (float)2.09088e-06,
-    (float)1.76495e-06,
-    (float)2.02538e-06,
-    (float)1.85976e-06,
-    (float)1.68788e-06,
-    (float)1.93232e-06,
-    (float)1.84735e-06,
-    (float)2.03751e-06,
-    (float)1.88695e-06,
-    (float)1.73683e-06,
-    (float)1.70667e-06,
-    (float)1.98081e-06,
-    (float)1.69483e-06,
-    (float)1.89306e-06,
-    (float)1.60709e-06,
-    (float)1.56955e-06,
-    (float)1.764e-06,
-    (float)1.7061e-06,
-    (float)1.74258e-06,
-    (float)1.67765e-06,
-    (float)1.64798e-06,
-    (float)1.67907e-06,
-    (float)1.8669e-06,
-    (float)1.60281e-06,
-    (float)0.943091,
-    (float)0.0483407,
-    (float)0.0011452,
-    (float)0.00295701,
-    (float)0.00140562,
-    (float)0.000667676,
-    (float)0.000272077,
-    (float)0.000106229,
-    (float)0.00056751,
-    (float)0.000166484,
-    (float)0.00030599,
-    (float)0.000131765,
-    (float)3.70317e-05,
-    (float)0.000101406,
-    (float)7.10839e-05,
-    (float)5.78038e-05,
-    (float)2.17382e-05,
-    (float)2.41825e-05,
-    (float)1.86401e-05,
-    (float)4.37206e-05,
-    (float)1.41554e-05,
-    (float)3.80521e-05,
-    (float)3.12871e-05,
-    (float)2.00689e-05,
-    (float)2.3473e-05,
-    (float)1.56714e-05,
-    (float)2.32254e-05,
-    (float)1.64713e-05,
-    (float)1.13628e-05,
-    (float)5.63657e-06,
-    (float)1.09394e-05,
-    (float)6.6508e-06,
-    (float)1.28841e-05,
-    (float)6.933e-06,
-    (float)6.20668e-06,
-    (float)8.93739e-06,
-    (float)7.57376e-06,
-    (float)1.01543e-05,
-    (float)6.19564e-06,
-    (float)5.97133e-06,
-    (float)5.37691e-06,
-    (float)6.38106e-06,
-    (float)3.28794e-06,
-    (float)5.00542e-06,
-    (float)3.47584e-06,
-    (float)4.41344e-06,
-    (float)3.90203e-06,
-    (float)2.85974e-06,
-    (float)4.47132e-06,
-    (float)3.74846e-06,
-    (float)4.31855e-06,
-    (float)3.10497e-06,
-    (float)3.1859e-06,
-    (float)2.69083e-06,
-    (float)3.81206e-06,
-    (float)2.56537e-06,
-    (float)2.65237e-06,
-    (float)2.23571e-06,
-    (float)2.30754e-06,
-    (float)3.05298e-06,
-    (float)2.14691e-06,
-    (float)2.63667e-06,
-    (float)2.361e-06,
-    (float)2.63804e-06,
-    (float)2.1668e-06,
-    (float)2.31587e-06,
-    (float)1.98599e-06,
-    (float)2.59222e-06,
-    (float)2.1036e-06,
-    (float)1.83535e-06,
-    (float)1.98933e-06,
-    (float)1.78773e-06,
-    (float)2.47828e-06,
-    (float)2.03193e-06,
-    (float)1.99332e-06,
-    (float)1.73924e-06,
-    (float)1.94485e-06,
-    (float)1.91607e-06,
-    (float)2.12856e-06,
-    (float)1.66261e-06,
-    (float)1.7639e-06,
-    (float)1.84008e-06,
-    (float)1.55518e-06,
-    (float)1.91769e-06,
-    (float)1.73638e-06,
-    (float)1.93725e-06,
-    (float)1.72715e-06,
-    (float)1.66838e-06,
-    (float)1.6088e-06,
-    (float)1.84573e-06,
-    (float)1.62007e-06,
-    (float)1.63611e-06,
-    (float)1.49508e-06,
-    (float)1.38789e-06,
-    (float)1.68508e-06,
-    (float)1.5055e-06,
-    (float)1.59882e-06,
-    (float)1.44366e-06,
-    (float)1.49632e-06,
-    (float)1.58419e-06,
-    (float)1.64409e-06,
-    (float)1.42519e-06,
-    (float)1.53131e-06,
-    (float)1.43539e-06,
-    (float)1.28557e-06,
-    (float)1.35834e-06,
-    (float)1.22765e-06,
-    (float)1.40352e-06,
-    (float)1.36719e-06,
-    (float)1.30728e-06,
-    (float)1.28625e-06,
-    (float)1.3289e-06,
-    (float)1.31382e-06,
-    (float)1.46743e-06,
-    (float)1.37566e-06,
-    (float)1.22954e-06,
-    (float)1.2648e-06,
-    (float)1.18804e-06,
-    (float)1.30465e-06,
-    (float)1.22791e-06,
-    (float)1.13902e-06,
-    (float)1.15035e-06,
-    (float)1.15902e-06,
-    (float)1.18879e-06,
-    (float)1.29068e-06,
-    (float)1.30145e-06,
-    (float)1.22737e-06,
-    (float)1.25174e-06,
-    (float)0.962575,
-    (float)0.031419,
-    (float)0.00077429,
-    (float)0.00209958,
-    (float)0.00107789,
-    (float)0.000432308,
-    (float)0.000186338,
-    (float)9.09447e-05,
-    (float)0.000365685,
-    (float)0.000106847,
-    (float)0.000228426,
-    (float)7.99538e-05,
-    (float)1.76128e-05,
-    (float)6.67161e-05,
-    (float)3.79335e-05,
-    (float)4.47606e-05,
-    (float)1.31553e-05,
-    (float)1.6817e-05,
-    (float)1.79189e-05,
-    (float)2.66967e-05,
-    (float)1.1142e-05,
-    (float)2.87764e-05,
-    (float)2.16617e-05,
-    (float)1.51871e-05,
-    (float)1.44496e-05,
-    (float)7.51145e-06,
-    (float)1.75807e-05,
-    (float)9.55002e-06,
-    (float)7.42479e-06,
-    (float)4.3059e-06,
-    (float)6.20385e-06,
-    (float)5.63641e-06,
-    (float)9.04075e-06,
-    (float)5.10433e-06,
-    (float)5.24966e-06,
-    (float)6.12159e-06,
-    (float)5.11326e-06,
-    (float)7.4073e-06,
-    (float)3.05917e-06,
-    (float)4.4165e-06,
-    (float)3.8949e-06,
-    (float)3.88841e-06,
-    (float)2.25513e-06,
-    (float)2.7585e-06,
-    (float)2.92501e-06,
-    (float)3.67721e-06,
-    (float)2.60894e-06,
-    (float)1.93664e-06,
-    (float)3.16236e-06,
-    (float)2.34245e-06,
-    (float)3.53599e-06,
-    (float)2.03475e-06,
-    (float)2.05855e-06,
-    (float)1.77651e-06,
-    (float)2.20225e-06,
-    (float)2.18507e-06,
-    (float)1.85893e-06,
-    (float)1.50861e-06,
-    (float)1.65738e-06,
-    (float)2.01922e-06,
-    (float)1.42519e-06,
-    (float)2.06569e-06,
-    (float)1.52593e-06,
-    (float)1.94398e-06,
-    (float)1.35758e-06,
-    (float)1.40478e-06,
-    (float)1.73559e-06,
-    (float)1.67617e-06,
-    (float)1.48699e-06,
-    (float)1.2495e-06,
-    (float)1.34479e-06,
-    (float)1.31187e-06,
-    (float)1.68377e-06,
-    (float)1.19089e-06,
-    (float)1.47313e-06,
-    (float)1.11114e-06,
-    (float)1.34086e-06,
-    (float)1.43785e-06,
-    (float)1.22922e-06,
-    (float)1.33597e-06,
-    (float)1.28766e-06,
-    (float)1.36957e-06,
-    (float)1.12002e-06,
-    (float)1.17606e-06,
-    (float)1.09575e-06,
-    (float)1.47854e-06,
-    (float)1.06413e-06,
-    (float)1.09046e-06,
-    (float)1.02698e-06,
-    (float)1.07246e-06,
-    (float)1.27276e-06,
-    (float)1.09563e-06,
-    (float)1.21096e-06,
-    (float)1.0462e-06,
-    (float)1.11066e-06,
-    (float)1.0464e-06,
-    (float)1.1889e-06,
-    (float)9.31389e-07,
-    (float)1.09854e-06,
-    (float)9.83547e-07,
-    (float)9.25345e-07,
-    (float)9.77922e-07,
-    (float)8.8733e-07,
-    (float)1.08566e-06,
-    (float)9.15165e-07,
-    (float)9.62793e-07,
-    (float)9.41142e-07,
-    (float)1.10724e-06,
-    (float)9.39615e-07,
-    (float)9.94305e-07,
-    (float)8.54531e-07,
-    (float)8.69269e-07,
-    (float)8.92807e-07,
-    (float)7.87001e-07,
-    (float)9.30392e-07,
-    (float)7.82906e-07,
-    (float)8.86925e-07,
-    (float)8.26625e-07,
-    (float)9.43991e-07,
-    (float)8.60638e-07,
-    (float)9.27049e-07,
-    (float)8.70508e-07,
-    (float)8.83763e-07,
-    (float)8.36408e-07,
-    (float)7.9837e-07,
-    (float)9.22437e-07,
-    (float)7.25151e-07,
-    (float)8.34393e-07,
-    (float)0.97679,
-    (float)0.019232,
-    (float)0.000501941,
-    (float)0.0013923,
-    (float)0.000771691,
-    (float)0.00026353,
-    (float)0.000126757,
-    (float)7.07461e-05,
-    (float)0.000216744,
-    (float)6.69846e-05,
-    (float)0.000160509,
-    (float)4.53689e-05,
-    (float)8.36185e-06,
-    (float)4.04022e-05,
-    (float)1.88026e-05,
-    (float)3.27331e-05,
-    (float)6.96904e-06,
-    (float)1.32597e-05,
-    (float)1.48564e-05,
-    (float)1.46682e-05,
-    (float)8.94858e-06,
-    (float)1.93364e-05,
-    (float)1.44292e-05,
-    (float)1.06751e-05,
-    (float)7.59893e-06,
-    (float)3.76512e-06,
-    (float)1.18663e-05,
-    (float)4.69407e-06,
-    (float)5.49084e-06,
-    (float)3.11109e-06,
-    (float)3.73401e-06,
-    (float)4.45737e-06,
-    (float)5.43088e-06,
-    (float)4.17681e-06,
-    (float)3.891e-06,
-    (float)3.77053e-06,
-    (float)3.53192e-06,
-    (float)4.3388e-06,
-    (float)1.44045e-06,
-    (float)3.24191e-06,
-    (float)2.37436e-06,
-    (float)2.50031e-06,
-    (float)1.4749e-06,
-    (float)1.4911e-06,
-    (float)2.54999e-06,
-    (float)2.39511e-06,
-    (float)1.94192e-06,
-    (float)1.53899e-06,
-    (float)1.83021e-06,
-    (float)1.39427e-06,
-    (float)2.30849e-06,
-    (float)1.33952e-06,
-    (float)1.49555e-06,
-    (float)9.04634e-07,
-    (float)1.23983e-06,
-    (float)1.64918e-06,
-    (float)1.14536e-06,
-    (float)1.32544e-06,
-    (float)1.085e-06,
-    (float)1.20922e-06,
-    (float)1.0371e-06,
-    (float)1.38e-06,
-    (float)1.07155e-06,
-    (float)1.20108e-06,
-    (float)7.67327e-07,
-    (float)1.03125e-06,
-    (float)1.08097e-06,
-    (float)9.1535e-07,
-    (float)1.11105e-06,
-    (float)7.79948e-07,
-    (float)1.05401e-06,
-    (float)8.58754e-07,
-    (float)9.73494e-07,
-    (float)8.76196e-07,
-    (float)9.72342e-07,
-    (float)7.8276e-07,
-    (float)9.02129e-07,
-    (float)8.30309e-07,
-    (float)8.15528e-07,
-    (float)8.67467e-07,
-    (float)7.2325e-07,
-    (float)1.02494e-06,
-    (float)6.86225e-07,
-    (float)8.11721e-07,
-    (float)7.53647e-07,
-    (float)8.09618e-07,
-    (float)7.65933e-07,
-    (float)8.06568e-07,
-    (float)7.02251e-07,
-    (float)6.81184e-07,
-    (float)7.24347e-07,
-    (float)7.33083e-07,
-    (float)9.01832e-07,
-    (float)5.87307e-07,
-    (float)7.28875e-07,
-    (float)6.32939e-07,
-    (float)7.64013e-07,
-    (float)6.95194e-07,
-    (float)6.64754e-07,
-    (float)6.74499e-07,
-    (float)6.29865e-07,
-    (float)6.12813e-07,
-    (float)6.03317e-07,
-    (float)6.87983e-07,
-    (float)5.95357e-07,
-    (float)7.64014e-07,
-    (float)5.50153e-07,
-    (float)6.40506e-07,
-    (float)5.58494e-07,
-    (float)6.25896e-07,
-    (float)6.70709e-07,
-    (float)5.58879e-07,
-    (float)5.69281e-07,
-    (float)5.37121e-07,
-    (float)6.0411e-07,
-    (float)5.48026e-07,
-    (float)6.26845e-07,
-    (float)5.14749e-07,
-    (float)6.42498e-07,
-    (float)4.88586e-07,
-    (float)5.63793e-07,
-    (float)6.06498e-07,
-    (float)5.90451e-07,
-    (float)6.11814e-07,
-    (float)4.55303e-07,
-    (float)5.4515e-07,
-    (float)5.34823e-07,
-    (float)6.18209e-07,
-    (float)0.986763,
-    (float)0.0108031,
-    (float)0.000308953,
-    (float)0.000839446,
-    (float)0.000500679,
-    (float)0.00014841,
-    (float)8.52787e-05,
-    (float)5.00037e-05,
-    (float)0.000113621,
-    (float)4.04236e-05,
-    (float)0.000104549,
-    (float)2.40461e-05,
-    (float)4.17264e-06,
-    (float)2.21859e-05,
-    (float)9.00409e-06,
-    (float)2.12571e-05,
-    (float)3.25489e-06,
-    (float)1.04765e-05,
-    (float)1.05696e-05,
-    (float)7.29373e-06,
-    (float)6.78281e-06,
-    (float)1.12824e-05,
-    (float)9.13906e-06,
-    (float)6.5675e-06,
-    (float)3.68733e-06,
-    (float)2.38196e-06,
-    (float)6.71642e-06,
-    (float)2.04016e-06,
-    (float)3.88572e-06,
-    (float)2.11529e-06,
-    (float)2.61501e-06,
-    (float)2.97909e-06,
-    (float)2.76554e-06,
-    (float)3.17686e-06,
-    (float)2.31186e-06,
-    (float)2.34183e-06,
-    (float)2.30538e-06,
-    (float)2.03891e-06,
-    (float)9.51908e-07,
-    (float)2.00259e-06,
-    (float)1.3505e-06,
-    (float)1.63187e-06,
-    (float)9.64084e-07,
-    (float)1.01557e-06,
-    (float)1.70148e-06,
-    (float)1.16288e-06,
-    (float)1.47846e-06,
-    (float)1.056e-06,
-    (float)1.01758e-06,
-    (float)8.15316e-07,
-    (float)1.16138e-06,
-    (float)9.74619e-07,
-    (float)9.45076e-07,
-    (float)5.61997e-07,
-    (float)8.00744e-07,
-    (float)9.26899e-07,
-    (float)7.513e-07,
-    (float)9.49534e-07,
-    (float)5.51292e-07,
-    (float)7.88215e-07,
-    (float)6.98719e-07,
-    (float)7.93552e-07,
-    (float)6.353e-07,
-    (float)5.54869e-07,
-    (float)6.69429e-07,
-    (float)7.1936e-07,
-    (float)5.92172e-07,
-    (float)5.49613e-07,
-    (float)5.86669e-07,
-    (float)5.23882e-07,
-    (float)7.68421e-07,
-    (float)4.8582e-07,
-    (float)5.29784e-07,
-    (float)4.97069e-07,
-    (float)5.7525e-07,
-    (float)5.91389e-07,
-    (float)4.74228e-07,
-    (float)5.84677e-07,
-    (float)5.45294e-07,
-    (float)4.7508e-07,
-    (float)4.60401e-07,
-    (float)5.21793e-07,
-    (float)4.68961e-07,
-    (float)5.73476e-07,
-    (float)4.04132e-07,
-    (float)4.42666e-07,
-    (float)4.49583e-07,
-    (float)4.47492e-07,
-    (float)5.54359e-07,
-    (float)4.43805e-07,
-    (float)4.63583e-07,
-    (float)4.32937e-07,
-    (float)4.60105e-07,
-    (float)4.28354e-07,
-    (float)3.95671e-07,
-    (float)3.9639e-07,
-    (float)4.78716e-07,
-    (float)3.63447e-07,
-    (float)3.78255e-07,
-    (float)4.17907e-07,
-    (float)4.07994e-07,
-    (float)4.74144e-07,
-    (float)3.49131e-07,
-    (float)4.21268e-07,
-    (float)4.1399e-07,
-    (float)3.77305e-07,
-    (float)3.93406e-07,
-    (float)3.60713e-07,
-    (float)3.00059e-07,
-    (float)3.56298e-07,
-    (float)3.58853e-07,
-    (float)3.96212e-07,
-    (float)3.80951e-07,
-    (float)3.27445e-07,
-    (float)4.35219e-07,
-    (float)3.53269e-07,
-    (float)3.4355e-07,
-    (float)3.50633e-07,
-    (float)3.45802e-07,
-    (float)3.45602e-07,
-    (float)3.16784e-07,
-    (float)3.15479e-07,
-    (float)3.70754e-07,
-    (float)2.99888e-07,
-    (float)3.42209e-07,
-    (float)3.95022e-07,
-    (float)3.15971e-07,
-    (float)3.66453e-07,
-    (float)0.993374,
-    (float)0.0053022,
-    (float)0.00017922,
-    (float)0.000437447,
-    (float)0.000280881,
-    (float)7.46645e-05,
-    (float)5.55383e-05,
-    (float)3.06563e-05,
-    (float)4.93602e-05,
-    (float)2.26975e-05,
-    (float)6.12853e-05,
-    (float)1.16908e-05,
-    (float)2.11246e-06,
-    (float)1.08909e-05,
-    (float)4.52273e-06,
-    (float)1.18201e-05,
-    (float)1.58015e-06,
-    (float)7.60743e-06,
-    (float)6.26985e-06,
-    (float)3.38893e-06,
-    (float)4.41603e-06,
-    (float)5.61557e-06,
-    (float)5.27988e-06,
-    (float)3.23249e-06,
-    (float)1.85968e-06,
-    (float)1.60241e-06,
-    (float)3.12421e-06,
-    (float)9.51785e-07,
-    (float)2.41475e-06,
-    (float)1.37089e-06,
-    (float)1.82229e-06,
-    (float)1.53355e-06,
-    (float)1.30526e-06,
-    (float)2.05644e-06,
-    (float)1.15142e-06,
-    (float)1.39678e-06,
-    (float)1.12269e-06,
-    (float)9.0834e-07,
-    (float)8.07763e-07,
-    (float)9.97662e-07,
-    (float)7.07054e-07,
-    (float)9.08007e-07,
-    (float)7.19323e-07,
-    (float)7.46343e-07,
-    (float)8.15173e-07,
-    (float)5.26429e-07,
-    (float)9.35301e-07,
-    (float)5.61816e-07,
-    (float)6.43324e-07,
-    (float)3.79332e-07,
-    (float)5.05906e-07,
-    (float)6.39394e-07,
-    (float)5.35974e-07,
-    (float)4.19336e-07,
-    (float)3.79476e-07,
-    (float)4.96424e-07,
-    (float)5.33634e-07,
-    (float)4.64282e-07,
-    (float)2.87268e-07,
-    (float)5.15165e-07,
-    (float)3.9715e-07,
-    (float)4.06565e-07,
-    (float)2.82081e-07,
-    (float)3.24804e-07,
-    (float)4.72234e-07,
-    (float)3.33731e-07,
-    (float)3.68246e-07,
-    (float)2.69319e-07,
-    (float)3.03311e-07,
-    (float)3.75565e-07,
-    (float)3.99392e-07,
-    (float)2.72746e-07,
-    (float)2.66721e-07,
-    (float)2.97639e-07,
-    (float)3.73564e-07,
-    (float)2.80005e-07,
-    (float)2.23652e-07,
-    (float)3.66519e-07,
-    (float)2.88996e-07,
-    (float)2.84839e-07,
-    (float)2.16321e-07,
-    (float)2.88773e-07,
-    (float)3.12293e-07,
-    (float)2.50111e-07,
-    (float)2.88565e-07,
-    (float)2.63771e-07,
-    (float)2.21562e-07,
-    (float)2.59873e-07,
-    (float)2.99994e-07,
-    (float)2.51684e-07,
-    (float)2.39059e-07,
-    (float)2.05947e-07,
-    (float)2.77392e-07,
-    (float)2.22834e-07,
-    (float)2.19387e-07,
-    (float)2.75137e-07,
-    (float)2.15306e-07,
-    (float)2.25656e-07,
-    (float)2.18881e-07,
-    (float)2.5178e-07,
-    (float)2.26568e-07,
-    (float)1.89344e-07,
-    (float)2.43442e-07,
-    (float)2.53054e-07,
-    (float)1.74476e-07,
-    (float)1.96607e-07,
-    (float)2.1351e-07,
-    (float)2.1846e-07,
-    (float)2.28059e-07,
-    (float)1.81072e-07,
-    (float)2.18469e-07,
-    (float)1.9163e-07,
-    (float)2.08473e-07,
-    (float)2.18961e-07,
-    (float)1.75901e-07,
-    (float)2.11805e-07,
-    (float)1.96613e-07,
-    (float)1.76654e-07,
-    (float)1.95809e-07,
-    (float)1.96441e-07,
-    (float)2.07515e-07,
-    (float)2.03682e-07,
-    (float)1.54617e-07,
-    (float)1.83425e-07,
-    (float)2.01748e-07,
-    (float)2.25145e-07,
-    (float)2.00381e-07,
-    (float)1.25689e-07,
-    (float)0.99738,
-    (float)0.00202966,
-    (float)9.66855e-05,
-    (float)0.000174263,
-    (float)0.000121005,
-    (float)3.13255e-05,
-    (float)3.34947e-05,
-    (float)1.52362e-05,
-    (float)1.47896e-05,
-    (float)1.09906e-05,
-    (float)3.0765e-05,
-    (float)5.13251e-06,
-    (float)1.00149e-06,
-    (float)4.55167e-06,
-    (float)2.48096e-06,
-    (float)5.14928e-06,
-    (float)1.04447e-06,
-    (float)4.35764e-06,
-    (float)2.88822e-06,
-    (float)1.54444e-06,
-    (float)2.39991e-06,
-    (float)2.34714e-06,
-    (float)2.46694e-06,
-    (float)1.13206e-06,
-    (float)1.10465e-06,
-    (float)9.26665e-07,
-    (float)1.10571e-06,
-    (float)4.37163e-07,
-    (float)1.11662e-06,
-    (float)8.87197e-07,
-    (float)1.0711e-06,
-    (float)5.6888e-07,
-    (float)5.24859e-07,
-    (float)1.0478e-06,
-    (float)5.97185e-07,
-    (float)6.43959e-07,
-    (float)3.37302e-07,
-    (float)5.19554e-07,
-    (float)5.43671e-07,
-    (float)3.7657e-07,
-    (float)3.10043e-07,
-    (float)4.16366e-07,
-    (float)4.82266e-07,
-    (float)3.72497e-07,
-    (float)3.23614e-07,
-    (float)2.45701e-07,
-    (float)3.77264e-07,
-    (float)2.84335e-07,
-    (float)3.98381e-07,
-    (float)1.43661e-07,
-    (float)1.89709e-07,
-    (float)3.11368e-07,
-    (float)2.89621e-07,
-    (float)2.28596e-07,
-    (float)1.52525e-07,
-    (float)3.13549e-07,
-    (float)2.05523e-07,
-    (float)1.50406e-07,
-    (float)2.06812e-07,
-    (float)2.69606e-07,
-    (float)1.64192e-07,
-    (float)1.44955e-07,
-    (float)1.65669e-07,
-    (float)1.93462e-07,
-    (float)2.0557e-07,
-    (float)1.52618e-07,
-    (float)1.75229e-07,
-    (float)1.20701e-07,
-    (float)1.86099e-07,
-    (float)1.55216e-07,
-    (float)1.6156e-07,
-    (float)1.46861e-07,
-    (float)1.14651e-07,
-    (float)1.67297e-07,
-    (float)1.59593e-07,
-    (float)1.44352e-07,
-    (float)1.18476e-07,
-    (float)1.58287e-07,
-    (float)1.22136e-07,
-    (float)1.20937e-07,
-    (float)1.40596e-07,
-    (float)1.54434e-07,
-    (float)9.28672e-08,
-    (float)1.12895e-07,
-    (float)1.65569e-07,
-    (float)1.14526e-07,
-    (float)1.29124e-07,
-    (float)1.03698e-07,
-    (float)1.45034e-07,
-    (float)1.30349e-07,
-    (float)9.80235e-08,
-    (float)9.2095e-08,
-    (float)1.13517e-07,
-    (float)1.33313e-07,
-    (float)1.17029e-07,
-    (float)1.05924e-07,
-    (float)9.22412e-08,
-    (float)1.19974e-07,
-    (float)1.18449e-07,
-    (float)1.15536e-07,
-    (float)8.47098e-08,
-    (float)1.11223e-07,
-    (float)1.08114e-07,
-    (float)9.80907e-08,
-    (float)1.03747e-07,
-    (float)6.9024e-08,
-    (float)1.08584e-07,
-    (float)1.08674e-07,
-    (float)1.13337e-07,
-    (float)1.0323e-07,
-    (float)9.47462e-08,
-    (float)9.85062e-08,
-    (float)9.01406e-08,
-    (float)7.50659e-08,
-    (float)1.02926e-07,
-    (float)1.05307e-07,
-    (float)6.7961e-08,
-    (float)1.06663e-07,
-    (float)9.55478e-08,
-    (float)1.01001e-07,
-    (float)7.27047e-08,
-    (float)8.74443e-08,
-    (float)1.2074e-07,
-    (float)7.66069e-08,
-    (float)8.27616e-08,
-    (float)8.78201e-08,
-    (float)9.38398e-08,
-    (float)9.58232e-08,
-    (float)0.999405,
-    (float)0.000414799,
-    (float)4.73125e-05,
-    (float)3.49461e-05,
-    (float)2.67088e-05,
-    (float)9.37309e-06,
-    (float)1.71205e-05,
-    (float)5.06592e-06,
-    (float)1.28716e-06,
-    (float)3.80088e-06,
-    (float)1.17359e-05,
-    (float)1.8001e-06,
-    (float)5.47739e-07,
-    (float)1.53102e-06,
-    (float)1.43639e-06,
-    (float)1.47118e-06,
-    (float)8.19663e-07,
-    (float)1.62843e-06,
-    (float)9.78256e-07,
-    (float)6.3796e-07,
-    (float)9.81347e-07,
-    (float)7.18728e-07,
-    (float)7.13569e-07,
-    (float)2.67721e-07,
-    (float)5.64444e-07,
-    (float)3.62937e-07,
-    (float)2.68438e-07,
-    (float)1.514e-07,
-    (float)3.32474e-07,
-    (float)4.5459e-07,
-    (float)3.9094e-07,
-    (float)1.03719e-07,
-    (float)1.43077e-07,
-    (float)4.53485e-07,
-    (float)2.95342e-07,
-    (float)1.2034e-07,
-    (float)4.82394e-08,
-    (float)3.24608e-07,
-    (float)2.56533e-07,
-    (float)7.50486e-08,
-    (float)7.757e-08,
-    (float)1.60029e-07,
-    (float)1.95885e-07,
-    (float)1.18449e-07,
-    (float)1.35847e-07,
-    (float)6.19866e-08,
-    (float)7.31284e-08,
-    (float)1.47848e-07,
-    (float)1.81317e-07,
-    (float)4.41713e-08,
-    (float)4.50989e-08,
-    (float)1.24923e-07,
-    (float)1.09847e-07,
-    (float)7.2243e-08,
-    (float)7.36865e-08,
-    (float)1.09236e-07,
-    (float)3.19299e-08,
-    (float)7.09988e-08,
-    (float)1.14821e-07,
-    (float)7.4575e-08,
-    (float)3.65063e-08,
-    (float)4.86045e-08,
-    (float)7.89066e-08,
-    (float)6.64663e-08,
-    (float)6.95243e-08,
-    (float)4.53384e-08,
-    (float)4.79251e-08,
-    (float)6.51023e-08,
-    (float)6.02009e-08,
-    (float)4.13766e-08,
-    (float)6.93797e-08,
-    (float)6.28597e-08,
-    (float)2.99739e-08,
-    (float)4.52041e-08,
-    (float)5.72021e-08,
-    (float)6.69451e-08,
-    (float)4.24392e-08,
-    (float)3.99276e-08,
-    (float)2.95299e-08,
-    (float)4.8497e-08,
-    (float)6.77773e-08,
-    (float)4.84934e-08,
-    (float)3.84369e-08,
-    (float)3.09567e-08,
-    (float)4.31683e-08,
-    (float)5.65515e-08,
-    (float)4.57016e-08,
-    (float)2.47297e-08,
-    (float)4.91129e-08,
-    (float)4.59486e-08,
-    (float)3.12814e-08,
-    (float)3.5299e-08,
-    (float)4.62146e-08,
-    (float)4.0797e-08,
-    (float)3.37933e-08,
-    (float)4.76858e-08,
-    (float)3.58537e-08,
-    (float)3.07357e-08,
-    (float)2.81535e-08,
-    (float)4.38798e-08,
-    (float)4.20921e-08,
-    (float)2.78623e-08,
-    (float)2.94652e-08,
-    (float)3.9174e-08,
-    (float)3.75334e-08,
-    (float)3.2239e-08,
-    (float)3.85943e-08,
-    (float)3.23349e-08,
-    (float)3.47676e-08,
-    (float)2.91151e-08,
-    (float)3.70259e-08,
-    (float)3.05713e-08,
-    (float)3.28798e-08,
-    (float)3.51283e-08,
-    (float)2.82253e-08,
-    (float)2.95366e-08,
-    (float)2.93542e-08,
-    (float)4.12091e-08,
-    (float)3.18368e-08,
-    (float)2.55796e-08,
-    (float)2.15924e-08,
-    (float)3.85434e-08,
-    (float)4.38478e-08,
-    (float)3.06509e-08,
-    (float)2.30761e-08,
-    (float)2.67617e-08,
-    (float)3.69098e-08,
-    (float)3.04582e-08,
-    (float)0.999947,
-    (float)1.10948e-05,
-    (float)2.04515e-05,
-    (float)1.60009e-06,
-    (float)1.73474e-06,
-    (float)1.01403e-06,
-    (float)6.18327e-06,
-    (float)4.27207e-07,
-    (float)1.25531e-06,
-    (float)5.51526e-07,
-    (float)2.30396e-06,
-    (float)3.62752e-07,
-    (float)7.61411e-07,
-    (float)3.88397e-07,
-    (float)8.09853e-07,
-    (float)3.51123e-07,
-    (float)4.87556e-07,
-    (float)2.48269e-07,
-    (float)2.46945e-07,
-    (float)2.37158e-07,
-    (float)2.88472e-07,
-    (float)1.18002e-07,
-    (float)4.91376e-08,
-    (float)8.30209e-08,
-    (float)1.14755e-07,
-    (float)7.0279e-08,
-    (float)1.83437e-08,
-    (float)4.7095e-09,
-    (float)2.43721e-08,
-    (float)1.28114e-07,
-    (float)6.3342e-08,
-    (float)7.08155e-09,
-    (float)1.89336e-09,
-    (float)1.66279e-07,
-    (float)8.91336e-08,
-    (float)1.18547e-08,
-    (float)5.78677e-11,
-    (float)1.12256e-07,
-    (float)5.18706e-08,
-    (float)6.93689e-11,
-    (float)8.54581e-09,
-    (float)2.77818e-08,
-    (float)9.61884e-09,
-    (float)2.15787e-08,
-    (float)3.62648e-08,
-    (float)5.28279e-09,
-    (float)4.88238e-10,
-    (float)4.33706e-08,
-    (float)3.53054e-08,
-    (float)1.24869e-08,
-    (float)3.74045e-09,
-    (float)2.19751e-08,
-    (float)9.50672e-09,
-    (float)2.03933e-08,
-    (float)2.28934e-08,
-    (float)3.42655e-09,
-    (float)3.49665e-09,
-    (float)1.99084e-08,
-    (float)2.67511e-08,
-    (float)4.72286e-09,
-    (float)2.43867e-09,
-    (float)5.57231e-09,
-    (float)1.17311e-08,
-    (float)1.64031e-08,
-    (float)6.43549e-09,
-    (float)9.24233e-10,
-    (float)1.08617e-08,
-    (float)1.77336e-08,
-    (float)2.57926e-09,
-    (float)2.27025e-09,
-    (float)1.35472e-08,
-    (float)1.39039e-08,
-    (float)2.54937e-09,
-    (float)3.55787e-09,
-    (float)8.84255e-09,
-    (float)6.28831e-09,
-    (float)5.53125e-09,
-    (float)9.99839e-09,
-    (float)8.62487e-09,
-    (float)2.41361e-09,
-    (float)5.21687e-09,
-    (float)1.01015e-08,
-    (float)4.94321e-09,
-    (float)2.91527e-09,
-    (float)5.99785e-09,
-    (float)6.983e-09,
-    (float)4.90114e-09,
-    (float)3.68765e-09,
-    (float)7.02709e-09,
-    (float)4.12859e-09,
-    (float)5.019e-09,
-    (float)9.02942e-09,
-    (float)7.59818e-09,
-    (float)4.71396e-10,
-    (float)1.66285e-09,
-    (float)1.09173e-08,
-    (float)6.64582e-09,
-    (float)3.02938e-09,
-    (float)3.97208e-09,
-    (float)2.98904e-09,
-    (float)5.58985e-09,
-    (float)4.86283e-09,
-    (float)1.94364e-09,
-    (float)4.56141e-09,
-    (float)7.00618e-09,
-    (float)3.83988e-09,
-    (float)4.91817e-09,
-    (float)3.61444e-09,
-    (float)2.6914e-09,
-    (float)3.02442e-09,
-    (float)3.13832e-09,
-    (float)5.92451e-09,
-    (float)4.77086e-09,
-    (float)3.18563e-09,
-    (float)5.51525e-09,
-    (float)4.16974e-09,
-    (float)1.91537e-09,
-    (float)2.98125e-09,
-    (float)3.00349e-09,
-    (float)4.83965e-09,
-    (float)3.71894e-09,
-    (float)5.0688e-09,
-    (float)6.68309e-09,
-    (float)1.85816e-09,
-    (float)3.81907e-09,
-    (float)7.50436e-09,
-    (float)2.31051e-09,
-    (float)1.19396e-09,
-    (float)0.999947,
-    (float)1.10948e-05,
-    (float)2.04515e-05,
-    (float)1.60009e-06,
-    (float)1.73474e-06,
-    (float)1.01403e-06,
-    (float)6.18327e-06,
-    (float)4.27207e-07,
-    (float)1.25531e-06,
-    (float)5.51526e-07,
-    (float)2.30396e-06,
-    (float)3.62752e-07,
-    (float)7.61411e-07,
-    (float)3.88397e-07,
-    (float)8.09853e-07,
-    (float)3.51123e-07,
-    (float)4.87556e-07,
-    (float)2.48269e-07,
-    (float)2.46945e-07,
-    (float)2.37158e-07,
-    (float)2.88472e-07,
-    (float)1.18002e-07,
-    (float)4.91376e-08,
-    (float)8.30209e-08,
-    (float)1.14755e-07,
-    (float)7.0279e-08,
-    (float)1.83437e-08,
-    (float)4.7095e-09,
-    (float)2.43721e-08,
-    (float)1.28114e-07,
-    (float)6.3342e-08,
-    (float)7.08155e-09,
-    (float)1.89336e-09,
-    (float)1.66279e-07,
-    (float)8.91336e-08,
-    (float)1.18547e-08,
-    (float)5.78677e-11,
-    (float)1.12256e-07,
-    (float)5.18706e-08,
-    (float)6.93689e-11,
-    (float)8.54581e-09,
-    (float)2.77818e-08,
-    (float)9.61884e-09,
-    (float)2.15787e-08,
-    (float)3.62648e-08,
-    (float)5.28279e-09,
-    (float)4.88238e-10,
-    (float)4.33706e-08,
-    (float)3.53054e-08,
-    (float)1.24869e-08,
-    (float)3.74045e-09,
-    (float)2.19751e-08,
-    (float)9.50672e-09,
-    (float)2.03933e-08,
-    (float)2.28934e-08,
-    (float)3.42655e-09,
-    (float)3.49665e-09,
-    (float)1.99084e-08,
-    (float)2.67511e-08,
-    (float)4.72286e-09,
-    (float)2.43867e-09,
-    (float)5.57231e-09,
-    (float)1.17311e-08,
-    (float)1.64031e-08,
-    (float)6.43549e-09,
-    (float)9.24233e-10,
-    (float)1.08617e-08,
-    (float)1.77336e-08,
-    (float)2.57926e-09,
-    (float)2.27025e-09,
-    (float)1.35472e-08,
-    (float)1.39039e-08,
-    (float)2.54937e-09,
-    (float)3.55787e-09,
-    (float)8.84255e-09,
-    (float)6.28831e-09,
-    (float)5.53125e-09,
-    (float)9.99839e-09,
-    (float)8.62487e-09,
-    (float)2.41361e-09,
-    (float)5.21687e-09,
-    (float)1.01015e-08,
-    (float)4.94321e-09,
-    (float)2.91527e-09,
-    (float)5.99785e-09,
-    (float)6.983e-09,
-    (float)4.90114e-09,
-    (float)3.68765e-09,
-    (float)7.02709e-09,
-    (float)4.12859e-09,
-    (float)5.019e-09,
-    (float)9.02942e-09,
-    (float)7.59818e-09,
-    (float)4.71396e-10,
-    (float)1.66285e-09,
-    (float)1.09173e-08,
-    (float)6.64582e-09,
-    (float)3.02938e-09,
-    (float)3.97208e-09,
-    (float)2.98904e-09,
-    (float)5.58985e-09,
-    (float)4.86283e-09,
-    (float)1.94364e-09,
-    (float)4.56141e-09,
-    (float)7.00618e-09,
-    (float)3.83988e-09,
-    (float)4.91817e-09,
-    (float)3.61444e-09,
-    (float)2.6914e-09,
-    (float)3.02442e-09,
-    (float)3.13832e-09,
-    (float)5.92451e-09,
-    (float)4.77086e-09,
-    (float)3.18563e-09,
-    (float)5.51525e-09,
-    (float)4.16974e-09,
-    (float)1.91537e-09,
-    (float)2.98125e-09,
-    (float)3.00349e-09,
-    (float)4.83965e-09,
-    (float)3.71894e-09,
-    (float)5.0688e-09,
-    (float)6.68309e-09,
-    (float)1.85816e-09,
-    (float)3.81907e-09,
-    (float)7.50436e-09,
-    (float)2.31051e-09,
-    (float)1.19396e-09,
-    (float)0.999111,
-    (float)6.23168e-05,
-    (float)0.000564719,
-    (float)2.47696e-05,
-    (float)0.000124034,
-    (float)4.52899e-05,
-    (float)1.37012e-05,
-    (float)8.36097e-06,
-    (float)2.42993e-06,
-    (float)5.39401e-06,
-    (float)6.00054e-06,
-    (float)2.78647e-06,
-    (float)3.18012e-06,
-    (float)4.14556e-06,
-    (float)2.82156e-06,
-    (float)1.67582e-06,
-    (float)1.0128e-06,
-    (float)2.33213e-06,
-    (float)8.37588e-07,
-    (float)4.59311e-07,
-    (float)1.12507e-06,
-    (float)8.19208e-08,
-    (float)6.0429e-07,
-    (float)1.78494e-07,
-    (float)6.48564e-07,
-    (float)3.02561e-07,
-    (float)5.23383e-07,
-    (float)2.38677e-07,
-    (float)4.67753e-07,
-    (float)6.97877e-07,
-    (float)2.47239e-07,
-    (float)2.18516e-07,
-    (float)1.14205e-07,
-    (float)5.08251e-07,
-    (float)3.55472e-07,
-    (float)5.96536e-08,
-    (float)7.88273e-08,
-    (float)3.95998e-07,
-    (float)3.10594e-07,
-    (float)5.53017e-08,
-    (float)7.44148e-08,
-    (float)1.66805e-07,
-    (float)1.35174e-07,
-    (float)1.59059e-07,
-    (float)1.25279e-07,
-    (float)1.02606e-07,
-    (float)7.50761e-08,
-    (float)1.97881e-07,
-    (float)2.33646e-07,
-    (float)7.03745e-08,
-    (float)6.76632e-08,
-    (float)1.29192e-07,
-    (float)1.39424e-07,
-    (float)5.75608e-08,
-    (float)1.17729e-07,
-    (float)7.13414e-08,
-    (float)3.04264e-08,
-    (float)1.02348e-07,
-    (float)1.26889e-07,
-    (float)6.56212e-08,
-    (float)2.96334e-08,
-    (float)7.63383e-08,
-    (float)8.10326e-08,
-    (float)9.95838e-08,
-    (float)8.1743e-08,
-    (float)4.45655e-08,
-    (float)7.02945e-08,
-    (float)8.63697e-08,
-    (float)6.6706e-08,
-    (float)4.56071e-08,
-    (float)7.09914e-08,
-    (float)7.38948e-08,
-    (float)3.57244e-08,
-    (float)4.07512e-08,
-    (float)6.19409e-08,
-    (float)7.27697e-08,
-    (float)4.42053e-08,
-    (float)3.87718e-08,
-    (float)4.68147e-08,
-    (float)5.00358e-08,
-    (float)6.51042e-08,
-    (float)5.62988e-08,
-    (float)4.75797e-08,
-    (float)4.13497e-08,
-    (float)5.22703e-08,
-    (float)7.13014e-08,
-    (float)4.4926e-08,
-    (float)3.97685e-08,
-    (float)4.60881e-08,
-    (float)4.60192e-08,
-    (float)3.35339e-08,
-    (float)4.45747e-08,
-    (float)4.88819e-08,
-    (float)2.67831e-08,
-    (float)3.594e-08,
-    (float)5.40265e-08,
-    (float)5.82494e-08,
-    (float)2.79688e-08,
-    (float)3.52277e-08,
-    (float)4.55253e-08,
-    (float)4.74203e-08,
-    (float)3.88318e-08,
-    (float)3.65739e-08,
-    (float)3.7452e-08,
-    (float)4.71321e-08,
-    (float)4.60597e-08,
-    (float)3.6359e-08,
-    (float)3.21958e-08,
-    (float)3.49729e-08,
-    (float)3.65529e-08,
-    (float)2.86674e-08,
-    (float)3.56226e-08,
-    (float)4.26017e-08,
-    (float)3.4803e-08,
-    (float)2.8479e-08,
-    (float)4.09327e-08,
-    (float)3.15593e-08,
-    (float)4.52545e-08,
-    (float)3.6307e-08,
-    (float)3.20483e-08,
-    (float)3.49862e-08,
-    (float)4.45708e-08,
-    (float)4.74515e-08,
-    (float)2.58943e-08,
-    (float)2.88725e-08,
-    (float)3.62861e-08,
-    (float)3.79478e-08,
-    (float)2.54745e-08,
-    (float)0.996058,
-    (float)0.000221166,
-    (float)0.00281902,
-    (float)8.34567e-05,
-    (float)0.000474524,
-    (float)0.000152332,
-    (float)2.89559e-05,
-    (float)2.4255e-05,
-    (float)9.94813e-06,
-    (float)1.84818e-05,
-    (float)1.48478e-05,
-    (float)1.11514e-05,
-    (float)7.74016e-06,
-    (float)1.26974e-05,
-    (float)7.28956e-06,
-    (float)7.40422e-06,
-    (float)2.47437e-06,
-    (float)7.01929e-06,
-    (float)2.57376e-06,
-    (float)6.94294e-07,
-    (float)2.85118e-06,
-    (float)7.72092e-08,
-    (float)2.02499e-06,
-    (float)2.2762e-07,
-    (float)1.66762e-06,
-    (float)8.38149e-07,
-    (float)1.67798e-06,
-    (float)9.62809e-07,
-    (float)1.26384e-06,
-    (float)1.83279e-06,
-    (float)5.15602e-07,
-    (float)9.41251e-07,
-    (float)6.40522e-07,
-    (float)9.28742e-07,
-    (float)1.02374e-06,
-    (float)4.13964e-07,
-    (float)3.9378e-07,
-    (float)8.44967e-07,
-    (float)7.71412e-07,
-    (float)2.99526e-07,
-    (float)1.57302e-07,
-    (float)4.65555e-07,
-    (float)3.10177e-07,
-    (float)5.00578e-07,
-    (float)2.41135e-07,
-    (float)3.64706e-07,
-    (float)3.54967e-07,
-    (float)4.00325e-07,
-    (float)6.04211e-07,
-    (float)2.43257e-07,
-    (float)2.28078e-07,
-    (float)3.07455e-07,
-    (float)4.97409e-07,
-    (float)1.68647e-07,
-    (float)2.44141e-07,
-    (float)3.09001e-07,
-    (float)1.41609e-07,
-    (float)2.32704e-07,
-    (float)2.76487e-07,
-    (float)2.02658e-07,
-    (float)1.36603e-07,
-    (float)1.86275e-07,
-    (float)2.49955e-07,
-    (float)2.19454e-07,
-    (float)2.34329e-07,
-    (float)1.59569e-07,
-    (float)1.97292e-07,
-    (float)1.98076e-07,
-    (float)2.03468e-07,
-    (float)2.16379e-07,
-    (float)1.45742e-07,
-    (float)1.96314e-07,
-    (float)1.42035e-07,
-    (float)1.50578e-07,
-    (float)1.90131e-07,
-    (float)1.87194e-07,
-    (float)1.26569e-07,
-    (float)1.03719e-07,
-    (float)1.33525e-07,
-    (float)1.32664e-07,
-    (float)1.92431e-07,
-    (float)1.59406e-07,
-    (float)1.10102e-07,
-    (float)1.6552e-07,
-    (float)1.36169e-07,
-    (float)1.69479e-07,
-    (float)1.51729e-07,
-    (float)1.27305e-07,
-    (float)1.03125e-07,
-    (float)1.49504e-07,
-    (float)1.31845e-07,
-    (float)9.17193e-08,
-    (float)1.69614e-07,
-    (float)1.19632e-07,
-    (float)1.23388e-07,
-    (float)1.16407e-07,
-    (float)1.24532e-07,
-    (float)9.61533e-08,
-    (float)1.023e-07,
-    (float)1.18608e-07,
-    (float)1.42994e-07,
-    (float)1.19899e-07,
-    (float)1.02125e-07,
-    (float)1.25998e-07,
-    (float)1.27065e-07,
-    (float)9.93974e-08,
-    (float)1.3421e-07,
-    (float)1.13857e-07,
-    (float)8.18421e-08,
-    (float)1.16453e-07,
-    (float)1.03544e-07,
-    (float)1.1333e-07,
-    (float)9.89402e-08,
-    (float)1.36992e-07,
-    (float)8.03576e-08,
-    (float)1.09218e-07,
-    (float)1.00678e-07,
-    (float)1.04299e-07,
-    (float)1.0106e-07,
-    (float)9.06669e-08,
-    (float)1.02081e-07,
-    (float)1.12586e-07,
-    (float)1.30533e-07,
-    (float)9.77113e-08,
-    (float)1.06854e-07,
-    (float)8.64753e-08,
-    (float)1.02592e-07,
-    (float)9.84483e-08,
-    (float)0.990389,
-    (float)0.000479337,
-    (float)0.00718253,
-    (float)0.000186771,
-    (float)0.00104949,
-    (float)0.000314299,
-    (float)5.67977e-05,
-    (float)4.56352e-05,
-    (float)2.39014e-05,
-    (float)3.86671e-05,
-    (float)3.05073e-05,
-    (float)2.83584e-05,
-    (float)1.41735e-05,
-    (float)2.68165e-05,
-    (float)1.44381e-05,
-    (float)1.91954e-05,
-    (float)5.46971e-06,
-    (float)1.4266e-05,
-    (float)6.32662e-06,
-    (float)7.75414e-07,
-    (float)5.81572e-06,
-    (float)9.07811e-08,
-    (float)4.35977e-06,
-    (float)5.62126e-07,
-    (float)3.0078e-06,
-    (float)1.90914e-06,
-    (float)3.26093e-06,
-    (float)2.32493e-06,
-    (float)2.16263e-06,
-    (float)3.56417e-06,
-    (float)1.01577e-06,
-    (float)1.92645e-06,
-    (float)2.01727e-06,
-    (float)1.46641e-06,
-    (float)2.26316e-06,
-    (float)1.21623e-06,
-    (float)1.00274e-06,
-    (float)1.63675e-06,
-    (float)1.28201e-06,
-    (float)8.97358e-07,
-    (float)2.76069e-07,
-    (float)9.62334e-07,
-    (float)5.1634e-07,
-    (float)1.02556e-06,
-    (float)4.46086e-07,
-    (float)6.00131e-07,
-    (float)1.00416e-06,
-    (float)6.17956e-07,
-    (float)1.06131e-06,
-    (float)6.15461e-07,
-    (float)5.76262e-07,
-    (float)6.16936e-07,
-    (float)9.54292e-07,
-    (float)5.48905e-07,
-    (float)3.97238e-07,
-    (float)7.23141e-07,
-    (float)4.23671e-07,
-    (float)4.0352e-07,
-    (float)4.97962e-07,
-    (float)3.8614e-07,
-    (float)4.55831e-07,
-    (float)2.52275e-07,
-    (float)4.75743e-07,
-    (float)4.51429e-07,
-    (float)4.1624e-07,
-    (float)3.32636e-07,
-    (float)3.52464e-07,
-    (float)4.48951e-07,
-    (float)3.46402e-07,
-    (float)5.67988e-07,
-    (float)3.40155e-07,
-    (float)3.32289e-07,
-    (float)4.30279e-07,
-    (float)3.18771e-07,
-    (float)4.19733e-07,
-    (float)3.04121e-07,
-    (float)2.59024e-07,
-    (float)2.43347e-07,
-    (float)3.03628e-07,
-    (float)2.98945e-07,
-    (float)2.80812e-07,
-    (float)3.92665e-07,
-    (float)1.63666e-07,
-    (float)3.16989e-07,
-    (float)3.45896e-07,
-    (float)2.66577e-07,
-    (float)2.93109e-07,
-    (float)2.68944e-07,
-    (float)2.75045e-07,
-    (float)2.75007e-07,
-    (float)3.54984e-07,
-    (float)2.65379e-07,
-    (float)2.96115e-07,
-    (float)3.27847e-07,
-    (float)2.00285e-07,
-    (float)2.48695e-07,
-    (float)1.93701e-07,
-    (float)1.97796e-07,
-    (float)2.86067e-07,
-    (float)1.78524e-07,
-    (float)2.6005e-07,
-    (float)2.55865e-07,
-    (float)2.63068e-07,
-    (float)1.77752e-07,
-    (float)2.77934e-07,
-    (float)2.41227e-07,
-    (float)2.0743e-07,
-    (float)3.15886e-07,
-    (float)1.78257e-07,
-    (float)2.49887e-07,
-    (float)2.29062e-07,
-    (float)2.54729e-07,
-    (float)2.67086e-07,
-    (float)2.00719e-07,
-    (float)2.22238e-07,
-    (float)2.20456e-07,
-    (float)1.82479e-07,
-    (float)1.78098e-07,
-    (float)1.91161e-07,
-    (float)2.11153e-07,
-    (float)1.59433e-07,
-    (float)2.63313e-07,
-    (float)2.29356e-07,
-    (float)2.17007e-07,
-    (float)2.52001e-07,
-    (float)1.87316e-07,
-    (float)2.4486e-07,
-    (float)1.85156e-07,
-    (float)0.981685,
-    (float)0.000822998,
-    (float)0.0140918,
-    (float)0.000342851,
-    (float)0.0018345,
-    (float)0.000521105,
-    (float)0.000103419,
-    (float)7.10805e-05,
-    (float)4.30611e-05,
-    (float)6.51192e-05,
-    (float)5.4501e-05,
-    (float)5.742e-05,
-    (float)2.12998e-05,
-    (float)4.67604e-05,
-    (float)2.51293e-05,
-    (float)3.82556e-05,
-    (float)1.09864e-05,
-    (float)2.29523e-05,
-    (float)1.3262e-05,
-    (float)9.68963e-07,
-    (float)1.02315e-05,
-    (float)3.64717e-07,
-    (float)7.34626e-06,
-    (float)2.07414e-06,
-    (float)4.50567e-06,
-    (float)3.54244e-06,
-    (float)5.13548e-06,
-    (float)4.18046e-06,
-    (float)3.24628e-06,
-    (float)5.34001e-06,
-    (float)2.08776e-06,
-    (float)2.73997e-06,
-    (float)4.54433e-06,
-    (float)2.42636e-06,
-    (float)3.82739e-06,
-    (float)2.83288e-06,
-    (float)1.80432e-06,
-    (float)3.05251e-06,
-    (float)1.63608e-06,
-    (float)1.78805e-06,
-    (float)7.20487e-07,
-    (float)1.5801e-06,
-    (float)9.21565e-07,
-    (float)1.56435e-06,
-    (float)1.03906e-06,
-    (float)7.85346e-07,
-    (float)1.79189e-06,
-    (float)1.0262e-06,
-    (float)1.32479e-06,
-    (float)1.23362e-06,
-    (float)1.08032e-06,
-    (float)1.18135e-06,
-    (float)1.33984e-06,
-    (float)1.21415e-06,
-    (float)8.93154e-07,
-    (float)1.09416e-06,
-    (float)9.93675e-07,
-    (float)5.92528e-07,
-    (float)8.65487e-07,
-    (float)6.27388e-07,
-    (float)8.81386e-07,
-    (float)5.3906e-07,
-    (float)5.78884e-07,
-    (float)8.1207e-07,
-    (float)6.50502e-07,
-    (float)6.08325e-07,
-    (float)5.31472e-07,
-    (float)7.77991e-07,
-    (float)6.44524e-07,
-    (float)8.00867e-07,
-    (float)8.26351e-07,
-    (float)5.03573e-07,
-    (float)7.69015e-07,
-    (float)6.56087e-07,
-    (float)6.33205e-07,
-    (float)5.80115e-07,
-    (float)4.24254e-07,
-    (float)4.97522e-07,
-    (float)5.43699e-07,
-    (float)6.10972e-07,
-    (float)4.27724e-07,
-    (float)5.26866e-07,
-    (float)4.54002e-07,
-    (float)3.77969e-07,
-    (float)5.77898e-07,
-    (float)4.7656e-07,
-    (float)4.38597e-07,
-    (float)5.23051e-07,
-    (float)5.20735e-07,
-    (float)5.81595e-07,
-    (float)4.97124e-07,
-    (float)5.62265e-07,
-    (float)4.88557e-07,
-    (float)5.05998e-07,
-    (float)3.90213e-07,
-    (float)3.34784e-07,
-    (float)4.7381e-07,
-    (float)3.81734e-07,
-    (float)4.76489e-07,
-    (float)3.94409e-07,
-    (float)3.64133e-07,
-    (float)4.07433e-07,
-    (float)4.13669e-07,
-    (float)3.63777e-07,
-    (float)3.41921e-07,
-    (float)4.36239e-07,
-    (float)4.73755e-07,
-    (float)4.59388e-07,
-    (float)4.38363e-07,
-    (float)3.81077e-07,
-    (float)4.77499e-07,
-    (float)4.08377e-07,
-    (float)3.79692e-07,
-    (float)4.06507e-07,
-    (float)2.94152e-07,
-    (float)4.12417e-07,
-    (float)3.5977e-07,
-    (float)3.51784e-07,
-    (float)3.37798e-07,
-    (float)3.45389e-07,
-    (float)3.64446e-07,
-    (float)3.3867e-07,
-    (float)3.82216e-07,
-    (float)3.62184e-07,
-    (float)3.83581e-07,
-    (float)3.89418e-07,
-    (float)4.1285e-07,
-    (float)4.26339e-07,
-    (float)0.969461,
-    (float)0.00123716,
-    (float)0.0240455,
-    (float)0.000561806,
-    (float)0.00281146,
-    (float)0.000763062,
-    (float)0.000177686,
-    (float)9.99819e-05,
-    (float)6.59454e-05,
-    (float)9.72543e-05,
-    (float)8.91015e-05,
-    (float)0.000101594,
-    (float)2.84962e-05,
-    (float)7.21825e-05,
-    (float)4.00798e-05,
-    (float)6.61486e-05,
-    (float)2.02004e-05,
-    (float)3.29053e-05,
-    (float)2.45189e-05,
-    (float)1.70133e-06,
-    (float)1.63785e-05,
-    (float)1.50881e-06,
-    (float)1.09034e-05,
-    (float)5.83312e-06,
-    (float)6.04786e-06,
-    (float)5.68323e-06,
-    (float)7.66921e-06,
-    (float)6.32686e-06,
-    (float)4.60327e-06,
-    (float)6.7363e-06,
-    (float)3.91903e-06,
-    (float)3.30002e-06,
-    (float)8.02328e-06,
-    (float)3.94564e-06,
-    (float)5.45088e-06,
-    (float)5.5886e-06,
-    (float)2.77635e-06,
-    (float)5.10333e-06,
-    (float)2.17637e-06,
-    (float)2.98991e-06,
-    (float)1.88357e-06,
-    (float)2.38704e-06,
-    (float)1.54719e-06,
-    (float)2.14849e-06,
-    (float)2.10789e-06,
-    (float)1.13442e-06,
-    (float)2.37366e-06,
-    (float)1.76992e-06,
-    (float)1.47367e-06,
-    (float)2.09124e-06,
-    (float)1.68607e-06,
-    (float)1.7553e-06,
-    (float)1.76897e-06,
-    (float)1.86654e-06,
-    (float)1.77104e-06,
-    (float)1.57987e-06,
-    (float)1.78025e-06,
-    (float)9.92266e-07,
-    (float)1.51987e-06,
-    (float)1.13909e-06,
-    (float)1.26774e-06,
-    (float)1.20527e-06,
-    (float)6.73229e-07,
-    (float)1.11053e-06,
-    (float)1.12394e-06,
-    (float)9.39184e-07,
-    (float)8.04373e-07,
-    (float)1.09012e-06,
-    (float)1.12195e-06,
-    (float)9.86227e-07,
-    (float)1.34027e-06,
-    (float)8.19616e-07,
-    (float)9.3779e-07,
-    (float)1.11394e-06,
-    (float)9.0536e-07,
-    (float)9.94828e-07,
-    (float)8.72831e-07,
-    (float)8.87184e-07,
-    (float)9.8877e-07,
-    (float)9.42974e-07,
-    (float)7.50802e-07,
-    (float)6.93132e-07,
-    (float)8.54524e-07,
-    (float)6.02684e-07,
-    (float)6.84773e-07,
-    (float)7.79718e-07,
-    (float)6.61838e-07,
-    (float)9.0995e-07,
-    (float)7.73325e-07,
-    (float)8.47679e-07,
-    (float)7.24427e-07,
-    (float)7.59514e-07,
-    (float)7.19678e-07,
-    (float)7.37611e-07,
-    (float)6.75786e-07,
-    (float)6.43932e-07,
-    (float)8.23171e-07,
-    (float)7.77321e-07,
-    (float)6.98899e-07,
-    (float)7.38607e-07,
-    (float)5.99993e-07,
-    (float)6.0398e-07,
-    (float)6.42379e-07,
-    (float)5.3671e-07,
-    (float)5.76974e-07,
-    (float)6.04648e-07,
-    (float)7.23847e-07,
-    (float)6.70119e-07,
-    (float)7.23741e-07,
-    (float)5.50406e-07,
-    (float)6.23861e-07,
-    (float)6.70257e-07,
-    (float)5.54551e-07,
-    (float)5.72962e-07,
-    (float)5.82363e-07,
-    (float)5.85299e-07,
-    (float)6.94568e-07,
-    (float)7.13602e-07,
-    (float)5.94775e-07,
-    (float)5.76177e-07,
-    (float)5.87945e-07,
-    (float)5.52265e-07,
-    (float)5.32442e-07,
-    (float)5.67198e-07,
-    (float)5.20408e-07,
-    (float)5.93671e-07,
-    (float)6.36094e-07,
-    (float)6.65113e-07,
-    (float)0.953209,
-    (float)0.00170711,
-    (float)0.0375808,
-    (float)0.000851275,
-    (float)0.00395178,
-    (float)0.00102555,
-    (float)0.000286798,
-    (float)0.000132083,
-    (float)9.06287e-05,
-    (float)0.000135038,
-    (float)0.000137235,
-    (float)0.000164588,
-    (float)3.57724e-05,
-    (float)0.000103905,
-    (float)6.08856e-05,
-    (float)0.000103883,
-    (float)3.42794e-05,
-    (float)4.34069e-05,
-    (float)4.15751e-05,
-    (float)3.92406e-06,
-    (float)2.42413e-05,
-    (float)4.80469e-06,
-    (float)1.4988e-05,
-    (float)1.28447e-05,
-    (float)7.5884e-06,
-    (float)7.7426e-06,
-    (float)1.10221e-05,
-    (float)8.16968e-06,
-    (float)6.25473e-06,
-    (float)7.30838e-06,
-    (float)6.98707e-06,
-    (float)3.9697e-06,
-    (float)1.24258e-05,
-    (float)6.67346e-06,
-    (float)6.97146e-06,
-    (float)9.73952e-06,
-    (float)3.87222e-06,
-    (float)7.56931e-06,
-    (float)3.33463e-06,
-    (float)4.3832e-06,
-    (float)4.22748e-06,
-    (float)3.55102e-06,
-    (float)2.5084e-06,
-    (float)2.92635e-06,
-    (float)3.47606e-06,
-    (float)1.76755e-06,
-    (float)2.37452e-06,
-    (float)2.85818e-06,
-    (float)1.51577e-06,
-    (float)3.11935e-06,
-    (float)2.53452e-06,
-    (float)2.36236e-06,
-    (float)2.64073e-06,
-    (float)2.4731e-06,
-    (float)2.98874e-06,
-    (float)2.34215e-06,
-    (float)2.61769e-06,
-    (float)1.62392e-06,
-    (float)2.43423e-06,
-    (float)2.24707e-06,
-    (float)1.58525e-06,
-    (float)2.15318e-06,
-    (float)9.90883e-07,
-    (float)1.27677e-06,
-    (float)1.87192e-06,
-    (float)1.29334e-06,
-    (float)1.18325e-06,
-    (float)1.25126e-06,
-    (float)1.72719e-06,
-    (float)1.35161e-06,
-    (float)1.67191e-06,
-    (float)1.3483e-06,
-    (float)1.14934e-06,
-    (float)1.71845e-06,
-    (float)1.31772e-06,
-    (float)1.54169e-06,
-    (float)1.71822e-06,
-    (float)1.29338e-06,
-    (float)1.71106e-06,
-    (float)1.26076e-06,
-    (float)1.1733e-06,
-    (float)1.09425e-06,
-    (float)1.2545e-06,
-    (float)1.00931e-06,
-    (float)8.63248e-07,
-    (float)1.21808e-06,
-    (float)9.15627e-07,
-    (float)1.33059e-06,
-    (float)1.02377e-06,
-    (float)9.05519e-07,
-    (float)1.11204e-06,
-    (float)9.73382e-07,
-    (float)9.62591e-07,
-    (float)1.27178e-06,
-    (float)1.12555e-06,
-    (float)1.17287e-06,
-    (float)1.20297e-06,
-    (float)1.34444e-06,
-    (float)8.78785e-07,
-    (float)1.16606e-06,
-    (float)9.8536e-07,
-    (float)8.34054e-07,
-    (float)1.12204e-06,
-    (float)7.71109e-07,
-    (float)9.81515e-07,
-    (float)8.7045e-07,
-    (float)8.75344e-07,
-    (float)8.71732e-07,
-    (float)9.45741e-07,
-    (float)7.32099e-07,
-    (float)7.48362e-07,
-    (float)9.65977e-07,
-    (float)9.49216e-07,
-    (float)8.64464e-07,
-    (float)1.13937e-06,
-    (float)8.29612e-07,
-    (float)1.10183e-06,
-    (float)1.0376e-06,
-    (float)9.01939e-07,
-    (float)9.49725e-07,
-    (float)8.14711e-07,
-    (float)9.50078e-07,
-    (float)8.62121e-07,
-    (float)9.84925e-07,
-    (float)6.67379e-07,
-    (float)8.27591e-07,
-    (float)8.55427e-07,
-    (float)6.75952e-07,
-    (float)0.932448,
-    (float)0.00220629,
-    (float)0.0552401,
-    (float)0.00121283,
-    (float)0.00521279,
-    (float)0.0012996,
-    (float)0.000440577,
-    (float)0.000168824,
-    (float)0.000115353,
-    (float)0.000178174,
-    (float)0.000201347,
-    (float)0.000245703,
-    (float)4.12885e-05,
-    (float)0.000142004,
-    (float)8.7938e-05,
-    (float)0.000150971,
-    (float)5.55819e-05,
-    (float)5.35541e-05,
-    (float)6.51978e-05,
-    (float)8.56811e-06,
-    (float)3.27093e-05,
-    (float)1.22169e-05,
-    (float)1.99302e-05,
-    (float)2.37444e-05,
-    (float)9.89501e-06,
-    (float)9.49396e-06,
-    (float)1.6249e-05,
-    (float)9.36115e-06,
-    (float)8.89682e-06,
-    (float)6.6256e-06,
-    (float)1.10849e-05,
-    (float)5.09712e-06,
-    (float)1.61102e-05,
-    (float)1.12563e-05,
-    (float)8.03228e-06,
-    (float)1.44057e-05,
-    (float)5.48955e-06,
-    (float)9.97268e-06,
-    (float)5.88283e-06,
-    (float)5.71942e-06,
-    (float)7.24923e-06,
-    (float)5.36994e-06,
-    (float)3.89642e-06,
-    (float)4.28378e-06,
-    (float)4.79006e-06,
-    (float)3.57383e-06,
-    (float)2.03151e-06,
-    (float)4.25738e-06,
-    (float)2.00555e-06,
-    (float)3.79587e-06,
-    (float)3.77065e-06,
-    (float)2.68218e-06,
-    (float)3.73669e-06,
-    (float)2.83656e-06,
-    (float)4.33017e-06,
-    (float)3.68017e-06,
-    (float)3.19958e-06,
-    (float)2.6187e-06,
-    (float)3.06339e-06,
-    (float)3.94796e-06,
-    (float)2.16342e-06,
-    (float)2.59424e-06,
-    (float)2.17807e-06,
-    (float)1.54926e-06,
-    (float)2.83327e-06,
-    (float)1.96217e-06,
-    (float)1.77539e-06,
-    (float)1.68333e-06,
-    (float)2.01983e-06,
-    (float)2.17612e-06,
-    (float)1.72539e-06,
-    (float)1.90104e-06,
-    (float)1.58214e-06,
-    (float)2.09139e-06,
-    (float)2.2965e-06,
-    (float)1.79435e-06,
-    (float)2.82485e-06,
-    (float)1.70539e-06,
-    (float)2.03556e-06,
-    (float)1.84964e-06,
-    (float)1.59359e-06,
-    (float)1.89717e-06,
-    (float)1.63207e-06,
-    (float)1.63363e-06,
-    (float)1.45557e-06,
-    (float)1.62306e-06,
-    (float)1.64695e-06,
-    (float)1.48268e-06,
-    (float)1.53305e-06,
-    (float)1.03451e-06,
-    (float)1.21664e-06,
-    (float)1.80964e-06,
-    (float)1.13955e-06,
-    (float)1.92624e-06,
-    (float)1.51218e-06,
-    (float)1.81264e-06,
-    (float)1.47853e-06,
-    (float)1.54976e-06,
-    (float)1.49615e-06,
-    (float)1.37273e-06,
-    (float)1.54426e-06,
-    (float)1.30405e-06,
-    (float)1.4762e-06,
-    (float)1.49703e-06,
-    (float)1.20986e-06,
-    (float)1.48111e-06,
-    (float)1.16725e-06,
-    (float)9.48491e-07,
-    (float)1.47421e-06,
-    (float)9.39792e-07,
-    (float)1.33948e-06,
-    (float)9.69305e-07,
-    (float)1.53571e-06,
-    (float)1.37306e-06,
-    (float)1.44346e-06,
-    (float)1.36394e-06,
-    (float)1.22324e-06,
-    (float)1.40411e-06,
-    (float)1.19491e-06,
-    (float)1.26351e-06,
-    (float)1.397e-06,
-    (float)1.16102e-06,
-    (float)1.37699e-06,
-    (float)1.39271e-06,
-    (float)1.08671e-06,
-    (float)1.23379e-06,
-    (float)8.63377e-07,
-    (float)1.33174e-06,
-    (float)0.906749,
-    (float)0.00270896,
-    (float)0.0775397,
-    (float)0.00164785,
-    (float)0.0065346,
-    (float)0.00157038,
-    (float)0.000645717,
-    (float)0.000209725,
-    (float)0.000137512,
-    (float)0.000230608,
-    (float)0.000279439,
-    (float)0.000345184,
-    (float)4.79333e-05,
-    (float)0.000184128,
-    (float)0.000123222,
-    (float)0.000205083,
-    (float)8.52158e-05,
-    (float)6.54952e-05,
-    (float)9.41394e-05,
-    (float)1.7102e-05,
-    (float)4.24149e-05,
-    (float)2.57352e-05,
-    (float)2.62558e-05,
-    (float)3.75287e-05,
-    (float)1.47121e-05,
-    (float)9.94374e-06,
-    (float)2.41172e-05,
-    (float)9.15474e-06,
-    (float)1.19753e-05,
-    (float)5.98662e-06,
-    (float)1.55342e-05,
-    (float)7.60254e-06,
-    (float)1.81422e-05,
-    (float)1.7015e-05,
-    (float)9.23335e-06,
-    (float)1.85226e-05,
-    (float)8.04698e-06,
-    (float)1.1362e-05,
-    (float)1.05949e-05,
-    (float)7.78831e-06,
-    (float)1.00919e-05,
-    (float)8.97565e-06,
-    (float)5.30195e-06,
-    (float)6.60963e-06,
-    (float)5.96786e-06,
-    (float)6.21068e-06,
-    (float)2.2561e-06,
-    (float)5.1254e-06,
-    (float)3.5554e-06,
-    (float)4.29376e-06,
-    (float)5.36762e-06,
-    (float)2.78701e-06,
-    (float)4.3396e-06,
-    (float)3.98895e-06,
-    (float)4.70107e-06,
-    (float)5.1284e-06,
-    (float)4.04031e-06,
-    (float)3.70586e-06,
-    (float)3.98784e-06,
-    (float)5.37131e-06,
-    (float)3.58876e-06,
-    (float)2.75433e-06,
-    (float)3.75037e-06,
-    (float)2.62755e-06,
-    (float)3.57899e-06,
-    (float)3.47994e-06,
-    (float)2.3312e-06,
-    (float)2.73399e-06,
-    (float)2.22997e-06,
-    (float)2.58087e-06,
-    (float)2.47336e-06,
-    (float)2.18227e-06,
-    (float)2.20546e-06,
-    (float)2.25719e-06,
-    (float)3.38769e-06,
-    (float)2.32826e-06,
-    (float)3.11545e-06,
-    (float)2.53002e-06,
-    (float)2.05306e-06,
-    (float)2.50286e-06,
-    (float)2.51444e-06,
-    (float)2.41011e-06,
-    (float)2.9022e-06,
-    (float)2.22326e-06,
-    (float)2.33514e-06,
-    (float)2.3394e-06,
-    (float)2.37574e-06,
-    (float)1.89969e-06,
-    (float)1.75208e-06,
-    (float)2.03266e-06,
-    (float)1.36494e-06,
-    (float)2.4834e-06,
-    (float)1.92717e-06,
-    (float)2.12238e-06,
-    (float)1.95801e-06,
-    (float)1.96819e-06,
-    (float)1.66879e-06,
-    (float)1.96398e-06,
-    (float)1.72195e-06,
-    (float)2.13777e-06,
-    (float)2.01354e-06,
-    (float)2.07832e-06,
-    (float)1.8393e-06,
-    (float)2.14542e-06,
-    (float)2.04696e-06,
-    (float)1.48283e-06,
-    (float)2.09868e-06,
-    (float)1.41224e-06,
-    (float)1.99327e-06,
-    (float)1.73177e-06,
-    (float)1.86501e-06,
-    (float)1.50291e-06,
-    (float)1.83388e-06,
-    (float)1.56055e-06,
-    (float)1.90084e-06,
-    (float)1.43483e-06,
-    (float)1.65708e-06,
-    (float)1.47723e-06,
-    (float)1.85167e-06,
-    (float)1.72519e-06,
-    (float)1.5452e-06,
-    (float)1.90075e-06,
-    (float)1.43308e-06,
-    (float)1.90439e-06,
-    (float)1.53719e-06,
-    (float)1.84102e-06,
-    (float)1.51217e-06,
-    (float)1.87843e-06,
-    (float)0.875593,
-    (float)0.00320014,
-    (float)0.105048,
-    (float)0.00214783,
-    (float)0.00786557,
-    (float)0.00181932,
-    (float)0.000910132,
-    (float)0.000255998,
-    (float)0.000159346,
-    (float)0.00029435,
-    (float)0.00037643,
-    (float)0.000459723,
-    (float)5.83432e-05,
-    (float)0.000231786,
-    (float)0.000169273,
-    (float)0.000268496,
-    (float)0.000125885,
-    (float)8.15976e-05,
-    (float)0.000128803,
-    (float)3.06853e-05,
-    (float)5.34056e-05,
-    (float)4.83501e-05,
-    (float)3.49492e-05,
-    (float)5.40623e-05,
-    (float)2.3196e-05,
-    (float)9.21728e-06,
-    (float)3.37408e-05,
-    (float)8.32007e-06,
-    (float)1.45713e-05,
-    (float)6.59817e-06,
-    (float)1.9451e-05,
-    (float)1.12718e-05,
-    (float)1.9578e-05,
-    (float)2.37922e-05,
-    (float)1.09206e-05,
-    (float)2.19656e-05,
-    (float)1.20951e-05,
-    (float)1.20928e-05,
-    (float)1.72253e-05,
-    (float)1.15815e-05,
-    (float)1.28089e-05,
-    (float)1.44004e-05,
-    (float)7.14386e-06,
-    (float)9.74541e-06,
-    (float)7.89412e-06,
-    (float)8.85595e-06,
-    (float)3.63136e-06,
-    (float)5.54248e-06,
-    (float)5.61672e-06,
-    (float)4.83851e-06,
-    (float)6.90266e-06,
-    (float)3.05758e-06,
-    (float)4.33578e-06,
-    (float)6.12153e-06,
-    (float)5.03881e-06,
-    (float)5.97187e-06,
-    (float)5.41318e-06,
-    (float)4.79947e-06,
-    (float)5.28128e-06,
-    (float)6.69977e-06,
-    (float)5.6513e-06,
-    (float)3.83149e-06,
-    (float)5.37614e-06,
-    (float)4.52125e-06,
-    (float)4.33348e-06,
-    (float)5.41808e-06,
-    (float)2.94254e-06,
-    (float)3.78655e-06,
-    (float)3.06851e-06,
-    (float)2.61305e-06,
-    (float)3.41395e-06,
-    (float)2.98924e-06,
-    (float)2.67817e-06,
-    (float)2.64159e-06,
-    (float)4.02523e-06,
-    (float)2.91883e-06,
-    (float)3.08088e-06,
-    (float)3.40219e-06,
-    (float)2.52805e-06,
-    (float)3.09561e-06,
-    (float)4.26551e-06,
-    (float)2.99625e-06,
-    (float)4.22808e-06,
-    (float)3.34135e-06,
-    (float)3.18116e-06,
-    (float)3.25823e-06,
-    (float)3.12615e-06,
-    (float)2.62761e-06,
-    (float)2.54398e-06,
-    (float)3.00792e-06,
-    (float)2.18781e-06,
-    (float)2.85517e-06,
-    (float)2.63926e-06,
-    (float)2.22336e-06,
-    (float)2.2074e-06,
-    (float)2.22528e-06,
-    (float)1.63242e-06,
-    (float)2.81016e-06,
-    (float)2.26576e-06,
-    (float)2.61472e-06,
-    (float)2.67417e-06,
-    (float)2.93138e-06,
-    (float)2.52675e-06,
-    (float)2.80468e-06,
-    (float)2.89112e-06,
-    (float)2.08778e-06,
-    (float)2.83306e-06,
-    (float)2.48067e-06,
-    (float)2.75101e-06,
-    (float)2.76242e-06,
-    (float)2.51202e-06,
-    (float)1.87968e-06,
-    (float)2.47304e-06,
-    (float)1.69066e-06,
-    (float)2.01975e-06,
-    (float)1.83239e-06,
-    (float)1.98534e-06,
-    (float)1.75106e-06,
-    (float)2.45091e-06,
-    (float)2.26425e-06,
-    (float)1.87346e-06,
-    (float)2.42677e-06,
-    (float)1.80812e-06,
-    (float)2.24366e-06,
-    (float)2.35116e-06,
-    (float)2.59248e-06,
-    (float)2.29481e-06,
-    (float)2.9589e-06,
-    (float)0.838799,
-    (float)0.00364023,
-    (float)0.138097,
-    (float)0.00270702,
-    (float)0.00912813,
-    (float)0.00204654,
-    (float)0.00123639,
-    (float)0.000306867,
-    (float)0.000182072,
-    (float)0.000368244,
-    (float)0.000486079,
-    (float)0.000584537,
-    (float)7.32008e-05,
-    (float)0.000285553,
-    (float)0.000221517,
-    (float)0.00033238,
-    (float)0.000178469,
-    (float)0.000101005,
-    (float)0.000164811,
-    (float)5.04315e-05,
-    (float)6.51343e-05,
-    (float)8.12398e-05,
-    (float)4.7823e-05,
-    (float)7.0494e-05,
-    (float)3.82592e-05,
-    (float)8.50698e-06,
-    (float)4.56692e-05,
-    (float)8.13215e-06,
-    (float)1.84236e-05,
-    (float)1.0087e-05,
-    (float)2.30111e-05,
-    (float)1.66057e-05,
-    (float)1.97901e-05,
-    (float)2.92456e-05,
-    (float)1.36914e-05,
-    (float)2.25002e-05,
-    (float)1.78161e-05,
-    (float)1.22133e-05,
-    (float)2.29786e-05,
-    (float)1.71392e-05,
-    (float)1.45919e-05,
-    (float)1.98821e-05,
-    (float)9.04924e-06,
-    (float)1.35266e-05,
-    (float)1.10072e-05,
-    (float)1.18993e-05,
-    (float)6.80404e-06,
-    (float)6.20983e-06,
-    (float)8.56623e-06,
-    (float)6.41557e-06,
-    (float)8.16773e-06,
-    (float)4.60206e-06,
-    (float)3.95266e-06,
-    (float)8.71624e-06,
-    (float)6.03699e-06,
-    (float)6.50648e-06,
-    (float)6.75157e-06,
-    (float)5.40503e-06,
-    (float)6.5589e-06,
-    (float)6.64203e-06,
-    (float)7.38375e-06,
-    (float)5.88577e-06,
-    (float)6.03972e-06,
-    (float)7.14313e-06,
-    (float)5.18927e-06,
-    (float)7.06582e-06,
-    (float)4.14853e-06,
-    (float)4.28612e-06,
-    (float)4.90913e-06,
-    (float)3.1187e-06,
-    (float)4.63612e-06,
-    (float)4.96346e-06,
-    (float)3.75867e-06,
-    (float)3.5608e-06,
-    (float)3.94728e-06,
-    (float)4.10456e-06,
-    (float)3.28266e-06,
-    (float)3.52143e-06,
-    (float)3.86824e-06,
-    (float)3.26207e-06,
-    (float)5.83714e-06,
-    (float)3.90737e-06,
-    (float)4.7159e-06,
-    (float)4.19356e-06,
-    (float)3.45743e-06,
-    (float)4.07731e-06,
-    (float)3.69591e-06,
-    (float)3.60973e-06,
-    (float)4.16234e-06,
-    (float)3.83123e-06,
-    (float)3.77628e-06,
-    (float)3.21928e-06,
-    (float)3.31793e-06,
-    (float)3.10089e-06,
-    (float)2.49005e-06,
-    (float)3.29216e-06,
-    (float)2.09029e-06,
-    (float)3.85193e-06,
-    (float)3.34121e-06,
-    (float)3.08723e-06,
-    (float)3.25339e-06,
-    (float)2.93379e-06,
-    (float)3.23377e-06,
-    (float)3.41141e-06,
-    (float)3.03563e-06,
-    (float)3.12067e-06,
-    (float)3.13852e-06,
-    (float)3.62593e-06,
-    (float)3.43774e-06,
-    (float)3.20093e-06,
-    (float)3.30179e-06,
-    (float)2.15233e-06,
-    (float)3.36105e-06,
-    (float)2.46203e-06,
-    (float)2.73892e-06,
-    (float)2.8474e-06,
-    (float)2.60693e-06,
-    (float)2.76836e-06,
-    (float)2.63537e-06,
-    (float)2.88468e-06,
-    (float)2.90809e-06,
-    (float)2.52243e-06,
-    (float)2.67181e-06,
-    (float)2.66571e-06,
-    (float)3.16912e-06,
-    (float)3.2536e-06,
-    (float)2.47768e-06,
-    (float)3.50256e-06,
-    (float)0.796143,
-    (float)0.00400507,
-    (float)0.177019,
-    (float)0.00330947,
-    (float)0.0102508,
-    (float)0.00223043,
-    (float)0.00161642,
-    (float)0.000365287,
-    (float)0.000210122,
-    (float)0.000460855,
-    (float)0.00060313,
-    (float)0.000712545,
-    (float)0.000101674,
-    (float)0.00034419,
-    (float)0.000283064,
-    (float)0.000397721,
-    (float)0.000243415,
-    (float)0.000129474,
-    (float)0.00019934,
-    (float)7.88223e-05,
-    (float)8.13173e-05,
-    (float)0.000125991,
-    (float)6.75349e-05,
-    (float)8.47715e-05,
-    (float)6.25794e-05,
-    (float)7.40471e-06,
-    (float)5.7626e-05,
-    (float)1.11997e-05,
-    (float)2.15956e-05,
-    (float)1.76671e-05,
-    (float)2.61257e-05,
-    (float)2.25972e-05,
-    (float)2.12943e-05,
-    (float)3.13871e-05,
-    (float)1.7649e-05,
-    (float)2.05512e-05,
-    (float)2.4461e-05,
-    (float)1.28711e-05,
-    (float)2.67856e-05,
-    (float)2.63948e-05,
-    (float)1.56938e-05,
-    (float)2.5434e-05,
-    (float)1.25999e-05,
-    (float)1.64569e-05,
-    (float)1.6299e-05,
-    (float)1.42855e-05,
-    (float)1.14143e-05,
-    (float)9.10735e-06,
-    (float)1.12134e-05,
-    (float)9.34642e-06,
-    (float)8.81404e-06,
-    (float)7.90952e-06,
-    (float)3.97793e-06,
-    (float)9.63509e-06,
-    (float)8.35086e-06,
-    (float)5.78118e-06,
-    (float)8.32023e-06,
-    (float)6.19662e-06,
-    (float)7.28289e-06,
-    (float)7.47251e-06,
-    (float)7.70709e-06,
-    (float)8.62597e-06,
-    (float)6.77694e-06,
-    (float)8.77819e-06,
-    (float)6.63245e-06,
-    (float)8.22081e-06,
-    (float)7.09157e-06,
-    (float)4.79826e-06,
-    (float)6.80185e-06,
-    (float)5.77363e-06,
-    (float)5.00398e-06,
-    (float)7.61272e-06,
-    (float)4.99558e-06,
-    (float)4.43607e-06,
-    (float)4.34366e-06,
-    (float)4.48797e-06,
-    (float)4.95793e-06,
-    (float)3.62885e-06,
-    (float)5.09571e-06,
-    (float)3.96818e-06,
-    (float)5.791e-06,
-    (float)5.18981e-06,
-    (float)4.22011e-06,
-    (float)4.97244e-06,
-    (float)4.55366e-06,
-    (float)3.98033e-06,
-    (float)5.65975e-06,
-    (float)4.45564e-06,
-    (float)5.77181e-06,
-    (float)5.13126e-06,
-    (float)4.57049e-06,
-    (float)4.68184e-06,
-    (float)3.85e-06,
-    (float)4.54328e-06,
-    (float)3.67545e-06,
-    (float)4.52034e-06,
-    (float)4.03196e-06,
-    (float)3.71583e-06,
-    (float)4.54674e-06,
-    (float)3.9114e-06,
-    (float)2.96962e-06,
-    (float)3.98043e-06,
-    (float)2.96126e-06,
-    (float)4.1393e-06,
-    (float)3.58148e-06,
-    (float)3.6199e-06,
-    (float)4.16295e-06,
-    (float)3.73246e-06,
-    (float)4.15351e-06,
-    (float)3.51499e-06,
-    (float)3.86634e-06,
-    (float)3.7273e-06,
-    (float)3.31804e-06,
-    (float)4.24656e-06,
-    (float)4.32494e-06,
-    (float)3.77308e-06,
-    (float)4.0993e-06,
-    (float)3.08165e-06,
-    (float)3.80795e-06,
-    (float)3.4026e-06,
-    (float)3.49669e-06,
-    (float)3.79973e-06,
-    (float)3.13448e-06,
-    (float)3.73953e-06,
-    (float)3.48423e-06,
-    (float)3.65371e-06,
-    (float)3.34892e-06,
-    (float)2.45098e-06,
-    (float)0.747627,
-    (float)0.00426224,
-    (float)0.221924,
-    (float)0.00391627,
-    (float)0.011176,
-    (float)0.00236368,
-    (float)0.0020407,
-    (float)0.000431736,
-    (float)0.000250899,
-    (float)0.000578602,
-    (float)0.000726739,
-    (float)0.000831595,
-    (float)0.00015064,
-    (float)0.000408817,
-    (float)0.000353372,
-    (float)0.000465969,
-    (float)0.000322091,
-    (float)0.000173507,
-    (float)0.000232634,
-    (float)0.000116048,
-    (float)0.000105014,
-    (float)0.000181521,
-    (float)9.67627e-05,
-    (float)9.69685e-05,
-    (float)9.69961e-05,
-    (float)8.20113e-06,
-    (float)6.72344e-05,
-    (float)2.06601e-05,
-    (float)2.43625e-05,
-    (float)2.79392e-05,
-    (float)2.9437e-05,
-    (float)2.58166e-05,
-    (float)2.56299e-05,
-    (float)2.98171e-05,
-    (float)2.22577e-05,
-    (float)1.9228e-05,
-    (float)3.06829e-05,
-    (float)1.53395e-05,
-    (float)2.76782e-05,
-    (float)3.79643e-05,
-    (float)1.81208e-05,
-    (float)2.8976e-05,
-    (float)1.96337e-05,
-    (float)1.97916e-05,
-    (float)2.40118e-05,
-    (float)1.81064e-05,
-    (float)1.47328e-05,
-    (float)1.49145e-05,
-    (float)1.32326e-05,
-    (float)1.24597e-05,
-    (float)1.04137e-05,
-    (float)1.17539e-05,
-    (float)5.86538e-06,
-    (float)8.75818e-06,
-    (float)1.10668e-05,
-    (float)5.47874e-06,
-    (float)8.01201e-06,
-    (float)7.54377e-06,
-    (float)6.81693e-06,
-    (float)9.47697e-06,
-    (float)8.62615e-06,
-    (float)1.03944e-05,
-    (float)9.31514e-06,
-    (float)9.7191e-06,
-    (float)7.69894e-06,
-    (float)9.35798e-06,
-    (float)1.04771e-05,
-    (float)7.34474e-06,
-    (float)7.86984e-06,
-    (float)1.04664e-05,
-    (float)6.74777e-06,
-    (float)9.01878e-06,
-    (float)6.92649e-06,
-    (float)4.48825e-06,
-    (float)5.63544e-06,
-    (float)5.03231e-06,
-    (float)5.73831e-06,
-    (float)5.65494e-06,
-    (float)5.74544e-06,
-    (float)4.56827e-06,
-    (float)5.43641e-06,
-    (float)5.45625e-06,
-    (float)4.46998e-06,
-    (float)4.40952e-06,
-    (float)6.43011e-06,
-    (float)4.5162e-06,
-    (float)7.54437e-06,
-    (float)6.88773e-06,
-    (float)6.30999e-06,
-    (float)6.89964e-06,
-    (float)5.68575e-06,
-    (float)5.08609e-06,
-    (float)6.33555e-06,
-    (float)6.24715e-06,
-    (float)5.60592e-06,
-    (float)6.1219e-06,
-    (float)5.90627e-06,
-    (float)4.77163e-06,
-    (float)4.1545e-06,
-    (float)4.94096e-06,
-    (float)3.14929e-06,
-    (float)4.57288e-06,
-    (float)3.91988e-06,
-    (float)3.83486e-06,
-    (float)4.63423e-06,
-    (float)4.56116e-06,
-    (float)3.6779e-06,
-    (float)4.55784e-06,
-    (float)4.16941e-06,
-    (float)4.38255e-06,
-    (float)4.80955e-06,
-    (float)5.18007e-06,
-    (float)4.92545e-06,
-    (float)5.35841e-06,
-    (float)6.03491e-06,
-    (float)4.95123e-06,
-    (float)5.24677e-06,
-    (float)4.70774e-06,
-    (float)4.22812e-06,
-    (float)5.1637e-06,
-    (float)5.03846e-06,
-    (float)3.8629e-06,
-    (float)4.52612e-06,
-    (float)4.05048e-06,
-    (float)3.94593e-06,
-    (float)3.83832e-06,
-    (float)3.60698e-06,
-    (float)3.08105e-06,
-    (float)0.69383,
-    (float)0.00438152,
-    (float)0.272447,
-    (float)0.00452949,
-    (float)0.0118078,
-    (float)0.00246168,
-    (float)0.00250156,
-    (float)0.000498228,
-    (float)0.000312531,
-    (float)0.000715737,
-    (float)0.000835051,
-    (float)0.000941538,
-    (float)0.000221285,
-    (float)0.000478524,
-    (float)0.000421709,
-    (float)0.000518762,
-    (float)0.000405568,
-    (float)0.000226156,
-    (float)0.000256286,
-    (float)0.000161633,
-    (float)0.000133609,
-    (float)0.000242841,
-    (float)0.000136899,
-    (float)0.0001042,
-    (float)0.000137064,
-    (float)1.35783e-05,
-    (float)7.68579e-05,
-    (float)4.00056e-05,
-    (float)3.16838e-05,
-    (float)4.21557e-05,
-    (float)3.84129e-05,
-    (float)2.95183e-05,
-    (float)3.31678e-05,
-    (float)2.52241e-05,
-    (float)2.73595e-05,
-    (float)1.87615e-05,
-    (float)3.50434e-05,
-    (float)1.98989e-05,
-    (float)2.62629e-05,
-    (float)4.66554e-05,
-    (float)2.10305e-05,
-    (float)2.76911e-05,
-    (float)2.56187e-05,
-    (float)2.1402e-05,
-    (float)2.98398e-05,
-    (float)2.335e-05,
-    (float)1.75103e-05,
-    (float)2.12926e-05,
-    (float)1.61794e-05,
-    (float)1.63131e-05,
-    (float)1.33579e-05,
-    (float)1.5753e-05,
-    (float)1.04554e-05,
-    (float)9.05528e-06,
-    (float)1.40516e-05,
-    (float)8.09603e-06,
-    (float)8.88168e-06,
-    (float)1.02605e-05,
-    (float)6.53883e-06,
-    (float)1.08281e-05,
-    (float)1.00057e-05,
-    (float)1.06694e-05,
-    (float)1.07745e-05,
-    (float)9.56692e-06,
-    (float)8.35602e-06,
-    (float)1.01867e-05,
-    (float)1.16938e-05,
-    (float)1.0077e-05,
-    (float)7.59593e-06,
-    (float)1.25762e-05,
-    (float)9.23263e-06,
-    (float)9.66258e-06,
-    (float)9.04726e-06,
-    (float)5.63866e-06,
-    (float)7.68503e-06,
-    (float)7.81781e-06,
-    (float)7.05462e-06,
-    (float)8.0356e-06,
-    (float)7.22072e-06,
-    (float)5.77828e-06,
-    (float)6.44928e-06,
-    (float)5.7505e-06,
-    (float)6.35467e-06,
-    (float)4.9019e-06,
-    (float)7.86592e-06,
-    (float)5.56021e-06,
-    (float)7.5559e-06,
-    (float)8.03873e-06,
-    (float)6.40016e-06,
-    (float)6.34376e-06,
-    (float)6.88404e-06,
-    (float)5.5079e-06,
-    (float)7.79514e-06,
-    (float)7.30786e-06,
-    (float)6.90683e-06,
-    (float)7.16829e-06,
-    (float)6.41699e-06,
-    (float)6.39744e-06,
-    (float)5.05262e-06,
-    (float)6.20343e-06,
-    (float)5.08711e-06,
-    (float)6.21968e-06,
-    (float)5.8614e-06,
-    (float)5.33695e-06,
-    (float)5.34192e-06,
-    (float)6.22904e-06,
-    (float)3.99087e-06,
-    (float)5.48859e-06,
-    (float)4.70284e-06,
-    (float)5.69103e-06,
-    (float)5.89867e-06,
-    (float)5.94655e-06,
-    (float)5.42945e-06,
-    (float)5.67076e-06,
-    (float)5.94797e-06,
-    (float)5.20775e-06,
-    (float)5.1966e-06,
-    (float)5.84433e-06,
-    (float)5.49302e-06,
-    (float)5.89682e-06,
-    (float)6.0214e-06,
-    (float)4.50569e-06,
-    (float)5.7349e-06,
-    (float)4.63364e-06,
-    (float)4.97664e-06,
-    (float)4.93671e-06,
-    (float)5.48274e-06,
-    (float)4.78744e-06,
-    (float)0.63507,
-    (float)0.00437491,
-    (float)0.328312,
-    (float)0.00508775,
-    (float)0.0121256,
-    (float)0.00249203,
-    (float)0.00297098,
-    (float)0.000566594,
-    (float)0.000415897,
-    (float)0.000872785,
-    (float)0.000933267,
-    (float)0.00102864,
-    (float)0.000319322,
-    (float)0.000550826,
-    (float)0.000494556,
-    (float)0.000567923,
-    (float)0.000504256,
-    (float)0.00029217,
-    (float)0.000275561,
-    (float)0.000219531,
-    (float)0.000171998,
-    (float)0.000308216,
-    (float)0.000193183,
-    (float)0.000111495,
-    (float)0.000185141,
-    (float)2.70762e-05,
-    (float)8.46201e-05,
-    (float)6.96439e-05,
-    (float)4.20576e-05,
-    (float)5.64189e-05,
-    (float)5.23277e-05,
-    (float)2.99962e-05,
-    (float)4.30011e-05,
-    (float)2.15572e-05,
-    (float)3.22695e-05,
-    (float)2.01616e-05,
-    (float)3.50785e-05,
-    (float)2.6339e-05,
-    (float)2.33613e-05,
-    (float)5.14209e-05,
-    (float)2.65503e-05,
-    (float)2.55413e-05,
-    (float)3.34477e-05,
-    (float)2.41345e-05,
-    (float)3.30841e-05,
-    (float)3.10467e-05,
-    (float)1.94125e-05,
-    (float)2.79451e-05,
-    (float)2.07767e-05,
-    (float)2.11739e-05,
-    (float)1.94105e-05,
-    (float)1.93971e-05,
-    (float)1.69031e-05,
-    (float)9.9349e-06,
-    (float)1.47892e-05,
-    (float)1.26447e-05,
-    (float)9.65154e-06,
-    (float)1.36841e-05,
-    (float)7.58853e-06,
-    (float)1.09159e-05,
-    (float)1.33441e-05,
-    (float)9.57451e-06,
-    (float)1.04198e-05,
-    (float)9.14668e-06,
-    (float)8.47777e-06,
-    (float)1.22251e-05,
-    (float)1.18887e-05,
-    (float)1.40924e-05,
-    (float)8.91315e-06,
-    (float)1.23606e-05,
-    (float)1.21322e-05,
-    (float)9.5663e-06,
-    (float)1.12442e-05,
-    (float)9.00471e-06,
-    (float)8.99167e-06,
-    (float)1.32463e-05,
-    (float)8.97176e-06,
-    (float)9.55952e-06,
-    (float)9.4464e-06,
-    (float)6.19128e-06,
-    (float)7.72591e-06,
-    (float)6.37076e-06,
-    (float)8.75564e-06,
-    (float)7.15034e-06,
-    (float)7.93547e-06,
-    (float)7.70958e-06,
-    (float)6.71499e-06,
-    (float)6.96082e-06,
-    (float)7.40737e-06,
-    (float)5.10902e-06,
-    (float)8.90437e-06,
-    (float)6.76476e-06,
-    (float)8.38495e-06,
-    (float)8.98149e-06,
-    (float)7.32084e-06,
-    (float)8.39276e-06,
-    (float)7.16409e-06,
-    (float)7.16398e-06,
-    (float)7.84925e-06,
-    (float)7.75118e-06,
-    (float)8.29289e-06,
-    (float)8.23538e-06,
-    (float)6.94516e-06,
-    (float)8.2313e-06,
-    (float)5.40295e-06,
-    (float)7.74672e-06,
-    (float)5.696e-06,
-    (float)6.20216e-06,
-    (float)6.70742e-06,
-    (float)6.48725e-06,
-    (float)6.38566e-06,
-    (float)6.68298e-06,
-    (float)4.91897e-06,
-    (float)6.46687e-06,
-    (float)5.14035e-06,
-    (float)5.97237e-06,
-    (float)6.07937e-06,
-    (float)5.76168e-06,
-    (float)7.40695e-06,
-    (float)5.64861e-06,
-    (float)6.64562e-06,
-    (float)6.44549e-06,
-    (float)6.19544e-06,
-    (float)6.55207e-06,
-    (float)6.59928e-06,
-    (float)6.07536e-06,
-    (float)8.11373e-06,
-    (float)5.89819e-06,
-    (float)0.572521,
-    (float)0.00422036,
-    (float)0.388528,
-    (float)0.00554614,
-    (float)0.0120618,
-    (float)0.00246444,
-    (float)0.00341874,
-    (float)0.00063852,
-    (float)0.000569828,
-    (float)0.00104872,
-    (float)0.00100518,
-    (float)0.00108306,
-    (float)0.000453829,
-    (float)0.000624062,
-    (float)0.000565946,
-    (float)0.000616346,
-    (float)0.000602036,
-    (float)0.000371428,
-    (float)0.000293615,
-    (float)0.000284598,
-    (float)0.000226859,
-    (float)0.000375166,
-    (float)0.000264949,
-    (float)0.000120837,
-    (float)0.000229674,
-    (float)5.29849e-05,
-    (float)9.24058e-05,
-    (float)0.000109237,
-    (float)6.06778e-05,
-    (float)6.80225e-05,
-    (float)7.58401e-05,
-    (float)2.70466e-05,
-    (float)4.98971e-05,
-    (float)2.30129e-05,
-    (float)3.36158e-05,
-    (float)2.54377e-05,
-    (float)3.42957e-05,
-    (float)3.34101e-05,
-    (float)2.3072e-05,
-    (float)4.91295e-05,
-    (float)3.37745e-05,
-    (float)2.2536e-05,
-    (float)3.83353e-05,
-    (float)3.01052e-05,
-    (float)3.33438e-05,
-    (float)4.28005e-05,
-    (float)2.27917e-05,
-    (float)3.06432e-05,
-    (float)2.91367e-05,
-    (float)2.39283e-05,
-    (float)2.6146e-05,
-    (float)2.50505e-05,
-    (float)2.24605e-05,
-    (float)1.43702e-05,
-    (float)1.49503e-05,
-    (float)1.76541e-05,
-    (float)1.27197e-05,
-    (float)1.46557e-05,
-    (float)1.09293e-05,
-    (float)8.77754e-06,
-    (float)1.64883e-05,
-    (float)1.06835e-05,
-    (float)8.13083e-06,
-    (float)1.08201e-05,
-    (float)8.54224e-06,
-    (float)1.28055e-05,
-    (float)1.31709e-05,
-    (float)1.46404e-05,
-    (float)1.16397e-05,
-    (float)1.24368e-05,
-    (float)1.37474e-05,
-    (float)1.19064e-05,
-    (float)1.22928e-05,
-    (float)1.4749e-05,
-    (float)9.73954e-06,
-    (float)1.58849e-05,
-    (float)1.37512e-05,
-    (float)9.68984e-06,
-    (float)1.18845e-05,
-    (float)8.99105e-06,
-    (float)7.94051e-06,
-    (float)9.8362e-06,
-    (float)9.47404e-06,
-    (float)9.30777e-06,
-    (float)9.10452e-06,
-    (float)7.19846e-06,
-    (float)7.6355e-06,
-    (float)5.82874e-06,
-    (float)8.55386e-06,
-    (float)5.93916e-06,
-    (float)8.72556e-06,
-    (float)9.33805e-06,
-    (float)7.89615e-06,
-    (float)9.06691e-06,
-    (float)9.66472e-06,
-    (float)7.39738e-06,
-    (float)1.01267e-05,
-    (float)8.54418e-06,
-    (float)8.87175e-06,
-    (float)1.15177e-05,
-    (float)1.0226e-05,
-    (float)1.00912e-05,
-    (float)8.48479e-06,
-    (float)9.43687e-06,
-    (float)8.07296e-06,
-    (float)8.29837e-06,
-    (float)8.36424e-06,
-    (float)8.48465e-06,
-    (float)7.04306e-06,
-    (float)8.61829e-06,
-    (float)5.32781e-06,
-    (float)7.27293e-06,
-    (float)6.35936e-06,
-    (float)5.34685e-06,
-    (float)6.32911e-06,
-    (float)7.09694e-06,
-    (float)6.65054e-06,
-    (float)6.98493e-06,
-    (float)6.61381e-06,
-    (float)6.76858e-06,
-    (float)6.92437e-06,
-    (float)7.44393e-06,
-    (float)8.89603e-06,
-    (float)7.3397e-06,
-    (float)9.69511e-06,
-    (float)7.55943e-06,
-    (float)8.4419e-06,
-    (float)9.17585e-06,
-    (float)0.507664,
-    (float)0.00390371,
-    (float)0.451776,
-    (float)0.00590713,
-    (float)0.0116009,
-    (float)0.00240829,
-    (float)0.00383088,
-    (float)0.000700227,
-    (float)0.000780398,
-    (float)0.00124284,
-    (float)0.00103191,
-    (float)0.00110746,
-    (float)0.000611865,
-    (float)0.000691442,
-    (float)0.000627888,
-    (float)0.000651434,
-    (float)0.000684182,
-    (float)0.000454061,
-    (float)0.000308469,
-    (float)0.000346171,
-    (float)0.000283633,
-    (float)0.000430899,
-    (float)0.000345782,
-    (float)0.000133307,
-    (float)0.000265087,
-    (float)9.15887e-05,
-    (float)0.000104874,
-    (float)0.000151189,
-    (float)9.02305e-05,
-    (float)7.82882e-05,
-    (float)0.000109449,
-    (float)2.7901e-05,
-    (float)5.76257e-05,
-    (float)3.56561e-05,
-    (float)3.75561e-05,
-    (float)3.32123e-05,
-    (float)3.61733e-05,
-    (float)3.80191e-05,
-    (float)2.71623e-05,
-    (float)4.23837e-05,
-    (float)3.99678e-05,
-    (float)2.22156e-05,
-    (float)3.76453e-05,
-    (float)3.51349e-05,
-    (float)2.89012e-05,
-    (float)4.75934e-05,
-    (float)2.77994e-05,
-    (float)2.88957e-05,
-    (float)3.57095e-05,
-    (float)2.73277e-05,
-    (float)2.97449e-05,
-    (float)3.08757e-05,
-    (float)2.4867e-05,
-    (float)1.84349e-05,
-    (float)1.85455e-05,
-    (float)2.23988e-05,
-    (float)1.95496e-05,
-    (float)1.75719e-05,
-    (float)1.64568e-05,
-    (float)9.30277e-06,
-    (float)1.72265e-05,
-    (float)1.49636e-05,
-    (float)8.32169e-06,
-    (float)1.24201e-05,
-    (float)1.15748e-05,
-    (float)1.3537e-05,
-    (float)1.53578e-05,
-    (float)1.3224e-05,
-    (float)1.05601e-05,
-    (float)1.29599e-05,
-    (float)1.17825e-05,
-    (float)1.3233e-05,
-    (float)1.33101e-05,
-    (float)1.85103e-05,
-    (float)1.10094e-05,
-    (float)1.34038e-05,
-    (float)1.50223e-05,
-    (float)1.17318e-05,
-    (float)1.18207e-05,
-    (float)1.2897e-05,
-    (float)9.45156e-06,
-    (float)1.38894e-05,
-    (float)1.30915e-05,
-    (float)1.01096e-05,
-    (float)1.12431e-05,
-    (float)8.21071e-06,
-    (float)8.84874e-06,
-    (float)8.83301e-06,
-    (float)1.11091e-05,
-    (float)8.96673e-06,
-    (float)1.03729e-05,
-    (float)9.51227e-06,
-    (float)8.79899e-06,
-    (float)7.56253e-06,
-    (float)1.13069e-05,
-    (float)7.55436e-06,
-    (float)1.0304e-05,
-    (float)1.07763e-05,
-    (float)9.07168e-06,
-    (float)1.05819e-05,
-    (float)1.09499e-05,
-    (float)8.76022e-06,
-    (float)9.48871e-06,
-    (float)1.00164e-05,
-    (float)9.01796e-06,
-    (float)1.08691e-05,
-    (float)9.82796e-06,
-    (float)9.97149e-06,
-    (float)8.01367e-06,
-    (float)9.74482e-06,
-    (float)7.46955e-06,
-    (float)8.96737e-06,
-    (float)9.13427e-06,
-    (float)8.42484e-06,
-    (float)7.36982e-06,
-    (float)9.57667e-06,
-    (float)8.06099e-06,
-    (float)8.69265e-06,
-    (float)8.22653e-06,
-    (float)6.81478e-06,
-    (float)8.42279e-06,
-    (float)9.58196e-06,
-    (float)8.9582e-06,
-    (float)7.87851e-06,
-    (float)9.38335e-06,
-    (float)8.01028e-06,
-    (float)9.04004e-06,
-    (float)8.49024e-06,
-    (float)0.441489,
-    (float)0.00348452,
-    (float)0.516949,
-    (float)0.00609264,
-    (float)0.0108207,
-    (float)0.00229839,
-    (float)0.00415762,
-    (float)0.000756958,
-    (float)0.00108506,
-    (float)0.00142309,
-    (float)0.00101895,
-    (float)0.00110382,
-    (float)0.000784692,
-    (float)0.000761399,
-    (float)0.000693428,
-    (float)0.00068308,
-    (float)0.000760083,
-    (float)0.000538491,
-    (float)0.000329062,
-    (float)0.00041806,
-    (float)0.000353588,
-    (float)0.000484223,
-    (float)0.000441077,
-    (float)0.000155128,
-    (float)0.000291295,
-    (float)0.000148459,
-    (float)0.000125809,
-    (float)0.000196925,
-    (float)0.000135935,
-    (float)8.85267e-05,
-    (float)0.000145028,
-    (float)3.3181e-05,
-    (float)6.29069e-05,
-    (float)5.59434e-05,
-    (float)4.41351e-05,
-    (float)4.15861e-05,
-    (float)4.1564e-05,
-    (float)3.92981e-05,
-    (float)3.22525e-05,
-    (float)3.32584e-05,
-    (float)4.3001e-05,
-    (float)2.4085e-05,
-    (float)3.40371e-05,
-    (float)4.08156e-05,
-    (float)2.60329e-05,
-    (float)4.71455e-05,
-    (float)3.55352e-05,
-    (float)2.66159e-05,
-    (float)3.89352e-05,
-    (float)3.21728e-05,
-    (float)3.43967e-05,
-    (float)3.79277e-05,
-    (float)2.72724e-05,
-    (float)2.26049e-05,
-    (float)2.46125e-05,
-    (float)2.69477e-05,
-    (float)2.75664e-05,
-    (float)2.00911e-05,
-    (float)2.26482e-05,
-    (float)1.30799e-05,
-    (float)1.58644e-05,
-    (float)1.90929e-05,
-    (float)1.18364e-05,
-    (float)1.31198e-05,
-    (float)1.45332e-05,
-    (float)1.28631e-05,
-    (float)1.63023e-05,
-    (float)1.36398e-05,
-    (float)8.87293e-06,
-    (float)1.25399e-05,
-    (float)1.02736e-05,
-    (float)1.50389e-05,
-    (float)1.37848e-05,
-    (float)1.88968e-05,
-    (float)1.35515e-05,
-    (float)1.20737e-05,
-    (float)1.4359e-05,
-    (float)1.57923e-05,
-    (float)1.20382e-05,
-    (float)1.68847e-05,
-    (float)1.23183e-05,
-    (float)1.60198e-05,
-    (float)1.77793e-05,
-    (float)1.2191e-05,
-    (float)1.25102e-05,
-    (float)1.12812e-05,
-    (float)1.08155e-05,
-    (float)1.23087e-05,
-    (float)1.37762e-05,
-    (float)1.18295e-05,
-    (float)1.21494e-05,
-    (float)8.34273e-06,
-    (float)1.0524e-05,
-    (float)7.37318e-06,
-    (float)1.11391e-05,
-    (float)9.38078e-06,
-    (float)9.87852e-06,
-    (float)1.05689e-05,
-    (float)1.04066e-05,
-    (float)8.81596e-06,
-    (float)1.08215e-05,
-    (float)8.42286e-06,
-    (float)9.77769e-06,
-    (float)1.10879e-05,
-    (float)1.04399e-05,
-    (float)1.28344e-05,
-    (float)1.11121e-05,
-    (float)1.16489e-05,
-    (float)9.75499e-06,
-    (float)1.03801e-05,
-    (float)1.09828e-05,
-    (float)1.26164e-05,
-    (float)1.13232e-05,
-    (float)1.21115e-05,
-    (float)9.09604e-06,
-    (float)1.15934e-05,
-    (float)1.04312e-05,
-    (float)1.01167e-05,
-    (float)1.00571e-05,
-    (float)9.12439e-06,
-    (float)9.65854e-06,
-    (float)1.01593e-05,
-    (float)9.29651e-06,
-    (float)8.85228e-06,
-    (float)8.16408e-06,
-    (float)7.55789e-06,
-    (float)9.64866e-06,
-    (float)8.74681e-06,
-    (float)0.375947,
-    (float)0.00296711,
-    (float)0.582156,
-    (float)0.00613173,
-    (float)0.00973614,
-    (float)0.00212927,
-    (float)0.00438047,
-    (float)0.000802167,
-    (float)0.00147056,
-    (float)0.00160341,
-    (float)0.000970663,
-    (float)0.00106736,
-    (float)0.000963168,
-    (float)0.000825045,
-    (float)0.000754103,
-    (float)0.000710836,
-    (float)0.000814686,
-    (float)0.000623868,
-    (float)0.000362261,
-    (float)0.000488366,
-    (float)0.000426053,
-    (float)0.000528396,
-    (float)0.000538627,
-    (float)0.000187433,
-    (float)0.000309789,
-    (float)0.000223199,
-    (float)0.000154839,
-    (float)0.000239389,
-    (float)0.000193614,
-    (float)9.83818e-05,
-    (float)0.000183527,
-    (float)5.06598e-05,
-    (float)6.73839e-05,
-    (float)8.54986e-05,
-    (float)5.59839e-05,
-    (float)4.84906e-05,
-    (float)5.49055e-05,
-    (float)3.77288e-05,
-    (float)3.98994e-05,
-    (float)2.94228e-05,
-    (float)4.38293e-05,
-    (float)2.82917e-05,
-    (float)2.92939e-05,
-    (float)4.44653e-05,
-    (float)2.42262e-05,
-    (float)4.02171e-05,
-    (float)4.61766e-05,
-    (float)2.48741e-05,
-    (float)3.88897e-05,
-    (float)3.7419e-05,
-    (float)3.32881e-05,
-    (float)4.25948e-05,
-    (float)3.06176e-05,
-    (float)2.47503e-05,
-    (float)3.36921e-05,
-    (float)3.07572e-05,
-    (float)3.3794e-05,
-    (float)2.31246e-05,
-    (float)2.47695e-05,
-    (float)1.96395e-05,
-    (float)1.56881e-05,
-    (float)2.25059e-05,
-    (float)1.94206e-05,
-    (float)1.41011e-05,
-    (float)1.9109e-05,
-    (float)1.21111e-05,
-    (float)1.3223e-05,
-    (float)1.75848e-05,
-    (float)8.07586e-06,
-    (float)1.31209e-05,
-    (float)1.26522e-05,
-    (float)1.57032e-05,
-    (float)1.5068e-05,
-    (float)1.62438e-05,
-    (float)1.3427e-05,
-    (float)1.3117e-05,
-    (float)1.20769e-05,
-    (float)2.09049e-05,
-    (float)1.36751e-05,
-    (float)1.82785e-05,
-    (float)1.69612e-05,
-    (float)1.39055e-05,
-    (float)1.87038e-05,
-    (float)1.60233e-05,
-    (float)1.17143e-05,
-    (float)1.71438e-05,
-    (float)1.44773e-05,
-    (float)1.35189e-05,
-    (float)1.69799e-05,
-    (float)1.12711e-05,
-    (float)1.32209e-05,
-    (float)9.90285e-06,
-    (float)1.13511e-05,
-    (float)1.07025e-05,
-    (float)1.152e-05,
-    (float)1.10764e-05,
-    (float)1.12142e-05,
-    (float)7.94815e-06,
-    (float)1.25172e-05,
-    (float)7.8298e-06,
-    (float)1.0573e-05,
-    (float)1.18733e-05,
-    (float)9.78238e-06,
-    (float)1.22948e-05,
-    (float)1.24772e-05,
-    (float)1.129e-05,
-    (float)1.34289e-05,
-    (float)1.19352e-05,
-    (float)1.17927e-05,
-    (float)1.37786e-05,
-    (float)1.25684e-05,
-    (float)1.57437e-05,
-    (float)1.23865e-05,
-    (float)1.30647e-05,
-    (float)1.28142e-05,
-    (float)1.15081e-05,
-    (float)1.32368e-05,
-    (float)1.32387e-05,
-    (float)9.84578e-06,
-    (float)1.29164e-05,
-    (float)9.83835e-06,
-    (float)9.81333e-06,
-    (float)1.16735e-05,
-    (float)8.83622e-06,
-    (float)9.01127e-06,
-    (float)8.96248e-06,
-    (float)8.81447e-06,
-    (float)1.04742e-05,
-    (float)0.312907,
-    (float)0.00236956,
-    (float)0.645598,
-    (float)0.00598314,
-    (float)0.00838995,
-    (float)0.00197245,
-    (float)0.00450288,
-    (float)0.000849805,
-    (float)0.00193003,
-    (float)0.00175317,
-    (float)0.000875008,
-    (float)0.00100504,
-    (float)0.00114205,
-    (float)0.0008877,
-    (float)0.000800848,
-    (float)0.000738907,
-    (float)0.000826631,
-    (float)0.000687128,
-    (float)0.000409292,
-    (float)0.00053849,
-    (float)0.000494789,
-    (float)0.00056779,
-    (float)0.00061704,
-    (float)0.000224274,
-    (float)0.000312603,
-    (float)0.000297549,
-    (float)0.000197375,
-    (float)0.000270831,
-    (float)0.000261193,
-    (float)0.000113413,
-    (float)0.000211393,
-    (float)8.44877e-05,
-    (float)7.38505e-05,
-    (float)0.000116925,
-    (float)8.39588e-05,
-    (float)5.48398e-05,
-    (float)7.70621e-05,
-    (float)4.02914e-05,
-    (float)4.63955e-05,
-    (float)3.76734e-05,
-    (float)4.28193e-05,
-    (float)3.42492e-05,
-    (float)3.09727e-05,
-    (float)4.22312e-05,
-    (float)2.66121e-05,
-    (float)3.05059e-05,
-    (float)5.08301e-05,
-    (float)2.66368e-05,
-    (float)3.12977e-05,
-    (float)4.06932e-05,
-    (float)3.09135e-05,
-    (float)3.81817e-05,
-    (float)3.65959e-05,
-    (float)2.21079e-05,
-    (float)3.64131e-05,
-    (float)3.70237e-05,
-    (float)3.43153e-05,
-    (float)2.64137e-05,
-    (float)2.66664e-05,
-    (float)2.35523e-05,
-    (float)2.06849e-05,
-    (float)2.35131e-05,
-    (float)2.75115e-05,
-    (float)1.94432e-05,
-    (float)2.16419e-05,
-    (float)1.65126e-05,
-    (float)1.14408e-05,
-    (float)2.15648e-05,
-    (float)1.32175e-05,
-    (float)1.18602e-05,
-    (float)1.70807e-05,
-    (float)1.80017e-05,
-    (float)1.38199e-05,
-    (float)1.78423e-05,
-    (float)9.84085e-06,
-    (float)1.27472e-05,
-    (float)1.28912e-05,
-    (float)1.9448e-05,
-    (float)1.51091e-05,
-    (float)1.75909e-05,
-    (float)1.7207e-05,
-    (float)1.39507e-05,
-    (float)1.32468e-05,
-    (float)1.79855e-05,
-    (float)1.29263e-05,
-    (float)1.69746e-05,
-    (float)1.98441e-05,
-    (float)1.36252e-05,
-    (float)1.79166e-05,
-    (float)1.46833e-05,
-    (float)1.1625e-05,
-    (float)1.33384e-05,
-    (float)1.5799e-05,
-    (float)1.23669e-05,
-    (float)1.71962e-05,
-    (float)1.29212e-05,
-    (float)1.3858e-05,
-    (float)1.04375e-05,
-    (float)1.28137e-05,
-    (float)1.02255e-05,
-    (float)1.29715e-05,
-    (float)1.40454e-05,
-    (float)1.36568e-05,
-    (float)1.03827e-05,
-    (float)1.44299e-05,
-    (float)1.08347e-05,
-    (float)1.08803e-05,
-    (float)1.36663e-05,
-    (float)1.16796e-05,
-    (float)1.28829e-05,
-    (float)1.50157e-05,
-    (float)1.25266e-05,
-    (float)1.18766e-05,
-    (float)1.3306e-05,
-    (float)1.10998e-05,
-    (float)1.29219e-05,
-    (float)1.32798e-05,
-    (float)1.38907e-05,
-    (float)1.17364e-05,
-    (float)1.28107e-05,
-    (float)1.21242e-05,
-    (float)1.13346e-05,
-    (float)1.21528e-05,
-    (float)1.37566e-05,
-    (float)1.01004e-05,
-    (float)1.24293e-05,
-    (float)1.23308e-05,
-    (float)1.10315e-05,
-    (float)0.253587,
-    (float)0.0018047,
-    (float)0.705832,
-    (float)0.00564867,
-    (float)0.00692385,
-    (float)0.00176851,
-    (float)0.00445264,
-    (float)0.000869015,
-    (float)0.00247632,
-    (float)0.00184592,
-    (float)0.000759911,
-    (float)0.000934455,
-    (float)0.00127623,
-    (float)0.000931547,
-    (float)0.000854515,
-    (float)0.000759678,
-    (float)0.000822219,
-    (float)0.000746845,
-    (float)0.000472373,
-    (float)0.000583385,
-    (float)0.000568374,
-    (float)0.000596318,
-    (float)0.000688058,
-    (float)0.000278392,
-    (float)0.000321666,
-    (float)0.000378505,
-    (float)0.000258364,
-    (float)0.000296854,
-    (float)0.0003358,
-    (float)0.000139376,
-    (float)0.000231322,
-    (float)0.000136547,
-    (float)9.25834e-05,
-    (float)0.000142591,
-    (float)0.000121193,
-    (float)6.49341e-05,
-    (float)9.87061e-05,
-    (float)4.97637e-05,
-    (float)5.11617e-05,
-    (float)5.06081e-05,
-    (float)4.4001e-05,
-    (float)3.89472e-05,
-    (float)3.35979e-05,
-    (float)3.62836e-05,
-    (float)3.05358e-05,
-    (float)2.56184e-05,
-    (float)4.64906e-05,
-    (float)3.08473e-05,
-    (float)2.41786e-05,
-    (float)3.76484e-05,
-    (float)3.06234e-05,
-    (float)3.29133e-05,
-    (float)4.18758e-05,
-    (float)2.42538e-05,
-    (float)3.46854e-05,
-    (float)4.02125e-05,
-    (float)3.53486e-05,
-    (float)2.89425e-05,
-    (float)3.05608e-05,
-    (float)2.71268e-05,
-    (float)2.85039e-05,
-    (float)2.71183e-05,
-    (float)3.35279e-05,
-    (float)2.44572e-05,
-    (float)2.18328e-05,
-    (float)2.02011e-05,
-    (float)1.52007e-05,
-    (float)2.24493e-05,
-    (float)2.15451e-05,
-    (float)1.40931e-05,
-    (float)1.65244e-05,
-    (float)1.83174e-05,
-    (float)1.17396e-05,
-    (float)1.69963e-05,
-    (float)1.04553e-05,
-    (float)1.24252e-05,
-    (float)1.38881e-05,
-    (float)1.76656e-05,
-    (float)1.38848e-05,
-    (float)1.49222e-05,
-    (float)1.33254e-05,
-    (float)1.50633e-05,
-    (float)1.20385e-05,
-    (float)1.797e-05,
-    (float)1.72442e-05,
-    (float)1.67842e-05,
-    (float)1.88447e-05,
-    (float)1.51989e-05,
-    (float)1.65922e-05,
-    (float)1.91326e-05,
-    (float)1.60826e-05,
-    (float)1.60165e-05,
-    (float)2.05616e-05,
-    (float)1.57658e-05,
-    (float)1.8668e-05,
-    (float)1.56278e-05,
-    (float)1.56767e-05,
-    (float)1.47973e-05,
-    (float)1.66992e-05,
-    (float)1.34172e-05,
-    (float)1.57582e-05,
-    (float)1.37316e-05,
-    (float)1.47259e-05,
-    (float)1.1172e-05,
-    (float)1.28861e-05,
-    (float)1.23366e-05,
-    (float)1.20938e-05,
-    (float)1.22002e-05,
-    (float)1.2266e-05,
-    (float)1.09266e-05,
-    (float)1.24746e-05,
-    (float)1.17e-05,
-    (float)1.09197e-05,
-    (float)1.27297e-05,
-    (float)1.19942e-05,
-    (float)1.28691e-05,
-    (float)1.28883e-05,
-    (float)1.32389e-05,
-    (float)1.29175e-05,
-    (float)1.46765e-05,
-    (float)1.35944e-05,
-    (float)1.42678e-05,
-    (float)1.43761e-05,
-    (float)1.61036e-05,
-    (float)1.43668e-05,
-    (float)1.53457e-05,
-    (float)1.5012e-05,
-    (float)1.58924e-05,
-    (float)0.1993,
-    (float)0.00126509,
-    (float)0.761385,
-    (float)0.00514626,
-    (float)0.00541545,
-    (float)0.00157286,
-    (float)0.00431581,
-    (float)0.000884834,
-    (float)0.0031052,
-    (float)0.00188007,
-    (float)0.000630139,
-    (float)0.000857605,
-    (float)0.00138719,
-    (float)0.000972522,
-    (float)0.000912013,
-    (float)0.000773137,
-    (float)0.000787242,
-    (float)0.000782674,
-    (float)0.000541979,
-    (float)0.000617016,
-    (float)0.000637713,
-    (float)0.000618691,
-    (float)0.000736549,
-    (float)0.000330804,
-    (float)0.00032856,
-    (float)0.000447679,
-    (float)0.000326572,
-    (float)0.000319334,
-    (float)0.000409284,
-    (float)0.000171022,
-    (float)0.000240062,
-    (float)0.000197043,
-    (float)0.000120873,
-    (float)0.000164877,
-    (float)0.000168867,
-    (float)7.90989e-05,
-    (float)0.000121206,
-    (float)7.31509e-05,
-    (float)5.6602e-05,
-    (float)6.73923e-05,
-    (float)5.61236e-05,
-    (float)4.57455e-05,
-    (float)4.20593e-05,
-    (float)3.42626e-05,
-    (float)3.60348e-05,
-    (float)2.77967e-05,
-    (float)4.11591e-05,
-    (float)3.61202e-05,
-    (float)1.97985e-05,
-    (float)3.24921e-05,
-    (float)3.09941e-05,
-    (float)2.5396e-05,
-    (float)4.33621e-05,
-    (float)2.80534e-05,
-    (float)2.90602e-05,
-    (float)3.88187e-05,
-    (float)3.36015e-05,
-    (float)2.72027e-05,
-    (float)3.36098e-05,
-    (float)2.59887e-05,
-    (float)3.21589e-05,
-    (float)3.07151e-05,
-    (float)3.6347e-05,
-    (float)2.72605e-05,
-    (float)2.04077e-05,
-    (float)2.16386e-05,
-    (float)2.12343e-05,
-    (float)2.19127e-05,
-    (float)2.908e-05,
-    (float)1.88329e-05,
-    (float)1.62642e-05,
-    (float)2.04533e-05,
-    (float)1.10966e-05,
-    (float)1.57269e-05,
-    (float)1.69113e-05,
-    (float)1.36529e-05,
-    (float)1.52651e-05,
-    (float)1.91478e-05,
-    (float)1.37947e-05,
-    (float)1.48167e-05,
-    (float)1.04833e-05,
-    (float)1.49076e-05,
-    (float)1.37236e-05,
-    (float)1.82709e-05,
-    (float)2.0704e-05,
-    (float)1.72371e-05,
-    (float)1.56739e-05,
-    (float)1.6932e-05,
-    (float)1.35415e-05,
-    (float)1.95078e-05,
-    (float)2.10737e-05,
-    (float)1.70272e-05,
-    (float)2.2066e-05,
-    (float)1.86347e-05,
-    (float)1.62414e-05,
-    (float)1.71421e-05,
-    (float)1.67868e-05,
-    (float)1.60386e-05,
-    (float)2.005e-05,
-    (float)1.66276e-05,
-    (float)1.80202e-05,
-    (float)1.37879e-05,
-    (float)1.38759e-05,
-    (float)1.32902e-05,
-    (float)1.35652e-05,
-    (float)1.3965e-05,
-    (float)1.48358e-05,
-    (float)1.20589e-05,
-    (float)1.48802e-05,
-    (float)1.16336e-05,
-    (float)1.0293e-05,
-    (float)1.277e-05,
-    (float)1.25654e-05,
-    (float)1.33194e-05,
-    (float)1.44022e-05,
-    (float)1.31513e-05,
-    (float)1.36193e-05,
-    (float)1.38297e-05,
-    (float)1.34848e-05,
-    (float)1.57292e-05,
-    (float)1.50717e-05,
-    (float)1.68219e-05,
-    (float)1.56213e-05,
-    (float)1.57315e-05,
-    (float)1.77314e-05,
-    (float)1.72359e-05,
-    (float)1.55967e-05,
-    (float)1.82521e-05,
-    (float)0.151374,
-    (float)0.000822513,
-    (float)0.810876,
-    (float)0.00456063,
-    (float)0.00394381,
-    (float)0.00136423,
-    (float)0.00404243,
-    (float)0.000882939,
-    (float)0.00376011,
-    (float)0.00187722,
-    (float)0.000513342,
-    (float)0.000778053,
-    (float)0.00144265,
-    (float)0.000991514,
-    (float)0.000948748,
-    (float)0.000783556,
-    (float)0.000738206,
-    (float)0.000803663,
-    (float)0.000611602,
-    (float)0.000629055,
-    (float)0.000684208,
-    (float)0.000631966,
-    (float)0.000756065,
-    (float)0.000385128,
-    (float)0.000345613,
-    (float)0.000500983,
-    (float)0.000395483,
-    (float)0.000332967,
-    (float)0.000468541,
-    (float)0.000212856,
-    (float)0.000245206,
-    (float)0.000262903,
-    (float)0.000163211,
-    (float)0.000181558,
-    (float)0.000223293,
-    (float)9.96994e-05,
-    (float)0.000141603,
-    (float)0.000115128,
-    (float)6.76175e-05,
-    (float)8.49703e-05,
-    (float)8.27921e-05,
-    (float)5.45745e-05,
-    (float)5.68001e-05,
-    (float)4.22041e-05,
-    (float)4.12889e-05,
-    (float)3.77876e-05,
-    (float)3.83736e-05,
-    (float)3.97466e-05,
-    (float)2.04664e-05,
-    (float)2.56639e-05,
-    (float)3.37841e-05,
-    (float)2.07304e-05,
-    (float)3.7368e-05,
-    (float)3.22211e-05,
-    (float)1.92599e-05,
-    (float)3.01443e-05,
-    (float)3.20948e-05,
-    (float)2.11412e-05,
-    (float)3.53642e-05,
-    (float)2.50744e-05,
-    (float)2.74856e-05,
-    (float)3.05768e-05,
-    (float)3.36857e-05,
-    (float)2.60014e-05,
-    (float)2.26556e-05,
-    (float)2.10652e-05,
-    (float)2.84225e-05,
-    (float)2.38814e-05,
-    (float)3.01496e-05,
-    (float)2.3875e-05,
-    (float)1.60056e-05,
-    (float)2.28882e-05,
-    (float)1.79009e-05,
-    (float)1.60803e-05,
-    (float)2.62577e-05,
-    (float)1.90105e-05,
-    (float)1.24484e-05,
-    (float)2.215e-05,
-    (float)1.46762e-05,
-    (float)1.59268e-05,
-    (float)1.58604e-05,
-    (float)1.46756e-05,
-    (float)1.51208e-05,
-    (float)2.03501e-05,
-    (float)1.64213e-05,
-    (float)1.64665e-05,
-    (float)1.22456e-05,
-    (float)1.74978e-05,
-    (float)1.53785e-05,
-    (float)1.62933e-05,
-    (float)2.05952e-05,
-    (float)1.62672e-05,
-    (float)1.47014e-05,
-    (float)2.03172e-05,
-    (float)1.43061e-05,
-    (float)1.55666e-05,
-    (float)2.13147e-05,
-    (float)1.46373e-05,
-    (float)1.7726e-05,
-    (float)1.92866e-05,
-    (float)1.53431e-05,
-    (float)1.5849e-05,
-    (float)1.75403e-05,
-    (float)1.48531e-05,
-    (float)1.79673e-05,
-    (float)1.55939e-05,
-    (float)1.63334e-05,
-    (float)1.49223e-05,
-    (float)1.65548e-05,
-    (float)1.6829e-05,
-    (float)1.38641e-05,
-    (float)1.39753e-05,
-    (float)1.8126e-05,
-    (float)1.38052e-05,
-    (float)1.60508e-05,
-    (float)1.70662e-05,
-    (float)1.25905e-05,
-    (float)1.60556e-05,
-    (float)1.72484e-05,
-    (float)1.38732e-05,
-    (float)1.70636e-05,
-    (float)1.64199e-05,
-    (float)1.34128e-05,
-    (float)1.71753e-05,
-    (float)1.69009e-05,
-    (float)1.64084e-05,
-    (float)1.57724e-05,
-    (float)1.53174e-05,
-    (float)0.110002,
-    (float)0.000516623,
-    (float)0.853784,
-    (float)0.00382852,
-    (float)0.00265208,
-    (float)0.00118097,
-    (float)0.00364685,
-    (float)0.000887186,
-    (float)0.00446014,
-    (float)0.0017677,
-    (float)0.000414749,
-    (float)0.000710908,
-    (float)0.00143308,
-    (float)0.0010128,
-    (float)0.000994163,
-    (float)0.000778451,
-    (float)0.000679035,
-    (float)0.0008081,
-    (float)0.000680239,
-    (float)0.000644001,
-    (float)0.000734992,
-    (float)0.000648247,
-    (float)0.000748809,
-    (float)0.000444819,
-    (float)0.000380846,
-    (float)0.000534144,
-    (float)0.000480046,
-    (float)0.000360965,
-    (float)0.000509398,
-    (float)0.000272689,
-    (float)0.000255251,
-    (float)0.000316931,
-    (float)0.000229919,
-    (float)0.00020054,
-    (float)0.000271141,
-    (float)0.000138709,
-    (float)0.000157325,
-    (float)0.000159054,
-    (float)9.09132e-05,
-    (float)9.84796e-05,
-    (float)0.000116513,
-    (float)6.88906e-05,
-    (float)6.77117e-05,
-    (float)5.88958e-05,
-    (float)4.54471e-05,
-    (float)4.84275e-05,
-    (float)4.16738e-05,
-    (float)3.78106e-05,
-    (float)2.50498e-05,
-    (float)2.22263e-05,
-    (float)3.12864e-05,
-    (float)2.30452e-05,
-    (float)2.84825e-05,
-    (float)3.21717e-05,
-    (float)1.65512e-05,
-    (float)1.83601e-05,
-    (float)3.06457e-05,
-    (float)1.91435e-05,
-    (float)3.06772e-05,
-    (float)2.73647e-05,
-    (float)2.47371e-05,
-    (float)2.74458e-05,
-    (float)3.41597e-05,
-    (float)2.27178e-05,
-    (float)2.54308e-05,
-    (float)2.26765e-05,
-    (float)3.25939e-05,
-    (float)3.00861e-05,
-    (float)3.09172e-05,
-    (float)2.58698e-05,
-    (float)2.04281e-05,
-    (float)2.05233e-05,
-    (float)2.52726e-05,
-    (float)2.20647e-05,
-    (float)2.82118e-05,
-    (float)2.63182e-05,
-    (float)1.30837e-05,
-    (float)1.79961e-05,
-    (float)1.81237e-05,
-    (float)1.61825e-05,
-    (float)1.82034e-05,
-    (float)1.85594e-05,
-    (float)1.27294e-05,
-    (float)1.95078e-05,
-    (float)1.3209e-05,
-    (float)1.25623e-05,
-    (float)1.15299e-05,
-    (float)1.50364e-05,
-    (float)1.46238e-05,
-    (float)1.74836e-05,
-    (float)1.4786e-05,
-    (float)1.56275e-05,
-    (float)1.20087e-05,
-    (float)1.50915e-05,
-    (float)1.53992e-05,
-    (float)1.63033e-05,
-    (float)2.08971e-05,
-    (float)1.93456e-05,
-    (float)1.58771e-05,
-    (float)1.82592e-05,
-    (float)1.7932e-05,
-    (float)1.68742e-05,
-    (float)2.28589e-05,
-    (float)2.02944e-05,
-    (float)2.06438e-05,
-    (float)2.0698e-05,
-    (float)1.91171e-05,
-    (float)1.77503e-05,
-    (float)2.22497e-05,
-    (float)1.9522e-05,
-    (float)2.04252e-05,
-    (float)1.91812e-05,
-    (float)1.94367e-05,
-    (float)1.82704e-05,
-    (float)1.88019e-05,
-    (float)1.68957e-05,
-    (float)1.68423e-05,
-    (float)1.62167e-05,
-    (float)1.80982e-05,
-    (float)1.67174e-05,
-    (float)1.48371e-05,
-    (float)1.46171e-05,
-    (float)1.35954e-05,
-    (float)1.43189e-05,
-    (float)1.6185e-05,
-    (float)1.43754e-05,
-    (float)1.27832e-05,
-    (float)1.40977e-05,
-    (float)0.0758598,
-    (float)0.000389813,
-    (float)0.889457,
-    (float)0.00310342,
-    (float)0.00156126,
-    (float)0.00101465,
-    (float)0.00319122,
-    (float)0.000886709,
-    (float)0.0051177,
-    (float)0.00163151,
-    (float)0.000350335,
-    (float)0.000656179,
-    (float)0.00137531,
-    (float)0.00101516,
-    (float)0.00101655,
-    (float)0.000767785,
-    (float)0.000622414,
-    (float)0.000799388,
-    (float)0.000724027,
-    (float)0.000641689,
-    (float)0.000757006,
-    (float)0.000649042,
-    (float)0.000718456,
-    (float)0.000495229,
-    (float)0.000414005,
-    (float)0.000539393,
-    (float)0.000541075,
-    (float)0.000377499,
-    (float)0.000526266,
-    (float)0.000332122,
-    (float)0.000263959,
-    (float)0.000348415,
-    (float)0.000295484,
-    (float)0.000215387,
-    (float)0.000303157,
-    (float)0.000183831,
-    (float)0.000171682,
-    (float)0.000200326,
-    (float)0.000125231,
-    (float)0.000108886,
-    (float)0.000149835,
-    (float)9.58447e-05,
-    (float)8.16851e-05,
-    (float)8.50156e-05,
-    (float)5.8826e-05,
-    (float)6.09621e-05,
-    (float)5.61471e-05,
-    (float)4.38963e-05,
-    (float)3.42005e-05,
-    (float)3.0762e-05,
-    (float)3.43132e-05,
-    (float)3.11377e-05,
-    (float)2.63917e-05,
-    (float)3.07024e-05,
-    (float)1.79398e-05,
-    (float)1.25161e-05,
-    (float)2.90899e-05,
-    (float)2.09044e-05,
-    (float)2.48515e-05,
-    (float)2.5734e-05,
-    (float)1.99976e-05,
-    (float)1.78498e-05,
-    (float)3.08199e-05,
-    (float)1.94555e-05,
-    (float)2.38977e-05,
-    (float)2.12107e-05,
-    (float)2.82389e-05,
-    (float)2.62676e-05,
-    (float)2.76147e-05,
-    (float)2.15562e-05,
-    (float)2.13137e-05,
-    (float)1.82434e-05,
-    (float)2.72031e-05,
-    (float)2.47125e-05,
-    (float)2.38856e-05,
-    (float)2.50428e-05,
-    (float)1.53459e-05,
-    (float)1.59926e-05,
-    (float)2.18226e-05,
-    (float)1.99584e-05,
-    (float)1.75122e-05,
-    (float)2.25278e-05,
-    (float)1.29298e-05,
-    (float)1.70906e-05,
-    (float)1.54203e-05,
-    (float)1.67953e-05,
-    (float)1.37804e-05,
-    (float)1.72421e-05,
-    (float)1.36511e-05,
-    (float)1.90463e-05,
-    (float)1.45885e-05,
-    (float)1.6874e-05,
-    (float)1.31654e-05,
-    (float)1.58951e-05,
-    (float)1.70795e-05,
-    (float)1.83903e-05,
-    (float)1.74086e-05,
-    (float)2.0321e-05,
-    (float)1.66939e-05,
-    (float)1.70731e-05,
-    (float)1.98952e-05,
-    (float)1.84595e-05,
-    (float)2.13872e-05,
-    (float)2.16409e-05,
-    (float)1.97012e-05,
-    (float)1.86717e-05,
-    (float)2.18108e-05,
-    (float)1.98881e-05,
-    (float)2.21545e-05,
-    (float)1.93103e-05,
-    (float)2.04965e-05,
-    (float)1.92305e-05,
-    (float)2.09014e-05,
-    (float)1.95777e-05,
-    (float)2.01161e-05,
-    (float)1.72961e-05,
-    (float)1.84045e-05,
-    (float)1.65598e-05,
-    (float)1.81043e-05,
-    (float)1.87344e-05,
-    (float)1.72232e-05,
-    (float)1.50975e-05,
-    (float)1.53576e-05,
-    (float)1.53049e-05,
-    (float)1.62397e-05,
-    (float)1.64593e-05,
-    (float)1.49205e-05,
-    (float)1.43523e-05,
-    (float)0.048645,
-    (float)0.000463062,
-    (float)0.917845,
-    (float)0.00236094,
-    (float)0.000751986,
-    (float)0.000861435,
-    (float)0.00269621,
-    (float)0.000895441,
-    (float)0.00578034,
-    (float)0.00143676,
-    (float)0.000323907,
-    (float)0.00060766,
-    (float)0.00127614,
-    (float)0.00100401,
-    (float)0.00103806,
-    (float)0.000740759,
-    (float)0.000570962,
-    (float)0.000767061,
-    (float)0.000745803,
-    (float)0.000642925,
-    (float)0.000772006,
-    (float)0.000638074,
-    (float)0.000670183,
-    (float)0.000528239,
-    (float)0.000448411,
-    (float)0.000540977,
-    (float)0.000597418,
-    (float)0.000392431,
-    (float)0.000524851,
-    (float)0.000388246,
-    (float)0.000279826,
-    (float)0.00037109,
-    (float)0.000369415,
-    (float)0.00023754,
-    (float)0.000326507,
-    (float)0.000235507,
-    (float)0.000188045,
-    (float)0.00024078,
-    (float)0.000177765,
-    (float)0.000124811,
-    (float)0.000182411,
-    (float)0.000134969,
-    (float)9.92017e-05,
-    (float)0.000120401,
-    (float)8.42484e-05,
-    (float)7.42118e-05,
-    (float)7.89766e-05,
-    (float)6.17339e-05,
-    (float)4.74071e-05,
-    (float)4.91128e-05,
-    (float)4.07664e-05,
-    (float)4.19566e-05,
-    (float)3.23144e-05,
-    (float)3.09194e-05,
-    (float)2.25262e-05,
-    (float)1.38268e-05,
-    (float)2.69572e-05,
-    (float)2.49533e-05,
-    (float)1.85586e-05,
-    (float)2.1326e-05,
-    (float)1.76628e-05,
-    (float)7.92556e-06,
-    (float)2.39825e-05,
-    (float)1.65304e-05,
-    (float)1.82512e-05,
-    (float)1.85961e-05,
-    (float)2.12893e-05,
-    (float)1.71646e-05,
-    (float)2.2339e-05,
-    (float)1.56693e-05,
-    (float)1.92771e-05,
-    (float)1.60994e-05,
-    (float)2.40094e-05,
-    (float)2.59684e-05,
-    (float)1.98772e-05,
-    (float)1.98468e-05,
-    (float)1.73574e-05,
-    (float)1.4883e-05,
-    (float)2.41401e-05,
-    (float)2.73462e-05,
-    (float)1.58569e-05,
-    (float)2.46751e-05,
-    (float)1.66249e-05,
-    (float)1.53306e-05,
-    (float)1.88559e-05,
-    (float)2.42967e-05,
-    (float)1.62691e-05,
-    (float)2.43376e-05,
-    (float)1.46545e-05,
-    (float)1.85479e-05,
-    (float)1.72544e-05,
-    (float)2.01468e-05,
-    (float)1.55131e-05,
-    (float)2.03381e-05,
-    (float)1.80607e-05,
-    (float)2.15566e-05,
-    (float)1.52123e-05,
-    (float)1.81031e-05,
-    (float)1.78033e-05,
-    (float)1.66929e-05,
-    (float)2.07562e-05,
-    (float)2.12772e-05,
-    (float)1.66134e-05,
-    (float)1.91314e-05,
-    (float)1.91352e-05,
-    (float)1.4596e-05,
-    (float)2.21863e-05,
-    (float)2.0325e-05,
-    (float)1.89608e-05,
-    (float)1.92966e-05,
-    (float)1.95205e-05,
-    (float)1.57401e-05,
-    (float)2.10046e-05,
-    (float)1.91433e-05,
-    (float)2.06613e-05,
-    (float)1.85162e-05,
-    (float)1.89694e-05,
-    (float)1.76459e-05,
-    (float)1.88226e-05,
-    (float)1.94846e-05,
-    (float)2.04063e-05,
-    (float)1.65529e-05,
-    (float)1.91087e-05,
-    (float)1.96347e-05,
-    (float)1.66663e-05,
-    (float)1.94515e-05,
-    (float)1.96715e-05,
-    (float)1.6227e-05,
-    (float)0.0281649,
-    (float)0.000742916,
-    (float)0.939003,
-    (float)0.00163913,
-    (float)0.000242341,
-    (float)0.000719531,
-    (float)0.00216021,
-    (float)0.000899874,
-    (float)0.00638212,
-    (float)0.00118714,
-    (float)0.000343846,
-    (float)0.00056794,
-    (float)0.00112995,
-    (float)0.000965028,
-    (float)0.0010477,
-    (float)0.000705078,
-    (float)0.000547852,
-    (float)0.000723506,
-    (float)0.000740393,
-    (float)0.000641419,
-    (float)0.000780764,
-    (float)0.000632425,
-    (float)0.000630894,
-    (float)0.000558456,
-    (float)0.000485992,
-    (float)0.000535978,
-    (float)0.000644321,
-    (float)0.000425768,
-    (float)0.000520817,
-    (float)0.000450621,
-    (float)0.000318062,
-    (float)0.000384104,
-    (float)0.00044159,
-    (float)0.000278841,
-    (float)0.000345177,
-    (float)0.000303839,
-    (float)0.000222351,
-    (float)0.000269427,
-    (float)0.000241679,
-    (float)0.000154324,
-    (float)0.000208939,
-    (float)0.000190156,
-    (float)0.00012735,
-    (float)0.000154042,
-    (float)0.000122067,
-    (float)8.75986e-05,
-    (float)0.000100977,
-    (float)9.36275e-05,
-    (float)6.47446e-05,
-    (float)7.25172e-05,
-    (float)5.25067e-05,
-    (float)4.84914e-05,
-    (float)4.29257e-05,
-    (float)3.60402e-05,
-    (float)2.72874e-05,
-    (float)2.40282e-05,
-    (float)2.39016e-05,
-    (float)2.73585e-05,
-    (float)1.68996e-05,
-    (float)1.3805e-05,
-    (float)1.58319e-05,
-    (float)5.06687e-06,
-    (float)1.46829e-05,
-    (float)1.7269e-05,
-    (float)1.27977e-05,
-    (float)1.16293e-05,
-    (float)1.59367e-05,
-    (float)8.65521e-06,
-    (float)1.6777e-05,
-    (float)1.48044e-05,
-    (float)1.54219e-05,
-    (float)1.55509e-05,
-    (float)1.99703e-05,
-    (float)2.17491e-05,
-    (float)2.02665e-05,
-    (float)1.66146e-05,
-    (float)1.89662e-05,
-    (float)1.90313e-05,
-    (float)2.23098e-05,
-    (float)3.1048e-05,
-    (float)2.02554e-05,
-    (float)2.08104e-05,
-    (float)2.2007e-05,
-    (float)1.93481e-05,
-    (float)2.02059e-05,
-    (float)3.17601e-05,
-    (float)1.89698e-05,
-    (float)2.2925e-05,
-    (float)2.08e-05,
-    (float)1.83844e-05,
-    (float)1.87848e-05,
-    (float)2.57266e-05,
-    (float)1.55779e-05,
-    (float)2.11311e-05,
-    (float)1.91671e-05,
-    (float)1.78017e-05,
-    (float)1.70052e-05,
-    (float)1.84361e-05,
-    (float)1.49023e-05,
-    (float)1.73529e-05,
-    (float)1.68177e-05,
-    (float)1.78725e-05,
-    (float)1.67651e-05,
-    (float)1.46329e-05,
-    (float)1.6915e-05,
-    (float)1.49612e-05,
-    (float)1.63038e-05,
-    (float)1.85836e-05,
-    (float)1.7207e-05,
-    (float)1.55839e-05,
-    (float)2.07279e-05,
-    (float)1.58011e-05,
-    (float)1.80019e-05,
-    (float)2.0445e-05,
-    (float)1.86421e-05,
-    (float)1.89571e-05,
-    (float)2.34742e-05,
-    (float)1.93193e-05,
-    (float)2.14935e-05,
-    (float)2.28045e-05,
-    (float)2.05176e-05,
-    (float)2.20906e-05,
-    (float)2.41762e-05,
-    (float)2.28619e-05,
-    (float)2.41006e-05,
-    (float)2.40583e-05,
-    (float)2.27592e-05,
-    (float)2.33467e-05,
-    (float)0.0140781,
-    (float)0.00127852,
-    (float)0.953514,
-    (float)0.00104074,
-    (float)3.89081e-05,
-    (float)0.000654982,
-    (float)0.00168229,
-    (float)0.000941908,
-    (float)0.00680734,
-    (float)0.000953148,
-    (float)0.00041084,
-    (float)0.000565326,
-    (float)0.000990931,
-    (float)0.000927627,
-    (float)0.00100891,
-    (float)0.000664362,
-    (float)0.000545584,
-    (float)0.000680136,
-    (float)0.000716181,
-    (float)0.000639843,
-    (float)0.000752274,
-    (float)0.000606982,
-    (float)0.000580725,
-    (float)0.000561888,
-    (float)0.000508453,
-    (float)0.0005193,
-    (float)0.000644991,
-    (float)0.000438813,
-    (float)0.000485097,
-    (float)0.000472789,
-    (float)0.000349402,
-    (float)0.000375696,
-    (float)0.000472523,
-    (float)0.000307239,
-    (float)0.00033077,
-    (float)0.00033945,
-    (float)0.000250726,
-    (float)0.000271311,
-    (float)0.000285085,
-    (float)0.000183561,
-    (float)0.000209052,
-    (float)0.000227997,
-    (float)0.000154529,
-    (float)0.000168488,
-    (float)0.000157795,
-    (float)0.000106485,
-    (float)0.000111025,
-    (float)0.000127674,
-    (float)8.68141e-05,
-    (float)8.98599e-05,
-    (float)7.35153e-05,
-    (float)6.02539e-05,
-    (float)5.5669e-05,
-    (float)5.5885e-05,
-    (float)3.93526e-05,
-    (float)3.88332e-05,
-    (float)3.28339e-05,
-    (float)3.39379e-05,
-    (float)2.5359e-05,
-    (float)1.88545e-05,
-    (float)1.90786e-05,
-    (float)1.19189e-05,
-    (float)1.40798e-05,
-    (float)2.04983e-05,
-    (float)1.58523e-05,
-    (float)7.37227e-06,
-    (float)1.27013e-05,
-    (float)5.47616e-06,
-    (float)1.1005e-05,
-    (float)1.48856e-05,
-    (float)1.3764e-05,
-    (float)9.53788e-06,
-    (float)1.4184e-05,
-    (float)1.15471e-05,
-    (float)1.37199e-05,
-    (float)1.33365e-05,
-    (float)1.46252e-05,
-    (float)1.57514e-05,
-    (float)1.67863e-05,
-    (float)2.0172e-05,
-    (float)1.70632e-05,
-    (float)1.42255e-05,
-    (float)1.60494e-05,
-    (float)2.00199e-05,
-    (float)1.79441e-05,
-    (float)2.51325e-05,
-    (float)1.88119e-05,
-    (float)1.60335e-05,
-    (float)1.72426e-05,
-    (float)2.10841e-05,
-    (float)1.79281e-05,
-    (float)2.46177e-05,
-    (float)1.8939e-05,
-    (float)1.79504e-05,
-    (float)1.81961e-05,
-    (float)1.93648e-05,
-    (float)1.773e-05,
-    (float)2.20836e-05,
-    (float)1.88602e-05,
-    (float)1.84503e-05,
-    (float)1.88289e-05,
-    (float)1.87102e-05,
-    (float)1.85253e-05,
-    (float)1.87641e-05,
-    (float)1.91152e-05,
-    (float)2.00652e-05,
-    (float)2.01854e-05,
-    (float)1.82524e-05,
-    (float)1.942e-05,
-    (float)1.86105e-05,
-    (float)2.08941e-05,
-    (float)2.1745e-05,
-    (float)2.12805e-05,
-    (float)1.96867e-05,
-    (float)2.11356e-05,
-    (float)2.03707e-05,
-    (float)2.26206e-05,
-    (float)2.38077e-05,
-    (float)2.25508e-05,
-    (float)2.18342e-05,
-    (float)2.27613e-05,
-    (float)2.29148e-05,
-    (float)2.36518e-05,
-    (float)2.4523e-05,
-    (float)2.34749e-05,
-    (float)2.41996e-05,
-    (float)2.36978e-05,
-    (float)2.36024e-05,
-    (float)0.00556527,
-    (float)0.00203174,
-    (float)0.961745,
-    (float)0.000543256,
-    (float)0.000145123,
-    (float)0.000603639,
-    (float)0.00121521,
-    (float)0.000993119,
-    (float)0.00719411,
-    (float)0.000709504,
-    (float)0.00050266,
-    (float)0.000565261,
-    (float)0.000828984,
-    (float)0.000863334,
-    (float)0.000966404,
-    (float)0.000611452,
-    (float)0.000560432,
-    (float)0.000622219,
-    (float)0.000655551,
-    (float)0.00062956,
-    (float)0.000720743,
-    (float)0.000573465,
-    (float)0.000546142,
-    (float)0.000550449,
-    (float)0.000506679,
-    (float)0.000500113,
-    (float)0.000635648,
-    (float)0.00045261,
-    (float)0.000458466,
-    (float)0.000483171,
-    (float)0.000378242,
-    (float)0.000368777,
-    (float)0.000488535,
-    (float)0.000340948,
-    (float)0.000329531,
-    (float)0.000375453,
-    (float)0.000285259,
-    (float)0.000271614,
-    (float)0.000321173,
-    (float)0.000225675,
-    (float)0.000219819,
-    (float)0.000272314,
-    (float)0.000194571,
-    (float)0.00018259,
-    (float)0.000193534,
-    (float)0.000139385,
-    (float)0.000128621,
-    (float)0.000172315,
-    (float)0.0001231,
-    (float)0.000110521,
-    (float)0.0001012,
-    (float)8.11372e-05,
-    (float)7.2094e-05,
-    (float)8.9671e-05,
-    (float)6.46098e-05,
-    (float)5.84642e-05,
-    (float)4.91589e-05,
-    (float)4.46069e-05,
-    (float)3.70382e-05,
-    (float)3.57391e-05,
-    (float)2.96503e-05,
-    (float)2.47784e-05,
-    (float)2.03137e-05,
-    (float)2.39809e-05,
-    (float)2.07145e-05,
-    (float)9.02422e-06,
-    (float)1.1958e-05,
-    (float)8.64667e-06,
-    (float)8.71639e-06,
-    (float)1.30325e-05,
-    (float)1.31535e-05,
-    (float)3.49777e-06,
-    (float)7.39389e-06,
-    (float)5.31373e-06,
-    (float)7.08492e-06,
-    (float)8.91095e-06,
-    (float)1.04927e-05,
-    (float)8.30236e-06,
-    (float)9.1383e-06,
-    (float)9.88913e-06,
-    (float)1.11945e-05,
-    (float)8.90796e-06,
-    (float)1.01204e-05,
-    (float)1.54749e-05,
-    (float)1.32737e-05,
-    (float)1.62405e-05,
-    (float)1.63721e-05,
-    (float)1.2057e-05,
-    (float)1.25885e-05,
-    (float)2.06746e-05,
-    (float)1.67687e-05,
-    (float)2.01537e-05,
-    (float)2.04769e-05,
-    (float)1.74038e-05,
-    (float)1.7017e-05,
-    (float)2.2237e-05,
-    (float)1.91305e-05,
-    (float)2.18149e-05,
-    (float)2.28295e-05,
-    (float)2.20897e-05,
-    (float)2.12037e-05,
-    (float)2.26444e-05,
-    (float)2.16978e-05,
-    (float)2.17235e-05,
-    (float)2.29177e-05,
-    (float)2.54217e-05,
-    (float)2.43871e-05,
-    (float)2.23654e-05,
-    (float)2.38091e-05,
-    (float)2.26051e-05,
-    (float)2.25614e-05,
-    (float)2.62314e-05,
-    (float)2.5386e-05,
-    (float)2.27896e-05,
-    (float)2.53036e-05,
-    (float)2.43119e-05,
-    (float)2.28827e-05,
-    (float)2.61245e-05,
-    (float)2.46908e-05,
-    (float)2.28117e-05,
-    (float)2.57383e-05,
-    (float)2.71132e-05,
-    (float)2.4122e-05,
-    (float)2.46854e-05,
-    (float)2.35638e-05,
-    (float)2.3716e-05,
-    (float)2.52912e-05,
-    (float)2.80661e-05,
-    (float)0.00198839,
-    (float)0.00295769,
-    (float)0.964114,
-    (float)0.000185718,
-    (float)0.000509807,
-    (float)0.000571942,
-    (float)0.000779368,
-    (float)0.00103637,
-    (float)0.00754008,
-    (float)0.000482205,
-    (float)0.000595207,
-    (float)0.000572773,
-    (float)0.000660834,
-    (float)0.00075916,
-    (float)0.000918753,
-    (float)0.0005492,
-    (float)0.000582451,
-    (float)0.000564638,
-    (float)0.000579147,
-    (float)0.000599649,
-    (float)0.000682248,
-    (float)0.000531383,
-    (float)0.0005232,
-    (float)0.000537898,
-    (float)0.000502749,
-    (float)0.000477743,
-    (float)0.000615868,
-    (float)0.000466837,
-    (float)0.000435397,
-    (float)0.000486271,
-    (float)0.000423852,
-    (float)0.000375836,
-    (float)0.000493629,
-    (float)0.000378185,
-    (float)0.000335652,
-    (float)0.000410153,
-    (float)0.000340524,
-    (float)0.000287139,
-    (float)0.000355491,
-    (float)0.000283266,
-    (float)0.000239512,
-    (float)0.00031726,
-    (float)0.000255283,
-    (float)0.000208822,
-    (float)0.000233908,
-    (float)0.000195379,
-    (float)0.000158307,
-    (float)0.000220372,
-    (float)0.000174144,
-    (float)0.000140875,
-    (float)0.000141011,
-    (float)0.000122632,
-    (float)9.71768e-05,
-    (float)0.000133193,
-    (float)0.000104415,
-    (float)8.51517e-05,
-    (float)7.66087e-05,
-    (float)6.82939e-05,
-    (float)5.55362e-05,
-    (float)6.61263e-05,
-    (float)5.19436e-05,
-    (float)4.37902e-05,
-    (float)3.57411e-05,
-    (float)3.2077e-05,
-    (float)2.94412e-05,
-    (float)2.36309e-05,
-    (float)1.90628e-05,
-    (float)1.7583e-05,
-    (float)1.29744e-05,
-    (float)1.16366e-05,
-    (float)1.4372e-05,
-    (float)3.98009e-06,
-    (float)4.07147e-06,
-    (float)5.09986e-06,
-    (float)3.72368e-06,
-    (float)3.68458e-06,
-    (float)7.00932e-06,
-    (float)1.12279e-06,
-    (float)2.27396e-06,
-    (float)2.9455e-06,
-    (float)3.96672e-06,
-    (float)4.56384e-06,
-    (float)5.46251e-06,
-    (float)7.50766e-06,
-    (float)7.87704e-06,
-    (float)6.89888e-06,
-    (float)9.77663e-06,
-    (float)1.05357e-05,
-    (float)8.4247e-06,
-    (float)1.65854e-05,
-    (float)1.58005e-05,
-    (float)1.32468e-05,
-    (float)1.74322e-05,
-    (float)1.81192e-05,
-    (float)1.42643e-05,
-    (float)2.41723e-05,
-    (float)2.27229e-05,
-    (float)1.9625e-05,
-    (float)2.40333e-05,
-    (float)2.45915e-05,
-    (float)2.08434e-05,
-    (float)2.85801e-05,
-    (float)2.72135e-05,
-    (float)2.50662e-05,
-    (float)2.80818e-05,
-    (float)2.84641e-05,
-    (float)2.61442e-05,
-    (float)2.99571e-05,
-    (float)2.92494e-05,
-    (float)2.94458e-05,
-    (float)2.95585e-05,
-    (float)2.96312e-05,
-    (float)2.91234e-05,
-    (float)2.94148e-05,
-    (float)2.9562e-05,
-    (float)3.28102e-05,
-    (float)2.94297e-05,
-    (float)2.90446e-05,
-    (float)3.00562e-05,
-    (float)2.82998e-05,
-    (float)2.91111e-05,
-    (float)3.50177e-05,
-    (float)2.88888e-05,
-    (float)2.80476e-05,
-    (float)3.00501e-05,
-    (float)2.76891e-05,
-    (float)2.87351e-05,
-    (float)3.57987e-05,
-};
-HarmData sweep1_coeff = { harm_data, 120, 128 };
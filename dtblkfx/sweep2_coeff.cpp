@@ -1,15366 +0,0 @@
-#include <StdAfx.h>
-/*file generated by write_harm_data.m*/
-#include "HarmData.h"
-static float harm_data[120*128]={
-    (float)0.801097,
-    (float)0.0196798,
-    (float)0.0722521,
-    (float)0.0177534,
-    (float)0.0162991,
-    (float)0.0148947,
-    (float)0.00339768,
-    (float)0.0115369,
-    (float)0.000236437,
-    (float)0.00813799,
-    (float)0.0001734,
-    (float)0.00509781,
-    (float)0.00101223,
-    (float)0.00270059,
-    (float)0.00183293,
-    (float)0.00108327,
-    (float)0.0022587,
-    (float)0.000230872,
-    (float)0.00221478,
-    (float)4.37033e-07,
-    (float)0.00180478,
-    (float)0.000170744,
-    (float)0.00121607,
-    (float)0.000504642,
-    (float)0.000641034,
-    (float)0.000805472,
-    (float)0.000221273,
-    (float)0.000952699,
-    (float)2.05697e-05,
-    (float)0.000911395,
-    (float)2.5381e-05,
-    (float)0.000718719,
-    (float)0.000165886,
-    (float)0.000455038,
-    (float)0.000348235,
-    (float)0.000209306,
-    (float)0.000487697,
-    (float)4.87416e-05,
-    (float)0.000533105,
-    (float)9.89337e-07,
-    (float)0.000476424,
-    (float)5.22508e-05,
-    (float)0.000346928,
-    (float)0.000159116,
-    (float)0.000194587,
-    (float)0.000267809,
-    (float)6.9827e-05,
-    (float)0.000333561,
-    (float)6.47212e-06,
-    (float)0.000334109,
-    (float)1.26597e-05,
-    (float)0.000273878,
-    (float)7.16044e-05,
-    (float)0.000178621,
-    (float)0.000150776,
-    (float)8.3435e-05,
-    (float)0.000215325,
-    (float)1.91424e-05,
-    (float)0.000240537,
-    (float)1.97976e-06,
-    (float)0.000219158,
-    (float)2.96691e-05,
-    (float)0.000161774,
-    (float)8.4373e-05,
-    (float)9.09858e-05,
-    (float)0.000140734,
-    (float)3.20141e-05,
-    (float)0.000175731,
-    (float)3.32374e-06,
-    (float)0.000176738,
-    (float)1.05915e-05,
-    (float)0.000145039,
-    (float)4.58931e-05,
-    (float)9.39666e-05,
-    (float)9.19003e-05,
-    (float)4.2868e-05,
-    (float)0.00012907,
-    (float)9.47223e-06,
-    (float)0.000142972,
-    (float)3.53044e-06,
-    (float)0.000129144,
-    (float)2.38692e-05,
-    (float)9.39382e-05,
-    (float)5.96662e-05,
-    (float)5.13273e-05,
-    (float)9.52008e-05,
-    (float)1.71101e-05,
-    (float)0.00011609,
-    (float)2.84987e-06,
-    (float)0.000114581,
-    (float)1.18249e-05,
-    (float)9.19961e-05,
-    (float)3.83482e-05,
-    (float)5.76402e-05,
-    (float)7.04703e-05,
-    (float)2.47993e-05,
-    (float)9.48603e-05,
-    (float)5.47803e-06,
-    (float)0.000101943,
-    (float)5.89158e-06,
-    (float)8.93597e-05,
-    (float)2.43762e-05,
-    (float)6.25102e-05,
-    (float)5.24053e-05,
-    (float)3.21098e-05,
-    (float)7.81823e-05,
-    (float)9.8227e-06,
-    (float)9.13219e-05,
-    (float)3.72516e-06,
-    (float)8.68e-05,
-    (float)1.53174e-05,
-    (float)6.67064e-05,
-    (float)3.91611e-05,
-    (float)3.92078e-05,
-    (float)6.52017e-05,
-    (float)1.51908e-05,
-    (float)8.28189e-05,
-    (float)3.93259e-06,
-    (float)8.49984e-05,
-    (float)9.49773e-06,
-    (float)7.10076e-05,
-    (float)2.9243e-05,
-    (float)4.65692e-05,
-    (float)5.4964e-05,
-    (float)2.15159e-05,
-    (float)7.61967e-05,
-    (float)5.86808e-06,
-    (float)8.43707e-05,
-    (float)0.812205,
-    (float)0.0090245,
-    (float)0.0817233,
-    (float)0.00848583,
-    (float)0.0240023,
-    (float)0.00768666,
-    (float)0.0088669,
-    (float)0.00672762,
-    (float)0.00332494,
-    (float)0.00569495,
-    (float)0.00108479,
-    (float)0.00465618,
-    (float)0.000235301,
-    (float)0.00366794,
-    (float)1.99737e-05,
-    (float)0.00277806,
-    (float)8.45192e-05,
-    (float)0.00201862,
-    (float)0.000250411,
-    (float)0.00140047,
-    (float)0.000429697,
-    (float)0.000916971,
-    (float)0.00058215,
-    (float)0.000553528,
-    (float)0.000690653,
-    (float)0.000294815,
-    (float)0.000749101,
-    (float)0.000126718,
-    (float)0.000757672,
-    (float)3.57191e-05,
-    (float)0.000720581,
-    (float)8.35808e-06,
-    (float)0.000644715,
-    (float)3.07322e-05,
-    (float)0.000539521,
-    (float)8.76621e-05,
-    (float)0.000417402,
-    (float)0.000162527,
-    (float)0.000292914,
-    (float)0.0002387,
-    (float)0.000180365,
-    (float)0.000301903,
-    (float)9.11525e-05,
-    (float)0.000342074,
-    (float)3.21274e-05,
-    (float)0.000354204,
-    (float)5.0916e-06,
-    (float)0.000338409,
-    (float)7.08202e-06,
-    (float)0.000299327,
-    (float)3.14183e-05,
-    (float)0.000244672,
-    (float)6.94336e-05,
-    (float)0.000183267,
-    (float)0.000112298,
-    (float)0.000123346,
-    (float)0.000152293,
-    (float)7.16031e-05,
-    (float)0.000183444,
-    (float)3.27855e-05,
-    (float)0.000201837,
-    (float)9.52363e-06,
-    (float)0.000205728,
-    (float)2.3418e-06,
-    (float)0.000195387,
-    (float)9.90381e-06,
-    (float)0.000172743,
-    (float)2.93561e-05,
-    (float)0.000141056,
-    (float)5.66439e-05,
-    (float)0.000104626,
-    (float)8.6908e-05,
-    (float)6.83302e-05,
-    (float)0.000115109,
-    (float)3.69153e-05,
-    (float)0.000136786,
-    (float)1.42379e-05,
-    (float)0.000148703,
-    (float)2.70131e-06,
-    (float)0.000149256,
-    (float)2.95372e-06,
-    (float)0.000138655,
-    (float)1.38461e-05,
-    (float)0.000118843,
-    (float)3.26943e-05,
-    (float)9.30859e-05,
-    (float)5.58397e-05,
-    (float)6.53026e-05,
-    (float)7.93315e-05,
-    (float)3.93845e-05,
-    (float)9.95201e-05,
-    (float)1.8666e-05,
-    (float)0.000113494,
-    (float)5.55804e-06,
-    (float)0.000119398,
-    (float)1.3037e-06,
-    (float)0.000116611,
-    (float)5.88944e-06,
-    (float)0.000105746,
-    (float)1.81357e-05,
-    (float)8.84643e-05,
-    (float)3.5908e-05,
-    (float)6.72391e-05,
-    (float)5.63845e-05,
-    (float)4.5062e-05,
-    (float)7.64016e-05,
-    (float)2.50658e-05,
-    (float)9.29007e-05,
-    (float)1.00584e-05,
-    (float)0.0001034,
-    (float)2.08189e-06,
-    (float)0.000106359,
-    (float)2.11358e-06,
-    (float)0.00010138,
-    (float)9.93659e-06,
-    (float)8.92586e-05,
-    (float)2.4175e-05,
-    (float)7.18697e-05,
-    (float)4.25155e-05,
-    (float)5.18655e-05,
-    (float)6.21016e-05,
-    (float)3.22241e-05,
-    (float)7.99955e-05,
-    (float)1.579e-05,
-    (float)9.35864e-05,
-    (float)4.89782e-06,
-    (float)0.000100912,
-    (float)1.08724e-06,
-    (float)0.821782,
-    (float)0.00225669,
-    (float)0.0872263,
-    (float)0.00206681,
-    (float)0.0289724,
-    (float)0.00181707,
-    (float)0.0133892,
-    (float)0.00156274,
-    (float)0.00731126,
-    (float)0.00133677,
-    (float)0.00445019,
-    (float)0.00115419,
-    (float)0.00293414,
-    (float)0.0010225,
-    (float)0.00204778,
-    (float)0.000941916,
-    (float)0.00147272,
-    (float)0.000900493,
-    (float)0.00106213,
-    (float)0.000877232,
-    (float)0.000753497,
-    (float)0.000852961,
-    (float)0.000521352,
-    (float)0.000818109,
-    (float)0.000351418,
-    (float)0.000772,
-    (float)0.000231244,
-    (float)0.000718436,
-    (float)0.000149079,
-    (float)0.000662825,
-    (float)9.42315e-05,
-    (float)0.000610435,
-    (float)5.76531e-05,
-    (float)0.00056416,
-    (float)3.30116e-05,
-    (float)0.000523206,
-    (float)1.70723e-05,
-    (float)0.000484465,
-    (float)8.58356e-06,
-    (float)0.000445209,
-    (float)6.71208e-06,
-    (float)0.000404489,
-    (float)1.02724e-05,
-    (float)0.000362847,
-    (float)1.77221e-05,
-    (float)0.000321669,
-    (float)2.74012e-05,
-    (float)0.000282684,
-    (float)3.79099e-05,
-    (float)0.000247245,
-    (float)4.85113e-05,
-    (float)0.000215637,
-    (float)5.91427e-05,
-    (float)0.000187144,
-    (float)6.99519e-05,
-    (float)0.000160832,
-    (float)8.08497e-05,
-    (float)0.000136185,
-    (float)9.14376e-05,
-    (float)0.000113183,
-    (float)0.000101145,
-    (float)9.2128e-05,
-    (float)0.000109375,
-    (float)7.34663e-05,
-    (float)0.000115704,
-    (float)5.75577e-05,
-    (float)0.000120121,
-    (float)4.44256e-05,
-    (float)0.000123002,
-    (float)3.37422e-05,
-    (float)0.000124801,
-    (float)2.50742e-05,
-    (float)0.000125752,
-    (float)1.81147e-05,
-    (float)0.000125843,
-    (float)1.27267e-05,
-    (float)0.000124921,
-    (float)8.88213e-06,
-    (float)0.000122791,
-    (float)6.58624e-06,
-    (float)0.000119332,
-    (float)5.78328e-06,
-    (float)0.000114642,
-    (float)6.28515e-06,
-    (float)0.000109064,
-    (float)7.80902e-06,
-    (float)0.000103003,
-    (float)1.00938e-05,
-    (float)9.67383e-05,
-    (float)1.29727e-05,
-    (float)9.03791e-05,
-    (float)1.63648e-05,
-    (float)8.3921e-05,
-    (float)2.0236e-05,
-    (float)7.73034e-05,
-    (float)2.45511e-05,
-    (float)7.04755e-05,
-    (float)2.92103e-05,
-    (float)6.34893e-05,
-    (float)3.40245e-05,
-    (float)5.65292e-05,
-    (float)3.87767e-05,
-    (float)4.98263e-05,
-    (float)4.33119e-05,
-    (float)4.35496e-05,
-    (float)4.75682e-05,
-    (float)3.7772e-05,
-    (float)5.15537e-05,
-    (float)3.24925e-05,
-    (float)5.5316e-05,
-    (float)2.76632e-05,
-    (float)5.89017e-05,
-    (float)2.32312e-05,
-    (float)6.22921e-05,
-    (float)1.9196e-05,
-    (float)6.53771e-05,
-    (float)1.56281e-05,
-    (float)6.80107e-05,
-    (float)1.26247e-05,
-    (float)7.00915e-05,
-    (float)1.0253e-05,
-    (float)7.15924e-05,
-    (float)8.53165e-06,
-    (float)7.25499e-05,
-    (float)7.43569e-06,
-    (float)7.30523e-05,
-    (float)6.9112e-06,
-    (float)7.32038e-05,
-    (float)0.827209,
-    (float)4.35365e-05,
-    (float)0.0877529,
-    (float)0.000119597,
-    (float)0.0294474,
-    (float)0.000203761,
-    (float)0.014083,
-    (float)0.00026707,
-    (float)0.00818459,
-    (float)0.000299624,
-    (float)0.00540899,
-    (float)0.000303197,
-    (float)0.00388551,
-    (float)0.00028628,
-    (float)0.0029183,
-    (float)0.000263216,
-    (float)0.00222772,
-    (float)0.000248022,
-    (float)0.00171214,
-    (float)0.00024541,
-    (float)0.00133393,
-    (float)0.000249984,
-    (float)0.00106345,
-    (float)0.000253801,
-    (float)0.000868358,
-    (float)0.000252528,
-    (float)0.000720936,
-    (float)0.000246056,
-    (float)0.000602019,
-    (float)0.00023711,
-    (float)0.000500817,
-    (float)0.000229547,
-    (float)0.000414015,
-    (float)0.000225577,
-    (float)0.000342405,
-    (float)0.000224004,
-    (float)0.000285845,
-    (float)0.000221849,
-    (float)0.000241259,
-    (float)0.000217314,
-    (float)0.000204547,
-    (float)0.000210692,
-    (float)0.000172775,
-    (float)0.000203399,
-    (float)0.0001446,
-    (float)0.000196909,
-    (float)0.000119869,
-    (float)0.000191931,
-    (float)9.90323e-05,
-    (float)0.000187848,
-    (float)8.22481e-05,
-    (float)0.000183243,
-    (float)6.88416e-05,
-    (float)0.000177291,
-    (float)5.77038e-05,
-    (float)0.000170383,
-    (float)4.80362e-05,
-    (float)0.000163469,
-    (float)3.95786e-05,
-    (float)0.000157224,
-    (float)3.2374e-05,
-    (float)0.000151744,
-    (float)2.65237e-05,
-    (float)0.000146572,
-    (float)2.20406e-05,
-    (float)0.000141008,
-    (float)1.87585e-05,
-    (float)0.000134712,
-    (float)1.63741e-05,
-    (float)0.000128029,
-    (float)1.46082e-05,
-    (float)0.000121604,
-    (float)1.33168e-05,
-    (float)0.000115777,
-    (float)1.24671e-05,
-    (float)0.000110425,
-    (float)1.20666e-05,
-    (float)0.000105183,
-    (float)1.2127e-05,
-    (float)9.97098e-05,
-    (float)1.26477e-05,
-    (float)9.39208e-05,
-    (float)1.3578e-05,
-    (float)8.80828e-05,
-    (float)1.47886e-05,
-    (float)8.25996e-05,
-    (float)1.61183e-05,
-    (float)7.76473e-05,
-    (float)1.74695e-05,
-    (float)7.30687e-05,
-    (float)1.88533e-05,
-    (float)6.85858e-05,
-    (float)2.03452e-05,
-    (float)6.40348e-05,
-    (float)2.20129e-05,
-    (float)5.94475e-05,
-    (float)2.38546e-05,
-    (float)5.50164e-05,
-    (float)2.57638e-05,
-    (float)5.09681e-05,
-    (float)2.75697e-05,
-    (float)4.73886e-05,
-    (float)2.91636e-05,
-    (float)4.41609e-05,
-    (float)3.05889e-05,
-    (float)4.10933e-05,
-    (float)3.19839e-05,
-    (float)3.80946e-05,
-    (float)3.34439e-05,
-    (float)3.52218e-05,
-    (float)3.49415e-05,
-    (float)3.26104e-05,
-    (float)3.63459e-05,
-    (float)3.03832e-05,
-    (float)3.75025e-05,
-    (float)2.85813e-05,
-    (float)3.83417e-05,
-    (float)2.71388e-05,
-    (float)3.89459e-05,
-    (float)2.59336e-05,
-    (float)3.94832e-05,
-    (float)2.48879e-05,
-    (float)4.00474e-05,
-    (float)2.40273e-05,
-    (float)4.05711e-05,
-    (float)2.34485e-05,
-    (float)4.08937e-05,
-    (float)2.32436e-05,
-    (float)0.827886,
-    (float)0.0025298,
-    (float)0.0832668,
-    (float)0.00305579,
-    (float)0.0253457,
-    (float)0.00350957,
-    (float)0.0105782,
-    (float)0.00367308,
-    (float)0.00510731,
-    (float)0.00354142,
-    (float)0.00259909,
-    (float)0.00321279,
-    (float)0.00127916,
-    (float)0.00281011,
-    (float)0.000550657,
-    (float)0.0024305,
-    (float)0.000180991,
-    (float)0.00209693,
-    (float)3.74927e-05,
-    (float)0.0017768,
-    (float)2.15264e-05,
-    (float)0.0014496,
-    (float)7.15326e-05,
-    (float)0.00113089,
-    (float)0.000155174,
-    (float)0.000845664,
-    (float)0.000251244,
-    (float)0.000607188,
-    (float)0.000341266,
-    (float)0.000415773,
-    (float)0.000410525,
-    (float)0.000265105,
-    (float)0.000453182,
-    (float)0.00015054,
-    (float)0.000472518,
-    (float)7.15122e-05,
-    (float)0.0004727,
-    (float)2.63453e-05,
-    (float)0.000453841,
-    (float)9.46007e-06,
-    (float)0.000416093,
-    (float)1.39455e-05,
-    (float)0.000363489,
-    (float)3.3728e-05,
-    (float)0.000302808,
-    (float)6.34032e-05,
-    (float)0.000240966,
-    (float)9.73764e-05,
-    (float)0.000182783,
-    (float)0.000129993,
-    (float)0.00013049,
-    (float)0.00015724,
-    (float)8.56496e-05,
-    (float)0.000177547,
-    (float)5.03344e-05,
-    (float)0.000190255,
-    (float)2.60138e-05,
-    (float)0.000194466,
-    (float)1.26218e-05,
-    (float)0.000189696,
-    (float)8.96608e-06,
-    (float)0.000176613,
-    (float)1.33829e-05,
-    (float)0.000157147,
-    (float)2.39905e-05,
-    (float)0.000134015,
-    (float)3.85779e-05,
-    (float)0.000109622,
-    (float)5.4693e-05,
-    (float)8.55128e-05,
-    (float)7.02595e-05,
-    (float)6.29772e-05,
-    (float)8.39009e-05,
-    (float)4.34677e-05,
-    (float)9.46116e-05,
-    (float)2.82036e-05,
-    (float)0.000101541,
-    (float)1.7805e-05,
-    (float)0.000104107,
-    (float)1.23078e-05,
-    (float)0.000102169,
-    (float)1.13202e-05,
-    (float)9.62453e-05,
-    (float)1.41644e-05,
-    (float)8.74161e-05,
-    (float)1.99228e-05,
-    (float)7.67702e-05,
-    (float)2.75239e-05,
-    (float)6.51241e-05,
-    (float)3.59488e-05,
-    (float)5.32569e-05,
-    (float)4.43317e-05,
-    (float)4.20297e-05,
-    (float)5.19319e-05,
-    (float)3.2224e-05,
-    (float)5.81333e-05,
-    (float)2.44136e-05,
-    (float)6.24424e-05,
-    (float)1.89089e-05,
-    (float)6.45516e-05,
-    (float)1.57442e-05,
-    (float)6.45031e-05,
-    (float)1.47461e-05,
-    (float)6.26413e-05,
-    (float)1.56206e-05,
-    (float)5.93366e-05,
-    (float)1.80058e-05,
-    (float)5.4896e-05,
-    (float)2.15069e-05,
-    (float)4.96684e-05,
-    (float)2.57187e-05,
-    (float)4.40523e-05,
-    (float)3.02601e-05,
-    (float)3.84354e-05,
-    (float)3.47907e-05,
-    (float)3.31743e-05,
-    (float)3.89919e-05,
-    (float)2.85349e-05,
-    (float)4.26174e-05,
-    (float)2.464e-05,
-    (float)4.5576e-05,
-    (float)2.15338e-05,
-    (float)4.78657e-05,
-    (float)1.92676e-05,
-    (float)4.94441e-05,
-    (float)1.78947e-05,
-    (float)5.02454e-05,
-    (float)1.74366e-05,
-    (float)0.823788,
-    (float)0.00976053,
-    (float)0.0742744,
-    (float)0.0103758,
-    (float)0.0179485,
-    (float)0.0101807,
-    (float)0.00498081,
-    (float)0.00890873,
-    (float)0.00110983,
-    (float)0.00699238,
-    (float)9.01649e-05,
-    (float)0.00498463,
-    (float)0.000186036,
-    (float)0.00325514,
-    (float)0.000681467,
-    (float)0.00191724,
-    (float)0.00116327,
-    (float)0.000944439,
-    (float)0.00144323,
-    (float)0.000325644,
-    (float)0.00150348,
-    (float)4.70302e-05,
-    (float)0.00137425,
-    (float)3.11873e-05,
-    (float)0.00109936,
-    (float)0.000167871,
-    (float)0.000753204,
-    (float)0.000359805,
-    (float)0.000423499,
-    (float)0.00053334,
-    (float)0.000176915,
-    (float)0.000634616,
-    (float)4.00029e-05,
-    (float)0.000636836,
-    (float)8.09025e-06,
-    (float)0.000551535,
-    (float)5.95724e-05,
-    (float)0.000414549,
-    (float)0.000158095,
-    (float)0.000262957,
-    (float)0.000261031,
-    (float)0.000129135,
-    (float)0.000334874,
-    (float)3.90201e-05,
-    (float)0.000362151,
-    (float)5.4141e-06,
-    (float)0.000339856,
-    (float)2.40082e-05,
-    (float)0.000276085,
-    (float)7.74931e-05,
-    (float)0.000189006,
-    (float)0.000144146,
-    (float)0.000102932,
-    (float)0.000202616,
-    (float)3.85634e-05,
-    (float)0.000235194,
-    (float)6.98904e-06,
-    (float)0.000233475,
-    (float)1.00188e-05,
-    (float)0.000200571,
-    (float)4.12022e-05,
-    (float)0.000147793,
-    (float)8.73037e-05,
-    (float)8.96747e-05,
-    (float)0.000132237,
-    (float)4.01753e-05,
-    (float)0.000162678,
-    (float)1.02528e-05,
-    (float)0.000171414,
-    (float)5.05857e-06,
-    (float)0.00015712,
-    (float)2.23165e-05,
-    (float)0.000124085,
-    (float)5.41395e-05,
-    (float)8.17528e-05,
-    (float)9.00164e-05,
-    (float)4.17426e-05,
-    (float)0.000119266,
-    (float)1.39149e-05,
-    (float)0.000133495,
-    (float)3.83587e-06,
-    (float)0.000129021,
-    (float)1.21038e-05,
-    (float)0.00010803,
-    (float)3.46586e-05,
-    (float)7.70989e-05,
-    (float)6.37433e-05,
-    (float)4.45205e-05,
-    (float)9.03415e-05,
-    (float)1.84133e-05,
-    (float)0.00010708,
-    (float)4.99932e-06,
-    (float)0.000109835,
-    (float)6.8114e-06,
-    (float)9.82181e-05,
-    (float)2.20403e-05,
-    (float)7.55193e-05,
-    (float)4.54554e-05,
-    (float)4.80093e-05,
-    (float)7.01369e-05,
-    (float)2.3214e-05,
-    (float)8.91111e-05,
-    (float)7.49188e-06,
-    (float)9.70217e-05,
-    (float)4.3353e-06,
-    (float)9.18295e-05,
-    (float)1.38543e-05,
-    (float)7.53674e-05,
-    (float)3.2874e-05,
-    (float)5.23971e-05,
-    (float)5.57039e-05,
-    (float)2.90721e-05,
-    (float)7.57765e-05,
-    (float)1.14441e-05,
-    (float)8.76204e-05,
-    (float)4.05094e-06,
-    (float)8.82341e-05,
-    (float)8.63107e-06,
-    (float)7.75443e-05,
-    (float)2.357e-05,
-    (float)5.83897e-05,
-    (float)4.45341e-05,
-    (float)3.60028e-05,
-    (float)6.57729e-05,
-    (float)1.65848e-05,
-    (float)8.14919e-05,
-    (float)5.40971e-06,
-    (float)8.72868e-05,
-    (float)0.816547,
-    (float)0.0218778,
-    (float)0.0616072,
-    (float)0.0208908,
-    (float)0.00942379,
-    (float)0.0171874,
-    (float)0.000699108,
-    (float)0.0116616,
-    (float)0.000343717,
-    (float)0.00635772,
-    (float)0.00180248,
-    (float)0.00259076,
-    (float)0.00298986,
-    (float)0.000601895,
-    (float)0.00316263,
-    (float)2.31837e-05,
-    (float)0.00246065,
-    (float)0.000327349,
-    (float)0.00143864,
-    (float)0.000918276,
-    (float)0.000556132,
-    (float)0.00130123,
-    (float)7.53489e-05,
-    (float)0.00129089,
-    (float)4.92021e-05,
-    (float)0.000959426,
-    (float)0.000311778,
-    (float)0.000503802,
-    (float)0.000608072,
-    (float)0.000140882,
-    (float)0.000750654,
-    (float)6.83739e-06,
-    (float)0.000679455,
-    (float)9.36821e-05,
-    (float)0.000447742,
-    (float)0.000286213,
-    (float)0.000187533,
-    (float)0.000449545,
-    (float)2.76625e-05,
-    (float)0.000488158,
-    (float)1.81717e-05,
-    (float)0.000387432,
-    (float)0.000125207,
-    (float)0.000214029,
-    (float)0.000264162,
-    (float)6.37288e-05,
-    (float)0.000346041,
-    (float)3.60758e-06,
-    (float)0.000325448,
-    (float)4.50111e-05,
-    (float)0.000222414,
-    (float)0.000146069,
-    (float)9.83395e-05,
-    (float)0.00023706,
-    (float)1.5993e-05,
-    (float)0.000264192,
-    (float)1.04048e-05,
-    (float)0.000216919,
-    (float)7.17309e-05,
-    (float)0.000124922,
-    (float)0.000154105,
-    (float)3.8914e-05,
-    (float)0.000206363,
-    (float)2.6654e-06,
-    (float)0.000200231,
-    (float)2.83852e-05,
-    (float)0.000141249,
-    (float)9.23985e-05,
-    (float)6.3698e-05,
-    (float)0.000153449,
-    (float)1.06328e-05,
-    (float)0.000175734,
-    (float)7.22556e-06,
-    (float)0.000147085,
-    (float)4.88446e-05,
-    (float)8.56693e-05,
-    (float)0.000107136,
-    (float)2.70798e-05,
-    (float)0.0001464,
-    (float)2.13276e-06,
-    (float)0.000143777,
-    (float)2.08063e-05,
-    (float)0.000102242,
-    (float)6.86418e-05,
-    (float)4.68522e-05,
-    (float)0.000115245,
-    (float)8.17522e-06,
-    (float)0.000132724,
-    (float)5.95606e-06,
-    (float)0.000112183,
-    (float)3.86598e-05,
-    (float)6.63577e-05,
-    (float)8.46267e-05,
-    (float)2.13084e-05,
-    (float)0.000116053,
-    (float)1.95554e-06,
-    (float)0.000115159,
-    (float)1.75975e-05,
-    (float)8.30246e-05,
-    (float)5.68595e-05,
-    (float)3.82726e-05,
-    (float)9.57224e-05,
-    (float)6.65238e-06,
-    (float)0.000111573,
-    (float)5.44295e-06,
-    (float)9.51458e-05,
-    (float)3.36343e-05,
-    (float)5.62815e-05,
-    (float)7.38121e-05,
-    (float)1.79307e-05,
-    (float)0.000102075,
-    (float)1.79722e-06,
-    (float)0.000101716,
-    (float)1.62151e-05,
-    (float)7.32438e-05,
-    (float)5.20931e-05,
-    (float)3.36969e-05,
-    (float)8.79554e-05,
-    (float)5.85962e-06,
-    (float)0.000102427,
-    (float)5.44592e-06,
-    (float)8.74068e-05,
-    (float)3.24583e-05,
-    (float)5.19635e-05,
-    (float)7.06512e-05,
-    (float)1.65288e-05,
-    (float)9.748e-05,
-    (float)1.80368e-06,
-    (float)0.807744,
-    (float)0.0381803,
-    (float)0.0472009,
-    (float)0.0321507,
-    (float)0.00283335,
-    (float)0.0209395,
-    (float)0.000699824,
-    (float)0.00954669,
-    (float)0.00388943,
-    (float)0.00242064,
-    (float)0.00544914,
-    (float)8.21379e-05,
-    (float)0.00433867,
-    (float)0.000627082,
-    (float)0.00204199,
-    (float)0.00185355,
-    (float)0.000391769,
-    (float)0.00227021,
-    (float)4.42013e-05,
-    (float)0.00161859,
-    (float)0.000585276,
-    (float)0.000630105,
-    (float)0.00116323,
-    (float)5.5971e-05,
-    (float)0.00118549,
-    (float)0.000123341,
-    (float)0.000712512,
-    (float)0.00052906,
-    (float)0.000196853,
-    (float)0.000786387,
-    (float)1.08863e-05,
-    (float)0.000666116,
-    (float)0.000186992,
-    (float)0.000319913,
-    (float)0.000457752,
-    (float)4.91698e-05,
-    (float)0.000539468,
-    (float)3.77124e-05,
-    (float)0.000377718,
-    (float)0.000220535,
-    (float)0.000132782,
-    (float)0.000380526,
-    (float)9.51265e-06,
-    (float)0.000366423,
-    (float)7.73297e-05,
-    (float)0.000204658,
-    (float)0.000228568,
-    (float)4.50391e-05,
-    (float)0.000304092,
-    (float)1.53191e-05,
-    (float)0.00023904,
-    (float)0.000110244,
-    (float)0.000100197,
-    (float)0.000217071,
-    (float)1.20849e-05,
-    (float)0.000231769,
-    (float)3.76524e-05,
-    (float)0.000145534,
-    (float)0.000130438,
-    (float)4.16607e-05,
-    (float)0.000192498,
-    (float)9.40989e-06,
-    (float)0.000166125,
-    (float)6.23952e-05,
-    (float)8.0125e-05,
-    (float)0.000137328,
-    (float)1.47098e-05,
-    (float)0.000159443,
-    (float)2.18895e-05,
-    (float)0.000110031,
-    (float)8.24775e-05,
-    (float)3.85041e-05,
-    (float)0.000131843,
-    (float)8.86147e-06,
-    (float)0.000122444,
-    (float)4.00199e-05,
-    (float)6.61273e-05,
-    (float)9.41644e-05,
-    (float)1.66522e-05,
-    (float)0.000116334,
-    (float)1.59089e-05,
-    (float)8.66627e-05,
-    (float)5.73692e-05,
-    (float)3.54987e-05,
-    (float)9.63342e-05,
-    (float)1.00057e-05,
-    (float)9.46141e-05,
-    (float)2.94657e-05,
-    (float)5.58375e-05,
-    (float)6.986e-05,
-    (float)1.77209e-05,
-    (float)8.97027e-05,
-    (float)1.42353e-05,
-    (float)7.06526e-05,
-    (float)4.43068e-05,
-    (float)3.24817e-05,
-    (float)7.53239e-05,
-    (float)1.14337e-05,
-    (float)7.65469e-05,
-    (float)2.50101e-05,
-    (float)4.79969e-05,
-    (float)5.65348e-05,
-    (float)1.79688e-05,
-    (float)7.34999e-05,
-    (float)1.44511e-05,
-    (float)5.97146e-05,
-    (float)3.82271e-05,
-    (float)2.95481e-05,
-    (float)6.37425e-05,
-    (float)1.25435e-05,
-    (float)6.5377e-05,
-    (float)2.39236e-05,
-    (float)4.21358e-05,
-    (float)5.04413e-05,
-    (float)1.7505e-05,
-    (float)6.47686e-05,
-    (float)1.54269e-05,
-    (float)5.27553e-05,
-    (float)3.66642e-05,
-    (float)2.68672e-05,
-    (float)5.89559e-05,
-    (float)1.31324e-05,
-    (float)5.96453e-05,
-    (float)2.4813e-05,
-    (float)3.82308e-05,
-    (float)4.95339e-05,
-    (float)1.6566e-05,
-    (float)6.20102e-05,
-    (float)0.794392,
-    (float)0.0582587,
-    (float)0.0323001,
-    (float)0.0419465,
-    (float)0.000203596,
-    (float)0.0197417,
-    (float)0.00512304,
-    (float)0.00439753,
-    (float)0.00835358,
-    (float)5.92002e-05,
-    (float)0.0058149,
-    (float)0.00172757,
-    (float)0.00168069,
-    (float)0.00343159,
-    (float)3.04274e-05,
-    (float)0.00274586,
-    (float)0.00084249,
-    (float)0.000888852,
-    (float)0.00185304,
-    (float)2.0139e-05,
-    (float)0.00159299,
-    (float)0.000493688,
-    (float)0.000553058,
-    (float)0.00115328,
-    (float)1.56385e-05,
-    (float)0.00103742,
-    (float)0.000322007,
-    (float)0.000378971,
-    (float)0.000781988,
-    (float)1.33548e-05,
-    (float)0.000727931,
-    (float)0.000224535,
-    (float)0.00027665,
-    (float)0.000562495,
-    (float)1.22017e-05,
-    (float)0.000537655,
-    (float)0.000164535,
-    (float)0.000211888,
-    (float)0.000422279,
-    (float)1.16821e-05,
-    (float)0.000412667,
-    (float)0.000125412,
-    (float)0.000168342,
-    (float)0.000327382,
-    (float)1.14638e-05,
-    (float)0.000326354,
-    (float)9.85795e-05,
-    (float)0.000137264,
-    (float)0.000260413,
-    (float)1.14972e-05,
-    (float)0.000263857,
-    (float)7.95613e-05,
-    (float)0.000114361,
-    (float)0.000211281,
-    (float)1.17998e-05,
-    (float)0.000217111,
-    (float)6.56874e-05,
-    (float)9.72315e-05,
-    (float)0.000174131,
-    (float)1.2266e-05,
-    (float)0.000181518,
-    (float)5.5307e-05,
-    (float)8.40457e-05,
-    (float)0.000145614,
-    (float)1.28319e-05,
-    (float)0.000153755,
-    (float)4.75254e-05,
-    (float)7.36187e-05,
-    (float)0.000123307,
-    (float)1.3543e-05,
-    (float)0.000131531,
-    (float)4.16829e-05,
-    (float)6.53178e-05,
-    (float)0.000105425,
-    (float)1.44113e-05,
-    (float)0.000113527,
-    (float)3.72204e-05,
-    (float)5.86685e-05,
-    (float)9.09351e-05,
-    (float)1.54052e-05,
-    (float)9.88052e-05,
-    (float)3.38416e-05,
-    (float)5.32848e-05,
-    (float)7.91433e-05,
-    (float)1.65302e-05,
-    (float)8.65828e-05,
-    (float)3.13835e-05,
-    (float)4.8914e-05,
-    (float)6.94248e-05,
-    (float)1.78052e-05,
-    (float)7.63221e-05,
-    (float)2.96637e-05,
-    (float)4.53611e-05,
-    (float)6.13368e-05,
-    (float)1.92384e-05,
-    (float)6.76349e-05,
-    (float)2.85525e-05,
-    (float)4.24819e-05,
-    (float)5.45864e-05,
-    (float)2.08545e-05,
-    (float)6.02092e-05,
-    (float)2.79839e-05,
-    (float)4.02005e-05,
-    (float)4.89275e-05,
-    (float)2.2671e-05,
-    (float)5.38357e-05,
-    (float)2.78968e-05,
-    (float)3.84369e-05,
-    (float)4.41872e-05,
-    (float)2.46909e-05,
-    (float)4.8339e-05,
-    (float)2.82646e-05,
-    (float)3.70995e-05,
-    (float)4.02387e-05,
-    (float)2.69544e-05,
-    (float)4.35388e-05,
-    (float)2.90891e-05,
-    (float)3.61604e-05,
-    (float)3.69452e-05,
-    (float)2.95207e-05,
-    (float)3.93256e-05,
-    (float)3.03466e-05,
-    (float)3.56264e-05,
-    (float)3.42191e-05,
-    (float)3.24086e-05,
-    (float)3.56457e-05,
-    (float)3.20359e-05,
-    (float)3.54598e-05,
-    (float)0.776509,
-    (float)0.0813737,
-    (float)0.0186702,
-    (float)0.0481698,
-    (float)0.00259493,
-    (float)0.0141118,
-    (float)0.0114843,
-    (float)0.00045933,
-    (float)0.00930531,
-    (float)0.00229115,
-    (float)0.00231919,
-    (float)0.00501821,
-    (float)9.39443e-05,
-    (float)0.003152,
-    (float)0.0019645,
-    (float)0.000381304,
-    (float)0.00268473,
-    (float)0.000374495,
-    (float)0.00114279,
-    (float)0.00159639,
-    (float)2.40389e-05,
-    (float)0.00146572,
-    (float)0.000588141,
-    (float)0.00034957,
-    (float)0.00121507,
-    (float)6.69543e-05,
-    (float)0.000742781,
-    (float)0.000671803,
-    (float)6.23749e-05,
-    (float)0.000848543,
-    (float)0.000197355,
-    (float)0.000320134,
-    (float)0.000641272,
-    (float)1.07521e-05,
-    (float)0.000532675,
-    (float)0.000305688,
-    (float)9.98391e-05,
-    (float)0.000536255,
-    (float)6.0621e-05,
-    (float)0.000289197,
-    (float)0.000357046,
-    (float)1.57072e-05,
-    (float)0.000396952,
-    (float)0.000136947,
-    (float)0.000125273,
-    (float)0.000350012,
-    (float)1.52787e-05,
-    (float)0.000256217,
-    (float)0.000198957,
-    (float)3.62707e-05,
-    (float)0.000297846,
-    (float)5.62434e-05,
-    (float)0.000138739,
-    (float)0.000227612,
-    (float)7.83712e-06,
-    (float)0.000221634,
-    (float)0.000106095,
-    (float)5.79137e-05,
-    (float)0.000220746,
-    (float)2.00822e-05,
-    (float)0.000142209,
-    (float)0.000143758,
-    (float)1.6478e-05,
-    (float)0.000186555,
-    (float)5.20898e-05,
-    (float)7.56487e-05,
-    (float)0.000159387,
-    (float)8.50462e-06,
-    (float)0.000137783,
-    (float)8.62907e-05,
-    (float)3.10848e-05,
-    (float)0.000151987,
-    (float)2.31652e-05,
-    (float)8.76059e-05,
-    (float)0.000110462,
-    (float)1.06543e-05,
-    (float)0.000127085,
-    (float)4.80685e-05,
-    (float)4.63661e-05,
-    (float)0.000118916,
-    (float)1.08812e-05,
-    (float)9.33276e-05,
-    (float)7.2315e-05,
-    (float)2.00551e-05,
-    (float)0.000111787,
-    (float)2.4682e-05,
-    (float)5.95916e-05,
-    (float)8.85831e-05,
-    (float)9.78304e-06,
-    (float)9.32294e-05,
-    (float)4.40847e-05,
-    (float)3.2577e-05,
-    (float)9.36494e-05,
-    (float)1.29895e-05,
-    (float)6.91523e-05,
-    (float)6.21624e-05,
-    (float)1.59435e-05,
-    (float)8.78961e-05,
-    (float)2.5015e-05,
-    (float)4.53601e-05,
-    (float)7.42301e-05,
-    (float)1.04364e-05,
-    (float)7.41641e-05,
-    (float)4.05771e-05,
-    (float)2.64379e-05,
-    (float)7.82367e-05,
-    (float)1.4333e-05,
-    (float)5.65509e-05,
-    (float)5.51275e-05,
-    (float)1.48614e-05,
-    (float)7.45136e-05,
-    (float)2.4608e-05,
-    (float)3.89246e-05,
-    (float)6.56032e-05,
-    (float)1.12237e-05,
-    (float)6.47787e-05,
-    (float)3.79694e-05,
-    (float)2.43029e-05,
-    (float)7.03839e-05,
-    (float)1.484e-05,
-    (float)5.13914e-05,
-    (float)5.13702e-05,
-    (float)1.48181e-05,
-    (float)6.90579e-05,
-    (float)2.41239e-05,
-    (float)3.70298e-05,
-    (float)6.2309e-05,
-    (float)1.15608e-05,
-    (float)0.754187,
-    (float)0.106593,
-    (float)0.0080191,
-    (float)0.0493949,
-    (float)0.00953386,
-    (float)0.00672739,
-    (float)0.0159459,
-    (float)0.00113721,
-    (float)0.00568,
-    (float)0.00668589,
-    (float)4.85656e-05,
-    (float)0.00457833,
-    (float)0.00280775,
-    (float)0.000329469,
-    (float)0.00348226,
-    (float)0.000993534,
-    (float)0.000795765,
-    (float)0.00245784,
-    (float)0.000218346,
-    (float)0.0011267,
-    (float)0.00156455,
-    (float)1.27508e-05,
-    (float)0.001251,
-    (float)0.000856401,
-    (float)9.5816e-05,
-    (float)0.0011844,
-    (float)0.000367289,
-    (float)0.000285648,
-    (float)0.000978239,
-    (float)9.58482e-05,
-    (float)0.000469082,
-    (float)0.00070094,
-    (float)6.3539e-06,
-    (float)0.000582849,
-    (float)0.000422596,
-    (float)4.30801e-05,
-    (float)0.000602037,
-    (float)0.000198185,
-    (float)0.000145708,
-    (float)0.000533298,
-    (float)5.73638e-05,
-    (float)0.000259564,
-    (float)0.000406044,
-    (float)4.43871e-06,
-    (float)0.000342757,
-    (float)0.000259366,
-    (float)2.4287e-05,
-    (float)0.000371928,
-    (float)0.000129197,
-    (float)8.94605e-05,
-    (float)0.000344192,
-    (float)4.03623e-05,
-    (float)0.000167733,
-    (float)0.000273294,
-    (float)3.58056e-06,
-    (float)0.000230322,
-    (float)0.000182047,
-    (float)1.54809e-05,
-    (float)0.000258716,
-    (float)9.47596e-05,
-    (float)6.11371e-05,
-    (float)0.000247497,
-    (float)3.13531e-05,
-    (float)0.000119348,
-    (float)0.00020299,
-    (float)3.14646e-06,
-    (float)0.000169267,
-    (float)0.000139584,
-    (float)1.0782e-05,
-    (float)0.000195838,
-    (float)7.51458e-05,
-    (float)4.52152e-05,
-    (float)0.00019261,
-    (float)2.60759e-05,
-    (float)9.14774e-05,
-    (float)0.000162124,
-    (float)2.91039e-06,
-    (float)0.000133501,
-    (float)0.000114342,
-    (float)7.9171e-06,
-    (float)0.000158369,
-    (float)6.33431e-05,
-    (float)3.54211e-05,
-    (float)0.000159289,
-    (float)2.2966e-05,
-    (float)7.42614e-05,
-    (float)0.000136928,
-    (float)2.84589e-06,
-    (float)0.000111266,
-    (float)9.87091e-05,
-    (float)6.13876e-06,
-    (float)0.000134902,
-    (float)5.61555e-05,
-    (float)2.92798e-05,
-    (float)0.000138368,
-    (float)2.1219e-05,
-    (float)6.34504e-05,
-    (float)0.000121266,
-    (float)2.89578e-06,
-    (float)9.72927e-05,
-    (float)8.92787e-05,
-    (float)4.97594e-06,
-    (float)0.00012025,
-    (float)5.2103e-05,
-    (float)2.52858e-05,
-    (float)0.000125581,
-    (float)2.04569e-05,
-    (float)5.6537e-05,
-    (float)0.000112095,
-    (float)3.04712e-06,
-    (float)8.86054e-05,
-    (float)8.41777e-05,
-    (float)4.19613e-06,
-    (float)0.000111579,
-    (float)5.0289e-05,
-    (float)2.27189e-05,
-    (float)0.000118617,
-    (float)2.0438e-05,
-    (float)5.23976e-05,
-    (float)0.000107789,
-    (float)3.2875e-06,
-    (float)8.39186e-05,
-    (float)8.24981e-05,
-    (float)3.66096e-06,
-    (float)0.000107651,
-    (float)5.04039e-05,
-    (float)2.11755e-05,
-    (float)0.000116439,
-    (float)0.731121,
-    (float)0.133946,
-    (float)0.00175209,
-    (float)0.0452787,
-    (float)0.0193061,
-    (float)0.00118942,
-    (float)0.0155959,
-    (float)0.00632559,
-    (float)0.00105647,
-    (float)0.00798469,
-    (float)0.00265678,
-    (float)0.000983462,
-    (float)0.00485869,
-    (float)0.00122525,
-    (float)0.000928137,
-    (float)0.00323518,
-    (float)0.000576545,
-    (float)0.000880621,
-    (float)0.00226367,
-    (float)0.000262218,
-    (float)0.000836224,
-    (float)0.00162743,
-    (float)0.000108319,
-    (float)0.000791373,
-    (float)0.00118646,
-    (float)3.72713e-05,
-    (float)0.000743639,
-    (float)0.000869899,
-    (float)1.13251e-05,
-    (float)0.00069222,
-    (float)0.000637388,
-    (float)1.07797e-05,
-    (float)0.00063786,
-    (float)0.000463775,
-    (float)2.44789e-05,
-    (float)0.000582167,
-    (float)0.000332635,
-    (float)4.55206e-05,
-    (float)0.000526755,
-    (float)0.000233125,
-    (float)6.9412e-05,
-    (float)0.000472693,
-    (float)0.000158042,
-    (float)9.3286e-05,
-    (float)0.000420432,
-    (float)0.000102403,
-    (float)0.000115447,
-    (float)0.000370102,
-    (float)6.24587e-05,
-    (float)0.000134959,
-    (float)0.00032187,
-    (float)3.5146e-05,
-    (float)0.000151287,
-    (float)0.000276119,
-    (float)1.78775e-05,
-    (float)0.00016407,
-    (float)0.000233393,
-    (float)8.50247e-06,
-    (float)0.000173079,
-    (float)0.000194205,
-    (float)5.27639e-06,
-    (float)0.000178271,
-    (float)0.000158881,
-    (float)6.77959e-06,
-    (float)0.000179838,
-    (float)0.000127522,
-    (float)1.18141e-05,
-    (float)0.000178167,
-    (float)0.00010008,
-    (float)1.93349e-05,
-    (float)0.00017373,
-    (float)7.64518e-05,
-    (float)2.84379e-05,
-    (float)0.000166975,
-    (float)5.65386e-05,
-    (float)3.83769e-05,
-    (float)0.000158273,
-    (float)4.0232e-05,
-    (float)4.85684e-05,
-    (float)0.000147952,
-    (float)2.73793e-05,
-    (float)5.85618e-05,
-    (float)0.000136349,
-    (float)1.77623e-05,
-    (float)6.79926e-05,
-    (float)0.000123849,
-    (float)1.11086e-05,
-    (float)7.65496e-05,
-    (float)0.000110862,
-    (float)7.12088e-06,
-    (float)8.39751e-05,
-    (float)9.77784e-05,
-    (float)5.50141e-06,
-    (float)9.00882e-05,
-    (float)8.49194e-05,
-    (float)5.95831e-06,
-    (float)9.47998e-05,
-    (float)7.25273e-05,
-    (float)8.20109e-06,
-    (float)9.81017e-05,
-    (float)6.07876e-05,
-    (float)1.19402e-05,
-    (float)0.000100031,
-    (float)4.98612e-05,
-    (float)1.6897e-05,
-    (float)0.000100632,
-    (float)3.99023e-05,
-    (float)2.28162e-05,
-    (float)9.99473e-05,
-    (float)3.10544e-05,
-    (float)2.94709e-05,
-    (float)9.80224e-05,
-    (float)2.34347e-05,
-    (float)3.66532e-05,
-    (float)9.49342e-05,
-    (float)1.7125e-05,
-    (float)4.41601e-05,
-    (float)9.07993e-05,
-    (float)1.21749e-05,
-    (float)5.17882e-05,
-    (float)8.57629e-05,
-    (float)8.61532e-06,
-    (float)5.93412e-05,
-    (float)7.99735e-05,
-    (float)6.46854e-06,
-    (float)6.66463e-05,
-    (float)7.35628e-05,
-    (float)5.75086e-06,
-    (float)0.705361,
-    (float)0.161259,
-    (float)0.00109607,
-    (float)0.036618,
-    (float)0.0286785,
-    (float)0.000627546,
-    (float)0.0105213,
-    (float)0.0119451,
-    (float)0.000537397,
-    (float)0.00449959,
-    (float)0.0066135,
-    (float)0.000502146,
-    (float)0.00229066,
-    (float)0.00421323,
-    (float)0.000482036,
-    (float)0.00127789,
-    (float)0.00291275,
-    (float)0.000467195,
-    (float)0.000748872,
-    (float)0.00212167,
-    (float)0.000454069,
-    (float)0.000448671,
-    (float)0.00160077,
-    (float)0.000440984,
-    (float)0.000269158,
-    (float)0.00123739,
-    (float)0.000427034,
-    (float)0.00015875,
-    (float)0.000972536,
-    (float)0.000411766,
-    (float)9.05036e-05,
-    (float)0.000772861,
-    (float)0.000395082,
-    (float)4.92056e-05,
-    (float)0.000618344,
-    (float)0.000377148,
-    (float)2.56442e-05,
-    (float)0.000496372,
-    (float)0.000358294,
-    (float)1.39024e-05,
-    (float)0.000398648,
-    (float)0.000338887,
-    (float)1.00207e-05,
-    (float)0.000319507,
-    (float)0.000319232,
-    (float)1.12942e-05,
-    (float)0.000254955,
-    (float)0.000299518,
-    (float)1.58643e-05,
-    (float)0.000202112,
-    (float)0.000279821,
-    (float)2.2451e-05,
-    (float)0.000158855,
-    (float)0.000260153,
-    (float)3.01632e-05,
-    (float)0.000123584,
-    (float)0.000240526,
-    (float)3.83637e-05,
-    (float)9.50556e-05,
-    (float)0.000220997,
-    (float)4.6581e-05,
-    (float)7.22569e-05,
-    (float)0.000201694,
-    (float)5.44578e-05,
-    (float)5.43332e-05,
-    (float)0.000182795,
-    (float)6.17232e-05,
-    (float)4.0546e-05,
-    (float)0.000164498,
-    (float)6.81761e-05,
-    (float)3.02578e-05,
-    (float)0.000146981,
-    (float)7.36736e-05,
-    (float)2.29273e-05,
-    (float)0.000130384,
-    (float)7.81198e-05,
-    (float)1.81023e-05,
-    (float)0.000114803,
-    (float)8.14576e-05,
-    (float)1.54033e-05,
-    (float)0.000100301,
-    (float)8.36644e-05,
-    (float)1.45008e-05,
-    (float)8.69244e-05,
-    (float)8.47512e-05,
-    (float)1.5093e-05,
-    (float)7.47193e-05,
-    (float)8.47619e-05,
-    (float)1.68907e-05,
-    (float)6.37314e-05,
-    (float)8.37697e-05,
-    (float)1.96144e-05,
-    (float)5.40049e-05,
-    (float)8.18684e-05,
-    (float)2.30008e-05,
-    (float)4.55753e-05,
-    (float)7.91617e-05,
-    (float)2.6812e-05,
-    (float)3.8464e-05,
-    (float)7.57536e-05,
-    (float)3.08425e-05,
-    (float)3.26753e-05,
-    (float)7.17453e-05,
-    (float)3.49186e-05,
-    (float)2.81969e-05,
-    (float)6.72383e-05,
-    (float)3.88928e-05,
-    (float)2.49989e-05,
-    (float)6.23421e-05,
-    (float)4.26353e-05,
-    (float)2.30341e-05,
-    (float)5.71822e-05,
-    (float)4.60285e-05,
-    (float)2.22376e-05,
-    (float)5.19011e-05,
-    (float)4.89652e-05,
-    (float)2.25284e-05,
-    (float)4.66538e-05,
-    (float)5.13516e-05,
-    (float)2.3813e-05,
-    (float)4.15969e-05,
-    (float)5.31114e-05,
-    (float)2.59921e-05,
-    (float)3.68777e-05,
-    (float)5.41894e-05,
-    (float)2.89643e-05,
-    (float)3.26281e-05,
-    (float)5.45524e-05,
-    (float)0.675747,
-    (float)0.18765,
-    (float)0.00646326,
-    (float)0.0251423,
-    (float)0.0348467,
-    (float)0.00568357,
-    (float)0.00390917,
-    (float)0.0136083,
-    (float)0.00503994,
-    (float)0.000498961,
-    (float)0.00632141,
-    (float)0.00430273,
-    (float)3.7149e-05,
-    (float)0.00296979,
-    (float)0.00350292,
-    (float)0.000267429,
-    (float)0.00127228,
-    (float)0.0026983,
-    (float)0.000609275,
-    (float)0.000432707,
-    (float)0.00194548,
-    (float)0.000875796,
-    (float)8.34517e-05,
-    (float)0.00129081,
-    (float)0.00101036,
-    (float)1.61716e-05,
-    (float)0.000765912,
-    (float)0.00101163,
-    (float)9.59103e-05,
-    (float)0.000385404,
-    (float)0.000905485,
-    (float)0.000230303,
-    (float)0.000146706,
-    (float)0.000730567,
-    (float)0.000357829,
-    (float)3.20626e-05,
-    (float)0.000528307,
-    (float)0.00044248,
-    (float)1.28026e-05,
-    (float)0.00033537,
-    (float)0.000469703,
-    (float)5.5016e-05,
-    (float)0.000178521,
-    (float)0.000441705,
-    (float)0.000125374,
-    (float)7.22917e-05,
-    (float)0.000371952,
-    (float)0.00019588,
-    (float)1.92777e-05,
-    (float)0.000279535,
-    (float)0.000246842,
-    (float)1.23937e-05,
-    (float)0.000184167,
-    (float)0.000267964,
-    (float)3.82088e-05,
-    (float)0.000102337,
-    (float)0.000257818,
-    (float)8.05963e-05,
-    (float)4.48586e-05,
-    (float)0.00022207,
-    (float)0.000124134,
-    (float)1.58752e-05,
-    (float)0.000170874,
-    (float)0.000156804,
-    (float)1.3266e-05,
-    (float)0.000115913,
-    (float)0.000171638,
-    (float)3.02056e-05,
-    (float)6.76518e-05,
-    (float)0.000167094,
-    (float)5.74256e-05,
-    (float)3.33395e-05,
-    (float)0.000146268,
-    (float)8.55804e-05,
-    (float)1.60834e-05,
-    (float)0.000115283,
-    (float)0.000107168,
-    (float)1.49966e-05,
-    (float)8.13768e-05,
-    (float)0.000117683,
-    (float)2.61498e-05,
-    (float)5.11637e-05,
-    (float)0.000115932,
-    (float)4.39458e-05,
-    (float)2.93732e-05,
-    (float)0.000103634,
-    (float)6.25641e-05,
-    (float)1.8202e-05,
-    (float)8.45251e-05,
-    (float)7.71992e-05,
-    (float)1.72938e-05,
-    (float)6.31856e-05,
-    (float)8.48914e-05,
-    (float)2.42668e-05,
-    (float)4.38814e-05,
-    (float)8.48237e-05,
-    (float)3.56107e-05,
-    (float)2.96628e-05,
-    (float)7.80758e-05,
-    (float)4.7691e-05,
-    (float)2.192e-05,
-    (float)6.69709e-05,
-    (float)5.75856e-05,
-    (float)2.04365e-05,
-    (float)5.4262e-05,
-    (float)6.35619e-05,
-    (float)2.38212e-05,
-    (float)4.24097e-05,
-    (float)6.51519e-05,
-    (float)3.01133e-05,
-    (float)3.31185e-05,
-    (float)6.29114e-05,
-    (float)3.73586e-05,
-    (float)2.7174e-05,
-    (float)5.80082e-05,
-    (float)4.40301e-05,
-    (float)2.45402e-05,
-    (float)5.17763e-05,
-    (float)4.92365e-05,
-    (float)2.4633e-05,
-    (float)4.53436e-05,
-    (float)5.27094e-05,
-    (float)2.66745e-05,
-    (float)3.94198e-05,
-    (float)5.46027e-05,
-    (float)3.00123e-05,
-    (float)3.4292e-05,
-    (float)5.51914e-05,
-    (float)0.642524,
-    (float)0.211915,
-    (float)0.0178261,
-    (float)0.0134263,
-    (float)0.0357015,
-    (float)0.0145264,
-    (float)0.00019133,
-    (float)0.00983886,
-    (float)0.0104679,
-    (float)0.00118299,
-    (float)0.00209166,
-    (float)0.0063709,
-    (float)0.0027289,
-    (float)0.000100476,
-    (float)0.00304811,
-    (float)0.00314796,
-    (float)0.000299005,
-    (float)0.000953516,
-    (float)0.0025538,
-    (float)0.0010208,
-    (float)8.85148e-05,
-    (float)0.00151313,
-    (float)0.00145693,
-    (float)9.86113e-05,
-    (float)0.000582645,
-    (float)0.00137893,
-    (float)0.000481612,
-    (float)8.21311e-05,
-    (float)0.000933097,
-    (float)0.000806587,
-    (float)3.72708e-05,
-    (float)0.000416732,
-    (float)0.000854785,
-    (float)0.000259724,
-    (float)8.02725e-05,
-    (float)0.000639493,
-    (float)0.000498605,
-    (float)1.46497e-05,
-    (float)0.000321095,
-    (float)0.000580059,
-    (float)0.00014814,
-    (float)7.85027e-05,
-    (float)0.000472398,
-    (float)0.000326202,
-    (float)7.32658e-06,
-    (float)0.000262759,
-    (float)0.000414197,
-    (float)8.80209e-05,
-    (float)7.84026e-05,
-    (float)0.000364688,
-    (float)0.000223219,
-    (float)6.19989e-06,
-    (float)0.000222396,
-    (float)0.000308654,
-    (float)5.25899e-05,
-    (float)7.8271e-05,
-    (float)0.000292604,
-    (float)0.000156234,
-    (float)8.08346e-06,
-    (float)0.000194239,
-    (float)0.000235809,
-    (float)3.17294e-05,
-    (float)7.88453e-05,
-    (float)0.000240179,
-    (float)0.000111624,
-    (float)1.15063e-05,
-    (float)0.000172564,
-    (float)0.000184232,
-    (float)1.89766e-05,
-    (float)7.93576e-05,
-    (float)0.000201395,
-    (float)8.00676e-05,
-    (float)1.57323e-05,
-    (float)0.000156139,
-    (float)0.000145479,
-    (float)1.16091e-05,
-    (float)8.04474e-05,
-    (float)0.000171009,
-    (float)5.76267e-05,
-    (float)2.05752e-05,
-    (float)0.000142881,
-    (float)0.000116141,
-    (float)7.6305e-06,
-    (float)8.17e-05,
-    (float)0.000147201,
-    (float)4.10987e-05,
-    (float)2.57711e-05,
-    (float)0.000132442,
-    (float)9.30095e-05,
-    (float)6.18338e-06,
-    (float)8.34112e-05,
-    (float)0.000127668,
-    (float)2.9104e-05,
-    (float)3.1366e-05,
-    (float)0.00012369,
-    (float)7.47118e-05,
-    (float)6.56833e-06,
-    (float)8.52821e-05,
-    (float)0.000111574,
-    (float)2.02757e-05,
-    (float)3.72894e-05,
-    (float)0.000116475,
-    (float)5.97243e-05,
-    (float)8.48798e-06,
-    (float)8.75547e-05,
-    (float)9.77846e-05,
-    (float)1.40403e-05,
-    (float)4.36931e-05,
-    (float)0.00011027,
-    (float)4.74631e-05,
-    (float)1.17065e-05,
-    (float)9.01382e-05,
-    (float)8.59737e-05,
-    (float)9.81438e-06,
-    (float)5.06075e-05,
-    (float)0.000105055,
-    (float)3.72431e-05,
-    (float)1.61654e-05,
-    (float)9.31748e-05,
-    (float)7.55923e-05,
-    (float)7.41055e-06,
-    (float)5.81474e-05,
-    (float)0.000100535,
-    (float)2.8813e-05,
-    (float)2.18263e-05,
-    (float)9.6619e-05,
-    (float)6.64237e-05,
-    (float)6.60467e-06,
-    (float)0.606306,
-    (float)0.23348,
-    (float)0.034878,
-    (float)0.00421562,
-    (float)0.0306347,
-    (float)0.0235528,
-    (float)0.00243288,
-    (float)0.00346478,
-    (float)0.0114207,
-    (float)0.00647762,
-    (float)0.000134994,
-    (float)0.00310447,
-    (float)0.00575948,
-    (float)0.00212409,
-    (float)0.000108594,
-    (float)0.00266005,
-    (float)0.00315962,
-    (float)0.000614659,
-    (float)0.000398322,
-    (float)0.00218558,
-    (float)0.00170767,
-    (float)0.000103226,
-    (float)0.000658137,
-    (float)0.00170638,
-    (float)0.000844087,
-    (float)1.03069e-05,
-    (float)0.00081489,
-    (float)0.00124307,
-    (float)0.000351521,
-    (float)9.06558e-05,
-    (float)0.000853403,
-    (float)0.000838393,
-    (float)9.84441e-05,
-    (float)0.000223546,
-    (float)0.000800819,
-    (float)0.000503746,
-    (float)9.16905e-06,
-    (float)0.00034811,
-    (float)0.000677545,
-    (float)0.000258106,
-    (float)2.13173e-05,
-    (float)0.000428247,
-    (float)0.000521037,
-    (float)9.87162e-05,
-    (float)8.71482e-05,
-    (float)0.000455284,
-    (float)0.00035733,
-    (float)1.92045e-05,
-    (float)0.000169915,
-    (float)0.000430288,
-    (float)0.000211541,
-    (float)4.16339e-06,
-    (float)0.00024224,
-    (float)0.000365504,
-    (float)9.9951e-05,
-    (float)3.39809e-05,
-    (float)0.000287196,
-    (float)0.000278129,
-    (float)3.01733e-05,
-    (float)8.75355e-05,
-    (float)0.000298681,
-    (float)0.000184648,
-    (float)2.97753e-06,
-    (float)0.000145912,
-    (float)0.000276557,
-    (float)0.000102064,
-    (float)1.15697e-05,
-    (float)0.000192774,
-    (float)0.000229636,
-    (float)4.09354e-05,
-    (float)4.48636e-05,
-    (float)0.000219018,
-    (float)0.000168004,
-    (float)7.88613e-06,
-    (float)9.00458e-05,
-    (float)0.000219673,
-    (float)0.000104979,
-    (float)2.98237e-06,
-    (float)0.000133904,
-    (float)0.000197011,
-    (float)5.14215e-05,
-    (float)2.15699e-05,
-    (float)0.000166196,
-    (float)0.00015701,
-    (float)1.5604e-05,
-    (float)5.54147e-05,
-    (float)0.000180303,
-    (float)0.000108578,
-    (float)1.62004e-06,
-    (float)9.45905e-05,
-    (float)0.000173891,
-    (float)6.1796e-05,
-    (float)8.93321e-06,
-    (float)0.000129062,
-    (float)0.000149751,
-    (float)2.5e-05,
-    (float)3.30431e-05,
-    (float)0.00015152,
-    (float)0.000113133,
-    (float)4.55993e-06,
-    (float)6.68425e-05,
-    (float)0.000156918,
-    (float)7.25011e-05,
-    (float)2.78419e-06,
-    (float)0.000101517,
-    (float)0.000145091,
-    (float)3.58722e-05,
-    (float)1.8297e-05,
-    (float)0.000129316,
-    (float)0.000118704,
-    (float)1.05983e-05,
-    (float)4.64327e-05,
-    (float)0.000143924,
-    (float)8.39328e-05,
-    (float)1.18064e-06,
-    (float)8.01242e-05,
-    (float)0.000142404,
-    (float)4.83334e-05,
-    (float)8.78507e-06,
-    (float)0.000111497,
-    (float)0.000125451,
-    (float)1.93595e-05,
-    (float)3.1064e-05,
-    (float)0.000133701,
-    (float)9.66868e-05,
-    (float)3.23769e-06,
-    (float)6.28301e-05,
-    (float)0.000141531,
-    (float)0.571253,
-    (float)0.252002,
-    (float)0.0561635,
-    (float)0.000376849,
-    (float)0.0213036,
-    (float)0.028485,
-    (float)0.0100177,
-    (float)9.13713e-05,
-    (float)0.00671558,
-    (float)0.0102287,
-    (float)0.00394947,
-    (float)5.15596e-05,
-    (float)0.00329155,
-    (float)0.00518754,
-    (float)0.00207856,
-    (float)3.56653e-05,
-    (float)0.00195348,
-    (float)0.00314119,
-    (float)0.00125223,
-    (float)2.75328e-05,
-    (float)0.00131239,
-    (float)0.00209102,
-    (float)0.00083287,
-    (float)2.42531e-05,
-    (float)0.000944289,
-    (float)0.00149247,
-    (float)0.000589114,
-    (float)2.15816e-05,
-    (float)0.000714714,
-    (float)0.00111953,
-    (float)0.000434641,
-    (float)1.98336e-05,
-    (float)0.000563509,
-    (float)0.000867688,
-    (float)0.000334101,
-    (float)1.88321e-05,
-    (float)0.000454912,
-    (float)0.000693796,
-    (float)0.000263061,
-    (float)1.77386e-05,
-    (float)0.000376483,
-    (float)0.00056651,
-    (float)0.000212034,
-    (float)1.71054e-05,
-    (float)0.000317349,
-    (float)0.000470557,
-    (float)0.000174786,
-    (float)1.66286e-05,
-    (float)0.000270938,
-    (float)0.000397769,
-    (float)0.00014606,
-    (float)1.61536e-05,
-    (float)0.000234949,
-    (float)0.00034007,
-    (float)0.000124317,
-    (float)1.59295e-05,
-    (float)0.000205629,
-    (float)0.000294475,
-    (float)0.000107395,
-    (float)1.5644e-05,
-    (float)0.000181635,
-    (float)0.000257997,
-    (float)9.38761e-05,
-    (float)1.53882e-05,
-    (float)0.000162028,
-    (float)0.000227921,
-    (float)8.33961e-05,
-    (float)1.52134e-05,
-    (float)0.0001453,
-    (float)0.000203454,
-    (float)7.49446e-05,
-    (float)1.4971e-05,
-    (float)0.000131278,
-    (float)0.000183038,
-    (float)6.81821e-05,
-    (float)1.48157e-05,
-    (float)0.000119308,
-    (float)0.000165832,
-    (float)6.29076e-05,
-    (float)1.46864e-05,
-    (float)0.00010886,
-    (float)0.000151549,
-    (float)5.86202e-05,
-    (float)1.45465e-05,
-    (float)9.99487e-05,
-    (float)0.000139394,
-    (float)5.52893e-05,
-    (float)1.44754e-05,
-    (float)9.21358e-05,
-    (float)0.000129189,
-    (float)5.27484e-05,
-    (float)1.43802e-05,
-    (float)8.53067e-05,
-    (float)0.000120698,
-    (float)5.07886e-05,
-    (float)1.42934e-05,
-    (float)7.94148e-05,
-    (float)0.000113506,
-    (float)4.94605e-05,
-    (float)1.42366e-05,
-    (float)7.4182e-05,
-    (float)0.000107592,
-    (float)4.86357e-05,
-    (float)1.41593e-05,
-    (float)6.96067e-05,
-    (float)0.00010275,
-    (float)4.82456e-05,
-    (float)1.41121e-05,
-    (float)6.56024e-05,
-    (float)9.88062e-05,
-    (float)4.83209e-05,
-    (float)1.40797e-05,
-    (float)6.20435e-05,
-    (float)9.57858e-05,
-    (float)4.87593e-05,
-    (float)1.40418e-05,
-    (float)5.89706e-05,
-    (float)9.35583e-05,
-    (float)4.95483e-05,
-    (float)1.40305e-05,
-    (float)5.63261e-05,
-    (float)9.20731e-05,
-    (float)5.07138e-05,
-    (float)1.40213e-05,
-    (float)5.40617e-05,
-    (float)9.13658e-05,
-    (float)5.22075e-05,
-    (float)1.40106e-05,
-    (float)0.533242,
-    (float)0.265599,
-    (float)0.0801626,
-    (float)0.00348664,
-    (float)0.0105828,
-    (float)0.0269717,
-    (float)0.0188671,
-    (float)0.00314791,
-    (float)0.00113733,
-    (float)0.00788057,
-    (float)0.00864824,
-    (float)0.00288729,
-    (float)6.63442e-05,
-    (float)0.0028198,
-    (float)0.00478514,
-    (float)0.00253156,
-    (float)0.000112863,
-    (float)0.00099351,
-    (float)0.00277167,
-    (float)0.00214191,
-    (float)0.000346463,
-    (float)0.000281514,
-    (float)0.00157715,
-    (float)0.00174554,
-    (float)0.000550516,
-    (float)4.22941e-05,
-    (float)0.000846028,
-    (float)0.00135224,
-    (float)0.000678177,
-    (float)2.30794e-05,
-    (float)0.000402,
-    (float)0.000988817,
-    (float)0.000723972,
-    (float)9.64162e-05,
-    (float)0.000152195,
-    (float)0.00067582,
-    (float)0.000695411,
-    (float)0.00019561,
-    (float)3.80202e-05,
-    (float)0.000421084,
-    (float)0.000613585,
-    (float)0.000283027,
-    (float)1.24684e-05,
-    (float)0.000230807,
-    (float)0.000500487,
-    (float)0.000338316,
-    (float)3.95404e-05,
-    (float)0.000105249,
-    (float)0.000374928,
-    (float)0.000356369,
-    (float)9.06803e-05,
-    (float)3.65275e-05,
-    (float)0.000255418,
-    (float)0.000339808,
-    (float)0.000143949,
-    (float)1.35796e-05,
-    (float)0.0001554,
-    (float)0.000296026,
-    (float)0.000185654,
-    (float)2.29587e-05,
-    (float)8.15587e-05,
-    (float)0.000236683,
-    (float)0.000208108,
-    (float)5.04452e-05,
-    (float)3.62899e-05,
-    (float)0.000173068,
-    (float)0.000209142,
-    (float)8.38581e-05,
-    (float)1.74174e-05,
-    (float)0.000114306,
-    (float)0.000191834,
-    (float)0.000113322,
-    (float)1.92057e-05,
-    (float)6.76293e-05,
-    (float)0.000161548,
-    (float)0.000132322,
-    (float)3.45555e-05,
-    (float)3.67677e-05,
-    (float)0.000124819,
-    (float)0.000138345,
-    (float)5.57364e-05,
-    (float)2.19793e-05,
-    (float)8.86729e-05,
-    (float)0.000131678,
-    (float)7.59064e-05,
-    (float)2.11059e-05,
-    (float)5.85373e-05,
-    (float)0.000115163,
-    (float)9.03171e-05,
-    (float)2.98782e-05,
-    (float)3.76836e-05,
-    (float)9.34432e-05,
-    (float)9.63036e-05,
-    (float)4.32437e-05,
-    (float)2.72822e-05,
-    (float)7.11374e-05,
-    (float)9.37174e-05,
-    (float)5.66015e-05,
-    (float)2.61187e-05,
-    (float)5.21907e-05,
-    (float)8.45237e-05,
-    (float)6.63039e-05,
-    (float)3.14731e-05,
-    (float)3.9314e-05,
-    (float)7.16089e-05,
-    (float)7.048e-05,
-    (float)4.0003e-05,
-    (float)3.32936e-05,
-    (float)5.83187e-05,
-    (float)6.90604e-05,
-    (float)4.82971e-05,
-    (float)3.33879e-05,
-    (float)4.765e-05,
-    (float)6.32688e-05,
-    (float)5.38484e-05,
-    (float)3.76803e-05,
-    (float)4.13944e-05,
-    (float)5.54633e-05,
-    (float)5.54028e-05,
-    (float)4.34652e-05,
-    (float)4.01254e-05,
-    (float)4.8337e-05,
-    (float)5.3001e-05,
-    (float)4.82062e-05,
-    (float)4.30363e-05,
-    (float)4.40839e-05,
-    (float)4.81216e-05,
-    (float)5.00399e-05,
-    (float)0.492582,
-    (float)0.27347,
-    (float)0.104859,
-    (float)0.0141646,
-    (float)0.00240195,
-    (float)0.0193928,
-    (float)0.0236977,
-    (float)0.0112629,
-    (float)0.000867174,
-    (float)0.00209054,
-    (float)0.00761761,
-    (float)0.00769014,
-    (float)0.00281839,
-    (float)3.47432e-05,
-    (float)0.00188341,
-    (float)0.0042313,
-    (float)0.00331231,
-    (float)0.000769618,
-    (float)0.00013893,
-    (float)0.00167247,
-    (float)0.00259552,
-    (float)0.00153557,
-    (float)0.000158455,
-    (float)0.000329726,
-    (float)0.00143228,
-    (float)0.0016337,
-    (float)0.000681247,
-    (float)1.61936e-05,
-    (float)0.00047788,
-    (float)0.00117678,
-    (float)0.00100671,
-    (float)0.000261571,
-    (float)4.28872e-05,
-    (float)0.000557836,
-    (float)0.000924965,
-    (float)0.000584323,
-    (float)7.32387e-05,
-    (float)0.000124768,
-    (float)0.000572588,
-    (float)0.000689812,
-    (float)0.000307075,
-    (float)1.28249e-05,
-    (float)0.000208782,
-    (float)0.000538164,
-    (float)0.000480818,
-    (float)0.000136985,
-    (float)2.2881e-05,
-    (float)0.000271469,
-    (float)0.000467777,
-    (float)0.000308528,
-    (float)4.60625e-05,
-    (float)6.58578e-05,
-    (float)0.000304184,
-    (float)0.000376792,
-    (float)0.000177167,
-    (float)1.26461e-05,
-    (float)0.00011711,
-    (float)0.00030564,
-    (float)0.000280784,
-    (float)8.63326e-05,
-    (float)1.75375e-05,
-    (float)0.000161551,
-    (float)0.000280554,
-    (float)0.000190758,
-    (float)3.38111e-05,
-    (float)4.41545e-05,
-    (float)0.000189791,
-    (float)0.000237077,
-    (float)0.000115395,
-    (float)1.34102e-05,
-    (float)7.89987e-05,
-    (float)0.000198416,
-    (float)0.000183823,
-    (float)6.03071e-05,
-    (float)1.71079e-05,
-    (float)0.0001112,
-    (float)0.000188709,
-    (float)0.000129239,
-    (float)2.71561e-05,
-    (float)3.62883e-05,
-    (float)0.000133785,
-    (float)0.00016391,
-    (float)8.12392e-05,
-    (float)1.46087e-05,
-    (float)6.20572e-05,
-    (float)0.000143075,
-    (float)0.000129888,
-    (float)4.49588e-05,
-    (float)1.90354e-05,
-    (float)8.68404e-05,
-    (float)0.000138304,
-    (float)9.32961e-05,
-    (float)2.32173e-05,
-    (float)3.48546e-05,
-    (float)0.000105025,
-    (float)0.000121628,
-    (float)5.99597e-05,
-    (float)1.65145e-05,
-    (float)5.60045e-05,
-    (float)0.000112833,
-    (float)9.72775e-05,
-    (float)3.48311e-05,
-    (float)2.2637e-05,
-    (float)7.65317e-05,
-    (float)0.000109461,
-    (float)7.01592e-05,
-    (float)2.09896e-05,
-    (float)3.77795e-05,
-    (float)9.14149e-05,
-    (float)9.63851e-05,
-    (float)4.54796e-05,
-    (float)1.9123e-05,
-    (float)5.71087e-05,
-    (float)9.76244e-05,
-    (float)7.65812e-05,
-    (float)2.7804e-05,
-    (float)2.79634e-05,
-    (float)7.53758e-05,
-    (float)9.4111e-05,
-    (float)5.46445e-05,
-    (float)1.98748e-05,
-    (float)4.43408e-05,
-    (float)8.8339e-05,
-    (float)8.18382e-05,
-    (float)3.53366e-05,
-    (float)2.27366e-05,
-    (float)6.38167e-05,
-    (float)9.30831e-05,
-    (float)0.449623,
-    (float)0.275005,
-    (float)0.128006,
-    (float)0.0316204,
-    (float)0.000459853,
-    (float)0.00912724,
-    (float)0.0212364,
-    (float)0.0187051,
-    (float)0.00740703,
-    (float)0.000341165,
-    (float)0.00207282,
-    (float)0.00668076,
-    (float)0.007287,
-    (float)0.00354495,
-    (float)0.000311038,
-    (float)0.000705246,
-    (float)0.00305707,
-    (float)0.00384593,
-    (float)0.00219762,
-    (float)0.000295866,
-    (float)0.000273873,
-    (float)0.00164844,
-    (float)0.00237243,
-    (float)0.00153587,
-    (float)0.000288353,
-    (float)0.000109122,
-    (float)0.000974153,
-    (float)0.00159393,
-    (float)0.00116099,
-    (float)0.000280434,
-    (float)4.00781e-05,
-    (float)0.000608024,
-    (float)0.00113188,
-    (float)0.000920335,
-    (float)0.000274432,
-    (float)1.29807e-05,
-    (float)0.000389395,
-    (float)0.000836232,
-    (float)0.000752628,
-    (float)0.000268689,
-    (float)5.52883e-06,
-    (float)0.00025335,
-    (float)0.000631916,
-    (float)0.000630859,
-    (float)0.000262779,
-    (float)7.80287e-06,
-    (float)0.000164426,
-    (float)0.000486344,
-    (float)0.000536505,
-    (float)0.000257157,
-    (float)1.50767e-05,
-    (float)0.000105148,
-    (float)0.000378389,
-    (float)0.000461782,
-    (float)0.00025076,
-    (float)2.49066e-05,
-    (float)6.57e-05,
-    (float)0.000295974,
-    (float)0.000400727,
-    (float)0.000244369,
-    (float)3.55974e-05,
-    (float)3.9213e-05,
-    (float)0.000232509,
-    (float)0.000349666,
-    (float)0.000237627,
-    (float)4.66085e-05,
-    (float)2.20415e-05,
-    (float)0.000182442,
-    (float)0.000306686,
-    (float)0.000230577,
-    (float)5.74484e-05,
-    (float)1.14348e-05,
-    (float)0.000142768,
-    (float)0.0002696,
-    (float)0.000223733,
-    (float)6.77921e-05,
-    (float)5.53034e-06,
-    (float)0.000111008,
-    (float)0.000237589,
-    (float)0.000216642,
-    (float)7.77808e-05,
-    (float)3.18541e-06,
-    (float)8.5376e-05,
-    (float)0.000209508,
-    (float)0.000209664,
-    (float)8.71933e-05,
-    (float)3.50995e-06,
-    (float)6.47498e-05,
-    (float)0.000184586,
-    (float)0.000202742,
-    (float)9.61223e-05,
-    (float)5.89352e-06,
-    (float)4.80738e-05,
-    (float)0.000162507,
-    (float)0.000195718,
-    (float)0.000104595,
-    (float)9.94012e-06,
-    (float)3.47625e-05,
-    (float)0.00014261,
-    (float)0.000188836,
-    (float)0.000112579,
-    (float)1.53169e-05,
-    (float)2.42531e-05,
-    (float)0.000124736,
-    (float)0.000181936,
-    (float)0.000120229,
-    (float)2.18032e-05,
-    (float)1.61271e-05,
-    (float)0.000108595,
-    (float)0.000175121,
-    (float)0.000127515,
-    (float)2.93046e-05,
-    (float)1.01193e-05,
-    (float)9.39059e-05,
-    (float)0.000168378,
-    (float)0.000134597,
-    (float)3.76936e-05,
-    (float)5.96468e-06,
-    (float)8.05663e-05,
-    (float)0.00016166,
-    (float)0.000141498,
-    (float)4.69915e-05,
-    (float)3.53113e-06,
-    (float)6.83536e-05,
-    (float)0.000154997,
-    (float)0.000148258,
-    (float)5.72003e-05,
-    (float)2.73299e-06,
-    (float)0.406871,
-    (float)0.27141,
-    (float)0.14842,
-    (float)0.0542756,
-    (float)0.00722061,
-    (float)0.00136044,
-    (float)0.0125027,
-    (float)0.0195077,
-    (float)0.0154772,
-    (float)0.00626121,
-    (float)0.000449067,
-    (float)0.00120828,
-    (float)0.00504718,
-    (float)0.00683056,
-    (float)0.00486385,
-    (float)0.0015379,
-    (float)2.35061e-05,
-    (float)0.00112554,
-    (float)0.00296759,
-    (float)0.00336785,
-    (float)0.00200197,
-    (float)0.00040866,
-    (float)8.64156e-05,
-    (float)0.00103718,
-    (float)0.001988,
-    (float)0.00187953,
-    (float)0.000887868,
-    (float)8.26839e-05,
-    (float)0.000198284,
-    (float)0.000936027,
-    (float)0.00140021,
-    (float)0.00109608,
-    (float)0.000382338,
-    (float)9.67174e-06,
-    (float)0.000289971,
-    (float)0.000827026,
-    (float)0.000999649,
-    (float)0.000637843,
-    (float)0.000144819,
-    (float)2.73132e-05,
-    (float)0.000350245,
-    (float)0.000713112,
-    (float)0.000709208,
-    (float)0.000357346,
-    (float)4.06766e-05,
-    (float)7.51361e-05,
-    (float)0.000380859,
-    (float)0.000599222,
-    (float)0.000491757,
-    (float)0.000185341,
-    (float)7.71875e-06,
-    (float)0.000127552,
-    (float)0.000385974,
-    (float)0.000489527,
-    (float)0.000328501,
-    (float)8.36713e-05,
-    (float)1.29662e-05,
-    (float)0.000173074,
-    (float)0.000371289,
-    (float)0.000387134,
-    (float)0.00020762,
-    (float)2.96416e-05,
-    (float)3.74966e-05,
-    (float)0.000206732,
-    (float)0.000341849,
-    (float)0.000295041,
-    (float)0.000120932,
-    (float)7.98658e-06,
-    (float)6.97587e-05,
-    (float)0.000227211,
-    (float)0.000302463,
-    (float)0.000214925,
-    (float)6.23671e-05,
-    (float)8.02108e-06,
-    (float)0.000102581,
-    (float)0.000234734,
-    (float)0.000257525,
-    (float)0.000147968,
-    (float)2.66508e-05,
-    (float)2.18273e-05,
-    (float)0.000131582,
-    (float)0.00023082,
-    (float)0.00021055,
-    (float)9.46159e-05,
-    (float)9.31301e-06,
-    (float)4.34638e-05,
-    (float)0.000154132,
-    (float)0.000217451,
-    (float)0.000164679,
-    (float)5.46048e-05,
-    (float)6.28907e-06,
-    (float)6.84352e-05,
-    (float)0.000169092,
-    (float)0.000196819,
-    (float)0.000122267,
-    (float)2.72963e-05,
-    (float)1.39799e-05,
-    (float)9.34034e-05,
-    (float)0.000176135,
-    (float)0.000171299,
-    (float)8.5087e-05,
-    (float)1.15816e-05,
-    (float)2.92127e-05,
-    (float)0.000116059,
-    (float)0.000175667,
-    (float)0.000142997,
-    (float)5.44122e-05,
-    (float)6.1729e-06,
-    (float)4.92833e-05,
-    (float)0.000134784,
-    (float)0.000168546,
-    (float)0.000113907,
-    (float)3.09663e-05,
-    (float)9.6618e-06,
-    (float)7.19544e-05,
-    (float)0.000148659,
-    (float)0.000155768,
-    (float)8.57394e-05,
-    (float)1.51955e-05,
-    (float)2.06581e-05,
-    (float)9.53524e-05,
-    (float)0.00015715,
-    (float)0.000138534,
-    (float)5.99352e-05,
-    (float)7.27563e-06,
-    (float)3.78382e-05,
-    (float)0.000117994,
-    (float)0.000159987,
-    (float)0.364534,
-    (float)0.262289,
-    (float)0.163621,
-    (float)0.0785737,
-    (float)0.0226523,
-    (float)0.00131965,
-    (float)0.00321401,
-    (float)0.0125033,
-    (float)0.0171593,
-    (float)0.0140227,
-    (float)0.00676166,
-    (float)0.00118553,
-    (float)0.000247122,
-    (float)0.00279468,
-    (float)0.00545171,
-    (float)0.00574427,
-    (float)0.0036563,
-    (float)0.00110484,
-    (float)2.43583e-05,
-    (float)0.000800069,
-    (float)0.00228946,
-    (float)0.0029997,
-    (float)0.00236829,
-    (float)0.0010209,
-    (float)9.75691e-05,
-    (float)0.00021423,
-    (float)0.00104533,
-    (float)0.00172484,
-    (float)0.00164746,
-    (float)0.000923604,
-    (float)0.000198795,
-    (float)4.08737e-05,
-    (float)0.000473657,
-    (float)0.00102252,
-    (float)0.00117566,
-    (float)0.000817854,
-    (float)0.000279671,
-    (float)1.52674e-05,
-    (float)0.000196668,
-    (float)0.000601683,
-    (float)0.000839766,
-    (float)0.000706074,
-    (float)0.000332081,
-    (float)4.51256e-05,
-    (float)6.84741e-05,
-    (float)0.000339789,
-    (float)0.000589972,
-    (float)0.000593405,
-    (float)0.000356352,
-    (float)9.19738e-05,
-    (float)2.05681e-05,
-    (float)0.000178249,
-    (float)0.00040139,
-    (float)0.000483209,
-    (float)0.000356426,
-    (float)0.000137985,
-    (float)1.68595e-05,
-    (float)8.36119e-05,
-    (float)0.00026038,
-    (float)0.000379604,
-    (float)0.000336594,
-    (float)0.000174296,
-    (float)3.60984e-05,
-    (float)3.52375e-05,
-    (float)0.000158326,
-    (float)0.000285684,
-    (float)0.000302252,
-    (float)0.000196934,
-    (float)6.47123e-05,
-    (float)1.84021e-05,
-    (float)8.9012e-05,
-    (float)0.000204524,
-    (float)0.000258415,
-    (float)0.000204978,
-    (float)9.38956e-05,
-    (float)2.21414e-05,
-    (float)4.68414e-05,
-    (float)0.000138161,
-    (float)0.000210322,
-    (float)0.000199553,
-    (float)0.000117879,
-    (float)3.78057e-05,
-    (float)2.65458e-05,
-    (float)8.78052e-05,
-    (float)0.000162424,
-    (float)0.000183152,
-    (float)0.000133536,
-    (float)5.85725e-05,
-    (float)2.28599e-05,
-    (float)5.34432e-05,
-    (float)0.000118742,
-    (float)0.000158936,
-    (float)0.000139548,
-    (float)7.92609e-05,
-    (float)3.08162e-05,
-    (float)3.407e-05,
-    (float)8.22416e-05,
-    (float)0.000130422,
-    (float)0.000136213,
-    (float)9.60704e-05,
-    (float)4.57222e-05,
-    (float)2.78331e-05,
-    (float)5.50904e-05,
-    (float)0.000101069,
-    (float)0.000124799,
-    (float)0.000106637,
-    (float)6.3381e-05,
-    (float)3.22363e-05,
-    (float)3.83717e-05,
-    (float)7.42006e-05,
-    (float)0.000107455,
-    (float)0.000109723,
-    (float)8.01284e-05,
-    (float)4.43619e-05,
-    (float)3.22892e-05,
-    (float)5.26753e-05,
-    (float)8.68274e-05,
-    (float)0.000105308,
-    (float)9.3034e-05,
-    (float)6.09336e-05,
-    (float)3.60725e-05,
-    (float)3.87964e-05,
-    (float)6.5999e-05,
-    (float)9.43045e-05,
-    (float)0.000100021,
-    (float)7.86445e-05,
-    (float)4.81027e-05,
-    (float)3.39932e-05,
-    (float)0.32065,
-    (float)0.246576,
-    (float)0.171675,
-    (float)0.100932,
-    (float)0.0443831,
-    (float)0.0114906,
-    (float)0.000364841,
-    (float)0.00318832,
-    (float)0.010337,
-    (float)0.0146707,
-    (float)0.013562,
-    (float)0.00856059,
-    (float)0.0031985,
-    (float)0.00027468,
-    (float)0.00054593,
-    (float)0.00271176,
-    (float)0.00471252,
-    (float)0.00506953,
-    (float)0.00370677,
-    (float)0.00167605,
-    (float)0.000254046,
-    (float)0.000133374,
-    (float)0.00105485,
-    (float)0.00215172,
-    (float)0.00258763,
-    (float)0.00210692,
-    (float)0.0010972,
-    (float)0.000241935,
-    (float)3.62992e-05,
-    (float)0.000481265,
-    (float)0.00115187,
-    (float)0.00153076,
-    (float)0.00136699,
-    (float)0.000800678,
-    (float)0.000231504,
-    (float)1.65508e-05,
-    (float)0.000236347,
-    (float)0.000672124,
-    (float)0.000984441,
-    (float)0.000956149,
-    (float)0.000620965,
-    (float)0.000221394,
-    (float)2.00072e-05,
-    (float)0.000120451,
-    (float)0.000412476,
-    (float)0.00066662,
-    (float)0.000700811,
-    (float)0.000499437,
-    (float)0.000210988,
-    (float)3.04397e-05,
-    (float)6.35845e-05,
-    (float)0.000261294,
-    (float)0.000466581,
-    (float)0.000529554,
-    (float)0.000410866,
-    (float)0.000199914,
-    (float)4.21498e-05,
-    (float)3.646e-05,
-    (float)0.000169517,
-    (float)0.000333909,
-    (float)0.000408222,
-    (float)0.000342725,
-    (float)0.000188091,
-    (float)5.28928e-05,
-    (float)2.52655e-05,
-    (float)0.00011281,
-    (float)0.000243064,
-    (float)0.00031894,
-    (float)0.000288105,
-    (float)0.000175575,
-    (float)6.17527e-05,
-    (float)2.28451e-05,
-    (float)7.80126e-05,
-    (float)0.000179875,
-    (float)0.000251737,
-    (float)0.000243083,
-    (float)0.000162445,
-    (float)6.83843e-05,
-    (float)2.51738e-05,
-    (float)5.75155e-05,
-    (float)0.000135906,
-    (float)0.000200646,
-    (float)0.000205472,
-    (float)0.000148872,
-    (float)7.2689e-05,
-    (float)2.98393e-05,
-    (float)4.66069e-05,
-    (float)0.000105871,
-    (float)0.000161874,
-    (float)0.000174006,
-    (float)0.000135162,
-    (float)7.47243e-05,
-    (float)3.53304e-05,
-    (float)4.21773e-05,
-    (float)8.62619e-05,
-    (float)0.000132936,
-    (float)0.000147909,
-    (float)0.000121684,
-    (float)7.46861e-05,
-    (float)4.06849e-05,
-    (float)4.20785e-05,
-    (float)7.46137e-05,
-    (float)0.000112146,
-    (float)0.000126719,
-    (float)0.000108808,
-    (float)7.28562e-05,
-    (float)4.53032e-05,
-    (float)4.47837e-05,
-    (float)6.91282e-05,
-    (float)9.83037e-05,
-    (float)0.000110195,
-    (float)9.69188e-05,
-    (float)6.95505e-05,
-    (float)4.88183e-05,
-    (float)4.91836e-05,
-    (float)6.84708e-05,
-    (float)9.05302e-05,
-    (float)9.82344e-05,
-    (float)8.64386e-05,
-    (float)6.51136e-05,
-    (float)5.10079e-05,
-    (float)5.44482e-05,
-    (float)7.16339e-05,
-    (float)8.81926e-05,
-    (float)9.08536e-05,
-    (float)7.78337e-05,
-    (float)5.99323e-05,
-    (float)5.17505e-05,
-    (float)0.275561,
-    (float)0.224518,
-    (float)0.171279,
-    (float)0.11751,
-    (float)0.0678152,
-    (float)0.0306216,
-    (float)0.00873597,
-    (float)0.000488034,
-    (float)0.00164005,
-    (float)0.00675545,
-    (float)0.0112885,
-    (float)0.0126536,
-    (float)0.0106552,
-    (float)0.00669613,
-    (float)0.00275488,
-    (float)0.000414212,
-    (float)0.000165535,
-    (float)0.00147637,
-    (float)0.00321247,
-    (float)0.00430573,
-    (float)0.00421998,
-    (float)0.0030888,
-    (float)0.0015673,
-    (float)0.000391695,
-    (float)2.00865e-05,
-    (float)0.000453942,
-    (float)0.0012995,
-    (float)0.00202186,
-    (float)0.00222394,
-    (float)0.00183317,
-    (float)0.00108539,
-    (float)0.000372308,
-    (float)2.49534e-05,
-    (float)0.000149948,
-    (float)0.000604631,
-    (float)0.00109402,
-    (float)0.00134241,
-    (float)0.00122579,
-    (float)0.000822149,
-    (float)0.000353947,
-    (float)5.356e-05,
-    (float)4.70014e-05,
-    (float)0.000297158,
-    (float)0.000638252,
-    (float)0.000872587,
-    (float)0.000875301,
-    (float)0.000654736,
-    (float)0.00033456,
-    (float)8.17336e-05,
-    (float)1.53569e-05,
-    (float)0.000148049,
-    (float)0.000387498,
-    (float)0.000592514,
-    (float)0.000651361,
-    (float)0.000536305,
-    (float)0.000314366,
-    (float)0.000104858,
-    (float)1.2125e-05,
-    (float)7.28257e-05,
-    (float)0.000240036,
-    (float)0.000414007,
-    (float)0.000497376,
-    (float)0.000447061,
-    (float)0.00029412,
-    (float)0.000122034,
-    (float)2.01775e-05,
-    (float)3.55882e-05,
-    (float)0.000150373,
-    (float)0.000294616,
-    (float)0.000386717,
-    (float)0.000377356,
-    (float)0.000273787,
-    (float)0.000133958,
-    (float)3.2228e-05,
-    (float)1.89665e-05,
-    (float)9.48645e-05,
-    (float)0.000212714,
-    (float)0.000305184,
-    (float)0.000321393,
-    (float)0.000254159,
-    (float)0.000141673,
-    (float)4.47792e-05,
-    (float)1.36065e-05,
-    (float)6.0709e-05,
-    (float)0.000155876,
-    (float)0.000244078,
-    (float)0.000276385,
-    (float)0.000235967,
-    (float)0.00014614,
-    (float)5.64215e-05,
-    (float)1.43782e-05,
-    (float)4.01144e-05,
-    (float)0.000116145,
-    (float)0.000198294,
-    (float)0.000240478,
-    (float)0.000219809,
-    (float)0.00014873,
-    (float)6.67595e-05,
-    (float)1.82471e-05,
-    (float)2.80709e-05,
-    (float)8.84426e-05,
-    (float)0.00016409,
-    (float)0.000212288,
-    (float)0.000206555,
-    (float)0.000150659,
-    (float)7.59968e-05,
-    (float)2.36211e-05,
-    (float)2.13979e-05,
-    (float)6.90053e-05,
-    (float)0.000138624,
-    (float)0.000190908,
-    (float)0.000196688,
-    (float)0.000153132,
-    (float)8.48832e-05,
-    (float)2.97875e-05,
-    (float)1.79599e-05,
-    (float)5.51212e-05,
-    (float)0.000119737,
-    (float)0.000175258,
-    (float)0.000190607,
-    (float)0.000157385,
-    (float)9.43142e-05,
-    (float)3.66915e-05,
-    (float)1.65375e-05,
-    (float)4.48381e-05,
-    (float)0.000105477,
-    (float)0.000164403,
-    (float)0.000188585,
-    (float)0.229657,
-    (float)0.196682,
-    (float)0.161886,
-    (float)0.125206,
-    (float)0.0873974,
-    (float)0.0536891,
-    (float)0.0277319,
-    (float)0.0105823,
-    (float)0.00197384,
-    (float)0.000120582,
-    (float)0.00241169,
-    (float)0.00617914,
-    (float)0.00928833,
-    (float)0.0105569,
-    (float)0.00971646,
-    (float)0.00732336,
-    (float)0.00436873,
-    (float)0.00180518,
-    (float)0.000306516,
-    (float)7.29803e-05,
-    (float)0.000845947,
-    (float)0.00208708,
-    (float)0.00319104,
-    (float)0.00372095,
-    (float)0.00351497,
-    (float)0.00269801,
-    (float)0.00160973,
-    (float)0.000639188,
-    (float)8.54986e-05,
-    (float)6.44189e-05,
-    (float)0.000486521,
-    (float)0.00111627,
-    (float)0.00167036,
-    (float)0.00193083,
-    (float)0.00181172,
-    (float)0.00137497,
-    (float)0.000799178,
-    (float)0.000295312,
-    (float)2.80561e-05,
-    (float)6.18837e-05,
-    (float)0.000343413,
-    (float)0.000734024,
-    (float)0.00106601,
-    (float)0.0012088,
-    (float)0.00111507,
-    (float)0.000828527,
-    (float)0.000463466,
-    (float)0.000155714,
-    (float)9.42431e-06,
-    (float)6.16412e-05,
-    (float)0.000272152,
-    (float)0.000544687,
-    (float)0.000765592,
-    (float)0.000848565,
-    (float)0.000766076,
-    (float)0.000553826,
-    (float)0.000295543,
-    (float)8.82412e-05,
-    (float)3.48697e-06,
-    (float)6.30677e-05,
-    (float)0.000232631,
-    (float)0.000438196,
-    (float)0.000596011,
-    (float)0.000644425,
-    (float)0.000567427,
-    (float)0.000397375,
-    (float)0.000200737,
-    (float)5.16882e-05,
-    (float)2.67668e-06,
-    (float)6.5873e-05,
-    (float)0.000209901,
-    (float)0.000373952,
-    (float)0.000492083,
-    (float)0.000518207,
-    (float)0.000444066,
-    (float)0.00030008,
-    (float)0.000142199,
-    (float)3.03387e-05,
-    (float)4.41279e-06,
-    (float)7.00094e-05,
-    (float)0.000197306,
-    (float)0.00033365,
-    (float)0.000424834,
-    (float)0.000435411,
-    (float)0.0003624,
-    (float)0.00023535,
-    (float)0.000103618,
-    (float)1.73491e-05,
-    (float)7.71106e-06,
-    (float)7.54632e-05,
-    (float)0.000191407,
-    (float)0.000308353,
-    (float)0.000380149,
-    (float)0.000378899,
-    (float)0.000305796,
-    (float)0.000190179,
-    (float)7.69401e-05,
-    (float)9.35561e-06,
-    (float)1.21785e-05,
-    (float)8.22985e-05,
-    (float)0.000190605,
-    (float)0.000293533,
-    (float)0.000350608,
-    (float)0.000339739,
-    (float)0.000265556,
-    (float)0.000157563,
-    (float)5.77983e-05,
-    (float)4.59572e-06,
-    (float)1.77275e-05,
-    (float)9.08216e-05,
-    (float)0.000194314,
-    (float)0.000286962,
-    (float)0.000332422,
-    (float)0.000313124,
-    (float)0.000236734,
-    (float)0.000133464,
-    (float)4.36666e-05,
-    (float)2.0838e-06,
-    (float)2.45122e-05,
-    (float)0.000101563,
-    (float)0.000202669,
-    (float)0.000287868,
-    (float)0.000323715,
-    (float)0.000296335,
-    (float)0.000216397,
-    (float)0.000115371,
-    (float)3.29273e-05,
-    (float)1.30071e-06,
-    (float)0.186902,
-    (float)0.166841,
-    (float)0.145917,
-    (float)0.123542,
-    (float)0.0986555,
-    (float)0.0734849,
-    (float)0.0506446,
-    (float)0.0314334,
-    (float)0.0167554,
-    (float)0.00697561,
-    (float)0.00169153,
-    (float)6.37648e-05,
-    (float)0.000964521,
-    (float)0.00318752,
-    (float)0.00565884,
-    (float)0.00754871,
-    (float)0.00840796,
-    (float)0.00813927,
-    (float)0.00690748,
-    (float)0.00509877,
-    (float)0.00317284,
-    (float)0.00152551,
-    (float)0.000439041,
-    (float)2.79485e-05,
-    (float)0.000232807,
-    (float)0.000867275,
-    (float)0.00167411,
-    (float)0.00239862,
-    (float)0.00284509,
-    (float)0.00291131,
-    (float)0.00260638,
-    (float)0.00202886,
-    (float)0.00133161,
-    (float)0.00068348,
-    (float)0.000221782,
-    (float)2.35227e-05,
-    (float)9.53105e-05,
-    (float)0.00037695,
-    (float)0.000764908,
-    (float)0.00114028,
-    (float)0.00139895,
-    (float)0.00147864,
-    (float)0.00136707,
-    (float)0.00110007,
-    (float)0.000751131,
-    (float)0.000407624,
-    (float)0.000147961,
-    (float)2.40871e-05,
-    (float)4.99123e-05,
-    (float)0.000201257,
-    (float)0.000424664,
-    (float)0.000653226,
-    (float)0.000824538,
-    (float)0.000894745,
-    (float)0.000849164,
-    (float)0.000704086,
-    (float)0.000498947,
-    (float)0.000285919,
-    (float)0.00011632,
-    (float)2.6782e-05,
-    (float)3.16132e-05,
-    (float)0.000120677,
-    (float)0.000263352,
-    (float)0.000417758,
-    (float)0.000541513,
-    (float)0.000602728,
-    (float)0.000587494,
-    (float)0.000501812,
-    (float)0.000369335,
-    (float)0.000224351,
-    (float)0.000102253,
-    (float)3.09365e-05,
-    (float)2.40576e-05,
-    (float)7.83303e-05,
-    (float)0.000175327,
-    (float)0.000286742,
-    (float)0.000382341,
-    (float)0.000437471,
-    (float)0.000438672,
-    (float)0.000387018,
-    (float)0.000296989,
-    (float)0.000191833,
-    (float)9.76772e-05,
-    (float)3.67996e-05,
-    (float)2.20517e-05,
-    (float)5.41756e-05,
-    (float)0.000122138,
-    (float)0.000206446,
-    (float)0.000284338,
-    (float)0.000335619,
-    (float)0.000347742,
-    (float)0.00031843,
-    (float)0.00025585,
-    (float)0.000176364,
-    (float)9.98991e-05,
-    (float)4.48328e-05,
-    (float)2.36302e-05,
-    (float)3.98618e-05,
-    (float)8.76565e-05,
-    (float)0.000153489,
-    (float)0.000219777,
-    (float)0.000269508,
-    (float)0.000290343,
-    (float)0.000277457,
-    (float)0.000234639,
-    (float)0.000173025,
-    (float)0.000108072,
-    (float)5.56903e-05,
-    (float)2.82642e-05,
-    (float)3.16955e-05,
-    (float)6.41236e-05,
-    (float)0.000116586,
-    (float)0.000175407,
-    (float)0.000225592,
-    (float)0.000254612,
-    (float)0.000255491,
-    (float)0.000228262,
-    (float)0.00017987,
-    (float)0.000122485,
-    (float)7.03137e-05,
-    (float)3.6065e-05,
-    (float)2.79365e-05,
-    (float)4.7622e-05,
-    (float)8.99574e-05,
-    (float)0.000144241,
-    (float)0.000196882,
-    (float)0.000234789,
-    (float)0.000248566,
-    (float)0.144025,
-    (float)0.133019,
-    (float)0.122025,
-    (float)0.110532,
-    (float)0.0971659,
-    (float)0.0823013,
-    (float)0.0672265,
-    (float)0.052669,
-    (float)0.039178,
-    (float)0.0273854,
-    (float)0.0176663,
-    (float)0.0101635,
-    (float)0.00489632,
-    (float)0.00169424,
-    (float)0.000241983,
-    (float)0.000154961,
-    (float)0.000998712,
-    (float)0.00234774,
-    (float)0.00382359,
-    (float)0.00511093,
-    (float)0.0060006,
-    (float)0.00638954,
-    (float)0.00625481,
-    (float)0.00565896,
-    (float)0.00473085,
-    (float)0.00362232,
-    (float)0.00249065,
-    (float)0.00148114,
-    (float)0.000701313,
-    (float)0.000213029,
-    (float)3.14509e-05,
-    (float)0.000126543,
-    (float)0.000433947,
-    (float)0.000867134,
-    (float)0.00133256,
-    (float)0.00174558,
-    (float)0.00203836,
-    (float)0.00216824,
-    (float)0.00212464,
-    (float)0.00192388,
-    (float)0.00160276,
-    (float)0.00121471,
-    (float)0.000818815,
-    (float)0.00046879,
-    (float)0.000207317,
-    (float)6.06149e-05,
-    (float)3.51987e-05,
-    (float)0.000119139,
-    (float)0.000285287,
-    (float)0.000496811,
-    (float)0.000713487,
-    (float)0.00089749,
-    (float)0.00101967,
-    (float)0.00106315,
-    (float)0.00102387,
-    (float)0.000911073,
-    (float)0.000745315,
-    (float)0.000553229,
-    (float)0.000363424,
-    (float)0.000202672,
-    (float)9.12823e-05,
-    (float)4.04367e-05,
-    (float)5.14677e-05,
-    (float)0.000116201,
-    (float)0.000218934,
-    (float)0.000339285,
-    (float)0.0004556,
-    (float)0.000548599,
-    (float)0.000603934,
-    (float)0.000613973,
-    (float)0.0005789,
-    (float)0.000505867,
-    (float)0.000407234,
-    (float)0.000298738,
-    (float)0.000196723,
-    (float)0.00011529,
-    (float)6.45046e-05,
-    (float)4.91628e-05,
-    (float)6.82688e-05,
-    (float)0.000115605,
-    (float)0.000181003,
-    (float)0.000252252,
-    (float)0.000317155,
-    (float)0.000365262,
-    (float)0.000389456,
-    (float)0.000386927,
-    (float)0.000359134,
-    (float)0.000311355,
-    (float)0.000251721,
-    (float)0.000189591,
-    (float)0.000134034,
-    (float)9.25664e-05,
-    (float)7.00201e-05,
-    (float)6.7941e-05,
-    (float)8.463e-05,
-    (float)0.000115666,
-    (float)0.00015481,
-    (float)0.000195039,
-    (float)0.000229692,
-    (float)0.000253573,
-    (float)0.000263577,
-    (float)0.000258936,
-    (float)0.00024123,
-    (float)0.000213937,
-    (float)0.000181651,
-    (float)0.000149336,
-    (float)0.000121543,
-    (float)0.000101682,
-    (float)9.16294e-05,
-    (float)9.16387e-05,
-    (float)0.000100461,
-    (float)0.000115665,
-    (float)0.000134158,
-    (float)0.000152789,
-    (float)0.000168825,
-    (float)0.000180251,
-    (float)0.000186016,
-    (float)0.000186086,
-    (float)0.000181217,
-    (float)0.000172699,
-    (float)0.000162098,
-    (float)0.000150929,
-    (float)0.000140411,
-    (float)0.000131399,
-    (float)0.000124366,
-    (float)0.000119437,
-    (float)0.000116537,
-    (float)0.000115579,
-    (float)0.101004,
-    (float)0.0958808,
-    (float)0.0911898,
-    (float)0.0866863,
-    (float)0.0814415,
-    (float)0.0751638,
-    (float)0.0682695,
-    (float)0.0610392,
-    (float)0.0535657,
-    (float)0.0460638,
-    (float)0.0387731,
-    (float)0.0318383,
-    (float)0.0254041,
-    (float)0.0196194,
-    (float)0.0145636,
-    (float)0.0102767,
-    (float)0.00679245,
-    (float)0.00410338,
-    (float)0.00215866,
-    (float)0.000892545,
-    (float)0.000222883,
-    (float)4.78173e-05,
-    (float)0.000259012,
-    (float)0.000746781,
-    (float)0.0014037,
-    (float)0.00213321,
-    (float)0.00285066,
-    (float)0.00348477,
-    (float)0.00398408,
-    (float)0.0043156,
-    (float)0.00446159,
-    (float)0.00442246,
-    (float)0.00421415,
-    (float)0.00386129,
-    (float)0.00339725,
-    (float)0.0028628,
-    (float)0.00229853,
-    (float)0.00174211,
-    (float)0.00122905,
-    (float)0.000788803,
-    (float)0.000441578,
-    (float)0.000199429,
-    (float)6.6363e-05,
-    (float)3.78018e-05,
-    (float)0.000102005,
-    (float)0.000241612,
-    (float)0.000435218,
-    (float)0.000659649,
-    (float)0.000891451,
-    (float)0.00110846,
-    (float)0.00129205,
-    (float)0.00142785,
-    (float)0.0015059,
-    (float)0.00152197,
-    (float)0.00147757,
-    (float)0.00137823,
-    (float)0.00123339,
-    (float)0.00105617,
-    (float)0.000861232,
-    (float)0.000663181,
-    (float)0.000476336,
-    (float)0.000313492,
-    (float)0.000184468,
-    (float)9.58182e-05,
-    (float)5.07105e-05,
-    (float)4.86733e-05,
-    (float)8.58672e-05,
-    (float)0.000155596,
-    (float)0.000249014,
-    (float)0.000356051,
-    (float)0.000466108,
-    (float)0.000568902,
-    (float)0.00065557,
-    (float)0.000719125,
-    (float)0.000754615,
-    (float)0.000759814,
-    (float)0.000735371,
-    (float)0.000684116,
-    (float)0.000610822,
-    (float)0.000522139,
-    (float)0.000425667,
-    (float)0.000329058,
-    (float)0.000239699,
-    (float)0.000164151,
-    (float)0.000107428,
-    (float)7.27114e-05,
-    (float)6.12704e-05,
-    (float)7.23912e-05,
-    (float)0.000103507,
-    (float)0.000150479,
-    (float)0.000208055,
-    (float)0.000270414,
-    (float)0.000331553,
-    (float)0.000385787,
-    (float)0.000428419,
-    (float)0.000455995,
-    (float)0.000466349,
-    (float)0.000458955,
-    (float)0.000435012,
-    (float)0.000397007,
-    (float)0.000348463,
-    (float)0.000293836,
-    (float)0.000237981,
-    (float)0.000185577,
-    (float)0.000140863,
-    (float)0.000107328,
-    (float)8.73302e-05,
-    (float)8.19264e-05,
-    (float)9.08698e-05,
-    (float)0.00011268,
-    (float)0.000144771,
-    (float)0.000183678,
-    (float)0.000225449,
-    (float)0.00026606,
-    (float)0.000301644,
-    (float)0.000328833,
-    (float)0.000345219,
-    (float)0.00034947,
-    (float)0.000341275,
-    (float)0.000321513,
-    (float)0.000292237,
-    (float)0.000256292,
-    (float)0.00021704,
-    (float)0.000178207,
-    (float)0.00014348,
-    (float)0.00011608,
-    (float)9.85337e-05,
-    (float)9.24923e-05,
-    (float)0.0581326,
-    (float)0.0564474,
-    (float)0.0550943,
-    (float)0.0540403,
-    (float)0.0529309,
-    (float)0.051519,
-    (float)0.049862,
-    (float)0.0480508,
-    (float)0.0460716,
-    (float)0.0439203,
-    (float)0.0416434,
-    (float)0.0392672,
-    (float)0.0367982,
-    (float)0.0342683,
-    (float)0.0317152,
-    (float)0.0291531,
-    (float)0.0265976,
-    (float)0.024082,
-    (float)0.0216327,
-    (float)0.0192604,
-    (float)0.0169813,
-    (float)0.0148182,
-    (float)0.0127855,
-    (float)0.0108902,
-    (float)0.00914202,
-    (float)0.00755065,
-    (float)0.00611959,
-    (float)0.00484964,
-    (float)0.00374152,
-    (float)0.00279318,
-    (float)0.0019995,
-    (float)0.00135439,
-    (float)0.000850321,
-    (float)0.000477547,
-    (float)0.000225257,
-    (float)8.20542e-05,
-    (float)3.55561e-05,
-    (float)7.2796e-05,
-    (float)0.000180656,
-    (float)0.000345817,
-    (float)0.00055525,
-    (float)0.000796613,
-    (float)0.00105788,
-    (float)0.00132755,
-    (float)0.00159545,
-    (float)0.0018526,
-    (float)0.00209072,
-    (float)0.00230287,
-    (float)0.00248367,
-    (float)0.00262884,
-    (float)0.00273524,
-    (float)0.00280131,
-    (float)0.00282671,
-    (float)0.00281184,
-    (float)0.00275833,
-    (float)0.00266914,
-    (float)0.00254773,
-    (float)0.00239792,
-    (float)0.00222442,
-    (float)0.00203258,
-    (float)0.00182763,
-    (float)0.00161475,
-    (float)0.00139939,
-    (float)0.00118689,
-    (float)0.000982031,
-    (float)0.000789221,
-    (float)0.000612506,
-    (float)0.000455283,
-    (float)0.000320255,
-    (float)0.000209495,
-    (float)0.00012437,
-    (float)6.54816e-05,
-    (float)3.2751e-05,
-    (float)2.54363e-05,
-    (float)4.21543e-05,
-    (float)8.09583e-05,
-    (float)0.000139387,
-    (float)0.000214538,
-    (float)0.000303234,
-    (float)0.000402081,
-    (float)0.00050748,
-    (float)0.000615785,
-    (float)0.000723495,
-    (float)0.000827251,
-    (float)0.000923855,
-    (float)0.00101045,
-    (float)0.00108462,
-    (float)0.00114431,
-    (float)0.00118797,
-    (float)0.00121455,
-    (float)0.00122354,
-    (float)0.00121487,
-    (float)0.00118904,
-    (float)0.00114707,
-    (float)0.00109031,
-    (float)0.00102052,
-    (float)0.000939828,
-    (float)0.000850679,
-    (float)0.000755604,
-    (float)0.000657254,
-    (float)0.000558398,
-    (float)0.000461761,
-    (float)0.000369908,
-    (float)0.000285237,
-    (float)0.000209938,
-    (float)0.000145893,
-    (float)9.46303e-05,
-    (float)5.73042e-05,
-    (float)3.46674e-05,
-    (float)2.70485e-05,
-    (float)3.43534e-05,
-    (float)5.60729e-05,
-    (float)9.13069e-05,
-    (float)0.000138792,
-    (float)0.000196921,
-    (float)0.000263809,
-    (float)0.00033737,
-    (float)0.000415354,
-    (float)0.000495376,
-    (float)0.000575016,
-    (float)0.000651929,
-    (float)0.000723864,
-    (float)0.000788687,
-    (float)0.000844488,
-    (float)0.000889661,
-    (float)0.000922906,
-    (float)0.000943247,
-    (float)0.000950092,
-    (float)0.0152767,
-    (float)0.0152674,
-    (float)0.0152521,
-    (float)0.0152306,
-    (float)0.0152031,
-    (float)0.0151696,
-    (float)0.0151301,
-    (float)0.0150848,
-    (float)0.0150337,
-    (float)0.0149769,
-    (float)0.0149145,
-    (float)0.0148466,
-    (float)0.0147734,
-    (float)0.0146949,
-    (float)0.0146114,
-    (float)0.0145229,
-    (float)0.0144295,
-    (float)0.0143316,
-    (float)0.0142291,
-    (float)0.0141222,
-    (float)0.0140112,
-    (float)0.0138961,
-    (float)0.0137771,
-    (float)0.0136545,
-    (float)0.0135283,
-    (float)0.0133987,
-    (float)0.0132659,
-    (float)0.01313,
-    (float)0.0129913,
-    (float)0.0128497,
-    (float)0.0127056,
-    (float)0.0125591,
-    (float)0.0124102,
-    (float)0.0122592,
-    (float)0.0121061,
-    (float)0.0119512,
-    (float)0.0117945,
-    (float)0.0116362,
-    (float)0.0114764,
-    (float)0.0113153,
-    (float)0.0111529,
-    (float)0.0109893,
-    (float)0.0108248,
-    (float)0.0106593,
-    (float)0.010493,
-    (float)0.010326,
-    (float)0.0101584,
-    (float)0.00999032,
-    (float)0.00982185,
-    (float)0.00965308,
-    (float)0.00948412,
-    (float)0.00931505,
-    (float)0.00914599,
-    (float)0.00897701,
-    (float)0.00880822,
-    (float)0.00863972,
-    (float)0.00847159,
-    (float)0.00830393,
-    (float)0.00813683,
-    (float)0.0079704,
-    (float)0.00780471,
-    (float)0.00763987,
-    (float)0.00747597,
-    (float)0.0073131,
-    (float)0.00715136,
-    (float)0.00699083,
-    (float)0.0068316,
-    (float)0.00667377,
-    (float)0.00651742,
-    (float)0.00636264,
-    (float)0.00620952,
-    (float)0.00605813,
-    (float)0.00590856,
-    (float)0.0057609,
-    (float)0.0056152,
-    (float)0.00547156,
-    (float)0.00533003,
-    (float)0.0051907,
-    (float)0.00505362,
-    (float)0.00491885,
-    (float)0.00478646,
-    (float)0.0046565,
-    (float)0.00452901,
-    (float)0.00440406,
-    (float)0.00428168,
-    (float)0.00416191,
-    (float)0.0040448,
-    (float)0.00393037,
-    (float)0.00381866,
-    (float)0.00370969,
-    (float)0.0036035,
-    (float)0.00350009,
-    (float)0.00339949,
-    (float)0.00330171,
-    (float)0.00320677,
-    (float)0.00311468,
-    (float)0.00302544,
-    (float)0.00293906,
-    (float)0.00285556,
-    (float)0.00277492,
-    (float)0.00269715,
-    (float)0.00262225,
-    (float)0.00255022,
-    (float)0.00248106,
-    (float)0.00241476,
-    (float)0.00235132,
-    (float)0.00229075,
-    (float)0.00223303,
-    (float)0.00217815,
-    (float)0.00212612,
-    (float)0.00207694,
-    (float)0.00203058,
-    (float)0.00198706,
-    (float)0.00194637,
-    (float)0.0019085,
-    (float)0.00187345,
-    (float)0.00184122,
-    (float)0.0018118,
-    (float)0.00178519,
-    (float)0.00176139,
-    (float)0.00174039,
-    (float)0.0017222,
-    (float)0.00170681,
-    (float)0.00169422,
-    (float)0.00168442,
-    (float)0.00167743,
-    (float)0.00167323,
-    (float)0.00167184,
-    (float)0.0152767,
-    (float)0.0152674,
-    (float)0.0152521,
-    (float)0.0152306,
-    (float)0.0152031,
-    (float)0.0151696,
-    (float)0.0151301,
-    (float)0.0150848,
-    (float)0.0150337,
-    (float)0.0149769,
-    (float)0.0149145,
-    (float)0.0148466,
-    (float)0.0147734,
-    (float)0.0146949,
-    (float)0.0146114,
-    (float)0.0145229,
-    (float)0.0144295,
-    (float)0.0143316,
-    (float)0.0142291,
-    (float)0.0141222,
-    (float)0.0140112,
-    (float)0.0138961,
-    (float)0.0137771,
-    (float)0.0136545,
-    (float)0.0135283,
-    (float)0.0133987,
-    (float)0.0132659,
-    (float)0.01313,
-    (float)0.0129913,
-    (float)0.0128497,
-    (float)0.0127056,
-    (float)0.0125591,
-    (float)0.0124102,
-    (float)0.0122592,
-    (float)0.0121061,
-    (float)0.0119512,
-    (float)0.0117945,
-    (float)0.0116362,
-    (float)0.0114764,
-    (float)0.0113153,
-    (float)0.0111529,
-    (float)0.0109893,
-    (float)0.0108248,
-    (float)0.0106593,
-    (float)0.010493,
-    (float)0.010326,
-    (float)0.0101584,
-    (float)0.00999032,
-    (float)0.00982185,
-    (float)0.00965308,
-    (float)0.00948412,
-    (float)0.00931505,
-    (float)0.00914599,
-    (float)0.00897701,
-    (float)0.00880822,
-    (float)0.00863972,
-    (float)0.00847159,
-    (float)0.00830393,
-    (float)0.00813683,
-    (float)0.0079704,
-    (float)0.00780471,
-    (float)0.00763987,
-    (float)0.00747597,
-    (float)0.0073131,
-    (float)0.00715136,
-    (float)0.00699083,
-    (float)0.0068316,
-    (float)0.00667377,
-    (float)0.00651742,
-    (float)0.00636264,
-    (float)0.00620952,
-    (float)0.00605813,
-    (float)0.00590856,
-    (float)0.0057609,
-    (float)0.0056152,
-    (float)0.00547156,
-    (float)0.00533003,
-    (float)0.0051907,
-    (float)0.00505362,
-    (float)0.00491885,
-    (float)0.00478646,
-    (float)0.0046565,
-    (float)0.00452901,
-    (float)0.00440406,
-    (float)0.00428168,
-    (float)0.00416191,
-    (float)0.0040448,
-    (float)0.00393037,
-    (float)0.00381866,
-    (float)0.00370969,
-    (float)0.0036035,
-    (float)0.00350009,
-    (float)0.00339949,
-    (float)0.00330171,
-    (float)0.00320677,
-    (float)0.00311468,
-    (float)0.00302544,
-    (float)0.00293906,
-    (float)0.00285556,
-    (float)0.00277492,
-    (float)0.00269715,
-    (float)0.00262225,
-    (float)0.00255022,
-    (float)0.00248106,
-    (float)0.00241476,
-    (float)0.00235132,
-    (float)0.00229075,
-    (float)0.00223303,
-    (float)0.00217815,
-    (float)0.00212612,
-    (float)0.00207694,
-    (float)0.00203058,
-    (float)0.00198706,
-    (float)0.00194637,
-    (float)0.0019085,
-    (float)0.00187345,
-    (float)0.00184122,
-    (float)0.0018118,
-    (float)0.00178519,
-    (float)0.00176139,
-    (float)0.00174039,
-    (float)0.0017222,
-    (float)0.00170681,
-    (float)0.00169422,
-    (float)0.00168442,
-    (float)0.00167743,
-    (float)0.00167323,
-    (float)0.00167184,
-    (float)0.0732635,
-    (float)0.0647923,
-    (float)0.0620656,
-    (float)0.0597899,
-    (float)0.057354,
-    (float)0.0546525,
-    (float)0.0516925,
-    (float)0.0485174,
-    (float)0.0451849,
-    (float)0.0417572,
-    (float)0.0382958,
-    (float)0.0348596,
-    (float)0.0315019,
-    (float)0.0282696,
-    (float)0.0252022,
-    (float)0.0223312,
-    (float)0.0196804,
-    (float)0.0172651,
-    (float)0.0150932,
-    (float)0.0131656,
-    (float)0.0114766,
-    (float)0.0100151,
-    (float)0.00876539,
-    (float)0.00770854,
-    (float)0.00682326,
-    (float)0.00608715,
-    (float)0.00547765,
-    (float)0.004973,
-    (float)0.00455295,
-    (float)0.00419933,
-    (float)0.00389644,
-    (float)0.00363126,
-    (float)0.00339343,
-    (float)0.00317523,
-    (float)0.00297126,
-    (float)0.00277818,
-    (float)0.00259433,
-    (float)0.00241934,
-    (float)0.0022537,
-    (float)0.00209846,
-    (float)0.00195481,
-    (float)0.00182384,
-    (float)0.00170633,
-    (float)0.00160259,
-    (float)0.00151242,
-    (float)0.00143503,
-    (float)0.00136919,
-    (float)0.00131327,
-    (float)0.00126539,
-    (float)0.00122362,
-    (float)0.00118609,
-    (float)0.00115119,
-    (float)0.00111769,
-    (float)0.00108489,
-    (float)0.00105264,
-    (float)0.00102142,
-    (float)0.000992278,
-    (float)0.000966816,
-    (float)0.00094705,
-    (float)0.000935276,
-    (float)0.000933898,
-    (float)0.000945235,
-    (float)0.000971319,
-    (float)0.00101371,
-    (float)0.0010733,
-    (float)0.00115022,
-    (float)0.0012437,
-    (float)0.00135203,
-    (float)0.00147257,
-    (float)0.00160184,
-    (float)0.00173559,
-    (float)0.00186901,
-    (float)0.00199692,
-    (float)0.002114,
-    (float)0.00221509,
-    (float)0.0022954,
-    (float)0.0023508,
-    (float)0.00237804,
-    (float)0.00237492,
-    (float)0.00234042,
-    (float)0.00227481,
-    (float)0.00217959,
-    (float)0.0020575,
-    (float)0.00191234,
-    (float)0.00174878,
-    (float)0.00157218,
-    (float)0.00138829,
-    (float)0.00120299,
-    (float)0.00102199,
-    (float)0.000850606,
-    (float)0.000693506,
-    (float)0.00055453,
-    (float)0.000436553,
-    (float)0.000341406,
-    (float)0.000269851,
-    (float)0.000221618,
-    (float)0.000195489,
-    (float)0.000189438,
-    (float)0.000200789,
-    (float)0.000226417,
-    (float)0.000262946,
-    (float)0.000306949,
-    (float)0.000355141,
-    (float)0.000404534,
-    (float)0.000452572,
-    (float)0.000497224,
-    (float)0.000537027,
-    (float)0.000571101,
-    (float)0.000599119,
-    (float)0.000621246,
-    (float)0.00063805,
-    (float)0.000650398,
-    (float)0.000659344,
-    (float)0.000666013,
-    (float)0.000671496,
-    (float)0.000676756,
-    (float)0.00068256,
-    (float)0.000689425,
-    (float)0.000697596,
-    (float)0.000707053,
-    (float)0.000717527,
-    (float)0.000728552,
-    (float)0.000739521,
-    (float)0.000749754,
-    (float)0.000758574,
-    (float)0.000765367,
-    (float)0.00076965,
-    (float)0.000771113,
-    (float)0.137515,
-    (float)0.11114,
-    (float)0.100045,
-    (float)0.0895969,
-    (float)0.0786191,
-    (float)0.067398,
-    (float)0.05648,
-    (float)0.0463933,
-    (float)0.0375428,
-    (float)0.0301626,
-    (float)0.0243117,
-    (float)0.0198947,
-    (float)0.0166998,
-    (float)0.014448,
-    (float)0.0128423,
-    (float)0.0116108,
-    (float)0.0105382,
-    (float)0.00948295,
-    (float)0.00837938,
-    (float)0.00722675,
-    (float)0.00606959,
-    (float)0.0049737,
-    (float)0.0040035,
-    (float)0.00320425,
-    (float)0.00259229,
-    (float)0.00215394,
-    (float)0.0018518,
-    (float)0.00163611,
-    (float)0.00145785,
-    (float)0.00128034,
-    (float)0.00108682,
-    (float)0.000882728,
-    (float)0.000692505,
-    (float)0.000552078,
-    (float)0.000498998,
-    (float)0.000562433,
-    (float)0.000755187,
-    (float)0.00106934,
-    (float)0.00147628,
-    (float)0.00193088,
-    (float)0.00237896,
-    (float)0.00276637,
-    (float)0.00304782,
-    (float)0.00319392,
-    (float)0.00319498,
-    (float)0.0030612,
-    (float)0.00281942,
-    (float)0.00250721,
-    (float)0.00216573,
-    (float)0.00183274,
-    (float)0.00153705,
-    (float)0.00129534,
-    (float)0.00111164,
-    (float)0.000979201,
-    (float)0.000884246,
-    (float)0.000810438,
-    (float)0.00074317,
-    (float)0.000672754,
-    (float)0.000595989,
-    (float)0.000515933,
-    (float)0.00044015,
-    (float)0.000378016,
-    (float)0.000337802,
-    (float)0.000324282,
-    (float)0.000337427,
-    (float)0.000372432,
-    (float)0.000421008,
-    (float)0.000473571,
-    (float)0.000521705,
-    (float)0.000560302,
-    (float)0.000588803,
-    (float)0.000611246,
-    (float)0.000635084,
-    (float)0.000669066,
-    (float)0.000720666,
-    (float)0.000793685,
-    (float)0.000886598,
-    (float)0.000992067,
-    (float)0.00109778,
-    (float)0.00118845,
-    (float)0.00124865,
-    (float)0.00126578,
-    (float)0.00123263,
-    (float)0.00114895,
-    (float)0.00102175,
-    (float)0.000864143,
-    (float)0.000693115,
-    (float)0.000526603,
-    (float)0.000380512,
-    (float)0.000266253,
-    (float)0.000189293,
-    (float)0.000148919,
-    (float)0.000139214,
-    (float)0.000150948,
-    (float)0.000173917,
-    (float)0.000199209,
-    (float)0.000220906,
-    (float)0.000236898,
-    (float)0.000248702,
-    (float)0.000260405,
-    (float)0.000277053,
-    (float)0.000302919,
-    (float)0.000340072,
-    (float)0.000387608,
-    (float)0.000441696,
-    (float)0.000496405,
-    (float)0.00054509,
-    (float)0.000581956,
-    (float)0.000603427,
-    (float)0.00060895,
-    (float)0.000601043,
-    (float)0.000584587,
-    (float)0.000565512,
-    (float)0.00054922,
-    (float)0.000539135,
-    (float)0.000535735,
-    (float)0.000536323,
-    (float)0.000535616,
-    (float)0.00052703,
-    (float)0.000504382,
-    (float)0.000463606,
-    (float)0.000404093,
-    (float)0.000329308,
-    (float)0.000246534,
-    (float)0.000165742,
-    (float)9.78208e-05,
-    (float)5.25368e-05,
-    (float)3.66392e-05,
-    (float)0.195116,
-    (float)0.144232,
-    (float)0.119663,
-    (float)0.0969523,
-    (float)0.0756134,
-    (float)0.0572127,
-    (float)0.0429298,
-    (float)0.0330358,
-    (float)0.0269325,
-    (float)0.0234589,
-    (float)0.0213064,
-    (float)0.0193909,
-    (float)0.0170771,
-    (float)0.0142235,
-    (float)0.011069,
-    (float)0.00802925,
-    (float)0.00548785,
-    (float)0.00365282,
-    (float)0.00251195,
-    (float)0.00188331,
-    (float)0.00152184,
-    (float)0.00122969,
-    (float)0.000925694,
-    (float)0.000652051,
-    (float)0.000524895,
-    (float)0.000657294,
-    (float)0.00109101,
-    (float)0.00176514,
-    (float)0.00253147,
-    (float)0.00320617,
-    (float)0.00363385,
-    (float)0.00373731,
-    (float)0.00353533,
-    (float)0.00312464,
-    (float)0.0026369,
-    (float)0.00218962,
-    (float)0.00185002,
-    (float)0.00162337,
-    (float)0.0014669,
-    (float)0.00131985,
-    (float)0.0011355,
-    (float)0.000901999,
-    (float)0.000644872,
-    (float)0.000412551,
-    (float)0.000253133,
-    (float)0.000193355,
-    (float)0.000228693,
-    (float)0.000327858,
-    (float)0.000448413,
-    (float)0.000555644,
-    (float)0.000636044,
-    (float)0.000699751,
-    (float)0.000771514,
-    (float)0.000874884,
-    (float)0.00101712,
-    (float)0.00118171,
-    (float)0.00133178,
-    (float)0.00142317,
-    (float)0.00142135,
-    (float)0.00131529,
-    (float)0.00112246,
-    (float)0.000883022,
-    (float)0.000645773,
-    (float)0.000451691,
-    (float)0.00032161,
-    (float)0.000252702,
-    (float)0.000224481,
-    (float)0.000211062,
-    (float)0.000194014,
-    (float)0.000170219,
-    (float)0.000151666,
-    (float)0.000157847,
-    (float)0.00020465,
-    (float)0.000295041,
-    (float)0.000415786,
-    (float)0.000541613,
-    (float)0.000644821,
-    (float)0.000705937,
-    (float)0.000720685,
-    (float)0.000700279,
-    (float)0.00066508,
-    (float)0.00063465,
-    (float)0.00061876,
-    (float)0.000613357,
-    (float)0.000603252,
-    (float)0.000570145,
-    (float)0.00050225,
-    (float)0.000401113,
-    (float)0.000282502,
-    (float)0.000170974,
-    (float)9.05537e-05,
-    (float)5.56479e-05,
-    (float)6.61197e-05,
-    (float)0.000108538,
-    (float)0.000162823,
-    (float)0.000211178,
-    (float)0.000245269,
-    (float)0.000268577,
-    (float)0.000293059,
-    (float)0.000331856,
-    (float)0.000391519,
-    (float)0.000467346,
-    (float)0.000543975,
-    (float)0.000600972,
-    (float)0.000620928,
-    (float)0.000596481,
-    (float)0.000533224,
-    (float)0.000447312,
-    (float)0.000358937,
-    (float)0.000284623,
-    (float)0.000231699,
-    (float)0.000197214,
-    (float)0.000171532,
-    (float)0.000144684,
-    (float)0.000112438,
-    (float)7.92159e-05,
-    (float)5.65437e-05,
-    (float)5.775e-05,
-    (float)9.13857e-05,
-    (float)0.0001564,
-    (float)0.000241335,
-    (float)0.000328016,
-    (float)0.000398198,
-    (float)0.000440308,
-    (float)0.000453376,
-    (float)0.000446447,
-    (float)0.000433763,
-    (float)0.000427883,
-    (float)0.248222,
-    (float)0.165153,
-    (float)0.121993,
-    (float)0.0865837,
-    (float)0.0605454,
-    (float)0.0451838,
-    (float)0.0384251,
-    (float)0.0359943,
-    (float)0.0336916,
-    (float)0.0291753,
-    (float)0.0224473,
-    (float)0.0150873,
-    (float)0.00891451,
-    (float)0.00491433,
-    (float)0.00293516,
-    (float)0.00211262,
-    (float)0.00158674,
-    (float)0.00100614,
-    (float)0.000558645,
-    (float)0.000621152,
-    (float)0.00134751,
-    (float)0.00249267,
-    (float)0.00356002,
-    (float)0.00412323,
-    (float)0.00407547,
-    (float)0.00364179,
-    (float)0.00317545,
-    (float)0.00290503,
-    (float)0.00280963,
-    (float)0.00268792,
-    (float)0.00234493,
-    (float)0.00174917,
-    (float)0.00105401,
-    (float)0.000485917,
-    (float)0.000194045,
-    (float)0.000170533,
-    (float)0.000287093,
-    (float)0.000406191,
-    (float)0.000477814,
-    (float)0.000554092,
-    (float)0.000721211,
-    (float)0.00100855,
-    (float)0.00134648,
-    (float)0.00160283,
-    (float)0.00166801,
-    (float)0.00152489,
-    (float)0.00125441,
-    (float)0.000976838,
-    (float)0.00077443,
-    (float)0.00065064,
-    (float)0.000550111,
-    (float)0.000418139,
-    (float)0.000251762,
-    (float)0.000104955,
-    (float)4.73115e-05,
-    (float)0.000110241,
-    (float)0.000261852,
-    (float)0.0004282,
-    (float)0.000543404,
-    (float)0.000590763,
-    (float)0.000605474,
-    (float)0.00063915,
-    (float)0.000714417,
-    (float)0.000803885,
-    (float)0.000848383,
-    (float)0.000799859,
-    (float)0.000656744,
-    (float)0.000466323,
-    (float)0.000293857,
-    (float)0.000182244,
-    (float)0.000131515,
-    (float)0.000111007,
-    (float)9.2016e-05,
-    (float)7.41309e-05,
-    (float)8.48687e-05,
-    (float)0.000153839,
-    (float)0.000282648,
-    (float)0.000434906,
-    (float)0.000555095,
-    (float)0.000602913,
-    (float)0.000577903,
-    (float)0.000516449,
-    (float)0.00046378,
-    (float)0.000441898,
-    (float)0.000436756,
-    (float)0.000413147,
-    (float)0.000345013,
-    (float)0.000237967,
-    (float)0.000127463,
-    (float)5.4824e-05,
-    (float)3.98363e-05,
-    (float)7.03744e-05,
-    (float)0.000115836,
-    (float)0.000152766,
-    (float)0.000182164,
-    (float)0.000225104,
-    (float)0.000300614,
-    (float)0.000403793,
-    (float)0.000502046,
-    (float)0.000553412,
-    (float)0.000533933,
-    (float)0.000453891,
-    (float)0.000350912,
-    (float)0.000265066,
-    (float)0.000214228,
-    (float)0.000187285,
-    (float)0.000159028,
-    (float)0.000114311,
-    (float)6.25682e-05,
-    (float)3.17227e-05,
-    (float)4.66222e-05,
-    (float)0.000108961,
-    (float)0.000194308,
-    (float)0.000268551,
-    (float)0.000311144,
-    (float)0.000327425,
-    (float)0.000340768,
-    (float)0.000370909,
-    (float)0.00041538,
-    (float)0.000448619,
-    (float)0.000439828,
-    (float)0.000376284,
-    (float)0.000274559,
-    (float)0.000171164,
-    (float)9.94991e-05,
-    (float)7.01471e-05,
-    (float)6.87051e-05,
-    (float)7.18775e-05,
-    (float)0.292638,
-    (float)0.17073,
-    (float)0.109632,
-    (float)0.0710701,
-    (float)0.0546548,
-    (float)0.0525831,
-    (float)0.0526578,
-    (float)0.0465583,
-    (float)0.0339064,
-    (float)0.0198482,
-    (float)0.00954004,
-    (float)0.0044562,
-    (float)0.00270846,
-    (float)0.00182565,
-    (float)0.000914402,
-    (float)0.00057358,
-    (float)0.00139392,
-    (float)0.00293656,
-    (float)0.00412326,
-    (float)0.00433994,
-    (float)0.00395173,
-    (float)0.00375228,
-    (float)0.00404871,
-    (float)0.00437341,
-    (float)0.00404772,
-    (float)0.00292215,
-    (float)0.00152147,
-    (float)0.000524248,
-    (float)0.000180073,
-    (float)0.000235251,
-    (float)0.000335484,
-    (float)0.000401731,
-    (float)0.000600012,
-    (float)0.0010241,
-    (float)0.00150247,
-    (float)0.00174625,
-    (float)0.00164662,
-    (float)0.00137642,
-    (float)0.00119148,
-    (float)0.0011627,
-    (float)0.00112983,
-    (float)0.00090924,
-    (float)0.000514288,
-    (float)0.000152562,
-    (float)1.94158e-05,
-    (float)0.000119729,
-    (float)0.00029786,
-    (float)0.000418295,
-    (float)0.000487741,
-    (float)0.000597653,
-    (float)0.000775992,
-    (float)0.000928661,
-    (float)0.000934325,
-    (float)0.000777492,
-    (float)0.000567148,
-    (float)0.000423635,
-    (float)0.00036356,
-    (float)0.000307622,
-    (float)0.000193545,
-    (float)6.1322e-05,
-    (float)1.57316e-05,
-    (float)0.000111583,
-    (float)0.000290783,
-    (float)0.000438461,
-    (float)0.000493091,
-    (float)0.000491022,
-    (float)0.000504183,
-    (float)0.000548234,
-    (float)0.00056507,
-    (float)0.000494264,
-    (float)0.000347811,
-    (float)0.000203117,
-    (float)0.000124893,
-    (float)0.000106106,
-    (float)9.27416e-05,
-    (float)5.94476e-05,
-    (float)4.60582e-05,
-    (float)0.000111836,
-    (float)0.000259549,
-    (float)0.000416632,
-    (float)0.000497126,
-    (float)0.0004787,
-    (float)0.000413478,
-    (float)0.000365117,
-    (float)0.000343755,
-    (float)0.000308141,
-    (float)0.00022627,
-    (float)0.000121592,
-    (float)5.20895e-05,
-    (float)4.83503e-05,
-    (float)8.32773e-05,
-    (float)0.0001082,
-    (float)0.000112611,
-    (float)0.000136975,
-    (float)0.000221869,
-    (float)0.000350583,
-    (float)0.000451841,
-    (float)0.000463185,
-    (float)0.000388224,
-    (float)0.000287681,
-    (float)0.000216751,
-    (float)0.000178011,
-    (float)0.000137684,
-    (float)8.01054e-05,
-    (float)3.40862e-05,
-    (float)4.07015e-05,
-    (float)0.000101872,
-    (float)0.000172069,
-    (float)0.000205424,
-    (float)0.000205368,
-    (float)0.000218906,
-    (float)0.000279667,
-    (float)0.000362777,
-    (float)0.000403242,
-    (float)0.000359739,
-    (float)0.000255536,
-    (float)0.000153842,
-    (float)9.69177e-05,
-    (float)7.57375e-05,
-    (float)5.90372e-05,
-    (float)4.21521e-05,
-    (float)5.56891e-05,
-    (float)0.000123894,
-    (float)0.000223756,
-    (float)0.000296927,
-    (float)0.000305648,
-    (float)0.000271132,
-    (float)0.000249747,
-    (float)0.32305,
-    (float)0.162,
-    (float)0.0937312,
-    (float)0.0680754,
-    (float)0.0698465,
-    (float)0.0734759,
-    (float)0.0623697,
-    (float)0.0394457,
-    (float)0.0179841,
-    (float)0.00637116,
-    (float)0.00289646,
-    (float)0.00193523,
-    (float)0.000987654,
-    (float)0.00100343,
-    (float)0.00255093,
-    (float)0.00422608,
-    (float)0.00468925,
-    (float)0.00446919,
-    (float)0.00485844,
-    (float)0.00580658,
-    (float)0.00591018,
-    (float)0.00435822,
-    (float)0.00204499,
-    (float)0.000475732,
-    (float)0.000126331,
-    (float)0.000334088,
-    (float)0.000475291,
-    (float)0.000635758,
-    (float)0.00108323,
-    (float)0.00162253,
-    (float)0.00182798,
-    (float)0.0016721,
-    (float)0.00153068,
-    (float)0.00158315,
-    (float)0.00154053,
-    (float)0.00109903,
-    (float)0.000435041,
-    (float)2.88163e-05,
-    (float)8.55379e-05,
-    (float)0.000351262,
-    (float)0.000509466,
-    (float)0.000553679,
-    (float)0.000661796,
-    (float)0.000849977,
-    (float)0.000937961,
-    (float)0.000829021,
-    (float)0.000647511,
-    (float)0.000538554,
-    (float)0.000460784,
-    (float)0.000292377,
-    (float)7.48447e-05,
-    (float)6.8686e-06,
-    (float)0.00018007,
-    (float)0.000437487,
-    (float)0.000560512,
-    (float)0.000522699,
-    (float)0.000471012,
-    (float)0.000493923,
-    (float)0.000516002,
-    (float)0.000439934,
-    (float)0.000296686,
-    (float)0.000187603,
-    (float)0.00013444,
-    (float)7.86851e-05,
-    (float)1.95817e-05,
-    (float)5.54377e-05,
-    (float)0.000241545,
-    (float)0.000470315,
-    (float)0.000567081,
-    (float)0.000487925,
-    (float)0.000354747,
-    (float)0.000288583,
-    (float)0.00027519,
-    (float)0.00023014,
-    (float)0.000140236,
-    (float)7.21701e-05,
-    (float)6.08361e-05,
-    (float)6.69776e-05,
-    (float)6.63738e-05,
-    (float)0.000114056,
-    (float)0.000262165,
-    (float)0.000445805,
-    (float)0.000521605,
-    (float)0.000429716,
-    (float)0.000264152,
-    (float)0.000156178,
-    (float)0.00013023,
-    (float)0.000116801,
-    (float)7.70084e-05,
-    (float)4.99977e-05,
-    (float)7.25718e-05,
-    (float)0.000115259,
-    (float)0.000137489,
-    (float)0.000165137,
-    (float)0.000252934,
-    (float)0.000377672,
-    (float)0.000431035,
-    (float)0.000345067,
-    (float)0.000184026,
-    (float)7.26102e-05,
-    (float)5.59287e-05,
-    (float)7.55896e-05,
-    (float)7.53203e-05,
-    (float)7.36918e-05,
-    (float)0.000110601,
-    (float)0.0001691,
-    (float)0.000199466,
-    (float)0.000201784,
-    (float)0.000227588,
-    (float)0.000289072,
-    (float)0.000317101,
-    (float)0.000246238,
-    (float)0.000113636,
-    (float)2.67508e-05,
-    (float)3.7512e-05,
-    (float)9.30343e-05,
-    (float)0.000122093,
-    (float)0.000126621,
-    (float)0.0001537,
-    (float)0.000206484,
-    (float)0.000235405,
-    (float)0.000217561,
-    (float)0.000193713,
-    (float)0.000201078,
-    (float)0.000207247,
-    (float)0.000155453,
-    (float)6.11242e-05,
-    (float)1.23005e-05,
-    (float)0.342465,
-    (float)0.142432,
-    (float)0.0825895,
-    (float)0.0856313,
-    (float)0.10057,
-    (float)0.0871086,
-    (float)0.0500235,
-    (float)0.0181832,
-    (float)0.00514892,
-    (float)0.00276803,
-    (float)0.0015299,
-    (float)0.00106162,
-    (float)0.00277145,
-    (float)0.00445033,
-    (float)0.00468541,
-    (float)0.00545416,
-    (float)0.00762374,
-    (float)0.00848145,
-    (float)0.00602889,
-    (float)0.00231048,
-    (float)0.000329819,
-    (float)0.000220243,
-    (float)0.0004133,
-    (float)0.00051241,
-    (float)0.00100962,
-    (float)0.00162189,
-    (float)0.00177186,
-    (float)0.00179777,
-    (float)0.00220139,
-    (float)0.0024412,
-    (float)0.0017603,
-    (float)0.000598362,
-    (float)1.23688e-05,
-    (float)0.000160561,
-    (float)0.000390172,
-    (float)0.000441455,
-    (float)0.00058931,
-    (float)0.00084794,
-    (float)0.000924529,
-    (float)0.000838132,
-    (float)0.000847269,
-    (float)0.000862063,
-    (float)0.000584294,
-    (float)0.000151184,
-    (float)2.21095e-05,
-    (float)0.000255517,
-    (float)0.00045761,
-    (float)0.000443002,
-    (float)0.000423313,
-    (float)0.000515574,
-    (float)0.000555106,
-    (float)0.00046496,
-    (float)0.000380094,
-    (float)0.000330249,
-    (float)0.00019099,
-    (float)2.03045e-05,
-    (float)6.37345e-05,
-    (float)0.000331356,
-    (float)0.000520116,
-    (float)0.000464229,
-    (float)0.000343049,
-    (float)0.000330692,
-    (float)0.000345535,
-    (float)0.000278218,
-    (float)0.000189615,
-    (float)0.000140522,
-    (float)7.42686e-05,
-    (float)7.06822e-06,
-    (float)9.36544e-05,
-    (float)0.000350217,
-    (float)0.000534834,
-    (float)0.000470556,
-    (float)0.000292225,
-    (float)0.000209293,
-    (float)0.000210454,
-    (float)0.000176411,
-    (float)0.000112236,
-    (float)8.21235e-05,
-    (float)6.19341e-05,
-    (float)3.79678e-05,
-    (float)0.000112993,
-    (float)0.000326979,
-    (float)0.000499033,
-    (float)0.000444209,
-    (float)0.000245491,
-    (float)0.000121391,
-    (float)0.000116984,
-    (float)0.000117358,
-    (float)8.29627e-05,
-    (float)7.0256e-05,
-    (float)7.97089e-05,
-    (float)7.83819e-05,
-    (float)0.000124368,
-    (float)0.000276347,
-    (float)0.000420035,
-    (float)0.000382059,
-    (float)0.000195288,
-    (float)6.12281e-05,
-    (float)6.12824e-05,
-    (float)9.22852e-05,
-    (float)8.23525e-05,
-    (float)7.76215e-05,
-    (float)0.000101603,
-    (float)0.000113743,
-    (float)0.000131888,
-    (float)0.000219193,
-    (float)0.000321598,
-    (float)0.000296043,
-    (float)0.000140392,
-    (float)2.38858e-05,
-    (float)4.0656e-05,
-    (float)9.82704e-05,
-    (float)0.000103977,
-    (float)9.51435e-05,
-    (float)0.00011802,
-    (float)0.000135728,
-    (float)0.000133213,
-    (float)0.000165777,
-    (float)0.000225818,
-    (float)0.000207611,
-    (float)8.92456e-05,
-    (float)6.5343e-06,
-    (float)5.22588e-05,
-    (float)0.000137636,
-    (float)0.000151453,
-    (float)0.000124376,
-    (float)0.000129029,
-    (float)0.00014363,
-    (float)0.348506,
-    (float)0.120693,
-    (float)0.089101,
-    (float)0.121014,
-    (float)0.124153,
-    (float)0.0764724,
-    (float)0.0259753,
-    (float)0.00539029,
-    (float)0.00271832,
-    (float)0.00157085,
-    (float)0.00182226,
-    (float)0.0040759,
-    (float)0.00504196,
-    (float)0.00613855,
-    (float)0.00943836,
-    (float)0.0107376,
-    (float)0.00680573,
-    (float)0.00180427,
-    (float)9.96088e-05,
-    (float)0.000403631,
-    (float)0.000530947,
-    (float)0.000888234,
-    (float)0.00162497,
-    (float)0.00194824,
-    (float)0.00223883,
-    (float)0.00290863,
-    (float)0.00277686,
-    (float)0.00133645,
-    (float)0.000131441,
-    (float)0.000125377,
-    (float)0.000434777,
-    (float)0.0004586,
-    (float)0.000623687,
-    (float)0.000945028,
-    (float)0.00102693,
-    (float)0.00100921,
-    (float)0.00102586,
-    (float)0.00072189,
-    (float)0.000185737,
-    (float)6.3508e-05,
-    (float)0.000364045,
-    (float)0.000489792,
-    (float)0.000391694,
-    (float)0.000451853,
-    (float)0.00060005,
-    (float)0.000564641,
-    (float)0.000434484,
-    (float)0.000312178,
-    (float)0.000117005,
-    (float)1.31647e-05,
-    (float)0.000234154,
-    (float)0.000515147,
-    (float)0.000484059,
-    (float)0.00031933,
-    (float)0.000333102,
-    (float)0.000393705,
-    (float)0.000301351,
-    (float)0.000161244,
-    (float)6.80441e-05,
-    (float)4.96405e-06,
-    (float)9.552e-05,
-    (float)0.000381469,
-    (float)0.000551987,
-    (float)0.000410465,
-    (float)0.000228577,
-    (float)0.000232899,
-    (float)0.000252151,
-    (float)0.000150354,
-    (float)5.53725e-05,
-    (float)3.5642e-05,
-    (float)6.08858e-05,
-    (float)0.000203597,
-    (float)0.000434525,
-    (float)0.000488262,
-    (float)0.00029497,
-    (float)0.000141517,
-    (float)0.000162303,
-    (float)0.000165271,
-    (float)7.71888e-05,
-    (float)4.15513e-05,
-    (float)8.52466e-05,
-    (float)0.000144638,
-    (float)0.000261038,
-    (float)0.000395716,
-    (float)0.000359308,
-    (float)0.000169859,
-    (float)7.76167e-05,
-    (float)0.000121499,
-    (float)0.000114357,
-    (float)4.97565e-05,
-    (float)6.84779e-05,
-    (float)0.000145396,
-    (float)0.000192252,
-    (float)0.000246037,
-    (float)0.000290801,
-    (float)0.000212733,
-    (float)7.28958e-05,
-    (float)5.09003e-05,
-    (float)0.000107734,
-    (float)8.94492e-05,
-    (float)4.93704e-05,
-    (float)0.000104586,
-    (float)0.000180519,
-    (float)0.000187327,
-    (float)0.000179425,
-    (float)0.000168435,
-    (float)9.39005e-05,
-    (float)2.45545e-05,
-    (float)6.0411e-05,
-    (float)0.000112055,
-    (float)7.90131e-05,
-    (float)5.90639e-05,
-    (float)0.00012815,
-    (float)0.00017621,
-    (float)0.000138557,
-    (float)9.57264e-05,
-    (float)7.2225e-05,
-    (float)3.17954e-05,
-    (float)2.91517e-05,
-    (float)9.61976e-05,
-    (float)0.000124395,
-    (float)7.44701e-05,
-    (float)6.86456e-05,
-    (float)0.000133381,
-    (float)0.000142223,
-    (float)7.57442e-05,
-    (float)3.66366e-05,
-    (float)3.6359e-05,
-    (float)0.344076,
-    (float)0.0997373,
-    (float)0.115856,
-    (float)0.164361,
-    (float)0.126201,
-    (float)0.0475066,
-    (float)0.00833544,
-    (float)0.00297006,
-    (float)0.00174555,
-    (float)0.00262974,
-    (float)0.0047003,
-    (float)0.00531323,
-    (float)0.00956957,
-    (float)0.0141061,
-    (float)0.0102595,
-    (float)0.00280782,
-    (float)0.000121503,
-    (float)0.000405499,
-    (float)0.000594523,
-    (float)0.00127261,
-    (float)0.00176502,
-    (float)0.00212182,
-    (float)0.00350665,
-    (float)0.00392032,
-    (float)0.00190534,
-    (float)0.000161242,
-    (float)0.000150565,
-    (float)0.000391349,
-    (float)0.000521519,
-    (float)0.000854247,
-    (float)0.00095205,
-    (float)0.00111043,
-    (float)0.00145778,
-    (float)0.00106985,
-    (float)0.000243298,
-    (float)0.000128563,
-    (float)0.000388864,
-    (float)0.000391081,
-    (float)0.000454959,
-    (float)0.000575035,
-    (float)0.000519857,
-    (float)0.000531056,
-    (float)0.000483843,
-    (float)0.000167634,
-    (float)9.42251e-05,
-    (float)0.000384363,
-    (float)0.000460185,
-    (float)0.000345411,
-    (float)0.000373667,
-    (float)0.000364504,
-    (float)0.000261602,
-    (float)0.000213233,
-    (float)9.04399e-05,
-    (float)1.93946e-05,
-    (float)0.000285807,
-    (float)0.000529566,
-    (float)0.000413902,
-    (float)0.000279348,
-    (float)0.000279964,
-    (float)0.000207267,
-    (float)0.000121988,
-    (float)7.61329e-05,
-    (float)6.39217e-06,
-    (float)0.000135052,
-    (float)0.000455935,
-    (float)0.000511078,
-    (float)0.000297008,
-    (float)0.00020238,
-    (float)0.000188672,
-    (float)0.000109517,
-    (float)7.31801e-05,
-    (float)5.55173e-05,
-    (float)6.23653e-05,
-    (float)0.000273961,
-    (float)0.000488406,
-    (float)0.000378866,
-    (float)0.000176412,
-    (float)0.000143898,
-    (float)0.000121865,
-    (float)6.87764e-05,
-    (float)8.35475e-05,
-    (float)8.90729e-05,
-    (float)0.000140874,
-    (float)0.000332125,
-    (float)0.000396482,
-    (float)0.000215516,
-    (float)9.47923e-05,
-    (float)0.00010655,
-    (float)7.8503e-05,
-    (float)6.97375e-05,
-    (float)0.000115487,
-    (float)0.000118376,
-    (float)0.000173196,
-    (float)0.000291041,
-    (float)0.0002439,
-    (float)8.81465e-05,
-    (float)6.04997e-05,
-    (float)8.23232e-05,
-    (float)5.946e-05,
-    (float)9.22892e-05,
-    (float)0.000130733,
-    (float)0.00011098,
-    (float)0.000150317,
-    (float)0.000194108,
-    (float)0.000105361,
-    (float)2.85746e-05,
-    (float)6.04748e-05,
-    (float)6.70836e-05,
-    (float)6.07244e-05,
-    (float)0.000109325,
-    (float)0.000109596,
-    (float)7.3692e-05,
-    (float)0.0001009,
-    (float)9.53745e-05,
-    (float)2.67565e-05,
-    (float)3.22177e-05,
-    (float)7.24236e-05,
-    (float)5.70952e-05,
-    (float)7.03937e-05,
-    (float)0.000101432,
-    (float)6.17427e-05,
-    (float)3.74597e-05,
-    (float)6.22146e-05,
-    (float)3.824e-05,
-    (float)2.04911e-05,
-    (float)6.87832e-05,
-    (float)7.6994e-05,
-    (float)5.30598e-05,
-    (float)0.326764,
-    (float)0.0882586,
-    (float)0.164674,
-    (float)0.197084,
-    (float)0.101242,
-    (float)0.0199369,
-    (float)0.00352003,
-    (float)0.00219482,
-    (float)0.00302069,
-    (float)0.0047603,
-    (float)0.00600737,
-    (float)0.0141579,
-    (float)0.0172738,
-    (float)0.00781481,
-    (float)0.000708291,
-    (float)0.000288801,
-    (float)0.000592698,
-    (float)0.00130997,
-    (float)0.00164663,
-    (float)0.00251646,
-    (float)0.00498029,
-    (float)0.0044566,
-    (float)0.00118971,
-    (float)1.18149e-05,
-    (float)0.000298819,
-    (float)0.000492328,
-    (float)0.000821188,
-    (float)0.000860423,
-    (float)0.00140893,
-    (float)0.00206731,
-    (float)0.0011695,
-    (float)0.000154229,
-    (float)0.000235304,
-    (float)0.000360833,
-    (float)0.000446981,
-    (float)0.000533859,
-    (float)0.000490703,
-    (float)0.00075185,
-    (float)0.000719548,
-    (float)0.000220424,
-    (float)0.000213979,
-    (float)0.00041229,
-    (float)0.000356157,
-    (float)0.000374106,
-    (float)0.00032171,
-    (float)0.000275361,
-    (float)0.000344745,
-    (float)0.000158741,
-    (float)0.000111898,
-    (float)0.000420088,
-    (float)0.000452357,
-    (float)0.000316272,
-    (float)0.000284132,
-    (float)0.000182354,
-    (float)0.0001661,
-    (float)0.00012755,
-    (float)1.00155e-05,
-    (float)0.000262604,
-    (float)0.000541303,
-    (float)0.000397131,
-    (float)0.000252458,
-    (float)0.000192238,
-    (float)0.00010949,
-    (float)0.000119078,
-    (float)3.61455e-05,
-    (float)6.52372e-05,
-    (float)0.000425385,
-    (float)0.00052188,
-    (float)0.000285743,
-    (float)0.000181368,
-    (float)0.000121083,
-    (float)8.91197e-05,
-    (float)0.000104082,
-    (float)2.79755e-05,
-    (float)0.00018056,
-    (float)0.000485349,
-    (float)0.000400799,
-    (float)0.000177027,
-    (float)0.000125859,
-    (float)8.23109e-05,
-    (float)0.000100484,
-    (float)0.000102284,
-    (float)5.83385e-05,
-    (float)0.000267449,
-    (float)0.000435641,
-    (float)0.000247838,
-    (float)9.97203e-05,
-    (float)8.7282e-05,
-    (float)7.09706e-05,
-    (float)0.000119068,
-    (float)9.35737e-05,
-    (float)8.90287e-05,
-    (float)0.000286079,
-    (float)0.000310041,
-    (float)0.000114945,
-    (float)5.7467e-05,
-    (float)6.38046e-05,
-    (float)7.68902e-05,
-    (float)0.000121196,
-    (float)6.92472e-05,
-    (float)0.000101931,
-    (float)0.000240501,
-    (float)0.000168308,
-    (float)3.61635e-05,
-    (float)4.48083e-05,
-    (float)5.47057e-05,
-    (float)8.56186e-05,
-    (float)9.78524e-05,
-    (float)3.91963e-05,
-    (float)9.96959e-05,
-    (float)0.000161424,
-    (float)5.91369e-05,
-    (float)1.46045e-05,
-    (float)4.7795e-05,
-    (float)5.35539e-05,
-    (float)8.22707e-05,
-    (float)5.47796e-05,
-    (float)2.05686e-05,
-    (float)9.01449e-05,
-    (float)8.17174e-05,
-    (float)8.45905e-06,
-    (float)3.20862e-05,
-    (float)5.23115e-05,
-    (float)5.37096e-05,
-    (float)6.13097e-05,
-    (float)1.49551e-05,
-    (float)3.16672e-05,
-    (float)8.47061e-05,
-    (float)0.296385,
-    (float)0.0957986,
-    (float)0.225676,
-    (float)0.204282,
-    (float)0.0642264,
-    (float)0.00602169,
-    (float)0.00327397,
-    (float)0.00275153,
-    (float)0.0046522,
-    (float)0.00670077,
-    (float)0.0174592,
-    (float)0.0200114,
-    (float)0.0066862,
-    (float)0.000128139,
-    (float)0.000661405,
-    (float)0.000845072,
-    (float)0.00157058,
-    (float)0.00249103,
-    (float)0.00548847,
-    (float)0.00575405,
-    (float)0.00159755,
-    (float)4.85493e-05,
-    (float)0.000443174,
-    (float)0.000463915,
-    (float)0.000841862,
-    (float)0.00130204,
-    (float)0.00231517,
-    (float)0.00204049,
-    (float)0.000460114,
-    (float)0.000254034,
-    (float)0.000414213,
-    (float)0.000323505,
-    (float)0.00054842,
-    (float)0.000741268,
-    (float)0.00100557,
-    (float)0.000679592,
-    (float)0.000216638,
-    (float)0.000447244,
-    (float)0.000399236,
-    (float)0.00024623,
-    (float)0.000377406,
-    (float)0.000415064,
-    (float)0.000400342,
-    (float)0.00018109,
-    (float)0.000241732,
-    (float)0.000568996,
-    (float)0.000371868,
-    (float)0.00018968,
-    (float)0.000270074,
-    (float)0.000234988,
-    (float)0.000138188,
-    (float)3.4119e-05,
-    (float)0.000322735,
-    (float)0.000622823,
-    (float)0.000328496,
-    (float)0.000146069,
-    (float)0.000208664,
-    (float)0.00014187,
-    (float)3.9682e-05,
-    (float)2.93911e-05,
-    (float)0.000395648,
-    (float)0.000615036,
-    (float)0.000266214,
-    (float)0.000112856,
-    (float)0.000173606,
-    (float)9.43984e-05,
-    (float)2.06759e-05,
-    (float)7.58812e-05,
-    (float)0.000428268,
-    (float)0.000551225,
-    (float)0.000194302,
-    (float)8.93742e-05,
-    (float)0.000152341,
-    (float)7.25024e-05,
-    (float)3.5823e-05,
-    (float)0.000122345,
-    (float)0.000413697,
-    (float)0.000455244,
-    (float)0.000126769,
-    (float)7.59767e-05,
-    (float)0.000140108,
-    (float)6.35193e-05,
-    (float)5.67802e-05,
-    (float)0.000148602,
-    (float)0.00036531,
-    (float)0.000347182,
-    (float)6.97878e-05,
-    (float)7.24805e-05,
-    (float)0.000131731,
-    (float)5.64336e-05,
-    (float)6.90511e-05,
-    (float)0.00015068,
-    (float)0.000294841,
-    (float)0.000239032,
-    (float)2.8338e-05,
-    (float)7.71353e-05,
-    (float)0.000121254,
-    (float)4.54674e-05,
-    (float)6.88205e-05,
-    (float)0.000132402,
-    (float)0.000216171,
-    (float)0.000145002,
-    (float)6.61259e-06,
-    (float)8.66042e-05,
-    (float)0.000106187,
-    (float)3.11396e-05,
-    (float)5.97909e-05,
-    (float)0.000104191,
-    (float)0.000144861,
-    (float)7.46081e-05,
-    (float)3.55068e-06,
-    (float)9.72555e-05,
-    (float)8.62153e-05,
-    (float)1.64461e-05,
-    (float)4.89788e-05,
-    (float)7.74256e-05,
-    (float)9.06216e-05,
-    (float)2.97468e-05,
-    (float)1.52629e-05,
-    (float)0.000105491,
-    (float)6.19841e-05,
-    (float)6.49072e-06,
-    (float)4.5374e-05,
-    (float)6.14134e-05,
-    (float)5.7594e-05,
-    (float)8.60723e-06,
-    (float)3.66418e-05,
-    (float)0.000108542,
-    (float)0.261105,
-    (float)0.121925,
-    (float)0.288445,
-    (float)0.18264,
-    (float)0.0298574,
-    (float)0.00346971,
-    (float)0.00305815,
-    (float)0.00460046,
-    (float)0.0056666,
-    (float)0.0192392,
-    (float)0.024331,
-    (float)0.00702627,
-    (float)9.08905e-05,
-    (float)0.000753672,
-    (float)0.00120427,
-    (float)0.00171428,
-    (float)0.00449898,
-    (float)0.00793548,
-    (float)0.00357194,
-    (float)7.7371e-05,
-    (float)0.000382058,
-    (float)0.000502486,
-    (float)0.000818742,
-    (float)0.00151746,
-    (float)0.00314261,
-    (float)0.00202354,
-    (float)0.000233837,
-    (float)0.000338128,
-    (float)0.000323616,
-    (float)0.000474891,
-    (float)0.000673643,
-    (float)0.00129347,
-    (float)0.0010634,
-    (float)0.00028904,
-    (float)0.000410907,
-    (float)0.000310662,
-    (float)0.000307557,
-    (float)0.000379992,
-    (float)0.000544229,
-    (float)0.000492318,
-    (float)0.000235568,
-    (float)0.000493608,
-    (float)0.000373253,
-    (float)0.000220219,
-    (float)0.000258918,
-    (float)0.000257423,
-    (float)0.000208804,
-    (float)0.000129435,
-    (float)0.00051037,
-    (float)0.0004708,
-    (float)0.000183583,
-    (float)0.00020021,
-    (float)0.000159039,
-    (float)9.8903e-05,
-    (float)3.88279e-05,
-    (float)0.000443301,
-    (float)0.000561138,
-    (float)0.000190483,
-    (float)0.000159562,
-    (float)0.000132972,
-    (float)6.88762e-05,
-    (float)2.64498e-06,
-    (float)0.000325319,
-    (float)0.000598379,
-    (float)0.000232338,
-    (float)0.000118156,
-    (float)0.000130745,
-    (float)6.42049e-05,
-    (float)1.27555e-05,
-    (float)0.000205757,
-    (float)0.000557157,
-    (float)0.000289493,
-    (float)7.80598e-05,
-    (float)0.000127795,
-    (float)6.58723e-05,
-    (float)3.59227e-05,
-    (float)0.000121434,
-    (float)0.00045104,
-    (float)0.000334357,
-    (float)5.37347e-05,
-    (float)0.000111968,
-    (float)7.34539e-05,
-    (float)4.75756e-05,
-    (float)8.10635e-05,
-    (float)0.000321176,
-    (float)0.000341794,
-    (float)5.31179e-05,
-    (float)8.2882e-05,
-    (float)8.62937e-05,
-    (float)4.44255e-05,
-    (float)6.80155e-05,
-    (float)0.000206977,
-    (float)0.000303118,
-    (float)6.79176e-05,
-    (float)4.91754e-05,
-    (float)9.71947e-05,
-    (float)3.6178e-05,
-    (float)5.95373e-05,
-    (float)0.000127814,
-    (float)0.00023268,
-    (float)8.18961e-05,
-    (float)2.18015e-05,
-    (float)9.93698e-05,
-    (float)3.29795e-05,
-    (float)4.45659e-05,
-    (float)8.28566e-05,
-    (float)0.000157921,
-    (float)8.4058e-05,
-    (float)6.47453e-06,
-    (float)9.27273e-05,
-    (float)3.82018e-05,
-    (float)2.59207e-05,
-    (float)6.0932e-05,
-    (float)0.000100758,
-    (float)7.43273e-05,
-    (float)1.08788e-06,
-    (float)8.20131e-05,
-    (float)4.8751e-05,
-    (float)1.09351e-05,
-    (float)5.18125e-05,
-    (float)6.83881e-05,
-    (float)6.06814e-05,
-    (float)5.24006e-07,
-    (float)7.10509e-05,
-    (float)6.02317e-05,
-    (float)3.0328e-06,
-    (float)5.18731e-05,
-    (float)5.83517e-05,
-    (float)0.22045,
-    (float)0.1705,
-    (float)0.336165,
-    (float)0.14159,
-    (float)0.0104304,
-    (float)0.00382865,
-    (float)0.0042757,
-    (float)0.00476646,
-    (float)0.0162605,
-    (float)0.0301485,
-    (float)0.0109228,
-    (float)7.92073e-05,
-    (float)0.000937151,
-    (float)0.00135082,
-    (float)0.0020423,
-    (float)0.0067754,
-    (float)0.00840779,
-    (float)0.00169753,
-    (float)0.000179594,
-    (float)0.000514081,
-    (float)0.000727171,
-    (float)0.0013484,
-    (float)0.0034051,
-    (float)0.00269975,
-    (float)0.000342277,
-    (float)0.000390271,
-    (float)0.000340355,
-    (float)0.000515164,
-    (float)0.000950543,
-    (float)0.00161948,
-    (float)0.000793034,
-    (float)0.00034302,
-    (float)0.000423995,
-    (float)0.000263416,
-    (float)0.000392271,
-    (float)0.000596249,
-    (float)0.00061762,
-    (float)0.000301487,
-    (float)0.000530254,
-    (float)0.000349751,
-    (float)0.000217519,
-    (float)0.000278575,
-    (float)0.000298557,
-    (float)0.000164709,
-    (float)0.000354059,
-    (float)0.000591937,
-    (float)0.000238628,
-    (float)0.000180522,
-    (float)0.000179417,
-    (float)9.84256e-05,
-    (float)7.33835e-05,
-    (float)0.000508579,
-    (float)0.000504827,
-    (float)0.000148993,
-    (float)0.000152205,
-    (float)9.98929e-05,
-    (float)7.77554e-06,
-    (float)0.00016373,
-    (float)0.000580509,
-    (float)0.000348105,
-    (float)0.000103015,
-    (float)0.000123669,
-    (float)4.52343e-05,
-    (float)1.45213e-05,
-    (float)0.000296377,
-    (float)0.000531763,
-    (float)0.000195253,
-    (float)8.88147e-05,
-    (float)9.07454e-05,
-    (float)2.42425e-05,
-    (float)8.16789e-05,
-    (float)0.000376784,
-    (float)0.000393797,
-    (float)8.90285e-05,
-    (float)8.69397e-05,
-    (float)5.97585e-05,
-    (float)3.57602e-05,
-    (float)0.000158129,
-    (float)0.000367171,
-    (float)0.000231587,
-    (float)4.15764e-05,
-    (float)8.29839e-05,
-    (float)3.83545e-05,
-    (float)6.80466e-05,
-    (float)0.000203255,
-    (float)0.000285578,
-    (float)0.000103246,
-    (float)3.76637e-05,
-    (float)6.94088e-05,
-    (float)3.21639e-05,
-    (float)0.000103434,
-    (float)0.00019971,
-    (float)0.000176565,
-    (float)3.33565e-05,
-    (float)4.93287e-05,
-    (float)4.82626e-05,
-    (float)4.1469e-05,
-    (float)0.000122676,
-    (float)0.000154454,
-    (float)8.2811e-05,
-    (float)1.46544e-05,
-    (float)5.39916e-05,
-    (float)2.88685e-05,
-    (float)5.88271e-05,
-    (float)0.000115422,
-    (float)9.27333e-05,
-    (float)2.85189e-05,
-    (float)2.23468e-05,
-    (float)4.40834e-05,
-    (float)2.08326e-05,
-    (float)7.36971e-05,
-    (float)8.63542e-05,
-    (float)4.24245e-05,
-    (float)1.28994e-05,
-    (float)3.1133e-05,
-    (float)2.66304e-05,
-    (float)2.8329e-05,
-    (float)7.76117e-05,
-    (float)5.01318e-05,
-    (float)1.86839e-05,
-    (float)1.76336e-05,
-    (float)2.85769e-05,
-    (float)1.58025e-05,
-    (float)4.73096e-05,
-    (float)6.73018e-05,
-    (float)2.31776e-05,
-    (float)1.91156e-05,
-    (float)2.21586e-05,
-    (float)0.176464,
-    (float)0.239643,
-    (float)0.360846,
-    (float)0.0924112,
-    (float)0.00379573,
-    (float)0.00428674,
-    (float)0.00509666,
-    (float)0.00933728,
-    (float)0.033729,
-    (float)0.0197495,
-    (float)0.000500906,
-    (float)0.000993586,
-    (float)0.00143705,
-    (float)0.00214017,
-    (float)0.00870892,
-    (float)0.00862498,
-    (float)0.000770822,
-    (float)0.000424695,
-    (float)0.000586769,
-    (float)0.000888719,
-    (float)0.00281256,
-    (float)0.00421244,
-    (float)0.000957401,
-    (float)0.000340096,
-    (float)0.000358745,
-    (float)0.000488415,
-    (float)0.0010362,
-    (float)0.00198317,
-    (float)0.000840646,
-    (float)0.000423407,
-    (float)0.000344421,
-    (float)0.000306398,
-    (float)0.000464249,
-    (float)0.000865027,
-    (float)0.000550339,
-    (float)0.000511212,
-    (float)0.00043216,
-    (float)0.000217121,
-    (float)0.000268364,
-    (float)0.000363256,
-    (float)0.000265511,
-    (float)0.000500414,
-    (float)0.000562478,
-    (float)0.000185955,
-    (float)0.000191894,
-    (float)0.000168052,
-    (float)8.84195e-05,
-    (float)0.000380747,
-    (float)0.000666162,
-    (float)0.000206676,
-    (float)0.000150906,
-    (float)0.000102752,
-    (float)2.28486e-05,
-    (float)0.000220236,
-    (float)0.000683338,
-    (float)0.000275699,
-    (float)0.00011571,
-    (float)8.72146e-05,
-    (float)1.89363e-05,
-    (float)9.82743e-05,
-    (float)0.000598182,
-    (float)0.000368805,
-    (float)8.3974e-05,
-    (float)8.77123e-05,
-    (float)2.88398e-05,
-    (float)4.66343e-05,
-    (float)0.000446399,
-    (float)0.000439687,
-    (float)6.9119e-05,
-    (float)8.44777e-05,
-    (float)3.37841e-05,
-    (float)4.4176e-05,
-    (float)0.000288834,
-    (float)0.000447155,
-    (float)8.12986e-05,
-    (float)6.72547e-05,
-    (float)3.63979e-05,
-    (float)5.31093e-05,
-    (float)0.000172977,
-    (float)0.000384879,
-    (float)0.000112791,
-    (float)3.99516e-05,
-    (float)4.11151e-05,
-    (float)5.19872e-05,
-    (float)0.000111336,
-    (float)0.000283016,
-    (float)0.000141961,
-    (float)1.56614e-05,
-    (float)4.59033e-05,
-    (float)4.10795e-05,
-    (float)8.77689e-05,
-    (float)0.000182928,
-    (float)0.000150162,
-    (float)4.15994e-06,
-    (float)4.66667e-05,
-    (float)2.98287e-05,
-    (float)7.88875e-05,
-    (float)0.00011138,
-    (float)0.000134166,
-    (float)5.21565e-06,
-    (float)4.21488e-05,
-    (float)2.51002e-05,
-    (float)7.01232e-05,
-    (float)7.32175e-05,
-    (float)0.000104318,
-    (float)1.29127e-05,
-    (float)3.33649e-05,
-    (float)2.79439e-05,
-    (float)5.78957e-05,
-    (float)5.97271e-05,
-    (float)7.35876e-05,
-    (float)2.29244e-05,
-    (float)2.17906e-05,
-    (float)3.55186e-05,
-    (float)4.44162e-05,
-    (float)5.93246e-05,
-    (float)4.96045e-05,
-    (float)3.35852e-05,
-    (float)1.00397e-05,
-    (float)4.31887e-05,
-    (float)3.36955e-05,
-    (float)6.28309e-05,
-    (float)3.48068e-05,
-    (float)4.25474e-05,
-    (float)2.37545e-06,
-    (float)4.62805e-05,
-    (float)2.96878e-05,
-    (float)6.46309e-05,
-    (float)0.131745,
-    (float)0.326492,
-    (float)0.355445,
-    (float)0.0491475,
-    (float)0.00372738,
-    (float)0.00546645,
-    (float)0.00428163,
-    (float)0.027223,
-    (float)0.0344243,
-    (float)0.00346389,
-    (float)0.000771107,
-    (float)0.00150832,
-    (float)0.00182408,
-    (float)0.0100255,
-    (float)0.00948024,
-    (float)0.000474909,
-    (float)0.000509269,
-    (float)0.000691992,
-    (float)0.00114444,
-    (float)0.00480207,
-    (float)0.00328681,
-    (float)0.000273486,
-    (float)0.000394558,
-    (float)0.000414018,
-    (float)0.000801323,
-    (float)0.00242641,
-    (float)0.00125698,
-    (float)0.000417207,
-    (float)0.000321916,
-    (float)0.000295596,
-    (float)0.000559727,
-    (float)0.0011766,
-    (float)0.000605433,
-    (float)0.000556903,
-    (float)0.000270204,
-    (float)0.000220825,
-    (float)0.000374064,
-    (float)0.000504525,
-    (float)0.000501714,
-    (float)0.000615447,
-    (float)0.000218513,
-    (float)0.000164203,
-    (float)0.000230281,
-    (float)0.00018565,
-    (float)0.000593728,
-    (float)0.000573917,
-    (float)0.000168428,
-    (float)0.000122118,
-    (float)0.000123548,
-    (float)9.21161e-05,
-    (float)0.000694075,
-    (float)0.000462775,
-    (float)0.000128572,
-    (float)9.0167e-05,
-    (float)5.57912e-05,
-    (float)0.000121213,
-    (float)0.000726327,
-    (float)0.000330379,
-    (float)9.8503e-05,
-    (float)6.77199e-05,
-    (float)2.28198e-05,
-    (float)0.000197246,
-    (float)0.000683642,
-    (float)0.000207588,
-    (float)7.54033e-05,
-    (float)5.47574e-05,
-    (float)1.40557e-05,
-    (float)0.000275274,
-    (float)0.000580232,
-    (float)0.000108944,
-    (float)5.82349e-05,
-    (float)4.80683e-05,
-    (float)2.06012e-05,
-    (float)0.000327305,
-    (float)0.000437423,
-    (float)4.32092e-05,
-    (float)4.53418e-05,
-    (float)4.47326e-05,
-    (float)3.54027e-05,
-    (float)0.0003379,
-    (float)0.000286443,
-    (float)1.15388e-05,
-    (float)3.57168e-05,
-    (float)4.33938e-05,
-    (float)5.17689e-05,
-    (float)0.000309109,
-    (float)0.000157611,
-    (float)6.26164e-06,
-    (float)3.01434e-05,
-    (float)4.24584e-05,
-    (float)6.6223e-05,
-    (float)0.00025509,
-    (float)6.71546e-05,
-    (float)1.65095e-05,
-    (float)2.89147e-05,
-    (float)4.09475e-05,
-    (float)7.86277e-05,
-    (float)0.000190596,
-    (float)1.75752e-05,
-    (float)3.24389e-05,
-    (float)3.12563e-05,
-    (float)3.93032e-05,
-    (float)8.89638e-05,
-    (float)0.000126846,
-    (float)3.60295e-06,
-    (float)4.64432e-05,
-    (float)3.62053e-05,
-    (float)3.82292e-05,
-    (float)9.62038e-05,
-    (float)7.23923e-05,
-    (float)1.50321e-05,
-    (float)5.41871e-05,
-    (float)4.22043e-05,
-    (float)3.83852e-05,
-    (float)9.88637e-05,
-    (float)3.26487e-05,
-    (float)3.90207e-05,
-    (float)5.50265e-05,
-    (float)4.7176e-05,
-    (float)4.06656e-05,
-    (float)9.52056e-05,
-    (float)9.28524e-06,
-    (float)6.42007e-05,
-    (float)5.10207e-05,
-    (float)4.98016e-05,
-    (float)4.53202e-05,
-    (float)8.37346e-05,
-    (float)1.68678e-06,
-    (float)0.0894543,
-    (float)0.422068,
-    (float)0.323385,
-    (float)0.0209508,
-    (float)0.00526993,
-    (float)0.00557951,
-    (float)0.0103975,
-    (float)0.0448696,
-    (float)0.0160938,
-    (float)0.000173175,
-    (float)0.00143318,
-    (float)0.00159002,
-    (float)0.00930879,
-    (float)0.0118971,
-    (float)0.000729219,
-    (float)0.000673339,
-    (float)0.000573304,
-    (float)0.00184892,
-    (float)0.00582327,
-    (float)0.00229774,
-    (float)0.000385698,
-    (float)0.000312946,
-    (float)0.000539379,
-    (float)0.0019745,
-    (float)0.00229549,
-    (float)0.000582949,
-    (float)0.000419865,
-    (float)0.000206872,
-    (float)0.000632055,
-    (float)0.00126022,
-    (float)0.000749614,
-    (float)0.000641444,
-    (float)0.00016999,
-    (float)0.000284753,
-    (float)0.000517746,
-    (float)0.000503313,
-    (float)0.00073222,
-    (float)0.000421745,
-    (float)0.00013768,
-    (float)0.000264997,
-    (float)0.000217239,
-    (float)0.000471223,
-    (float)0.000775979,
-    (float)0.000126761,
-    (float)0.000195335,
-    (float)0.000118593,
-    (float)0.000130512,
-    (float)0.000801288,
-    (float)0.000388001,
-    (float)0.000109773,
-    (float)0.000128806,
-    (float)8.28596e-06,
-    (float)0.000440361,
-    (float)0.000726067,
-    (float)8.38657e-05,
-    (float)0.000146412,
-    (float)2.08336e-05,
-    (float)0.00012054,
-    (float)0.000713006,
-    (float)0.000301459,
-    (float)7.75708e-05,
-    (float)7.30641e-05,
-    (float)1.92265e-05,
-    (float)0.00039787,
-    (float)0.000562959,
-    (float)3.86805e-05,
-    (float)0.000108077,
-    (float)8.30537e-06,
-    (float)0.000153099,
-    (float)0.000533725,
-    (float)0.000191305,
-    (float)4.90854e-05,
-    (float)4.33667e-05,
-    (float)5.31959e-05,
-    (float)0.000314151,
-    (float)0.000357816,
-    (float)6.85741e-06,
-    (float)7.40612e-05,
-    (float)1.01541e-05,
-    (float)0.000155392,
-    (float)0.000330801,
-    (float)9.01326e-05,
-    (float)3.62563e-05,
-    (float)2.16389e-05,
-    (float)7.04491e-05,
-    (float)0.000210949,
-    (float)0.000175369,
-    (float)2.19108e-06,
-    (float)5.14596e-05,
-    (float)1.56182e-05,
-    (float)0.000132424,
-    (float)0.000164922,
-    (float)2.70512e-05,
-    (float)4.80921e-05,
-    (float)1.03093e-05,
-    (float)7.98932e-05,
-    (float)0.000125666,
-    (float)5.78794e-05,
-    (float)2.51751e-05,
-    (float)4.66874e-05,
-    (float)2.83424e-05,
-    (float)0.000111611,
-    (float)6.55e-05,
-    (float)8.01658e-06,
-    (float)7.73502e-05,
-    (float)1.06706e-05,
-    (float)9.46674e-05,
-    (float)7.55842e-05,
-    (float)8.31861e-06,
-    (float)6.05418e-05,
-    (float)5.53311e-05,
-    (float)4.6373e-05,
-    (float)0.000104636,
-    (float)2.25857e-05,
-    (float)1.76785e-05,
-    (float)0.000107252,
-    (float)1.66163e-05,
-    (float)0.000112896,
-    (float)5.16588e-05,
-    (float)2.70907e-07,
-    (float)8.97574e-05,
-    (float)6.34815e-05,
-    (float)6.10726e-05,
-    (float)0.000102384,
-    (float)7.04293e-06,
-    (float)3.52827e-05,
-    (float)0.000120179,
-    (float)1.99978e-05,
-    (float)0.0538182,
-    (float)0.520859,
-    (float)0.269458,
-    (float)0.00749964,
-    (float)0.00622542,
-    (float)0.0042541,
-    (float)0.0294781,
-    (float)0.0422695,
-    (float)0.00188603,
-    (float)0.00142622,
-    (float)0.00151796,
-    (float)0.00648314,
-    (float)0.0154638,
-    (float)0.00176158,
-    (float)0.000588079,
-    (float)0.000667902,
-    (float)0.00199208,
-    (float)0.0067874,
-    (float)0.00173421,
-    (float)0.000409487,
-    (float)0.000342104,
-    (float)0.000762799,
-    (float)0.0030534,
-    (float)0.00149201,
-    (float)0.000476604,
-    (float)0.000229521,
-    (float)0.000373786,
-    (float)0.00133751,
-    (float)0.00109107,
-    (float)0.000636,
-    (float)0.000218403,
-    (float)0.000236033,
-    (float)0.000573923,
-    (float)0.000661415,
-    (float)0.000774201,
-    (float)0.00027032,
-    (float)0.000182319,
-    (float)0.000258142,
-    (float)0.000315367,
-    (float)0.00081445,
-    (float)0.000370134,
-    (float)0.000156693,
-    (float)0.000137759,
-    (float)0.000104869,
-    (float)0.000736719,
-    (float)0.000497807,
-    (float)0.000134852,
-    (float)9.6085e-05,
-    (float)1.75983e-05,
-    (float)0.000574771,
-    (float)0.000619125,
-    (float)0.000110684,
-    (float)8.50303e-05,
-    (float)3.71958e-06,
-    (float)0.000389037,
-    (float)0.000693493,
-    (float)9.35208e-05,
-    (float)8.37364e-05,
-    (float)1.31162e-05,
-    (float)0.000233418,
-    (float)0.00069204,
-    (float)9.70173e-05,
-    (float)7.93881e-05,
-    (float)1.87735e-05,
-    (float)0.000133884,
-    (float)0.000613248,
-    (float)0.000124621,
-    (float)6.45529e-05,
-    (float)1.66726e-05,
-    (float)8.64853e-05,
-    (float)0.000483668,
-    (float)0.000163748,
-    (float)4.05431e-05,
-    (float)1.25114e-05,
-    (float)7.04734e-05,
-    (float)0.00034287,
-    (float)0.00019291,
-    (float)1.66972e-05,
-    (float)1.0585e-05,
-    (float)6.51523e-05,
-    (float)0.000223972,
-    (float)0.00019549,
-    (float)3.0419e-06,
-    (float)1.1307e-05,
-    (float)5.97598e-05,
-    (float)0.000142348,
-    (float)0.000169721,
-    (float)2.31169e-06,
-    (float)1.43853e-05,
-    (float)5.27454e-05,
-    (float)9.67002e-05,
-    (float)0.000127899,
-    (float)8.53792e-06,
-    (float)2.1559e-05,
-    (float)4.54972e-05,
-    (float)7.76351e-05,
-    (float)8.65338e-05,
-    (float)1.28922e-05,
-    (float)3.53481e-05,
-    (float)3.83327e-05,
-    (float)7.57233e-05,
-    (float)5.61951e-05,
-    (float)1.08766e-05,
-    (float)5.51675e-05,
-    (float)3.149e-05,
-    (float)8.41685e-05,
-    (float)3.85817e-05,
-    (float)4.81203e-06,
-    (float)7.52309e-05,
-    (float)2.76057e-05,
-    (float)9.68531e-05,
-    (float)3.07815e-05,
-    (float)4.12481e-07,
-    (float)8.71551e-05,
-    (float)3.13502e-05,
-    (float)0.000106312,
-    (float)3.07282e-05,
-    (float)1.02693e-06,
-    (float)8.55975e-05,
-    (float)4.57335e-05,
-    (float)0.000105321,
-    (float)3.85662e-05,
-    (float)4.73921e-06,
-    (float)7.2091e-05,
-    (float)6.83307e-05,
-    (float)9.12012e-05,
-    (float)5.37949e-05,
-    (float)6.79391e-06,
-    (float)0.0255381,
-    (float)0.611316,
-    (float)0.206654,
-    (float)0.00357418,
-    (float)0.00767375,
-    (float)0.00474856,
-    (float)0.0525382,
-    (float)0.0215663,
-    (float)0.000334549,
-    (float)0.00182523,
-    (float)0.00259924,
-    (float)0.0173699,
-    (float)0.00538408,
-    (float)0.000428347,
-    (float)0.000691809,
-    (float)0.00174681,
-    (float)0.00753247,
-    (float)0.00186316,
-    (float)0.000466566,
-    (float)0.000341405,
-    (float)0.00120074,
-    (float)0.00352083,
-    (float)0.000977954,
-    (float)0.000433646,
-    (float)0.000225574,
-    (float)0.000796694,
-    (float)0.00167043,
-    (float)0.000810372,
-    (float)0.000381157,
-    (float)0.000178675,
-    (float)0.000503712,
-    (float)0.00079743,
-    (float)0.000839095,
-    (float)0.000318438,
-    (float)0.00015445,
-    (float)0.000293008,
-    (float)0.000417953,
-    (float)0.000888991,
-    (float)0.000250021,
-    (float)0.000138604,
-    (float)0.000142879,
-    (float)0.000307812,
-    (float)0.000891083,
-    (float)0.000186778,
-    (float)0.00011976,
-    (float)4.86382e-05,
-    (float)0.00033615,
-    (float)0.000827314,
-    (float)0.000133849,
-    (float)9.48621e-05,
-    (float)6.58982e-06,
-    (float)0.000412014,
-    (float)0.000707013,
-    (float)9.10482e-05,
-    (float)6.89758e-05,
-    (float)4.26643e-06,
-    (float)0.000475895,
-    (float)0.000552063,
-    (float)5.92601e-05,
-    (float)4.65112e-05,
-    (float)2.62211e-05,
-    (float)0.000496919,
-    (float)0.000390644,
-    (float)3.81971e-05,
-    (float)2.9972e-05,
-    (float)5.80981e-05,
-    (float)0.00046911,
-    (float)0.000247894,
-    (float)2.4916e-05,
-    (float)2.15376e-05,
-    (float)8.77661e-05,
-    (float)0.000403379,
-    (float)0.000137186,
-    (float)1.71369e-05,
-    (float)2.12619e-05,
-    (float)0.000107789,
-    (float)0.000315791,
-    (float)6.16949e-05,
-    (float)1.39846e-05,
-    (float)2.70673e-05,
-    (float)0.000115215,
-    (float)0.000221445,
-    (float)1.96849e-05,
-    (float)1.46658e-05,
-    (float)3.65718e-05,
-    (float)0.000109471,
-    (float)0.000134564,
-    (float)5.78984e-06,
-    (float)1.88243e-05,
-    (float)4.70007e-05,
-    (float)9.26071e-05,
-    (float)6.68475e-05,
-    (float)1.15332e-05,
-    (float)2.65042e-05,
-    (float)5.52348e-05,
-    (float)6.95405e-05,
-    (float)2.40319e-05,
-    (float)2.77587e-05,
-    (float)3.70367e-05,
-    (float)5.93135e-05,
-    (float)4.57158e-05,
-    (float)5.5782e-06,
-    (float)4.67467e-05,
-    (float)4.92273e-05,
-    (float)5.86757e-05,
-    (float)2.52795e-05,
-    (float)6.71751e-06,
-    (float)6.3427e-05,
-    (float)6.17726e-05,
-    (float)5.34007e-05,
-    (float)1.10136e-05,
-    (float)2.05369e-05,
-    (float)7.57868e-05,
-    (float)7.26913e-05,
-    (float)4.42874e-05,
-    (float)4.16622e-06,
-    (float)3.99804e-05,
-    (float)8.37681e-05,
-    (float)7.95041e-05,
-    (float)3.28611e-05,
-    (float)4.45589e-06,
-    (float)5.90657e-05,
-    (float)8.79623e-05,
-    (float)8.0127e-05,
-    (float)2.09395e-05,
-    (float)1.06814e-05,
-    (float)7.32644e-05,
-    (float)8.92052e-05,
-    (float)0.00694754,
-    (float)0.686149,
-    (float)0.143965,
-    (float)0.00413024,
-    (float)0.0079166,
-    (float)0.0159963,
-    (float)0.0597222,
-    (float)0.00425945,
-    (float)0.00182543,
-    (float)0.00136234,
-    (float)0.0127131,
-    (float)0.0134515,
-    (float)0.000150051,
-    (float)0.00079513,
-    (float)0.00111605,
-    (float)0.00807195,
-    (float)0.00271114,
-    (float)0.000511241,
-    (float)0.000328164,
-    (float)0.00153916,
-    (float)0.00384013,
-    (float)0.000825779,
-    (float)0.000349709,
-    (float)0.000265752,
-    (float)0.00144346,
-    (float)0.00155584,
-    (float)0.000728707,
-    (float)0.000152952,
-    (float)0.000290461,
-    (float)0.000918809,
-    (float)0.000982584,
-    (float)0.000523041,
-    (float)0.000117918,
-    (float)0.000268013,
-    (float)0.000504164,
-    (float)0.00102061,
-    (float)0.000218454,
-    (float)0.000131299,
-    (float)0.000147539,
-    (float)0.000559665,
-    (float)0.000853374,
-    (float)8.90319e-05,
-    (float)0.000101071,
-    (float)4.84252e-05,
-    (float)0.000876328,
-    (float)0.00044033,
-    (float)9.65165e-05,
-    (float)4.12257e-05,
-    (float)0.00016452,
-    (float)0.000964733,
-    (float)0.000124367,
-    (float)8.74871e-05,
-    (float)5.11782e-06,
-    (float)0.000481496,
-    (float)0.000657657,
-    (float)4.48126e-05,
-    (float)4.35975e-05,
-    (float)4.92427e-05,
-    (float)0.000715466,
-    (float)0.000242031,
-    (float)6.15723e-05,
-    (float)2.3446e-05,
-    (float)0.000195678,
-    (float)0.000632134,
-    (float)2.83179e-05,
-    (float)4.53507e-05,
-    (float)4.78418e-05,
-    (float)0.000356046,
-    (float)0.000330543,
-    (float)1.20831e-05,
-    (float)2.1116e-05,
-    (float)9.47107e-05,
-    (float)0.000392683,
-    (float)7.96821e-05,
-    (float)3.16603e-05,
-    (float)3.4424e-05,
-    (float)0.000143957,
-    (float)0.000269398,
-    (float)5.70668e-06,
-    (float)2.11739e-05,
-    (float)6.4012e-05,
-    (float)0.000165027,
-    (float)0.000104362,
-    (float)2.71107e-05,
-    (float)1.96269e-05,
-    (float)7.3286e-05,
-    (float)0.000127978,
-    (float)3.20515e-05,
-    (float)3.47014e-05,
-    (float)4.31959e-05,
-    (float)6.00521e-05,
-    (float)5.84716e-05,
-    (float)5.34074e-05,
-    (float)2.39128e-05,
-    (float)5.3729e-05,
-    (float)3.77213e-05,
-    (float)2.84065e-05,
-    (float)7.66564e-05,
-    (float)3.21162e-05,
-    (float)3.48073e-05,
-    (float)1.20598e-05,
-    (float)6.86934e-05,
-    (float)5.83066e-05,
-    (float)4.81799e-05,
-    (float)1.20692e-05,
-    (float)4.62801e-06,
-    (float)0.000121849,
-    (float)3.74395e-05,
-    (float)3.77141e-05,
-    (float)4.54697e-06,
-    (float)4.45696e-05,
-    (float)0.000121311,
-    (float)4.08604e-05,
-    (float)1.25272e-05,
-    (float)6.14866e-06,
-    (float)0.0001182,
-    (float)7.57502e-05,
-    (float)4.19004e-05,
-    (float)7.78606e-06,
-    (float)2.23873e-05,
-    (float)0.000162525,
-    (float)3.96522e-05,
-    (float)2.17444e-05,
-    (float)2.1765e-05,
-    (float)7.15316e-05,
-    (float)0.000136699,
-    (float)3.04305e-05,
-    (float)7.0676e-06,
-    (float)7.1737e-05,
-    (float)0.739698,
-    (float)0.0894811,
-    (float)0.00584783,
-    (float)0.00562524,
-    (float)0.0411789,
-    (float)0.0432532,
-    (float)4.05224e-05,
-    (float)0.00225511,
-    (float)0.00366866,
-    (float)0.0218944,
-    (float)0.00185918,
-    (float)0.000902754,
-    (float)0.000598821,
-    (float)0.00757178,
-    (float)0.00461928,
-    (float)0.000446714,
-    (float)0.000358838,
-    (float)0.00163841,
-    (float)0.0043361,
-    (float)0.0007373,
-    (float)0.000296259,
-    (float)0.000302125,
-    (float)0.00217904,
-    (float)0.00134088,
-    (float)0.000476538,
-    (float)0.000129703,
-    (float)0.000667633,
-    (float)0.00122001,
-    (float)0.000882447,
-    (float)0.000128634,
-    (float)0.000178712,
-    (float)0.000588434,
-    (float)0.00109608,
-    (float)0.000329325,
-    (float)9.23829e-05,
-    (float)0.000202521,
-    (float)0.000714566,
-    (float)0.00080161,
-    (float)7.83487e-05,
-    (float)9.89098e-05,
-    (float)0.000184794,
-    (float)0.00110966,
-    (float)0.000165437,
-    (float)8.19966e-05,
-    (float)1.89325e-05,
-    (float)0.000788506,
-    (float)0.000543076,
-    (float)6.87847e-05,
-    (float)4.8198e-05,
-    (float)0.000231311,
-    (float)0.000948275,
-    (float)5.63343e-05,
-    (float)6.43609e-05,
-    (float)1.20788e-05,
-    (float)0.000836716,
-    (float)0.000251286,
-    (float)6.18014e-05,
-    (float)3.09811e-05,
-    (float)0.000358695,
-    (float)0.000610531,
-    (float)1.65149e-05,
-    (float)4.37347e-05,
-    (float)7.27977e-05,
-    (float)0.000677883,
-    (float)6.13617e-05,
-    (float)4.5329e-05,
-    (float)3.63772e-05,
-    (float)0.000377595,
-    (float)0.000282217,
-    (float)2.01124e-05,
-    (float)3.2313e-05,
-    (float)0.000113052,
-    (float)0.000411127,
-    (float)7.34906e-06,
-    (float)2.82509e-05,
-    (float)4.28438e-05,
-    (float)0.00028363,
-    (float)9.53009e-05,
-    (float)3.21228e-05,
-    (float)2.99239e-05,
-    (float)0.000106628,
-    (float)0.000183523,
-    (float)3.47048e-05,
-    (float)1.95385e-05,
-    (float)3.95866e-05,
-    (float)0.000151811,
-    (float)5.77197e-05,
-    (float)3.51913e-05,
-    (float)2.9938e-05,
-    (float)6.96442e-05,
-    (float)7.20278e-05,
-    (float)7.66822e-05,
-    (float)2.12811e-05,
-    (float)2.82633e-05,
-    (float)5.19135e-05,
-    (float)0.000105677,
-    (float)3.03522e-05,
-    (float)2.62052e-05,
-    (float)2.93537e-05,
-    (float)7.29181e-05,
-    (float)9.25855e-05,
-    (float)2.73341e-05,
-    (float)1.78821e-05,
-    (float)1.60395e-05,
-    (float)0.000162568,
-    (float)2.50133e-05,
-    (float)1.93402e-05,
-    (float)5.14109e-06,
-    (float)0.000135102,
-    (float)7.65466e-05,
-    (float)2.92931e-05,
-    (float)1.50576e-05,
-    (float)3.96911e-05,
-    (float)0.000179165,
-    (float)2.27289e-05,
-    (float)1.53302e-05,
-    (float)2.52122e-06,
-    (float)0.000196798,
-    (float)4.54394e-05,
-    (float)2.46646e-05,
-    (float)1.80142e-05,
-    (float)9.42785e-05,
-    (float)0.000149448,
-    (float)2.13124e-05,
-    (float)1.78682e-05,
-    (float)1.77492e-05,
-    (float)0.000220541,
-    (float)0.00640961,
-    (float)0.768006,
-    (float)0.0514584,
-    (float)0.00840719,
-    (float)0.00272973,
-    (float)0.0677421,
-    (float)0.0190329,
-    (float)0.00168731,
-    (float)0.00141544,
-    (float)0.0160317,
-    (float)0.0126644,
-    (float)0.000488188,
-    (float)0.000702729,
-    (float)0.00446384,
-    (float)0.00832863,
-    (float)0.000446363,
-    (float)0.00037389,
-    (float)0.00132327,
-    (float)0.00486088,
-    (float)0.000852467,
-    (float)0.000288626,
-    (float)0.000457387,
-    (float)0.00242048,
-    (float)0.0012082,
-    (float)0.000345847,
-    (float)0.000197557,
-    (float)0.00102981,
-    (float)0.00120916,
-    (float)0.000530548,
-    (float)0.000102454,
-    (float)0.000397272,
-    (float)0.000880359,
-    (float)0.00079957,
-    (float)5.98772e-05,
-    (float)0.000169238,
-    (float)0.000457984,
-    (float)0.00102851,
-    (float)5.30141e-05,
-    (float)0.000107219,
-    (float)0.000155174,
-    (float)0.00108089,
-    (float)0.000110949,
-    (float)0.000101036,
-    (float)2.50744e-05,
-    (float)0.000918447,
-    (float)0.000261921,
-    (float)0.000100697,
-    (float)5.87497e-08,
-    (float)0.00063556,
-    (float)0.000471158,
-    (float)7.65854e-05,
-    (float)7.40055e-06,
-    (float)0.000370431,
-    (float)0.000640686,
-    (float)3.25676e-05,
-    (float)2.2125e-05,
-    (float)0.000202961,
-    (float)0.000682549,
-    (float)7.77995e-06,
-    (float)4.33201e-05,
-    (float)0.000123028,
-    (float)0.000587581,
-    (float)3.6375e-05,
-    (float)6.11277e-05,
-    (float)8.1205e-05,
-    (float)0.000425286,
-    (float)0.000106556,
-    (float)6.05984e-05,
-    (float)4.75224e-05,
-    (float)0.000276837,
-    (float)0.000168567,
-    (float)4.28083e-05,
-    (float)2.22143e-05,
-    (float)0.000180248,
-    (float)0.00018237,
-    (float)2.61569e-05,
-    (float)1.3104e-05,
-    (float)0.000125937,
-    (float)0.000149124,
-    (float)2.41507e-05,
-    (float)1.87421e-05,
-    (float)8.99165e-05,
-    (float)9.99392e-05,
-    (float)3.11925e-05,
-    (float)3.31633e-05,
-    (float)5.98855e-05,
-    (float)6.19877e-05,
-    (float)3.27749e-05,
-    (float)5.31954e-05,
-    (float)3.51327e-05,
-    (float)4.23235e-05,
-    (float)2.38569e-05,
-    (float)7.61137e-05,
-    (float)1.7797e-05,
-    (float)3.50673e-05,
-    (float)1.21425e-05,
-    (float)9.40711e-05,
-    (float)1.02104e-05,
-    (float)3.41225e-05,
-    (float)5.723e-06,
-    (float)9.77476e-05,
-    (float)1.66814e-05,
-    (float)3.59214e-05,
-    (float)3.9889e-06,
-    (float)8.65357e-05,
-    (float)3.94968e-05,
-    (float)3.56255e-05,
-    (float)2.17882e-06,
-    (float)7.06161e-05,
-    (float)7.21815e-05,
-    (float)2.85653e-05,
-    (float)7.35165e-08,
-    (float)6.15426e-05,
-    (float)0.000100432,
-    (float)1.6231e-05,
-    (float)2.74567e-06,
-    (float)6.05844e-05,
-    (float)0.00011229,
-    (float)7.5973e-06,
-    (float)1.29888e-05,
-    (float)5.87281e-05,
-    (float)0.000108452,
-    (float)1.16561e-05,
-    (float)2.57427e-05,
-    (float)4.74597e-05,
-    (float)0.00010072,
-    (float)2.82057e-05,
-    (float)3.15498e-05,
-    (float)0.0272914,
-    (float)0.767885,
-    (float)0.0274151,
-    (float)0.0111501,
-    (float)0.00594946,
-    (float)0.0797559,
-    (float)0.00328119,
-    (float)0.00268018,
-    (float)0.00228469,
-    (float)0.026206,
-    (float)0.00137356,
-    (float)0.00110166,
-    (float)0.00117694,
-    (float)0.0115005,
-    (float)0.00105613,
-    (float)0.000548941,
-    (float)0.000664794,
-    (float)0.00561188,
-    (float)0.00104558,
-    (float)0.000330257,
-    (float)0.00038889,
-    (float)0.00284823,
-    (float)0.0010936,
-    (float)0.000243731,
-    (float)0.000234899,
-    (float)0.00143915,
-    (float)0.00113764,
-    (float)0.000206416,
-    (float)0.000151991,
-    (float)0.000698703,
-    (float)0.00114505,
-    (float)0.000189291,
-    (float)0.00010993,
-    (float)0.000307767,
-    (float)0.00111664,
-    (float)0.000180494,
-    (float)8.72908e-05,
-    (float)0.000113144,
-    (float)0.00105893,
-    (float)0.000174561,
-    (float)7.47207e-05,
-    (float)2.92723e-05,
-    (float)0.00098245,
-    (float)0.000167149,
-    (float)6.78754e-05,
-    (float)4.89682e-06,
-    (float)0.000891811,
-    (float)0.000154984,
-    (float)6.31709e-05,
-    (float)9.80413e-06,
-    (float)0.000787598,
-    (float)0.000138996,
-    (float)5.82473e-05,
-    (float)2.6611e-05,
-    (float)0.000674592,
-    (float)0.000120257,
-    (float)5.18486e-05,
-    (float)4.51469e-05,
-    (float)0.000557834,
-    (float)0.000100341,
-    (float)4.47703e-05,
-    (float)5.96818e-05,
-    (float)0.00044432,
-    (float)8.05811e-05,
-    (float)3.81961e-05,
-    (float)6.83287e-05,
-    (float)0.000338551,
-    (float)6.25115e-05,
-    (float)3.26516e-05,
-    (float)7.12315e-05,
-    (float)0.00024443,
-    (float)4.80795e-05,
-    (float)2.89192e-05,
-    (float)6.98144e-05,
-    (float)0.000165751,
-    (float)3.80619e-05,
-    (float)2.7622e-05,
-    (float)6.53039e-05,
-    (float)0.00010415,
-    (float)3.25834e-05,
-    (float)2.89003e-05,
-    (float)5.92382e-05,
-    (float)5.95342e-05,
-    (float)3.06961e-05,
-    (float)3.23278e-05,
-    (float)5.31514e-05,
-    (float)2.96454e-05,
-    (float)3.12781e-05,
-    (float)3.70112e-05,
-    (float)4.76776e-05,
-    (float)1.17243e-05,
-    (float)3.31553e-05,
-    (float)4.22882e-05,
-    (float)4.299e-05,
-    (float)2.98192e-06,
-    (float)3.54878e-05,
-    (float)4.75381e-05,
-    (float)3.88847e-05,
-    (float)6.78554e-07,
-    (float)3.78646e-05,
-    (float)5.19017e-05,
-    (float)3.52387e-05,
-    (float)2.49193e-06,
-    (float)3.99697e-05,
-    (float)5.47873e-05,
-    (float)3.20191e-05,
-    (float)6.72515e-06,
-    (float)4.17699e-05,
-    (float)5.57847e-05,
-    (float)2.89806e-05,
-    (float)1.22738e-05,
-    (float)4.31462e-05,
-    (float)5.4923e-05,
-    (float)2.61133e-05,
-    (float)1.84315e-05,
-    (float)4.42173e-05,
-    (float)5.2397e-05,
-    (float)2.36163e-05,
-    (float)2.47928e-05,
-    (float)4.50237e-05,
-    (float)4.83391e-05,
-    (float)2.17626e-05,
-    (float)3.10921e-05,
-    (float)4.55402e-05,
-    (float)4.31747e-05,
-    (float)2.08208e-05,
-    (float)3.72924e-05,
-    (float)4.57539e-05,
-    (float)0.0629694,
-    (float)0.738812,
-    (float)0.0155077,
-    (float)0.0139692,
-    (float)0.0229819,
-    (float)0.0671684,
-    (float)7.74512e-05,
-    (float)0.002572,
-    (float)0.0132769,
-    (float)0.0171462,
-    (float)0.000489756,
-    (float)0.000680987,
-    (float)0.00861764,
-    (float)0.00528117,
-    (float)0.000606042,
-    (float)0.000302899,
-    (float)0.00535183,
-    (float)0.0019658,
-    (float)0.000429367,
-    (float)0.000283461,
-    (float)0.00308406,
-    (float)0.00118128,
-    (float)0.000237043,
-    (float)0.000301021,
-    (float)0.00168396,
-    (float)0.00105215,
-    (float)0.000113026,
-    (float)0.00027989,
-    (float)0.000964571,
-    (float)0.000962262,
-    (float)6.38373e-05,
-    (float)0.000207395,
-    (float)0.000730176,
-    (float)0.000766115,
-    (float)6.35209e-05,
-    (float)0.000111886,
-    (float)0.00075989,
-    (float)0.000516012,
-    (float)7.24875e-05,
-    (float)3.52596e-05,
-    (float)0.000868045,
-    (float)0.000285551,
-    (float)7.09053e-05,
-    (float)7.37817e-06,
-    (float)0.000921384,
-    (float)0.000122682,
-    (float)5.87589e-05,
-    (float)3.71685e-05,
-    (float)0.000860034,
-    (float)3.94106e-05,
-    (float)4.23979e-05,
-    (float)0.000113257,
-    (float)0.000690843,
-    (float)1.64994e-05,
-    (float)3.14589e-05,
-    (float)0.000205152,
-    (float)0.000468714,
-    (float)2.1617e-05,
-    (float)3.13711e-05,
-    (float)0.000278634,
-    (float)0.000257848,
-    (float)3.03539e-05,
-    (float)3.91757e-05,
-    (float)0.000307164,
-    (float)0.00010425,
-    (float)3.22856e-05,
-    (float)4.91163e-05,
-    (float)0.000280169,
-    (float)2.57684e-05,
-    (float)2.90402e-05,
-    (float)5.56905e-05,
-    (float)0.000211043,
-    (float)8.54167e-06,
-    (float)2.73117e-05,
-    (float)5.53041e-05,
-    (float)0.000127781,
-    (float)2.29918e-05,
-    (float)2.9495e-05,
-    (float)4.84711e-05,
-    (float)5.93171e-05,
-    (float)4.15422e-05,
-    (float)3.24866e-05,
-    (float)3.76022e-05,
-    (float)2.35038e-05,
-    (float)4.94838e-05,
-    (float)3.17445e-05,
-    (float)2.46616e-05,
-    (float)2.20627e-05,
-    (float)4.59173e-05,
-    (float)2.48033e-05,
-    (float)1.22721e-05,
-    (float)4.25388e-05,
-    (float)3.72228e-05,
-    (float)1.42096e-05,
-    (float)3.30828e-06,
-    (float)6.68986e-05,
-    (float)2.89935e-05,
-    (float)5.72529e-06,
-    (float)5.31787e-07,
-    (float)8.04555e-05,
-    (float)2.28501e-05,
-    (float)3.76207e-06,
-    (float)6.17272e-06,
-    (float)7.72026e-05,
-    (float)1.7394e-05,
-    (float)8.86986e-06,
-    (float)1.97954e-05,
-    (float)6.09239e-05,
-    (float)1.10332e-05,
-    (float)1.76434e-05,
-    (float)3.76974e-05,
-    (float)3.9864e-05,
-    (float)5.07955e-06,
-    (float)2.49627e-05,
-    (float)5.35058e-05,
-    (float)2.18513e-05,
-    (float)3.40449e-06,
-    (float)2.78787e-05,
-    (float)6.06544e-05,
-    (float)1.09149e-05,
-    (float)9.53471e-06,
-    (float)2.6981e-05,
-    (float)5.60187e-05,
-    (float)6.25048e-06,
-    (float)2.37907e-05,
-    (float)2.50967e-05,
-    (float)4.16788e-05,
-    (float)5.12252e-06,
-    (float)0.113347,
-    (float)0.68403,
-    (float)0.0109565,
-    (float)0.0145519,
-    (float)0.0540674,
-    (float)0.0399451,
-    (float)0.00165342,
-    (float)0.000971979,
-    (float)0.0289545,
-    (float)0.00345795,
-    (float)0.00128267,
-    (float)0.0017071,
-    (float)0.0129729,
-    (float)0.000405608,
-    (float)0.000404553,
-    (float)0.00323151,
-    (float)0.00431472,
-    (float)0.000553343,
-    (float)0.000175529,
-    (float)0.00303111,
-    (float)0.00153065,
-    (float)0.0002771,
-    (float)0.000319963,
-    (float)0.00189042,
-    (float)0.00106386,
-    (float)6.447e-05,
-    (float)0.00043685,
-    (float)0.00120195,
-    (float)0.000686983,
-    (float)8.10596e-05,
-    (float)0.000336485,
-    (float)0.00121501,
-    (float)0.00021786,
-    (float)0.000117609,
-    (float)0.000239965,
-    (float)0.00119006,
-    (float)3.73728e-05,
-    (float)7.5959e-05,
-    (float)0.000456719,
-    (float)0.000736224,
-    (float)7.24342e-05,
-    (float)1.13647e-05,
-    (float)0.000844995,
-    (float)0.000216633,
-    (float)8.43976e-05,
-    (float)3.2024e-05,
-    (float)0.000944477,
-    (float)1.4374e-05,
-    (float)3.77522e-05,
-    (float)0.000223704,
-    (float)0.000605027,
-    (float)4.67011e-05,
-    (float)1.36786e-05,
-    (float)0.00048096,
-    (float)0.000180649,
-    (float)6.466e-05,
-    (float)4.41515e-05,
-    (float)0.000557207,
-    (float)4.4507e-06,
-    (float)2.98784e-05,
-    (float)0.000124473,
-    (float)0.000364343,
-    (float)3.07568e-05,
-    (float)2.16632e-05,
-    (float)0.000216578,
-    (float)0.000112966,
-    (float)5.17739e-05,
-    (float)4.74723e-05,
-    (float)0.00023161,
-    (float)2.2439e-05,
-    (float)2.37747e-05,
-    (float)6.7407e-05,
-    (float)0.000140953,
-    (float)5.47298e-05,
-    (float)1.64435e-05,
-    (float)7.2539e-05,
-    (float)4.93551e-05,
-    (float)6.13205e-05,
-    (float)3.24286e-05,
-    (float)5.80539e-05,
-    (float)5.36197e-05,
-    (float)2.36513e-05,
-    (float)3.19092e-05,
-    (float)2.447e-05,
-    (float)9.7705e-05,
-    (float)9.48804e-06,
-    (float)1.77847e-05,
-    (float)1.82923e-05,
-    (float)8.24596e-05,
-    (float)1.99113e-05,
-    (float)7.52585e-06,
-    (float)6.95002e-05,
-    (float)2.60159e-05,
-    (float)1.70661e-05,
-    (float)3.05497e-07,
-    (float)0.000116395,
-    (float)3.53398e-06,
-    (float)7.3487e-06,
-    (float)1.31703e-05,
-    (float)8.91446e-05,
-    (float)1.51083e-05,
-    (float)8.64923e-06,
-    (float)6.07337e-05,
-    (float)2.42026e-05,
-    (float)1.68667e-05,
-    (float)1.08759e-05,
-    (float)9.85321e-05,
-    (float)3.96757e-07,
-    (float)1.04859e-05,
-    (float)1.57374e-05,
-    (float)7.37493e-05,
-    (float)1.75025e-05,
-    (float)1.53263e-05,
-    (float)4.16626e-05,
-    (float)1.76267e-05,
-    (float)2.47657e-05,
-    (float)2.014e-05,
-    (float)6.6583e-05,
-    (float)2.58e-06,
-    (float)1.63376e-05,
-    (float)1.73652e-05,
-    (float)4.91209e-05,
-    (float)2.86783e-05,
-    (float)1.74238e-05,
-    (float)2.58206e-05,
-    (float)9.38467e-06,
-    (float)4.0555e-05,
-    (float)2.24364e-05,
-    (float)0.178721,
-    (float)0.609054,
-    (float)0.00977861,
-    (float)0.0118886,
-    (float)0.0900708,
-    (float)0.0150208,
-    (float)0.00324511,
-    (float)0.00333169,
-    (float)0.0295466,
-    (float)0.000104367,
-    (float)0.000934463,
-    (float)0.0107457,
-    (float)0.00419559,
-    (float)0.000693275,
-    (float)0.000660741,
-    (float)0.00737817,
-    (float)0.00058164,
-    (float)0.000217242,
-    (float)0.00238167,
-    (float)0.00224878,
-    (float)0.000391161,
-    (float)0.000194466,
-    (float)0.00217093,
-    (float)0.00104942,
-    (float)7.94453e-05,
-    (float)0.000559354,
-    (float)0.00139512,
-    (float)0.00042848,
-    (float)9.14581e-05,
-    (float)0.000554829,
-    (float)0.00125936,
-    (float)5.61929e-05,
-    (float)0.000142906,
-    (float)0.00082739,
-    (float)0.000522744,
-    (float)7.56571e-05,
-    (float)8.37462e-05,
-    (float)0.00121753,
-    (float)4.87099e-05,
-    (float)6.32717e-05,
-    (float)0.000457922,
-    (float)0.000587115,
-    (float)6.92133e-05,
-    (float)7.44133e-07,
-    (float)0.000998609,
-    (float)3.84816e-05,
-    (float)4.92186e-05,
-    (float)0.000233619,
-    (float)0.00057597,
-    (float)5.31816e-05,
-    (float)1.24263e-05,
-    (float)0.000698617,
-    (float)3.85552e-05,
-    (float)4.12901e-05,
-    (float)0.000114837,
-    (float)0.000488563,
-    (float)3.34481e-05,
-    (float)2.54394e-05,
-    (float)0.000419078,
-    (float)4.77293e-05,
-    (float)3.33077e-05,
-    (float)6.16638e-05,
-    (float)0.000347425,
-    (float)2.67453e-05,
-    (float)2.43924e-05,
-    (float)0.000213288,
-    (float)5.62031e-05,
-    (float)2.88229e-05,
-    (float)3.84445e-05,
-    (float)0.000201605,
-    (float)4.17648e-05,
-    (float)1.78498e-05,
-    (float)9.3141e-05,
-    (float)5.5293e-05,
-    (float)3.19716e-05,
-    (float)2.66597e-05,
-    (float)9.10022e-05,
-    (float)7.29938e-05,
-    (float)1.21344e-05,
-    (float)3.69419e-05,
-    (float)4.38643e-05,
-    (float)4.32661e-05,
-    (float)2.10691e-05,
-    (float)3.02214e-05,
-    (float)0.000102905,
-    (float)8.28803e-06,
-    (float)1.67556e-05,
-    (float)2.7883e-05,
-    (float)5.97196e-05,
-    (float)1.98671e-05,
-    (float)9.94103e-06,
-    (float)0.00011634,
-    (float)4.67873e-06,
-    (float)1.17815e-05,
-    (float)1.47384e-05,
-    (float)7.36135e-05,
-    (float)2.09358e-05,
-    (float)1.01937e-05,
-    (float)0.000108095,
-    (float)1.71951e-06,
-    (float)1.14548e-05,
-    (float)7.90004e-06,
-    (float)7.91045e-05,
-    (float)2.23222e-05,
-    (float)1.46748e-05,
-    (float)8.61809e-05,
-    (float)5.37615e-07,
-    (float)1.25167e-05,
-    (float)6.59432e-06,
-    (float)7.42741e-05,
-    (float)2.42729e-05,
-    (float)1.61542e-05,
-    (float)6.10846e-05,
-    (float)1.41552e-06,
-    (float)1.47238e-05,
-    (float)7.87449e-06,
-    (float)6.24675e-05,
-    (float)2.84599e-05,
-    (float)1.46889e-05,
-    (float)4.0684e-05,
-    (float)3.08209e-06,
-    (float)1.90703e-05,
-    (float)9.89088e-06,
-    (float)4.8503e-05,
-    (float)3.65311e-05,
-    (float)1.21978e-05,
-    (float)2.70234e-05,
-    (float)3.88033e-06,
-    (float)0.257167,
-    (float)0.524056,
-    (float)0.00846919,
-    (float)0.00573769,
-    (float)0.114399,
-    (float)0.00313771,
-    (float)0.00456119,
-    (float)0.0180431,
-    (float)0.0139056,
-    (float)0.0012542,
-    (float)0.000855914,
-    (float)0.0155244,
-    (float)0.000311749,
-    (float)0.000395176,
-    (float)0.00629657,
-    (float)0.00207325,
-    (float)0.00041006,
-    (float)0.000984297,
-    (float)0.00367955,
-    (float)0.000587849,
-    (float)0.000115571,
-    (float)0.00216922,
-    (float)0.00121161,
-    (float)8.21778e-05,
-    (float)0.000580081,
-    (float)0.00144147,
-    (float)0.000374536,
-    (float)0.000139813,
-    (float)0.000685512,
-    (float)0.00109028,
-    (float)5.14961e-05,
-    (float)0.000170194,
-    (float)0.00124078,
-    (float)0.000111017,
-    (float)9.49965e-05,
-    (float)0.000470877,
-    (float)0.000690747,
-    (float)8.92479e-05,
-    (float)2.53313e-05,
-    (float)0.00113083,
-    (float)2.32137e-05,
-    (float)2.87981e-05,
-    (float)0.000613176,
-    (float)0.000273307,
-    (float)8.31922e-05,
-    (float)9.09173e-05,
-    (float)0.000778385,
-    (float)4.22618e-05,
-    (float)1.05482e-05,
-    (float)0.000636681,
-    (float)4.45275e-05,
-    (float)4.06939e-05,
-    (float)0.000195296,
-    (float)0.00036823,
-    (float)5.93402e-05,
-    (float)4.14963e-05,
-    (float)0.000464405,
-    (float)1.48639e-06,
-    (float)1.4056e-05,
-    (float)0.0002183,
-    (float)0.00010467,
-    (float)4.18197e-05,
-    (float)7.35177e-05,
-    (float)0.0002289,
-    (float)3.03258e-05,
-    (float)1.86698e-05,
-    (float)0.000151773,
-    (float)2.55514e-05,
-    (float)1.42782e-05,
-    (float)6.9715e-05,
-    (float)6.93386e-05,
-    (float)4.45927e-05,
-    (float)3.28272e-05,
-    (float)6.12813e-05,
-    (float)4.72354e-05,
-    (float)5.28516e-06,
-    (float)3.71304e-05,
-    (float)2.62404e-05,
-    (float)2.76537e-05,
-    (float)3.31527e-05,
-    (float)8.90229e-06,
-    (float)7.0421e-05,
-    (float)1.59351e-05,
-    (float)7.10144e-06,
-    (float)5.08065e-05,
-    (float)7.92862e-06,
-    (float)1.83329e-05,
-    (float)8.81131e-06,
-    (float)5.6621e-05,
-    (float)2.72467e-05,
-    (float)1.55702e-06,
-    (float)7.35779e-05,
-    (float)6.66189e-06,
-    (float)4.84003e-06,
-    (float)3.22282e-05,
-    (float)2.35315e-05,
-    (float)2.50974e-05,
-    (float)1.5399e-05,
-    (float)6.23455e-05,
-    (float)1.91929e-05,
-    (float)5.52423e-06,
-    (float)4.52562e-05,
-    (float)3.91947e-06,
-    (float)1.36259e-05,
-    (float)2.87748e-05,
-    (float)3.07595e-05,
-    (float)2.7685e-05,
-    (float)1.7071e-05,
-    (float)3.68022e-05,
-    (float)7.17627e-06,
-    (float)5.18341e-06,
-    (float)2.84798e-05,
-    (float)6.43447e-06,
-    (float)2.22487e-05,
-    (float)2.66683e-05,
-    (float)1.81058e-05,
-    (float)1.94922e-05,
-    (float)7.74218e-06,
-    (float)1.70526e-05,
-    (float)2.65936e-06,
-    (float)9.84709e-06,
-    (float)2.52995e-05,
-    (float)5.01369e-06,
-    (float)2.43879e-05,
-    (float)1.78423e-05,
-    (float)5.64421e-06,
-    (float)1.36138e-05,
-    (float)3.62155e-06,
-    (float)0.349364,
-    (float)0.429643,
-    (float)0.00626286,
-    (float)0.000583116,
-    (float)0.116503,
-    (float)0.0012541,
-    (float)0.00382275,
-    (float)0.0392301,
-    (float)0.00167627,
-    (float)0.00202978,
-    (float)0.00941189,
-    (float)0.00578587,
-    (float)0.000803433,
-    (float)0.00124176,
-    (float)0.00730871,
-    (float)0.000468211,
-    (float)0.000161776,
-    (float)0.00492464,
-    (float)0.0007708,
-    (float)0.000126447,
-    (float)0.00196031,
-    (float)0.00147922,
-    (float)0.000150358,
-    (float)0.000504969,
-    (float)0.00159417,
-    (float)0.000358012,
-    (float)0.000129098,
-    (float)0.000913351,
-    (float)0.00086022,
-    (float)6.79926e-05,
-    (float)0.000282093,
-    (float)0.00132031,
-    (float)4.71229e-05,
-    (float)8.5473e-05,
-    (float)0.00115894,
-    (float)0.000115588,
-    (float)7.20011e-05,
-    (float)0.000519574,
-    (float)0.000473818,
-    (float)8.52068e-05,
-    (float)7.77342e-05,
-    (float)0.000933704,
-    (float)6.66998e-05,
-    (float)4.45815e-06,
-    (float)0.000961231,
-    (float)1.44784e-05,
-    (float)2.72746e-05,
-    (float)0.000533016,
-    (float)0.000122327,
-    (float)4.58434e-05,
-    (float)0.000156486,
-    (float)0.000406691,
-    (float)5.82568e-05,
-    (float)4.63885e-05,
-    (float)0.000530609,
-    (float)1.97829e-05,
-    (float)2.85166e-05,
-    (float)0.000355633,
-    (float)9.83373e-06,
-    (float)1.4208e-05,
-    (float)0.000138344,
-    (float)0.000102875,
-    (float)2.50264e-05,
-    (float)5.58936e-05,
-    (float)0.000177014,
-    (float)3.38694e-05,
-    (float)3.64059e-05,
-    (float)0.000133749,
-    (float)3.34331e-05,
-    (float)1.38591e-05,
-    (float)5.48588e-05,
-    (float)4.16865e-05,
-    (float)4.77393e-06,
-    (float)2.32389e-05,
-    (float)3.84517e-05,
-    (float)2.43579e-05,
-    (float)2.47746e-05,
-    (float)1.89571e-05,
-    (float)6.09669e-05,
-    (float)2.41922e-05,
-    (float)6.94411e-06,
-    (float)7.21411e-05,
-    (float)1.01843e-05,
-    (float)2.9634e-06,
-    (float)3.57651e-05,
-    (float)9.13117e-06,
-    (float)7.41641e-06,
-    (float)2.61906e-06,
-    (float)4.83161e-05,
-    (float)2.38299e-05,
-    (float)8.50977e-06,
-    (float)8.22062e-05,
-    (float)2.43112e-05,
-    (float)1.43246e-05,
-    (float)5.60347e-05,
-    (float)6.5692e-06,
-    (float)4.66764e-06,
-    (float)1.41693e-05,
-    (float)1.79888e-05,
-    (float)1.26493e-05,
-    (float)1.63545e-05,
-    (float)5.38191e-05,
-    (float)2.71681e-05,
-    (float)3.01658e-05,
-    (float)5.29154e-05,
-    (float)1.52303e-05,
-    (float)1.62398e-05,
-    (float)1.84304e-05,
-    (float)2.2049e-06,
-    (float)4.70285e-06,
-    (float)8.62574e-06,
-    (float)1.83046e-05,
-    (float)1.63724e-05,
-    (float)2.50015e-05,
-    (float)3.37688e-05,
-    (float)2.12993e-05,
-    (float)2.49584e-05,
-    (float)2.03092e-05,
-    (float)7.29603e-06,
-    (float)7.88082e-06,
-    (float)2.57618e-06,
-    (float)8.96408e-07,
-    (float)4.6981e-06,
-    (float)7.24327e-06,
-    (float)1.30381e-05,
-    (float)1.70866e-05,
-    (float)2.00668e-05,
-    (float)2.22128e-05,
-    (float)0.452795,
-    (float)0.336275,
-    (float)0.00341441,
-    (float)0.00235197,
-    (float)0.0947187,
-    (float)0.00177503,
-    (float)0.000615414,
-    (float)0.0460304,
-    (float)0.00036806,
-    (float)0.00142386,
-    (float)0.0227687,
-    (float)2.9434e-05,
-    (float)0.00108931,
-    (float)0.0100752,
-    (float)0.000708066,
-    (float)0.000597547,
-    (float)0.00375617,
-    (float)0.0016493,
-    (float)0.000339478,
-    (float)0.00115022,
-    (float)0.00208162,
-    (float)0.000302714,
-    (float)0.00030667,
-    (float)0.00178242,
-    (float)0.000443505,
-    (float)9.59039e-05,
-    (float)0.00108718,
-    (float)0.000743548,
-    (float)5.67885e-05,
-    (float)0.00046504,
-    (float)0.00109908,
-    (float)5.41758e-05,
-    (float)0.000140108,
-    (float)0.00131047,
-    (float)4.99047e-05,
-    (float)5.37977e-05,
-    (float)0.00122811,
-    (float)5.4072e-05,
-    (float)5.67572e-05,
-    (float)0.000887118,
-    (float)0.000119187,
-    (float)6.50541e-05,
-    (float)0.000476714,
-    (float)0.000279936,
-    (float)6.77835e-05,
-    (float)0.000180014,
-    (float)0.000487246,
-    (float)6.56953e-05,
-    (float)5.09402e-05,
-    (float)0.000627116,
-    (float)4.83936e-05,
-    (float)2.85931e-05,
-    (float)0.00061562,
-    (float)1.80368e-05,
-    (float)3.29227e-05,
-    (float)0.000468616,
-    (float)6.34316e-07,
-    (float)2.91558e-05,
-    (float)0.000277803,
-    (float)1.90444e-05,
-    (float)2.14957e-05,
-    (float)0.00012971,
-    (float)6.31595e-05,
-    (float)1.91495e-05,
-    (float)5.21862e-05,
-    (float)9.75363e-05,
-    (float)2.24866e-05,
-    (float)2.44792e-05,
-    (float)9.71825e-05,
-    (float)3.03364e-05,
-    (float)1.68283e-05,
-    (float)6.86273e-05,
-    (float)4.36964e-05,
-    (float)1.34576e-05,
-    (float)3.64018e-05,
-    (float)5.86638e-05,
-    (float)1.05113e-05,
-    (float)1.69888e-05,
-    (float)6.3703e-05,
-    (float)8.21073e-06,
-    (float)9.73636e-06,
-    (float)5.03357e-05,
-    (float)9.53165e-06,
-    (float)7.37469e-06,
-    (float)2.48566e-05,
-    (float)1.99344e-05,
-    (float)7.11209e-06,
-    (float)4.58713e-06,
-    (float)4.1282e-05,
-    (float)9.84541e-06,
-    (float)1.60243e-06,
-    (float)6.54371e-05,
-    (float)1.38973e-05,
-    (float)1.24098e-05,
-    (float)7.76052e-05,
-    (float)1.47123e-05,
-    (float)2.38138e-05,
-    (float)6.85864e-05,
-    (float)1.0894e-05,
-    (float)2.64798e-05,
-    (float)4.35556e-05,
-    (float)7.47227e-06,
-    (float)2.15332e-05,
-    (float)1.79143e-05,
-    (float)1.10588e-05,
-    (float)1.57431e-05,
-    (float)4.55861e-06,
-    (float)2.22828e-05,
-    (float)1.31518e-05,
-    (float)5.11063e-06,
-    (float)3.43881e-05,
-    (float)1.23162e-05,
-    (float)1.19138e-05,
-    (float)3.93505e-05,
-    (float)1.00681e-05,
-    (float)1.64948e-05,
-    (float)3.46257e-05,
-    (float)5.8359e-06,
-    (float)1.58011e-05,
-    (float)2.40333e-05,
-    (float)1.79962e-06,
-    (float)1.19892e-05,
-    (float)1.32817e-05,
-    (float)1.16747e-07,
-    (float)8.46234e-06,
-    (float)5.62158e-06,
-    (float)1.38343e-06,
-    (float)7.13536e-06,
-    (float)0.562782,
-    (float)0.251594,
-    (float)0.00111416,
-    (float)0.0157539,
-    (float)0.0612502,
-    (float)0.000991297,
-    (float)0.00164621,
-    (float)0.0317115,
-    (float)0.000788665,
-    (float)0.000193499,
-    (float)0.0197397,
-    (float)0.000550147,
-    (float)0.000168267,
-    (float)0.0129202,
-    (float)0.000357922,
-    (float)0.000259974,
-    (float)0.00843593,
-    (float)0.000287023,
-    (float)0.000280129,
-    (float)0.00532102,
-    (float)0.000364481,
-    (float)0.000249143,
-    (float)0.0031508,
-    (float)0.000566473,
-    (float)0.000214347,
-    (float)0.0016998,
-    (float)0.000842344,
-    (float)0.000198756,
-    (float)0.000807405,
-    (float)0.00113519,
-    (float)0.000200176,
-    (float)0.00032428,
-    (float)0.00138906,
-    (float)0.000206406,
-    (float)0.000109878,
-    (float)0.00155471,
-    (float)0.000204933,
-    (float)4.83124e-05,
-    (float)0.00160159,
-    (float)0.000186675,
-    (float)5.6767e-05,
-    (float)0.0015273,
-    (float)0.000149809,
-    (float)8.30125e-05,
-    (float)0.00135493,
-    (float)0.000101809,
-    (float)9.96832e-05,
-    (float)0.00112101,
-    (float)5.55666e-05,
-    (float)9.85479e-05,
-    (float)0.000864289,
-    (float)2.24556e-05,
-    (float)8.33901e-05,
-    (float)0.00061899,
-    (float)8.1612e-06,
-    (float)6.21912e-05,
-    (float)0.000410313,
-    (float)1.23916e-05,
-    (float)4.16935e-05,
-    (float)0.00025101,
-    (float)3.00415e-05,
-    (float)2.55786e-05,
-    (float)0.000141363,
-    (float)5.29003e-05,
-    (float)1.48116e-05,
-    (float)7.32074e-05,
-    (float)7.2425e-05,
-    (float)8.62212e-06,
-    (float)3.52053e-05,
-    (float)8.26948e-05,
-    (float)5.65478e-06,
-    (float)1.6546e-05,
-    (float)8.1752e-05,
-    (float)4.96741e-06,
-    (float)8.70259e-06,
-    (float)7.10573e-05,
-    (float)6.37954e-06,
-    (float)6.04157e-06,
-    (float)5.42129e-05,
-    (float)1.0159e-05,
-    (float)5.64072e-06,
-    (float)3.56769e-05,
-    (float)1.65201e-05,
-    (float)6.45721e-06,
-    (float)1.94539e-05,
-    (float)2.52531e-05,
-    (float)8.29751e-06,
-    (float)8.00437e-06,
-    (float)3.55262e-05,
-    (float)1.10371e-05,
-    (float)1.90274e-06,
-    (float)4.59489e-05,
-    (float)1.42311e-05,
-    (float)2.7635e-07,
-    (float)5.49582e-05,
-    (float)1.71136e-05,
-    (float)1.53083e-06,
-    (float)6.13003e-05,
-    (float)1.88931e-05,
-    (float)3.97415e-06,
-    (float)6.42745e-05,
-    (float)1.9083e-05,
-    (float)6.2666e-06,
-    (float)6.37247e-05,
-    (float)1.76279e-05,
-    (float)7.67352e-06,
-    (float)6.00072e-05,
-    (float)1.48565e-05,
-    (float)8.06016e-06,
-    (float)5.39744e-05,
-    (float)1.13898e-05,
-    (float)7.67424e-06,
-    (float)4.68052e-05,
-    (float)7.98645e-06,
-    (float)6.87689e-06,
-    (float)3.96627e-05,
-    (float)5.29217e-06,
-    (float)5.9554e-06,
-    (float)3.34182e-05,
-    (float)3.62293e-06,
-    (float)5.05691e-06,
-    (float)2.86172e-05,
-    (float)2.94078e-06,
-    (float)4.22602e-06,
-    (float)2.55961e-05,
-    (float)2.99698e-06,
-    (float)3.5003e-06,
-    (float)2.45639e-05,
-    (float)0.562782,
-    (float)0.251594,
-    (float)0.00111416,
-    (float)0.0157539,
-    (float)0.0612502,
-    (float)0.000991297,
-    (float)0.00164621,
-    (float)0.0317115,
-    (float)0.000788665,
-    (float)0.000193499,
-    (float)0.0197397,
-    (float)0.000550147,
-    (float)0.000168267,
-    (float)0.0129202,
-    (float)0.000357922,
-    (float)0.000259974,
-    (float)0.00843593,
-    (float)0.000287023,
-    (float)0.000280129,
-    (float)0.00532102,
-    (float)0.000364481,
-    (float)0.000249143,
-    (float)0.0031508,
-    (float)0.000566473,
-    (float)0.000214347,
-    (float)0.0016998,
-    (float)0.000842344,
-    (float)0.000198756,
-    (float)0.000807405,
-    (float)0.00113519,
-    (float)0.000200176,
-    (float)0.00032428,
-    (float)0.00138906,
-    (float)0.000206406,
-    (float)0.000109878,
-    (float)0.00155471,
-    (float)0.000204933,
-    (float)4.83124e-05,
-    (float)0.00160159,
-    (float)0.000186675,
-    (float)5.6767e-05,
-    (float)0.0015273,
-    (float)0.000149809,
-    (float)8.30125e-05,
-    (float)0.00135493,
-    (float)0.000101809,
-    (float)9.96832e-05,
-    (float)0.00112101,
-    (float)5.55666e-05,
-    (float)9.85479e-05,
-    (float)0.000864289,
-    (float)2.24556e-05,
-    (float)8.33901e-05,
-    (float)0.00061899,
-    (float)8.1612e-06,
-    (float)6.21912e-05,
-    (float)0.000410313,
-    (float)1.23916e-05,
-    (float)4.16935e-05,
-    (float)0.00025101,
-    (float)3.00415e-05,
-    (float)2.55786e-05,
-    (float)0.000141363,
-    (float)5.29003e-05,
-    (float)1.48116e-05,
-    (float)7.32074e-05,
-    (float)7.2425e-05,
-    (float)8.62212e-06,
-    (float)3.52053e-05,
-    (float)8.26948e-05,
-    (float)5.65478e-06,
-    (float)1.6546e-05,
-    (float)8.1752e-05,
-    (float)4.96741e-06,
-    (float)8.70259e-06,
-    (float)7.10573e-05,
-    (float)6.37954e-06,
-    (float)6.04157e-06,
-    (float)5.42129e-05,
-    (float)1.0159e-05,
-    (float)5.64072e-06,
-    (float)3.56769e-05,
-    (float)1.65201e-05,
-    (float)6.45721e-06,
-    (float)1.94539e-05,
-    (float)2.52531e-05,
-    (float)8.29751e-06,
-    (float)8.00437e-06,
-    (float)3.55262e-05,
-    (float)1.10371e-05,
-    (float)1.90274e-06,
-    (float)4.59489e-05,
-    (float)1.42311e-05,
-    (float)2.7635e-07,
-    (float)5.49582e-05,
-    (float)1.71136e-05,
-    (float)1.53083e-06,
-    (float)6.13003e-05,
-    (float)1.88931e-05,
-    (float)3.97415e-06,
-    (float)6.42745e-05,
-    (float)1.9083e-05,
-    (float)6.2666e-06,
-    (float)6.37247e-05,
-    (float)1.76279e-05,
-    (float)7.67352e-06,
-    (float)6.00072e-05,
-    (float)1.48565e-05,
-    (float)8.06016e-06,
-    (float)5.39744e-05,
-    (float)1.13898e-05,
-    (float)7.67424e-06,
-    (float)4.68052e-05,
-    (float)7.98645e-06,
-    (float)6.87689e-06,
-    (float)3.96627e-05,
-    (float)5.29217e-06,
-    (float)5.9554e-06,
-    (float)3.34182e-05,
-    (float)3.62293e-06,
-    (float)5.05691e-06,
-    (float)2.86172e-05,
-    (float)2.94078e-06,
-    (float)4.22602e-06,
-    (float)2.55961e-05,
-    (float)2.99698e-06,
-    (float)3.5003e-06,
-    (float)2.45639e-05,
-    (float)0.545823,
-    (float)0.272873,
-    (float)0.00182369,
-    (float)0.0119507,
-    (float)0.0690671,
-    (float)0.00150592,
-    (float)0.000699544,
-    (float)0.0353417,
-    (float)0.00104771,
-    (float)0.000147735,
-    (float)0.0208381,
-    (float)0.000591705,
-    (float)0.000337144,
-    (float)0.0124063,
-    (float)0.000303845,
-    (float)0.000390764,
-    (float)0.00706459,
-    (float)0.000271124,
-    (float)0.000329769,
-    (float)0.00370905,
-    (float)0.000453219,
-    (float)0.000262946,
-    (float)0.00173368,
-    (float)0.000726912,
-    (float)0.000239278,
-    (float)0.000702845,
-    (float)0.00096503,
-    (float)0.000243501,
-    (float)0.000259122,
-    (float)0.00108421,
-    (float)0.000241551,
-    (float)0.000118754,
-    (float)0.00105503,
-    (float)0.000215804,
-    (float)9.28968e-05,
-    (float)0.000897581,
-    (float)0.000170664,
-    (float)8.72555e-05,
-    (float)0.000668394,
-    (float)0.000122832,
-    (float)7.31823e-05,
-    (float)0.000434494,
-    (float)8.96102e-05,
-    (float)5.27002e-05,
-    (float)0.000245232,
-    (float)7.94263e-05,
-    (float)3.46992e-05,
-    (float)0.000119618,
-    (float)8.86387e-05,
-    (float)2.39993e-05,
-    (float)5.17829e-05,
-    (float)0.00010619,
-    (float)1.94629e-05,
-    (float)2.36736e-05,
-    (float)0.000120933,
-    (float)1.72762e-05,
-    (float)1.6201e-05,
-    (float)0.000126124,
-    (float)1.48664e-05,
-    (float)1.60772e-05,
-    (float)0.000120499,
-    (float)1.23059e-05,
-    (float)1.73799e-05,
-    (float)0.000107141,
-    (float)1.14206e-05,
-    (float)1.8891e-05,
-    (float)9.06933e-05,
-    (float)1.40808e-05,
-    (float)2.07334e-05,
-    (float)7.45625e-05,
-    (float)2.05341e-05,
-    (float)2.27042e-05,
-    (float)6.0117e-05,
-    (float)2.87366e-05,
-    (float)2.39899e-05,
-    (float)4.76239e-05,
-    (float)3.5403e-05,
-    (float)2.35371e-05,
-    (float)3.70534e-05,
-    (float)3.78457e-05,
-    (float)2.08517e-05,
-    (float)2.81926e-05,
-    (float)3.50652e-05,
-    (float)1.65665e-05,
-    (float)2.08061e-05,
-    (float)2.78749e-05,
-    (float)1.21299e-05,
-    (float)1.49562e-05,
-    (float)1.85584e-05,
-    (float)8.95966e-06,
-    (float)1.09693e-05,
-    (float)1.00236e-05,
-    (float)7.79394e-06,
-    (float)9.06896e-06,
-    (float)4.53579e-06,
-    (float)8.46936e-06,
-    (float)9.1105e-06,
-    (float)2.82441e-06,
-    (float)1.00988e-05,
-    (float)1.0536e-05,
-    (float)4.10678e-06,
-    (float)1.16083e-05,
-    (float)1.24987e-05,
-    (float)6.73796e-06,
-    (float)1.23135e-05,
-    (float)1.41543e-05,
-    (float)9.01842e-06,
-    (float)1.21199e-05,
-    (float)1.49584e-05,
-    (float)9.89303e-06,
-    (float)1.1345e-05,
-    (float)1.47523e-05,
-    (float)9.24617e-06,
-    (float)1.04381e-05,
-    (float)1.36879e-05,
-    (float)7.64062e-06,
-    (float)9.73312e-06,
-    (float)1.21447e-05,
-    (float)5.79978e-06,
-    (float)9.30198e-06,
-    (float)1.06124e-05,
-    (float)4.25775e-06,
-    (float)9.0317e-06,
-    (float)9.49486e-06,
-    (float)3.28301e-06,
-    (float)8.86784e-06,
-    (float)8.94773e-06,
-    (float)2.95552e-06,
-    (float)0.526935,
-    (float)0.294876,
-    (float)0.00279718,
-    (float)0.00857154,
-    (float)0.0765251,
-    (float)0.00212159,
-    (float)0.000230034,
-    (float)0.037795,
-    (float)0.00125171,
-    (float)0.000350108,
-    (float)0.0203948,
-    (float)0.000525004,
-    (float)0.000523666,
-    (float)0.0105332,
-    (float)0.000195319,
-    (float)0.000431773,
-    (float)0.00491279,
-    (float)0.000261139,
-    (float)0.000300437,
-    (float)0.00198846,
-    (float)0.000502799,
-    (float)0.000241669,
-    (float)0.000688981,
-    (float)0.0006783,
-    (float)0.000231734,
-    (float)0.00023377,
-    (float)0.000673782,
-    (float)0.000214625,
-    (float)0.000117148,
-    (float)0.000514707,
-    (float)0.000178151,
-    (float)8.59356e-05,
-    (float)0.000297411,
-    (float)0.00015055,
-    (float)6.53953e-05,
-    (float)0.000117049,
-    (float)0.000159737,
-    (float)5.67666e-05,
-    (float)2.13165e-05,
-    (float)0.00020716,
-    (float)6.53239e-05,
-    (float)1.55091e-06,
-    (float)0.000268642,
-    (float)8.10581e-05,
-    (float)1.91066e-05,
-    (float)0.00031247,
-    (float)8.85847e-05,
-    (float)3.94289e-05,
-    (float)0.000319125,
-    (float)7.98763e-05,
-    (float)4.7026e-05,
-    (float)0.000288057,
-    (float)5.86093e-05,
-    (float)4.17574e-05,
-    (float)0.000231195,
-    (float)3.49076e-05,
-    (float)3.01309e-05,
-    (float)0.00016457,
-    (float)1.68589e-05,
-    (float)1.8521e-05,
-    (float)0.000103206,
-    (float)6.69888e-06,
-    (float)9.91882e-06,
-    (float)5.69547e-05,
-    (float)2.39671e-06,
-    (float)4.58046e-06,
-    (float)2.81028e-05,
-    (float)7.67931e-07,
-    (float)2.03416e-06,
-    (float)1.32664e-05,
-    (float)9.89853e-08,
-    (float)1.84124e-06,
-    (float)7.47629e-06,
-    (float)1.20488e-06,
-    (float)3.50525e-06,
-    (float)6.8691e-06,
-    (float)5.8248e-06,
-    (float)6.33343e-06,
-    (float)9.21787e-06,
-    (float)1.39489e-05,
-    (float)9.19898e-06,
-    (float)1.30873e-05,
-    (float)2.30265e-05,
-    (float)1.07498e-05,
-    (float)1.68168e-05,
-    (float)2.94947e-05,
-    (float)1.02658e-05,
-    (float)1.86813e-05,
-    (float)3.1009e-05,
-    (float)8.13725e-06,
-    (float)1.8007e-05,
-    (float)2.78546e-05,
-    (float)5.47325e-06,
-    (float)1.56396e-05,
-    (float)2.2549e-05,
-    (float)3.43703e-06,
-    (float)1.32223e-05,
-    (float)1.79132e-05,
-    (float)2.73156e-06,
-    (float)1.21008e-05,
-    (float)1.53695e-05,
-    (float)3.37734e-06,
-    (float)1.25976e-05,
-    (float)1.46894e-05,
-    (float)4.88607e-06,
-    (float)1.39881e-05,
-    (float)1.47592e-05,
-    (float)6.53902e-06,
-    (float)1.51033e-05,
-    (float)1.44738e-05,
-    (float)7.54586e-06,
-    (float)1.50032e-05,
-    (float)1.32528e-05,
-    (float)7.34683e-06,
-    (float)1.33529e-05,
-    (float)1.10522e-05,
-    (float)5.99903e-06,
-    (float)1.05287e-05,
-    (float)8.19638e-06,
-    (float)4.15423e-06,
-    (float)7.36556e-06,
-    (float)5.31821e-06,
-    (float)2.64514e-06,
-    (float)4.63626e-06,
-    (float)3.19746e-06,
-    (float)2.10692e-06,
-    (float)2.79747e-06,
-    (float)2.42313e-06,
-    (float)0.50783,
-    (float)0.317421,
-    (float)0.00405131,
-    (float)0.00581408,
-    (float)0.0832534,
-    (float)0.00277579,
-    (float)0.000160475,
-    (float)0.0387561,
-    (float)0.00132149,
-    (float)0.000588895,
-    (float)0.0184596,
-    (float)0.000344791,
-    (float)0.000551131,
-    (float)0.00783923,
-    (float)9.77786e-05,
-    (float)0.000325746,
-    (float)0.00278183,
-    (float)0.000295768,
-    (float)0.000200813,
-    (float)0.000808226,
-    (float)0.000482291,
-    (float)0.000166882,
-    (float)0.000227432,
-    (float)0.000441277,
-    (float)0.000142685,
-    (float)9.98879e-05,
-    (float)0.000251663,
-    (float)0.00012504,
-    (float)6.58437e-05,
-    (float)8.36622e-05,
-    (float)0.000158714,
-    (float)6.45586e-05,
-    (float)2.64618e-05,
-    (float)0.000250009,
-    (float)9.68434e-05,
-    (float)5.87908e-05,
-    (float)0.000350557,
-    (float)0.000134568,
-    (float)0.000109801,
-    (float)0.000400818,
-    (float)0.000144224,
-    (float)0.000128796,
-    (float)0.000371966,
-    (float)0.000119348,
-    (float)0.000110886,
-    (float)0.000279782,
-    (float)7.73023e-05,
-    (float)7.67857e-05,
-    (float)0.000168048,
-    (float)3.97585e-05,
-    (float)4.53945e-05,
-    (float)7.73456e-05,
-    (float)1.81316e-05,
-    (float)2.51537e-05,
-    (float)2.57177e-05,
-    (float)1.13074e-05,
-    (float)1.6714e-05,
-    (float)8.70386e-06,
-    (float)1.29503e-05,
-    (float)1.61362e-05,
-    (float)9.86644e-06,
-    (float)1.83129e-05,
-    (float)1.81372e-05,
-    (float)1.39437e-05,
-    (float)2.49298e-05,
-    (float)1.87329e-05,
-    (float)1.45969e-05,
-    (float)3.05097e-05,
-    (float)1.63447e-05,
-    (float)1.24839e-05,
-    (float)3.21267e-05,
-    (float)1.19793e-05,
-    (float)9.74509e-06,
-    (float)2.78516e-05,
-    (float)8.08177e-06,
-    (float)7.62654e-06,
-    (float)1.9289e-05,
-    (float)6.70468e-06,
-    (float)6.78004e-06,
-    (float)1.11351e-05,
-    (float)8.56136e-06,
-    (float)7.62918e-06,
-    (float)7.22346e-06,
-    (float)1.30155e-05,
-    (float)1.00515e-05,
-    (float)7.79886e-06,
-    (float)1.86824e-05,
-    (float)1.29181e-05,
-    (float)1.04462e-05,
-    (float)2.40247e-05,
-    (float)1.44618e-05,
-    (float)1.24285e-05,
-    (float)2.72341e-05,
-    (float)1.34449e-05,
-    (float)1.23829e-05,
-    (float)2.65712e-05,
-    (float)1.00866e-05,
-    (float)1.0757e-05,
-    (float)2.19389e-05,
-    (float)6.16797e-06,
-    (float)9.01638e-06,
-    (float)1.55718e-05,
-    (float)4.01277e-06,
-    (float)8.42169e-06,
-    (float)1.04199e-05,
-    (float)4.68347e-06,
-    (float)9.14344e-06,
-    (float)7.97958e-06,
-    (float)7.23627e-06,
-    (float)1.02379e-05,
-    (float)7.65352e-06,
-    (float)9.85501e-06,
-    (float)1.0563e-05,
-    (float)7.81635e-06,
-    (float)1.12278e-05,
-    (float)9.59232e-06,
-    (float)7.33592e-06,
-    (float)1.09722e-05,
-    (float)7.44015e-06,
-    (float)6.17518e-06,
-    (float)9.44176e-06,
-    (float)4.71657e-06,
-    (float)5.00493e-06,
-    (float)7.34793e-06,
-    (float)2.42912e-06,
-    (float)4.63522e-06,
-    (float)5.50206e-06,
-    (float)1.5384e-06,
-    (float)0.487378,
-    (float)0.34149,
-    (float)0.0054363,
-    (float)0.00353256,
-    (float)0.0893484,
-    (float)0.00328756,
-    (float)0.000384018,
-    (float)0.0382448,
-    (float)0.0011653,
-    (float)0.000793861,
-    (float)0.0154229,
-    (float)0.000115082,
-    (float)0.000477877,
-    (float)0.00503413,
-    (float)0.000119782,
-    (float)0.00020654,
-    (float)0.00123969,
-    (float)0.000409961,
-    (float)0.000121165,
-    (float)0.000258675,
-    (float)0.000442464,
-    (float)8.61998e-05,
-    (float)7.99517e-05,
-    (float)0.000269705,
-    (float)8.04902e-05,
-    (float)4.34687e-05,
-    (float)0.000147355,
-    (float)0.00015842,
-    (float)7.08417e-05,
-    (float)0.000154531,
-    (float)0.000289486,
-    (float)0.000141605,
-    (float)0.000203998,
-    (float)0.000370797,
-    (float)0.000183483,
-    (float)0.000210771,
-    (float)0.00034234,
-    (float)0.000160213,
-    (float)0.000165248,
-    (float)0.000229691,
-    (float)0.000101932,
-    (float)0.000102982,
-    (float)0.000107069,
-    (float)5.30605e-05,
-    (float)5.69202e-05,
-    (float)3.71529e-05,
-    (float)3.11974e-05,
-    (float)3.729e-05,
-    (float)2.89047e-05,
-    (float)2.81369e-05,
-    (float)3.65882e-05,
-    (float)4.73173e-05,
-    (float)2.94085e-05,
-    (float)4.04666e-05,
-    (float)5.65001e-05,
-    (float)2.78225e-05,
-    (float)3.82122e-05,
-    (float)4.68997e-05,
-    (float)2.24955e-05,
-    (float)2.93527e-05,
-    (float)2.9562e-05,
-    (float)1.40528e-05,
-    (float)2.01085e-05,
-    (float)1.6487e-05,
-    (float)5.74524e-06,
-    (float)1.56664e-05,
-    (float)1.09921e-05,
-    (float)3.06349e-06,
-    (float)1.63341e-05,
-    (float)1.10813e-05,
-    (float)7.85998e-06,
-    (float)1.867e-05,
-    (float)1.37954e-05,
-    (float)1.55623e-05,
-    (float)1.9531e-05,
-    (float)1.60735e-05,
-    (float)1.96431e-05,
-    (float)1.81126e-05,
-    (float)1.58164e-05,
-    (float)1.7922e-05,
-    (float)1.46573e-05,
-    (float)1.32195e-05,
-    (float)1.33739e-05,
-    (float)9.88005e-06,
-    (float)1.04444e-05,
-    (float)9.77904e-06,
-    (float)5.94836e-06,
-    (float)9.77034e-06,
-    (float)8.81413e-06,
-    (float)5.66941e-06,
-    (float)1.13549e-05,
-    (float)1.01371e-05,
-    (float)9.42813e-06,
-    (float)1.30368e-05,
-    (float)1.20748e-05,
-    (float)1.39343e-05,
-    (float)1.26385e-05,
-    (float)1.2753e-05,
-    (float)1.53316e-05,
-    (float)9.85204e-06,
-    (float)1.15286e-05,
-    (float)1.30872e-05,
-    (float)6.09159e-06,
-    (float)9.48821e-06,
-    (float)9.74082e-06,
-    (float)3.20945e-06,
-    (float)8.51163e-06,
-    (float)7.76547e-06,
-    (float)2.54572e-06,
-    (float)9.45868e-06,
-    (float)7.71654e-06,
-    (float)4.4517e-06,
-    (float)1.1106e-05,
-    (float)8.5101e-06,
-    (float)7.678e-06,
-    (float)1.12646e-05,
-    (float)8.7605e-06,
-    (float)9.85433e-06,
-    (float)9.02856e-06,
-    (float)7.97893e-06,
-    (float)9.62765e-06,
-    (float)5.62774e-06,
-    (float)6.69446e-06,
-    (float)7.83058e-06,
-    (float)3.00591e-06,
-    (float)5.85809e-06,
-    (float)6.22366e-06,
-    (float)2.10215e-06,
-    (float)0.465667,
-    (float)0.366626,
-    (float)0.00701655,
-    (float)0.00185435,
-    (float)0.0945618,
-    (float)0.00365882,
-    (float)0.000777728,
-    (float)0.0363527,
-    (float)0.000866054,
-    (float)0.000847515,
-    (float)0.0118809,
-    (float)9.85906e-07,
-    (float)0.000316376,
-    (float)0.00275701,
-    (float)0.000337304,
-    (float)0.000102769,
-    (float)0.00043615,
-    (float)0.000589936,
-    (float)5.02374e-05,
-    (float)7.87556e-05,
-    (float)0.000463368,
-    (float)3.75207e-05,
-    (float)2.47365e-05,
-    (float)0.000319613,
-    (float)0.00012904,
-    (float)6.35199e-05,
-    (float)0.000310238,
-    (float)0.000275774,
-    (float)0.0001527,
-    (float)0.000309273,
-    (float)0.000324176,
-    (float)0.000182133,
-    (float)0.00023999,
-    (float)0.000233857,
-    (float)0.000130168,
-    (float)0.000143945,
-    (float)0.000105235,
-    (float)6.65125e-05,
-    (float)7.44024e-05,
-    (float)4.45486e-05,
-    (float)3.92481e-05,
-    (float)4.8356e-05,
-    (float)6.63907e-05,
-    (float)3.88659e-05,
-    (float)5.07358e-05,
-    (float)0.000104466,
-    (float)3.85071e-05,
-    (float)5.45524e-05,
-    (float)0.000102396,
-    (float)2.7636e-05,
-    (float)4.52932e-05,
-    (float)6.73002e-05,
-    (float)1.28067e-05,
-    (float)2.96167e-05,
-    (float)3.42595e-05,
-    (float)4.82473e-06,
-    (float)2.10083e-05,
-    (float)1.93681e-05,
-    (float)1.02879e-05,
-    (float)2.16652e-05,
-    (float)1.74287e-05,
-    (float)2.58522e-05,
-    (float)2.33267e-05,
-    (float)1.88343e-05,
-    (float)3.72467e-05,
-    (float)1.96103e-05,
-    (float)1.77051e-05,
-    (float)3.4427e-05,
-    (float)1.20509e-05,
-    (float)1.32444e-05,
-    (float)2.29885e-05,
-    (float)5.6582e-06,
-    (float)8.84796e-06,
-    (float)1.37017e-05,
-    (float)3.53444e-06,
-    (float)8.04413e-06,
-    (float)1.03835e-05,
-    (float)6.82285e-06,
-    (float)1.03035e-05,
-    (float)1.08941e-05,
-    (float)1.40248e-05,
-    (float)1.20167e-05,
-    (float)1.21092e-05,
-    (float)1.94455e-05,
-    (float)1.05508e-05,
-    (float)1.17251e-05,
-    (float)1.85278e-05,
-    (float)6.82499e-06,
-    (float)9.5493e-06,
-    (float)1.35987e-05,
-    (float)3.98932e-06,
-    (float)7.88983e-06,
-    (float)9.8439e-06,
-    (float)4.21123e-06,
-    (float)8.6466e-06,
-    (float)8.97569e-06,
-    (float)7.49451e-06,
-    (float)1.06249e-05,
-    (float)9.27593e-06,
-    (float)1.17303e-05,
-    (float)1.10619e-05,
-    (float)8.90318e-06,
-    (float)1.38051e-05,
-    (float)8.95781e-06,
-    (float)7.52532e-06,
-    (float)1.26887e-05,
-    (float)6.04772e-06,
-    (float)6.23211e-06,
-    (float)1.05228e-05,
-    (float)4.64578e-06,
-    (float)6.39659e-06,
-    (float)9.39952e-06,
-    (float)5.28347e-06,
-    (float)7.9046e-06,
-    (float)8.98384e-06,
-    (float)7.01821e-06,
-    (float)9.06388e-06,
-    (float)8.0723e-06,
-    (float)8.60708e-06,
-    (float)8.50346e-06,
-    (float)6.52449e-06,
-    (float)8.99546e-06,
-    (float)6.53023e-06,
-    (float)4.97932e-06,
-    (float)8.22111e-06,
-    (float)4.65885e-06,
-    (float)4.13327e-06,
-    (float)7.6579e-06,
-    (float)0.44292,
-    (float)0.392687,
-    (float)0.00870782,
-    (float)0.000787659,
-    (float)0.0987036,
-    (float)0.00380965,
-    (float)0.00121193,
-    (float)0.0332876,
-    (float)0.000499995,
-    (float)0.000742245,
-    (float)0.00840179,
-    (float)0.000117518,
-    (float)0.000150064,
-    (float)0.00126708,
-    (float)0.00072874,
-    (float)3.51868e-05,
-    (float)0.000133244,
-    (float)0.000805208,
-    (float)7.67129e-06,
-    (float)1.70406e-05,
-    (float)0.000574233,
-    (float)7.76917e-05,
-    (float)3.80342e-05,
-    (float)0.000461538,
-    (float)0.000229917,
-    (float)0.000135663,
-    (float)0.000386243,
-    (float)0.000267008,
-    (float)0.000162161,
-    (float)0.000248398,
-    (float)0.000152755,
-    (float)0.000100892,
-    (float)0.00011829,
-    (float)5.63409e-05,
-    (float)5.03745e-05,
-    (float)5.53507e-05,
-    (float)7.88431e-05,
-    (float)4.50735e-05,
-    (float)5.07239e-05,
-    (float)0.000147555,
-    (float)4.67709e-05,
-    (float)5.95872e-05,
-    (float)0.000153442,
-    (float)3.14218e-05,
-    (float)5.01104e-05,
-    (float)9.53649e-05,
-    (float)1.24803e-05,
-    (float)3.22542e-05,
-    (float)4.12669e-05,
-    (float)1.14426e-05,
-    (float)2.69525e-05,
-    (float)2.16142e-05,
-    (float)3.32478e-05,
-    (float)3.18045e-05,
-    (float)2.13787e-05,
-    (float)5.7935e-05,
-    (float)2.99132e-05,
-    (float)2.16197e-05,
-    (float)5.95752e-05,
-    (float)1.78581e-05,
-    (float)1.61229e-05,
-    (float)3.84298e-05,
-    (float)7.7898e-06,
-    (float)1.05186e-05,
-    (float)1.82876e-05,
-    (float)7.94332e-06,
-    (float)1.05388e-05,
-    (float)1.11743e-05,
-    (float)1.57596e-05,
-    (float)1.32612e-05,
-    (float)1.06905e-05,
-    (float)2.40619e-05,
-    (float)1.27289e-05,
-    (float)1.02951e-05,
-    (float)2.54784e-05,
-    (float)8.27778e-06,
-    (float)8.71077e-06,
-    (float)1.8616e-05,
-    (float)4.72e-06,
-    (float)7.66953e-06,
-    (float)1.05525e-05,
-    (float)5.91763e-06,
-    (float)9.03412e-06,
-    (float)7.21405e-06,
-    (float)1.08308e-05,
-    (float)1.09221e-05,
-    (float)6.94656e-06,
-    (float)1.53733e-05,
-    (float)1.01212e-05,
-    (float)6.73048e-06,
-    (float)1.59263e-05,
-    (float)7.05132e-06,
-    (float)6.46978e-06,
-    (float)1.25051e-05,
-    (float)5.38431e-06,
-    (float)7.48835e-06,
-    (float)9.1381e-06,
-    (float)7.38247e-06,
-    (float)1.00118e-05,
-    (float)8.56067e-06,
-    (float)1.11502e-05,
-    (float)1.15187e-05,
-    (float)8.96433e-06,
-    (float)1.29959e-05,
-    (float)9.80295e-06,
-    (float)8.25103e-06,
-    (float)1.14409e-05,
-    (float)6.62256e-06,
-    (float)7.16549e-06,
-    (float)8.1385e-06,
-    (float)5.23818e-06,
-    (float)7.02526e-06,
-    (float)5.75245e-06,
-    (float)6.39801e-06,
-    (float)7.76492e-06,
-    (float)5.5506e-06,
-    (float)8.35604e-06,
-    (float)8.13569e-06,
-    (float)6.579e-06,
-    (float)9.23546e-06,
-    (float)7.17472e-06,
-    (float)7.228e-06,
-    (float)8.39898e-06,
-    (float)5.66347e-06,
-    (float)7.12205e-06,
-    (float)6.56948e-06,
-    (float)5.2899e-06,
-    (float)6.94457e-06,
-    (float)0.419097,
-    (float)0.420083,
-    (float)0.0104712,
-    (float)0.000295256,
-    (float)0.101743,
-    (float)0.00370069,
-    (float)0.00156648,
-    (float)0.0293033,
-    (float)0.000194877,
-    (float)0.000528508,
-    (float)0.00535358,
-    (float)0.000517901,
-    (float)4.64703e-05,
-    (float)0.000462789,
-    (float)0.00116064,
-    (float)6.21459e-06,
-    (float)3.57762e-05,
-    (float)0.000946625,
-    (float)2.52884e-05,
-    (float)7.55452e-06,
-    (float)0.000646144,
-    (float)0.000162535,
-    (float)0.000101711,
-    (float)0.000465436,
-    (float)0.000219946,
-    (float)0.00014424,
-    (float)0.000259315,
-    (float)0.000116474,
-    (float)8.26971e-05,
-    (float)9.50904e-05,
-    (float)6.00217e-05,
-    (float)4.2998e-05,
-    (float)3.95517e-05,
-    (float)0.000136758,
-    (float)5.07682e-05,
-    (float)5.08785e-05,
-    (float)0.000196757,
-    (float)4.69019e-05,
-    (float)5.81255e-05,
-    (float)0.000143695,
-    (float)2.37208e-05,
-    (float)3.97102e-05,
-    (float)5.86399e-05,
-    (float)1.87243e-05,
-    (float)2.95862e-05,
-    (float)2.38604e-05,
-    (float)4.67246e-05,
-    (float)3.81885e-05,
-    (float)2.5439e-05,
-    (float)7.76337e-05,
-    (float)3.96875e-05,
-    (float)2.66404e-05,
-    (float)7.04256e-05,
-    (float)2.54958e-05,
-    (float)1.92051e-05,
-    (float)3.60273e-05,
-    (float)1.60987e-05,
-    (float)1.44469e-05,
-    (float)1.58515e-05,
-    (float)2.12484e-05,
-    (float)1.75195e-05,
-    (float)1.53901e-05,
-    (float)2.91869e-05,
-    (float)1.90617e-05,
-    (float)1.58402e-05,
-    (float)2.84389e-05,
-    (float)1.43036e-05,
-    (float)1.21078e-05,
-    (float)1.77189e-05,
-    (float)9.61898e-06,
-    (float)9.1996e-06,
-    (float)8.05012e-06,
-    (float)1.08693e-05,
-    (float)1.03384e-05,
-    (float)7.34222e-06,
-    (float)1.46155e-05,
-    (float)1.21201e-05,
-    (float)8.92726e-06,
-    (float)1.43879e-05,
-    (float)1.00374e-05,
-    (float)7.52406e-06,
-    (float)9.95269e-06,
-    (float)6.92786e-06,
-    (float)6.09838e-06,
-    (float)6.06159e-06,
-    (float)7.43573e-06,
-    (float)7.40431e-06,
-    (float)7.35405e-06,
-    (float)1.08188e-05,
-    (float)1.03956e-05,
-    (float)1.17293e-05,
-    (float)1.20124e-05,
-    (float)1.13177e-05,
-    (float)1.2752e-05,
-    (float)8.74172e-06,
-    (float)9.60829e-06,
-    (float)1.02826e-05,
-    (float)5.10709e-06,
-    (float)8.72896e-06,
-    (float)8.32209e-06,
-    (float)4.99301e-06,
-    (float)9.27095e-06,
-    (float)7.82416e-06,
-    (float)7.34322e-06,
-    (float)8.96803e-06,
-    (float)7.55824e-06,
-    (float)8.99497e-06,
-    (float)7.17443e-06,
-    (float)7.12248e-06,
-    (float)8.77855e-06,
-    (float)5.61652e-06,
-    (float)7.31425e-06,
-    (float)7.88857e-06,
-    (float)6.08246e-06,
-    (float)7.93919e-06,
-    (float)7.21895e-06,
-    (float)7.85482e-06,
-    (float)7.53217e-06,
-    (float)6.74363e-06,
-    (float)8.83277e-06,
-    (float)6.0288e-06,
-    (float)6.57296e-06,
-    (float)8.16396e-06,
-    (float)4.88691e-06,
-    (float)6.80499e-06,
-    (float)6.52228e-06,
-    (float)5.10476e-06,
-    (float)7.00474e-06,
-    (float)0.394475,
-    (float)0.44851,
-    (float)0.0122982,
-    (float)0.000328329,
-    (float)0.103499,
-    (float)0.0033602,
-    (float)0.00175813,
-    (float)0.0247452,
-    (float)9.53653e-05,
-    (float)0.000290603,
-    (float)0.00302294,
-    (float)0.00112786,
-    (float)1.26151e-05,
-    (float)0.000139771,
-    (float)0.00147378,
-    (float)8.72829e-06,
-    (float)5.39339e-06,
-    (float)0.000967522,
-    (float)9.32391e-05,
-    (float)4.95891e-05,
-    (float)0.000587772,
-    (float)0.000183368,
-    (float)0.000125307,
-    (float)0.000298776,
-    (float)0.000105957,
-    (float)7.59105e-05,
-    (float)8.85078e-05,
-    (float)6.37813e-05,
-    (float)4.07357e-05,
-    (float)2.79624e-05,
-    (float)0.000171881,
-    (float)5.88226e-05,
-    (float)4.83676e-05,
-    (float)0.00021891,
-    (float)5.08191e-05,
-    (float)5.45544e-05,
-    (float)0.00012145,
-    (float)2.55753e-05,
-    (float)3.5652e-05,
-    (float)3.43587e-05,
-    (float)3.7001e-05,
-    (float)3.85851e-05,
-    (float)2.44651e-05,
-    (float)7.54237e-05,
-    (float)5.10655e-05,
-    (float)3.31924e-05,
-    (float)8.31404e-05,
-    (float)3.98848e-05,
-    (float)2.69263e-05,
-    (float)4.49254e-05,
-    (float)2.46494e-05,
-    (float)2.03645e-05,
-    (float)1.88552e-05,
-    (float)2.93207e-05,
-    (float)2.5694e-05,
-    (float)2.27511e-05,
-    (float)3.64409e-05,
-    (float)2.78244e-05,
-    (float)2.34675e-05,
-    (float)2.78879e-05,
-    (float)1.8819e-05,
-    (float)1.57373e-05,
-    (float)1.25534e-05,
-    (float)1.28309e-05,
-    (float)1.24667e-05,
-    (float)8.41427e-06,
-    (float)1.54329e-05,
-    (float)1.50204e-05,
-    (float)1.39989e-05,
-    (float)1.61414e-05,
-    (float)1.44845e-05,
-    (float)1.35299e-05,
-    (float)1.02606e-05,
-    (float)9.37901e-06,
-    (float)8.74427e-06,
-    (float)5.08367e-06,
-    (float)7.68462e-06,
-    (float)7.74403e-06,
-    (float)7.02096e-06,
-    (float)1.02158e-05,
-    (float)9.59452e-06,
-    (float)1.26072e-05,
-    (float)1.04526e-05,
-    (float)9.66777e-06,
-    (float)1.3454e-05,
-    (float)6.72028e-06,
-    (float)7.53006e-06,
-    (float)1.05447e-05,
-    (float)4.64218e-06,
-    (float)7.81147e-06,
-    (float)9.3495e-06,
-    (float)6.859e-06,
-    (float)9.39993e-06,
-    (float)8.69265e-06,
-    (float)9.13262e-06,
-    (float)8.24131e-06,
-    (float)6.9901e-06,
-    (float)8.72107e-06,
-    (float)6.01943e-06,
-    (float)6.27246e-06,
-    (float)8.11779e-06,
-    (float)6.46433e-06,
-    (float)7.95801e-06,
-    (float)8.66454e-06,
-    (float)8.718e-06,
-    (float)9.04406e-06,
-    (float)8.06923e-06,
-    (float)9.20648e-06,
-    (float)7.45883e-06,
-    (float)6.41983e-06,
-    (float)8.06848e-06,
-    (float)5.98483e-06,
-    (float)6.11549e-06,
-    (float)7.61787e-06,
-    (float)6.25174e-06,
-    (float)6.9548e-06,
-    (float)7.4592e-06,
-    (float)6.62269e-06,
-    (float)6.98483e-06,
-    (float)6.5403e-06,
-    (float)6.25044e-06,
-    (float)6.35496e-06,
-    (float)6.01548e-06,
-    (float)6.24525e-06,
-    (float)6.46805e-06,
-    (float)6.51151e-06,
-    (float)6.70964e-06,
-    (float)6.80294e-06,
-    (float)0.368984,
-    (float)0.477851,
-    (float)0.0140752,
-    (float)0.000799178,
-    (float)0.104055,
-    (float)0.00280658,
-    (float)0.00174873,
-    (float)0.020062,
-    (float)0.000300893,
-    (float)0.000101354,
-    (float)0.00148004,
-    (float)0.0018096,
-    (float)2.69532e-05,
-    (float)5.593e-05,
-    (float)0.00159838,
-    (float)4.72621e-05,
-    (float)9.46188e-06,
-    (float)0.000868655,
-    (float)0.000146671,
-    (float)9.2339e-05,
-    (float)0.000408204,
-    (float)0.00011226,
-    (float)8.12938e-05,
-    (float)0.000111895,
-    (float)5.48359e-05,
-    (float)3.88868e-05,
-    (float)1.8185e-05,
-    (float)0.000179438,
-    (float)6.279e-05,
-    (float)4.28051e-05,
-    (float)0.000238704,
-    (float)5.39788e-05,
-    (float)5.26132e-05,
-    (float)0.00011083,
-    (float)2.89041e-05,
-    (float)3.65545e-05,
-    (float)2.19854e-05,
-    (float)5.33328e-05,
-    (float)4.86524e-05,
-    (float)2.93832e-05,
-    (float)9.01818e-05,
-    (float)5.77172e-05,
-    (float)3.83678e-05,
-    (float)7.08286e-05,
-    (float)3.72665e-05,
-    (float)2.88808e-05,
-    (float)2.53393e-05,
-    (float)3.11806e-05,
-    (float)2.94716e-05,
-    (float)2.57312e-05,
-    (float)4.18455e-05,
-    (float)3.56273e-05,
-    (float)3.61921e-05,
-    (float)3.38741e-05,
-    (float)2.62059e-05,
-    (float)2.5063e-05,
-    (float)1.31129e-05,
-    (float)1.72226e-05,
-    (float)1.64196e-05,
-    (float)1.00555e-05,
-    (float)2.0319e-05,
-    (float)1.78081e-05,
-    (float)2.17502e-05,
-    (float)1.86833e-05,
-    (float)1.62345e-05,
-    (float)2.05915e-05,
-    (float)8.58021e-06,
-    (float)1.01198e-05,
-    (float)1.18936e-05,
-    (float)5.14171e-06,
-    (float)1.06021e-05,
-    (float)9.32983e-06,
-    (float)1.22011e-05,
-    (float)1.22827e-05,
-    (float)8.62066e-06,
-    (float)1.72716e-05,
-    (float)7.74331e-06,
-    (float)6.65595e-06,
-    (float)1.31905e-05,
-    (float)3.84158e-06,
-    (float)7.23852e-06,
-    (float)9.1375e-06,
-    (float)6.7134e-06,
-    (float)1.08263e-05,
-    (float)7.93295e-06,
-    (float)1.07338e-05,
-    (float)9.62071e-06,
-    (float)6.02696e-06,
-    (float)9.79889e-06,
-    (float)5.66553e-06,
-    (float)5.79519e-06,
-    (float)7.56178e-06,
-    (float)6.45859e-06,
-    (float)8.77764e-06,
-    (float)7.6641e-06,
-    (float)9.74502e-06,
-    (float)9.68495e-06,
-    (float)7.10115e-06,
-    (float)9.37646e-06,
-    (float)6.49742e-06,
-    (float)6.34094e-06,
-    (float)6.8043e-06,
-    (float)5.82591e-06,
-    (float)7.78412e-06,
-    (float)6.49285e-06,
-    (float)8.16252e-06,
-    (float)8.66758e-06,
-    (float)6.99631e-06,
-    (float)8.07077e-06,
-    (float)6.60442e-06,
-    (float)6.86467e-06,
-    (float)6.12616e-06,
-    (float)5.41934e-06,
-    (float)7.83732e-06,
-    (float)5.78686e-06,
-    (float)7.40146e-06,
-    (float)8.04962e-06,
-    (float)6.33772e-06,
-    (float)8.14683e-06,
-    (float)5.75428e-06,
-    (float)6.38228e-06,
-    (float)6.3771e-06,
-    (float)4.33068e-06,
-    (float)7.31145e-06,
-    (float)5.3632e-06,
-    (float)6.28295e-06,
-    (float)8.1722e-06,
-    (float)5.44396e-06,
-    (float)0.342698,
-    (float)0.50836,
-    (float)0.0157314,
-    (float)0.00161708,
-    (float)0.103367,
-    (float)0.00213445,
-    (float)0.00155568,
-    (float)0.0154946,
-    (float)0.00084867,
-    (float)9.66603e-06,
-    (float)0.000592756,
-    (float)0.00235207,
-    (float)6.60111e-05,
-    (float)4.92503e-05,
-    (float)0.00149722,
-    (float)0.000101307,
-    (float)4.01341e-05,
-    (float)0.00065962,
-    (float)0.000129552,
-    (float)8.84135e-05,
-    (float)0.000193731,
-    (float)4.80172e-05,
-    (float)3.79536e-05,
-    (float)1.60148e-05,
-    (float)0.00014707,
-    (float)6.33725e-05,
-    (float)3.28208e-05,
-    (float)0.000252631,
-    (float)6.47774e-05,
-    (float)5.04309e-05,
-    (float)0.00011795,
-    (float)3.3996e-05,
-    (float)3.46602e-05,
-    (float)1.76575e-05,
-    (float)6.01444e-05,
-    (float)5.17086e-05,
-    (float)3.73688e-05,
-    (float)9.10737e-05,
-    (float)6.10872e-05,
-    (float)4.34867e-05,
-    (float)5.40395e-05,
-    (float)3.80298e-05,
-    (float)3.17078e-05,
-    (float)1.95124e-05,
-    (float)3.85663e-05,
-    (float)3.85607e-05,
-    (float)4.15923e-05,
-    (float)4.23007e-05,
-    (float)3.96058e-05,
-    (float)4.20392e-05,
-    (float)2.15764e-05,
-    (float)2.39184e-05,
-    (float)2.27877e-05,
-    (float)1.08418e-05,
-    (float)2.10315e-05,
-    (float)1.86193e-05,
-    (float)2.6972e-05,
-    (float)2.14305e-05,
-    (float)1.91382e-05,
-    (float)3.03473e-05,
-    (float)1.08639e-05,
-    (float)1.31541e-05,
-    (float)1.63966e-05,
-    (float)7.73209e-06,
-    (float)1.29775e-05,
-    (float)1.13097e-05,
-    (float)1.65856e-05,
-    (float)1.37011e-05,
-    (float)9.42019e-06,
-    (float)1.93422e-05,
-    (float)7.57712e-06,
-    (float)6.7394e-06,
-    (float)1.18085e-05,
-    (float)5.72494e-06,
-    (float)7.93419e-06,
-    (float)8.50236e-06,
-    (float)1.078e-05,
-    (float)1.07676e-05,
-    (float)8.43169e-06,
-    (float)1.20153e-05,
-    (float)7.92042e-06,
-    (float)6.43832e-06,
-    (float)7.32027e-06,
-    (float)6.31581e-06,
-    (float)6.93621e-06,
-    (float)6.45308e-06,
-    (float)8.75893e-06,
-    (float)8.90786e-06,
-    (float)7.76702e-06,
-    (float)8.56838e-06,
-    (float)7.41452e-06,
-    (float)6.52995e-06,
-    (float)5.49063e-06,
-    (float)6.48204e-06,
-    (float)6.32202e-06,
-    (float)5.92209e-06,
-    (float)8.75925e-06,
-    (float)7.26011e-06,
-    (float)9.00131e-06,
-    (float)7.84239e-06,
-    (float)6.4019e-06,
-    (float)8.79087e-06,
-    (float)4.94566e-06,
-    (float)6.33877e-06,
-    (float)7.75672e-06,
-    (float)5.62046e-06,
-    (float)8.16778e-06,
-    (float)6.92923e-06,
-    (float)7.55226e-06,
-    (float)6.9068e-06,
-    (float)5.25282e-06,
-    (float)7.08792e-06,
-    (float)4.47125e-06,
-    (float)5.46754e-06,
-    (float)6.54462e-06,
-    (float)5.48911e-06,
-    (float)7.75818e-06,
-    (float)6.46704e-06,
-    (float)7.28451e-06,
-    (float)7.26071e-06,
-    (float)5.28785e-06,
-    (float)6.69188e-06,
-    (float)5.42027e-06,
-    (float)5.39335e-06,
-    (float)6.31896e-06,
-    (float)6.30555e-06,
-    (float)6.72888e-06,
-    (float)6.79163e-06,
-    (float)0.315846,
-    (float)0.539892,
-    (float)0.0172319,
-    (float)0.00266533,
-    (float)0.101373,
-    (float)0.00145165,
-    (float)0.00122525,
-    (float)0.0113322,
-    (float)0.00167775,
-    (float)2.1031e-05,
-    (float)0.000202086,
-    (float)0.00260979,
-    (float)0.000107489,
-    (float)5.65385e-05,
-    (float)0.00123036,
-    (float)0.000136125,
-    (float)6.76115e-05,
-    (float)0.000398903,
-    (float)6.93959e-05,
-    (float)4.88947e-05,
-    (float)4.56209e-05,
-    (float)8.35993e-05,
-    (float)5.12762e-05,
-    (float)1.71563e-05,
-    (float)0.000244611,
-    (float)8.11132e-05,
-    (float)5.24769e-05,
-    (float)0.00015244,
-    (float)3.99198e-05,
-    (float)3.54139e-05,
-    (float)1.72816e-05,
-    (float)5.52844e-05,
-    (float)4.9302e-05,
-    (float)4.10002e-05,
-    (float)8.61168e-05,
-    (float)6.35246e-05,
-    (float)4.91156e-05,
-    (float)4.55185e-05,
-    (float)3.96909e-05,
-    (float)3.38281e-05,
-    (float)2.08272e-05,
-    (float)4.19908e-05,
-    (float)4.27967e-05,
-    (float)5.29468e-05,
-    (float)3.84625e-05,
-    (float)3.90702e-05,
-    (float)4.30213e-05,
-    (float)1.43648e-05,
-    (float)2.3597e-05,
-    (float)2.26298e-05,
-    (float)1.88831e-05,
-    (float)2.51942e-05,
-    (float)2.14092e-05,
-    (float)3.73248e-05,
-    (float)1.90621e-05,
-    (float)1.72726e-05,
-    (float)2.60682e-05,
-    (float)1.00902e-05,
-    (float)1.3423e-05,
-    (float)1.4797e-05,
-    (float)1.76758e-05,
-    (float)1.71195e-05,
-    (float)1.27939e-05,
-    (float)2.21394e-05,
-    (float)1.19993e-05,
-    (float)8.61865e-06,
-    (float)1.33477e-05,
-    (float)7.99535e-06,
-    (float)8.76938e-06,
-    (float)8.66803e-06,
-    (float)1.17254e-05,
-    (float)1.16723e-05,
-    (float)8.99966e-06,
-    (float)1.09749e-05,
-    (float)8.84189e-06,
-    (float)7.01841e-06,
-    (float)6.50972e-06,
-    (float)7.67284e-06,
-    (float)7.68007e-06,
-    (float)7.63294e-06,
-    (float)9.08297e-06,
-    (float)8.75673e-06,
-    (float)8.62847e-06,
-    (float)6.79821e-06,
-    (float)6.79801e-06,
-    (float)6.74535e-06,
-    (float)4.36201e-06,
-    (float)7.03692e-06,
-    (float)6.76207e-06,
-    (float)6.41709e-06,
-    (float)8.3193e-06,
-    (float)6.75389e-06,
-    (float)7.96369e-06,
-    (float)6.22672e-06,
-    (float)5.8223e-06,
-    (float)7.24894e-06,
-    (float)5.68102e-06,
-    (float)6.80407e-06,
-    (float)7.05734e-06,
-    (float)7.29424e-06,
-    (float)6.74173e-06,
-    (float)5.90729e-06,
-    (float)7.04322e-06,
-    (float)4.70157e-06,
-    (float)5.36713e-06,
-    (float)6.38916e-06,
-    (float)4.97576e-06,
-    (float)7.32381e-06,
-    (float)6.78805e-06,
-    (float)6.42109e-06,
-    (float)7.9693e-06,
-    (float)5.77042e-06,
-    (float)6.13585e-06,
-    (float)6.63716e-06,
-    (float)5.01134e-06,
-    (float)6.11928e-06,
-    (float)6.44844e-06,
-    (float)5.4666e-06,
-    (float)6.47998e-06,
-    (float)5.93826e-06,
-    (float)5.32099e-06,
-    (float)5.86376e-06,
-    (float)5.20931e-06,
-    (float)5.33573e-06,
-    (float)6.23872e-06,
-    (float)6.01655e-06,
-    (float)6.43715e-06,
-    (float)7.04848e-06,
-    (float)0.28871,
-    (float)0.572219,
-    (float)0.0185176,
-    (float)0.00379581,
-    (float)0.0981571,
-    (float)0.000876001,
-    (float)0.000828044,
-    (float)0.00776119,
-    (float)0.00263168,
-    (float)0.00010348,
-    (float)0.000106077,
-    (float)0.00252937,
-    (float)0.000142152,
-    (float)6.86684e-05,
-    (float)0.000906809,
-    (float)0.000122981,
-    (float)6.54569e-05,
-    (float)0.000175316,
-    (float)3.78412e-05,
-    (float)3.19559e-05,
-    (float)1.09539e-06,
-    (float)0.000182252,
-    (float)8.84726e-05,
-    (float)4.96156e-05,
-    (float)0.000208143,
-    (float)5.66606e-05,
-    (float)4.28776e-05,
-    (float)2.94195e-05,
-    (float)4.58844e-05,
-    (float)4.07162e-05,
-    (float)3.72619e-05,
-    (float)8.12891e-05,
-    (float)6.10017e-05,
-    (float)5.98069e-05,
-    (float)4.58772e-05,
-    (float)3.88004e-05,
-    (float)3.56864e-05,
-    (float)2.01902e-05,
-    (float)4.22552e-05,
-    (float)4.1218e-05,
-    (float)6.13306e-05,
-    (float)3.77824e-05,
-    (float)3.75453e-05,
-    (float)4.41602e-05,
-    (float)1.29321e-05,
-    (float)2.54117e-05,
-    (float)2.0437e-05,
-    (float)2.75175e-05,
-    (float)2.85139e-05,
-    (float)2.00982e-05,
-    (float)4.22041e-05,
-    (float)1.70036e-05,
-    (float)1.61401e-05,
-    (float)2.27101e-05,
-    (float)1.3979e-05,
-    (float)1.8307e-05,
-    (float)1.66134e-05,
-    (float)2.42783e-05,
-    (float)1.86938e-05,
-    (float)1.36948e-05,
-    (float)1.83171e-05,
-    (float)1.05842e-05,
-    (float)1.00617e-05,
-    (float)8.80994e-06,
-    (float)1.26313e-05,
-    (float)1.21705e-05,
-    (float)1.05604e-05,
-    (float)1.31616e-05,
-    (float)1.01332e-05,
-    (float)9.74153e-06,
-    (float)6.97816e-06,
-    (float)8.42223e-06,
-    (float)8.86871e-06,
-    (float)8.08031e-06,
-    (float)1.02197e-05,
-    (float)8.74074e-06,
-    (float)1.09054e-05,
-    (float)6.44473e-06,
-    (float)6.41686e-06,
-    (float)8.1165e-06,
-    (float)3.65593e-06,
-    (float)7.42386e-06,
-    (float)6.12301e-06,
-    (float)6.43104e-06,
-    (float)8.10394e-06,
-    (float)4.89089e-06,
-    (float)8.02482e-06,
-    (float)5.43404e-06,
-    (float)5.3887e-06,
-    (float)7.04532e-06,
-    (float)6.15097e-06,
-    (float)7.65486e-06,
-    (float)6.19278e-06,
-    (float)7.81494e-06,
-    (float)6.05616e-06,
-    (float)5.20928e-06,
-    (float)6.40464e-06,
-    (float)4.02402e-06,
-    (float)6.25285e-06,
-    (float)5.49973e-06,
-    (float)5.3503e-06,
-    (float)7.31255e-06,
-    (float)5.75752e-06,
-    (float)6.07199e-06,
-    (float)5.89585e-06,
-    (float)6.05257e-06,
-    (float)5.52416e-06,
-    (float)6.06387e-06,
-    (float)6.17019e-06,
-    (float)5.73165e-06,
-    (float)6.71978e-06,
-    (float)4.95935e-06,
-    (float)6.00016e-06,
-    (float)5.60269e-06,
-    (float)4.51698e-06,
-    (float)6.20702e-06,
-    (float)5.23099e-06,
-    (float)6.36626e-06,
-    (float)5.82149e-06,
-    (float)6.07331e-06,
-    (float)6.44368e-06,
-    (float)4.94123e-06,
-    (float)6.24965e-06,
-    (float)4.78037e-06,
-    (float)5.84739e-06,
-    (float)5.62758e-06,
-    (float)4.65781e-06,
-    (float)7.08961e-06,
-    (float)0.261297,
-    (float)0.60542,
-    (float)0.0194497,
-    (float)0.00492823,
-    (float)0.093815,
-    (float)0.000530846,
-    (float)0.000456646,
-    (float)0.00489143,
-    (float)0.00351589,
-    (float)0.000214444,
-    (float)0.000150051,
-    (float)0.00217084,
-    (float)0.00016835,
-    (float)7.4935e-05,
-    (float)0.000591646,
-    (float)7.5373e-05,
-    (float)3.99274e-05,
-    (float)3.86107e-05,
-    (float)7.82599e-05,
-    (float)5.87681e-05,
-    (float)2.76525e-05,
-    (float)0.000231091,
-    (float)9.20433e-05,
-    (float)5.7348e-05,
-    (float)7.92838e-05,
-    (float)4.00347e-05,
-    (float)3.37398e-05,
-    (float)1.89538e-05,
-    (float)6.85576e-05,
-    (float)5.70735e-05,
-    (float)6.99934e-05,
-    (float)5.04665e-05,
-    (float)4.09525e-05,
-    (float)4.06317e-05,
-    (float)1.57892e-05,
-    (float)3.68695e-05,
-    (float)3.83879e-05,
-    (float)6.53537e-05,
-    (float)3.84127e-05,
-    (float)3.89311e-05,
-    (float)4.87221e-05,
-    (float)1.39344e-05,
-    (float)2.68046e-05,
-    (float)1.82196e-05,
-    (float)3.19014e-05,
-    (float)2.98161e-05,
-    (float)1.84733e-05,
-    (float)4.10381e-05,
-    (float)1.74243e-05,
-    (float)1.66405e-05,
-    (float)1.95544e-05,
-    (float)1.98834e-05,
-    (float)2.21991e-05,
-    (float)1.9844e-05,
-    (float)2.54041e-05,
-    (float)1.85863e-05,
-    (float)1.51609e-05,
-    (float)1.25587e-05,
-    (float)1.22673e-05,
-    (float)1.22347e-05,
-    (float)1.03206e-05,
-    (float)1.45932e-05,
-    (float)1.30883e-05,
-    (float)1.35529e-05,
-    (float)9.22031e-06,
-    (float)1.00758e-05,
-    (float)9.92647e-06,
-    (float)7.84403e-06,
-    (float)1.14823e-05,
-    (float)8.73742e-06,
-    (float)1.29444e-05,
-    (float)8.08696e-06,
-    (float)6.89874e-06,
-    (float)9.83207e-06,
-    (float)4.11836e-06,
-    (float)7.33185e-06,
-    (float)6.44325e-06,
-    (float)6.54532e-06,
-    (float)7.9548e-06,
-    (float)5.29911e-06,
-    (float)7.45296e-06,
-    (float)5.4825e-06,
-    (float)5.80984e-06,
-    (float)5.98305e-06,
-    (float)6.84652e-06,
-    (float)7.50261e-06,
-    (float)6.00036e-06,
-    (float)7.57264e-06,
-    (float)5.53799e-06,
-    (float)5.33276e-06,
-    (float)5.26744e-06,
-    (float)4.48093e-06,
-    (float)5.48969e-06,
-    (float)5.27364e-06,
-    (float)5.01279e-06,
-    (float)5.55935e-06,
-    (float)6.09266e-06,
-    (float)4.3384e-06,
-    (float)5.899e-06,
-    (float)6.01012e-06,
-    (float)4.96981e-06,
-    (float)7.25347e-06,
-    (float)5.0892e-06,
-    (float)6.27157e-06,
-    (float)5.85419e-06,
-    (float)4.30999e-06,
-    (float)5.861e-06,
-    (float)4.65704e-06,
-    (float)5.26362e-06,
-    (float)5.01063e-06,
-    (float)5.5037e-06,
-    (float)5.47948e-06,
-    (float)4.83273e-06,
-    (float)5.77409e-06,
-    (float)4.8108e-06,
-    (float)5.88621e-06,
-    (float)5.0843e-06,
-    (float)5.3432e-06,
-    (float)6.29441e-06,
-    (float)4.86722e-06,
-    (float)5.69075e-06,
-    (float)5.2029e-06,
-    (float)5.43789e-06,
-    (float)5.05549e-06,
-    (float)5.01491e-06,
-    (float)5.56494e-06,
-    (float)4.98258e-06,
-    (float)5.35853e-06,
-    (float)0.233964,
-    (float)0.639202,
-    (float)0.0200063,
-    (float)0.00594325,
-    (float)0.0884203,
-    (float)0.000518742,
-    (float)0.000174601,
-    (float)0.00275781,
-    (float)0.00411691,
-    (float)0.000313412,
-    (float)0.000224001,
-    (float)0.00168599,
-    (float)0.000168212,
-    (float)6.89006e-05,
-    (float)0.000327527,
-    (float)3.70314e-05,
-    (float)2.2833e-05,
-    (float)9.17088e-07,
-    (float)0.000153297,
-    (float)0.000101648,
-    (float)6.15091e-05,
-    (float)0.000172693,
-    (float)6.17456e-05,
-    (float)3.88289e-05,
-    (float)5.70889e-06,
-    (float)5.35943e-05,
-    (float)4.53174e-05,
-    (float)6.60601e-05,
-    (float)5.67115e-05,
-    (float)4.82597e-05,
-    (float)5.36165e-05,
-    (float)1.28932e-05,
-    (float)2.91786e-05,
-    (float)3.48025e-05,
-    (float)5.75549e-05,
-    (float)3.89184e-05,
-    (float)4.02627e-05,
-    (float)5.84936e-05,
-    (float)1.50535e-05,
-    (float)2.61403e-05,
-    (float)1.78237e-05,
-    (float)3.1441e-05,
-    (float)3.05426e-05,
-    (float)1.65232e-05,
-    (float)4.07698e-05,
-    (float)1.91722e-05,
-    (float)1.59083e-05,
-    (float)1.89556e-05,
-    (float)2.36719e-05,
-    (float)2.46147e-05,
-    (float)2.29711e-05,
-    (float)2.45371e-05,
-    (float)1.94317e-05,
-    (float)1.62396e-05,
-    (float)9.77682e-06,
-    (float)1.39766e-05,
-    (float)1.4242e-05,
-    (float)1.29371e-05,
-    (float)1.30374e-05,
-    (float)1.31757e-05,
-    (float)1.34889e-05,
-    (float)7.27572e-06,
-    (float)1.11644e-05,
-    (float)1.05827e-05,
-    (float)1.27295e-05,
-    (float)1.19306e-05,
-    (float)8.73391e-06,
-    (float)1.40739e-05,
-    (float)5.93535e-06,
-    (float)6.50951e-06,
-    (float)8.23044e-06,
-    (float)6.18992e-06,
-    (float)8.44577e-06,
-    (float)5.9418e-06,
-    (float)7.52945e-06,
-    (float)6.64984e-06,
-    (float)4.92348e-06,
-    (float)5.86646e-06,
-    (float)6.7354e-06,
-    (float)7.15286e-06,
-    (float)6.40465e-06,
-    (float)7.24394e-06,
-    (float)6.40836e-06,
-    (float)5.50539e-06,
-    (float)4.59732e-06,
-    (float)4.83801e-06,
-    (float)5.25302e-06,
-    (float)4.86107e-06,
-    (float)4.77976e-06,
-    (float)5.16522e-06,
-    (float)5.63121e-06,
-    (float)3.9374e-06,
-    (float)5.17895e-06,
-    (float)5.79397e-06,
-    (float)5.1691e-06,
-    (float)6.20536e-06,
-    (float)4.96e-06,
-    (float)5.95486e-06,
-    (float)4.83148e-06,
-    (float)4.01982e-06,
-    (float)5.12356e-06,
-    (float)4.38269e-06,
-    (float)4.89607e-06,
-    (float)4.41386e-06,
-    (float)4.77196e-06,
-    (float)5.14248e-06,
-    (float)4.14144e-06,
-    (float)4.98677e-06,
-    (float)5.27051e-06,
-    (float)5.22425e-06,
-    (float)5.38283e-06,
-    (float)5.18866e-06,
-    (float)5.46496e-06,
-    (float)5.336e-06,
-    (float)4.54984e-06,
-    (float)4.96921e-06,
-    (float)5.3527e-06,
-    (float)4.29777e-06,
-    (float)4.54155e-06,
-    (float)4.73731e-06,
-    (float)4.35104e-06,
-    (float)4.56134e-06,
-    (float)4.56622e-06,
-    (float)5.02491e-06,
-    (float)5.39112e-06,
-    (float)4.95412e-06,
-    (float)5.22308e-06,
-    (float)5.76093e-06,
-    (float)0.206986,
-    (float)0.673385,
-    (float)0.0201788,
-    (float)0.00672531,
-    (float)0.0820377,
-    (float)0.000880769,
-    (float)2.44401e-05,
-    (float)0.00133181,
-    (float)0.00430345,
-    (float)0.000368859,
-    (float)0.000271329,
-    (float)0.0012249,
-    (float)0.000135756,
-    (float)5.22443e-05,
-    (float)0.000133751,
-    (float)4.16313e-05,
-    (float)3.80882e-05,
-    (float)3.24564e-05,
-    (float)0.000196075,
-    (float)0.000109328,
-    (float)6.38694e-05,
-    (float)6.27274e-05,
-    (float)4.32122e-05,
-    (float)3.02736e-05,
-    (float)3.28273e-05,
-    (float)6.17162e-05,
-    (float)5.11551e-05,
-    (float)7.30124e-05,
-    (float)2.07856e-05,
-    (float)2.60826e-05,
-    (float)3.21712e-05,
-    (float)3.34098e-05,
-    (float)3.76244e-05,
-    (float)4.02703e-05,
-    (float)7.17427e-05,
-    (float)1.77615e-05,
-    (float)2.78809e-05,
-    (float)2.055e-05,
-    (float)2.53514e-05,
-    (float)3.16195e-05,
-    (float)1.49709e-05,
-    (float)4.18719e-05,
-    (float)1.94654e-05,
-    (float)1.48419e-05,
-    (float)1.87395e-05,
-    (float)2.39525e-05,
-    (float)2.40789e-05,
-    (float)2.56618e-05,
-    (float)2.47219e-05,
-    (float)1.89484e-05,
-    (float)1.74018e-05,
-    (float)8.90733e-06,
-    (float)1.57893e-05,
-    (float)1.4732e-05,
-    (float)1.50225e-05,
-    (float)1.26893e-05,
-    (float)1.27089e-05,
-    (float)1.32727e-05,
-    (float)7.15764e-06,
-    (float)1.35825e-05,
-    (float)1.08636e-05,
-    (float)1.53824e-05,
-    (float)1.16872e-05,
-    (float)8.41701e-06,
-    (float)1.25783e-05,
-    (float)5.43894e-06,
-    (float)7.97722e-06,
-    (float)7.70035e-06,
-    (float)7.88113e-06,
-    (float)7.98608e-06,
-    (float)5.73862e-06,
-    (float)6.91349e-06,
-    (float)5.68087e-06,
-    (float)6.39043e-06,
-    (float)6.44449e-06,
-    (float)7.84918e-06,
-    (float)7.41512e-06,
-    (float)6.38351e-06,
-    (float)5.5552e-06,
-    (float)5.31944e-06,
-    (float)4.98698e-06,
-    (float)4.1866e-06,
-    (float)5.91846e-06,
-    (float)4.29699e-06,
-    (float)5.39125e-06,
-    (float)3.83813e-06,
-    (float)4.49298e-06,
-    (float)5.61221e-06,
-    (float)3.76223e-06,
-    (float)6.65285e-06,
-    (float)4.56987e-06,
-    (float)5.07337e-06,
-    (float)4.60789e-06,
-    (float)3.77926e-06,
-    (float)4.97932e-06,
-    (float)3.71545e-06,
-    (float)4.89111e-06,
-    (float)4.41684e-06,
-    (float)4.36381e-06,
-    (float)4.17393e-06,
-    (float)4.11758e-06,
-    (float)4.47632e-06,
-    (float)4.45281e-06,
-    (float)4.84216e-06,
-    (float)4.45063e-06,
-    (float)5.02372e-06,
-    (float)4.16415e-06,
-    (float)4.58936e-06,
-    (float)4.52433e-06,
-    (float)4.62318e-06,
-    (float)4.79779e-06,
-    (float)4.05118e-06,
-    (float)4.90906e-06,
-    (float)3.70624e-06,
-    (float)4.19574e-06,
-    (float)4.04797e-06,
-    (float)4.64403e-06,
-    (float)4.83198e-06,
-    (float)4.04121e-06,
-    (float)5.79254e-06,
-    (float)4.19504e-06,
-    (float)4.95686e-06,
-    (float)4.86767e-06,
-    (float)4.46117e-06,
-    (float)5.08512e-06,
-    (float)3.93517e-06,
-    (float)4.21795e-06,
-    (float)4.16165e-06,
-    (float)0.180567,
-    (float)0.707795,
-    (float)0.0199149,
-    (float)0.00724686,
-    (float)0.0748006,
-    (float)0.00161678,
-    (float)1.95498e-05,
-    (float)0.000519421,
-    (float)0.00405124,
-    (float)0.000377414,
-    (float)0.000274326,
-    (float)0.000852112,
-    (float)8.52123e-05,
-    (float)2.89103e-05,
-    (float)2.58792e-05,
-    (float)8.2772e-05,
-    (float)7.54915e-05,
-    (float)7.81045e-05,
-    (float)0.000170675,
-    (float)7.89358e-05,
-    (float)4.21942e-05,
-    (float)2.10741e-06,
-    (float)5.6736e-05,
-    (float)3.77619e-05,
-    (float)7.87235e-05,
-    (float)3.8192e-05,
-    (float)3.40261e-05,
-    (float)4.23976e-05,
-    (float)8.94571e-06,
-    (float)2.76867e-05,
-    (float)3.30875e-05,
-    (float)7.19014e-05,
-    (float)2.58367e-05,
-    (float)3.09702e-05,
-    (float)3.07271e-05,
-    (float)1.61725e-05,
-    (float)3.14857e-05,
-    (float)1.44137e-05,
-    (float)3.98063e-05,
-    (float)2.21759e-05,
-    (float)1.35264e-05,
-    (float)1.79188e-05,
-    (float)2.05287e-05,
-    (float)2.12816e-05,
-    (float)2.8449e-05,
-    (float)2.54574e-05,
-    (float)1.97562e-05,
-    (float)2.02238e-05,
-    (float)8.40545e-06,
-    (float)1.60308e-05,
-    (float)1.39367e-05,
-    (float)1.60505e-05,
-    (float)1.24627e-05,
-    (float)1.21053e-05,
-    (float)1.23651e-05,
-    (float)8.49534e-06,
-    (float)1.47091e-05,
-    (float)1.04148e-05,
-    (float)1.66729e-05,
-    (float)1.10208e-05,
-    (float)8.6261e-06,
-    (float)1.03338e-05,
-    (float)6.84441e-06,
-    (float)9.25165e-06,
-    (float)7.99548e-06,
-    (float)8.24519e-06,
-    (float)7.23078e-06,
-    (float)6.50999e-06,
-    (float)5.49394e-06,
-    (float)6.99943e-06,
-    (float)7.14197e-06,
-    (float)7.66735e-06,
-    (float)7.14518e-06,
-    (float)5.86869e-06,
-    (float)6.37848e-06,
-    (float)4.1561e-06,
-    (float)5.88479e-06,
-    (float)4.59376e-06,
-    (float)5.34255e-06,
-    (float)4.64118e-06,
-    (float)3.64941e-06,
-    (float)4.86478e-06,
-    (float)3.63716e-06,
-    (float)5.92114e-06,
-    (float)4.58561e-06,
-    (float)5.3661e-06,
-    (float)5.13658e-06,
-    (float)3.71258e-06,
-    (float)4.13061e-06,
-    (float)3.41901e-06,
-    (float)4.41414e-06,
-    (float)3.9543e-06,
-    (float)3.83218e-06,
-    (float)3.90609e-06,
-    (float)3.93348e-06,
-    (float)3.37459e-06,
-    (float)4.26252e-06,
-    (float)4.06126e-06,
-    (float)4.2877e-06,
-    (float)4.35383e-06,
-    (float)3.19311e-06,
-    (float)4.57816e-06,
-    (float)3.57832e-06,
-    (float)4.27017e-06,
-    (float)4.46635e-06,
-    (float)4.16282e-06,
-    (float)4.38039e-06,
-    (float)3.57853e-06,
-    (float)3.61089e-06,
-    (float)3.45897e-06,
-    (float)4.21748e-06,
-    (float)3.2549e-06,
-    (float)4.03503e-06,
-    (float)4.222e-06,
-    (float)3.82248e-06,
-    (float)4.7229e-06,
-    (float)4.27514e-06,
-    (float)4.8921e-06,
-    (float)4.58078e-06,
-    (float)3.88801e-06,
-    (float)3.63058e-06,
-    (float)4.06038e-06,
-    (float)3.43569e-06,
-    (float)4.13266e-06,
-    (float)4.18143e-06,
-    (float)4.12468e-06,
-    (float)4.79243e-06,
-    (float)3.51447e-06,
-    (float)0.155113,
-    (float)0.742071,
-    (float)0.0192052,
-    (float)0.00744468,
-    (float)0.0668733,
-    (float)0.00265049,
-    (float)0.000140796,
-    (float)0.000192557,
-    (float)0.0034202,
-    (float)0.000345934,
-    (float)0.00023595,
-    (float)0.000586759,
-    (float)3.99626e-05,
-    (float)1.52268e-05,
-    (float)1.06769e-05,
-    (float)0.000123273,
-    (float)0.000107917,
-    (float)9.30751e-05,
-    (float)9.4545e-05,
-    (float)4.68393e-05,
-    (float)2.34819e-05,
-    (float)2.73134e-05,
-    (float)6.11063e-05,
-    (float)3.96701e-05,
-    (float)7.43068e-05,
-    (float)9.10134e-06,
-    (float)1.68152e-05,
-    (float)2.42417e-05,
-    (float)4.19546e-05,
-    (float)3.45002e-05,
-    (float)3.55639e-05,
-    (float)5.26047e-05,
-    (float)1.09642e-05,
-    (float)2.65315e-05,
-    (float)1.20629e-05,
-    (float)3.17258e-05,
-    (float)2.84742e-05,
-    (float)1.3212e-05,
-    (float)2.03239e-05,
-    (float)1.55085e-05,
-    (float)1.67588e-05,
-    (float)2.51945e-05,
-    (float)2.5421e-05,
-    (float)2.1742e-05,
-    (float)2.49535e-05,
-    (float)8.58148e-06,
-    (float)1.50429e-05,
-    (float)1.35754e-05,
-    (float)1.59099e-05,
-    (float)1.26662e-05,
-    (float)1.09964e-05,
-    (float)1.24039e-05,
-    (float)8.77566e-06,
-    (float)1.40887e-05,
-    (float)1.04074e-05,
-    (float)1.67639e-05,
-    (float)1.16456e-05,
-    (float)8.49727e-06,
-    (float)9.32017e-06,
-    (float)8.31231e-06,
-    (float)9.52614e-06,
-    (float)8.53559e-06,
-    (float)7.22654e-06,
-    (float)7.08337e-06,
-    (float)6.50403e-06,
-    (float)5.19854e-06,
-    (float)7.48687e-06,
-    (float)7.71294e-06,
-    (float)8.20727e-06,
-    (float)5.41836e-06,
-    (float)5.76986e-06,
-    (float)5.90565e-06,
-    (float)4.64271e-06,
-    (float)6.40534e-06,
-    (float)4.60363e-06,
-    (float)5.54545e-06,
-    (float)3.90094e-06,
-    (float)3.43984e-06,
-    (float)4.48368e-06,
-    (float)4.30548e-06,
-    (float)5.52968e-06,
-    (float)4.22467e-06,
-    (float)4.29905e-06,
-    (float)3.96394e-06,
-    (float)3.73657e-06,
-    (float)3.59961e-06,
-    (float)3.85125e-06,
-    (float)4.0821e-06,
-    (float)3.5396e-06,
-    (float)2.9401e-06,
-    (float)3.42066e-06,
-    (float)3.6845e-06,
-    (float)3.67365e-06,
-    (float)3.95628e-06,
-    (float)3.36332e-06,
-    (float)3.75316e-06,
-    (float)3.02183e-06,
-    (float)3.32421e-06,
-    (float)3.74976e-06,
-    (float)3.66112e-06,
-    (float)3.96495e-06,
-    (float)3.18334e-06,
-    (float)3.16145e-06,
-    (float)3.29446e-06,
-    (float)3.72132e-06,
-    (float)3.2114e-06,
-    (float)3.21279e-06,
-    (float)3.87033e-06,
-    (float)3.05718e-06,
-    (float)3.35253e-06,
-    (float)3.96837e-06,
-    (float)4.07189e-06,
-    (float)4.47352e-06,
-    (float)3.48389e-06,
-    (float)3.27697e-06,
-    (float)3.66515e-06,
-    (float)3.24258e-06,
-    (float)3.24296e-06,
-    (float)3.67768e-06,
-    (float)3.67284e-06,
-    (float)3.77709e-06,
-    (float)3.36872e-06,
-    (float)3.73962e-06,
-    (float)4.26297e-06,
-    (float)4.12184e-06,
-    (float)3.47004e-06,
-    (float)3.25706e-06,
-    (float)3.9968e-06,
-    (float)0.130834,
-    (float)0.775929,
-    (float)0.0180567,
-    (float)0.00731635,
-    (float)0.0584776,
-    (float)0.00384971,
-    (float)0.000343649,
-    (float)0.000201439,
-    (float)0.0026075,
-    (float)0.00028304,
-    (float)0.000173431,
-    (float)0.000387865,
-    (float)2.21218e-05,
-    (float)2.2757e-05,
-    (float)6.30516e-05,
-    (float)0.00013551,
-    (float)0.000106283,
-    (float)7.08903e-05,
-    (float)2.29354e-05,
-    (float)4.51104e-05,
-    (float)2.30855e-05,
-    (float)7.8945e-05,
-    (float)3.65639e-05,
-    (float)2.53408e-05,
-    (float)3.81512e-05,
-    (float)6.17762e-06,
-    (float)2.22499e-05,
-    (float)2.81716e-05,
-    (float)6.66391e-05,
-    (float)2.00947e-05,
-    (float)2.54916e-05,
-    (float)1.56241e-05,
-    (float)1.79883e-05,
-    (float)3.26895e-05,
-    (float)1.28633e-05,
-    (float)2.50637e-05,
-    (float)1.47643e-05,
-    (float)1.14777e-05,
-    (float)1.5629e-05,
-    (float)2.28289e-05,
-    (float)2.12551e-05,
-    (float)3.13178e-05,
-    (float)1.07936e-05,
-    (float)1.4153e-05,
-    (float)1.43993e-05,
-    (float)1.24071e-05,
-    (float)1.31254e-05,
-    (float)1.00389e-05,
-    (float)1.31315e-05,
-    (float)7.44292e-06,
-    (float)1.31304e-05,
-    (float)9.85485e-06,
-    (float)1.66593e-05,
-    (float)1.177e-05,
-    (float)8.42942e-06,
-    (float)9.87144e-06,
-    (float)8.4386e-06,
-    (float)9.26264e-06,
-    (float)8.94761e-06,
-    (float)6.9546e-06,
-    (float)7.06083e-06,
-    (float)6.34007e-06,
-    (float)5.03422e-06,
-    (float)8.00443e-06,
-    (float)6.88263e-06,
-    (float)8.19361e-06,
-    (float)4.84005e-06,
-    (float)6.08313e-06,
-    (float)5.83964e-06,
-    (float)4.42043e-06,
-    (float)6.67708e-06,
-    (float)4.0577e-06,
-    (float)4.91435e-06,
-    (float)3.81516e-06,
-    (float)3.85602e-06,
-    (float)4.41032e-06,
-    (float)4.49981e-06,
-    (float)4.71788e-06,
-    (float)3.9492e-06,
-    (float)3.95493e-06,
-    (float)3.47674e-06,
-    (float)4.0943e-06,
-    (float)3.55482e-06,
-    (float)3.45325e-06,
-    (float)3.20759e-06,
-    (float)3.16017e-06,
-    (float)2.45658e-06,
-    (float)3.63868e-06,
-    (float)2.90187e-06,
-    (float)3.49152e-06,
-    (float)3.22436e-06,
-    (float)2.46057e-06,
-    (float)3.69764e-06,
-    (float)2.73973e-06,
-    (float)3.71105e-06,
-    (float)3.10087e-06,
-    (float)3.08763e-06,
-    (float)2.87381e-06,
-    (float)2.87584e-06,
-    (float)2.56412e-06,
-    (float)2.96846e-06,
-    (float)3.38515e-06,
-    (float)2.40167e-06,
-    (float)2.96706e-06,
-    (float)2.92769e-06,
-    (float)3.14457e-06,
-    (float)3.34845e-06,
-    (float)3.3521e-06,
-    (float)3.09598e-06,
-    (float)3.49158e-06,
-    (float)2.69692e-06,
-    (float)3.09253e-06,
-    (float)3.29141e-06,
-    (float)2.99127e-06,
-    (float)3.34843e-06,
-    (float)2.58499e-06,
-    (float)3.66984e-06,
-    (float)2.94495e-06,
-    (float)3.51017e-06,
-    (float)3.23052e-06,
-    (float)2.89505e-06,
-    (float)3.35309e-06,
-    (float)2.97373e-06,
-    (float)3.04362e-06,
-    (float)3.5918e-06,
-    (float)3.55066e-06,
-    (float)2.92308e-06,
-    (float)3.8533e-06,
-    (float)0.108059,
-    (float)0.808984,
-    (float)0.0165223,
-    (float)0.00688468,
-    (float)0.0498175,
-    (float)0.0050308,
-    (float)0.000569507,
-    (float)0.000390402,
-    (float)0.00180596,
-    (float)0.000207383,
-    (float)0.000108555,
-    (float)0.000223647,
-    (float)3.45965e-05,
-    (float)4.70491e-05,
-    (float)0.000130402,
-    (float)0.000117094,
-    (float)7.51046e-05,
-    (float)3.4939e-05,
-    (float)9.66319e-07,
-    (float)6.11274e-05,
-    (float)2.56416e-05,
-    (float)8.95653e-05,
-    (float)8.68261e-06,
-    (float)1.00038e-05,
-    (float)1.62074e-05,
-    (float)3.01079e-05,
-    (float)3.03075e-05,
-    (float)3.01602e-05,
-    (float)4.12385e-05,
-    (float)9.38476e-06,
-    (float)2.62077e-05,
-    (float)9.29992e-06,
-    (float)2.35131e-05,
-    (float)2.19288e-05,
-    (float)9.27307e-06,
-    (float)9.88692e-06,
-    (float)1.67718e-05,
-    (float)1.68058e-05,
-    (float)3.10937e-05,
-    (float)1.40026e-05,
-    (float)1.45394e-05,
-    (float)1.75986e-05,
-    (float)7.8405e-06,
-    (float)1.42257e-05,
-    (float)9.53657e-06,
-    (float)1.3805e-05,
-    (float)5.66935e-06,
-    (float)1.1281e-05,
-    (float)9.28614e-06,
-    (float)1.42118e-05,
-    (float)1.21576e-05,
-    (float)8.66587e-06,
-    (float)9.8757e-06,
-    (float)8.26192e-06,
-    (float)8.00885e-06,
-    (float)9.15734e-06,
-    (float)6.973e-06,
-    (float)6.82555e-06,
-    (float)6.64397e-06,
-    (float)5.08617e-06,
-    (float)7.89036e-06,
-    (float)6.0977e-06,
-    (float)8.01132e-06,
-    (float)4.09835e-06,
-    (float)6.88435e-06,
-    (float)5.00997e-06,
-    (float)4.57498e-06,
-    (float)6.42112e-06,
-    (float)3.67399e-06,
-    (float)4.6334e-06,
-    (float)4.20766e-06,
-    (float)3.87278e-06,
-    (float)4.52347e-06,
-    (float)3.98818e-06,
-    (float)4.0246e-06,
-    (float)3.91299e-06,
-    (float)3.18634e-06,
-    (float)3.69467e-06,
-    (float)3.35287e-06,
-    (float)3.54366e-06,
-    (float)2.52775e-06,
-    (float)3.19565e-06,
-    (float)2.98453e-06,
-    (float)2.38283e-06,
-    (float)3.73258e-06,
-    (float)2.49418e-06,
-    (float)3.27665e-06,
-    (float)2.28268e-06,
-    (float)2.74921e-06,
-    (float)2.84757e-06,
-    (float)2.59904e-06,
-    (float)2.82461e-06,
-    (float)2.59163e-06,
-    (float)2.4148e-06,
-    (float)2.26657e-06,
-    (float)2.58664e-06,
-    (float)2.36606e-06,
-    (float)2.54764e-06,
-    (float)2.6021e-06,
-    (float)2.42018e-06,
-    (float)2.51169e-06,
-    (float)3.25413e-06,
-    (float)2.23458e-06,
-    (float)2.94876e-06,
-    (float)2.31283e-06,
-    (float)2.67187e-06,
-    (float)2.48988e-06,
-    (float)2.49238e-06,
-    (float)3.0191e-06,
-    (float)2.5516e-06,
-    (float)2.74965e-06,
-    (float)2.14883e-06,
-    (float)2.99629e-06,
-    (float)2.68573e-06,
-    (float)2.28502e-06,
-    (float)2.74697e-06,
-    (float)2.80368e-06,
-    (float)2.50832e-06,
-    (float)3.38859e-06,
-    (float)2.80078e-06,
-    (float)2.99022e-06,
-    (float)3.12643e-06,
-    (float)2.74469e-06,
-    (float)2.63269e-06,
-    (float)2.80665e-06,
-    (float)2.95263e-06,
-    (float)2.38092e-06,
-    (float)2.82254e-06,
-    (float)0.0870701,
-    (float)0.84079,
-    (float)0.0146608,
-    (float)0.00620372,
-    (float)0.0411685,
-    (float)0.00598799,
-    (float)0.000766749,
-    (float)0.000625009,
-    (float)0.00119869,
-    (float)0.000130415,
-    (float)5.51108e-05,
-    (float)9.05701e-05,
-    (float)5.51594e-05,
-    (float)7.38838e-05,
-    (float)0.000161494,
-    (float)8.63857e-05,
-    (float)3.99365e-05,
-    (float)1.37004e-05,
-    (float)3.65141e-05,
-    (float)5.61017e-05,
-    (float)1.92478e-05,
-    (float)5.33913e-05,
-    (float)2.16855e-06,
-    (float)8.4869e-06,
-    (float)1.71678e-05,
-    (float)5.32791e-05,
-    (float)2.04278e-05,
-    (float)2.20807e-05,
-    (float)1.01359e-05,
-    (float)1.46772e-05,
-    (float)2.94943e-05,
-    (float)9.41319e-06,
-    (float)1.26306e-05,
-    (float)1.19879e-05,
-    (float)8.72847e-06,
-    (float)1.92279e-05,
-    (float)1.67855e-05,
-    (float)1.50519e-05,
-    (float)2.34571e-05,
-    (float)5.30972e-06,
-    (float)1.42578e-05,
-    (float)1.06589e-05,
-    (float)1.21027e-05,
-    (float)5.843e-06,
-    (float)8.41457e-06,
-    (float)7.63583e-06,
-    (float)1.04884e-05,
-    (float)1.29169e-05,
-    (float)8.91374e-06,
-    (float)1.02506e-05,
-    (float)7.52118e-06,
-    (float)7.20773e-06,
-    (float)8.75967e-06,
-    (float)6.42371e-06,
-    (float)6.29373e-06,
-    (float)6.82933e-06,
-    (float)4.95969e-06,
-    (float)7.2164e-06,
-    (float)5.12086e-06,
-    (float)7.73168e-06,
-    (float)3.70621e-06,
-    (float)6.41873e-06,
-    (float)4.99348e-06,
-    (float)4.33417e-06,
-    (float)6.06305e-06,
-    (float)3.57212e-06,
-    (float)4.24215e-06,
-    (float)4.90865e-06,
-    (float)3.51364e-06,
-    (float)4.56869e-06,
-    (float)3.43227e-06,
-    (float)3.70204e-06,
-    (float)3.41499e-06,
-    (float)3.02529e-06,
-    (float)3.08335e-06,
-    (float)3.3089e-06,
-    (float)3.29818e-06,
-    (float)2.18795e-06,
-    (float)3.40759e-06,
-    (float)2.36163e-06,
-    (float)2.33355e-06,
-    (float)3.23145e-06,
-    (float)2.13163e-06,
-    (float)2.78628e-06,
-    (float)2.13217e-06,
-    (float)2.45682e-06,
-    (float)2.46218e-06,
-    (float)1.98051e-06,
-    (float)2.45894e-06,
-    (float)2.19237e-06,
-    (float)2.1463e-06,
-    (float)2.06402e-06,
-    (float)2.28985e-06,
-    (float)2.3391e-06,
-    (float)1.91724e-06,
-    (float)2.10447e-06,
-    (float)1.84451e-06,
-    (float)2.28836e-06,
-    (float)2.31257e-06,
-    (float)1.83764e-06,
-    (float)2.01054e-06,
-    (float)2.06457e-06,
-    (float)2.46251e-06,
-    (float)2.10147e-06,
-    (float)2.36987e-06,
-    (float)2.39371e-06,
-    (float)2.18646e-06,
-    (float)2.31286e-06,
-    (float)1.59797e-06,
-    (float)2.31053e-06,
-    (float)2.08033e-06,
-    (float)1.79548e-06,
-    (float)2.36776e-06,
-    (float)2.23248e-06,
-    (float)2.56873e-06,
-    (float)2.93003e-06,
-    (float)2.21981e-06,
-    (float)2.08246e-06,
-    (float)2.57156e-06,
-    (float)2.44371e-06,
-    (float)2.02666e-06,
-    (float)2.17726e-06,
-    (float)2.40976e-06,
-    (float)2.42277e-06,
-    (float)2.66387e-06,
-    (float)2.05371e-06,
-    (float)2.46098e-06,
-    (float)2.56196e-06,
-    (float)0.0681465,
-    (float)0.870787,
-    (float)0.0125824,
-    (float)0.00534936,
-    (float)0.0328352,
-    (float)0.00656244,
-    (float)0.000890529,
-    (float)0.000803961,
-    (float)0.000862911,
-    (float)6.35705e-05,
-    (float)2.28031e-05,
-    (float)2.07468e-05,
-    (float)6.15731e-05,
-    (float)8.70951e-05,
-    (float)0.000138323,
-    (float)5.13577e-05,
-    (float)2.78454e-05,
-    (float)1.18879e-05,
-    (float)8.73562e-05,
-    (float)2.82387e-05,
-    (float)7.63168e-06,
-    (float)1.68248e-05,
-    (float)1.14411e-05,
-    (float)1.72808e-05,
-    (float)2.33008e-05,
-    (float)4.15713e-05,
-    (float)8.54505e-06,
-    (float)2.10389e-05,
-    (float)7.53695e-06,
-    (float)1.43362e-05,
-    (float)1.78413e-05,
-    (float)4.69666e-06,
-    (float)5.69534e-06,
-    (float)1.48504e-05,
-    (float)1.24279e-05,
-    (float)2.70696e-05,
-    (float)6.78275e-06,
-    (float)1.08883e-05,
-    (float)1.30416e-05,
-    (float)8.18961e-06,
-    (float)9.35561e-06,
-    (float)6.13193e-06,
-    (float)6.34914e-06,
-    (float)5.97338e-06,
-    (float)1.2071e-05,
-    (float)8.20898e-06,
-    (float)9.89272e-06,
-    (float)7.11837e-06,
-    (float)7.43324e-06,
-    (float)7.19519e-06,
-    (float)6.39566e-06,
-    (float)5.19476e-06,
-    (float)7.02233e-06,
-    (float)3.84606e-06,
-    (float)6.8387e-06,
-    (float)4.88885e-06,
-    (float)6.77176e-06,
-    (float)3.14242e-06,
-    (float)5.67326e-06,
-    (float)4.94784e-06,
-    (float)3.69523e-06,
-    (float)5.67626e-06,
-    (float)3.40006e-06,
-    (float)3.97811e-06,
-    (float)4.84374e-06,
-    (float)3.07712e-06,
-    (float)4.05701e-06,
-    (float)3.06249e-06,
-    (float)3.19669e-06,
-    (float)3.41808e-06,
-    (float)2.67901e-06,
-    (float)2.80381e-06,
-    (float)2.92185e-06,
-    (float)3.06545e-06,
-    (float)2.33551e-06,
-    (float)3.28745e-06,
-    (float)2.09904e-06,
-    (float)2.22849e-06,
-    (float)2.70264e-06,
-    (float)1.80058e-06,
-    (float)2.28157e-06,
-    (float)1.78254e-06,
-    (float)2.36597e-06,
-    (float)1.94668e-06,
-    (float)1.9341e-06,
-    (float)2.03375e-06,
-    (float)1.99117e-06,
-    (float)1.86013e-06,
-    (float)1.74652e-06,
-    (float)2.00081e-06,
-    (float)2.09483e-06,
-    (float)1.36791e-06,
-    (float)1.82785e-06,
-    (float)1.43401e-06,
-    (float)1.88096e-06,
-    (float)1.78552e-06,
-    (float)1.58475e-06,
-    (float)1.77167e-06,
-    (float)1.8695e-06,
-    (float)2.28646e-06,
-    (float)1.87147e-06,
-    (float)1.88092e-06,
-    (float)1.27529e-06,
-    (float)1.87178e-06,
-    (float)1.49559e-06,
-    (float)1.27299e-06,
-    (float)1.53095e-06,
-    (float)1.82312e-06,
-    (float)1.73919e-06,
-    (float)2.48436e-06,
-    (float)1.89431e-06,
-    (float)2.2475e-06,
-    (float)1.99718e-06,
-    (float)1.93346e-06,
-    (float)1.50156e-06,
-    (float)1.81235e-06,
-    (float)1.7588e-06,
-    (float)1.69032e-06,
-    (float)1.73478e-06,
-    (float)1.75753e-06,
-    (float)2.21955e-06,
-    (float)2.06055e-06,
-    (float)1.84873e-06,
-    (float)1.70579e-06,
-    (float)2.3527e-06,
-    (float)1.96206e-06,
-    (float)1.94733e-06,
-    (float)1.8775e-06,
-    (float)0.0514191,
-    (float)0.898657,
-    (float)0.0103667,
-    (float)0.00438199,
-    (float)0.0250752,
-    (float)0.00662755,
-    (float)0.000915114,
-    (float)0.000868501,
-    (float)0.000772504,
-    (float)2.00735e-05,
-    (float)1.2168e-05,
-    (float)3.40237e-05,
-    (float)5.13722e-05,
-    (float)7.7809e-05,
-    (float)8.14349e-05,
-    (float)1.93131e-05,
-    (float)3.96607e-05,
-    (float)1.43859e-05,
-    (float)9.99607e-05,
-    (float)5.67919e-06,
-    (float)9.34206e-07,
-    (float)6.84816e-06,
-    (float)2.73738e-05,
-    (float)2.00898e-05,
-    (float)2.03256e-05,
-    (float)1.22704e-05,
-    (float)9.85392e-06,
-    (float)2.36927e-05,
-    (float)7.75875e-06,
-    (float)6.0317e-06,
-    (float)7.96849e-06,
-    (float)3.84801e-06,
-    (float)1.7092e-05,
-    (float)1.27914e-05,
-    (float)9.41065e-06,
-    (float)1.61601e-05,
-    (float)3.67698e-06,
-    (float)1.22331e-05,
-    (float)7.16129e-06,
-    (float)6.15078e-06,
-    (float)3.56788e-06,
-    (float)7.76409e-06,
-    (float)5.78624e-06,
-    (float)8.10827e-06,
-    (float)7.74491e-06,
-    (float)6.57767e-06,
-    (float)5.98962e-06,
-    (float)6.70292e-06,
-    (float)5.04734e-06,
-    (float)6.23781e-06,
-    (float)2.77081e-06,
-    (float)6.08473e-06,
-    (float)4.87583e-06,
-    (float)5.38913e-06,
-    (float)2.93958e-06,
-    (float)4.44697e-06,
-    (float)4.58885e-06,
-    (float)2.71809e-06,
-    (float)5.25442e-06,
-    (float)3.29401e-06,
-    (float)3.26323e-06,
-    (float)4.91286e-06,
-    (float)2.5545e-06,
-    (float)3.62137e-06,
-    (float)2.83214e-06,
-    (float)2.54622e-06,
-    (float)3.34969e-06,
-    (float)2.36932e-06,
-    (float)2.30433e-06,
-    (float)2.39972e-06,
-    (float)2.67776e-06,
-    (float)1.99737e-06,
-    (float)3.03114e-06,
-    (float)1.90592e-06,
-    (float)2.19876e-06,
-    (float)2.32643e-06,
-    (float)1.68561e-06,
-    (float)1.97416e-06,
-    (float)1.67395e-06,
-    (float)1.8382e-06,
-    (float)1.7892e-06,
-    (float)1.57245e-06,
-    (float)1.80486e-06,
-    (float)1.60862e-06,
-    (float)1.71546e-06,
-    (float)1.47866e-06,
-    (float)1.74407e-06,
-    (float)1.52714e-06,
-    (float)1.06739e-06,
-    (float)1.67366e-06,
-    (float)1.1568e-06,
-    (float)1.54218e-06,
-    (float)1.42939e-06,
-    (float)1.60667e-06,
-    (float)1.31718e-06,
-    (float)1.76446e-06,
-    (float)1.479e-06,
-    (float)1.54394e-06,
-    (float)1.25685e-06,
-    (float)1.03127e-06,
-    (float)1.25816e-06,
-    (float)1.31644e-06,
-    (float)8.56603e-07,
-    (float)1.75305e-06,
-    (float)1.30094e-06,
-    (float)1.73507e-06,
-    (float)1.87531e-06,
-    (float)1.51574e-06,
-    (float)1.31252e-06,
-    (float)1.34854e-06,
-    (float)1.29151e-06,
-    (float)1.34705e-06,
-    (float)1.33606e-06,
-    (float)1.45613e-06,
-    (float)1.49537e-06,
-    (float)1.62197e-06,
-    (float)1.59049e-06,
-    (float)1.421e-06,
-    (float)1.6126e-06,
-    (float)1.40927e-06,
-    (float)1.60283e-06,
-    (float)1.48027e-06,
-    (float)1.20121e-06,
-    (float)1.39312e-06,
-    (float)1.58857e-06,
-    (float)1.44606e-06,
-    (float)1.83525e-06,
-    (float)1.5583e-06,
-    (float)0.0370588,
-    (float)0.923883,
-    (float)0.00813256,
-    (float)0.00338536,
-    (float)0.0181527,
-    (float)0.0061498,
-    (float)0.000848255,
-    (float)0.000812232,
-    (float)0.000811792,
-    (float)3.68526e-06,
-    (float)1.76204e-05,
-    (float)0.000115562,
-    (float)4.34697e-05,
-    (float)5.29851e-05,
-    (float)2.95459e-05,
-    (float)5.99289e-06,
-    (float)5.00881e-05,
-    (float)1.02786e-05,
-    (float)6.56614e-05,
-    (float)4.02863e-06,
-    (float)8.23585e-07,
-    (float)1.32876e-05,
-    (float)3.84116e-05,
-    (float)1.10717e-05,
-    (float)1.3962e-05,
-    (float)4.9848e-06,
-    (float)9.43318e-06,
-    (float)1.57244e-05,
-    (float)2.06875e-06,
-    (float)1.89037e-06,
-    (float)1.01434e-05,
-    (float)5.98053e-06,
-    (float)2.28187e-05,
-    (float)4.47363e-06,
-    (float)6.70652e-06,
-    (float)9.05624e-06,
-    (float)5.03084e-06,
-    (float)5.91414e-06,
-    (float)3.73434e-06,
-    (float)2.90701e-06,
-    (float)5.52161e-06,
-    (float)8.7342e-06,
-    (float)5.27939e-06,
-    (float)4.97137e-06,
-    (float)5.58059e-06,
-    (float)4.94967e-06,
-    (float)5.3199e-06,
-    (float)2.91876e-06,
-    (float)3.74869e-06,
-    (float)4.41741e-06,
-    (float)3.72365e-06,
-    (float)3.80196e-06,
-    (float)3.42439e-06,
-    (float)4.00418e-06,
-    (float)1.47797e-06,
-    (float)5.04232e-06,
-    (float)2.92438e-06,
-    (float)2.35605e-06,
-    (float)4.64336e-06,
-    (float)2.28113e-06,
-    (float)3.10643e-06,
-    (float)2.62763e-06,
-    (float)1.81679e-06,
-    (float)3.12422e-06,
-    (float)1.84911e-06,
-    (float)2.03225e-06,
-    (float)2.27525e-06,
-    (float)2.05459e-06,
-    (float)1.47881e-06,
-    (float)2.4671e-06,
-    (float)1.86932e-06,
-    (float)1.83341e-06,
-    (float)2.13723e-06,
-    (float)1.48656e-06,
-    (float)1.66038e-06,
-    (float)1.33236e-06,
-    (float)1.40191e-06,
-    (float)1.43775e-06,
-    (float)1.32603e-06,
-    (float)1.54273e-06,
-    (float)1.35147e-06,
-    (float)1.65784e-06,
-    (float)1.20237e-06,
-    (float)1.48935e-06,
-    (float)1.33087e-06,
-    (float)9.14261e-07,
-    (float)1.36506e-06,
-    (float)8.51894e-07,
-    (float)9.74639e-07,
-    (float)1.27722e-06,
-    (float)1.21389e-06,
-    (float)1.22856e-06,
-    (float)1.4171e-06,
-    (float)9.97075e-07,
-    (float)1.11475e-06,
-    (float)1.11617e-06,
-    (float)6.99287e-07,
-    (float)1.10774e-06,
-    (float)9.54061e-07,
-    (float)7.86241e-07,
-    (float)1.50281e-06,
-    (float)9.7743e-07,
-    (float)1.14259e-06,
-    (float)1.32544e-06,
-    (float)1.22523e-06,
-    (float)1.05557e-06,
-    (float)8.66523e-07,
-    (float)9.48702e-07,
-    (float)9.88393e-07,
-    (float)1.17725e-06,
-    (float)1.11902e-06,
-    (float)9.6721e-07,
-    (float)1.31432e-06,
-    (float)1.07313e-06,
-    (float)1.12561e-06,
-    (float)1.10347e-06,
-    (float)8.79323e-07,
-    (float)1.27166e-06,
-    (float)1.27602e-06,
-    (float)1.08898e-06,
-    (float)1.14682e-06,
-    (float)1.11786e-06,
-    (float)1.45444e-06,
-    (float)1.39889e-06,
-    (float)1.02113e-06,
-    (float)1.00785e-06,
-    (float)1.01813e-06,
-    (float)1.02546e-06,
-    (float)0.0251373,
-    (float)0.946024,
-    (float)0.0060088,
-    (float)0.00244154,
-    (float)0.0122584,
-    (float)0.00519424,
-    (float)0.000706071,
-    (float)0.000663795,
-    (float)0.000847466,
-    (float)9.44852e-06,
-    (float)2.92702e-05,
-    (float)0.000207918,
-    (float)5.75591e-05,
-    (float)2.54966e-05,
-    (float)5.56174e-06,
-    (float)2.5476e-05,
-    (float)4.05107e-05,
-    (float)2.65195e-06,
-    (float)2.12196e-05,
-    (float)8.48144e-06,
-    (float)3.66632e-06,
-    (float)1.78677e-05,
-    (float)2.88164e-05,
-    (float)4.16681e-06,
-    (float)1.48543e-05,
-    (float)1.07293e-05,
-    (float)3.071e-06,
-    (float)5.04331e-06,
-    (float)3.19173e-07,
-    (float)9.9531e-06,
-    (float)9.80145e-06,
-    (float)5.23789e-06,
-    (float)1.27127e-05,
-    (float)2.31958e-06,
-    (float)7.82416e-06,
-    (float)4.61585e-06,
-    (float)2.36033e-06,
-    (float)2.64497e-06,
-    (float)5.11256e-06,
-    (float)4.25957e-06,
-    (float)4.10543e-06,
-    (float)4.53988e-06,
-    (float)3.48483e-06,
-    (float)4.23842e-06,
-    (float)4.26382e-06,
-    (float)2.29868e-06,
-    (float)3.26954e-06,
-    (float)2.11376e-06,
-    (float)4.6143e-06,
-    (float)2.74883e-06,
-    (float)3.14545e-06,
-    (float)9.29331e-07,
-    (float)4.12256e-06,
-    (float)2.3586e-06,
-    (float)1.39247e-06,
-    (float)3.77546e-06,
-    (float)2.12755e-06,
-    (float)2.26494e-06,
-    (float)3.21788e-06,
-    (float)1.13816e-06,
-    (float)2.57975e-06,
-    (float)1.2191e-06,
-    (float)1.85164e-06,
-    (float)1.88225e-06,
-    (float)1.59126e-06,
-    (float)1.04466e-06,
-    (float)2.15221e-06,
-    (float)1.4722e-06,
-    (float)1.2785e-06,
-    (float)1.95131e-06,
-    (float)1.42831e-06,
-    (float)1.29762e-06,
-    (float)1.08318e-06,
-    (float)1.07927e-06,
-    (float)1.09706e-06,
-    (float)9.68628e-07,
-    (float)1.16031e-06,
-    (float)1.11398e-06,
-    (float)1.54166e-06,
-    (float)9.88971e-07,
-    (float)1.15394e-06,
-    (float)1.13002e-06,
-    (float)5.1139e-07,
-    (float)1.20025e-06,
-    (float)6.08839e-07,
-    (float)8.04066e-07,
-    (float)1.01012e-06,
-    (float)1.03734e-06,
-    (float)1.02781e-06,
-    (float)1.2252e-06,
-    (float)6.31189e-07,
-    (float)8.56474e-07,
-    (float)7.82732e-07,
-    (float)4.94782e-07,
-    (float)7.23706e-07,
-    (float)7.45874e-07,
-    (float)5.1142e-07,
-    (float)1.37203e-06,
-    (float)7.24406e-07,
-    (float)8.48202e-07,
-    (float)8.20699e-07,
-    (float)1.11222e-06,
-    (float)6.72607e-07,
-    (float)8.06165e-07,
-    (float)6.88444e-07,
-    (float)6.10721e-07,
-    (float)8.4548e-07,
-    (float)8.11624e-07,
-    (float)6.308e-07,
-    (float)1.03153e-06,
-    (float)5.77767e-07,
-    (float)1.02317e-06,
-    (float)7.35005e-07,
-    (float)5.80846e-07,
-    (float)7.80954e-07,
-    (float)1.00957e-06,
-    (float)8.16228e-07,
-    (float)9.94675e-07,
-    (float)7.63728e-07,
-    (float)9.92903e-07,
-    (float)8.516e-07,
-    (float)7.50047e-07,
-    (float)7.48358e-07,
-    (float)8.14086e-07,
-    (float)6.58711e-07,
-    (float)1.07699e-06,
-    (float)8.30762e-07,
-    (float)6.87783e-07,
-    (float)0.015645,
-    (float)0.964734,
-    (float)0.00409447,
-    (float)0.00160914,
-    (float)0.00752203,
-    (float)0.00392186,
-    (float)0.000521437,
-    (float)0.000468546,
-    (float)0.000769551,
-    (float)2.29159e-05,
-    (float)3.78212e-05,
-    (float)0.000252539,
-    (float)8.84486e-05,
-    (float)8.88196e-06,
-    (float)6.29531e-06,
-    (float)6.5718e-05,
-    (float)1.85969e-05,
-    (float)1.39785e-07,
-    (float)3.27562e-06,
-    (float)9.78765e-06,
-    (float)5.94858e-06,
-    (float)1.46482e-05,
-    (float)7.53615e-06,
-    (float)4.75239e-06,
-    (float)1.47301e-05,
-    (float)5.39217e-06,
-    (float)8.48118e-08,
-    (float)3.06273e-06,
-    (float)5.63743e-07,
-    (float)1.9521e-05,
-    (float)4.16286e-06,
-    (float)2.72631e-06,
-    (float)7.68865e-06,
-    (float)2.63478e-06,
-    (float)3.48028e-06,
-    (float)1.29669e-06,
-    (float)1.25931e-06,
-    (float)3.5121e-06,
-    (float)4.93533e-06,
-    (float)2.32853e-06,
-    (float)2.54078e-06,
-    (float)3.84913e-06,
-    (float)2.40431e-06,
-    (float)2.73487e-06,
-    (float)1.51211e-06,
-    (float)2.77845e-06,
-    (float)2.58122e-06,
-    (float)2.23225e-06,
-    (float)1.15297e-06,
-    (float)1.96524e-06,
-    (float)2.31122e-06,
-    (float)5.87117e-07,
-    (float)2.89155e-06,
-    (float)1.31069e-06,
-    (float)1.48033e-06,
-    (float)4.34784e-06,
-    (float)8.04886e-07,
-    (float)1.78181e-06,
-    (float)8.55362e-07,
-    (float)1.3476e-06,
-    (float)1.41123e-06,
-    (float)1.06925e-06,
-    (float)7.4936e-07,
-    (float)1.81629e-06,
-    (float)1.12391e-06,
-    (float)9.13807e-07,
-    (float)1.50453e-06,
-    (float)1.25245e-06,
-    (float)9.07307e-07,
-    (float)1.06923e-06,
-    (float)7.7338e-07,
-    (float)8.28043e-07,
-    (float)4.5739e-07,
-    (float)9.6114e-07,
-    (float)6.81085e-07,
-    (float)1.42818e-06,
-    (float)7.78859e-07,
-    (float)9.28997e-07,
-    (float)9.24868e-07,
-    (float)3.42031e-07,
-    (float)8.23823e-07,
-    (float)5.11453e-07,
-    (float)4.44592e-07,
-    (float)8.40402e-07,
-    (float)8.10125e-07,
-    (float)8.92881e-07,
-    (float)8.97715e-07,
-    (float)4.43088e-07,
-    (float)4.84213e-07,
-    (float)6.66976e-07,
-    (float)2.59335e-07,
-    (float)6.73669e-07,
-    (float)5.84918e-07,
-    (float)4.16777e-07,
-    (float)9.542e-07,
-    (float)5.58551e-07,
-    (float)6.64667e-07,
-    (float)5.31966e-07,
-    (float)6.342e-07,
-    (float)4.25094e-07,
-    (float)5.09302e-07,
-    (float)5.85171e-07,
-    (float)2.46997e-07,
-    (float)6.98017e-07,
-    (float)5.41953e-07,
-    (float)5.68812e-07,
-    (float)7.77824e-07,
-    (float)4.47903e-07,
-    (float)4.88574e-07,
-    (float)6.58615e-07,
-    (float)3.93847e-07,
-    (float)4.88511e-07,
-    (float)5.11868e-07,
-    (float)5.84124e-07,
-    (float)7.79087e-07,
-    (float)6.08063e-07,
-    (float)4.11707e-07,
-    (float)6.15762e-07,
-    (float)3.98737e-07,
-    (float)6.91982e-07,
-    (float)4.59326e-07,
-    (float)5.30934e-07,
-    (float)5.61816e-07,
-    (float)7.33801e-07,
-    (float)3.82998e-07,
-    (float)6.42747e-07,
-    (float)6.3987e-07,
-    (float)5.81203e-07,
-    (float)0.00853755,
-    (float)0.979661,
-    (float)0.00248129,
-    (float)0.000933759,
-    (float)0.00400751,
-    (float)0.00253537,
-    (float)0.000332348,
-    (float)0.00028052,
-    (float)0.000567542,
-    (float)2.86642e-05,
-    (float)3.83445e-05,
-    (float)0.000219224,
-    (float)0.000105659,
-    (float)8.29762e-06,
-    (float)1.32684e-05,
-    (float)8.91831e-05,
-    (float)5.47702e-06,
-    (float)3.35375e-06,
-    (float)9.79715e-06,
-    (float)1.67455e-05,
-    (float)4.90201e-06,
-    (float)8.51005e-06,
-    (float)2.89532e-06,
-    (float)3.0608e-06,
-    (float)6.76875e-06,
-    (float)4.35968e-07,
-    (float)1.01407e-06,
-    (float)4.29389e-06,
-    (float)1.12591e-06,
-    (float)1.29976e-05,
-    (float)1.46336e-06,
-    (float)3.37638e-06,
-    (float)4.32999e-06,
-    (float)1.2906e-06,
-    (float)8.24463e-07,
-    (float)1.62992e-06,
-    (float)3.44867e-06,
-    (float)1.78401e-06,
-    (float)2.01885e-06,
-    (float)1.14709e-06,
-    (float)3.05624e-06,
-    (float)2.08204e-06,
-    (float)6.50337e-07,
-    (float)1.66722e-06,
-    (float)1.50058e-06,
-    (float)2.00765e-06,
-    (float)8.65257e-07,
-    (float)1.66874e-06,
-    (float)2.33611e-07,
-    (float)2.43268e-06,
-    (float)7.20375e-07,
-    (float)5.63543e-07,
-    (float)3.59976e-06,
-    (float)6.93904e-07,
-    (float)1.04283e-06,
-    (float)1.11517e-06,
-    (float)7.19311e-07,
-    (float)1.2066e-06,
-    (float)4.37814e-07,
-    (float)5.02218e-07,
-    (float)1.13172e-06,
-    (float)9.83967e-07,
-    (float)6.46918e-07,
-    (float)9.16939e-07,
-    (float)7.76595e-07,
-    (float)6.64081e-07,
-    (float)1.08087e-06,
-    (float)5.75327e-07,
-    (float)4.73955e-07,
-    (float)2.177e-07,
-    (float)7.95055e-07,
-    (float)3.24715e-07,
-    (float)9.62062e-07,
-    (float)7.38646e-07,
-    (float)7.52674e-07,
-    (float)7.17224e-07,
-    (float)1.50905e-07,
-    (float)7.30932e-07,
-    (float)2.86949e-07,
-    (float)1.89341e-07,
-    (float)5.3129e-07,
-    (float)6.96642e-07,
-    (float)6.45294e-07,
-    (float)4.93737e-07,
-    (float)2.63568e-07,
-    (float)4.19511e-07,
-    (float)4.44938e-07,
-    (float)2.30662e-07,
-    (float)4.5823e-07,
-    (float)4.2188e-07,
-    (float)2.41749e-07,
-    (float)5.69226e-07,
-    (float)4.11366e-07,
-    (float)4.62362e-07,
-    (float)1.93662e-07,
-    (float)5.58465e-07,
-    (float)2.25924e-07,
-    (float)4.487e-07,
-    (float)4.60162e-07,
-    (float)1.53341e-07,
-    (float)4.56227e-07,
-    (float)2.504e-07,
-    (float)4.95688e-07,
-    (float)4.4094e-07,
-    (float)1.72758e-07,
-    (float)1.86497e-07,
-    (float)4.45059e-07,
-    (float)3.02568e-07,
-    (float)3.42959e-07,
-    (float)4.08699e-07,
-    (float)4.87311e-07,
-    (float)4.6961e-07,
-    (float)3.1119e-07,
-    (float)3.25844e-07,
-    (float)2.74342e-07,
-    (float)2.52966e-07,
-    (float)3.37865e-07,
-    (float)3.19907e-07,
-    (float)4.18004e-07,
-    (float)2.40827e-07,
-    (float)3.99305e-07,
-    (float)2.35557e-07,
-    (float)4.08644e-07,
-    (float)5.61923e-07,
-    (float)2.17161e-07,
-    (float)3.4516e-07,
-    (float)3.95232e-07,
-    (float)4.89663e-07,
-    (float)0.00367999,
-    (float)0.990588,
-    (float)0.00123907,
-    (float)0.000442289,
-    (float)0.00167004,
-    (float)0.00129144,
-    (float)0.000169075,
-    (float)0.000130771,
-    (float)0.00029631,
-    (float)1.8686e-05,
-    (float)2.9452e-05,
-    (float)0.000130204,
-    (float)8.15424e-05,
-    (float)1.72896e-05,
-    (float)1.31462e-05,
-    (float)6.78381e-05,
-    (float)7.23084e-06,
-    (float)4.73642e-06,
-    (float)1.57538e-05,
-    (float)2.5019e-05,
-    (float)1.76428e-06,
-    (float)6.08476e-06,
-    (float)9.90554e-06,
-    (float)1.82684e-07,
-    (float)9.02454e-07,
-    (float)3.18829e-06,
-    (float)7.2071e-06,
-    (float)2.66749e-06,
-    (float)8.40824e-07,
-    (float)5.99627e-06,
-    (float)1.44315e-06,
-    (float)1.61077e-06,
-    (float)5.11451e-07,
-    (float)1.6108e-08,
-    (float)1.37762e-06,
-    (float)1.7819e-06,
-    (float)1.20219e-06,
-    (float)1.1279e-06,
-    (float)1.44975e-06,
-    (float)6.02465e-07,
-    (float)1.04289e-06,
-    (float)6.78348e-07,
-    (float)1.1304e-06,
-    (float)1.49958e-06,
-    (float)8.17512e-07,
-    (float)1.5869e-07,
-    (float)6.83254e-07,
-    (float)1.19284e-06,
-    (float)5.50592e-08,
-    (float)1.3069e-06,
-    (float)5.43106e-07,
-    (float)8.61364e-07,
-    (float)1.73897e-06,
-    (float)9.50406e-08,
-    (float)9.87631e-07,
-    (float)3.96745e-07,
-    (float)3.79513e-07,
-    (float)3.1809e-07,
-    (float)5.95049e-07,
-    (float)4.35623e-07,
-    (float)5.32655e-07,
-    (float)2.89654e-07,
-    (float)5.3225e-07,
-    (float)9.01138e-07,
-    (float)3.82116e-07,
-    (float)2.43063e-07,
-    (float)2.15179e-07,
-    (float)4.93518e-07,
-    (float)1.39743e-07,
-    (float)3.57645e-07,
-    (float)4.77752e-07,
-    (float)4.80686e-07,
-    (float)4.9268e-07,
-    (float)1.30268e-07,
-    (float)4.12049e-07,
-    (float)1.9851e-07,
-    (float)6.4583e-08,
-    (float)3.39392e-07,
-    (float)3.97126e-07,
-    (float)4.3474e-07,
-    (float)3.44013e-07,
-    (float)1.61335e-07,
-    (float)1.81778e-07,
-    (float)2.98816e-07,
-    (float)1.24329e-07,
-    (float)2.66239e-07,
-    (float)2.51263e-07,
-    (float)1.68666e-07,
-    (float)3.68377e-07,
-    (float)1.86586e-07,
-    (float)2.93902e-07,
-    (float)1.84019e-07,
-    (float)3.25819e-07,
-    (float)1.01514e-07,
-    (float)2.0791e-07,
-    (float)3.0346e-07,
-    (float)6.87896e-08,
-    (float)1.8796e-07,
-    (float)1.51715e-07,
-    (float)2.75386e-07,
-    (float)2.21477e-07,
-    (float)1.1427e-07,
-    (float)1.11604e-07,
-    (float)3.44248e-07,
-    (float)1.39105e-07,
-    (float)2.35814e-07,
-    (float)2.5297e-07,
-    (float)2.8426e-07,
-    (float)1.64772e-07,
-    (float)9.70545e-08,
-    (float)1.98748e-07,
-    (float)2.00896e-07,
-    (float)1.37426e-07,
-    (float)1.70388e-07,
-    (float)2.5751e-07,
-    (float)2.74592e-07,
-    (float)1.24583e-07,
-    (float)1.15262e-07,
-    (float)1.45249e-07,
-    (float)2.68281e-07,
-    (float)2.1367e-07,
-    (float)1.46583e-07,
-    (float)1.77393e-07,
-    (float)2.28469e-07,
-    (float)2.601e-07,
-    (float)1.36831e-07,
-    (float)2.79957e-07,
-    (float)8.39296e-08,
-    (float)0.000912918,
-    (float)0.997316,
-    (float)0.000417435,
-    (float)0.000138475,
-    (float)0.000394548,
-    (float)0.000416604,
-    (float)5.67478e-05,
-    (float)4.01789e-05,
-    (float)7.26767e-05,
-    (float)5.16117e-06,
-    (float)1.58607e-05,
-    (float)4.17037e-05,
-    (float)2.85433e-05,
-    (float)2.25352e-05,
-    (float)7.03059e-06,
-    (float)2.10985e-05,
-    (float)7.65989e-06,
-    (float)2.03104e-06,
-    (float)1.17877e-05,
-    (float)1.56603e-05,
-    (float)2.33545e-07,
-    (float)6.52581e-06,
-    (float)4.5486e-06,
-    (float)1.14778e-06,
-    (float)1.18316e-06,
-    (float)2.49691e-06,
-    (float)1.04995e-05,
-    (float)7.38872e-07,
-    (float)3.97557e-07,
-    (float)5.43335e-06,
-    (float)1.44872e-06,
-    (float)1.14523e-08,
-    (float)1.67203e-07,
-    (float)1.0544e-06,
-    (float)6.16169e-07,
-    (float)5.12921e-07,
-    (float)3.91062e-07,
-    (float)1.42975e-06,
-    (float)5.97428e-07,
-    (float)5.42079e-08,
-    (float)5.86865e-07,
-    (float)8.91394e-07,
-    (float)3.53475e-07,
-    (float)1.83137e-07,
-    (float)6.82676e-07,
-    (float)2.66976e-08,
-    (float)6.88121e-07,
-    (float)4.5182e-08,
-    (float)2.26762e-07,
-    (float)1.80025e-06,
-    (float)7.05414e-08,
-    (float)3.56471e-07,
-    (float)3.8163e-07,
-    (float)1.59726e-07,
-    (float)2.65531e-07,
-    (float)7.87129e-08,
-    (float)8.11976e-08,
-    (float)2.98522e-07,
-    (float)1.17644e-07,
-    (float)2.63877e-07,
-    (float)3.69933e-07,
-    (float)3.79007e-07,
-    (float)1.05821e-07,
-    (float)1.24964e-07,
-    (float)1.6646e-07,
-    (float)7.12877e-08,
-    (float)7.99522e-08,
-    (float)1.13287e-07,
-    (float)1.316e-07,
-    (float)5.13659e-07,
-    (float)1.19739e-07,
-    (float)1.59254e-07,
-    (float)1.54694e-07,
-    (float)6.66785e-09,
-    (float)1.56087e-07,
-    (float)6.34085e-08,
-    (float)2.96534e-07,
-    (float)2.62983e-07,
-    (float)6.96257e-08,
-    (float)5.69303e-08,
-    (float)1.54675e-07,
-    (float)7.15809e-08,
-    (float)1.15812e-07,
-    (float)1.12783e-07,
-    (float)1.16761e-07,
-    (float)1.84912e-07,
-    (float)7.72837e-08,
-    (float)1.42059e-07,
-    (float)8.94807e-08,
-    (float)2.25125e-07,
-    (float)2.63978e-08,
-    (float)1.01689e-07,
-    (float)1.69734e-07,
-    (float)9.39775e-09,
-    (float)9.98829e-08,
-    (float)6.00287e-08,
-    (float)1.48685e-07,
-    (float)1.39553e-07,
-    (float)3.58649e-08,
-    (float)9.11833e-08,
-    (float)9.45536e-08,
-    (float)4.05284e-08,
-    (float)1.17889e-07,
-    (float)1.18737e-07,
-    (float)1.64538e-07,
-    (float)1.83484e-08,
-    (float)2.47347e-08,
-    (float)1.83954e-07,
-    (float)9.17997e-08,
-    (float)1.05625e-07,
-    (float)5.28308e-08,
-    (float)1.37713e-07,
-    (float)4.42481e-08,
-    (float)4.17147e-08,
-    (float)5.26792e-08,
-    (float)7.23956e-08,
-    (float)5.73938e-08,
-    (float)1.24238e-07,
-    (float)1.68452e-07,
-    (float)1.17259e-07,
-    (float)1.01674e-07,
-    (float)3.76974e-08,
-    (float)9.61875e-08,
-    (float)4.46479e-08,
-    (float)8.94603e-08,
-    (float)5.10301e-08,
-    (float)6.03778e-08,
-    (float)1.25715e-07,
-    (float)1.04617e-05,
-    (float)0.999771,
-    (float)3.59802e-05,
-    (float)9.10399e-06,
-    (float)4.45297e-06,
-    (float)8.06086e-05,
-    (float)4.15498e-06,
-    (float)3.57202e-06,
-    (float)2.61202e-06,
-    (float)1.7194e-05,
-    (float)5.31272e-06,
-    (float)9.76246e-07,
-    (float)2.18218e-07,
-    (float)1.67479e-05,
-    (float)3.6218e-06,
-    (float)1.86678e-06,
-    (float)1.15249e-06,
-    (float)2.32863e-06,
-    (float)6.23382e-06,
-    (float)1.31714e-06,
-    (float)3.48978e-07,
-    (float)2.98919e-06,
-    (float)2.51438e-06,
-    (float)8.62639e-07,
-    (float)4.74311e-07,
-    (float)2.79658e-07,
-    (float)3.42119e-06,
-    (float)8.8269e-07,
-    (float)2.66468e-07,
-    (float)8.07816e-07,
-    (float)4.8427e-07,
-    (float)2.22564e-07,
-    (float)1.4573e-07,
-    (float)7.57399e-08,
-    (float)6.96192e-07,
-    (float)3.01096e-07,
-    (float)5.58434e-08,
-    (float)2.69796e-08,
-    (float)1.82401e-07,
-    (float)7.66346e-08,
-    (float)2.48879e-07,
-    (float)4.84309e-07,
-    (float)9.28325e-08,
-    (float)7.77942e-08,
-    (float)4.39344e-08,
-    (float)1.6007e-07,
-    (float)4.92935e-07,
-    (float)6.14107e-08,
-    (float)2.05045e-07,
-    (float)6.34335e-07,
-    (float)2.86034e-08,
-    (float)6.12266e-08,
-    (float)6.52196e-08,
-    (float)5.26514e-08,
-    (float)1.21848e-07,
-    (float)8.76147e-09,
-    (float)5.14176e-08,
-    (float)7.70815e-08,
-    (float)7.80493e-08,
-    (float)1.15582e-07,
-    (float)8.22822e-08,
-    (float)8.18944e-08,
-    (float)8.55784e-09,
-    (float)2.11478e-08,
-    (float)5.92924e-09,
-    (float)3.25398e-08,
-    (float)2.2005e-07,
-    (float)7.51468e-08,
-    (float)6.41378e-08,
-    (float)5.14919e-08,
-    (float)1.41058e-08,
-    (float)2.40515e-08,
-    (float)9.71816e-09,
-    (float)3.81678e-08,
-    (float)1.58532e-07,
-    (float)2.46917e-08,
-    (float)5.03599e-08,
-    (float)8.05268e-08,
-    (float)2.29913e-08,
-    (float)4.65629e-08,
-    (float)1.1546e-08,
-    (float)5.00317e-08,
-    (float)5.65364e-08,
-    (float)3.85651e-08,
-    (float)1.97527e-08,
-    (float)3.04989e-08,
-    (float)4.94711e-08,
-    (float)2.2903e-08,
-    (float)3.72363e-08,
-    (float)3.27128e-08,
-    (float)1.95795e-08,
-    (float)2.79834e-08,
-    (float)9.20736e-09,
-    (float)1.30325e-08,
-    (float)7.31159e-08,
-    (float)8.70869e-09,
-    (float)2.04125e-08,
-    (float)1.56235e-08,
-    (float)9.14053e-09,
-    (float)5.30166e-08,
-    (float)4.44371e-08,
-    (float)3.1063e-08,
-    (float)1.60079e-08,
-    (float)3.08806e-09,
-    (float)1.95142e-08,
-    (float)3.95597e-08,
-    (float)2.01503e-08,
-    (float)3.06566e-08,
-    (float)6.47516e-09,
-    (float)4.26907e-10,
-    (float)1.37203e-08,
-    (float)1.19419e-08,
-    (float)2.98982e-08,
-    (float)2.2551e-08,
-    (float)5.3084e-08,
-    (float)3.66799e-08,
-    (float)1.59309e-08,
-    (float)2.23179e-08,
-    (float)2.09781e-09,
-    (float)1.82531e-08,
-    (float)1.10179e-08,
-    (float)4.7423e-08,
-    (float)3.35154e-08,
-    (float)1.21272e-08,
-    (float)3.92127e-08,
-    (float)3.72279e-09,
-    (float)7.24467e-09,
-    (float)1.86678e-08,
-    (float)1.04617e-05,
-    (float)0.999771,
-    (float)3.59802e-05,
-    (float)9.10399e-06,
-    (float)4.45297e-06,
-    (float)8.06086e-05,
-    (float)4.15498e-06,
-    (float)3.57202e-06,
-    (float)2.61202e-06,
-    (float)1.7194e-05,
-    (float)5.31272e-06,
-    (float)9.76246e-07,
-    (float)2.18218e-07,
-    (float)1.67479e-05,
-    (float)3.6218e-06,
-    (float)1.86678e-06,
-    (float)1.15249e-06,
-    (float)2.32863e-06,
-    (float)6.23382e-06,
-    (float)1.31714e-06,
-    (float)3.48978e-07,
-    (float)2.98919e-06,
-    (float)2.51438e-06,
-    (float)8.62639e-07,
-    (float)4.74311e-07,
-    (float)2.79658e-07,
-    (float)3.42119e-06,
-    (float)8.8269e-07,
-    (float)2.66468e-07,
-    (float)8.07816e-07,
-    (float)4.8427e-07,
-    (float)2.22564e-07,
-    (float)1.4573e-07,
-    (float)7.57399e-08,
-    (float)6.96192e-07,
-    (float)3.01096e-07,
-    (float)5.58434e-08,
-    (float)2.69796e-08,
-    (float)1.82401e-07,
-    (float)7.66346e-08,
-    (float)2.48879e-07,
-    (float)4.84309e-07,
-    (float)9.28325e-08,
-    (float)7.77942e-08,
-    (float)4.39344e-08,
-    (float)1.6007e-07,
-    (float)4.92935e-07,
-    (float)6.14107e-08,
-    (float)2.05045e-07,
-    (float)6.34335e-07,
-    (float)2.86034e-08,
-    (float)6.12266e-08,
-    (float)6.52196e-08,
-    (float)5.26514e-08,
-    (float)1.21848e-07,
-    (float)8.76147e-09,
-    (float)5.14176e-08,
-    (float)7.70815e-08,
-    (float)7.80493e-08,
-    (float)1.15582e-07,
-    (float)8.22822e-08,
-    (float)8.18944e-08,
-    (float)8.55784e-09,
-    (float)2.11478e-08,
-    (float)5.92924e-09,
-    (float)3.25398e-08,
-    (float)2.2005e-07,
-    (float)7.51468e-08,
-    (float)6.41378e-08,
-    (float)5.14919e-08,
-    (float)1.41058e-08,
-    (float)2.40515e-08,
-    (float)9.71816e-09,
-    (float)3.81678e-08,
-    (float)1.58532e-07,
-    (float)2.46917e-08,
-    (float)5.03599e-08,
-    (float)8.05268e-08,
-    (float)2.29913e-08,
-    (float)4.65629e-08,
-    (float)1.1546e-08,
-    (float)5.00317e-08,
-    (float)5.65364e-08,
-    (float)3.85651e-08,
-    (float)1.97527e-08,
-    (float)3.04989e-08,
-    (float)4.94711e-08,
-    (float)2.2903e-08,
-    (float)3.72363e-08,
-    (float)3.27128e-08,
-    (float)1.95795e-08,
-    (float)2.79834e-08,
-    (float)9.20736e-09,
-    (float)1.30325e-08,
-    (float)7.31159e-08,
-    (float)8.70869e-09,
-    (float)2.04125e-08,
-    (float)1.56235e-08,
-    (float)9.14053e-09,
-    (float)5.30166e-08,
-    (float)4.44371e-08,
-    (float)3.1063e-08,
-    (float)1.60079e-08,
-    (float)3.08806e-09,
-    (float)1.95142e-08,
-    (float)3.95597e-08,
-    (float)2.01503e-08,
-    (float)3.06566e-08,
-    (float)6.47516e-09,
-    (float)4.26907e-10,
-    (float)1.37203e-08,
-    (float)1.19419e-08,
-    (float)2.98982e-08,
-    (float)2.2551e-08,
-    (float)5.3084e-08,
-    (float)3.66799e-08,
-    (float)1.59309e-08,
-    (float)2.23179e-08,
-    (float)2.09781e-09,
-    (float)1.82531e-08,
-    (float)1.10179e-08,
-    (float)4.7423e-08,
-    (float)3.35154e-08,
-    (float)1.21272e-08,
-    (float)3.92127e-08,
-    (float)3.72279e-09,
-    (float)7.24467e-09,
-    (float)1.86678e-08,
-    (float)0.000156148,
-    (float)0.997735,
-    (float)0.00128782,
-    (float)0.000155935,
-    (float)6.26465e-05,
-    (float)6.10165e-05,
-    (float)9.70288e-05,
-    (float)0.000165843,
-    (float)5.05016e-05,
-    (float)5.71338e-06,
-    (float)4.03974e-05,
-    (float)1.6746e-05,
-    (float)1.43192e-05,
-    (float)2.58629e-05,
-    (float)4.03833e-06,
-    (float)3.79589e-06,
-    (float)9.35353e-06,
-    (float)1.12582e-06,
-    (float)1.63449e-05,
-    (float)1.34377e-05,
-    (float)3.50498e-06,
-    (float)1.14113e-05,
-    (float)1.29426e-05,
-    (float)5.06024e-06,
-    (float)2.45047e-07,
-    (float)1.99165e-06,
-    (float)1.39794e-06,
-    (float)2.78681e-07,
-    (float)4.59702e-07,
-    (float)1.05396e-05,
-    (float)4.76895e-08,
-    (float)1.38085e-06,
-    (float)2.33822e-07,
-    (float)1.17718e-06,
-    (float)5.68692e-06,
-    (float)8.62649e-07,
-    (float)9.11636e-07,
-    (float)1.17529e-07,
-    (float)5.15206e-07,
-    (float)1.40238e-07,
-    (float)1.413e-06,
-    (float)7.58298e-08,
-    (float)1.19438e-07,
-    (float)1.76108e-07,
-    (float)2.54944e-06,
-    (float)1.14395e-07,
-    (float)9.12537e-07,
-    (float)5.98297e-08,
-    (float)9.622e-07,
-    (float)1.48709e-06,
-    (float)1.14157e-07,
-    (float)5.01544e-07,
-    (float)2.58306e-07,
-    (float)8.47082e-08,
-    (float)4.39022e-07,
-    (float)1.68579e-07,
-    (float)1.08213e-07,
-    (float)6.73896e-08,
-    (float)2.70698e-08,
-    (float)8.61146e-07,
-    (float)1.82386e-07,
-    (float)1.58881e-07,
-    (float)1.19148e-07,
-    (float)3.89106e-07,
-    (float)1.70325e-07,
-    (float)2.98038e-07,
-    (float)2.10722e-07,
-    (float)1.33159e-07,
-    (float)1.27537e-07,
-    (float)5.42517e-08,
-    (float)4.42845e-08,
-    (float)4.01934e-07,
-    (float)6.21918e-08,
-    (float)7.30233e-08,
-    (float)3.32377e-07,
-    (float)5.13324e-08,
-    (float)2.19739e-07,
-    (float)2.93299e-07,
-    (float)1.02348e-07,
-    (float)1.12143e-07,
-    (float)4.78188e-08,
-    (float)2.02231e-08,
-    (float)7.14278e-08,
-    (float)1.72581e-07,
-    (float)1.12814e-07,
-    (float)9.55652e-08,
-    (float)1.09406e-07,
-    (float)1.20594e-07,
-    (float)5.16741e-08,
-    (float)1.34978e-07,
-    (float)6.1688e-08,
-    (float)1.84344e-07,
-    (float)1.64267e-07,
-    (float)8.98133e-08,
-    (float)9.34958e-08,
-    (float)7.01241e-08,
-    (float)7.05342e-08,
-    (float)4.67279e-08,
-    (float)8.43395e-08,
-    (float)1.13934e-07,
-    (float)2.72376e-08,
-    (float)9.07516e-08,
-    (float)2.02917e-07,
-    (float)8.10585e-08,
-    (float)1.08257e-07,
-    (float)5.51088e-08,
-    (float)1.32699e-07,
-    (float)1.17774e-07,
-    (float)8.32742e-08,
-    (float)4.11008e-08,
-    (float)1.88895e-07,
-    (float)5.25813e-08,
-    (float)8.30357e-08,
-    (float)5.99564e-08,
-    (float)4.21474e-08,
-    (float)1.19319e-08,
-    (float)8.50919e-08,
-    (float)1.70676e-07,
-    (float)1.39218e-07,
-    (float)1.91726e-07,
-    (float)2.54597e-08,
-    (float)1.24367e-07,
-    (float)9.98259e-08,
-    (float)4.12932e-08,
-    (float)3.10756e-08,
-    (float)1.22985e-07,
-    (float)6.13997e-08,
-    (float)7.52838e-08,
-    (float)0.000647223,
-    (float)0.991625,
-    (float)0.00499631,
-    (float)0.000545141,
-    (float)0.000217071,
-    (float)0.000164687,
-    (float)0.000399,
-    (float)0.000631462,
-    (float)0.000168121,
-    (float)1.26098e-06,
-    (float)0.000123364,
-    (float)6.88634e-05,
-    (float)6.73645e-05,
-    (float)3.55188e-05,
-    (float)2.03715e-05,
-    (float)1.19447e-05,
-    (float)4.70916e-05,
-    (float)7.57604e-06,
-    (float)2.55075e-05,
-    (float)4.29281e-05,
-    (float)7.81362e-06,
-    (float)3.01844e-05,
-    (float)2.00441e-05,
-    (float)7.7823e-06,
-    (float)7.06827e-07,
-    (float)9.5141e-06,
-    (float)2.09287e-06,
-    (float)1.07845e-06,
-    (float)3.88533e-07,
-    (float)1.77597e-05,
-    (float)7.87846e-07,
-    (float)5.8147e-06,
-    (float)1.00547e-06,
-    (float)8.59429e-07,
-    (float)7.43625e-06,
-    (float)1.04421e-06,
-    (float)3.63804e-06,
-    (float)5.81333e-07,
-    (float)5.14023e-07,
-    (float)3.14888e-07,
-    (float)2.1547e-06,
-    (float)5.14966e-07,
-    (float)2.99688e-08,
-    (float)3.91932e-07,
-    (float)2.1461e-06,
-    (float)7.5969e-07,
-    (float)1.68118e-06,
-    (float)3.07268e-07,
-    (float)4.67798e-07,
-    (float)4.36343e-07,
-    (float)9.49013e-08,
-    (float)1.84908e-06,
-    (float)1.02779e-06,
-    (float)1.08563e-06,
-    (float)9.49939e-07,
-    (float)2.17715e-08,
-    (float)3.40726e-07,
-    (float)2.97684e-07,
-    (float)1.50974e-07,
-    (float)4.26078e-07,
-    (float)3.16782e-07,
-    (float)3.31888e-07,
-    (float)8.56989e-07,
-    (float)8.74891e-07,
-    (float)1.17136e-06,
-    (float)3.35296e-07,
-    (float)4.71091e-07,
-    (float)7.11276e-08,
-    (float)7.77964e-07,
-    (float)1.23458e-07,
-    (float)1.70439e-07,
-    (float)3.13281e-07,
-    (float)6.20555e-07,
-    (float)3.89786e-07,
-    (float)4.4821e-07,
-    (float)1.8131e-07,
-    (float)2.65643e-07,
-    (float)3.65751e-07,
-    (float)5.11174e-07,
-    (float)1.02485e-06,
-    (float)2.11542e-07,
-    (float)1.14029e-07,
-    (float)1.82326e-07,
-    (float)3.92133e-07,
-    (float)1.84716e-07,
-    (float)1.19352e-07,
-    (float)6.31373e-08,
-    (float)5.3368e-07,
-    (float)2.8829e-07,
-    (float)4.04813e-07,
-    (float)3.36039e-07,
-    (float)2.7494e-07,
-    (float)8.08849e-08,
-    (float)2.30324e-07,
-    (float)4.0645e-07,
-    (float)1.39503e-07,
-    (float)1.58653e-07,
-    (float)2.06842e-07,
-    (float)2.08388e-07,
-    (float)3.30519e-07,
-    (float)1.46716e-07,
-    (float)1.76657e-07,
-    (float)1.79295e-07,
-    (float)1.50377e-07,
-    (float)2.10747e-07,
-    (float)2.39062e-07,
-    (float)3.16765e-07,
-    (float)2.09885e-07,
-    (float)1.39987e-07,
-    (float)1.82629e-07,
-    (float)1.88005e-07,
-    (float)2.82241e-07,
-    (float)2.2661e-07,
-    (float)2.21345e-07,
-    (float)1.57751e-07,
-    (float)1.78086e-07,
-    (float)1.8143e-07,
-    (float)2.78232e-07,
-    (float)1.90978e-07,
-    (float)4.68777e-08,
-    (float)9.60504e-08,
-    (float)2.57726e-07,
-    (float)3.68278e-07,
-    (float)2.06349e-07,
-    (float)2.84272e-07,
-    (float)1.16622e-07,
-    (float)2.31523e-07,
-    (float)2.06798e-07,
-    (float)0.0016223,
-    (float)0.980234,
-    (float)0.0120687,
-    (float)0.00125681,
-    (float)0.000510076,
-    (float)0.000431671,
-    (float)0.000997383,
-    (float)0.00139798,
-    (float)0.000358309,
-    (float)2.25313e-05,
-    (float)0.000265549,
-    (float)0.000129532,
-    (float)0.000157135,
-    (float)4.03588e-05,
-    (float)3.76893e-05,
-    (float)3.30003e-05,
-    (float)9.2844e-05,
-    (float)2.3953e-05,
-    (float)2.87684e-05,
-    (float)7.09834e-05,
-    (float)9.3171e-06,
-    (float)5.94149e-05,
-    (float)1.37159e-05,
-    (float)4.2883e-06,
-    (float)9.61718e-07,
-    (float)1.41032e-05,
-    (float)6.4827e-06,
-    (float)1.19937e-06,
-    (float)3.14018e-07,
-    (float)1.2969e-05,
-    (float)1.96746e-06,
-    (float)7.31551e-06,
-    (float)4.94332e-06,
-    (float)1.73975e-06,
-    (float)3.08982e-06,
-    (float)7.43705e-07,
-    (float)4.74322e-06,
-    (float)3.31261e-06,
-    (float)2.67851e-06,
-    (float)1.85992e-06,
-    (float)9.16563e-07,
-    (float)1.18364e-06,
-    (float)5.00562e-07,
-    (float)1.09519e-06,
-    (float)9.23494e-07,
-    (float)2.08734e-06,
-    (float)1.22059e-06,
-    (float)1.0287e-06,
-    (float)1.71538e-06,
-    (float)3.83314e-06,
-    (float)2.92214e-07,
-    (float)1.95527e-06,
-    (float)1.12254e-06,
-    (float)4.01336e-06,
-    (float)2.44976e-06,
-    (float)5.17205e-07,
-    (float)5.41198e-07,
-    (float)7.41997e-07,
-    (float)4.6532e-07,
-    (float)1.26416e-06,
-    (float)1.26929e-06,
-    (float)5.79594e-07,
-    (float)5.13643e-07,
-    (float)8.42953e-07,
-    (float)2.94739e-06,
-    (float)7.7149e-07,
-    (float)7.08986e-07,
-    (float)3.8311e-07,
-    (float)1.33279e-06,
-    (float)6.53796e-07,
-    (float)9.29069e-07,
-    (float)5.82624e-07,
-    (float)3.86849e-07,
-    (float)3.29642e-07,
-    (float)3.77656e-07,
-    (float)5.54848e-07,
-    (float)1.09543e-06,
-    (float)4.74676e-07,
-    (float)4.70732e-07,
-    (float)6.91189e-07,
-    (float)3.19526e-07,
-    (float)9.76625e-07,
-    (float)1.022e-06,
-    (float)7.21329e-07,
-    (float)6.17887e-07,
-    (float)3.07298e-07,
-    (float)1.77981e-07,
-    (float)3.34419e-07,
-    (float)5.62824e-07,
-    (float)3.55814e-07,
-    (float)2.54398e-07,
-    (float)3.10166e-07,
-    (float)9.04593e-07,
-    (float)3.89791e-07,
-    (float)6.26751e-07,
-    (float)4.20351e-07,
-    (float)7.27719e-07,
-    (float)4.85158e-07,
-    (float)6.73786e-07,
-    (float)4.56875e-07,
-    (float)2.54416e-07,
-    (float)1.97873e-07,
-    (float)3.17956e-07,
-    (float)4.52159e-07,
-    (float)5.05601e-07,
-    (float)1.52982e-07,
-    (float)3.23075e-07,
-    (float)4.02539e-07,
-    (float)4.1092e-07,
-    (float)7.2418e-07,
-    (float)3.9512e-07,
-    (float)6.09826e-07,
-    (float)3.24234e-07,
-    (float)4.82872e-07,
-    (float)3.12033e-07,
-    (float)4.88582e-07,
-    (float)3.61083e-07,
-    (float)3.65859e-07,
-    (float)2.34452e-07,
-    (float)3.21457e-07,
-    (float)3.86826e-07,
-    (float)2.34041e-07,
-    (float)3.48977e-07,
-    (float)3.95084e-07,
-    (float)2.4005e-07,
-    (float)3.71094e-07,
-    (float)7.25357e-07,
-    (float)7.09038e-07,
-    (float)0.00325712,
-    (float)0.962142,
-    (float)0.0236029,
-    (float)0.0023896,
-    (float)0.000988282,
-    (float)0.000911046,
-    (float)0.00197845,
-    (float)0.0024017,
-    (float)0.000606787,
-    (float)9.20943e-05,
-    (float)0.000469679,
-    (float)0.000180727,
-    (float)0.000261584,
-    (float)3.78685e-05,
-    (float)4.47515e-05,
-    (float)6.81155e-05,
-    (float)0.000114606,
-    (float)5.40362e-05,
-    (float)2.78331e-05,
-    (float)7.50547e-05,
-    (float)8.7358e-06,
-    (float)8.34626e-05,
-    (float)3.12494e-06,
-    (float)6.33309e-07,
-    (float)1.92842e-07,
-    (float)1.1354e-05,
-    (float)1.63562e-05,
-    (float)6.9664e-07,
-    (float)2.01674e-06,
-    (float)5.56104e-06,
-    (float)2.11227e-06,
-    (float)4.68058e-06,
-    (float)7.92751e-06,
-    (float)5.95339e-06,
-    (float)8.00047e-06,
-    (float)4.95171e-07,
-    (float)2.09961e-06,
-    (float)5.64117e-06,
-    (float)8.44414e-06,
-    (float)7.90136e-06,
-    (float)2.33465e-06,
-    (float)2.53927e-06,
-    (float)9.1213e-07,
-    (float)1.98904e-06,
-    (float)1.6427e-06,
-    (float)6.24272e-06,
-    (float)9.85995e-07,
-    (float)4.96216e-07,
-    (float)2.27665e-06,
-    (float)9.35264e-06,
-    (float)1.70499e-06,
-    (float)3.18731e-06,
-    (float)8.22411e-07,
-    (float)2.81655e-06,
-    (float)2.70131e-06,
-    (float)1.28143e-06,
-    (float)3.6171e-06,
-    (float)1.85343e-06,
-    (float)1.0357e-06,
-    (float)1.42869e-06,
-    (float)1.14608e-06,
-    (float)1.41248e-06,
-    (float)9.66128e-07,
-    (float)9.01102e-07,
-    (float)1.77669e-06,
-    (float)1.2425e-06,
-    (float)1.43393e-06,
-    (float)1.78807e-06,
-    (float)2.04521e-06,
-    (float)2.09473e-06,
-    (float)9.41583e-07,
-    (float)1.00836e-06,
-    (float)4.635e-07,
-    (float)1.94216e-06,
-    (float)4.33018e-07,
-    (float)7.49252e-07,
-    (float)1.15172e-06,
-    (float)1.50752e-06,
-    (float)7.86912e-07,
-    (float)1.31499e-06,
-    (float)1.13894e-06,
-    (float)1.02222e-06,
-    (float)5.23778e-07,
-    (float)1.18082e-06,
-    (float)1.96408e-06,
-    (float)7.31684e-07,
-    (float)6.25095e-07,
-    (float)9.68089e-07,
-    (float)8.28284e-07,
-    (float)5.69906e-07,
-    (float)5.86039e-07,
-    (float)5.0618e-07,
-    (float)1.0237e-06,
-    (float)6.57923e-07,
-    (float)7.18342e-07,
-    (float)9.45061e-07,
-    (float)8.97496e-07,
-    (float)7.27493e-07,
-    (float)5.46277e-07,
-    (float)8.32153e-07,
-    (float)6.15014e-07,
-    (float)1.02565e-06,
-    (float)5.96048e-07,
-    (float)8.24513e-07,
-    (float)7.80975e-07,
-    (float)3.59468e-07,
-    (float)4.73084e-07,
-    (float)8.91298e-07,
-    (float)9.83638e-07,
-    (float)6.10364e-07,
-    (float)3.13095e-07,
-    (float)7.84979e-07,
-    (float)9.76595e-07,
-    (float)5.73774e-07,
-    (float)9.50807e-07,
-    (float)8.04664e-07,
-    (float)6.76372e-07,
-    (float)3.11775e-07,
-    (float)7.62433e-07,
-    (float)6.71033e-07,
-    (float)7.65296e-07,
-    (float)5.22459e-07,
-    (float)6.98207e-07,
-    (float)9.40543e-07,
-    (float)6.16954e-07,
-    (float)6.00644e-07,
-    (float)5.71412e-07,
-    (float)7.12167e-07,
-    (float)0.00576447,
-    (float)0.935664,
-    (float)0.0408855,
-    (float)0.00405281,
-    (float)0.00172229,
-    (float)0.00163853,
-    (float)0.0034337,
-    (float)0.00354034,
-    (float)0.00090109,
-    (float)0.000239728,
-    (float)0.000714131,
-    (float)0.000230541,
-    (float)0.00034591,
-    (float)2.58214e-05,
-    (float)3.53531e-05,
-    (float)0.000110237,
-    (float)9.43059e-05,
-    (float)9.96952e-05,
-    (float)3.16067e-05,
-    (float)5.229e-05,
-    (float)8.24421e-06,
-    (float)8.27779e-05,
-    (float)7.44159e-06,
-    (float)9.93492e-06,
-    (float)2.2212e-06,
-    (float)5.40766e-06,
-    (float)2.41315e-05,
-    (float)4.07126e-06,
-    (float)6.92667e-06,
-    (float)3.10669e-06,
-    (float)7.69381e-06,
-    (float)2.72841e-06,
-    (float)5.54326e-06,
-    (float)9.00602e-06,
-    (float)2.86605e-05,
-    (float)2.12759e-06,
-    (float)5.28167e-06,
-    (float)4.25106e-06,
-    (float)9.82912e-06,
-    (float)1.58826e-05,
-    (float)4.78491e-06,
-    (float)8.42876e-06,
-    (float)1.75552e-06,
-    (float)1.46923e-06,
-    (float)1.80804e-06,
-    (float)7.75362e-06,
-    (float)2.78473e-06,
-    (float)1.58448e-06,
-    (float)2.75585e-06,
-    (float)5.92615e-06,
-    (float)3.4456e-06,
-    (float)5.63976e-06,
-    (float)3.70743e-06,
-    (float)3.27809e-06,
-    (float)2.83244e-06,
-    (float)1.28885e-06,
-    (float)4.90188e-06,
-    (float)3.08577e-06,
-    (float)5.64487e-06,
-    (float)2.37313e-06,
-    (float)1.04727e-06,
-    (float)1.47467e-06,
-    (float)2.14853e-06,
-    (float)1.56737e-06,
-    (float)3.05916e-06,
-    (float)2.87247e-06,
-    (float)1.62877e-06,
-    (float)1.16292e-06,
-    (float)2.61953e-06,
-    (float)5.13966e-06,
-    (float)1.89866e-06,
-    (float)1.92292e-06,
-    (float)1.40985e-06,
-    (float)2.21546e-06,
-    (float)1.34976e-06,
-    (float)2.1705e-06,
-    (float)1.78091e-06,
-    (float)9.06596e-07,
-    (float)8.63302e-07,
-    (float)8.89366e-07,
-    (float)1.38078e-06,
-    (float)2.14559e-06,
-    (float)2.08439e-06,
-    (float)1.47053e-06,
-    (float)1.33653e-06,
-    (float)9.50423e-07,
-    (float)2.00248e-06,
-    (float)1.72648e-06,
-    (float)2.07069e-06,
-    (float)1.76783e-06,
-    (float)9.78934e-07,
-    (float)5.25461e-07,
-    (float)1.03932e-06,
-    (float)1.32902e-06,
-    (float)9.49474e-07,
-    (float)8.28455e-07,
-    (float)8.68514e-07,
-    (float)1.36037e-06,
-    (float)8.54847e-07,
-    (float)2.00782e-06,
-    (float)1.63543e-06,
-    (float)1.35026e-06,
-    (float)7.72743e-07,
-    (float)1.21432e-06,
-    (float)1.21136e-06,
-    (float)1.0656e-06,
-    (float)1.57373e-06,
-    (float)1.16366e-06,
-    (float)7.03751e-07,
-    (float)7.45421e-07,
-    (float)7.81281e-07,
-    (float)9.38496e-07,
-    (float)1.23011e-06,
-    (float)1.21445e-06,
-    (float)1.01548e-06,
-    (float)5.54296e-07,
-    (float)1.41603e-06,
-    (float)1.31355e-06,
-    (float)1.73401e-06,
-    (float)1.42794e-06,
-    (float)1.0789e-06,
-    (float)9.05486e-07,
-    (float)6.32135e-07,
-    (float)1.36381e-06,
-    (float)1.26702e-06,
-    (float)1.12007e-06,
-    (float)6.9055e-07,
-    (float)9.14251e-07,
-    (float)0.00937453,
-    (float)0.899251,
-    (float)0.0652119,
-    (float)0.00631987,
-    (float)0.00273386,
-    (float)0.00263759,
-    (float)0.0054533,
-    (float)0.00466136,
-    (float)0.0011875,
-    (float)0.00047569,
-    (float)0.000965062,
-    (float)0.000339692,
-    (float)0.000359604,
-    (float)8.12166e-06,
-    (float)1.79045e-05,
-    (float)0.000138933,
-    (float)4.27231e-05,
-    (float)0.000144661,
-    (float)5.34703e-05,
-    (float)2.60935e-05,
-    (float)6.54637e-06,
-    (float)5.35554e-05,
-    (float)3.0968e-05,
-    (float)3.71527e-05,
-    (float)1.92649e-05,
-    (float)8.42166e-06,
-    (float)2.75014e-05,
-    (float)1.0394e-05,
-    (float)1.07331e-05,
-    (float)3.48976e-06,
-    (float)2.66522e-05,
-    (float)4.00895e-06,
-    (float)3.17095e-06,
-    (float)7.38739e-06,
-    (float)3.83821e-05,
-    (float)7.75585e-06,
-    (float)1.46419e-05,
-    (float)1.01547e-05,
-    (float)6.78003e-06,
-    (float)1.14293e-05,
-    (float)4.07821e-06,
-    (float)1.57296e-05,
-    (float)7.40785e-06,
-    (float)5.65023e-06,
-    (float)3.57754e-06,
-    (float)4.27302e-06,
-    (float)4.54266e-06,
-    (float)3.4054e-06,
-    (float)4.69129e-06,
-    (float)5.14422e-06,
-    (float)7.16321e-06,
-    (float)3.89663e-06,
-    (float)3.76493e-06,
-    (float)6.48045e-06,
-    (float)1.2614e-05,
-    (float)2.88636e-06,
-    (float)4.72797e-06,
-    (float)2.19289e-06,
-    (float)6.0673e-06,
-    (float)3.86062e-06,
-    (float)3.30122e-06,
-    (float)6.47326e-06,
-    (float)3.42185e-06,
-    (float)2.05324e-06,
-    (float)2.63987e-06,
-    (float)2.98403e-06,
-    (float)3.04565e-06,
-    (float)2.83349e-06,
-    (float)2.99365e-06,
-    (float)3.78746e-06,
-    (float)2.61736e-06,
-    (float)3.16103e-06,
-    (float)3.17251e-06,
-    (float)3.89503e-06,
-    (float)4.13154e-06,
-    (float)1.86157e-06,
-    (float)1.50511e-06,
-    (float)1.52792e-06,
-    (float)3.88134e-06,
-    (float)1.39628e-06,
-    (float)2.39599e-06,
-    (float)2.34466e-06,
-    (float)1.93417e-06,
-    (float)1.20332e-06,
-    (float)2.44225e-06,
-    (float)3.35529e-06,
-    (float)2.8471e-06,
-    (float)1.3757e-06,
-    (float)1.83658e-06,
-    (float)2.24056e-06,
-    (float)1.42383e-06,
-    (float)2.41669e-06,
-    (float)2.11574e-06,
-    (float)1.89544e-06,
-    (float)1.75539e-06,
-    (float)1.36261e-06,
-    (float)1.0326e-06,
-    (float)1.85708e-06,
-    (float)1.87576e-06,
-    (float)1.32693e-06,
-    (float)1.45756e-06,
-    (float)2.09138e-06,
-    (float)2.66852e-06,
-    (float)1.29666e-06,
-    (float)2.16466e-06,
-    (float)2.06701e-06,
-    (float)1.70339e-06,
-    (float)8.92256e-07,
-    (float)1.78924e-06,
-    (float)1.94049e-06,
-    (float)1.29389e-06,
-    (float)1.70094e-06,
-    (float)1.41379e-06,
-    (float)1.7195e-06,
-    (float)1.40059e-06,
-    (float)1.22813e-06,
-    (float)1.62872e-06,
-    (float)1.99761e-06,
-    (float)1.9449e-06,
-    (float)1.78026e-06,
-    (float)1.20503e-06,
-    (float)2.01428e-06,
-    (float)1.74147e-06,
-    (float)1.43275e-06,
-    (float)1.83944e-06,
-    (float)1.77628e-06,
-    (float)1.61663e-06,
-    (float)6.26725e-07,
-    (float)0.014357,
-    (float)0.851318,
-    (float)0.0978493,
-    (float)0.00928686,
-    (float)0.00409021,
-    (float)0.00392181,
-    (float)0.00803769,
-    (float)0.00557642,
-    (float)0.00143324,
-    (float)0.000814271,
-    (float)0.00116295,
-    (float)0.00060393,
-    (float)0.000282248,
-    (float)2.33885e-07,
-    (float)4.05615e-06,
-    (float)0.000135023,
-    (float)2.88111e-06,
-    (float)0.000161765,
-    (float)9.3543e-05,
-    (float)3.25905e-05,
-    (float)4.69937e-06,
-    (float)2.56556e-05,
-    (float)5.31853e-05,
-    (float)6.81023e-05,
-    (float)6.00864e-05,
-    (float)1.94081e-05,
-    (float)4.18716e-05,
-    (float)1.03031e-05,
-    (float)8.51037e-06,
-    (float)2.4246e-06,
-    (float)4.47413e-05,
-    (float)1.32461e-05,
-    (float)5.70491e-06,
-    (float)6.6897e-06,
-    (float)2.50407e-05,
-    (float)1.1479e-05,
-    (float)1.84755e-05,
-    (float)2.54889e-05,
-    (float)1.35837e-05,
-    (float)1.00774e-05,
-    (float)2.45974e-06,
-    (float)1.17399e-05,
-    (float)1.2451e-05,
-    (float)1.70296e-05,
-    (float)1.11496e-05,
-    (float)6.61877e-06,
-    (float)6.91226e-06,
-    (float)3.42735e-06,
-    (float)4.43899e-06,
-    (float)6.43784e-06,
-    (float)1.37706e-05,
-    (float)5.02138e-06,
-    (float)3.26168e-06,
-    (float)7.02007e-06,
-    (float)1.40044e-05,
-    (float)6.69277e-06,
-    (float)9.92894e-06,
-    (float)6.22477e-06,
-    (float)5.30652e-06,
-    (float)3.8004e-06,
-    (float)3.3329e-06,
-    (float)8.54626e-06,
-    (float)5.2018e-06,
-    (float)7.50563e-06,
-    (float)3.19109e-06,
-    (float)3.01887e-06,
-    (float)3.81276e-06,
-    (float)4.27529e-06,
-    (float)3.34941e-06,
-    (float)5.76764e-06,
-    (float)5.43917e-06,
-    (float)3.78679e-06,
-    (float)2.48676e-06,
-    (float)4.88394e-06,
-    (float)6.23553e-06,
-    (float)3.15449e-06,
-    (float)4.32081e-06,
-    (float)3.67119e-06,
-    (float)3.86898e-06,
-    (float)2.57759e-06,
-    (float)3.15892e-06,
-    (float)2.89847e-06,
-    (float)2.19218e-06,
-    (float)3.08744e-06,
-    (float)2.09864e-06,
-    (float)2.69366e-06,
-    (float)3.20587e-06,
-    (float)3.19762e-06,
-    (float)2.46949e-06,
-    (float)4.05269e-06,
-    (float)3.50386e-06,
-    (float)2.87378e-06,
-    (float)1.59236e-06,
-    (float)3.13588e-06,
-    (float)3.15072e-06,
-    (float)2.5e-06,
-    (float)3.05882e-06,
-    (float)3.06566e-06,
-    (float)1.99875e-06,
-    (float)1.61027e-06,
-    (float)2.07393e-06,
-    (float)2.10061e-06,
-    (float)2.53291e-06,
-    (float)2.00874e-06,
-    (float)2.35118e-06,
-    (float)2.1015e-06,
-    (float)2.97188e-06,
-    (float)2.62548e-06,
-    (float)2.76809e-06,
-    (float)3.01617e-06,
-    (float)2.24128e-06,
-    (float)2.04268e-06,
-    (float)1.64779e-06,
-    (float)3.02054e-06,
-    (float)2.69383e-06,
-    (float)2.2893e-06,
-    (float)2.28136e-06,
-    (float)2.07666e-06,
-    (float)1.59978e-06,
-    (float)1.92224e-06,
-    (float)2.08766e-06,
-    (float)3.08555e-06,
-    (float)2.18562e-06,
-    (float)2.05912e-06,
-    (float)2.34154e-06,
-    (float)2.10914e-06,
-    (float)3.16997e-06,
-    (float)2.04773e-06,
-    (float)0.0209244,
-    (float)0.79103,
-    (float)0.139547,
-    (float)0.0129624,
-    (float)0.00579441,
-    (float)0.00544838,
-    (float)0.011155,
-    (float)0.00616293,
-    (float)0.00157767,
-    (float)0.00121258,
-    (float)0.00125527,
-    (float)0.00115595,
-    (float)0.000138196,
-    (float)2.25861e-05,
-    (float)2.74969e-06,
-    (float)9.68104e-05,
-    (float)1.49295e-05,
-    (float)0.000136797,
-    (float)0.000140664,
-    (float)8.51382e-05,
-    (float)9.16546e-06,
-    (float)3.15198e-05,
-    (float)5.89483e-05,
-    (float)8.1076e-05,
-    (float)0.000107016,
-    (float)2.77118e-05,
-    (float)8.5744e-05,
-    (float)4.71028e-06,
-    (float)3.41334e-06,
-    (float)1.23727e-06,
-    (float)4.05714e-05,
-    (float)3.29034e-05,
-    (float)8.01423e-06,
-    (float)1.44876e-05,
-    (float)1.58405e-05,
-    (float)1.26203e-05,
-    (float)1.21116e-05,
-    (float)2.82707e-05,
-    (float)2.54287e-05,
-    (float)3.55983e-05,
-    (float)5.84903e-06,
-    (float)1.1155e-05,
-    (float)1.02429e-05,
-    (float)1.78373e-05,
-    (float)1.93317e-05,
-    (float)1.06814e-05,
-    (float)2.05007e-05,
-    (float)7.09591e-06,
-    (float)5.21982e-06,
-    (float)5.05367e-06,
-    (float)1.16775e-05,
-    (float)8.17292e-06,
-    (float)8.5007e-06,
-    (float)1.04161e-05,
-    (float)1.07154e-05,
-    (float)9.32855e-06,
-    (float)8.30475e-06,
-    (float)8.65977e-06,
-    (float)1.16631e-05,
-    (float)1.61982e-05,
-    (float)5.62384e-06,
-    (float)7.246e-06,
-    (float)3.88634e-06,
-    (float)7.69794e-06,
-    (float)4.87884e-06,
-    (float)6.67557e-06,
-    (float)1.07246e-05,
-    (float)5.68788e-06,
-    (float)4.44911e-06,
-    (float)3.74463e-06,
-    (float)4.66077e-06,
-    (float)5.61634e-06,
-    (float)6.87122e-06,
-    (float)6.06739e-06,
-    (float)6.57009e-06,
-    (float)4.82373e-06,
-    (float)4.74472e-06,
-    (float)4.0378e-06,
-    (float)6.26851e-06,
-    (float)7.25945e-06,
-    (float)3.70215e-06,
-    (float)3.6141e-06,
-    (float)3.18953e-06,
-    (float)4.21991e-06,
-    (float)2.74168e-06,
-    (float)4.62848e-06,
-    (float)4.20605e-06,
-    (float)3.42123e-06,
-    (float)3.51757e-06,
-    (float)3.18983e-06,
-    (float)4.28344e-06,
-    (float)4.86581e-06,
-    (float)4.8865e-06,
-    (float)3.83098e-06,
-    (float)4.44641e-06,
-    (float)3.44156e-06,
-    (float)3.37623e-06,
-    (float)2.08755e-06,
-    (float)3.82728e-06,
-    (float)3.95231e-06,
-    (float)3.25786e-06,
-    (float)3.41631e-06,
-    (float)2.87113e-06,
-    (float)2.49365e-06,
-    (float)2.37795e-06,
-    (float)3.34222e-06,
-    (float)3.40235e-06,
-    (float)4.314e-06,
-    (float)3.13663e-06,
-    (float)3.28368e-06,
-    (float)3.20545e-06,
-    (float)3.9916e-06,
-    (float)4.12612e-06,
-    (float)3.22542e-06,
-    (float)3.91816e-06,
-    (float)2.70394e-06,
-    (float)2.73697e-06,
-    (float)1.86476e-06,
-    (float)3.00461e-06,
-    (float)3.22105e-06,
-    (float)3.49085e-06,
-    (float)3.76374e-06,
-    (float)2.63321e-06,
-    (float)2.9765e-06,
-    (float)2.34463e-06,
-    (float)3.03065e-06,
-    (float)4.12225e-06,
-    (float)4.6543e-06,
-    (float)0.0291145,
-    (float)0.719139,
-    (float)0.190066,
-    (float)0.0172356,
-    (float)0.00774198,
-    (float)0.00712278,
-    (float)0.0146118,
-    (float)0.00638997,
-    (float)0.0015789,
-    (float)0.00159645,
-    (float)0.00119217,
-    (float)0.00207838,
-    (float)1.74819e-05,
-    (float)9.79986e-05,
-    (float)1.00512e-05,
-    (float)5.21393e-05,
-    (float)7.37038e-05,
-    (float)7.89312e-05,
-    (float)0.000168178,
-    (float)0.000149382,
-    (float)3.56304e-05,
-    (float)6.8796e-05,
-    (float)7.15697e-05,
-    (float)6.88005e-05,
-    (float)0.000116034,
-    (float)2.54598e-05,
-    (float)0.000136883,
-    (float)2.15366e-05,
-    (float)1.37637e-05,
-    (float)4.22529e-06,
-    (float)2.49271e-05,
-    (float)4.28094e-05,
-    (float)6.14359e-06,
-    (float)2.25926e-05,
-    (float)2.11046e-05,
-    (float)3.19577e-05,
-    (float)1.01528e-05,
-    (float)1.57289e-05,
-    (float)2.29707e-05,
-    (float)5.10082e-05,
-    (float)1.71412e-05,
-    (float)2.60162e-05,
-    (float)2.4142e-05,
-    (float)1.53561e-05,
-    (float)1.30798e-05,
-    (float)7.28574e-06,
-    (float)2.71523e-05,
-    (float)1.58701e-05,
-    (float)1.75274e-05,
-    (float)9.9885e-06,
-    (float)1.06335e-05,
-    (float)9.31464e-06,
-    (float)8.05014e-06,
-    (float)9.72834e-06,
-    (float)1.36856e-05,
-    (float)1.92433e-05,
-    (float)8.82265e-06,
-    (float)7.20649e-06,
-    (float)1.25854e-05,
-    (float)1.87827e-05,
-    (float)1.01105e-05,
-    (float)1.38801e-05,
-    (float)1.10362e-05,
-    (float)9.24536e-06,
-    (float)6.28334e-06,
-    (float)5.58773e-06,
-    (float)9.86889e-06,
-    (float)7.17821e-06,
-    (float)9.97816e-06,
-    (float)5.04842e-06,
-    (float)8.32075e-06,
-    (float)9.22239e-06,
-    (float)6.23046e-06,
-    (float)4.39781e-06,
-    (float)7.54316e-06,
-    (float)8.24106e-06,
-    (float)6.65126e-06,
-    (float)6.33119e-06,
-    (float)7.74499e-06,
-    (float)6.79109e-06,
-    (float)4.50895e-06,
-    (float)6.54249e-06,
-    (float)6.07469e-06,
-    (float)7.90167e-06,
-    (float)5.67691e-06,
-    (float)3.77858e-06,
-    (float)3.84617e-06,
-    (float)5.00036e-06,
-    (float)5.68922e-06,
-    (float)3.9774e-06,
-    (float)6.19995e-06,
-    (float)5.3346e-06,
-    (float)3.41761e-06,
-    (float)3.70544e-06,
-    (float)5.55301e-06,
-    (float)5.88456e-06,
-    (float)5.51527e-06,
-    (float)4.30095e-06,
-    (float)4.85137e-06,
-    (float)4.92269e-06,
-    (float)4.52534e-06,
-    (float)3.86972e-06,
-    (float)3.5523e-06,
-    (float)5.23822e-06,
-    (float)3.95014e-06,
-    (float)4.25231e-06,
-    (float)4.95485e-06,
-    (float)5.30793e-06,
-    (float)3.00636e-06,
-    (float)3.35049e-06,
-    (float)3.96825e-06,
-    (float)4.81171e-06,
-    (float)4.64497e-06,
-    (float)3.65051e-06,
-    (float)4.50813e-06,
-    (float)4.39716e-06,
-    (float)5.30161e-06,
-    (float)3.4443e-06,
-    (float)4.76169e-06,
-    (float)4.88968e-06,
-    (float)3.87525e-06,
-    (float)3.50325e-06,
-    (float)4.18441e-06,
-    (float)5.27961e-06,
-    (float)3.71924e-06,
-    (float)3.72984e-06,
-    (float)4.10986e-06,
-    (float)4.24369e-06,
-    (float)0.0388788,
-    (float)0.637732,
-    (float)0.247813,
-    (float)0.0219335,
-    (float)0.00992852,
-    (float)0.00877607,
-    (float)0.0180703,
-    (float)0.00642258,
-    (float)0.00141899,
-    (float)0.00190925,
-    (float)0.000971019,
-    (float)0.00337544,
-    (float)5.59627e-05,
-    (float)0.000235572,
-    (float)1.84647e-05,
-    (float)5.53547e-05,
-    (float)0.000123391,
-    (float)3.1711e-05,
-    (float)0.00015174,
-    (float)0.000175574,
-    (float)9.49032e-05,
-    (float)9.19631e-05,
-    (float)0.000142825,
-    (float)5.85358e-05,
-    (float)8.38847e-05,
-    (float)1.79216e-05,
-    (float)0.000147124,
-    (float)7.12015e-05,
-    (float)4.87896e-05,
-    (float)2.03224e-05,
-    (float)2.38399e-05,
-    (float)3.55913e-05,
-    (float)4.6621e-06,
-    (float)2.03882e-05,
-    (float)1.94395e-05,
-    (float)6.42728e-05,
-    (float)1.98019e-05,
-    (float)1.55685e-05,
-    (float)1.99548e-05,
-    (float)3.71836e-05,
-    (float)2.51688e-05,
-    (float)3.12898e-05,
-    (float)5.07116e-05,
-    (float)2.97246e-05,
-    (float)2.32727e-05,
-    (float)6.48379e-06,
-    (float)1.73969e-05,
-    (float)1.5904e-05,
-    (float)2.54384e-05,
-    (float)1.86094e-05,
-    (float)1.66754e-05,
-    (float)2.31656e-05,
-    (float)9.59474e-06,
-    (float)8.94939e-06,
-    (float)9.77463e-06,
-    (float)1.85535e-05,
-    (float)1.18856e-05,
-    (float)1.57906e-05,
-    (float)1.69055e-05,
-    (float)1.64273e-05,
-    (float)1.37925e-05,
-    (float)1.27522e-05,
-    (float)1.23926e-05,
-    (float)1.64112e-05,
-    (float)2.10345e-05,
-    (float)9.71127e-06,
-    (float)1.13521e-05,
-    (float)7.15851e-06,
-    (float)7.59194e-06,
-    (float)4.93263e-06,
-    (float)8.9302e-06,
-    (float)1.32978e-05,
-    (float)8.30957e-06,
-    (float)9.92145e-06,
-    (float)6.39643e-06,
-    (float)7.73702e-06,
-    (float)8.28138e-06,
-    (float)9.38167e-06,
-    (float)8.00901e-06,
-    (float)1.0842e-05,
-    (float)9.97321e-06,
-    (float)7.76455e-06,
-    (float)6.9143e-06,
-    (float)8.27923e-06,
-    (float)7.7544e-06,
-    (float)5.37098e-06,
-    (float)8.4421e-06,
-    (float)5.88833e-06,
-    (float)6.60269e-06,
-    (float)4.6908e-06,
-    (float)4.72425e-06,
-    (float)4.3234e-06,
-    (float)5.93185e-06,
-    (float)7.33816e-06,
-    (float)5.41241e-06,
-    (float)7.97037e-06,
-    (float)5.76119e-06,
-    (float)5.29968e-06,
-    (float)5.49572e-06,
-    (float)7.70045e-06,
-    (float)7.15309e-06,
-    (float)7.102e-06,
-    (float)6.82311e-06,
-    (float)5.16153e-06,
-    (float)4.96724e-06,
-    (float)4.36241e-06,
-    (float)5.03327e-06,
-    (float)4.06282e-06,
-    (float)5.91965e-06,
-    (float)4.58246e-06,
-    (float)5.09561e-06,
-    (float)5.63913e-06,
-    (float)4.86908e-06,
-    (float)4.77e-06,
-    (float)5.53431e-06,
-    (float)6.6214e-06,
-    (float)5.70372e-06,
-    (float)6.69605e-06,
-    (float)5.66291e-06,
-    (float)5.53112e-06,
-    (float)5.19189e-06,
-    (float)6.37905e-06,
-    (float)5.62703e-06,
-    (float)5.97244e-06,
-    (float)6.16655e-06,
-    (float)4.0068e-06,
-    (float)4.52018e-06,
-    (float)3.88936e-06,
-    (float)0.0497811,
-    (float)0.551469,
-    (float)0.309562,
-    (float)0.0267076,
-    (float)0.0120051,
-    (float)0.0102707,
-    (float)0.0210998,
-    (float)0.00666098,
-    (float)0.00112589,
-    (float)0.00201073,
-    (float)0.000652699,
-    (float)0.00489916,
-    (float)0.000365716,
-    (float)0.000425361,
-    (float)2.69573e-05,
-    (float)0.000160474,
-    (float)0.000106051,
-    (float)3.06008e-05,
-    (float)0.000101138,
-    (float)0.00013408,
-    (float)0.000157052,
-    (float)6.51386e-05,
-    (float)0.000278696,
-    (float)8.8664e-05,
-    (float)5.25013e-05,
-    (float)7.38048e-06,
-    (float)0.000101277,
-    (float)0.000107287,
-    (float)8.45887e-05,
-    (float)5.92307e-05,
-    (float)4.28507e-05,
-    (float)5.35393e-05,
-    (float)5.56323e-06,
-    (float)1.0446e-05,
-    (float)1.16434e-05,
-    (float)6.75747e-05,
-    (float)3.9104e-05,
-    (float)2.25938e-05,
-    (float)3.54925e-05,
-    (float)3.29335e-05,
-    (float)2.63627e-05,
-    (float)1.98877e-05,
-    (float)4.03498e-05,
-    (float)4.01188e-05,
-    (float)5.26656e-05,
-    (float)1.95857e-05,
-    (float)2.82422e-05,
-    (float)2.54924e-05,
-    (float)1.88583e-05,
-    (float)1.40167e-05,
-    (float)1.20223e-05,
-    (float)3.60018e-05,
-    (float)1.96908e-05,
-    (float)2.32952e-05,
-    (float)1.4189e-05,
-    (float)1.67894e-05,
-    (float)1.31883e-05,
-    (float)1.23758e-05,
-    (float)1.38587e-05,
-    (float)1.95672e-05,
-    (float)2.50939e-05,
-    (float)1.3191e-05,
-    (float)1.3727e-05,
-    (float)1.79377e-05,
-    (float)1.94797e-05,
-    (float)1.22252e-05,
-    (float)1.63934e-05,
-    (float)1.51017e-05,
-    (float)1.66534e-05,
-    (float)1.34158e-05,
-    (float)8.14205e-06,
-    (float)9.06312e-06,
-    (float)8.22556e-06,
-    (float)1.01387e-05,
-    (float)6.90919e-06,
-    (float)1.44692e-05,
-    (float)1.65935e-05,
-    (float)9.25511e-06,
-    (float)8.12999e-06,
-    (float)7.96577e-06,
-    (float)8.89443e-06,
-    (float)9.70441e-06,
-    (float)1.02772e-05,
-    (float)9.98913e-06,
-    (float)1.09083e-05,
-    (float)9.61439e-06,
-    (float)7.08889e-06,
-    (float)6.73775e-06,
-    (float)9.59322e-06,
-    (float)7.21429e-06,
-    (float)5.88597e-06,
-    (float)8.87672e-06,
-    (float)9.15052e-06,
-    (float)8.23167e-06,
-    (float)5.56735e-06,
-    (float)5.63418e-06,
-    (float)5.87504e-06,
-    (float)8.63944e-06,
-    (float)8.03889e-06,
-    (float)7.40366e-06,
-    (float)8.83559e-06,
-    (float)7.57179e-06,
-    (float)4.91878e-06,
-    (float)5.96116e-06,
-    (float)8.06159e-06,
-    (float)7.08712e-06,
-    (float)7.36068e-06,
-    (float)6.81102e-06,
-    (float)8.40994e-06,
-    (float)7.21434e-06,
-    (float)6.23478e-06,
-    (float)4.14816e-06,
-    (float)5.07622e-06,
-    (float)7.31568e-06,
-    (float)6.2743e-06,
-    (float)7.45519e-06,
-    (float)8.8579e-06,
-    (float)8.25061e-06,
-    (float)5.39699e-06,
-    (float)5.81336e-06,
-    (float)5.79409e-06,
-    (float)6.8717e-06,
-    (float)7.12689e-06,
-    (float)6.27934e-06,
-    (float)6.62379e-06,
-    (float)7.53253e-06,
-    (float)7.10989e-06,
-    (float)4.76301e-06,
-    (float)0.0611943,
-    (float)0.466685,
-    (float)0.370618,
-    (float)0.0310202,
-    (float)0.0138802,
-    (float)0.0113162,
-    (float)0.0232082,
-    (float)0.00769838,
-    (float)0.000751271,
-    (float)0.00189189,
-    (float)0.000323712,
-    (float)0.0063545,
-    (float)0.000945081,
-    (float)0.000620325,
-    (float)5.03581e-05,
-    (float)0.000364782,
-    (float)5.52185e-05,
-    (float)6.52668e-05,
-    (float)4.92972e-05,
-    (float)5.35294e-05,
-    (float)0.000174352,
-    (float)1.66508e-05,
-    (float)0.000387257,
-    (float)0.000154754,
-    (float)8.94633e-05,
-    (float)6.15517e-06,
-    (float)6.68142e-05,
-    (float)9.08535e-05,
-    (float)8.70542e-05,
-    (float)9.38884e-05,
-    (float)4.39557e-05,
-    (float)0.000117301,
-    (float)2.46239e-05,
-    (float)2.08494e-05,
-    (float)9.1281e-06,
-    (float)4.08213e-05,
-    (float)3.87416e-05,
-    (float)1.89916e-05,
-    (float)4.43662e-05,
-    (float)4.20699e-05,
-    (float)5.56305e-05,
-    (float)2.14028e-05,
-    (float)2.46437e-05,
-    (float)3.25511e-05,
-    (float)4.95652e-05,
-    (float)3.24856e-05,
-    (float)4.05607e-05,
-    (float)5.66783e-05,
-    (float)3.07993e-05,
-    (float)2.14148e-05,
-    (float)9.57646e-06,
-    (float)2.24411e-05,
-    (float)1.78905e-05,
-    (float)2.68059e-05,
-    (float)1.78196e-05,
-    (float)2.26214e-05,
-    (float)3.07355e-05,
-    (float)1.37451e-05,
-    (float)1.64893e-05,
-    (float)1.44751e-05,
-    (float)2.01264e-05,
-    (float)1.33284e-05,
-    (float)2.22106e-05,
-    (float)2.18813e-05,
-    (float)2.30968e-05,
-    (float)2.01978e-05,
-    (float)1.4517e-05,
-    (float)1.42351e-05,
-    (float)1.88911e-05,
-    (float)2.18642e-05,
-    (float)1.23568e-05,
-    (float)1.89893e-05,
-    (float)1.36344e-05,
-    (float)1.24229e-05,
-    (float)8.44219e-06,
-    (float)8.93115e-06,
-    (float)9.93252e-06,
-    (float)8.77245e-06,
-    (float)1.20187e-05,
-    (float)8.32969e-06,
-    (float)1.55685e-05,
-    (float)1.36046e-05,
-    (float)9.72012e-06,
-    (float)1.00695e-05,
-    (float)1.07223e-05,
-    (float)1.06117e-05,
-    (float)1.01779e-05,
-    (float)1.33496e-05,
-    (float)1.10283e-05,
-    (float)1.08322e-05,
-    (float)8.85772e-06,
-    (float)8.67366e-06,
-    (float)8.42028e-06,
-    (float)9.7395e-06,
-    (float)7.22489e-06,
-    (float)6.00227e-06,
-    (float)9.71937e-06,
-    (float)7.42712e-06,
-    (float)8.484e-06,
-    (float)6.81006e-06,
-    (float)8.14861e-06,
-    (float)6.9499e-06,
-    (float)9.03214e-06,
-    (float)9.15418e-06,
-    (float)8.41559e-06,
-    (float)1.03653e-05,
-    (float)7.73047e-06,
-    (float)8.3117e-06,
-    (float)9.14897e-06,
-    (float)1.02941e-05,
-    (float)7.06432e-06,
-    (float)8.12558e-06,
-    (float)7.97903e-06,
-    (float)8.12451e-06,
-    (float)7.50179e-06,
-    (float)6.60682e-06,
-    (float)6.29522e-06,
-    (float)6.12176e-06,
-    (float)7.70822e-06,
-    (float)5.59103e-06,
-    (float)8.49556e-06,
-    (float)8.53547e-06,
-    (float)7.89063e-06,
-    (float)7.97798e-06,
-    (float)9.274e-06,
-    (float)9.39133e-06,
-    (float)7.49895e-06,
-    (float)8.87002e-06,
-    (float)0.0723779,
-    (float)0.389838,
-    (float)0.425932,
-    (float)0.0345949,
-    (float)0.0152173,
-    (float)0.0118509,
-    (float)0.0239949,
-    (float)0.0100724,
-    (float)0.000412245,
-    (float)0.00154527,
-    (float)0.000110453,
-    (float)0.00744132,
-    (float)0.00164886,
-    (float)0.000770484,
-    (float)0.000130667,
-    (float)0.000600474,
-    (float)0.000133171,
-    (float)8.23127e-05,
-    (float)5.16705e-05,
-    (float)8.08219e-06,
-    (float)0.00012966,
-    (float)2.62484e-06,
-    (float)0.000369706,
-    (float)0.000217554,
-    (float)0.000162799,
-    (float)2.67579e-05,
-    (float)7.13261e-05,
-    (float)8.48344e-05,
-    (float)6.53034e-05,
-    (float)8.22251e-05,
-    (float)2.77572e-05,
-    (float)0.000160063,
-    (float)7.20121e-05,
-    (float)5.28912e-05,
-    (float)2.44403e-05,
-    (float)4.20731e-05,
-    (float)2.85164e-05,
-    (float)1.2164e-05,
-    (float)2.79802e-05,
-    (float)3.32176e-05,
-    (float)7.96171e-05,
-    (float)3.53167e-05,
-    (float)3.48929e-05,
-    (float)4.37752e-05,
-    (float)3.93747e-05,
-    (float)3.13746e-05,
-    (float)2.86003e-05,
-    (float)4.77961e-05,
-    (float)4.35892e-05,
-    (float)4.86576e-05,
-    (float)2.45249e-05,
-    (float)3.13225e-05,
-    (float)3.19486e-05,
-    (float)1.92992e-05,
-    (float)1.19641e-05,
-    (float)1.32117e-05,
-    (float)3.42915e-05,
-    (float)2.0958e-05,
-    (float)2.98955e-05,
-    (float)1.90456e-05,
-    (float)2.38378e-05,
-    (float)2.27209e-05,
-    (float)1.52425e-05,
-    (float)1.66739e-05,
-    (float)1.91518e-05,
-    (float)2.53164e-05,
-    (float)1.66438e-05,
-    (float)2.42232e-05,
-    (float)2.27603e-05,
-    (float)1.97851e-05,
-    (float)1.452e-05,
-    (float)1.38471e-05,
-    (float)1.26297e-05,
-    (float)2.03625e-05,
-    (float)1.99269e-05,
-    (float)1.2605e-05,
-    (float)1.51687e-05,
-    (float)1.22474e-05,
-    (float)1.12129e-05,
-    (float)7.91038e-06,
-    (float)1.05991e-05,
-    (float)1.06397e-05,
-    (float)1.25104e-05,
-    (float)1.37334e-05,
-    (float)1.23375e-05,
-    (float)1.56884e-05,
-    (float)1.42994e-05,
-    (float)8.96845e-06,
-    (float)9.59154e-06,
-    (float)1.11154e-05,
-    (float)1.1132e-05,
-    (float)1.22958e-05,
-    (float)1.17846e-05,
-    (float)1.1087e-05,
-    (float)9.60456e-06,
-    (float)9.69163e-06,
-    (float)7.85689e-06,
-    (float)8.13587e-06,
-    (float)9.76614e-06,
-    (float)7.66589e-06,
-    (float)8.84226e-06,
-    (float)1.12644e-05,
-    (float)1.07549e-05,
-    (float)1.03319e-05,
-    (float)8.10827e-06,
-    (float)7.72744e-06,
-    (float)8.103e-06,
-    (float)1.04093e-05,
-    (float)1.00797e-05,
-    (float)9.4212e-06,
-    (float)1.09931e-05,
-    (float)9.46083e-06,
-    (float)9.28211e-06,
-    (float)9.2077e-06,
-    (float)8.17065e-06,
-    (float)7.04033e-06,
-    (float)8.2801e-06,
-    (float)8.27989e-06,
-    (float)1.02803e-05,
-    (float)1.01743e-05,
-    (float)9.58069e-06,
-    (float)7.19002e-06,
-    (float)8.30517e-06,
-    (float)8.80274e-06,
-    (float)8.15145e-06,
-    (float)1.03369e-05,
-    (float)9.17812e-06,
-    (float)1.05268e-05,
-    (float)0.0824213,
-    (float)0.326611,
-    (float)0.47117,
-    (float)0.0369509,
-    (float)0.0159521,
-    (float)0.0117317,
-    (float)0.0233217,
-    (float)0.0142616,
-    (float)0.000194052,
-    (float)0.00107641,
-    (float)9.85776e-05,
-    (float)0.00797209,
-    (float)0.00222905,
-    (float)0.000829261,
-    (float)0.000280295,
-    (float)0.000759878,
-    (float)0.000553256,
-    (float)5.26916e-05,
-    (float)0.000135463,
-    (float)2.00934e-05,
-    (float)6.19155e-05,
-    (float)2.78295e-05,
-    (float)0.000238865,
-    (float)0.00020755,
-    (float)0.000185283,
-    (float)7.62352e-05,
-    (float)8.36917e-05,
-    (float)0.000196683,
-    (float)6.56794e-05,
-    (float)5.18555e-05,
-    (float)8.37283e-06,
-    (float)0.000129266,
-    (float)9.48948e-05,
-    (float)7.40312e-05,
-    (float)5.23551e-05,
-    (float)5.80584e-05,
-    (float)6.2727e-05,
-    (float)1.74876e-05,
-    (float)2.22465e-05,
-    (float)1.64048e-05,
-    (float)5.71052e-05,
-    (float)3.40076e-05,
-    (float)3.90738e-05,
-    (float)5.90203e-05,
-    (float)5.38098e-05,
-    (float)5.22195e-05,
-    (float)2.53188e-05,
-    (float)2.88166e-05,
-    (float)3.68647e-05,
-    (float)4.53242e-05,
-    (float)3.32235e-05,
-    (float)4.15385e-05,
-    (float)5.89571e-05,
-    (float)3.54413e-05,
-    (float)2.65829e-05,
-    (float)1.5568e-05,
-    (float)2.32698e-05,
-    (float)1.94647e-05,
-    (float)2.03001e-05,
-    (float)1.43059e-05,
-    (float)2.31353e-05,
-    (float)3.85381e-05,
-    (float)1.80561e-05,
-    (float)2.82294e-05,
-    (float)1.96752e-05,
-    (float)2.32831e-05,
-    (float)1.53236e-05,
-    (float)1.73503e-05,
-    (float)1.9486e-05,
-    (float)2.28798e-05,
-    (float)2.60272e-05,
-    (float)1.53644e-05,
-    (float)2.52432e-05,
-    (float)2.05462e-05,
-    (float)1.84615e-05,
-    (float)1.09632e-05,
-    (float)1.47001e-05,
-    (float)1.31325e-05,
-    (float)1.87691e-05,
-    (float)1.70447e-05,
-    (float)1.2284e-05,
-    (float)1.73668e-05,
-    (float)1.11295e-05,
-    (float)1.1023e-05,
-    (float)7.22278e-06,
-    (float)1.20553e-05,
-    (float)1.03625e-05,
-    (float)1.10052e-05,
-    (float)1.30828e-05,
-    (float)1.35532e-05,
-    (float)1.8298e-05,
-    (float)1.35274e-05,
-    (float)1.09651e-05,
-    (float)1.16313e-05,
-    (float)1.21932e-05,
-    (float)9.81593e-06,
-    (float)1.0271e-05,
-    (float)1.14893e-05,
-    (float)1.20382e-05,
-    (float)1.17038e-05,
-    (float)1.0275e-05,
-    (float)1.03488e-05,
-    (float)1.02393e-05,
-    (float)9.12923e-06,
-    (float)6.42182e-06,
-    (float)8.57687e-06,
-    (float)1.12853e-05,
-    (float)1.01018e-05,
-    (float)1.1041e-05,
-    (float)8.90134e-06,
-    (float)1.16072e-05,
-    (float)9.8694e-06,
-    (float)9.30208e-06,
-    (float)8.9963e-06,
-    (float)9.49975e-06,
-    (float)1.34336e-05,
-    (float)9.54516e-06,
-    (float)1.33534e-05,
-    (float)1.16175e-05,
-    (float)1.20192e-05,
-    (float)8.82033e-06,
-    (float)7.98147e-06,
-    (float)8.89174e-06,
-    (float)8.75932e-06,
-    (float)9.4936e-06,
-    (float)7.89794e-06,
-    (float)1.15419e-05,
-    (float)1.10926e-05,
-    (float)0.0909539,
-    (float)0.280364,
-    (float)0.503574,
-    (float)0.0380303,
-    (float)0.0159492,
-    (float)0.0110891,
-    (float)0.0212458,
-    (float)0.0202939,
-    (float)0.000178143,
-    (float)0.00060808,
-    (float)0.000306962,
-    (float)0.00782588,
-    (float)0.00245421,
-    (float)0.000781631,
-    (float)0.000470342,
-    (float)0.000747536,
-    (float)0.00139147,
-    (float)6.96398e-06,
-    (float)0.000269035,
-    (float)5.87093e-05,
-    (float)5.50271e-05,
-    (float)2.88764e-05,
-    (float)9.84909e-05,
-    (float)0.000133599,
-    (float)0.000116927,
-    (float)0.000112765,
-    (float)4.8665e-05,
-    (float)0.000358143,
-    (float)0.000120233,
-    (float)7.10479e-05,
-    (float)5.67775e-06,
-    (float)7.62386e-05,
-    (float)6.27164e-05,
-    (float)6.20915e-05,
-    (float)6.21269e-05,
-    (float)4.14033e-05,
-    (float)0.000122515,
-    (float)4.3542e-05,
-    (float)4.57169e-05,
-    (float)2.47454e-05,
-    (float)4.83943e-05,
-    (float)2.18567e-05,
-    (float)2.56511e-05,
-    (float)3.8636e-05,
-    (float)4.11826e-05,
-    (float)7.20241e-05,
-    (float)3.47266e-05,
-    (float)4.64268e-05,
-    (float)5.26653e-05,
-    (float)4.25484e-05,
-    (float)3.29427e-05,
-    (float)2.89854e-05,
-    (float)3.44635e-05,
-    (float)3.91066e-05,
-    (float)4.30652e-05,
-    (float)3.13079e-05,
-    (float)3.58998e-05,
-    (float)4.12405e-05,
-    (float)2.13956e-05,
-    (float)1.42704e-05,
-    (float)1.48528e-05,
-    (float)2.18617e-05,
-    (float)1.84864e-05,
-    (float)2.21663e-05,
-    (float)1.75564e-05,
-    (float)2.66607e-05,
-    (float)3.41979e-05,
-    (float)1.83899e-05,
-    (float)2.58394e-05,
-    (float)2.00818e-05,
-    (float)2.14523e-05,
-    (float)1.73372e-05,
-    (float)2.04581e-05,
-    (float)2.00678e-05,
-    (float)2.03388e-05,
-    (float)2.10754e-05,
-    (float)1.48001e-05,
-    (float)2.05547e-05,
-    (float)1.76322e-05,
-    (float)1.5222e-05,
-    (float)1.12996e-05,
-    (float)1.42744e-05,
-    (float)1.1701e-05,
-    (float)1.78855e-05,
-    (float)1.42757e-05,
-    (float)1.18271e-05,
-    (float)1.42975e-05,
-    (float)1.05475e-05,
-    (float)1.24903e-05,
-    (float)9.94442e-06,
-    (float)1.27324e-05,
-    (float)1.01226e-05,
-    (float)1.28943e-05,
-    (float)1.29495e-05,
-    (float)1.40217e-05,
-    (float)1.63493e-05,
-    (float)1.31751e-05,
-    (float)1.14814e-05,
-    (float)1.2356e-05,
-    (float)1.11249e-05,
-    (float)1.02326e-05,
-    (float)1.09162e-05,
-    (float)8.44539e-06,
-    (float)1.08e-05,
-    (float)9.85011e-06,
-    (float)1.24331e-05,
-    (float)1.0472e-05,
-    (float)1.11455e-05,
-    (float)9.48929e-06,
-    (float)9.241e-06,
-    (float)1.24593e-05,
-    (float)9.84147e-06,
-    (float)1.19361e-05,
-    (float)9.65408e-06,
-    (float)1.0383e-05,
-    (float)1.14742e-05,
-    (float)1.22994e-05,
-    (float)1.1637e-05,
-    (float)1.11984e-05,
-    (float)1.0453e-05,
-    (float)1.09647e-05,
-    (float)1.14409e-05,
-    (float)1.19847e-05,
-    (float)1.04727e-05,
-    (float)9.2041e-06,
-    (float)9.38571e-06,
-    (float)9.05697e-06,
-    (float)1.16793e-05,
-    (float)0.0975482,
-    (float)0.251162,
-    (float)0.522569,
-    (float)0.0379352,
-    (float)0.0153647,
-    (float)0.00993895,
-    (float)0.0182004,
-    (float)0.0279981,
-    (float)0.000372816,
-    (float)0.000255312,
-    (float)0.000697413,
-    (float)0.00717791,
-    (float)0.0023421,
-    (float)0.000633235,
-    (float)0.000640999,
-    (float)0.000594418,
-    (float)0.00254792,
-    (float)3.5558e-05,
-    (float)0.000392572,
-    (float)8.02431e-05,
-    (float)0.000155281,
-    (float)1.63106e-06,
-    (float)4.10088e-05,
-    (float)7.55775e-05,
-    (float)3.60558e-05,
-    (float)9.98941e-05,
-    (float)7.86041e-06,
-    (float)0.000408061,
-    (float)0.000171708,
-    (float)0.000122978,
-    (float)2.51348e-05,
-    (float)7.12334e-05,
-    (float)9.00673e-05,
-    (float)4.54626e-05,
-    (float)4.19556e-05,
-    (float)1.31535e-05,
-    (float)0.000132596,
-    (float)6.14481e-05,
-    (float)6.23816e-05,
-    (float)4.20192e-05,
-    (float)6.40989e-05,
-    (float)5.33615e-05,
-    (float)2.2133e-05,
-    (float)3.00866e-05,
-    (float)2.23837e-05,
-    (float)5.72949e-05,
-    (float)2.48359e-05,
-    (float)4.83231e-05,
-    (float)5.74654e-05,
-    (float)5.24873e-05,
-    (float)5.6717e-05,
-    (float)2.7023e-05,
-    (float)3.60494e-05,
-    (float)3.90284e-05,
-    (float)3.4947e-05,
-    (float)2.59436e-05,
-    (float)3.11227e-05,
-    (float)4.14006e-05,
-    (float)3.58912e-05,
-    (float)3.50004e-05,
-    (float)2.35949e-05,
-    (float)3.18699e-05,
-    (float)3.02137e-05,
-    (float)1.53631e-05,
-    (float)1.02622e-05,
-    (float)1.6235e-05,
-    (float)2.56723e-05,
-    (float)1.80683e-05,
-    (float)2.44113e-05,
-    (float)1.93714e-05,
-    (float)3.0885e-05,
-    (float)3.06546e-05,
-    (float)1.60939e-05,
-    (float)2.28899e-05,
-    (float)1.83582e-05,
-    (float)1.96289e-05,
-    (float)1.36971e-05,
-    (float)1.87092e-05,
-    (float)1.79008e-05,
-    (float)2.0751e-05,
-    (float)1.94165e-05,
-    (float)1.31733e-05,
-    (float)2.12113e-05,
-    (float)1.48255e-05,
-    (float)1.30956e-05,
-    (float)8.92396e-06,
-    (float)1.25373e-05,
-    (float)1.15299e-05,
-    (float)1.71091e-05,
-    (float)1.21295e-05,
-    (float)1.21757e-05,
-    (float)1.78062e-05,
-    (float)1.08066e-05,
-    (float)1.44186e-05,
-    (float)8.69169e-06,
-    (float)1.31163e-05,
-    (float)9.7254e-06,
-    (float)1.08509e-05,
-    (float)1.07756e-05,
-    (float)1.21119e-05,
-    (float)1.82483e-05,
-    (float)1.11958e-05,
-    (float)1.45788e-05,
-    (float)1.23452e-05,
-    (float)1.26662e-05,
-    (float)1.03258e-05,
-    (float)9.41173e-06,
-    (float)8.95352e-06,
-    (float)1.1934e-05,
-    (float)1.18333e-05,
-    (float)1.02391e-05,
-    (float)1.32508e-05,
-    (float)1.19901e-05,
-    (float)1.24356e-05,
-    (float)1.01498e-05,
-    (float)1.03234e-05,
-    (float)9.20622e-06,
-    (float)1.13219e-05,
-    (float)8.75068e-06,
-    (float)9.46771e-06,
-    (float)1.34622e-05,
-    (float)1.1788e-05,
-    (float)1.4077e-05,
-    (float)1.08693e-05,
-    (float)1.16747e-05,
-    (float)1.21194e-05,
-    (float)9.91703e-06,
-    (float)9.99638e-06,
-    (float)0.102435,
-    (float)0.237685,
-    (float)0.529333,
-    (float)0.0367431,
-    (float)0.014256,
-    (float)0.00858368,
-    (float)0.0145589,
-    (float)0.0366351,
-    (float)0.000767391,
-    (float)0.000103638,
-    (float)0.0011454,
-    (float)0.00619074,
-    (float)0.00206063,
-    (float)0.000449905,
-    (float)0.000721376,
-    (float)0.000345608,
-    (float)0.00359644,
-    (float)0.000173666,
-    (float)0.000430072,
-    (float)7.08396e-05,
-    (float)0.000301532,
-    (float)5.98212e-05,
-    (float)4.36614e-05,
-    (float)0.000107556,
-    (float)2.15961e-05,
-    (float)4.7997e-05,
-    (float)1.83098e-06,
-    (float)0.000272071,
-    (float)0.000160164,
-    (float)0.000121664,
-    (float)6.42465e-05,
-    (float)6.55598e-05,
-    (float)0.000236867,
-    (float)7.2497e-05,
-    (float)3.94229e-05,
-    (float)5.52528e-06,
-    (float)7.30809e-05,
-    (float)3.99073e-05,
-    (float)4.71588e-05,
-    (float)4.37618e-05,
-    (float)3.97434e-05,
-    (float)0.000103833,
-    (float)3.39081e-05,
-    (float)5.33281e-05,
-    (float)3.50132e-05,
-    (float)5.3261e-05,
-    (float)2.12871e-05,
-    (float)2.87628e-05,
-    (float)3.32979e-05,
-    (float)3.25648e-05,
-    (float)5.83247e-05,
-    (float)2.71248e-05,
-    (float)5.95906e-05,
-    (float)5.84912e-05,
-    (float)4.58717e-05,
-    (float)3.84496e-05,
-    (float)2.74681e-05,
-    (float)2.67023e-05,
-    (float)3.36375e-05,
-    (float)2.96508e-05,
-    (float)2.28734e-05,
-    (float)3.03834e-05,
-    (float)3.33767e-05,
-    (float)2.75988e-05,
-    (float)2.64926e-05,
-    (float)2.24655e-05,
-    (float)2.39716e-05,
-    (float)2.35893e-05,
-    (float)1.23735e-05,
-    (float)1.13963e-05,
-    (float)1.79601e-05,
-    (float)2.01242e-05,
-    (float)1.76379e-05,
-    (float)2.18213e-05,
-    (float)1.99666e-05,
-    (float)2.73892e-05,
-    (float)2.84913e-05,
-    (float)1.71836e-05,
-    (float)2.49699e-05,
-    (float)1.77575e-05,
-    (float)1.65854e-05,
-    (float)1.54742e-05,
-    (float)1.53177e-05,
-    (float)1.61569e-05,
-    (float)1.50987e-05,
-    (float)1.64096e-05,
-    (float)1.3031e-05,
-    (float)1.98583e-05,
-    (float)1.32792e-05,
-    (float)1.05168e-05,
-    (float)1.10938e-05,
-    (float)9.21297e-06,
-    (float)1.1106e-05,
-    (float)1.20912e-05,
-    (float)8.73937e-06,
-    (float)1.07152e-05,
-    (float)1.45163e-05,
-    (float)1.18964e-05,
-    (float)1.82356e-05,
-    (float)1.37308e-05,
-    (float)1.36968e-05,
-    (float)1.30142e-05,
-    (float)1.1253e-05,
-    (float)1.20852e-05,
-    (float)1.18764e-05,
-    (float)1.24916e-05,
-    (float)8.55415e-06,
-    (float)1.41925e-05,
-    (float)1.28626e-05,
-    (float)1.38363e-05,
-    (float)1.34996e-05,
-    (float)1.00635e-05,
-    (float)1.24307e-05,
-    (float)1.15685e-05,
-    (float)9.10845e-06,
-    (float)8.64938e-06,
-    (float)9.0856e-06,
-    (float)8.18149e-06,
-    (float)1.1199e-05,
-    (float)1.12743e-05,
-    (float)1.24129e-05,
-    (float)1.16093e-05,
-    (float)1.26664e-05,
-    (float)1.14585e-05,
-    (float)1.48683e-05,
-    (float)1.41345e-05,
-    (float)8.72289e-06,
-    (float)1.29414e-05,
-    (float)0.10543,
-    (float)0.236765,
-    (float)0.5262,
-    (float)0.034842,
-    (float)0.0128211,
-    (float)0.00704051,
-    (float)0.0107839,
-    (float)0.0456383,
-    (float)0.00127812,
-    (float)0.000161469,
-    (float)0.00156996,
-    (float)0.00512074,
-    (float)0.0020488,
-    (float)0.000250798,
-    (float)0.000658181,
-    (float)0.000141295,
-    (float)0.00428236,
-    (float)0.000355935,
-    (float)0.000378054,
-    (float)7.03179e-05,
-    (float)0.000404975,
-    (float)0.00037596,
-    (float)3.80271e-05,
-    (float)0.000221029,
-    (float)6.89021e-05,
-    (float)4.94469e-05,
-    (float)8.24244e-06,
-    (float)0.000103393,
-    (float)9.17227e-05,
-    (float)5.8703e-05,
-    (float)7.05165e-05,
-    (float)2.92905e-05,
-    (float)0.000339428,
-    (float)0.000112882,
-    (float)7.57656e-05,
-    (float)2.13599e-05,
-    (float)5.82082e-05,
-    (float)7.59249e-05,
-    (float)3.62682e-05,
-    (float)2.64974e-05,
-    (float)1.04943e-05,
-    (float)9.59029e-05,
-    (float)3.08316e-05,
-    (float)5.38852e-05,
-    (float)4.12658e-05,
-    (float)5.56633e-05,
-    (float)6.88717e-05,
-    (float)2.35699e-05,
-    (float)4.51597e-05,
-    (float)3.08109e-05,
-    (float)5.06018e-05,
-    (float)1.68569e-05,
-    (float)3.91588e-05,
-    (float)3.84621e-05,
-    (float)3.59278e-05,
-    (float)5.47419e-05,
-    (float)2.38287e-05,
-    (float)5.50823e-05,
-    (float)4.56063e-05,
-    (float)3.39282e-05,
-    (float)2.56382e-05,
-    (float)2.19114e-05,
-    (float)2.14051e-05,
-    (float)2.85892e-05,
-    (float)2.61549e-05,
-    (float)1.69076e-05,
-    (float)2.83237e-05,
-    (float)2.60077e-05,
-    (float)2.58835e-05,
-    (float)2.43785e-05,
-    (float)1.97323e-05,
-    (float)2.39154e-05,
-    (float)2.14117e-05,
-    (float)1.42725e-05,
-    (float)1.24772e-05,
-    (float)1.92868e-05,
-    (float)1.70773e-05,
-    (float)1.68594e-05,
-    (float)1.84432e-05,
-    (float)1.55317e-05,
-    (float)2.48847e-05,
-    (float)2.1833e-05,
-    (float)1.57091e-05,
-    (float)2.21267e-05,
-    (float)1.64813e-05,
-    (float)1.68075e-05,
-    (float)1.41707e-05,
-    (float)1.17716e-05,
-    (float)1.37001e-05,
-    (float)1.41321e-05,
-    (float)1.34942e-05,
-    (float)1.06154e-05,
-    (float)1.58567e-05,
-    (float)1.06426e-05,
-    (float)1.30985e-05,
-    (float)1.24834e-05,
-    (float)9.1629e-06,
-    (float)1.42885e-05,
-    (float)1.12114e-05,
-    (float)9.80393e-06,
-    (float)1.17651e-05,
-    (float)1.20117e-05,
-    (float)1.21578e-05,
-    (float)1.63255e-05,
-    (float)1.06382e-05,
-    (float)1.31382e-05,
-    (float)1.37278e-05,
-    (float)1.03754e-05,
-    (float)1.36593e-05,
-    (float)1.08596e-05,
-    (float)1.20559e-05,
-    (float)9.14608e-06,
-    (float)1.11156e-05,
-    (float)9.28501e-06,
-    (float)1.28598e-05,
-    (float)1.38476e-05,
-    (float)8.45987e-06,
-    (float)1.43298e-05,
-    (float)9.63649e-06,
-    (float)1.2907e-05,
-    (float)1.30321e-05,
-    (float)1.05453e-05,
-    (float)1.17793e-05,
-    (float)1.16951e-05,
-    (float)1.07603e-05,
-    (float)1.10555e-05,
-    (float)1.29901e-05,
-    (float)9.72163e-06,
-    (float)0.107408,
-    (float)0.245188,
-    (float)0.514793,
-    (float)0.0323827,
-    (float)0.0111704,
-    (float)0.0056029,
-    (float)0.00740597,
-    (float)0.0543292,
-    (float)0.00187703,
-    (float)0.000385162,
-    (float)0.00189503,
-    (float)0.00411193,
-    (float)0.00276325,
-    (float)0.000104916,
-    (float)0.000486137,
-    (float)5.07119e-05,
-    (float)0.00436307,
-    (float)0.000479369,
-    (float)0.000259762,
-    (float)0.000102495,
-    (float)0.000377482,
-    (float)0.000967046,
-    (float)1.37708e-05,
-    (float)0.000320097,
-    (float)0.000103743,
-    (float)0.000133741,
-    (float)1.65351e-05,
-    (float)4.22604e-05,
-    (float)8.22753e-05,
-    (float)2.39078e-05,
-    (float)4.12532e-05,
-    (float)9.45525e-06,
-    (float)0.000253206,
-    (float)0.000116567,
-    (float)8.10904e-05,
-    (float)4.76872e-05,
-    (float)5.85293e-05,
-    (float)0.000212992,
-    (float)5.82856e-05,
-    (float)3.21401e-05,
-    (float)1.14207e-05,
-    (float)5.24408e-05,
-    (float)3.12519e-05,
-    (float)3.02524e-05,
-    (float)2.57315e-05,
-    (float)2.19195e-05,
-    (float)8.61491e-05,
-    (float)2.11357e-05,
-    (float)5.64403e-05,
-    (float)4.38696e-05,
-    (float)5.54654e-05,
-    (float)4.59576e-05,
-    (float)2.07825e-05,
-    (float)4.35596e-05,
-    (float)3.19521e-05,
-    (float)4.29821e-05,
-    (float)1.58669e-05,
-    (float)4.10061e-05,
-    (float)3.98228e-05,
-    (float)3.60179e-05,
-    (float)4.4983e-05,
-    (float)2.30144e-05,
-    (float)5.0488e-05,
-    (float)3.95889e-05,
-    (float)2.64072e-05,
-    (float)1.98149e-05,
-    (float)1.80222e-05,
-    (float)1.7791e-05,
-    (float)2.33093e-05,
-    (float)1.72895e-05,
-    (float)1.35852e-05,
-    (float)2.20932e-05,
-    (float)1.82724e-05,
-    (float)2.2727e-05,
-    (float)2.12215e-05,
-    (float)2.04318e-05,
-    (float)2.23538e-05,
-    (float)1.75173e-05,
-    (float)1.41929e-05,
-    (float)1.54175e-05,
-    (float)1.8725e-05,
-    (float)1.24083e-05,
-    (float)1.42869e-05,
-    (float)1.24445e-05,
-    (float)1.63674e-05,
-    (float)2.34499e-05,
-    (float)1.87508e-05,
-    (float)1.80371e-05,
-    (float)2.18796e-05,
-    (float)1.9023e-05,
-    (float)1.87077e-05,
-    (float)1.48807e-05,
-    (float)1.09985e-05,
-    (float)1.39545e-05,
-    (float)1.04266e-05,
-    (float)1.02174e-05,
-    (float)9.5525e-06,
-    (float)1.00055e-05,
-    (float)9.4521e-06,
-    (float)1.05384e-05,
-    (float)1.29592e-05,
-    (float)1.01388e-05,
-    (float)1.37839e-05,
-    (float)7.67726e-06,
-    (float)1.00147e-05,
-    (float)1.32574e-05,
-    (float)8.9999e-06,
-    (float)1.26879e-05,
-    (float)8.93443e-06,
-    (float)9.90767e-06,
-    (float)1.44645e-05,
-    (float)1.44725e-05,
-    (float)1.48654e-05,
-    (float)1.63828e-05,
-    (float)1.36104e-05,
-    (float)1.4592e-05,
-    (float)1.47057e-05,
-    (float)1.14649e-05,
-    (float)1.29443e-05,
-    (float)1.03489e-05,
-    (float)9.03042e-06,
-    (float)8.41746e-06,
-    (float)1.05006e-05,
-    (float)9.9308e-06,
-    (float)1.17317e-05,
-    (float)1.16664e-05,
-    (float)9.88457e-06,
-    (float)1.44471e-05,
-    (float)0.108015,
-    (float)0.259863,
-    (float)0.498724,
-    (float)0.0296608,
-    (float)0.00945799,
-    (float)0.00422321,
-    (float)0.00458168,
-    (float)0.0620718,
-    (float)0.00242183,
-    (float)0.000704279,
-    (float)0.00202097,
-    (float)0.00318883,
-    (float)0.0045286,
-    (float)1.64969e-05,
-    (float)0.00025848,
-    (float)0.000100206,
-    (float)0.00384906,
-    (float)0.000468308,
-    (float)0.000135336,
-    (float)0.000149257,
-    (float)0.000245561,
-    (float)0.00164483,
-    (float)1.17131e-05,
-    (float)0.000313238,
-    (float)8.04294e-05,
-    (float)0.000246652,
-    (float)0.000117446,
-    (float)5.95758e-05,
-    (float)0.000171019,
-    (float)6.71178e-05,
-    (float)4.64662e-05,
-    (float)1.48061e-05,
-    (float)8.64115e-05,
-    (float)6.72444e-05,
-    (float)3.78734e-05,
-    (float)4.83964e-05,
-    (float)3.02221e-05,
-    (float)0.00025684,
-    (float)7.9121e-05,
-    (float)5.96614e-05,
-    (float)3.2204e-05,
-    (float)5.39855e-05,
-    (float)0.000115932,
-    (float)3.06883e-05,
-    (float)1.92061e-05,
-    (float)1.10803e-05,
-    (float)5.12594e-05,
-    (float)2.01552e-05,
-    (float)3.17349e-05,
-    (float)2.62101e-05,
-    (float)2.96498e-05,
-    (float)7.40314e-05,
-    (float)1.71572e-05,
-    (float)6.00025e-05,
-    (float)4.16278e-05,
-    (float)5.37454e-05,
-    (float)4.02702e-05,
-    (float)2.06268e-05,
-    (float)4.2744e-05,
-    (float)2.83183e-05,
-    (float)3.87919e-05,
-    (float)1.47078e-05,
-    (float)3.43186e-05,
-    (float)2.91229e-05,
-    (float)2.57478e-05,
-    (float)3.60548e-05,
-    (float)1.82148e-05,
-    (float)4.34636e-05,
-    (float)2.80947e-05,
-    (float)2.29347e-05,
-    (float)1.98744e-05,
-    (float)1.75869e-05,
-    (float)2.0735e-05,
-    (float)1.82052e-05,
-    (float)1.40707e-05,
-    (float)9.57562e-06,
-    (float)1.78786e-05,
-    (float)1.1803e-05,
-    (float)1.93026e-05,
-    (float)1.71502e-05,
-    (float)1.50085e-05,
-    (float)2.33952e-05,
-    (float)1.53633e-05,
-    (float)1.98325e-05,
-    (float)1.74833e-05,
-    (float)1.86469e-05,
-    (float)1.58669e-05,
-    (float)1.36113e-05,
-    (float)1.1632e-05,
-    (float)1.20853e-05,
-    (float)1.60004e-05,
-    (float)1.091e-05,
-    (float)1.40743e-05,
-    (float)1.30753e-05,
-    (float)1.34897e-05,
-    (float)1.6627e-05,
-    (float)1.30259e-05,
-    (float)1.51506e-05,
-    (float)1.47069e-05,
-    (float)1.28756e-05,
-    (float)1.20946e-05,
-    (float)1.07049e-05,
-    (float)9.89702e-06,
-    (float)1.02206e-05,
-    (float)9.89201e-06,
-    (float)9.28882e-06,
-    (float)9.11031e-06,
-    (float)9.41175e-06,
-    (float)9.72473e-06,
-    (float)1.28177e-05,
-    (float)1.3491e-05,
-    (float)1.11078e-05,
-    (float)1.3565e-05,
-    (float)1.06557e-05,
-    (float)1.37013e-05,
-    (float)1.44815e-05,
-    (float)1.04088e-05,
-    (float)1.25069e-05,
-    (float)8.97527e-06,
-    (float)9.9331e-06,
-    (float)1.16774e-05,
-    (float)1.07259e-05,
-    (float)1.14234e-05,
-    (float)1.14976e-05,
-    (float)1.06397e-05,
-    (float)1.20502e-05,
-    (float)1.34909e-05,
-    (float)1.25408e-05,
-    (float)0.108016,
-    (float)0.278543,
-    (float)0.47848,
-    (float)0.0268691,
-    (float)0.00777979,
-    (float)0.00305087,
-    (float)0.00262579,
-    (float)0.0684389,
-    (float)0.00293318,
-    (float)0.00099997,
-    (float)0.0020067,
-    (float)0.00241121,
-    (float)0.00752396,
-    (float)1.39203e-05,
-    (float)8.11136e-05,
-    (float)0.000258083,
-    (float)0.00305409,
-    (float)0.000491912,
-    (float)5.4397e-05,
-    (float)0.000162497,
-    (float)0.000107614,
-    (float)0.00208455,
-    (float)4.37441e-05,
-    (float)0.000190365,
-    (float)3.78069e-05,
-    (float)0.000268628,
-    (float)0.000406038,
-    (float)6.09187e-05,
-    (float)0.000275868,
-    (float)0.000110372,
-    (float)0.000119648,
-    (float)3.30741e-05,
-    (float)4.71261e-05,
-    (float)9.81279e-05,
-    (float)3.66132e-05,
-    (float)3.34332e-05,
-    (float)1.93421e-05,
-    (float)0.000129802,
-    (float)6.86164e-05,
-    (float)4.18486e-05,
-    (float)3.91567e-05,
-    (float)4.42688e-05,
-    (float)0.000201994,
-    (float)5.23978e-05,
-    (float)3.59864e-05,
-    (float)2.75037e-05,
-    (float)4.84045e-05,
-    (float)8.13307e-05,
-    (float)2.09685e-05,
-    (float)1.31026e-05,
-    (float)1.47547e-05,
-    (float)4.7908e-05,
-    (float)1.99359e-05,
-    (float)2.82673e-05,
-    (float)2.24352e-05,
-    (float)2.99368e-05,
-    (float)6.08854e-05,
-    (float)1.4911e-05,
-    (float)5.41495e-05,
-    (float)3.8866e-05,
-    (float)4.4483e-05,
-    (float)3.74828e-05,
-    (float)1.652e-05,
-    (float)4.65855e-05,
-    (float)3.01244e-05,
-    (float)3.15509e-05,
-    (float)1.49095e-05,
-    (float)2.4008e-05,
-    (float)2.91134e-05,
-    (float)2.35179e-05,
-    (float)2.6542e-05,
-    (float)1.33031e-05,
-    (float)3.46812e-05,
-    (float)2.41981e-05,
-    (float)2.02056e-05,
-    (float)1.76866e-05,
-    (float)1.41133e-05,
-    (float)2.50708e-05,
-    (float)1.63287e-05,
-    (float)1.20569e-05,
-    (float)8.85464e-06,
-    (float)1.35422e-05,
-    (float)1.26411e-05,
-    (float)1.42717e-05,
-    (float)1.10533e-05,
-    (float)9.92452e-06,
-    (float)1.79578e-05,
-    (float)1.17579e-05,
-    (float)1.74091e-05,
-    (float)1.55065e-05,
-    (float)1.58811e-05,
-    (float)1.85296e-05,
-    (float)1.20957e-05,
-    (float)1.56112e-05,
-    (float)1.57991e-05,
-    (float)1.61803e-05,
-    (float)1.1716e-05,
-    (float)1.11087e-05,
-    (float)1.12172e-05,
-    (float)1.42473e-05,
-    (float)1.42974e-05,
-    (float)9.00638e-06,
-    (float)1.23703e-05,
-    (float)1.14104e-05,
-    (float)1.37126e-05,
-    (float)1.23185e-05,
-    (float)8.96109e-06,
-    (float)1.20355e-05,
-    (float)1.11156e-05,
-    (float)1.11606e-05,
-    (float)9.52782e-06,
-    (float)8.59778e-06,
-    (float)9.76152e-06,
-    (float)1.0287e-05,
-    (float)1.05693e-05,
-    (float)9.95541e-06,
-    (float)9.35568e-06,
-    (float)1.01251e-05,
-    (float)1.11496e-05,
-    (float)1.33254e-05,
-    (float)1.30254e-05,
-    (float)1.00498e-05,
-    (float)1.17979e-05,
-    (float)1.09025e-05,
-    (float)1.49175e-05,
-    (float)1.45869e-05,
-    (float)9.77941e-06,
-    (float)1.21605e-05,
-    (float)0.107565,
-    (float)0.29923,
-    (float)0.456398,
-    (float)0.0239486,
-    (float)0.00623148,
-    (float)0.00207674,
-    (float)0.00158938,
-    (float)0.073141,
-    (float)0.00328319,
-    (float)0.00127526,
-    (float)0.00179979,
-    (float)0.00169124,
-    (float)0.0115042,
-    (float)8.86557e-05,
-    (float)2.1673e-06,
-    (float)0.000432615,
-    (float)0.00215088,
-    (float)0.000852045,
-    (float)1.76957e-05,
-    (float)0.000135718,
-    (float)3.77989e-05,
-    (float)0.0020717,
-    (float)6.68207e-05,
-    (float)6.44425e-05,
-    (float)2.24907e-05,
-    (float)0.000185169,
-    (float)0.000815651,
-    (float)2.9774e-05,
-    (float)0.000263235,
-    (float)8.74139e-05,
-    (float)0.000205576,
-    (float)0.000117643,
-    (float)0.000101815,
-    (float)0.000206601,
-    (float)9.50672e-05,
-    (float)7.33904e-05,
-    (float)3.05683e-05,
-    (float)4.12063e-05,
-    (float)6.50678e-05,
-    (float)3.17705e-05,
-    (float)3.12436e-05,
-    (float)2.23138e-05,
-    (float)0.000116887,
-    (float)4.82443e-05,
-    (float)3.94197e-05,
-    (float)3.63295e-05,
-    (float)4.37194e-05,
-    (float)0.000149797,
-    (float)3.34638e-05,
-    (float)3.54923e-05,
-    (float)2.95333e-05,
-    (float)4.28085e-05,
-    (float)6.71369e-05,
-    (float)1.63181e-05,
-    (float)1.57617e-05,
-    (float)1.77507e-05,
-    (float)3.60943e-05,
-    (float)2.09684e-05,
-    (float)2.19561e-05,
-    (float)1.85463e-05,
-    (float)2.4849e-05,
-    (float)4.8726e-05,
-    (float)1.64613e-05,
-    (float)4.96643e-05,
-    (float)3.33959e-05,
-    (float)3.95219e-05,
-    (float)3.99171e-05,
-    (float)1.76016e-05,
-    (float)5.10881e-05,
-    (float)2.72394e-05,
-    (float)2.84094e-05,
-    (float)1.72806e-05,
-    (float)1.52644e-05,
-    (float)2.77524e-05,
-    (float)1.58768e-05,
-    (float)1.88696e-05,
-    (float)9.66551e-06,
-    (float)2.12421e-05,
-    (float)1.77407e-05,
-    (float)1.59311e-05,
-    (float)1.79012e-05,
-    (float)1.21146e-05,
-    (float)2.49531e-05,
-    (float)1.3458e-05,
-    (float)1.54262e-05,
-    (float)1.31455e-05,
-    (float)1.27591e-05,
-    (float)1.64335e-05,
-    (float)9.04007e-06,
-    (float)1.08837e-05,
-    (float)8.40461e-06,
-    (float)1.15102e-05,
-    (float)9.67363e-06,
-    (float)1.06791e-05,
-    (float)1.1148e-05,
-    (float)1.10272e-05,
-    (float)1.64875e-05,
-    (float)1.11767e-05,
-    (float)1.74918e-05,
-    (float)1.58537e-05,
-    (float)1.64657e-05,
-    (float)1.75815e-05,
-    (float)1.14167e-05,
-    (float)1.64775e-05,
-    (float)1.36849e-05,
-    (float)1.36404e-05,
-    (float)1.02929e-05,
-    (float)8.19858e-06,
-    (float)9.79395e-06,
-    (float)9.46867e-06,
-    (float)9.87817e-06,
-    (float)7.21414e-06,
-    (float)9.05692e-06,
-    (float)8.89677e-06,
-    (float)1.09715e-05,
-    (float)1.18161e-05,
-    (float)1.03514e-05,
-    (float)1.34035e-05,
-    (float)1.10839e-05,
-    (float)1.33228e-05,
-    (float)1.32332e-05,
-    (float)1.19909e-05,
-    (float)1.3065e-05,
-    (float)1.01375e-05,
-    (float)1.11574e-05,
-    (float)1.06688e-05,
-    (float)9.71973e-06,
-    (float)1.05459e-05,
-    (float)0.10671,
-    (float)0.320299,
-    (float)0.433478,
-    (float)0.0212,
-    (float)0.00482994,
-    (float)0.00136111,
-    (float)0.00155099,
-    (float)0.0759962,
-    (float)0.00350305,
-    (float)0.00138664,
-    (float)0.00152397,
-    (float)0.00106457,
-    (float)0.0161425,
-    (float)0.000225669,
-    (float)4.00658e-05,
-    (float)0.000586837,
-    (float)0.0014183,
-    (float)0.00197408,
-    (float)1.54712e-05,
-    (float)6.81069e-05,
-    (float)8.17742e-05,
-    (float)0.00166014,
-    (float)0.000113117,
-    (float)1.87167e-06,
-    (float)3.18599e-05,
-    (float)7.73264e-05,
-    (float)0.0010754,
-    (float)4.56145e-06,
-    (float)0.000116349,
-    (float)2.45607e-05,
-    (float)0.000186969,
-    (float)0.000324863,
-    (float)0.000101431,
-    (float)0.000247156,
-    (float)0.000105978,
-    (float)0.000152654,
-    (float)6.31776e-05,
-    (float)0.000106961,
-    (float)0.000160782,
-    (float)8.04263e-05,
-    (float)5.83905e-05,
-    (float)3.16307e-05,
-    (float)3.68305e-05,
-    (float)5.87031e-05,
-    (float)3.21834e-05,
-    (float)2.77267e-05,
-    (float)2.44725e-05,
-    (float)7.61139e-05,
-    (float)3.6883e-05,
-    (float)3.15304e-05,
-    (float)3.1779e-05,
-    (float)3.83972e-05,
-    (float)0.000109567,
-    (float)2.71764e-05,
-    (float)3.35682e-05,
-    (float)3.43641e-05,
-    (float)4.20868e-05,
-    (float)7.04976e-05,
-    (float)1.66446e-05,
-    (float)2.20761e-05,
-    (float)2.76841e-05,
-    (float)3.19826e-05,
-    (float)3.07524e-05,
-    (float)1.3077e-05,
-    (float)1.40596e-05,
-    (float)2.27219e-05,
-    (float)3.25698e-05,
-    (float)1.75278e-05,
-    (float)2.53507e-05,
-    (float)1.93887e-05,
-    (float)2.86566e-05,
-    (float)3.45582e-05,
-    (float)1.64659e-05,
-    (float)3.99587e-05,
-    (float)2.27365e-05,
-    (float)2.77249e-05,
-    (float)2.47989e-05,
-    (float)1.44012e-05,
-    (float)3.46673e-05,
-    (float)1.58704e-05,
-    (float)1.7211e-05,
-    (float)1.36673e-05,
-    (float)1.12983e-05,
-    (float)2.07953e-05,
-    (float)1.01573e-05,
-    (float)1.10647e-05,
-    (float)9.91217e-06,
-    (float)1.28419e-05,
-    (float)1.38224e-05,
-    (float)1.05413e-05,
-    (float)1.06909e-05,
-    (float)1.18592e-05,
-    (float)1.61718e-05,
-    (float)1.17614e-05,
-    (float)1.26519e-05,
-    (float)1.1212e-05,
-    (float)1.39145e-05,
-    (float)1.55856e-05,
-    (float)1.0003e-05,
-    (float)1.21437e-05,
-    (float)1.00541e-05,
-    (float)1.29535e-05,
-    (float)1.21266e-05,
-    (float)8.86923e-06,
-    (float)1.02539e-05,
-    (float)9.39902e-06,
-    (float)1.26042e-05,
-    (float)1.06059e-05,
-    (float)1.10176e-05,
-    (float)1.11327e-05,
-    (float)1.19254e-05,
-    (float)1.40147e-05,
-    (float)1.17373e-05,
-    (float)1.4329e-05,
-    (float)1.29173e-05,
-    (float)1.38893e-05,
-    (float)1.32052e-05,
-    (float)1.19975e-05,
-    (float)1.37762e-05,
-    (float)1.15777e-05,
-    (float)1.18468e-05,
-    (float)9.96133e-06,
-    (float)1.00275e-05,
-    (float)1.01038e-05,
-    (float)8.82532e-06,
-    (float)8.79466e-06,
-    (float)8.153e-06,
-    (float)8.66083e-06,
-    (float)0.105583,
-    (float)0.341486,
-    (float)0.409868,
-    (float)0.0185993,
-    (float)0.00363822,
-    (float)0.000832845,
-    (float)0.00248184,
-    (float)0.0770507,
-    (float)0.0035576,
-    (float)0.00139717,
-    (float)0.00114581,
-    (float)0.000530876,
-    (float)0.0208955,
-    (float)0.000395371,
-    (float)0.000162579,
-    (float)0.000630221,
-    (float)0.000878744,
-    (float)0.0040924,
-    (float)2.73064e-05,
-    (float)1.63014e-05,
-    (float)0.000179888,
-    (float)0.00109498,
-    (float)0.00042223,
-    (float)2.97953e-05,
-    (float)4.11796e-05,
-    (float)3.71757e-05,
-    (float)0.0010092,
-    (float)5.00838e-06,
-    (float)1.26987e-05,
-    (float)1.90798e-07,
-    (float)9.26456e-05,
-    (float)0.000535991,
-    (float)5.90835e-05,
-    (float)0.000141356,
-    (float)4.72928e-05,
-    (float)0.000159143,
-    (float)0.000158964,
-    (float)0.000165657,
-    (float)0.000223269,
-    (float)0.000101279,
-    (float)0.00012543,
-    (float)4.59511e-05,
-    (float)0.000137228,
-    (float)0.000149943,
-    (float)7.56216e-05,
-    (float)5.48793e-05,
-    (float)3.09933e-05,
-    (float)4.77031e-05,
-    (float)6.37081e-05,
-    (float)3.63201e-05,
-    (float)2.35977e-05,
-    (float)2.40101e-05,
-    (float)3.98253e-05,
-    (float)3.23168e-05,
-    (float)2.82782e-05,
-    (float)2.18062e-05,
-    (float)2.9853e-05,
-    (float)6.67469e-05,
-    (float)2.27631e-05,
-    (float)3.32718e-05,
-    (float)2.6417e-05,
-    (float)3.73559e-05,
-    (float)5.96133e-05,
-    (float)1.89149e-05,
-    (float)3.19372e-05,
-    (float)2.78717e-05,
-    (float)3.19092e-05,
-    (float)3.55798e-05,
-    (float)1.47527e-05,
-    (float)2.30498e-05,
-    (float)2.36464e-05,
-    (float)2.42996e-05,
-    (float)2.07096e-05,
-    (float)1.27493e-05,
-    (float)1.7711e-05,
-    (float)2.20275e-05,
-    (float)2.36307e-05,
-    (float)1.64005e-05,
-    (float)2.04724e-05,
-    (float)1.79727e-05,
-    (float)2.28447e-05,
-    (float)2.17018e-05,
-    (float)1.58318e-05,
-    (float)2.74167e-05,
-    (float)1.54169e-05,
-    (float)1.84193e-05,
-    (float)1.51231e-05,
-    (float)1.38595e-05,
-    (float)2.39913e-05,
-    (float)1.00652e-05,
-    (float)1.15057e-05,
-    (float)1.02362e-05,
-    (float)1.08267e-05,
-    (float)1.71009e-05,
-    (float)7.23314e-06,
-    (float)8.06071e-06,
-    (float)9.88103e-06,
-    (float)1.02165e-05,
-    (float)1.36974e-05,
-    (float)8.43931e-06,
-    (float)8.50309e-06,
-    (float)1.28928e-05,
-    (float)1.27863e-05,
-    (float)1.31394e-05,
-    (float)1.1965e-05,
-    (float)1.01664e-05,
-    (float)1.59392e-05,
-    (float)1.47218e-05,
-    (float)1.20758e-05,
-    (float)1.37768e-05,
-    (float)1.01797e-05,
-    (float)1.57002e-05,
-    (float)1.35299e-05,
-    (float)9.61292e-06,
-    (float)1.27474e-05,
-    (float)9.2469e-06,
-    (float)1.35995e-05,
-    (float)1.13368e-05,
-    (float)8.12398e-06,
-    (float)1.16163e-05,
-    (float)9.50976e-06,
-    (float)1.19188e-05,
-    (float)1.00012e-05,
-    (float)8.70878e-06,
-    (float)1.11794e-05,
-    (float)1.05062e-05,
-    (float)1.03172e-05,
-    (float)9.55485e-06,
-    (float)0.104618,
-    (float)0.361545,
-    (float)0.386878,
-    (float)0.0160994,
-    (float)0.00259577,
-    (float)0.000527808,
-    (float)0.00421154,
-    (float)0.0763119,
-    (float)0.003439,
-    (float)0.00126316,
-    (float)0.00078737,
-    (float)0.000179812,
-    (float)0.0250365,
-    (float)0.000573386,
-    (float)0.000302456,
-    (float)0.000596547,
-    (float)0.000515018,
-    (float)0.00706692,
-    (float)5.02665e-05,
-    (float)2.70003e-05,
-    (float)0.000276703,
-    (float)0.000600631,
-    (float)0.00136629,
-    (float)8.55603e-05,
-    (float)4.07393e-05,
-    (float)8.48143e-05,
-    (float)0.000658115,
-    (float)0.000134345,
-    (float)4.7173e-05,
-    (float)2.41463e-05,
-    (float)3.49139e-05,
-    (float)0.000534035,
-    (float)2.04816e-05,
-    (float)2.72961e-05,
-    (float)5.59277e-06,
-    (float)8.01151e-05,
-    (float)0.0002801,
-    (float)0.000108243,
-    (float)0.000113925,
-    (float)4.75482e-05,
-    (float)0.000129312,
-    (float)9.93202e-05,
-    (float)0.000199192,
-    (float)0.000177523,
-    (float)8.92024e-05,
-    (float)0.000116288,
-    (float)4.25089e-05,
-    (float)0.000182889,
-    (float)0.000141163,
-    (float)7.98428e-05,
-    (float)6.41989e-05,
-    (float)3.40815e-05,
-    (float)8.96861e-05,
-    (float)7.22055e-05,
-    (float)4.6277e-05,
-    (float)2.56982e-05,
-    (float)2.50362e-05,
-    (float)2.66412e-05,
-    (float)3.37447e-05,
-    (float)2.59437e-05,
-    (float)1.42855e-05,
-    (float)2.0094e-05,
-    (float)2.19667e-05,
-    (float)2.32613e-05,
-    (float)2.5376e-05,
-    (float)1.75366e-05,
-    (float)2.58041e-05,
-    (float)3.32766e-05,
-    (float)2.36647e-05,
-    (float)3.24516e-05,
-    (float)2.38119e-05,
-    (float)3.00468e-05,
-    (float)3.2576e-05,
-    (float)2.49401e-05,
-    (float)3.32853e-05,
-    (float)2.4575e-05,
-    (float)2.34449e-05,
-    (float)2.35469e-05,
-    (float)1.97375e-05,
-    (float)2.48827e-05,
-    (float)1.88556e-05,
-    (float)1.319e-05,
-    (float)1.59756e-05,
-    (float)1.10546e-05,
-    (float)1.59327e-05,
-    (float)1.41964e-05,
-    (float)8.77201e-06,
-    (float)1.38614e-05,
-    (float)8.03307e-06,
-    (float)1.28908e-05,
-    (float)1.47507e-05,
-    (float)9.51278e-06,
-    (float)1.66105e-05,
-    (float)1.12213e-05,
-    (float)1.37145e-05,
-    (float)1.70252e-05,
-    (float)1.115e-05,
-    (float)2.03135e-05,
-    (float)1.40543e-05,
-    (float)1.43963e-05,
-    (float)1.71238e-05,
-    (float)1.19967e-05,
-    (float)1.99842e-05,
-    (float)1.32293e-05,
-    (float)1.29633e-05,
-    (float)1.44731e-05,
-    (float)1.11663e-05,
-    (float)1.4738e-05,
-    (float)1.06026e-05,
-    (float)9.73704e-06,
-    (float)1.09298e-05,
-    (float)9.57446e-06,
-    (float)9.30893e-06,
-    (float)9.43988e-06,
-    (float)7.59931e-06,
-    (float)9.3449e-06,
-    (float)1.03794e-05,
-    (float)7.86736e-06,
-    (float)1.13251e-05,
-    (float)8.76425e-06,
-    (float)1.05936e-05,
-    (float)1.38564e-05,
-    (float)9.29314e-06,
-    (float)1.47207e-05,
-    (float)1.14243e-05,
-    (float)1.22084e-05,
-    (float)1.61514e-05,
-    (float)1.02466e-05,
-    (float)0.103301,
-    (float)0.380445,
-    (float)0.363993,
-    (float)0.0138686,
-    (float)0.0017829,
-    (float)0.000408189,
-    (float)0.00678978,
-    (float)0.0740558,
-    (float)0.00319853,
-    (float)0.00105052,
-    (float)0.000456008,
-    (float)0.000101185,
-    (float)0.0282297,
-    (float)0.00071137,
-    (float)0.00039673,
-    (float)0.000460593,
-    (float)0.000253732,
-    (float)0.0105926,
-    (float)8.22395e-05,
-    (float)8.87033e-05,
-    (float)0.000296024,
-    (float)0.000318169,
-    (float)0.00328045,
-    (float)0.000105933,
-    (float)4.423e-05,
-    (float)0.000149925,
-    (float)0.000323242,
-    (float)0.000736269,
-    (float)0.000166798,
-    (float)5.63865e-05,
-    (float)6.32097e-05,
-    (float)0.000324576,
-    (float)0.000100856,
-    (float)0.000114772,
-    (float)3.68591e-05,
-    (float)3.3584e-05,
-    (float)0.000258133,
-    (float)4.5526e-05,
-    (float)6.09315e-05,
-    (float)2.03482e-05,
-    (float)5.28603e-05,
-    (float)0.000146462,
-    (float)0.000128969,
-    (float)8.00993e-05,
-    (float)3.72534e-05,
-    (float)8.70535e-05,
-    (float)6.1115e-05,
-    (float)0.00021739,
-    (float)0.000123275,
-    (float)6.35979e-05,
-    (float)9.53886e-05,
-    (float)2.85919e-05,
-    (float)0.000239338,
-    (float)0.000125159,
-    (float)6.89654e-05,
-    (float)7.08157e-05,
-    (float)2.65651e-05,
-    (float)0.000184307,
-    (float)8.6667e-05,
-    (float)5.40366e-05,
-    (float)3.75272e-05,
-    (float)2.82001e-05,
-    (float)0.000101929,
-    (float)4.54476e-05,
-    (float)3.55542e-05,
-    (float)1.59081e-05,
-    (float)2.4775e-05,
-    (float)4.25257e-05,
-    (float)2.21908e-05,
-    (float)2.34263e-05,
-    (float)7.3571e-06,
-    (float)2.0525e-05,
-    (float)1.77698e-05,
-    (float)1.47626e-05,
-    (float)1.92462e-05,
-    (float)6.02339e-06,
-    (float)2.04639e-05,
-    (float)1.3267e-05,
-    (float)1.67253e-05,
-    (float)2.13796e-05,
-    (float)8.33299e-06,
-    (float)2.33263e-05,
-    (float)1.41662e-05,
-    (float)2.3054e-05,
-    (float)2.5157e-05,
-    (float)1.12782e-05,
-    (float)2.36361e-05,
-    (float)1.41252e-05,
-    (float)2.76195e-05,
-    (float)2.50493e-05,
-    (float)1.17234e-05,
-    (float)1.88583e-05,
-    (float)1.25135e-05,
-    (float)2.62075e-05,
-    (float)1.98977e-05,
-    (float)9.41868e-06,
-    (float)1.19037e-05,
-    (float)1.07512e-05,
-    (float)2.01844e-05,
-    (float)1.3269e-05,
-    (float)6.77061e-06,
-    (float)6.73682e-06,
-    (float)1.03261e-05,
-    (float)1.385e-05,
-    (float)8.77694e-06,
-    (float)5.73183e-06,
-    (float)4.59956e-06,
-    (float)1.21322e-05,
-    (float)9.94505e-06,
-    (float)7.54447e-06,
-    (float)6.90948e-06,
-    (float)4.91017e-06,
-    (float)1.64447e-05,
-    (float)8.78788e-06,
-    (float)9.33373e-06,
-    (float)1.02981e-05,
-    (float)6.94481e-06,
-    (float)2.24734e-05,
-    (float)9.56037e-06,
-    (float)1.32057e-05,
-    (float)1.47457e-05,
-    (float)9.57235e-06,
-    (float)2.79676e-05,
-    (float)1.08921e-05,
-    (float)1.68812e-05,
-    (float)1.76275e-05,
-    (float)1.11623e-05,
-    (float)3.02106e-05,
-    (float)0.102115,
-    (float)0.397626,
-    (float)0.342895,
-    (float)0.0118883,
-    (float)0.00112613,
-    (float)0.000459546,
-    (float)0.0097919,
-    (float)0.07044,
-    (float)0.00286626,
-    (float)0.000765776,
-    (float)0.000221957,
-    (float)0.000360806,
-    (float)0.0297377,
-    (float)0.000795635,
-    (float)0.000391088,
-    (float)0.000310315,
-    (float)9.63259e-05,
-    (float)0.0135919,
-    (float)0.000140553,
-    (float)0.000152457,
-    (float)0.000268814,
-    (float)0.000190204,
-    (float)0.00575433,
-    (float)9.04896e-05,
-    (float)7.45704e-05,
-    (float)0.000189526,
-    (float)0.000163216,
-    (float)0.00208491,
-    (float)0.00022222,
-    (float)8.15433e-05,
-    (float)0.000121259,
-    (float)0.000130105,
-    (float)0.000602673,
-    (float)0.000294521,
-    (float)8.98633e-05,
-    (float)7.00431e-05,
-    (float)0.000116462,
-    (float)0.000135109,
-    (float)0.000254662,
-    (float)7.15662e-05,
-    (float)3.80788e-05,
-    (float)9.5976e-05,
-    (float)5.59682e-05,
-    (float)0.000166219,
-    (float)4.58687e-05,
-    (float)2.96173e-05,
-    (float)6.11229e-05,
-    (float)9.7332e-05,
-    (float)9.96341e-05,
-    (float)3.51506e-05,
-    (float)3.85034e-05,
-    (float)2.7722e-05,
-    (float)0.000162077,
-    (float)7.31937e-05,
-    (float)3.99367e-05,
-    (float)4.8545e-05,
-    (float)1.09197e-05,
-    (float)0.000208159,
-    (float)6.55015e-05,
-    (float)4.7295e-05,
-    (float)4.79908e-05,
-    (float)1.21518e-05,
-    (float)0.000214694,
-    (float)5.45997e-05,
-    (float)4.85252e-05,
-    (float)3.79648e-05,
-    (float)2.24098e-05,
-    (float)0.000182635,
-    (float)3.70472e-05,
-    (float)4.3993e-05,
-    (float)2.63078e-05,
-    (float)3.10794e-05,
-    (float)0.000130335,
-    (float)2.04424e-05,
-    (float)3.70336e-05,
-    (float)1.78682e-05,
-    (float)3.2597e-05,
-    (float)7.92455e-05,
-    (float)1.02417e-05,
-    (float)2.94266e-05,
-    (float)1.24801e-05,
-    (float)2.81375e-05,
-    (float)4.21413e-05,
-    (float)6.11952e-06,
-    (float)2.21861e-05,
-    (float)8.77525e-06,
-    (float)2.23254e-05,
-    (float)2.08712e-05,
-    (float)5.74049e-06,
-    (float)1.67281e-05,
-    (float)6.4758e-06,
-    (float)1.83662e-05,
-    (float)1.09362e-05,
-    (float)7.8464e-06,
-    (float)1.37751e-05,
-    (float)5.56257e-06,
-    (float)1.62413e-05,
-    (float)7.154e-06,
-    (float)1.20231e-05,
-    (float)1.24776e-05,
-    (float)5.49775e-06,
-    (float)1.47228e-05,
-    (float)6.59249e-06,
-    (float)1.74465e-05,
-    (float)1.14657e-05,
-    (float)5.73491e-06,
-    (float)1.36242e-05,
-    (float)8.17272e-06,
-    (float)2.25571e-05,
-    (float)1.01409e-05,
-    (float)6.0574e-06,
-    (float)1.36429e-05,
-    (float)1.09766e-05,
-    (float)2.5686e-05,
-    (float)8.64845e-06,
-    (float)6.26863e-06,
-    (float)1.50803e-05,
-    (float)1.36762e-05,
-    (float)2.59822e-05,
-    (float)7.29223e-06,
-    (float)6.19761e-06,
-    (float)1.75957e-05,
-    (float)1.53228e-05,
-    (float)2.39037e-05,
-    (float)6.36804e-06,
-    (float)6.06923e-06,
-    (float)2.0735e-05,
-    (float)1.58236e-05,
-    (float)0.100804,
-    (float)0.41412,
-    (float)0.321525,
-    (float)0.0101134,
-    (float)0.000599734,
-    (float)0.000628231,
-    (float)0.0133874,
-    (float)0.065579,
-    (float)0.00247405,
-    (float)0.000466485,
-    (float)7.67145e-05,
-    (float)0.00104098,
-    (float)0.0297338,
-    (float)0.000808994,
-    (float)0.00030796,
-    (float)0.00015453,
-    (float)5.3975e-05,
-    (float)0.0157256,
-    (float)0.000201875,
-    (float)0.000177924,
-    (float)0.000181548,
-    (float)0.000104681,
-    (float)0.00833796,
-    (float)6.61067e-05,
-    (float)0.0001083,
-    (float)0.00016009,
-    (float)0.000130111,
-    (float)0.00414663,
-    (float)0.000172388,
-    (float)9.61777e-05,
-    (float)0.000128972,
-    (float)8.89209e-05,
-    (float)0.00184551,
-    (float)0.000354578,
-    (float)0.000112955,
-    (float)0.00010454,
-    (float)4.23515e-05,
-    (float)0.000698132,
-    (float)0.000493649,
-    (float)0.000126,
-    (float)8.47114e-05,
-    (float)1.66524e-05,
-    (float)0.000209754,
-    (float)0.000532587,
-    (float)0.000117595,
-    (float)6.43318e-05,
-    (float)7.80716e-06,
-    (float)5.31134e-05,
-    (float)0.000474783,
-    (float)9.00872e-05,
-    (float)4.38836e-05,
-    (float)5.02449e-06,
-    (float)3.53009e-05,
-    (float)0.000361391,
-    (float)5.7382e-05,
-    (float)2.80005e-05,
-    (float)2.70189e-06,
-    (float)6.03118e-05,
-    (float)0.000240491,
-    (float)3.21101e-05,
-    (float)1.9812e-05,
-    (float)6.16904e-07,
-    (float)8.95896e-05,
-    (float)0.000144025,
-    (float)1.83932e-05,
-    (float)1.80997e-05,
-    (float)2.28195e-07,
-    (float)0.000111164,
-    (float)8.10212e-05,
-    (float)1.32635e-05,
-    (float)1.90642e-05,
-    (float)2.38245e-06,
-    (float)0.000122146,
-    (float)4.46897e-05,
-    (float)1.24017e-05,
-    (float)1.96984e-05,
-    (float)7.04014e-06,
-    (float)0.000122188,
-    (float)2.41847e-05,
-    (float)1.40002e-05,
-    (float)1.93328e-05,
-    (float)1.35808e-05,
-    (float)0.000112435,
-    (float)1.23904e-05,
-    (float)1.82833e-05,
-    (float)1.87129e-05,
-    (float)2.08431e-05,
-    (float)9.55777e-05,
-    (float)6.91285e-06,
-    (float)2.48573e-05,
-    (float)1.83587e-05,
-    (float)2.7153e-05,
-    (float)7.52341e-05,
-    (float)7.01936e-06,
-    (float)3.13617e-05,
-    (float)1.79441e-05,
-    (float)3.0782e-05,
-    (float)5.48972e-05,
-    (float)1.08909e-05,
-    (float)3.4671e-05,
-    (float)1.68628e-05,
-    (float)3.07164e-05,
-    (float)3.71341e-05,
-    (float)1.54173e-05,
-    (float)3.31313e-05,
-    (float)1.49893e-05,
-    (float)2.7191e-05,
-    (float)2.33218e-05,
-    (float)1.78172e-05,
-    (float)2.76265e-05,
-    (float)1.28036e-05,
-    (float)2.15948e-05,
-    (float)1.37621e-05,
-    (float)1.71186e-05,
-    (float)2.07209e-05,
-    (float)1.09489e-05,
-    (float)1.58539e-05,
-    (float)7.96678e-06,
-    (float)1.43119e-05,
-    (float)1.48828e-05,
-    (float)9.85248e-06,
-    (float)1.17075e-05,
-    (float)5.04722e-06,
-    (float)1.13909e-05,
-    (float)1.1281e-05,
-    (float)9.80699e-06,
-    (float)1.01956e-05,
-    (float)4.18419e-06,
-    (float)0.0996888,
-    (float)0.427581,
-    (float)0.301915,
-    (float)0.00851311,
-    (float)0.000319728,
-    (float)0.000948697,
-    (float)0.0170398,
-    (float)0.06017,
-    (float)0.00203966,
-    (float)0.000264243,
-    (float)5.8298e-05,
-    (float)0.00210062,
-    (float)0.0282203,
-    (float)0.000734449,
-    (float)0.000193369,
-    (float)4.58561e-05,
-    (float)0.000228268,
-    (float)0.0162656,
-    (float)0.000235657,
-    (float)0.000126364,
-    (float)8.42531e-05,
-    (float)5.47517e-05,
-    (float)0.00991148,
-    (float)6.63549e-05,
-    (float)8.11147e-05,
-    (float)0.000103076,
-    (float)9.71255e-05,
-    (float)0.00600976,
-    (float)9.30254e-05,
-    (float)6.65653e-05,
-    (float)0.000106822,
-    (float)0.000112699,
-    (float)0.00350378,
-    (float)0.000239459,
-    (float)7.97668e-05,
-    (float)0.000105757,
-    (float)9.04647e-05,
-    (float)0.00191065,
-    (float)0.000440113,
-    (float)0.000107865,
-    (float)0.000103822,
-    (float)5.55972e-05,
-    (float)0.000943686,
-    (float)0.000636225,
-    (float)0.000134081,
-    (float)9.93817e-05,
-    (float)2.61864e-05,
-    (float)0.000401076,
-    (float)0.000781961,
-    (float)0.00014486,
-    (float)8.9543e-05,
-    (float)8.43465e-06,
-    (float)0.000131761,
-    (float)0.000850779,
-    (float)0.000134846,
-    (float)7.36151e-05,
-    (float)1.32015e-06,
-    (float)2.43524e-05,
-    (float)0.000837727,
-    (float)0.000107637,
-    (float)5.39344e-05,
-    (float)1.49266e-06,
-    (float)1.48969e-06,
-    (float)0.000756374,
-    (float)7.25959e-05,
-    (float)3.44691e-05,
-    (float)5.95938e-06,
-    (float)1.41623e-05,
-    (float)0.000631512,
-    (float)3.99326e-05,
-    (float)1.8778e-05,
-    (float)1.28034e-05,
-    (float)3.50939e-05,
-    (float)0.000490406,
-    (float)1.66824e-05,
-    (float)8.7022e-06,
-    (float)2.091e-05,
-    (float)5.18696e-05,
-    (float)0.00035562,
-    (float)5.14532e-06,
-    (float)4.23334e-06,
-    (float)2.94993e-05,
-    (float)6.08347e-05,
-    (float)0.000241305,
-    (float)3.70012e-06,
-    (float)4.17395e-06,
-    (float)3.78455e-05,
-    (float)6.25057e-05,
-    (float)0.000153115,
-    (float)8.78909e-06,
-    (float)6.95516e-06,
-    (float)4.52271e-05,
-    (float)5.87082e-05,
-    (float)9.0465e-05,
-    (float)1.67624e-05,
-    (float)1.11979e-05,
-    (float)5.09874e-05,
-    (float)5.12022e-05,
-    (float)4.94881e-05,
-    (float)2.48935e-05,
-    (float)1.59385e-05,
-    (float)5.458e-05,
-    (float)4.13314e-05,
-    (float)2.54106e-05,
-    (float)3.15891e-05,
-    (float)2.06266e-05,
-    (float)5.55696e-05,
-    (float)3.02116e-05,
-    (float)1.38865e-05,
-    (float)3.61673e-05,
-    (float)2.50156e-05,
-    (float)5.36526e-05,
-    (float)1.90586e-05,
-    (float)1.14069e-05,
-    (float)3.85438e-05,
-    (float)2.90218e-05,
-    (float)4.87689e-05,
-    (float)9.35077e-06,
-    (float)1.51696e-05,
-    (float)3.89721e-05,
-    (float)3.25935e-05,
-    (float)4.12844e-05,
-    (float)2.67206e-06,
-    (float)2.27929e-05,
-    (float)3.78562e-05,
-    (float)3.56148e-05,
-    (float)3.21299e-05,
-    (float)2.84095e-07,
-};
-HarmData sweep2_coeff = { harm_data, 120, 128 };
@@ -1,15366 +0,0 @@
-#include <StdAfx.h>
-/*file generated by write_harm_data.m*/
-#include "HarmData.h"
-static float harm_data[120*128]={
-    (float)0.607939,
-    (float)0.152008,
-    (float)0.0675759,
-    (float)0.0380248,
-    (float)0.0243469,
-    (float)0.0169169,
-    (float)0.0124369,
-    (float)0.00952915,
-    (float)0.00753564,
-    (float)0.00610969,
-    (float)0.00505467,
-    (float)0.00425224,
-    (float)0.00362776,
-    (float)0.00313227,
-    (float)0.00273254,
-    (float)0.0024054,
-    (float)0.00213427,
-    (float)0.00190708,
-    (float)0.00171481,
-    (float)0.00155066,
-    (float)0.0014094,
-    (float)0.00128698,
-    (float)0.00118017,
-    (float)0.00108645,
-    (float)0.00100375,
-    (float)0.000930421,
-    (float)0.000865092,
-    (float)0.000806645,
-    (float)0.000754146,
-    (float)0.000706816,
-    (float)0.000664,
-    (float)0.000625142,
-    (float)0.000589771,
-    (float)0.000557482,
-    (float)0.000527928,
-    (float)0.000500811,
-    (float)0.00047587,
-    (float)0.00045288,
-    (float)0.000431644,
-    (float)0.000411988,
-    (float)0.000393761,
-    (float)0.000376828,
-    (float)0.000361071,
-    (float)0.000346384,
-    (float)0.000332674,
-    (float)0.000319856,
-    (float)0.000307856,
-    (float)0.000296606,
-    (float)0.000286047,
-    (float)0.000276123,
-    (float)0.000266786,
-    (float)0.000257991,
-    (float)0.000249697,
-    (float)0.000241869,
-    (float)0.000234473,
-    (float)0.000227479,
-    (float)0.000220858,
-    (float)0.000214586,
-    (float)0.00020864,
-    (float)0.000202997,
-    (float)0.000197639,
-    (float)0.000192548,
-    (float)0.000187706,
-    (float)0.0001831,
-    (float)0.000178714,
-    (float)0.000174536,
-    (float)0.000170553,
-    (float)0.000166755,
-    (float)0.000163131,
-    (float)0.000159671,
-    (float)0.000156367,
-    (float)0.00015321,
-    (float)0.000150193,
-    (float)0.000147307,
-    (float)0.000144547,
-    (float)0.000141907,
-    (float)0.000139379,
-    (float)0.00013696,
-    (float)0.000134643,
-    (float)0.000132424,
-    (float)0.000130298,
-    (float)0.000128261,
-    (float)0.00012631,
-    (float)0.00012444,
-    (float)0.000122647,
-    (float)0.00012093,
-    (float)0.000119283,
-    (float)0.000117706,
-    (float)0.000116194,
-    (float)0.000114746,
-    (float)0.000113358,
-    (float)0.000112029,
-    (float)0.000110757,
-    (float)0.000109538,
-    (float)0.000108373,
-    (float)0.000107257,
-    (float)0.000106191,
-    (float)0.000105172,
-    (float)0.000104199,
-    (float)0.000103271,
-    (float)0.000102385,
-    (float)0.000101541,
-    (float)0.000100738,
-    (float)9.99743e-05,
-    (float)9.9249e-05,
-    (float)9.85612e-05,
-    (float)9.79098e-05,
-    (float)9.72941e-05,
-    (float)9.67133e-05,
-    (float)9.61664e-05,
-    (float)9.5653e-05,
-    (float)9.51722e-05,
-    (float)9.47235e-05,
-    (float)9.43063e-05,
-    (float)9.39201e-05,
-    (float)9.35644e-05,
-    (float)9.32387e-05,
-    (float)9.29426e-05,
-    (float)9.26759e-05,
-    (float)9.2438e-05,
-    (float)9.22289e-05,
-    (float)9.20481e-05,
-    (float)9.18955e-05,
-    (float)9.17709e-05,
-    (float)9.16741e-05,
-    (float)9.16051e-05,
-    (float)9.15637e-05,
-    (float)9.15499e-05,
-    (float)0.602516,
-    (float)0.171556,
-    (float)0.0615782,
-    (float)0.0357788,
-    (float)0.0231095,
-    (float)0.0161001,
-    (float)0.0118895,
-    (float)0.00908827,
-    (float)0.00719782,
-    (float)0.00585179,
-    (float)0.00497764,
-    (float)0.00402594,
-    (float)0.00345026,
-    (float)0.00297937,
-    (float)0.00258301,
-    (float)0.00234797,
-    (float)0.00204843,
-    (float)0.00182936,
-    (float)0.00164478,
-    (float)0.00148493,
-    (float)0.00135353,
-    (float)0.00123356,
-    (float)0.00113072,
-    (float)0.00103667,
-    (float)0.000974,
-    (float)0.000895771,
-    (float)0.000832523,
-    (float)0.000776309,
-    (float)0.000717855,
-    (float)0.000682825,
-    (float)0.000639252,
-    (float)0.000602028,
-    (float)0.000568424,
-    (float)0.000536009,
-    (float)0.000509164,
-    (float)0.000482588,
-    (float)0.000458703,
-    (float)0.000433906,
-    (float)0.000416707,
-    (float)0.000397201,
-    (float)0.000379734,
-    (float)0.000364465,
-    (float)0.000346015,
-    (float)0.000334291,
-    (float)0.000320638,
-    (float)0.000308193,
-    (float)0.000297075,
-    (float)0.000285239,
-    (float)0.000275726,
-    (float)0.000266161,
-    (float)0.0002575,
-    (float)0.000247922,
-    (float)0.000240653,
-    (float)0.000232968,
-    (float)0.000225716,
-    (float)0.000219822,
-    (float)0.000211883,
-    (float)0.000206657,
-    (float)0.000200951,
-    (float)0.000195346,
-    (float)0.000190686,
-    (float)0.000185079,
-    (float)0.000180539,
-    (float)0.000176154,
-    (float)0.000172168,
-    (float)0.000167706,
-    (float)0.00016411,
-    (float)0.00016045,
-    (float)0.000156794,
-    (float)0.000154163,
-    (float)0.000150099,
-    (float)0.000147217,
-    (float)0.00014445,
-    (float)0.000141461,
-    (float)0.00013936,
-    (float)0.000136519,
-    (float)0.000133997,
-    (float)0.000131699,
-    (float)0.00012961,
-    (float)0.000127263,
-    (float)0.000125284,
-    (float)0.000123355,
-    (float)0.000121261,
-    (float)0.000120104,
-    (float)0.000118026,
-    (float)0.000116277,
-    (float)0.000114812,
-    (float)0.000112947,
-    (float)0.000111882,
-    (float)0.000110489,
-    (float)0.000109057,
-    (float)0.000107808,
-    (float)0.000106678,
-    (float)0.00010542,
-    (float)0.000104302,
-    (float)0.000103269,
-    (float)0.000101907,
-    (float)0.000101337,
-    (float)0.000100385,
-    (float)9.93977e-05,
-    (float)9.87537e-05,
-    (float)9.75753e-05,
-    (float)9.69286e-05,
-    (float)9.62717e-05,
-    (float)9.5483e-05,
-    (float)9.48604e-05,
-    (float)9.4287e-05,
-    (float)9.36757e-05,
-    (float)9.31215e-05,
-    (float)9.27163e-05,
-    (float)9.18981e-05,
-    (float)9.15662e-05,
-    (float)9.11866e-05,
-    (float)9.0655e-05,
-    (float)9.05933e-05,
-    (float)9.00395e-05,
-    (float)8.97194e-05,
-    (float)8.95137e-05,
-    (float)8.91153e-05,
-    (float)8.89241e-05,
-    (float)8.87456e-05,
-    (float)8.85649e-05,
-    (float)8.84077e-05,
-    (float)8.84648e-05,
-    (float)8.81929e-05,
-    (float)8.81442e-05,
-    (float)8.81719e-05,
-    (float)8.78971e-05,
-    (float)0.59508,
-    (float)0.193385,
-    (float)0.0558863,
-    (float)0.0334813,
-    (float)0.0218203,
-    (float)0.0153014,
-    (float)0.0111771,
-    (float)0.00858854,
-    (float)0.00681967,
-    (float)0.00555781,
-    (float)0.00491777,
-    (float)0.00379239,
-    (float)0.00326042,
-    (float)0.00281473,
-    (float)0.0024209,
-    (float)0.00226312,
-    (float)0.00195351,
-    (float)0.00174414,
-    (float)0.00156752,
-    (float)0.00142944,
-    (float)0.00128885,
-    (float)0.00117377,
-    (float)0.00107511,
-    (float)0.000976065,
-    (float)0.000941304,
-    (float)0.000858277,
-    (float)0.000797591,
-    (float)0.000744139,
-    (float)0.000682341,
-    (float)0.000653837,
-    (float)0.000611048,
-    (float)0.000575672,
-    (float)0.000541087,
-    (float)0.000516006,
-    (float)0.000488598,
-    (float)0.000463037,
-    (float)0.000440935,
-    (float)0.000411568,
-    (float)0.000400132,
-    (float)0.00038057,
-    (float)0.000364013,
-    (float)0.000350017,
-    (float)0.000331051,
-    (float)0.000320766,
-    (float)0.000307515,
-    (float)0.000296035,
-    (float)0.000283109,
-    (float)0.000273763,
-    (float)0.00026424,
-    (float)0.00025506,
-    (float)0.000247966,
-    (float)0.00023615,
-    (float)0.000230779,
-    (float)0.000223269,
-    (float)0.000216324,
-    (float)0.000210814,
-    (float)0.000202608,
-    (float)0.000197726,
-    (float)0.000192271,
-    (float)0.000187677,
-    (float)0.000181776,
-    (float)0.000177352,
-    (float)0.000172862,
-    (float)0.000168439,
-    (float)0.00016565,
-    (float)0.000159753,
-    (float)0.000156745,
-    (float)0.000153347,
-    (float)0.000150024,
-    (float)0.00014774,
-    (float)0.000143719,
-    (float)0.000140784,
-    (float)0.000137895,
-    (float)0.000135826,
-    (float)0.000132711,
-    (float)0.00013042,
-    (float)0.000128111,
-    (float)0.000125653,
-    (float)0.000124792,
-    (float)0.00012176,
-    (float)0.000119715,
-    (float)0.00011775,
-    (float)0.000115789,
-    (float)0.000114755,
-    (float)0.000112982,
-    (float)0.000111338,
-    (float)0.000109565,
-    (float)0.000108707,
-    (float)0.000106965,
-    (float)0.000105598,
-    (float)0.00010428,
-    (float)0.000102512,
-    (float)0.000102313,
-    (float)0.000101087,
-    (float)9.99878e-05,
-    (float)9.88609e-05,
-    (float)9.76063e-05,
-    (float)9.68368e-05,
-    (float)9.59953e-05,
-    (float)9.51999e-05,
-    (float)9.39685e-05,
-    (float)9.37202e-05,
-    (float)9.29482e-05,
-    (float)9.22711e-05,
-    (float)9.1715e-05,
-    (float)9.03991e-05,
-    (float)9.01031e-05,
-    (float)8.95992e-05,
-    (float)8.91686e-05,
-    (float)8.86603e-05,
-    (float)8.81667e-05,
-    (float)8.77189e-05,
-    (float)8.73062e-05,
-    (float)8.71053e-05,
-    (float)8.61845e-05,
-    (float)8.60788e-05,
-    (float)8.58133e-05,
-    (float)8.55926e-05,
-    (float)8.56808e-05,
-    (float)8.51196e-05,
-    (float)8.49385e-05,
-    (float)8.47279e-05,
-    (float)8.46661e-05,
-    (float)8.43493e-05,
-    (float)8.43427e-05,
-    (float)8.432e-05,
-    (float)8.42745e-05,
-    (float)8.47023e-05,
-    (float)0.585362,
-    (float)0.217711,
-    (float)0.0505271,
-    (float)0.0311493,
-    (float)0.02049,
-    (float)0.0145432,
-    (float)0.010309,
-    (float)0.00802203,
-    (float)0.00639388,
-    (float)0.00522028,
-    (float)0.00486107,
-    (float)0.00355745,
-    (float)0.00306207,
-    (float)0.00264206,
-    (float)0.00225489,
-    (float)0.00214668,
-    (float)0.00184529,
-    (float)0.0016477,
-    (float)0.00147875,
-    (float)0.00138303,
-    (float)0.00121992,
-    (float)0.00110979,
-    (float)0.00101499,
-    (float)0.000907244,
-    (float)0.000900225,
-    (float)0.000816168,
-    (float)0.000758776,
-    (float)0.000708185,
-    (float)0.000650816,
-    (float)0.00062152,
-    (float)0.000580199,
-    (float)0.000546428,
-    (float)0.000506795,
-    (float)0.000494431,
-    (float)0.000466016,
-    (float)0.000442004,
-    (float)0.000422274,
-    (float)0.000388926,
-    (float)0.000381326,
-    (float)0.000362127,
-    (float)0.000346494,
-    (float)0.000331524,
-    (float)0.000316081,
-    (float)0.000305919,
-    (float)0.000293501,
-    (float)0.000283777,
-    (float)0.000266957,
-    (float)0.000261127,
-    (float)0.00025155,
-    (float)0.000242832,
-    (float)0.000236906,
-    (float)0.000223977,
-    (float)0.000219662,
-    (float)0.000212675,
-    (float)0.000206718,
-    (float)0.000199764,
-    (float)0.000193028,
-    (float)0.000187999,
-    (float)0.000182745,
-    (float)0.000179708,
-    (float)0.000171626,
-    (float)0.000168489,
-    (float)0.000164342,
-    (float)0.000160283,
-    (float)0.0001582,
-    (float)0.000151845,
-    (float)0.000148701,
-    (float)0.000145397,
-    (float)0.000143036,
-    (float)0.000139656,
-    (float)0.000136553,
-    (float)0.00013376,
-    (float)0.00013086,
-    (float)0.000130303,
-    (float)0.000125924,
-    (float)0.000123549,
-    (float)0.00012129,
-    (float)0.00011895,
-    (float)0.000118577,
-    (float)0.00011595,
-    (float)0.000113856,
-    (float)0.000111751,
-    (float)0.00011082,
-    (float)0.00010883,
-    (float)0.00010708,
-    (float)0.000105475,
-    (float)0.000103262,
-    (float)0.000103737,
-    (float)0.000102113,
-    (float)0.000100616,
-    (float)9.92286e-05,
-    (float)9.74399e-05,
-    (float)9.69997e-05,
-    (float)9.59498e-05,
-    (float)9.49085e-05,
-    (float)9.3318e-05,
-    (float)9.31955e-05,
-    (float)9.25062e-05,
-    (float)9.1573e-05,
-    (float)9.08686e-05,
-    (float)8.88285e-05,
-    (float)8.87438e-05,
-    (float)8.8292e-05,
-    (float)8.77087e-05,
-    (float)8.70998e-05,
-    (float)8.61844e-05,
-    (float)8.59446e-05,
-    (float)8.54247e-05,
-    (float)8.5172e-05,
-    (float)8.37633e-05,
-    (float)8.33546e-05,
-    (float)8.32865e-05,
-    (float)8.29822e-05,
-    (float)8.32153e-05,
-    (float)8.2164e-05,
-    (float)8.1908e-05,
-    (float)8.16547e-05,
-    (float)8.153e-05,
-    (float)8.11644e-05,
-    (float)8.0482e-05,
-    (float)8.06041e-05,
-    (float)8.04727e-05,
-    (float)8.10498e-05,
-    (float)8.06006e-05,
-    (float)8.01203e-05,
-    (float)8.00747e-05,
-    (float)7.99202e-05,
-    (float)8.03666e-05,
-    (float)0.573083,
-    (float)0.244724,
-    (float)0.0455321,
-    (float)0.0288071,
-    (float)0.01913,
-    (float)0.0138457,
-    (float)0.00930214,
-    (float)0.00738807,
-    (float)0.00591763,
-    (float)0.00483321,
-    (float)0.00478702,
-    (float)0.00332323,
-    (float)0.00285969,
-    (float)0.00246575,
-    (float)0.00209529,
-    (float)0.00199776,
-    (float)0.00172149,
-    (float)0.00153803,
-    (float)0.00137447,
-    (float)0.00133948,
-    (float)0.00114815,
-    (float)0.00104428,
-    (float)0.00095358,
-    (float)0.000836736,
-    (float)0.000847482,
-    (float)0.000766837,
-    (float)0.000714188,
-    (float)0.000665418,
-    (float)0.000623672,
-    (float)0.000586695,
-    (float)0.000548121,
-    (float)0.000516211,
-    (float)0.000468277,
-    (float)0.000469043,
-    (float)0.000439282,
-    (float)0.000418012,
-    (float)0.000400767,
-    (float)0.000368701,
-    (float)0.000360856,
-    (float)0.000342354,
-    (float)0.000327906,
-    (float)0.0003087,
-    (float)0.000300799,
-    (float)0.000288655,
-    (float)0.000277782,
-    (float)0.000270544,
-    (float)0.000250534,
-    (float)0.000247778,
-    (float)0.000237658,
-    (float)0.000229537,
-    (float)0.000222797,
-    (float)0.000212433,
-    (float)0.00020723,
-    (float)0.000200936,
-    (float)0.000196747,
-    (float)0.000186395,
-    (float)0.000183451,
-    (float)0.000177514,
-    (float)0.000172423,
-    (float)0.000170541,
-    (float)0.000161401,
-    (float)0.000158813,
-    (float)0.000154892,
-    (float)0.00015169,
-    (float)0.000147871,
-    (float)0.000144196,
-    (float)0.000140393,
-    (float)0.000137044,
-    (float)0.000136457,
-    (float)0.000130254,
-    (float)0.000128568,
-    (float)0.000125831,
-    (float)0.000123024,
-    (float)0.000122852,
-    (float)0.000119261,
-    (float)0.000116687,
-    (float)0.000114346,
-    (float)0.00011338,
-    (float)0.000110295,
-    (float)0.000109086,
-    (float)0.000107044,
-    (float)0.000104546,
-    (float)0.000105571,
-    (float)0.000102802,
-    (float)0.000101223,
-    (float)9.95878e-05,
-    (float)9.7734e-05,
-    (float)9.68506e-05,
-    (float)9.60304e-05,
-    (float)9.4662e-05,
-    (float)9.27468e-05,
-    (float)9.33566e-05,
-    (float)9.1541e-05,
-    (float)9.07981e-05,
-    (float)8.98298e-05,
-    (float)8.74834e-05,
-    (float)8.75769e-05,
-    (float)8.6935e-05,
-    (float)8.62523e-05,
-    (float)8.52657e-05,
-    (float)8.49593e-05,
-    (float)8.38556e-05,
-    (float)8.35744e-05,
-    (float)8.31631e-05,
-    (float)8.11207e-05,
-    (float)8.13654e-05,
-    (float)8.06749e-05,
-    (float)8.05015e-05,
-    (float)8.04737e-05,
-    (float)7.95891e-05,
-    (float)7.90059e-05,
-    (float)7.87427e-05,
-    (float)7.86204e-05,
-    (float)7.74628e-05,
-    (float)7.75874e-05,
-    (float)7.6859e-05,
-    (float)7.69311e-05,
-    (float)7.75063e-05,
-    (float)7.66269e-05,
-    (float)7.65562e-05,
-    (float)7.60541e-05,
-    (float)7.59743e-05,
-    (float)7.57829e-05,
-    (float)7.58108e-05,
-    (float)7.53353e-05,
-    (float)7.54519e-05,
-    (float)7.61518e-05,
-    (float)7.56816e-05,
-    (float)0.557989,
-    (float)0.274597,
-    (float)0.0409184,
-    (float)0.0264734,
-    (float)0.0177509,
-    (float)0.0132339,
-    (float)0.00818383,
-    (float)0.00668542,
-    (float)0.00538949,
-    (float)0.00439477,
-    (float)0.00467749,
-    (float)0.00308959,
-    (float)0.00265267,
-    (float)0.00228662,
-    (float)0.00195237,
-    (float)0.00182297,
-    (float)0.00158183,
-    (float)0.00141384,
-    (float)0.00125106,
-    (float)0.00129034,
-    (float)0.0010751,
-    (float)0.000976917,
-    (float)0.000891897,
-    (float)0.000771147,
-    (float)0.000784329,
-    (float)0.000711018,
-    (float)0.000662566,
-    (float)0.000611904,
-    (float)0.000596938,
-    (float)0.000550612,
-    (float)0.000515228,
-    (float)0.000486645,
-    (float)0.000429573,
-    (float)0.000438555,
-    (float)0.000409435,
-    (float)0.000389843,
-    (float)0.000373258,
-    (float)0.000350093,
-    (float)0.000338801,
-    (float)0.000322164,
-    (float)0.000309978,
-    (float)0.000283291,
-    (float)0.000283309,
-    (float)0.000269814,
-    (float)0.00025935,
-    (float)0.000254604,
-    (float)0.000235202,
-    (float)0.000232463,
-    (float)0.000223524,
-    (float)0.000216359,
-    (float)0.000205374,
-    (float)0.000200659,
-    (float)0.000193905,
-    (float)0.000187487,
-    (float)0.000186229,
-    (float)0.000172791,
-    (float)0.000171739,
-    (float)0.000166854,
-    (float)0.000161556,
-    (float)0.000158536,
-    (float)0.000152196,
-    (float)0.000148396,
-    (float)0.000144523,
-    (float)0.000143704,
-    (float)0.000135841,
-    (float)0.000134584,
-    (float)0.000131813,
-    (float)0.000127628,
-    (float)0.00012831,
-    (float)0.000122394,
-    (float)0.00011972,
-    (float)0.000117538,
-    (float)0.000116075,
-    (float)0.000112662,
-    (float)0.000111151,
-    (float)0.000109293,
-    (float)0.000106015,
-    (float)0.000107765,
-    (float)0.000103442,
-    (float)0.000101299,
-    (float)0.000100188,
-    (float)9.7786e-05,
-    (float)9.72526e-05,
-    (float)9.59952e-05,
-    (float)9.45196e-05,
-    (float)9.22107e-05,
-    (float)9.33842e-05,
-    (float)9.0845e-05,
-    (float)8.92458e-05,
-    (float)8.88562e-05,
-    (float)8.58339e-05,
-    (float)8.65211e-05,
-    (float)8.57991e-05,
-    (float)8.45624e-05,
-    (float)8.34599e-05,
-    (float)8.34163e-05,
-    (float)8.21467e-05,
-    (float)8.11407e-05,
-    (float)8.11889e-05,
-    (float)7.83193e-05,
-    (float)7.90439e-05,
-    (float)7.87477e-05,
-    (float)7.76599e-05,
-    (float)7.78502e-05,
-    (float)7.68545e-05,
-    (float)7.62171e-05,
-    (float)7.57184e-05,
-    (float)7.57843e-05,
-    (float)7.38331e-05,
-    (float)7.41604e-05,
-    (float)7.40576e-05,
-    (float)7.30368e-05,
-    (float)7.41803e-05,
-    (float)7.29256e-05,
-    (float)7.25721e-05,
-    (float)7.25057e-05,
-    (float)7.21245e-05,
-    (float)7.14086e-05,
-    (float)7.14438e-05,
-    (float)7.14186e-05,
-    (float)7.05673e-05,
-    (float)7.19816e-05,
-    (float)7.1043e-05,
-    (float)7.09181e-05,
-    (float)7.13312e-05,
-    (float)7.02991e-05,
-    (float)7.06042e-05,
-    (float)7.05792e-05,
-    (float)0.539874,
-    (float)0.307419,
-    (float)0.0367049,
-    (float)0.0241732,
-    (float)0.0163633,
-    (float)0.0127272,
-    (float)0.00699042,
-    (float)0.00591974,
-    (float)0.00481291,
-    (float)0.00391071,
-    (float)0.00450983,
-    (float)0.00285392,
-    (float)0.00244062,
-    (float)0.00210233,
-    (float)0.00183477,
-    (float)0.00163184,
-    (float)0.00142842,
-    (float)0.00127709,
-    (float)0.00111015,
-    (float)0.00122416,
-    (float)0.00099938,
-    (float)0.00090678,
-    (float)0.000826992,
-    (float)0.000717889,
-    (float)0.000714675,
-    (float)0.000650117,
-    (float)0.000606029,
-    (float)0.000546675,
-    (float)0.000564126,
-    (float)0.000512586,
-    (float)0.000480646,
-    (float)0.000455479,
-    (float)0.000397009,
-    (float)0.000404156,
-    (float)0.000377274,
-    (float)0.000359855,
-    (float)0.00033696,
-    (float)0.000330026,
-    (float)0.000315113,
-    (float)0.000300551,
-    (float)0.000291874,
-    (float)0.000259945,
-    (float)0.000263083,
-    (float)0.000249742,
-    (float)0.000240434,
-    (float)0.000232358,
-    (float)0.00022063,
-    (float)0.000215703,
-    (float)0.000207785,
-    (float)0.000204037,
-    (float)0.000187065,
-    (float)0.000186987,
-    (float)0.000179951,
-    (float)0.000173897,
-    (float)0.00017186,
-    (float)0.000160791,
-    (float)0.000158756,
-    (float)0.00015432,
-    (float)0.00015207,
-    (float)0.000143687,
-    (float)0.000141729,
-    (float)0.00013784,
-    (float)0.000133744,
-    (float)0.000134244,
-    (float)0.000125404,
-    (float)0.000123827,
-    (float)0.000121279,
-    (float)0.000119541,
-    (float)0.000116372,
-    (float)0.000113703,
-    (float)0.000111157,
-    (float)0.00010824,
-    (float)0.000109699,
-    (float)0.00010364,
-    (float)0.000101951,
-    (float)0.00010021,
-    (float)9.83918e-05,
-    (float)9.8312e-05,
-    (float)9.60121e-05,
-    (float)9.40723e-05,
-    (float)9.17226e-05,
-    (float)9.30295e-05,
-    (float)8.96097e-05,
-    (float)8.81229e-05,
-    (float)8.67871e-05,
-    (float)8.45066e-05,
-    (float)8.57451e-05,
-    (float)8.43794e-05,
-    (float)8.30423e-05,
-    (float)8.11408e-05,
-    (float)8.15813e-05,
-    (float)7.99868e-05,
-    (float)7.90338e-05,
-    (float)7.82247e-05,
-    (float)7.56202e-05,
-    (float)7.68516e-05,
-    (float)7.62696e-05,
-    (float)7.56048e-05,
-    (float)7.44284e-05,
-    (float)7.39818e-05,
-    (float)7.32297e-05,
-    (float)7.2727e-05,
-    (float)7.25535e-05,
-    (float)7.01538e-05,
-    (float)7.08467e-05,
-    (float)7.05765e-05,
-    (float)7.03482e-05,
-    (float)7.00723e-05,
-    (float)6.92584e-05,
-    (float)6.87889e-05,
-    (float)6.84443e-05,
-    (float)6.87061e-05,
-    (float)6.69091e-05,
-    (float)6.72173e-05,
-    (float)6.70003e-05,
-    (float)6.68503e-05,
-    (float)6.72848e-05,
-    (float)6.65909e-05,
-    (float)6.63559e-05,
-    (float)6.60722e-05,
-    (float)6.64741e-05,
-    (float)6.52547e-05,
-    (float)6.5482e-05,
-    (float)6.53808e-05,
-    (float)6.51653e-05,
-    (float)6.60092e-05,
-    (float)6.5524e-05,
-    (float)6.55994e-05,
-    (float)0.518531,
-    (float)0.343256,
-    (float)0.0328998,
-    (float)0.0219295,
-    (float)0.0149855,
-    (float)0.0123403,
-    (float)0.00576245,
-    (float)0.00510889,
-    (float)0.00419686,
-    (float)0.00338816,
-    (float)0.00427192,
-    (float)0.00260721,
-    (float)0.00222056,
-    (float)0.00191283,
-    (float)0.00174327,
-    (float)0.0014366,
-    (float)0.00126722,
-    (float)0.00113155,
-    (float)0.000957357,
-    (float)0.00113486,
-    (float)0.000915562,
-    (float)0.00083057,
-    (float)0.000756673,
-    (float)0.000676727,
-    (float)0.000645806,
-    (float)0.00058768,
-    (float)0.000546742,
-    (float)0.00047455,
-    (float)0.00052075,
-    (float)0.000469784,
-    (float)0.000442017,
-    (float)0.000419639,
-    (float)0.000370621,
-    (float)0.000370358,
-    (float)0.000345228,
-    (float)0.000329506,
-    (float)0.000295743,
-    (float)0.000304484,
-    (float)0.000288667,
-    (float)0.000276502,
-    (float)0.000270445,
-    (float)0.000239665,
-    (float)0.000242265,
-    (float)0.000229776,
-    (float)0.000222119,
-    (float)0.000206496,
-    (float)0.000203401,
-    (float)0.000197371,
-    (float)0.000190629,
-    (float)0.000189825,
-    (float)0.000170247,
-    (float)0.000171736,
-    (float)0.00016543,
-    (float)0.00016091,
-    (float)0.000154674,
-    (float)0.000148045,
-    (float)0.000145074,
-    (float)0.000140959,
-    (float)0.000141854,
-    (float)0.000129503,
-    (float)0.000129274,
-    (float)0.000126078,
-    (float)0.000123078,
-    (float)0.000122216,
-    (float)0.000115387,
-    (float)0.000113092,
-    (float)0.000110327,
-    (float)0.00011164,
-    (float)0.000104545,
-    (float)0.000103041,
-    (float)0.000101078,
-    (float)9.85464e-05,
-    (float)0.000100708,
-    (float)9.54493e-05,
-    (float)9.32118e-05,
-    (float)9.09808e-05,
-    (float)9.17864e-05,
-    (float)8.86219e-05,
-    (float)8.6814e-05,
-    (float)8.52964e-05,
-    (float)8.24833e-05,
-    (float)8.56698e-05,
-    (float)8.26784e-05,
-    (float)8.07848e-05,
-    (float)7.89143e-05,
-    (float)7.85185e-05,
-    (float)7.78309e-05,
-    (float)7.64956e-05,
-    (float)7.54605e-05,
-    (float)7.22994e-05,
-    (float)7.48946e-05,
-    (float)7.38387e-05,
-    (float)7.265e-05,
-    (float)7.14963e-05,
-    (float)6.98582e-05,
-    (float)7.01938e-05,
-    (float)6.94904e-05,
-    (float)6.91316e-05,
-    (float)6.6183e-05,
-    (float)6.73922e-05,
-    (float)6.74172e-05,
-    (float)6.68686e-05,
-    (float)6.67707e-05,
-    (float)6.45162e-05,
-    (float)6.49077e-05,
-    (float)6.45716e-05,
-    (float)6.47739e-05,
-    (float)6.26941e-05,
-    (float)6.25665e-05,
-    (float)6.29571e-05,
-    (float)6.26759e-05,
-    (float)6.35443e-05,
-    (float)6.14866e-05,
-    (float)6.16061e-05,
-    (float)6.14051e-05,
-    (float)6.18108e-05,
-    (float)6.09183e-05,
-    (float)5.9912e-05,
-    (float)6.03513e-05,
-    (float)6.00424e-05,
-    (float)6.14324e-05,
-    (float)6.01306e-05,
-    (float)5.99983e-05,
-    (float)5.99178e-05,
-    (float)6.02407e-05,
-    (float)6.05191e-05,
-    (float)5.91039e-05,
-    (float)5.95018e-05,
-    (float)0.493864,
-    (float)0.382024,
-    (float)0.0295227,
-    (float)0.0197702,
-    (float)0.0136332,
-    (float)0.0120745,
-    (float)0.00454629,
-    (float)0.0042796,
-    (float)0.00355767,
-    (float)0.00284232,
-    (float)0.00394844,
-    (float)0.00234508,
-    (float)0.00199053,
-    (float)0.0017157,
-    (float)0.00167223,
-    (float)0.00124545,
-    (float)0.00110761,
-    (float)0.000985104,
-    (float)0.000803674,
-    (float)0.0010168,
-    (float)0.000819685,
-    (float)0.000745832,
-    (float)0.000677733,
-    (float)0.000643886,
-    (float)0.00057872,
-    (float)0.00052804,
-    (float)0.000489559,
-    (float)0.00040487,
-    (float)0.000465646,
-    (float)0.000419204,
-    (float)0.000397202,
-    (float)0.000375731,
-    (float)0.000348728,
-    (float)0.000336219,
-    (float)0.000314767,
-    (float)0.000301159,
-    (float)0.000256671,
-    (float)0.000274795,
-    (float)0.000257724,
-    (float)0.000248515,
-    (float)0.000242239,
-    (float)0.000222321,
-    (float)0.000220193,
-    (float)0.000210082,
-    (float)0.000204982,
-    (float)0.000181019,
-    (float)0.000185552,
-    (float)0.000176856,
-    (float)0.000171411,
-    (float)0.000170554,
-    (float)0.000155637,
-    (float)0.000155318,
-    (float)0.000150433,
-    (float)0.000148501,
-    (float)0.000135667,
-    (float)0.00013578,
-    (float)0.000130526,
-    (float)0.000126785,
-    (float)0.00012841,
-    (float)0.000117074,
-    (float)0.000116277,
-    (float)0.00011375,
-    (float)0.000113053,
-    (float)0.000106624,
-    (float)0.000105525,
-    (float)0.000101895,
-    (float)9.90052e-05,
-    (float)0.000102142,
-    (float)9.40217e-05,
-    (float)9.24957e-05,
-    (float)9.07319e-05,
-    (float)9.01605e-05,
-    (float)8.74911e-05,
-    (float)8.65655e-05,
-    (float)8.38285e-05,
-    (float)8.10625e-05,
-    (float)8.47904e-05,
-    (float)7.97153e-05,
-    (float)7.81036e-05,
-    (float)7.65668e-05,
-    (float)7.53924e-05,
-    (float)7.462e-05,
-    (float)7.43884e-05,
-    (float)7.24901e-05,
-    (float)6.95365e-05,
-    (float)7.28268e-05,
-    (float)7.0143e-05,
-    (float)6.91114e-05,
-    (float)6.80223e-05,
-    (float)6.61162e-05,
-    (float)6.58912e-05,
-    (float)6.62064e-05,
-    (float)6.52542e-05,
-    (float)6.23494e-05,
-    (float)6.45767e-05,
-    (float)6.32403e-05,
-    (float)6.29459e-05,
-    (float)6.2669e-05,
-    (float)6.0479e-05,
-    (float)6.01161e-05,
-    (float)6.05149e-05,
-    (float)6.03795e-05,
-    (float)5.79715e-05,
-    (float)5.91485e-05,
-    (float)5.82406e-05,
-    (float)5.83892e-05,
-    (float)5.89573e-05,
-    (float)5.7087e-05,
-    (float)5.65592e-05,
-    (float)5.66924e-05,
-    (float)5.7021e-05,
-    (float)5.53907e-05,
-    (float)5.59303e-05,
-    (float)5.4964e-05,
-    (float)5.51862e-05,
-    (float)5.62871e-05,
-    (float)5.50601e-05,
-    (float)5.46934e-05,
-    (float)5.45049e-05,
-    (float)5.4964e-05,
-    (float)5.41415e-05,
-    (float)5.45278e-05,
-    (float)5.33784e-05,
-    (float)5.34696e-05,
-    (float)5.47199e-05,
-    (float)5.40684e-05,
-    (float)5.41933e-05,
-    (float)5.37999e-05,
-    (float)0.465902,
-    (float)0.423531,
-    (float)0.0265505,
-    (float)0.0177205,
-    (float)0.0123162,
-    (float)0.0119378,
-    (float)0.0033957,
-    (float)0.00345383,
-    (float)0.00291407,
-    (float)0.00229604,
-    (float)0.00354261,
-    (float)0.00206045,
-    (float)0.00174693,
-    (float)0.00150406,
-    (float)0.00161356,
-    (float)0.00106975,
-    (float)0.000954019,
-    (float)0.000844438,
-    (float)0.000660566,
-    (float)0.000875758,
-    (float)0.000711455,
-    (float)0.000650508,
-    (float)0.00058479,
-    (float)0.000610264,
-    (float)0.000516517,
-    (float)0.000471533,
-    (float)0.000437514,
-    (float)0.000345,
-    (float)0.000403611,
-    (float)0.000364116,
-    (float)0.000346465,
-    (float)0.000320921,
-    (float)0.000323659,
-    (float)0.000301763,
-    (float)0.000284186,
-    (float)0.000275595,
-    (float)0.000224634,
-    (float)0.000243194,
-    (float)0.000226673,
-    (float)0.000218321,
-    (float)0.000206589,
-    (float)0.000202849,
-    (float)0.000196203,
-    (float)0.000188376,
-    (float)0.000188629,
-    (float)0.000159543,
-    (float)0.000166463,
-    (float)0.000157874,
-    (float)0.00015206,
-    (float)0.000146325,
-    (float)0.000140855,
-    (float)0.000137511,
-    (float)0.000133146,
-    (float)0.00013615,
-    (float)0.00011853,
-    (float)0.000121426,
-    (float)0.000117389,
-    (float)0.000113086,
-    (float)0.000110937,
-    (float)0.000105765,
-    (float)0.000103003,
-    (float)9.97733e-05,
-    (float)0.000103567,
-    (float)9.22219e-05,
-    (float)9.29206e-05,
-    (float)9.14203e-05,
-    (float)8.81169e-05,
-    (float)8.84012e-05,
-    (float)8.46876e-05,
-    (float)8.22274e-05,
-    (float)7.92386e-05,
-    (float)8.31586e-05,
-    (float)7.58729e-05,
-    (float)7.51481e-05,
-    (float)7.47748e-05,
-    (float)7.17205e-05,
-    (float)7.31894e-05,
-    (float)7.12767e-05,
-    (float)6.94539e-05,
-    (float)6.64551e-05,
-    (float)7.00054e-05,
-    (float)6.57558e-05,
-    (float)6.43779e-05,
-    (float)6.46027e-05,
-    (float)6.13486e-05,
-    (float)6.27933e-05,
-    (float)6.2236e-05,
-    (float)6.12936e-05,
-    (float)5.84053e-05,
-    (float)6.11441e-05,
-    (float)5.90857e-05,
-    (float)5.76339e-05,
-    (float)5.85018e-05,
-    (float)5.51998e-05,
-    (float)5.59549e-05,
-    (float)5.59777e-05,
-    (float)5.58023e-05,
-    (float)5.32872e-05,
-    (float)5.50327e-05,
-    (float)5.4302e-05,
-    (float)5.29399e-05,
-    (float)5.45211e-05,
-    (float)5.16656e-05,
-    (float)5.17397e-05,
-    (float)5.17981e-05,
-    (float)5.20275e-05,
-    (float)5.0094e-05,
-    (float)5.0974e-05,
-    (float)5.08973e-05,
-    (float)4.94684e-05,
-    (float)5.15657e-05,
-    (float)4.95307e-05,
-    (float)4.93033e-05,
-    (float)4.93089e-05,
-    (float)4.95853e-05,
-    (float)4.83211e-05,
-    (float)4.86552e-05,
-    (float)4.89115e-05,
-    (float)4.72084e-05,
-    (float)4.94431e-05,
-    (float)4.82419e-05,
-    (float)4.80378e-05,
-    (float)4.82165e-05,
-    (float)4.83295e-05,
-    (float)4.7696e-05,
-    (float)4.7845e-05,
-    (float)4.84546e-05,
-    (float)4.64133e-05,
-    (float)0.434865,
-    (float)0.467366,
-    (float)0.0239647,
-    (float)0.0158003,
-    (float)0.0110533,
-    (float)0.0119154,
-    (float)0.00236382,
-    (float)0.00266134,
-    (float)0.00228729,
-    (float)0.00178105,
-    (float)0.00306015,
-    (float)0.00175369,
-    (float)0.001488,
-    (float)0.00127547,
-    (float)0.00155086,
-    (float)0.000915477,
-    (float)0.000811349,
-    (float)0.00071226,
-    (float)0.000543157,
-    (float)0.00071979,
-    (float)0.000594784,
-    (float)0.00054672,
-    (float)0.000477441,
-    (float)0.000564317,
-    (float)0.000457374,
-    (float)0.000417524,
-    (float)0.000386884,
-    (float)0.000302957,
-    (float)0.000340842,
-    (float)0.000309043,
-    (float)0.000294986,
-    (float)0.000257823,
-    (float)0.000288812,
-    (float)0.000264566,
-    (float)0.000251711,
-    (float)0.000245951,
-    (float)0.00020308,
-    (float)0.000212673,
-    (float)0.000197874,
-    (float)0.000191706,
-    (float)0.000167787,
-    (float)0.000178264,
-    (float)0.000169716,
-    (float)0.00016434,
-    (float)0.000165921,
-    (float)0.0001435,
-    (float)0.000146976,
-    (float)0.000139665,
-    (float)0.000137048,
-    (float)0.000121169,
-    (float)0.000124115,
-    (float)0.000119152,
-    (float)0.000115254,
-    (float)0.000117938,
-    (float)0.000104788,
-    (float)0.000105963,
-    (float)0.000102889,
-    (float)0.000102864,
-    (float)9.25267e-05,
-    (float)9.31042e-05,
-    (float)9.00476e-05,
-    (float)8.67499e-05,
-    (float)8.94872e-05,
-    (float)8.09419e-05,
-    (float)8.01911e-05,
-    (float)7.86163e-05,
-    (float)8.02097e-05,
-    (float)7.35524e-05,
-    (float)7.33663e-05,
-    (float)7.17343e-05,
-    (float)6.90476e-05,
-    (float)7.20234e-05,
-    (float)6.68827e-05,
-    (float)6.50561e-05,
-    (float)6.33757e-05,
-    (float)6.5601e-05,
-    (float)6.13552e-05,
-    (float)6.07435e-05,
-    (float)5.98745e-05,
-    (float)5.74419e-05,
-    (float)6.02693e-05,
-    (float)5.80079e-05,
-    (float)5.63402e-05,
-    (float)5.42072e-05,
-    (float)5.63983e-05,
-    (float)5.39085e-05,
-    (float)5.3115e-05,
-    (float)5.26181e-05,
-    (float)5.01493e-05,
-    (float)5.20622e-05,
-    (float)5.16132e-05,
-    (float)5.08456e-05,
-    (float)4.85262e-05,
-    (float)5.02999e-05,
-    (float)4.91176e-05,
-    (float)4.8484e-05,
-    (float)4.83718e-05,
-    (float)4.60881e-05,
-    (float)4.67904e-05,
-    (float)4.69119e-05,
-    (float)4.70296e-05,
-    (float)4.48294e-05,
-    (float)4.60121e-05,
-    (float)4.55801e-05,
-    (float)4.52314e-05,
-    (float)4.55388e-05,
-    (float)4.39327e-05,
-    (float)4.38244e-05,
-    (float)4.38131e-05,
-    (float)4.44745e-05,
-    (float)4.25768e-05,
-    (float)4.32332e-05,
-    (float)4.30594e-05,
-    (float)4.28391e-05,
-    (float)4.32976e-05,
-    (float)4.25809e-05,
-    (float)4.229e-05,
-    (float)4.20544e-05,
-    (float)4.30109e-05,
-    (float)4.14903e-05,
-    (float)4.18757e-05,
-    (float)4.18019e-05,
-    (float)4.16203e-05,
-    (float)4.18322e-05,
-    (float)4.17633e-05,
-    (float)4.16504e-05,
-    (float)4.13294e-05,
-    (float)4.25274e-05,
-    (float)0.401,
-    (float)0.513086,
-    (float)0.0217321,
-    (float)0.014026,
-    (float)0.00985781,
-    (float)0.011997,
-    (float)0.00149073,
-    (float)0.00194009,
-    (float)0.00170617,
-    (float)0.00132108,
-    (float)0.00253017,
-    (float)0.00142684,
-    (float)0.00121567,
-    (float)0.00103205,
-    (float)0.00147078,
-    (float)0.000778542,
-    (float)0.000682216,
-    (float)0.000593282,
-    (float)0.000456052,
-    (float)0.00056679,
-    (float)0.000475545,
-    (float)0.000438891,
-    (float)0.000362541,
-    (float)0.000500114,
-    (float)0.000395121,
-    (float)0.000362198,
-    (float)0.000335387,
-    (float)0.000274784,
-    (float)0.000286655,
-    (float)0.000258914,
-    (float)0.000247066,
-    (float)0.000196084,
-    (float)0.000244408,
-    (float)0.000222612,
-    (float)0.000214587,
-    (float)0.000209099,
-    (float)0.000184232,
-    (float)0.000185934,
-    (float)0.000172822,
-    (float)0.00016957,
-    (float)0.000134628,
-    (float)0.000151191,
-    (float)0.000142218,
-    (float)0.000138538,
-    (float)0.000136624,
-    (float)0.000125828,
-    (float)0.00012712,
-    (float)0.000121665,
-    (float)0.000123493,
-    (float)0.000101043,
-    (float)0.000107113,
-    (float)0.000101893,
-    (float)9.8804e-05,
-    (float)9.63583e-05,
-    (float)8.98282e-05,
-    (float)8.97704e-05,
-    (float)8.72848e-05,
-    (float)9.15998e-05,
-    (float)7.73061e-05,
-    (float)7.96512e-05,
-    (float)7.74213e-05,
-    (float)7.58383e-05,
-    (float)7.38243e-05,
-    (float)6.92415e-05,
-    (float)6.78934e-05,
-    (float)6.56197e-05,
-    (float)7.07583e-05,
-    (float)6.14097e-05,
-    (float)6.13755e-05,
-    (float)6.04557e-05,
-    (float)6.03734e-05,
-    (float)5.95093e-05,
-    (float)5.6792e-05,
-    (float)5.5349e-05,
-    (float)5.25543e-05,
-    (float)5.78127e-05,
-    (float)5.22611e-05,
-    (float)5.08021e-05,
-    (float)4.96298e-05,
-    (float)5.0043e-05,
-    (float)4.98604e-05,
-    (float)4.84916e-05,
-    (float)4.76939e-05,
-    (float)4.43274e-05,
-    (float)4.89367e-05,
-    (float)4.66439e-05,
-    (float)4.52358e-05,
-    (float)4.35729e-05,
-    (float)4.38394e-05,
-    (float)4.39368e-05,
-    (float)4.31444e-05,
-    (float)4.31352e-05,
-    (float)3.93932e-05,
-    (float)4.2489e-05,
-    (float)4.21506e-05,
-    (float)4.1698e-05,
-    (float)3.9988e-05,
-    (float)3.99589e-05,
-    (float)4.03281e-05,
-    (float)3.97687e-05,
-    (float)4.05441e-05,
-    (float)3.7015e-05,
-    (float)3.84962e-05,
-    (float)3.86238e-05,
-    (float)3.90458e-05,
-    (float)3.76019e-05,
-    (float)3.72114e-05,
-    (float)3.77614e-05,
-    (float)3.72877e-05,
-    (float)3.8654e-05,
-    (float)3.5919e-05,
-    (float)3.64861e-05,
-    (float)3.63686e-05,
-    (float)3.7265e-05,
-    (float)3.62813e-05,
-    (float)3.55206e-05,
-    (float)3.60941e-05,
-    (float)3.55894e-05,
-    (float)3.71495e-05,
-    (float)3.51957e-05,
-    (float)3.55772e-05,
-    (float)3.51767e-05,
-    (float)3.62341e-05,
-    (float)3.58858e-05,
-    (float)3.48874e-05,
-    (float)3.542e-05,
-    (float)3.49452e-05,
-    (float)3.65535e-05,
-    (float)0.364833,
-    (float)0.559975,
-    (float)0.0198352,
-    (float)0.0124082,
-    (float)0.00874531,
-    (float)0.0121413,
-    (float)0.000811681,
-    (float)0.00132408,
-    (float)0.00119889,
-    (float)0.000944032,
-    (float)0.00197605,
-    (float)0.00109612,
-    (float)0.000937478,
-    (float)0.000783035,
-    (float)0.00135528,
-    (float)0.000653521,
-    (float)0.000565778,
-    (float)0.000488204,
-    (float)0.000401073,
-    (float)0.000425935,
-    (float)0.000364969,
-    (float)0.000335143,
-    (float)0.000252792,
-    (float)0.000415582,
-    (float)0.000325724,
-    (float)0.000301995,
-    (float)0.000278887,
-    (float)0.000254852,
-    (float)0.000239638,
-    (float)0.000217551,
-    (float)0.000206469,
-    (float)0.000146957,
-    (float)0.000195806,
-    (float)0.000177854,
-    (float)0.000173542,
-    (float)0.000163728,
-    (float)0.000163288,
-    (float)0.000157418,
-    (float)0.000149539,
-    (float)0.000149241,
-    (float)0.000112424,
-    (float)0.000126414,
-    (float)0.000117467,
-    (float)0.000114645,
-    (float)0.00010375,
-    (float)0.000106524,
-    (float)0.000103627,
-    (float)0.000101653,
-    (float)0.000106062,
-    (float)8.61964e-05,
-    (float)9.10242e-05,
-    (float)8.70545e-05,
-    (float)8.59852e-05,
-    (float)7.49299e-05,
-    (float)7.63402e-05,
-    (float)7.2888e-05,
-    (float)7.11879e-05,
-    (float)7.55987e-05,
-    (float)6.46305e-05,
-    (float)6.54696e-05,
-    (float)6.47579e-05,
-    (float)6.68166e-05,
-    (float)5.8036e-05,
-    (float)5.90012e-05,
-    (float)5.63423e-05,
-    (float)5.42189e-05,
-    (float)5.76023e-05,
-    (float)5.17135e-05,
-    (float)4.9638e-05,
-    (float)4.88391e-05,
-    (float)5.28727e-05,
-    (float)4.65108e-05,
-    (float)4.69161e-05,
-    (float)4.56546e-05,
-    (float)4.38366e-05,
-    (float)4.61976e-05,
-    (float)4.44456e-05,
-    (float)4.17496e-05,
-    (float)3.947e-05,
-    (float)4.40001e-05,
-    (float)4.00354e-05,
-    (float)3.9433e-05,
-    (float)3.87146e-05,
-    (float)3.73903e-05,
-    (float)3.81503e-05,
-    (float)3.89059e-05,
-    (float)3.75081e-05,
-    (float)3.41125e-05,
-    (float)3.78991e-05,
-    (float)3.65045e-05,
-    (float)3.56256e-05,
-    (float)3.4801e-05,
-    (float)3.41798e-05,
-    (float)3.34694e-05,
-    (float)3.463e-05,
-    (float)3.48139e-05,
-    (float)3.1225e-05,
-    (float)3.32698e-05,
-    (float)3.35428e-05,
-    (float)3.33165e-05,
-    (float)3.22499e-05,
-    (float)3.24123e-05,
-    (float)3.12073e-05,
-    (float)3.18447e-05,
-    (float)3.29589e-05,
-    (float)3.0187e-05,
-    (float)3.04709e-05,
-    (float)3.10313e-05,
-    (float)3.16027e-05,
-    (float)3.03952e-05,
-    (float)3.0934e-05,
-    (float)2.98733e-05,
-    (float)3.01005e-05,
-    (float)3.13705e-05,
-    (float)2.99054e-05,
-    (float)2.92725e-05,
-    (float)2.94486e-05,
-    (float)3.04538e-05,
-    (float)2.94151e-05,
-    (float)2.99839e-05,
-    (float)2.90332e-05,
-    (float)2.91804e-05,
-    (float)3.02155e-05,
-    (float)2.98097e-05,
-    (float)2.89422e-05,
-    (float)2.88255e-05,
-    (float)2.98578e-05,
-    (float)2.91458e-05,
-    (float)0.327033,
-    (float)0.607221,
-    (float)0.0182014,
-    (float)0.0109665,
-    (float)0.00771482,
-    (float)0.0123211,
-    (float)0.000349591,
-    (float)0.000837299,
-    (float)0.000785195,
-    (float)0.000674976,
-    (float)0.00144147,
-    (float)0.000773655,
-    (float)0.000669571,
-    (float)0.000538119,
-    (float)0.00119992,
-    (float)0.00053465,
-    (float)0.000458682,
-    (float)0.000392233,
-    (float)0.000370676,
-    (float)0.000310397,
-    (float)0.00026866,
-    (float)0.000245633,
-    (float)0.000159208,
-    (float)0.000319048,
-    (float)0.000250493,
-    (float)0.000236731,
-    (float)0.000215029,
-    (float)0.000231481,
-    (float)0.000199125,
-    (float)0.00018165,
-    (float)0.000174672,
-    (float)0.000114777,
-    (float)0.000151669,
-    (float)0.000136467,
-    (float)0.000134071,
-    (float)0.000115158,
-    (float)0.000135233,
-    (float)0.000126275,
-    (float)0.000122116,
-    (float)0.000126596,
-    (float)9.76726e-05,
-    (float)0.000105487,
-    (float)9.76914e-05,
-    (float)9.70549e-05,
-    (float)7.53268e-05,
-    (float)8.62731e-05,
-    (float)8.12014e-05,
-    (float)7.87259e-05,
-    (float)8.27729e-05,
-    (float)7.2307e-05,
-    (float)7.40983e-05,
-    (float)7.16588e-05,
-    (float)7.58248e-05,
-    (float)5.84148e-05,
-    (float)6.33786e-05,
-    (float)6.02927e-05,
-    (float)5.74008e-05,
-    (float)5.65882e-05,
-    (float)5.30418e-05,
-    (float)5.17605e-05,
-    (float)4.9759e-05,
-    (float)5.65347e-05,
-    (float)4.54175e-05,
-    (float)4.70048e-05,
-    (float)4.65772e-05,
-    (float)4.62875e-05,
-    (float)4.30192e-05,
-    (float)4.23857e-05,
-    (float)4.08555e-05,
-    (float)3.71754e-05,
-    (float)4.31628e-05,
-    (float)3.7175e-05,
-    (float)3.60577e-05,
-    (float)3.54507e-05,
-    (float)3.79218e-05,
-    (float)3.43249e-05,
-    (float)3.44865e-05,
-    (float)3.47305e-05,
-    (float)3.08682e-05,
-    (float)3.47235e-05,
-    (float)3.29421e-05,
-    (float)3.14839e-05,
-    (float)2.89427e-05,
-    (float)3.24918e-05,
-    (float)2.97902e-05,
-    (float)2.90121e-05,
-    (float)3.01478e-05,
-    (float)2.74517e-05,
-    (float)2.87883e-05,
-    (float)2.90734e-05,
-    (float)2.94685e-05,
-    (float)2.57019e-05,
-    (float)2.88011e-05,
-    (float)2.79342e-05,
-    (float)2.66458e-05,
-    (float)2.7219e-05,
-    (float)2.61096e-05,
-    (float)2.57673e-05,
-    (float)2.56018e-05,
-    (float)2.7698e-05,
-    (float)2.40823e-05,
-    (float)2.57131e-05,
-    (float)2.61236e-05,
-    (float)2.56238e-05,
-    (float)2.52486e-05,
-    (float)2.53881e-05,
-    (float)2.4983e-05,
-    (float)2.36703e-05,
-    (float)2.6199e-05,
-    (float)2.36775e-05,
-    (float)2.39038e-05,
-    (float)2.41828e-05,
-    (float)2.47878e-05,
-    (float)2.37811e-05,
-    (float)2.43003e-05,
-    (float)2.46709e-05,
-    (float)2.28708e-05,
-    (float)2.49929e-05,
-    (float)2.37944e-05,
-    (float)2.35708e-05,
-    (float)2.29897e-05,
-    (float)2.4307e-05,
-    (float)2.31232e-05,
-    (float)2.33542e-05,
-    (float)2.43281e-05,
-    (float)2.26345e-05,
-    (float)2.40596e-05,
-    (float)2.38518e-05,
-    (float)0.288509,
-    (float)0.653834,
-    (float)0.0167666,
-    (float)0.00969219,
-    (float)0.00678779,
-    (float)0.012482,
-    (float)0.000110057,
-    (float)0.000494012,
-    (float)0.000480551,
-    (float)0.000529882,
-    (float)0.000963568,
-    (float)0.000483745,
-    (float)0.000424935,
-    (float)0.000318693,
-    (float)0.00100352,
-    (float)0.000420632,
-    (float)0.000356645,
-    (float)0.000299691,
-    (float)0.0003518,
-    (float)0.000223772,
-    (float)0.000192548,
-    (float)0.000172696,
-    (float)9.40574e-05,
-    (float)0.000220984,
-    (float)0.000176958,
-    (float)0.00017087,
-    (float)0.000145871,
-    (float)0.000196001,
-    (float)0.000160756,
-    (float)0.000148745,
-    (float)0.00014373,
-    (float)9.90734e-05,
-    (float)0.000116316,
-    (float)0.000104011,
-    (float)0.000102632,
-    (float)7.32574e-05,
-    (float)0.000101489,
-    (float)9.36725e-05,
-    (float)9.30212e-05,
-    (float)9.47655e-05,
-    (float)8.39512e-05,
-    (float)8.55847e-05,
-    (float)8.06338e-05,
-    (float)8.31891e-05,
-    (float)5.79561e-05,
-    (float)6.79912e-05,
-    (float)6.26659e-05,
-    (float)6.12891e-05,
-    (float)5.60796e-05,
-    (float)5.68725e-05,
-    (float)5.60094e-05,
-    (float)5.48253e-05,
-    (float)6.05784e-05,
-    (float)4.72117e-05,
-    (float)5.05758e-05,
-    (float)4.87233e-05,
-    (float)4.96038e-05,
-    (float)4.03839e-05,
-    (float)4.20448e-05,
-    (float)4.00612e-05,
-    (float)3.80211e-05,
-    (float)4.10046e-05,
-    (float)3.53966e-05,
-    (float)3.52092e-05,
-    (float)3.4583e-05,
-    (float)3.89479e-05,
-    (float)3.16422e-05,
-    (float)3.24904e-05,
-    (float)3.1985e-05,
-    (float)3.11395e-05,
-    (float)3.09485e-05,
-    (float)2.92737e-05,
-    (float)2.78413e-05,
-    (float)2.56462e-05,
-    (float)3.00972e-05,
-    (float)2.59488e-05,
-    (float)2.51722e-05,
-    (float)2.4737e-05,
-    (float)2.61505e-05,
-    (float)2.47447e-05,
-    (float)2.47522e-05,
-    (float)2.45026e-05,
-    (float)2.20824e-05,
-    (float)2.4867e-05,
-    (float)2.3735e-05,
-    (float)2.26506e-05,
-    (float)2.06963e-05,
-    (float)2.29103e-05,
-    (float)2.15347e-05,
-    (float)2.11578e-05,
-    (float)2.13547e-05,
-    (float)2.00914e-05,
-    (float)2.09503e-05,
-    (float)2.13513e-05,
-    (float)2.16884e-05,
-    (float)1.92206e-05,
-    (float)2.10074e-05,
-    (float)2.06958e-05,
-    (float)2.02416e-05,
-    (float)1.95943e-05,
-    (float)1.94528e-05,
-    (float)1.90945e-05,
-    (float)1.90774e-05,
-    (float)2.00875e-05,
-    (float)1.83151e-05,
-    (float)1.90151e-05,
-    (float)1.93544e-05,
-    (float)1.98631e-05,
-    (float)1.87128e-05,
-    (float)1.92247e-05,
-    (float)1.89524e-05,
-    (float)1.85554e-05,
-    (float)1.90304e-05,
-    (float)1.82685e-05,
-    (float)1.80586e-05,
-    (float)1.79524e-05,
-    (float)1.897e-05,
-    (float)1.78814e-05,
-    (float)1.83542e-05,
-    (float)1.84899e-05,
-    (float)1.85931e-05,
-    (float)1.83873e-05,
-    (float)1.85455e-05,
-    (float)1.83199e-05,
-    (float)1.78006e-05,
-    (float)1.85495e-05,
-    (float)1.78117e-05,
-    (float)1.78338e-05,
-    (float)0.250021,
-    (float)0.698972,
-    (float)0.0154741,
-    (float)0.00857658,
-    (float)0.00595708,
-    (float)0.01261,
-    (float)7.46856e-05,
-    (float)0.000303015,
-    (float)0.000295217,
-    (float)0.000510656,
-    (float)0.000584762,
-    (float)0.000249093,
-    (float)0.000223515,
-    (float)0.000142581,
-    (float)0.000788368,
-    (float)0.00030738,
-    (float)0.000259237,
-    (float)0.000211396,
-    (float)0.000330048,
-    (float)0.000162291,
-    (float)0.000136408,
-    (float)0.000118971,
-    (float)5.77785e-05,
-    (float)0.000138875,
-    (float)0.000111781,
-    (float)0.000110883,
-    (float)8.16626e-05,
-    (float)0.000149117,
-    (float)0.000120139,
-    (float)0.000114395,
-    (float)0.000111392,
-    (float)8.80892e-05,
-    (float)9.13724e-05,
-    (float)8.07558e-05,
-    (float)8.09201e-05,
-    (float)4.55229e-05,
-    (float)7.13953e-05,
-    (float)6.41101e-05,
-    (float)6.52065e-05,
-    (float)6.04679e-05,
-    (float)6.45066e-05,
-    (float)6.43153e-05,
-    (float)6.21714e-05,
-    (float)6.78453e-05,
-    (float)4.68035e-05,
-    (float)5.43428e-05,
-    (float)4.93532e-05,
-    (float)5.02029e-05,
-    (float)3.62801e-05,
-    (float)4.20405e-05,
-    (float)3.98202e-05,
-    (float)3.87422e-05,
-    (float)4.17406e-05,
-    (float)3.49921e-05,
-    (float)3.73636e-05,
-    (float)3.6351e-05,
-    (float)4.14341e-05,
-    (float)2.93923e-05,
-    (float)3.25473e-05,
-    (float)3.11668e-05,
-    (float)3.08637e-05,
-    (float)2.77802e-05,
-    (float)2.59761e-05,
-    (float)2.53341e-05,
-    (float)2.37189e-05,
-    (float)2.88719e-05,
-    (float)2.21116e-05,
-    (float)2.27154e-05,
-    (float)2.24026e-05,
-    (float)2.57101e-05,
-    (float)2.15478e-05,
-    (float)2.12837e-05,
-    (float)2.09558e-05,
-    (float)1.94697e-05,
-    (float)2.20971e-05,
-    (float)1.91089e-05,
-    (float)1.8171e-05,
-    (float)1.60573e-05,
-    (float)2.03613e-05,
-    (float)1.73161e-05,
-    (float)1.66718e-05,
-    (float)1.6364e-05,
-    (float)1.66019e-05,
-    (float)1.75397e-05,
-    (float)1.69732e-05,
-    (float)1.7058e-05,
-    (float)1.41718e-05,
-    (float)1.76303e-05,
-    (float)1.65357e-05,
-    (float)1.59062e-05,
-    (float)1.40561e-05,
-    (float)1.51602e-05,
-    (float)1.5059e-05,
-    (float)1.46027e-05,
-    (float)1.51406e-05,
-    (float)1.28992e-05,
-    (float)1.47671e-05,
-    (float)1.48672e-05,
-    (float)1.57937e-05,
-    (float)1.34065e-05,
-    (float)1.4692e-05,
-    (float)1.4861e-05,
-    (float)1.47042e-05,
-    (float)1.45899e-05,
-    (float)1.31761e-05,
-    (float)1.37537e-05,
-    (float)1.33172e-05,
-    (float)1.47616e-05,
-    (float)1.25582e-05,
-    (float)1.33801e-05,
-    (float)1.35265e-05,
-    (float)1.43653e-05,
-    (float)1.39891e-05,
-    (float)1.34772e-05,
-    (float)1.39739e-05,
-    (float)1.34574e-05,
-    (float)1.47052e-05,
-    (float)1.28939e-05,
-    (float)1.33511e-05,
-    (float)1.27233e-05,
-    (float)1.38318e-05,
-    (float)1.30661e-05,
-    (float)1.28935e-05,
-    (float)1.32216e-05,
-    (float)1.32074e-05,
-    (float)1.43341e-05,
-    (float)1.30695e-05,
-    (float)1.38215e-05,
-    (float)0.212538,
-    (float)0.741693,
-    (float)0.0142899,
-    (float)0.0076014,
-    (float)0.00522654,
-    (float)0.012645,
-    (float)0.000215938,
-    (float)0.000254929,
-    (float)0.000229071,
-    (float)0.000604203,
-    (float)0.000325087,
-    (float)9.26174e-05,
-    (float)8.27545e-05,
-    (float)3.28866e-05,
-    (float)0.000570712,
-    (float)0.000203638,
-    (float)0.000169063,
-    (float)0.000132751,
-    (float)0.000292488,
-    (float)0.000116589,
-    (float)9.59143e-05,
-    (float)8.07903e-05,
-    (float)4.6421e-05,
-    (float)7.77713e-05,
-    (float)6.34469e-05,
-    (float)6.28605e-05,
-    (float)3.3651e-05,
-    (float)9.78572e-05,
-    (float)7.90338e-05,
-    (float)7.83822e-05,
-    (float)7.61625e-05,
-    (float)7.47766e-05,
-    (float)6.95784e-05,
-    (float)6.37359e-05,
-    (float)6.47467e-05,
-    (float)3.2882e-05,
-    (float)4.91306e-05,
-    (float)4.33871e-05,
-    (float)4.39581e-05,
-    (float)3.13765e-05,
-    (float)4.35515e-05,
-    (float)4.15719e-05,
-    (float)4.23328e-05,
-    (float)4.69353e-05,
-    (float)3.69265e-05,
-    (float)4.01936e-05,
-    (float)3.88336e-05,
-    (float)4.20316e-05,
-    (float)2.53696e-05,
-    (float)3.13631e-05,
-    (float)2.88216e-05,
-    (float)2.82105e-05,
-    (float)2.40336e-05,
-    (float)2.44034e-05,
-    (float)2.3543e-05,
-    (float)2.36436e-05,
-    (float)2.87853e-05,
-    (float)2.06842e-05,
-    (float)2.2244e-05,
-    (float)2.27281e-05,
-    (float)2.57828e-05,
-    (float)1.81647e-05,
-    (float)1.95059e-05,
-    (float)1.84367e-05,
-    (float)1.76273e-05,
-    (float)1.81245e-05,
-    (float)1.58313e-05,
-    (float)1.41766e-05,
-    (float)1.35135e-05,
-    (float)1.82937e-05,
-    (float)1.36026e-05,
-    (float)1.33094e-05,
-    (float)1.34482e-05,
-    (float)1.53324e-05,
-    (float)1.35488e-05,
-    (float)1.38931e-05,
-    (float)1.28712e-05,
-    (float)1.11657e-05,
-    (float)1.39294e-05,
-    (float)1.28343e-05,
-    (float)1.10369e-05,
-    (float)9.38029e-06,
-    (float)1.24059e-05,
-    (float)1.07333e-05,
-    (float)1.04678e-05,
-    (float)1.02799e-05,
-    (float)9.8853e-06,
-    (float)1.03449e-05,
-    (float)1.15171e-05,
-    (float)1.13454e-05,
-    (float)8.79628e-06,
-    (float)1.0957e-05,
-    (float)1.12767e-05,
-    (float)1.06805e-05,
-    (float)9.22098e-06,
-    (float)9.96008e-06,
-    (float)9.26428e-06,
-    (float)9.59038e-06,
-    (float)1.00962e-05,
-    (float)8.48666e-06,
-    (float)8.62956e-06,
-    (float)9.79256e-06,
-    (float)1.06837e-05,
-    (float)8.87712e-06,
-    (float)9.73518e-06,
-    (float)9.89862e-06,
-    (float)1.01662e-05,
-    (float)9.98396e-06,
-    (float)9.7261e-06,
-    (float)8.76805e-06,
-    (float)9.0143e-06,
-    (float)1.0045e-05,
-    (float)8.72996e-06,
-    (float)8.41276e-06,
-    (float)8.76941e-06,
-    (float)9.65674e-06,
-    (float)9.09004e-06,
-    (float)9.59873e-06,
-    (float)9.16005e-06,
-    (float)9.40072e-06,
-    (float)1.00987e-05,
-    (float)9.95498e-06,
-    (float)8.948e-06,
-    (float)8.88726e-06,
-    (float)9.73924e-06,
-    (float)8.9813e-06,
-    (float)8.85491e-06,
-    (float)8.52013e-06,
-    (float)0.176898,
-    (float)0.781225,
-    (float)0.0131541,
-    (float)0.00676255,
-    (float)0.00457962,
-    (float)0.0125714,
-    (float)0.000490559,
-    (float)0.000333655,
-    (float)0.000264846,
-    (float)0.0007918,
-    (float)0.000201162,
-    (float)2.39523e-05,
-    (float)1.76478e-05,
-    (float)3.32425e-06,
-    (float)0.00038185,
-    (float)0.000118635,
-    (float)9.79757e-05,
-    (float)7.15351e-05,
-    (float)0.000237256,
-    (float)8.04544e-05,
-    (float)6.5154e-05,
-    (float)5.40925e-05,
-    (float)4.71187e-05,
-    (float)4.0238e-05,
-    (float)3.16414e-05,
-    (float)3.21969e-05,
-    (float)7.02902e-06,
-    (float)5.32561e-05,
-    (float)4.26852e-05,
-    (float)4.52443e-05,
-    (float)4.33526e-05,
-    (float)5.50853e-05,
-    (float)4.85474e-05,
-    (float)4.61154e-05,
-    (float)5.08164e-05,
-    (float)2.78633e-05,
-    (float)3.53496e-05,
-    (float)3.03435e-05,
-    (float)3.2265e-05,
-    (float)1.41252e-05,
-    (float)2.66271e-05,
-    (float)2.35966e-05,
-    (float)2.41807e-05,
-    (float)2.49473e-05,
-    (float)2.47547e-05,
-    (float)2.55892e-05,
-    (float)2.51925e-05,
-    (float)3.18125e-05,
-    (float)1.88428e-05,
-    (float)2.31154e-05,
-    (float)2.14427e-05,
-    (float)2.34242e-05,
-    (float)1.33687e-05,
-    (float)1.69422e-05,
-    (float)1.53736e-05,
-    (float)1.41745e-05,
-    (float)1.52483e-05,
-    (float)1.29375e-05,
-    (float)1.29378e-05,
-    (float)1.2336e-05,
-    (float)1.79879e-05,
-    (float)1.10571e-05,
-    (float)1.2415e-05,
-    (float)1.25335e-05,
-    (float)1.45718e-05,
-    (float)1.02734e-05,
-    (float)1.08681e-05,
-    (float)1.04051e-05,
-    (float)8.63195e-06,
-    (float)1.05755e-05,
-    (float)8.59109e-06,
-    (float)7.75091e-06,
-    (float)6.24706e-06,
-    (float)1.02937e-05,
-    (float)7.21309e-06,
-    (float)7.06753e-06,
-    (float)7.37775e-06,
-    (float)8.17971e-06,
-    (float)7.4498e-06,
-    (float)7.71265e-06,
-    (float)8.15763e-06,
-    (float)5.67101e-06,
-    (float)7.93389e-06,
-    (float)7.37362e-06,
-    (float)6.82623e-06,
-    (float)4.85637e-06,
-    (float)6.99604e-06,
-    (float)5.95805e-06,
-    (float)5.44119e-06,
-    (float)6.06635e-06,
-    (float)5.43124e-06,
-    (float)5.59869e-06,
-    (float)5.91871e-06,
-    (float)7.43874e-06,
-    (float)4.99322e-06,
-    (float)6.41723e-06,
-    (float)6.71266e-06,
-    (float)6.89123e-06,
-    (float)5.58771e-06,
-    (float)6.29501e-06,
-    (float)5.98336e-06,
-    (float)5.18438e-06,
-    (float)6.26039e-06,
-    (float)5.18789e-06,
-    (float)5.13601e-06,
-    (float)4.93913e-06,
-    (float)6.64992e-06,
-    (float)5.12658e-06,
-    (float)5.74812e-06,
-    (float)6.18749e-06,
-    (float)6.32647e-06,
-    (float)6.19193e-06,
-    (float)6.38246e-06,
-    (float)6.4944e-06,
-    (float)5.28665e-06,
-    (float)6.60886e-06,
-    (float)5.69866e-06,
-    (float)5.54232e-06,
-    (float)4.9052e-06,
-    (float)6.02379e-06,
-    (float)5.18002e-06,
-    (float)5.36313e-06,
-    (float)5.92709e-06,
-    (float)5.49649e-06,
-    (float)6.04491e-06,
-    (float)6.17193e-06,
-    (float)6.75416e-06,
-    (float)5.3827e-06,
-    (float)0.143986,
-    (float)0.816876,
-    (float)0.012008,
-    (float)0.00603071,
-    (float)0.00403118,
-    (float)0.0123464,
-    (float)0.00084209,
-    (float)0.000507623,
-    (float)0.000387119,
-    (float)0.0010344,
-    (float)0.000206661,
-    (float)4.87855e-05,
-    (float)3.1336e-05,
-    (float)5.90892e-05,
-    (float)0.000245383,
-    (float)7.01179e-05,
-    (float)5.54319e-05,
-    (float)4.07403e-05,
-    (float)0.000169337,
-    (float)5.29488e-05,
-    (float)4.16691e-05,
-    (float)3.40141e-05,
-    (float)4.60268e-05,
-    (float)2.06639e-05,
-    (float)1.51305e-05,
-    (float)1.52176e-05,
-    (float)6.8128e-08,
-    (float)2.21586e-05,
-    (float)1.80125e-05,
-    (float)2.11647e-05,
-    (float)1.905e-05,
-    (float)3.19225e-05,
-    (float)2.86333e-05,
-    (float)2.90519e-05,
-    (float)3.41255e-05,
-    (float)2.25247e-05,
-    (float)2.49653e-05,
-    (float)2.21232e-05,
-    (float)2.50614e-05,
-    (float)8.39433e-06,
-    (float)1.60965e-05,
-    (float)1.3339e-05,
-    (float)1.41223e-05,
-    (float)8.92921e-06,
-    (float)1.31604e-05,
-    (float)1.26786e-05,
-    (float)1.3034e-05,
-    (float)1.69569e-05,
-    (float)1.20985e-05,
-    (float)1.39303e-05,
-    (float)1.36854e-05,
-    (float)1.75387e-05,
-    (float)8.68127e-06,
-    (float)1.14235e-05,
-    (float)1.05404e-05,
-    (float)1.10994e-05,
-    (float)6.68801e-06,
-    (float)7.74087e-06,
-    (float)7.02412e-06,
-    (float)6.37654e-06,
-    (float)8.11717e-06,
-    (float)5.83407e-06,
-    (float)5.87526e-06,
-    (float)5.75442e-06,
-    (float)9.08578e-06,
-    (float)5.23472e-06,
-    (float)5.75736e-06,
-    (float)5.86137e-06,
-    (float)6.98621e-06,
-    (float)5.05353e-06,
-    (float)5.10353e-06,
-    (float)4.75181e-06,
-    (float)3.89445e-06,
-    (float)4.98304e-06,
-    (float)3.98177e-06,
-    (float)3.38946e-06,
-    (float)2.53998e-06,
-    (float)4.5526e-06,
-    (float)3.259e-06,
-    (float)3.07407e-06,
-    (float)3.0786e-06,
-    (float)3.66911e-06,
-    (float)3.40195e-06,
-    (float)3.61064e-06,
-    (float)3.83063e-06,
-    (float)2.79774e-06,
-    (float)3.72292e-06,
-    (float)3.71075e-06,
-    (float)3.53096e-06,
-    (float)2.34138e-06,
-    (float)3.32653e-06,
-    (float)2.98631e-06,
-    (float)2.72505e-06,
-    (float)2.56925e-06,
-    (float)2.63789e-06,
-    (float)2.57067e-06,
-    (float)2.71557e-06,
-    (float)3.36827e-06,
-    (float)2.60816e-06,
-    (float)3.06289e-06,
-    (float)3.367e-06,
-    (float)3.82706e-06,
-    (float)3.00355e-06,
-    (float)3.44489e-06,
-    (float)3.42085e-06,
-    (float)3.30083e-06,
-    (float)3.08319e-06,
-    (float)3.02845e-06,
-    (float)2.82151e-06,
-    (float)2.62058e-06,
-    (float)3.06948e-06,
-    (float)2.67382e-06,
-    (float)2.75007e-06,
-    (float)2.85969e-06,
-    (float)3.41405e-06,
-    (float)3.06644e-06,
-    (float)3.3842e-06,
-    (float)3.5321e-06,
-    (float)3.62155e-06,
-    (float)3.50389e-06,
-    (float)3.60922e-06,
-    (float)3.48941e-06,
-    (float)3.18383e-06,
-    (float)3.3309e-06,
-    (float)3.06857e-06,
-    (float)2.92109e-06,
-    (float)2.74441e-06,
-    (float)3.09014e-06,
-    (float)0.114236,
-    (float)0.848304,
-    (float)0.0108463,
-    (float)0.00538406,
-    (float)0.00355804,
-    (float)0.0120097,
-    (float)0.00122099,
-    (float)0.000742709,
-    (float)0.000567872,
-    (float)0.00130586,
-    (float)0.000326296,
-    (float)0.000159262,
-    (float)0.000120779,
-    (float)0.000195709,
-    (float)0.000187399,
-    (float)7.01924e-05,
-    (float)5.42885e-05,
-    (float)5.53758e-05,
-    (float)0.000110856,
-    (float)3.68464e-05,
-    (float)2.81105e-05,
-    (float)2.55658e-05,
-    (float)3.69054e-05,
-    (float)1.16882e-05,
-    (float)7.59073e-06,
-    (float)8.25824e-06,
-    (float)3.03616e-06,
-    (float)7.2985e-06,
-    (float)5.59903e-06,
-    (float)8.16781e-06,
-    (float)8.8881e-06,
-    (float)1.41328e-05,
-    (float)1.36287e-05,
-    (float)1.48954e-05,
-    (float)2.09688e-05,
-    (float)1.38902e-05,
-    (float)1.57781e-05,
-    (float)1.44035e-05,
-    (float)1.91869e-05,
-    (float)6.07139e-06,
-    (float)1.07578e-05,
-    (float)8.37646e-06,
-    (float)1.01555e-05,
-    (float)2.2589e-06,
-    (float)6.37328e-06,
-    (float)5.17199e-06,
-    (float)5.52989e-06,
-    (float)5.90462e-06,
-    (float)5.18583e-06,
-    (float)5.90015e-06,
-    (float)5.83931e-06,
-    (float)9.76174e-06,
-    (float)4.31898e-06,
-    (float)6.24964e-06,
-    (float)5.86335e-06,
-    (float)8.49943e-06,
-    (float)2.92948e-06,
-    (float)4.56049e-06,
-    (float)4.07654e-06,
-    (float)4.49726e-06,
-    (float)2.74392e-06,
-    (float)2.59173e-06,
-    (float)2.41536e-06,
-    (float)1.98827e-06,
-    (float)3.74542e-06,
-    (float)1.6903e-06,
-    (float)1.90524e-06,
-    (float)1.66779e-06,
-    (float)3.97203e-06,
-    (float)1.67023e-06,
-    (float)1.88813e-06,
-    (float)1.88009e-06,
-    (float)2.67952e-06,
-    (float)1.96065e-06,
-    (float)1.66465e-06,
-    (float)1.60218e-06,
-    (float)1.08609e-06,
-    (float)2.06241e-06,
-    (float)1.2257e-06,
-    (float)1.07129e-06,
-    (float)4.55756e-07,
-    (float)1.66389e-06,
-    (float)9.78522e-07,
-    (float)8.7702e-07,
-    (float)8.51593e-07,
-    (float)1.01153e-06,
-    (float)1.18675e-06,
-    (float)1.13494e-06,
-    (float)1.47473e-06,
-    (float)6.42329e-07,
-    (float)1.49759e-06,
-    (float)1.36634e-06,
-    (float)1.56689e-06,
-    (float)7.07655e-07,
-    (float)1.32155e-06,
-    (float)1.20234e-06,
-    (float)1.13582e-06,
-    (float)1.00881e-06,
-    (float)7.85227e-07,
-    (float)9.67896e-07,
-    (float)8.6206e-07,
-    (float)1.39827e-06,
-    (float)6.59046e-07,
-    (float)1.11318e-06,
-    (float)1.13448e-06,
-    (float)1.69784e-06,
-    (float)1.18644e-06,
-    (float)1.39389e-06,
-    (float)1.51796e-06,
-    (float)1.62151e-06,
-    (float)1.71474e-06,
-    (float)1.29038e-06,
-    (float)1.4829e-06,
-    (float)1.20939e-06,
-    (float)1.70351e-06,
-    (float)9.7646e-07,
-    (float)1.19888e-06,
-    (float)9.76617e-07,
-    (float)1.42209e-06,
-    (float)1.11018e-06,
-    (float)1.15361e-06,
-    (float)1.25938e-06,
-    (float)1.35239e-06,
-    (float)1.73759e-06,
-    (float)1.35807e-06,
-    (float)1.69566e-06,
-    (float)1.44256e-06,
-    (float)2.10851e-06,
-    (float)0.0881049,
-    (float)0.875287,
-    (float)0.00966437,
-    (float)0.00480423,
-    (float)0.00315756,
-    (float)0.0115445,
-    (float)0.00157955,
-    (float)0.00100162,
-    (float)0.00078078,
-    (float)0.00156147,
-    (float)0.000527119,
-    (float)0.000337074,
-    (float)0.000273464,
-    (float)0.000395076,
-    (float)0.000211947,
-    (float)0.000126968,
-    (float)0.000103132,
-    (float)0.000125581,
-    (float)8.01118e-05,
-    (float)4.22715e-05,
-    (float)3.30078e-05,
-    (float)3.76601e-05,
-    (float)2.18884e-05,
-    (float)9.0765e-06,
-    (float)6.15057e-06,
-    (float)7.90427e-06,
-    (float)5.38893e-06,
-    (float)2.41632e-06,
-    (float)2.16148e-06,
-    (float)3.64876e-06,
-    (float)9.42429e-06,
-    (float)5.53828e-06,
-    (float)6.3349e-06,
-    (float)7.2926e-06,
-    (float)1.53459e-05,
-    (float)6.8367e-06,
-    (float)8.4558e-06,
-    (float)8.43855e-06,
-    (float)1.41144e-05,
-    (float)3.85206e-06,
-    (float)6.31347e-06,
-    (float)5.62122e-06,
-    (float)7.92896e-06,
-    (float)7.57104e-07,
-    (float)3.13003e-06,
-    (float)2.44976e-06,
-    (float)2.86963e-06,
-    (float)9.11986e-07,
-    (float)1.55034e-06,
-    (float)1.32897e-06,
-    (float)1.41612e-06,
-    (float)3.09752e-06,
-    (float)1.22674e-06,
-    (float)1.52034e-06,
-    (float)1.8018e-06,
-    (float)4.21198e-06,
-    (float)9.21757e-07,
-    (float)1.50595e-06,
-    (float)1.80497e-06,
-    (float)3.2087e-06,
-    (float)5.46278e-07,
-    (float)9.86531e-07,
-    (float)1.06815e-06,
-    (float)1.42461e-06,
-    (float)6.05025e-07,
-    (float)4.71468e-07,
-    (float)3.42337e-07,
-    (float)3.14707e-07,
-    (float)9.70975e-07,
-    (float)2.38745e-07,
-    (float)8.8517e-08,
-    (float)8.24797e-08,
-    (float)1.05192e-06,
-    (float)2.0981e-07,
-    (float)1.84589e-07,
-    (float)1.71188e-07,
-    (float)6.68954e-07,
-    (float)2.62531e-07,
-    (float)3.1401e-07,
-    (float)1.69442e-07,
-    (float)1.96699e-07,
-    (float)2.91226e-07,
-    (float)2.7957e-07,
-    (float)7.41432e-08,
-    (float)1.67027e-08,
-    (float)2.07718e-07,
-    (float)1.22503e-07,
-    (float)6.34464e-08,
-    (float)1.57902e-07,
-    (float)6.28768e-08,
-    (float)4.03676e-08,
-    (float)2.04241e-07,
-    (float)3.85958e-07,
-    (float)1.65927e-08,
-    (float)1.20972e-07,
-    (float)3.41902e-07,
-    (float)4.57291e-07,
-    (float)1.23228e-07,
-    (float)2.18763e-07,
-    (float)2.89203e-07,
-    (float)3.22963e-07,
-    (float)2.75818e-07,
-    (float)1.87875e-07,
-    (float)1.0841e-07,
-    (float)1.58565e-07,
-    (float)3.75357e-07,
-    (float)1.23192e-07,
-    (float)6.98393e-08,
-    (float)1.55681e-07,
-    (float)4.24305e-07,
-    (float)2.19145e-07,
-    (float)2.86958e-07,
-    (float)2.86648e-07,
-    (float)4.40559e-07,
-    (float)4.60897e-07,
-    (float)5.39242e-07,
-    (float)3.58615e-07,
-    (float)3.99394e-07,
-    (float)6.16703e-07,
-    (float)5.53348e-07,
-    (float)2.91732e-07,
-    (float)2.99025e-07,
-    (float)5.34943e-07,
-    (float)3.58197e-07,
-    (float)2.2924e-07,
-    (float)2.09247e-07,
-    (float)3.30225e-07,
-    (float)2.37808e-07,
-    (float)0.0657345,
-    (float)0.897863,
-    (float)0.00848092,
-    (float)0.00427685,
-    (float)0.00280906,
-    (float)0.0109771,
-    (float)0.00188516,
-    (float)0.00125123,
-    (float)0.000992173,
-    (float)0.00177179,
-    (float)0.000776808,
-    (float)0.000556368,
-    (float)0.000465134,
-    (float)0.000632933,
-    (float)0.000316784,
-    (float)0.000238581,
-    (float)0.000200485,
-    (float)0.00025393,
-    (float)9.73795e-05,
-    (float)8.04689e-05,
-    (float)6.51588e-05,
-    (float)8.34879e-05,
-    (float)1.4516e-05,
-    (float)1.7257e-05,
-    (float)1.23786e-05,
-    (float)1.82249e-05,
-    (float)2.57008e-06,
-    (float)3.19504e-06,
-    (float)2.67736e-06,
-    (float)4.04852e-06,
-    (float)1.23082e-05,
-    (float)4.49269e-06,
-    (float)5.62722e-06,
-    (float)5.1944e-06,
-    (float)1.76562e-05,
-    (float)4.88444e-06,
-    (float)6.72246e-06,
-    (float)5.61565e-06,
-    (float)1.40475e-05,
-    (float)2.45027e-06,
-    (float)4.43077e-06,
-    (float)3.39963e-06,
-    (float)7.19142e-06,
-    (float)3.5668e-07,
-    (float)1.75506e-06,
-    (float)1.15158e-06,
-    (float)2.29954e-06,
-    (float)1.07276e-07,
-    (float)3.94181e-07,
-    (float)1.75135e-07,
-    (float)3.63245e-07,
-    (float)7.62568e-07,
-    (float)4.81594e-08,
-    (float)2.48324e-08,
-    (float)7.03167e-09,
-    (float)1.14674e-06,
-    (float)8.77357e-09,
-    (float)4.59274e-08,
-    (float)2.79075e-08,
-    (float)1.09872e-06,
-    (float)1.07847e-08,
-    (float)5.90645e-08,
-    (float)7.83308e-08,
-    (float)9.83663e-07,
-    (float)2.47573e-08,
-    (float)9.52311e-08,
-    (float)1.6049e-07,
-    (float)9.39978e-07,
-    (float)1.42814e-08,
-    (float)1.40868e-07,
-    (float)2.3988e-07,
-    (float)8.31059e-07,
-    (float)3.01902e-09,
-    (float)1.65381e-07,
-    (float)2.54882e-07,
-    (float)5.70959e-07,
-    (float)9.39504e-08,
-    (float)1.64187e-07,
-    (float)1.96477e-07,
-    (float)2.55768e-07,
-    (float)3.17187e-07,
-    (float)1.3571e-07,
-    (float)1.10351e-07,
-    (float)4.7616e-08,
-    (float)5.54415e-07,
-    (float)9.23803e-08,
-    (float)6.59625e-08,
-    (float)2.94065e-08,
-    (float)6.51154e-07,
-    (float)8.08775e-08,
-    (float)1.04142e-07,
-    (float)1.48654e-07,
-    (float)5.53841e-07,
-    (float)1.33681e-07,
-    (float)1.85815e-07,
-    (float)2.63858e-07,
-    (float)3.32463e-07,
-    (float)2.12833e-07,
-    (float)2.19641e-07,
-    (float)2.63651e-07,
-    (float)1.15484e-07,
-    (float)2.43863e-07,
-    (float)1.62534e-07,
-    (float)1.59031e-07,
-    (float)7.07079e-09,
-    (float)1.97825e-07,
-    (float)6.76534e-08,
-    (float)5.04657e-08,
-    (float)2.51329e-08,
-    (float)1.1214e-07,
-    (float)1.59847e-08,
-    (float)1.08983e-08,
-    (float)9.8817e-08,
-    (float)4.03302e-08,
-    (float)2.62057e-08,
-    (float)2.48072e-08,
-    (float)1.38823e-07,
-    (float)6.10971e-09,
-    (float)5.34981e-08,
-    (float)3.73566e-08,
-    (float)1.17038e-07,
-    (float)1.2995e-09,
-    (float)5.91812e-08,
-    (float)2.82877e-08,
-    (float)7.36143e-08,
-    (float)6.03284e-09,
-    (float)5.45592e-08,
-    (float)1.96199e-08,
-    (float)0.0472596,
-    (float)0.916153,
-    (float)0.00727149,
-    (float)0.00379214,
-    (float)0.00252817,
-    (float)0.010316,
-    (float)0.00209324,
-    (float)0.00146684,
-    (float)0.00119216,
-    (float)0.00190239,
-    (float)0.00102769,
-    (float)0.000792091,
-    (float)0.000679807,
-    (float)0.000870712,
-    (float)0.000479556,
-    (float)0.000397646,
-    (float)0.000343678,
-    (float)0.00042537,
-    (float)0.000171242,
-    (float)0.000160881,
-    (float)0.000135334,
-    (float)0.000169163,
-    (float)3.29369e-05,
-    (float)4.61184e-05,
-    (float)3.59831e-05,
-    (float)4.73607e-05,
-    (float)3.68675e-07,
-    (float)9.47489e-06,
-    (float)7.14724e-06,
-    (float)9.54655e-06,
-    (float)1.01374e-05,
-    (float)5.95998e-06,
-    (float)6.82621e-06,
-    (float)6.05293e-06,
-    (float)2.03896e-05,
-    (float)7.02291e-06,
-    (float)8.75788e-06,
-    (float)7.05617e-06,
-    (float)1.82337e-05,
-    (float)4.48685e-06,
-    (float)6.07388e-06,
-    (float)4.57518e-06,
-    (float)9.39841e-06,
-    (float)1.24259e-06,
-    (float)2.09399e-06,
-    (float)1.3289e-06,
-    (float)2.45e-06,
-    (float)3.0479e-07,
-    (float)1.54189e-07,
-    (float)3.17747e-08,
-    (float)1.603e-07,
-    (float)9.40689e-07,
-    (float)1.5591e-07,
-    (float)2.74544e-07,
-    (float)4.27718e-07,
-    (float)1.1298e-06,
-    (float)5.63293e-07,
-    (float)6.27168e-07,
-    (float)7.89611e-07,
-    (float)4.58742e-07,
-    (float)6.82047e-07,
-    (float)6.27059e-07,
-    (float)6.71081e-07,
-    (float)3.74292e-09,
-    (float)7.19687e-07,
-    (float)6.12046e-07,
-    (float)6.03243e-07,
-    (float)5.17098e-07,
-    (float)8.41599e-07,
-    (float)7.93626e-07,
-    (float)8.72542e-07,
-    (float)1.58033e-06,
-    (float)9.0934e-07,
-    (float)1.0365e-06,
-    (float)1.25284e-06,
-    (float)2.30055e-06,
-    (float)8.64706e-07,
-    (float)1.1902e-06,
-    (float)1.45286e-06,
-    (float)2.25651e-06,
-    (float)8.74875e-07,
-    (float)1.24443e-06,
-    (float)1.39867e-06,
-    (float)1.68077e-06,
-    (float)1.05953e-06,
-    (float)1.21892e-06,
-    (float)1.18432e-06,
-    (float)1.05454e-06,
-    (float)1.30656e-06,
-    (float)1.1149e-06,
-    (float)9.58828e-07,
-    (float)7.14371e-07,
-    (float)1.41857e-06,
-    (float)9.78693e-07,
-    (float)8.45899e-07,
-    (float)7.11489e-07,
-    (float)1.31805e-06,
-    (float)8.86162e-07,
-    (float)8.57872e-07,
-    (float)8.623e-07,
-    (float)1.06259e-06,
-    (float)8.42068e-07,
-    (float)8.76689e-07,
-    (float)9.1867e-07,
-    (float)7.50793e-07,
-    (float)7.70048e-07,
-    (float)7.74469e-07,
-    (float)7.67533e-07,
-    (float)4.73443e-07,
-    (float)6.21116e-07,
-    (float)5.54266e-07,
-    (float)5.01552e-07,
-    (float)3.02982e-07,
-    (float)4.4002e-07,
-    (float)3.40386e-07,
-    (float)2.97445e-07,
-    (float)2.62251e-07,
-    (float)3.06534e-07,
-    (float)2.42505e-07,
-    (float)2.42185e-07,
-    (float)3.02446e-07,
-    (float)2.49726e-07,
-    (float)2.62149e-07,
-    (float)2.82935e-07,
-    (float)3.39395e-07,
-    (float)2.39667e-07,
-    (float)3.20201e-07,
-    (float)3.13271e-07,
-    (float)0.0324412,
-    (float)0.93045,
-    (float)0.00608484,
-    (float)0.0033359,
-    (float)0.0022943,
-    (float)0.00964403,
-    (float)0.00220132,
-    (float)0.00162398,
-    (float)0.00135692,
-    (float)0.00195722,
-    (float)0.00125123,
-    (float)0.00101324,
-    (float)0.000888862,
-    (float)0.00108819,
-    (float)0.000675207,
-    (float)0.000584743,
-    (float)0.000515008,
-    (float)0.000628725,
-    (float)0.000298763,
-    (float)0.000284282,
-    (float)0.00024397,
-    (float)0.000302372,
-    (float)9.21493e-05,
-    (float)0.000108093,
-    (float)8.70788e-05,
-    (float)0.000110575,
-    (float)1.40198e-05,
-    (float)3.04259e-05,
-    (float)2.22089e-05,
-    (float)2.83935e-05,
-    (float)6.70655e-06,
-    (float)9.60604e-06,
-    (float)8.65164e-06,
-    (float)8.08038e-06,
-    (float)1.90341e-05,
-    (float)8.64369e-06,
-    (float)1.0611e-05,
-    (float)8.07464e-06,
-    (float)2.35007e-05,
-    (float)8.11144e-06,
-    (float)1.02656e-05,
-    (float)7.7492e-06,
-    (float)1.65732e-05,
-    (float)4.8184e-06,
-    (float)5.83445e-06,
-    (float)4.22259e-06,
-    (float)6.56487e-06,
-    (float)2.14478e-06,
-    (float)1.71668e-06,
-    (float)1.18626e-06,
-    (float)7.91729e-07,
-    (float)1.88147e-06,
-    (float)5.29273e-07,
-    (float)6.84459e-07,
-    (float)2.99225e-07,
-    (float)2.60373e-06,
-    (float)1.44271e-06,
-    (float)1.70201e-06,
-    (float)2.06712e-06,
-    (float)2.45086e-06,
-    (float)2.55062e-06,
-    (float)2.55775e-06,
-    (float)3.30106e-06,
-    (float)1.4267e-06,
-    (float)2.98107e-06,
-    (float)2.7373e-06,
-    (float)3.36952e-06,
-    (float)9.10797e-07,
-    (float)2.9459e-06,
-    (float)2.68921e-06,
-    (float)3.00243e-06,
-    (float)1.78173e-06,
-    (float)2.80845e-06,
-    (float)2.82198e-06,
-    (float)2.85122e-06,
-    (float)3.51166e-06,
-    (float)2.65559e-06,
-    (float)3.09131e-06,
-    (float)2.96976e-06,
-    (float)4.86013e-06,
-    (float)2.52226e-06,
-    (float)3.26129e-06,
-    (float)3.12151e-06,
-    (float)5.0408e-06,
-    (float)2.5622e-06,
-    (float)3.20457e-06,
-    (float)3.13821e-06,
-    (float)4.18534e-06,
-    (float)2.85742e-06,
-    (float)2.93776e-06,
-    (float)2.98964e-06,
-    (float)2.97927e-06,
-    (float)3.21908e-06,
-    (float)2.55396e-06,
-    (float)2.71791e-06,
-    (float)2.06227e-06,
-    (float)3.31161e-06,
-    (float)2.19483e-06,
-    (float)2.39292e-06,
-    (float)1.68467e-06,
-    (float)2.95641e-06,
-    (float)1.99565e-06,
-    (float)2.07625e-06,
-    (float)1.70658e-06,
-    (float)2.27343e-06,
-    (float)1.97083e-06,
-    (float)1.78435e-06,
-    (float)1.80818e-06,
-    (float)1.56092e-06,
-    (float)1.97103e-06,
-    (float)1.50672e-06,
-    (float)1.74412e-06,
-    (float)1.08066e-06,
-    (float)1.80641e-06,
-    (float)1.26792e-06,
-    (float)1.48406e-06,
-    (float)9.22286e-07,
-    (float)1.42581e-06,
-    (float)1.13199e-06,
-    (float)1.16291e-06,
-    (float)9.93467e-07,
-    (float)9.69553e-07,
-    (float)1.11943e-06,
-    (float)9.27235e-07,
-    (float)1.11259e-06,
-    (float)6.62542e-07,
-    (float)1.15021e-06,
-    (float)8.44799e-07,
-    (float)0.0210683,
-    (float)0.94118,
-    (float)0.00493518,
-    (float)0.00291395,
-    (float)0.00209932,
-    (float)0.00896837,
-    (float)0.00219809,
-    (float)0.00171598,
-    (float)0.00147357,
-    (float)0.00192227,
-    (float)0.00141582,
-    (float)0.00119594,
-    (float)0.00107086,
-    (float)0.00125219,
-    (float)0.00087174,
-    (float)0.000773408,
-    (float)0.000696642,
-    (float)0.000833115,
-    (float)0.000465848,
-    (float)0.000436776,
-    (float)0.000387837,
-    (float)0.000471245,
-    (float)0.00019992,
-    (float)0.000205725,
-    (float)0.000176533,
-    (float)0.000215028,
-    (float)6.1679e-05,
-    (float)7.68202e-05,
-    (float)6.21353e-05,
-    (float)7.41028e-05,
-    (float)1.46509e-05,
-    (float)2.32627e-05,
-    (float)1.80414e-05,
-    (float)1.8862e-05,
-    (float)1.33141e-05,
-    (float)1.01486e-05,
-    (float)9.74487e-06,
-    (float)7.76368e-06,
-    (float)2.14784e-05,
-    (float)9.93662e-06,
-    (float)1.09631e-05,
-    (float)9.09755e-06,
-    (float)2.19317e-05,
-    (float)9.35375e-06,
-    (float)9.99676e-06,
-    (float)8.63166e-06,
-    (float)1.42331e-05,
-    (float)6.67521e-06,
-    (float)6.35152e-06,
-    (float)5.29061e-06,
-    (float)5.37405e-06,
-    (float)4.47711e-06,
-    (float)3.33357e-06,
-    (float)2.53296e-06,
-    (float)9.21768e-07,
-    (float)4.09231e-06,
-    (float)2.70467e-06,
-    (float)2.32578e-06,
-    (float)1.49699e-06,
-    (float)4.54419e-06,
-    (float)3.71003e-06,
-    (float)3.94785e-06,
-    (float)4.35743e-06,
-    (float)4.44237e-06,
-    (float)4.81556e-06,
-    (float)5.69011e-06,
-    (float)6.66472e-06,
-    (float)3.69334e-06,
-    (float)5.31093e-06,
-    (float)6.53717e-06,
-    (float)7.35915e-06,
-    (float)3.34772e-06,
-    (float)5.43093e-06,
-    (float)6.49358e-06,
-    (float)6.93834e-06,
-    (float)4.25322e-06,
-    (float)5.57721e-06,
-    (float)6.0159e-06,
-    (float)6.28863e-06,
-    (float)6.12263e-06,
-    (float)5.78384e-06,
-    (float)5.48997e-06,
-    (float)5.86652e-06,
-    (float)7.80423e-06,
-    (float)5.83341e-06,
-    (float)5.10654e-06,
-    (float)5.62259e-06,
-    (float)8.25939e-06,
-    (float)5.61485e-06,
-    (float)4.92141e-06,
-    (float)5.32004e-06,
-    (float)7.28701e-06,
-    (float)5.23942e-06,
-    (float)4.87747e-06,
-    (float)4.82244e-06,
-    (float)5.51177e-06,
-    (float)4.87508e-06,
-    (float)4.81826e-06,
-    (float)4.19265e-06,
-    (float)3.84232e-06,
-    (float)4.56654e-06,
-    (float)4.58227e-06,
-    (float)3.62929e-06,
-    (float)2.8903e-06,
-    (float)4.22345e-06,
-    (float)4.12264e-06,
-    (float)3.30741e-06,
-    (float)2.70014e-06,
-    (float)3.7326e-06,
-    (float)3.52712e-06,
-    (float)3.22367e-06,
-    (float)2.86628e-06,
-    (float)3.07054e-06,
-    (float)2.92847e-06,
-    (float)3.17688e-06,
-    (float)2.90275e-06,
-    (float)2.35204e-06,
-    (float)2.41852e-06,
-    (float)2.93209e-06,
-    (float)2.6088e-06,
-    (float)1.80011e-06,
-    (float)2.04388e-06,
-    (float)2.43984e-06,
-    (float)2.17767e-06,
-    (float)1.63196e-06,
-    (float)1.84134e-06,
-    (float)1.9045e-06,
-    (float)1.97433e-06,
-    (float)0.0127895,
-    (float)0.948797,
-    (float)0.00387818,
-    (float)0.00251179,
-    (float)0.00194029,
-    (float)0.0083223,
-    (float)0.00210746,
-    (float)0.00172973,
-    (float)0.00153655,
-    (float)0.00180404,
-    (float)0.00151326,
-    (float)0.00131797,
-    (float)0.00120246,
-    (float)0.00134377,
-    (float)0.00104292,
-    (float)0.000939369,
-    (float)0.000855155,
-    (float)0.00101001,
-    (float)0.000647728,
-    (float)0.00060289,
-    (float)0.000538752,
-    (float)0.000656128,
-    (float)0.000347681,
-    (float)0.000338811,
-    (float)0.000292663,
-    (float)0.000359443,
-    (float)0.000153307,
-    (float)0.000161167,
-    (float)0.000132037,
-    (float)0.000159889,
-    (float)5.28006e-05,
-    (float)6.24938e-05,
-    (float)4.76795e-05,
-    (float)5.38984e-05,
-    (float)1.75866e-05,
-    (float)2.05393e-05,
-    (float)1.56097e-05,
-    (float)1.35061e-05,
-    (float)1.48941e-05,
-    (float)9.47289e-06,
-    (float)9.63516e-06,
-    (float)6.31832e-06,
-    (float)1.94398e-05,
-    (float)9.32085e-06,
-    (float)1.08311e-05,
-    (float)8.70263e-06,
-    (float)1.89975e-05,
-    (float)9.8394e-06,
-    (float)1.06486e-05,
-    (float)9.7438e-06,
-    (float)1.28278e-05,
-    (float)8.786e-06,
-    (float)8.35577e-06,
-    (float)8.06509e-06,
-    (float)5.77881e-06,
-    (float)7.48835e-06,
-    (float)6.19542e-06,
-    (float)6.07226e-06,
-    (float)2.32828e-06,
-    (float)7.13011e-06,
-    (float)5.69921e-06,
-    (float)5.63386e-06,
-    (float)3.56942e-06,
-    (float)7.50217e-06,
-    (float)6.63695e-06,
-    (float)6.73779e-06,
-    (float)7.55006e-06,
-    (float)7.74806e-06,
-    (float)7.89931e-06,
-    (float)8.29188e-06,
-    (float)1.13785e-05,
-    (float)7.49835e-06,
-    (float)8.69572e-06,
-    (float)9.35893e-06,
-    (float)1.31367e-05,
-    (float)7.18718e-06,
-    (float)8.97999e-06,
-    (float)9.70414e-06,
-    (float)1.25578e-05,
-    (float)7.48779e-06,
-    (float)9.09349e-06,
-    (float)9.58666e-06,
-    (float)1.05808e-05,
-    (float)8.5897e-06,
-    (float)9.24566e-06,
-    (float)9.31467e-06,
-    (float)8.4697e-06,
-    (float)9.98023e-06,
-    (float)9.33003e-06,
-    (float)8.99904e-06,
-    (float)7.10386e-06,
-    (float)1.08136e-05,
-    (float)9.09877e-06,
-    (float)8.57334e-06,
-    (float)6.68494e-06,
-    (float)1.04803e-05,
-    (float)8.41734e-06,
-    (float)7.92764e-06,
-    (float)6.83516e-06,
-    (float)8.95438e-06,
-    (float)7.37018e-06,
-    (float)7.02247e-06,
-    (float)6.94253e-06,
-    (float)6.764e-06,
-    (float)6.19565e-06,
-    (float)5.9443e-06,
-    (float)6.55976e-06,
-    (float)4.69132e-06,
-    (float)5.15165e-06,
-    (float)4.89592e-06,
-    (float)5.64892e-06,
-    (float)3.39655e-06,
-    (float)4.40014e-06,
-    (float)4.11047e-06,
-    (float)4.54201e-06,
-    (float)3.13099e-06,
-    (float)3.95004e-06,
-    (float)3.71693e-06,
-    (float)3.66828e-06,
-    (float)3.64867e-06,
-    (float)3.68173e-06,
-    (float)3.65184e-06,
-    (float)3.26228e-06,
-    (float)4.36204e-06,
-    (float)3.45819e-06,
-    (float)3.70896e-06,
-    (float)3.26507e-06,
-    (float)4.68158e-06,
-    (float)0.00728973,
-    (float)0.953757,
-    (float)0.00290473,
-    (float)0.00214258,
-    (float)0.00181792,
-    (float)0.00771632,
-    (float)0.0019218,
-    (float)0.00167729,
-    (float)0.00155333,
-    (float)0.00160973,
-    (float)0.00152068,
-    (float)0.00137425,
-    (float)0.00128482,
-    (float)0.00134715,
-    (float)0.00115552,
-    (float)0.0010627,
-    (float)0.000984593,
-    (float)0.00112553,
-    (float)0.000811641,
-    (float)0.000757962,
-    (float)0.000688992,
-    (float)0.000820369,
-    (float)0.000514906,
-    (float)0.000489908,
-    (float)0.000433195,
-    (float)0.000520063,
-    (float)0.000287405,
-    (float)0.00028062,
-    (float)0.00023905,
-    (float)0.000282372,
-    (float)0.000136377,
-    (float)0.00013791,
-    (float)0.000111779,
-    (float)0.000126169,
-    (float)5.33477e-05,
-    (float)5.55682e-05,
-    (float)4.23362e-05,
-    (float)4.28795e-05,
-    (float)1.92092e-05,
-    (float)1.80762e-05,
-    (float)1.3506e-05,
-    (float)1.02805e-05,
-    (float)1.19886e-05,
-    (float)7.2097e-06,
-    (float)6.98506e-06,
-    (float)4.5483e-06,
-    (float)1.38444e-05,
-    (float)7.74559e-06,
-    (float)8.71698e-06,
-    (float)7.92139e-06,
-    (float)1.47611e-05,
-    (float)1.03781e-05,
-    (float)1.09939e-05,
-    (float)1.11445e-05,
-    (float)1.22808e-05,
-    (float)1.15513e-05,
-    (float)1.15373e-05,
-    (float)1.18458e-05,
-    (float)8.47961e-06,
-    (float)1.13238e-05,
-    (float)1.10148e-05,
-    (float)1.11491e-05,
-    (float)6.32347e-06,
-    (float)1.09095e-05,
-    (float)1.06682e-05,
-    (float)1.06911e-05,
-    (float)7.22745e-06,
-    (float)1.1099e-05,
-    (float)1.10557e-05,
-    (float)1.11526e-05,
-    (float)1.05101e-05,
-    (float)1.18647e-05,
-    (float)1.19516e-05,
-    (float)1.22202e-05,
-    (float)1.42844e-05,
-    (float)1.27255e-05,
-    (float)1.28292e-05,
-    (float)1.32199e-05,
-    (float)1.67689e-05,
-    (float)1.32396e-05,
-    (float)1.33092e-05,
-    (float)1.36821e-05,
-    (float)1.7157e-05,
-    (float)1.32461e-05,
-    (float)1.3298e-05,
-    (float)1.35191e-05,
-    (float)1.57309e-05,
-    (float)1.2828e-05,
-    (float)1.28871e-05,
-    (float)1.28989e-05,
-    (float)1.34166e-05,
-    (float)1.21639e-05,
-    (float)1.22122e-05,
-    (float)1.20458e-05,
-    (float)1.11811e-05,
-    (float)1.14094e-05,
-    (float)1.13831e-05,
-    (float)1.1118e-05,
-    (float)9.60069e-06,
-    (float)1.06436e-05,
-    (float)1.04702e-05,
-    (float)1.01754e-05,
-    (float)8.73168e-06,
-    (float)9.85351e-06,
-    (float)9.49862e-06,
-    (float)9.19876e-06,
-    (float)8.24668e-06,
-    (float)8.95259e-06,
-    (float)8.44713e-06,
-    (float)8.13458e-06,
-    (float)7.71414e-06,
-    (float)7.84857e-06,
-    (float)7.28616e-06,
-    (float)6.96282e-06,
-    (float)6.87294e-06,
-    (float)6.54875e-06,
-    (float)6.05944e-06,
-    (float)5.7648e-06,
-    (float)5.77544e-06,
-    (float)5.23509e-06,
-    (float)4.94657e-06,
-    (float)4.74063e-06,
-    (float)4.73914e-06,
-    (float)4.23121e-06,
-    (float)4.22902e-06,
-    (float)4.14092e-06,
-    (float)4.14774e-06,
-    (float)3.85281e-06,
-    (float)0.00416774,
-    (float)0.95635,
-    (float)0.00206609,
-    (float)0.00180395,
-    (float)0.00173214,
-    (float)0.00722638,
-    (float)0.00168075,
-    (float)0.00156278,
-    (float)0.00152964,
-    (float)0.00137524,
-    (float)0.00145311,
-    (float)0.00135895,
-    (float)0.00131104,
-    (float)0.00127526,
-    (float)0.00119962,
-    (float)0.00112598,
-    (float)0.00106323,
-    (float)0.00117481,
-    (float)0.000929192,
-    (float)0.000877505,
-    (float)0.000807983,
-    (float)0.000948624,
-    (float)0.000667114,
-    (float)0.000636056,
-    (float)0.000569324,
-    (float)0.000681348,
-    (float)0.000437585,
-    (float)0.00042271,
-    (float)0.000366501,
-    (float)0.000435504,
-    (float)0.000257077,
-    (float)0.000252229,
-    (float)0.000210737,
-    (float)0.000243449,
-    (float)0.000131448,
-    (float)0.000130657,
-    (float)0.000104278,
-    (float)0.000114112,
-    (float)5.63073e-05,
-    (float)5.53623e-05,
-    (float)4.15844e-05,
-    (float)4.07915e-05,
-    (float)2.00579e-05,
-    (float)1.72516e-05,
-    (float)1.21274e-05,
-    (float)8.75788e-06,
-    (float)8.3391e-06,
-    (float)4.23673e-06,
-    (float)3.81957e-06,
-    (float)1.68609e-06,
-    (float)8.24908e-06,
-    (float)4.70393e-06,
-    (float)5.99124e-06,
-    (float)6.00774e-06,
-    (float)1.10263e-05,
-    (float)9.91036e-06,
-    (float)1.11597e-05,
-    (float)1.28407e-05,
-    (float)1.26541e-05,
-    (float)1.48301e-05,
-    (float)1.53854e-05,
-    (float)1.78786e-05,
-    (float)1.27377e-05,
-    (float)1.7645e-05,
-    (float)1.7541e-05,
-    (float)2.00919e-05,
-    (float)1.25789e-05,
-    (float)1.8517e-05,
-    (float)1.80984e-05,
-    (float)2.01498e-05,
-    (float)1.34441e-05,
-    (float)1.83383e-05,
-    (float)1.80026e-05,
-    (float)1.91828e-05,
-    (float)1.56462e-05,
-    (float)1.79059e-05,
-    (float)1.79607e-05,
-    (float)1.81005e-05,
-    (float)1.8521e-05,
-    (float)1.76134e-05,
-    (float)1.81923e-05,
-    (float)1.73698e-05,
-    (float)2.09604e-05,
-    (float)1.74962e-05,
-    (float)1.85064e-05,
-    (float)1.70471e-05,
-    (float)2.20378e-05,
-    (float)1.7402e-05,
-    (float)1.85224e-05,
-    (float)1.69061e-05,
-    (float)2.13853e-05,
-    (float)1.71312e-05,
-    (float)1.78996e-05,
-    (float)1.65944e-05,
-    (float)1.92302e-05,
-    (float)1.65112e-05,
-    (float)1.64995e-05,
-    (float)1.57991e-05,
-    (float)1.61896e-05,
-    (float)1.54352e-05,
-    (float)1.445e-05,
-    (float)1.43906e-05,
-    (float)1.29886e-05,
-    (float)1.38943e-05,
-    (float)1.21029e-05,
-    (float)1.24889e-05,
-    (float)1.02285e-05,
-    (float)1.19972e-05,
-    (float)9.90244e-06,
-    (float)1.04129e-05,
-    (float)8.25615e-06,
-    (float)9.95734e-06,
-    (float)8.2148e-06,
-    (float)8.53367e-06,
-    (float)7.13152e-06,
-    (float)8.03977e-06,
-    (float)7.19476e-06,
-    (float)7.11501e-06,
-    (float)6.67842e-06,
-    (float)6.49272e-06,
-    (float)6.75354e-06,
-    (float)6.23635e-06,
-    (float)6.59971e-06,
-    (float)5.49764e-06,
-    (float)6.64532e-06,
-    (float)5.837e-06,
-    (float)6.62602e-06,
-    (float)5.15559e-06,
-    (float)0.00304175,
-    (float)0.95701,
-    (float)0.00136125,
-    (float)0.00151145,
-    (float)0.00166167,
-    (float)0.0068524,
-    (float)0.00138983,
-    (float)0.00140675,
-    (float)0.0014604,
-    (float)0.00111685,
-    (float)0.00130979,
-    (float)0.00128049,
-    (float)0.00127756,
-    (float)0.00113272,
-    (float)0.00116639,
-    (float)0.00112095,
-    (float)0.00108293,
-    (float)0.00114342,
-    (float)0.000983336,
-    (float)0.000937367,
-    (float)0.000880935,
-    (float)0.00100987,
-    (float)0.000781914,
-    (float)0.000743393,
-    (float)0.0006821,
-    (float)0.00080499,
-    (float)0.000582449,
-    (float)0.000554028,
-    (float)0.000497718,
-    (float)0.000586342,
-    (float)0.000402344,
-    (float)0.000383178,
-    (float)0.000337539,
-    (float)0.00038909,
-    (float)0.000253846,
-    (float)0.000241409,
-    (float)0.000208291,
-    (float)0.000231307,
-    (float)0.000142756,
-    (float)0.000134381,
-    (float)0.000112821,
-    (float)0.000118613,
-    (float)6.85546e-05,
-    (float)6.24096e-05,
-    (float)4.99575e-05,
-    (float)4.81316e-05,
-    (float)2.58395e-05,
-    (float)2.12165e-05,
-    (float)1.51456e-05,
-    (float)1.1997e-05,
-    (float)6.54062e-06,
-    (float)3.59016e-06,
-    (float)1.66601e-06,
-    (float)3.09786e-07,
-    (float)2.20048e-06,
-    (float)1.37578e-06,
-    (float)2.10767e-06,
-    (float)3.37551e-06,
-    (float)5.69248e-06,
-    (float)7.21144e-06,
-    (float)9.69932e-06,
-    (float)1.31301e-05,
-    (float)1.20562e-05,
-    (float)1.56003e-05,
-    (float)1.92083e-05,
-    (float)2.38045e-05,
-    (float)1.84844e-05,
-    (float)2.32079e-05,
-    (float)2.7291e-05,
-    (float)3.19849e-05,
-    (float)2.37636e-05,
-    (float)2.85466e-05,
-    (float)3.23617e-05,
-    (float)3.62735e-05,
-    (float)2.75602e-05,
-    (float)3.13563e-05,
-    (float)3.41649e-05,
-    (float)3.67425e-05,
-    (float)2.98607e-05,
-    (float)3.19866e-05,
-    (float)3.32546e-05,
-    (float)3.43352e-05,
-    (float)3.06958e-05,
-    (float)3.0965e-05,
-    (float)3.05355e-05,
-    (float)3.0321e-05,
-    (float)3.01061e-05,
-    (float)2.87917e-05,
-    (float)2.69343e-05,
-    (float)2.58733e-05,
-    (float)2.82165e-05,
-    (float)2.58914e-05,
-    (float)2.32044e-05,
-    (float)2.18092e-05,
-    (float)2.52933e-05,
-    (float)2.26275e-05,
-    (float)1.98361e-05,
-    (float)1.85011e-05,
-    (float)2.17261e-05,
-    (float)1.93094e-05,
-    (float)1.70427e-05,
-    (float)1.59394e-05,
-    (float)1.79494e-05,
-    (float)1.6179e-05,
-    (float)1.48059e-05,
-    (float)1.38927e-05,
-    (float)1.43571e-05,
-    (float)1.33968e-05,
-    (float)1.29665e-05,
-    (float)1.20983e-05,
-    (float)1.12524e-05,
-    (float)1.10483e-05,
-    (float)1.13373e-05,
-    (float)1.0411e-05,
-    (float)8.83955e-06,
-    (float)9.17271e-06,
-    (float)9.80518e-06,
-    (float)8.86438e-06,
-    (float)7.23567e-06,
-    (float)7.79656e-06,
-    (float)8.38651e-06,
-    (float)7.63658e-06,
-    (float)6.47814e-06,
-    (float)6.95056e-06,
-    (float)7.22181e-06,
-    (float)6.94866e-06,
-    (float)6.51884e-06,
-    (float)6.66437e-06,
-    (float)0.00358062,
-    (float)0.955914,
-    (float)0.000825537,
-    (float)0.00124594,
-    (float)0.00161752,
-    (float)0.00662449,
-    (float)0.00108745,
-    (float)0.00120486,
-    (float)0.00136338,
-    (float)0.00086064,
-    (float)0.00111532,
-    (float)0.00113671,
-    (float)0.00119306,
-    (float)0.000935906,
-    (float)0.00106195,
-    (float)0.00104279,
-    (float)0.00103685,
-    (float)0.00103284,
-    (float)0.000959756,
-    (float)0.000926203,
-    (float)0.000883205,
-    (float)0.000987951,
-    (float)0.000826499,
-    (float)0.000792366,
-    (float)0.000731488,
-    (float)0.000859159,
-    (float)0.000677339,
-    (float)0.000648909,
-    (float)0.000584513,
-    (float)0.000694606,
-    (float)0.00052621,
-    (float)0.000504915,
-    (float)0.000446527,
-    (float)0.000525368,
-    (float)0.000385023,
-    (float)0.000369653,
-    (float)0.000322248,
-    (float)0.000370411,
-    (float)0.00026262,
-    (float)0.000251133,
-    (float)0.000216022,
-    (float)0.000240309,
-    (float)0.000164159,
-    (float)0.000154917,
-    (float)0.000131005,
-    (float)0.000139681,
-    (float)9.11681e-05,
-    (float)8.34689e-05,
-    (float)6.85391e-05,
-    (float)6.89184e-05,
-    (float)4.21913e-05,
-    (float)3.61836e-05,
-    (float)2.78848e-05,
-    (float)2.5474e-05,
-    (float)1.3778e-05,
-    (float)1.00116e-05,
-    (float)6.39236e-06,
-    (float)4.88292e-06,
-    (float)1.52233e-06,
-    (float)4.25837e-07,
-    (float)5.22558e-08,
-    (float)1.60474e-06,
-    (float)9.07696e-07,
-    (float)2.43765e-06,
-    (float)4.25308e-06,
-    (float)9.76004e-06,
-    (float)7.8369e-06,
-    (float)1.14068e-05,
-    (float)1.45308e-05,
-    (float)2.37814e-05,
-    (float)1.88563e-05,
-    (float)2.35139e-05,
-    (float)2.71266e-05,
-    (float)3.89556e-05,
-    (float)3.11759e-05,
-    (float)3.59004e-05,
-    (float)3.92603e-05,
-    (float)5.18042e-05,
-    (float)4.26121e-05,
-    (float)4.65838e-05,
-    (float)4.91346e-05,
-    (float)6.02489e-05,
-    (float)5.15473e-05,
-    (float)5.42878e-05,
-    (float)5.5762e-05,
-    (float)6.35448e-05,
-    (float)5.69339e-05,
-    (float)5.82988e-05,
-    (float)5.87392e-05,
-    (float)6.20151e-05,
-    (float)5.83174e-05,
-    (float)5.83908e-05,
-    (float)5.80655e-05,
-    (float)5.66686e-05,
-    (float)5.5824e-05,
-    (float)5.47972e-05,
-    (float)5.4045e-05,
-    (float)4.88046e-05,
-    (float)5.0076e-05,
-    (float)4.81729e-05,
-    (float)4.72549e-05,
-    (float)3.96972e-05,
-    (float)4.20342e-05,
-    (float)3.95012e-05,
-    (float)3.85256e-05,
-    (float)3.04085e-05,
-    (float)3.28052e-05,
-    (float)2.99369e-05,
-    (float)2.88842e-05,
-    (float)2.17316e-05,
-    (float)2.34667e-05,
-    (float)2.06197e-05,
-    (float)1.94416e-05,
-    (float)1.4223e-05,
-    (float)1.49544e-05,
-    (float)1.25135e-05,
-    (float)1.1244e-05,
-    (float)8.26983e-06,
-    (float)8.02023e-06,
-    (float)6.3166e-06,
-    (float)5.13178e-06,
-    (float)4.14556e-06,
-    (float)3.24064e-06,
-    (float)2.45802e-06,
-    (float)1.6507e-06,
-    (float)2.03527e-06,
-    (float)1.03366e-06,
-    (float)1.15117e-06,
-    (float)0.00358062,
-    (float)0.955914,
-    (float)0.000825537,
-    (float)0.00124594,
-    (float)0.00161752,
-    (float)0.00662449,
-    (float)0.00108745,
-    (float)0.00120486,
-    (float)0.00136338,
-    (float)0.00086064,
-    (float)0.00111532,
-    (float)0.00113671,
-    (float)0.00119306,
-    (float)0.000935906,
-    (float)0.00106195,
-    (float)0.00104279,
-    (float)0.00103685,
-    (float)0.00103284,
-    (float)0.000959756,
-    (float)0.000926203,
-    (float)0.000883205,
-    (float)0.000987951,
-    (float)0.000826499,
-    (float)0.000792366,
-    (float)0.000731488,
-    (float)0.000859159,
-    (float)0.000677339,
-    (float)0.000648909,
-    (float)0.000584513,
-    (float)0.000694606,
-    (float)0.00052621,
-    (float)0.000504915,
-    (float)0.000446527,
-    (float)0.000525368,
-    (float)0.000385023,
-    (float)0.000369653,
-    (float)0.000322248,
-    (float)0.000370411,
-    (float)0.00026262,
-    (float)0.000251133,
-    (float)0.000216022,
-    (float)0.000240309,
-    (float)0.000164159,
-    (float)0.000154917,
-    (float)0.000131005,
-    (float)0.000139681,
-    (float)9.11681e-05,
-    (float)8.34689e-05,
-    (float)6.85391e-05,
-    (float)6.89184e-05,
-    (float)4.21913e-05,
-    (float)3.61836e-05,
-    (float)2.78848e-05,
-    (float)2.5474e-05,
-    (float)1.3778e-05,
-    (float)1.00116e-05,
-    (float)6.39236e-06,
-    (float)4.88292e-06,
-    (float)1.52233e-06,
-    (float)4.25837e-07,
-    (float)5.22558e-08,
-    (float)1.60474e-06,
-    (float)9.07696e-07,
-    (float)2.43765e-06,
-    (float)4.25308e-06,
-    (float)9.76004e-06,
-    (float)7.8369e-06,
-    (float)1.14068e-05,
-    (float)1.45308e-05,
-    (float)2.37814e-05,
-    (float)1.88563e-05,
-    (float)2.35139e-05,
-    (float)2.71266e-05,
-    (float)3.89556e-05,
-    (float)3.11759e-05,
-    (float)3.59004e-05,
-    (float)3.92603e-05,
-    (float)5.18042e-05,
-    (float)4.26121e-05,
-    (float)4.65838e-05,
-    (float)4.91346e-05,
-    (float)6.02489e-05,
-    (float)5.15473e-05,
-    (float)5.42878e-05,
-    (float)5.5762e-05,
-    (float)6.35448e-05,
-    (float)5.69339e-05,
-    (float)5.82988e-05,
-    (float)5.87392e-05,
-    (float)6.20151e-05,
-    (float)5.83174e-05,
-    (float)5.83908e-05,
-    (float)5.80655e-05,
-    (float)5.66686e-05,
-    (float)5.5824e-05,
-    (float)5.47972e-05,
-    (float)5.4045e-05,
-    (float)4.88046e-05,
-    (float)5.0076e-05,
-    (float)4.81729e-05,
-    (float)4.72549e-05,
-    (float)3.96972e-05,
-    (float)4.20342e-05,
-    (float)3.95012e-05,
-    (float)3.85256e-05,
-    (float)3.04085e-05,
-    (float)3.28052e-05,
-    (float)2.99369e-05,
-    (float)2.88842e-05,
-    (float)2.17316e-05,
-    (float)2.34667e-05,
-    (float)2.06197e-05,
-    (float)1.94416e-05,
-    (float)1.4223e-05,
-    (float)1.49544e-05,
-    (float)1.25135e-05,
-    (float)1.1244e-05,
-    (float)8.26983e-06,
-    (float)8.02023e-06,
-    (float)6.3166e-06,
-    (float)5.13178e-06,
-    (float)4.14556e-06,
-    (float)3.24064e-06,
-    (float)2.45802e-06,
-    (float)1.6507e-06,
-    (float)2.03527e-06,
-    (float)1.03366e-06,
-    (float)1.15117e-06,
-    (float)0.00268771,
-    (float)0.953462,
-    (float)0.0024696,
-    (float)0.0021438,
-    (float)0.000909344,
-    (float)0.00719352,
-    (float)0.00146446,
-    (float)0.00142166,
-    (float)0.00122026,
-    (float)0.00104178,
-    (float)0.00127801,
-    (float)0.00124922,
-    (float)0.00112817,
-    (float)0.00105714,
-    (float)0.00109903,
-    (float)0.00110321,
-    (float)0.00103493,
-    (float)0.00109099,
-    (float)0.000967889,
-    (float)0.000944566,
-    (float)0.000902815,
-    (float)0.00101713,
-    (float)0.000803745,
-    (float)0.000802221,
-    (float)0.000749575,
-    (float)0.000868954,
-    (float)0.000647348,
-    (float)0.000649157,
-    (float)0.000604588,
-    (float)0.000682312,
-    (float)0.000489912,
-    (float)0.000502498,
-    (float)0.00046259,
-    (float)0.000507105,
-    (float)0.000348777,
-    (float)0.000363069,
-    (float)0.000332546,
-    (float)0.00035077,
-    (float)0.000235939,
-    (float)0.000243344,
-    (float)0.000219924,
-    (float)0.000221656,
-    (float)0.00014693,
-    (float)0.000151131,
-    (float)0.000131624,
-    (float)0.000124832,
-    (float)8.11026e-05,
-    (float)8.1946e-05,
-    (float)6.9765e-05,
-    (float)5.99312e-05,
-    (float)3.80017e-05,
-    (float)3.54754e-05,
-    (float)2.88282e-05,
-    (float)2.22401e-05,
-    (float)1.31438e-05,
-    (float)1.00645e-05,
-    (float)6.98191e-06,
-    (float)4.03176e-06,
-    (float)2.1515e-06,
-    (float)7.33761e-07,
-    (float)3.22211e-07,
-    (float)5.96973e-07,
-    (float)4.33335e-07,
-    (float)2.5534e-06,
-    (float)3.91913e-06,
-    (float)6.25311e-06,
-    (float)5.22252e-06,
-    (float)1.16737e-05,
-    (float)1.33919e-05,
-    (float)1.67124e-05,
-    (float)1.36927e-05,
-    (float)2.38246e-05,
-    (float)2.61382e-05,
-    (float)2.84875e-05,
-    (float)2.42106e-05,
-    (float)3.60046e-05,
-    (float)3.82433e-05,
-    (float)4.03156e-05,
-    (float)3.49518e-05,
-    (float)4.65083e-05,
-    (float)4.82133e-05,
-    (float)4.9202e-05,
-    (float)4.53707e-05,
-    (float)5.37427e-05,
-    (float)5.51172e-05,
-    (float)5.51067e-05,
-    (float)5.27333e-05,
-    (float)5.79356e-05,
-    (float)5.82739e-05,
-    (float)5.76342e-05,
-    (float)5.69983e-05,
-    (float)5.75308e-05,
-    (float)5.83912e-05,
-    (float)5.67598e-05,
-    (float)5.74146e-05,
-    (float)5.39453e-05,
-    (float)5.44825e-05,
-    (float)5.324e-05,
-    (float)5.40748e-05,
-    (float)4.75341e-05,
-    (float)4.81316e-05,
-    (float)4.64054e-05,
-    (float)4.77225e-05,
-    (float)3.94394e-05,
-    (float)3.97386e-05,
-    (float)3.78696e-05,
-    (float)3.83096e-05,
-    (float)3.05459e-05,
-    (float)3.04914e-05,
-    (float)2.82182e-05,
-    (float)2.792e-05,
-    (float)2.11631e-05,
-    (float)2.10822e-05,
-    (float)1.88026e-05,
-    (float)1.76587e-05,
-    (float)1.28485e-05,
-    (float)1.21809e-05,
-    (float)1.03874e-05,
-    (float)9.08413e-06,
-    (float)6.18737e-06,
-    (float)5.28892e-06,
-    (float)3.96209e-06,
-    (float)2.99359e-06,
-    (float)1.9618e-06,
-    (float)1.08523e-06,
-    (float)5.97356e-07,
-    (float)2.36691e-07,
-    (float)4.6258e-07,
-    (float)0.00193456,
-    (float)0.948748,
-    (float)0.00589634,
-    (float)0.00337115,
-    (float)0.000501855,
-    (float)0.00772861,
-    (float)0.00195655,
-    (float)0.00165592,
-    (float)0.001141,
-    (float)0.00116605,
-    (float)0.00146316,
-    (float)0.00134202,
-    (float)0.00108283,
-    (float)0.0011697,
-    (float)0.00113673,
-    (float)0.00114615,
-    (float)0.00102713,
-    (float)0.0011201,
-    (float)0.000962593,
-    (float)0.000952344,
-    (float)0.000911504,
-    (float)0.00101355,
-    (float)0.00075985,
-    (float)0.000803162,
-    (float)0.000753196,
-    (float)0.000844072,
-    (float)0.000604673,
-    (float)0.000637083,
-    (float)0.000603582,
-    (float)0.000640898,
-    (float)0.000450676,
-    (float)0.000496352,
-    (float)0.000452039,
-    (float)0.000461175,
-    (float)0.000315321,
-    (float)0.000359432,
-    (float)0.000325146,
-    (float)0.00030827,
-    (float)0.000212289,
-    (float)0.00023876,
-    (float)0.000213633,
-    (float)0.000193937,
-    (float)0.000133609,
-    (float)0.000148513,
-    (float)0.000125463,
-    (float)0.000108303,
-    (float)7.85957e-05,
-    (float)8.18925e-05,
-    (float)6.71594e-05,
-    (float)5.13528e-05,
-    (float)3.93662e-05,
-    (float)3.83647e-05,
-    (float)2.92125e-05,
-    (float)2.02015e-05,
-    (float)1.49561e-05,
-    (float)1.20346e-05,
-    (float)8.92757e-06,
-    (float)4.40777e-06,
-    (float)3.41349e-06,
-    (float)1.45036e-06,
-    (float)5.84894e-07,
-    (float)2.91545e-08,
-    (float)1.50509e-08,
-    (float)1.711e-06,
-    (float)1.60273e-06,
-    (float)3.01887e-06,
-    (float)3.28425e-06,
-    (float)9.17068e-06,
-    (float)7.86856e-06,
-    (float)1.0522e-05,
-    (float)1.1937e-05,
-    (float)1.96476e-05,
-    (float)1.81312e-05,
-    (float)1.98985e-05,
-    (float)2.28537e-05,
-    (float)3.24321e-05,
-    (float)2.89147e-05,
-    (float)3.11212e-05,
-    (float)3.40902e-05,
-    (float)4.27187e-05,
-    (float)4.08949e-05,
-    (float)4.0815e-05,
-    (float)4.52126e-05,
-    (float)5.04312e-05,
-    (float)4.93791e-05,
-    (float)5.02597e-05,
-    (float)5.26948e-05,
-    (float)5.56152e-05,
-    (float)5.51837e-05,
-    (float)5.47384e-05,
-    (float)5.81327e-05,
-    (float)5.6557e-05,
-    (float)5.77965e-05,
-    (float)5.60307e-05,
-    (float)5.7429e-05,
-    (float)5.56014e-05,
-    (float)5.60152e-05,
-    (float)5.35825e-05,
-    (float)5.35206e-05,
-    (float)4.97999e-05,
-    (float)5.18552e-05,
-    (float)4.74519e-05,
-    (float)4.63094e-05,
-    (float)4.23525e-05,
-    (float)4.31654e-05,
-    (float)3.96436e-05,
-    (float)3.69786e-05,
-    (float)3.30963e-05,
-    (float)3.3328e-05,
-    (float)2.9201e-05,
-    (float)2.72852e-05,
-    (float)2.34077e-05,
-    (float)2.27116e-05,
-    (float)1.92704e-05,
-    (float)1.70215e-05,
-    (float)1.45109e-05,
-    (float)1.31232e-05,
-    (float)1.0378e-05,
-    (float)8.68187e-06,
-    (float)6.70854e-06,
-    (float)5.70448e-06,
-    (float)3.90004e-06,
-    (float)2.74087e-06,
-    (float)1.76258e-06,
-    (float)1.05702e-06,
-    (float)4.84979e-07,
-    (float)1.0097e-07,
-    (float)1.87924e-08,
-    (float)0.00128945,
-    (float)0.940812,
-    (float)0.0115922,
-    (float)0.00489916,
-    (float)0.000392684,
-    (float)0.00832509,
-    (float)0.00253846,
-    (float)0.00192009,
-    (float)0.00114477,
-    (float)0.00123849,
-    (float)0.00165234,
-    (float)0.00140944,
-    (float)0.0010771,
-    (float)0.00127666,
-    (float)0.00117653,
-    (float)0.00117514,
-    (float)0.00102845,
-    (float)0.00113464,
-    (float)0.000951435,
-    (float)0.000962572,
-    (float)0.000919631,
-    (float)0.000997481,
-    (float)0.000712706,
-    (float)0.000816503,
-    (float)0.000760209,
-    (float)0.000804035,
-    (float)0.000560074,
-    (float)0.000635517,
-    (float)0.000605469,
-    (float)0.000598966,
-    (float)0.000416723,
-    (float)0.000495725,
-    (float)0.000437773,
-    (float)0.000418797,
-    (float)0.000297063,
-    (float)0.000361795,
-    (float)0.000309662,
-    (float)0.000268319,
-    (float)0.000202891,
-    (float)0.00024399,
-    (float)0.000202759,
-    (float)0.000167587,
-    (float)0.000128593,
-    (float)0.000151234,
-    (float)0.000120362,
-    (float)9.60404e-05,
-    (float)8.0222e-05,
-    (float)8.20084e-05,
-    (float)6.47496e-05,
-    (float)4.84019e-05,
-    (float)4.37772e-05,
-    (float)4.02787e-05,
-    (float)2.86908e-05,
-    (float)2.05618e-05,
-    (float)1.90445e-05,
-    (float)1.4311e-05,
-    (float)1.07157e-05,
-    (float)5.38288e-06,
-    (float)5.13443e-06,
-    (float)2.49344e-06,
-    (float)1.62579e-06,
-    (float)3.71537e-07,
-    (float)2.82302e-07,
-    (float)1.01832e-06,
-    (float)2.57813e-07,
-    (float)1.4106e-06,
-    (float)2.77536e-06,
-    (float)6.52921e-06,
-    (float)4.2896e-06,
-    (float)7.21424e-06,
-    (float)1.12408e-05,
-    (float)1.45208e-05,
-    (float)1.22671e-05,
-    (float)1.66783e-05,
-    (float)2.21941e-05,
-    (float)2.53732e-05,
-    (float)2.15806e-05,
-    (float)2.74696e-05,
-    (float)3.46811e-05,
-    (float)3.47697e-05,
-    (float)3.34838e-05,
-    (float)3.71465e-05,
-    (float)4.47776e-05,
-    (float)4.40459e-05,
-    (float)4.33567e-05,
-    (float)4.68519e-05,
-    (float)5.12585e-05,
-    (float)4.97058e-05,
-    (float)5.2327e-05,
-    (float)5.20664e-05,
-    (float)5.54276e-05,
-    (float)5.25664e-05,
-    (float)5.59762e-05,
-    (float)5.49695e-05,
-    (float)5.44213e-05,
-    (float)5.31601e-05,
-    (float)5.56706e-05,
-    (float)5.19349e-05,
-    (float)5.13515e-05,
-    (float)4.95705e-05,
-    (float)5.13452e-05,
-    (float)4.60799e-05,
-    (float)4.37161e-05,
-    (float)4.40656e-05,
-    (float)4.30376e-05,
-    (float)3.73628e-05,
-    (float)3.51417e-05,
-    (float)3.48245e-05,
-    (float)3.33608e-05,
-    (float)2.74221e-05,
-    (float)2.52034e-05,
-    (float)2.52542e-05,
-    (float)2.22566e-05,
-    (float)1.79909e-05,
-    (float)1.59587e-05,
-    (float)1.51974e-05,
-    (float)1.28248e-05,
-    (float)9.54834e-06,
-    (float)8.1952e-06,
-    (float)7.18748e-06,
-    (float)5.15496e-06,
-    (float)3.6682e-06,
-    (float)2.68095e-06,
-    (float)1.85125e-06,
-    (float)9.43438e-07,
-    (float)3.94436e-07,
-    (float)1.50194e-07,
-    (float)4.27073e-08,
-    (float)0.00079745,
-    (float)0.929073,
-    (float)0.0202041,
-    (float)0.0067678,
-    (float)0.00057773,
-    (float)0.00892711,
-    (float)0.00323533,
-    (float)0.00225534,
-    (float)0.00126227,
-    (float)0.00122819,
-    (float)0.00185175,
-    (float)0.00147343,
-    (float)0.00111704,
-    (float)0.00135101,
-    (float)0.00121637,
-    (float)0.00119999,
-    (float)0.00104308,
-    (float)0.00110708,
-    (float)0.000929707,
-    (float)0.000966285,
-    (float)0.000909878,
-    (float)0.00094934,
-    (float)0.000657083,
-    (float)0.000835492,
-    (float)0.00074054,
-    (float)0.000726084,
-    (float)0.000511608,
-    (float)0.000638447,
-    (float)0.000586785,
-    (float)0.000534098,
-    (float)0.000379634,
-    (float)0.000497843,
-    (float)0.0004075,
-    (float)0.000372805,
-    (float)0.000286302,
-    (float)0.000356744,
-    (float)0.000282571,
-    (float)0.000235722,
-    (float)0.000209694,
-    (float)0.00024771,
-    (float)0.000179884,
-    (float)0.000151328,
-    (float)0.000139083,
-    (float)0.00015755,
-    (float)0.000113797,
-    (float)8.93799e-05,
-    (float)9.16724e-05,
-    (float)8.60002e-05,
-    (float)6.64819e-05,
-    (float)5.25394e-05,
-    (float)5.09847e-05,
-    (float)4.335e-05,
-    (float)3.31367e-05,
-    (float)2.54112e-05,
-    (float)2.61888e-05,
-    (float)1.61124e-05,
-    (float)1.47601e-05,
-    (float)8.26618e-06,
-    (float)8.72333e-06,
-    (float)4.66287e-06,
-    (float)3.37551e-06,
-    (float)1.24591e-06,
-    (float)1.83819e-06,
-    (float)6.72188e-07,
-    (float)4.79182e-07,
-    (float)2.26545e-06,
-    (float)3.34219e-06,
-    (float)3.11263e-06,
-    (float)3.30286e-06,
-    (float)8.33325e-06,
-    (float)1.14049e-05,
-    (float)9.32596e-06,
-    (float)1.07852e-05,
-    (float)1.94177e-05,
-    (float)2.03548e-05,
-    (float)1.82362e-05,
-    (float)2.1927e-05,
-    (float)2.94475e-05,
-    (float)3.21088e-05,
-    (float)2.65316e-05,
-    (float)3.37168e-05,
-    (float)3.9811e-05,
-    (float)4.00451e-05,
-    (float)3.70897e-05,
-    (float)4.2589e-05,
-    (float)4.59288e-05,
-    (float)4.81753e-05,
-    (float)4.37116e-05,
-    (float)5.00294e-05,
-    (float)4.86395e-05,
-    (float)5.15235e-05,
-    (float)5.01129e-05,
-    (float)5.06438e-05,
-    (float)4.95005e-05,
-    (float)5.24303e-05,
-    (float)5.05257e-05,
-    (float)4.96708e-05,
-    (float)4.61283e-05,
-    (float)5.04206e-05,
-    (float)4.79961e-05,
-    (float)4.29414e-05,
-    (float)4.26948e-05,
-    (float)4.42405e-05,
-    (float)4.13879e-05,
-    (float)3.56534e-05,
-    (float)3.54805e-05,
-    (float)3.7041e-05,
-    (float)3.19996e-05,
-    (float)2.6499e-05,
-    (float)2.82238e-05,
-    (float)2.69282e-05,
-    (float)2.26866e-05,
-    (float)1.77186e-05,
-    (float)1.90968e-05,
-    (float)1.77498e-05,
-    (float)1.33756e-05,
-    (float)1.03174e-05,
-    (float)1.0695e-05,
-    (float)8.83139e-06,
-    (float)6.51853e-06,
-    (float)4.37415e-06,
-    (float)4.17732e-06,
-    (float)2.813e-06,
-    (float)1.65169e-06,
-    (float)9.58399e-07,
-    (float)6.74142e-07,
-    (float)1.41563e-07,
-    (float)1.0207e-08,
-    (float)0.00043471,
-    (float)0.91272,
-    (float)0.0324272,
-    (float)0.00891203,
-    (float)0.00102867,
-    (float)0.00962323,
-    (float)0.00401409,
-    (float)0.00267303,
-    (float)0.00148243,
-    (float)0.00116592,
-    (float)0.0020406,
-    (float)0.00155732,
-    (float)0.00118572,
-    (float)0.0014037,
-    (float)0.00124605,
-    (float)0.00124018,
-    (float)0.00108275,
-    (float)0.00105945,
-    (float)0.000903111,
-    (float)0.000971041,
-    (float)0.00088795,
-    (float)0.000902679,
-    (float)0.000616695,
-    (float)0.000851527,
-    (float)0.000697643,
-    (float)0.000646264,
-    (float)0.00048708,
-    (float)0.000643274,
-    (float)0.000538399,
-    (float)0.000471624,
-    (float)0.000358266,
-    (float)0.000498578,
-    (float)0.000366986,
-    (float)0.000333207,
-    (float)0.000282467,
-    (float)0.000338123,
-    (float)0.000253946,
-    (float)0.000223125,
-    (float)0.000215852,
-    (float)0.000230939,
-    (float)0.000158498,
-    (float)0.000153669,
-    (float)0.000153597,
-    (float)0.000145929,
-    (float)0.000106493,
-    (float)9.45903e-05,
-    (float)0.000105304,
-    (float)8.4734e-05,
-    (float)6.70516e-05,
-    (float)5.97806e-05,
-    (float)5.92458e-05,
-    (float)4.5641e-05,
-    (float)3.9775e-05,
-    (float)3.10867e-05,
-    (float)3.19956e-05,
-    (float)1.8553e-05,
-    (float)1.99403e-05,
-    (float)1.3495e-05,
-    (float)1.24541e-05,
-    (float)6.56039e-06,
-    (float)6.07601e-06,
-    (float)3.95963e-06,
-    (float)4.36018e-06,
-    (float)1.24496e-06,
-    (float)2.25776e-06,
-    (float)2.92284e-06,
-    (float)2.94522e-06,
-    (float)2.65252e-06,
-    (float)5.95787e-06,
-    (float)7.8103e-06,
-    (float)7.8274e-06,
-    (float)8.54812e-06,
-    (float)1.45524e-05,
-    (float)1.70372e-05,
-    (float)1.56637e-05,
-    (float)1.74822e-05,
-    (float)2.6416e-05,
-    (float)2.5149e-05,
-    (float)2.64591e-05,
-    (float)2.7022e-05,
-    (float)3.68206e-05,
-    (float)3.45017e-05,
-    (float)3.49543e-05,
-    (float)3.66658e-05,
-    (float)4.4599e-05,
-    (float)4.04576e-05,
-    (float)4.39097e-05,
-    (float)4.18006e-05,
-    (float)4.87578e-05,
-    (float)4.51474e-05,
-    (float)4.74257e-05,
-    (float)4.58964e-05,
-    (float)4.78558e-05,
-    (float)4.66999e-05,
-    (float)4.84872e-05,
-    (float)4.42293e-05,
-    (float)4.59275e-05,
-    (float)4.48543e-05,
-    (float)4.43645e-05,
-    (float)4.14725e-05,
-    (float)4.00495e-05,
-    (float)4.13544e-05,
-    (float)3.76057e-05,
-    (float)3.49786e-05,
-    (float)3.43925e-05,
-    (float)3.42761e-05,
-    (float)2.95048e-05,
-    (float)2.79973e-05,
-    (float)2.62057e-05,
-    (float)2.6821e-05,
-    (float)2.07919e-05,
-    (float)2.01258e-05,
-    (float)1.849e-05,
-    (float)1.77697e-05,
-    (float)1.33033e-05,
-    (float)1.25912e-05,
-    (float)1.06645e-05,
-    (float)1.00872e-05,
-    (float)6.7044e-06,
-    (float)6.18227e-06,
-    (float)4.64561e-06,
-    (float)3.84386e-06,
-    (float)2.26122e-06,
-    (float)1.74539e-06,
-    (float)9.16129e-07,
-    (float)6.03484e-07,
-    (float)1.39023e-07,
-    (float)1.74727e-07,
-    (float)0.000204095,
-    (float)0.890935,
-    (float)0.0490125,
-    (float)0.0113195,
-    (float)0.00171572,
-    (float)0.0105179,
-    (float)0.00486391,
-    (float)0.00318724,
-    (float)0.001787,
-    (float)0.00107636,
-    (float)0.002215,
-    (float)0.00169407,
-    (float)0.00124344,
-    (float)0.00143519,
-    (float)0.00124582,
-    (float)0.00131889,
-    (float)0.00113065,
-    (float)0.000985985,
-    (float)0.000862434,
-    (float)0.000979486,
-    (float)0.000852373,
-    (float)0.000850792,
-    (float)0.000578278,
-    (float)0.000859229,
-    (float)0.000637884,
-    (float)0.000570074,
-    (float)0.000483989,
-    (float)0.000638171,
-    (float)0.000470832,
-    (float)0.000417596,
-    (float)0.00035669,
-    (float)0.000500968,
-    (float)0.000320216,
-    (float)0.000298422,
-    (float)0.000294197,
-    (float)0.00032413,
-    (float)0.000232818,
-    (float)0.000217973,
-    (float)0.000220305,
-    (float)0.000219139,
-    (float)0.000150523,
-    (float)0.000164959,
-    (float)0.000163353,
-    (float)0.000130095,
-    (float)0.000110986,
-    (float)0.00010791,
-    (float)0.000113617,
-    (float)8.00739e-05,
-    (float)6.91804e-05,
-    (float)7.08089e-05,
-    (float)6.65243e-05,
-    (float)4.51391e-05,
-    (float)4.56393e-05,
-    (float)3.46584e-05,
-    (float)3.69431e-05,
-    (float)2.18251e-05,
-    (float)2.3952e-05,
-    (float)1.69058e-05,
-    (float)1.41202e-05,
-    (float)8.95463e-06,
-    (float)1.07722e-05,
-    (float)6.04592e-06,
-    (float)5.96562e-06,
-    (float)2.15894e-06,
-    (float)5.041e-06,
-    (float)3.79047e-06,
-    (float)3.75849e-06,
-    (float)3.13184e-06,
-    (float)6.98952e-06,
-    (float)6.07249e-06,
-    (float)7.41654e-06,
-    (float)9.54965e-06,
-    (float)1.38741e-05,
-    (float)1.16515e-05,
-    (float)1.4935e-05,
-    (float)1.7602e-05,
-    (float)2.42989e-05,
-    (float)1.83569e-05,
-    (float)2.41862e-05,
-    (float)2.78685e-05,
-    (float)3.20945e-05,
-    (float)2.7038e-05,
-    (float)3.35364e-05,
-    (float)3.49987e-05,
-    (float)4.04955e-05,
-    (float)3.37166e-05,
-    (float)4.13123e-05,
-    (float)4.06095e-05,
-    (float)4.37101e-05,
-    (float)4.10978e-05,
-    (float)4.41813e-05,
-    (float)4.23078e-05,
-    (float)4.58683e-05,
-    (float)4.32601e-05,
-    (float)4.48585e-05,
-    (float)4.10707e-05,
-    (float)4.32176e-05,
-    (float)4.34786e-05,
-    (float)3.97572e-05,
-    (float)3.85259e-05,
-    (float)3.85767e-05,
-    (float)3.78153e-05,
-    (float)3.40461e-05,
-    (float)3.31091e-05,
-    (float)3.18009e-05,
-    (float)3.06692e-05,
-    (float)2.49688e-05,
-    (float)2.74917e-05,
-    (float)2.37502e-05,
-    (float)2.17989e-05,
-    (float)1.74275e-05,
-    (float)1.93765e-05,
-    (float)1.61164e-05,
-    (float)1.39472e-05,
-    (float)1.01251e-05,
-    (float)1.22835e-05,
-    (float)8.66367e-06,
-    (float)7.47072e-06,
-    (float)5.14867e-06,
-    (float)5.60904e-06,
-    (float)3.58027e-06,
-    (float)2.74766e-06,
-    (float)1.70388e-06,
-    (float)1.83176e-06,
-    (float)5.43405e-07,
-    (float)3.66776e-07,
-    (float)1.26644e-07,
-    (float)2.75727e-07,
-    (float)0.000101298,
-    (float)0.863017,
-    (float)0.0706654,
-    (float)0.0139443,
-    (float)0.00262177,
-    (float)0.0117059,
-    (float)0.0057652,
-    (float)0.00377922,
-    (float)0.00216124,
-    (float)0.000997708,
-    (float)0.0023772,
-    (float)0.0019211,
-    (float)0.00125629,
-    (float)0.00145508,
-    (float)0.00120664,
-    (float)0.00145235,
-    (float)0.00117171,
-    (float)0.00089729,
-    (float)0.000812327,
-    (float)0.00101299,
-    (float)0.000796859,
-    (float)0.000788018,
-    (float)0.00054285,
-    (float)0.000849819,
-    (float)0.000575267,
-    (float)0.000499627,
-    (float)0.00049615,
-    (float)0.00060439,
-    (float)0.000390051,
-    (float)0.000384592,
-    (float)0.000372954,
-    (float)0.000468677,
-    (float)0.000266256,
-    (float)0.000275711,
-    (float)0.000325051,
-    (float)0.000295708,
-    (float)0.000204794,
-    (float)0.000220387,
-    (float)0.000228047,
-    (float)0.000205648,
-    (float)0.000149282,
-    (float)0.000173863,
-    (float)0.000167767,
-    (float)0.000118847,
-    (float)0.00012519,
-    (float)0.000124031,
-    (float)0.000108715,
-    (float)7.89698e-05,
-    (float)8.23784e-05,
-    (float)8.42317e-05,
-    (float)6.77102e-05,
-    (float)4.44684e-05,
-    (float)5.63658e-05,
-    (float)4.27143e-05,
-    (float)3.94338e-05,
-    (float)2.61929e-05,
-    (float)2.80414e-05,
-    (float)2.12439e-05,
-    (float)1.82221e-05,
-    (float)1.27393e-05,
-    (float)1.5625e-05,
-    (float)6.95329e-06,
-    (float)8.57723e-06,
-    (float)6.06049e-06,
-    (float)8.82122e-06,
-    (float)4.45772e-06,
-    (float)4.34529e-06,
-    (float)5.68286e-06,
-    (float)9.30644e-06,
-    (float)5.45643e-06,
-    (float)8.33639e-06,
-    (float)1.03679e-05,
-    (float)1.21928e-05,
-    (float)1.02467e-05,
-    (float)1.64433e-05,
-    (float)1.69519e-05,
-    (float)1.7844e-05,
-    (float)1.63262e-05,
-    (float)2.5937e-05,
-    (float)2.48128e-05,
-    (float)2.33326e-05,
-    (float)2.43892e-05,
-    (float)3.37199e-05,
-    (float)3.03244e-05,
-    (float)3.08664e-05,
-    (float)3.05222e-05,
-    (float)3.82474e-05,
-    (float)3.53455e-05,
-    (float)3.61401e-05,
-    (float)3.61554e-05,
-    (float)3.84977e-05,
-    (float)3.86303e-05,
-    (float)4.0396e-05,
-    (float)3.64641e-05,
-    (float)3.75809e-05,
-    (float)3.93654e-05,
-    (float)3.95968e-05,
-    (float)3.54364e-05,
-    (float)3.37584e-05,
-    (float)3.83599e-05,
-    (float)3.48978e-05,
-    (float)3.04014e-05,
-    (float)3.09152e-05,
-    (float)3.25696e-05,
-    (float)2.72242e-05,
-    (float)2.51794e-05,
-    (float)2.52313e-05,
-    (float)2.58996e-05,
-    (float)1.83203e-05,
-    (float)1.88886e-05,
-    (float)1.95306e-05,
-    (float)1.67644e-05,
-    (float)1.13807e-05,
-    (float)1.27124e-05,
-    (float)1.21873e-05,
-    (float)9.67039e-06,
-    (float)5.72623e-06,
-    (float)7.4413e-06,
-    (float)5.99356e-06,
-    (float)3.89185e-06,
-    (float)2.61822e-06,
-    (float)3.08652e-06,
-    (float)1.80604e-06,
-    (float)9.68157e-07,
-    (float)5.2132e-07,
-    (float)9.58754e-07,
-    (float)1.29999e-07,
-    (float)4.55767e-09,
-    (float)0.000120713,
-    (float)0.828423,
-    (float)0.0980464,
-    (float)0.0166566,
-    (float)0.00369886,
-    (float)0.013339,
-    (float)0.00670237,
-    (float)0.00440419,
-    (float)0.00256143,
-    (float)0.000963514,
-    (float)0.0025379,
-    (float)0.00225417,
-    (float)0.00117309,
-    (float)0.00147691,
-    (float)0.00112691,
-    (float)0.00163229,
-    (float)0.00116362,
-    (float)0.000807242,
-    (float)0.000765397,
-    (float)0.00108222,
-    (float)0.000700853,
-    (float)0.000724292,
-    (float)0.000509622,
-    (float)0.000822729,
-    (float)0.00051835,
-    (float)0.000449958,
-    (float)0.000504558,
-    (float)0.000544525,
-    (float)0.000323419,
-    (float)0.000394565,
-    (float)0.000378914,
-    (float)0.000398272,
-    (float)0.000236925,
-    (float)0.000286128,
-    (float)0.000342715,
-    (float)0.000252055,
-    (float)0.000188975,
-    (float)0.00024413,
-    (float)0.000227325,
-    (float)0.000187388,
-    (float)0.000157096,
-    (float)0.000175095,
-    (float)0.000169095,
-    (float)0.000118995,
-    (float)0.000136015,
-    (float)0.000124777,
-    (float)9.98725e-05,
-    (float)8.92745e-05,
-    (float)9.69775e-05,
-    (float)7.8817e-05,
-    (float)6.56659e-05,
-    (float)5.14602e-05,
-    (float)6.72514e-05,
-    (float)4.43684e-05,
-    (float)3.72405e-05,
-    (float)3.24297e-05,
-    (float)3.43311e-05,
-    (float)2.4253e-05,
-    (float)2.16935e-05,
-    (float)1.60622e-05,
-    (float)1.88203e-05,
-    (float)1.04169e-05,
-    (float)1.25202e-05,
-    (float)1.05278e-05,
-    (float)9.05029e-06,
-    (float)6.24977e-06,
-    (float)8.78956e-06,
-    (float)8.91343e-06,
-    (float)8.96753e-06,
-    (float)5.75254e-06,
-    (float)1.10199e-05,
-    (float)1.09123e-05,
-    (float)1.13312e-05,
-    (float)1.13353e-05,
-    (float)1.59912e-05,
-    (float)1.40057e-05,
-    (float)1.72332e-05,
-    (float)1.84962e-05,
-    (float)2.19553e-05,
-    (float)1.89222e-05,
-    (float)2.2562e-05,
-    (float)2.62385e-05,
-    (float)2.7457e-05,
-    (float)2.34398e-05,
-    (float)2.86396e-05,
-    (float)3.08863e-05,
-    (float)3.10568e-05,
-    (float)2.90157e-05,
-    (float)3.07396e-05,
-    (float)3.36619e-05,
-    (float)3.3518e-05,
-    (float)3.12801e-05,
-    (float)3.21631e-05,
-    (float)3.28648e-05,
-    (float)3.39457e-05,
-    (float)3.23232e-05,
-    (float)2.88667e-05,
-    (float)3.20115e-05,
-    (float)3.193e-05,
-    (float)2.86948e-05,
-    (float)2.65334e-05,
-    (float)2.79816e-05,
-    (float)2.76812e-05,
-    (float)2.46256e-05,
-    (float)2.13314e-05,
-    (float)2.44051e-05,
-    (float)2.13206e-05,
-    (float)1.85013e-05,
-    (float)1.79976e-05,
-    (float)1.77384e-05,
-    (float)1.4889e-05,
-    (float)1.37161e-05,
-    (float)1.24621e-05,
-    (float)1.231e-05,
-    (float)8.81108e-06,
-    (float)8.53258e-06,
-    (float)8.43536e-06,
-    (float)6.20214e-06,
-    (float)4.4571e-06,
-    (float)4.80936e-06,
-    (float)3.70313e-06,
-    (float)2.6641e-06,
-    (float)1.48844e-06,
-    (float)1.61444e-06,
-    (float)1.32628e-06,
-    (float)4.6194e-07,
-    (float)2.91486e-07,
-    (float)8.44812e-07,
-    (float)0.000257503,
-    (float)0.78659,
-    (float)0.131584,
-    (float)0.0193189,
-    (float)0.0049316,
-    (float)0.0156339,
-    (float)0.00766109,
-    (float)0.0049955,
-    (float)0.00298025,
-    (float)0.00101344,
-    (float)0.00274108,
-    (float)0.0026697,
-    (float)0.00101579,
-    (float)0.00153318,
-    (float)0.00104879,
-    (float)0.00181301,
-    (float)0.0011092,
-    (float)0.000732935,
-    (float)0.000763292,
-    (float)0.00117451,
-    (float)0.000579078,
-    (float)0.000663311,
-    (float)0.00048996,
-    (float)0.000791493,
-    (float)0.000467005,
-    (float)0.000404711,
-    (float)0.000503473,
-    (float)0.000486256,
-    (float)0.000277861,
-    (float)0.000411899,
-    (float)0.000357001,
-    (float)0.000324539,
-    (float)0.000238011,
-    (float)0.000300131,
-    (float)0.000325494,
-    (float)0.00020522,
-    (float)0.00019087,
-    (float)0.000274038,
-    (float)0.000208041,
-    (float)0.00016298,
-    (float)0.000170753,
-    (float)0.000175798,
-    (float)0.000168095,
-    (float)0.000116085,
-    (float)0.000137258,
-    (float)0.000124246,
-    (float)9.96943e-05,
-    (float)9.92635e-05,
-    (float)9.93153e-05,
-    (float)6.79266e-05,
-    (float)7.50596e-05,
-    (float)6.24192e-05,
-    (float)6.74727e-05,
-    (float)4.1654e-05,
-    (float)4.05699e-05,
-    (float)4.44621e-05,
-    (float)3.756e-05,
-    (float)2.30029e-05,
-    (float)2.78457e-05,
-    (float)2.10651e-05,
-    (float)2.31868e-05,
-    (float)1.43521e-05,
-    (float)1.55896e-05,
-    (float)1.42911e-05,
-    (float)1.15341e-05,
-    (float)1.05818e-05,
-    (float)1.40637e-05,
-    (float)8.35249e-06,
-    (float)1.04546e-05,
-    (float)9.98951e-06,
-    (float)1.36261e-05,
-    (float)1.09267e-05,
-    (float)1.05175e-05,
-    (float)1.32604e-05,
-    (float)1.64372e-05,
-    (float)1.31411e-05,
-    (float)1.68299e-05,
-    (float)1.68846e-05,
-    (float)1.84232e-05,
-    (float)1.97091e-05,
-    (float)2.14083e-05,
-    (float)2.14204e-05,
-    (float)2.17408e-05,
-    (float)2.33127e-05,
-    (float)2.71782e-05,
-    (float)2.40435e-05,
-    (float)2.35274e-05,
-    (float)2.82861e-05,
-    (float)2.77308e-05,
-    (float)2.67746e-05,
-    (float)2.5548e-05,
-    (float)2.73969e-05,
-    (float)2.8855e-05,
-    (float)2.66282e-05,
-    (float)2.47725e-05,
-    (float)2.70029e-05,
-    (float)2.52553e-05,
-    (float)2.70075e-05,
-    (float)2.29412e-05,
-    (float)2.19313e-05,
-    (float)2.45302e-05,
-    (float)2.3215e-05,
-    (float)1.93577e-05,
-    (float)1.92411e-05,
-    (float)1.93378e-05,
-    (float)2.07696e-05,
-    (float)1.54283e-05,
-    (float)1.42575e-05,
-    (float)1.7266e-05,
-    (float)1.46013e-05,
-    (float)1.20046e-05,
-    (float)1.15285e-05,
-    (float)1.10086e-05,
-    (float)1.11337e-05,
-    (float)8.20901e-06,
-    (float)7.311e-06,
-    (float)7.68538e-06,
-    (float)5.59181e-06,
-    (float)5.49431e-06,
-    (float)4.43657e-06,
-    (float)2.96035e-06,
-    (float)3.06513e-06,
-    (float)2.42303e-06,
-    (float)1.81895e-06,
-    (float)1.27e-06,
-    (float)7.39046e-07,
-    (float)1.03985e-06,
-    (float)1.05016e-06,
-    (float)0.000494873,
-    (float)0.737731,
-    (float)0.171258,
-    (float)0.0217841,
-    (float)0.00630418,
-    (float)0.0187316,
-    (float)0.00867691,
-    (float)0.00543354,
-    (float)0.00340257,
-    (float)0.00115666,
-    (float)0.00299094,
-    (float)0.00311323,
-    (float)0.000800117,
-    (float)0.00161137,
-    (float)0.00103428,
-    (float)0.00190276,
-    (float)0.00100026,
-    (float)0.000657997,
-    (float)0.000832801,
-    (float)0.00125561,
-    (float)0.000432885,
-    (float)0.000599224,
-    (float)0.000525641,
-    (float)0.000729459,
-    (float)0.000405442,
-    (float)0.000364181,
-    (float)0.000507782,
-    (float)0.000449303,
-    (float)0.00023895,
-    (float)0.000419864,
-    (float)0.000332944,
-    (float)0.000264529,
-    (float)0.000267369,
-    (float)0.000304904,
-    (float)0.000274903,
-    (float)0.000183633,
-    (float)0.000214017,
-    (float)0.000284669,
-    (float)0.000173149,
-    (float)0.000142222,
-    (float)0.000207316,
-    (float)0.000170953,
-    (float)0.000143504,
-    (float)0.000116821,
-    (float)0.000141433,
-    (float)0.000124135,
-    (float)9.76214e-05,
-    (float)9.50198e-05,
-    (float)0.0001005,
-    (float)6.58457e-05,
-    (float)8.30508e-05,
-    (float)6.71088e-05,
-    (float)5.69392e-05,
-    (float)4.69708e-05,
-    (float)5.33692e-05,
-    (float)4.62183e-05,
-    (float)3.54183e-05,
-    (float)2.63244e-05,
-    (float)3.95538e-05,
-    (float)2.6524e-05,
-    (float)2.18093e-05,
-    (float)2.0163e-05,
-    (float)2.19589e-05,
-    (float)1.82425e-05,
-    (float)1.59158e-05,
-    (float)1.4206e-05,
-    (float)1.69779e-05,
-    (float)1.15415e-05,
-    (float)1.43684e-05,
-    (float)1.49272e-05,
-    (float)1.2001e-05,
-    (float)1.22627e-05,
-    (float)1.4823e-05,
-    (float)1.48865e-05,
-    (float)1.41963e-05,
-    (float)1.26946e-05,
-    (float)1.70597e-05,
-    (float)1.72796e-05,
-    (float)1.49484e-05,
-    (float)1.80446e-05,
-    (float)1.82343e-05,
-    (float)1.77626e-05,
-    (float)2.01973e-05,
-    (float)2.02816e-05,
-    (float)1.88471e-05,
-    (float)2.09352e-05,
-    (float)2.12476e-05,
-    (float)2.34279e-05,
-    (float)1.91975e-05,
-    (float)2.13633e-05,
-    (float)2.38089e-05,
-    (float)2.22086e-05,
-    (float)1.99128e-05,
-    (float)2.29594e-05,
-    (float)2.05291e-05,
-    (float)2.23542e-05,
-    (float)2.06964e-05,
-    (float)1.96135e-05,
-    (float)1.91122e-05,
-    (float)2.04993e-05,
-    (float)1.97757e-05,
-    (float)1.69849e-05,
-    (float)1.50601e-05,
-    (float)2.00218e-05,
-    (float)1.7165e-05,
-    (float)1.17287e-05,
-    (float)1.41755e-05,
-    (float)1.65074e-05,
-    (float)1.24451e-05,
-    (float)9.14534e-06,
-    (float)1.1074e-05,
-    (float)1.2387e-05,
-    (float)8.33353e-06,
-    (float)5.96188e-06,
-    (float)8.94599e-06,
-    (float)7.06853e-06,
-    (float)4.59469e-06,
-    (float)4.56213e-06,
-    (float)5.00226e-06,
-    (float)3.1297e-06,
-    (float)2.64521e-06,
-    (float)2.45208e-06,
-    (float)2.40737e-06,
-    (float)9.92542e-07,
-    (float)1.14344e-06,
-    (float)1.58149e-06,
-    (float)1.07877e-06,
-    (float)3.01092e-07,
-    (float)0.000807015,
-    (float)0.682263,
-    (float)0.216654,
-    (float)0.0238819,
-    (float)0.00778575,
-    (float)0.0228574,
-    (float)0.00969275,
-    (float)0.00568494,
-    (float)0.00385406,
-    (float)0.00139157,
-    (float)0.00331764,
-    (float)0.00352778,
-    (float)0.000570386,
-    (float)0.00175125,
-    (float)0.00114816,
-    (float)0.00182948,
-    (float)0.000870144,
-    (float)0.00059268,
-    (float)0.000999773,
-    (float)0.00124494,
-    (float)0.000295749,
-    (float)0.000582586,
-    (float)0.000625229,
-    (float)0.000599021,
-    (float)0.000343137,
-    (float)0.00034533,
-    (float)0.000516153,
-    (float)0.00040782,
-    (float)0.000204061,
-    (float)0.000416787,
-    (float)0.00030895,
-    (float)0.00022436,
-    (float)0.000299523,
-    (float)0.000274698,
-    (float)0.000220954,
-    (float)0.000200148,
-    (float)0.000230569,
-    (float)0.000245106,
-    (float)0.000143589,
-    (float)0.000149777,
-    (float)0.000236639,
-    (float)0.000137564,
-    (float)0.000120005,
-    (float)0.000136462,
-    (float)0.000142266,
-    (float)0.000109482,
-    (float)9.37104e-05,
-    (float)9.21303e-05,
-    (float)0.000107188,
-    (float)6.53394e-05,
-    (float)8.10418e-05,
-    (float)6.56709e-05,
-    (float)5.64254e-05,
-    (float)5.81073e-05,
-    (float)5.79938e-05,
-    (float)3.83902e-05,
-    (float)4.266e-05,
-    (float)3.7141e-05,
-    (float)4.38597e-05,
-    (float)2.6252e-05,
-    (float)2.49598e-05,
-    (float)3.21494e-05,
-    (float)2.70479e-05,
-    (float)1.85213e-05,
-    (float)2.18517e-05,
-    (float)1.98291e-05,
-    (float)2.12504e-05,
-    (float)1.58417e-05,
-    (float)1.65262e-05,
-    (float)1.86331e-05,
-    (float)1.45304e-05,
-    (float)1.55055e-05,
-    (float)1.75899e-05,
-    (float)1.35241e-05,
-    (float)1.54309e-05,
-    (float)1.61451e-05,
-    (float)1.51228e-05,
-    (float)1.66505e-05,
-    (float)1.3686e-05,
-    (float)1.69862e-05,
-    (float)1.66943e-05,
-    (float)1.50758e-05,
-    (float)1.65339e-05,
-    (float)1.72704e-05,
-    (float)1.48491e-05,
-    (float)1.9505e-05,
-    (float)1.52285e-05,
-    (float)1.71961e-05,
-    (float)1.73759e-05,
-    (float)1.69703e-05,
-    (float)1.70044e-05,
-    (float)1.78181e-05,
-    (float)1.4835e-05,
-    (float)1.90989e-05,
-    (float)1.55901e-05,
-    (float)1.72989e-05,
-    (float)1.58145e-05,
-    (float)1.49464e-05,
-    (float)1.78187e-05,
-    (float)1.61671e-05,
-    (float)1.15828e-05,
-    (float)1.633e-05,
-    (float)1.53932e-05,
-    (float)1.24314e-05,
-    (float)1.17516e-05,
-    (float)1.21947e-05,
-    (float)1.43634e-05,
-    (float)9.28025e-06,
-    (float)8.12171e-06,
-    (float)1.21809e-05,
-    (float)8.82473e-06,
-    (float)5.51749e-06,
-    (float)8.4009e-06,
-    (float)6.70699e-06,
-    (float)5.75945e-06,
-    (float)3.82958e-06,
-    (float)4.83131e-06,
-    (float)4.75526e-06,
-    (float)2.3886e-06,
-    (float)1.93858e-06,
-    (float)4.05783e-06,
-    (float)1.40354e-06,
-    (float)1.30422e-06,
-    (float)1.55097e-06,
-    (float)1.40177e-06,
-    (float)7.96188e-07,
-    (float)1.11811e-06,
-    (float)7.66249e-07,
-    (float)0.00119519,
-    (float)0.621313,
-    (float)0.26695,
-    (float)0.0253897,
-    (float)0.00932517,
-    (float)0.0281348,
-    (float)0.0106897,
-    (float)0.00565185,
-    (float)0.00434642,
-    (float)0.00174194,
-    (float)0.00365812,
-    (float)0.0038249,
-    (float)0.000393368,
-    (float)0.00196371,
-    (float)0.00138722,
-    (float)0.00157351,
-    (float)0.000766219,
-    (float)0.000570776,
-    (float)0.00117506,
-    (float)0.00112731,
-    (float)0.000204411,
-    (float)0.000633178,
-    (float)0.000749901,
-    (float)0.000426636,
-    (float)0.000295318,
-    (float)0.000373091,
-    (float)0.00049875,
-    (float)0.000353732,
-    (float)0.000179012,
-    (float)0.000405376,
-    (float)0.000305176,
-    (float)0.000189517,
-    (float)0.000300798,
-    (float)0.000237305,
-    (float)0.000188804,
-    (float)0.000226542,
-    (float)0.000213149,
-    (float)0.000180834,
-    (float)0.000149879,
-    (float)0.000162654,
-    (float)0.000212818,
-    (float)0.000101639,
-    (float)0.000116456,
-    (float)0.000161501,
-    (float)0.00012119,
-    (float)8.3121e-05,
-    (float)0.000105458,
-    (float)9.51134e-05,
-    (float)0.000100575,
-    (float)6.21062e-05,
-    (float)7.64762e-05,
-    (float)7.43615e-05,
-    (float)6.20844e-05,
-    (float)5.75725e-05,
-    (float)5.80293e-05,
-    (float)4.14047e-05,
-    (float)5.72667e-05,
-    (float)4.38777e-05,
-    (float)3.66328e-05,
-    (float)3.56547e-05,
-    (float)3.89983e-05,
-    (float)3.62854e-05,
-    (float)2.66687e-05,
-    (float)2.34011e-05,
-    (float)3.47129e-05,
-    (float)2.52559e-05,
-    (float)1.91158e-05,
-    (float)2.25221e-05,
-    (float)2.2211e-05,
-    (float)2.17522e-05,
-    (float)1.68343e-05,
-    (float)1.65597e-05,
-    (float)1.99661e-05,
-    (float)1.72283e-05,
-    (float)1.49101e-05,
-    (float)1.71071e-05,
-    (float)1.36976e-05,
-    (float)1.76732e-05,
-    (float)1.45746e-05,
-    (float)1.33166e-05,
-    (float)1.5069e-05,
-    (float)1.56804e-05,
-    (float)1.30464e-05,
-    (float)1.51143e-05,
-    (float)1.22302e-05,
-    (float)1.63661e-05,
-    (float)1.31426e-05,
-    (float)1.27235e-05,
-    (float)1.43228e-05,
-    (float)1.45783e-05,
-    (float)1.19623e-05,
-    (float)1.48838e-05,
-    (float)1.17594e-05,
-    (float)1.44424e-05,
-    (float)1.29574e-05,
-    (float)1.18856e-05,
-    (float)1.28607e-05,
-    (float)1.30031e-05,
-    (float)1.10417e-05,
-    (float)1.2484e-05,
-    (float)1.03434e-05,
-    (float)1.15244e-05,
-    (float)1.07101e-05,
-    (float)8.81943e-06,
-    (float)1.02392e-05,
-    (float)9.08812e-06,
-    (float)7.50399e-06,
-    (float)8.36555e-06,
-    (float)7.42468e-06,
-    (float)6.07717e-06,
-    (float)6.51549e-06,
-    (float)5.25503e-06,
-    (float)5.83705e-06,
-    (float)3.85033e-06,
-    (float)3.98928e-06,
-    (float)4.47266e-06,
-    (float)3.35655e-06,
-    (float)1.94859e-06,
-    (float)3.35406e-06,
-    (float)2.36723e-06,
-    (float)2.18218e-06,
-    (float)1.15094e-06,
-    (float)1.83072e-06,
-    (float)1.94319e-06,
-    (float)1.28358e-06,
-    (float)6.37419e-07,
-    (float)1.59576e-06,
-    (float)1.21607e-06,
-    (float)0.00160742,
-    (float)0.55645,
-    (float)0.320437,
-    (float)0.0261961,
-    (float)0.0109594,
-    (float)0.0347335,
-    (float)0.0116535,
-    (float)0.00535501,
-    (float)0.00500311,
-    (float)0.00221721,
-    (float)0.00391773,
-    (float)0.00397241,
-    (float)0.000283729,
-    (float)0.00227675,
-    (float)0.00170348,
-    (float)0.00118603,
-    (float)0.000717359,
-    (float)0.00064745,
-    (float)0.00126148,
-    (float)0.000926837,
-    (float)0.000140955,
-    (float)0.000777696,
-    (float)0.000825744,
-    (float)0.000244117,
-    (float)0.000285451,
-    (float)0.000474135,
-    (float)0.000419863,
-    (float)0.000279629,
-    (float)0.000177217,
-    (float)0.000412753,
-    (float)0.000292191,
-    (float)0.000144079,
-    (float)0.000293913,
-    (float)0.000228579,
-    (float)0.000160445,
-    (float)0.000228373,
-    (float)0.00018164,
-    (float)0.000140588,
-    (float)0.000174901,
-    (float)0.000152788,
-    (float)0.000157295,
-    (float)9.46214e-05,
-    (float)0.000127363,
-    (float)0.000155775,
-    (float)8.6395e-05,
-    (float)7.40405e-05,
-    (float)0.000132609,
-    (float)8.43045e-05,
-    (float)7.41924e-05,
-    (float)7.08181e-05,
-    (float)8.22417e-05,
-    (float)7.32045e-05,
-    (float)5.73579e-05,
-    (float)5.55239e-05,
-    (float)6.82136e-05,
-    (float)4.76087e-05,
-    (float)5.53143e-05,
-    (float)4.63628e-05,
-    (float)4.02397e-05,
-    (float)4.91867e-05,
-    (float)4.354e-05,
-    (float)3.12236e-05,
-    (float)3.66402e-05,
-    (float)3.70283e-05,
-    (float)3.50005e-05,
-    (float)2.59074e-05,
-    (float)2.54862e-05,
-    (float)3.47665e-05,
-    (float)2.41873e-05,
-    (float)2.00538e-05,
-    (float)2.44104e-05,
-    (float)2.35409e-05,
-    (float)1.99837e-05,
-    (float)1.89714e-05,
-    (float)1.64793e-05,
-    (float)2.15095e-05,
-    (float)1.61501e-05,
-    (float)1.52408e-05,
-    (float)1.56332e-05,
-    (float)1.58487e-05,
-    (float)1.51733e-05,
-    (float)1.4275e-05,
-    (float)1.07899e-05,
-    (float)1.69661e-05,
-    (float)1.25441e-05,
-    (float)1.06146e-05,
-    (float)1.27958e-05,
-    (float)1.29754e-05,
-    (float)1.07503e-05,
-    (float)1.119e-05,
-    (float)1.00435e-05,
-    (float)1.27209e-05,
-    (float)9.09265e-06,
-    (float)8.86672e-06,
-    (float)1.16513e-05,
-    (float)8.60133e-06,
-    (float)7.79586e-06,
-    (float)1.02242e-05,
-    (float)7.4071e-06,
-    (float)7.60654e-06,
-    (float)7.7545e-06,
-    (float)6.53606e-06,
-    (float)7.25027e-06,
-    (float)5.63693e-06,
-    (float)5.87358e-06,
-    (float)6.4322e-06,
-    (float)4.21378e-06,
-    (float)5.19194e-06,
-    (float)5.42302e-06,
-    (float)2.94383e-06,
-    (float)4.70257e-06,
-    (float)4.23475e-06,
-    (float)2.56935e-06,
-    (float)3.21627e-06,
-    (float)3.55439e-06,
-    (float)2.67697e-06,
-    (float)2.51831e-06,
-    (float)1.8628e-06,
-    (float)3.6144e-06,
-    (float)2.07332e-06,
-    (float)1.03194e-06,
-    (float)2.76208e-06,
-    (float)2.84944e-06,
-    (float)6.88788e-07,
-    (float)1.90813e-06,
-    (float)2.39438e-06,
-    (float)1.65936e-06,
-    (float)1.10759e-06,
-    (float)0.00203616,
-    (float)0.489928,
-    (float)0.375181,
-    (float)0.0262236,
-    (float)0.0125622,
-    (float)0.0425728,
-    (float)0.0124723,
-    (float)0.00488569,
-    (float)0.00585608,
-    (float)0.00281492,
-    (float)0.00402139,
-    (float)0.00400628,
-    (float)0.000240841,
-    (float)0.00267019,
-    (float)0.00201323,
-    (float)0.000786685,
-    (float)0.000740022,
-    (float)0.000863311,
-    (float)0.00117487,
-    (float)0.000713599,
-    (float)0.000122643,
-    (float)0.000965034,
-    (float)0.00077463,
-    (float)0.000118021,
-    (float)0.000353109,
-    (float)0.000603294,
-    (float)0.000268496,
-    (float)0.000218865,
-    (float)0.000234026,
-    (float)0.000383984,
-    (float)0.000236594,
-    (float)0.000114144,
-    (float)0.000298197,
-    (float)0.00022257,
-    (float)0.000117781,
-    (float)0.000207158,
-    (float)0.000165807,
-    (float)0.000114548,
-    (float)0.000180738,
-    (float)0.000122615,
-    (float)0.000114138,
-    (float)0.000113413,
-    (float)0.000123859,
-    (float)0.000111824,
-    (float)7.6176e-05,
-    (float)8.49832e-05,
-    (float)0.000134866,
-    (float)5.95335e-05,
-    (float)6.4699e-05,
-    (float)9.80203e-05,
-    (float)7.67596e-05,
-    (float)5.58577e-05,
-    (float)6.60197e-05,
-    (float)6.49431e-05,
-    (float)6.93453e-05,
-    (float)4.70984e-05,
-    (float)5.31807e-05,
-    (float)5.98728e-05,
-    (float)4.67725e-05,
-    (float)4.72586e-05,
-    (float)4.54719e-05,
-    (float)3.90103e-05,
-    (float)4.72204e-05,
-    (float)3.9274e-05,
-    (float)3.00504e-05,
-    (float)3.91668e-05,
-    (float)3.56142e-05,
-    (float)3.12185e-05,
-    (float)2.674e-05,
-    (float)2.89943e-05,
-    (float)3.14619e-05,
-    (float)2.4773e-05,
-    (float)1.97745e-05,
-    (float)2.7256e-05,
-    (float)2.23816e-05,
-    (float)2.01797e-05,
-    (float)1.7958e-05,
-    (float)1.90964e-05,
-    (float)1.99485e-05,
-    (float)1.67562e-05,
-    (float)1.24582e-05,
-    (float)1.77381e-05,
-    (float)1.6004e-05,
-    (float)1.19873e-05,
-    (float)1.11287e-05,
-    (float)1.37361e-05,
-    (float)1.30202e-05,
-    (float)8.56275e-06,
-    (float)8.57508e-06,
-    (float)1.28605e-05,
-    (float)8.205e-06,
-    (float)6.05681e-06,
-    (float)8.99686e-06,
-    (float)8.08519e-06,
-    (float)5.77257e-06,
-    (float)5.41598e-06,
-    (float)6.42007e-06,
-    (float)6.0783e-06,
-    (float)3.84333e-06,
-    (float)4.37399e-06,
-    (float)5.40477e-06,
-    (float)3.07182e-06,
-    (float)3.7614e-06,
-    (float)3.85682e-06,
-    (float)2.522e-06,
-    (float)3.41299e-06,
-    (float)3.34149e-06,
-    (float)1.94913e-06,
-    (float)2.79271e-06,
-    (float)2.86269e-06,
-    (float)2.64336e-06,
-    (float)1.75868e-06,
-    (float)1.99263e-06,
-    (float)3.7395e-06,
-    (float)1.81143e-06,
-    (float)9.18728e-07,
-    (float)3.83905e-06,
-    (float)2.52639e-06,
-    (float)9.78552e-07,
-    (float)2.25621e-06,
-    (float)2.98747e-06,
-    (float)1.88592e-06,
-    (float)1.40794e-06,
-    (float)2.06797e-06,
-    (float)3.4503e-06,
-    (float)1.07448e-06,
-    (float)1.51685e-06,
-    (float)3.81417e-06,
-    (float)0.00244921,
-    (float)0.423734,
-    (float)0.429206,
-    (float)0.0254496,
-    (float)0.0140823,
-    (float)0.051688,
-    (float)0.0130894,
-    (float)0.00436081,
-    (float)0.00701834,
-    (float)0.0035581,
-    (float)0.0038763,
-    (float)0.00395491,
-    (float)0.000265247,
-    (float)0.00308628,
-    (float)0.00220442,
-    (float)0.000467102,
-    (float)0.000875252,
-    (float)0.00118116,
-    (float)0.000912706,
-    (float)0.000564912,
-    (float)0.000187713,
-    (float)0.00105806,
-    (float)0.000612841,
-    (float)6.00124e-05,
-    (float)0.000502973,
-    (float)0.000651943,
-    (float)0.000121902,
-    (float)0.000208896,
-    (float)0.000343351,
-    (float)0.000278665,
-    (float)0.000171969,
-    (float)0.00011785,
-    (float)0.00029507,
-    (float)0.000189812,
-    (float)7.99003e-05,
-    (float)0.000186456,
-    (float)0.000169498,
-    (float)8.32642e-05,
-    (float)0.00015758,
-    (float)0.000100157,
-    (float)9.616e-05,
-    (float)0.000124148,
-    (float)9.57959e-05,
-    (float)7.61936e-05,
-    (float)9.68829e-05,
-    (float)8.54791e-05,
-    (float)9.69896e-05,
-    (float)5.54753e-05,
-    (float)7.61292e-05,
-    (float)0.000103533,
-    (float)5.61657e-05,
-    (float)5.22373e-05,
-    (float)9.17174e-05,
-    (float)6.25648e-05,
-    (float)5.3917e-05,
-    (float)5.89921e-05,
-    (float)6.13915e-05,
-    (float)6.24665e-05,
-    (float)4.61356e-05,
-    (float)4.74267e-05,
-    (float)5.9144e-05,
-    (float)4.58906e-05,
-    (float)4.18078e-05,
-    (float)4.53354e-05,
-    (float)3.96097e-05,
-    (float)4.623e-05,
-    (float)3.46393e-05,
-    (float)3.17219e-05,
-    (float)4.05188e-05,
-    (float)3.57149e-05,
-    (float)2.52808e-05,
-    (float)3.18304e-05,
-    (float)3.00244e-05,
-    (float)2.93812e-05,
-    (float)2.27228e-05,
-    (float)2.32446e-05,
-    (float)2.73436e-05,
-    (float)2.24726e-05,
-    (float)1.68637e-05,
-    (float)2.09169e-05,
-    (float)1.98558e-05,
-    (float)1.69245e-05,
-    (float)1.4009e-05,
-    (float)1.37841e-05,
-    (float)1.65469e-05,
-    (float)1.20973e-05,
-    (float)8.33502e-06,
-    (float)1.1543e-05,
-    (float)1.14544e-05,
-    (float)6.6248e-06,
-    (float)6.21188e-06,
-    (float)7.42842e-06,
-    (float)7.29749e-06,
-    (float)3.78125e-06,
-    (float)3.58205e-06,
-    (float)5.52105e-06,
-    (float)3.86663e-06,
-    (float)1.73924e-06,
-    (float)2.97723e-06,
-    (float)2.85531e-06,
-    (float)2.12048e-06,
-    (float)1.48451e-06,
-    (float)1.43885e-06,
-    (float)2.13026e-06,
-    (float)1.76766e-06,
-    (float)6.56609e-07,
-    (float)1.51431e-06,
-    (float)1.73931e-06,
-    (float)1.18535e-06,
-    (float)1.114e-06,
-    (float)1.08208e-06,
-    (float)1.97911e-06,
-    (float)1.81187e-06,
-    (float)6.51736e-07,
-    (float)2.00774e-06,
-    (float)2.69227e-06,
-    (float)9.62977e-07,
-    (float)1.80715e-06,
-    (float)2.56886e-06,
-    (float)1.90451e-06,
-    (float)2.02928e-06,
-    (float)1.95362e-06,
-    (float)2.65168e-06,
-    (float)2.51288e-06,
-    (float)1.58539e-06,
-    (float)2.8676e-06,
-    (float)2.90896e-06,
-    (float)1.34534e-06,
-    (float)0.00281506,
-    (float)0.360097,
-    (float)0.480329,
-    (float)0.0239443,
-    (float)0.0154386,
-    (float)0.0618624,
-    (float)0.013365,
-    (float)0.00396857,
-    (float)0.00865254,
-    (float)0.00440925,
-    (float)0.00345008,
-    (float)0.00394437,
-    (float)0.00037672,
-    (float)0.00337646,
-    (float)0.00223733,
-    (float)0.000282246,
-    (float)0.00113925,
-    (float)0.00148147,
-    (float)0.000600547,
-    (float)0.00052193,
-    (float)0.00037671,
-    (float)0.000957545,
-    (float)0.00043413,
-    (float)6.19122e-05,
-    (float)0.000670207,
-    (float)0.000563203,
-    (float)4.13475e-05,
-    (float)0.000273877,
-    (float)0.000444331,
-    (float)0.000130607,
-    (float)0.000134101,
-    (float)0.000179135,
-    (float)0.000237601,
-    (float)0.000123986,
-    (float)6.9299e-05,
-    (float)0.000186489,
-    (float)0.000151946,
-    (float)4.60169e-05,
-    (float)0.000136645,
-    (float)0.000108045,
-    (float)6.80333e-05,
-    (float)0.000104221,
-    (float)8.13652e-05,
-    (float)6.48277e-05,
-    (float)0.000105439,
-    (float)6.75833e-05,
-    (float)6.77584e-05,
-    (float)7.6012e-05,
-    (float)7.7191e-05,
-    (float)7.36411e-05,
-    (float)5.67222e-05,
-    (float)6.40697e-05,
-    (float)9.27758e-05,
-    (float)4.90539e-05,
-    (float)5.23329e-05,
-    (float)8.27872e-05,
-    (float)5.79328e-05,
-    (float)4.88423e-05,
-    (float)6.11235e-05,
-    (float)5.80469e-05,
-    (float)5.41575e-05,
-    (float)4.93248e-05,
-    (float)4.62713e-05,
-    (float)5.71294e-05,
-    (float)4.43854e-05,
-    (float)4.19206e-05,
-    (float)4.45386e-05,
-    (float)4.44797e-05,
-    (float)3.98806e-05,
-    (float)3.76947e-05,
-    (float)3.37824e-05,
-    (float)4.16884e-05,
-    (float)3.27431e-05,
-    (float)2.73541e-05,
-    (float)3.28298e-05,
-    (float)3.24039e-05,
-    (float)2.32411e-05,
-    (float)2.49294e-05,
-    (float)2.57714e-05,
-    (float)2.23263e-05,
-    (float)1.97306e-05,
-    (float)1.83331e-05,
-    (float)1.78539e-05,
-    (float)1.61572e-05,
-    (float)1.40469e-05,
-    (float)1.16472e-05,
-    (float)1.23224e-05,
-    (float)1.03762e-05,
-    (float)9.04033e-06,
-    (float)6.87969e-06,
-    (float)7.27859e-06,
-    (float)6.96346e-06,
-    (float)4.66102e-06,
-    (float)3.04264e-06,
-    (float)5.3797e-06,
-    (float)3.30661e-06,
-    (float)1.44574e-06,
-    (float)2.40068e-06,
-    (float)2.66825e-06,
-    (float)9.32681e-07,
-    (float)9.01307e-07,
-    (float)1.12182e-06,
-    (float)9.19537e-07,
-    (float)4.13253e-07,
-    (float)3.75651e-07,
-    (float)6.11262e-07,
-    (float)6.4543e-07,
-    (float)1.31515e-07,
-    (float)4.89448e-07,
-    (float)1.25543e-06,
-    (float)2.67242e-07,
-    (float)4.7638e-07,
-    (float)2.16664e-06,
-    (float)6.80079e-07,
-    (float)7.90657e-07,
-    (float)2.08585e-06,
-    (float)1.5291e-06,
-    (float)1.72897e-06,
-    (float)1.51436e-06,
-    (float)2.00884e-06,
-    (float)3.06656e-06,
-    (float)1.45974e-06,
-    (float)1.78213e-06,
-    (float)4.03919e-06,
-    (float)1.83631e-06,
-    (float)2.24946e-06,
-    (float)3.10851e-06,
-    (float)2.41786e-06,
-    (float)0.00315425,
-    (float)0.300834,
-    (float)0.526774,
-    (float)0.0218283,
-    (float)0.0165573,
-    (float)0.0728247,
-    (float)0.0132691,
-    (float)0.00380226,
-    (float)0.0108266,
-    (float)0.0052955,
-    (float)0.00286379,
-    (float)0.0040357,
-    (float)0.000603027,
-    (float)0.00342568,
-    (float)0.00216404,
-    (float)0.000205224,
-    (float)0.00147977,
-    (float)0.00165959,
-    (float)0.000361403,
-    (float)0.000589081,
-    (float)0.000656779,
-    (float)0.000697115,
-    (float)0.00031699,
-    (float)0.000138552,
-    (float)0.00072258,
-    (float)0.000387618,
-    (float)2.76313e-05,
-    (float)0.000391822,
-    (float)0.000432302,
-    (float)3.2754e-05,
-    (float)0.000157466,
-    (float)0.000262197,
-    (float)0.00011776,
-    (float)7.61049e-05,
-    (float)0.000106422,
-    (float)0.00015411,
-    (float)9.71102e-05,
-    (float)3.24503e-05,
-    (float)0.00013862,
-    (float)9.90493e-05,
-    (float)3.62222e-05,
-    (float)9.0385e-05,
-    (float)8.93121e-05,
-    (float)4.51749e-05,
-    (float)9.30756e-05,
-    (float)5.83666e-05,
-    (float)5.91905e-05,
-    (float)8.62486e-05,
-    (float)6.19117e-05,
-    (float)5.53201e-05,
-    (float)7.79037e-05,
-    (float)6.44995e-05,
-    (float)6.6398e-05,
-    (float)5.7272e-05,
-    (float)6.39658e-05,
-    (float)8.03399e-05,
-    (float)4.62186e-05,
-    (float)5.56935e-05,
-    (float)8.13537e-05,
-    (float)4.96267e-05,
-    (float)4.72922e-05,
-    (float)7.03018e-05,
-    (float)5.04212e-05,
-    (float)5.1677e-05,
-    (float)5.22148e-05,
-    (float)4.94374e-05,
-    (float)5.20505e-05,
-    (float)4.70511e-05,
-    (float)3.9755e-05,
-    (float)5.1886e-05,
-    (float)4.08018e-05,
-    (float)3.7679e-05,
-    (float)4.08444e-05,
-    (float)3.75826e-05,
-    (float)3.48481e-05,
-    (float)3.26213e-05,
-    (float)2.97986e-05,
-    (float)3.28582e-05,
-    (float)2.56467e-05,
-    (float)2.17162e-05,
-    (float)2.81393e-05,
-    (float)1.97464e-05,
-    (float)1.59326e-05,
-    (float)2.1073e-05,
-    (float)1.60975e-05,
-    (float)1.04195e-05,
-    (float)1.57964e-05,
-    (float)1.1845e-05,
-    (float)8.06561e-06,
-    (float)8.6967e-06,
-    (float)9.56754e-06,
-    (float)5.66747e-06,
-    (float)4.86325e-06,
-    (float)5.13963e-06,
-    (float)5.255e-06,
-    (float)2.39674e-06,
-    (float)2.19202e-06,
-    (float)3.54447e-06,
-    (float)1.5983e-06,
-    (float)5.48248e-07,
-    (float)1.59045e-06,
-    (float)8.61645e-07,
-    (float)1.00853e-07,
-    (float)3.75879e-07,
-    (float)5.21132e-08,
-    (float)8.27232e-08,
-    (float)6.75148e-09,
-    (float)5.00912e-07,
-    (float)8.37541e-08,
-    (float)8.73847e-08,
-    (float)1.36748e-06,
-    (float)7.82958e-07,
-    (float)3.5394e-07,
-    (float)1.06392e-06,
-    (float)2.01205e-06,
-    (float)1.04179e-06,
-    (float)9.34564e-07,
-    (float)2.01498e-06,
-    (float)2.89427e-06,
-    (float)1.43163e-06,
-    (float)1.41698e-06,
-    (float)4.00917e-06,
-    (float)2.43034e-06,
-    (float)1.64974e-06,
-    (float)3.22017e-06,
-    (float)3.36651e-06,
-    (float)2.25126e-06,
-    (float)3.11412e-06,
-    (float)0.00341874,
-    (float)0.247103,
-    (float)0.567392,
-    (float)0.0193392,
-    (float)0.0173279,
-    (float)0.0842059,
-    (float)0.0127711,
-    (float)0.00398659,
-    (float)0.0136642,
-    (float)0.00611577,
-    (float)0.00229219,
-    (float)0.00432153,
-    (float)0.000995157,
-    (float)0.00315763,
-    (float)0.00204061,
-    (float)0.000220555,
-    (float)0.00180316,
-    (float)0.0016396,
-    (float)0.00025134,
-    (float)0.000777856,
-    (float)0.000910885,
-    (float)0.000414811,
-    (float)0.000298946,
-    (float)0.000310136,
-    (float)0.000584795,
-    (float)0.000231974,
-    (float)6.37217e-05,
-    (float)0.000459677,
-    (float)0.000295797,
-    (float)1.30217e-05,
-    (float)0.000235909,
-    (float)0.00026905,
-    (float)2.89197e-05,
-    (float)7.66022e-05,
-    (float)0.000170361,
-    (float)7.09097e-05,
-    (float)5.38224e-05,
-    (float)5.54565e-05,
-    (float)0.000115289,
-    (float)6.16855e-05,
-    (float)2.64269e-05,
-    (float)9.12316e-05,
-    (float)8.52642e-05,
-    (float)2.49351e-05,
-    (float)7.78489e-05,
-    (float)7.17153e-05,
-    (float)4.40403e-05,
-    (float)7.28092e-05,
-    (float)5.90753e-05,
-    (float)5.31254e-05,
-    (float)8.26593e-05,
-    (float)5.28713e-05,
-    (float)5.54523e-05,
-    (float)7.74871e-05,
-    (float)6.01072e-05,
-    (float)5.75987e-05,
-    (float)6.4241e-05,
-    (float)6.38299e-05,
-    (float)6.53957e-05,
-    (float)5.46212e-05,
-    (float)5.84349e-05,
-    (float)7.45423e-05,
-    (float)4.74561e-05,
-    (float)5.54027e-05,
-    (float)6.74967e-05,
-    (float)5.17154e-05,
-    (float)4.77268e-05,
-    (float)6.02018e-05,
-    (float)4.88735e-05,
-    (float)4.8362e-05,
-    (float)4.7622e-05,
-    (float)4.55376e-05,
-    (float)4.5061e-05,
-    (float)4.07216e-05,
-    (float)3.69174e-05,
-    (float)4.02474e-05,
-    (float)3.5242e-05,
-    (float)2.8611e-05,
-    (float)3.28221e-05,
-    (float)2.98502e-05,
-    (float)2.30069e-05,
-    (float)2.33338e-05,
-    (float)2.56468e-05,
-    (float)1.7681e-05,
-    (float)1.70048e-05,
-    (float)1.78621e-05,
-    (float)1.57734e-05,
-    (float)1.12256e-05,
-    (float)1.13037e-05,
-    (float)1.26661e-05,
-    (float)9.38233e-06,
-    (float)5.1681e-06,
-    (float)9.32713e-06,
-    (float)7.76846e-06,
-    (float)2.56369e-06,
-    (float)4.69082e-06,
-    (float)5.49841e-06,
-    (float)1.86351e-06,
-    (float)1.70175e-06,
-    (float)2.27942e-06,
-    (float)1.61363e-06,
-    (float)7.96637e-07,
-    (float)1.44529e-07,
-    (float)1.05027e-06,
-    (float)5.40108e-07,
-    (float)1.36575e-07,
-    (float)9.93862e-08,
-    (float)4.17016e-07,
-    (float)8.21941e-07,
-    (float)3.07831e-07,
-    (float)3.44407e-07,
-    (float)1.00161e-06,
-    (float)1.01008e-06,
-    (float)1.38484e-06,
-    (float)1.24481e-06,
-    (float)1.03317e-06,
-    (float)3.16236e-06,
-    (float)1.54899e-06,
-    (float)1.17069e-06,
-    (float)3.54517e-06,
-    (float)2.57077e-06,
-    (float)2.00491e-06,
-    (float)2.75607e-06,
-    (float)3.24042e-06,
-    (float)3.25423e-06,
-    (float)2.49007e-06,
-    (float)2.51892e-06,
-    (float)4.45363e-06,
-    (float)0.00363238,
-    (float)0.199637,
-    (float)0.601359,
-    (float)0.0166227,
-    (float)0.0177056,
-    (float)0.0957085,
-    (float)0.0118462,
-    (float)0.00450668,
-    (float)0.0172821,
-    (float)0.00671096,
-    (float)0.00191616,
-    (float)0.00494111,
-    (float)0.00154565,
-    (float)0.00260314,
-    (float)0.00198734,
-    (float)0.000330527,
-    (float)0.00193824,
-    (float)0.00148854,
-    (float)0.000229561,
-    (float)0.00103019,
-    (float)0.00101224,
-    (float)0.000256396,
-    (float)0.00038732,
-    (float)0.000504789,
-    (float)0.000362407,
-    (float)0.000173273,
-    (float)0.0001563,
-    (float)0.00037975,
-    (float)0.000161247,
-    (float)2.7351e-05,
-    (float)0.000293103,
-    (float)0.000178106,
-    (float)1.19433e-05,
-    (float)0.000125028,
-    (float)0.000181968,
-    (float)9.83066e-06,
-    (float)5.23356e-05,
-    (float)0.000103916,
-    (float)4.62637e-05,
-    (float)3.18608e-05,
-    (float)4.83738e-05,
-    (float)7.34772e-05,
-    (float)5.26556e-05,
-    (float)2.05843e-05,
-    (float)8.12605e-05,
-    (float)6.86255e-05,
-    (float)2.47492e-05,
-    (float)6.78469e-05,
-    (float)7.56036e-05,
-    (float)3.55962e-05,
-    (float)6.86327e-05,
-    (float)6.40524e-05,
-    (float)5.03234e-05,
-    (float)7.40708e-05,
-    (float)5.47698e-05,
-    (float)5.90759e-05,
-    (float)7.72345e-05,
-    (float)5.46432e-05,
-    (float)5.80574e-05,
-    (float)7.76356e-05,
-    (float)5.51238e-05,
-    (float)6.1139e-05,
-    (float)6.73374e-05,
-    (float)5.93244e-05,
-    (float)6.12095e-05,
-    (float)5.90046e-05,
-    (float)5.73832e-05,
-    (float)6.38565e-05,
-    (float)4.79444e-05,
-    (float)5.49579e-05,
-    (float)5.9488e-05,
-    (float)4.18969e-05,
-    (float)4.70941e-05,
-    (float)5.37231e-05,
-    (float)3.65126e-05,
-    (float)3.88835e-05,
-    (float)4.47398e-05,
-    (float)3.20369e-05,
-    (float)3.2959e-05,
-    (float)3.299e-05,
-    (float)2.85531e-05,
-    (float)2.75909e-05,
-    (float)2.44603e-05,
-    (float)2.17044e-05,
-    (float)2.47408e-05,
-    (float)1.76434e-05,
-    (float)1.59366e-05,
-    (float)1.88576e-05,
-    (float)1.47512e-05,
-    (float)1.07905e-05,
-    (float)1.24159e-05,
-    (float)1.14577e-05,
-    (float)8.45092e-06,
-    (float)6.52048e-06,
-    (float)7.19798e-06,
-    (float)7.10345e-06,
-    (float)3.3718e-06,
-    (float)3.52864e-06,
-    (float)4.83887e-06,
-    (float)2.61527e-06,
-    (float)1.57503e-06,
-    (float)2.3722e-06,
-    (float)1.90092e-06,
-    (float)1.49707e-06,
-    (float)5.80845e-07,
-    (float)1.0957e-06,
-    (float)1.32881e-06,
-    (float)6.52488e-07,
-    (float)6.92719e-07,
-    (float)6.60979e-07,
-    (float)1.53996e-06,
-    (float)1.35551e-06,
-    (float)4.88049e-07,
-    (float)1.76884e-06,
-    (float)2.59773e-06,
-    (float)1.24032e-06,
-    (float)1.95753e-06,
-    (float)2.74726e-06,
-    (float)2.50337e-06,
-    (float)2.60181e-06,
-    (float)2.25653e-06,
-    (float)3.27326e-06,
-    (float)3.548e-06,
-    (float)2.37188e-06,
-    (float)3.02653e-06,
-    (float)4.04877e-06,
-    (float)3.17808e-06,
-    (float)2.92262e-06,
-    (float)0.00381445,
-    (float)0.158778,
-    (float)0.628189,
-    (float)0.0138464,
-    (float)0.017711,
-    (float)0.106949,
-    (float)0.0105778,
-    (float)0.00531025,
-    (float)0.0216631,
-    (float)0.00698094,
-    (float)0.00190393,
-    (float)0.00597796,
-    (float)0.00218447,
-    (float)0.00197552,
-    (float)0.00205946,
-    (float)0.000566881,
-    (float)0.00180803,
-    (float)0.00131538,
-    (float)0.000247934,
-    (float)0.00121732,
-    (float)0.000953073,
-    (float)0.000226429,
-    (float)0.000544843,
-    (float)0.000612212,
-    (float)0.000226521,
-    (float)0.00019342,
-    (float)0.000289318,
-    (float)0.000219344,
-    (float)9.62245e-05,
-    (float)7.40967e-05,
-    (float)0.000245463,
-    (float)7.55282e-05,
-    (float)2.38965e-05,
-    (float)0.000168451,
-    (float)0.000111376,
-    (float)8.82508e-06,
-    (float)9.03038e-05,
-    (float)0.000114561,
-    (float)3.14103e-06,
-    (float)3.4168e-05,
-    (float)9.29911e-05,
-    (float)2.2816e-05,
-    (float)2.81063e-05,
-    (float)4.85405e-05,
-    (float)6.04978e-05,
-    (float)3.94662e-05,
-    (float)2.74518e-05,
-    (float)7.61192e-05,
-    (float)6.25943e-05,
-    (float)2.30717e-05,
-    (float)7.42225e-05,
-    (float)7.58593e-05,
-    (float)3.1943e-05,
-    (float)6.87076e-05,
-    (float)7.40758e-05,
-    (float)4.8723e-05,
-    (float)6.76297e-05,
-    (float)6.54797e-05,
-    (float)6.23687e-05,
-    (float)7.3901e-05,
-    (float)5.34056e-05,
-    (float)7.05981e-05,
-    (float)7.6393e-05,
-    (float)5.0885e-05,
-    (float)6.34982e-05,
-    (float)7.9769e-05,
-    (float)5.03999e-05,
-    (float)5.48566e-05,
-    (float)7.29821e-05,
-    (float)5.49809e-05,
-    (float)4.63203e-05,
-    (float)5.93688e-05,
-    (float)5.79131e-05,
-    (float)4.16941e-05,
-    (float)4.41601e-05,
-    (float)5.35387e-05,
-    (float)4.06554e-05,
-    (float)3.1846e-05,
-    (float)4.31883e-05,
-    (float)3.91774e-05,
-    (float)2.70011e-05,
-    (float)2.89975e-05,
-    (float)3.61799e-05,
-    (float)2.47793e-05,
-    (float)1.964e-05,
-    (float)2.7638e-05,
-    (float)2.31761e-05,
-    (float)1.44783e-05,
-    (float)1.88861e-05,
-    (float)1.78811e-05,
-    (float)1.2519e-05,
-    (float)1.2752e-05,
-    (float)1.0614e-05,
-    (float)1.08838e-05,
-    (float)9.45048e-06,
-    (float)5.48738e-06,
-    (float)7.69348e-06,
-    (float)7.79825e-06,
-    (float)3.12777e-06,
-    (float)4.75156e-06,
-    (float)5.49218e-06,
-    (float)2.37382e-06,
-    (float)3.04335e-06,
-    (float)3.33034e-06,
-    (float)1.5805e-06,
-    (float)2.45797e-06,
-    (float)2.58001e-06,
-    (float)8.34338e-07,
-    (float)1.74077e-06,
-    (float)3.7073e-06,
-    (float)6.87094e-07,
-    (float)8.58338e-07,
-    (float)4.97902e-06,
-    (float)1.34141e-06,
-    (float)8.15815e-07,
-    (float)4.52546e-06,
-    (float)2.43754e-06,
-    (float)1.66883e-06,
-    (float)3.49573e-06,
-    (float)2.86147e-06,
-    (float)2.91921e-06,
-    (float)3.42816e-06,
-    (float)2.56797e-06,
-    (float)3.85773e-06,
-    (float)4.05557e-06,
-    (float)2.81488e-06,
-    (float)3.62167e-06,
-    (float)4.46129e-06,
-    (float)0.00392674,
-    (float)0.124243,
-    (float)0.648555,
-    (float)0.0113022,
-    (float)0.017218,
-    (float)0.117364,
-    (float)0.00911783,
-    (float)0.00622325,
-    (float)0.0266332,
-    (float)0.00685879,
-    (float)0.00234936,
-    (float)0.0075175,
-    (float)0.00278125,
-    (float)0.00155686,
-    (float)0.00233424,
-    (float)0.000939476,
-    (float)0.00147232,
-    (float)0.00121833,
-    (float)0.000308863,
-    (float)0.00119944,
-    (float)0.000815243,
-    (float)0.000240483,
-    (float)0.000693332,
-    (float)0.000566768,
-    (float)0.000226008,
-    (float)0.000280107,
-    (float)0.000361872,
-    (float)0.000135275,
-    (float)0.000105592,
-    (float)0.000149829,
-    (float)0.000123334,
-    (float)3.65678e-05,
-    (float)4.77594e-05,
-    (float)0.000119897,
-    (float)3.53309e-05,
-    (float)1.3153e-05,
-    (float)0.00011033,
-    (float)5.54563e-05,
-    (float)4.78174e-06,
-    (float)6.63898e-05,
-    (float)8.74321e-05,
-    (float)3.61201e-07,
-    (float)3.86205e-05,
-    (float)8.66809e-05,
-    (float)1.27504e-05,
-    (float)2.74798e-05,
-    (float)6.91764e-05,
-    (float)4.14441e-05,
-    (float)3.56012e-05,
-    (float)4.64945e-05,
-    (float)6.87193e-05,
-    (float)5.20505e-05,
-    (float)3.43487e-05,
-    (float)8.02623e-05,
-    (float)7.02557e-05,
-    (float)3.498e-05,
-    (float)7.42475e-05,
-    (float)8.51415e-05,
-    (float)4.21359e-05,
-    (float)6.84712e-05,
-    (float)8.2918e-05,
-    (float)5.81828e-05,
-    (float)6.1925e-05,
-    (float)7.3099e-05,
-    (float)7.02619e-05,
-    (float)6.28732e-05,
-    (float)5.691e-05,
-    (float)7.43698e-05,
-    (float)6.53899e-05,
-    (float)4.51345e-05,
-    (float)6.61603e-05,
-    (float)6.78883e-05,
-    (float)3.98458e-05,
-    (float)5.05217e-05,
-    (float)6.62396e-05,
-    (float)3.91978e-05,
-    (float)3.81218e-05,
-    (float)5.47766e-05,
-    (float)4.25428e-05,
-    (float)2.96781e-05,
-    (float)4.0767e-05,
-    (float)4.14133e-05,
-    (float)2.73232e-05,
-    (float)2.74999e-05,
-    (float)3.49621e-05,
-    (float)2.61839e-05,
-    (float)1.96848e-05,
-    (float)2.48857e-05,
-    (float)2.31771e-05,
-    (float)1.63677e-05,
-    (float)1.60455e-05,
-    (float)1.75689e-05,
-    (float)1.41984e-05,
-    (float)1.14365e-05,
-    (float)1.07776e-05,
-    (float)1.19151e-05,
-    (float)8.824e-06,
-    (float)6.54942e-06,
-    (float)8.41306e-06,
-    (float)6.94375e-06,
-    (float)4.56949e-06,
-    (float)5.7907e-06,
-    (float)4.62745e-06,
-    (float)3.57052e-06,
-    (float)4.93071e-06,
-    (float)2.6092e-06,
-    (float)2.73423e-06,
-    (float)4.52575e-06,
-    (float)2.22573e-06,
-    (float)1.9303e-06,
-    (float)3.64611e-06,
-    (float)3.06143e-06,
-    (float)2.00008e-06,
-    (float)2.31222e-06,
-    (float)3.74602e-06,
-    (float)2.99736e-06,
-    (float)1.7173e-06,
-    (float)3.64398e-06,
-    (float)3.83024e-06,
-    (float)2.59464e-06,
-    (float)3.20164e-06,
-    (float)3.73242e-06,
-    (float)4.09482e-06,
-    (float)3.5552e-06,
-    (float)2.74752e-06,
-    (float)4.88329e-06,
-    (float)4.55826e-06,
-    (float)2.12785e-06,
-    (float)0.00400461,
-    (float)0.0954896,
-    (float)0.662354,
-    (float)0.00897509,
-    (float)0.0163668,
-    (float)0.126957,
-    (float)0.00753324,
-    (float)0.00713389,
-    (float)0.0322275,
-    (float)0.00632471,
-    (float)0.00318766,
-    (float)0.00970956,
-    (float)0.003175,
-    (float)0.00155951,
-    (float)0.00291659,
-    (float)0.00137763,
-    (float)0.00117491,
-    (float)0.00124698,
-    (float)0.00045989,
-    (float)0.000992225,
-    (float)0.000704411,
-    (float)0.000244735,
-    (float)0.000724541,
-    (float)0.000442032,
-    (float)0.000248683,
-    (float)0.000380465,
-    (float)0.000312042,
-    (float)0.000172594,
-    (float)0.0001634,
-    (float)0.000180786,
-    (float)9.21208e-05,
-    (float)4.77449e-05,
-    (float)9.21188e-05,
-    (float)4.75401e-05,
-    (float)1.62217e-05,
-    (float)2.78836e-05,
-    (float)5.82055e-05,
-    (float)1.20456e-05,
-    (float)7.04162e-06,
-    (float)6.97706e-05,
-    (float)3.40202e-05,
-    (float)2.10516e-06,
-    (float)7.02293e-05,
-    (float)6.15327e-05,
-    (float)1.80167e-07,
-    (float)5.54588e-05,
-    (float)8.45158e-05,
-    (float)5.89928e-06,
-    (float)4.44577e-05,
-    (float)8.6448e-05,
-    (float)2.53728e-05,
-    (float)4.20794e-05,
-    (float)7.33531e-05,
-    (float)5.55357e-05,
-    (float)4.64025e-05,
-    (float)5.94352e-05,
-    (float)7.88517e-05,
-    (float)5.92954e-05,
-    (float)4.64798e-05,
-    (float)9.15806e-05,
-    (float)7.07602e-05,
-    (float)4.37489e-05,
-    (float)8.50561e-05,
-    (float)8.14993e-05,
-    (float)4.61516e-05,
-    (float)7.24404e-05,
-    (float)8.13162e-05,
-    (float)5.44614e-05,
-    (float)5.87044e-05,
-    (float)7.14825e-05,
-    (float)6.4407e-05,
-    (float)4.90227e-05,
-    (float)5.77403e-05,
-    (float)6.74625e-05,
-    (float)4.65683e-05,
-    (float)4.34039e-05,
-    (float)6.36404e-05,
-    (float)4.57303e-05,
-    (float)3.58854e-05,
-    (float)5.02964e-05,
-    (float)4.55938e-05,
-    (float)3.22391e-05,
-    (float)3.6151e-05,
-    (float)4.05791e-05,
-    (float)3.08825e-05,
-    (float)2.51954e-05,
-    (float)3.18834e-05,
-    (float)2.89306e-05,
-    (float)1.85321e-05,
-    (float)2.36814e-05,
-    (float)2.35096e-05,
-    (float)1.54669e-05,
-    (float)1.76048e-05,
-    (float)1.72535e-05,
-    (float)1.21599e-05,
-    (float)1.51233e-05,
-    (float)1.11371e-05,
-    (float)8.75342e-06,
-    (float)1.31185e-05,
-    (float)7.78252e-06,
-    (float)5.52744e-06,
-    (float)1.00503e-05,
-    (float)6.76906e-06,
-    (float)3.51029e-06,
-    (float)6.73628e-06,
-    (float)5.9405e-06,
-    (float)3.35022e-06,
-    (float)3.95808e-06,
-    (float)4.88397e-06,
-    (float)3.68849e-06,
-    (float)3.15582e-06,
-    (float)3.6684e-06,
-    (float)3.62353e-06,
-    (float)3.64655e-06,
-    (float)3.33436e-06,
-    (float)3.0736e-06,
-    (float)3.9313e-06,
-    (float)4.31913e-06,
-    (float)2.45216e-06,
-    (float)3.80056e-06,
-    (float)5.1516e-06,
-    (float)2.86952e-06,
-    (float)3.24932e-06,
-    (float)5.01505e-06,
-    (float)3.92504e-06,
-    (float)3.20805e-06,
-    (float)4.17518e-06,
-    (float)4.32766e-06,
-    (float)0.00410281,
-    (float)0.0720632,
-    (float)0.670308,
-    (float)0.00697545,
-    (float)0.0151745,
-    (float)0.135251,
-    (float)0.00597898,
-    (float)0.00788241,
-    (float)0.0380824,
-    (float)0.00547859,
-    (float)0.00427273,
-    (float)0.0125156,
-    (float)0.00327888,
-    (float)0.0020827,
-    (float)0.00391652,
-    (float)0.00177212,
-    (float)0.00118743,
-    (float)0.00145917,
-    (float)0.000726876,
-    (float)0.000763082,
-    (float)0.000676552,
-    (float)0.000298274,
-    (float)0.000583265,
-    (float)0.000351745,
-    (float)0.000226482,
-    (float)0.00037678,
-    (float)0.000217727,
-    (float)0.000201673,
-    (float)0.000214329,
-    (float)0.000134553,
-    (float)0.000149305,
-    (float)8.37325e-05,
-    (float)0.000101616,
-    (float)6.91515e-05,
-    (float)2.75145e-05,
-    (float)6.33619e-05,
-    (float)1.74756e-05,
-    (float)5.86279e-06,
-    (float)3.65665e-05,
-    (float)1.70285e-05,
-    (float)7.11478e-06,
-    (float)1.51402e-05,
-    (float)4.59304e-05,
-    (float)1.969e-05,
-    (float)6.084e-06,
-    (float)7.00461e-05,
-    (float)4.54479e-05,
-    (float)4.01184e-06,
-    (float)7.75212e-05,
-    (float)7.38147e-05,
-    (float)6.20258e-06,
-    (float)7.23662e-05,
-    (float)9.55498e-05,
-    (float)1.64896e-05,
-    (float)5.96583e-05,
-    (float)0.000106472,
-    (float)3.38042e-05,
-    (float)5.2541e-05,
-    (float)9.8536e-05,
-    (float)5.90969e-05,
-    (float)4.75193e-05,
-    (float)8.51009e-05,
-    (float)7.90224e-05,
-    (float)5.01247e-05,
-    (float)6.77678e-05,
-    (float)8.92884e-05,
-    (float)5.6066e-05,
-    (float)5.51444e-05,
-    (float)8.56962e-05,
-    (float)6.29536e-05,
-    (float)5.01414e-05,
-    (float)7.07282e-05,
-    (float)6.85531e-05,
-    (float)4.87166e-05,
-    (float)5.54926e-05,
-    (float)6.53275e-05,
-    (float)5.17733e-05,
-    (float)4.1644e-05,
-    (float)5.72269e-05,
-    (float)5.23162e-05,
-    (float)3.40224e-05,
-    (float)4.47597e-05,
-    (float)4.9538e-05,
-    (float)2.97109e-05,
-    (float)3.42601e-05,
-    (float)4.24536e-05,
-    (float)2.60177e-05,
-    (float)2.8508e-05,
-    (float)3.2344e-05,
-    (float)2.27498e-05,
-    (float)2.41891e-05,
-    (float)2.48335e-05,
-    (float)1.75019e-05,
-    (float)2.06021e-05,
-    (float)1.98326e-05,
-    (float)1.28106e-05,
-    (float)1.53278e-05,
-    (float)1.76537e-05,
-    (float)8.97916e-06,
-    (float)9.81159e-06,
-    (float)1.57451e-05,
-    (float)7.19841e-06,
-    (float)5.91179e-06,
-    (float)1.18704e-05,
-    (float)7.42e-06,
-    (float)3.58634e-06,
-    (float)8.0408e-06,
-    (float)7.26211e-06,
-    (float)3.23303e-06,
-    (float)5.13738e-06,
-    (float)6.42013e-06,
-    (float)3.58717e-06,
-    (float)4.21111e-06,
-    (float)5.15076e-06,
-    (float)3.6739e-06,
-    (float)4.8037e-06,
-    (float)4.23839e-06,
-    (float)3.55432e-06,
-    (float)4.97781e-06,
-    (float)4.65041e-06,
-    (float)3.00271e-06,
-    (float)4.64282e-06,
-    (float)5.1766e-06,
-    (float)3.11961e-06,
-    (float)4.03942e-06,
-    (float)4.85066e-06,
-    (float)4.09423e-06,
-    (float)3.55208e-06,
-    (float)0.0041227,
-    (float)0.0531864,
-    (float)0.673393,
-    (float)0.0054677,
-    (float)0.0137054,
-    (float)0.141913,
-    (float)0.00466583,
-    (float)0.00830783,
-    (float)0.0438057,
-    (float)0.0044713,
-    (float)0.00536572,
-    (float)0.0158189,
-    (float)0.00301912,
-    (float)0.00307176,
-    (float)0.00545414,
-    (float)0.00189885,
-    (float)0.00176603,
-    (float)0.00197783,
-    (float)0.000952745,
-    (float)0.000908503,
-    (float)0.000774659,
-    (float)0.000406541,
-    (float)0.00052097,
-    (float)0.000336318,
-    (float)0.000196875,
-    (float)0.000296464,
-    (float)0.000168465,
-    (float)0.000143684,
-    (float)0.000190495,
-    (float)7.56644e-05,
-    (float)0.000143622,
-    (float)0.00010623,
-    (float)4.74719e-05,
-    (float)0.000117339,
-    (float)5.79331e-05,
-    (float)4.32086e-05,
-    (float)6.21113e-05,
-    (float)2.58846e-05,
-    (float)5.21545e-05,
-    (float)1.8704e-05,
-    (float)1.45716e-05,
-    (float)5.08989e-05,
-    (float)3.29173e-06,
-    (float)1.25981e-05,
-    (float)4.45351e-05,
-    (float)2.0062e-05,
-    (float)1.88059e-05,
-    (float)3.4418e-05,
-    (float)5.19104e-05,
-    (float)3.02894e-05,
-    (float)2.65713e-05,
-    (float)8.28829e-05,
-    (float)4.63883e-05,
-    (float)2.49629e-05,
-    (float)9.80219e-05,
-    (float)6.62399e-05,
-    (float)2.66191e-05,
-    (float)0.000101109,
-    (float)8.07718e-05,
-    (float)3.41473e-05,
-    (float)9.05473e-05,
-    (float)9.01378e-05,
-    (float)4.44408e-05,
-    (float)7.76212e-05,
-    (float)8.83006e-05,
-    (float)5.67136e-05,
-    (float)6.5856e-05,
-    (float)7.90734e-05,
-    (float)6.87188e-05,
-    (float)5.74593e-05,
-    (float)6.74974e-05,
-    (float)7.43853e-05,
-    (float)5.43691e-05,
-    (float)5.59559e-05,
-    (float)7.41177e-05,
-    (float)5.17015e-05,
-    (float)4.98819e-05,
-    (float)6.48708e-05,
-    (float)4.94153e-05,
-    (float)4.69598e-05,
-    (float)5.24038e-05,
-    (float)4.43518e-05,
-    (float)4.57897e-05,
-    (float)4.03739e-05,
-    (float)3.67971e-05,
-    (float)4.40975e-05,
-    (float)3.14911e-05,
-    (float)2.90357e-05,
-    (float)3.86619e-05,
-    (float)2.68944e-05,
-    (float)2.20408e-05,
-    (float)3.13102e-05,
-    (float)2.30981e-05,
-    (float)1.86408e-05,
-    (float)2.22458e-05,
-    (float)1.91775e-05,
-    (float)1.77428e-05,
-    (float)1.46116e-05,
-    (float)1.43122e-05,
-    (float)1.76024e-05,
-    (float)9.71782e-06,
-    (float)9.28316e-06,
-    (float)1.67164e-05,
-    (float)7.24678e-06,
-    (float)6.06855e-06,
-    (float)1.34813e-05,
-    (float)6.6045e-06,
-    (float)4.74624e-06,
-    (float)9.61564e-06,
-    (float)5.96444e-06,
-    (float)5.10007e-06,
-    (float)6.27821e-06,
-    (float)4.902e-06,
-    (float)6.00138e-06,
-    (float)4.47063e-06,
-    (float)3.98396e-06,
-    (float)6.0096e-06,
-    (float)4.27325e-06,
-    (float)3.58384e-06,
-    (float)5.34734e-06,
-    (float)4.36061e-06,
-    (float)4.20948e-06,
-    (float)4.26366e-06,
-    (float)4.18086e-06,
-    (float)5.22433e-06,
-    (float)3.59691e-06,
-    (float)3.8164e-06,
-    (float)5.56344e-06,
-    (float)0.00419025,
-    (float)0.0382895,
-    (float)0.671841,
-    (float)0.00437595,
-    (float)0.0120959,
-    (float)0.146913,
-    (float)0.00364164,
-    (float)0.00840157,
-    (float)0.0491294,
-    (float)0.00350351,
-    (float)0.00625535,
-    (float)0.0194051,
-    (float)0.00256096,
-    (float)0.0042296,
-    (float)0.0075075,
-    (float)0.0017848,
-    (float)0.00278413,
-    (float)0.0029003,
-    (float)0.00106192,
-    (float)0.0015807,
-    (float)0.0010717,
-    (float)0.000543552,
-    (float)0.000841158,
-    (float)0.000388999,
-    (float)0.000249662,
-    (float)0.000379435,
-    (float)0.000156667,
-    (float)0.000106887,
-    (float)0.00016329,
-    (float)5.84394e-05,
-    (float)7.14276e-05,
-    (float)7.0421e-05,
-    (float)1.91182e-05,
-    (float)6.76608e-05,
-    (float)4.63572e-05,
-    (float)7.48209e-06,
-    (float)5.92686e-05,
-    (float)4.14395e-05,
-    (float)1.99676e-05,
-    (float)4.24031e-05,
-    (float)4.2683e-05,
-    (float)4.22306e-05,
-    (float)1.8859e-05,
-    (float)4.02169e-05,
-    (float)6.56715e-05,
-    (float)5.48092e-06,
-    (float)3.73959e-05,
-    (float)7.93946e-05,
-    (float)7.12289e-06,
-    (float)3.52081e-05,
-    (float)8.26028e-05,
-    (float)2.53738e-05,
-    (float)3.41186e-05,
-    (float)7.98007e-05,
-    (float)5.10864e-05,
-    (float)3.66114e-05,
-    (float)7.20537e-05,
-    (float)7.78e-05,
-    (float)3.98759e-05,
-    (float)6.70579e-05,
-    (float)9.48396e-05,
-    (float)4.55122e-05,
-    (float)6.47501e-05,
-    (float)0.000101127,
-    (float)5.09798e-05,
-    (float)6.6088e-05,
-    (float)9.69744e-05,
-    (float)5.49065e-05,
-    (float)7.05784e-05,
-    (float)8.54366e-05,
-    (float)5.68309e-05,
-    (float)7.35981e-05,
-    (float)7.31879e-05,
-    (float)5.42619e-05,
-    (float)7.46063e-05,
-    (float)6.18182e-05,
-    (float)4.9472e-05,
-    (float)7.0526e-05,
-    (float)5.44535e-05,
-    (float)4.31327e-05,
-    (float)6.19474e-05,
-    (float)4.9886e-05,
-    (float)3.79419e-05,
-    (float)5.05023e-05,
-    (float)4.56539e-05,
-    (float)3.54682e-05,
-    (float)3.76791e-05,
-    (float)4.05908e-05,
-    (float)3.44964e-05,
-    (float)2.69005e-05,
-    (float)3.30556e-05,
-    (float)3.4207e-05,
-    (float)1.9071e-05,
-    (float)2.48793e-05,
-    (float)3.21153e-05,
-    (float)1.50479e-05,
-    (float)1.75606e-05,
-    (float)2.74875e-05,
-    (float)1.36734e-05,
-    (float)1.24198e-05,
-    (float)2.10195e-05,
-    (float)1.29336e-05,
-    (float)9.99279e-06,
-    (float)1.40066e-05,
-    (float)1.18378e-05,
-    (float)9.05196e-06,
-    (float)8.83314e-06,
-    (float)9.71288e-06,
-    (float)8.4902e-06,
-    (float)6.20264e-06,
-    (float)7.34661e-06,
-    (float)7.32819e-06,
-    (float)5.77206e-06,
-    (float)5.66123e-06,
-    (float)5.39229e-06,
-    (float)6.33983e-06,
-    (float)5.01761e-06,
-    (float)3.64486e-06,
-    (float)6.48533e-06,
-    (float)5.35104e-06,
-    (float)2.82074e-06,
-    (float)5.93879e-06,
-    (float)5.75005e-06,
-    (float)3.25601e-06,
-    (float)5.10244e-06,
-    (float)5.47846e-06,
-    (float)4.48725e-06,
-    (float)4.66209e-06,
-    (float)0.00425713,
-    (float)0.026629,
-    (float)0.666693,
-    (float)0.00369168,
-    (float)0.0103879,
-    (float)0.150138,
-    (float)0.00297215,
-    (float)0.00811747,
-    (float)0.0536547,
-    (float)0.00272605,
-    (float)0.00675864,
-    (float)0.0229164,
-    (float)0.00204301,
-    (float)0.0052559,
-    (float)0.00992135,
-    (float)0.00146693,
-    (float)0.00398771,
-    (float)0.00428667,
-    (float)0.000950458,
-    (float)0.0027243,
-    (float)0.00173053,
-    (float)0.000550379,
-    (float)0.0017428,
-    (float)0.000631707,
-    (float)0.000290966,
-    (float)0.000981501,
-    (float)0.000208906,
-    (float)0.000128361,
-    (float)0.000481481,
-    (float)5.69058e-05,
-    (float)5.14505e-05,
-    (float)0.000189574,
-    (float)1.31493e-05,
-    (float)1.70877e-05,
-    (float)5.14776e-05,
-    (float)1.10394e-06,
-    (float)6.86808e-06,
-    (float)1.25215e-05,
-    (float)1.96362e-06,
-    (float)5.22104e-06,
-    (float)2.19739e-05,
-    (float)1.11139e-05,
-    (float)5.10944e-06,
-    (float)4.57022e-05,
-    (float)2.84318e-05,
-    (float)6.56249e-06,
-    (float)6.59103e-05,
-    (float)4.94812e-05,
-    (float)9.6737e-06,
-    (float)7.65702e-05,
-    (float)7.01104e-05,
-    (float)1.72542e-05,
-    (float)7.67216e-05,
-    (float)8.67317e-05,
-    (float)2.84251e-05,
-    (float)7.24396e-05,
-    (float)9.4267e-05,
-    (float)4.30707e-05,
-    (float)6.50776e-05,
-    (float)9.52868e-05,
-    (float)5.82603e-05,
-    (float)5.93901e-05,
-    (float)8.99263e-05,
-    (float)7.12097e-05,
-    (float)5.62555e-05,
-    (float)8.22933e-05,
-    (float)8.03342e-05,
-    (float)5.47911e-05,
-    (float)7.59998e-05,
-    (float)8.25578e-05,
-    (float)5.47929e-05,
-    (float)7.15811e-05,
-    (float)7.92032e-05,
-    (float)5.33707e-05,
-    (float)7.07041e-05,
-    (float)7.0236e-05,
-    (float)5.01328e-05,
-    (float)7.16125e-05,
-    (float)5.9012e-05,
-    (float)4.47736e-05,
-    (float)7.23236e-05,
-    (float)4.82923e-05,
-    (float)3.75392e-05,
-    (float)7.10408e-05,
-    (float)3.972e-05,
-    (float)3.02266e-05,
-    (float)6.52395e-05,
-    (float)3.4499e-05,
-    (float)2.36359e-05,
-    (float)5.55971e-05,
-    (float)3.13682e-05,
-    (float)1.9145e-05,
-    (float)4.32772e-05,
-    (float)2.90933e-05,
-    (float)1.68801e-05,
-    (float)3.08545e-05,
-    (float)2.61678e-05,
-    (float)1.60147e-05,
-    (float)2.08342e-05,
-    (float)2.16974e-05,
-    (float)1.56049e-05,
-    (float)1.42488e-05,
-    (float)1.64176e-05,
-    (float)1.43902e-05,
-    (float)1.12168e-05,
-    (float)1.13735e-05,
-    (float)1.20398e-05,
-    (float)1.04105e-05,
-    (float)7.90464e-06,
-    (float)8.88122e-06,
-    (float)1.01359e-05,
-    (float)6.54399e-06,
-    (float)5.70423e-06,
-    (float)9.2918e-06,
-    (float)6.7578e-06,
-    (float)3.49877e-06,
-    (float)7.56551e-06,
-    (float)7.50833e-06,
-    (float)2.68365e-06,
-    (float)5.63579e-06,
-    (float)7.7432e-06,
-    (float)3.04536e-06,
-    (float)4.46042e-06,
-    (float)7.00663e-06,
-    (float)3.83874e-06,
-    (float)4.54557e-06,
-    (float)5.66354e-06,
-    (float)4.22231e-06,
-    (float)0.00427802,
-    (float)0.0177231,
-    (float)0.6581,
-    (float)0.00342357,
-    (float)0.00874213,
-    (float)0.151489,
-    (float)0.00272857,
-    (float)0.00754519,
-    (float)0.0570667,
-    (float)0.00232059,
-    (float)0.00681923,
-    (float)0.025961,
-    (float)0.00171519,
-    (float)0.005879,
-    (float)0.0123768,
-    (float)0.00118586,
-    (float)0.0049617,
-    (float)0.00600615,
-    (float)0.000753944,
-    (float)0.00391339,
-    (float)0.00282158,
-    (float)0.000427277,
-    (float)0.00295156,
-    (float)0.00125397,
-    (float)0.00022546,
-    (float)0.00207306,
-    (float)0.000520458,
-    (float)0.000107587,
-    (float)0.00135084,
-    (float)0.000195643,
-    (float)5.7219e-05,
-    (float)0.000801255,
-    (float)7.29986e-05,
-    (float)3.92065e-05,
-    (float)0.0004148,
-    (float)3.16288e-05,
-    (float)3.7927e-05,
-    (float)0.000181112,
-    (float)2.27763e-05,
-    (float)3.76084e-05,
-    (float)5.96112e-05,
-    (float)2.17499e-05,
-    (float)3.60084e-05,
-    (float)1.90605e-05,
-    (float)2.35993e-05,
-    (float)3.19266e-05,
-    (float)2.388e-05,
-    (float)2.62857e-05,
-    (float)2.88543e-05,
-    (float)4.98461e-05,
-    (float)3.04091e-05,
-    (float)3.01646e-05,
-    (float)7.745e-05,
-    (float)3.60231e-05,
-    (float)3.6562e-05,
-    (float)9.84426e-05,
-    (float)4.0946e-05,
-    (float)4.91298e-05,
-    (float)0.000107503,
-    (float)4.50101e-05,
-    (float)6.59278e-05,
-    (float)0.000106577,
-    (float)4.66487e-05,
-    (float)8.38752e-05,
-    (float)9.87843e-05,
-    (float)4.55967e-05,
-    (float)0.00010059,
-    (float)8.7274e-05,
-    (float)4.26852e-05,
-    (float)0.000111572,
-    (float)7.63953e-05,
-    (float)3.80489e-05,
-    (float)0.000115571,
-    (float)6.72827e-05,
-    (float)3.36419e-05,
-    (float)0.000111344,
-    (float)6.12395e-05,
-    (float)3.05324e-05,
-    (float)9.95585e-05,
-    (float)5.77509e-05,
-    (float)2.9425e-05,
-    (float)8.28749e-05,
-    (float)5.4931e-05,
-    (float)3.06739e-05,
-    (float)6.34586e-05,
-    (float)5.18036e-05,
-    (float)3.30842e-05,
-    (float)4.50816e-05,
-    (float)4.70068e-05,
-    (float)3.55181e-05,
-    (float)2.99789e-05,
-    (float)4.06412e-05,
-    (float)3.6487e-05,
-    (float)1.958e-05,
-    (float)3.35701e-05,
-    (float)3.46063e-05,
-    (float)1.40368e-05,
-    (float)2.6692e-05,
-    (float)2.98894e-05,
-    (float)1.20892e-05,
-    (float)2.13773e-05,
-    (float)2.28202e-05,
-    (float)1.2223e-05,
-    (float)1.80255e-05,
-    (float)1.49973e-05,
-    (float)1.28725e-05,
-    (float)1.62945e-05,
-    (float)8.11839e-06,
-    (float)1.28777e-05,
-    (float)1.5356e-05,
-    (float)3.42005e-06,
-    (float)1.20904e-05,
-    (float)1.40032e-05,
-    (float)1.54472e-06,
-    (float)1.08502e-05,
-    (float)1.16176e-05,
-    (float)2.14679e-06,
-    (float)9.73161e-06,
-    (float)8.26463e-06,
-    (float)4.20216e-06,
-    (float)9.20908e-06,
-    (float)4.583e-06,
-    (float)6.5299e-06,
-    (float)9.11769e-06,
-    (float)1.74144e-06,
-    (float)8.24123e-06,
-    (float)8.97516e-06,
-    (float)6.68575e-07,
-    (float)0.00444298,
-    (float)0.0111443,
-    (float)0.646889,
-    (float)0.00357651,
-    (float)0.00723744,
-    (float)0.150927,
-    (float)0.00294823,
-    (float)0.0067686,
-    (float)0.0590053,
-    (float)0.0024106,
-    (float)0.00644782,
-    (float)0.028015,
-    (float)0.00180564,
-    (float)0.00594113,
-    (float)0.0143064,
-    (float)0.00124768,
-    (float)0.00535164,
-    (float)0.00758261,
-    (float)0.000791796,
-    (float)0.00461164,
-    (float)0.00405244,
-    (float)0.000438508,
-    (float)0.00384308,
-    (float)0.00217995,
-    (float)0.000208327,
-    (float)0.00306603,
-    (float)0.00119983,
-    (float)7.60827e-05,
-    (float)0.00234058,
-    (float)0.000695369,
-    (float)2.47207e-05,
-    (float)0.00170489,
-    (float)0.000445998,
-    (float)2.56372e-05,
-    (float)0.00117577,
-    (float)0.000316601,
-    (float)5.61098e-05,
-    (float)0.000771399,
-    (float)0.000243865,
-    (float)9.4272e-05,
-    (float)0.000479706,
-    (float)0.000190383,
-    (float)0.000127754,
-    (float)0.000291285,
-    (float)0.000145729,
-    (float)0.000147619,
-    (float)0.000182574,
-    (float)0.000105618,
-    (float)0.000152391,
-    (float)0.000132872,
-    (float)7.19569e-05,
-    (float)0.00014416,
-    (float)0.000119972,
-    (float)4.73061e-05,
-    (float)0.000126206,
-    (float)0.000125905,
-    (float)3.23254e-05,
-    (float)0.000104915,
-    (float)0.000137014,
-    (float)2.73924e-05,
-    (float)8.42315e-05,
-    (float)0.000143899,
-    (float)3.06195e-05,
-    (float)6.81509e-05,
-    (float)0.000142852,
-    (float)3.90931e-05,
-    (float)5.85606e-05,
-    (float)0.000132114,
-    (float)5.00338e-05,
-    (float)5.49938e-05,
-    (float)0.000114329,
-    (float)6.02295e-05,
-    (float)5.64999e-05,
-    (float)9.22684e-05,
-    (float)6.77379e-05,
-    (float)6.06083e-05,
-    (float)6.98735e-05,
-    (float)7.16459e-05,
-    (float)6.46662e-05,
-    (float)5.0366e-05,
-    (float)7.14474e-05,
-    (float)6.66518e-05,
-    (float)3.53682e-05,
-    (float)6.82767e-05,
-    (float)6.46422e-05,
-    (float)2.57685e-05,
-    (float)6.31024e-05,
-    (float)5.85359e-05,
-    (float)2.07587e-05,
-    (float)5.73257e-05,
-    (float)4.89112e-05,
-    (float)1.88837e-05,
-    (float)5.20519e-05,
-    (float)3.7183e-05,
-    (float)1.85e-05,
-    (float)4.74104e-05,
-    (float)2.54617e-05,
-    (float)1.79872e-05,
-    (float)4.34782e-05,
-    (float)1.53734e-05,
-    (float)1.66285e-05,
-    (float)3.95699e-05,
-    (float)8.31241e-06,
-    (float)1.43631e-05,
-    (float)3.49865e-05,
-    (float)4.6549e-06,
-    (float)1.16289e-05,
-    (float)2.94497e-05,
-    (float)3.87567e-06,
-    (float)9.3365e-06,
-    (float)2.2843e-05,
-    (float)4.89914e-06,
-    (float)8.1314e-06,
-    (float)1.58934e-05,
-    (float)6.36982e-06,
-    (float)8.31207e-06,
-    (float)9.52407e-06,
-    (float)7.1051e-06,
-    (float)9.7222e-06,
-    (float)4.66953e-06,
-    (float)6.60241e-06,
-    (float)1.16202e-05,
-    (float)2.02847e-06,
-    (float)4.94394e-06,
-    (float)1.3194e-05,
-    (float)1.62397e-06,
-    (float)2.91306e-06,
-    (float)1.38333e-05,
-    (float)0.00452264,
-    (float)0.0063171,
-    (float)0.635471,
-    (float)0.00396526,
-    (float)0.00586389,
-    (float)0.149121,
-    (float)0.00346495,
-    (float)0.00582222,
-    (float)0.0596542,
-    (float)0.00287265,
-    (float)0.00568892,
-    (float)0.0289902,
-    (float)0.00226688,
-    (float)0.0054148,
-    (float)0.0154284,
-    (float)0.00169577,
-    (float)0.00500581,
-    (float)0.00863193,
-    (float)0.00119212,
-    (float)0.00448865,
-    (float)0.0050183,
-    (float)0.000776102,
-    (float)0.00390053,
-    (float)0.00305967,
-    (float)0.000456332,
-    (float)0.00328293,
-    (float)0.00200495,
-    (float)0.000231231,
-    (float)0.00267629,
-    (float)0.00144738,
-    (float)9.10508e-05,
-    (float)0.00211582,
-    (float)0.00115369,
-    (float)2.03921e-05,
-    (float)0.00162837,
-    (float)0.000987727,
-    (float)8.97867e-07,
-    (float)0.00123067,
-    (float)0.000872127,
-    (float)1.38197e-05,
-    (float)0.000929009,
-    (float)0.00076676,
-    (float)4.21753e-05,
-    (float)0.000720075,
-    (float)0.000655162,
-    (float)7.23159e-05,
-    (float)0.00059279,
-    (float)0.00053526,
-    (float)9.48108e-05,
-    (float)0.000530697,
-    (float)0.000412716,
-    (float)0.000104653,
-    (float)0.000514571,
-    (float)0.000296187,
-    (float)0.000100871,
-    (float)0.000524917,
-    (float)0.00019409,
-    (float)8.56925e-05,
-    (float)0.000544092,
-    (float)0.000112634,
-    (float)6.34374e-05,
-    (float)0.000557886,
-    (float)5.48862e-05,
-    (float)3.93312e-05,
-    (float)0.00055648,
-    (float)2.06507e-05,
-    (float)1.84032e-05,
-    (float)0.000534764,
-    (float)6.93291e-06,
-    (float)4.60715e-06,
-    (float)0.000492071,
-    (float)8.76929e-06,
-    (float)2.4755e-07,
-    (float)0.000431443,
-    (float)2.02286e-05,
-    (float)5.74682e-06,
-    (float)0.000358552,
-    (float)3.54109e-05,
-    (float)1.97411e-05,
-    (float)0.000280451,
-    (float)4.93036e-05,
-    (float)3.94515e-05,
-    (float)0.000204331,
-    (float)5.8389e-05,
-    (float)6.12497e-05,
-    (float)0.000136421,
-    (float)6.09399e-05,
-    (float)8.13177e-05,
-    (float)8.11789e-05,
-    (float)5.69872e-05,
-    (float)9.62977e-05,
-    (float)4.0859e-05,
-    (float)4.79931e-05,
-    (float)0.00010383,
-    (float)1.54626e-05,
-    (float)3.63096e-05,
-    (float)0.000102901,
-    (float)3.0612e-06,
-    (float)2.45375e-05,
-    (float)9.3944e-05,
-    (float)3.94544e-07,
-    (float)1.49127e-05,
-    (float)7.86871e-05,
-    (float)3.61843e-06,
-    (float)8.84136e-06,
-    (float)5.97747e-05,
-    (float)9.05862e-06,
-    (float)6.66716e-06,
-    (float)4.02369e-05,
-    (float)1.38327e-05,
-    (float)7.70788e-06,
-    (float)2.29096e-05,
-    (float)1.62348e-05,
-    (float)1.05354e-05,
-    (float)9.91933e-06,
-    (float)1.58292e-05,
-    (float)1.34236e-05,
-    (float)2.33423e-06,
-    (float)1.32593e-05,
-    (float)1.48519e-05,
-    (float)4.97314e-08,
-    (float)9.8386e-06,
-    (float)1.39415e-05,
-    (float)1.92786e-06,
-    (float)7.03194e-06,
-    (float)1.07204e-05,
-    (float)6.15308e-06,
-    (float)5.95778e-06,
-    (float)0.00452264,
-    (float)0.0063171,
-    (float)0.635471,
-    (float)0.00396526,
-    (float)0.00586389,
-    (float)0.149121,
-    (float)0.00346495,
-    (float)0.00582222,
-    (float)0.0596542,
-    (float)0.00287265,
-    (float)0.00568892,
-    (float)0.0289902,
-    (float)0.00226688,
-    (float)0.0054148,
-    (float)0.0154284,
-    (float)0.00169577,
-    (float)0.00500581,
-    (float)0.00863193,
-    (float)0.00119212,
-    (float)0.00448865,
-    (float)0.0050183,
-    (float)0.000776102,
-    (float)0.00390053,
-    (float)0.00305967,
-    (float)0.000456332,
-    (float)0.00328293,
-    (float)0.00200495,
-    (float)0.000231231,
-    (float)0.00267629,
-    (float)0.00144738,
-    (float)9.10508e-05,
-    (float)0.00211582,
-    (float)0.00115369,
-    (float)2.03921e-05,
-    (float)0.00162837,
-    (float)0.000987727,
-    (float)8.97867e-07,
-    (float)0.00123067,
-    (float)0.000872127,
-    (float)1.38197e-05,
-    (float)0.000929009,
-    (float)0.00076676,
-    (float)4.21753e-05,
-    (float)0.000720075,
-    (float)0.000655162,
-    (float)7.23159e-05,
-    (float)0.00059279,
-    (float)0.00053526,
-    (float)9.48108e-05,
-    (float)0.000530697,
-    (float)0.000412716,
-    (float)0.000104653,
-    (float)0.000514571,
-    (float)0.000296187,
-    (float)0.000100871,
-    (float)0.000524917,
-    (float)0.00019409,
-    (float)8.56925e-05,
-    (float)0.000544092,
-    (float)0.000112634,
-    (float)6.34374e-05,
-    (float)0.000557886,
-    (float)5.48862e-05,
-    (float)3.93312e-05,
-    (float)0.00055648,
-    (float)2.06507e-05,
-    (float)1.84032e-05,
-    (float)0.000534764,
-    (float)6.93291e-06,
-    (float)4.60715e-06,
-    (float)0.000492071,
-    (float)8.76929e-06,
-    (float)2.4755e-07,
-    (float)0.000431443,
-    (float)2.02286e-05,
-    (float)5.74682e-06,
-    (float)0.000358552,
-    (float)3.54109e-05,
-    (float)1.97411e-05,
-    (float)0.000280451,
-    (float)4.93036e-05,
-    (float)3.94515e-05,
-    (float)0.000204331,
-    (float)5.8389e-05,
-    (float)6.12497e-05,
-    (float)0.000136421,
-    (float)6.09399e-05,
-    (float)8.13177e-05,
-    (float)8.11789e-05,
-    (float)5.69872e-05,
-    (float)9.62977e-05,
-    (float)4.0859e-05,
-    (float)4.79931e-05,
-    (float)0.00010383,
-    (float)1.54626e-05,
-    (float)3.63096e-05,
-    (float)0.000102901,
-    (float)3.0612e-06,
-    (float)2.45375e-05,
-    (float)9.3944e-05,
-    (float)3.94544e-07,
-    (float)1.49127e-05,
-    (float)7.86871e-05,
-    (float)3.61843e-06,
-    (float)8.84136e-06,
-    (float)5.97747e-05,
-    (float)9.05862e-06,
-    (float)6.66716e-06,
-    (float)4.02369e-05,
-    (float)1.38327e-05,
-    (float)7.70788e-06,
-    (float)2.29096e-05,
-    (float)1.62348e-05,
-    (float)1.05354e-05,
-    (float)9.91933e-06,
-    (float)1.58292e-05,
-    (float)1.34236e-05,
-    (float)2.33423e-06,
-    (float)1.32593e-05,
-    (float)1.48519e-05,
-    (float)4.97314e-08,
-    (float)9.8386e-06,
-    (float)1.39415e-05,
-    (float)1.92786e-06,
-    (float)7.03194e-06,
-    (float)1.07204e-05,
-    (float)6.15308e-06,
-    (float)5.95778e-06,
-    (float)0.00508804,
-    (float)0.00680133,
-    (float)0.651436,
-    (float)0.00478672,
-    (float)0.00683162,
-    (float)0.149875,
-    (float)0.0040054,
-    (float)0.00681607,
-    (float)0.0579705,
-    (float)0.00314692,
-    (float)0.00655786,
-    (float)0.0268381,
-    (float)0.00231776,
-    (float)0.00605843,
-    (float)0.0133972,
-    (float)0.00158458,
-    (float)0.00536366,
-    (float)0.00692978,
-    (float)0.000987795,
-    (float)0.00454163,
-    (float)0.00369484,
-    (float)0.000543732,
-    (float)0.00366898,
-    (float)0.00208462,
-    (float)0.000247837,
-    (float)0.00281906,
-    (float)0.0013087,
-    (float)7.98591e-05,
-    (float)0.00205242,
-    (float)0.000947506,
-    (float)1.01989e-05,
-    (float)0.00141064,
-    (float)0.000773151,
-    (float)6.21966e-06,
-    (float)0.000914085,
-    (float)0.000666192,
-    (float)3.75358e-05,
-    (float)0.000563143,
-    (float)0.000571034,
-    (float)7.96484e-05,
-    (float)0.000342294,
-    (float)0.00046907,
-    (float)0.000115741,
-    (float)0.000225619,
-    (float)0.000361286,
-    (float)0.000136804,
-    (float)0.000182639,
-    (float)0.000256864,
-    (float)0.000140514,
-    (float)0.000183445,
-    (float)0.000166067,
-    (float)0.000129364,
-    (float)0.000202527,
-    (float)9.63426e-05,
-    (float)0.000108567,
-    (float)0.00022103,
-    (float)5.07843e-05,
-    (float)8.41207e-05,
-    (float)0.000227518,
-    (float)2.81887e-05,
-    (float)6.12971e-05,
-    (float)0.000217499,
-    (float)2.40672e-05,
-    (float)4.37051e-05,
-    (float)0.000192067,
-    (float)3.20902e-05,
-    (float)3.292e-05,
-    (float)0.000156054,
-    (float)4.55725e-05,
-    (float)2.8613e-05,
-    (float)0.00011603,
-    (float)5.8729e-05,
-    (float)2.90435e-05,
-    (float)7.84921e-05,
-    (float)6.75256e-05,
-    (float)3.17515e-05,
-    (float)4.84547e-05,
-    (float)7.00453e-05,
-    (float)3.42832e-05,
-    (float)2.86308e-05,
-    (float)6.63733e-05,
-    (float)3.48009e-05,
-    (float)1.92386e-05,
-    (float)5.80916e-05,
-    (float)3.24649e-05,
-    (float)1.83819e-05,
-    (float)4.75417e-05,
-    (float)2.75279e-05,
-    (float)2.28383e-05,
-    (float)3.70538e-05,
-    (float)2.11458e-05,
-    (float)2.90254e-05,
-    (float)2.83326e-05,
-    (float)1.49696e-05,
-    (float)3.38988e-05,
-    (float)2.21355e-05,
-    (float)1.06315e-05,
-    (float)3.55764e-05,
-    (float)1.82871e-05,
-    (float)9.26414e-06,
-    (float)3.35736e-05,
-    (float)1.59773e-05,
-    (float)1.11767e-05,
-    (float)2.86421e-05,
-    (float)1.42129e-05,
-    (float)1.57735e-05,
-    (float)2.2308e-05,
-    (float)1.22574e-05,
-    (float)2.17295e-05,
-    (float)1.62731e-05,
-    (float)9.91729e-06,
-    (float)2.73684e-05,
-    (float)1.18639e-05,
-    (float)7.58916e-06,
-    (float)3.11317e-05,
-    (float)9.67814e-06,
-    (float)6.07205e-06,
-    (float)3.20021e-05,
-    (float)9.50958e-06,
-    (float)6.22145e-06,
-    (float)2.97609e-05,
-    (float)1.05439e-05,
-    (float)8.57256e-06,
-    (float)2.50109e-05,
-    (float)1.17375e-05,
-    (float)1.30648e-05,
-    (float)1.89637e-05,
-    (float)1.22432e-05,
-    (float)0.00720496,
-    (float)0.00755094,
-    (float)0.665353,
-    (float)0.00591677,
-    (float)0.00796226,
-    (float)0.149163,
-    (float)0.00469141,
-    (float)0.00789053,
-    (float)0.0551616,
-    (float)0.00347123,
-    (float)0.00738003,
-    (float)0.0238897,
-    (float)0.00236678,
-    (float)0.00651086,
-    (float)0.0108732,
-    (float)0.00146024,
-    (float)0.00540442,
-    (float)0.00498183,
-    (float)0.000790068,
-    (float)0.00420166,
-    (float)0.00229692,
-    (float)0.000352461,
-    (float)0.0030374,
-    (float)0.00112904,
-    (float)0.000111854,
-    (float)0.00201835,
-    (float)0.000662633,
-    (float)1.55901e-05,
-    (float)0.00120996,
-    (float)0.000489112,
-    (float)8.31915e-06,
-    (float)0.000633577,
-    (float)0.000411686,
-    (float)4.28591e-05,
-    (float)0.000272816,
-    (float)0.000348291,
-    (float)8.5991e-05,
-    (float)8.59026e-05,
-    (float)0.000276564,
-    (float)0.000119372,
-    (float)1.98272e-05,
-    (float)0.000200857,
-    (float)0.000136932,
-    (float)2.28273e-05,
-    (float)0.000133026,
-    (float)0.000140563,
-    (float)5.29795e-05,
-    (float)8.26064e-05,
-    (float)0.000135732,
-    (float)8.22354e-05,
-    (float)5.32513e-05,
-    (float)0.000128073,
-    (float)9.64859e-05,
-    (float)4.29062e-05,
-    (float)0.000121394,
-    (float)9.29214e-05,
-    (float)4.57978e-05,
-    (float)0.000117015,
-    (float)7.60855e-05,
-    (float)5.48808e-05,
-    (float)0.000114105,
-    (float)5.3794e-05,
-    (float)6.39307e-05,
-    (float)0.000110588,
-    (float)3.37215e-05,
-    (float)6.88826e-05,
-    (float)0.00010423,
-    (float)2.11047e-05,
-    (float)6.82975e-05,
-    (float)9.35901e-05,
-    (float)1.77244e-05,
-    (float)6.30352e-05,
-    (float)7.86084e-05,
-    (float)2.2087e-05,
-    (float)5.53647e-05,
-    (float)6.07047e-05,
-    (float)3.05192e-05,
-    (float)4.78469e-05,
-    (float)4.23921e-05,
-    (float)3.8726e-05,
-    (float)4.23557e-05,
-    (float)2.65293e-05,
-    (float)4.32897e-05,
-    (float)3.95312e-05,
-    (float)1.54575e-05,
-    (float)4.26581e-05,
-    (float)3.87885e-05,
-    (float)1.03029e-05,
-    (float)3.73664e-05,
-    (float)3.87988e-05,
-    (float)1.06751e-05,
-    (float)2.9521e-05,
-    (float)3.81869e-05,
-    (float)1.48554e-05,
-    (float)2.18203e-05,
-    (float)3.61368e-05,
-    (float)2.0394e-05,
-    (float)1.65188e-05,
-    (float)3.26703e-05,
-    (float)2.48979e-05,
-    (float)1.47102e-05,
-    (float)2.85258e-05,
-    (float)2.6732e-05,
-    (float)1.61365e-05,
-    (float)2.47427e-05,
-    (float)2.54095e-05,
-    (float)1.95083e-05,
-    (float)2.21659e-05,
-    (float)2.15746e-05,
-    (float)2.31372e-05,
-    (float)2.10866e-05,
-    (float)1.66317e-05,
-    (float)2.56032e-05,
-    (float)2.11537e-05,
-    (float)1.21872e-05,
-    (float)2.62143e-05,
-    (float)2.15598e-05,
-    (float)9.50936e-06,
-    (float)2.51322e-05,
-    (float)2.14008e-05,
-    (float)9.17363e-06,
-    (float)2.31749e-05,
-    (float)2.0055e-05,
-    (float)1.09748e-05,
-    (float)2.14115e-05,
-    (float)1.74449e-05,
-    (float)1.40951e-05,
-    (float)2.0713e-05,
-    (float)0.0110318,
-    (float)0.00849819,
-    (float)0.677295,
-    (float)0.00729386,
-    (float)0.00912773,
-    (float)0.147034,
-    (float)0.00545102,
-    (float)0.00887969,
-    (float)0.051365,
-    (float)0.00378069,
-    (float)0.00796375,
-    (float)0.0203783,
-    (float)0.0023688,
-    (float)0.00658596,
-    (float)0.00815442,
-    (float)0.00130286,
-    (float)0.00499327,
-    (float)0.00310569,
-    (float)0.000598898,
-    (float)0.00343101,
-    (float)0.00112005,
-    (float)0.000207622,
-    (float)0.00209369,
-    (float)0.000441985,
-    (float)4.23833e-05,
-    (float)0.00109318,
-    (float)0.000266213,
-    (float)1.05093e-05,
-    (float)0.000452476,
-    (float)0.000235289,
-    (float)3.67046e-05,
-    (float)0.000122777,
-    (float)0.000214916,
-    (float)7.3635e-05,
-    (float)1.43554e-05,
-    (float)0.00017588,
-    (float)0.000100642,
-    (float)2.92297e-05,
-    (float)0.000128615,
-    (float)0.00011526,
-    (float)8.61019e-05,
-    (float)8.95075e-05,
-    (float)0.00012305,
-    (float)0.000132925,
-    (float)6.73779e-05,
-    (float)0.000129827,
-    (float)0.00014762,
-    (float)6.16611e-05,
-    (float)0.000137875,
-    (float)0.000130841,
-    (float)6.58603e-05,
-    (float)0.000145704,
-    (float)9.56523e-05,
-    (float)7.20534e-05,
-    (float)0.000149792,
-    (float)5.8026e-05,
-    (float)7.42762e-05,
-    (float)0.000146786,
-    (float)3.02941e-05,
-    (float)7.0102e-05,
-    (float)0.000135137,
-    (float)1.81035e-05,
-    (float)6.0567e-05,
-    (float)0.000115805,
-    (float)2.03872e-05,
-    (float)4.89425e-05,
-    (float)9.20273e-05,
-    (float)3.14164e-05,
-    (float)3.89863e-05,
-    (float)6.83487e-05,
-    (float)4.38463e-05,
-    (float)3.33314e-05,
-    (float)4.92204e-05,
-    (float)5.16652e-05,
-    (float)3.25743e-05,
-    (float)3.75881e-05,
-    (float)5.21189e-05,
-    (float)3.5343e-05,
-    (float)3.39544e-05,
-    (float)4.60781e-05,
-    (float)3.92064e-05,
-    (float)3.63019e-05,
-    (float)3.69198e-05,
-    (float)4.19175e-05,
-    (float)4.09603e-05,
-    (float)2.85758e-05,
-    (float)4.23565e-05,
-    (float)4.4092e-05,
-    (float)2.37057e-05,
-    (float)4.07511e-05,
-    (float)4.31685e-05,
-    (float)2.27912e-05,
-    (float)3.81758e-05,
-    (float)3.78041e-05,
-    (float)2.44175e-05,
-    (float)3.5722e-05,
-    (float)2.96198e-05,
-    (float)2.63978e-05,
-    (float)3.38613e-05,
-    (float)2.12857e-05,
-    (float)2.70315e-05,
-    (float)3.23314e-05,
-    (float)1.5261e-05,
-    (float)2.58434e-05,
-    (float)3.05194e-05,
-    (float)1.28365e-05,
-    (float)2.35377e-05,
-    (float)2.80159e-05,
-    (float)1.38485e-05,
-    (float)2.13655e-05,
-    (float)2.49644e-05,
-    (float)1.70509e-05,
-    (float)2.03638e-05,
-    (float)2.20126e-05,
-    (float)2.08239e-05,
-    (float)2.08836e-05,
-    (float)1.99521e-05,
-    (float)2.38197e-05,
-    (float)2.25621e-05,
-    (float)1.93027e-05,
-    (float)2.53019e-05,
-    (float)2.46198e-05,
-    (float)2.00799e-05,
-    (float)2.51654e-05,
-    (float)2.62403e-05,
-    (float)2.18211e-05,
-    (float)2.37825e-05,
-    (float)2.68481e-05,
-    (float)0.0168011,
-    (float)0.0097131,
-    (float)0.686383,
-    (float)0.00890319,
-    (float)0.010352,
-    (float)0.143394,
-    (float)0.00623974,
-    (float)0.00979776,
-    (float)0.0467262,
-    (float)0.00402669,
-    (float)0.00833197,
-    (float)0.0165735,
-    (float)0.00229067,
-    (float)0.00635157,
-    (float)0.00554826,
-    (float)0.001102,
-    (float)0.0042833,
-    (float)0.00157083,
-    (float)0.000418932,
-    (float)0.00248905,
-    (float)0.000347818,
-    (float)0.000112949,
-    (float)0.00118647,
-    (float)0.000109839,
-    (float)2.94551e-05,
-    (float)0.00042336,
-    (float)0.000128461,
-    (float)4.02171e-05,
-    (float)0.000108756,
-    (float)0.000151511,
-    (float)6.84805e-05,
-    (float)7.89602e-05,
-    (float)0.000133951,
-    (float)8.61397e-05,
-    (float)0.000167634,
-    (float)9.89916e-05,
-    (float)9.45366e-05,
-    (float)0.000254643,
-    (float)7.32888e-05,
-    (float)0.000103381,
-    (float)0.000283227,
-    (float)6.65042e-05,
-    (float)0.000117581,
-    (float)0.00025014,
-    (float)7.34477e-05,
-    (float)0.000134234,
-    (float)0.000182027,
-    (float)8.32989e-05,
-    (float)0.000146318,
-    (float)0.000111599,
-    (float)8.72932e-05,
-    (float)0.000147936,
-    (float)6.1985e-05,
-    (float)8.21104e-05,
-    (float)0.000137539,
-    (float)4.11571e-05,
-    (float)6.95996e-05,
-    (float)0.000118203,
-    (float)4.40477e-05,
-    (float)5.45287e-05,
-    (float)9.58457e-05,
-    (float)5.85326e-05,
-    (float)4.18505e-05,
-    (float)7.67291e-05,
-    (float)7.19919e-05,
-    (float)3.45386e-05,
-    (float)6.52277e-05,
-    (float)7.62528e-05,
-    (float)3.26758e-05,
-    (float)6.24169e-05,
-    (float)6.97172e-05,
-    (float)3.40248e-05,
-    (float)6.58527e-05,
-    (float)5.64255e-05,
-    (float)3.56679e-05,
-    (float)7.07144e-05,
-    (float)4.28632e-05,
-    (float)3.57374e-05,
-    (float)7.2016e-05,
-    (float)3.4215e-05,
-    (float)3.42158e-05,
-    (float)6.69675e-05,
-    (float)3.19593e-05,
-    (float)3.241e-05,
-    (float)5.62824e-05,
-    (float)3.38813e-05,
-    (float)3.16123e-05,
-    (float)4.36553e-05,
-    (float)3.61449e-05,
-    (float)3.19961e-05,
-    (float)3.36539e-05,
-    (float)3.58937e-05,
-    (float)3.25498e-05,
-    (float)2.9245e-05,
-    (float)3.27244e-05,
-    (float)3.20084e-05,
-    (float)3.03979e-05,
-    (float)2.83192e-05,
-    (float)2.99738e-05,
-    (float)3.45034e-05,
-    (float)2.48296e-05,
-    (float)2.73058e-05,
-    (float)3.81695e-05,
-    (float)2.33326e-05,
-    (float)2.54903e-05,
-    (float)3.91441e-05,
-    (float)2.33936e-05,
-    (float)2.5511e-05,
-    (float)3.71943e-05,
-    (float)2.37929e-05,
-    (float)2.71263e-05,
-    (float)3.36223e-05,
-    (float)2.3625e-05,
-    (float)2.90847e-05,
-    (float)3.00435e-05,
-    (float)2.28615e-05,
-    (float)3.00556e-05,
-    (float)2.74111e-05,
-    (float)2.20711e-05,
-    (float)2.95153e-05,
-    (float)2.58589e-05,
-    (float)2.17261e-05,
-    (float)2.79439e-05,
-    (float)2.51817e-05,
-    (float)2.17856e-05,
-    (float)2.62992e-05,
-    (float)2.53093e-05,
-    (float)2.18755e-05,
-    (float)0.0249671,
-    (float)0.0113177,
-    (float)0.691814,
-    (float)0.0108851,
-    (float)0.0116858,
-    (float)0.13813,
-    (float)0.00715867,
-    (float)0.0106444,
-    (float)0.0413718,
-    (float)0.00429283,
-    (float)0.00846165,
-    (float)0.0127173,
-    (float)0.00221099,
-    (float)0.00581479,
-    (float)0.00330068,
-    (float)0.000930238,
-    (float)0.00335806,
-    (float)0.00054112,
-    (float)0.000303604,
-    (float)0.00154043,
-    (float)2.78071e-05,
-    (float)8.99007e-05,
-    (float)0.000510285,
-    (float)8.43673e-05,
-    (float)6.28659e-05,
-    (float)0.000145881,
-    (float)0.000156951,
-    (float)7.91364e-05,
-    (float)0.000178008,
-    (float)0.000151109,
-    (float)8.52131e-05,
-    (float)0.000333404,
-    (float)0.000113095,
-    (float)8.30081e-05,
-    (float)0.000433429,
-    (float)9.00989e-05,
-    (float)8.79176e-05,
-    (float)0.000420222,
-    (float)9.33973e-05,
-    (float)0.000104155,
-    (float)0.000323882,
-    (float)0.000109517,
-    (float)0.000122515,
-    (float)0.00020683,
-    (float)0.000121211,
-    (float)0.000130748,
-    (float)0.000118875,
-    (float)0.000119771,
-    (float)0.000123492,
-    (float)7.83697e-05,
-    (float)0.000106343,
-    (float)0.000104768,
-    (float)7.63093e-05,
-    (float)8.7463e-05,
-    (float)8.3863e-05,
-    (float)9.11275e-05,
-    (float)7.00535e-05,
-    (float)6.9332e-05,
-    (float)0.000102925,
-    (float)5.83134e-05,
-    (float)6.50547e-05,
-    (float)0.000101508,
-    (float)5.27626e-05,
-    (float)6.9484e-05,
-    (float)8.75993e-05,
-    (float)5.10765e-05,
-    (float)7.72721e-05,
-    (float)6.90558e-05,
-    (float)5.01023e-05,
-    (float)8.20704e-05,
-    (float)5.48142e-05,
-    (float)4.7966e-05,
-    (float)7.95058e-05,
-    (float)4.95683e-05,
-    (float)4.49453e-05,
-    (float)6.9284e-05,
-    (float)5.17409e-05,
-    (float)4.25355e-05,
-    (float)5.53161e-05,
-    (float)5.55623e-05,
-    (float)4.1577e-05,
-    (float)4.34711e-05,
-    (float)5.55571e-05,
-    (float)4.11781e-05,
-    (float)3.80442e-05,
-    (float)5.01853e-05,
-    (float)3.94853e-05,
-    (float)3.9186e-05,
-    (float)4.21643e-05,
-    (float)3.56118e-05,
-    (float)4.31379e-05,
-    (float)3.56504e-05,
-    (float)3.08507e-05,
-    (float)4.51466e-05,
-    (float)3.28592e-05,
-    (float)2.78644e-05,
-    (float)4.28715e-05,
-    (float)3.28585e-05,
-    (float)2.84272e-05,
-    (float)3.77091e-05,
-    (float)3.31583e-05,
-    (float)3.1733e-05,
-    (float)3.31647e-05,
-    (float)3.22829e-05,
-    (float)3.48771e-05,
-    (float)3.17963e-05,
-    (float)3.08858e-05,
-    (float)3.51794e-05,
-    (float)3.33154e-05,
-    (float)3.05782e-05,
-    (float)3.23327e-05,
-    (float)3.52654e-05,
-    (float)3.18685e-05,
-    (float)2.85023e-05,
-    (float)3.54086e-05,
-    (float)3.33634e-05,
-    (float)2.63604e-05,
-    (float)3.35642e-05,
-    (float)3.30407e-05,
-    (float)2.68755e-05,
-    (float)3.13488e-05,
-    (float)3.03261e-05,
-    (float)2.88118e-05,
-    (float)3.031e-05,
-    (float)2.68952e-05,
-    (float)3.02254e-05,
-    (float)3.03945e-05,
-    (float)2.53409e-05,
-    (float)0.0357426,
-    (float)0.0134201,
-    (float)0.692733,
-    (float)0.0131707,
-    (float)0.0131821,
-    (float)0.131365,
-    (float)0.00809336,
-    (float)0.0114532,
-    (float)0.0356654,
-    (float)0.0044724,
-    (float)0.00839691,
-    (float)0.00919451,
-    (float)0.00206551,
-    (float)0.00507951,
-    (float)0.00166776,
-    (float)0.000764686,
-    (float)0.00240163,
-    (float)7.91153e-05,
-    (float)0.000245002,
-    (float)0.000804067,
-    (float)6.31912e-05,
-    (float)0.000122441,
-    (float)0.000220598,
-    (float)0.000203628,
-    (float)0.000118534,
-    (float)0.000261271,
-    (float)0.000214234,
-    (float)0.000113227,
-    (float)0.000485956,
-    (float)0.000159757,
-    (float)9.71411e-05,
-    (float)0.00060931,
-    (float)0.000125708,
-    (float)9.2892e-05,
-    (float)0.000557298,
-    (float)0.000131455,
-    (float)0.000105941,
-    (float)0.000399651,
-    (float)0.00015286,
-    (float)0.000120637,
-    (float)0.000241138,
-    (float)0.000163635,
-    (float)0.000120111,
-    (float)0.000145533,
-    (float)0.000155145,
-    (float)0.000101909,
-    (float)0.000117958,
-    (float)0.000133862,
-    (float)7.73496e-05,
-    (float)0.000127892,
-    (float)0.00011082,
-    (float)6.04506e-05,
-    (float)0.000140991,
-    (float)9.38503e-05,
-    (float)5.80383e-05,
-    (float)0.000138543,
-    (float)8.51059e-05,
-    (float)6.72797e-05,
-    (float)0.000120377,
-    (float)8.21598e-05,
-    (float)7.94752e-05,
-    (float)9.72449e-05,
-    (float)8.0749e-05,
-    (float)8.58305e-05,
-    (float)8.04613e-05,
-    (float)7.76872e-05,
-    (float)8.19111e-05,
-    (float)7.45337e-05,
-    (float)7.24108e-05,
-    (float)6.93224e-05,
-    (float)7.5758e-05,
-    (float)6.62762e-05,
-    (float)5.42583e-05,
-    (float)7.64835e-05,
-    (float)6.05101e-05,
-    (float)4.3598e-05,
-    (float)7.14629e-05,
-    (float)5.49646e-05,
-    (float)4.06784e-05,
-    (float)6.14542e-05,
-    (float)4.89184e-05,
-    (float)4.3545e-05,
-    (float)5.16085e-05,
-    (float)4.28303e-05,
-    (float)4.70161e-05,
-    (float)4.65686e-05,
-    (float)3.877e-05,
-    (float)4.69361e-05,
-    (float)4.67793e-05,
-    (float)3.86482e-05,
-    (float)4.31346e-05,
-    (float)4.89502e-05,
-    (float)4.19118e-05,
-    (float)3.87598e-05,
-    (float)4.95677e-05,
-    (float)4.52453e-05,
-    (float)3.69105e-05,
-    (float)4.77853e-05,
-    (float)4.49668e-05,
-    (float)3.78017e-05,
-    (float)4.51954e-05,
-    (float)4.00705e-05,
-    (float)3.895e-05,
-    (float)4.33703e-05,
-    (float)3.30915e-05,
-    (float)3.78739e-05,
-    (float)4.2107e-05,
-    (float)2.79726e-05,
-    (float)3.45253e-05,
-    (float)4.01575e-05,
-    (float)2.6906e-05,
-    (float)3.11827e-05,
-    (float)3.73487e-05,
-    (float)2.89625e-05,
-    (float)3.01449e-05,
-    (float)3.55032e-05,
-    (float)3.14945e-05,
-    (float)3.16147e-05,
-    (float)3.69106e-05,
-    (float)3.26884e-05,
-    (float)3.37611e-05,
-    (float)4.17852e-05,
-    (float)3.27887e-05,
-    (float)3.46621e-05,
-    (float)4.73665e-05,
-    (float)3.30839e-05,
-    (float)3.40378e-05,
-    (float)4.98204e-05,
-    (float)0.0494857,
-    (float)0.0159362,
-    (float)0.689648,
-    (float)0.0157855,
-    (float)0.0146786,
-    (float)0.123206,
-    (float)0.00907103,
-    (float)0.0120523,
-    (float)0.0297493,
-    (float)0.00461572,
-    (float)0.00803381,
-    (float)0.00612846,
-    (float)0.00192328,
-    (float)0.00416456,
-    (float)0.000658979,
-    (float)0.000668354,
-    (float)0.0015279,
-    (float)6.78736e-05,
-    (float)0.000276697,
-    (float)0.000377674,
-    (float)0.000285375,
-    (float)0.00021517,
-    (float)0.000279189,
-    (float)0.000340057,
-    (float)0.000194555,
-    (float)0.000561345,
-    (float)0.000253777,
-    (float)0.000154489,
-    (float)0.000738513,
-    (float)0.000185247,
-    (float)0.000128481,
-    (float)0.00067008,
-    (float)0.000181131,
-    (float)0.000133216,
-    (float)0.000461168,
-    (float)0.000203932,
-    (float)0.000146038,
-    (float)0.000268642,
-    (float)0.000212775,
-    (float)0.000139303,
-    (float)0.000171743,
-    (float)0.000198103,
-    (float)0.000110356,
-    (float)0.000157188,
-    (float)0.000171724,
-    (float)7.85637e-05,
-    (float)0.000171778,
-    (float)0.000147326,
-    (float)6.31759e-05,
-    (float)0.000174467,
-    (float)0.000131457,
-    (float)6.78571e-05,
-    (float)0.00015495,
-    (float)0.000123818,
-    (float)8.21428e-05,
-    (float)0.000124596,
-    (float)0.000120296,
-    (float)9.23914e-05,
-    (float)9.91535e-05,
-    (float)0.00011619,
-    (float)9.10383e-05,
-    (float)8.6589e-05,
-    (float)0.000109042,
-    (float)7.93372e-05,
-    (float)8.41947e-05,
-    (float)9.94911e-05,
-    (float)6.46542e-05,
-    (float)8.34507e-05,
-    (float)8.94914e-05,
-    (float)5.50194e-05,
-    (float)7.78454e-05,
-    (float)8.01012e-05,
-    (float)5.38618e-05,
-    (float)6.75508e-05,
-    (float)7.14315e-05,
-    (float)5.81309e-05,
-    (float)5.7656e-05,
-    (float)6.41882e-05,
-    (float)6.13844e-05,
-    (float)5.24644e-05,
-    (float)5.99531e-05,
-    (float)5.94236e-05,
-    (float)5.17129e-05,
-    (float)5.92418e-05,
-    (float)5.34382e-05,
-    (float)5.19069e-05,
-    (float)5.98537e-05,
-    (float)4.79309e-05,
-    (float)5.03773e-05,
-    (float)5.81802e-05,
-    (float)4.59561e-05,
-    (float)4.73883e-05,
-    (float)5.25558e-05,
-    (float)4.6652e-05,
-    (float)4.46797e-05,
-    (float)4.5015e-05,
-    (float)4.70761e-05,
-    (float)4.3015e-05,
-    (float)3.94404e-05,
-    (float)4.56411e-05,
-    (float)4.17713e-05,
-    (float)3.80407e-05,
-    (float)4.33226e-05,
-    (float)4.05042e-05,
-    (float)3.97064e-05,
-    (float)4.19364e-05,
-    (float)4.0001e-05,
-    (float)4.15076e-05,
-    (float)4.20022e-05,
-    (float)4.13415e-05,
-    (float)4.13859e-05,
-    (float)4.25156e-05,
-    (float)4.42056e-05,
-    (float)3.94364e-05,
-    (float)4.23298e-05,
-    (float)4.6608e-05,
-    (float)3.71299e-05,
-    (float)4.12542e-05,
-    (float)4.65275e-05,
-    (float)3.57835e-05,
-    (float)3.98524e-05,
-    (float)4.37893e-05,
-    (float)3.57273e-05,
-    (float)3.86046e-05,
-    (float)4.03642e-05,
-    (float)3.6501e-05,
-    (float)3.75283e-05,
-    (float)3.88347e-05,
-    (float)0.0661066,
-    (float)0.0190666,
-    (float)0.681478,
-    (float)0.0185722,
-    (float)0.0162862,
-    (float)0.114035,
-    (float)0.00994887,
-    (float)0.0125617,
-    (float)0.0241112,
-    (float)0.00463168,
-    (float)0.00752994,
-    (float)0.00380554,
-    (float)0.00174619,
-    (float)0.00325883,
-    (float)0.000293289,
-    (float)0.00062002,
-    (float)0.000888397,
-    (float)0.000360732,
-    (float)0.000362829,
-    (float)0.000283182,
-    (float)0.000543654,
-    (float)0.000321694,
-    (float)0.000552336,
-    (float)0.000435307,
-    (float)0.000260271,
-    (float)0.00084472,
-    (float)0.000295872,
-    (float)0.000199916,
-    (float)0.000812332,
-    (float)0.000256936,
-    (float)0.000187171,
-    (float)0.000557896,
-    (float)0.000273485,
-    (float)0.000199212,
-    (float)0.000315184,
-    (float)0.000276756,
-    (float)0.000188187,
-    (float)0.000203705,
-    (float)0.000251418,
-    (float)0.000144383,
-    (float)0.00019578,
-    (float)0.000216368,
-    (float)9.83366e-05,
-    (float)0.000211484,
-    (float)0.000188264,
-    (float)7.97052e-05,
-    (float)0.000202864,
-    (float)0.000171238,
-    (float)8.92026e-05,
-    (float)0.000169881,
-    (float)0.000162683,
-    (float)0.000106175,
-    (float)0.000133866,
-    (float)0.000157669,
-    (float)0.000111775,
-    (float)0.000110899,
-    (float)0.000150888,
-    (float)0.000101991,
-    (float)0.000102483,
-    (float)0.000139665,
-    (float)8.50027e-05,
-    (float)9.98967e-05,
-    (float)0.000125424,
-    (float)7.17769e-05,
-    (float)9.38613e-05,
-    (float)0.000111187,
-    (float)6.81068e-05,
-    (float)8.2118e-05,
-    (float)9.87153e-05,
-    (float)7.15415e-05,
-    (float)6.9582e-05,
-    (float)8.88694e-05,
-    (float)7.44668e-05,
-    (float)6.18591e-05,
-    (float)8.28466e-05,
-    (float)7.13522e-05,
-    (float)5.94176e-05,
-    (float)8.07938e-05,
-    (float)6.37088e-05,
-    (float)5.84405e-05,
-    (float)7.98171e-05,
-    (float)5.75402e-05,
-    (float)5.6034e-05,
-    (float)7.57955e-05,
-    (float)5.62925e-05,
-    (float)5.27451e-05,
-    (float)6.79098e-05,
-    (float)5.76356e-05,
-    (float)5.00979e-05,
-    (float)5.98817e-05,
-    (float)5.72982e-05,
-    (float)4.77973e-05,
-    (float)5.57422e-05,
-    (float)5.42699e-05,
-    (float)4.47283e-05,
-    (float)5.53689e-05,
-    (float)5.09219e-05,
-    (float)4.15768e-05,
-    (float)5.53095e-05,
-    (float)4.91688e-05,
-    (float)4.05307e-05,
-    (float)5.32555e-05,
-    (float)4.85631e-05,
-    (float)4.22311e-05,
-    (float)5.01744e-05,
-    (float)4.81789e-05,
-    (float)4.44764e-05,
-    (float)4.81123e-05,
-    (float)4.8375e-05,
-    (float)4.46962e-05,
-    (float)4.75211e-05,
-    (float)4.95757e-05,
-    (float)4.28468e-05,
-    (float)4.7509e-05,
-    (float)5.05266e-05,
-    (float)4.10006e-05,
-    (float)4.75384e-05,
-    (float)4.93981e-05,
-    (float)4.06332e-05,
-    (float)4.75923e-05,
-    (float)4.64228e-05,
-    (float)4.13431e-05,
-    (float)4.72004e-05,
-    (float)4.40398e-05,
-    (float)4.20456e-05,
-    (float)4.57729e-05,
-    (float)4.40715e-05,
-    (float)4.22813e-05,
-    (float)0.0861263,
-    (float)0.0227607,
-    (float)0.668015,
-    (float)0.0217081,
-    (float)0.017882,
-    (float)0.103907,
-    (float)0.0108793,
-    (float)0.0128538,
-    (float)0.0188732,
-    (float)0.00465536,
-    (float)0.00683526,
-    (float)0.00223566,
-    (float)0.0016394,
-    (float)0.00239393,
-    (float)0.000419969,
-    (float)0.000677044,
-    (float)0.000499229,
-    (float)0.00075653,
-    (float)0.000518325,
-    (float)0.000424687,
-    (float)0.00071967,
-    (float)0.000448392,
-    (float)0.000853341,
-    (float)0.000478002,
-    (float)0.000342327,
-    (float)0.000963716,
-    (float)0.000360371,
-    (float)0.000289235,
-    (float)0.000705057,
-    (float)0.000357196,
-    (float)0.0002962,
-    (float)0.000391504,
-    (float)0.000351217,
-    (float)0.000285789,
-    (float)0.000236665,
-    (float)0.000307794,
-    (float)0.000222161,
-    (float)0.000224006,
-    (float)0.00025716,
-    (float)0.000148992,
-    (float)0.000242272,
-    (float)0.000222165,
-    (float)0.00011925,
-    (float)0.000227718,
-    (float)0.000202226,
-    (float)0.00013357,
-    (float)0.000187192,
-    (float)0.000190982,
-    (float)0.000154061,
-    (float)0.000149984,
-    (float)0.000183186,
-    (float)0.000152571,
-    (float)0.000130308,
-    (float)0.000172672,
-    (float)0.000131346,
-    (float)0.000123575,
-    (float)0.000155905,
-    (float)0.000108325,
-    (float)0.000118294,
-    (float)0.000135795,
-    (float)9.65176e-05,
-    (float)0.000107255,
-    (float)0.000117796,
-    (float)9.62443e-05,
-    (float)9.23242e-05,
-    (float)0.000104555,
-    (float)9.87883e-05,
-    (float)8.07083e-05,
-    (float)9.62419e-05,
-    (float)9.54305e-05,
-    (float)7.62478e-05,
-    (float)9.2384e-05,
-    (float)8.56599e-05,
-    (float)7.5574e-05,
-    (float)9.05156e-05,
-    (float)7.67291e-05,
-    (float)7.34889e-05,
-    (float)8.603e-05,
-    (float)7.41144e-05,
-    (float)6.93338e-05,
-    (float)7.69279e-05,
-    (float)7.46968e-05,
-    (float)6.54992e-05,
-    (float)6.71464e-05,
-    (float)7.18491e-05,
-    (float)6.20647e-05,
-    (float)6.20021e-05,
-    (float)6.47815e-05,
-    (float)5.71557e-05,
-    (float)6.13419e-05,
-    (float)5.87216e-05,
-    (float)5.19643e-05,
-    (float)6.04353e-05,
-    (float)5.69296e-05,
-    (float)5.07305e-05,
-    (float)5.71436e-05,
-    (float)5.72352e-05,
-    (float)5.43535e-05,
-    (float)5.43944e-05,
-    (float)5.70072e-05,
-    (float)5.78022e-05,
-    (float)5.46708e-05,
-    (float)5.69473e-05,
-    (float)5.63311e-05,
-    (float)5.57121e-05,
-    (float)5.77334e-05,
-    (float)5.15466e-05,
-    (float)5.4089e-05,
-    (float)5.67193e-05,
-    (float)4.84274e-05,
-    (float)5.04586e-05,
-    (float)5.17485e-05,
-    (float)4.83977e-05,
-    (float)4.8138e-05,
-    (float)4.61734e-05,
-    (float)4.88834e-05,
-    (float)4.80003e-05,
-    (float)4.57621e-05,
-    (float)4.86322e-05,
-    (float)4.82827e-05,
-    (float)5.08573e-05,
-    (float)4.93737e-05,
-    (float)4.87933e-05,
-    (float)5.5469e-05,
-    (float)5.17135e-05,
-    (float)5.12972e-05,
-    (float)5.49763e-05,
-    (float)5.31128e-05,
-    (float)0.109246,
-    (float)0.0271319,
-    (float)0.649139,
-    (float)0.0249161,
-    (float)0.0195334,
-    (float)0.093321,
-    (float)0.011647,
-    (float)0.0130247,
-    (float)0.0143633,
-    (float)0.00457925,
-    (float)0.00607656,
-    (float)0.00144066,
-    (float)0.0015719,
-    (float)0.00168178,
-    (float)0.000880638,
-    (float)0.000816502,
-    (float)0.000381026,
-    (float)0.00113239,
-    (float)0.000703922,
-    (float)0.000716854,
-    (float)0.000821601,
-    (float)0.000565933,
-    (float)0.00108518,
-    (float)0.00053504,
-    (float)0.000434926,
-    (float)0.000923572,
-    (float)0.000469971,
-    (float)0.000410476,
-    (float)0.000530344,
-    (float)0.000456295,
-    (float)0.000410222,
-    (float)0.000288039,
-    (float)0.000393063,
-    (float)0.000336871,
-    (float)0.000252457,
-    (float)0.000317131,
-    (float)0.000226837,
-    (float)0.000277131,
-    (float)0.00026863,
-    (float)0.000171844,
-    (float)0.000261061,
-    (float)0.000242422,
-    (float)0.000186864,
-    (float)0.000212688,
-    (float)0.000225328,
-    (float)0.00021196,
-    (float)0.000173124,
-    (float)0.000212678,
-    (float)0.000202157,
-    (float)0.000155611,
-    (float)0.000197837,
-    (float)0.000167406,
-    (float)0.0001486,
-    (float)0.000174958,
-    (float)0.000138221,
-    (float)0.000139011,
-    (float)0.000148547,
-    (float)0.000127455,
-    (float)0.000123349,
-    (float)0.000127805,
-    (float)0.000127539,
-    (float)0.000107195,
-    (float)0.00011576,
-    (float)0.000125612,
-    (float)9.80614e-05,
-    (float)0.000109666,
-    (float)0.000115666,
-    (float)9.64037e-05,
-    (float)0.000106097,
-    (float)0.00010245,
-    (float)9.51927e-05,
-    (float)0.000101122,
-    (float)9.4645e-05,
-    (float)8.96801e-05,
-    (float)9.13096e-05,
-    (float)9.29785e-05,
-    (float)8.2736e-05,
-    (float)7.89033e-05,
-    (float)8.94837e-05,
-    (float)7.78613e-05,
-    (float)7.10674e-05,
-    (float)8.02003e-05,
-    (float)7.31819e-05,
-    (float)7.03342e-05,
-    (float)7.14113e-05,
-    (float)6.71537e-05,
-    (float)7.06713e-05,
-    (float)6.92311e-05,
-    (float)6.40522e-05,
-    (float)6.67402e-05,
-    (float)7.0239e-05,
-    (float)6.69728e-05,
-    (float)6.17086e-05,
-    (float)6.83476e-05,
-    (float)7.01916e-05,
-    (float)6.07691e-05,
-    (float)6.46649e-05,
-    (float)6.6426e-05,
-    (float)6.18069e-05,
-    (float)6.32793e-05,
-    (float)5.84851e-05,
-    (float)5.93224e-05,
-    (float)6.23324e-05,
-    (float)5.53314e-05,
-    (float)5.43411e-05,
-    (float)5.78378e-05,
-    (float)5.84029e-05,
-    (float)5.27331e-05,
-    (float)5.31002e-05,
-    (float)6.06282e-05,
-    (float)5.51311e-05,
-    (float)5.4896e-05,
-    (float)5.86918e-05,
-    (float)5.63426e-05,
-    (float)6.12623e-05,
-    (float)5.71523e-05,
-    (float)5.47753e-05,
-    (float)6.25857e-05,
-    (float)5.87398e-05,
-    (float)5.45012e-05,
-    (float)5.60648e-05,
-    (float)5.93674e-05,
-    (float)5.64907e-05,
-    (float)5.01468e-05,
-    (float)5.64036e-05,
-    (float)5.5906e-05,
-    (float)5.15248e-05,
-    (float)5.41932e-05,
-    (float)0.135814,
-    (float)0.0321321,
-    (float)0.62481,
-    (float)0.0283099,
-    (float)0.0211388,
-    (float)0.0823883,
-    (float)0.0123516,
-    (float)0.0129882,
-    (float)0.010652,
-    (float)0.00450809,
-    (float)0.00525125,
-    (float)0.001296,
-    (float)0.00161929,
-    (float)0.00114843,
-    (float)0.0014616,
-    (float)0.00105225,
-    (float)0.000477193,
-    (float)0.00137808,
-    (float)0.000906012,
-    (float)0.00102559,
-    (float)0.00086217,
-    (float)0.000689472,
-    (float)0.00116747,
-    (float)0.000618149,
-    (float)0.000573388,
-    (float)0.000776013,
-    (float)0.000576898,
-    (float)0.000566964,
-    (float)0.000394123,
-    (float)0.000504465,
-    (float)0.000501249,
-    (float)0.000285024,
-    (float)0.000394191,
-    (float)0.000352434,
-    (float)0.00031535,
-    (float)0.000317085,
-    (float)0.000250126,
-    (float)0.000312321,
-    (float)0.000278614,
-    (float)0.000251553,
-    (float)0.000257591,
-    (float)0.000254503,
-    (float)0.000280653,
-    (float)0.000209302,
-    (float)0.000234779,
-    (float)0.000263373,
-    (float)0.000191904,
-    (float)0.000213991,
-    (float)0.000211849,
-    (float)0.000187197,
-    (float)0.000187002,
-    (float)0.000172948,
-    (float)0.00017511,
-    (float)0.000158296,
-    (float)0.000161576,
-    (float)0.000154832,
-    (float)0.000136912,
-    (float)0.00015985,
-    (float)0.000137832,
-    (float)0.000125443,
-    (float)0.000149454,
-    (float)0.000131168,
-    (float)0.000120364,
-    (float)0.000130118,
-    (float)0.000129271,
-    (float)0.000116459,
-    (float)0.000113943,
-    (float)0.000123193,
-    (float)0.000108666,
-    (float)0.000107458,
-    (float)0.00011336,
-    (float)9.65035e-05,
-    (float)0.000103513,
-    (float)0.000105689,
-    (float)8.67077e-05,
-    (float)9.37342e-05,
-    (float)9.97227e-05,
-    (float)8.48068e-05,
-    (float)8.1732e-05,
-    (float)9.14216e-05,
-    (float)8.61431e-05,
-    (float)7.58279e-05,
-    (float)8.37589e-05,
-    (float)8.28356e-05,
-    (float)7.50525e-05,
-    (float)8.235e-05,
-    (float)7.64484e-05,
-    (float)7.25226e-05,
-    (float)8.34608e-05,
-    (float)7.4352e-05,
-    (float)6.79658e-05,
-    (float)7.86589e-05,
-    (float)7.62841e-05,
-    (float)6.61523e-05,
-    (float)6.93549e-05,
-    (float)7.52218e-05,
-    (float)6.60968e-05,
-    (float)6.47603e-05,
-    (float)7.01604e-05,
-    (float)6.28196e-05,
-    (float)6.64732e-05,
-    (float)6.71695e-05,
-    (float)5.82207e-05,
-    (float)6.66918e-05,
-    (float)6.79965e-05,
-    (float)5.91266e-05,
-    (float)6.20835e-05,
-    (float)6.79737e-05,
-    (float)6.45058e-05,
-    (float)5.84798e-05,
-    (float)6.57752e-05,
-    (float)6.56041e-05,
-    (float)5.96962e-05,
-    (float)6.53613e-05,
-    (float)6.04648e-05,
-    (float)6.13791e-05,
-    (float)6.69429e-05,
-    (float)5.7595e-05,
-    (float)5.95292e-05,
-    (float)6.55753e-05,
-    (float)6.17202e-05,
-    (float)5.70223e-05,
-    (float)6.10273e-05,
-    (float)6.60058e-05,
-    (float)5.7263e-05,
-    (float)5.98239e-05,
-    (float)6.38915e-05,
-    (float)5.81573e-05,
-    (float)0.165227,
-    (float)0.0379163,
-    (float)0.595302,
-    (float)0.0316228,
-    (float)0.022788,
-    (float)0.0716407,
-    (float)0.0128472,
-    (float)0.0128418,
-    (float)0.00790363,
-    (float)0.00439727,
-    (float)0.00445202,
-    (float)0.00166504,
-    (float)0.00174645,
-    (float)0.000823129,
-    (float)0.00202384,
-    (float)0.00131514,
-    (float)0.000728594,
-    (float)0.0015141,
-    (float)0.00107322,
-    (float)0.00128495,
-    (float)0.00092598,
-    (float)0.000815213,
-    (float)0.00112461,
-    (float)0.000752206,
-    (float)0.000744942,
-    (float)0.000611695,
-    (float)0.000669344,
-    (float)0.000701319,
-    (float)0.000343509,
-    (float)0.000522391,
-    (float)0.000526892,
-    (float)0.000342295,
-    (float)0.000398399,
-    (float)0.000354506,
-    (float)0.000361685,
-    (float)0.00033381,
-    (float)0.000322869,
-    (float)0.000311506,
-    (float)0.000297347,
-    (float)0.000357244,
-    (float)0.000253747,
-    (float)0.000271538,
-    (float)0.00033747,
-    (float)0.000230977,
-    (float)0.000246658,
-    (float)0.000269347,
-    (float)0.000224828,
-    (float)0.000212302,
-    (float)0.000218536,
-    (float)0.000210383,
-    (float)0.000175807,
-    (float)0.00020199,
-    (float)0.000186616,
-    (float)0.000152259,
-    (float)0.000193969,
-    (float)0.000167044,
-    (float)0.000142232,
-    (float)0.000176075,
-    (float)0.000159715,
-    (float)0.000136599,
-    (float)0.000152289,
-    (float)0.000157167,
-    (float)0.000129776,
-    (float)0.00013511,
-    (float)0.000148522,
-    (float)0.000119818,
-    (float)0.000127379,
-    (float)0.000135592,
-    (float)0.000107936,
-    (float)0.000119392,
-    (float)0.00012557,
-    (float)9.99407e-05,
-    (float)0.000105384,
-    (float)0.000116966,
-    (float)9.82753e-05,
-    (float)9.25827e-05,
-    (float)0.000106732,
-    (float)9.66106e-05,
-    (float)8.74339e-05,
-    (float)9.9812e-05,
-    (float)9.07321e-05,
-    (float)8.53281e-05,
-    (float)9.86848e-05,
-    (float)8.61006e-05,
-    (float)8.1157e-05,
-    (float)9.59186e-05,
-    (float)8.65978e-05,
-    (float)7.73162e-05,
-    (float)8.72862e-05,
-    (float)8.66923e-05,
-    (float)7.51609e-05,
-    (float)7.94378e-05,
-    (float)8.20304e-05,
-    (float)7.1037e-05,
-    (float)7.72368e-05,
-    (float)7.6793e-05,
-    (float)6.55416e-05,
-    (float)7.6048e-05,
-    (float)7.51421e-05,
-    (float)6.47738e-05,
-    (float)7.2018e-05,
-    (float)7.54416e-05,
-    (float)6.88833e-05,
-    (float)6.86589e-05,
-    (float)7.58341e-05,
-    (float)7.04792e-05,
-    (float)6.88567e-05,
-    (float)7.64584e-05,
-    (float)6.69267e-05,
-    (float)6.93733e-05,
-    (float)7.55043e-05,
-    (float)6.40659e-05,
-    (float)6.67504e-05,
-    (float)7.12603e-05,
-    (float)6.55707e-05,
-    (float)6.25394e-05,
-    (float)6.7269e-05,
-    (float)6.76215e-05,
-    (float)6.03974e-05,
-    (float)6.81858e-05,
-    (float)6.68021e-05,
-    (float)6.15448e-05,
-    (float)7.1942e-05,
-    (float)6.60124e-05,
-    (float)6.41507e-05,
-    (float)7.2434e-05,
-    (float)6.87686e-05,
-    (float)6.5447e-05,
-    (float)0.19739,
-    (float)0.0442908,
-    (float)0.561077,
-    (float)0.034899,
-    (float)0.0243116,
-    (float)0.0613245,
-    (float)0.0132351,
-    (float)0.0125274,
-    (float)0.00606378,
-    (float)0.00433896,
-    (float)0.00371373,
-    (float)0.0023292,
-    (float)0.00198128,
-    (float)0.00070499,
-    (float)0.00244933,
-    (float)0.00159814,
-    (float)0.00105914,
-    (float)0.0015638,
-    (float)0.00123084,
-    (float)0.00144925,
-    (float)0.00101967,
-    (float)0.00097847,
-    (float)0.00100815,
-    (float)0.000875687,
-    (float)0.000926856,
-    (float)0.000502167,
-    (float)0.000705192,
-    (float)0.000770668,
-    (float)0.000380521,
-    (float)0.000515624,
-    (float)0.000513381,
-    (float)0.000419321,
-    (float)0.00040736,
-    (float)0.000403512,
-    (float)0.000387859,
-    (float)0.000351549,
-    (float)0.000435276,
-    (float)0.000317601,
-    (float)0.000314471,
-    (float)0.000423424,
-    (float)0.000283618,
-    (float)0.000285772,
-    (float)0.00033626,
-    (float)0.000273834,
-    (float)0.000247025,
-    (float)0.000265664,
-    (float)0.000255612,
-    (float)0.000201809,
-    (float)0.00024063,
-    (float)0.000227297,
-    (float)0.000174221,
-    (float)0.00022566,
-    (float)0.000203749,
-    (float)0.000166459,
-    (float)0.000200931,
-    (float)0.000193748,
-    (float)0.000161447,
-    (float)0.000173645,
-    (float)0.000188699,
-    (float)0.00015209,
-    (float)0.000154543,
-    (float)0.000175161,
-    (float)0.000140628,
-    (float)0.000143925,
-    (float)0.00015626,
-    (float)0.000128885,
-    (float)0.000132322,
-    (float)0.000141989,
-    (float)0.000120955,
-    (float)0.000116446,
-    (float)0.00013042,
-    (float)0.000118148,
-    (float)0.000105113,
-    (float)0.000118544,
-    (float)0.000114046,
-    (float)0.000102171,
-    (float)0.00011166,
-    (float)0.000106916,
-    (float)0.00010013,
-    (float)0.000108788,
-    (float)0.000102924,
-    (float)9.55294e-05,
-    (float)0.000101412,
-    (float)0.000101295,
-    (float)9.17924e-05,
-    (float)9.06996e-05,
-    (float)9.54356e-05,
-    (float)8.76385e-05,
-    (float)8.49076e-05,
-    (float)8.73248e-05,
-    (float)8.12618e-05,
-    (float)8.35099e-05,
-    (float)8.31233e-05,
-    (float)7.87527e-05,
-    (float)8.11732e-05,
-    (float)8.20898e-05,
-    (float)8.24774e-05,
-    (float)7.88938e-05,
-    (float)8.14925e-05,
-    (float)8.38249e-05,
-    (float)7.87388e-05,
-    (float)8.09887e-05,
-    (float)7.8567e-05,
-    (float)7.79216e-05,
-    (float)7.80076e-05,
-    (float)7.36422e-05,
-    (float)7.49874e-05,
-    (float)7.16804e-05,
-    (float)7.32972e-05,
-    (float)7.22723e-05,
-    (float)6.862e-05,
-    (float)7.40353e-05,
-    (float)7.13868e-05,
-    (float)7.26178e-05,
-    (float)7.37541e-05,
-    (float)7.29848e-05,
-    (float)7.64883e-05,
-    (float)7.35899e-05,
-    (float)7.6269e-05,
-    (float)7.41286e-05,
-    (float)7.33984e-05,
-    (float)7.63901e-05,
-    (float)6.98714e-05,
-    (float)7.24373e-05,
-    (float)7.11105e-05,
-    (float)6.90976e-05,
-    (float)7.07823e-05,
-    (float)6.74412e-05,
-    (float)0.231572,
-    (float)0.0512548,
-    (float)0.522969,
-    (float)0.0379037,
-    (float)0.0257219,
-    (float)0.0518207,
-    (float)0.0134367,
-    (float)0.0120916,
-    (float)0.00509026,
-    (float)0.00433321,
-    (float)0.00308156,
-    (float)0.00313481,
-    (float)0.00229916,
-    (float)0.00077802,
-    (float)0.00273035,
-    (float)0.00186512,
-    (float)0.00140959,
-    (float)0.00159874,
-    (float)0.00137828,
-    (float)0.00150314,
-    (float)0.00114736,
-    (float)0.00116539,
-    (float)0.000862066,
-    (float)0.000962626,
-    (float)0.00106744,
-    (float)0.000471733,
-    (float)0.000706759,
-    (float)0.000772966,
-    (float)0.000471098,
-    (float)0.000520513,
-    (float)0.000523944,
-    (float)0.000478763,
-    (float)0.000430054,
-    (float)0.000510586,
-    (float)0.000397979,
-    (float)0.000371226,
-    (float)0.000521825,
-    (float)0.000342785,
-    (float)0.000333137,
-    (float)0.000423099,
-    (float)0.000328299,
-    (float)0.000295312,
-    (float)0.000323438,
-    (float)0.000306763,
-    (float)0.000242649,
-    (float)0.000287088,
-    (float)0.00027301,
-    (float)0.000204886,
-    (float)0.000265821,
-    (float)0.000243818,
-    (float)0.000196139,
-    (float)0.000232468,
-    (float)0.000227496,
-    (float)0.000191211,
-    (float)0.000200531,
-    (float)0.000217707,
-    (float)0.000177253,
-    (float)0.000179166,
-    (float)0.00020017,
-    (float)0.000162911,
-    (float)0.000165596,
-    (float)0.000176923,
-    (float)0.000151317,
-    (float)0.000151564,
-    (float)0.000160178,
-    (float)0.000142587,
-    (float)0.000134896,
-    (float)0.000147408,
-    (float)0.000137245,
-    (float)0.000124138,
-    (float)0.000133995,
-    (float)0.000129872,
-    (float)0.000120736,
-    (float)0.000125668,
-    (float)0.000120555,
-    (float)0.000115773,
-    (float)0.000120209,
-    (float)0.000115722,
-    (float)0.000109099,
-    (float)0.000109777,
-    (float)0.000111719,
-    (float)0.000105259,
-    (float)9.99134e-05,
-    (float)0.000103151,
-    (float)9.98375e-05,
-    (float)9.70341e-05,
-    (float)9.59898e-05,
-    (float)9.28853e-05,
-    (float)9.44983e-05,
-    (float)9.32381e-05,
-    (float)9.25965e-05,
-    (float)8.92952e-05,
-    (float)9.00968e-05,
-    (float)9.47987e-05,
-    (float)8.71545e-05,
-    (float)8.73554e-05,
-    (float)8.96826e-05,
-    (float)8.68334e-05,
-    (float)8.60733e-05,
-    (float)8.34033e-05,
-    (float)8.39e-05,
-    (float)8.10969e-05,
-    (float)8.38557e-05,
-    (float)8.13986e-05,
-    (float)7.54498e-05,
-    (float)8.44428e-05,
-    (float)8.09131e-05,
-    (float)7.73834e-05,
-    (float)8.11592e-05,
-    (float)8.00604e-05,
-    (float)8.0725e-05,
-    (float)7.95882e-05,
-    (float)8.09291e-05,
-    (float)7.63686e-05,
-    (float)7.98004e-05,
-    (float)8.29425e-05,
-    (float)7.18633e-05,
-    (float)7.82871e-05,
-    (float)8.00074e-05,
-    (float)7.45681e-05,
-    (float)7.69763e-05,
-    (float)7.62098e-05,
-    (float)7.70666e-05,
-    (float)7.62832e-05,
-    (float)8.01508e-05,
-    (float)7.51829e-05,
-    (float)7.46765e-05,
-    (float)8.44867e-05,
-    (float)0.267319,
-    (float)0.0586929,
-    (float)0.48171,
-    (float)0.0406608,
-    (float)0.0269556,
-    (float)0.0433428,
-    (float)0.0135327,
-    (float)0.0115446,
-    (float)0.00483413,
-    (float)0.00441838,
-    (float)0.00258328,
-    (float)0.00389523,
-    (float)0.00266429,
-    (float)0.0010058,
-    (float)0.00285002,
-    (float)0.00209235,
-    (float)0.00172975,
-    (float)0.00164678,
-    (float)0.00153527,
-    (float)0.00147407,
-    (float)0.00127855,
-    (float)0.00135986,
-    (float)0.00075388,
-    (float)0.000999225,
-    (float)0.00113353,
-    (float)0.000528664,
-    (float)0.000696362,
-    (float)0.000741778,
-    (float)0.00057191,
-    (float)0.000537495,
-    (float)0.00058785,
-    (float)0.00050959,
-    (float)0.000453272,
-    (float)0.000617921,
-    (float)0.000419391,
-    (float)0.00039478,
-    (float)0.000536983,
-    (float)0.000393006,
-    (float)0.000355593,
-    (float)0.000396645,
-    (float)0.000369352,
-    (float)0.000300464,
-    (float)0.00033486,
-    (float)0.000325278,
-    (float)0.000246651,
-    (float)0.000309223,
-    (float)0.000287229,
-    (float)0.000230947,
-    (float)0.0002678,
-    (float)0.000263639,
-    (float)0.000228879,
-    (float)0.000229894,
-    (float)0.000247662,
-    (float)0.000212022,
-    (float)0.000207331,
-    (float)0.000225785,
-    (float)0.000192846,
-    (float)0.000191347,
-    (float)0.000197388,
-    (float)0.000179791,
-    (float)0.000174849,
-    (float)0.000176118,
-    (float)0.000168109,
-    (float)0.000157839,
-    (float)0.000160998,
-    (float)0.000157747,
-    (float)0.000147662,
-    (float)0.000146031,
-    (float)0.000146367,
-    (float)0.000143866,
-    (float)0.000136768,
-    (float)0.000134784,
-    (float)0.000137161,
-    (float)0.000130594,
-    (float)0.00012778,
-    (float)0.000129544,
-    (float)0.000119941,
-    (float)0.000119911,
-    (float)0.000124618,
-    (float)0.000111928,
-    (float)0.000108361,
-    (float)0.000115693,
-    (float)0.000110299,
-    (float)0.000101156,
-    (float)0.000106853,
-    (float)0.00010616,
-    (float)9.79033e-05,
-    (float)0.000106605,
-    (float)0.000101192,
-    (float)9.37095e-05,
-    (float)0.000104551,
-    (float)0.000101605,
-    (float)9.21906e-05,
-    (float)9.4946e-05,
-    (float)0.000100302,
-    (float)9.10722e-05,
-    (float)9.03969e-05,
-    (float)9.46984e-05,
-    (float)8.4558e-05,
-    (float)9.09687e-05,
-    (float)9.18679e-05,
-    (float)8.17942e-05,
-    (float)8.63122e-05,
-    (float)9.04071e-05,
-    (float)8.71251e-05,
-    (float)8.21788e-05,
-    (float)8.84607e-05,
-    (float)8.6782e-05,
-    (float)8.44565e-05,
-    (float)8.9688e-05,
-    (float)8.064e-05,
-    (float)8.46081e-05,
-    (float)8.8414e-05,
-    (float)8.21897e-05,
-    (float)8.11256e-05,
-    (float)8.16942e-05,
-    (float)8.54357e-05,
-    (float)8.027e-05,
-    (float)8.13042e-05,
-    (float)8.07698e-05,
-    (float)8.01721e-05,
-    (float)8.66322e-05,
-    (float)7.86393e-05,
-    (float)8.04161e-05,
-    (float)8.39624e-05,
-    (float)8.31616e-05,
-    (float)8.35829e-05,
-    (float)7.9327e-05,
-    (float)0.303767,
-    (float)0.0665786,
-    (float)0.438456,
-    (float)0.0429951,
-    (float)0.0280258,
-    (float)0.0360906,
-    (float)0.0134952,
-    (float)0.0109274,
-    (float)0.00512442,
-    (float)0.00458051,
-    (float)0.00224428,
-    (float)0.00451087,
-    (float)0.00302308,
-    (float)0.00135378,
-    (float)0.00287387,
-    (float)0.00226862,
-    (float)0.00198439,
-    (float)0.0017387,
-    (float)0.00170776,
-    (float)0.00139138,
-    (float)0.0013867,
-    (float)0.00151359,
-    (float)0.000715275,
-    (float)0.000999309,
-    (float)0.00111424,
-    (float)0.000639043,
-    (float)0.000697887,
-    (float)0.000729556,
-    (float)0.000646388,
-    (float)0.000565943,
-    (float)0.000689023,
-    (float)0.000529652,
-    (float)0.000484268,
-    (float)0.000667137,
-    (float)0.000465033,
-    (float)0.000430107,
-    (float)0.000502582,
-    (float)0.000442432,
-    (float)0.000375301,
-    (float)0.00038823,
-    (float)0.000388369,
-    (float)0.000306631,
-    (float)0.0003551,
-    (float)0.000332913,
-    (float)0.000272822,
-    (float)0.000312792,
-    (float)0.000301966,
-    (float)0.000270638,
-    (float)0.000265032,
-    (float)0.000281124,
-    (float)0.000254715,
-    (float)0.000239242,
-    (float)0.000253238,
-    (float)0.00022769,
-    (float)0.00022256,
-    (float)0.000220321,
-    (float)0.000208526,
-    (float)0.000201162,
-    (float)0.00019561,
-    (float)0.000194337,
-    (float)0.000181149,
-    (float)0.000177538,
-    (float)0.00017965,
-    (float)0.000171818,
-    (float)0.00016191,
-    (float)0.00016409,
-    (float)0.000166084,
-    (float)0.000153048,
-    (float)0.000152031,
-    (float)0.00015545,
-    (float)0.000144878,
-    (float)0.000143599,
-    (float)0.000146857,
-    (float)0.000132515,
-    (float)0.000131285,
-    (float)0.000139486,
-    (float)0.000125078,
-    (float)0.000118668,
-    (float)0.000126452,
-    (float)0.000121695,
-    (float)0.000113066,
-    (float)0.000118877,
-    (float)0.000115463,
-    (float)0.000108737,
-    (float)0.000119805,
-    (float)0.000112406,
-    (float)0.00010423,
-    (float)0.000113403,
-    (float)0.000112108,
-    (float)0.000102989,
-    (float)0.000102632,
-    (float)0.000106057,
-    (float)9.74573e-05,
-    (float)9.99681e-05,
-    (float)9.96177e-05,
-    (float)8.92582e-05,
-    (float)9.77363e-05,
-    (float)9.82705e-05,
-    (float)9.14948e-05,
-    (float)9.20789e-05,
-    (float)9.72713e-05,
-    (float)9.61214e-05,
-    (float)9.20985e-05,
-    (float)9.70243e-05,
-    (float)9.03609e-05,
-    (float)9.31899e-05,
-    (float)9.61089e-05,
-    (float)8.60522e-05,
-    (float)8.77162e-05,
-    (float)8.9073e-05,
-    (float)8.92179e-05,
-    (float)8.36131e-05,
-    (float)8.51186e-05,
-    (float)8.77457e-05,
-    (float)8.5165e-05,
-    (float)9.0793e-05,
-    (float)8.47519e-05,
-    (float)8.70999e-05,
-    (float)9.16891e-05,
-    (float)8.91254e-05,
-    (float)8.81675e-05,
-    (float)8.46953e-05,
-    (float)9.03392e-05,
-    (float)8.66668e-05,
-    (float)8.44802e-05,
-    (float)8.38779e-05,
-    (float)8.23143e-05,
-    (float)8.77918e-05,
-    (float)0.340291,
-    (float)0.0747012,
-    (float)0.394343,
-    (float)0.0448427,
-    (float)0.0288601,
-    (float)0.0300985,
-    (float)0.0133616,
-    (float)0.0102689,
-    (float)0.00576448,
-    (float)0.00483231,
-    (float)0.00208796,
-    (float)0.00493968,
-    (float)0.00336042,
-    (float)0.00178166,
-    (float)0.00285912,
-    (float)0.00240858,
-    (float)0.00214697,
-    (float)0.00185341,
-    (float)0.00187927,
-    (float)0.00128525,
-    (float)0.00144067,
-    (float)0.00158758,
-    (float)0.000755847,
-    (float)0.000983656,
-    (float)0.00105181,
-    (float)0.000766898,
-    (float)0.000723675,
-    (float)0.000775136,
-    (float)0.000690373,
-    (float)0.000602481,
-    (float)0.000778659,
-    (float)0.000561448,
-    (float)0.000520428,
-    (float)0.000643961,
-    (float)0.000519002,
-    (float)0.000463219,
-    (float)0.000465563,
-    (float)0.000466959,
-    (float)0.000386392,
-    (float)0.000404212,
-    (float)0.000394527,
-    (float)0.000328229,
-    (float)0.000364548,
-    (float)0.000346154,
-    (float)0.000319428,
-    (float)0.000307668,
-    (float)0.000316217,
-    (float)0.000303233,
-    (float)0.000272618,
-    (float)0.000283907,
-    (float)0.000268022,
-    (float)0.000253766,
-    (float)0.000244736,
-    (float)0.000243261,
-    (float)0.000232162,
-    (float)0.000215345,
-    (float)0.000224914,
-    (float)0.000210485,
-    (float)0.000197037,
-    (float)0.00020478,
-    (float)0.000198455,
-    (float)0.000179218,
-    (float)0.000184634,
-    (float)0.000190157,
-    (float)0.000167467,
-    (float)0.000168349,
-    (float)0.000175959,
-    (float)0.000159727,
-    (float)0.000156944,
-    (float)0.000164441,
-    (float)0.000148313,
-    (float)0.000143627,
-    (float)0.000155075,
-    (float)0.000140922,
-    (float)0.000131209,
-    (float)0.00013958,
-    (float)0.000136566,
-    (float)0.000125374,
-    (float)0.000130152,
-    (float)0.000128751,
-    (float)0.000120075,
-    (float)0.000127855,
-    (float)0.000124216,
-    (float)0.000116056,
-    (float)0.000118167,
-    (float)0.000120943,
-    (float)0.00011474,
-    (float)0.00010874,
-    (float)0.000112809,
-    (float)0.000107843,
-    (float)0.000107382,
-    (float)0.000106413,
-    (float)0.000102269,
-    (float)0.000103835,
-    (float)0.000103308,
-    (float)0.000105666,
-    (float)9.9457e-05,
-    (float)0.000100659,
-    (float)0.000103817,
-    (float)0.000100362,
-    (float)9.91607e-05,
-    (float)9.56133e-05,
-    (float)9.92264e-05,
-    (float)9.47218e-05,
-    (float)9.47496e-05,
-    (float)9.46944e-05,
-    (float)8.97675e-05,
-    (float)9.5441e-05,
-    (float)9.35919e-05,
-    (float)9.25911e-05,
-    (float)9.07837e-05,
-    (float)9.51429e-05,
-    (float)9.53014e-05,
-    (float)8.95581e-05,
-    (float)9.49968e-05,
-    (float)9.03049e-05,
-    (float)9.14162e-05,
-    (float)9.17202e-05,
-    (float)8.8603e-05,
-    (float)8.84251e-05,
-    (float)8.82497e-05,
-    (float)9.29101e-05,
-    (float)8.56431e-05,
-    (float)8.94494e-05,
-    (float)9.23474e-05,
-    (float)8.91774e-05,
-    (float)9.20117e-05,
-    (float)8.96335e-05,
-    (float)0.376069,
-    (float)0.0829178,
-    (float)0.350499,
-    (float)0.0462109,
-    (float)0.0294396,
-    (float)0.0254058,
-    (float)0.013195,
-    (float)0.00960921,
-    (float)0.00656755,
-    (float)0.0051467,
-    (float)0.00210772,
-    (float)0.00516646,
-    (float)0.00363792,
-    (float)0.00222981,
-    (float)0.00284057,
-    (float)0.00252705,
-    (float)0.00221487,
-    (float)0.00196611,
-    (float)0.0020327,
-    (float)0.0012054,
-    (float)0.00145273,
-    (float)0.00158088,
-    (float)0.000864599,
-    (float)0.000980211,
-    (float)0.00100165,
-    (float)0.00086835,
-    (float)0.000762387,
-    (float)0.000857775,
-    (float)0.000710591,
-    (float)0.000639537,
-    (float)0.000807109,
-    (float)0.00060643,
-    (float)0.000563082,
-    (float)0.000591955,
-    (float)0.00055627,
-    (float)0.000488536,
-    (float)0.000465319,
-    (float)0.000470403,
-    (float)0.000399243,
-    (float)0.00042386,
-    (float)0.000398661,
-    (float)0.000368147,
-    (float)0.000361336,
-    (float)0.000355168,
-    (float)0.000355499,
-    (float)0.000313925,
-    (float)0.000320071,
-    (float)0.00031277,
-    (float)0.000290913,
-    (float)0.000277931,
-    (float)0.000278827,
-    (float)0.000266614,
-    (float)0.000240238,
-    (float)0.0002558,
-    (float)0.000240949,
-    (float)0.000219997,
-    (float)0.000229511,
-    (float)0.000223513,
-    (float)0.000201573,
-    (float)0.000206666,
-    (float)0.000212385,
-    (float)0.000185904,
-    (float)0.000188143,
-    (float)0.000195732,
-    (float)0.000177681,
-    (float)0.000174206,
-    (float)0.000180164,
-    (float)0.00016539,
-    (float)0.000160296,
-    (float)0.000169056,
-    (float)0.000154885,
-    (float)0.000147185,
-    (float)0.000152506,
-    (float)0.000148734,
-    (float)0.000140381,
-    (float)0.000141818,
-    (float)0.000139387,
-    (float)0.000133891,
-    (float)0.000138534,
-    (float)0.000133177,
-    (float)0.000128857,
-    (float)0.000127889,
-    (float)0.000128152,
-    (float)0.000125766,
-    (float)0.000119335,
-    (float)0.000119379,
-    (float)0.000116772,
-    (float)0.000117528,
-    (float)0.000113264,
-    (float)0.000112036,
-    (float)0.00011177,
-    (float)0.000109325,
-    (float)0.000113931,
-    (float)0.000107726,
-    (float)0.000106864,
-    (float)0.000108058,
-    (float)0.000107814,
-    (float)0.000104909,
-    (float)0.00010221,
-    (float)0.000104382,
-    (float)9.85916e-05,
-    (float)0.000103144,
-    (float)0.000100159,
-    (float)9.59935e-05,
-    (float)9.98097e-05,
-    (float)9.87988e-05,
-    (float)9.8758e-05,
-    (float)9.55445e-05,
-    (float)9.94667e-05,
-    (float)9.5461e-05,
-    (float)9.66116e-05,
-    (float)9.87405e-05,
-    (float)9.20665e-05,
-    (float)9.60641e-05,
-    (float)9.45118e-05,
-    (float)9.49354e-05,
-    (float)9.22885e-05,
-    (float)9.39005e-05,
-    (float)9.43993e-05,
-    (float)9.10774e-05,
-    (float)9.61452e-05,
-    (float)9.12342e-05,
-    (float)9.3528e-05,
-    (float)9.30595e-05,
-    (float)9.29122e-05,
-    (float)9.36018e-05,
-    (float)9.08657e-05,
-    (float)9.51716e-05,
-    (float)0.410345,
-    (float)0.0911129,
-    (float)0.308054,
-    (float)0.0470758,
-    (float)0.0297594,
-    (float)0.021942,
-    (float)0.0130164,
-    (float)0.00898215,
-    (float)0.00737798,
-    (float)0.00548397,
-    (float)0.0022867,
-    (float)0.00522485,
-    (float)0.00384463,
-    (float)0.00264687,
-    (float)0.00284825,
-    (float)0.00264058,
-    (float)0.00220018,
-    (float)0.00205702,
-    (float)0.00214297,
-    (float)0.0011798,
-    (float)0.00143528,
-    (float)0.00151505,
-    (float)0.00100118,
-    (float)0.000992041,
-    (float)0.000996609,
-    (float)0.000923634,
-    (float)0.000802158,
-    (float)0.000936262,
-    (float)0.00073357,
-    (float)0.000679189,
-    (float)0.000778407,
-    (float)0.000656211,
-    (float)0.000602764,
-    (float)0.000557582,
-    (float)0.000567968,
-    (float)0.000500077,
-    (float)0.000484813,
-    (float)0.000467151,
-    (float)0.000424071,
-    (float)0.000425558,
-    (float)0.000404006,
-    (float)0.00041074,
-    (float)0.00036163,
-    (float)0.000359843,
-    (float)0.000369064,
-    (float)0.000332323,
-    (float)0.000316751,
-    (float)0.000319114,
-    (float)0.00030493,
-    (float)0.000270057,
-    (float)0.000290255,
-    (float)0.000274886,
-    (float)0.000242584,
-    (float)0.0002573,
-    (float)0.000251977,
-    (float)0.000225703,
-    (float)0.000229508,
-    (float)0.000236741,
-    (float)0.000206792,
-    (float)0.000208787,
-    (float)0.000218478,
-    (float)0.000196977,
-    (float)0.00019131,
-    (float)0.000197581,
-    (float)0.000184864,
-    (float)0.000176741,
-    (float)0.000183055,
-    (float)0.000170791,
-    (float)0.000162835,
-    (float)0.000165315,
-    (float)0.000162906,
-    (float)0.000155386,
-    (float)0.000152174,
-    (float)0.000151902,
-    (float)0.000149259,
-    (float)0.000148105,
-    (float)0.000143163,
-    (float)0.000143202,
-    (float)0.000137143,
-    (float)0.0001359,
-    (float)0.000138492,
-    (float)0.000128734,
-    (float)0.000124886,
-    (float)0.000127759,
-    (float)0.000126941,
-    (float)0.000118229,
-    (float)0.000122645,
-    (float)0.000120803,
-    (float)0.000114305,
-    (float)0.000122456,
-    (float)0.000118408,
-    (float)0.000112017,
-    (float)0.000113358,
-    (float)0.000117403,
-    (float)0.000109358,
-    (float)0.000108027,
-    (float)0.000110883,
-    (float)0.000102596,
-    (float)0.000106982,
-    (float)0.00010651,
-    (float)0.000102913,
-    (float)0.000101334,
-    (float)0.0001048,
-    (float)0.000105233,
-    (float)0.000100849,
-    (float)0.000104193,
-    (float)9.97724e-05,
-    (float)0.000102218,
-    (float)0.000100681,
-    (float)9.89095e-05,
-    (float)9.85765e-05,
-    (float)9.47583e-05,
-    (float)9.88848e-05,
-    (float)9.65054e-05,
-    (float)9.6421e-05,
-    (float)9.39415e-05,
-    (float)9.78953e-05,
-    (float)9.75627e-05,
-    (float)9.4614e-05,
-    (float)0.000100278,
-    (float)9.40365e-05,
-    (float)9.5846e-05,
-    (float)9.78909e-05,
-    (float)9.64825e-05,
-    (float)9.22465e-05,
-    (float)9.42223e-05,
-    (float)9.7044e-05,
-    (float)9.0188e-05,
-    (float)0.442657,
-    (float)0.0991294,
-    (float)0.267856,
-    (float)0.0474546,
-    (float)0.0298181,
-    (float)0.019529,
-    (float)0.0128531,
-    (float)0.00844083,
-    (float)0.00806984,
-    (float)0.0058175,
-    (float)0.00261367,
-    (float)0.00516136,
-    (float)0.00397955,
-    (float)0.00299994,
-    (float)0.00288301,
-    (float)0.00273905,
-    (float)0.00213711,
-    (float)0.0021045,
-    (float)0.00217574,
-    (float)0.00122187,
-    (float)0.00140962,
-    (float)0.00142154,
-    (float)0.00112783,
-    (float)0.00102499,
-    (float)0.00103546,
-    (float)0.000946161,
-    (float)0.000844607,
-    (float)0.000970292,
-    (float)0.000769022,
-    (float)0.000722721,
-    (float)0.000722875,
-    (float)0.000683265,
-    (float)0.000626402,
-    (float)0.000555327,
-    (float)0.000558927,
-    (float)0.000507396,
-    (float)0.000501256,
-    (float)0.000467872,
-    (float)0.000461619,
-    (float)0.000424252,
-    (float)0.000410104,
-    (float)0.000431793,
-    (float)0.000376779,
-    (float)0.000361133,
-    (float)0.000365289,
-    (float)0.000346537,
-    (float)0.00031091,
-    (float)0.000324534,
-    (float)0.00030994,
-    (float)0.00027259,
-    (float)0.000290893,
-    (float)0.000281831,
-    (float)0.000254414,
-    (float)0.000256139,
-    (float)0.000260277,
-    (float)0.000233133,
-    (float)0.000232274,
-    (float)0.000238533,
-    (float)0.000216604,
-    (float)0.000211758,
-    (float)0.000214599,
-    (float)0.000203974,
-    (float)0.000196033,
-    (float)0.00019756,
-    (float)0.000187486,
-    (float)0.000181778,
-    (float)0.000180368,
-    (float)0.000176175,
-    (float)0.000171238,
-    (float)0.000165058,
-    (float)0.000163278,
-    (float)0.000162911,
-    (float)0.000159214,
-    (float)0.000152577,
-    (float)0.000154824,
-    (float)0.000148763,
-    (float)0.000145077,
-    (float)0.000148162,
-    (float)0.000139955,
-    (float)0.000134006,
-    (float)0.000136557,
-    (float)0.000136257,
-    (float)0.000127073,
-    (float)0.000130613,
-    (float)0.000128386,
-    (float)0.000122987,
-    (float)0.000128673,
-    (float)0.000125456,
-    (float)0.000119913,
-    (float)0.000119413,
-    (float)0.00012231,
-    (float)0.000115586,
-    (float)0.000115497,
-    (float)0.000114445,
-    (float)0.000108556,
-    (float)0.000113013,
-    (float)0.000111245,
-    (float)0.000109244,
-    (float)0.000107341,
-    (float)0.000109745,
-    (float)0.000108357,
-    (float)0.000108118,
-    (float)0.000107987,
-    (float)0.000102097,
-    (float)0.000105796,
-    (float)0.000103223,
-    (float)0.000102552,
-    (float)0.000100597,
-    (float)9.93099e-05,
-    (float)0.000100341,
-    (float)0.00010087,
-    (float)0.000102303,
-    (float)9.73789e-05,
-    (float)0.000101652,
-    (float)9.97989e-05,
-    (float)9.994e-05,
-    (float)0.000100806,
-    (float)9.62804e-05,
-    (float)9.66058e-05,
-    (float)9.70196e-05,
-    (float)9.87958e-05,
-    (float)9.33709e-05,
-    (float)9.69621e-05,
-    (float)9.64297e-05,
-    (float)9.55584e-05,
-    (float)0.000100567,
-    (float)9.70391e-05,
-    (float)9.6586e-05,
-    (float)0.472425,
-    (float)0.106904,
-    (float)0.230715,
-    (float)0.0473317,
-    (float)0.0296477,
-    (float)0.0180173,
-    (float)0.0127147,
-    (float)0.00801493,
-    (float)0.00859288,
-    (float)0.00611539,
-    (float)0.00304231,
-    (float)0.00503963,
-    (float)0.00405169,
-    (float)0.00324696,
-    (float)0.00293229,
-    (float)0.0028189,
-    (float)0.00205552,
-    (float)0.00210684,
-    (float)0.00214259,
-    (float)0.00131846,
-    (float)0.0013935,
-    (float)0.0013507,
-    (float)0.00121735,
-    (float)0.00106341,
-    (float)0.00109328,
-    (float)0.000958401,
-    (float)0.00087863,
-    (float)0.000950124,
-    (float)0.000807935,
-    (float)0.000757329,
-    (float)0.000678212,
-    (float)0.000688156,
-    (float)0.000633073,
-    (float)0.000571697,
-    (float)0.000553016,
-    (float)0.000526362,
-    (float)0.000502621,
-    (float)0.000472708,
-    (float)0.000492993,
-    (float)0.000426919,
-    (float)0.000412631,
-    (float)0.000429001,
-    (float)0.000391401,
-    (float)0.000358073,
-    (float)0.000364762,
-    (float)0.000351843,
-    (float)0.000310069,
-    (float)0.000327725,
-    (float)0.000314158,
-    (float)0.000283628,
-    (float)0.000286686,
-    (float)0.000287372,
-    (float)0.0002624,
-    (float)0.000255664,
-    (float)0.000261197,
-    (float)0.000241005,
-    (float)0.000233634,
-    (float)0.000233594,
-    (float)0.000225734,
-    (float)0.0002153,
-    (float)0.000212955,
-    (float)0.000207801,
-    (float)0.00019979,
-    (float)0.000193936,
-    (float)0.000192366,
-    (float)0.00018787,
-    (float)0.000176794,
-    (float)0.000176931,
-    (float)0.00017735,
-    (float)0.000169241,
-    (float)0.000164208,
-    (float)0.000167849,
-    (float)0.000158975,
-    (float)0.000154628,
-    (float)0.000159447,
-    (float)0.000150428,
-    (float)0.000143052,
-    (float)0.00014601,
-    (float)0.000145393,
-    (float)0.000135712,
-    (float)0.000138683,
-    (float)0.000136908,
-    (float)0.000130946,
-    (float)0.000133967,
-    (float)0.000133263,
-    (float)0.000128063,
-    (float)0.000124228,
-    (float)0.000127649,
-    (float)0.00012323,
-    (float)0.000120905,
-    (float)0.000119206,
-    (float)0.000116988,
-    (float)0.000116949,
-    (float)0.000115209,
-    (float)0.000117237,
-    (float)0.000112528,
-    (float)0.000112023,
-    (float)0.000112944,
-    (float)0.000113531,
-    (float)0.000109206,
-    (float)0.000107248,
-    (float)0.000109735,
-    (float)0.000104591,
-    (float)0.000106799,
-    (float)0.000106094,
-    (float)0.000103319,
-    (float)0.000101849,
-    (float)0.000105979,
-    (float)0.00010508,
-    (float)0.000100071,
-    (float)0.000104003,
-    (float)0.000101257,
-    (float)0.000101086,
-    (float)0.000101031,
-    (float)0.000101134,
-    (float)9.73564e-05,
-    (float)9.80086e-05,
-    (float)0.000102086,
-    (float)9.77608e-05,
-    (float)9.86559e-05,
-    (float)9.80517e-05,
-    (float)9.9783e-05,
-    (float)9.80196e-05,
-    (float)9.91812e-05,
-    (float)9.86552e-05,
-    (float)9.53138e-05,
-    (float)9.86113e-05,
-    (float)9.81708e-05,
-    (float)0.49947,
-    (float)0.114266,
-    (float)0.197079,
-    (float)0.0468406,
-    (float)0.0292589,
-    (float)0.0171813,
-    (float)0.012628,
-    (float)0.00773288,
-    (float)0.0088926,
-    (float)0.0063518,
-    (float)0.00352603,
-    (float)0.00488895,
-    (float)0.00407376,
-    (float)0.00338978,
-    (float)0.00297888,
-    (float)0.00286494,
-    (float)0.00199673,
-    (float)0.00208156,
-    (float)0.00205642,
-    (float)0.00143826,
-    (float)0.00139768,
-    (float)0.00131459,
-    (float)0.00125556,
-    (float)0.0011019,
-    (float)0.00113544,
-    (float)0.000968961,
-    (float)0.000910836,
-    (float)0.000901876,
-    (float)0.000830325,
-    (float)0.000779874,
-    (float)0.000667094,
-    (float)0.000673996,
-    (float)0.000631431,
-    (float)0.000589526,
-    (float)0.00054989,
-    (float)0.000549511,
-    (float)0.000499357,
-    (float)0.000475333,
-    (float)0.000499563,
-    (float)0.000439678,
-    (float)0.000413937,
-    (float)0.000417355,
-    (float)0.000399108,
-    (float)0.000357541,
-    (float)0.000366477,
-    (float)0.0003507,
-    (float)0.000317555,
-    (float)0.000323205,
-    (float)0.000315002,
-    (float)0.000293669,
-    (float)0.000284695,
-    (float)0.000285835,
-    (float)0.000267477,
-    (float)0.000259375,
-    (float)0.000255324,
-    (float)0.000247479,
-    (float)0.000238023,
-    (float)0.000230155,
-    (float)0.000226577,
-    (float)0.000219344,
-    (float)0.000210685,
-    (float)0.000207611,
-    (float)0.000204182,
-    (float)0.000191533,
-    (float)0.000190988,
-    (float)0.00019163,
-    (float)0.000182041,
-    (float)0.000176399,
-    (float)0.000179011,
-    (float)0.000171193,
-    (float)0.000166322,
-    (float)0.000168871,
-    (float)0.000160156,
-    (float)0.000154175,
-    (float)0.000154809,
-    (float)0.000153472,
-    (float)0.000146246,
-    (float)0.000146331,
-    (float)0.000143415,
-    (float)0.000140546,
-    (float)0.000141404,
-    (float)0.000138543,
-    (float)0.000135965,
-    (float)0.000131773,
-    (float)0.000131891,
-    (float)0.000129669,
-    (float)0.000128144,
-    (float)0.00012353,
-    (float)0.000122563,
-    (float)0.000122748,
-    (float)0.000119978,
-    (float)0.000121495,
-    (float)0.000118177,
-    (float)0.00011671,
-    (float)0.000116126,
-    (float)0.000117584,
-    (float)0.000113561,
-    (float)0.000111834,
-    (float)0.000111817,
-    (float)0.000108583,
-    (float)0.000110419,
-    (float)0.000108407,
-    (float)0.000107222,
-    (float)0.000105431,
-    (float)0.00010756,
-    (float)0.000106376,
-    (float)0.000105391,
-    (float)0.000105464,
-    (float)0.000102609,
-    (float)0.000104299,
-    (float)0.000102704,
-    (float)0.000102819,
-    (float)0.000100131,
-    (float)0.000100687,
-    (float)0.0001007,
-    (float)0.00010042,
-    (float)0.000100713,
-    (float)9.86977e-05,
-    (float)0.000100554,
-    (float)9.88705e-05,
-    (float)0.000100792,
-    (float)9.91273e-05,
-    (float)9.8405e-05,
-    (float)9.85367e-05,
-    (float)9.88742e-05,
-    (float)9.90691e-05,
-    (float)9.69376e-05,
-    (float)9.90317e-05,
-    (float)0.523465,
-    (float)0.121207,
-    (float)0.167365,
-    (float)0.0459954,
-    (float)0.0286925,
-    (float)0.0168494,
-    (float)0.0125773,
-    (float)0.00759853,
-    (float)0.00899905,
-    (float)0.00651313,
-    (float)0.00400344,
-    (float)0.00475323,
-    (float)0.00406986,
-    (float)0.00342576,
-    (float)0.00300748,
-    (float)0.00287665,
-    (float)0.00197479,
-    (float)0.00203731,
-    (float)0.00195271,
-    (float)0.00154533,
-    (float)0.0014124,
-    (float)0.00131821,
-    (float)0.00126015,
-    (float)0.00112859,
-    (float)0.00114622,
-    (float)0.000988945,
-    (float)0.000935843,
-    (float)0.000851289,
-    (float)0.000832419,
-    (float)0.000783645,
-    (float)0.000676405,
-    (float)0.000658521,
-    (float)0.000632885,
-    (float)0.000592016,
-    (float)0.00055073,
-    (float)0.000569424,
-    (float)0.000500401,
-    (float)0.000475374,
-    (float)0.000489025,
-    (float)0.000451227,
-    (float)0.000412388,
-    (float)0.000411683,
-    (float)0.000396887,
-    (float)0.000357281,
-    (float)0.000364107,
-    (float)0.000350138,
-    (float)0.000326539,
-    (float)0.000317144,
-    (float)0.000314535,
-    (float)0.000298312,
-    (float)0.000286253,
-    (float)0.00028109,
-    (float)0.000271487,
-    (float)0.000260728,
-    (float)0.000249629,
-    (float)0.00024901,
-    (float)0.000240069,
-    (float)0.000227579,
-    (float)0.000225243,
-    (float)0.000222084,
-    (float)0.000207362,
-    (float)0.000207028,
-    (float)0.000207399,
-    (float)0.000193715,
-    (float)0.000188896,
-    (float)0.000192481,
-    (float)0.000183623,
-    (float)0.000176984,
-    (float)0.0001796,
-    (float)0.000170635,
-    (float)0.000164743,
-    (float)0.000165316,
-    (float)0.000163045,
-    (float)0.000155276,
-    (float)0.000153844,
-    (float)0.000152017,
-    (float)0.000149467,
-    (float)0.000147914,
-    (float)0.000144839,
-    (float)0.000143704,
-    (float)0.000138093,
-    (float)0.000137366,
-    (float)0.00013716,
-    (float)0.000133709,
-    (float)0.00012782,
-    (float)0.000129435,
-    (float)0.000128352,
-    (float)0.000123683,
-    (float)0.00012667,
-    (float)0.00012398,
-    (float)0.000119929,
-    (float)0.00012015,
-    (float)0.000122406,
-    (float)0.000116458,
-    (float)0.000115331,
-    (float)0.000115609,
-    (float)0.00011196,
-    (float)0.000112272,
-    (float)0.000112006,
-    (float)0.000111204,
-    (float)0.000108064,
-    (float)0.000109775,
-    (float)0.000109279,
-    (float)0.000108687,
-    (float)0.000106524,
-    (float)0.000105732,
-    (float)0.000106035,
-    (float)0.000102705,
-    (float)0.000104261,
-    (float)0.000103385,
-    (float)0.000101539,
-    (float)0.00010053,
-    (float)0.000103927,
-    (float)0.000101626,
-    (float)0.000100132,
-    (float)0.000102984,
-    (float)0.000100216,
-    (float)9.94533e-05,
-    (float)0.000100127,
-    (float)0.000100478,
-    (float)9.67426e-05,
-    (float)9.88038e-05,
-    (float)9.9125e-05,
-    (float)9.76553e-05,
-    (float)9.8743e-05,
-    (float)9.89904e-05,
-    (float)9.97473e-05,
-    (float)9.7939e-05,
-    (float)0.544491,
-    (float)0.127616,
-    (float)0.141603,
-    (float)0.044914,
-    (float)0.0279948,
-    (float)0.0168042,
-    (float)0.0125646,
-    (float)0.00763666,
-    (float)0.00892682,
-    (float)0.00659349,
-    (float)0.00444033,
-    (float)0.00463825,
-    (float)0.00403888,
-    (float)0.00339329,
-    (float)0.0030072,
-    (float)0.00283586,
-    (float)0.00199672,
-    (float)0.00199671,
-    (float)0.00185217,
-    (float)0.00161614,
-    (float)0.00143775,
-    (float)0.0013414,
-    (float)0.00124815,
-    (float)0.00114796,
-    (float)0.00112459,
-    (float)0.00100182,
-    (float)0.000949766,
-    (float)0.000821839,
-    (float)0.000814066,
-    (float)0.000771444,
-    (float)0.000693095,
-    (float)0.000650098,
-    (float)0.000639245,
-    (float)0.000588458,
-    (float)0.000552615,
-    (float)0.00056949,
-    (float)0.000507891,
-    (float)0.00047593,
-    (float)0.000470775,
-    (float)0.000450228,
-    (float)0.000411021,
-    (float)0.000409217,
-    (float)0.000390624,
-    (float)0.000362944,
-    (float)0.000358087,
-    (float)0.000347512,
-    (float)0.000332859,
-    (float)0.000317238,
-    (float)0.000308869,
-    (float)0.00029706,
-    (float)0.000287356,
-    (float)0.000274231,
-    (float)0.000271218,
-    (float)0.000261779,
-    (float)0.000247457,
-    (float)0.000244865,
-    (float)0.000241545,
-    (float)0.000227266,
-    (float)0.0002234,
-    (float)0.000221847,
-    (float)0.000207972,
-    (float)0.000203712,
-    (float)0.000204937,
-    (float)0.000196437,
-    (float)0.000189164,
-    (float)0.000189749,
-    (float)0.00018213,
-    (float)0.000178024,
-    (float)0.000176267,
-    (float)0.000171567,
-    (float)0.000165588,
-    (float)0.000162503,
-    (float)0.000159589,
-    (float)0.000158004,
-    (float)0.000155673,
-    (float)0.000150195,
-    (float)0.000150403,
-    (float)0.000146509,
-    (float)0.000143821,
-    (float)0.000143194,
-    (float)0.0001404,
-    (float)0.000133821,
-    (float)0.000134267,
-    (float)0.000133876,
-    (float)0.000129251,
-    (float)0.000130195,
-    (float)0.000127803,
-    (float)0.000124931,
-    (float)0.00012438,
-    (float)0.000125309,
-    (float)0.000120838,
-    (float)0.000119811,
-    (float)0.000117861,
-    (float)0.000115453,
-    (float)0.000116305,
-    (float)0.000114539,
-    (float)0.000113295,
-    (float)0.000112007,
-    (float)0.000111998,
-    (float)0.000110284,
-    (float)0.000111763,
-    (float)0.00010898,
-    (float)0.000106871,
-    (float)0.000107174,
-    (float)0.00010538,
-    (float)0.000105168,
-    (float)0.000104991,
-    (float)0.000104152,
-    (float)0.000101999,
-    (float)0.000104355,
-    (float)0.000102854,
-    (float)0.000102422,
-    (float)0.000102557,
-    (float)0.000100485,
-    (float)9.98127e-05,
-    (float)0.000100268,
-    (float)0.000100142,
-    (float)9.82906e-05,
-    (float)9.99698e-05,
-    (float)9.82313e-05,
-    (float)9.88825e-05,
-    (float)9.98061e-05,
-    (float)9.91198e-05,
-    (float)9.83746e-05,
-    (float)9.8218e-05,
-    (float)9.79628e-05,
-    (float)9.71278e-05,
-    (float)9.89535e-05,
-    (float)0.56247,
-    (float)0.133544,
-    (float)0.119818,
-    (float)0.043625,
-    (float)0.0272207,
-    (float)0.016923,
-    (float)0.0125683,
-    (float)0.00782734,
-    (float)0.00873377,
-    (float)0.00659653,
-    (float)0.00478523,
-    (float)0.00454874,
-    (float)0.00399293,
-    (float)0.00331769,
-    (float)0.00297422,
-    (float)0.00276103,
-    (float)0.00205059,
-    (float)0.00196433,
-    (float)0.00178153,
-    (float)0.00164669,
-    (float)0.00145444,
-    (float)0.0013618,
-    (float)0.00123903,
-    (float)0.00115381,
-    (float)0.0010822,
-    (float)0.00100456,
-    (float)0.000948155,
-    (float)0.000814551,
-    (float)0.00079507,
-    (float)0.000757168,
-    (float)0.000698712,
-    (float)0.000648079,
-    (float)0.000645134,
-    (float)0.000583272,
-    (float)0.000550977,
-    (float)0.000552994,
-    (float)0.000511972,
-    (float)0.000474703,
-    (float)0.00046001,
-    (float)0.000443461,
-    (float)0.000410355,
-    (float)0.000403931,
-    (float)0.000386795,
-    (float)0.000368715,
-    (float)0.000350967,
-    (float)0.000342188,
-    (float)0.000331336,
-    (float)0.00031617,
-    (float)0.000302894,
-    (float)0.000296642,
-    (float)0.000285301,
-    (float)0.000270185,
-    (float)0.000268594,
-    (float)0.000261175,
-    (float)0.000246443,
-    (float)0.000241372,
-    (float)0.000238791,
-    (float)0.000225117,
-    (float)0.000220583,
-    (float)0.000219206,
-    (float)0.000209964,
-    (float)0.000202074,
-    (float)0.000201657,
-    (float)0.000195502,
-    (float)0.000189622,
-    (float)0.000186363,
-    (float)0.000181746,
-    (float)0.000176113,
-    (float)0.000171547,
-    (float)0.000169813,
-    (float)0.000166695,
-    (float)0.000162413,
-    (float)0.000157926,
-    (float)0.00015827,
-    (float)0.000153417,
-    (float)0.000150435,
-    (float)0.000149717,
-    (float)0.000145781,
-    (float)0.000140116,
-    (float)0.000140392,
-    (float)0.00013943,
-    (float)0.000134304,
-    (float)0.000134454,
-    (float)0.000132489,
-    (float)0.000129696,
-    (float)0.000128132,
-    (float)0.000128829,
-    (float)0.000125,
-    (float)0.00012276,
-    (float)0.000121205,
-    (float)0.000119949,
-    (float)0.000118898,
-    (float)0.000116993,
-    (float)0.000116844,
-    (float)0.000114706,
-    (float)0.000113565,
-    (float)0.000113033,
-    (float)0.000113758,
-    (float)0.000110085,
-    (float)0.000109208,
-    (float)0.000109222,
-    (float)0.000107047,
-    (float)0.000106472,
-    (float)0.000107009,
-    (float)0.000105647,
-    (float)0.000103143,
-    (float)0.000104956,
-    (float)0.00010397,
-    (float)0.000103024,
-    (float)0.000102303,
-    (float)0.000102066,
-    (float)0.000100457,
-    (float)0.000100106,
-    (float)0.000100909,
-    (float)9.99318e-05,
-    (float)9.9188e-05,
-    (float)9.83567e-05,
-    (float)9.96112e-05,
-    (float)9.84044e-05,
-    (float)9.84334e-05,
-    (float)9.85269e-05,
-    (float)9.79235e-05,
-    (float)9.66345e-05,
-    (float)9.76262e-05,
-    (float)9.8633e-05,
-    (float)9.66805e-05,
-    (float)9.72618e-05,
-    (float)9.75152e-05,
-    (float)0.57763,
-    (float)0.138922,
-    (float)0.101797,
-    (float)0.0422415,
-    (float)0.0264163,
-    (float)0.01706,
-    (float)0.0125754,
-    (float)0.00815121,
-    (float)0.00845337,
-    (float)0.00653202,
-    (float)0.00502077,
-    (float)0.00447647,
-    (float)0.00392832,
-    (float)0.00323832,
-    (float)0.00292146,
-    (float)0.00266022,
-    (float)0.00210881,
-    (float)0.00194679,
-    (float)0.00174129,
-    (float)0.00163837,
-    (float)0.0014618,
-    (float)0.00136515,
-    (float)0.00123042,
-    (float)0.00115234,
-    (float)0.00104432,
-    (float)0.00099079,
-    (float)0.000932131,
-    (float)0.000821157,
-    (float)0.00077925,
-    (float)0.000744799,
-    (float)0.000693779,
-    (float)0.000646271,
-    (float)0.000639471,
-    (float)0.000581587,
-    (float)0.000549266,
-    (float)0.000533106,
-    (float)0.000507208,
-    (float)0.000472105,
-    (float)0.000454566,
-    (float)0.000433886,
-    (float)0.000410601,
-    (float)0.000396124,
-    (float)0.000380555,
-    (float)0.000368197,
-    (float)0.000348739,
-    (float)0.0003357,
-    (float)0.000326188,
-    (float)0.000314062,
-    (float)0.000297895,
-    (float)0.000293109,
-    (float)0.000282648,
-    (float)0.000268495,
-    (float)0.000262599,
-    (float)0.000257318,
-    (float)0.0002447,
-    (float)0.000238598,
-    (float)0.000234339,
-    (float)0.000224987,
-    (float)0.000218118,
-    (float)0.000214593,
-    (float)0.000208733,
-    (float)0.000202377,
-    (float)0.000197692,
-    (float)0.000192258,
-    (float)0.000187947,
-    (float)0.000182133,
-    (float)0.000179254,
-    (float)0.000175703,
-    (float)0.00017098,
-    (float)0.0001663,
-    (float)0.00016568,
-    (float)0.000161293,
-    (float)0.0001575,
-    (float)0.000155832,
-    (float)0.000151886,
-    (float)0.000147545,
-    (float)0.000145972,
-    (float)0.000144467,
-    (float)0.000140354,
-    (float)0.000139185,
-    (float)0.000136528,
-    (float)0.000134908,
-    (float)0.000132767,
-    (float)0.000131645,
-    (float)0.000129065,
-    (float)0.00012695,
-    (float)0.000124374,
-    (float)0.000123187,
-    (float)0.000122332,
-    (float)0.000119835,
-    (float)0.000119193,
-    (float)0.000117637,
-    (float)0.00011635,
-    (float)0.000115069,
-    (float)0.000115224,
-    (float)0.000112572,
-    (float)0.000111364,
-    (float)0.000110253,
-    (float)0.000109033,
-    (float)0.000108271,
-    (float)0.000107636,
-    (float)0.00010676,
-    (float)0.000105448,
-    (float)0.000105407,
-    (float)0.000104386,
-    (float)0.000104447,
-    (float)0.000102971,
-    (float)0.000102225,
-    (float)0.000101276,
-    (float)0.000100826,
-    (float)0.000100298,
-    (float)0.000100117,
-    (float)9.95796e-05,
-    (float)9.86592e-05,
-    (float)9.90475e-05,
-    (float)9.84695e-05,
-    (float)9.85752e-05,
-    (float)9.78495e-05,
-    (float)9.75146e-05,
-    (float)9.66749e-05,
-    (float)9.68471e-05,
-    (float)9.66451e-05,
-    (float)9.65068e-05,
-    (float)9.64276e-05,
-    (float)9.59656e-05,
-    (float)9.64345e-05,
-    (float)9.63553e-05,
-    (float)9.68171e-05,
-    (float)0.590099,
-    (float)0.143782,
-    (float)0.0873108,
-    (float)0.040807,
-    (float)0.0256332,
-    (float)0.0171421,
-    (float)0.0125661,
-    (float)0.00856983,
-    (float)0.00814139,
-    (float)0.00642144,
-    (float)0.0051335,
-    (float)0.00441013,
-    (float)0.00384727,
-    (float)0.00317455,
-    (float)0.00285537,
-    (float)0.00255721,
-    (float)0.00214934,
-    (float)0.00193554,
-    (float)0.00172742,
-    (float)0.00161226,
-    (float)0.00145583,
-    (float)0.00134805,
-    (float)0.00122153,
-    (float)0.00114005,
-    (float)0.0010188,
-    (float)0.00096863,
-    (float)0.000908724,
-    (float)0.000824624,
-    (float)0.000769527,
-    (float)0.000736511,
-    (float)0.000683967,
-    (float)0.000642105,
-    (float)0.00062452,
-    (float)0.000578824,
-    (float)0.000544292,
-    (float)0.000518571,
-    (float)0.000496347,
-    (float)0.000466671,
-    (float)0.000448148,
-    (float)0.000426511,
-    (float)0.000409282,
-    (float)0.000389139,
-    (float)0.000374211,
-    (float)0.00036247,
-    (float)0.000345769,
-    (float)0.000329443,
-    (float)0.000320836,
-    (float)0.000308859,
-    (float)0.000293711,
-    (float)0.000287338,
-    (float)0.000278708,
-    (float)0.00026617,
-    (float)0.000258481,
-    (float)0.000252625,
-    (float)0.000242115,
-    (float)0.000235134,
-    (float)0.000229559,
-    (float)0.000223033,
-    (float)0.000215781,
-    (float)0.000210431,
-    (float)0.000204901,
-    (float)0.000200199,
-    (float)0.000193861,
-    (float)0.000190027,
-    (float)0.000185757,
-    (float)0.000179823,
-    (float)0.000175619,
-    (float)0.000173785,
-    (float)0.000169115,
-    (float)0.000164805,
-    (float)0.000163048,
-    (float)0.000158562,
-    (float)0.000154829,
-    (float)0.00015271,
-    (float)0.000150412,
-    (float)0.000146124,
-    (float)0.000144182,
-    (float)0.000141401,
-    (float)0.000139533,
-    (float)0.00013717,
-    (float)0.000135426,
-    (float)0.000133289,
-    (float)0.00013068,
-    (float)0.00012824,
-    (float)0.000127125,
-    (float)0.000125644,
-    (float)0.000122761,
-    (float)0.000122107,
-    (float)0.000120287,
-    (float)0.000118483,
-    (float)0.000117459,
-    (float)0.000117163,
-    (float)0.000114522,
-    (float)0.000113339,
-    (float)0.000112224,
-    (float)0.000110871,
-    (float)0.000109812,
-    (float)0.000109042,
-    (float)0.000108102,
-    (float)0.000106739,
-    (float)0.000106042,
-    (float)0.000105342,
-    (float)0.000105094,
-    (float)0.000103354,
-    (float)0.000102865,
-    (float)0.000102109,
-    (float)0.000101071,
-    (float)0.000100454,
-    (float)0.000100746,
-    (float)9.96302e-05,
-    (float)9.87399e-05,
-    (float)9.90073e-05,
-    (float)9.82966e-05,
-    (float)9.77572e-05,
-    (float)9.74023e-05,
-    (float)9.71287e-05,
-    (float)9.61363e-05,
-    (float)9.61079e-05,
-    (float)9.5967e-05,
-    (float)9.60548e-05,
-    (float)9.54881e-05,
-    (float)9.53062e-05,
-    (float)9.55727e-05,
-    (float)9.51125e-05,
-    (float)9.48718e-05,
-    (float)9.51191e-05,
-    (float)9.496e-05,
-    (float)9.41099e-05,
-    (float)0.600129,
-    (float)0.148133,
-    (float)0.0760185,
-    (float)0.0393877,
-    (float)0.0249268,
-    (float)0.0171031,
-    (float)0.0125245,
-    (float)0.00904523,
-    (float)0.00782603,
-    (float)0.00627528,
-    (float)0.00513727,
-    (float)0.0043384,
-    (float)0.00374596,
-    (float)0.00314041,
-    (float)0.00278995,
-    (float)0.0024676,
-    (float)0.00215832,
-    (float)0.00192551,
-    (float)0.00172363,
-    (float)0.00157988,
-    (float)0.00143776,
-    (float)0.00131787,
-    (float)0.00120488,
-    (float)0.0011173,
-    (float)0.00100851,
-    (float)0.000946503,
-    (float)0.000884948,
-    (float)0.000819607,
-    (float)0.000762888,
-    (float)0.000724735,
-    (float)0.000674113,
-    (float)0.000634981,
-    (float)0.000605198,
-    (float)0.000570174,
-    (float)0.000537298,
-    (float)0.000509481,
-    (float)0.000484784,
-    (float)0.000460726,
-    (float)0.000440137,
-    (float)0.000419503,
-    (float)0.000403381,
-    (float)0.000383737,
-    (float)0.000367152,
-    (float)0.000354046,
-    (float)0.000340061,
-    (float)0.000324464,
-    (float)0.000314634,
-    (float)0.000303115,
-    (float)0.00029056,
-    (float)0.000281386,
-    (float)0.000273018,
-    (float)0.000262586,
-    (float)0.000254472,
-    (float)0.000246844,
-    (float)0.000238855,
-    (float)0.000231538,
-    (float)0.000224953,
-    (float)0.000218888,
-    (float)0.0002132,
-    (float)0.000206745,
-    (float)0.000201271,
-    (float)0.000196643,
-    (float)0.000190683,
-    (float)0.0001862,
-    (float)0.000182595,
-    (float)0.000177859,
-    (float)0.000173135,
-    (float)0.000170391,
-    (float)0.000166169,
-    (float)0.000162655,
-    (float)0.00015957,
-    (float)0.000156315,
-    (float)0.000152548,
-    (float)0.000149878,
-    (float)0.000146908,
-    (float)0.000144673,
-    (float)0.000142196,
-    (float)0.000139458,
-    (float)0.000137381,
-    (float)0.000134969,
-    (float)0.0001325,
-    (float)0.000130735,
-    (float)0.00012904,
-    (float)0.000126233,
-    (float)0.000124868,
-    (float)0.000123126,
-    (float)0.000121414,
-    (float)0.000119989,
-    (float)0.000118886,
-    (float)0.000116834,
-    (float)0.000115514,
-    (float)0.000114035,
-    (float)0.000112696,
-    (float)0.000111672,
-    (float)0.000110354,
-    (float)0.000109194,
-    (float)0.000108231,
-    (float)0.000107171,
-    (float)0.000106091,
-    (float)0.00010569,
-    (float)0.000104307,
-    (float)0.000103371,
-    (float)0.000102613,
-    (float)0.000101768,
-    (float)0.00010089,
-    (float)0.000100654,
-    (float)9.97996e-05,
-    (float)9.91103e-05,
-    (float)9.86755e-05,
-    (float)9.79624e-05,
-    (float)9.75194e-05,
-    (float)9.70551e-05,
-    (float)9.64592e-05,
-    (float)9.59668e-05,
-    (float)9.57552e-05,
-    (float)9.51301e-05,
-    (float)9.51213e-05,
-    (float)9.48624e-05,
-    (float)9.44048e-05,
-    (float)9.4208e-05,
-    (float)9.40766e-05,
-    (float)9.36232e-05,
-    (float)9.35917e-05,
-    (float)9.35889e-05,
-    (float)9.32627e-05,
-    (float)9.34082e-05,
-    (float)9.33447e-05,
-    (float)9.32681e-05,
-    (float)0.607939,
-    (float)0.152008,
-    (float)0.0675759,
-    (float)0.0380248,
-    (float)0.0243469,
-    (float)0.0169169,
-    (float)0.0124369,
-    (float)0.00952915,
-    (float)0.00753564,
-    (float)0.00610969,
-    (float)0.00505467,
-    (float)0.00425224,
-    (float)0.00362776,
-    (float)0.00313227,
-    (float)0.00273254,
-    (float)0.0024054,
-    (float)0.00213427,
-    (float)0.00190708,
-    (float)0.00171481,
-    (float)0.00155066,
-    (float)0.0014094,
-    (float)0.00128698,
-    (float)0.00118017,
-    (float)0.00108645,
-    (float)0.00100375,
-    (float)0.000930421,
-    (float)0.000865092,
-    (float)0.000806645,
-    (float)0.000754146,
-    (float)0.000706816,
-    (float)0.000664,
-    (float)0.000625142,
-    (float)0.000589771,
-    (float)0.000557482,
-    (float)0.000527928,
-    (float)0.000500811,
-    (float)0.00047587,
-    (float)0.00045288,
-    (float)0.000431644,
-    (float)0.000411988,
-    (float)0.000393761,
-    (float)0.000376828,
-    (float)0.000361071,
-    (float)0.000346384,
-    (float)0.000332674,
-    (float)0.000319856,
-    (float)0.000307856,
-    (float)0.000296606,
-    (float)0.000286047,
-    (float)0.000276123,
-    (float)0.000266786,
-    (float)0.000257991,
-    (float)0.000249697,
-    (float)0.000241869,
-    (float)0.000234473,
-    (float)0.000227479,
-    (float)0.000220858,
-    (float)0.000214586,
-    (float)0.00020864,
-    (float)0.000202997,
-    (float)0.000197639,
-    (float)0.000192548,
-    (float)0.000187706,
-    (float)0.0001831,
-    (float)0.000178714,
-    (float)0.000174536,
-    (float)0.000170553,
-    (float)0.000166755,
-    (float)0.000163131,
-    (float)0.000159671,
-    (float)0.000156367,
-    (float)0.00015321,
-    (float)0.000150193,
-    (float)0.000147307,
-    (float)0.000144547,
-    (float)0.000141907,
-    (float)0.000139379,
-    (float)0.00013696,
-    (float)0.000134643,
-    (float)0.000132424,
-    (float)0.000130298,
-    (float)0.000128261,
-    (float)0.00012631,
-    (float)0.00012444,
-    (float)0.000122647,
-    (float)0.00012093,
-    (float)0.000119283,
-    (float)0.000117706,
-    (float)0.000116194,
-    (float)0.000114746,
-    (float)0.000113358,
-    (float)0.000112029,
-    (float)0.000110757,
-    (float)0.000109538,
-    (float)0.000108373,
-    (float)0.000107257,
-    (float)0.000106191,
-    (float)0.000105172,
-    (float)0.000104199,
-    (float)0.000103271,
-    (float)0.000102385,
-    (float)0.000101541,
-    (float)0.000100738,
-    (float)9.99743e-05,
-    (float)9.9249e-05,
-    (float)9.85612e-05,
-    (float)9.79098e-05,
-    (float)9.72941e-05,
-    (float)9.67133e-05,
-    (float)9.61664e-05,
-    (float)9.5653e-05,
-    (float)9.51722e-05,
-    (float)9.47235e-05,
-    (float)9.43063e-05,
-    (float)9.39201e-05,
-    (float)9.35644e-05,
-    (float)9.32387e-05,
-    (float)9.29426e-05,
-    (float)9.26759e-05,
-    (float)9.2438e-05,
-    (float)9.22289e-05,
-    (float)9.20481e-05,
-    (float)9.18955e-05,
-    (float)9.17709e-05,
-    (float)9.16741e-05,
-    (float)9.16051e-05,
-    (float)9.15637e-05,
-    (float)9.15499e-05,
-    (float)0.607939,
-    (float)0.152008,
-    (float)0.0675759,
-    (float)0.0380248,
-    (float)0.0243469,
-    (float)0.0169169,
-    (float)0.0124369,
-    (float)0.00952915,
-    (float)0.00753564,
-    (float)0.00610969,
-    (float)0.00505467,
-    (float)0.00425224,
-    (float)0.00362776,
-    (float)0.00313227,
-    (float)0.00273254,
-    (float)0.0024054,
-    (float)0.00213427,
-    (float)0.00190708,
-    (float)0.00171481,
-    (float)0.00155066,
-    (float)0.0014094,
-    (float)0.00128698,
-    (float)0.00118017,
-    (float)0.00108645,
-    (float)0.00100375,
-    (float)0.000930421,
-    (float)0.000865092,
-    (float)0.000806645,
-    (float)0.000754146,
-    (float)0.000706816,
-    (float)0.000664,
-    (float)0.000625142,
-    (float)0.000589771,
-    (float)0.000557482,
-    (float)0.000527928,
-    (float)0.000500811,
-    (float)0.00047587,
-    (float)0.00045288,
-    (float)0.000431644,
-    (float)0.000411988,
-    (float)0.000393761,
-    (float)0.000376828,
-    (float)0.000361071,
-    (float)0.000346384,
-    (float)0.000332674,
-    (float)0.000319856,
-    (float)0.000307856,
-    (float)0.000296606,
-    (float)0.000286047,
-    (float)0.000276123,
-    (float)0.000266786,
-    (float)0.000257991,
-    (float)0.000249697,
-    (float)0.000241869,
-    (float)0.000234473,
-    (float)0.000227479,
-    (float)0.000220858,
-    (float)0.000214586,
-    (float)0.00020864,
-    (float)0.000202997,
-    (float)0.000197639,
-    (float)0.000192548,
-    (float)0.000187706,
-    (float)0.0001831,
-    (float)0.000178714,
-    (float)0.000174536,
-    (float)0.000170553,
-    (float)0.000166755,
-    (float)0.000163131,
-    (float)0.000159671,
-    (float)0.000156367,
-    (float)0.00015321,
-    (float)0.000150193,
-    (float)0.000147307,
-    (float)0.000144547,
-    (float)0.000141907,
-    (float)0.000139379,
-    (float)0.00013696,
-    (float)0.000134643,
-    (float)0.000132424,
-    (float)0.000130298,
-    (float)0.000128261,
-    (float)0.00012631,
-    (float)0.00012444,
-    (float)0.000122647,
-    (float)0.00012093,
-    (float)0.000119283,
-    (float)0.000117706,
-    (float)0.000116194,
-    (float)0.000114746,
-    (float)0.000113358,
-    (float)0.000112029,
-    (float)0.000110757,
-    (float)0.000109538,
-    (float)0.000108373,
-    (float)0.000107257,
-    (float)0.000106191,
-    (float)0.000105172,
-    (float)0.000104199,
-    (float)0.000103271,
-    (float)0.000102385,
-    (float)0.000101541,
-    (float)0.000100738,
-    (float)9.99743e-05,
-    (float)9.9249e-05,
-    (float)9.85612e-05,
-    (float)9.79098e-05,
-    (float)9.72941e-05,
-    (float)9.67133e-05,
-    (float)9.61664e-05,
-    (float)9.5653e-05,
-    (float)9.51722e-05,
-    (float)9.47235e-05,
-    (float)9.43063e-05,
-    (float)9.39201e-05,
-    (float)9.35644e-05,
-    (float)9.32387e-05,
-    (float)9.29426e-05,
-    (float)9.26759e-05,
-    (float)9.2438e-05,
-    (float)9.22289e-05,
-    (float)9.20481e-05,
-    (float)9.18955e-05,
-    (float)9.17709e-05,
-    (float)9.16741e-05,
-    (float)9.16051e-05,
-    (float)9.15637e-05,
-    (float)9.15499e-05,
-    (float)0.595419,
-    (float)0.162442,
-    (float)0.0687198,
-    (float)0.0381704,
-    (float)0.0236563,
-    (float)0.0173119,
-    (float)0.0125574,
-    (float)0.00968266,
-    (float)0.0075856,
-    (float)0.00620784,
-    (float)0.0050786,
-    (float)0.00424059,
-    (float)0.00368073,
-    (float)0.00317642,
-    (float)0.00278025,
-    (float)0.00241106,
-    (float)0.0021677,
-    (float)0.00192088,
-    (float)0.00173117,
-    (float)0.00156637,
-    (float)0.00143449,
-    (float)0.00130825,
-    (float)0.00118763,
-    (float)0.00110136,
-    (float)0.00101513,
-    (float)0.000945559,
-    (float)0.000873521,
-    (float)0.000821791,
-    (float)0.000765969,
-    (float)0.000715502,
-    (float)0.000671997,
-    (float)0.00063445,
-    (float)0.000600814,
-    (float)0.000564321,
-    (float)0.000537206,
-    (float)0.000508567,
-    (float)0.000483777,
-    (float)0.000458279,
-    (float)0.000438811,
-    (float)0.000419565,
-    (float)0.000399848,
-    (float)0.000382786,
-    (float)0.000366687,
-    (float)0.00035266,
-    (float)0.000337012,
-    (float)0.000325123,
-    (float)0.000313068,
-    (float)0.000301823,
-    (float)0.000290202,
-    (float)0.000280379,
-    (float)0.000271413,
-    (float)0.000261706,
-    (float)0.000253544,
-    (float)0.000245604,
-    (float)0.000238714,
-    (float)0.000230667,
-    (float)0.000224154,
-    (float)0.000217887,
-    (float)0.000211859,
-    (float)0.000205916,
-    (float)0.000200496,
-    (float)0.000195862,
-    (float)0.000190355,
-    (float)0.000185717,
-    (float)0.000181113,
-    (float)0.00017731,
-    (float)0.000172926,
-    (float)0.000169134,
-    (float)0.000165664,
-    (float)0.000161981,
-    (float)0.00015853,
-    (float)0.000155121,
-    (float)0.000152554,
-    (float)0.000149387,
-    (float)0.000146672,
-    (float)0.000143878,
-    (float)0.00014144,
-    (float)0.000138825,
-    (float)0.00013638,
-    (float)0.000134431,
-    (float)0.00013222,
-    (float)0.000130202,
-    (float)0.000127976,
-    (float)0.000126285,
-    (float)0.00012433,
-    (float)0.000122644,
-    (float)0.000121036,
-    (float)0.000119523,
-    (float)0.000117951,
-    (float)0.000116303,
-    (float)0.000115014,
-    (float)0.000113629,
-    (float)0.000112441,
-    (float)0.000111146,
-    (float)0.000110082,
-    (float)0.000108847,
-    (float)0.000107715,
-    (float)0.000106685,
-    (float)0.000105773,
-    (float)0.000104865,
-    (float)0.000103927,
-    (float)0.000103114,
-    (float)0.000102224,
-    (float)0.00010145,
-    (float)0.000100678,
-    (float)0.0001001,
-    (float)9.94009e-05,
-    (float)9.87855e-05,
-    (float)9.81454e-05,
-    (float)9.76088e-05,
-    (float)9.70522e-05,
-    (float)9.65709e-05,
-    (float)9.61833e-05,
-    (float)9.57302e-05,
-    (float)9.53419e-05,
-    (float)9.49082e-05,
-    (float)9.46497e-05,
-    (float)9.42799e-05,
-    (float)9.40641e-05,
-    (float)9.38027e-05,
-    (float)9.36315e-05,
-    (float)9.33966e-05,
-    (float)9.3226e-05,
-    (float)9.31366e-05,
-    (float)9.3003e-05,
-    (float)9.29668e-05,
-    (float)9.28821e-05,
-    (float)9.29516e-05,
-    (float)0.580841,
-    (float)0.175331,
-    (float)0.0699484,
-    (float)0.0381145,
-    (float)0.022964,
-    (float)0.0176999,
-    (float)0.0125176,
-    (float)0.00980838,
-    (float)0.00767235,
-    (float)0.0063368,
-    (float)0.00505214,
-    (float)0.00422611,
-    (float)0.00372671,
-    (float)0.00319975,
-    (float)0.00280936,
-    (float)0.00243113,
-    (float)0.00221402,
-    (float)0.00191538,
-    (float)0.00173967,
-    (float)0.00157969,
-    (float)0.00145944,
-    (float)0.00131739,
-    (float)0.0012015,
-    (float)0.00112149,
-    (float)0.0010203,
-    (float)0.000951585,
-    (float)0.000881681,
-    (float)0.000840125,
-    (float)0.000771822,
-    (float)0.000725288,
-    (float)0.000681923,
-    (float)0.000643066,
-    (float)0.000604416,
-    (float)0.00057108,
-    (float)0.000549057,
-    (float)0.000514656,
-    (float)0.000489987,
-    (float)0.00046426,
-    (float)0.000446878,
-    (float)0.000422472,
-    (float)0.000405248,
-    (float)0.000390104,
-    (float)0.000372857,
-    (float)0.000356521,
-    (float)0.000341319,
-    (float)0.000331236,
-    (float)0.000316076,
-    (float)0.000305696,
-    (float)0.000294843,
-    (float)0.000285928,
-    (float)0.000274069,
-    (float)0.000265036,
-    (float)0.000257685,
-    (float)0.000248757,
-    (float)0.0002413,
-    (float)0.000233891,
-    (float)0.000228639,
-    (float)0.000220138,
-    (float)0.000214403,
-    (float)0.000208552,
-    (float)0.000203594,
-    (float)0.000197644,
-    (float)0.000192876,
-    (float)0.000189033,
-    (float)0.000183376,
-    (float)0.000179161,
-    (float)0.00017467,
-    (float)0.000171897,
-    (float)0.000167164,
-    (float)0.00016416,
-    (float)0.000160842,
-    (float)0.000157452,
-    (float)0.000153887,
-    (float)0.000150783,
-    (float)0.000148876,
-    (float)0.000145498,
-    (float)0.000143372,
-    (float)0.00014051,
-    (float)0.000138586,
-    (float)0.000135506,
-    (float)0.000133578,
-    (float)0.000131864,
-    (float)0.000129832,
-    (float)0.000127962,
-    (float)0.000125802,
-    (float)0.000124486,
-    (float)0.000122117,
-    (float)0.000120888,
-    (float)0.000119313,
-    (float)0.000118249,
-    (float)0.000116487,
-    (float)0.000115086,
-    (float)0.000113868,
-    (float)0.000112376,
-    (float)0.00011137,
-    (float)0.000110184,
-    (float)0.000109532,
-    (float)0.000108069,
-    (float)0.000107179,
-    (float)0.000106034,
-    (float)0.000105263,
-    (float)0.000104309,
-    (float)0.000103635,
-    (float)0.000103025,
-    (float)0.000102065,
-    (float)0.000101363,
-    (float)0.000100497,
-    (float)0.000100109,
-    (float)9.93229e-05,
-    (float)9.90222e-05,
-    (float)9.84252e-05,
-    (float)9.79634e-05,
-    (float)9.73031e-05,
-    (float)9.68428e-05,
-    (float)9.65756e-05,
-    (float)9.61266e-05,
-    (float)9.5986e-05,
-    (float)9.55478e-05,
-    (float)9.54179e-05,
-    (float)9.48667e-05,
-    (float)9.47554e-05,
-    (float)9.45387e-05,
-    (float)9.44926e-05,
-    (float)9.43965e-05,
-    (float)9.42372e-05,
-    (float)9.42732e-05,
-    (float)9.39656e-05,
-    (float)9.40726e-05,
-    (float)0.564082,
-    (float)0.190881,
-    (float)0.0711668,
-    (float)0.0379017,
-    (float)0.0223369,
-    (float)0.0180391,
-    (float)0.0122859,
-    (float)0.0099172,
-    (float)0.00778796,
-    (float)0.00647012,
-    (float)0.00498752,
-    (float)0.00423889,
-    (float)0.00374992,
-    (float)0.00318437,
-    (float)0.00282334,
-    (float)0.00247166,
-    (float)0.0022563,
-    (float)0.00189575,
-    (float)0.00175784,
-    (float)0.00158619,
-    (float)0.00146747,
-    (float)0.00131569,
-    (float)0.00123097,
-    (float)0.00113734,
-    (float)0.00101921,
-    (float)0.000958729,
-    (float)0.000891282,
-    (float)0.000847013,
-    (float)0.000771411,
-    (float)0.00074438,
-    (float)0.000690861,
-    (float)0.000647104,
-    (float)0.000606301,
-    (float)0.000581824,
-    (float)0.000552886,
-    (float)0.000517113,
-    (float)0.000500572,
-    (float)0.000472255,
-    (float)0.000450362,
-    (float)0.00042371,
-    (float)0.00041392,
-    (float)0.000392817,
-    (float)0.000376075,
-    (float)0.000362081,
-    (float)0.000348866,
-    (float)0.000333227,
-    (float)0.000317987,
-    (float)0.000311272,
-    (float)0.000297792,
-    (float)0.000288175,
-    (float)0.000277503,
-    (float)0.000271325,
-    (float)0.000259012,
-    (float)0.00025086,
-    (float)0.000244478,
-    (float)0.000237164,
-    (float)0.000229582,
-    (float)0.000222965,
-    (float)0.00021893,
-    (float)0.000210139,
-    (float)0.00020512,
-    (float)0.000199592,
-    (float)0.000195947,
-    (float)0.000189314,
-    (float)0.000185926,
-    (float)0.000182151,
-    (float)0.000176833,
-    (float)0.000172527,
-    (float)0.000168797,
-    (float)0.000166485,
-    (float)0.000161313,
-    (float)0.000159506,
-    (float)0.000156037,
-    (float)0.000153186,
-    (float)0.000148949,
-    (float)0.000147107,
-    (float)0.000144832,
-    (float)0.000141644,
-    (float)0.000139949,
-    (float)0.000137514,
-    (float)0.000135656,
-    (float)0.000132021,
-    (float)0.000131205,
-    (float)0.000128964,
-    (float)0.000127407,
-    (float)0.000125365,
-    (float)0.000124247,
-    (float)0.000122356,
-    (float)0.000119971,
-    (float)0.000119127,
-    (float)0.000117574,
-    (float)0.000116631,
-    (float)0.00011477,
-    (float)0.000114384,
-    (float)0.000112468,
-    (float)0.000111211,
-    (float)0.000110002,
-    (float)0.000109447,
-    (float)0.000108348,
-    (float)0.000107298,
-    (float)0.000106818,
-    (float)0.000105482,
-    (float)0.000104569,
-    (float)0.000103501,
-    (float)0.000103479,
-    (float)0.000102322,
-    (float)0.000102011,
-    (float)0.000101221,
-    (float)0.000100736,
-    (float)9.95944e-05,
-    (float)9.92251e-05,
-    (float)9.90573e-05,
-    (float)9.84399e-05,
-    (float)9.82061e-05,
-    (float)9.76141e-05,
-    (float)9.75415e-05,
-    (float)9.6364e-05,
-    (float)9.65868e-05,
-    (float)9.61713e-05,
-    (float)9.63265e-05,
-    (float)9.57389e-05,
-    (float)9.58459e-05,
-    (float)9.55809e-05,
-    (float)9.49627e-05,
-    (float)9.51551e-05,
-    (float)9.50236e-05,
-    (float)9.55125e-05,
-    (float)9.48603e-05,
-    (float)0.545049,
-    (float)0.209253,
-    (float)0.0722752,
-    (float)0.0376031,
-    (float)0.0218366,
-    (float)0.0182757,
-    (float)0.0118544,
-    (float)0.0100222,
-    (float)0.00790489,
-    (float)0.00657587,
-    (float)0.00491269,
-    (float)0.00430054,
-    (float)0.00372825,
-    (float)0.0031298,
-    (float)0.00283138,
-    (float)0.00251952,
-    (float)0.00227173,
-    (float)0.00188376,
-    (float)0.00179617,
-    (float)0.00157425,
-    (float)0.00145498,
-    (float)0.00131478,
-    (float)0.00126462,
-    (float)0.00113346,
-    (float)0.00102709,
-    (float)0.000975453,
-    (float)0.000893588,
-    (float)0.000837839,
-    (float)0.00077686,
-    (float)0.000762776,
-    (float)0.000688425,
-    (float)0.000655601,
-    (float)0.000616076,
-    (float)0.000587668,
-    (float)0.000545408,
-    (float)0.000525711,
-    (float)0.000509,
-    (float)0.000473535,
-    (float)0.000454801,
-    (float)0.000432888,
-    (float)0.000417459,
-    (float)0.000389087,
-    (float)0.000383136,
-    (float)0.000366668,
-    (float)0.00035074,
-    (float)0.000335437,
-    (float)0.000326527,
-    (float)0.000312436,
-    (float)0.000297164,
-    (float)0.000292408,
-    (float)0.000281291,
-    (float)0.000271726,
-    (float)0.000261129,
-    (float)0.000257436,
-    (float)0.000245047,
-    (float)0.000237613,
-    (float)0.000232141,
-    (float)0.000226226,
-    (float)0.000218006,
-    (float)0.000212682,
-    (float)0.000209465,
-    (float)0.000200639,
-    (float)0.00019611,
-    (float)0.00019152,
-    (float)0.000188126,
-    (float)0.00018102,
-    (float)0.000179223,
-    (float)0.000175466,
-    (float)0.000170256,
-    (float)0.000166179,
-    (float)0.000163663,
-    (float)0.000160506,
-    (float)0.000155504,
-    (float)0.000154857,
-    (float)0.000151486,
-    (float)0.00014838,
-    (float)0.000144646,
-    (float)0.000143819,
-    (float)0.000140261,
-    (float)0.000137595,
-    (float)0.000136639,
-    (float)0.000134603,
-    (float)0.000131962,
-    (float)0.000129415,
-    (float)0.000128946,
-    (float)0.00012572,
-    (float)0.000124406,
-    (float)0.000123237,
-    (float)0.000122328,
-    (float)0.000119652,
-    (float)0.000118551,
-    (float)0.000117588,
-    (float)0.000115408,
-    (float)0.000114314,
-    (float)0.000113694,
-    (float)0.000112945,
-    (float)0.000110801,
-    (float)0.00011041,
-    (float)0.000109247,
-    (float)0.000107856,
-    (float)0.000106803,
-    (float)0.000106858,
-    (float)0.000105832,
-    (float)0.000104588,
-    (float)0.000104225,
-    (float)0.000103436,
-    (float)0.000102169,
-    (float)0.000101636,
-    (float)0.000101814,
-    (float)0.000100893,
-    (float)0.000100158,
-    (float)9.99396e-05,
-    (float)9.94286e-05,
-    (float)9.82317e-05,
-    (float)9.82857e-05,
-    (float)9.83514e-05,
-    (float)9.78194e-05,
-    (float)9.71984e-05,
-    (float)9.74477e-05,
-    (float)9.68231e-05,
-    (float)9.60746e-05,
-    (float)9.63032e-05,
-    (float)9.65906e-05,
-    (float)9.616e-05,
-    (float)9.58699e-05,
-    (float)9.63762e-05,
-    (float)9.57443e-05,
-    (float)9.54272e-05,
-    (float)0.523689,
-    (float)0.230557,
-    (float)0.0731584,
-    (float)0.0373306,
-    (float)0.0215046,
-    (float)0.0183534,
-    (float)0.0112367,
-    (float)0.0101404,
-    (float)0.00797299,
-    (float)0.00662934,
-    (float)0.00486241,
-    (float)0.00441335,
-    (float)0.00364336,
-    (float)0.00305723,
-    (float)0.00283915,
-    (float)0.00254215,
-    (float)0.00225274,
-    (float)0.00190256,
-    (float)0.00184418,
-    (float)0.00153643,
-    (float)0.0014435,
-    (float)0.0013172,
-    (float)0.00127435,
-    (float)0.00111218,
-    (float)0.00105931,
-    (float)0.000988278,
-    (float)0.000884467,
-    (float)0.000833585,
-    (float)0.000787764,
-    (float)0.000757733,
-    (float)0.000681245,
-    (float)0.00067805,
-    (float)0.000620594,
-    (float)0.00058612,
-    (float)0.000546054,
-    (float)0.000536925,
-    (float)0.000498987,
-    (float)0.00047583,
-    (float)0.000466067,
-    (float)0.000436946,
-    (float)0.000415582,
-    (float)0.000395389,
-    (float)0.000388685,
-    (float)0.000359455,
-    (float)0.000354915,
-    (float)0.000341271,
-    (float)0.000328797,
-    (float)0.000310922,
-    (float)0.000305739,
-    (float)0.000293051,
-    (float)0.000278357,
-    (float)0.000274499,
-    (float)0.000265305,
-    (float)0.000256571,
-    (float)0.000245733,
-    (float)0.000244607,
-    (float)0.000231208,
-    (float)0.000225593,
-    (float)0.000219918,
-    (float)0.000215598,
-    (float)0.000206567,
-    (float)0.000203421,
-    (float)0.000200046,
-    (float)0.000191173,
-    (float)0.000187898,
-    (float)0.000183392,
-    (float)0.000180119,
-    (float)0.000172747,
-    (float)0.000173448,
-    (float)0.000167977,
-    (float)0.000163997,
-    (float)0.000160321,
-    (float)0.000158528,
-    (float)0.000153782,
-    (float)0.000150316,
-    (float)0.000150493,
-    (float)0.00014588,
-    (float)0.000143932,
-    (float)0.000140892,
-    (float)0.000140238,
-    (float)0.000134882,
-    (float)0.000134714,
-    (float)0.000132887,
-    (float)0.000130677,
-    (float)0.000128519,
-    (float)0.00012757,
-    (float)0.000125786,
-    (float)0.000122192,
-    (float)0.000122638,
-    (float)0.000120286,
-    (float)0.000119343,
-    (float)0.000117297,
-    (float)0.000117777,
-    (float)0.0001147,
-    (float)0.000113652,
-    (float)0.000112986,
-    (float)0.000111661,
-    (float)0.000110369,
-    (float)0.000109776,
-    (float)0.000109715,
-    (float)0.0001071,
-    (float)0.000107193,
-    (float)0.000105964,
-    (float)0.000105353,
-    (float)0.000103816,
-    (float)0.000104603,
-    (float)0.000103265,
-    (float)0.000102263,
-    (float)0.00010205,
-    (float)0.000101428,
-    (float)0.000100409,
-    (float)9.98635e-05,
-    (float)0.000100573,
-    (float)9.90012e-05,
-    (float)9.90222e-05,
-    (float)9.85931e-05,
-    (float)9.8493e-05,
-    (float)9.70762e-05,
-    (float)9.78879e-05,
-    (float)9.75934e-05,
-    (float)9.69099e-05,
-    (float)9.68957e-05,
-    (float)9.70681e-05,
-    (float)9.65406e-05,
-    (float)9.58426e-05,
-    (float)9.70172e-05,
-    (float)9.62815e-05,
-    (float)9.63387e-05,
-    (float)0.500007,
-    (float)0.254816,
-    (float)0.0737171,
-    (float)0.0372143,
-    (float)0.0213694,
-    (float)0.0182136,
-    (float)0.0104786,
-    (float)0.0102726,
-    (float)0.0079367,
-    (float)0.00661985,
-    (float)0.00486299,
-    (float)0.00455512,
-    (float)0.00349589,
-    (float)0.00300632,
-    (float)0.00283078,
-    (float)0.00251186,
-    (float)0.00221105,
-    (float)0.00195758,
-    (float)0.00186814,
-    (float)0.00149251,
-    (float)0.0014584,
-    (float)0.0013059,
-    (float)0.00124681,
-    (float)0.00109469,
-    (float)0.00110165,
-    (float)0.000973591,
-    (float)0.000887761,
-    (float)0.000845667,
-    (float)0.000786313,
-    (float)0.000732281,
-    (float)0.000688586,
-    (float)0.000688863,
-    (float)0.00060985,
-    (float)0.000597782,
-    (float)0.000556382,
-    (float)0.000533567,
-    (float)0.000486826,
-    (float)0.000488723,
-    (float)0.000459788,
-    (float)0.000434773,
-    (float)0.000423869,
-    (float)0.00040432,
-    (float)0.000381722,
-    (float)0.000361793,
-    (float)0.00036065,
-    (float)0.00033387,
-    (float)0.000329014,
-    (float)0.000317213,
-    (float)0.000308628,
-    (float)0.000288579,
-    (float)0.000286596,
-    (float)0.000273788,
-    (float)0.00026156,
-    (float)0.000256804,
-    (float)0.000250674,
-    (float)0.000241268,
-    (float)0.000232357,
-    (float)0.00023153,
-    (float)0.000218134,
-    (float)0.000213977,
-    (float)0.000208102,
-    (float)0.000204916,
-    (float)0.000195228,
-    (float)0.000195339,
-    (float)0.000189609,
-    (float)0.000182895,
-    (float)0.000179398,
-    (float)0.000175889,
-    (float)0.00017097,
-    (float)0.000165833,
-    (float)0.000166916,
-    (float)0.000160172,
-    (float)0.000158377,
-    (float)0.000154568,
-    (float)0.000153054,
-    (float)0.000146681,
-    (float)0.00014662,
-    (float)0.000144125,
-    (float)0.000140791,
-    (float)0.00013945,
-    (float)0.00013755,
-    (float)0.00013513,
-    (float)0.000131041,
-    (float)0.00013184,
-    (float)0.000127651,
-    (float)0.000127164,
-    (float)0.000125194,
-    (float)0.000125117,
-    (float)0.000121402,
-    (float)0.000121101,
-    (float)0.000119412,
-    (float)0.000117072,
-    (float)0.000116368,
-    (float)0.00011548,
-    (float)0.000114649,
-    (float)0.000112429,
-    (float)0.000113106,
-    (float)0.000110284,
-    (float)0.000109772,
-    (float)0.000108343,
-    (float)0.000108477,
-    (float)0.000106362,
-    (float)0.00010686,
-    (float)0.000105856,
-    (float)0.00010465,
-    (float)0.000103861,
-    (float)0.000103404,
-    (float)0.00010246,
-    (float)0.000101472,
-    (float)0.000102214,
-    (float)0.000100723,
-    (float)0.000100733,
-    (float)9.98326e-05,
-    (float)0.000100069,
-    (float)9.81469e-05,
-    (float)9.91024e-05,
-    (float)9.81802e-05,
-    (float)9.8113e-05,
-    (float)9.76218e-05,
-    (float)9.80921e-05,
-    (float)9.71517e-05,
-    (float)9.67557e-05,
-    (float)9.73511e-05,
-    (float)9.63093e-05,
-    (float)9.67099e-05,
-    (float)9.63909e-05,
-    (float)9.72725e-05,
-    (float)9.58006e-05,
-    (float)0.474057,
-    (float)0.28196,
-    (float)0.0738606,
-    (float)0.0374066,
-    (float)0.0214395,
-    (float)0.0178131,
-    (float)0.00964609,
-    (float)0.0104013,
-    (float)0.00774792,
-    (float)0.00655282,
-    (float)0.00491981,
-    (float)0.00468476,
-    (float)0.003314,
-    (float)0.00301232,
-    (float)0.00277767,
-    (float)0.00242294,
-    (float)0.00216805,
-    (float)0.0020223,
-    (float)0.00184135,
-    (float)0.00147922,
-    (float)0.00149728,
-    (float)0.00126546,
-    (float)0.00120473,
-    (float)0.00109146,
-    (float)0.00111222,
-    (float)0.000937854,
-    (float)0.000922906,
-    (float)0.000851803,
-    (float)0.000771614,
-    (float)0.000720128,
-    (float)0.000700026,
-    (float)0.000663049,
-    (float)0.000604992,
-    (float)0.000617778,
-    (float)0.000552885,
-    (float)0.000530444,
-    (float)0.000494978,
-    (float)0.000488926,
-    (float)0.000439206,
-    (float)0.000443794,
-    (float)0.000423512,
-    (float)0.000400279,
-    (float)0.000385018,
-    (float)0.000373624,
-    (float)0.000351274,
-    (float)0.000331936,
-    (float)0.00033358,
-    (float)0.000310594,
-    (float)0.000305024,
-    (float)0.000295298,
-    (float)0.00028896,
-    (float)0.000268251,
-    (float)0.000268438,
-    (float)0.000255331,
-    (float)0.000245192,
-    (float)0.000240209,
-    (float)0.000236573,
-    (float)0.000226062,
-    (float)0.000220313,
-    (float)0.000218407,
-    (float)0.000205807,
-    (float)0.000202269,
-    (float)0.000197216,
-    (float)0.000193256,
-    (float)0.000184883,
-    (float)0.00018691,
-    (float)0.000179318,
-    (float)0.000174896,
-    (float)0.00017135,
-    (float)0.00016813,
-    (float)0.000161605,
-    (float)0.000159783,
-    (float)0.000158845,
-    (float)0.000152972,
-    (float)0.000152577,
-    (float)0.000149237,
-    (float)0.0001465,
-    (float)0.000141197,
-    (float)0.00014207,
-    (float)0.00013705,
-    (float)0.00013601,
-    (float)0.000134742,
-    (float)0.000133292,
-    (float)0.00013006,
-    (float)0.000128703,
-    (float)0.000127197,
-    (float)0.000123197,
-    (float)0.000123494,
-    (float)0.000121389,
-    (float)0.00012083,
-    (float)0.000118618,
-    (float)0.000119146,
-    (float)0.00011574,
-    (float)0.000114869,
-    (float)0.000113528,
-    (float)0.000112136,
-    (float)0.00011114,
-    (float)0.000110836,
-    (float)0.00011035,
-    (float)0.00010845,
-    (float)0.000108507,
-    (float)0.000106446,
-    (float)0.000105619,
-    (float)0.000104585,
-    (float)0.000104613,
-    (float)0.000103506,
-    (float)0.000103612,
-    (float)0.000103084,
-    (float)0.000101864,
-    (float)0.000101213,
-    (float)0.000100446,
-    (float)9.97237e-05,
-    (float)9.93385e-05,
-    (float)9.96345e-05,
-    (float)9.91364e-05,
-    (float)9.88627e-05,
-    (float)9.86206e-05,
-    (float)9.77175e-05,
-    (float)9.71293e-05,
-    (float)9.69788e-05,
-    (float)9.68305e-05,
-    (float)9.67662e-05,
-    (float)9.71612e-05,
-    (float)9.70891e-05,
-    (float)9.65664e-05,
-    (float)9.65684e-05,
-    (float)9.60244e-05,
-    (float)9.58587e-05,
-    (float)0.445958,
-    (float)0.311833,
-    (float)0.0734865,
-    (float)0.0380975,
-    (float)0.0216882,
-    (float)0.0171461,
-    (float)0.00880917,
-    (float)0.0105001,
-    (float)0.00736604,
-    (float)0.00645455,
-    (float)0.00500571,
-    (float)0.0047584,
-    (float)0.00314307,
-    (float)0.0030922,
-    (float)0.00265426,
-    (float)0.00230061,
-    (float)0.00213432,
-    (float)0.00204791,
-    (float)0.00176784,
-    (float)0.00151951,
-    (float)0.00152629,
-    (float)0.00120562,
-    (float)0.0011904,
-    (float)0.00108222,
-    (float)0.00106956,
-    (float)0.000909915,
-    (float)0.000968209,
-    (float)0.000824779,
-    (float)0.000776486,
-    (float)0.00072898,
-    (float)0.000690969,
-    (float)0.000625459,
-    (float)0.000618692,
-    (float)0.000605779,
-    (float)0.000539444,
-    (float)0.000547848,
-    (float)0.000500474,
-    (float)0.000476493,
-    (float)0.000438541,
-    (float)0.000448986,
-    (float)0.000398602,
-    (float)0.000404884,
-    (float)0.000387716,
-    (float)0.000370643,
-    (float)0.000348868,
-    (float)0.000345563,
-    (float)0.00032223,
-    (float)0.000305469,
-    (float)0.000308126,
-    (float)0.000288367,
-    (float)0.000282967,
-    (float)0.000274586,
-    (float)0.000270303,
-    (float)0.000248311,
-    (float)0.000252424,
-    (float)0.00023658,
-    (float)0.000229954,
-    (float)0.000224082,
-    (float)0.000223036,
-    (float)0.000210537,
-    (float)0.000209332,
-    (float)0.000205303,
-    (float)0.000193583,
-    (float)0.000191573,
-    (float)0.000186194,
-    (float)0.000181528,
-    (float)0.000174742,
-    (float)0.000178459,
-    (float)0.00016817,
-    (float)0.000167844,
-    (float)0.000163235,
-    (float)0.000160144,
-    (float)0.00015284,
-    (float)0.000154006,
-    (float)0.000149524,
-    (float)0.00014594,
-    (float)0.000146808,
-    (float)0.000142857,
-    (float)0.0001403,
-    (float)0.000136651,
-    (float)0.000136891,
-    (float)0.000129757,
-    (float)0.000131996,
-    (float)0.000128473,
-    (float)0.000128306,
-    (float)0.000125311,
-    (float)0.000126289,
-    (float)0.000121771,
-    (float)0.000120333,
-    (float)0.00011951,
-    (float)0.000116504,
-    (float)0.000116491,
-    (float)0.000115207,
-    (float)0.00011581,
-    (float)0.000112149,
-    (float)0.000113959,
-    (float)0.000109631,
-    (float)0.000109811,
-    (float)0.000107312,
-    (float)0.000108243,
-    (float)0.00010593,
-    (float)0.00010713,
-    (float)0.00010611,
-    (float)0.00010474,
-    (float)0.000104212,
-    (float)0.000102429,
-    (float)0.000102019,
-    (float)0.000100353,
-    (float)0.000102008,
-    (float)9.99292e-05,
-    (float)0.000101567,
-    (float)9.9629e-05,
-    (float)0.000100087,
-    (float)9.75624e-05,
-    (float)9.83529e-05,
-    (float)9.66723e-05,
-    (float)9.73756e-05,
-    (float)9.73545e-05,
-    (float)9.7688e-05,
-    (float)9.73637e-05,
-    (float)9.67557e-05,
-    (float)9.65739e-05,
-    (float)9.49471e-05,
-    (float)9.5761e-05,
-    (float)9.49081e-05,
-    (float)9.63911e-05,
-    (float)9.55812e-05,
-    (float)9.7317e-05,
-    (float)0.415947,
-    (float)0.34409,
-    (float)0.0725388,
-    (float)0.039451,
-    (float)0.0220978,
-    (float)0.0162245,
-    (float)0.00806457,
-    (float)0.0105093,
-    (float)0.00679304,
-    (float)0.00634481,
-    (float)0.00507272,
-    (float)0.00473405,
-    (float)0.00303444,
-    (float)0.00323004,
-    (float)0.00246018,
-    (float)0.00219895,
-    (float)0.00209186,
-    (float)0.00199548,
-    (float)0.00167487,
-    (float)0.00160123,
-    (float)0.00149776,
-    (float)0.00117242,
-    (float)0.00121434,
-    (float)0.00104512,
-    (float)0.00100135,
-    (float)0.000907056,
-    (float)0.000964288,
-    (float)0.000779155,
-    (float)0.000817453,
-    (float)0.000724421,
-    (float)0.000673029,
-    (float)0.00061843,
-    (float)0.000624357,
-    (float)0.000556311,
-    (float)0.000546815,
-    (float)0.000547904,
-    (float)0.000487179,
-    (float)0.000482136,
-    (float)0.000452777,
-    (float)0.000430118,
-    (float)0.00039169,
-    (float)0.000410968,
-    (float)0.0003635,
-    (float)0.000369198,
-    (float)0.000353776,
-    (float)0.000342289,
-    (float)0.000315699,
-    (float)0.000320805,
-    (float)0.000293876,
-    (float)0.000283123,
-    (float)0.000283258,
-    (float)0.000268018,
-    (float)0.000259994,
-    (float)0.000256869,
-    (float)0.00024964,
-    (float)0.000230958,
-    (float)0.000236932,
-    (float)0.00021918,
-    (float)0.000215035,
-    (float)0.000209395,
-    (float)0.000208867,
-    (float)0.00019436,
-    (float)0.000199929,
-    (float)0.000190132,
-    (float)0.000183258,
-    (float)0.000180721,
-    (float)0.000176659,
-    (float)0.000168321,
-    (float)0.000167422,
-    (float)0.000167028,
-    (float)0.000157573,
-    (float)0.000160569,
-    (float)0.000154856,
-    (float)0.000151458,
-    (float)0.000146024,
-    (float)0.000148389,
-    (float)0.000138697,
-    (float)0.000141243,
-    (float)0.000138458,
-    (float)0.000136074,
-    (float)0.000133215,
-    (float)0.000133925,
-    (float)0.00012866,
-    (float)0.000126197,
-    (float)0.000127062,
-    (float)0.00012191,
-    (float)0.000122448,
-    (float)0.000121065,
-    (float)0.00012084,
-    (float)0.000116449,
-    (float)0.000119249,
-    (float)0.000113746,
-    (float)0.000113725,
-    (float)0.000112003,
-    (float)0.000111837,
-    (float)0.000109019,
-    (float)0.000110862,
-    (float)0.000108964,
-    (float)0.000107224,
-    (float)0.000107548,
-    (float)0.000105302,
-    (float)0.000104063,
-    (float)0.000103338,
-    (float)0.000103881,
-    (float)0.000101286,
-    (float)0.000103402,
-    (float)0.000101375,
-    (float)0.000101085,
-    (float)9.95879e-05,
-    (float)0.000100073,
-    (float)9.72503e-05,
-    (float)9.86437e-05,
-    (float)9.78824e-05,
-    (float)9.7666e-05,
-    (float)9.75359e-05,
-    (float)9.78922e-05,
-    (float)9.6105e-05,
-    (float)9.59135e-05,
-    (float)9.5944e-05,
-    (float)9.44924e-05,
-    (float)9.5322e-05,
-    (float)9.55176e-05,
-    (float)9.5544e-05,
-    (float)9.48881e-05,
-    (float)9.61562e-05,
-    (float)9.39002e-05,
-    (float)9.46034e-05,
-    (float)9.41069e-05,
-    (float)0.384317,
-    (float)0.378314,
-    (float)0.0709649,
-    (float)0.0416525,
-    (float)0.0225998,
-    (float)0.0151082,
-    (float)0.00747841,
-    (float)0.0103692,
-    (float)0.00605523,
-    (float)0.00625593,
-    (float)0.00505631,
-    (float)0.0046018,
-    (float)0.00301467,
-    (float)0.00337184,
-    (float)0.00222491,
-    (float)0.00217135,
-    (float)0.00200648,
-    (float)0.00186409,
-    (float)0.00160064,
-    (float)0.00166668,
-    (float)0.00140212,
-    (float)0.00120377,
-    (float)0.00123568,
-    (float)0.000983071,
-    (float)0.000967993,
-    (float)0.000904114,
-    (float)0.000891262,
-    (float)0.000756939,
-    (float)0.000849557,
-    (float)0.000683441,
-    (float)0.000688031,
-    (float)0.00062823,
-    (float)0.000599445,
-    (float)0.000527637,
-    (float)0.000562041,
-    (float)0.000499585,
-    (float)0.000485324,
-    (float)0.000490502,
-    (float)0.000442839,
-    (float)0.000424601,
-    (float)0.000410489,
-    (float)0.000387763,
-    (float)0.000352104,
-    (float)0.000374271,
-    (float)0.000331018,
-    (float)0.000335622,
-    (float)0.000323697,
-    (float)0.000313871,
-    (float)0.000287099,
-    (float)0.00029796,
-    (float)0.00026661,
-    (float)0.000262398,
-    (float)0.000259952,
-    (float)0.000247034,
-    (float)0.000238112,
-    (float)0.000241245,
-    (float)0.000227395,
-    (float)0.000216807,
-    (float)0.000221103,
-    (float)0.000202595,
-    (float)0.000200041,
-    (float)0.000197122,
-    (float)0.00019128,
-    (float)0.000181394,
-    (float)0.000189276,
-    (float)0.000174531,
-    (float)0.000173714,
-    (float)0.000171205,
-    (float)0.000164796,
-    (float)0.000157288,
-    (float)0.000161129,
-    (float)0.00015237,
-    (float)0.00014958,
-    (float)0.000152337,
-    (float)0.000144924,
-    (float)0.000142692,
-    (float)0.000142301,
-    (float)0.000138012,
-    (float)0.000131801,
-    (float)0.000136412,
-    (float)0.000128429,
-    (float)0.000128754,
-    (float)0.00012845,
-    (float)0.000126357,
-    (float)0.000121723,
-    (float)0.000124804,
-    (float)0.000119052,
-    (float)0.000117029,
-    (float)0.000118452,
-    (float)0.000114561,
-    (float)0.000113552,
-    (float)0.000114378,
-    (float)0.000112692,
-    (float)0.000109231,
-    (float)0.000112271,
-    (float)0.000107168,
-    (float)0.000106999,
-    (float)0.000106687,
-    (float)0.000105513,
-    (float)0.000103151,
-    (float)0.000105695,
-    (float)0.000102776,
-    (float)0.000101841,
-    (float)0.000103001,
-    (float)0.000100163,
-    (float)9.94412e-05,
-    (float)9.99296e-05,
-    (float)9.87237e-05,
-    (float)9.71093e-05,
-    (float)9.95815e-05,
-    (float)9.66534e-05,
-    (float)9.68849e-05,
-    (float)9.71175e-05,
-    (float)9.57805e-05,
-    (float)9.44862e-05,
-    (float)9.62345e-05,
-    (float)9.42044e-05,
-    (float)9.41352e-05,
-    (float)9.55385e-05,
-    (float)9.37646e-05,
-    (float)9.35797e-05,
-    (float)9.45094e-05,
-    (float)9.31111e-05,
-    (float)9.24549e-05,
-    (float)9.44457e-05,
-    (float)9.24908e-05,
-    (float)9.31005e-05,
-    (float)9.41073e-05,
-    (float)0.351475,
-    (float)0.413918,
-    (float)0.0687426,
-    (float)0.0448673,
-    (float)0.0231127,
-    (float)0.0139086,
-    (float)0.00710626,
-    (float)0.0100152,
-    (float)0.00521204,
-    (float)0.0062002,
-    (float)0.00489031,
-    (float)0.00438829,
-    (float)0.00307602,
-    (float)0.00344687,
-    (float)0.00200767,
-    (float)0.00224287,
-    (float)0.00184427,
-    (float)0.00170688,
-    (float)0.00154877,
-    (float)0.00164737,
-    (float)0.00128022,
-    (float)0.00129555,
-    (float)0.00119321,
-    (float)0.000946492,
-    (float)0.000984893,
-    (float)0.000861841,
-    (float)0.000807631,
-    (float)0.00076526,
-    (float)0.000806211,
-    (float)0.000641946,
-    (float)0.00073291,
-    (float)0.000602205,
-    (float)0.000589678,
-    (float)0.000537759,
-    (float)0.000541012,
-    (float)0.000453852,
-    (float)0.000504933,
-    (float)0.000446741,
-    (float)0.00043482,
-    (float)0.00043587,
-    (float)0.000403249,
-    (float)0.00037524,
-    (float)0.000372882,
-    (float)0.000347586,
-    (float)0.000317783,
-    (float)0.000339906,
-    (float)0.000298661,
-    (float)0.000306332,
-    (float)0.000295084,
-    (float)0.000286412,
-    (float)0.000262053,
-    (float)0.000276967,
-    (float)0.000239094,
-    (float)0.000245464,
-    (float)0.00023609,
-    (float)0.000225846,
-    (float)0.000218795,
-    (float)0.000224842,
-    (float)0.000204675,
-    (float)0.000206125,
-    (float)0.000203747,
-    (float)0.000186209,
-    (float)0.00018876,
-    (float)0.000182637,
-    (float)0.000173714,
-    (float)0.000171531,
-    (float)0.000175175,
-    (float)0.000158556,
-    (float)0.000167844,
-    (float)0.000157887,
-    (float)0.000153744,
-    (float)0.000150233,
-    (float)0.000151379,
-    (float)0.000138039,
-    (float)0.000145845,
-    (float)0.000138572,
-    (float)0.000135289,
-    (float)0.000137031,
-    (float)0.000133992,
-    (float)0.00012804,
-    (float)0.000130031,
-    (float)0.000126687,
-    (float)0.000119662,
-    (float)0.000125653,
-    (float)0.000117854,
-    (float)0.000118919,
-    (float)0.000117718,
-    (float)0.00011814,
-    (float)0.000111121,
-    (float)0.000117838,
-    (float)0.000108832,
-    (float)0.000110672,
-    (float)0.000109185,
-    (float)0.000107759,
-    (float)0.000104986,
-    (float)0.000108409,
-    (float)0.000103986,
-    (float)0.000103841,
-    (float)0.000105824,
-    (float)0.000100418,
-    (float)0.000102326,
-    (float)0.000100418,
-    (float)9.95971e-05,
-    (float)9.72301e-05,
-    (float)0.000101231,
-    (float)9.49047e-05,
-    (float)9.96031e-05,
-    (float)9.64936e-05,
-    (float)9.65971e-05,
-    (float)9.50541e-05,
-    (float)9.68811e-05,
-    (float)9.21708e-05,
-    (float)9.53224e-05,
-    (float)9.35261e-05,
-    (float)9.24001e-05,
-    (float)9.40982e-05,
-    (float)9.32086e-05,
-    (float)9.20626e-05,
-    (float)9.31128e-05,
-    (float)9.27328e-05,
-    (float)9.00438e-05,
-    (float)9.33665e-05,
-    (float)9.00879e-05,
-    (float)9.12891e-05,
-    (float)9.13747e-05,
-    (float)9.19157e-05,
-    (float)8.9727e-05,
-    (float)9.37431e-05,
-    (float)0.317936,
-    (float)0.450169,
-    (float)0.0659071,
-    (float)0.0491849,
-    (float)0.0235726,
-    (float)0.0127701,
-    (float)0.00698929,
-    (float)0.00938554,
-    (float)0.00436361,
-    (float)0.00613811,
-    (float)0.00454754,
-    (float)0.00413889,
-    (float)0.00317683,
-    (float)0.00338964,
-    (float)0.00188246,
-    (float)0.00237075,
-    (float)0.0016179,
-    (float)0.00160437,
-    (float)0.00147871,
-    (float)0.00151854,
-    (float)0.00118848,
-    (float)0.00137542,
-    (float)0.00107681,
-    (float)0.000993539,
-    (float)0.000983012,
-    (float)0.000801298,
-    (float)0.000778838,
-    (float)0.000758434,
-    (float)0.000699317,
-    (float)0.000648754,
-    (float)0.000715314,
-    (float)0.000560325,
-    (float)0.000623613,
-    (float)0.000530955,
-    (float)0.000511671,
-    (float)0.000461072,
-    (float)0.000485531,
-    (float)0.000394502,
-    (float)0.000452916,
-    (float)0.00039566,
-    (float)0.00039389,
-    (float)0.000384152,
-    (float)0.000368619,
-    (float)0.000330473,
-    (float)0.000342245,
-    (float)0.000305385,
-    (float)0.000292298,
-    (float)0.000302132,
-    (float)0.000271176,
-    (float)0.000276931,
-    (float)0.000270401,
-    (float)0.000257027,
-    (float)0.000244086,
-    (float)0.000252204,
-    (float)0.000216289,
-    (float)0.000229972,
-    (float)0.000211279,
-    (float)0.000206513,
-    (float)0.000201081,
-    (float)0.000205307,
-    (float)0.000184202,
-    (float)0.000197975,
-    (float)0.000181113,
-    (float)0.000176793,
-    (float)0.000175375,
-    (float)0.000167776,
-    (float)0.000158675,
-    (float)0.000163806,
-    (float)0.000153775,
-    (float)0.000150826,
-    (float)0.000155924,
-    (float)0.000143987,
-    (float)0.000146298,
-    (float)0.000142895,
-    (float)0.000137395,
-    (float)0.00013256,
-    (float)0.000136841,
-    (float)0.000123732,
-    (float)0.000131179,
-    (float)0.000125112,
-    (float)0.000124285,
-    (float)0.000122529,
-    (float)0.00012435,
-    (float)0.000115191,
-    (float)0.000120418,
-    (float)0.000113804,
-    (float)0.000111697,
-    (float)0.000112763,
-    (float)0.000109892,
-    (float)0.00010812,
-    (float)0.000110252,
-    (float)0.00010774,
-    (float)0.000105255,
-    (float)0.000108516,
-    (float)0.000101613,
-    (float)0.000103631,
-    (float)0.000101004,
-    (float)0.000100088,
-    (float)9.8097e-05,
-    (float)0.000101391,
-    (float)9.61548e-05,
-    (float)0.000100334,
-    (float)9.74809e-05,
-    (float)9.68639e-05,
-    (float)9.60699e-05,
-    (float)9.55751e-05,
-    (float)9.23452e-05,
-    (float)9.42152e-05,
-    (float)9.23297e-05,
-    (float)9.19284e-05,
-    (float)9.38311e-05,
-    (float)9.20697e-05,
-    (float)9.25452e-05,
-    (float)9.24852e-05,
-    (float)9.0965e-05,
-    (float)8.98325e-05,
-    (float)9.06752e-05,
-    (float)8.78472e-05,
-    (float)8.97383e-05,
-    (float)8.91971e-05,
-    (float)8.92533e-05,
-    (float)9.00386e-05,
-    (float)9.03692e-05,
-    (float)8.8727e-05,
-    (float)9.0033e-05,
-    (float)8.8058e-05,
-    (float)8.78039e-05,
-    (float)8.82722e-05,
-    (float)0.284158,
-    (float)0.48635,
-    (float)0.0624832,
-    (float)0.0546726,
-    (float)0.023898,
-    (float)0.0118898,
-    (float)0.00711467,
-    (float)0.00849662,
-    (float)0.00359318,
-    (float)0.00601821,
-    (float)0.00402549,
-    (float)0.00391191,
-    (float)0.00323503,
-    (float)0.00319981,
-    (float)0.00187653,
-    (float)0.0024751,
-    (float)0.00138766,
-    (float)0.00160788,
-    (float)0.00134757,
-    (float)0.00133559,
-    (float)0.00113469,
-    (float)0.00135007,
-    (float)0.000952048,
-    (float)0.00109504,
-    (float)0.000911823,
-    (float)0.000790214,
-    (float)0.000787911,
-    (float)0.000704164,
-    (float)0.00062859,
-    (float)0.000661596,
-    (float)0.000613178,
-    (float)0.000556697,
-    (float)0.000624213,
-    (float)0.000495669,
-    (float)0.000531198,
-    (float)0.000468302,
-    (float)0.000444907,
-    (float)0.000399733,
-    (float)0.000430445,
-    (float)0.000345101,
-    (float)0.000404452,
-    (float)0.000349207,
-    (float)0.000355644,
-    (float)0.000340999,
-    (float)0.000334127,
-    (float)0.000293632,
-    (float)0.000313772,
-    (float)0.000266387,
-    (float)0.00026979,
-    (float)0.000265084,
-    (float)0.000244976,
-    (float)0.000248839,
-    (float)0.000246556,
-    (float)0.000228651,
-    (float)0.000230781,
-    (float)0.000224286,
-    (float)0.00020074,
-    (float)0.000211878,
-    (float)0.000189054,
-    (float)0.000187974,
-    (float)0.000184942,
-    (float)0.000180811,
-    (float)0.000170885,
-    (float)0.000182913,
-    (float)0.000161964,
-    (float)0.000169655,
-    (float)0.000160436,
-    (float)0.000153654,
-    (float)0.000149206,
-    (float)0.000149822,
-    (float)0.000136393,
-    (float)0.000144654,
-    (float)0.000137001,
-    (float)0.000134795,
-    (float)0.000137723,
-    (float)0.000131679,
-    (float)0.000128349,
-    (float)0.000128995,
-    (float)0.000121742,
-    (float)0.000118723,
-    (float)0.000121186,
-    (float)0.000112349,
-    (float)0.000117341,
-    (float)0.000114163,
-    (float)0.00011329,
-    (float)0.000112278,
-    (float)0.000113414,
-    (float)0.000105661,
-    (float)0.000110062,
-    (float)0.000102878,
-    (float)0.000102878,
-    (float)0.000102154,
-    (float)0.000101031,
-    (float)9.96569e-05,
-    (float)0.000102632,
-    (float)9.91054e-05,
-    (float)9.98818e-05,
-    (float)9.97564e-05,
-    (float)9.52556e-05,
-    (float)9.64894e-05,
-    (float)9.33481e-05,
-    (float)9.26001e-05,
-    (float)9.21104e-05,
-    (float)9.33397e-05,
-    (float)9.08426e-05,
-    (float)9.48795e-05,
-    (float)9.11815e-05,
-    (float)9.29031e-05,
-    (float)9.06473e-05,
-    (float)9.00153e-05,
-    (float)8.75849e-05,
-    (float)8.85977e-05,
-    (float)8.5961e-05,
-    (float)8.79196e-05,
-    (float)8.76484e-05,
-    (float)8.80014e-05,
-    (float)8.89635e-05,
-    (float)8.82497e-05,
-    (float)8.7798e-05,
-    (float)8.67014e-05,
-    (float)8.60518e-05,
-    (float)8.42381e-05,
-    (float)8.55488e-05,
-    (float)8.38195e-05,
-    (float)8.64778e-05,
-    (float)8.54581e-05,
-    (float)8.77482e-05,
-    (float)8.64882e-05,
-    (float)0.250701,
-    (float)0.521641,
-    (float)0.05853,
-    (float)0.0613046,
-    (float)0.0240197,
-    (float)0.0114698,
-    (float)0.00746081,
-    (float)0.00740923,
-    (float)0.00299317,
-    (float)0.0057757,
-    (float)0.00336603,
-    (float)0.00373576,
-    (float)0.00316996,
-    (float)0.00291458,
-    (float)0.001965,
-    (float)0.00247371,
-    (float)0.00122773,
-    (float)0.00170745,
-    (float)0.00115524,
-    (float)0.00120545,
-    (float)0.0010746,
-    (float)0.00120073,
-    (float)0.000868336,
-    (float)0.00115112,
-    (float)0.000786077,
-    (float)0.000864712,
-    (float)0.000756427,
-    (float)0.000660747,
-    (float)0.000626462,
-    (float)0.000628124,
-    (float)0.000518753,
-    (float)0.00057837,
-    (float)0.000533606,
-    (float)0.000483679,
-    (float)0.000537871,
-    (float)0.000438184,
-    (float)0.000454516,
-    (float)0.000413352,
-    (float)0.000386971,
-    (float)0.000351414,
-    (float)0.000380209,
-    (float)0.000302143,
-    (float)0.000362826,
-    (float)0.000303937,
-    (float)0.000320905,
-    (float)0.000300837,
-    (float)0.000300085,
-    (float)0.000261362,
-    (float)0.000287953,
-    (float)0.000231066,
-    (float)0.000253111,
-    (float)0.000229395,
-    (float)0.000222889,
-    (float)0.000221955,
-    (float)0.000221026,
-    (float)0.000202312,
-    (float)0.000216193,
-    (float)0.000194674,
-    (float)0.000190356,
-    (float)0.000191771,
-    (float)0.000170639,
-    (float)0.000174792,
-    (float)0.000167223,
-    (float)0.000159615,
-    (float)0.000159508,
-    (float)0.000161096,
-    (float)0.000146113,
-    (float)0.000160199,
-    (float)0.000141447,
-    (float)0.000146118,
-    (float)0.00013858,
-    (float)0.000136061,
-    (float)0.000126927,
-    (float)0.000135167,
-    (float)0.00011821,
-    (float)0.000130182,
-    (float)0.000120112,
-    (float)0.000122108,
-    (float)0.000119607,
-    (float)0.000119947,
-    (float)0.000111491,
-    (float)0.000117467,
-    (float)0.000106817,
-    (float)0.000108868,
-    (float)0.000107459,
-    (float)0.00010321,
-    (float)0.000105413,
-    (float)0.000104131,
-    (float)0.000102175,
-    (float)0.00010247,
-    (float)0.000102484,
-    (float)9.62642e-05,
-    (float)0.000101602,
-    (float)9.27861e-05,
-    (float)9.68393e-05,
-    (float)9.23407e-05,
-    (float)9.4619e-05,
-    (float)9.04075e-05,
-    (float)9.63726e-05,
-    (float)8.85805e-05,
-    (float)9.56179e-05,
-    (float)8.89254e-05,
-    (float)9.162e-05,
-    (float)8.79279e-05,
-    (float)8.93579e-05,
-    (float)8.48744e-05,
-    (float)8.87914e-05,
-    (float)8.43502e-05,
-    (float)8.72918e-05,
-    (float)8.64681e-05,
-    (float)8.6155e-05,
-    (float)8.66103e-05,
-    (float)8.59451e-05,
-    (float)8.47112e-05,
-    (float)8.41035e-05,
-    (float)8.40226e-05,
-    (float)8.14124e-05,
-    (float)8.42626e-05,
-    (float)8.12862e-05,
-    (float)8.42145e-05,
-    (float)8.25533e-05,
-    (float)8.48669e-05,
-    (float)8.19599e-05,
-    (float)8.54144e-05,
-    (float)8.04968e-05,
-    (float)8.39877e-05,
-    (float)8.01401e-05,
-    (float)8.27068e-05,
-    (float)0.218155,
-    (float)0.555199,
-    (float)0.0541787,
-    (float)0.0689658,
-    (float)0.0239144,
-    (float)0.0116749,
-    (float)0.007989,
-    (float)0.00620314,
-    (float)0.00263803,
-    (float)0.00532449,
-    (float)0.00266423,
-    (float)0.00358923,
-    (float)0.00295669,
-    (float)0.00259808,
-    (float)0.00209894,
-    (float)0.00230698,
-    (float)0.00119743,
-    (float)0.00179883,
-    (float)0.000958351,
-    (float)0.0011896,
-    (float)0.000969856,
-    (float)0.00100283,
-    (float)0.000833022,
-    (float)0.00107018,
-    (float)0.000682585,
-    (float)0.000954093,
-    (float)0.000655905,
-    (float)0.00069798,
-    (float)0.000617766,
-    (float)0.000571766,
-    (float)0.000498155,
-    (float)0.000562852,
-    (float)0.000426463,
-    (float)0.000513173,
-    (float)0.000451669,
-    (float)0.000430099,
-    (float)0.000455358,
-    (float)0.000393339,
-    (float)0.000385583,
-    (float)0.000374003,
-    (float)0.000327957,
-    (float)0.000320522,
-    (float)0.000324394,
-    (float)0.00027094,
-    (float)0.000317973,
-    (float)0.000266915,
-    (float)0.000284128,
-    (float)0.000270039,
-    (float)0.000261763,
-    (float)0.00023997,
-    (float)0.000256987,
-    (float)0.000204676,
-    (float)0.000236286,
-    (float)0.000196794,
-    (float)0.000204191,
-    (float)0.000196347,
-    (float)0.000193675,
-    (float)0.000180734,
-    (float)0.000197648,
-    (float)0.000166129,
-    (float)0.000185022,
-    (float)0.000164847,
-    (float)0.000161153,
-    (float)0.000159163,
-    (float)0.000151193,
-    (float)0.000142268,
-    (float)0.000150457,
-    (float)0.000133484,
-    (float)0.000141163,
-    (float)0.000137397,
-    (float)0.000129604,
-    (float)0.000135071,
-    (float)0.000127285,
-    (float)0.000122707,
-    (float)0.000124806,
-    (float)0.000116177,
-    (float)0.000113936,
-    (float)0.000117387,
-    (float)0.000105911,
-    (float)0.000114068,
-    (float)0.000107368,
-    (float)0.000107103,
-    (float)0.000107104,
-    (float)0.000105822,
-    (float)9.95721e-05,
-    (float)0.000106361,
-    (float)9.42984e-05,
-    (float)0.000100887,
-    (float)9.50215e-05,
-    (float)9.49491e-05,
-    (float)9.40413e-05,
-    (float)9.54271e-05,
-    (float)8.98049e-05,
-    (float)9.64038e-05,
-    (float)8.86885e-05,
-    (float)9.19945e-05,
-    (float)9.0065e-05,
-    (float)8.75488e-05,
-    (float)8.79286e-05,
-    (float)8.7487e-05,
-    (float)8.41611e-05,
-    (float)8.71652e-05,
-    (float)8.45487e-05,
-    (float)8.39582e-05,
-    (float)8.66248e-05,
-    (float)8.22856e-05,
-    (float)8.49048e-05,
-    (float)8.32108e-05,
-    (float)8.18438e-05,
-    (float)8.2119e-05,
-    (float)8.20237e-05,
-    (float)7.89961e-05,
-    (float)8.28883e-05,
-    (float)7.87446e-05,
-    (float)8.10745e-05,
-    (float)8.08074e-05,
-    (float)7.95681e-05,
-    (float)8.02261e-05,
-    (float)8.05526e-05,
-    (float)7.78491e-05,
-    (float)8.04273e-05,
-    (float)7.81653e-05,
-    (float)7.80122e-05,
-    (float)7.98276e-05,
-    (float)7.75819e-05,
-    (float)7.90559e-05,
-    (float)7.96744e-05,
-    (float)7.78448e-05,
-    (float)0.187023,
-    (float)0.586258,
-    (float)0.0495248,
-    (float)0.0775365,
-    (float)0.0235241,
-    (float)0.012688,
-    (float)0.00861427,
-    (float)0.00505728,
-    (float)0.0025527,
-    (float)0.00464829,
-    (float)0.00200079,
-    (float)0.00342813,
-    (float)0.00257516,
-    (float)0.00233362,
-    (float)0.00218627,
-    (float)0.00201355,
-    (float)0.00129607,
-    (float)0.00177666,
-    (float)0.000830716,
-    (float)0.00126363,
-    (float)0.000814856,
-    (float)0.000880357,
-    (float)0.000795261,
-    (float)0.000869559,
-    (float)0.000648418,
-    (float)0.000927412,
-    (float)0.000553555,
-    (float)0.000784924,
-    (float)0.000550035,
-    (float)0.000574828,
-    (float)0.000507307,
-    (float)0.000495547,
-    (float)0.000403129,
-    (float)0.000499262,
-    (float)0.000349686,
-    (float)0.000457858,
-    (float)0.000376041,
-    (float)0.00038464,
-    (float)0.000385565,
-    (float)0.00035109,
-    (float)0.000330427,
-    (float)0.000339913,
-    (float)0.000275178,
-    (float)0.000299131,
-    (float)0.000268565,
-    (float)0.000247763,
-    (float)0.000272842,
-    (float)0.00023326,
-    (float)0.000250044,
-    (float)0.00024183,
-    (float)0.000223776,
-    (float)0.000227011,
-    (float)0.000219175,
-    (float)0.000190494,
-    (float)0.000214443,
-    (float)0.000170278,
-    (float)0.000189566,
-    (float)0.000171645,
-    (float)0.000166862,
-    (float)0.00016661,
-    (float)0.000167294,
-    (float)0.000148974,
-    (float)0.000171395,
-    (float)0.000139291,
-    (float)0.000156706,
-    (float)0.000140718,
-    (float)0.000136683,
-    (float)0.00013457,
-    (float)0.000131621,
-    (float)0.000118803,
-    (float)0.000132813,
-    (float)0.000111799,
-    (float)0.000124366,
-    (float)0.000116669,
-    (float)0.000113405,
-    (float)0.000116224,
-    (float)0.000112089,
-    (float)0.000105552,
-    (float)0.000112673,
-    (float)9.88067e-05,
-    (float)0.000104204,
-    (float)0.000101005,
-    (float)9.43954e-05,
-    (float)0.000100756,
-    (float)9.41098e-05,
-    (float)9.40962e-05,
-    (float)9.69669e-05,
-    (float)9.0849e-05,
-    (float)9.25298e-05,
-    (float)9.38446e-05,
-    (float)8.52291e-05,
-    (float)9.35802e-05,
-    (float)8.40757e-05,
-    (float)8.71819e-05,
-    (float)8.58348e-05,
-    (float)8.36128e-05,
-    (float)8.29894e-05,
-    (float)8.631e-05,
-    (float)7.84343e-05,
-    (float)8.7393e-05,
-    (float)7.88816e-05,
-    (float)8.30265e-05,
-    (float)8.14877e-05,
-    (float)7.97141e-05,
-    (float)7.94683e-05,
-    (float)8.10419e-05,
-    (float)7.50721e-05,
-    (float)8.13737e-05,
-    (float)7.51964e-05,
-    (float)7.75621e-05,
-    (float)7.84927e-05,
-    (float)7.50984e-05,
-    (float)7.82759e-05,
-    (float)7.71633e-05,
-    (float)7.51094e-05,
-    (float)7.824e-05,
-    (float)7.5101e-05,
-    (float)7.46348e-05,
-    (float)7.7811e-05,
-    (float)7.15711e-05,
-    (float)7.73741e-05,
-    (float)7.33008e-05,
-    (float)7.43565e-05,
-    (float)7.5301e-05,
-    (float)7.48264e-05,
-    (float)7.32772e-05,
-    (float)7.82857e-05,
-    (float)7.12561e-05,
-    (float)0.157793,
-    (float)0.614047,
-    (float)0.0447037,
-    (float)0.0868147,
-    (float)0.0228297,
-    (float)0.0146442,
-    (float)0.00924795,
-    (float)0.00418434,
-    (float)0.00273577,
-    (float)0.0037815,
-    (float)0.00147308,
-    (float)0.0031754,
-    (float)0.00205867,
-    (float)0.00215674,
-    (float)0.00213628,
-    (float)0.00169399,
-    (float)0.00146136,
-    (float)0.00159881,
-    (float)0.000829931,
-    (float)0.00132201,
-    (float)0.000656867,
-    (float)0.000897501,
-    (float)0.000696297,
-    (float)0.000693203,
-    (float)0.000641586,
-    (float)0.000754068,
-    (float)0.000512365,
-    (float)0.000792889,
-    (float)0.000454247,
-    (float)0.000657041,
-    (float)0.000458764,
-    (float)0.000485628,
-    (float)0.000419903,
-    (float)0.000427683,
-    (float)0.00033116,
-    (float)0.000439514,
-    (float)0.000282469,
-    (float)0.00041349,
-    (float)0.000303428,
-    (float)0.000349697,
-    (float)0.000322917,
-    (float)0.00031277,
-    (float)0.000287194,
-    (float)0.000307023,
-    (float)0.000232655,
-    (float)0.000284013,
-    (float)0.000214316,
-    (float)0.000235978,
-    (float)0.000223549,
-    (float)0.000205583,
-    (float)0.00021784,
-    (float)0.000209891,
-    (float)0.000193086,
-    (float)0.000213874,
-    (float)0.00017904,
-    (float)0.000189575,
-    (float)0.000181499,
-    (float)0.000156902,
-    (float)0.000175187,
-    (float)0.000145562,
-    (float)0.000151907,
-    (float)0.000149002,
-    (float)0.000135483,
-    (float)0.000142518,
-    (float)0.000140077,
-    (float)0.000125676,
-    (float)0.000146505,
-    (float)0.000117361,
-    (float)0.000135253,
-    (float)0.000119676,
-    (float)0.0001171,
-    (float)0.000115757,
-    (float)0.000111728,
-    (float)0.000101201,
-    (float)0.000115477,
-    (float)9.16632e-05,
-    (float)0.000112059,
-    (float)9.52731e-05,
-    (float)0.000101916,
-    (float)9.93917e-05,
-    (float)9.83587e-05,
-    (float)9.27446e-05,
-    (float)0.000101827,
-    (float)8.29645e-05,
-    (float)9.96727e-05,
-    (float)8.15002e-05,
-    (float)8.95022e-05,
-    (float)8.47734e-05,
-    (float)8.33701e-05,
-    (float)8.27854e-05,
-    (float)8.6793e-05,
-    (float)7.69927e-05,
-    (float)9.00398e-05,
-    (float)7.63065e-05,
-    (float)8.51066e-05,
-    (float)8.04892e-05,
-    (float)7.79515e-05,
-    (float)8.05757e-05,
-    (float)7.68947e-05,
-    (float)7.4568e-05,
-    (float)7.91188e-05,
-    (float)7.09133e-05,
-    (float)7.72669e-05,
-    (float)7.43995e-05,
-    (float)7.25373e-05,
-    (float)7.85844e-05,
-    (float)7.17228e-05,
-    (float)7.67268e-05,
-    (float)7.4697e-05,
-    (float)7.22893e-05,
-    (float)7.44101e-05,
-    (float)7.21389e-05,
-    (float)6.91035e-05,
-    (float)7.50236e-05,
-    (float)6.56808e-05,
-    (float)7.47546e-05,
-    (float)6.84219e-05,
-    (float)7.16084e-05,
-    (float)7.19743e-05,
-    (float)7.17022e-05,
-    (float)7.02404e-05,
-    (float)7.55973e-05,
-    (float)6.61094e-05,
-    (float)7.65471e-05,
-    (float)6.5953e-05,
-    (float)7.20867e-05,
-    (float)6.88206e-05,
-    (float)6.8923e-05,
-    (float)0.130963,
-    (float)0.638061,
-    (float)0.0398831,
-    (float)0.0963835,
-    (float)0.0218754,
-    (float)0.0175271,
-    (float)0.00983952,
-    (float)0.00378344,
-    (float)0.00317517,
-    (float)0.00280537,
-    (float)0.00118189,
-    (float)0.00272299,
-    (float)0.00150731,
-    (float)0.00199959,
-    (float)0.00191978,
-    (float)0.00142943,
-    (float)0.00161054,
-    (float)0.00129666,
-    (float)0.000981507,
-    (float)0.00122311,
-    (float)0.000605883,
-    (float)0.000949066,
-    (float)0.000566916,
-    (float)0.000643656,
-    (float)0.000600542,
-    (float)0.000548017,
-    (float)0.000535411,
-    (float)0.00062386,
-    (float)0.000431782,
-    (float)0.000654498,
-    (float)0.00039065,
-    (float)0.000548451,
-    (float)0.000393243,
-    (float)0.000410446,
-    (float)0.000361731,
-    (float)0.000354968,
-    (float)0.000288773,
-    (float)0.000365865,
-    (float)0.000238712,
-    (float)0.000361,
-    (float)0.000245899,
-    (float)0.000316999,
-    (float)0.000269438,
-    (float)0.000276506,
-    (float)0.00025634,
-    (float)0.000265272,
-    (float)0.00021059,
-    (float)0.000257961,
-    (float)0.000176449,
-    (float)0.000227988,
-    (float)0.000174009,
-    (float)0.000190679,
-    (float)0.000180299,
-    (float)0.000176883,
-    (float)0.000170697,
-    (float)0.000185313,
-    (float)0.000151951,
-    (float)0.000185842,
-    (float)0.000143487,
-    (float)0.00016354,
-    (float)0.000144408,
-    (float)0.000136544,
-    (float)0.000137616,
-    (float)0.000126404,
-    (float)0.000119568,
-    (float)0.000129092,
-    (float)0.000106615,
-    (float)0.000126512,
-    (float)0.00010943,
-    (float)0.000114822,
-    (float)0.0001167,
-    (float)0.00010603,
-    (float)0.000112282,
-    (float)0.000105697,
-    (float)9.79859e-05,
-    (float)0.00010453,
-    (float)8.8501e-05,
-    (float)9.50226e-05,
-    (float)8.93206e-05,
-    (float)8.41866e-05,
-    (float)9.15641e-05,
-    (float)8.24852e-05,
-    (float)8.79399e-05,
-    (float)8.77122e-05,
-    (float)8.27515e-05,
-    (float)8.8672e-05,
-    (float)8.23538e-05,
-    (float)8.15063e-05,
-    (float)8.40573e-05,
-    (float)7.37545e-05,
-    (float)8.11393e-05,
-    (float)7.21989e-05,
-    (float)7.43774e-05,
-    (float)7.41678e-05,
-    (float)7.12661e-05,
-    (float)7.36638e-05,
-    (float)7.46684e-05,
-    (float)7.06214e-05,
-    (float)7.86038e-05,
-    (float)6.93957e-05,
-    (float)7.68953e-05,
-    (float)7.07744e-05,
-    (float)7.13118e-05,
-    (float)7.06956e-05,
-    (float)6.80746e-05,
-    (float)6.7034e-05,
-    (float)6.91462e-05,
-    (float)6.34302e-05,
-    (float)7.08165e-05,
-    (float)6.42717e-05,
-    (float)7.00542e-05,
-    (float)6.832e-05,
-    (float)6.84058e-05,
-    (float)7.01978e-05,
-    (float)6.845e-05,
-    (float)6.74994e-05,
-    (float)6.92571e-05,
-    (float)6.36317e-05,
-    (float)6.79751e-05,
-    (float)6.29144e-05,
-    (float)6.48152e-05,
-    (float)6.51338e-05,
-    (float)6.35002e-05,
-    (float)6.67628e-05,
-    (float)6.60826e-05,
-    (float)6.62594e-05,
-    (float)6.95791e-05,
-    (float)6.55693e-05,
-    (float)0.106703,
-    (float)0.657938,
-    (float)0.0351301,
-    (float)0.106022,
-    (float)0.0206663,
-    (float)0.0213063,
-    (float)0.0103077,
-    (float)0.00405264,
-    (float)0.00379486,
-    (float)0.00193769,
-    (float)0.00116412,
-    (float)0.00210132,
-    (float)0.00102023,
-    (float)0.00178541,
-    (float)0.00153839,
-    (float)0.00125365,
-    (float)0.00161557,
-    (float)0.00100431,
-    (float)0.00118408,
-    (float)0.000986954,
-    (float)0.000702041,
-    (float)0.000908311,
-    (float)0.000491068,
-    (float)0.00068204,
-    (float)0.000502141,
-    (float)0.000471617,
-    (float)0.000525921,
-    (float)0.000424362,
-    (float)0.000465428,
-    (float)0.000493581,
-    (float)0.000379049,
-    (float)0.000527849,
-    (float)0.000341561,
-    (float)0.000458101,
-    (float)0.000342561,
-    (float)0.000348318,
-    (float)0.000323948,
-    (float)0.00028879,
-    (float)0.000268064,
-    (float)0.00029156,
-    (float)0.000215029,
-    (float)0.000302296,
-    (float)0.000203435,
-    (float)0.00028163,
-    (float)0.000221821,
-    (float)0.000243967,
-    (float)0.000227868,
-    (float)0.000221562,
-    (float)0.000201218,
-    (float)0.000217626,
-    (float)0.000162387,
-    (float)0.000208961,
-    (float)0.000141741,
-    (float)0.00018343,
-    (float)0.000143548,
-    (float)0.000156573,
-    (float)0.000147602,
-    (float)0.000148296,
-    (float)0.000138792,
-    (float)0.000155363,
-    (float)0.000123437,
-    (float)0.000156483,
-    (float)0.00011524,
-    (float)0.000140286,
-    (float)0.000114864,
-    (float)0.000118001,
-    (float)0.000111169,
-    (float)0.000106677,
-    (float)9.91135e-05,
-    (float)0.000107965,
-    (float)8.73728e-05,
-    (float)0.000109536,
-    (float)8.57969e-05,
-    (float)0.000103307,
-    (float)9.15457e-05,
-    (float)9.42248e-05,
-    (float)9.30323e-05,
-    (float)9.02331e-05,
-    (float)8.5126e-05,
-    (float)9.03828e-05,
-    (float)7.47015e-05,
-    (float)8.76153e-05,
-    (float)7.05642e-05,
-    (float)8.00827e-05,
-    (float)7.27078e-05,
-    (float)7.39004e-05,
-    (float)7.44222e-05,
-    (float)7.42101e-05,
-    (float)7.20935e-05,
-    (float)7.79789e-05,
-    (float)6.87059e-05,
-    (float)7.82285e-05,
-    (float)6.79409e-05,
-    (float)7.30267e-05,
-    (float)6.87055e-05,
-    (float)6.71216e-05,
-    (float)6.74983e-05,
-    (float)6.52292e-05,
-    (float)6.40824e-05,
-    (float)6.66664e-05,
-    (float)6.1994e-05,
-    (float)6.75618e-05,
-    (float)6.35559e-05,
-    (float)6.62198e-05,
-    (float)6.66398e-05,
-    (float)6.43121e-05,
-    (float)6.73921e-05,
-    (float)6.35377e-05,
-    (float)6.49195e-05,
-    (float)6.32534e-05,
-    (float)6.19381e-05,
-    (float)6.20124e-05,
-    (float)6.12293e-05,
-    (float)6.00755e-05,
-    (float)6.27693e-05,
-    (float)5.91666e-05,
-    (float)6.45406e-05,
-    (float)6.00872e-05,
-    (float)6.50851e-05,
-    (float)6.15861e-05,
-    (float)6.45379e-05,
-    (float)6.17941e-05,
-    (float)6.37242e-05,
-    (float)6.02204e-05,
-    (float)6.31418e-05,
-    (float)5.81015e-05,
-    (float)6.28665e-05,
-    (float)5.71437e-05,
-    (float)0.0852148,
-    (float)0.673288,
-    (float)0.0305765,
-    (float)0.115447,
-    (float)0.0192586,
-    (float)0.0258891,
-    (float)0.0106032,
-    (float)0.00512432,
-    (float)0.00451205,
-    (float)0.00138752,
-    (float)0.00142611,
-    (float)0.00139208,
-    (float)0.000709209,
-    (float)0.00144317,
-    (float)0.00107892,
-    (float)0.00111369,
-    (float)0.00142551,
-    (float)0.000802497,
-    (float)0.00131162,
-    (float)0.000715821,
-    (float)0.000903547,
-    (float)0.000730389,
-    (float)0.000551071,
-    (float)0.00066363,
-    (float)0.000424292,
-    (float)0.000495795,
-    (float)0.000448683,
-    (float)0.00034692,
-    (float)0.000470392,
-    (float)0.000313014,
-    (float)0.000422963,
-    (float)0.00036733,
-    (float)0.000348304,
-    (float)0.000409571,
-    (float)0.000307132,
-    (float)0.000377759,
-    (float)0.000304466,
-    (float)0.000297103,
-    (float)0.000299545,
-    (float)0.000233264,
-    (float)0.000263971,
-    (float)0.000219134,
-    (float)0.000212943,
-    (float)0.000232886,
-    (float)0.000181757,
-    (float)0.000235161,
-    (float)0.000183718,
-    (float)0.000212992,
-    (float)0.000197922,
-    (float)0.0001846,
-    (float)0.000195074,
-    (float)0.000170345,
-    (float)0.000168359,
-    (float)0.000168956,
-    (float)0.00013652,
-    (float)0.000163838,
-    (float)0.000120407,
-    (float)0.000146244,
-    (float)0.000121673,
-    (float)0.000125596,
-    (float)0.000125354,
-    (float)0.000116511,
-    (float)0.000119195,
-    (float)0.000120542,
-    (float)0.000105865,
-    (float)0.000124792,
-    (float)9.60884e-05,
-    (float)0.000117553,
-    (float)9.40687e-05,
-    (float)0.000101244,
-    (float)9.35226e-05,
-    (float)8.80867e-05,
-    (float)8.73226e-05,
-    (float)8.54397e-05,
-    (float)7.70521e-05,
-    (float)8.87302e-05,
-    (float)7.05919e-05,
-    (float)8.8799e-05,
-    (float)7.18451e-05,
-    (float)8.29502e-05,
-    (float)7.59459e-05,
-    (float)7.64239e-05,
-    (float)7.53622e-05,
-    (float)7.43336e-05,
-    (float)6.86559e-05,
-    (float)7.5333e-05,
-    (float)6.13584e-05,
-    (float)7.43759e-05,
-    (float)5.88994e-05,
-    (float)6.97851e-05,
-    (float)6.07559e-05,
-    (float)6.52352e-05,
-    (float)6.22556e-05,
-    (float)6.47235e-05,
-    (float)6.0648e-05,
-    (float)6.74821e-05,
-    (float)5.7699e-05,
-    (float)6.91176e-05,
-    (float)5.64614e-05,
-    (float)6.70244e-05,
-    (float)5.71565e-05,
-    (float)6.31613e-05,
-    (float)5.73505e-05,
-    (float)6.12038e-05,
-    (float)5.5559e-05,
-    (float)6.2129e-05,
-    (float)5.32499e-05,
-    (float)6.363e-05,
-    (float)5.28049e-05,
-    (float)6.34532e-05,
-    (float)5.43665e-05,
-    (float)6.20238e-05,
-    (float)5.56885e-05,
-    (float)6.12812e-05,
-    (float)5.49936e-05,
-    (float)6.18139e-05,
-    (float)5.30454e-05,
-    (float)6.22678e-05,
-    (float)5.19352e-05,
-    (float)6.15312e-05,
-    (float)5.24304e-05,
-    (float)6.04058e-05,
-    (float)5.33479e-05,
-    (float)6.04258e-05,
-    (float)5.34427e-05,
-    (float)6.16003e-05,
-    (float)5.29888e-05,
-    (float)6.2325e-05,
-    (float)0.0665712,
-    (float)0.684312,
-    (float)0.0262789,
-    (float)0.124279,
-    (float)0.0177018,
-    (float)0.0310093,
-    (float)0.0107135,
-    (float)0.00700055,
-    (float)0.00526558,
-    (float)0.00134278,
-    (float)0.00195098,
-    (float)0.000752236,
-    (float)0.000661227,
-    (float)0.000963884,
-    (float)0.000662198,
-    (float)0.000910639,
-    (float)0.00106039,
-    (float)0.000673566,
-    (float)0.00124969,
-    (float)0.000512465,
-    (float)0.00108372,
-    (float)0.000495996,
-    (float)0.00074467,
-    (float)0.00052059,
-    (float)0.000474228,
-    (float)0.000477517,
-    (float)0.000376729,
-    (float)0.000362241,
-    (float)0.000396845,
-    (float)0.000252909,
-    (float)0.000423329,
-    (float)0.000217772,
-    (float)0.000396344,
-    (float)0.000253064,
-    (float)0.000334104,
-    (float)0.000298757,
-    (float)0.000285373,
-    (float)0.000300367,
-    (float)0.000272197,
-    (float)0.000252961,
-    (float)0.00027546,
-    (float)0.000193683,
-    (float)0.000263634,
-    (float)0.000160791,
-    (float)0.000227071,
-    (float)0.000161568,
-    (float)0.000184525,
-    (float)0.000174225,
-    (float)0.000161185,
-    (float)0.000174191,
-    (float)0.000163626,
-    (float)0.000156283,
-    (float)0.000175464,
-    (float)0.000134094,
-    (float)0.000174825,
-    (float)0.000122236,
-    (float)0.000154612,
-    (float)0.000121598,
-    (float)0.000126635,
-    (float)0.000121185,
-    (float)0.000108047,
-    (float)0.00011182,
-    (float)0.000105057,
-    (float)9.59993e-05,
-    (float)0.000109418,
-    (float)8.42136e-05,
-    (float)0.000108963,
-    (float)8.30371e-05,
-    (float)9.98756e-05,
-    (float)8.82607e-05,
-    (float)8.84936e-05,
-    (float)8.9825e-05,
-    (float)8.26038e-05,
-    (float)8.24288e-05,
-    (float)8.27889e-05,
-    (float)7.03647e-05,
-    (float)8.28449e-05,
-    (float)6.2194e-05,
-    (float)7.76031e-05,
-    (float)6.17787e-05,
-    (float)6.88232e-05,
-    (float)6.52012e-05,
-    (float)6.29118e-05,
-    (float)6.59321e-05,
-    (float)6.36324e-05,
-    (float)6.18418e-05,
-    (float)6.80722e-05,
-    (float)5.65907e-05,
-    (float)6.99386e-05,
-    (float)5.47483e-05,
-    (float)6.61512e-05,
-    (float)5.66301e-05,
-    (float)5.95966e-05,
-    (float)5.83867e-05,
-    (float)5.5578e-05,
-    (float)5.66596e-05,
-    (float)5.62474e-05,
-    (float)5.23186e-05,
-    (float)5.89304e-05,
-    (float)4.93028e-05,
-    (float)5.95959e-05,
-    (float)5.01799e-05,
-    (float)5.7256e-05,
-    (float)5.34333e-05,
-    (float)5.45664e-05,
-    (float)5.5285e-05,
-    (float)5.43942e-05,
-    (float)5.38163e-05,
-    (float)5.64698e-05,
-    (float)5.08169e-05,
-    (float)5.78282e-05,
-    (float)4.95128e-05,
-    (float)5.63352e-05,
-    (float)5.09046e-05,
-    (float)5.31877e-05,
-    (float)5.28341e-05,
-    (float)5.1564e-05,
-    (float)5.26827e-05,
-    (float)5.30126e-05,
-    (float)5.04881e-05,
-    (float)5.57096e-05,
-    (float)4.88787e-05,
-    (float)5.65517e-05,
-    (float)4.99452e-05,
-    (float)5.46722e-05,
-    (float)5.27133e-05,
-    (float)5.23611e-05,
-    (float)5.41762e-05,
-    (float)0.0507867,
-    (float)0.690681,
-    (float)0.0223464,
-    (float)0.132306,
-    (float)0.0160657,
-    (float)0.0365057,
-    (float)0.0106164,
-    (float)0.00967756,
-    (float)0.0059583,
-    (float)0.00197656,
-    (float)0.00266594,
-    (float)0.000404995,
-    (float)0.000924188,
-    (float)0.000458574,
-    (float)0.000439975,
-    (float)0.000604555,
-    (float)0.000641237,
-    (float)0.000542281,
-    (float)0.000966026,
-    (float)0.000398834,
-    (float)0.00108047,
-    (float)0.000320435,
-    (float)0.000934031,
-    (float)0.000330761,
-    (float)0.000663571,
-    (float)0.000361895,
-    (float)0.00043662,
-    (float)0.000345827,
-    (float)0.000336235,
-    (float)0.000274202,
-    (float)0.000339221,
-    (float)0.000192154,
-    (float)0.000369533,
-    (float)0.000150417,
-    (float)0.000367861,
-    (float)0.000163347,
-    (float)0.000326023,
-    (float)0.000203594,
-    (float)0.000273826,
-    (float)0.000229513,
-    (float)0.000242407,
-    (float)0.000217998,
-    (float)0.000237732,
-    (float)0.000177405,
-    (float)0.000241375,
-    (float)0.000135104,
-    (float)0.000231107,
-    (float)0.000113833,
-    (float)0.000200687,
-    (float)0.000116335,
-    (float)0.000163215,
-    (float)0.000127855,
-    (float)0.00013808,
-    (float)0.000131126,
-    (float)0.000134318,
-    (float)0.000120123,
-    (float)0.000144159,
-    (float)0.000102257,
-    (float)0.000150734,
-    (float)8.93581e-05,
-    (float)0.000142209,
-    (float)8.66901e-05,
-    (float)0.000120376,
-    (float)8.94371e-05,
-    (float)9.7439e-05,
-    (float)8.85852e-05,
-    (float)8.4958e-05,
-    (float)7.9846e-05,
-    (float)8.4837e-05,
-    (float)6.73274e-05,
-    (float)8.94539e-05,
-    (float)5.91483e-05,
-    (float)8.95703e-05,
-    (float)5.96559e-05,
-    (float)8.22932e-05,
-    (float)6.55748e-05,
-    (float)7.23019e-05,
-    (float)6.92869e-05,
-    (float)6.62486e-05,
-    (float)6.57725e-05,
-    (float)6.62395e-05,
-    (float)5.67389e-05,
-    (float)6.8387e-05,
-    (float)4.85195e-05,
-    (float)6.71602e-05,
-    (float)4.61677e-05,
-    (float)6.09134e-05,
-    (float)4.93034e-05,
-    (float)5.3351e-05,
-    (float)5.31637e-05,
-    (float)4.9867e-05,
-    (float)5.33568e-05,
-    (float)5.24567e-05,
-    (float)4.97022e-05,
-    (float)5.79242e-05,
-    (float)4.58322e-05,
-    (float)6.08242e-05,
-    (float)4.53424e-05,
-    (float)5.82576e-05,
-    (float)4.83065e-05,
-    (float)5.21847e-05,
-    (float)5.13324e-05,
-    (float)4.73797e-05,
-    (float)5.09098e-05,
-    (float)4.7096e-05,
-    (float)4.68085e-05,
-    (float)5.03977e-05,
-    (float)4.23704e-05,
-    (float)5.34055e-05,
-    (float)4.14697e-05,
-    (float)5.30917e-05,
-    (float)4.49646e-05,
-    (float)5.00276e-05,
-    (float)4.98949e-05,
-    (float)4.75931e-05,
-    (float)5.21386e-05,
-    (float)4.85163e-05,
-    (float)5.00729e-05,
-    (float)5.21027e-05,
-    (float)4.58883e-05,
-    (float)5.48242e-05,
-    (float)4.34086e-05,
-    (float)5.37202e-05,
-    (float)4.45164e-05,
-    (float)4.93498e-05,
-    (float)4.75503e-05,
-    (float)4.54278e-05,
-    (float)4.91249e-05,
-    (float)0.0377483,
-    (float)0.692647,
-    (float)0.0187959,
-    (float)0.139276,
-    (float)0.0143907,
-    (float)0.0420883,
-    (float)0.0103148,
-    (float)0.0130071,
-    (float)0.00652519,
-    (float)0.00335174,
-    (float)0.00348579,
-    (float)0.000553958,
-    (float)0.00148917,
-    (float)0.000115255,
-    (float)0.000529499,
-    (float)0.000251592,
-    (float)0.000346066,
-    (float)0.000347546,
-    (float)0.000557892,
-    (float)0.000312591,
-    (float)0.000817972,
-    (float)0.000235324,
-    (float)0.000921212,
-    (float)0.000199345,
-    (float)0.000830363,
-    (float)0.00021893,
-    (float)0.000626716,
-    (float)0.000254908,
-    (float)0.000425492,
-    (float)0.000262048,
-    (float)0.000303964,
-    (float)0.000225534,
-    (float)0.000272966,
-    (float)0.00016625,
-    (float)0.000292996,
-    (float)0.000119951,
-    (float)0.000312865,
-    (float)0.000110302,
-    (float)0.000302844,
-    (float)0.000134734,
-    (float)0.000265119,
-    (float)0.000169752,
-    (float)0.000221902,
-    (float)0.000188739,
-    (float)0.000194453,
-    (float)0.000178855,
-    (float)0.000188301,
-    (float)0.000146688,
-    (float)0.000192505,
-    (float)0.000111046,
-    (float)0.000190368,
-    (float)8.94424e-05,
-    (float)0.000172332,
-    (float)8.76336e-05,
-    (float)0.000142084,
-    (float)9.82184e-05,
-    (float)0.000112698,
-    (float)0.000107773,
-    (float)9.6669e-05,
-    (float)0.000106656,
-    (float)9.72564e-05,
-    (float)9.46926e-05,
-    (float)0.000106915,
-    (float)7.95568e-05,
-    (float)0.000113227,
-    (float)6.99622e-05,
-    (float)0.000107625,
-    (float)6.9119e-05,
-    (float)9.0677e-05,
-    (float)7.31043e-05,
-    (float)7.06508e-05,
-    (float)7.47769e-05,
-    (float)5.70236e-05,
-    (float)6.97462e-05,
-    (float)5.39612e-05,
-    (float)5.96953e-05,
-    (float)5.82973e-05,
-    (float)5.07388e-05,
-    (float)6.28627e-05,
-    (float)4.84211e-05,
-    (float)6.21163e-05,
-    (float)5.33911e-05,
-    (float)5.57546e-05,
-    (float)6.09965e-05,
-    (float)4.79781e-05,
-    (float)6.48747e-05,
-    (float)4.35471e-05,
-    (float)6.16346e-05,
-    (float)4.39794e-05,
-    (float)5.31209e-05,
-    (float)4.67257e-05,
-    (float)4.47808e-05,
-    (float)4.76149e-05,
-    (float)4.15944e-05,
-    (float)4.43783e-05,
-    (float)4.46608e-05,
-    (float)3.84563e-05,
-    (float)5.08101e-05,
-    (float)3.38102e-05,
-    (float)5.52563e-05,
-    (float)3.37899e-05,
-    (float)5.51446e-05,
-    (float)3.84981e-05,
-    (float)5.13815e-05,
-    (float)4.46126e-05,
-    (float)4.75578e-05,
-    (float)4.77527e-05,
-    (float)4.69531e-05,
-    (float)4.56169e-05,
-    (float)4.99604e-05,
-    (float)3.95948e-05,
-    (float)5.38605e-05,
-    (float)3.37089e-05,
-    (float)5.5066e-05,
-    (float)3.16994e-05,
-    (float)5.20772e-05,
-    (float)3.44052e-05,
-    (float)4.68441e-05,
-    (float)3.93457e-05,
-    (float)4.3425e-05,
-    (float)4.27438e-05,
-    (float)4.49016e-05,
-    (float)4.24051e-05,
-    (float)5.0892e-05,
-    (float)3.92475e-05,
-    (float)5.76108e-05,
-    (float)3.63534e-05,
-    (float)6.05178e-05,
-    (float)0.0273701,
-    (float)0.690925,
-    (float)0.0156834,
-    (float)0.144924,
-    (float)0.0127229,
-    (float)0.047372,
-    (float)0.00979027,
-    (float)0.0167062,
-    (float)0.0068582,
-    (float)0.00539664,
-    (float)0.00425543,
-    (float)0.00132962,
-    (float)0.00225558,
-    (float)0.000152592,
-    (float)0.000977482,
-    (float)1.71366e-05,
-    (float)0.000371047,
-    (float)0.000127803,
-    (float)0.000258435,
-    (float)0.00020093,
-    (float)0.000406925,
-    (float)0.000196886,
-    (float)0.000605155,
-    (float)0.000163672,
-    (float)0.000716871,
-    (float)0.000149402,
-    (float)0.000697959,
-    (float)0.000167917,
-    (float)0.000578311,
-    (float)0.000201854,
-    (float)0.000423112,
-    (float)0.000223708,
-    (float)0.000293166,
-    (float)0.000216597,
-    (float)0.000219856,
-    (float)0.000183348,
-    (float)0.000200661,
-    (float)0.000142027,
-    (float)0.000211061,
-    (float)0.000113543,
-    (float)0.000222773,
-    (float)0.000109707,
-    (float)0.00021824,
-    (float)0.000128039,
-    (float)0.000195706,
-    (float)0.00015485,
-    (float)0.000165085,
-    (float)0.00017365,
-    (float)0.000139076,
-    (float)0.000173786,
-    (float)0.000125158,
-    (float)0.000154958,
-    (float)0.00012233,
-    (float)0.00012598,
-    (float)0.000123276,
-    (float)9.91962e-05,
-    (float)0.000119737,
-    (float)8.39333e-05,
-    (float)0.000107603,
-    (float)8.23786e-05,
-    (float)8.89413e-05,
-    (float)8.96385e-05,
-    (float)7.01948e-05,
-    (float)9.74003e-05,
-    (float)5.80089e-05,
-    (float)9.88189e-05,
-    (float)5.52983e-05,
-    (float)9.18814e-05,
-    (float)5.97939e-05,
-    (float)7.96463e-05,
-    (float)6.5694e-05,
-    (float)6.76538e-05,
-    (float)6.72048e-05,
-    (float)6.03484e-05,
-    (float)6.17742e-05,
-    (float)5.86908e-05,
-    (float)5.11888e-05,
-    (float)6.01798e-05,
-    (float)4.01147e-05,
-    (float)6.09438e-05,
-    (float)3.31784e-05,
-    (float)5.83754e-05,
-    (float)3.24099e-05,
-    (float)5.26443e-05,
-    (float)3.64566e-05,
-    (float)4.62969e-05,
-    (float)4.17872e-05,
-    (float)4.24014e-05,
-    (float)4.49381e-05,
-    (float)4.25214e-05,
-    (float)4.43863e-05,
-    (float)4.577e-05,
-    (float)4.10459e-05,
-    (float)4.94201e-05,
-    (float)3.731e-05,
-    (float)5.05859e-05,
-    (float)3.54008e-05,
-    (float)4.79106e-05,
-    (float)3.60749e-05,
-    (float)4.22915e-05,
-    (float)3.8385e-05,
-    (float)3.62992e-05,
-    (float)4.0504e-05,
-    (float)3.26984e-05,
-    (float)4.10057e-05,
-    (float)3.29399e-05,
-    (float)3.97929e-05,
-    (float)3.64453e-05,
-    (float)3.81305e-05,
-    (float)4.10247e-05,
-    (float)3.77979e-05,
-    (float)4.41373e-05,
-    (float)3.98923e-05,
-    (float)4.42655e-05,
-    (float)4.40165e-05,
-    (float)4.16433e-05,
-    (float)4.83621e-05,
-    (float)3.79685e-05,
-    (float)5.06772e-05,
-    (float)3.53125e-05,
-    (float)4.95772e-05,
-    (float)3.48932e-05,
-    (float)4.54327e-05,
-    (float)3.64348e-05,
-    (float)4.02845e-05,
-    (float)3.84733e-05,
-    (float)3.67922e-05,
-    (float)3.93844e-05,
-    (float)0.0193752,
-    (float)0.685503,
-    (float)0.0129834,
-    (float)0.149198,
-    (float)0.0111112,
-    (float)0.0521686,
-    (float)0.00910513,
-    (float)0.020534,
-    (float)0.0069613,
-    (float)0.00794332,
-    (float)0.00488859,
-    (float)0.0027208,
-    (float)0.00309158,
-    (float)0.000707965,
-    (float)0.00171041,
-    (float)9.73539e-05,
-    (float)0.000797129,
-    (float)2.9264e-05,
-    (float)0.000317149,
-    (float)0.000102989,
-    (float)0.000170772,
-    (float)0.000161631,
-    (float)0.000226926,
-    (float)0.000174075,
-    (float)0.000358728,
-    (float)0.000161514,
-    (float)0.000471099,
-    (float)0.000152861,
-    (float)0.000514187,
-    (float)0.000163089,
-    (float)0.000481514,
-    (float)0.000189187,
-    (float)0.000396655,
-    (float)0.000216954,
-    (float)0.00029506,
-    (float)0.000231379,
-    (float)0.000207816,
-    (float)0.000224782,
-    (float)0.000151952,
-    (float)0.000199683,
-    (float)0.000128613,
-    (float)0.000166388,
-    (float)0.000127475,
-    (float)0.000137479,
-    (float)0.000134055,
-    (float)0.00012216,
-    (float)0.000136472,
-    (float)0.000122854,
-    (float)0.000129297,
-    (float)0.000135068,
-    (float)0.000113817,
-    (float)0.000150089,
-    (float)9.5509e-05,
-    (float)0.000159005,
-    (float)8.04022e-05,
-    (float)0.000156298,
-    (float)7.20538e-05,
-    (float)0.000141634,
-    (float)7.02761e-05,
-    (float)0.00011937,
-    (float)7.18346e-05,
-    (float)9.62575e-05,
-    (float)7.2469e-05,
-    (float)7.84604e-05,
-    (float)6.91221e-05,
-    (float)6.91938e-05,
-    (float)6.13145e-05,
-    (float)6.78714e-05,
-    (float)5.11239e-05,
-    (float)7.09365e-05,
-    (float)4.19302e-05,
-    (float)7.38127e-05,
-    (float)3.66468e-05,
-    (float)7.29973e-05,
-    (float)3.63346e-05,
-    (float)6.73733e-05,
-    (float)3.98218e-05,
-    (float)5.82814e-05,
-    (float)4.44167e-05,
-    (float)4.85057e-05,
-    (float)4.72698e-05,
-    (float)4.0794e-05,
-    (float)4.66821e-05,
-    (float)3.66481e-05,
-    (float)4.27558e-05,
-    (float)3.58855e-05,
-    (float)3.71608e-05,
-    (float)3.70366e-05,
-    (float)3.22267e-05,
-    (float)3.825e-05,
-    (float)2.98494e-05,
-    (float)3.82036e-05,
-    (float)3.07195e-05,
-    (float)3.66025e-05,
-    (float)3.41661e-05,
-    (float)3.41102e-05,
-    (float)3.85927e-05,
-    (float)3.18461e-05,
-    (float)4.2236e-05,
-    (float)3.07536e-05,
-    (float)4.38814e-05,
-    (float)3.11503e-05,
-    (float)4.3252e-05,
-    (float)3.26357e-05,
-    (float)4.09678e-05,
-    (float)3.4346e-05,
-    (float)3.81652e-05,
-    (float)3.53941e-05,
-    (float)3.59826e-05,
-    (float)3.52787e-05,
-    (float)3.51336e-05,
-    (float)3.40878e-05,
-    (float)3.57174e-05,
-    (float)3.24313e-05,
-    (float)3.72949e-05,
-    (float)3.11536e-05,
-    (float)3.91573e-05,
-    (float)3.09623e-05,
-    (float)4.06499e-05,
-    (float)3.21276e-05,
-    (float)4.1417e-05,
-    (float)3.43674e-05,
-    (float)4.14845e-05,
-    (float)3.6954e-05,
-    (float)4.11693e-05,
-    (float)3.89932e-05,
-    (float)4.08758e-05,
-    (float)3.97645e-05,
-    (float)0.0135623,
-    (float)0.67665,
-    (float)0.0107094,
-    (float)0.151989,
-    (float)0.00960823,
-    (float)0.0562306,
-    (float)0.00830982,
-    (float)0.0241906,
-    (float)0.00683406,
-    (float)0.0107322,
-    (float)0.00530135,
-    (float)0.00458535,
-    (float)0.00384097,
-    (float)0.00178573,
-    (float)0.00256285,
-    (float)0.000612357,
-    (float)0.00154156,
-    (float)0.000215418,
-    (float)0.000808728,
-    (float)0.000150986,
-    (float)0.000353873,
-    (float)0.000191945,
-    (float)0.000132492,
-    (float)0.000235826,
-    (float)7.93529e-05,
-    (float)0.000251165,
-    (float)0.000123616,
-    (float)0.000242297,
-    (float)0.0002024,
-    (float)0.000225843,
-    (float)0.000270108,
-    (float)0.000216495,
-    (float)0.000302201,
-    (float)0.000220588,
-    (float)0.000293634,
-    (float)0.000235624,
-    (float)0.000253435,
-    (float)0.000253454,
-    (float)0.000197583,
-    (float)0.000264773,
-    (float)0.00014231,
-    (float)0.000262997,
-    (float)9.93456e-05,
-    (float)0.00024637,
-    (float)7.38069e-05,
-    (float)0.000218005,
-    (float)6.45605e-05,
-    (float)0.000184276,
-    (float)6.62904e-05,
-    (float)0.000152394,
-    (float)7.225e-05,
-    (float)0.000128065,
-    (float)7.67356e-05,
-    (float)0.000113956,
-    (float)7.66221e-05,
-    (float)0.000109297,
-    (float)7.1711e-05,
-    (float)0.000110613,
-    (float)6.40362e-05,
-    (float)0.000113191,
-    (float)5.65567e-05,
-    (float)0.000112741,
-    (float)5.17829e-05,
-    (float)0.00010672,
-    (float)5.08182e-05,
-    (float)9.49213e-05,
-    (float)5.30889e-05,
-    (float)7.92238e-05,
-    (float)5.67625e-05,
-    (float)6.26908e-05,
-    (float)5.96086e-05,
-    (float)4.83862e-05,
-    (float)5.99212e-05,
-    (float)3.83508e-05,
-    (float)5.71425e-05,
-    (float)3.30723e-05,
-    (float)5.19778e-05,
-    (float)3.157e-05,
-    (float)4.60087e-05,
-    (float)3.19806e-05,
-    (float)4.10063e-05,
-    (float)3.23656e-05,
-    (float)3.82382e-05,
-    (float)3.14148e-05,
-    (float)3.80389e-05,
-    (float)2.88062e-05,
-    (float)3.97774e-05,
-    (float)2.51421e-05,
-    (float)4.21908e-05,
-    (float)2.15531e-05,
-    (float)4.39168e-05,
-    (float)1.91701e-05,
-    (float)4.40015e-05,
-    (float)1.86826e-05,
-    (float)4.21981e-05,
-    (float)2.01331e-05,
-    (float)3.89731e-05,
-    (float)2.29871e-05,
-    (float)3.52545e-05,
-    (float)2.64052e-05,
-    (float)3.20477e-05,
-    (float)2.95826e-05,
-    (float)3.00743e-05,
-    (float)3.20171e-05,
-    (float)2.95601e-05,
-    (float)3.36151e-05,
-    (float)3.02257e-05,
-    (float)3.46242e-05,
-    (float)3.14553e-05,
-    (float)3.5447e-05,
-    (float)3.25546e-05,
-    (float)3.64309e-05,
-    (float)3.29945e-05,
-    (float)3.77243e-05,
-    (float)3.25536e-05,
-    (float)3.92462e-05,
-    (float)3.13283e-05,
-    (float)4.07652e-05,
-    (float)2.96326e-05,
-    (float)4.20337e-05,
-    (float)2.78501e-05,
-    (float)4.29055e-05,
-    (float)2.63063e-05,
-    (float)4.33831e-05,
-    (float)2.52064e-05,
-    (float)4.358e-05,
-    (float)2.4643e-05,
-    (float)4.36269e-05,
-    (float)0.00961365,
-    (float)0.665349,
-    (float)0.0087646,
-    (float)0.153408,
-    (float)0.0081661,
-    (float)0.0594234,
-    (float)0.00737619,
-    (float)0.0274178,
-    (float)0.00642735,
-    (float)0.0134681,
-    (float)0.00538289,
-    (float)0.0066702,
-    (float)0.00431302,
-    (float)0.00323093,
-    (float)0.00328532,
-    (float)0.00152158,
-    (float)0.00235753,
-    (float)0.000734822,
-    (float)0.00157215,
-    (float)0.000431152,
-    (float)0.000953179,
-    (float)0.000359962,
-    (float)0.000505507,
-    (float)0.000379025,
-    (float)0.000216847,
-    (float)0.00041298,
-    (float)6.17645e-05,
-    (float)0.00042864,
-    (float)7.03116e-06,
-    (float)0.000418369,
-    (float)1.73025e-05,
-    (float)0.000388132,
-    (float)6.01688e-05,
-    (float)0.000348948,
-    (float)0.000109841,
-    (float)0.000311267,
-    (float)0.000149084,
-    (float)0.000281904,
-    (float)0.00016939,
-    (float)0.000263092,
-    (float)0.000169703,
-    (float)0.00025308,
-    (float)0.000154226,
-    (float)0.000247611,
-    (float)0.000129876,
-    (float)0.000241695,
-    (float)0.000103947,
-    (float)0.00023116,
-    (float)8.23169e-05,
-    (float)0.000213681,
-    (float)6.844e-05,
-    (float)0.000189162,
-    (float)6.31009e-05,
-    (float)0.000159499,
-    (float)6.48267e-05,
-    (float)0.000127897,
-    (float)7.0722e-05,
-    (float)9.7955e-05,
-    (float)7.74665e-05,
-    (float)7.27718e-05,
-    (float)8.22234e-05,
-    (float)5.42753e-05,
-    (float)8.32674e-05,
-    (float)4.29076e-05,
-    (float)8.02265e-05,
-    (float)3.77046e-05,
-    (float)7.39355e-05,
-    (float)3.67118e-05,
-    (float)6.59932e-05,
-    (float)3.75952e-05,
-    (float)5.81798e-05,
-    (float)3.82736e-05,
-    (float)5.19084e-05,
-    (float)3.74034e-05,
-    (float)4.78609e-05,
-    (float)3.46027e-05,
-    (float)4.58883e-05,
-    (float)3.03819e-05,
-    (float)4.51736e-05,
-    (float)2.58335e-05,
-    (float)4.45794e-05,
-    (float)2.21957e-05,
-    (float)4.30561e-05,
-    (float)2.04297e-05,
-    (float)3.99807e-05,
-    (float)2.09299e-05,
-    (float)3.53321e-05,
-    (float)2.34384e-05,
-    (float)2.96659e-05,
-    (float)2.71635e-05,
-    (float)2.39156e-05,
-    (float)3.10469e-05,
-    (float)1.90967e-05,
-    (float)3.40847e-05,
-    (float)1.60086e-05,
-    (float)3.56041e-05,
-    (float)1.50235e-05,
-    (float)3.54199e-05,
-    (float)1.60142e-05,
-    (float)3.38375e-05,
-    (float)1.84307e-05,
-    (float)3.15162e-05,
-    (float)2.14909e-05,
-    (float)2.92436e-05,
-    (float)2.44212e-05,
-    (float)2.76941e-05,
-    (float)2.66737e-05,
-    (float)2.72398e-05,
-    (float)2.80588e-05,
-    (float)2.78675e-05,
-    (float)2.87585e-05,
-    (float)2.92167e-05,
-    (float)2.92222e-05,
-    (float)3.07212e-05,
-    (float)2.9984e-05,
-    (float)3.18063e-05,
-    (float)3.14576e-05,
-    (float)3.2078e-05,
-    (float)3.37772e-05,
-    (float)3.14454e-05,
-    (float)3.67329e-05,
-    (float)3.01395e-05,
-    (float)3.98205e-05,
-    (float)2.86247e-05,
-    (float)4.23916e-05,
-    (float)2.74344e-05,
-    (float)4.38532e-05,
-    (float)2.69853e-05,
-    (float)0.0073562,
-    (float)0.650811,
-    (float)0.00719184,
-    (float)0.153286,
-    (float)0.00687172,
-    (float)0.061607,
-    (float)0.00641252,
-    (float)0.0300267,
-    (float)0.00583796,
-    (float)0.015921,
-    (float)0.00517734,
-    (float)0.0087436,
-    (float)0.00446359,
-    (float)0.00485368,
-    (float)0.00373106,
-    (float)0.0027064,
-    (float)0.00301315,
-    (float)0.00154426,
-    (float)0.00233998,
-    (float)0.000954005,
-    (float)0.00173636,
-    (float)0.00069232,
-    (float)0.00122027,
-    (float)0.000609103,
-    (float)0.000802027,
-    (float)0.000610328,
-    (float)0.000484132,
-    (float)0.00063833,
-    (float)0.000261938,
-    (float)0.000660184,
-    (float)0.000124902,
-    (float)0.000660059,
-    (float)5.82894e-05,
-    (float)0.000633676,
-    (float)4.50853e-05,
-    (float)0.000584026,
-    (float)6.78718e-05,
-    (float)0.000518024,
-    (float)0.000110467,
-    (float)0.000443947,
-    (float)0.000159173,
-    (float)0.00036961,
-    (float)0.000203554,
-    (float)0.000301209,
-    (float)0.000236738,
-    (float)0.000242765,
-    (float)0.000255285,
-    (float)0.000196046,
-    (float)0.00025872,
-    (float)0.000160846,
-    (float)0.000248838,
-    (float)0.000135505,
-    (float)0.0002289,
-    (float)0.000117512,
-    (float)0.000202828,
-    (float)0.000104119,
-    (float)0.000174494,
-    (float)9.28584e-05,
-    (float)0.000147157,
-    (float)8.19134e-05,
-    (float)0.000123115,
-    (float)7.0307e-05,
-    (float)0.00010356,
-    (float)5.79102e-05,
-    (float)8.86378e-05,
-    (float)4.52912e-05,
-    (float)7.76688e-05,
-    (float)3.34538e-05,
-    (float)6.94705e-05,
-    (float)2.35225e-05,
-    (float)6.27126e-05,
-    (float)1.64422e-05,
-    (float)5.62383e-05,
-    (float)1.27467e-05,
-    (float)4.92945e-05,
-    (float)1.24369e-05,
-    (float)4.16405e-05,
-    (float)1.49835e-05,
-    (float)3.35271e-05,
-    (float)1.9443e-05,
-    (float)2.55672e-05,
-    (float)2.46542e-05,
-    (float)1.85391e-05,
-    (float)2.94681e-05,
-    (float)1.31709e-05,
-    (float)3.29614e-05,
-    (float)9.95664e-06,
-    (float)3.45903e-05,
-    (float)9.0399e-06,
-    (float)3.42587e-05,
-    (float)1.01849e-05,
-    (float)3.2294e-05,
-    (float)1.28335e-05,
-    (float)2.9341e-05,
-    (float)1.62292e-05,
-    (float)2.62028e-05,
-    (float)1.95777e-05,
-    (float)2.3662e-05,
-    (float)2.2208e-05,
-    (float)2.23184e-05,
-    (float)2.37019e-05,
-    (float)2.24736e-05,
-    (float)2.39668e-05,
-    (float)2.40808e-05,
-    (float)2.32406e-05,
-    (float)2.67663e-05,
-    (float)2.20286e-05,
-    (float)2.99165e-05,
-    (float)2.09874e-05,
-    (float)3.28101e-05,
-    (float)2.07782e-05,
-    (float)3.47708e-05,
-    (float)2.19187e-05,
-    (float)3.53095e-05,
-    (float)2.4662e-05,
-    (float)3.42284e-05,
-    (float)2.89282e-05,
-    (float)3.16652e-05,
-    (float)3.43017e-05,
-    (float)2.807e-05,
-    (float)4.00973e-05,
-    (float)2.41161e-05,
-    (float)4.54823e-05,
-    (float)2.05648e-05,
-    (float)4.96326e-05,
-    (float)1.81095e-05,
-    (float)5.18901e-05,
-    (float)1.72334e-05,
-    (float)0.00651207,
-    (float)0.631272,
-    (float)0.00591943,
-    (float)0.151072,
-    (float)0.00569972,
-    (float)0.0623945,
-    (float)0.00542723,
-    (float)0.0316394,
-    (float)0.0050887,
-    (float)0.0176963,
-    (float)0.00469165,
-    (float)0.0104095,
-    (float)0.00424866,
-    (float)0.00628784,
-    (float)0.0037746,
-    (float)0.00386167,
-    (float)0.00328535,
-    (float)0.00241887,
-    (float)0.00279698,
-    (float)0.00157557,
-    (float)0.0023249,
-    (float)0.00110685,
-    (float)0.00188308,
-    (float)0.000872024,
-    (float)0.00148341,
-    (float)0.000778808,
-    (float)0.00113513,
-    (float)0.000764872,
-    (float)0.000844525,
-    (float)0.000787762,
-    (float)0.000614684,
-    (float)0.000819009,
-    (float)0.000445582,
-    (float)0.000840448,
-    (float)0.000334283,
-    (float)0.00084169,
-    (float)0.000275332,
-    (float)0.000818256,
-    (float)0.000261272,
-    (float)0.000770067,
-    (float)0.000283238,
-    (float)0.000700186,
-    (float)0.000331588,
-    (float)0.000613729,
-    (float)0.000396523,
-    (float)0.000516933,
-    (float)0.000468658,
-    (float)0.000416369,
-    (float)0.000539513,
-    (float)0.000318306,
-    (float)0.000601909,
-    (float)0.000228219,
-    (float)0.000650237,
-    (float)0.000150443,
-    (float)0.000680628,
-    (float)8.79644e-05,
-    (float)0.000690992,
-    (float)4.23417e-05,
-    (float)0.000680952,
-    (float)1.37443e-05,
-    (float)0.000651675,
-    (float)1.08756e-06,
-    (float)0.000605628,
-    (float)2.2507e-06,
-    (float)0.000546265,
-    (float)1.43507e-05,
-    (float)0.000477676,
-    (float)3.40493e-05,
-    (float)0.000404227,
-    (float)5.78668e-05,
-    (float)0.000330212,
-    (float)8.24767e-05,
-    (float)0.000259545,
-    (float)0.000104959,
-    (float)0.000195508,
-    (float)0.000122994,
-    (float)0.000140579,
-    (float)0.000134988,
-    (float)9.63359e-05,
-    (float)0.000140118,
-    (float)6.34458e-05,
-    (float)0.000138313,
-    (float)4.17253e-05,
-    (float)0.000130168,
-    (float)3.02609e-05,
-    (float)0.000116812,
-    (float)2.75709e-05,
-    (float)9.97484e-05,
-    (float)3.17917e-05,
-    (float)8.06816e-05,
-    (float)4.08669e-05,
-    (float)6.13497e-05,
-    (float)5.2726e-05,
-    (float)4.33751e-05,
-    (float)6.54394e-05,
-    (float)2.81437e-05,
-    (float)7.73399e-05,
-    (float)1.67179e-05,
-    (float)8.71081e-05,
-    (float)9.78724e-06,
-    (float)9.38187e-05,
-    (float)7.65354e-06,
-    (float)9.69518e-05,
-    (float)1.02486e-05,
-    (float)9.63714e-05,
-    (float)1.71778e-05,
-    (float)9.22786e-05,
-    (float)2.77833e-05,
-    (float)8.51463e-05,
-    (float)4.12185e-05,
-    (float)7.56435e-05,
-    (float)5.65264e-05,
-    (float)6.45566e-05,
-    (float)7.27149e-05,
-    (float)5.27153e-05,
-    (float)8.88219e-05,
-    (float)4.09296e-05,
-    (float)0.000103967,
-    (float)2.99393e-05,
-    (float)0.000117388,
-    (float)2.03809e-05,
-    (float)0.000128459,
-    (float)1.27676e-05,
-    (float)0.000136701,
-    (float)7.48237e-06,
-    (float)0.000141778,
-    (float)4.77734e-06,
-    (float)0.000143492,
-};
-HarmData sweep3_coeff = { harm_data, 120, 128 };
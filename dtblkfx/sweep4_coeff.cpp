@@ -1,15366 +0,0 @@
-#include <StdAfx.h>
-/*file generated by write_harm_data.m*/
-#include "HarmData.h"
-static float harm_data[120*128]={
-    (float)0.0152767,
-    (float)0.0152674,
-    (float)0.0152521,
-    (float)0.0152306,
-    (float)0.0152031,
-    (float)0.0151696,
-    (float)0.0151301,
-    (float)0.0150848,
-    (float)0.0150337,
-    (float)0.0149769,
-    (float)0.0149145,
-    (float)0.0148466,
-    (float)0.0147734,
-    (float)0.0146949,
-    (float)0.0146114,
-    (float)0.0145229,
-    (float)0.0144295,
-    (float)0.0143316,
-    (float)0.0142291,
-    (float)0.0141222,
-    (float)0.0140112,
-    (float)0.0138961,
-    (float)0.0137771,
-    (float)0.0136545,
-    (float)0.0135283,
-    (float)0.0133987,
-    (float)0.0132659,
-    (float)0.01313,
-    (float)0.0129913,
-    (float)0.0128497,
-    (float)0.0127056,
-    (float)0.0125591,
-    (float)0.0124102,
-    (float)0.0122592,
-    (float)0.0121061,
-    (float)0.0119512,
-    (float)0.0117945,
-    (float)0.0116362,
-    (float)0.0114764,
-    (float)0.0113153,
-    (float)0.0111529,
-    (float)0.0109893,
-    (float)0.0108248,
-    (float)0.0106593,
-    (float)0.010493,
-    (float)0.010326,
-    (float)0.0101584,
-    (float)0.00999032,
-    (float)0.00982185,
-    (float)0.00965308,
-    (float)0.00948412,
-    (float)0.00931505,
-    (float)0.00914599,
-    (float)0.00897701,
-    (float)0.00880822,
-    (float)0.00863972,
-    (float)0.00847159,
-    (float)0.00830393,
-    (float)0.00813683,
-    (float)0.0079704,
-    (float)0.00780471,
-    (float)0.00763987,
-    (float)0.00747597,
-    (float)0.0073131,
-    (float)0.00715136,
-    (float)0.00699083,
-    (float)0.0068316,
-    (float)0.00667377,
-    (float)0.00651742,
-    (float)0.00636264,
-    (float)0.00620952,
-    (float)0.00605813,
-    (float)0.00590856,
-    (float)0.0057609,
-    (float)0.0056152,
-    (float)0.00547156,
-    (float)0.00533003,
-    (float)0.0051907,
-    (float)0.00505362,
-    (float)0.00491885,
-    (float)0.00478646,
-    (float)0.0046565,
-    (float)0.00452901,
-    (float)0.00440406,
-    (float)0.00428168,
-    (float)0.00416191,
-    (float)0.0040448,
-    (float)0.00393037,
-    (float)0.00381866,
-    (float)0.00370969,
-    (float)0.0036035,
-    (float)0.00350009,
-    (float)0.00339949,
-    (float)0.00330171,
-    (float)0.00320677,
-    (float)0.00311468,
-    (float)0.00302544,
-    (float)0.00293906,
-    (float)0.00285556,
-    (float)0.00277492,
-    (float)0.00269715,
-    (float)0.00262225,
-    (float)0.00255022,
-    (float)0.00248106,
-    (float)0.00241476,
-    (float)0.00235132,
-    (float)0.00229075,
-    (float)0.00223303,
-    (float)0.00217815,
-    (float)0.00212612,
-    (float)0.00207694,
-    (float)0.00203058,
-    (float)0.00198706,
-    (float)0.00194637,
-    (float)0.0019085,
-    (float)0.00187345,
-    (float)0.00184122,
-    (float)0.0018118,
-    (float)0.00178519,
-    (float)0.00176139,
-    (float)0.00174039,
-    (float)0.0017222,
-    (float)0.00170681,
-    (float)0.00169422,
-    (float)0.00168442,
-    (float)0.00167743,
-    (float)0.00167323,
-    (float)0.00167184,
-    (float)0.0989146,
-    (float)0.0602683,
-    (float)0.0530347,
-    (float)0.0537147,
-    (float)0.0506683,
-    (float)0.048556,
-    (float)0.0469775,
-    (float)0.0443609,
-    (float)0.0421245,
-    (float)0.0396962,
-    (float)0.0369992,
-    (float)0.0345239,
-    (float)0.0318291,
-    (float)0.0291914,
-    (float)0.026717,
-    (float)0.0241444,
-    (float)0.0217693,
-    (float)0.0195452,
-    (float)0.0173478,
-    (float)0.0153899,
-    (float)0.0135846,
-    (float)0.0118877,
-    (float)0.0104172,
-    (float)0.00909519,
-    (float)0.00791258,
-    (float)0.00691652,
-    (float)0.00605037,
-    (float)0.00531561,
-    (float)0.00471845,
-    (float)0.00421989,
-    (float)0.00382368,
-    (float)0.00351732,
-    (float)0.00327312,
-    (float)0.00309659,
-    (float)0.00296933,
-    (float)0.00287112,
-    (float)0.00281005,
-    (float)0.00276784,
-    (float)0.00273068,
-    (float)0.00270864,
-    (float)0.00268604,
-    (float)0.0026556,
-    (float)0.00262725,
-    (float)0.00258902,
-    (float)0.00253973,
-    (float)0.00248703,
-    (float)0.00242295,
-    (float)0.00235096,
-    (float)0.00227523,
-    (float)0.00219135,
-    (float)0.0021054,
-    (float)0.00201798,
-    (float)0.0019273,
-    (float)0.00184005,
-    (float)0.00175401,
-    (float)0.00166891,
-    (float)0.00159054,
-    (float)0.00151505,
-    (float)0.00144277,
-    (float)0.00137791,
-    (float)0.00131611,
-    (float)0.00125792,
-    (float)0.00120581,
-    (float)0.0011559,
-    (float)0.00110897,
-    (float)0.00106601,
-    (float)0.00102422,
-    (float)0.000984756,
-    (float)0.00094758,
-    (float)0.000911171,
-    (float)0.000877085,
-    (float)0.000844647,
-    (float)0.00081343,
-    (float)0.000785229,
-    (float)0.000758971,
-    (float)0.000734885,
-    (float)0.000714674,
-    (float)0.000697002,
-    (float)0.000682265,
-    (float)0.000671749,
-    (float)0.000663925,
-    (float)0.000659059,
-    (float)0.000657797,
-    (float)0.000658556,
-    (float)0.000661422,
-    (float)0.000666382,
-    (float)0.000672003,
-    (float)0.000678347,
-    (float)0.000684901,
-    (float)0.000690617,
-    (float)0.000695738,
-    (float)0.000699501,
-    (float)0.000701418,
-    (float)0.000702018,
-    (float)0.000700539,
-    (float)0.000697081,
-    (float)0.000692405,
-    (float)0.000685922,
-    (float)0.000678177,
-    (float)0.000670003,
-    (float)0.000661033,
-    (float)0.000652025,
-    (float)0.000643669,
-    (float)0.00063579,
-    (float)0.000629111,
-    (float)0.000624027,
-    (float)0.000620457,
-    (float)0.000618928,
-    (float)0.000619471,
-    (float)0.00062201,
-    (float)0.000626809,
-    (float)0.00063356,
-    (float)0.000642147,
-    (float)0.000652578,
-    (float)0.000664308,
-    (float)0.000677176,
-    (float)0.000690989,
-    (float)0.000705108,
-    (float)0.000719356,
-    (float)0.000733418,
-    (float)0.000746706,
-    (float)0.000759073,
-    (float)0.000770165,
-    (float)0.000779585,
-    (float)0.000787232,
-    (float)0.000792827,
-    (float)0.000796226,
-    (float)0.000797393,
-    (float)0.190873,
-    (float)0.0976037,
-    (float)0.079995,
-    (float)0.0787289,
-    (float)0.0694974,
-    (float)0.0620085,
-    (float)0.055709,
-    (float)0.0477652,
-    (float)0.0409255,
-    (float)0.0344583,
-    (float)0.0282415,
-    (float)0.0231371,
-    (float)0.0185687,
-    (float)0.0147577,
-    (float)0.011876,
-    (float)0.00949695,
-    (float)0.00772621,
-    (float)0.00653891,
-    (float)0.00562676,
-    (float)0.00500579,
-    (float)0.00465357,
-    (float)0.00437267,
-    (float)0.00417356,
-    (float)0.00407097,
-    (float)0.00395962,
-    (float)0.00386508,
-    (float)0.00381056,
-    (float)0.00374066,
-    (float)0.00368262,
-    (float)0.00363959,
-    (float)0.0035737,
-    (float)0.00350758,
-    (float)0.00342268,
-    (float)0.00329279,
-    (float)0.00314382,
-    (float)0.00295204,
-    (float)0.0027101,
-    (float)0.00245211,
-    (float)0.00216324,
-    (float)0.00185412,
-    (float)0.00155946,
-    (float)0.00127407,
-    (float)0.0010131,
-    (float)0.000799019,
-    (float)0.000628194,
-    (float)0.000505875,
-    (float)0.000437305,
-    (float)0.000413149,
-    (float)0.000426165,
-    (float)0.000470495,
-    (float)0.000531604,
-    (float)0.000598776,
-    (float)0.000665892,
-    (float)0.000719555,
-    (float)0.000755994,
-    (float)0.000775802,
-    (float)0.000771804,
-    (float)0.000749745,
-    (float)0.000716183,
-    (float)0.000669399,
-    (float)0.000618964,
-    (float)0.00057186,
-    (float)0.000527141,
-    (float)0.000491293,
-    (float)0.00046731,
-    (float)0.000451947,
-    (float)0.000446799,
-    (float)0.000451048,
-    (float)0.000460034,
-    (float)0.000473728,
-    (float)0.000490252,
-    (float)0.000506041,
-    (float)0.000522649,
-    (float)0.000538712,
-    (float)0.000552221,
-    (float)0.000566292,
-    (float)0.000579304,
-    (float)0.000589258,
-    (float)0.000599129,
-    (float)0.000606138,
-    (float)0.00060769,
-    (float)0.000606204,
-    (float)0.000598689,
-    (float)0.000583545,
-    (float)0.000563652,
-    (float)0.000537609,
-    (float)0.000506328,
-    (float)0.000473502,
-    (float)0.000439421,
-    (float)0.000406653,
-    (float)0.00037835,
-    (float)0.000354533,
-    (float)0.00033707,
-    (float)0.000327037,
-    (float)0.000322462,
-    (float)0.000323373,
-    (float)0.000329012,
-    (float)0.000335861,
-    (float)0.000343247,
-    (float)0.000350352,
-    (float)0.000354046,
-    (float)0.000354726,
-    (float)0.000352824,
-    (float)0.000346878,
-    (float)0.000338721,
-    (float)0.000329666,
-    (float)0.000319484,
-    (float)0.000310325,
-    (float)0.000303074,
-    (float)0.000297405,
-    (float)0.000294723,
-    (float)0.000294651,
-    (float)0.000296063,
-    (float)0.000299639,
-    (float)0.00030404,
-    (float)0.000307741,
-    (float)0.00031148,
-    (float)0.00031389,
-    (float)0.000313863,
-    (float)0.000312807,
-    (float)0.000309968,
-    (float)0.000305052,
-    (float)0.000299996,
-    (float)0.000294555,
-    (float)0.000288963,
-    (float)0.000285001,
-    (float)0.000282308,
-    (float)0.000281059,
-    (float)0.276931,
-    (float)0.124248,
-    (float)0.0941879,
-    (float)0.0881351,
-    (float)0.0712074,
-    (float)0.0572907,
-    (float)0.0463942,
-    (float)0.0350406,
-    (float)0.0264,
-    (float)0.0198102,
-    (float)0.0145627,
-    (float)0.0111435,
-    (float)0.00880213,
-    (float)0.00711882,
-    (float)0.00616547,
-    (float)0.00555463,
-    (float)0.00510325,
-    (float)0.00500078,
-    (float)0.0051177,
-    (float)0.00529458,
-    (float)0.00565306,
-    (float)0.00605607,
-    (float)0.00626664,
-    (float)0.00633915,
-    (float)0.00616822,
-    (float)0.00565115,
-    (float)0.00492705,
-    (float)0.00402992,
-    (float)0.00304679,
-    (float)0.00213908,
-    (float)0.00136868,
-    (float)0.000805994,
-    (float)0.000482648,
-    (float)0.000364036,
-    (float)0.000400987,
-    (float)0.000536256,
-    (float)0.000697551,
-    (float)0.000821766,
-    (float)0.000895681,
-    (float)0.000901974,
-    (float)0.000839049,
-    (float)0.000748059,
-    (float)0.000646627,
-    (float)0.000548743,
-    (float)0.000480306,
-    (float)0.000442256,
-    (float)0.000425445,
-    (float)0.000428077,
-    (float)0.000440655,
-    (float)0.000452642,
-    (float)0.000466125,
-    (float)0.000481034,
-    (float)0.000497571,
-    (float)0.000523451,
-    (float)0.000556632,
-    (float)0.000590709,
-    (float)0.000625662,
-    (float)0.000650353,
-    (float)0.000653087,
-    (float)0.000636923,
-    (float)0.000598819,
-    (float)0.000539736,
-    (float)0.000475224,
-    (float)0.000413744,
-    (float)0.000362086,
-    (float)0.000330739,
-    (float)0.000320595,
-    (float)0.000326298,
-    (float)0.000343016,
-    (float)0.000361785,
-    (float)0.00037333,
-    (float)0.000374575,
-    (float)0.000363287,
-    (float)0.000341507,
-    (float)0.000316739,
-    (float)0.000293299,
-    (float)0.00027564,
-    (float)0.000268611,
-    (float)0.00027015,
-    (float)0.000275947,
-    (float)0.000284093,
-    (float)0.000289396,
-    (float)0.000287288,
-    (float)0.000279528,
-    (float)0.000267361,
-    (float)0.000252446,
-    (float)0.000239902,
-    (float)0.000232307,
-    (float)0.000229977,
-    (float)0.000233067,
-    (float)0.000239036,
-    (float)0.000244583,
-    (float)0.000247862,
-    (float)0.00024646,
-    (float)0.000240139,
-    (float)0.000231378,
-    (float)0.000221306,
-    (float)0.000212082,
-    (float)0.000206943,
-    (float)0.000205695,
-    (float)0.000207151,
-    (float)0.000211192,
-    (float)0.000215333,
-    (float)0.00021679,
-    (float)0.00021556,
-    (float)0.000211359,
-    (float)0.000204355,
-    (float)0.000196848,
-    (float)0.000190517,
-    (float)0.000186695,
-    (float)0.000186597,
-    (float)0.00018976,
-    (float)0.000195359,
-    (float)0.000202412,
-    (float)0.0002085,
-    (float)0.000212343,
-    (float)0.000214036,
-    (float)0.000212589,
-    (float)0.00020857,
-    (float)0.000204225,
-    (float)0.000200054,
-    (float)0.00019674,
-    (float)0.000195855,
-    (float)0.000196966,
-    (float)0.000199013,
-    (float)0.000201722,
-    (float)0.000203923,
-    (float)0.000204639,
-    (float)0.354084,
-    (float)0.139831,
-    (float)0.0964556,
-    (float)0.0846832,
-    (float)0.0618249,
-    (float)0.0442277,
-    (float)0.0326283,
-    (float)0.0225157,
-    (float)0.0158535,
-    (float)0.0117515,
-    (float)0.00868112,
-    (float)0.0068184,
-    (float)0.00598277,
-    (float)0.0058271,
-    (float)0.0065213,
-    (float)0.00796558,
-    (float)0.00938991,
-    (float)0.0104382,
-    (float)0.0108958,
-    (float)0.010158,
-    (float)0.00852199,
-    (float)0.00644537,
-    (float)0.00414901,
-    (float)0.00223984,
-    (float)0.000993605,
-    (float)0.000401799,
-    (float)0.000356823,
-    (float)0.000616144,
-    (float)0.000920582,
-    (float)0.0010865,
-    (float)0.00108571,
-    (float)0.000940185,
-    (float)0.000735882,
-    (float)0.000572627,
-    (float)0.000476839,
-    (float)0.000444138,
-    (float)0.000456503,
-    (float)0.000471988,
-    (float)0.000465252,
-    (float)0.000458065,
-    (float)0.000468226,
-    (float)0.000500049,
-    (float)0.000564442,
-    (float)0.000648048,
-    (float)0.000705869,
-    (float)0.00071797,
-    (float)0.000680468,
-    (float)0.00059241,
-    (float)0.000487284,
-    (float)0.000400625,
-    (float)0.000349554,
-    (float)0.000342254,
-    (float)0.000368019,
-    (float)0.000398728,
-    (float)0.000414073,
-    (float)0.000405749,
-    (float)0.000370985,
-    (float)0.000326601,
-    (float)0.000293159,
-    (float)0.000276903,
-    (float)0.000278843,
-    (float)0.000294028,
-    (float)0.000305529,
-    (float)0.000301296,
-    (float)0.000284236,
-    (float)0.000258695,
-    (float)0.000233728,
-    (float)0.000222101,
-    (float)0.000225905,
-    (float)0.000238296,
-    (float)0.000251505,
-    (float)0.000256062,
-    (float)0.000246231,
-    (float)0.000226974,
-    (float)0.000205949,
-    (float)0.000190584,
-    (float)0.000187453,
-    (float)0.00019497,
-    (float)0.000204784,
-    (float)0.000210572,
-    (float)0.000207754,
-    (float)0.000194231,
-    (float)0.00017664,
-    (float)0.000163382,
-    (float)0.000158137,
-    (float)0.000162437,
-    (float)0.00017408,
-    (float)0.000185406,
-    (float)0.00019038,
-    (float)0.000188138,
-    (float)0.00017959,
-    (float)0.000169069,
-    (float)0.000162438,
-    (float)0.000161551,
-    (float)0.000165202,
-    (float)0.000170747,
-    (float)0.000173527,
-    (float)0.000170832,
-    (float)0.00016429,
-    (float)0.00015632,
-    (float)0.000150208,
-    (float)0.00014964,
-    (float)0.000154323,
-    (float)0.0001607,
-    (float)0.00016591,
-    (float)0.000166939,
-    (float)0.00016152,
-    (float)0.000152028,
-    (float)0.000142398,
-    (float)0.000135297,
-    (float)0.000133303,
-    (float)0.000136866,
-    (float)0.000143036,
-    (float)0.000148517,
-    (float)0.000151089,
-    (float)0.000149131,
-    (float)0.000143607,
-    (float)0.000137422,
-    (float)0.000132695,
-    (float)0.000131042,
-    (float)0.000132953,
-    (float)0.000136371,
-    (float)0.00013892,
-    (float)0.000139626,
-    (float)0.000137655,
-    (float)0.0001336,
-    (float)0.000130226,
-    (float)0.000129103,
-    (float)0.420092,
-    (float)0.144998,
-    (float)0.0895592,
-    (float)0.0738948,
-    (float)0.0496276,
-    (float)0.0324443,
-    (float)0.0230564,
-    (float)0.0153659,
-    (float)0.0100233,
-    (float)0.00718523,
-    (float)0.00624731,
-    (float)0.00750313,
-    (float)0.0107932,
-    (float)0.014421,
-    (float)0.0165995,
-    (float)0.0168033,
-    (float)0.0142703,
-    (float)0.0099896,
-    (float)0.0057423,
-    (float)0.00236576,
-    (float)0.000610876,
-    (float)0.000310407,
-    (float)0.00075797,
-    (float)0.00121939,
-    (float)0.00133864,
-    (float)0.00114774,
-    (float)0.000798492,
-    (float)0.000542609,
-    (float)0.000467556,
-    (float)0.000488598,
-    (float)0.000504164,
-    (float)0.000482316,
-    (float)0.000441168,
-    (float)0.000444906,
-    (float)0.000538177,
-    (float)0.000675353,
-    (float)0.000764145,
-    (float)0.000765457,
-    (float)0.000668562,
-    (float)0.000514395,
-    (float)0.000398631,
-    (float)0.00036342,
-    (float)0.00038716,
-    (float)0.000428668,
-    (float)0.000448734,
-    (float)0.000416823,
-    (float)0.000354618,
-    (float)0.000306536,
-    (float)0.000289607,
-    (float)0.00029946,
-    (float)0.000317805,
-    (float)0.000317074,
-    (float)0.000289192,
-    (float)0.000254583,
-    (float)0.000232224,
-    (float)0.00023128,
-    (float)0.00024928,
-    (float)0.000266171,
-    (float)0.000260887,
-    (float)0.000237666,
-    (float)0.000211637,
-    (float)0.00019486,
-    (float)0.000196745,
-    (float)0.000212272,
-    (float)0.000220919,
-    (float)0.000210663,
-    (float)0.000187639,
-    (float)0.000162536,
-    (float)0.000148978,
-    (float)0.000154484,
-    (float)0.000170319,
-    (float)0.000181147,
-    (float)0.000180406,
-    (float)0.000169571,
-    (float)0.000156949,
-    (float)0.000154082,
-    (float)0.000162001,
-    (float)0.0001706,
-    (float)0.000171821,
-    (float)0.00016318,
-    (float)0.000147455,
-    (float)0.00013605,
-    (float)0.000137542,
-    (float)0.000147877,
-    (float)0.000157151,
-    (float)0.000158212,
-    (float)0.000147257,
-    (float)0.000129514,
-    (float)0.000117077,
-    (float)0.00011589,
-    (float)0.000123255,
-    (float)0.000132581,
-    (float)0.000135898,
-    (float)0.000129529,
-    (float)0.000119262,
-    (float)0.000112584,
-    (float)0.000112445,
-    (float)0.000117993,
-    (float)0.00012413,
-    (float)0.000123895,
-    (float)0.000116969,
-    (float)0.000108903,
-    (float)0.000103994,
-    (float)0.000104605,
-    (float)0.000109763,
-    (float)0.000113435,
-    (float)0.000110635,
-    (float)0.000103075,
-    (float)9.51352e-05,
-    (float)9.15455e-05,
-    (float)9.57457e-05,
-    (float)0.000105446,
-    (float)0.000113743,
-    (float)0.000116232,
-    (float)0.000112371,
-    (float)0.000104458,
-    (float)9.86857e-05,
-    (float)9.9524e-05,
-    (float)0.000105342,
-    (float)0.000111926,
-    (float)0.00011569,
-    (float)0.000113612,
-    (float)0.000107194,
-    (float)0.000101962,
-    (float)0.000100797,
-    (float)0.000103297,
-    (float)0.000107647,
-    (float)0.000109985,
-    (float)0.473986,
-    (float)0.141575,
-    (float)0.0775458,
-    (float)0.0616653,
-    (float)0.0402499,
-    (float)0.0248097,
-    (float)0.016318,
-    (float)0.00944503,
-    (float)0.00620217,
-    (float)0.00841989,
-    (float)0.014835,
-    (float)0.0214173,
-    (float)0.025066,
-    (float)0.0232377,
-    (float)0.0165074,
-    (float)0.00893771,
-    (float)0.00307783,
-    (float)0.000465803,
-    (float)0.000442618,
-    (float)0.00128686,
-    (float)0.00164848,
-    (float)0.00129022,
-    (float)0.000789387,
-    (float)0.000505255,
-    (float)0.000492551,
-    (float)0.000556349,
-    (float)0.000525399,
-    (float)0.000422032,
-    (float)0.000424649,
-    (float)0.000593152,
-    (float)0.000785353,
-    (float)0.000832336,
-    (float)0.000710877,
-    (float)0.000508446,
-    (float)0.000378492,
-    (float)0.000386671,
-    (float)0.000456778,
-    (float)0.000477476,
-    (float)0.000429951,
-    (float)0.000356326,
-    (float)0.000308266,
-    (float)0.000312956,
-    (float)0.00033956,
-    (float)0.000330841,
-    (float)0.0002823,
-    (float)0.000240631,
-    (float)0.000233422,
-    (float)0.000252695,
-    (float)0.000271258,
-    (float)0.000263109,
-    (float)0.000229172,
-    (float)0.00020278,
-    (float)0.00020531,
-    (float)0.000223275,
-    (float)0.000230051,
-    (float)0.000211588,
-    (float)0.000174779,
-    (float)0.000147441,
-    (float)0.000148206,
-    (float)0.000165585,
-    (float)0.000175157,
-    (float)0.000169631,
-    (float)0.000157855,
-    (float)0.00015179,
-    (float)0.000157592,
-    (float)0.000166461,
-    (float)0.00016204,
-    (float)0.000144333,
-    (float)0.000131179,
-    (float)0.000134621,
-    (float)0.000149832,
-    (float)0.000161199,
-    (float)0.000155149,
-    (float)0.00013405,
-    (float)0.000115876,
-    (float)0.000113282,
-    (float)0.000121686,
-    (float)0.000127549,
-    (float)0.000122303,
-    (float)0.000108936,
-    (float)0.000100506,
-    (float)0.000105369,
-    (float)0.000116714,
-    (float)0.000121261,
-    (float)0.000115356,
-    (float)0.000105549,
-    (float)0.000100082,
-    (float)0.000101955,
-    (float)0.000105381,
-    (float)0.000101667,
-    (float)9.07505e-05,
-    (float)8.1945e-05,
-    (float)8.2757e-05,
-    (float)9.16421e-05,
-    (float)9.99118e-05,
-    (float)9.9405e-05,
-    (float)9.05885e-05,
-    (float)8.2219e-05,
-    (float)8.14169e-05,
-    (float)8.72104e-05,
-    (float)9.33874e-05,
-    (float)9.49013e-05,
-    (float)9.15046e-05,
-    (float)8.80242e-05,
-    (float)8.88655e-05,
-    (float)9.23185e-05,
-    (float)9.29854e-05,
-    (float)8.86921e-05,
-    (float)8.21501e-05,
-    (float)7.77377e-05,
-    (float)7.80214e-05,
-    (float)8.14406e-05,
-    (float)8.38087e-05,
-    (float)8.28948e-05,
-    (float)8.06588e-05,
-    (float)8.0618e-05,
-    (float)8.41229e-05,
-    (float)8.87515e-05,
-    (float)9.01778e-05,
-    (float)8.65075e-05,
-    (float)8.02377e-05,
-    (float)7.55803e-05,
-    (float)7.47719e-05,
-    (float)7.67922e-05,
-    (float)7.87448e-05,
-    (float)7.84029e-05,
-    (float)7.62693e-05,
-    (float)7.50373e-05,
-    (float)0.514779,
-    (float)0.132076,
-    (float)0.0646508,
-    (float)0.052127,
-    (float)0.0344752,
-    (float)0.0184085,
-    (float)0.00916211,
-    (float)0.00669327,
-    (float)0.0132541,
-    (float)0.025224,
-    (float)0.0345674,
-    (float)0.0331674,
-    (float)0.0233054,
-    (float)0.0110161,
-    (float)0.00257381,
-    (float)0.000215523,
-    (float)0.00110319,
-    (float)0.00196144,
-    (float)0.00152791,
-    (float)0.000780756,
-    (float)0.000479216,
-    (float)0.000573632,
-    (float)0.000599509,
-    (float)0.000461518,
-    (float)0.000390061,
-    (float)0.000571983,
-    (float)0.000832743,
-    (float)0.000869198,
-    (float)0.000625867,
-    (float)0.000401342,
-    (float)0.000384145,
-    (float)0.000481626,
-    (float)0.000511424,
-    (float)0.000435938,
-    (float)0.000341358,
-    (float)0.000320201,
-    (float)0.000352303,
-    (float)0.000345428,
-    (float)0.000275601,
-    (float)0.000225642,
-    (float)0.00024315,
-    (float)0.000280348,
-    (float)0.000274701,
-    (float)0.000235375,
-    (float)0.000204359,
-    (float)0.000208946,
-    (float)0.000231635,
-    (float)0.000230233,
-    (float)0.000189312,
-    (float)0.000150776,
-    (float)0.000149188,
-    (float)0.000167627,
-    (float)0.000171779,
-    (float)0.000158815,
-    (float)0.000148595,
-    (float)0.000152934,
-    (float)0.000161547,
-    (float)0.000155167,
-    (float)0.000133956,
-    (float)0.000125972,
-    (float)0.000145603,
-    (float)0.000168103,
-    (float)0.00016182,
-    (float)0.000133753,
-    (float)0.000112008,
-    (float)0.000112154,
-    (float)0.000123613,
-    (float)0.000125407,
-    (float)0.000110663,
-    (float)9.74542e-05,
-    (float)0.000102601,
-    (float)0.000115679,
-    (float)0.000115469,
-    (float)0.000102546,
-    (float)9.4067e-05,
-    (float)9.80239e-05,
-    (float)0.00010451,
-    (float)9.98614e-05,
-    (float)8.42121e-05,
-    (float)7.47e-05,
-    (float)8.22551e-05,
-    (float)9.47638e-05,
-    (float)9.27775e-05,
-    (float)7.78451e-05,
-    (float)6.73799e-05,
-    (float)7.09754e-05,
-    (float)8.16188e-05,
-    (float)8.70948e-05,
-    (float)8.31324e-05,
-    (float)7.67541e-05,
-    (float)7.72109e-05,
-    (float)8.20946e-05,
-    (float)8.15732e-05,
-    (float)7.47386e-05,
-    (float)7.00547e-05,
-    (float)7.15176e-05,
-    (float)7.49184e-05,
-    (float)7.4987e-05,
-    (float)7.08334e-05,
-    (float)6.71725e-05,
-    (float)6.91997e-05,
-    (float)7.47395e-05,
-    (float)7.63702e-05,
-    (float)7.24301e-05,
-    (float)6.83288e-05,
-    (float)6.73679e-05,
-    (float)6.86141e-05,
-    (float)7.0244e-05,
-    (float)7.02192e-05,
-    (float)6.7186e-05,
-    (float)6.3587e-05,
-    (float)6.2421e-05,
-    (float)6.29177e-05,
-    (float)6.33061e-05,
-    (float)6.36861e-05,
-    (float)6.3809e-05,
-    (float)6.31604e-05,
-    (float)6.3139e-05,
-    (float)6.43256e-05,
-    (float)6.47871e-05,
-    (float)6.39087e-05,
-    (float)6.30831e-05,
-    (float)6.2522e-05,
-    (float)6.2115e-05,
-    (float)6.23665e-05,
-    (float)6.22999e-05,
-    (float)6.07222e-05,
-    (float)5.95758e-05,
-    (float)0.541967,
-    (float)0.119626,
-    (float)0.0544252,
-    (float)0.0462322,
-    (float)0.0289869,
-    (float)0.0105703,
-    (float)0.005858,
-    (float)0.0180721,
-    (float)0.0374217,
-    (float)0.0471249,
-    (float)0.0399992,
-    (float)0.0209906,
-    (float)0.00573284,
-    (float)0.000314925,
-    (float)0.00125802,
-    (float)0.00223765,
-    (float)0.00153163,
-    (float)0.000594693,
-    (float)0.000511207,
-    (float)0.000676249,
-    (float)0.000527594,
-    (float)0.000354593,
-    (float)0.000573818,
-    (float)0.000876546,
-    (float)0.000836473,
-    (float)0.000500577,
-    (float)0.000352824,
-    (float)0.000475208,
-    (float)0.000553128,
-    (float)0.000435674,
-    (float)0.000327329,
-    (float)0.000349509,
-    (float)0.000375945,
-    (float)0.000305059,
-    (float)0.000225381,
-    (float)0.000235141,
-    (float)0.000285495,
-    (float)0.000279484,
-    (float)0.000222242,
-    (float)0.000196203,
-    (float)0.000225475,
-    (float)0.000243113,
-    (float)0.000201592,
-    (float)0.000151041,
-    (float)0.000150766,
-    (float)0.000173572,
-    (float)0.000165592,
-    (float)0.000141092,
-    (float)0.000144407,
-    (float)0.00016313,
-    (float)0.000153688,
-    (float)0.000124847,
-    (float)0.000122443,
-    (float)0.000153888,
-    (float)0.00017324,
-    (float)0.000150979,
-    (float)0.000113894,
-    (float)0.00010618,
-    (float)0.000123367,
-    (float)0.000126147,
-    (float)0.000104983,
-    (float)9.32476e-05,
-    (float)0.000105309,
-    (float)0.000114322,
-    (float)0.000101857,
-    (float)9.01287e-05,
-    (float)9.76227e-05,
-    (float)0.00010572,
-    (float)9.24107e-05,
-    (float)7.20224e-05,
-    (float)7.14562e-05,
-    (float)8.77287e-05,
-    (float)9.22348e-05,
-    (float)7.52682e-05,
-    (float)5.93854e-05,
-    (float)6.46226e-05,
-    (float)7.88546e-05,
-    (float)8.02996e-05,
-    (float)7.15205e-05,
-    (float)6.98879e-05,
-    (float)7.57589e-05,
-    (float)7.52804e-05,
-    (float)6.76935e-05,
-    (float)6.52829e-05,
-    (float)6.99848e-05,
-    (float)7.04751e-05,
-    (float)6.31239e-05,
-    (float)5.83411e-05,
-    (float)6.3936e-05,
-    (float)7.26721e-05,
-    (float)7.30861e-05,
-    (float)6.50198e-05,
-    (float)5.87279e-05,
-    (float)5.99378e-05,
-    (float)6.34741e-05,
-    (float)6.31034e-05,
-    (float)5.99373e-05,
-    (float)5.76482e-05,
-    (float)5.63876e-05,
-    (float)5.52776e-05,
-    (float)5.49105e-05,
-    (float)5.49171e-05,
-    (float)5.39069e-05,
-    (float)5.23553e-05,
-    (float)5.19635e-05,
-    (float)5.28665e-05,
-    (float)5.38674e-05,
-    (float)5.41421e-05,
-    (float)5.29977e-05,
-    (float)5.00927e-05,
-    (float)4.69897e-05,
-    (float)4.64676e-05,
-    (float)4.94879e-05,
-    (float)5.33379e-05,
-    (float)5.42056e-05,
-    (float)5.17146e-05,
-    (float)4.95492e-05,
-    (float)5.0264e-05,
-    (float)5.14545e-05,
-    (float)5.0115e-05,
-    (float)4.83228e-05,
-    (float)4.99491e-05,
-    (float)5.3783e-05,
-    (float)5.50825e-05,
-    (float)5.29075e-05,
-    (float)5.06918e-05,
-    (float)5.05299e-05,
-    (float)5.09462e-05,
-    (float)0.556131,
-    (float)0.107391,
-    (float)0.0485847,
-    (float)0.0418301,
-    (float)0.0205348,
-    (float)0.00538333,
-    (float)0.0175496,
-    (float)0.0475668,
-    (float)0.0623695,
-    (float)0.0476343,
-    (float)0.0208625,
-    (float)0.00303202,
-    (float)0.000382144,
-    (float)0.00242858,
-    (float)0.00211084,
-    (float)0.000614457,
-    (float)0.000485493,
-    (float)0.000794861,
-    (float)0.000488577,
-    (float)0.000325776,
-    (float)0.000732006,
-    (float)0.000967593,
-    (float)0.000605476,
-    (float)0.000328782,
-    (float)0.00046766,
-    (float)0.000580276,
-    (float)0.00042015,
-    (float)0.000319165,
-    (float)0.000383361,
-    (float)0.000366514,
-    (float)0.000238124,
-    (float)0.000216385,
-    (float)0.000291458,
-    (float)0.000277391,
-    (float)0.000196269,
-    (float)0.000198631,
-    (float)0.000252053,
-    (float)0.000225806,
-    (float)0.000157685,
-    (float)0.00014874,
-    (float)0.000171949,
-    (float)0.000153627,
-    (float)0.000130098,
-    (float)0.000149045,
-    (float)0.000161743,
-    (float)0.000127328,
-    (float)0.000106541,
-    (float)0.000142621,
-    (float)0.000173406,
-    (float)0.000145233,
-    (float)0.000108067,
-    (float)0.000114741,
-    (float)0.000131493,
-    (float)0.00011392,
-    (float)8.96648e-05,
-    (float)9.75823e-05,
-    (float)0.000111836,
-    (float)0.000100489,
-    (float)8.81455e-05,
-    (float)0.000101234,
-    (float)0.000108944,
-    (float)8.45918e-05,
-    (float)6.30693e-05,
-    (float)7.78204e-05,
-    (float)9.53012e-05,
-    (float)7.87711e-05,
-    (float)5.47392e-05,
-    (float)6.04163e-05,
-    (float)7.57878e-05,
-    (float)7.02408e-05,
-    (float)5.95579e-05,
-    (float)6.7036e-05,
-    (float)7.5559e-05,
-    (float)6.60382e-05,
-    (float)5.68156e-05,
-    (float)6.32715e-05,
-    (float)6.65028e-05,
-    (float)5.43654e-05,
-    (float)4.87533e-05,
-    (float)6.2336e-05,
-    (float)7.33456e-05,
-    (float)6.49304e-05,
-    (float)5.29882e-05,
-    (float)5.36388e-05,
-    (float)5.92153e-05,
-    (float)5.83128e-05,
-    (float)5.44255e-05,
-    (float)5.28496e-05,
-    (float)5.14993e-05,
-    (float)4.91142e-05,
-    (float)4.82768e-05,
-    (float)4.89769e-05,
-    (float)4.88814e-05,
-    (float)4.82778e-05,
-    (float)4.85228e-05,
-    (float)4.91129e-05,
-    (float)4.88234e-05,
-    (float)4.62877e-05,
-    (float)4.11097e-05,
-    (float)3.76993e-05,
-    (float)4.1253e-05,
-    (float)4.82537e-05,
-    (float)4.91256e-05,
-    (float)4.34744e-05,
-    (float)4.06324e-05,
-    (float)4.3458e-05,
-    (float)4.5075e-05,
-    (float)4.29495e-05,
-    (float)4.25085e-05,
-    (float)4.4781e-05,
-    (float)4.42963e-05,
-    (float)4.07354e-05,
-    (float)3.95789e-05,
-    (float)4.15131e-05,
-    (float)4.22416e-05,
-    (float)4.20395e-05,
-    (float)4.42212e-05,
-    (float)4.63634e-05,
-    (float)4.35781e-05,
-    (float)3.80848e-05,
-    (float)3.63574e-05,
-    (float)3.90162e-05,
-    (float)4.13163e-05,
-    (float)4.15226e-05,
-    (float)4.13075e-05,
-    (float)4.07616e-05,
-    (float)3.91249e-05,
-    (float)3.8038e-05,
-    (float)0.557306,
-    (float)0.0986569,
-    (float)0.0472943,
-    (float)0.0357169,
-    (float)0.0102576,
-    (float)0.0131426,
-    (float)0.0493751,
-    (float)0.0788241,
-    (float)0.06278,
-    (float)0.0243611,
-    (float)0.0025365,
-    (float)0.00102657,
-    (float)0.0029726,
-    (float)0.00141545,
-    (float)0.00040494,
-    (float)0.000849611,
-    (float)0.000571715,
-    (float)0.000248173,
-    (float)0.000759124,
-    (float)0.000978157,
-    (float)0.000472412,
-    (float)0.000326092,
-    (float)0.000578447,
-    (float)0.000519137,
-    (float)0.000318313,
-    (float)0.000364568,
-    (float)0.000383896,
-    (float)0.000229242,
-    (float)0.000211039,
-    (float)0.000299869,
-    (float)0.000252189,
-    (float)0.000173734,
-    (float)0.000223316,
-    (float)0.000250383,
-    (float)0.000170759,
-    (float)0.000135958,
-    (float)0.000164588,
-    (float)0.00015069,
-    (float)0.000126305,
-    (float)0.00014911,
-    (float)0.000147492,
-    (float)0.000105321,
-    (float)0.000119051,
-    (float)0.000168608,
-    (float)0.000156297,
-    (float)0.000108425,
-    (float)0.000111325,
-    (float)0.000127408,
-    (float)0.000104382,
-    (float)8.76739e-05,
-    (float)0.000104907,
-    (float)0.000106107,
-    (float)8.91943e-05,
-    (float)9.64013e-05,
-    (float)0.000104564,
-    (float)7.82442e-05,
-    (float)5.99447e-05,
-    (float)8.13702e-05,
-    (float)9.00436e-05,
-    (float)6.33666e-05,
-    (float)5.04378e-05,
-    (float)6.4277e-05,
-    (float)6.53473e-05,
-    (float)5.64086e-05,
-    (float)6.34101e-05,
-    (float)6.87472e-05,
-    (float)5.74053e-05,
-    (float)5.32785e-05,
-    (float)6.05013e-05,
-    (float)5.439e-05,
-    (float)4.5141e-05,
-    (float)5.68877e-05,
-    (float)7.04637e-05,
-    (float)6.16202e-05,
-    (float)4.96284e-05,
-    (float)5.20089e-05,
-    (float)5.54496e-05,
-    (float)5.35334e-05,
-    (float)5.44129e-05,
-    (float)5.34967e-05,
-    (float)4.60787e-05,
-    (float)4.28835e-05,
-    (float)4.63819e-05,
-    (float)4.59567e-05,
-    (float)4.28999e-05,
-    (float)4.50741e-05,
-    (float)4.68912e-05,
-    (float)4.17069e-05,
-    (float)3.58704e-05,
-    (float)3.41585e-05,
-    (float)3.49875e-05,
-    (float)3.84453e-05,
-    (float)4.18936e-05,
-    (float)3.95566e-05,
-    (float)3.43839e-05,
-    (float)3.44798e-05,
-    (float)3.7746e-05,
-    (float)3.84825e-05,
-    (float)3.8335e-05,
-    (float)3.85674e-05,
-    (float)3.65282e-05,
-    (float)3.43388e-05,
-    (float)3.5542e-05,
-    (float)3.70994e-05,
-    (float)3.7269e-05,
-    (float)3.89529e-05,
-    (float)4.01535e-05,
-    (float)3.68207e-05,
-    (float)3.28484e-05,
-    (float)3.33179e-05,
-    (float)3.50721e-05,
-    (float)3.50905e-05,
-    (float)3.53588e-05,
-    (float)3.50229e-05,
-    (float)3.24035e-05,
-    (float)3.15103e-05,
-    (float)3.42296e-05,
-    (float)3.54074e-05,
-    (float)3.34534e-05,
-    (float)3.25187e-05,
-    (float)3.24886e-05,
-    (float)3.09816e-05,
-    (float)3.07263e-05,
-    (float)3.30687e-05,
-    (float)3.3707e-05,
-    (float)3.20517e-05,
-    (float)3.20061e-05,
-    (float)3.2815e-05,
-    (float)0.546767,
-    (float)0.0954124,
-    (float)0.0483926,
-    (float)0.0257306,
-    (float)0.00526225,
-    (float)0.0422428,
-    (float)0.0897238,
-    (float)0.0871577,
-    (float)0.0371687,
-    (float)0.00366906,
-    (float)0.00111638,
-    (float)0.00344936,
-    (float)0.00104411,
-    (float)0.000434207,
-    (float)0.000926161,
-    (float)0.00035226,
-    (float)0.000493631,
-    (float)0.000969248,
-    (float)0.000584485,
-    (float)0.000318843,
-    (float)0.000579703,
-    (float)0.000469304,
-    (float)0.000312188,
-    (float)0.000422394,
-    (float)0.000328495,
-    (float)0.000172517,
-    (float)0.000262293,
-    (float)0.000286133,
-    (float)0.000171479,
-    (float)0.000206162,
-    (float)0.000247129,
-    (float)0.000162531,
-    (float)0.000136991,
-    (float)0.000157281,
-    (float)0.000125102,
-    (float)0.000131214,
-    (float)0.000150373,
-    (float)0.000100667,
-    (float)9.81361e-05,
-    (float)0.000166709,
-    (float)0.000151018,
-    (float)9.70657e-05,
-    (float)0.000114518,
-    (float)0.000124881,
-    (float)8.70344e-05,
-    (float)8.78591e-05,
-    (float)0.000106123,
-    (float)8.93301e-05,
-    (float)9.17537e-05,
-    (float)0.000108812,
-    (float)8.06996e-05,
-    (float)5.74268e-05,
-    (float)8.32708e-05,
-    (float)8.44958e-05,
-    (float)5.10019e-05,
-    (float)5.05022e-05,
-    (float)6.51551e-05,
-    (float)5.638e-05,
-    (float)5.58991e-05,
-    (float)6.53401e-05,
-    (float)5.47633e-05,
-    (float)4.86815e-05,
-    (float)5.75196e-05,
-    (float)4.80933e-05,
-    (float)3.81475e-05,
-    (float)5.60614e-05,
-    (float)6.66683e-05,
-    (float)5.09019e-05,
-    (float)4.52765e-05,
-    (float)5.35929e-05,
-    (float)5.30043e-05,
-    (float)4.78091e-05,
-    (float)4.5497e-05,
-    (float)4.1805e-05,
-    (float)4.09008e-05,
-    (float)4.24865e-05,
-    (float)4.05817e-05,
-    (float)4.04221e-05,
-    (float)4.28009e-05,
-    (float)4.02777e-05,
-    (float)3.51782e-05,
-    (float)3.12489e-05,
-    (float)2.95288e-05,
-    (float)3.40605e-05,
-    (float)3.82045e-05,
-    (float)3.35484e-05,
-    (float)3.1426e-05,
-    (float)3.65459e-05,
-    (float)3.55979e-05,
-    (float)3.19995e-05,
-    (float)3.52143e-05,
-    (float)3.44523e-05,
-    (float)2.89469e-05,
-    (float)3.18103e-05,
-    (float)3.58156e-05,
-    (float)3.24408e-05,
-    (float)3.32912e-05,
-    (float)3.69293e-05,
-    (float)3.16853e-05,
-    (float)2.68404e-05,
-    (float)2.98178e-05,
-    (float)3.00001e-05,
-    (float)2.71327e-05,
-    (float)2.86107e-05,
-    (float)2.92492e-05,
-    (float)2.69719e-05,
-    (float)2.81642e-05,
-    (float)3.00342e-05,
-    (float)2.77305e-05,
-    (float)2.53776e-05,
-    (float)2.57178e-05,
-    (float)2.67817e-05,
-    (float)2.76577e-05,
-    (float)2.75399e-05,
-    (float)2.74118e-05,
-    (float)2.87744e-05,
-    (float)2.88706e-05,
-    (float)2.70799e-05,
-    (float)2.71462e-05,
-    (float)2.77338e-05,
-    (float)2.65966e-05,
-    (float)2.67912e-05,
-    (float)2.72555e-05,
-    (float)2.53901e-05,
-    (float)2.60501e-05,
-    (float)2.88947e-05,
-    (float)2.66107e-05,
-    (float)2.34823e-05,
-    (float)0.525855,
-    (float)0.0992898,
-    (float)0.0489324,
-    (float)0.0130049,
-    (float)0.0155198,
-    (float)0.0900612,
-    (float)0.115501,
-    (float)0.0648789,
-    (float)0.00982973,
-    (float)0.000690101,
-    (float)0.00370693,
-    (float)0.00109928,
-    (float)0.000583414,
-    (float)0.00090363,
-    (float)0.000180652,
-    (float)0.000733755,
-    (float)0.000945212,
-    (float)0.000287211,
-    (float)0.000440545,
-    (float)0.000560251,
-    (float)0.000333687,
-    (float)0.000403579,
-    (float)0.00029725,
-    (float)0.000160497,
-    (float)0.000299946,
-    (float)0.000244709,
-    (float)0.000145725,
-    (float)0.000236111,
-    (float)0.000201695,
-    (float)0.000123739,
-    (float)0.000153001,
-    (float)0.000119157,
-    (float)0.000116487,
-    (float)0.000151203,
-    (float)8.74941e-05,
-    (float)9.58347e-05,
-    (float)0.000174473,
-    (float)0.000126573,
-    (float)8.71483e-05,
-    (float)0.000121385,
-    (float)9.98672e-05,
-    (float)8.07957e-05,
-    (float)0.000101188,
-    (float)8.60114e-05,
-    (float)8.98436e-05,
-    (float)0.00011094,
-    (float)7.03465e-05,
-    (float)5.36542e-05,
-    (float)8.89882e-05,
-    (float)7.21504e-05,
-    (float)3.93368e-05,
-    (float)5.28297e-05,
-    (float)5.73192e-05,
-    (float)4.9693e-05,
-    (float)5.7155e-05,
-    (float)5.1532e-05,
-    (float)4.58747e-05,
-    (float)5.14506e-05,
-    (float)3.87838e-05,
-    (float)3.62063e-05,
-    (float)5.96119e-05,
-    (float)5.8479e-05,
-    (float)4.07765e-05,
-    (float)4.49422e-05,
-    (float)5.29458e-05,
-    (float)4.94042e-05,
-    (float)4.34709e-05,
-    (float)3.82659e-05,
-    (float)3.91215e-05,
-    (float)4.06834e-05,
-    (float)3.59974e-05,
-    (float)3.74991e-05,
-    (float)4.27906e-05,
-    (float)3.81097e-05,
-    (float)2.87676e-05,
-    (float)2.46142e-05,
-    (float)2.97538e-05,
-    (float)3.57702e-05,
-    (float)2.95994e-05,
-    (float)2.57692e-05,
-    (float)3.24215e-05,
-    (float)3.18004e-05,
-    (float)2.84211e-05,
-    (float)3.17445e-05,
-    (float)2.96671e-05,
-    (float)2.59916e-05,
-    (float)2.7314e-05,
-    (float)2.66439e-05,
-    (float)3.07872e-05,
-    (float)3.55919e-05,
-    (float)2.79001e-05,
-    (float)2.36771e-05,
-    (float)2.74552e-05,
-    (float)2.48974e-05,
-    (float)2.39205e-05,
-    (float)2.66087e-05,
-    (float)2.3263e-05,
-    (float)2.2989e-05,
-    (float)2.6456e-05,
-    (float)2.49645e-05,
-    (float)2.55629e-05,
-    (float)2.58302e-05,
-    (float)2.1151e-05,
-    (float)2.22726e-05,
-    (float)2.5093e-05,
-    (float)2.28014e-05,
-    (float)2.49038e-05,
-    (float)2.70464e-05,
-    (float)2.27272e-05,
-    (float)2.18468e-05,
-    (float)2.37738e-05,
-    (float)2.22499e-05,
-    (float)2.14163e-05,
-    (float)2.03817e-05,
-    (float)1.93401e-05,
-    (float)2.20126e-05,
-    (float)2.22669e-05,
-    (float)1.96048e-05,
-    (float)2.16845e-05,
-    (float)2.34086e-05,
-    (float)2.0431e-05,
-    (float)1.94737e-05,
-    (float)2.20384e-05,
-    (float)2.34971e-05,
-    (float)2.26319e-05,
-    (float)2.16467e-05,
-    (float)2.35672e-05,
-    (float)2.54573e-05,
-    (float)0.496003,
-    (float)0.110392,
-    (float)0.046044,
-    (float)0.00287044,
-    (float)0.0482339,
-    (float)0.140552,
-    (float)0.109959,
-    (float)0.0296092,
-    (float)0.000126239,
-    (float)0.00422192,
-    (float)0.00146114,
-    (float)0.000481456,
-    (float)0.00105169,
-    (float)0.000157247,
-    (float)0.000830101,
-    (float)0.000717277,
-    (float)0.000260207,
-    (float)0.000613752,
-    (float)0.00036742,
-    (float)0.000318063,
-    (float)0.000401254,
-    (float)0.000167703,
-    (float)0.000259752,
-    (float)0.000225276,
-    (float)0.000134621,
-    (float)0.000257889,
-    (float)0.000171276,
-    (float)0.000110283,
-    (float)0.00014024,
-    (float)9.35968e-05,
-    (float)0.000138217,
-    (float)0.000110627,
-    (float)6.28438e-05,
-    (float)0.000157493,
-    (float)0.000135021,
-    (float)8.05693e-05,
-    (float)0.0001198,
-    (float)8.85652e-05,
-    (float)7.58498e-05,
-    (float)9.72296e-05,
-    (float)7.54561e-05,
-    (float)0.000102453,
-    (float)0.00010006,
-    (float)4.72957e-05,
-    (float)7.138e-05,
-    (float)7.92315e-05,
-    (float)4.02391e-05,
-    (float)4.91903e-05,
-    (float)5.07531e-05,
-    (float)4.21372e-05,
-    (float)5.60602e-05,
-    (float)4.83845e-05,
-    (float)4.27736e-05,
-    (float)4.38255e-05,
-    (float)2.85372e-05,
-    (float)4.32636e-05,
-    (float)6.0912e-05,
-    (float)4.28979e-05,
-    (float)4.03621e-05,
-    (float)5.00396e-05,
-    (float)4.38368e-05,
-    (float)4.07029e-05,
-    (float)3.80799e-05,
-    (float)3.45406e-05,
-    (float)3.5684e-05,
-    (float)3.38624e-05,
-    (float)3.59446e-05,
-    (float)3.99029e-05,
-    (float)3.15021e-05,
-    (float)2.04686e-05,
-    (float)2.33006e-05,
-    (float)3.12184e-05,
-    (float)2.6635e-05,
-    (float)2.31697e-05,
-    (float)2.80458e-05,
-    (float)2.75116e-05,
-    (float)2.82192e-05,
-    (float)2.83959e-05,
-    (float)2.32606e-05,
-    (float)2.55704e-05,
-    (float)2.50856e-05,
-    (float)2.42922e-05,
-    (float)3.3151e-05,
-    (float)2.85973e-05,
-    (float)2.05103e-05,
-    (float)2.51239e-05,
-    (float)2.34565e-05,
-    (float)2.21249e-05,
-    (float)2.28401e-05,
-    (float)1.80869e-05,
-    (float)2.1454e-05,
-    (float)2.35171e-05,
-    (float)2.05678e-05,
-    (float)2.2923e-05,
-    (float)1.97763e-05,
-    (float)1.79221e-05,
-    (float)2.19276e-05,
-    (float)2.00926e-05,
-    (float)2.03278e-05,
-    (float)2.03983e-05,
-    (float)1.7997e-05,
-    (float)2.19334e-05,
-    (float)2.12832e-05,
-    (float)1.79369e-05,
-    (float)1.82892e-05,
-    (float)1.51679e-05,
-    (float)1.7746e-05,
-    (float)2.0845e-05,
-    (float)1.56332e-05,
-    (float)1.77898e-05,
-    (float)2.09004e-05,
-    (float)1.78418e-05,
-    (float)1.97947e-05,
-    (float)1.91976e-05,
-    (float)1.66205e-05,
-    (float)1.89847e-05,
-    (float)1.84006e-05,
-    (float)2.06523e-05,
-    (float)2.41819e-05,
-    (float)1.79576e-05,
-    (float)1.59869e-05,
-    (float)2.1072e-05,
-    (float)1.8292e-05,
-    (float)1.39396e-05,
-    (float)1.52657e-05,
-    (float)1.62577e-05,
-    (float)1.67155e-05,
-    (float)1.75178e-05,
-    (float)0.459213,
-    (float)0.128075,
-    (float)0.0380929,
-    (float)0.00341918,
-    (float)0.102025,
-    (float)0.171745,
-    (float)0.0763963,
-    (float)0.00542238,
-    (float)0.0032208,
-    (float)0.00293544,
-    (float)0.000267601,
-    (float)0.00111077,
-    (float)0.000145832,
-    (float)0.000922536,
-    (float)0.000606995,
-    (float)0.000232183,
-    (float)0.000590551,
-    (float)0.000321619,
-    (float)0.000419175,
-    (float)0.000227387,
-    (float)0.000150708,
-    (float)0.000297676,
-    (float)0.000137805,
-    (float)0.000221517,
-    (float)0.000164327,
-    (float)9.95674e-05,
-    (float)0.000146441,
-    (float)8.38055e-05,
-    (float)0.00013139,
-    (float)7.52629e-05,
-    (float)7.83083e-05,
-    (float)0.000170084,
-    (float)8.57725e-05,
-    (float)9.74006e-05,
-    (float)0.000102885,
-    (float)6.35305e-05,
-    (float)9.41187e-05,
-    (float)6.97293e-05,
-    (float)9.43865e-05,
-    (float)9.78065e-05,
-    (float)4.31495e-05,
-    (float)7.57073e-05,
-    (float)6.60255e-05,
-    (float)3.3109e-05,
-    (float)5.10154e-05,
-    (float)4.07391e-05,
-    (float)4.45641e-05,
-    (float)4.8966e-05,
-    (float)3.94378e-05,
-    (float)4.29191e-05,
-    (float)2.54753e-05,
-    (float)3.32518e-05,
-    (float)5.5404e-05,
-    (float)3.85036e-05,
-    (float)3.7269e-05,
-    (float)4.7262e-05,
-    (float)4.16185e-05,
-    (float)3.6855e-05,
-    (float)3.12641e-05,
-    (float)3.07567e-05,
-    (float)3.19958e-05,
-    (float)3.32602e-05,
-    (float)3.80558e-05,
-    (float)3.19079e-05,
-    (float)2.04904e-05,
-    (float)2.1413e-05,
-    (float)2.80039e-05,
-    (float)2.2235e-05,
-    (float)1.9784e-05,
-    (float)2.65798e-05,
-    (float)2.61396e-05,
-    (float)2.62864e-05,
-    (float)2.38187e-05,
-    (float)1.96974e-05,
-    (float)2.13573e-05,
-    (float)2.06255e-05,
-    (float)2.69916e-05,
-    (float)2.75363e-05,
-    (float)1.91786e-05,
-    (float)2.12229e-05,
-    (float)2.05717e-05,
-    (float)1.93176e-05,
-    (float)1.84349e-05,
-    (float)1.60406e-05,
-    (float)2.0399e-05,
-    (float)1.92502e-05,
-    (float)1.9473e-05,
-    (float)2.02073e-05,
-    (float)1.63592e-05,
-    (float)1.79283e-05,
-    (float)1.68016e-05,
-    (float)1.92664e-05,
-    (float)1.98504e-05,
-    (float)1.50702e-05,
-    (float)1.95075e-05,
-    (float)1.81187e-05,
-    (float)1.56933e-05,
-    (float)1.64372e-05,
-    (float)1.33797e-05,
-    (float)1.66413e-05,
-    (float)1.4109e-05,
-    (float)1.29982e-05,
-    (float)1.82457e-05,
-    (float)1.44608e-05,
-    (float)1.56032e-05,
-    (float)1.67703e-05,
-    (float)1.37005e-05,
-    (float)1.543e-05,
-    (float)1.4741e-05,
-    (float)1.70545e-05,
-    (float)1.72484e-05,
-    (float)1.39223e-05,
-    (float)1.77959e-05,
-    (float)1.7824e-05,
-    (float)1.31858e-05,
-    (float)1.17126e-05,
-    (float)1.26853e-05,
-    (float)1.4857e-05,
-    (float)1.45577e-05,
-    (float)1.47904e-05,
-    (float)1.46339e-05,
-    (float)1.3056e-05,
-    (float)1.36701e-05,
-    (float)1.39936e-05,
-    (float)1.3285e-05,
-    (float)1.27708e-05,
-    (float)1.62509e-05,
-    (float)2.00402e-05,
-    (float)0.416868,
-    (float)0.150409,
-    (float)0.025796,
-    (float)0.0227685,
-    (float)0.165398,
-    (float)0.169201,
-    (float)0.0354975,
-    (float)0.000170435,
-    (float)0.00501899,
-    (float)0.000370539,
-    (float)0.0012423,
-    (float)0.00021271,
-    (float)0.000721017,
-    (float)0.000704384,
-    (float)0.000259348,
-    (float)0.00053749,
-    (float)0.000245239,
-    (float)0.000433482,
-    (float)0.00016383,
-    (float)0.000235628,
-    (float)0.000178162,
-    (float)0.000120566,
-    (float)0.000232375,
-    (float)0.000101447,
-    (float)0.000132663,
-    (float)6.27376e-05,
-    (float)0.000115594,
-    (float)8.11938e-05,
-    (float)7.85744e-05,
-    (float)0.000160545,
-    (float)6.7711e-05,
-    (float)0.000105379,
-    (float)7.83641e-05,
-    (float)6.9675e-05,
-    (float)8.24412e-05,
-    (float)6.73989e-05,
-    (float)0.000111016,
-    (float)4.90502e-05,
-    (float)5.90587e-05,
-    (float)7.25388e-05,
-    (float)2.96957e-05,
-    (float)4.48034e-05,
-    (float)3.63925e-05,
-    (float)4.16511e-05,
-    (float)4.17266e-05,
-    (float)3.61649e-05,
-    (float)3.6017e-05,
-    (float)1.90909e-05,
-    (float)3.98142e-05,
-    (float)4.43282e-05,
-    (float)3.11658e-05,
-    (float)4.28089e-05,
-    (float)4.01577e-05,
-    (float)3.33392e-05,
-    (float)3.04397e-05,
-    (float)2.94851e-05,
-    (float)2.86081e-05,
-    (float)2.91775e-05,
-    (float)3.61315e-05,
-    (float)2.9907e-05,
-    (float)1.71472e-05,
-    (float)1.99866e-05,
-    (float)2.35917e-05,
-    (float)1.80247e-05,
-    (float)2.14319e-05,
-    (float)2.19661e-05,
-    (float)2.03572e-05,
-    (float)2.2988e-05,
-    (float)1.96402e-05,
-    (float)1.85505e-05,
-    (float)1.63384e-05,
-    (float)2.3204e-05,
-    (float)2.44569e-05,
-    (float)1.71655e-05,
-    (float)2.08829e-05,
-    (float)1.78963e-05,
-    (float)1.7983e-05,
-    (float)1.63205e-05,
-    (float)1.52253e-05,
-    (float)1.81565e-05,
-    (float)1.62969e-05,
-    (float)1.9097e-05,
-    (float)1.57899e-05,
-    (float)1.52486e-05,
-    (float)1.52293e-05,
-    (float)1.47063e-05,
-    (float)1.58977e-05,
-    (float)1.30608e-05,
-    (float)1.62121e-05,
-    (float)1.50036e-05,
-    (float)1.36524e-05,
-    (float)1.19674e-05,
-    (float)1.24958e-05,
-    (float)1.32429e-05,
-    (float)9.5892e-06,
-    (float)1.50066e-05,
-    (float)1.40485e-05,
-    (float)1.34441e-05,
-    (float)1.46177e-05,
-    (float)1.24091e-05,
-    (float)1.34409e-05,
-    (float)1.25283e-05,
-    (float)1.70867e-05,
-    (float)1.41479e-05,
-    (float)1.24606e-05,
-    (float)1.74799e-05,
-    (float)1.30186e-05,
-    (float)1.07957e-05,
-    (float)1.08056e-05,
-    (float)1.1377e-05,
-    (float)1.11256e-05,
-    (float)1.14345e-05,
-    (float)1.22412e-05,
-    (float)9.8364e-06,
-    (float)1.05602e-05,
-    (float)1.11099e-05,
-    (float)9.76739e-06,
-    (float)9.64252e-06,
-    (float)1.35386e-05,
-    (float)1.35822e-05,
-    (float)1.16283e-05,
-    (float)1.29076e-05,
-    (float)1.08912e-05,
-    (float)1.17459e-05,
-    (float)1.10142e-05,
-    (float)1.15998e-05,
-    (float)1.36618e-05,
-    (float)1.18085e-05,
-    (float)0.371201,
-    (float)0.174549,
-    (float)0.0124288,
-    (float)0.0655878,
-    (float)0.220158,
-    (float)0.134326,
-    (float)0.00790229,
-    (float)0.00397499,
-    (float)0.00214809,
-    (float)0.000827542,
-    (float)0.000707691,
-    (float)0.000422123,
-    (float)0.000785651,
-    (float)0.000183581,
-    (float)0.000596619,
-    (float)0.000252577,
-    (float)0.000382292,
-    (float)9.80488e-05,
-    (float)0.000267172,
-    (float)0.000139636,
-    (float)0.000187604,
-    (float)0.000132726,
-    (float)8.72812e-05,
-    (float)0.000103437,
-    (float)8.82775e-05,
-    (float)0.000104307,
-    (float)3.21542e-05,
-    (float)0.000145192,
-    (float)7.27039e-05,
-    (float)0.000105294,
-    (float)6.74678e-05,
-    (float)6.38536e-05,
-    (float)6.74767e-05,
-    (float)7.16115e-05,
-    (float)9.95533e-05,
-    (float)3.06526e-05,
-    (float)7.60637e-05,
-    (float)4.84435e-05,
-    (float)3.0526e-05,
-    (float)3.5984e-05,
-    (float)3.31773e-05,
-    (float)4.0466e-05,
-    (float)3.31488e-05,
-    (float)3.6741e-05,
-    (float)1.56873e-05,
-    (float)3.47075e-05,
-    (float)3.96278e-05,
-    (float)2.67169e-05,
-    (float)4.09995e-05,
-    (float)3.62612e-05,
-    (float)2.77162e-05,
-    (float)2.56117e-05,
-    (float)2.52568e-05,
-    (float)2.5787e-05,
-    (float)3.141e-05,
-    (float)3.23349e-05,
-    (float)1.76093e-05,
-    (float)1.63582e-05,
-    (float)2.19179e-05,
-    (float)1.46735e-05,
-    (float)1.85592e-05,
-    (float)1.97075e-05,
-    (float)1.97858e-05,
-    (float)2.057e-05,
-    (float)1.4814e-05,
-    (float)1.42825e-05,
-    (float)1.65141e-05,
-    (float)2.52541e-05,
-    (float)1.69162e-05,
-    (float)1.54594e-05,
-    (float)1.73633e-05,
-    (float)1.521e-05,
-    (float)1.63381e-05,
-    (float)1.21631e-05,
-    (float)1.51596e-05,
-    (float)1.49779e-05,
-    (float)1.62711e-05,
-    (float)1.20997e-05,
-    (float)1.36642e-05,
-    (float)1.45256e-05,
-    (float)1.41699e-05,
-    (float)1.28237e-05,
-    (float)1.16656e-05,
-    (float)1.42735e-05,
-    (float)1.25714e-05,
-    (float)1.25615e-05,
-    (float)9.84549e-06,
-    (float)1.36083e-05,
-    (float)8.85717e-06,
-    (float)1.03177e-05,
-    (float)1.17489e-05,
-    (float)1.10281e-05,
-    (float)1.35999e-05,
-    (float)1.02425e-05,
-    (float)1.07279e-05,
-    (float)9.85623e-06,
-    (float)1.37552e-05,
-    (float)9.96027e-06,
-    (float)1.15451e-05,
-    (float)1.47904e-05,
-    (float)9.32045e-06,
-    (float)8.59278e-06,
-    (float)9.63519e-06,
-    (float)8.78059e-06,
-    (float)1.03518e-05,
-    (float)1.13768e-05,
-    (float)8.74413e-06,
-    (float)9.26606e-06,
-    (float)9.78935e-06,
-    (float)8.36389e-06,
-    (float)7.99358e-06,
-    (float)1.41497e-05,
-    (float)1.05647e-05,
-    (float)9.4026e-06,
-    (float)1.06213e-05,
-    (float)7.79609e-06,
-    (float)1.01779e-05,
-    (float)9.05113e-06,
-    (float)9.85699e-06,
-    (float)8.60421e-06,
-    (float)1.10748e-05,
-    (float)9.02101e-06,
-    (float)7.57705e-06,
-    (float)9.42143e-06,
-    (float)8.73593e-06,
-    (float)1.02434e-05,
-    (float)9.11123e-06,
-    (float)9.29658e-06,
-    (float)0.323952,
-    (float)0.197521,
-    (float)0.00391305,
-    (float)0.130277,
-    (float)0.24876,
-    (float)0.0832909,
-    (float)2.13677e-05,
-    (float)0.0052497,
-    (float)0.000124988,
-    (float)0.00144353,
-    (float)8.5997e-05,
-    (float)0.000982722,
-    (float)0.000116678,
-    (float)0.000527744,
-    (float)0.000257976,
-    (float)0.000437268,
-    (float)7.72823e-05,
-    (float)0.000225915,
-    (float)8.14323e-05,
-    (float)0.000216094,
-    (float)0.000106659,
-    (float)0.000113967,
-    (float)4.07007e-05,
-    (float)9.97528e-05,
-    (float)3.5248e-05,
-    (float)0.000118266,
-    (float)0.000105163,
-    (float)6.95081e-05,
-    (float)7.36316e-05,
-    (float)4.82447e-05,
-    (float)7.41367e-05,
-    (float)6.59751e-05,
-    (float)9.18473e-05,
-    (float)2.59263e-05,
-    (float)7.79836e-05,
-    (float)3.38842e-05,
-    (float)3.03924e-05,
-    (float)2.52721e-05,
-    (float)3.5564e-05,
-    (float)3.2802e-05,
-    (float)3.29636e-05,
-    (float)1.83563e-05,
-    (float)1.90915e-05,
-    (float)3.91679e-05,
-    (float)2.37932e-05,
-    (float)3.33847e-05,
-    (float)3.40028e-05,
-    (float)2.58829e-05,
-    (float)2.19006e-05,
-    (float)2.18455e-05,
-    (float)2.48796e-05,
-    (float)3.03102e-05,
-    (float)2.83136e-05,
-    (float)1.13466e-05,
-    (float)1.80435e-05,
-    (float)1.86084e-05,
-    (float)1.40555e-05,
-    (float)1.63593e-05,
-    (float)1.60735e-05,
-    (float)1.94321e-05,
-    (float)1.47223e-05,
-    (float)1.24536e-05,
-    (float)1.19685e-05,
-    (float)2.15911e-05,
-    (float)1.54703e-05,
-    (float)1.45738e-05,
-    (float)1.51177e-05,
-    (float)1.36593e-05,
-    (float)1.26878e-05,
-    (float)1.07905e-05,
-    (float)1.40543e-05,
-    (float)1.41892e-05,
-    (float)1.27551e-05,
-    (float)9.50566e-06,
-    (float)1.33168e-05,
-    (float)1.15249e-05,
-    (float)1.18476e-05,
-    (float)9.31159e-06,
-    (float)1.30751e-05,
-    (float)1.04815e-05,
-    (float)1.07956e-05,
-    (float)8.16776e-06,
-    (float)1.16983e-05,
-    (float)7.12507e-06,
-    (float)9.40705e-06,
-    (float)9.60782e-06,
-    (float)1.05119e-05,
-    (float)9.55754e-06,
-    (float)8.06305e-06,
-    (float)1.03217e-05,
-    (float)1.10407e-05,
-    (float)9.98259e-06,
-    (float)7.44878e-06,
-    (float)1.34822e-05,
-    (float)9.93954e-06,
-    (float)8.26106e-06,
-    (float)7.59338e-06,
-    (float)8.39125e-06,
-    (float)8.41973e-06,
-    (float)8.29854e-06,
-    (float)6.86372e-06,
-    (float)8.435e-06,
-    (float)8.52941e-06,
-    (float)5.23567e-06,
-    (float)7.36529e-06,
-    (float)9.91122e-06,
-    (float)7.67672e-06,
-    (float)8.09246e-06,
-    (float)7.01304e-06,
-    (float)7.92257e-06,
-    (float)7.35145e-06,
-    (float)8.48895e-06,
-    (float)6.31902e-06,
-    (float)1.03071e-05,
-    (float)8.02826e-06,
-    (float)7.51445e-06,
-    (float)7.35137e-06,
-    (float)8.03371e-06,
-    (float)7.70746e-06,
-    (float)8.46049e-06,
-    (float)8.86057e-06,
-    (float)6.74258e-06,
-    (float)8.10798e-06,
-    (float)6.04842e-06,
-    (float)7.39601e-06,
-    (float)6.26391e-06,
-    (float)7.87019e-06,
-    (float)5.62833e-06,
-    (float)0.276381,
-    (float)0.216222,
-    (float)0.00763516,
-    (float)0.208344,
-    (float)0.242182,
-    (float)0.036918,
-    (float)0.00375463,
-    (float)0.00240094,
-    (float)0.000857778,
-    (float)0.000451849,
-    (float)0.00080101,
-    (float)0.000317944,
-    (float)0.00042066,
-    (float)0.000240035,
-    (float)0.000410404,
-    (float)0.000104737,
-    (float)0.000253162,
-    (float)6.20135e-05,
-    (float)0.000172535,
-    (float)6.51949e-05,
-    (float)0.000118228,
-    (float)4.63312e-05,
-    (float)0.000108966,
-    (float)1.30614e-05,
-    (float)0.000126914,
-    (float)4.32894e-05,
-    (float)0.000105606,
-    (float)3.78475e-05,
-    (float)7.35308e-05,
-    (float)3.66035e-05,
-    (float)9.60291e-05,
-    (float)2.64894e-05,
-    (float)7.70349e-05,
-    (float)3.0594e-05,
-    (float)2.63031e-05,
-    (float)2.10124e-05,
-    (float)3.49463e-05,
-    (float)2.55774e-05,
-    (float)2.77507e-05,
-    (float)9.42924e-06,
-    (float)2.67955e-05,
-    (float)3.16494e-05,
-    (float)2.19688e-05,
-    (float)3.34702e-05,
-    (float)2.35736e-05,
-    (float)2.19912e-05,
-    (float)1.86006e-05,
-    (float)2.19967e-05,
-    (float)2.54746e-05,
-    (float)2.78453e-05,
-    (float)1.01164e-05,
-    (float)1.48609e-05,
-    (float)1.52658e-05,
-    (float)1.27666e-05,
-    (float)1.43163e-05,
-    (float)1.44269e-05,
-    (float)1.47685e-05,
-    (float)1.11912e-05,
-    (float)9.93464e-06,
-    (float)1.40747e-05,
-    (float)1.81446e-05,
-    (float)1.09792e-05,
-    (float)1.40456e-05,
-    (float)1.24831e-05,
-    (float)1.19578e-05,
-    (float)9.04061e-06,
-    (float)1.18252e-05,
-    (float)1.21857e-05,
-    (float)1.2043e-05,
-    (float)9.03673e-06,
-    (float)1.04917e-05,
-    (float)9.61031e-06,
-    (float)9.20043e-06,
-    (float)9.25386e-06,
-    (float)1.09984e-05,
-    (float)8.98667e-06,
-    (float)7.99944e-06,
-    (float)8.02315e-06,
-    (float)8.88466e-06,
-    (float)5.76844e-06,
-    (float)8.67755e-06,
-    (float)7.81589e-06,
-    (float)9.49491e-06,
-    (float)6.6201e-06,
-    (float)8.33004e-06,
-    (float)7.59434e-06,
-    (float)9.26268e-06,
-    (float)6.69288e-06,
-    (float)1.26483e-05,
-    (float)6.99267e-06,
-    (float)7.20826e-06,
-    (float)6.16323e-06,
-    (float)7.33742e-06,
-    (float)6.88872e-06,
-    (float)7.16419e-06,
-    (float)5.91328e-06,
-    (float)7.03834e-06,
-    (float)4.75945e-06,
-    (float)5.45415e-06,
-    (float)8.86674e-06,
-    (float)5.9947e-06,
-    (float)7.16353e-06,
-    (float)5.73958e-06,
-    (float)6.92441e-06,
-    (float)6.06957e-06,
-    (float)6.99997e-06,
-    (float)6.02845e-06,
-    (float)7.72305e-06,
-    (float)5.32498e-06,
-    (float)6.42257e-06,
-    (float)6.14041e-06,
-    (float)6.38363e-06,
-    (float)5.50759e-06,
-    (float)6.32348e-06,
-    (float)5.88239e-06,
-    (float)6.15865e-06,
-    (float)5.68382e-06,
-    (float)5.772e-06,
-    (float)4.55918e-06,
-    (float)6.70075e-06,
-    (float)4.71528e-06,
-    (float)7.28361e-06,
-    (float)5.02559e-06,
-    (float)6.58632e-06,
-    (float)4.66512e-06,
-    (float)7.29141e-06,
-    (float)4.60596e-06,
-    (float)9.67035e-06,
-    (float)0.230186,
-    (float)0.227593,
-    (float)0.0312381,
-    (float)0.285803,
-    (float)0.203218,
-    (float)0.00886072,
-    (float)0.00747654,
-    (float)0.000162454,
-    (float)0.0013502,
-    (float)7.08909e-05,
-    (float)0.000821006,
-    (float)0.000199369,
-    (float)0.000372216,
-    (float)0.000307567,
-    (float)0.000142877,
-    (float)0.000201826,
-    (float)8.60653e-05,
-    (float)0.000193307,
-    (float)4.68709e-05,
-    (float)8.02937e-05,
-    (float)2.80229e-05,
-    (float)8.99003e-05,
-    (float)4.12196e-05,
-    (float)0.000123065,
-    (float)4.63553e-05,
-    (float)5.58736e-05,
-    (float)3.92424e-05,
-    (float)4.74049e-05,
-    (float)8.73134e-05,
-    (float)4.7487e-05,
-    (float)4.84493e-05,
-    (float)4.33954e-05,
-    (float)1.88646e-05,
-    (float)2.09462e-05,
-    (float)3.13991e-05,
-    (float)2.12617e-05,
-    (float)2.45102e-05,
-    (float)6.61438e-06,
-    (float)2.75425e-05,
-    (float)2.32152e-05,
-    (float)1.92626e-05,
-    (float)2.68976e-05,
-    (float)2.06129e-05,
-    (float)2.03072e-05,
-    (float)1.65546e-05,
-    (float)2.01333e-05,
-    (float)2.62683e-05,
-    (float)1.5356e-05,
-    (float)8.75393e-06,
-    (float)1.62756e-05,
-    (float)1.02486e-05,
-    (float)1.30038e-05,
-    (float)1.15754e-05,
-    (float)1.28009e-05,
-    (float)9.85041e-06,
-    (float)7.28095e-06,
-    (float)1.44049e-05,
-    (float)1.4557e-05,
-    (float)9.38189e-06,
-    (float)1.08767e-05,
-    (float)1.05432e-05,
-    (float)9.43721e-06,
-    (float)8.67218e-06,
-    (float)9.76543e-06,
-    (float)1.06871e-05,
-    (float)7.8062e-06,
-    (float)9.10342e-06,
-    (float)8.21129e-06,
-    (float)8.77136e-06,
-    (float)6.32975e-06,
-    (float)9.28753e-06,
-    (float)8.75636e-06,
-    (float)7.50095e-06,
-    (float)7.58625e-06,
-    (float)6.25672e-06,
-    (float)5.25431e-06,
-    (float)7.17529e-06,
-    (float)7.05499e-06,
-    (float)7.0574e-06,
-    (float)6.4485e-06,
-    (float)5.41521e-06,
-    (float)7.89075e-06,
-    (float)4.85609e-06,
-    (float)9.8045e-06,
-    (float)7.80759e-06,
-    (float)5.92347e-06,
-    (float)5.16334e-06,
-    (float)6.30779e-06,
-    (float)5.80473e-06,
-    (float)5.89879e-06,
-    (float)4.81007e-06,
-    (float)6.01519e-06,
-    (float)3.88546e-06,
-    (float)4.30586e-06,
-    (float)6.73383e-06,
-    (float)5.36443e-06,
-    (float)5.69738e-06,
-    (float)4.09402e-06,
-    (float)5.7124e-06,
-    (float)5.49438e-06,
-    (float)5.50558e-06,
-    (float)5.57337e-06,
-    (float)5.42293e-06,
-    (float)4.52058e-06,
-    (float)4.83256e-06,
-    (float)5.2266e-06,
-    (float)5.87761e-06,
-    (float)5.30894e-06,
-    (float)3.89948e-06,
-    (float)5.13178e-06,
-    (float)5.00623e-06,
-    (float)5.41698e-06,
-    (float)3.71824e-06,
-    (float)5.08673e-06,
-    (float)3.98261e-06,
-    (float)4.39087e-06,
-    (float)4.39608e-06,
-    (float)4.68986e-06,
-    (float)4.61399e-06,
-    (float)3.33156e-06,
-    (float)5.00805e-06,
-    (float)5.46098e-06,
-    (float)4.88975e-06,
-    (float)4.50806e-06,
-    (float)4.61466e-06,
-    (float)3.99077e-06,
-    (float)6.23968e-06,
-    (float)3.91958e-06,
-    (float)0.186466,
-    (float)0.229588,
-    (float)0.0807962,
-    (float)0.346779,
-    (float)0.1451,
-    (float)0.000215502,
-    (float)0.00623416,
-    (float)0.00071796,
-    (float)0.000476618,
-    (float)0.000679414,
-    (float)0.000142178,
-    (float)0.000490641,
-    (float)0.00022484,
-    (float)0.000258861,
-    (float)9.34143e-05,
-    (float)0.000102664,
-    (float)0.000154864,
-    (float)6.88965e-05,
-    (float)9.32755e-05,
-    (float)2.96802e-05,
-    (float)4.99711e-05,
-    (float)4.13939e-05,
-    (float)8.3351e-05,
-    (float)7.31366e-05,
-    (float)3.89195e-05,
-    (float)6.04161e-05,
-    (float)2.29293e-05,
-    (float)8.40792e-05,
-    (float)1.43447e-05,
-    (float)7.45752e-05,
-    (float)1.62473e-05,
-    (float)2.06339e-05,
-    (float)1.80748e-05,
-    (float)1.88765e-05,
-    (float)2.21449e-05,
-    (float)6.89754e-06,
-    (float)2.1371e-05,
-    (float)2.0027e-05,
-    (float)1.54511e-05,
-    (float)2.65482e-05,
-    (float)1.91894e-05,
-    (float)1.71808e-05,
-    (float)1.35207e-05,
-    (float)1.65412e-05,
-    (float)2.55941e-05,
-    (float)8.96854e-06,
-    (float)1.45583e-05,
-    (float)9.50721e-06,
-    (float)1.02788e-05,
-    (float)7.89551e-06,
-    (float)1.17709e-05,
-    (float)8.33918e-06,
-    (float)6.48236e-06,
-    (float)1.00899e-05,
-    (float)1.37706e-05,
-    (float)7.2737e-06,
-    (float)9.75395e-06,
-    (float)8.62826e-06,
-    (float)8.00852e-06,
-    (float)7.26531e-06,
-    (float)9.59293e-06,
-    (float)9.13038e-06,
-    (float)6.11616e-06,
-    (float)7.70628e-06,
-    (float)7.35602e-06,
-    (float)6.36957e-06,
-    (float)6.62438e-06,
-    (float)7.03664e-06,
-    (float)6.72645e-06,
-    (float)4.71323e-06,
-    (float)7.53971e-06,
-    (float)3.35071e-06,
-    (float)6.01509e-06,
-    (float)4.65244e-06,
-    (float)6.0314e-06,
-    (float)4.94525e-06,
-    (float)4.5897e-06,
-    (float)7.76815e-06,
-    (float)3.71705e-06,
-    (float)9.15761e-06,
-    (float)6.69966e-06,
-    (float)5.48589e-06,
-    (float)4.59809e-06,
-    (float)5.36067e-06,
-    (float)5.40194e-06,
-    (float)4.49488e-06,
-    (float)4.04947e-06,
-    (float)4.72467e-06,
-    (float)2.05301e-06,
-    (float)4.90447e-06,
-    (float)3.71384e-06,
-    (float)4.94717e-06,
-    (float)3.25989e-06,
-    (float)4.90192e-06,
-    (float)4.36352e-06,
-    (float)4.2167e-06,
-    (float)4.40369e-06,
-    (float)4.53815e-06,
-    (float)4.04106e-06,
-    (float)4.13408e-06,
-    (float)4.50847e-06,
-    (float)4.3295e-06,
-    (float)3.67449e-06,
-    (float)4.02877e-06,
-    (float)4.02814e-06,
-    (float)3.98474e-06,
-    (float)3.34387e-06,
-    (float)3.93795e-06,
-    (float)3.24365e-06,
-    (float)3.34171e-06,
-    (float)3.42858e-06,
-    (float)3.6056e-06,
-    (float)3.11829e-06,
-    (float)3.62591e-06,
-    (float)4.10048e-06,
-    (float)3.869e-06,
-    (float)3.84736e-06,
-    (float)3.86316e-06,
-    (float)4.42434e-06,
-    (float)2.97347e-06,
-    (float)5.19967e-06,
-    (float)2.96635e-06,
-    (float)3.99736e-06,
-    (float)2.95696e-06,
-    (float)4.02747e-06,
-    (float)3.18356e-06,
-    (float)2.76113e-06,
-    (float)3.69704e-06,
-    (float)0.146367,
-    (float)0.220925,
-    (float)0.159531,
-    (float)0.377737,
-    (float)0.0853315,
-    (float)0.00282529,
-    (float)0.0024415,
-    (float)0.00183516,
-    (float)2.46288e-05,
-    (float)0.000634163,
-    (float)0.000175044,
-    (float)0.000242207,
-    (float)0.000402575,
-    (float)3.57606e-05,
-    (float)0.000147674,
-    (float)7.09388e-05,
-    (float)7.65086e-05,
-    (float)9.0257e-05,
-    (float)2.4962e-05,
-    (float)6.30154e-05,
-    (float)6.18369e-05,
-    (float)4.69794e-05,
-    (float)5.35352e-05,
-    (float)1.77268e-05,
-    (float)5.78847e-05,
-    (float)4.69775e-05,
-    (float)6.58982e-05,
-    (float)3.21075e-05,
-    (float)3.65947e-05,
-    (float)1.20374e-05,
-    (float)1.09411e-05,
-    (float)2.66031e-05,
-    (float)1.87752e-05,
-    (float)1.16388e-05,
-    (float)8.54636e-06,
-    (float)1.97457e-05,
-    (float)1.00764e-05,
-    (float)2.51232e-05,
-    (float)1.56711e-05,
-    (float)1.27987e-05,
-    (float)9.89198e-06,
-    (float)1.6086e-05,
-    (float)2.64526e-05,
-    (float)5.36289e-06,
-    (float)1.32034e-05,
-    (float)4.64634e-06,
-    (float)6.81299e-06,
-    (float)7.98169e-06,
-    (float)1.03219e-05,
-    (float)7.59565e-06,
-    (float)4.32422e-06,
-    (float)1.40151e-05,
-    (float)7.0268e-06,
-    (float)7.47262e-06,
-    (float)7.34804e-06,
-    (float)6.81341e-06,
-    (float)5.94203e-06,
-    (float)7.69036e-06,
-    (float)8.03782e-06,
-    (float)4.65851e-06,
-    (float)5.90243e-06,
-    (float)6.01644e-06,
-    (float)5.41574e-06,
-    (float)5.88793e-06,
-    (float)5.59243e-06,
-    (float)5.24049e-06,
-    (float)4.76887e-06,
-    (float)5.13486e-06,
-    (float)3.77014e-06,
-    (float)4.39904e-06,
-    (float)5.2643e-06,
-    (float)3.11698e-06,
-    (float)3.99272e-06,
-    (float)4.12589e-06,
-    (float)4.67841e-06,
-    (float)6.12194e-06,
-    (float)6.97607e-06,
-    (float)3.59133e-06,
-    (float)2.9519e-06,
-    (float)4.54008e-06,
-    (float)4.59004e-06,
-    (float)4.03238e-06,
-    (float)3.67883e-06,
-    (float)3.34162e-06,
-    (float)1.57743e-06,
-    (float)4.30855e-06,
-    (float)3.90083e-06,
-    (float)3.54334e-06,
-    (float)3.11639e-06,
-    (float)3.61129e-06,
-    (float)3.93877e-06,
-    (float)3.18194e-06,
-    (float)5.02307e-06,
-    (float)2.66751e-06,
-    (float)2.86721e-06,
-    (float)3.06902e-06,
-    (float)3.36471e-06,
-    (float)2.9736e-06,
-    (float)2.83305e-06,
-    (float)3.57827e-06,
-    (float)3.29004e-06,
-    (float)2.7965e-06,
-    (float)3.0922e-06,
-    (float)2.35487e-06,
-    (float)2.58959e-06,
-    (float)2.97587e-06,
-    (float)2.7848e-06,
-    (float)2.9634e-06,
-    (float)1.89766e-06,
-    (float)3.48685e-06,
-    (float)2.51024e-06,
-    (float)3.51245e-06,
-    (float)2.58327e-06,
-    (float)2.95007e-06,
-    (float)3.59279e-06,
-    (float)2.79933e-06,
-    (float)3.12275e-06,
-    (float)2.59655e-06,
-    (float)2.77595e-06,
-    (float)2.50062e-06,
-    (float)3.08071e-06,
-    (float)2.83985e-06,
-    (float)1.63687e-06,
-    (float)2.89745e-06,
-    (float)3.78119e-06,
-    (float)2.50956e-06,
-    (float)2.44727e-06,
-    (float)2.32162e-06,
-    (float)0.110556,
-    (float)0.20185,
-    (float)0.266324,
-    (float)0.371588,
-    (float)0.0383498,
-    (float)0.00691858,
-    (float)0.00025443,
-    (float)0.00146525,
-    (float)0.000579129,
-    (float)0.000104794,
-    (float)0.000345529,
-    (float)0.000230283,
-    (float)0.000143606,
-    (float)0.000189768,
-    (float)2.88211e-05,
-    (float)9.75052e-05,
-    (float)4.44519e-05,
-    (float)7.9034e-06,
-    (float)7.73994e-05,
-    (float)3.79492e-05,
-    (float)6.43622e-05,
-    (float)6.63017e-05,
-    (float)8.22525e-06,
-    (float)3.08881e-05,
-    (float)4.24021e-05,
-    (float)4.1925e-05,
-    (float)5.68816e-05,
-    (float)2.26258e-05,
-    (float)1.60157e-05,
-    (float)1.09453e-05,
-    (float)1.13678e-05,
-    (float)1.46473e-05,
-    (float)1.16161e-06,
-    (float)2.05441e-05,
-    (float)9.20712e-06,
-    (float)2.04368e-05,
-    (float)1.30046e-05,
-    (float)1.22479e-05,
-    (float)8.00826e-06,
-    (float)1.36014e-05,
-    (float)2.37848e-05,
-    (float)3.72642e-06,
-    (float)9.94448e-06,
-    (float)3.40304e-06,
-    (float)6.6716e-06,
-    (float)9.43841e-06,
-    (float)7.62124e-06,
-    (float)5.02067e-06,
-    (float)4.2833e-06,
-    (float)8.57796e-06,
-    (float)5.18739e-06,
-    (float)6.58878e-06,
-    (float)7.37851e-06,
-    (float)4.67212e-06,
-    (float)5.42701e-06,
-    (float)7.1007e-06,
-    (float)4.4245e-06,
-    (float)4.58274e-06,
-    (float)4.81752e-06,
-    (float)4.32737e-06,
-    (float)5.22523e-06,
-    (float)5.31135e-06,
-    (float)4.44751e-06,
-    (float)3.76226e-06,
-    (float)3.40645e-06,
-    (float)3.2952e-06,
-    (float)2.91534e-06,
-    (float)4.5306e-06,
-    (float)2.2287e-06,
-    (float)2.61844e-06,
-    (float)4.38477e-06,
-    (float)2.40521e-06,
-    (float)7.82184e-06,
-    (float)3.41355e-06,
-    (float)3.87572e-06,
-    (float)2.61281e-06,
-    (float)3.32255e-06,
-    (float)4.1303e-06,
-    (float)2.37364e-06,
-    (float)4.12845e-06,
-    (float)8.34064e-07,
-    (float)2.9289e-06,
-    (float)2.64028e-06,
-    (float)2.64787e-06,
-    (float)2.30182e-06,
-    (float)2.62759e-06,
-    (float)2.88583e-06,
-    (float)2.76864e-06,
-    (float)3.75556e-06,
-    (float)2.15651e-06,
-    (float)2.32373e-06,
-    (float)2.69604e-06,
-    (float)2.58019e-06,
-    (float)2.64343e-06,
-    (float)2.4211e-06,
-    (float)2.65384e-06,
-    (float)2.72225e-06,
-    (float)2.52089e-06,
-    (float)2.39769e-06,
-    (float)2.50455e-06,
-    (float)1.57943e-06,
-    (float)1.85683e-06,
-    (float)1.8461e-06,
-    (float)1.42865e-06,
-    (float)2.86198e-06,
-    (float)1.62403e-06,
-    (float)2.88823e-06,
-    (float)2.0543e-06,
-    (float)2.28208e-06,
-    (float)3.21605e-06,
-    (float)1.76323e-06,
-    (float)2.69806e-06,
-    (float)1.95413e-06,
-    (float)2.26485e-06,
-    (float)2.15385e-06,
-    (float)1.80025e-06,
-    (float)1.95495e-06,
-    (float)1.53276e-06,
-    (float)2.25105e-06,
-    (float)2.38513e-06,
-    (float)1.68407e-06,
-    (float)1.94002e-06,
-    (float)1.82326e-06,
-    (float)2.08656e-06,
-    (float)2.49108e-06,
-    (float)2.22047e-06,
-    (float)1.94328e-06,
-    (float)1.53488e-06,
-    (float)0.0795829,
-    (float)0.17329,
-    (float)0.395929,
-    (float)0.329647,
-    (float)0.0108762,
-    (float)0.00726772,
-    (float)0.000554286,
-    (float)0.000377588,
-    (float)0.00083509,
-    (float)0.000123202,
-    (float)0.000157544,
-    (float)0.000315658,
-    (float)4.72359e-05,
-    (float)7.67003e-05,
-    (float)0.000137613,
-    (float)2.69951e-05,
-    (float)1.3212e-05,
-    (float)5.09646e-05,
-    (float)1.0711e-05,
-    (float)6.58655e-05,
-    (float)5.54168e-05,
-    (float)1.38614e-05,
-    (float)3.74445e-05,
-    (float)5.91665e-05,
-    (float)1.38586e-05,
-    (float)4.47137e-05,
-    (float)1.03131e-05,
-    (float)1.18442e-05,
-    (float)1.83156e-05,
-    (float)1.29118e-05,
-    (float)1.07118e-05,
-    (float)5.72817e-06,
-    (float)1.12123e-05,
-    (float)6.33301e-06,
-    (float)1.65156e-05,
-    (float)1.16818e-05,
-    (float)6.77441e-06,
-    (float)1.0928e-05,
-    (float)1.85063e-05,
-    (float)7.74542e-06,
-    (float)7.87686e-06,
-    (float)3.25246e-06,
-    (float)5.73612e-06,
-    (float)6.84444e-06,
-    (float)4.86508e-06,
-    (float)2.68937e-06,
-    (float)3.45648e-06,
-    (float)7.89159e-06,
-    (float)6.0197e-06,
-    (float)6.31797e-06,
-    (float)5.39123e-06,
-    (float)3.05762e-06,
-    (float)3.8357e-06,
-    (float)4.63271e-06,
-    (float)3.22062e-06,
-    (float)3.63524e-06,
-    (float)4.1091e-06,
-    (float)3.44601e-06,
-    (float)4.15977e-06,
-    (float)4.74773e-06,
-    (float)2.37852e-06,
-    (float)3.6263e-06,
-    (float)1.60978e-06,
-    (float)2.67992e-06,
-    (float)3.54316e-06,
-    (float)2.16364e-06,
-    (float)1.77876e-06,
-    (float)3.40844e-06,
-    (float)1.61127e-06,
-    (float)7.25928e-06,
-    (float)2.75138e-06,
-    (float)2.82126e-06,
-    (float)2.37471e-06,
-    (float)2.62246e-06,
-    (float)2.60507e-06,
-    (float)2.31658e-06,
-    (float)1.81889e-06,
-    (float)1.47134e-06,
-    (float)2.48375e-06,
-    (float)2.55342e-06,
-    (float)1.3914e-06,
-    (float)1.89932e-06,
-    (float)2.06766e-06,
-    (float)2.04429e-06,
-    (float)3.26392e-06,
-    (float)2.00486e-06,
-    (float)1.77396e-06,
-    (float)1.51836e-06,
-    (float)2.07593e-06,
-    (float)1.65985e-06,
-    (float)2.1198e-06,
-    (float)2.02456e-06,
-    (float)1.8016e-06,
-    (float)1.80554e-06,
-    (float)1.80298e-06,
-    (float)1.76038e-06,
-    (float)1.67705e-06,
-    (float)1.04881e-06,
-    (float)1.90664e-06,
-    (float)8.80099e-07,
-    (float)2.56217e-06,
-    (float)1.42694e-06,
-    (float)1.80692e-06,
-    (float)1.82544e-06,
-    (float)2.32772e-06,
-    (float)1.93699e-06,
-    (float)2.15402e-06,
-    (float)1.0876e-06,
-    (float)1.51321e-06,
-    (float)1.50129e-06,
-    (float)1.34371e-06,
-    (float)1.20126e-06,
-    (float)1.16739e-06,
-    (float)1.63178e-06,
-    (float)2.17435e-06,
-    (float)1.32326e-06,
-    (float)1.31063e-06,
-    (float)1.26053e-06,
-    (float)1.66665e-06,
-    (float)1.89597e-06,
-    (float)1.74157e-06,
-    (float)7.80011e-07,
-    (float)1.6972e-06,
-    (float)1.57827e-06,
-    (float)1.42194e-06,
-    (float)1.81908e-06,
-    (float)1.37283e-06,
-    (float)1.41878e-06,
-    (float)0.053846,
-    (float)0.137971,
-    (float)0.538535,
-    (float)0.261045,
-    (float)0.000854889,
-    (float)0.00440475,
-    (float)0.00145237,
-    (float)3.87722e-05,
-    (float)0.000384015,
-    (float)0.000319538,
-    (float)0.000195592,
-    (float)7.67022e-05,
-    (float)0.000137481,
-    (float)4.8862e-05,
-    (float)4.94463e-05,
-    (float)5.19595e-05,
-    (float)4.1244e-05,
-    (float)8.30206e-06,
-    (float)5.59077e-05,
-    (float)1.95726e-05,
-    (float)9.84662e-06,
-    (float)3.34443e-05,
-    (float)5.78943e-05,
-    (float)1.94466e-05,
-    (float)5.7194e-05,
-    (float)3.65068e-06,
-    (float)2.5469e-06,
-    (float)8.55852e-06,
-    (float)7.4628e-06,
-    (float)7.14356e-06,
-    (float)1.04791e-05,
-    (float)7.75439e-06,
-    (float)1.6194e-05,
-    (float)9.17127e-06,
-    (float)6.95261e-06,
-    (float)4.00412e-06,
-    (float)9.90108e-06,
-    (float)1.82393e-05,
-    (float)2.77294e-06,
-    (float)4.6956e-06,
-    (float)3.74165e-06,
-    (float)2.95977e-06,
-    (float)4.79667e-06,
-    (float)3.49691e-06,
-    (float)2.85417e-06,
-    (float)7.5762e-06,
-    (float)4.58302e-06,
-    (float)3.9e-06,
-    (float)2.60562e-06,
-    (float)1.40019e-06,
-    (float)3.55759e-06,
-    (float)4.1174e-06,
-    (float)3.62733e-06,
-    (float)3.9467e-06,
-    (float)2.70982e-06,
-    (float)2.8396e-06,
-    (float)3.51629e-06,
-    (float)1.86819e-06,
-    (float)3.16192e-06,
-    (float)1.18685e-06,
-    (float)2.0377e-06,
-    (float)2.11161e-06,
-    (float)1.91042e-06,
-    (float)1.34121e-06,
-    (float)2.16073e-06,
-    (float)1.10282e-06,
-    (float)5.58195e-06,
-    (float)2.73039e-06,
-    (float)2.44775e-06,
-    (float)1.92605e-06,
-    (float)2.05258e-06,
-    (float)1.86381e-06,
-    (float)2.03944e-06,
-    (float)1.26792e-06,
-    (float)1.35616e-06,
-    (float)1.92906e-06,
-    (float)2.21006e-06,
-    (float)1.18695e-06,
-    (float)1.43189e-06,
-    (float)1.13278e-06,
-    (float)1.61639e-06,
-    (float)2.30016e-06,
-    (float)1.42269e-06,
-    (float)1.11133e-06,
-    (float)1.95123e-06,
-    (float)1.1048e-06,
-    (float)1.6181e-06,
-    (float)1.18312e-06,
-    (float)1.58947e-06,
-    (float)1.42096e-06,
-    (float)1.72347e-06,
-    (float)1.19686e-06,
-    (float)1.33475e-06,
-    (float)5.22349e-07,
-    (float)9.78312e-07,
-    (float)6.479e-07,
-    (float)1.5e-06,
-    (float)1.51853e-06,
-    (float)1.27002e-06,
-    (float)1.05059e-06,
-    (float)2.18727e-06,
-    (float)1.00371e-06,
-    (float)1.60114e-06,
-    (float)9.51947e-07,
-    (float)1.17347e-06,
-    (float)1.22254e-06,
-    (float)1.50574e-06,
-    (float)5.99975e-07,
-    (float)1.2913e-06,
-    (float)1.41998e-06,
-    (float)1.10708e-06,
-    (float)9.3116e-07,
-    (float)1.26547e-06,
-    (float)6.7703e-07,
-    (float)1.26504e-06,
-    (float)1.17104e-06,
-    (float)4.22889e-07,
-    (float)9.15286e-07,
-    (float)1.3095e-06,
-    (float)1.05231e-06,
-    (float)1.79521e-06,
-    (float)9.43975e-07,
-    (float)8.35282e-07,
-    (float)9.51164e-07,
-    (float)1.31555e-06,
-    (float)9.56318e-07,
-    (float)1.31145e-06,
-    (float)7.16797e-07,
-    (float)0.0333382,
-    (float)0.099353,
-    (float)0.681536,
-    (float)0.180519,
-    (float)0.000955548,
-    (float)0.00137095,
-    (float)0.00136735,
-    (float)0.000357889,
-    (float)5.06661e-05,
-    (float)0.000204477,
-    (float)0.000280294,
-    (float)2.67388e-05,
-    (float)2.62672e-05,
-    (float)9.26304e-05,
-    (float)4.54142e-05,
-    (float)4.88485e-06,
-    (float)2.51415e-05,
-    (float)8.19157e-05,
-    (float)1.08968e-05,
-    (float)9.73582e-06,
-    (float)1.64628e-05,
-    (float)2.27583e-05,
-    (float)2.53376e-05,
-    (float)5.45513e-05,
-    (float)8.65592e-06,
-    (float)5.79086e-06,
-    (float)1.24844e-05,
-    (float)7.21202e-06,
-    (float)1.21076e-06,
-    (float)7.80224e-06,
-    (float)5.44556e-07,
-    (float)1.15684e-05,
-    (float)7.43143e-06,
-    (float)5.19703e-06,
-    (float)8.14295e-06,
-    (float)1.75587e-05,
-    (float)2.70325e-06,
-    (float)6.01363e-06,
-    (float)9.89584e-07,
-    (float)1.33124e-06,
-    (float)5.40709e-06,
-    (float)2.78573e-06,
-    (float)4.98314e-07,
-    (float)5.70112e-06,
-    (float)2.09614e-06,
-    (float)2.54933e-06,
-    (float)3.11487e-06,
-    (float)2.04112e-06,
-    (float)4.101e-06,
-    (float)3.19613e-06,
-    (float)2.28202e-06,
-    (float)2.19669e-06,
-    (float)9.36264e-07,
-    (float)1.52593e-06,
-    (float)3.06149e-06,
-    (float)1.41044e-06,
-    (float)3.25689e-06,
-    (float)8.18236e-07,
-    (float)1.40285e-06,
-    (float)1.97018e-06,
-    (float)9.10998e-07,
-    (float)6.87791e-07,
-    (float)1.89952e-06,
-    (float)2.34255e-06,
-    (float)3.49438e-06,
-    (float)1.82203e-06,
-    (float)9.10973e-07,
-    (float)1.67222e-06,
-    (float)1.98447e-06,
-    (float)1.22294e-06,
-    (float)1.41477e-06,
-    (float)8.20514e-07,
-    (float)1.10576e-06,
-    (float)1.45304e-06,
-    (float)9.9644e-07,
-    (float)1.08982e-06,
-    (float)7.34248e-07,
-    (float)1.45297e-06,
-    (float)1.31345e-06,
-    (float)9.77126e-07,
-    (float)1.05697e-06,
-    (float)1.29334e-06,
-    (float)1.18949e-06,
-    (float)1.2584e-06,
-    (float)1.33252e-06,
-    (float)6.61635e-07,
-    (float)1.00003e-06,
-    (float)8.1171e-07,
-    (float)7.22777e-07,
-    (float)7.80727e-07,
-    (float)7.3853e-07,
-    (float)1.72083e-07,
-    (float)1.35342e-06,
-    (float)8.1092e-07,
-    (float)6.94941e-07,
-    (float)1.26034e-06,
-    (float)1.72402e-06,
-    (float)7.84954e-07,
-    (float)1.33566e-06,
-    (float)5.25952e-07,
-    (float)4.55955e-07,
-    (float)7.40021e-07,
-    (float)7.19039e-07,
-    (float)4.63276e-07,
-    (float)1.07317e-06,
-    (float)1.05354e-06,
-    (float)8.26613e-07,
-    (float)7.85866e-07,
-    (float)5.69161e-07,
-    (float)7.15599e-07,
-    (float)7.64748e-07,
-    (float)5.37163e-07,
-    (float)8.02801e-07,
-    (float)7.62137e-07,
-    (float)1.04866e-06,
-    (float)9.14132e-07,
-    (float)8.94463e-07,
-    (float)7.06705e-07,
-    (float)6.08902e-07,
-    (float)5.93228e-07,
-    (float)6.48814e-07,
-    (float)5.02774e-07,
-    (float)3.56804e-07,
-    (float)7.51677e-07,
-    (float)6.11921e-07,
-    (float)1.41325e-06,
-    (float)7.37286e-07,
-    (float)6.50219e-07,
-    (float)0.0180021,
-    (float)0.0615854,
-    (float)0.811125,
-    (float)0.103958,
-    (float)0.00332212,
-    (float)9.12915e-05,
-    (float)0.0005741,
-    (float)0.000442131,
-    (float)0.000101626,
-    (float)0.000161631,
-    (float)9.43019e-05,
-    (float)8.18167e-05,
-    (float)2.63427e-05,
-    (float)1.59458e-05,
-    (float)2.67425e-05,
-    (float)5.21589e-05,
-    (float)3.13688e-05,
-    (float)1.49267e-05,
-    (float)3.43584e-05,
-    (float)2.15658e-05,
-    (float)1.6699e-05,
-    (float)2.03017e-05,
-    (float)2.65679e-05,
-    (float)7.92372e-06,
-    (float)4.34663e-06,
-    (float)1.04341e-05,
-    (float)1.09033e-05,
-    (float)7.2602e-07,
-    (float)1.29791e-05,
-    (float)3.57833e-06,
-    (float)8.58062e-06,
-    (float)3.80724e-06,
-    (float)5.62672e-07,
-    (float)3.53126e-06,
-    (float)1.65978e-05,
-    (float)6.58924e-07,
-    (float)3.28225e-06,
-    (float)2.64199e-06,
-    (float)3.30112e-06,
-    (float)1.64087e-06,
-    (float)4.65036e-07,
-    (float)4.45864e-06,
-    (float)1.92519e-06,
-    (float)2.24857e-06,
-    (float)2.96804e-06,
-    (float)1.19521e-06,
-    (float)1.87923e-06,
-    (float)1.60502e-06,
-    (float)8.57729e-07,
-    (float)1.17801e-06,
-    (float)1.04612e-06,
-    (float)1.90924e-06,
-    (float)3.34441e-06,
-    (float)1.27911e-06,
-    (float)1.97476e-06,
-    (float)6.95025e-07,
-    (float)4.76222e-07,
-    (float)7.60501e-07,
-    (float)3.88715e-07,
-    (float)5.64464e-07,
-    (float)3.98123e-07,
-    (float)4.51699e-06,
-    (float)1.31864e-06,
-    (float)1.03819e-06,
-    (float)1.47804e-06,
-    (float)1.29003e-06,
-    (float)5.13346e-07,
-    (float)2.16325e-06,
-    (float)1.49952e-07,
-    (float)6.61241e-07,
-    (float)1.11255e-06,
-    (float)5.8748e-07,
-    (float)5.58952e-07,
-    (float)4.94778e-07,
-    (float)1.05643e-06,
-    (float)7.33007e-07,
-    (float)4.78475e-07,
-    (float)6.36615e-07,
-    (float)8.29353e-07,
-    (float)8.4014e-07,
-    (float)8.17397e-07,
-    (float)1.37791e-06,
-    (float)4.57403e-07,
-    (float)5.53301e-07,
-    (float)5.36736e-07,
-    (float)6.60065e-07,
-    (float)2.62648e-07,
-    (float)6.82971e-07,
-    (float)7.13979e-07,
-    (float)5.2359e-07,
-    (float)7.18491e-07,
-    (float)6.95836e-07,
-    (float)5.78892e-07,
-    (float)6.36888e-07,
-    (float)1.0922e-06,
-    (float)2.95725e-07,
-    (float)4.00536e-07,
-    (float)6.54076e-07,
-    (float)5.8906e-07,
-    (float)1.43155e-07,
-    (float)5.19781e-07,
-    (float)9.7542e-07,
-    (float)3.95328e-07,
-    (float)5.1726e-07,
-    (float)5.23315e-07,
-    (float)5.69683e-07,
-    (float)4.55329e-07,
-    (float)1.95633e-07,
-    (float)5.75143e-07,
-    (float)3.99274e-07,
-    (float)4.58345e-07,
-    (float)5.85471e-07,
-    (float)5.24184e-07,
-    (float)5.71729e-07,
-    (float)6.07199e-07,
-    (float)4.43166e-07,
-    (float)4.79714e-07,
-    (float)4.00087e-07,
-    (float)4.02114e-07,
-    (float)3.75809e-07,
-    (float)7.16946e-07,
-    (float)6.48577e-07,
-    (float)2.73295e-07,
-    (float)4.00241e-07,
-    (float)5.83557e-07,
-    (float)4.13608e-07,
-    (float)4.18914e-07,
-    (float)2.60772e-07,
-    (float)0.00760909,
-    (float)0.0293672,
-    (float)0.913844,
-    (float)0.0445941,
-    (float)0.00347263,
-    (float)0.000157982,
-    (float)6.87995e-05,
-    (float)0.000168226,
-    (float)0.000107186,
-    (float)0.000237505,
-    (float)7.9263e-06,
-    (float)1.15788e-05,
-    (float)3.32782e-05,
-    (float)1.97982e-05,
-    (float)2.65515e-06,
-    (float)3.23799e-05,
-    (float)3.44228e-05,
-    (float)2.85391e-05,
-    (float)5.92549e-06,
-    (float)6.05506e-06,
-    (float)4.82424e-05,
-    (float)2.55097e-05,
-    (float)5.50777e-06,
-    (float)4.20287e-07,
-    (float)1.71396e-06,
-    (float)2.30059e-06,
-    (float)6.74497e-06,
-    (float)6.00954e-06,
-    (float)1.52878e-06,
-    (float)8.61223e-06,
-    (float)6.89475e-06,
-    (float)3.13644e-06,
-    (float)8.30415e-06,
-    (float)7.35181e-06,
-    (float)2.20105e-06,
-    (float)7.10908e-08,
-    (float)3.02272e-07,
-    (float)2.45796e-06,
-    (float)1.66058e-06,
-    (float)7.25526e-07,
-    (float)3.01584e-06,
-    (float)1.38798e-06,
-    (float)1.46399e-06,
-    (float)5.13842e-07,
-    (float)4.87783e-07,
-    (float)2.18752e-06,
-    (float)1.13172e-06,
-    (float)1.35253e-06,
-    (float)1.0203e-06,
-    (float)1.34916e-06,
-    (float)2.10415e-06,
-    (float)1.52925e-07,
-    (float)9.03895e-07,
-    (float)8.72475e-08,
-    (float)1.41886e-07,
-    (float)8.01082e-07,
-    (float)4.01645e-07,
-    (float)1.24839e-06,
-    (float)2.78502e-07,
-    (float)4.03577e-06,
-    (float)9.57297e-07,
-    (float)2.29039e-07,
-    (float)7.20059e-07,
-    (float)9.66464e-07,
-    (float)7.38301e-07,
-    (float)7.22926e-07,
-    (float)4.8327e-07,
-    (float)6.064e-07,
-    (float)2.37397e-07,
-    (float)2.62524e-07,
-    (float)3.5469e-07,
-    (float)4.14089e-07,
-    (float)7.76027e-07,
-    (float)4.51045e-07,
-    (float)4.20316e-07,
-    (float)7.16513e-07,
-    (float)5.68298e-07,
-    (float)4.26313e-07,
-    (float)9.27209e-07,
-    (float)2.99755e-07,
-    (float)3.72235e-07,
-    (float)2.16073e-07,
-    (float)4.77576e-07,
-    (float)3.7338e-08,
-    (float)1.799e-07,
-    (float)6.33184e-07,
-    (float)2.82686e-07,
-    (float)3.78828e-07,
-    (float)4.42845e-07,
-    (float)1.00409e-06,
-    (float)2.06279e-07,
-    (float)5.36637e-07,
-    (float)3.99111e-07,
-    (float)3.01434e-07,
-    (float)2.95534e-07,
-    (float)3.28431e-07,
-    (float)2.71618e-07,
-    (float)4.82778e-07,
-    (float)1.77373e-07,
-    (float)1.63608e-07,
-    (float)2.67844e-07,
-    (float)2.80579e-07,
-    (float)3.10099e-07,
-    (float)1.72945e-07,
-    (float)5.72826e-07,
-    (float)3.19006e-07,
-    (float)3.24459e-07,
-    (float)5.71982e-07,
-    (float)2.92484e-07,
-    (float)1.32996e-07,
-    (float)2.81279e-07,
-    (float)1.93432e-07,
-    (float)2.84238e-07,
-    (float)7.73534e-08,
-    (float)4.32129e-07,
-    (float)3.15831e-07,
-    (float)4.28434e-07,
-    (float)2.63697e-07,
-    (float)2.64713e-07,
-    (float)2.89689e-07,
-    (float)2.90272e-07,
-    (float)4.67931e-07,
-    (float)1.75778e-07,
-    (float)2.3502e-07,
-    (float)4.07801e-07,
-    (float)1.75591e-07,
-    (float)1.89443e-07,
-    (float)9.09367e-08,
-    (float)0.00177698,
-    (float)0.00739887,
-    (float)0.97887,
-    (float)0.00983144,
-    (float)0.00138444,
-    (float)0.000227922,
-    (float)2.40587e-05,
-    (float)1.04595e-05,
-    (float)7.5573e-05,
-    (float)0.000111821,
-    (float)3.59265e-05,
-    (float)1.37036e-05,
-    (float)2.43853e-06,
-    (float)1.09133e-05,
-    (float)2.28718e-05,
-    (float)3.25072e-05,
-    (float)4.28537e-07,
-    (float)4.9589e-06,
-    (float)5.50552e-06,
-    (float)4.79667e-05,
-    (float)4.47015e-06,
-    (float)2.57122e-05,
-    (float)2.63476e-06,
-    (float)4.63358e-06,
-    (float)1.51809e-06,
-    (float)6.32453e-06,
-    (float)4.38635e-06,
-    (float)4.05897e-06,
-    (float)1.27516e-06,
-    (float)2.01231e-06,
-    (float)5.33541e-07,
-    (float)8.0613e-06,
-    (float)6.16799e-06,
-    (float)4.21953e-06,
-    (float)6.91175e-07,
-    (float)9.22983e-07,
-    (float)1.12183e-06,
-    (float)3.08947e-07,
-    (float)3.21657e-06,
-    (float)2.82495e-07,
-    (float)4.62139e-07,
-    (float)9.02949e-07,
-    (float)1.60618e-07,
-    (float)1.67027e-06,
-    (float)4.44947e-07,
-    (float)3.53258e-07,
-    (float)3.55039e-07,
-    (float)2.21139e-07,
-    (float)7.15543e-07,
-    (float)2.58774e-07,
-    (float)1.54493e-06,
-    (float)7.59478e-08,
-    (float)4.0614e-07,
-    (float)7.20802e-07,
-    (float)2.26415e-07,
-    (float)1.10729e-06,
-    (float)9.29656e-07,
-    (float)1.96641e-06,
-    (float)2.25255e-07,
-    (float)3.3468e-08,
-    (float)3.46423e-07,
-    (float)6.37976e-07,
-    (float)1.69919e-06,
-    (float)2.25038e-07,
-    (float)2.7793e-07,
-    (float)5.27009e-07,
-    (float)1.07336e-07,
-    (float)2.82565e-07,
-    (float)3.34743e-08,
-    (float)6.70295e-07,
-    (float)2.78045e-07,
-    (float)1.70628e-07,
-    (float)4.71761e-07,
-    (float)1.24435e-07,
-    (float)2.71228e-07,
-    (float)5.46336e-07,
-    (float)4.90032e-08,
-    (float)1.60237e-07,
-    (float)1.14524e-07,
-    (float)3.40639e-07,
-    (float)1.40066e-08,
-    (float)2.17368e-07,
-    (float)3.66368e-07,
-    (float)1.5364e-07,
-    (float)2.23809e-07,
-    (float)1.10202e-07,
-    (float)9.07919e-07,
-    (float)2.78125e-07,
-    (float)1.91204e-07,
-    (float)1.88636e-07,
-    (float)9.81401e-08,
-    (float)1.87759e-07,
-    (float)7.99895e-10,
-    (float)2.68036e-07,
-    (float)3.43283e-07,
-    (float)1.26829e-07,
-    (float)1.93913e-07,
-    (float)3.24033e-08,
-    (float)2.65354e-07,
-    (float)1.67604e-07,
-    (float)1.34267e-07,
-    (float)2.11888e-07,
-    (float)9.8146e-08,
-    (float)3.45167e-07,
-    (float)1.0783e-07,
-    (float)1.99211e-07,
-    (float)1.36341e-07,
-    (float)7.2971e-08,
-    (float)1.93821e-07,
-    (float)2.16866e-08,
-    (float)1.16533e-07,
-    (float)1.06492e-07,
-    (float)5.33165e-07,
-    (float)8.00718e-08,
-    (float)7.30177e-08,
-    (float)3.02876e-07,
-    (float)8.71094e-08,
-    (float)2.19672e-07,
-    (float)3.70384e-08,
-    (float)1.68703e-07,
-    (float)1.71658e-07,
-    (float)3.4123e-08,
-    (float)2.22347e-07,
-    (float)6.38961e-08,
-    (float)9.44267e-08,
-    (float)2.62697e-07,
-    (float)7.6809e-08,
-    (float)2.22933e-07,
-    (float)3.27754e-06,
-    (float)4.67466e-05,
-    (float)0.999397,
-    (float)6.59608e-05,
-    (float)2.19042e-05,
-    (float)7.16762e-06,
-    (float)9.27421e-06,
-    (float)8.25373e-06,
-    (float)0.000224206,
-    (float)4.47289e-06,
-    (float)2.64773e-06,
-    (float)6.06368e-06,
-    (float)4.63596e-06,
-    (float)1.15226e-05,
-    (float)6.62592e-05,
-    (float)3.34987e-06,
-    (float)7.74752e-07,
-    (float)1.32547e-06,
-    (float)9.29359e-06,
-    (float)7.72578e-06,
-    (float)3.3092e-05,
-    (float)1.35504e-06,
-    (float)4.16805e-07,
-    (float)3.01989e-06,
-    (float)4.32626e-06,
-    (float)1.18994e-05,
-    (float)7.90857e-06,
-    (float)2.55396e-06,
-    (float)4.1761e-07,
-    (float)1.55036e-06,
-    (float)6.15758e-06,
-    (float)3.3335e-06,
-    (float)1.28659e-06,
-    (float)1.73875e-07,
-    (float)1.34835e-07,
-    (float)1.01484e-06,
-    (float)7.41594e-07,
-    (float)2.62083e-06,
-    (float)4.0345e-07,
-    (float)5.64527e-07,
-    (float)1.03958e-07,
-    (float)5.94269e-07,
-    (float)4.60646e-07,
-    (float)4.85656e-08,
-    (float)2.86922e-07,
-    (float)6.69482e-08,
-    (float)5.10232e-07,
-    (float)5.79374e-07,
-    (float)8.851e-07,
-    (float)1.17544e-07,
-    (float)4.70994e-08,
-    (float)7.43673e-08,
-    (float)3.90004e-08,
-    (float)2.61822e-07,
-    (float)6.30199e-07,
-    (float)1.45689e-06,
-    (float)4.32659e-07,
-    (float)1.29125e-07,
-    (float)5.01517e-07,
-    (float)4.63221e-07,
-    (float)1.48403e-06,
-    (float)3.91567e-07,
-    (float)1.62066e-07,
-    (float)6.90908e-08,
-    (float)3.42521e-08,
-    (float)5.18284e-08,
-    (float)9.54653e-08,
-    (float)2.47236e-07,
-    (float)4.60298e-08,
-    (float)4.41714e-08,
-    (float)9.41767e-08,
-    (float)1.91003e-07,
-    (float)1.12379e-07,
-    (float)7.63468e-08,
-    (float)1.02437e-07,
-    (float)7.80393e-08,
-    (float)4.63288e-08,
-    (float)1.48468e-07,
-    (float)3.8031e-07,
-    (float)2.31528e-07,
-    (float)8.01262e-08,
-    (float)1.60687e-07,
-    (float)7.39386e-08,
-    (float)5.764e-07,
-    (float)2.00674e-07,
-    (float)1.75627e-08,
-    (float)3.9782e-08,
-    (float)1.95606e-08,
-    (float)3.24901e-08,
-    (float)3.38012e-08,
-    (float)1.34716e-07,
-    (float)5.58412e-08,
-    (float)4.43329e-08,
-    (float)3.46567e-08,
-    (float)3.90792e-08,
-    (float)1.28759e-07,
-    (float)4.81641e-08,
-    (float)1.56114e-07,
-    (float)8.44313e-08,
-    (float)1.70877e-07,
-    (float)3.70649e-08,
-    (float)5.17553e-08,
-    (float)9.57956e-08,
-    (float)4.62109e-08,
-    (float)5.78302e-08,
-    (float)1.29658e-08,
-    (float)1.57296e-07,
-    (float)5.02659e-08,
-    (float)1.28589e-07,
-    (float)2.32344e-09,
-    (float)1.19484e-08,
-    (float)1.51152e-08,
-    (float)2.14489e-08,
-    (float)1.96519e-07,
-    (float)3.69387e-08,
-    (float)6.0813e-08,
-    (float)9.23102e-08,
-    (float)1.00186e-07,
-    (float)8.45201e-08,
-    (float)5.19913e-08,
-    (float)2.83626e-09,
-    (float)3.01065e-08,
-    (float)9.03183e-08,
-    (float)2.99588e-08,
-    (float)3.18401e-08,
-    (float)7.26538e-08,
-    (float)4.37342e-08,
-    (float)9.483e-08,
-    (float)3.27754e-06,
-    (float)4.67466e-05,
-    (float)0.999397,
-    (float)6.59608e-05,
-    (float)2.19042e-05,
-    (float)7.16762e-06,
-    (float)9.27421e-06,
-    (float)8.25373e-06,
-    (float)0.000224206,
-    (float)4.47289e-06,
-    (float)2.64773e-06,
-    (float)6.06368e-06,
-    (float)4.63596e-06,
-    (float)1.15226e-05,
-    (float)6.62592e-05,
-    (float)3.34987e-06,
-    (float)7.74752e-07,
-    (float)1.32547e-06,
-    (float)9.29359e-06,
-    (float)7.72578e-06,
-    (float)3.3092e-05,
-    (float)1.35504e-06,
-    (float)4.16805e-07,
-    (float)3.01989e-06,
-    (float)4.32626e-06,
-    (float)1.18994e-05,
-    (float)7.90857e-06,
-    (float)2.55396e-06,
-    (float)4.1761e-07,
-    (float)1.55036e-06,
-    (float)6.15758e-06,
-    (float)3.3335e-06,
-    (float)1.28659e-06,
-    (float)1.73875e-07,
-    (float)1.34835e-07,
-    (float)1.01484e-06,
-    (float)7.41594e-07,
-    (float)2.62083e-06,
-    (float)4.0345e-07,
-    (float)5.64527e-07,
-    (float)1.03958e-07,
-    (float)5.94269e-07,
-    (float)4.60646e-07,
-    (float)4.85656e-08,
-    (float)2.86922e-07,
-    (float)6.69482e-08,
-    (float)5.10232e-07,
-    (float)5.79374e-07,
-    (float)8.851e-07,
-    (float)1.17544e-07,
-    (float)4.70994e-08,
-    (float)7.43673e-08,
-    (float)3.90004e-08,
-    (float)2.61822e-07,
-    (float)6.30199e-07,
-    (float)1.45689e-06,
-    (float)4.32659e-07,
-    (float)1.29125e-07,
-    (float)5.01517e-07,
-    (float)4.63221e-07,
-    (float)1.48403e-06,
-    (float)3.91567e-07,
-    (float)1.62066e-07,
-    (float)6.90908e-08,
-    (float)3.42521e-08,
-    (float)5.18284e-08,
-    (float)9.54653e-08,
-    (float)2.47236e-07,
-    (float)4.60298e-08,
-    (float)4.41714e-08,
-    (float)9.41767e-08,
-    (float)1.91003e-07,
-    (float)1.12379e-07,
-    (float)7.63468e-08,
-    (float)1.02437e-07,
-    (float)7.80393e-08,
-    (float)4.63288e-08,
-    (float)1.48468e-07,
-    (float)3.8031e-07,
-    (float)2.31528e-07,
-    (float)8.01262e-08,
-    (float)1.60687e-07,
-    (float)7.39386e-08,
-    (float)5.764e-07,
-    (float)2.00674e-07,
-    (float)1.75627e-08,
-    (float)3.9782e-08,
-    (float)1.95606e-08,
-    (float)3.24901e-08,
-    (float)3.38012e-08,
-    (float)1.34716e-07,
-    (float)5.58412e-08,
-    (float)4.43329e-08,
-    (float)3.46567e-08,
-    (float)3.90792e-08,
-    (float)1.28759e-07,
-    (float)4.81641e-08,
-    (float)1.56114e-07,
-    (float)8.44313e-08,
-    (float)1.70877e-07,
-    (float)3.70649e-08,
-    (float)5.17553e-08,
-    (float)9.57956e-08,
-    (float)4.62109e-08,
-    (float)5.78302e-08,
-    (float)1.29658e-08,
-    (float)1.57296e-07,
-    (float)5.02659e-08,
-    (float)1.28589e-07,
-    (float)2.32344e-09,
-    (float)1.19484e-08,
-    (float)1.51152e-08,
-    (float)2.14489e-08,
-    (float)1.96519e-07,
-    (float)3.69387e-08,
-    (float)6.0813e-08,
-    (float)9.23102e-08,
-    (float)1.00186e-07,
-    (float)8.45201e-08,
-    (float)5.19913e-08,
-    (float)2.83626e-09,
-    (float)3.01065e-08,
-    (float)9.03183e-08,
-    (float)2.99588e-08,
-    (float)3.18401e-08,
-    (float)7.26538e-08,
-    (float)4.37342e-08,
-    (float)9.483e-08,
-    (float)0.00139297,
-    (float)0.000151008,
-    (float)0.993417,
-    (float)0.000447318,
-    (float)0.00309336,
-    (float)5.58392e-05,
-    (float)0.000664648,
-    (float)3.48111e-05,
-    (float)0.000253306,
-    (float)2.04218e-05,
-    (float)0.000146233,
-    (float)1.39193e-05,
-    (float)7.80589e-05,
-    (float)6.99716e-06,
-    (float)5.72355e-05,
-    (float)6.45236e-07,
-    (float)1.8353e-05,
-    (float)3.55562e-06,
-    (float)5.41258e-06,
-    (float)1.77571e-05,
-    (float)3.54129e-05,
-    (float)5.85825e-06,
-    (float)5.13129e-06,
-    (float)4.97309e-06,
-    (float)4.21117e-06,
-    (float)3.57855e-06,
-    (float)1.14924e-05,
-    (float)1.41168e-06,
-    (float)1.22495e-06,
-    (float)3.24508e-06,
-    (float)2.50188e-07,
-    (float)7.42581e-06,
-    (float)8.56167e-06,
-    (float)1.40538e-06,
-    (float)4.78873e-07,
-    (float)1.19327e-06,
-    (float)8.4391e-07,
-    (float)1.22728e-07,
-    (float)1.44821e-06,
-    (float)1.19229e-06,
-    (float)2.7958e-07,
-    (float)1.03856e-06,
-    (float)4.39186e-08,
-    (float)1.41681e-06,
-    (float)1.63253e-07,
-    (float)4.46597e-07,
-    (float)7.58604e-08,
-    (float)2.22524e-07,
-    (float)3.39245e-07,
-    (float)5.01734e-07,
-    (float)1.11625e-06,
-    (float)6.14438e-08,
-    (float)1.5434e-07,
-    (float)3.41312e-07,
-    (float)7.07351e-08,
-    (float)4.94484e-07,
-    (float)1.46276e-06,
-    (float)9.27372e-07,
-    (float)5.63906e-07,
-    (float)8.9373e-08,
-    (float)8.40349e-07,
-    (float)2.92466e-07,
-    (float)1.97367e-06,
-    (float)8.38398e-08,
-    (float)3.69681e-07,
-    (float)2.90654e-07,
-    (float)8.35112e-08,
-    (float)1.12813e-07,
-    (float)1.3584e-07,
-    (float)2.37855e-07,
-    (float)2.12009e-07,
-    (float)7.21006e-08,
-    (float)1.86681e-07,
-    (float)1.7484e-07,
-    (float)1.64956e-07,
-    (float)1.50005e-07,
-    (float)2.17955e-07,
-    (float)1.0513e-07,
-    (float)1.44429e-07,
-    (float)6.71745e-08,
-    (float)4.99302e-07,
-    (float)2.07477e-07,
-    (float)1.51951e-07,
-    (float)2.24026e-07,
-    (float)7.71408e-08,
-    (float)1.6067e-07,
-    (float)2.81864e-07,
-    (float)2.29419e-07,
-    (float)1.56579e-07,
-    (float)4.76099e-08,
-    (float)1.09257e-07,
-    (float)9.95812e-08,
-    (float)8.93724e-09,
-    (float)2.63522e-07,
-    (float)3.04696e-07,
-    (float)6.09495e-08,
-    (float)7.59503e-08,
-    (float)1.75948e-08,
-    (float)2.22717e-07,
-    (float)6.16041e-08,
-    (float)1.35908e-07,
-    (float)1.54822e-07,
-    (float)7.34683e-08,
-    (float)1.6114e-07,
-    (float)3.56016e-08,
-    (float)3.94879e-08,
-    (float)7.74351e-08,
-    (float)1.40762e-09,
-    (float)9.31589e-08,
-    (float)2.40921e-09,
-    (float)9.16315e-08,
-    (float)1.68647e-07,
-    (float)3.13408e-07,
-    (float)2.29537e-07,
-    (float)1.07031e-07,
-    (float)1.29565e-07,
-    (float)2.86331e-08,
-    (float)2.28845e-08,
-    (float)1.00045e-08,
-    (float)1.45398e-08,
-    (float)1.49191e-07,
-    (float)1.93526e-08,
-    (float)1.04032e-07,
-    (float)1.32914e-07,
-    (float)1.39977e-07,
-    (float)3.33105e-08,
-    (float)1.27837e-07,
-    (float)6.28612e-08,
-    (float)0.00566501,
-    (float)0.000429002,
-    (float)0.974012,
-    (float)0.00127645,
-    (float)0.0145756,
-    (float)0.000115114,
-    (float)0.00255667,
-    (float)6.02836e-05,
-    (float)0.000613695,
-    (float)2.52738e-05,
-    (float)0.00032391,
-    (float)1.28247e-05,
-    (float)7.9809e-05,
-    (float)9.52713e-07,
-    (float)4.69393e-05,
-    (float)1.60878e-05,
-    (float)2.01509e-05,
-    (float)1.90257e-05,
-    (float)2.39334e-06,
-    (float)1.87403e-05,
-    (float)6.58147e-06,
-    (float)2.05978e-06,
-    (float)3.65717e-05,
-    (float)3.92324e-07,
-    (float)3.96512e-06,
-    (float)4.36033e-06,
-    (float)9.90407e-06,
-    (float)1.09218e-05,
-    (float)6.79961e-06,
-    (float)4.28368e-06,
-    (float)1.07542e-06,
-    (float)8.13986e-07,
-    (float)6.57918e-06,
-    (float)1.31343e-06,
-    (float)2.69732e-06,
-    (float)1.82711e-06,
-    (float)2.70739e-07,
-    (float)3.01582e-06,
-    (float)1.13259e-06,
-    (float)1.23531e-06,
-    (float)1.77571e-06,
-    (float)2.10617e-07,
-    (float)5.12466e-07,
-    (float)3.1612e-07,
-    (float)2.50442e-07,
-    (float)1.40577e-06,
-    (float)1.52672e-07,
-    (float)6.25914e-07,
-    (float)2.21644e-07,
-    (float)4.4237e-07,
-    (float)5.42338e-07,
-    (float)1.70976e-07,
-    (float)9.11125e-07,
-    (float)2.6109e-07,
-    (float)2.95661e-07,
-    (float)4.39852e-07,
-    (float)1.83205e-07,
-    (float)5.4833e-07,
-    (float)2.08608e-06,
-    (float)2.12809e-07,
-    (float)7.33726e-07,
-    (float)5.6548e-08,
-    (float)8.53831e-07,
-    (float)2.2498e-07,
-    (float)1.6659e-06,
-    (float)1.28973e-07,
-    (float)5.57892e-07,
-    (float)2.45623e-07,
-    (float)4.80906e-08,
-    (float)9.07943e-08,
-    (float)7.54897e-08,
-    (float)1.38371e-07,
-    (float)5.6808e-07,
-    (float)7.56944e-08,
-    (float)1.7591e-07,
-    (float)1.46124e-07,
-    (float)9.70285e-08,
-    (float)5.33521e-08,
-    (float)5.48979e-07,
-    (float)1.17011e-07,
-    (float)3.44383e-07,
-    (float)1.13641e-07,
-    (float)2.4773e-07,
-    (float)1.64544e-07,
-    (float)2.69651e-07,
-    (float)1.40965e-08,
-    (float)1.4424e-07,
-    (float)8.14162e-08,
-    (float)2.68307e-07,
-    (float)1.95889e-07,
-    (float)6.71733e-07,
-    (float)1.32779e-07,
-    (float)6.82299e-08,
-    (float)6.2264e-08,
-    (float)1.24891e-07,
-    (float)1.94784e-08,
-    (float)7.28132e-08,
-    (float)1.85977e-07,
-    (float)5.35015e-08,
-    (float)9.11013e-08,
-    (float)5.93184e-08,
-    (float)1.82814e-07,
-    (float)6.61921e-08,
-    (float)1.47228e-09,
-    (float)3.45776e-07,
-    (float)4.19283e-08,
-    (float)7.13112e-08,
-    (float)1.06511e-07,
-    (float)2.21089e-07,
-    (float)1.59955e-07,
-    (float)1.0082e-07,
-    (float)3.02194e-08,
-    (float)3.76163e-08,
-    (float)9.93834e-08,
-    (float)2.61161e-08,
-    (float)1.16516e-07,
-    (float)1.38827e-07,
-    (float)1.33641e-07,
-    (float)2.08588e-07,
-    (float)1.54214e-07,
-    (float)1.70331e-07,
-    (float)3.87418e-08,
-    (float)1.42077e-09,
-    (float)7.8035e-08,
-    (float)4.6855e-08,
-    (float)4.58693e-08,
-    (float)1.53898e-07,
-    (float)2.13309e-07,
-    (float)0.0126987,
-    (float)0.000931156,
-    (float)0.941845,
-    (float)0.00261796,
-    (float)0.035568,
-    (float)0.000146365,
-    (float)0.00465531,
-    (float)9.30336e-05,
-    (float)0.000739585,
-    (float)2.41232e-05,
-    (float)0.000277486,
-    (float)2.66707e-05,
-    (float)1.86814e-05,
-    (float)2.16634e-05,
-    (float)7.49002e-05,
-    (float)3.89651e-05,
-    (float)3.57193e-05,
-    (float)1.41091e-05,
-    (float)1.48562e-05,
-    (float)1.46377e-06,
-    (float)5.35068e-06,
-    (float)5.29143e-06,
-    (float)3.87568e-05,
-    (float)1.78142e-05,
-    (float)1.43742e-06,
-    (float)1.15045e-05,
-    (float)2.72842e-06,
-    (float)2.53699e-06,
-    (float)1.51858e-05,
-    (float)8.26101e-07,
-    (float)1.01479e-06,
-    (float)4.17499e-06,
-    (float)3.42313e-08,
-    (float)4.72755e-06,
-    (float)1.12503e-05,
-    (float)9.17152e-07,
-    (float)7.64988e-08,
-    (float)1.93383e-07,
-    (float)5.48894e-07,
-    (float)2.0649e-06,
-    (float)1.54322e-06,
-    (float)1.43989e-06,
-    (float)1.51805e-06,
-    (float)7.47983e-07,
-    (float)9.52324e-07,
-    (float)1.47722e-08,
-    (float)9.31804e-07,
-    (float)8.54875e-07,
-    (float)2.21928e-07,
-    (float)6.40233e-07,
-    (float)2.2546e-07,
-    (float)5.61599e-07,
-    (float)7.01036e-07,
-    (float)1.3426e-08,
-    (float)5.81363e-07,
-    (float)3.3256e-07,
-    (float)6.10097e-07,
-    (float)6.27169e-07,
-    (float)4.50179e-07,
-    (float)5.52107e-07,
-    (float)1.96036e-06,
-    (float)1.20143e-07,
-    (float)1.23901e-06,
-    (float)1.98342e-08,
-    (float)9.78841e-07,
-    (float)2.89195e-07,
-    (float)1.09457e-06,
-    (float)6.59088e-07,
-    (float)6.89007e-07,
-    (float)1.67216e-07,
-    (float)1.13771e-07,
-    (float)2.02224e-08,
-    (float)2.12288e-07,
-    (float)3.19075e-08,
-    (float)8.13099e-07,
-    (float)2.20075e-07,
-    (float)8.43845e-08,
-    (float)7.41147e-08,
-    (float)1.56262e-07,
-    (float)4.14051e-08,
-    (float)7.52148e-07,
-    (float)1.32732e-07,
-    (float)1.66473e-07,
-    (float)1.73917e-07,
-    (float)5.51429e-08,
-    (float)7.27747e-08,
-    (float)6.42306e-08,
-    (float)8.65694e-08,
-    (float)4.02405e-07,
-    (float)1.19485e-07,
-    (float)3.87056e-07,
-    (float)7.3038e-08,
-    (float)6.68543e-07,
-    (float)4.88878e-08,
-    (float)1.46952e-07,
-    (float)9.77214e-08,
-    (float)9.56179e-08,
-    (float)1.80051e-07,
-    (float)8.88805e-08,
-    (float)1.39983e-07,
-    (float)2.70987e-07,
-    (float)1.04889e-07,
-    (float)1.27072e-07,
-    (float)6.66379e-09,
-    (float)5.71797e-08,
-    (float)1.28691e-07,
-    (float)1.21016e-07,
-    (float)5.37345e-08,
-    (float)2.91045e-07,
-    (float)2.56943e-07,
-    (float)8.32184e-08,
-    (float)1.02405e-07,
-    (float)3.74159e-08,
-    (float)3.24013e-07,
-    (float)4.17058e-08,
-    (float)1.64869e-07,
-    (float)4.00743e-08,
-    (float)1.46795e-07,
-    (float)5.51487e-08,
-    (float)1.4356e-07,
-    (float)8.75239e-08,
-    (float)2.95067e-07,
-    (float)2.05714e-07,
-    (float)2.89324e-07,
-    (float)9.98665e-08,
-    (float)1.86847e-07,
-    (float)1.70239e-09,
-    (float)1.07219e-08,
-    (float)0.0223269,
-    (float)0.00174318,
-    (float)0.898074,
-    (float)0.00446596,
-    (float)0.066071,
-    (float)0.000159658,
-    (float)0.00575534,
-    (float)0.00017869,
-    (float)0.000430987,
-    (float)4.49425e-05,
-    (float)0.000146975,
-    (float)6.70094e-05,
-    (float)8.69447e-05,
-    (float)4.28467e-05,
-    (float)0.000143002,
-    (float)2.49923e-05,
-    (float)4.3245e-05,
-    (float)6.38318e-07,
-    (float)1.65262e-05,
-    (float)1.29559e-05,
-    (float)3.27669e-06,
-    (float)2.33805e-05,
-    (float)1.30699e-05,
-    (float)1.80555e-05,
-    (float)1.76082e-05,
-    (float)9.14254e-08,
-    (float)8.93377e-07,
-    (float)6.17432e-06,
-    (float)8.48216e-06,
-    (float)8.59639e-06,
-    (float)1.04787e-05,
-    (float)2.53363e-06,
-    (float)2.34358e-06,
-    (float)5.78478e-08,
-    (float)3.84897e-06,
-    (float)1.70409e-06,
-    (float)6.24052e-06,
-    (float)2.93501e-06,
-    (float)1.67925e-07,
-    (float)6.12514e-07,
-    (float)1.44299e-06,
-    (float)7.01748e-07,
-    (float)2.90374e-06,
-    (float)3.5796e-07,
-    (float)1.07941e-06,
-    (float)5.9809e-07,
-    (float)1.12807e-06,
-    (float)1.18232e-07,
-    (float)1.57887e-06,
-    (float)6.29424e-07,
-    (float)4.29158e-07,
-    (float)4.49759e-07,
-    (float)3.22644e-07,
-    (float)4.97994e-07,
-    (float)8.1855e-07,
-    (float)8.63352e-08,
-    (float)2.54383e-07,
-    (float)4.72747e-07,
-    (float)8.12437e-07,
-    (float)6.26043e-07,
-    (float)4.07458e-07,
-    (float)4.7115e-07,
-    (float)1.26729e-06,
-    (float)8.38067e-07,
-    (float)1.87107e-06,
-    (float)1.40155e-07,
-    (float)4.58126e-07,
-    (float)6.74484e-07,
-    (float)5.27979e-07,
-    (float)1.18036e-06,
-    (float)3.29116e-07,
-    (float)6.82558e-08,
-    (float)4.29944e-07,
-    (float)5.54411e-08,
-    (float)1.82933e-07,
-    (float)9.028e-08,
-    (float)4.63966e-07,
-    (float)3.96273e-07,
-    (float)1.25521e-07,
-    (float)3.25915e-08,
-    (float)2.43367e-07,
-    (float)3.32026e-07,
-    (float)2.98822e-07,
-    (float)3.44674e-07,
-    (float)1.15566e-07,
-    (float)1.37468e-07,
-    (float)1.00189e-07,
-    (float)6.54162e-08,
-    (float)4.81027e-08,
-    (float)3.29297e-07,
-    (float)3.51929e-07,
-    (float)2.22521e-07,
-    (float)1.77002e-07,
-    (float)1.32158e-07,
-    (float)1.01587e-07,
-    (float)1.41939e-07,
-    (float)4.45361e-07,
-    (float)7.94362e-07,
-    (float)9.50713e-08,
-    (float)6.34288e-08,
-    (float)2.6814e-08,
-    (float)1.2939e-07,
-    (float)8.91193e-09,
-    (float)7.58567e-09,
-    (float)3.5634e-07,
-    (float)1.09278e-07,
-    (float)8.44727e-08,
-    (float)9.91583e-08,
-    (float)6.23401e-08,
-    (float)1.77915e-07,
-    (float)8.0408e-08,
-    (float)1.00284e-07,
-    (float)1.32468e-07,
-    (float)2.44859e-07,
-    (float)1.57974e-07,
-    (float)2.44208e-07,
-    (float)1.17646e-08,
-    (float)2.37817e-07,
-    (float)1.64755e-07,
-    (float)1.08634e-07,
-    (float)1.33696e-07,
-    (float)1.59617e-07,
-    (float)1.24753e-07,
-    (float)4.88515e-08,
-    (float)8.19925e-08,
-    (float)1.59117e-07,
-    (float)9.2582e-08,
-    (float)2.90741e-07,
-    (float)0.0344351,
-    (float)0.00295733,
-    (float)0.844036,
-    (float)0.00674456,
-    (float)0.104866,
-    (float)0.000281053,
-    (float)0.00513164,
-    (float)0.000372954,
-    (float)4.15001e-05,
-    (float)8.78644e-05,
-    (float)0.000248057,
-    (float)9.29829e-05,
-    (float)0.000267833,
-    (float)3.79651e-05,
-    (float)0.00012605,
-    (float)9.66177e-06,
-    (float)3.02692e-05,
-    (float)3.01361e-05,
-    (float)1.89732e-05,
-    (float)2.99078e-05,
-    (float)4.84826e-06,
-    (float)9.06901e-06,
-    (float)5.27622e-06,
-    (float)2.05642e-07,
-    (float)2.05053e-05,
-    (float)2.5195e-05,
-    (float)1.73842e-06,
-    (float)1.05679e-05,
-    (float)3.84028e-07,
-    (float)7.22883e-07,
-    (float)1.50886e-05,
-    (float)2.19548e-06,
-    (float)2.88771e-06,
-    (float)3.90753e-06,
-    (float)1.46874e-06,
-    (float)1.09516e-06,
-    (float)9.20306e-06,
-    (float)1.03852e-06,
-    (float)1.8129e-06,
-    (float)1.67253e-06,
-    (float)8.91296e-08,
-    (float)8.39319e-07,
-    (float)1.66318e-06,
-    (float)2.37929e-07,
-    (float)4.78674e-06,
-    (float)3.24608e-07,
-    (float)4.05787e-07,
-    (float)2.76116e-07,
-    (float)1.13005e-06,
-    (float)1.30438e-07,
-    (float)2.04532e-06,
-    (float)6.36768e-07,
-    (float)4.66953e-07,
-    (float)5.98498e-07,
-    (float)2.94404e-07,
-    (float)5.49463e-07,
-    (float)1.00535e-06,
-    (float)3.52066e-08,
-    (float)7.42914e-08,
-    (float)6.27481e-07,
-    (float)8.27194e-07,
-    (float)6.74259e-07,
-    (float)3.29838e-07,
-    (float)6.21914e-07,
-    (float)6.74898e-07,
-    (float)9.77086e-07,
-    (float)1.60282e-06,
-    (float)1.05878e-06,
-    (float)1.15085e-07,
-    (float)1.03512e-06,
-    (float)2.44222e-07,
-    (float)6.20396e-07,
-    (float)6.02055e-10,
-    (float)4.62174e-07,
-    (float)5.60081e-07,
-    (float)3.19338e-07,
-    (float)2.03779e-07,
-    (float)1.72636e-07,
-    (float)2.04315e-07,
-    (float)3.21256e-07,
-    (float)2.00888e-07,
-    (float)3.87367e-07,
-    (float)1.63692e-07,
-    (float)3.9028e-07,
-    (float)1.44433e-07,
-    (float)3.72596e-08,
-    (float)9.82782e-08,
-    (float)4.17205e-07,
-    (float)4.21623e-08,
-    (float)7.78672e-08,
-    (float)1.69028e-07,
-    (float)8.45656e-08,
-    (float)2.40759e-08,
-    (float)1.06361e-08,
-    (float)2.20591e-07,
-    (float)6.97562e-07,
-    (float)3.62123e-08,
-    (float)2.71614e-07,
-    (float)9.56662e-08,
-    (float)3.05272e-07,
-    (float)2.19794e-09,
-    (float)4.18249e-07,
-    (float)1.83969e-07,
-    (float)6.46198e-08,
-    (float)4.50926e-08,
-    (float)1.00978e-07,
-    (float)2.98356e-08,
-    (float)8.05704e-08,
-    (float)2.22264e-07,
-    (float)1.51731e-07,
-    (float)2.23896e-07,
-    (float)2.92735e-07,
-    (float)3.48759e-08,
-    (float)1.83753e-07,
-    (float)9.03942e-08,
-    (float)2.55966e-08,
-    (float)2.49801e-07,
-    (float)4.08532e-07,
-    (float)3.09389e-07,
-    (float)3.92094e-08,
-    (float)5.44838e-08,
-    (float)2.43777e-08,
-    (float)1.84806e-07,
-    (float)4.47161e-08,
-    (float)1.67433e-07,
-    (float)1.74322e-07,
-    (float)2.00803e-07,
-    (float)3.38123e-08,
-    (float)0.0488146,
-    (float)0.00470568,
-    (float)0.781603,
-    (float)0.00928401,
-    (float)0.149437,
-    (float)0.000785863,
-    (float)0.0029798,
-    (float)0.000678077,
-    (float)0.000174645,
-    (float)0.000114264,
-    (float)0.000596659,
-    (float)7.29256e-05,
-    (float)0.000317554,
-    (float)5.02909e-05,
-    (float)2.69541e-05,
-    (float)4.25507e-05,
-    (float)6.54693e-05,
-    (float)5.11891e-05,
-    (float)2.64617e-05,
-    (float)5.12936e-06,
-    (float)7.70353e-06,
-    (float)5.54936e-06,
-    (float)5.18917e-06,
-    (float)1.6423e-05,
-    (float)1.05933e-05,
-    (float)2.64918e-05,
-    (float)5.47334e-06,
-    (float)2.12945e-06,
-    (float)9.65821e-07,
-    (float)9.89994e-06,
-    (float)2.77526e-06,
-    (float)3.39788e-06,
-    (float)1.50803e-05,
-    (float)2.33316e-06,
-    (float)2.62597e-06,
-    (float)7.90772e-07,
-    (float)3.76458e-07,
-    (float)1.44358e-06,
-    (float)8.22828e-06,
-    (float)2.83855e-06,
-    (float)1.81139e-06,
-    (float)2.56118e-07,
-    (float)2.63251e-07,
-    (float)1.98288e-07,
-    (float)1.40345e-06,
-    (float)1.42861e-07,
-    (float)4.74528e-06,
-    (float)1.54322e-06,
-    (float)2.23027e-07,
-    (float)4.11755e-07,
-    (float)7.56208e-07,
-    (float)7.89867e-08,
-    (float)1.99532e-06,
-    (float)9.65694e-07,
-    (float)3.19618e-07,
-    (float)9.10215e-07,
-    (float)4.19446e-07,
-    (float)6.37684e-07,
-    (float)9.90652e-07,
-    (float)1.04995e-07,
-    (float)1.43942e-08,
-    (float)8.84719e-07,
-    (float)3.48321e-07,
-    (float)9.52324e-07,
-    (float)6.00997e-07,
-    (float)3.63601e-07,
-    (float)5.08487e-07,
-    (float)1.05048e-07,
-    (float)4.61635e-07,
-    (float)3.48982e-06,
-    (float)1.83202e-07,
-    (float)2.61198e-07,
-    (float)3.96232e-07,
-    (float)1.14034e-07,
-    (float)6.67412e-08,
-    (float)7.17931e-07,
-    (float)3.53041e-07,
-    (float)9.19577e-07,
-    (float)2.69484e-07,
-    (float)1.45783e-07,
-    (float)3.78967e-08,
-    (float)2.07258e-07,
-    (float)8.33639e-08,
-    (float)6.66519e-07,
-    (float)3.40639e-07,
-    (float)4.69173e-09,
-    (float)6.31547e-08,
-    (float)3.28557e-07,
-    (float)1.65596e-07,
-    (float)2.45897e-07,
-    (float)1.30398e-07,
-    (float)7.8604e-08,
-    (float)7.72529e-08,
-    (float)6.28193e-08,
-    (float)3.07479e-08,
-    (float)1.15967e-07,
-    (float)7.78162e-08,
-    (float)1.54829e-07,
-    (float)1.87426e-08,
-    (float)5.61265e-07,
-    (float)2.08128e-07,
-    (float)2.80713e-07,
-    (float)8.19972e-08,
-    (float)3.80723e-07,
-    (float)2.55398e-07,
-    (float)1.6549e-07,
-    (float)2.55584e-07,
-    (float)2.33421e-07,
-    (float)7.63002e-08,
-    (float)1.38003e-07,
-    (float)9.66778e-08,
-    (float)6.26114e-08,
-    (float)3.78667e-08,
-    (float)4.26074e-07,
-    (float)5.42341e-08,
-    (float)1.65217e-07,
-    (float)3.4308e-07,
-    (float)7.79981e-09,
-    (float)1.25802e-07,
-    (float)5.08218e-08,
-    (float)1.73087e-07,
-    (float)2.50765e-07,
-    (float)4.09518e-07,
-    (float)8.04813e-08,
-    (float)1.7493e-07,
-    (float)4.85917e-08,
-    (float)1.24933e-07,
-    (float)1.22713e-07,
-    (float)0.0652485,
-    (float)0.00713165,
-    (float)0.712687,
-    (float)0.0118444,
-    (float)0.196491,
-    (float)0.00209794,
-    (float)0.000639007,
-    (float)0.000969205,
-    (float)0.00116206,
-    (float)0.000106426,
-    (float)0.000841338,
-    (float)5.91625e-05,
-    (float)0.000166167,
-    (float)0.000124843,
-    (float)2.15487e-05,
-    (float)6.27884e-05,
-    (float)0.000107065,
-    (float)2.20693e-05,
-    (float)1.89587e-05,
-    (float)1.37862e-05,
-    (float)1.48583e-05,
-    (float)2.81716e-05,
-    (float)1.87791e-06,
-    (float)6.57152e-06,
-    (float)9.26024e-06,
-    (float)9.03181e-07,
-    (float)4.46664e-06,
-    (float)3.3536e-05,
-    (float)1.30307e-06,
-    (float)1.66782e-06,
-    (float)1.48946e-06,
-    (float)3.2589e-06,
-    (float)8.47395e-06,
-    (float)3.43214e-06,
-    (float)7.18754e-06,
-    (float)4.66674e-06,
-    (float)4.24671e-06,
-    (float)6.42949e-08,
-    (float)1.42699e-06,
-    (float)1.4298e-06,
-    (float)4.23748e-06,
-    (float)3.76797e-06,
-    (float)2.36944e-06,
-    (float)1.98438e-07,
-    (float)7.18204e-07,
-    (float)6.02923e-08,
-    (float)1.02054e-06,
-    (float)1.29132e-07,
-    (float)3.2487e-06,
-    (float)3.74973e-06,
-    (float)2.81066e-07,
-    (float)6.46063e-07,
-    (float)5.28669e-07,
-    (float)3.641e-08,
-    (float)1.37309e-06,
-    (float)1.45919e-06,
-    (float)2.76119e-07,
-    (float)1.04111e-06,
-    (float)5.80128e-07,
-    (float)2.59019e-07,
-    (float)6.84467e-07,
-    (float)5.35053e-07,
-    (float)1.4217e-08,
-    (float)7.39556e-07,
-    (float)6.06105e-07,
-    (float)8.7136e-07,
-    (float)7.24968e-07,
-    (float)6.96408e-08,
-    (float)2.65611e-08,
-    (float)4.33342e-07,
-    (float)3.87414e-07,
-    (float)3.14321e-06,
-    (float)8.68558e-07,
-    (float)3.57741e-07,
-    (float)6.91337e-08,
-    (float)1.57844e-07,
-    (float)4.01658e-07,
-    (float)2.5541e-07,
-    (float)3.56726e-07,
-    (float)4.50108e-07,
-    (float)1.99493e-08,
-    (float)1.00612e-06,
-    (float)1.3407e-07,
-    (float)2.61651e-07,
-    (float)1.83894e-07,
-    (float)2.21779e-07,
-    (float)1.27627e-07,
-    (float)2.84913e-07,
-    (float)2.74896e-07,
-    (float)6.1905e-08,
-    (float)8.93813e-08,
-    (float)1.62779e-07,
-    (float)3.21334e-08,
-    (float)2.07509e-07,
-    (float)2.70565e-07,
-    (float)1.44936e-08,
-    (float)4.80194e-08,
-    (float)7.12561e-08,
-    (float)9.58934e-09,
-    (float)1.27337e-07,
-    (float)1.90643e-07,
-    (float)2.81109e-07,
-    (float)3.12899e-07,
-    (float)8.50604e-08,
-    (float)6.14387e-07,
-    (float)1.44853e-07,
-    (float)4.05723e-07,
-    (float)1.51389e-07,
-    (float)2.36915e-07,
-    (float)2.02021e-08,
-    (float)9.59674e-08,
-    (float)2.3149e-07,
-    (float)3.32801e-08,
-    (float)1.07856e-07,
-    (float)1.78851e-07,
-    (float)6.10018e-08,
-    (float)1.6883e-07,
-    (float)2.53413e-07,
-    (float)2.22703e-07,
-    (float)6.03429e-08,
-    (float)9.8928e-08,
-    (float)1.47676e-07,
-    (float)8.96673e-08,
-    (float)2.08305e-07,
-    (float)1.56219e-07,
-    (float)1.05534e-07,
-    (float)1.49637e-07,
-    (float)6.65857e-07,
-    (float)0.0835827,
-    (float)0.0104094,
-    (float)0.639301,
-    (float)0.0141531,
-    (float)0.242078,
-    (float)0.00467801,
-    (float)0.000356139,
-    (float)0.00103714,
-    (float)0.00265875,
-    (float)0.000178226,
-    (float)0.000668227,
-    (float)0.000124415,
-    (float)6.71067e-05,
-    (float)0.000178039,
-    (float)0.000130479,
-    (float)4.02021e-05,
-    (float)6.01725e-05,
-    (float)3.51416e-05,
-    (float)3.61977e-05,
-    (float)4.8282e-05,
-    (float)1.76034e-05,
-    (float)6.86571e-06,
-    (float)3.67257e-06,
-    (float)5.96652e-06,
-    (float)7.80559e-06,
-    (float)9.6081e-06,
-    (float)7.30367e-06,
-    (float)1.6156e-05,
-    (float)6.3786e-08,
-    (float)1.56333e-05,
-    (float)2.64893e-06,
-    (float)4.0209e-06,
-    (float)6.52097e-07,
-    (float)1.9468e-06,
-    (float)1.24693e-05,
-    (float)5.66995e-06,
-    (float)1.33679e-06,
-    (float)4.2876e-06,
-    (float)4.25264e-06,
-    (float)1.02908e-06,
-    (float)2.74225e-06,
-    (float)2.45081e-06,
-    (float)1.44491e-06,
-    (float)3.17932e-06,
-    (float)2.54116e-06,
-    (float)9.19986e-07,
-    (float)6.60434e-07,
-    (float)6.95124e-07,
-    (float)7.59446e-07,
-    (float)9.75195e-08,
-    (float)1.41702e-06,
-    (float)6.3016e-06,
-    (float)2.95381e-07,
-    (float)4.69251e-07,
-    (float)6.28669e-07,
-    (float)3.11223e-07,
-    (float)5.80981e-07,
-    (float)2.37763e-06,
-    (float)6.04389e-07,
-    (float)4.35443e-07,
-    (float)9.85454e-07,
-    (float)2.75195e-07,
-    (float)2.77317e-07,
-    (float)1.00695e-06,
-    (float)4.95798e-07,
-    (float)3.66663e-07,
-    (float)1.15127e-06,
-    (float)1.77419e-07,
-    (float)1.69732e-07,
-    (float)5.62994e-07,
-    (float)2.53722e-07,
-    (float)6.48277e-07,
-    (float)7.63879e-07,
-    (float)7.49128e-07,
-    (float)6.70494e-07,
-    (float)1.24556e-06,
-    (float)1.29721e-06,
-    (float)4.37446e-08,
-    (float)3.80444e-07,
-    (float)1.5705e-07,
-    (float)5.44938e-08,
-    (float)2.86077e-08,
-    (float)3.68236e-07,
-    (float)4.91973e-07,
-    (float)7.75109e-07,
-    (float)4.31096e-07,
-    (float)5.76802e-08,
-    (float)1.08974e-07,
-    (float)1.96244e-07,
-    (float)2.869e-07,
-    (float)3.55145e-07,
-    (float)5.38651e-08,
-    (float)1.06114e-07,
-    (float)7.20148e-08,
-    (float)3.42996e-07,
-    (float)1.85457e-07,
-    (float)6.21939e-08,
-    (float)4.21213e-08,
-    (float)4.26942e-07,
-    (float)1.39215e-07,
-    (float)7.27553e-08,
-    (float)1.36249e-08,
-    (float)4.76612e-08,
-    (float)4.01248e-09,
-    (float)3.26874e-07,
-    (float)9.04809e-08,
-    (float)3.76013e-07,
-    (float)1.08736e-07,
-    (float)5.5874e-07,
-    (float)2.74762e-07,
-    (float)3.88389e-07,
-    (float)8.72223e-08,
-    (float)2.58516e-07,
-    (float)1.48544e-07,
-    (float)1.36982e-07,
-    (float)1.53612e-07,
-    (float)1.3593e-07,
-    (float)4.92381e-08,
-    (float)7.91157e-08,
-    (float)2.23013e-07,
-    (float)6.76346e-08,
-    (float)7.03748e-07,
-    (float)4.22702e-07,
-    (float)3.19205e-07,
-    (float)9.9172e-09,
-    (float)2.74915e-07,
-    (float)1.30949e-07,
-    (float)4.74796e-07,
-    (float)0.103493,
-    (float)0.0147486,
-    (float)0.563968,
-    (float)0.015934,
-    (float)0.281937,
-    (float)0.00894005,
-    (float)0.0046058,
-    (float)0.00075973,
-    (float)0.00370446,
-    (float)0.000537747,
-    (float)0.000214151,
-    (float)0.000207091,
-    (float)0.000236502,
-    (float)0.000114958,
-    (float)0.000152561,
-    (float)8.52897e-05,
-    (float)1.42104e-06,
-    (float)7.22193e-05,
-    (float)6.52685e-05,
-    (float)2.50805e-05,
-    (float)1.47362e-05,
-    (float)1.39563e-05,
-    (float)1.37231e-05,
-    (float)1.82004e-05,
-    (float)1.37572e-07,
-    (float)1.25206e-06,
-    (float)1.38561e-05,
-    (float)2.09351e-06,
-    (float)9.3087e-07,
-    (float)2.36498e-05,
-    (float)6.86319e-07,
-    (float)5.39907e-06,
-    (float)4.83146e-06,
-    (float)2.89251e-06,
-    (float)1.90772e-08,
-    (float)2.43852e-06,
-    (float)9.64708e-06,
-    (float)1.01601e-05,
-    (float)1.55411e-07,
-    (float)2.96017e-06,
-    (float)2.3249e-06,
-    (float)2.21968e-06,
-    (float)2.55799e-06,
-    (float)3.18735e-06,
-    (float)5.80652e-08,
-    (float)3.30042e-06,
-    (float)1.79264e-06,
-    (float)2.33571e-06,
-    (float)6.30202e-07,
-    (float)1.34932e-06,
-    (float)2.45105e-07,
-    (float)2.15664e-07,
-    (float)2.26202e-07,
-    (float)7.38287e-06,
-    (float)1.05914e-06,
-    (float)8.52043e-08,
-    (float)7.68975e-07,
-    (float)1.45417e-06,
-    (float)2.05541e-07,
-    (float)1.66639e-06,
-    (float)1.7824e-06,
-    (float)2.01784e-07,
-    (float)3.0564e-07,
-    (float)7.78753e-07,
-    (float)2.14805e-07,
-    (float)5.11993e-07,
-    (float)1.29223e-06,
-    (float)4.03891e-07,
-    (float)2.79852e-07,
-    (float)1.07585e-07,
-    (float)4.76496e-07,
-    (float)6.80861e-07,
-    (float)8.05878e-07,
-    (float)5.14517e-07,
-    (float)1.18299e-07,
-    (float)4.33458e-07,
-    (float)2.60141e-07,
-    (float)6.83337e-07,
-    (float)2.24434e-06,
-    (float)1.00985e-07,
-    (float)6.19874e-07,
-    (float)4.75226e-08,
-    (float)3.21244e-07,
-    (float)3.41036e-07,
-    (float)5.39391e-08,
-    (float)6.51056e-08,
-    (float)3.306e-07,
-    (float)1.22068e-07,
-    (float)1.3821e-06,
-    (float)1.54624e-07,
-    (float)2.2621e-07,
-    (float)2.50984e-08,
-    (float)1.59681e-07,
-    (float)2.69742e-07,
-    (float)3.39041e-07,
-    (float)1.90667e-07,
-    (float)1.08579e-08,
-    (float)1.25619e-07,
-    (float)1.40667e-07,
-    (float)6.25928e-08,
-    (float)1.4538e-07,
-    (float)3.41244e-09,
-    (float)1.87935e-07,
-    (float)2.97295e-07,
-    (float)1.08188e-08,
-    (float)5.15901e-08,
-    (float)1.3387e-07,
-    (float)3.82901e-08,
-    (float)1.55871e-07,
-    (float)2.77969e-07,
-    (float)1.44786e-07,
-    (float)1.25573e-07,
-    (float)3.56543e-07,
-    (float)7.76803e-07,
-    (float)9.90613e-08,
-    (float)2.01447e-07,
-    (float)2.34445e-07,
-    (float)1.74867e-07,
-    (float)8.79843e-08,
-    (float)2.1317e-07,
-    (float)2.10081e-07,
-    (float)1.81384e-08,
-    (float)2.0487e-07,
-    (float)2.40507e-07,
-    (float)1.29746e-07,
-    (float)2.88386e-07,
-    (float)1.6696e-07,
-    (float)3.32749e-07,
-    (float)0.124708,
-    (float)0.0203084,
-    (float)0.488414,
-    (float)0.0170247,
-    (float)0.312758,
-    (float)0.01499,
-    (float)0.0152891,
-    (float)0.000378016,
-    (float)0.00347907,
-    (float)0.00124287,
-    (float)1.54359e-05,
-    (float)0.000172506,
-    (float)0.000506971,
-    (float)6.96753e-05,
-    (float)5.36131e-05,
-    (float)0.00020295,
-    (float)2.97871e-05,
-    (float)3.91424e-05,
-    (float)3.73714e-05,
-    (float)4.03453e-05,
-    (float)3.66111e-05,
-    (float)3.41245e-05,
-    (float)1.02538e-05,
-    (float)3.89173e-06,
-    (float)9.49428e-06,
-    (float)9.22359e-06,
-    (float)3.53746e-06,
-    (float)3.64408e-06,
-    (float)1.1813e-05,
-    (float)2.65229e-06,
-    (float)1.4896e-06,
-    (float)1.72984e-05,
-    (float)9.29563e-07,
-    (float)4.25599e-06,
-    (float)6.55641e-06,
-    (float)1.71321e-06,
-    (float)3.23004e-08,
-    (float)4.86047e-06,
-    (float)5.37167e-06,
-    (float)1.22875e-05,
-    (float)2.03233e-06,
-    (float)2.30389e-06,
-    (float)1.36982e-06,
-    (float)2.3939e-06,
-    (float)2.43467e-06,
-    (float)3.34856e-06,
-    (float)2.43807e-07,
-    (float)2.32762e-06,
-    (float)1.51836e-06,
-    (float)3.83938e-06,
-    (float)6.33451e-07,
-    (float)6.44428e-07,
-    (float)7.12638e-08,
-    (float)1.3392e-06,
-    (float)3.39263e-08,
-    (float)4.00861e-06,
-    (float)3.53223e-06,
-    (float)1.03512e-06,
-    (float)2.83144e-07,
-    (float)1.44237e-06,
-    (float)1.33365e-06,
-    (float)2.12189e-07,
-    (float)1.3802e-06,
-    (float)1.56279e-06,
-    (float)3.16126e-07,
-    (float)3.3314e-07,
-    (float)1.19619e-06,
-    (float)2.83865e-07,
-    (float)2.70849e-07,
-    (float)8.34675e-07,
-    (float)5.46047e-07,
-    (float)4.93933e-08,
-    (float)2.92396e-07,
-    (float)8.51591e-07,
-    (float)3.31806e-07,
-    (float)1.6308e-07,
-    (float)5.71672e-07,
-    (float)4.02223e-07,
-    (float)5.22385e-07,
-    (float)6.04395e-07,
-    (float)1.65862e-07,
-    (float)2.24345e-08,
-    (float)1.55028e-06,
-    (float)1.17391e-06,
-    (float)1.68769e-07,
-    (float)2.30672e-09,
-    (float)2.28037e-07,
-    (float)3.34142e-07,
-    (float)1.64775e-07,
-    (float)1.82536e-07,
-    (float)8.85729e-08,
-    (float)3.1475e-07,
-    (float)9.96881e-07,
-    (float)4.34948e-07,
-    (float)7.42467e-08,
-    (float)7.79038e-08,
-    (float)1.22869e-07,
-    (float)1.38645e-07,
-    (float)2.17996e-07,
-    (float)2.01982e-07,
-    (float)5.4679e-08,
-    (float)3.46444e-08,
-    (float)1.21781e-07,
-    (float)2.41542e-07,
-    (float)3.07669e-08,
-    (float)1.35124e-07,
-    (float)7.11002e-08,
-    (float)4.91055e-07,
-    (float)1.00679e-07,
-    (float)7.14e-08,
-    (float)8.61419e-08,
-    (float)2.52766e-07,
-    (float)9.08335e-08,
-    (float)3.55146e-07,
-    (float)2.20722e-07,
-    (float)1.85755e-07,
-    (float)1.65865e-07,
-    (float)6.32585e-07,
-    (float)3.28812e-07,
-    (float)1.65848e-07,
-    (float)7.30057e-07,
-    (float)1.73382e-07,
-    (float)1.63819e-07,
-    (float)7.64151e-08,
-    (float)4.67939e-07,
-    (float)1.27963e-09,
-    (float)1.0389e-07,
-    (float)2.72098e-07,
-    (float)0.146837,
-    (float)0.0273175,
-    (float)0.414875,
-    (float)0.0173265,
-    (float)0.331806,
-    (float)0.0224877,
-    (float)0.0328734,
-    (float)0.000675213,
-    (float)0.00193108,
-    (float)0.00196535,
-    (float)0.000423218,
-    (float)0.000101059,
-    (float)0.000521689,
-    (float)0.000183671,
-    (float)3.99569e-05,
-    (float)0.00018042,
-    (float)5.37126e-05,
-    (float)6.58914e-05,
-    (float)4.23875e-06,
-    (float)6.67502e-05,
-    (float)3.74286e-05,
-    (float)2.29766e-05,
-    (float)2.21298e-05,
-    (float)2.11648e-05,
-    (float)8.10111e-06,
-    (float)6.29593e-06,
-    (float)4.73752e-06,
-    (float)4.42424e-06,
-    (float)8.46678e-06,
-    (float)4.2245e-06,
-    (float)4.82042e-06,
-    (float)3.26854e-06,
-    (float)5.91766e-06,
-    (float)1.04624e-05,
-    (float)1.481e-06,
-    (float)5.872e-06,
-    (float)6.10662e-06,
-    (float)6.07162e-07,
-    (float)3.25425e-07,
-    (float)7.62757e-06,
-    (float)1.94107e-06,
-    (float)1.14214e-05,
-    (float)6.14726e-06,
-    (float)1.85492e-06,
-    (float)1.41536e-06,
-    (float)1.70227e-06,
-    (float)2.69621e-06,
-    (float)3.05986e-06,
-    (float)8.17644e-07,
-    (float)1.70115e-06,
-    (float)2.06542e-06,
-    (float)4.29697e-06,
-    (float)1.01751e-06,
-    (float)3.91199e-07,
-    (float)1.66107e-07,
-    (float)2.02595e-06,
-    (float)9.12287e-07,
-    (float)7.74783e-07,
-    (float)3.08157e-06,
-    (float)2.41019e-06,
-    (float)2.74765e-06,
-    (float)3.43266e-07,
-    (float)1.53438e-06,
-    (float)4.00993e-07,
-    (float)2.16158e-07,
-    (float)1.36349e-06,
-    (float)1.44696e-06,
-    (float)8.13513e-07,
-    (float)2.6225e-08,
-    (float)5.82052e-07,
-    (float)6.86593e-07,
-    (float)1.38846e-07,
-    (float)1.69011e-07,
-    (float)7.79681e-07,
-    (float)2.66217e-07,
-    (float)9.27248e-08,
-    (float)2.18295e-08,
-    (float)8.21889e-07,
-    (float)4.03049e-07,
-    (float)2.34615e-07,
-    (float)6.29563e-07,
-    (float)2.45301e-07,
-    (float)2.93636e-07,
-    (float)4.88457e-07,
-    (float)4.81702e-07,
-    (float)5.1091e-08,
-    (float)3.78488e-07,
-    (float)1.83265e-06,
-    (float)1.67911e-08,
-    (float)4.09625e-07,
-    (float)2.71723e-07,
-    (float)1.31198e-07,
-    (float)5.01839e-08,
-    (float)1.47947e-07,
-    (float)1.74398e-07,
-    (float)2.84334e-07,
-    (float)9.28252e-08,
-    (float)1.89822e-06,
-    (float)6.38177e-08,
-    (float)1.61196e-07,
-    (float)3.0692e-08,
-    (float)2.33583e-07,
-    (float)2.12868e-07,
-    (float)2.11444e-07,
-    (float)3.88269e-08,
-    (float)4.89539e-08,
-    (float)8.74344e-08,
-    (float)1.48739e-07,
-    (float)9.26336e-08,
-    (float)3.79976e-07,
-    (float)1.46867e-07,
-    (float)6.89766e-08,
-    (float)4.01504e-07,
-    (float)2.60832e-07,
-    (float)3.45558e-07,
-    (float)9.30547e-08,
-    (float)2.18954e-07,
-    (float)4.68278e-07,
-    (float)2.9461e-07,
-    (float)5.87807e-08,
-    (float)6.66424e-07,
-    (float)2.39283e-07,
-    (float)3.00473e-08,
-    (float)1.68283e-07,
-    (float)8.84448e-07,
-    (float)5.94536e-08,
-    (float)1.42668e-07,
-    (float)2.16039e-07,
-    (float)0.169655,
-    (float)0.035921,
-    (float)0.34501,
-    (float)0.0169513,
-    (float)0.337519,
-    (float)0.0307291,
-    (float)0.0559946,
-    (float)0.00293985,
-    (float)0.000266466,
-    (float)0.00209278,
-    (float)0.00114538,
-    (float)0.000426863,
-    (float)0.000257633,
-    (float)0.000286231,
-    (float)0.000194067,
-    (float)6.43869e-05,
-    (float)1.5469e-05,
-    (float)0.000191833,
-    (float)9.89915e-06,
-    (float)1.95908e-05,
-    (float)1.32118e-05,
-    (float)6.33981e-05,
-    (float)3.20781e-05,
-    (float)1.94518e-05,
-    (float)1.22117e-05,
-    (float)1.59105e-05,
-    (float)7.60309e-06,
-    (float)4.08773e-06,
-    (float)1.78797e-06,
-    (float)6.08154e-06,
-    (float)9.26916e-06,
-    (float)5.6536e-06,
-    (float)1.49464e-06,
-    (float)1.51161e-06,
-    (float)8.00212e-06,
-    (float)5.27527e-06,
-    (float)3.5514e-06,
-    (float)6.52926e-06,
-    (float)4.37112e-06,
-    (float)6.93732e-07,
-    (float)1.69742e-06,
-    (float)7.4121e-06,
-    (float)6.80493e-08,
-    (float)9.42944e-06,
-    (float)1.11289e-05,
-    (float)1.02046e-06,
-    (float)2.32873e-06,
-    (float)1.82632e-06,
-    (float)3.9023e-06,
-    (float)1.19708e-06,
-    (float)1.31724e-06,
-    (float)6.73074e-07,
-    (float)3.98684e-06,
-    (float)3.09587e-06,
-    (float)2.09709e-06,
-    (float)9.49607e-07,
-    (float)1.09073e-06,
-    (float)1.26876e-06,
-    (float)2.38376e-06,
-    (float)9.04827e-08,
-    (float)2.94507e-08,
-    (float)9.9275e-07,
-    (float)5.92997e-06,
-    (float)9.86388e-07,
-    (float)4.17616e-07,
-    (float)7.56075e-07,
-    (float)8.75106e-07,
-    (float)6.79708e-07,
-    (float)2.71137e-07,
-    (float)8.75119e-07,
-    (float)1.09708e-06,
-    (float)4.00012e-07,
-    (float)1.94954e-07,
-    (float)5.5407e-07,
-    (float)3.24605e-07,
-    (float)1.63544e-07,
-    (float)2.2551e-07,
-    (float)7.69491e-07,
-    (float)2.10445e-07,
-    (float)5.6444e-09,
-    (float)2.4404e-07,
-    (float)2.72748e-07,
-    (float)7.01549e-07,
-    (float)5.87464e-07,
-    (float)4.38882e-07,
-    (float)1.90803e-07,
-    (float)2.1908e-07,
-    (float)5.97948e-07,
-    (float)3.41445e-07,
-    (float)2.71836e-08,
-    (float)1.84571e-07,
-    (float)9.96354e-07,
-    (float)1.73331e-07,
-    (float)6.1501e-07,
-    (float)1.182e-08,
-    (float)2.32081e-07,
-    (float)9.441e-08,
-    (float)2.54072e-07,
-    (float)1.69928e-07,
-    (float)6.954e-08,
-    (float)2.24831e-08,
-    (float)9.69601e-07,
-    (float)1.02526e-06,
-    (float)2.83107e-07,
-    (float)2.57617e-07,
-    (float)4.61249e-08,
-    (float)2.76889e-07,
-    (float)8.90315e-08,
-    (float)2.29776e-07,
-    (float)1.33397e-07,
-    (float)2.29493e-07,
-    (float)2.3929e-07,
-    (float)6.25725e-08,
-    (float)1.08734e-07,
-    (float)5.37518e-07,
-    (float)5.32243e-08,
-    (float)2.73715e-07,
-    (float)6.88425e-08,
-    (float)1.77049e-07,
-    (float)2.15208e-07,
-    (float)1.1868e-07,
-    (float)4.14542e-07,
-    (float)1.13999e-07,
-    (float)8.9728e-07,
-    (float)4.42756e-07,
-    (float)1.78106e-07,
-    (float)3.44197e-07,
-    (float)6.63417e-07,
-    (float)0.192618,
-    (float)0.0463543,
-    (float)0.280268,
-    (float)0.0162131,
-    (float)0.32998,
-    (float)0.0384227,
-    (float)0.0817827,
-    (float)0.00849862,
-    (float)0.000466695,
-    (float)0.00128447,
-    (float)0.00146895,
-    (float)0.00138785,
-    (float)4.56324e-05,
-    (float)0.000141705,
-    (float)0.000330806,
-    (float)0.000158193,
-    (float)1.56307e-05,
-    (float)0.000153846,
-    (float)5.83038e-06,
-    (float)8.01589e-05,
-    (float)8.52832e-06,
-    (float)3.82428e-05,
-    (float)1.07753e-05,
-    (float)5.44477e-05,
-    (float)2.51528e-05,
-    (float)1.71007e-05,
-    (float)4.20567e-06,
-    (float)1.54086e-05,
-    (float)5.24045e-06,
-    (float)2.63625e-06,
-    (float)1.44766e-06,
-    (float)9.64084e-06,
-    (float)7.48577e-06,
-    (float)6.7395e-06,
-    (float)3.48479e-07,
-    (float)2.31485e-07,
-    (float)8.16737e-06,
-    (float)1.43517e-06,
-    (float)8.13714e-06,
-    (float)7.06237e-06,
-    (float)3.45126e-06,
-    (float)1.93355e-06,
-    (float)2.52445e-06,
-    (float)4.70314e-06,
-    (float)1.29725e-06,
-    (float)7.18714e-06,
-    (float)1.15499e-05,
-    (float)1.69475e-07,
-    (float)6.58312e-06,
-    (float)2.68321e-06,
-    (float)1.97977e-06,
-    (float)6.3079e-07,
-    (float)1.43053e-06,
-    (float)1.14355e-06,
-    (float)3.52952e-06,
-    (float)1.1224e-06,
-    (float)1.6195e-06,
-    (float)1.07751e-06,
-    (float)3.63581e-06,
-    (float)6.59602e-07,
-    (float)5.49601e-07,
-    (float)5.49608e-07,
-    (float)1.60464e-06,
-    (float)6.65609e-07,
-    (float)1.44408e-06,
-    (float)1.41541e-06,
-    (float)3.51932e-06,
-    (float)1.95393e-06,
-    (float)1.2053e-08,
-    (float)5.32846e-07,
-    (float)4.90864e-07,
-    (float)4.42279e-07,
-    (float)5.57803e-07,
-    (float)6.01814e-07,
-    (float)1.20253e-06,
-    (float)4.47268e-07,
-    (float)6.77383e-08,
-    (float)2.70497e-07,
-    (float)5.25882e-07,
-    (float)7.78232e-08,
-    (float)1.52011e-07,
-    (float)4.12923e-07,
-    (float)6.41661e-07,
-    (float)1.27316e-07,
-    (float)8.01997e-08,
-    (float)1.29489e-07,
-    (float)6.63146e-07,
-    (float)4.12849e-07,
-    (float)1.19156e-07,
-    (float)5.72844e-07,
-    (float)3.55485e-07,
-    (float)9.03734e-08,
-    (float)2.93062e-07,
-    (float)3.65919e-07,
-    (float)2.44085e-07,
-    (float)1.45548e-07,
-    (float)3.93671e-07,
-    (float)2.35377e-08,
-    (float)5.95785e-07,
-    (float)1.93201e-07,
-    (float)7.7464e-07,
-    (float)2.62379e-07,
-    (float)2.19006e-07,
-    (float)5.88606e-09,
-    (float)4.99262e-07,
-    (float)3.57e-07,
-    (float)3.33548e-07,
-    (float)1.27372e-08,
-    (float)1.61003e-06,
-    (float)2.3337e-07,
-    (float)3.25697e-07,
-    (float)2.65172e-08,
-    (float)9.37965e-08,
-    (float)6.94175e-08,
-    (float)3.22857e-07,
-    (float)1.79242e-07,
-    (float)3.62981e-07,
-    (float)3.7589e-07,
-    (float)8.38113e-08,
-    (float)2.07868e-07,
-    (float)3.36008e-07,
-    (float)7.26021e-07,
-    (float)1.8265e-07,
-    (float)6.23436e-07,
-    (float)1.39547e-07,
-    (float)4.01169e-07,
-    (float)1.59646e-07,
-    (float)2.66946e-07,
-    (float)0.215259,
-    (float)0.0586124,
-    (float)0.221906,
-    (float)0.0156517,
-    (float)0.310426,
-    (float)0.0441619,
-    (float)0.106287,
-    (float)0.0180408,
-    (float)0.00433873,
-    (float)0.000381348,
-    (float)0.00100415,
-    (float)0.00244482,
-    (float)9.98957e-05,
-    (float)0.000120861,
-    (float)0.000294895,
-    (float)0.000314665,
-    (float)0.000101222,
-    (float)4.94669e-05,
-    (float)1.38055e-06,
-    (float)0.000165996,
-    (float)3.24347e-06,
-    (float)1.98755e-05,
-    (float)1.0413e-05,
-    (float)4.93373e-05,
-    (float)5.96957e-06,
-    (float)5.26978e-05,
-    (float)1.44015e-05,
-    (float)1.5958e-05,
-    (float)2.02395e-06,
-    (float)1.79005e-05,
-    (float)2.19295e-06,
-    (float)2.2654e-06,
-    (float)2.1501e-06,
-    (float)1.09441e-05,
-    (float)6.3599e-06,
-    (float)7.12224e-06,
-    (float)2.75528e-07,
-    (float)1.16443e-07,
-    (float)4.47093e-06,
-    (float)1.71025e-07,
-    (float)9.52844e-06,
-    (float)3.443e-06,
-    (float)6.723e-06,
-    (float)4.5955e-06,
-    (float)1.18922e-06,
-    (float)6.41608e-07,
-    (float)5.73725e-06,
-    (float)4.01349e-06,
-    (float)8.54441e-06,
-    (float)4.68712e-07,
-    (float)1.10633e-05,
-    (float)5.49745e-06,
-    (float)6.43294e-07,
-    (float)1.61384e-07,
-    (float)2.18794e-06,
-    (float)2.78491e-06,
-    (float)1.51634e-06,
-    (float)7.29867e-07,
-    (float)1.30459e-06,
-    (float)1.68639e-06,
-    (float)3.80357e-06,
-    (float)2.74239e-07,
-    (float)2.15874e-06,
-    (float)1.36471e-06,
-    (float)9.50145e-07,
-    (float)8.77823e-07,
-    (float)5.33156e-07,
-    (float)7.97077e-07,
-    (float)1.47289e-06,
-    (float)2.13384e-06,
-    (float)1.99798e-06,
-    (float)3.57205e-06,
-    (float)1.56055e-07,
-    (float)7.08029e-09,
-    (float)6.44429e-07,
-    (float)6.40509e-07,
-    (float)3.69897e-07,
-    (float)3.14739e-07,
-    (float)9.58314e-07,
-    (float)6.4149e-07,
-    (float)3.8968e-07,
-    (float)1.83017e-07,
-    (float)2.70376e-07,
-    (float)3.22929e-07,
-    (float)2.30338e-07,
-    (float)5.39511e-08,
-    (float)1.62045e-07,
-    (float)1.14882e-07,
-    (float)2.02568e-07,
-    (float)3.86733e-08,
-    (float)1.12563e-07,
-    (float)2.31476e-07,
-    (float)1.79742e-07,
-    (float)1.41005e-07,
-    (float)5.61658e-07,
-    (float)3.31403e-07,
-    (float)4.01069e-08,
-    (float)1.2457e-08,
-    (float)4.82789e-07,
-    (float)1.5039e-07,
-    (float)3.08348e-08,
-    (float)3.32213e-08,
-    (float)2.16546e-07,
-    (float)1.16684e-07,
-    (float)2.78874e-07,
-    (float)3.62643e-07,
-    (float)5.09782e-07,
-    (float)4.35419e-07,
-    (float)2.20325e-07,
-    (float)2.07918e-07,
-    (float)1.69949e-07,
-    (float)5.95955e-07,
-    (float)4.51129e-07,
-    (float)4.9758e-07,
-    (float)2.30034e-07,
-    (float)1.6609e-06,
-    (float)1.81701e-07,
-    (float)1.87825e-07,
-    (float)8.95912e-08,
-    (float)1.96975e-07,
-    (float)5.91823e-07,
-    (float)1.58662e-07,
-    (float)1.57577e-07,
-    (float)1.43549e-07,
-    (float)4.13202e-07,
-    (float)2.63124e-07,
-    (float)2.21573e-07,
-    (float)5.11326e-07,
-    (float)0.236762,
-    (float)0.0728671,
-    (float)0.170694,
-    (float)0.0160939,
-    (float)0.281179,
-    (float)0.046882,
-    (float)0.125512,
-    (float)0.0309684,
-    (float)0.012421,
-    (float)0.00162279,
-    (float)0.000220883,
-    (float)0.00236515,
-    (float)0.000251127,
-    (float)0.00090812,
-    (float)0.000156477,
-    (float)0.000141536,
-    (float)0.000194913,
-    (float)0.000223664,
-    (float)2.27078e-05,
-    (float)5.33796e-05,
-    (float)7.54935e-06,
-    (float)0.000116652,
-    (float)7.85307e-06,
-    (float)2.26318e-06,
-    (float)6.98474e-06,
-    (float)5.80844e-05,
-    (float)1.1902e-06,
-    (float)6.12683e-05,
-    (float)6.84776e-06,
-    (float)1.55956e-05,
-    (float)5.75263e-06,
-    (float)1.57698e-05,
-    (float)2.62589e-06,
-    (float)3.05279e-06,
-    (float)3.22077e-06,
-    (float)8.30342e-06,
-    (float)9.60943e-06,
-    (float)8.73305e-06,
-    (float)1.02509e-06,
-    (float)3.18429e-07,
-    (float)1.26746e-06,
-    (float)2.70827e-06,
-    (float)5.73381e-06,
-    (float)4.97419e-07,
-    (float)1.25697e-05,
-    (float)6.84635e-06,
-    (float)9.91758e-07,
-    (float)6.45187e-07,
-    (float)5.73818e-06,
-    (float)2.46649e-06,
-    (float)7.31654e-06,
-    (float)7.73126e-08,
-    (float)8.56142e-06,
-    (float)1.02436e-05,
-    (float)8.49773e-07,
-    (float)4.29543e-06,
-    (float)1.67141e-06,
-    (float)1.74128e-06,
-    (float)4.95261e-07,
-    (float)2.64343e-06,
-    (float)1.03266e-06,
-    (float)1.89786e-06,
-    (float)5.07076e-07,
-    (float)8.82792e-07,
-    (float)3.55345e-06,
-    (float)2.21506e-06,
-    (float)6.26005e-07,
-    (float)2.07405e-06,
-    (float)7.5379e-07,
-    (float)7.84575e-07,
-    (float)2.9784e-07,
-    (float)6.40326e-07,
-    (float)1.15002e-06,
-    (float)1.20734e-06,
-    (float)1.12235e-06,
-    (float)2.77238e-06,
-    (float)1.59676e-06,
-    (float)1.85346e-07,
-    (float)2.3366e-07,
-    (float)2.57341e-07,
-    (float)7.82299e-07,
-    (float)2.15306e-07,
-    (float)6.6523e-08,
-    (float)9.8374e-07,
-    (float)3.72093e-07,
-    (float)9.8107e-08,
-    (float)1.22336e-07,
-    (float)2.16921e-07,
-    (float)1.4402e-07,
-    (float)8.27703e-08,
-    (float)1.38916e-07,
-    (float)1.85939e-07,
-    (float)1.48586e-07,
-    (float)2.72033e-07,
-    (float)1.59985e-07,
-    (float)6.71201e-09,
-    (float)3.70713e-07,
-    (float)1.21249e-07,
-    (float)4.26226e-07,
-    (float)3.56611e-07,
-    (float)3.33183e-07,
-    (float)6.93553e-08,
-    (float)9.47779e-09,
-    (float)2.91435e-07,
-    (float)3.40454e-08,
-    (float)2.90535e-07,
-    (float)2.27162e-08,
-    (float)1.84629e-07,
-    (float)1.16235e-07,
-    (float)1.32908e-07,
-    (float)2.51053e-07,
-    (float)7.21995e-07,
-    (float)3.51476e-08,
-    (float)1.85944e-06,
-    (float)1.58586e-07,
-    (float)4.61283e-07,
-    (float)2.91049e-07,
-    (float)9.05683e-07,
-    (float)1.01928e-06,
-    (float)3.23733e-07,
-    (float)2.35183e-07,
-    (float)6.90793e-07,
-    (float)1.10292e-06,
-    (float)1.18844e-07,
-    (float)5.6528e-07,
-    (float)1.75387e-07,
-    (float)1.58952e-07,
-    (float)3.01673e-07,
-    (float)0.256771,
-    (float)0.0889623,
-    (float)0.127165,
-    (float)0.0183221,
-    (float)0.245571,
-    (float)0.0457226,
-    (float)0.136587,
-    (float)0.0448732,
-    (float)0.0233985,
-    (float)0.00773253,
-    (float)0.000231075,
-    (float)0.000919915,
-    (float)0.000266524,
-    (float)0.00212425,
-    (float)3.97654e-05,
-    (float)7.64881e-05,
-    (float)0.000241172,
-    (float)0.000306154,
-    (float)7.0877e-05,
-    (float)0.000116913,
-    (float)1.33337e-05,
-    (float)5.23246e-05,
-    (float)2.21741e-05,
-    (float)7.48262e-05,
-    (float)1.25095e-05,
-    (float)1.81104e-07,
-    (float)5.84376e-06,
-    (float)5.57516e-05,
-    (float)2.65479e-06,
-    (float)6.90352e-05,
-    (float)6.69758e-07,
-    (float)1.61661e-05,
-    (float)1.05623e-05,
-    (float)7.83451e-06,
-    (float)1.01311e-05,
-    (float)3.95219e-06,
-    (float)1.16118e-06,
-    (float)5.33983e-06,
-    (float)1.31682e-05,
-    (float)1.04207e-05,
-    (float)5.02582e-06,
-    (float)9.62462e-07,
-    (float)1.42491e-07,
-    (float)3.86073e-06,
-    (float)1.41421e-07,
-    (float)1.50631e-06,
-    (float)7.21787e-06,
-    (float)7.11955e-06,
-    (float)7.48445e-06,
-    (float)4.42276e-06,
-    (float)2.49651e-06,
-    (float)1.32065e-06,
-    (float)3.54514e-06,
-    (float)4.24596e-06,
-    (float)5.8294e-06,
-    (float)4.30788e-06,
-    (float)7.10555e-07,
-    (float)1.14556e-05,
-    (float)2.06036e-06,
-    (float)2.17275e-06,
-    (float)1.59754e-06,
-    (float)1.79259e-06,
-    (float)8.56815e-07,
-    (float)1.50707e-06,
-    (float)1.26763e-06,
-    (float)9.25674e-07,
-    (float)7.36027e-07,
-    (float)3.9577e-07,
-    (float)1.36262e-06,
-    (float)2.73208e-06,
-    (float)1.81792e-07,
-    (float)1.72984e-06,
-    (float)1.34592e-06,
-    (float)2.00342e-07,
-    (float)2.03801e-07,
-    (float)5.66059e-07,
-    (float)8.74418e-07,
-    (float)2.96147e-07,
-    (float)1.12267e-07,
-    (float)1.57356e-06,
-    (float)2.4007e-06,
-    (float)4.03177e-07,
-    (float)9.04315e-07,
-    (float)2.20221e-07,
-    (float)2.28747e-07,
-    (float)2.31527e-07,
-    (float)3.31612e-07,
-    (float)4.99496e-08,
-    (float)5.41239e-07,
-    (float)3.14099e-07,
-    (float)3.78559e-07,
-    (float)3.97262e-07,
-    (float)2.57554e-07,
-    (float)1.72905e-07,
-    (float)5.11508e-08,
-    (float)6.54168e-08,
-    (float)1.89911e-07,
-    (float)3.72067e-07,
-    (float)2.76523e-07,
-    (float)2.56162e-08,
-    (float)2.76187e-08,
-    (float)3.90468e-07,
-    (float)3.34509e-07,
-    (float)2.85066e-07,
-    (float)6.75283e-08,
-    (float)2.72669e-07,
-    (float)2.64156e-07,
-    (float)5.28586e-07,
-    (float)3.10934e-07,
-    (float)5.59663e-08,
-    (float)1.06036e-07,
-    (float)2.50332e-07,
-    (float)5.53411e-07,
-    (float)7.88131e-08,
-    (float)1.45724e-08,
-    (float)1.14139e-07,
-    (float)6.92009e-07,
-    (float)3.74061e-07,
-    (float)3.16963e-08,
-    (float)2.65655e-07,
-    (float)8.38241e-07,
-    (float)3.06216e-07,
-    (float)2.93807e-07,
-    (float)6.88994e-07,
-    (float)6.84594e-07,
-    (float)2.71556e-07,
-    (float)7.4342e-07,
-    (float)9.20422e-07,
-    (float)0.273911,
-    (float)0.106565,
-    (float)0.0912579,
-    (float)0.0232035,
-    (float)0.206974,
-    (float)0.0411374,
-    (float)0.13856,
-    (float)0.0565162,
-    (float)0.0348905,
-    (float)0.0201411,
-    (float)0.00182736,
-    (float)0.000450636,
-    (float)0.000173811,
-    (float)0.00213742,
-    (float)3.61356e-06,
-    (float)0.000908388,
-    (float)0.000218601,
-    (float)3.1088e-05,
-    (float)0.000159262,
-    (float)0.000330832,
-    (float)1.98346e-05,
-    (float)7.5423e-05,
-    (float)1.49698e-05,
-    (float)3.07989e-05,
-    (float)4.24359e-05,
-    (float)4.70183e-05,
-    (float)2.09175e-05,
-    (float)1.09386e-06,
-    (float)4.07284e-06,
-    (float)4.05376e-05,
-    (float)1.64488e-05,
-    (float)6.57494e-05,
-    (float)8.61043e-06,
-    (float)2.25507e-05,
-    (float)1.14244e-05,
-    (float)9.18686e-07,
-    (float)2.27742e-05,
-    (float)1.40812e-06,
-    (float)2.90787e-06,
-    (float)2.17197e-06,
-    (float)8.78146e-06,
-    (float)1.01471e-05,
-    (float)1.3112e-05,
-    (float)3.70344e-06,
-    (float)1.09876e-06,
-    (float)1.34074e-06,
-    (float)6.12555e-07,
-    (float)2.88421e-06,
-    (float)8.51181e-07,
-    (float)3.8251e-06,
-    (float)3.27416e-06,
-    (float)1.37336e-05,
-    (float)6.29229e-06,
-    (float)3.22413e-06,
-    (float)1.95292e-06,
-    (float)2.71301e-06,
-    (float)1.4812e-06,
-    (float)6.49618e-06,
-    (float)1.84075e-06,
-    (float)6.32115e-06,
-    (float)1.02445e-06,
-    (float)6.44313e-06,
-    (float)7.80971e-06,
-    (float)1.03332e-06,
-    (float)2.51488e-06,
-    (float)4.55389e-07,
-    (float)1.02969e-06,
-    (float)4.98224e-07,
-    (float)2.56202e-06,
-    (float)6.13578e-08,
-    (float)1.02045e-06,
-    (float)2.78638e-07,
-    (float)1.3984e-06,
-    (float)2.15679e-06,
-    (float)6.83588e-07,
-    (float)1.55845e-06,
-    (float)2.94192e-06,
-    (float)2.83943e-07,
-    (float)7.89671e-07,
-    (float)3.33008e-07,
-    (float)3.11488e-07,
-    (float)5.14359e-07,
-    (float)3.48102e-07,
-    (float)3.85569e-07,
-    (float)3.71252e-07,
-    (float)4.44899e-07,
-    (float)9.35888e-07,
-    (float)1.85219e-06,
-    (float)4.95775e-07,
-    (float)9.11441e-07,
-    (float)4.62763e-07,
-    (float)6.88056e-10,
-    (float)8.64523e-08,
-    (float)5.88898e-07,
-    (float)6.18316e-08,
-    (float)6.45373e-07,
-    (float)1.60245e-07,
-    (float)8.1964e-10,
-    (float)3.08865e-07,
-    (float)7.13379e-07,
-    (float)3.60825e-07,
-    (float)4.17389e-07,
-    (float)1.29695e-08,
-    (float)1.28609e-07,
-    (float)1.9088e-07,
-    (float)6.38977e-07,
-    (float)1.05226e-07,
-    (float)7.44258e-08,
-    (float)1.82704e-07,
-    (float)4.65775e-07,
-    (float)2.96289e-07,
-    (float)5.02287e-07,
-    (float)5.38685e-07,
-    (float)2.06991e-07,
-    (float)1.42622e-06,
-    (float)3.4282e-07,
-    (float)3.16952e-07,
-    (float)1.40438e-07,
-    (float)3.53969e-07,
-    (float)9.27468e-07,
-    (float)5.17219e-07,
-    (float)4.15587e-07,
-    (float)4.44465e-08,
-    (float)1.34782e-06,
-    (float)3.86689e-07,
-    (float)1.94556e-06,
-    (float)6.6152e-07,
-    (float)5.90581e-10,
-    (float)0.287515,
-    (float)0.125338,
-    (float)0.0627579,
-    (float)0.0315663,
-    (float)0.168873,
-    (float)0.0342557,
-    (float)0.132419,
-    (float)0.0620204,
-    (float)0.044234,
-    (float)0.0366976,
-    (float)0.0048339,
-    (float)0.0050259,
-    (float)0.000231523,
-    (float)0.000575495,
-    (float)8.67374e-05,
-    (float)0.00173222,
-    (float)0.000194455,
-    (float)0.000236573,
-    (float)0.000262624,
-    (float)0.000136398,
-    (float)8.81064e-05,
-    (float)0.000309688,
-    (float)9.22602e-06,
-    (float)7.1652e-05,
-    (float)1.14463e-05,
-    (float)8.53028e-06,
-    (float)5.82596e-05,
-    (float)2.24411e-05,
-    (float)4.04237e-05,
-    (float)2.40777e-06,
-    (float)7.54699e-07,
-    (float)2.2919e-05,
-    (float)2.75273e-05,
-    (float)4.85113e-05,
-    (float)3.87983e-05,
-    (float)2.68749e-05,
-    (float)1.40261e-05,
-    (float)3.73271e-06,
-    (float)2.07341e-05,
-    (float)4.31092e-06,
-    (float)1.51369e-05,
-    (float)6.24398e-07,
-    (float)1.79445e-06,
-    (float)6.02724e-06,
-    (float)1.16671e-05,
-    (float)1.35054e-05,
-    (float)9.87401e-06,
-    (float)2.08989e-06,
-    (float)6.95961e-07,
-    (float)1.44574e-06,
-    (float)2.48042e-06,
-    (float)7.9677e-07,
-    (float)1.56165e-06,
-    (float)3.86649e-06,
-    (float)1.84248e-06,
-    (float)1.21803e-05,
-    (float)8.81102e-06,
-    (float)6.2605e-06,
-    (float)2.65665e-06,
-    (float)1.56866e-06,
-    (float)1.34511e-06,
-    (float)4.56287e-06,
-    (float)4.50118e-06,
-    (float)4.68812e-06,
-    (float)1.90857e-06,
-    (float)7.17818e-07,
-    (float)8.78005e-06,
-    (float)7.70206e-07,
-    (float)7.55349e-06,
-    (float)1.92819e-06,
-    (float)2.62877e-07,
-    (float)3.15399e-07,
-    (float)1.25772e-06,
-    (float)8.38198e-07,
-    (float)7.98253e-07,
-    (float)2.55245e-07,
-    (float)6.90851e-08,
-    (float)7.82545e-07,
-    (float)3.58446e-07,
-    (float)1.02544e-06,
-    (float)2.08353e-06,
-    (float)2.41932e-07,
-    (float)1.83521e-06,
-    (float)1.2007e-06,
-    (float)1.91504e-07,
-    (float)3.72084e-07,
-    (float)1.88542e-07,
-    (float)7.59109e-08,
-    (float)1.00194e-07,
-    (float)2.1605e-07,
-    (float)1.57907e-07,
-    (float)2.19703e-07,
-    (float)1.90765e-07,
-    (float)6.29399e-07,
-    (float)2.98552e-07,
-    (float)1.28774e-06,
-    (float)4.72665e-07,
-    (float)1.21841e-06,
-    (float)3.18737e-07,
-    (float)2.41125e-07,
-    (float)6.00597e-08,
-    (float)5.17619e-07,
-    (float)4.97582e-07,
-    (float)3.86834e-07,
-    (float)9.72119e-08,
-    (float)3.21828e-07,
-    (float)6.75593e-07,
-    (float)1.04501e-06,
-    (float)1.52054e-06,
-    (float)5.2505e-07,
-    (float)4.71344e-08,
-    (float)2.77569e-08,
-    (float)2.20584e-06,
-    (float)3.90108e-07,
-    (float)2.65846e-06,
-    (float)2.04334e-07,
-    (float)7.73367e-08,
-    (float)7.07545e-07,
-    (float)1.10828e-06,
-    (float)1.3064e-06,
-    (float)9.54737e-07,
-    (float)1.34084e-07,
-    (float)1.22401e-08,
-    (float)9.19616e-07,
-    (float)7.5539e-07,
-    (float)1.23028e-06,
-    (float)2.67339e-07,
-    (float)9.93212e-08,
-    (float)0.296775,
-    (float)0.144743,
-    (float)0.0410657,
-    (float)0.0436835,
-    (float)0.133758,
-    (float)0.0273415,
-    (float)0.12026,
-    (float)0.0595549,
-    (float)0.0498031,
-    (float)0.052223,
-    (float)0.00833434,
-    (float)0.0169984,
-    (float)0.000499543,
-    (float)0.00071246,
-    (float)0.000243013,
-    (float)0.000950458,
-    (float)0.000241667,
-    (float)0.000941263,
-    (float)0.000427936,
-    (float)4.31205e-05,
-    (float)0.000218955,
-    (float)0.00019825,
-    (float)5.04025e-05,
-    (float)0.000294639,
-    (float)2.42815e-05,
-    (float)9.72659e-05,
-    (float)2.89784e-07,
-    (float)4.99638e-06,
-    (float)4.56195e-05,
-    (float)2.2679e-06,
-    (float)6.5702e-05,
-    (float)3.73437e-07,
-    (float)1.08044e-05,
-    (float)9.49881e-06,
-    (float)1.57473e-05,
-    (float)2.13251e-05,
-    (float)6.84048e-05,
-    (float)1.42712e-05,
-    (float)5.26432e-05,
-    (float)1.28622e-06,
-    (float)1.45063e-05,
-    (float)9.33603e-06,
-    (float)7.33383e-06,
-    (float)1.58163e-05,
-    (float)2.73905e-06,
-    (float)2.3078e-06,
-    (float)2.95075e-06,
-    (float)4.68625e-06,
-    (float)1.24543e-05,
-    (float)1.24354e-05,
-    (float)1.0298e-05,
-    (float)4.80286e-06,
-    (float)6.87604e-07,
-    (float)2.6332e-07,
-    (float)2.33561e-06,
-    (float)7.09329e-07,
-    (float)1.91937e-06,
-    (float)8.24579e-07,
-    (float)1.11063e-06,
-    (float)3.35165e-06,
-    (float)1.06035e-05,
-    (float)6.32649e-06,
-    (float)8.73605e-06,
-    (float)3.97754e-06,
-    (float)6.9685e-07,
-    (float)4.23754e-07,
-    (float)4.16483e-06,
-    (float)1.67407e-06,
-    (float)5.16053e-06,
-    (float)7.31074e-07,
-    (float)2.59507e-06,
-    (float)1.39159e-06,
-    (float)1.91391e-06,
-    (float)7.03014e-06,
-    (float)3.15136e-07,
-    (float)4.61795e-06,
-    (float)1.32652e-07,
-    (float)1.17156e-07,
-    (float)2.51168e-07,
-    (float)8.19219e-07,
-    (float)4.62668e-08,
-    (float)5.99626e-07,
-    (float)2.60762e-07,
-    (float)1.20764e-07,
-    (float)1.52983e-06,
-    (float)5.04316e-07,
-    (float)2.03532e-06,
-    (float)1.4951e-06,
-    (float)4.98475e-07,
-    (float)1.86888e-06,
-    (float)8.99942e-08,
-    (float)8.98341e-07,
-    (float)4.63867e-07,
-    (float)2.66917e-07,
-    (float)1.49592e-07,
-    (float)1.09943e-07,
-    (float)6.67735e-08,
-    (float)7.13833e-08,
-    (float)6.19678e-07,
-    (float)1.48928e-07,
-    (float)3.79496e-07,
-    (float)2.36133e-07,
-    (float)3.36708e-07,
-    (float)5.97871e-08,
-    (float)2.48086e-06,
-    (float)5.43905e-07,
-    (float)2.42936e-06,
-    (float)7.34122e-07,
-    (float)3.41741e-07,
-    (float)1.81289e-08,
-    (float)3.54822e-07,
-    (float)1.10783e-06,
-    (float)4.84697e-07,
-    (float)1.06039e-06,
-    (float)2.6082e-08,
-    (float)1.22927e-07,
-    (float)3.00522e-07,
-    (float)1.39864e-06,
-    (float)8.76382e-07,
-    (float)9.89287e-07,
-    (float)3.15139e-07,
-    (float)7.45083e-09,
-    (float)2.63892e-07,
-    (float)8.34588e-07,
-    (float)1.22234e-06,
-    (float)6.77372e-07,
-    (float)5.58005e-07,
-    (float)9.75154e-11,
-    (float)0.300292,
-    (float)0.163292,
-    (float)0.0252992,
-    (float)0.0592868,
-    (float)0.103692,
-    (float)0.023065,
-    (float)0.10562,
-    (float)0.0499407,
-    (float)0.0519367,
-    (float)0.0604183,
-    (float)0.011529,
-    (float)0.0333135,
-    (float)0.000873613,
-    (float)0.00701076,
-    (float)0.000405723,
-    (float)4.63596e-05,
-    (float)0.000269108,
-    (float)0.000680179,
-    (float)0.000554543,
-    (float)0.000390701,
-    (float)0.000594549,
-    (float)1.73867e-05,
-    (float)0.000185111,
-    (float)0.00022628,
-    (float)3.16806e-05,
-    (float)0.00028617,
-    (float)7.03763e-05,
-    (float)0.000127591,
-    (float)2.36911e-05,
-    (float)2.25849e-05,
-    (float)7.73122e-06,
-    (float)2.08069e-06,
-    (float)5.4107e-05,
-    (float)6.17243e-06,
-    (float)3.7058e-05,
-    (float)9.78438e-06,
-    (float)4.0582e-07,
-    (float)8.28548e-06,
-    (float)3.83326e-05,
-    (float)1.15986e-05,
-    (float)7.66836e-05,
-    (float)1.16458e-05,
-    (float)4.89682e-05,
-    (float)5.67175e-06,
-    (float)9.83507e-06,
-    (float)1.36104e-05,
-    (float)2.23513e-08,
-    (float)1.93275e-05,
-    (float)1.05484e-06,
-    (float)6.57121e-06,
-    (float)1.54278e-06,
-    (float)5.77974e-07,
-    (float)8.39098e-06,
-    (float)8.68121e-06,
-    (float)1.20845e-05,
-    (float)9.71795e-06,
-    (float)4.69416e-06,
-    (float)2.03762e-06,
-    (float)1.30475e-07,
-    (float)7.42608e-07,
-    (float)1.44962e-06,
-    (float)2.87529e-06,
-    (float)2.20078e-07,
-    (float)5.64107e-07,
-    (float)1.9671e-06,
-    (float)2.14076e-06,
-    (float)7.46679e-06,
-    (float)6.96549e-06,
-    (float)6.79139e-06,
-    (float)3.70054e-06,
-    (float)2.3024e-06,
-    (float)2.84014e-08,
-    (float)8.17375e-07,
-    (float)3.123e-06,
-    (float)1.43867e-06,
-    (float)3.62746e-06,
-    (float)8.57895e-07,
-    (float)1.8792e-06,
-    (float)1.56464e-07,
-    (float)2.50289e-06,
-    (float)2.29974e-06,
-    (float)2.13628e-06,
-    (float)3.54799e-06,
-    (float)6.6392e-07,
-    (float)1.44871e-06,
-    (float)8.31308e-08,
-    (float)7.32956e-08,
-    (float)1.45545e-08,
-    (float)4.96525e-07,
-    (float)3.26106e-08,
-    (float)6.75104e-07,
-    (float)1.79896e-07,
-    (float)3.67642e-07,
-    (float)4.13179e-07,
-    (float)3.55943e-07,
-    (float)5.55026e-07,
-    (float)5.24129e-07,
-    (float)6.71967e-07,
-    (float)3.78551e-07,
-    (float)4.69717e-07,
-    (float)4.37511e-07,
-    (float)4.92314e-08,
-    (float)6.40942e-07,
-    (float)4.57659e-08,
-    (float)4.81725e-07,
-    (float)1.71999e-08,
-    (float)3.14648e-07,
-    (float)1.65073e-07,
-    (float)6.92445e-08,
-    (float)5.12787e-07,
-    (float)7.61986e-08,
-    (float)2.6835e-07,
-    (float)3.36747e-07,
-    (float)8.2533e-07,
-    (float)2.07863e-07,
-    (float)2.0478e-06,
-    (float)5.4735e-07,
-    (float)1.54434e-06,
-    (float)9.44243e-07,
-    (float)2.89314e-07,
-    (float)3.5873e-07,
-    (float)8.77355e-08,
-    (float)4.55611e-07,
-    (float)2.96219e-07,
-    (float)1.02651e-06,
-    (float)5.99422e-07,
-    (float)4.51668e-07,
-    (float)8.62291e-07,
-    (float)0.296626,
-    (float)0.18026,
-    (float)0.0145707,
-    (float)0.0777578,
-    (float)0.079541,
-    (float)0.0235928,
-    (float)0.0914545,
-    (float)0.0362829,
-    (float)0.0523628,
-    (float)0.0573331,
-    (float)0.0146408,
-    (float)0.0463514,
-    (float)0.00145186,
-    (float)0.0194562,
-    (float)0.000720183,
-    (float)0.0032596,
-    (float)0.00052849,
-    (float)8.7323e-06,
-    (float)0.00029546,
-    (float)0.000274305,
-    (float)0.000732069,
-    (float)9.3032e-05,
-    (float)0.000706804,
-    (float)3.19501e-05,
-    (float)0.000202066,
-    (float)0.000233615,
-    (float)5.31171e-06,
-    (float)0.000274151,
-    (float)0.000110325,
-    (float)0.000150751,
-    (float)0.000118143,
-    (float)4.67659e-05,
-    (float)2.77279e-05,
-    (float)8.39099e-06,
-    (float)6.31161e-06,
-    (float)1.66358e-05,
-    (float)2.46267e-05,
-    (float)3.69023e-05,
-    (float)9.38122e-06,
-    (float)2.52421e-05,
-    (float)2.35421e-06,
-    (float)2.3833e-06,
-    (float)3.01873e-05,
-    (float)1.68025e-05,
-    (float)4.48331e-05,
-    (float)4.26316e-05,
-    (float)2.526e-05,
-    (float)3.64666e-05,
-    (float)3.39238e-06,
-    (float)1.52111e-05,
-    (float)3.58637e-06,
-    (float)5.05486e-06,
-    (float)1.31844e-05,
-    (float)1.68868e-06,
-    (float)1.06401e-05,
-    (float)3.78399e-07,
-    (float)1.44889e-06,
-    (float)5.74964e-06,
-    (float)2.79105e-06,
-    (float)1.28233e-05,
-    (float)8.61326e-06,
-    (float)1.09508e-05,
-    (float)5.85413e-06,
-    (float)2.80692e-06,
-    (float)6.7003e-07,
-    (float)1.60356e-07,
-    (float)3.5065e-07,
-    (float)2.3714e-06,
-    (float)1.09681e-06,
-    (float)1.12793e-06,
-    (float)6.74944e-07,
-    (float)5.5488e-07,
-    (float)1.26102e-06,
-    (float)4.67575e-06,
-    (float)3.71764e-06,
-    (float)5.91955e-06,
-    (float)4.52035e-06,
-    (float)2.82977e-06,
-    (float)1.70506e-06,
-    (float)9.36204e-07,
-    (float)4.52594e-08,
-    (float)5.42915e-07,
-    (float)1.41679e-06,
-    (float)2.63018e-07,
-    (float)1.89713e-06,
-    (float)1.57591e-07,
-    (float)1.03719e-06,
-    (float)9.13968e-08,
-    (float)1.02053e-06,
-    (float)5.93616e-07,
-    (float)1.26784e-06,
-    (float)1.61462e-06,
-    (float)6.92434e-07,
-    (float)1.78879e-06,
-    (float)1.09232e-07,
-    (float)7.57077e-07,
-    (float)2.74269e-07,
-    (float)5.97901e-09,
-    (float)3.87845e-07,
-    (float)3.74371e-07,
-    (float)8.71249e-08,
-    (float)5.86826e-07,
-    (float)8.4597e-08,
-    (float)3.64424e-07,
-    (float)1.1768e-07,
-    (float)5.74725e-07,
-    (float)2.31165e-07,
-    (float)4.37414e-07,
-    (float)8.66009e-07,
-    (float)4.52864e-07,
-    (float)7.58375e-07,
-    (float)1.54978e-06,
-    (float)1.71224e-07,
-    (float)1.3939e-06,
-    (float)5.14445e-07,
-    (float)1.52584e-07,
-    (float)5.95601e-07,
-    (float)2.83315e-07,
-    (float)3.50137e-07,
-    (float)3.52802e-07,
-    (float)5.68108e-07,
-    (float)2.0788e-07,
-    (float)1.19812e-07,
-    (float)1.36492e-06,
-    (float)7.6276e-07,
-    (float)1.622e-06,
-    (float)3.42489e-06,
-    (float)1.01959e-06,
-    (float)0.284739,
-    (float)0.19345,
-    (float)0.00779876,
-    (float)0.0969514,
-    (float)0.0616284,
-    (float)0.029853,
-    (float)0.0802765,
-    (float)0.0236929,
-    (float)0.0535124,
-    (float)0.0444592,
-    (float)0.0189593,
-    (float)0.0489655,
-    (float)0.00285781,
-    (float)0.0314354,
-    (float)0.00138136,
-    (float)0.011585,
-    (float)0.00187792,
-    (float)0.00197249,
-    (float)0.000751417,
-    (float)9.34242e-05,
-    (float)0.000183388,
-    (float)9.81653e-05,
-    (float)0.000582249,
-    (float)2.71405e-05,
-    (float)0.000688334,
-    (float)9.68916e-05,
-    (float)0.000274027,
-    (float)0.000258429,
-    (float)7.3393e-06,
-    (float)0.000262542,
-    (float)9.86145e-05,
-    (float)0.000153017,
-    (float)0.000217112,
-    (float)6.92998e-05,
-    (float)0.000166541,
-    (float)2.46656e-05,
-    (float)5.7054e-05,
-    (float)7.1194e-07,
-    (float)6.28536e-06,
-    (float)1.45112e-05,
-    (float)7.59208e-07,
-    (float)4.25313e-05,
-    (float)3.34855e-06,
-    (float)3.30849e-05,
-    (float)1.11858e-05,
-    (float)3.34242e-06,
-    (float)1.95032e-05,
-    (float)1.06324e-05,
-    (float)1.90173e-05,
-    (float)4.9548e-05,
-    (float)1.41031e-05,
-    (float)6.4874e-05,
-    (float)1.09652e-05,
-    (float)4.03656e-05,
-    (float)8.49457e-06,
-    (float)1.07063e-05,
-    (float)7.24632e-06,
-    (float)1.61951e-06,
-    (float)7.57763e-06,
-    (float)4.58609e-06,
-    (float)4.94601e-06,
-    (float)4.75988e-06,
-    (float)8.61446e-07,
-    (float)2.3902e-06,
-    (float)3.13116e-06,
-    (float)3.40241e-06,
-    (float)9.83259e-06,
-    (float)5.76196e-06,
-    (float)1.11398e-05,
-    (float)4.50914e-06,
-    (float)5.56859e-06,
-    (float)1.37292e-06,
-    (float)7.29759e-07,
-    (float)8.54335e-08,
-    (float)5.16765e-07,
-    (float)2.28245e-07,
-    (float)1.17041e-06,
-    (float)3.04937e-07,
-    (float)3.36316e-07,
-    (float)2.50815e-07,
-    (float)6.17052e-07,
-    (float)8.60824e-07,
-    (float)2.51885e-06,
-    (float)2.47521e-06,
-    (float)3.16114e-06,
-    (float)3.46127e-06,
-    (float)1.96073e-06,
-    (float)2.34023e-06,
-    (float)8.59983e-07,
-    (float)5.3372e-07,
-    (float)7.1756e-07,
-    (float)1.61697e-08,
-    (float)9.6846e-07,
-    (float)4.258e-07,
-    (float)1.06493e-06,
-    (float)5.38248e-07,
-    (float)8.09673e-07,
-    (float)5.32608e-07,
-    (float)3.41411e-07,
-    (float)1.09661e-06,
-    (float)3.09909e-07,
-    (float)1.52502e-06,
-    (float)1.04304e-06,
-    (float)9.00908e-07,
-    (float)1.507e-06,
-    (float)1.96592e-07,
-    (float)9.59688e-07,
-    (float)4.84994e-07,
-    (float)6.98123e-07,
-    (float)9.84251e-07,
-    (float)1.37645e-06,
-    (float)1.00366e-06,
-    (float)1.48925e-06,
-    (float)7.29496e-07,
-    (float)8.355e-07,
-    (float)1.97313e-07,
-    (float)6.75963e-07,
-    (float)6.00702e-08,
-    (float)6.12419e-07,
-    (float)7.10381e-07,
-    (float)1.29335e-07,
-    (float)8.73304e-07,
-    (float)2.69749e-07,
-    (float)3.00217e-07,
-    (float)1.17546e-06,
-    (float)3.6489e-07,
-    (float)1.80874e-06,
-    (float)7.19143e-07,
-    (float)0.263497,
-    (float)0.200776,
-    (float)0.0039387,
-    (float)0.114203,
-    (float)0.0490261,
-    (float)0.0410207,
-    (float)0.0726893,
-    (float)0.0165688,
-    (float)0.057071,
-    (float)0.0277986,
-    (float)0.0264166,
-    (float)0.0402478,
-    (float)0.00660215,
-    (float)0.0356446,
-    (float)0.00238596,
-    (float)0.0202235,
-    (float)0.00396122,
-    (float)0.00715482,
-    (float)0.00364908,
-    (float)0.00141509,
-    (float)0.00151345,
-    (float)0.000239079,
-    (float)0.000169835,
-    (float)0.000169252,
-    (float)0.000145699,
-    (float)0.000139703,
-    (float)0.000365741,
-    (float)0.000239397,
-    (float)0.000235692,
-    (float)0.000368518,
-    (float)3.20179e-05,
-    (float)0.000317662,
-    (float)6.36808e-05,
-    (float)0.000143319,
-    (float)0.000231069,
-    (float)3.80619e-05,
-    (float)0.000299789,
-    (float)4.41439e-05,
-    (float)0.000220433,
-    (float)6.16626e-05,
-    (float)9.98579e-05,
-    (float)3.61575e-05,
-    (float)2.38043e-05,
-    (float)7.47102e-06,
-    (float)1.09939e-06,
-    (float)7.35925e-06,
-    (float)1.13556e-05,
-    (float)1.30687e-05,
-    (float)2.9771e-05,
-    (float)5.58098e-06,
-    (float)2.99825e-05,
-    (float)2.48593e-06,
-    (float)9.99276e-06,
-    (float)1.7574e-05,
-    (float)9.84771e-07,
-    (float)3.35715e-05,
-    (float)2.27492e-05,
-    (float)3.10712e-05,
-    (float)5.07094e-05,
-    (float)1.525e-05,
-    (float)5.1463e-05,
-    (float)2.63978e-06,
-    (float)2.82754e-05,
-    (float)6.64882e-07,
-    (float)7.83987e-06,
-    (float)5.54534e-06,
-    (float)2.15403e-06,
-    (float)9.0842e-06,
-    (float)3.55027e-06,
-    (float)6.7044e-06,
-    (float)3.74676e-06,
-    (float)2.23599e-06,
-    (float)2.55363e-06,
-    (float)2.20844e-06,
-    (float)2.48403e-06,
-    (float)6.69808e-06,
-    (float)3.45499e-06,
-    (float)9.91623e-06,
-    (float)3.62716e-06,
-    (float)8.19113e-06,
-    (float)2.32905e-06,
-    (float)3.74071e-06,
-    (float)6.98788e-07,
-    (float)8.00228e-07,
-    (float)9.22793e-08,
-    (float)6.122e-07,
-    (float)4.7424e-07,
-    (float)1.29317e-06,
-    (float)6.97402e-07,
-    (float)1.08553e-06,
-    (float)2.82485e-07,
-    (float)2.51511e-07,
-    (float)4.92274e-08,
-    (float)1.04405e-07,
-    (float)7.97808e-07,
-    (float)1.09228e-06,
-    (float)2.13714e-06,
-    (float)2.25659e-06,
-    (float)2.85233e-06,
-    (float)2.50854e-06,
-    (float)2.1728e-06,
-    (float)1.91267e-06,
-    (float)7.23644e-07,
-    (float)1.28973e-06,
-    (float)1.12663e-07,
-    (float)9.90544e-07,
-    (float)1.21798e-06,
-    (float)6.9747e-07,
-    (float)3.08065e-06,
-    (float)2.27229e-07,
-    (float)3.88671e-06,
-    (float)1.53249e-08,
-    (float)2.87067e-06,
-    (float)6.70487e-07,
-    (float)1.04634e-06,
-    (float)2.03246e-06,
-    (float)4.67578e-08,
-    (float)2.94045e-06,
-    (float)3.36833e-07,
-    (float)2.38498e-06,
-    (float)1.00102e-06,
-    (float)8.62141e-07,
-    (float)1.1459e-06,
-    (float)8.80574e-09,
-    (float)7.54984e-07,
-    (float)4.69782e-07,
-    (float)3.38993e-07,
-    (float)9.65219e-07,
-    (float)0.232322,
-    (float)0.200397,
-    (float)0.00215354,
-    (float)0.126343,
-    (float)0.0410733,
-    (float)0.0540111,
-    (float)0.0689547,
-    (float)0.0161564,
-    (float)0.063982,
-    (float)0.0137783,
-    (float)0.0386814,
-    (float)0.0252412,
-    (float)0.0151509,
-    (float)0.0301034,
-    (float)0.00490443,
-    (float)0.0234565,
-    (float)0.00489126,
-    (float)0.0122956,
-    (float)0.00671568,
-    (float)0.00415066,
-    (float)0.00586103,
-    (float)0.000880275,
-    (float)0.003139,
-    (float)0.000320421,
-    (float)0.000913692,
-    (float)0.000287468,
-    (float)7.41903e-05,
-    (float)0.000183714,
-    (float)3.13253e-05,
-    (float)0.00020322,
-    (float)6.69105e-05,
-    (float)0.000356077,
-    (float)2.03259e-05,
-    (float)0.00040855,
-    (float)3.61947e-05,
-    (float)0.000261928,
-    (float)0.000154528,
-    (float)6.63875e-05,
-    (float)0.000257566,
-    (float)2.5541e-06,
-    (float)0.000251777,
-    (float)8.11246e-05,
-    (float)0.00016743,
-    (float)0.000176645,
-    (float)8.67475e-05,
-    (float)0.000189642,
-    (float)4.41363e-05,
-    (float)0.00012784,
-    (float)2.21702e-05,
-    (float)5.4501e-05,
-    (float)6.22307e-06,
-    (float)1.10862e-05,
-    (float)2.33631e-06,
-    (float)8.20021e-07,
-    (float)1.04525e-05,
-    (float)1.12147e-05,
-    (float)1.46981e-05,
-    (float)2.60816e-05,
-    (float)7.46712e-06,
-    (float)2.87956e-05,
-    (float)1.94154e-06,
-    (float)1.52692e-05,
-    (float)1.09282e-05,
-    (float)1.43328e-06,
-    (float)2.69253e-05,
-    (float)5.747e-06,
-    (float)3.28302e-05,
-    (float)2.60885e-05,
-    (float)2.38621e-05,
-    (float)4.24731e-05,
-    (float)1.00723e-05,
-    (float)4.06635e-05,
-    (float)1.84165e-06,
-    (float)2.54213e-05,
-    (float)4.82249e-07,
-    (float)1.09615e-05,
-    (float)1.68232e-06,
-    (float)5.22653e-06,
-    (float)2.13334e-06,
-    (float)5.78223e-06,
-    (float)1.38204e-06,
-    (float)6.60599e-06,
-    (float)4.11536e-07,
-    (float)4.86657e-06,
-    (float)4.40399e-07,
-    (float)1.84519e-06,
-    (float)2.14285e-06,
-    (float)8.39975e-08,
-    (float)4.8623e-06,
-    (float)7.30502e-07,
-    (float)6.8112e-06,
-    (float)2.8786e-06,
-    (float)6.5807e-06,
-    (float)4.6297e-06,
-    (float)4.42656e-06,
-    (float)4.69025e-06,
-    (float)1.92861e-06,
-    (float)3.25877e-06,
-    (float)4.7923e-07,
-    (float)1.62616e-06,
-    (float)2.06548e-07,
-    (float)9.1211e-07,
-    (float)3.02079e-07,
-    (float)1.05731e-06,
-    (float)1.67551e-07,
-    (float)1.09465e-06,
-    (float)8.59917e-09,
-    (float)4.96226e-07,
-    (float)3.54252e-07,
-    (float)1.56838e-08,
-    (float)1.34048e-06,
-    (float)7.99201e-07,
-    (float)2.6007e-06,
-    (float)2.75056e-06,
-    (float)3.54261e-06,
-    (float)4.34061e-06,
-    (float)3.56e-06,
-    (float)4.24689e-06,
-    (float)2.41262e-06,
-    (float)2.74325e-06,
-    (float)7.8427e-07,
-    (float)1.16589e-06,
-    (float)4.16329e-08,
-    (float)4.00144e-07,
-    (float)7.97221e-07,
-    (float)3.13887e-07,
-    (float)1.95939e-06,
-    (float)3.69085e-07,
-    (float)0.191833,
-    (float)0.189799,
-    (float)0.00158924,
-    (float)0.129622,
-    (float)0.0359265,
-    (float)0.0642114,
-    (float)0.0669223,
-    (float)0.020409,
-    (float)0.0722077,
-    (float)0.00634965,
-    (float)0.0548575,
-    (float)0.0118451,
-    (float)0.0302786,
-    (float)0.0205546,
-    (float)0.0123785,
-    (float)0.0222209,
-    (float)0.00557397,
-    (float)0.0164756,
-    (float)0.00595589,
-    (float)0.00855531,
-    (float)0.00748167,
-    (float)0.00305723,
-    (float)0.00691619,
-    (float)0.000998219,
-    (float)0.00455671,
-    (float)0.000849406,
-    (float)0.00211824,
-    (float)0.000921037,
-    (float)0.000679083,
-    (float)0.000627552,
-    (float)0.000195113,
-    (float)0.000223909,
-    (float)0.000134236,
-    (float)2.83953e-05,
-    (float)0.00013267,
-    (float)4.48634e-05,
-    (float)0.000135058,
-    (float)9.27312e-05,
-    (float)0.000189648,
-    (float)6.51488e-05,
-    (float)0.0002711,
-    (float)8.90163e-06,
-    (float)0.000291464,
-    (float)1.78404e-05,
-    (float)0.000209528,
-    (float)0.00010913,
-    (float)8.21988e-05,
-    (float)0.000211682,
-    (float)5.55962e-06,
-    (float)0.00024897,
-    (float)2.17136e-05,
-    (float)0.000209279,
-    (float)9.06533e-05,
-    (float)0.000136988,
-    (float)0.000142,
-    (float)7.69132e-05,
-    (float)0.000139399,
-    (float)4.09526e-05,
-    (float)9.63622e-05,
-    (float)1.94556e-05,
-    (float)4.69386e-05,
-    (float)5.46864e-06,
-    (float)1.40056e-05,
-    (float)1.62221e-07,
-    (float)1.64726e-06,
-    (float)2.87339e-06,
-    (float)3.95174e-06,
-    (float)6.76619e-06,
-    (float)1.24066e-05,
-    (float)6.36147e-06,
-    (float)1.79768e-05,
-    (float)4.02703e-06,
-    (float)1.46823e-05,
-    (float)5.40285e-06,
-    (float)5.18074e-06,
-    (float)1.07418e-05,
-    (float)2.69702e-08,
-    (float)1.44262e-05,
-    (float)7.84294e-06,
-    (float)1.25031e-05,
-    (float)2.60818e-05,
-    (float)7.52452e-06,
-    (float)4.27397e-05,
-    (float)5.00302e-06,
-    (float)4.70427e-05,
-    (float)6.9624e-06,
-    (float)3.79021e-05,
-    (float)1.03759e-05,
-    (float)2.28492e-05,
-    (float)1.12057e-05,
-    (float)1.04585e-05,
-    (float)8.58975e-06,
-    (float)4.31758e-06,
-    (float)4.87515e-06,
-    (float)2.85047e-06,
-    (float)2.56029e-06,
-    (float)2.85017e-06,
-    (float)2.05226e-06,
-    (float)2.37397e-06,
-    (float)2.13919e-06,
-    (float)1.25604e-06,
-    (float)1.76134e-06,
-    (float)3.49849e-07,
-    (float)9.37133e-07,
-    (float)7.71925e-07,
-    (float)4.08055e-07,
-    (float)3.21441e-06,
-    (float)9.192e-07,
-    (float)7.18739e-06,
-    (float)2.79216e-06,
-    (float)1.08231e-05,
-    (float)5.68827e-06,
-    (float)1.19369e-05,
-    (float)8.46839e-06,
-    (float)9.77442e-06,
-    (float)9.55936e-06,
-    (float)5.74455e-06,
-    (float)8.0643e-06,
-    (float)2.19591e-06,
-    (float)4.78871e-06,
-    (float)4.37203e-07,
-    (float)1.85094e-06,
-    (float)7.43955e-08,
-    (float)8.53562e-07,
-    (float)8.68127e-08,
-    (float)1.44494e-06,
-    (float)3.35082e-08,
-    (float)1.95269e-06,
-    (float)0.143256,
-    (float)0.167596,
-    (float)0.001735,
-    (float)0.121348,
-    (float)0.0320535,
-    (float)0.067005,
-    (float)0.0639765,
-    (float)0.0246561,
-    (float)0.0776043,
-    (float)0.00449888,
-    (float)0.0699162,
-    (float)0.00411517,
-    (float)0.0489755,
-    (float)0.0131825,
-    (float)0.0265218,
-    (float)0.021094,
-    (float)0.0110047,
-    (float)0.0223912,
-    (float)0.0045416,
-    (float)0.0176337,
-    (float)0.00423807,
-    (float)0.0106833,
-    (float)0.00571196,
-    (float)0.00516675,
-    (float)0.00606295,
-    (float)0.00247414,
-    (float)0.00477116,
-    (float)0.00191206,
-    (float)0.00280491,
-    (float)0.00205528,
-    (float)0.00124085,
-    (float)0.00193978,
-    (float)0.000484427,
-    (float)0.00140414,
-    (float)0.000314684,
-    (float)0.00075346,
-    (float)0.0003268,
-    (float)0.000291411,
-    (float)0.000280287,
-    (float)9.53857e-05,
-    (float)0.000162141,
-    (float)6.57588e-05,
-    (float)5.96231e-05,
-    (float)8.04572e-05,
-    (float)2.39405e-05,
-    (float)9.15578e-05,
-    (float)3.16405e-05,
-    (float)0.000114231,
-    (float)3.37179e-05,
-    (float)0.000161893,
-    (float)1.5775e-05,
-    (float)0.000208258,
-    (float)7.14172e-06,
-    (float)0.000208784,
-    (float)4.07396e-05,
-    (float)0.000148345,
-    (float)0.000112703,
-    (float)6.1394e-05,
-    (float)0.000181852,
-    (float)5.72836e-06,
-    (float)0.0002044,
-    (float)1.71053e-05,
-    (float)0.00016844,
-    (float)8.4506e-05,
-    (float)9.98371e-05,
-    (float)0.000162382,
-    (float)3.94663e-05,
-    (float)0.000205105,
-    (float)1.35476e-05,
-    (float)0.000195274,
-    (float)1.99981e-05,
-    (float)0.0001473,
-    (float)3.76205e-05,
-    (float)8.95626e-05,
-    (float)4.61503e-05,
-    (float)4.36717e-05,
-    (float)3.93611e-05,
-    (float)1.62518e-05,
-    (float)2.37668e-05,
-    (float)3.69612e-06,
-    (float)9.18648e-06,
-    (float)2.02815e-07,
-    (float)1.28797e-06,
-    (float)1.56774e-06,
-    (float)3.01343e-07,
-    (float)4.78116e-06,
-    (float)3.52406e-06,
-    (float)7.18203e-06,
-    (float)7.802e-06,
-    (float)7.19595e-06,
-    (float)1.04875e-05,
-    (float)5.47556e-06,
-    (float)9.83248e-06,
-    (float)4.29208e-06,
-    (float)5.97181e-06,
-    (float)5.0669e-06,
-    (float)1.80527e-06,
-    (float)6.57557e-06,
-    (float)1.8445e-06,
-    (float)6.19158e-06,
-    (float)8.77033e-06,
-    (float)3.17057e-06,
-    (float)2.04767e-05,
-    (float)3.10645e-07,
-    (float)3.08001e-05,
-    (float)1.79681e-06,
-    (float)3.38376e-05,
-    (float)9.14958e-06,
-    (float)2.82071e-05,
-    (float)1.93026e-05,
-    (float)1.76399e-05,
-    (float)2.67335e-05,
-    (float)7.73183e-06,
-    (float)2.7665e-05,
-    (float)1.95556e-06,
-    (float)2.25905e-05,
-    (float)1.82009e-07,
-    (float)1.52284e-05,
-    (float)2.37249e-07,
-    (float)9.33244e-06,
-    (float)3.50174e-07,
-    (float)6.36226e-06,
-    (float)1.65428e-07,
-    (float)5.58739e-06,
-    (float)3.51359e-08,
-    (float)5.65881e-06,
-    (float)6.34212e-08,
-    (float)5.75427e-06,
-    (float)0.0879922,
-    (float)0.133808,
-    (float)0.00234711,
-    (float)0.100595,
-    (float)0.0282134,
-    (float)0.0594295,
-    (float)0.0575783,
-    (float)0.0242324,
-    (float)0.0752405,
-    (float)0.00425837,
-    (float)0.0757799,
-    (float)0.00110126,
-    (float)0.0617102,
-    (float)0.00968023,
-    (float)0.0404897,
-    (float)0.021879,
-    (float)0.0203494,
-    (float)0.0305777,
-    (float)0.00686463,
-    (float)0.0322418,
-    (float)0.00150115,
-    (float)0.0273375,
-    (float)0.00224237,
-    (float)0.0189487,
-    (float)0.00550332,
-    (float)0.0106546,
-    (float)0.00815558,
-    (float)0.00482454,
-    (float)0.00870564,
-    (float)0.00200997,
-    (float)0.00731967,
-    (float)0.00138939,
-    (float)0.0050584,
-    (float)0.00169035,
-    (float)0.00298523,
-    (float)0.0019526,
-    (float)0.00164621,
-    (float)0.0018128,
-    (float)0.00103313,
-    (float)0.00137063,
-    (float)0.000840278,
-    (float)0.000889434,
-    (float)0.000754198,
-    (float)0.00055818,
-    (float)0.000613902,
-    (float)0.000409014,
-    (float)0.000416919,
-    (float)0.000363686,
-    (float)0.000235575,
-    (float)0.000326913,
-    (float)0.00012803,
-    (float)0.000252602,
-    (float)9.81105e-05,
-    (float)0.000152771,
-    (float)0.000108984,
-    (float)6.50569e-05,
-    (float)0.000120277,
-    (float)1.58465e-05,
-    (float)0.000113829,
-    (float)5.87941e-06,
-    (float)9.40661e-05,
-    (float)1.9672e-05,
-    (float)7.25532e-05,
-    (float)4.24965e-05,
-    (float)5.45304e-05,
-    (float)6.90554e-05,
-    (float)3.74262e-05,
-    (float)9.97122e-05,
-    (float)1.88963e-05,
-    (float)0.000131089,
-    (float)4.77575e-06,
-    (float)0.000151282,
-    (float)8.37009e-06,
-    (float)0.000145523,
-    (float)3.99982e-05,
-    (float)0.000108849,
-    (float)9.4833e-05,
-    (float)5.4848e-05,
-    (float)0.000150455,
-    (float)1.09889e-05,
-    (float)0.000178607,
-    (float)1.94262e-06,
-    (float)0.000163415,
-    (float)3.30352e-05,
-    (float)0.000112262,
-    (float)8.63517e-05,
-    (float)5.13009e-05,
-    (float)0.000131959,
-    (float)9.39055e-06,
-    (float)0.000145851,
-    (float)1.68052e-06,
-    (float)0.000122836,
-    (float)2.28346e-05,
-    (float)7.72351e-05,
-    (float)5.28618e-05,
-    (float)3.2253e-05,
-    (float)7.0783e-05,
-    (float)5.5964e-06,
-    (float)6.69667e-05,
-    (float)6.8723e-07,
-    (float)4.6483e-05,
-    (float)8.33065e-06,
-    (float)2.26134e-05,
-    (float)1.59086e-05,
-    (float)6.65745e-06,
-    (float)1.62971e-05,
-    (float)1.72565e-06,
-    (float)1.05276e-05,
-    (float)3.619e-06,
-    (float)4.18453e-06,
-    (float)6.09067e-06,
-    (float)1.92428e-06,
-    (float)5.61731e-06,
-    (float)4.38907e-06,
-    (float)2.7466e-06,
-    (float)8.78881e-06,
-    (float)2.88472e-07,
-    (float)1.16393e-05,
-    (float)5.38827e-07,
-    (float)1.1223e-05,
-    (float)3.68542e-06,
-    (float)8.19865e-06,
-    (float)8.15146e-06,
-    (float)4.47853e-06,
-    (float)1.203e-05,
-    (float)1.73335e-06,
-    (float)1.41569e-05,
-    (float)7.59054e-07,
-    (float)0.0347648,
-    (float)0.0874825,
-    (float)0.00355572,
-    (float)0.0667054,
-    (float)0.0228897,
-    (float)0.0402491,
-    (float)0.0447804,
-    (float)0.0167009,
-    (float)0.0598779,
-    (float)0.00266368,
-    (float)0.0634746,
-    (float)0.000612953,
-    (float)0.0555303,
-    (float)0.00863712,
-    (float)0.0398516,
-    (float)0.0217942,
-    (float)0.0221777,
-    (float)0.0342552,
-    (float)0.00798459,
-    (float)0.0413602,
-    (float)0.000745584,
-    (float)0.0409695,
-    (float)0.00109508,
-    (float)0.0338067,
-    (float)0.00703229,
-    (float)0.0227994,
-    (float)0.0150003,
-    (float)0.0117261,
-    (float)0.0213877,
-    (float)0.00373013,
-    (float)0.0238425,
-    (float)0.000293914,
-    (float)0.0218969,
-    (float)0.00103022,
-    (float)0.0167482,
-    (float)0.00423579,
-    (float)0.0104469,
-    (float)0.00782246,
-    (float)0.0049524,
-    (float)0.0101585,
-    (float)0.00146886,
-    (float)0.0105138,
-    (float)0.000236692,
-    (float)0.00905562,
-    (float)0.000722972,
-    (float)0.00653348,
-    (float)0.00202055,
-    (float)0.00385783,
-    (float)0.00325633,
-    (float)0.001747,
-    (float)0.00387057,
-    (float)0.000539167,
-    (float)0.00371123,
-    (float)0.000186977,
-    (float)0.00296139,
-    (float)0.00038828,
-    (float)0.00196897,
-    (float)0.000770862,
-    (float)0.00106641,
-    (float)0.00104813,
-    (float)0.000451224,
-    (float)0.00109392,
-    (float)0.000156766,
-    (float)0.000930544,
-    (float)9.75692e-05,
-    (float)0.000661999,
-    (float)0.000146827,
-    (float)0.000398057,
-    (float)0.000202613,
-    (float)0.000204799,
-    (float)0.000218023,
-    (float)9.41597e-05,
-    (float)0.000194413,
-    (float)4.33426e-05,
-    (float)0.000154386,
-    (float)2.34178e-05,
-    (float)0.000116216,
-    (float)1.78827e-05,
-    (float)8.40089e-05,
-    (float)2.36398e-05,
-    (float)5.38599e-05,
-    (float)4.05911e-05,
-    (float)2.51217e-05,
-    (float)6.25419e-05,
-    (float)5.03039e-06,
-    (float)7.76211e-05,
-    (float)3.44995e-06,
-    (float)7.63292e-05,
-    (float)2.38119e-05,
-    (float)5.90007e-05,
-    (float)5.85919e-05,
-    (float)3.62936e-05,
-    (float)9.27051e-05,
-    (float)2.2721e-05,
-    (float)0.000111864,
-    (float)2.80659e-05,
-    (float)0.000110176,
-    (float)5.2061e-05,
-    (float)9.25424e-05,
-    (float)8.51396e-05,
-    (float)7.08604e-05,
-    (float)0.000114371,
-    (float)5.67193e-05,
-    (float)0.000130571,
-    (float)5.54432e-05,
-    (float)0.000131932,
-    (float)6.51668e-05,
-    (float)0.000122385,
-    (float)8.04942e-05,
-    (float)0.000107224,
-    (float)9.67256e-05,
-    (float)9.0274e-05,
-    (float)0.000111116,
-    (float)7.43072e-05,
-    (float)0.000121413,
-    (float)6.26714e-05,
-    (float)0.0001247,
-    (float)5.91653e-05,
-    (float)0.000118536,
-    (float)6.58098e-05,
-    (float)0.000103274,
-    (float)8.07968e-05,
-    (float)8.30282e-05,
-    (float)9.87224e-05,
-    (float)6.42541e-05,
-    (float)0.000112944,
-    (float)5.30751e-05,
-    (float)0.000118316,
-    (float)0.000880581,
-    (float)0.0377925,
-    (float)0.00735906,
-    (float)0.028186,
-    (float)0.0177917,
-    (float)0.0161283,
-    (float)0.0282157,
-    (float)0.00579694,
-    (float)0.0348605,
-    (float)0.000421299,
-    (float)0.035556,
-    (float)0.00120539,
-    (float)0.0303545,
-    (float)0.00715561,
-    (float)0.0212511,
-    (float)0.0157047,
-    (float)0.0112932,
-    (float)0.0237313,
-    (float)0.00352053,
-    (float)0.0285618,
-    (float)8.02408e-05,
-    (float)0.0287002,
-    (float)0.00168234,
-    (float)0.0241863,
-    (float)0.00745399,
-    (float)0.0165432,
-    (float)0.0152199,
-    (float)0.00829699,
-    (float)0.0221893,
-    (float)0.00214513,
-    (float)0.0258951,
-    (float)9.45644e-06,
-    (float)0.0250688,
-    (float)0.00233773,
-    (float)0.0200876,
-    (float)0.00796558,
-    (float)0.0127819,
-    (float)0.0146123,
-    (float)0.00568509,
-    (float)0.019787,
-    (float)0.00106258,
-    (float)0.021705,
-    (float)0.000129858,
-    (float)0.0198523,
-    (float)0.00273708,
-    (float)0.0150319,
-    (float)0.00756801,
-    (float)0.00895401,
-    (float)0.0127042,
-    (float)0.00357946,
-    (float)0.016313,
-    (float)0.000461672,
-    (float)0.0172287,
-    (float)0.000289079,
-    (float)0.015263,
-    (float)0.00274342,
-    (float)0.011179,
-    (float)0.00668889,
-    (float)0.00636414,
-    (float)0.010608,
-    (float)0.00232734,
-    (float)0.0131264,
-    (float)0.000198005,
-    (float)0.0134476,
-    (float)0.000391378,
-    (float)0.0115605,
-    (float)0.00253751,
-    (float)0.00817204,
-    (float)0.00567176,
-    (float)0.00441417,
-    (float)0.00859862,
-    (float)0.0014417,
-    (float)0.0102961,
-    (float)5.81632e-05,
-    (float)0.0102309,
-    (float)0.000483285,
-    (float)0.00849379,
-    (float)0.0023242,
-    (float)0.00572378,
-    (float)0.00474958,
-    (float)0.00285418,
-    (float)0.00680256,
-    (float)0.00077094,
-    (float)0.00774121,
-    (float)6.18981e-06,
-    (float)0.00728295,
-    (float)0.000579173,
-    (float)0.00566407,
-    (float)0.00203901,
-    (float)0.00350124,
-    (float)0.00368,
-    (float)0.00152369,
-    (float)0.00482993,
-    (float)0.000294242,
-    (float)0.00508973,
-    (float)3.00343e-05,
-    (float)0.00443736,
-    (float)0.000578337,
-    (float)0.00317582,
-    (float)0.0015328,
-    (float)0.00177017,
-    (float)0.00242305,
-    (float)0.000653244,
-    (float)0.00289444,
-    (float)7.76019e-05,
-    (float)0.00281296,
-    (float)6.09505e-05,
-    (float)0.00226907,
-    (float)0.000428846,
-    (float)0.00149743,
-    (float)0.000920269,
-    (float)0.000759719,
-    (float)0.00130209,
-    (float)0.000244686,
-    (float)0.00144474,
-    (float)2.16099e-05,
-    (float)0.00133799,
-    (float)5.21005e-05,
-    (float)0.0010571,
-    (float)0.00023815,
-    (float)0.000708794,
-    (float)0.000474635,
-    (float)0.000386522,
-    (float)0.000682908,
-    (float)0.000150007,
-    (float)0.000819235,
-    (float)2.7284e-05,
-    (float)0.000866019,
-    (float)0.000880581,
-    (float)0.0377925,
-    (float)0.00735906,
-    (float)0.028186,
-    (float)0.0177917,
-    (float)0.0161283,
-    (float)0.0282157,
-    (float)0.00579694,
-    (float)0.0348605,
-    (float)0.000421299,
-    (float)0.035556,
-    (float)0.00120539,
-    (float)0.0303545,
-    (float)0.00715561,
-    (float)0.0212511,
-    (float)0.0157047,
-    (float)0.0112932,
-    (float)0.0237313,
-    (float)0.00352053,
-    (float)0.0285618,
-    (float)8.02408e-05,
-    (float)0.0287002,
-    (float)0.00168234,
-    (float)0.0241863,
-    (float)0.00745399,
-    (float)0.0165432,
-    (float)0.0152199,
-    (float)0.00829699,
-    (float)0.0221893,
-    (float)0.00214513,
-    (float)0.0258951,
-    (float)9.45644e-06,
-    (float)0.0250688,
-    (float)0.00233773,
-    (float)0.0200876,
-    (float)0.00796558,
-    (float)0.0127819,
-    (float)0.0146123,
-    (float)0.00568509,
-    (float)0.019787,
-    (float)0.00106258,
-    (float)0.021705,
-    (float)0.000129858,
-    (float)0.0198523,
-    (float)0.00273708,
-    (float)0.0150319,
-    (float)0.00756801,
-    (float)0.00895401,
-    (float)0.0127042,
-    (float)0.00357946,
-    (float)0.016313,
-    (float)0.000461672,
-    (float)0.0172287,
-    (float)0.000289079,
-    (float)0.015263,
-    (float)0.00274342,
-    (float)0.011179,
-    (float)0.00668889,
-    (float)0.00636414,
-    (float)0.010608,
-    (float)0.00232734,
-    (float)0.0131264,
-    (float)0.000198005,
-    (float)0.0134476,
-    (float)0.000391378,
-    (float)0.0115605,
-    (float)0.00253751,
-    (float)0.00817204,
-    (float)0.00567176,
-    (float)0.00441417,
-    (float)0.00859862,
-    (float)0.0014417,
-    (float)0.0102961,
-    (float)5.81632e-05,
-    (float)0.0102309,
-    (float)0.000483285,
-    (float)0.00849379,
-    (float)0.0023242,
-    (float)0.00572378,
-    (float)0.00474958,
-    (float)0.00285418,
-    (float)0.00680256,
-    (float)0.00077094,
-    (float)0.00774121,
-    (float)6.18981e-06,
-    (float)0.00728295,
-    (float)0.000579173,
-    (float)0.00566407,
-    (float)0.00203901,
-    (float)0.00350124,
-    (float)0.00368,
-    (float)0.00152369,
-    (float)0.00482993,
-    (float)0.000294242,
-    (float)0.00508973,
-    (float)3.00343e-05,
-    (float)0.00443736,
-    (float)0.000578337,
-    (float)0.00317582,
-    (float)0.0015328,
-    (float)0.00177017,
-    (float)0.00242305,
-    (float)0.000653244,
-    (float)0.00289444,
-    (float)7.76019e-05,
-    (float)0.00281296,
-    (float)6.09505e-05,
-    (float)0.00226907,
-    (float)0.000428846,
-    (float)0.00149743,
-    (float)0.000920269,
-    (float)0.000759719,
-    (float)0.00130209,
-    (float)0.000244686,
-    (float)0.00144474,
-    (float)2.16099e-05,
-    (float)0.00133799,
-    (float)5.21005e-05,
-    (float)0.0010571,
-    (float)0.00023815,
-    (float)0.000708794,
-    (float)0.000474635,
-    (float)0.000386522,
-    (float)0.000682908,
-    (float)0.000150007,
-    (float)0.000819235,
-    (float)2.7284e-05,
-    (float)0.000866019,
-    (float)0.0031495,
-    (float)0.0846185,
-    (float)0.0111573,
-    (float)0.0643053,
-    (float)0.0323231,
-    (float)0.0385356,
-    (float)0.0539056,
-    (float)0.0157966,
-    (float)0.0681083,
-    (float)0.00259312,
-    (float)0.0705699,
-    (float)0.00132671,
-    (float)0.0613839,
-    (float)0.0100487,
-    (float)0.0444147,
-    (float)0.0238108,
-    (float)0.0254317,
-    (float)0.0367841,
-    (float)0.00994955,
-    (float)0.0442862,
-    (float)0.00151262,
-    (float)0.0441204,
-    (float)0.000853299,
-    (float)0.0369388,
-    (float)0.00606277,
-    (float)0.0256202,
-    (float)0.0136334,
-    (float)0.0139452,
-    (float)0.0199461,
-    (float)0.00510864,
-    (float)0.0225969,
-    (float)0.000676242,
-    (float)0.0210387,
-    (float)0.000362309,
-    (float)0.016369,
-    (float)0.00258396,
-    (float)0.0105137,
-    (float)0.00539138,
-    (float)0.0052936,
-    (float)0.00728633,
-    (float)0.00179608,
-    (float)0.00762129,
-    (float)0.000217456,
-    (float)0.00654986,
-    (float)8.7217e-05,
-    (float)0.00469737,
-    (float)0.000659287,
-    (float)0.00277168,
-    (float)0.00126875,
-    (float)0.00127701,
-    (float)0.00153705,
-    (float)0.000399633,
-    (float)0.00140144,
-    (float)5.21133e-05,
-    (float)0.00101323,
-    (float)1.01374e-05,
-    (float)0.000585083,
-    (float)5.83022e-05,
-    (float)0.000267046,
-    (float)7.84126e-05,
-    (float)9.88095e-05,
-    (float)5.69069e-05,
-    (float)3.68938e-05,
-    (float)3.4259e-05,
-    (float)1.75054e-05,
-    (float)4.39521e-05,
-    (float)6.94827e-06,
-    (float)8.11695e-05,
-    (float)1.23106e-05,
-    (float)0.000112228,
-    (float)5.70349e-05,
-    (float)0.000107192,
-    (float)0.000147287,
-    (float)6.70366e-05,
-    (float)0.000255673,
-    (float)2.55608e-05,
-    (float)0.000333123,
-    (float)2.57718e-05,
-    (float)0.000339519,
-    (float)8.80436e-05,
-    (float)0.000270978,
-    (float)0.00019294,
-    (float)0.000163912,
-    (float)0.000291468,
-    (float)7.23423e-05,
-    (float)0.000335816,
-    (float)3.44335e-05,
-    (float)0.000308578,
-    (float)5.18506e-05,
-    (float)0.000230161,
-    (float)9.49995e-05,
-    (float)0.00014139,
-    (float)0.000127263,
-    (float)7.64225e-05,
-    (float)0.000128747,
-    (float)4.56733e-05,
-    (float)0.000103806,
-    (float)3.77501e-05,
-    (float)7.1092e-05,
-    (float)3.44453e-05,
-    (float)4.71077e-05,
-    (float)2.54094e-05,
-    (float)3.60436e-05,
-    (float)1.26524e-05,
-    (float)3.12615e-05,
-    (float)4.41305e-06,
-    (float)2.44369e-05,
-    (float)5.5979e-06,
-    (float)1.36763e-05,
-    (float)1.30632e-05,
-    (float)4.35838e-06,
-    (float)1.87742e-05,
-    (float)3.24927e-06,
-    (float)1.70353e-05,
-    (float)1.18454e-05,
-    (float)9.16873e-06,
-    (float)2.46742e-05,
-    (float)2.0749e-06,
-    (float)3.33501e-05,
-    (float)2.62279e-06,
-    (float)3.24573e-05,
-    (float)1.27043e-05,
-    (float)2.27243e-05,
-    (float)2.82484e-05,
-    (float)9.93875e-06,
-    (float)4.19606e-05,
-    (float)1.21972e-06,
-    (float)4.73736e-05,
-    (float)0.0117834,
-    (float)0.139241,
-    (float)0.0169575,
-    (float)0.10568,
-    (float)0.0470491,
-    (float)0.0639488,
-    (float)0.075796,
-    (float)0.0279009,
-    (float)0.0915754,
-    (float)0.00666203,
-    (float)0.0898949,
-    (float)0.00179835,
-    (float)0.073618,
-    (float)0.00845768,
-    (float)0.0501763,
-    (float)0.0189881,
-    (float)0.0275719,
-    (float)0.0267442,
-    (float)0.011221,
-    (float)0.0284056,
-    (float)0.00270536,
-    (float)0.0242773,
-    (float)0.000405506,
-    (float)0.0170064,
-    (float)0.00124238,
-    (float)0.00968028,
-    (float)0.00248473,
-    (float)0.00432515,
-    (float)0.00277528,
-    (float)0.00140846,
-    (float)0.0021099,
-    (float)0.000286343,
-    (float)0.00113672,
-    (float)2.64085e-05,
-    (float)0.000420971,
-    (float)1.97212e-06,
-    (float)0.000118245,
-    (float)1.46143e-05,
-    (float)7.26214e-05,
-    (float)9.55078e-05,
-    (float)7.66436e-05,
-    (float)0.000273886,
-    (float)4.16987e-05,
-    (float)0.000486311,
-    (float)3.26022e-06,
-    (float)0.000622152,
-    (float)3.11179e-05,
-    (float)0.000609923,
-    (float)0.000146595,
-    (float)0.000463015,
-    (float)0.000301924,
-    (float)0.000261593,
-    (float)0.000417319,
-    (float)9.5869e-05,
-    (float)0.000436579,
-    (float)1.40239e-05,
-    (float)0.000359756,
-    (float)6.63778e-06,
-    (float)0.000234386,
-    (float)3.02525e-05,
-    (float)0.00011818,
-    (float)4.56517e-05,
-    (float)4.42068e-05,
-    (float)4.07745e-05,
-    (float)1.19236e-05,
-    (float)2.64324e-05,
-    (float)2.77864e-06,
-    (float)1.69776e-05,
-    (float)8.17681e-07,
-    (float)1.63319e-05,
-    (float)1.12907e-06,
-    (float)1.87146e-05,
-    (float)4.87669e-06,
-    (float)1.78001e-05,
-    (float)1.13991e-05,
-    (float)1.29361e-05,
-    (float)1.64477e-05,
-    (float)7.62615e-06,
-    (float)1.64916e-05,
-    (float)4.36943e-06,
-    (float)1.25936e-05,
-    (float)2.53444e-06,
-    (float)8.93672e-06,
-    (float)1.16835e-06,
-    (float)7.82933e-06,
-    (float)2.31381e-06,
-    (float)7.35644e-06,
-    (float)9.67632e-06,
-    (float)4.74978e-06,
-    (float)2.34192e-05,
-    (float)1.40325e-06,
-    (float)3.74018e-05,
-    (float)3.01031e-06,
-    (float)4.30883e-05,
-    (float)1.3934e-05,
-    (float)3.67478e-05,
-    (float)3.1845e-05,
-    (float)2.26654e-05,
-    (float)4.84747e-05,
-    (float)9.40679e-06,
-    (float)5.56784e-05,
-    (float)3.19649e-06,
-    (float)5.09506e-05,
-    (float)4.376e-06,
-    (float)3.80326e-05,
-    (float)8.91103e-06,
-    (float)2.33035e-05,
-    (float)1.23478e-05,
-    (float)1.1657e-05,
-    (float)1.26395e-05,
-    (float)4.70339e-06,
-    (float)1.03631e-05,
-    (float)1.51934e-06,
-    (float)7.22336e-06,
-    (float)4.02925e-07,
-    (float)4.55601e-06,
-    (float)9.58541e-08,
-    (float)2.80739e-06,
-    (float)2.16045e-08,
-    (float)1.82353e-06,
-    (float)3.71008e-09,
-    (float)1.2962e-06,
-    (float)3.19506e-09,
-    (float)9.97045e-07,
-    (float)1.29912e-08,
-    (float)8.23814e-07,
-    (float)2.43672e-08,
-    (float)7.63438e-07,
-    (float)0.0290639,
-    (float)0.188117,
-    (float)0.0243044,
-    (float)0.141356,
-    (float)0.0570491,
-    (float)0.0851114,
-    (float)0.0844496,
-    (float)0.0385335,
-    (float)0.0933572,
-    (float)0.0116419,
-    (float)0.0824827,
-    (float)0.00317324,
-    (float)0.0595854,
-    (float)0.0050064,
-    (float)0.03509,
-    (float)0.00864144,
-    (float)0.0164023,
-    (float)0.00943226,
-    (float)0.00574015,
-    (float)0.00710532,
-    (float)0.00135037,
-    (float)0.00372262,
-    (float)0.000183528,
-    (float)0.0012359,
-    (float)1.07174e-05,
-    (float)0.000229098,
-    (float)2.05208e-05,
-    (float)0.000149326,
-    (float)0.000221869,
-    (float)0.000236945,
-    (float)0.000645639,
-    (float)0.000168131,
-    (float)0.00106307,
-    (float)4.01681e-05,
-    (float)0.00120039,
-    (float)1.86577e-05,
-    (float)0.000999835,
-    (float)0.000110479,
-    (float)0.000627162,
-    (float)0.000204458,
-    (float)0.000291363,
-    (float)0.000216072,
-    (float)9.45822e-05,
-    (float)0.000153949,
-    (float)1.92312e-05,
-    (float)7.92833e-05,
-    (float)2.21791e-06,
-    (float)3.69054e-05,
-    (float)5.61219e-07,
-    (float)2.75285e-05,
-    (float)4.07841e-06,
-    (float)2.76719e-05,
-    (float)1.33006e-05,
-    (float)2.13687e-05,
-    (float)2.1554e-05,
-    (float)1.08161e-05,
-    (float)1.94658e-05,
-    (float)3.99582e-06,
-    (float)8.66195e-06,
-    (float)1.63373e-06,
-    (float)2.03917e-06,
-    (float)4.39935e-07,
-    (float)8.05084e-06,
-    (float)4.38905e-06,
-    (float)1.93223e-05,
-    (float)2.41419e-05,
-    (float)2.13827e-05,
-    (float)6.19274e-05,
-    (float)1.1035e-05,
-    (float)0.000101398,
-    (float)9.81465e-07,
-    (float)0.000118185,
-    (float)4.7854e-06,
-    (float)0.000101599,
-    (float)2.07208e-05,
-    (float)6.39429e-05,
-    (float)3.36365e-05,
-    (float)2.80669e-05,
-    (float)3.1698e-05,
-    (float)7.78467e-06,
-    (float)1.80283e-05,
-    (float)1.2805e-06,
-    (float)5.02519e-06,
-    (float)5.027e-07,
-    (float)2.31681e-07,
-    (float)1.85393e-06,
-    (float)9.15987e-07,
-    (float)6.00845e-06,
-    (float)1.26076e-06,
-    (float)1.13824e-05,
-    (float)2.27455e-07,
-    (float)1.31329e-05,
-    (float)2.89052e-07,
-    (float)9.11576e-06,
-    (float)1.67496e-06,
-    (float)3.15965e-06,
-    (float)1.873e-06,
-    (float)4.11139e-07,
-    (float)3.98347e-07,
-    (float)1.32214e-06,
-    (float)6.01089e-07,
-    (float)2.30298e-06,
-    (float)5.28548e-06,
-    (float)1.26321e-06,
-    (float)1.23217e-05,
-    (float)8.91356e-08,
-    (float)1.64046e-05,
-    (float)1.32445e-06,
-    (float)1.46702e-05,
-    (float)4.31318e-06,
-    (float)9.20067e-06,
-    (float)5.98239e-06,
-    (float)4.08123e-06,
-    (float)4.69214e-06,
-    (float)1.3843e-06,
-    (float)1.92851e-06,
-    (float)6.10933e-07,
-    (float)1.77076e-07,
-    (float)9.02713e-07,
-    (float)2.22098e-07,
-    (float)2.39199e-06,
-    (float)9.86791e-07,
-    (float)5.34897e-06,
-    (float)1.28816e-06,
-    (float)8.95236e-06,
-    (float)1.0239e-06,
-    (float)1.14552e-05,
-    (float)8.15242e-07,
-    (float)0.0557049,
-    (float)0.231178,
-    (float)0.0342534,
-    (float)0.169835,
-    (float)0.0633936,
-    (float)0.0993812,
-    (float)0.0817987,
-    (float)0.0446196,
-    (float)0.0781611,
-    (float)0.0147353,
-    (float)0.0576129,
-    (float)0.00419896,
-    (float)0.0328819,
-    (float)0.00236341,
-    (float)0.0141004,
-    (float)0.00189496,
-    (float)0.00420455,
-    (float)0.000866669,
-    (float)0.000741855,
-    (float)0.000155741,
-    (float)6.50786e-05,
-    (float)0.000412348,
-    (float)1.45926e-05,
-    (float)0.00112961,
-    (float)6.3953e-05,
-    (float)0.00147139,
-    (float)0.00024698,
-    (float)0.00118867,
-    (float)0.000450746,
-    (float)0.000636523,
-    (float)0.000481268,
-    (float)0.000220372,
-    (float)0.000329083,
-    (float)4.58734e-05,
-    (float)0.000149072,
-    (float)7.44623e-06,
-    (float)5.67182e-05,
-    (float)3.54475e-06,
-    (float)4.10109e-05,
-    (float)5.39597e-06,
-    (float)4.06894e-05,
-    (float)9.87072e-06,
-    (float)2.84222e-05,
-    (float)8.65508e-06,
-    (float)1.31982e-05,
-    (float)1.40932e-06,
-    (float)4.58356e-06,
-    (float)3.38446e-06,
-    (float)7.66429e-07,
-    (float)2.60944e-05,
-    (float)1.89764e-06,
-    (float)5.83737e-05,
-    (float)1.60681e-05,
-    (float)7.49519e-05,
-    (float)4.56724e-05,
-    (float)6.30971e-05,
-    (float)7.52097e-05,
-    (float)3.49443e-05,
-    (float)8.22716e-05,
-    (float)1.17536e-05,
-    (float)6.12832e-05,
-    (float)2.07253e-06,
-    (float)2.94881e-05,
-    (float)2.91214e-07,
-    (float)7.50026e-06,
-    (float)7.81772e-07,
-    (float)3.78667e-07,
-    (float)3.9217e-06,
-    (float)4.74291e-07,
-    (float)9.22247e-06,
-    (float)1.24595e-06,
-    (float)1.17746e-05,
-    (float)1.79276e-06,
-    (float)8.66324e-06,
-    (float)2.10569e-06,
-    (float)3.62966e-06,
-    (float)1.31367e-06,
-    (float)2.05218e-06,
-    (float)6.75479e-07,
-    (float)4.14491e-06,
-    (float)3.32044e-06,
-    (float)5.90563e-06,
-    (float)9.31856e-06,
-    (float)5.04477e-06,
-    (float)1.39188e-05,
-    (float)2.96714e-06,
-    (float)1.27931e-05,
-    (float)1.46666e-06,
-    (float)7.25982e-06,
-    (float)6.43406e-07,
-    (float)2.2032e-06,
-    (float)6.58681e-07,
-    (float)2.78235e-07,
-    (float)2.6228e-06,
-    (float)4.95374e-07,
-    (float)6.32769e-06,
-    (float)1.27961e-06,
-    (float)9.19338e-06,
-    (float)2.16988e-06,
-    (float)8.95705e-06,
-    (float)2.81659e-06,
-    (float)6.18841e-06,
-    (float)2.58727e-06,
-    (float)3.22736e-06,
-    (float)1.57072e-06,
-    (float)1.61395e-06,
-    (float)7.3587e-07,
-    (float)1.26127e-06,
-    (float)7.26723e-07,
-    (float)1.37939e-06,
-    (float)1.1249e-06,
-    (float)1.37638e-06,
-    (float)1.1392e-06,
-    (float)1.03589e-06,
-    (float)6.17763e-07,
-    (float)4.58219e-07,
-    (float)9.2485e-08,
-    (float)5.52398e-08,
-    (float)6.10203e-08,
-    (float)3.23041e-07,
-    (float)5.55731e-07,
-    (float)1.38259e-06,
-    (float)1.31396e-06,
-    (float)2.80886e-06,
-    (float)2.04305e-06,
-    (float)3.96317e-06,
-    (float)2.49166e-06,
-    (float)4.39569e-06,
-    (float)0.093897,
-    (float)0.262914,
-    (float)0.047629,
-    (float)0.186898,
-    (float)0.0662336,
-    (float)0.104006,
-    (float)0.0703108,
-    (float)0.0441676,
-    (float)0.0542419,
-    (float)0.0140016,
-    (float)0.0299781,
-    (float)0.00345404,
-    (float)0.0110529,
-    (float)0.000711261,
-    (float)0.00220749,
-    (float)2.54504e-05,
-    (float)0.000264956,
-    (float)0.00028303,
-    (float)0.000459193,
-    (float)0.00113343,
-    (float)0.000468912,
-    (float)0.00171049,
-    (float)0.000208064,
-    (float)0.00149164,
-    (float)5.47634e-05,
-    (float)0.000812661,
-    (float)2.82676e-05,
-    (float)0.000274573,
-    (float)1.30281e-05,
-    (float)7.75736e-05,
-    (float)4.16585e-06,
-    (float)5.52467e-05,
-    (float)2.07897e-05,
-    (float)4.51436e-05,
-    (float)2.75122e-05,
-    (float)2.29787e-05,
-    (float)8.34853e-06,
-    (float)7.61036e-06,
-    (float)2.56425e-06,
-    (float)1.94695e-06,
-    (float)3.45594e-05,
-    (float)1.15911e-05,
-    (float)7.2792e-05,
-    (float)4.3172e-05,
-    (float)7.74057e-05,
-    (float)7.91961e-05,
-    (float)4.98546e-05,
-    (float)8.77274e-05,
-    (float)1.94679e-05,
-    (float)6.0396e-05,
-    (float)3.99701e-06,
-    (float)2.26455e-05,
-    (float)3.09432e-07,
-    (float)2.29162e-06,
-    (float)2.20813e-06,
-    (float)1.05998e-06,
-    (float)8.4921e-06,
-    (float)3.6435e-06,
-    (float)1.46787e-05,
-    (float)2.35259e-06,
-    (float)1.34049e-05,
-    (float)5.26619e-07,
-    (float)6.84628e-06,
-    (float)1.46185e-07,
-    (float)5.53672e-06,
-    (float)1.81142e-08,
-    (float)1.15839e-05,
-    (float)1.4011e-06,
-    (float)1.54373e-05,
-    (float)4.69213e-06,
-    (float)1.14164e-05,
-    (float)5.5939e-06,
-    (float)4.55965e-06,
-    (float)2.41556e-06,
-    (float)6.95361e-07,
-    (float)8.68131e-07,
-    (float)1.20879e-07,
-    (float)5.1282e-06,
-    (float)1.85633e-06,
-    (float)1.04199e-05,
-    (float)5.46708e-06,
-    (float)1.01854e-05,
-    (float)8.03149e-06,
-    (float)5.34967e-06,
-    (float)6.23114e-06,
-    (float)1.34605e-06,
-    (float)2.00118e-06,
-    (float)2.20457e-07,
-    (float)4.31605e-07,
-    (float)4.6846e-07,
-    (float)2.07832e-06,
-    (float)1.11819e-06,
-    (float)2.90775e-06,
-    (float)1.64463e-06,
-    (float)1.42341e-06,
-    (float)1.02171e-06,
-    (float)9.48283e-08,
-    (float)7.66476e-08,
-    (float)2.30748e-07,
-    (float)1.37121e-06,
-    (float)6.56198e-07,
-    (float)4.71642e-06,
-    (float)7.84824e-07,
-    (float)6.55042e-06,
-    (float)9.60982e-07,
-    (float)5.02578e-06,
-    (float)8.31725e-07,
-    (float)2.2071e-06,
-    (float)2.29944e-07,
-    (float)5.43067e-07,
-    (float)3.14742e-07,
-    (float)1.79738e-07,
-    (float)1.80291e-06,
-    (float)2.56668e-07,
-    (float)3.37243e-06,
-    (float)4.45051e-07,
-    (float)3.36665e-06,
-    (float)5.72424e-07,
-    (float)2.03813e-06,
-    (float)3.62627e-07,
-    (float)8.71999e-07,
-    (float)1.19734e-07,
-    (float)5.23459e-07,
-    (float)5.71163e-07,
-    (float)5.37207e-07,
-    (float)1.63508e-06,
-    (float)5.15625e-07,
-    (float)2.21764e-06,
-    (float)0.143191,
-    (float)0.282461,
-    (float)0.0644226,
-    (float)0.191722,
-    (float)0.0664771,
-    (float)0.0986183,
-    (float)0.054337,
-    (float)0.0372976,
-    (float)0.0305064,
-    (float)0.00987422,
-    (float)0.0102319,
-    (float)0.00158224,
-    (float)0.0013826,
-    (float)3.06495e-05,
-    (float)0.000547043,
-    (float)0.000295168,
-    (float)0.00138235,
-    (float)0.000921069,
-    (float)0.00119405,
-    (float)0.00109214,
-    (float)0.000495801,
-    (float)0.000677914,
-    (float)9.57964e-05,
-    (float)0.000208361,
-    (float)1.92903e-05,
-    (float)4.66777e-05,
-    (float)2.93755e-05,
-    (float)6.07032e-05,
-    (float)3.01241e-05,
-    (float)4.65869e-05,
-    (float)1.45451e-05,
-    (float)9.51079e-06,
-    (float)4.5757e-06,
-    (float)8.7885e-06,
-    (float)3.8389e-05,
-    (float)2.40425e-05,
-    (float)0.000104718,
-    (float)2.22041e-05,
-    (float)0.000137018,
-    (float)1.08849e-05,
-    (float)0.000103463,
-    (float)3.69273e-06,
-    (float)4.41639e-05,
-    (float)4.37849e-07,
-    (float)7.85274e-06,
-    (float)2.10318e-06,
-    (float)2.72922e-08,
-    (float)1.00094e-05,
-    (float)1.54192e-06,
-    (float)1.56968e-05,
-    (float)1.81199e-06,
-    (float)1.18523e-05,
-    (float)1.00169e-06,
-    (float)5.7885e-06,
-    (float)1.46202e-07,
-    (float)7.61898e-06,
-    (float)3.28499e-07,
-    (float)1.32523e-05,
-    (float)2.14943e-06,
-    (float)1.24376e-05,
-    (float)2.69428e-06,
-    (float)5.64259e-06,
-    (float)7.89071e-07,
-    (float)6.79505e-07,
-    (float)1.85503e-06,
-    (float)3.78806e-07,
-    (float)8.27644e-06,
-    (float)2.54173e-06,
-    (float)1.25465e-05,
-    (float)4.5386e-06,
-    (float)9.04294e-06,
-    (float)4.02425e-06,
-    (float)2.83688e-06,
-    (float)1.34303e-06,
-    (float)3.15775e-07,
-    (float)2.01503e-08,
-    (float)8.82814e-07,
-    (float)1.0333e-06,
-    (float)1.31962e-06,
-    (float)1.42236e-06,
-    (float)7.35782e-07,
-    (float)3.02865e-07,
-    (float)3.71285e-08,
-    (float)2.85758e-07,
-    (float)5.13635e-07,
-    (float)2.17313e-06,
-    (float)2.42219e-06,
-    (float)3.42378e-06,
-    (float)3.83877e-06,
-    (float)2.46246e-06,
-    (float)2.84205e-06,
-    (float)7.37453e-07,
-    (float)6.94902e-07,
-    (float)8.31455e-08,
-    (float)8.83084e-08,
-    (float)6.21147e-07,
-    (float)9.51141e-07,
-    (float)1.31879e-06,
-    (float)1.20784e-06,
-    (float)1.2014e-06,
-    (float)5.32452e-07,
-    (float)3.88592e-07,
-    (float)2.32119e-07,
-    (float)2.14768e-08,
-    (float)6.65249e-07,
-    (float)5.13085e-07,
-    (float)1.04812e-06,
-    (float)8.88566e-07,
-    (float)8.44943e-07,
-    (float)5.12284e-07,
-    (float)2.91236e-07,
-    (float)4.28095e-08,
-    (float)4.73969e-08,
-    (float)2.01787e-07,
-    (float)4.68239e-07,
-    (float)7.40233e-07,
-    (float)1.12235e-06,
-    (float)9.50243e-07,
-    (float)1.28542e-06,
-    (float)6.281e-07,
-    (float)8.13127e-07,
-    (float)2.47606e-07,
-    (float)2.37506e-07,
-    (float)2.87349e-07,
-    (float)5.14816e-08,
-    (float)6.49879e-07,
-    (float)1.52885e-07,
-    (float)8.56612e-07,
-    (float)0.202313,
-    (float)0.288281,
-    (float)0.083666,
-    (float)0.184499,
-    (float)0.0644222,
-    (float)0.0850763,
-    (float)0.0378651,
-    (float)0.0265799,
-    (float)0.0131948,
-    (float)0.004782,
-    (float)0.00157851,
-    (float)0.000202348,
-    (float)0.000694099,
-    (float)0.000164252,
-    (float)0.00204951,
-    (float)0.000554042,
-    (float)0.00169678,
-    (float)0.000535233,
-    (float)0.000621983,
-    (float)0.000217253,
-    (float)0.000110699,
-    (float)2.01807e-05,
-    (float)6.90318e-05,
-    (float)2.65141e-05,
-    (float)7.31407e-05,
-    (float)2.98397e-05,
-    (float)3.26994e-05,
-    (float)1.13625e-06,
-    (float)3.20543e-06,
-    (float)4.21269e-05,
-    (float)1.1295e-05,
-    (float)0.000112456,
-    (float)4.18927e-05,
-    (float)0.00011208,
-    (float)5.15556e-05,
-    (float)5.55369e-05,
-    (float)2.62699e-05,
-    (float)1.27124e-05,
-    (float)3.02807e-06,
-    (float)2.23113e-06,
-    (float)4.88671e-06,
-    (float)5.19161e-06,
-    (float)1.1585e-05,
-    (float)7.50304e-06,
-    (float)7.56473e-06,
-    (float)5.19094e-06,
-    (float)3.88485e-06,
-    (float)1.92623e-06,
-    (float)7.34538e-06,
-    (float)3.06912e-06,
-    (float)9.22924e-06,
-    (float)4.91872e-06,
-    (float)5.252e-06,
-    (float)2.2991e-06,
-    (float)8.71522e-07,
-    (float)1.44985e-06,
-    (float)4.23393e-07,
-    (float)7.55298e-06,
-    (float)3.58433e-06,
-    (float)1.17917e-05,
-    (float)6.46044e-06,
-    (float)7.39111e-06,
-    (float)4.72137e-06,
-    (float)1.45433e-06,
-    (float)8.02744e-07,
-    (float)2.65492e-07,
-    (float)2.68655e-07,
-    (float)1.02824e-06,
-    (float)1.29338e-06,
-    (float)8.24702e-07,
-    (float)3.6847e-07,
-    (float)1.366e-07,
-    (float)6.32739e-07,
-    (float)2.07026e-07,
-    (float)3.449e-06,
-    (float)1.61258e-06,
-    (float)4.34602e-06,
-    (float)2.46285e-06,
-    (float)2.1666e-06,
-    (float)1.16522e-06,
-    (float)2.86661e-07,
-    (float)2.86163e-07,
-    (float)6.59993e-08,
-    (float)1.60818e-06,
-    (float)5.15692e-07,
-    (float)2.34529e-06,
-    (float)7.19495e-07,
-    (float)1.07822e-06,
-    (float)2.99734e-07,
-    (float)2.38598e-07,
-    (float)9.81566e-09,
-    (float)7.16324e-07,
-    (float)4.7024e-07,
-    (float)8.76173e-07,
-    (float)5.78934e-07,
-    (float)3.48974e-07,
-    (float)3.97135e-08,
-    (float)1.22348e-08,
-    (float)4.72241e-07,
-    (float)1.32255e-07,
-    (float)1.73214e-06,
-    (float)4.75043e-07,
-    (float)1.77535e-06,
-    (float)5.46662e-07,
-    (float)6.52833e-07,
-    (float)1.67359e-07,
-    (float)3.97692e-08,
-    (float)8.35319e-08,
-    (float)1.36581e-07,
-    (float)5.27164e-07,
-    (float)2.06934e-07,
-    (float)5.92369e-07,
-    (float)1.13413e-07,
-    (float)1.94654e-07,
-    (float)1.42329e-08,
-    (float)2.22917e-07,
-    (float)6.38462e-08,
-    (float)5.75061e-07,
-    (float)2.5547e-07,
-    (float)4.83587e-07,
-    (float)2.18089e-07,
-    (float)1.07902e-07,
-    (float)4.16884e-09,
-    (float)2.0086e-08,
-    (float)2.84778e-07,
-    (float)1.64706e-07,
-    (float)9.23807e-07,
-    (float)2.42003e-07,
-    (float)0.268643,
-    (float)0.281803,
-    (float)0.10376,
-    (float)0.167566,
-    (float)0.0604181,
-    (float)0.0667108,
-    (float)0.0236045,
-    (float)0.0155225,
-    (float)0.00367936,
-    (float)0.00125747,
-    (float)0.000343481,
-    (float)0.000113653,
-    (float)0.00215333,
-    (float)0.000479444,
-    (float)0.00200313,
-    (float)0.000316855,
-    (float)0.000683977,
-    (float)5.74859e-05,
-    (float)9.99038e-05,
-    (float)3.95655e-06,
-    (float)9.43068e-05,
-    (float)3.34876e-05,
-    (float)7.46525e-05,
-    (float)7.34442e-06,
-    (float)1.39168e-05,
-    (float)2.21928e-05,
-    (float)5.6705e-06,
-    (float)0.000113088,
-    (float)1.78365e-05,
-    (float)0.000143631,
-    (float)1.3624e-05,
-    (float)7.68353e-05,
-    (float)1.69725e-06,
-    (float)1.38775e-05,
-    (float)2.98582e-06,
-    (float)3.30368e-07,
-    (float)1.49756e-05,
-    (float)2.40939e-06,
-    (float)1.67446e-05,
-    (float)5.69016e-07,
-    (float)8.41884e-06,
-    (float)4.561e-07,
-    (float)7.05385e-06,
-    (float)2.55206e-06,
-    (float)1.02475e-05,
-    (float)2.43071e-06,
-    (float)6.29662e-06,
-    (float)4.77085e-07,
-    (float)9.20213e-07,
-    (float)1.98114e-06,
-    (float)2.1575e-06,
-    (float)8.16297e-06,
-    (float)4.26503e-06,
-    (float)1.06578e-05,
-    (float)2.28702e-06,
-    (float)5.21313e-06,
-    (float)1.113e-07,
-    (float)3.07411e-07,
-    (float)5.17139e-07,
-    (float)6.06997e-07,
-    (float)1.2609e-06,
-    (float)7.29208e-07,
-    (float)4.82442e-07,
-    (float)2.8855e-08,
-    (float)1.51515e-07,
-    (float)1.83145e-06,
-    (float)1.94378e-06,
-    (float)3.30211e-06,
-    (float)2.69487e-06,
-    (float)1.7998e-06,
-    (float)8.27079e-07,
-    (float)1.40393e-07,
-    (float)3.0318e-07,
-    (float)2.36344e-07,
-    (float)1.6764e-06,
-    (float)7.28952e-07,
-    (float)1.4005e-06,
-    (float)4.58158e-07,
-    (float)1.61842e-07,
-    (float)1.82133e-07,
-    (float)3.21501e-07,
-    (float)5.44969e-07,
-    (float)7.85514e-07,
-    (float)5.20373e-07,
-    (float)3.92518e-07,
-    (float)1.85276e-08,
-    (float)3.42344e-08,
-    (float)5.17927e-07,
-    (float)2.01179e-07,
-    (float)1.57953e-06,
-    (float)2.92197e-07,
-    (float)1.39614e-06,
-    (float)8.7918e-08,
-    (float)3.80879e-07,
-    (float)1.47728e-07,
-    (float)5.81755e-09,
-    (float)5.86053e-07,
-    (float)1.04505e-07,
-    (float)6.21315e-07,
-    (float)6.35642e-08,
-    (float)1.50148e-07,
-    (float)1.08581e-07,
-    (float)9.65893e-08,
-    (float)2.89278e-07,
-    (float)4.642e-07,
-    (float)2.35098e-07,
-    (float)4.021e-07,
-    (float)3.78241e-08,
-    (float)5.61258e-08,
-    (float)1.71193e-07,
-    (float)4.08232e-08,
-    (float)5.51673e-07,
-    (float)1.39833e-07,
-    (float)5.69207e-07,
-    (float)4.59568e-08,
-    (float)1.93462e-07,
-    (float)2.99111e-08,
-    (float)1.23103e-08,
-    (float)1.84112e-07,
-    (float)1.14267e-07,
-    (float)1.80876e-07,
-    (float)9.6879e-08,
-    (float)2.12556e-08,
-    (float)1.5463e-09,
-    (float)6.63637e-08,
-    (float)1.21986e-07,
-    (float)2.84427e-07,
-    (float)2.53257e-07,
-    (float)0.33901,
-    (float)0.265144,
-    (float)0.122752,
-    (float)0.144307,
-    (float)0.0545528,
-    (float)0.0474265,
-    (float)0.0128539,
-    (float)0.00697666,
-    (float)0.000327824,
-    (float)0.000117294,
-    (float)0.00155936,
-    (float)0.000624105,
-    (float)0.00224503,
-    (float)0.000398503,
-    (float)0.000850147,
-    (float)2.77725e-05,
-    (float)9.38119e-05,
-    (float)3.28753e-05,
-    (float)8.25378e-05,
-    (float)6.23325e-05,
-    (float)5.09083e-05,
-    (float)9.18143e-06,
-    (float)1.14156e-05,
-    (float)3.52349e-05,
-    (float)4.69432e-05,
-    (float)0.000103091,
-    (float)5.0559e-05,
-    (float)7.99548e-05,
-    (float)1.63401e-05,
-    (float)1.68248e-05,
-    (float)4.1699e-06,
-    (float)6.66691e-07,
-    (float)1.27443e-05,
-    (float)6.2599e-06,
-    (float)1.29117e-05,
-    (float)3.90533e-06,
-    (float)4.60394e-06,
-    (float)5.97219e-06,
-    (float)2.16887e-06,
-    (float)1.02858e-05,
-    (float)2.53852e-06,
-    (float)5.88215e-06,
-    (float)2.84166e-07,
-    (float)3.81893e-07,
-    (float)3.76242e-06,
-    (float)1.63506e-06,
-    (float)1.06599e-05,
-    (float)3.99364e-06,
-    (float)8.35846e-06,
-    (float)2.21627e-06,
-    (float)1.60477e-06,
-    (float)1.23047e-07,
-    (float)2.63143e-07,
-    (float)7.51748e-07,
-    (float)7.60529e-07,
-    (float)6.54815e-07,
-    (float)5.10742e-08,
-    (float)2.33011e-07,
-    (float)9.26494e-07,
-    (float)2.49447e-06,
-    (float)2.18836e-06,
-    (float)3.1737e-06,
-    (float)1.16692e-06,
-    (float)7.74359e-07,
-    (float)3.2742e-09,
-    (float)4.8986e-07,
-    (float)9.03961e-07,
-    (float)1.30701e-06,
-    (float)1.36398e-06,
-    (float)3.8887e-07,
-    (float)2.63294e-07,
-    (float)1.95433e-07,
-    (float)1.73633e-07,
-    (float)8.86026e-07,
-    (float)4.88013e-07,
-    (float)5.50732e-07,
-    (float)1.72401e-08,
-    (float)4.73615e-08,
-    (float)6.24308e-07,
-    (float)2.8276e-07,
-    (float)1.45715e-06,
-    (float)4.18206e-07,
-    (float)7.57483e-07,
-    (float)1.21391e-07,
-    (float)3.67332e-08,
-    (float)2.24536e-07,
-    (float)9.16087e-08,
-    (float)5.3561e-07,
-    (float)8.8691e-08,
-    (float)2.49992e-07,
-    (float)3.04156e-08,
-    (float)3.90824e-08,
-    (float)1.54975e-07,
-    (float)3.20542e-07,
-    (float)1.95088e-07,
-    (float)2.84467e-07,
-    (float)3.9024e-08,
-    (float)7.17153e-08,
-    (float)6.28014e-08,
-    (float)2.25338e-07,
-    (float)3.5141e-07,
-    (float)2.59309e-07,
-    (float)3.2869e-07,
-    (float)4.24443e-08,
-    (float)4.42142e-08,
-    (float)2.56196e-08,
-    (float)6.07353e-08,
-    (float)9.50397e-08,
-    (float)9.52334e-08,
-    (float)3.60515e-08,
-    (float)4.28167e-09,
-    (float)1.54022e-08,
-    (float)1.77728e-07,
-    (float)9.65686e-08,
-    (float)2.76069e-07,
-    (float)8.96897e-08,
-    (float)9.18924e-08,
-    (float)1.79068e-08,
-    (float)5.81786e-08,
-    (float)1.19925e-07,
-    (float)9.54812e-08,
-    (float)2.01036e-07,
-    (float)1.94553e-08,
-    (float)5.87159e-08,
-    (float)2.3488e-08,
-    (float)2.27609e-08,
-    (float)9.9802e-08,
-    (float)9.30877e-08,
-    (float)0.410514,
-    (float)0.24135,
-    (float)0.138868,
-    (float)0.118167,
-    (float)0.0470792,
-    (float)0.0302477,
-    (float)0.00571643,
-    (float)0.00207257,
-    (float)0.000299513,
-    (float)0.000510492,
-    (float)0.00224251,
-    (float)0.000774339,
-    (float)0.00123278,
-    (float)9.64593e-05,
-    (float)0.000133146,
-    (float)5.21323e-05,
-    (float)4.89897e-05,
-    (float)0.000113512,
-    (float)3.21867e-05,
-    (float)1.82542e-05,
-    (float)2.11838e-05,
-    (float)2.36754e-05,
-    (float)8.76628e-05,
-    (float)6.3123e-05,
-    (float)7.13919e-05,
-    (float)2.73134e-05,
-    (float)1.63441e-05,
-    (float)9.39332e-07,
-    (float)7.05839e-06,
-    (float)1.00343e-05,
-    (float)9.54186e-06,
-    (float)1.00117e-05,
-    (float)2.16449e-06,
-    (float)7.34735e-06,
-    (float)4.35707e-07,
-    (float)1.06776e-05,
-    (float)1.7783e-06,
-    (float)6.0032e-06,
-    (float)5.08663e-07,
-    (float)1.08164e-07,
-    (float)4.66528e-06,
-    (float)2.80782e-06,
-    (float)1.01313e-05,
-    (float)3.76949e-06,
-    (float)5.91976e-06,
-    (float)5.15066e-07,
-    (float)3.66614e-07,
-    (float)5.27375e-07,
-    (float)4.5717e-07,
-    (float)1.16555e-06,
-    (float)2.08059e-07,
-    (float)5.00735e-08,
-    (float)7.22743e-07,
-    (float)9.77464e-07,
-    (float)2.95572e-06,
-    (float)1.77506e-06,
-    (float)1.95559e-06,
-    (float)2.51089e-07,
-    (float)1.04418e-07,
-    (float)6.30454e-07,
-    (float)5.31532e-07,
-    (float)1.80833e-06,
-    (float)3.96292e-07,
-    (float)5.91615e-07,
-    (float)9.34952e-08,
-    (float)7.37937e-08,
-    (float)9.18042e-07,
-    (float)4.3243e-07,
-    (float)6.32352e-07,
-    (float)2.99186e-08,
-    (float)1.11756e-08,
-    (float)6.58874e-07,
-    (float)6.31945e-07,
-    (float)1.1343e-06,
-    (float)6.10364e-07,
-    (float)2.69223e-07,
-    (float)1.47319e-07,
-    (float)6.04703e-08,
-    (float)4.3974e-07,
-    (float)3.1736e-07,
-    (float)2.97713e-07,
-    (float)1.27832e-07,
-    (float)8.90868e-09,
-    (float)1.16099e-07,
-    (float)2.83476e-07,
-    (float)1.55741e-07,
-    (float)2.32611e-07,
-    (float)4.44134e-09,
-    (float)1.16273e-08,
-    (float)2.09452e-07,
-    (float)1.38551e-07,
-    (float)4.85563e-07,
-    (float)1.61065e-07,
-    (float)2.66503e-07,
-    (float)3.60437e-08,
-    (float)2.59726e-08,
-    (float)5.72553e-08,
-    (float)4.62817e-08,
-    (float)4.84868e-08,
-    (float)1.8374e-08,
-    (float)3.10584e-09,
-    (float)3.3583e-08,
-    (float)1.08533e-07,
-    (float)1.30716e-07,
-    (float)1.37387e-07,
-    (float)6.21016e-08,
-    (float)1.58882e-08,
-    (float)9.33604e-09,
-    (float)4.39958e-08,
-    (float)7.465e-08,
-    (float)1.49256e-07,
-    (float)4.32464e-08,
-    (float)1.4566e-07,
-    (float)3.68141e-08,
-    (float)1.39722e-07,
-    (float)9.89085e-08,
-    (float)7.9345e-08,
-    (float)5.35498e-08,
-    (float)7.56679e-09,
-    (float)8.41777e-09,
-    (float)1.16462e-07,
-    (float)3.08634e-08,
-    (float)1.84799e-07,
-    (float)3.92137e-08,
-    (float)8.62808e-08,
-    (float)1.08528e-07,
-    (float)2.27278e-08,
-    (float)1.79193e-07,
-    (float)0.480398,
-    (float)0.213511,
-    (float)0.150625,
-    (float)0.0923004,
-    (float)0.0384385,
-    (float)0.017025,
-    (float)0.00173149,
-    (float)0.000328351,
-    (float)0.00128239,
-    (float)0.00109506,
-    (float)0.00183079,
-    (float)0.000433912,
-    (float)0.000338106,
-    (float)2.76193e-05,
-    (float)1.55762e-05,
-    (float)0.000172807,
-    (float)2.49001e-05,
-    (float)4.48549e-05,
-    (float)1.84977e-05,
-    (float)1.03414e-05,
-    (float)0.000100484,
-    (float)4.25289e-05,
-    (float)7.49284e-05,
-    (float)8.11751e-06,
-    (float)1.17605e-05,
-    (float)5.26498e-06,
-    (float)4.82123e-06,
-    (float)1.72404e-05,
-    (float)2.76469e-06,
-    (float)9.46244e-06,
-    (float)7.56621e-07,
-    (float)6.61125e-06,
-    (float)5.84378e-06,
-    (float)4.87073e-06,
-    (float)3.25959e-06,
-    (float)3.1405e-07,
-    (float)2.00797e-06,
-    (float)3.70376e-06,
-    (float)6.55418e-06,
-    (float)6.29396e-06,
-    (float)4.15947e-06,
-    (float)1.75511e-06,
-    (float)8.30757e-08,
-    (float)5.35669e-07,
-    (float)8.49582e-07,
-    (float)7.62348e-07,
-    (float)3.33321e-07,
-    (float)1.16194e-07,
-    (float)1.07716e-06,
-    (float)2.26048e-06,
-    (float)2.28795e-06,
-    (float)1.77736e-06,
-    (float)5.07702e-07,
-    (float)4.75654e-09,
-    (float)5.3176e-07,
-    (float)8.55191e-07,
-    (float)1.05519e-06,
-    (float)5.52898e-07,
-    (float)5.48414e-08,
-    (float)1.86014e-07,
-    (float)5.68513e-07,
-    (float)6.54835e-07,
-    (float)6.68376e-07,
-    (float)6.00473e-08,
-    (float)7.94813e-08,
-    (float)5.23085e-07,
-    (float)6.73345e-07,
-    (float)1.08926e-06,
-    (float)3.53347e-07,
-    (float)2.41438e-07,
-    (float)7.17213e-08,
-    (float)1.79828e-07,
-    (float)5.87017e-07,
-    (float)1.9497e-07,
-    (float)1.99533e-07,
-    (float)3.0658e-08,
-    (float)6.10813e-08,
-    (float)4.49967e-07,
-    (float)1.56719e-07,
-    (float)2.38461e-07,
-    (float)1.81433e-08,
-    (float)2.34957e-08,
-    (float)3.36179e-07,
-    (float)2.19109e-07,
-    (float)3.19607e-07,
-    (float)7.03168e-08,
-    (float)1.63804e-08,
-    (float)3.54265e-08,
-    (float)5.65444e-08,
-    (float)8.49115e-08,
-    (float)4.68533e-08,
-    (float)4.4956e-09,
-    (float)2.43968e-08,
-    (float)8.90545e-08,
-    (float)1.13305e-07,
-    (float)1.25244e-07,
-    (float)6.61297e-08,
-    (float)1.61803e-08,
-    (float)8.68953e-09,
-    (float)2.38482e-08,
-    (float)4.29002e-08,
-    (float)6.31991e-08,
-    (float)1.36377e-08,
-    (float)2.8254e-08,
-    (float)2.84254e-08,
-    (float)4.65015e-08,
-    (float)1.09943e-07,
-    (float)4.19718e-08,
-    (float)6.02954e-08,
-    (float)1.7068e-09,
-    (float)1.0083e-08,
-    (float)7.02257e-08,
-    (float)2.67501e-08,
-    (float)8.99265e-08,
-    (float)2.0331e-08,
-    (float)3.79358e-08,
-    (float)8.23683e-08,
-    (float)2.85822e-08,
-    (float)1.02954e-07,
-    (float)1.36069e-08,
-    (float)3.32309e-08,
-    (float)7.62465e-08,
-    (float)1.31227e-08,
-    (float)1.17571e-07,
-    (float)3.8343e-08,
-    (float)4.75944e-08,
-    (float)9.37715e-08,
-    (float)9.76618e-09,
-    (float)0.546783,
-    (float)0.184215,
-    (float)0.157261,
-    (float)0.0688465,
-    (float)0.0293504,
-    (float)0.00817945,
-    (float)0.000149451,
-    (float)0.000397856,
-    (float)0.00197468,
-    (float)0.00112571,
-    (float)0.000960091,
-    (float)8.89556e-05,
-    (float)1.70175e-05,
-    (float)0.000174123,
-    (float)2.75004e-05,
-    (float)0.000113317,
-    (float)4.07503e-06,
-    (float)2.91909e-06,
-    (float)8.75301e-05,
-    (float)4.66924e-05,
-    (float)7.44233e-05,
-    (float)7.61994e-06,
-    (float)8.89378e-06,
-    (float)1.00411e-05,
-    (float)2.2106e-06,
-    (float)1.9978e-05,
-    (float)4.46146e-07,
-    (float)6.02203e-06,
-    (float)5.23438e-06,
-    (float)2.6605e-06,
-    (float)8.60766e-06,
-    (float)4.24882e-07,
-    (float)1.72114e-06,
-    (float)2.09062e-06,
-    (float)3.15138e-06,
-    (float)7.41832e-06,
-    (float)4.69776e-06,
-    (float)4.59805e-06,
-    (float)4.30808e-07,
-    (float)3.58745e-07,
-    (float)9.53217e-07,
-    (float)4.0836e-07,
-    (float)7.22463e-07,
-    (float)2.00292e-07,
-    (float)7.03857e-07,
-    (float)2.31447e-06,
-    (float)1.84103e-06,
-    (float)1.8558e-06,
-    (float)1.04156e-07,
-    (float)7.02703e-09,
-    (float)9.93104e-07,
-    (float)8.26381e-07,
-    (float)1.21549e-06,
-    (float)7.90248e-08,
-    (float)3.45073e-08,
-    (float)7.1705e-07,
-    (float)2.73995e-07,
-    (float)8.02359e-07,
-    (float)2.25905e-08,
-    (float)9.3833e-09,
-    (float)6.96363e-07,
-    (float)6.48942e-07,
-    (float)9.63378e-07,
-    (float)2.32726e-07,
-    (float)4.42406e-08,
-    (float)3.78258e-07,
-    (float)3.62753e-07,
-    (float)5.93153e-07,
-    (float)1.67189e-07,
-    (float)2.15225e-08,
-    (float)1.73078e-07,
-    (float)2.08964e-07,
-    (float)3.37542e-07,
-    (float)1.01642e-07,
-    (float)6.95731e-09,
-    (float)2.13765e-07,
-    (float)4.96119e-07,
-    (float)3.66409e-07,
-    (float)3.15625e-07,
-    (float)1.88301e-08,
-    (float)1.88325e-08,
-    (float)1.19423e-07,
-    (float)5.60638e-08,
-    (float)5.74277e-08,
-    (float)8.01355e-09,
-    (float)5.03387e-08,
-    (float)1.43376e-07,
-    (float)1.79239e-07,
-    (float)6.25453e-08,
-    (float)3.01782e-08,
-    (float)1.7185e-08,
-    (float)3.70301e-08,
-    (float)1.14722e-07,
-    (float)5.35111e-08,
-    (float)7.37119e-08,
-    (float)1.22138e-08,
-    (float)1.8364e-08,
-    (float)5.99841e-08,
-    (float)1.17582e-08,
-    (float)3.91391e-08,
-    (float)1.42846e-08,
-    (float)8.74922e-09,
-    (float)1.06017e-07,
-    (float)4.39554e-08,
-    (float)1.18758e-07,
-    (float)2.16561e-08,
-    (float)1.60093e-08,
-    (float)5.77046e-08,
-    (float)4.25385e-08,
-    (float)1.08112e-07,
-    (float)3.8802e-08,
-    (float)2.79112e-08,
-    (float)3.90874e-08,
-    (float)1.95059e-09,
-    (float)4.60219e-08,
-    (float)1.21022e-08,
-    (float)3.10118e-09,
-    (float)9.64335e-08,
-    (float)1.20178e-07,
-    (float)1.58179e-07,
-    (float)1.36368e-07,
-    (float)4.94712e-08,
-    (float)4.88334e-08,
-    (float)2.06844e-08,
-    (float)2.37745e-08,
-    (float)5.06171e-08,
-    (float)2.24477e-08,
-    (float)4.72046e-08,
-    (float)0.608574,
-    (float)0.155437,
-    (float)0.158548,
-    (float)0.0490123,
-    (float)0.0206029,
-    (float)0.00314436,
-    (float)0.000145859,
-    (float)0.000966486,
-    (float)0.00198285,
-    (float)0.000689896,
-    (float)0.000276858,
-    (float)5.51915e-05,
-    (float)2.33386e-05,
-    (float)0.000218895,
-    (float)5.80677e-06,
-    (float)1.09813e-05,
-    (float)5.15677e-05,
-    (float)5.54021e-05,
-    (float)7.32283e-05,
-    (float)2.0474e-05,
-    (float)9.58548e-06,
-    (float)1.0273e-05,
-    (float)9.8064e-07,
-    (float)2.20319e-05,
-    (float)8.41873e-07,
-    (float)2.86863e-06,
-    (float)8.08174e-06,
-    (float)1.23522e-06,
-    (float)7.65833e-06,
-    (float)1.86496e-07,
-    (float)4.95966e-07,
-    (float)4.61325e-06,
-    (float)3.09749e-06,
-    (float)7.0584e-06,
-    (float)2.32775e-06,
-    (float)1.92645e-06,
-    (float)4.82867e-07,
-    (float)7.07762e-08,
-    (float)1.2845e-06,
-    (float)2.83551e-07,
-    (float)3.31997e-07,
-    (float)9.21313e-07,
-    (float)2.52279e-06,
-    (float)1.7066e-06,
-    (float)9.23938e-07,
-    (float)4.52423e-08,
-    (float)5.09642e-07,
-    (float)8.71409e-07,
-    (float)9.19883e-07,
-    (float)2.69236e-07,
-    (float)1.1279e-07,
-    (float)5.94844e-07,
-    (float)6.8322e-07,
-    (float)6.78791e-07,
-    (float)2.09629e-08,
-    (float)1.29142e-07,
-    (float)6.3852e-07,
-    (float)7.92511e-07,
-    (float)4.98125e-07,
-    (float)6.84656e-09,
-    (float)1.58329e-07,
-    (float)6.41333e-07,
-    (float)3.29408e-07,
-    (float)2.68532e-07,
-    (float)8.26603e-09,
-    (float)1.47041e-07,
-    (float)5.22217e-07,
-    (float)1.40509e-07,
-    (float)1.62115e-07,
-    (float)1.23873e-07,
-    (float)1.81817e-07,
-    (float)5.06321e-07,
-    (float)2.32288e-07,
-    (float)7.76057e-08,
-    (float)5.1295e-08,
-    (float)6.71533e-08,
-    (float)2.22889e-07,
-    (float)5.0636e-08,
-    (float)4.13206e-09,
-    (float)9.98559e-08,
-    (float)2.93089e-07,
-    (float)1.38775e-07,
-    (float)9.78008e-08,
-    (float)5.25972e-09,
-    (float)3.04098e-08,
-    (float)1.491e-07,
-    (float)3.80486e-08,
-    (float)3.94935e-08,
-    (float)2.92987e-08,
-    (float)3.44014e-08,
-    (float)7.88229e-08,
-    (float)4.23118e-08,
-    (float)1.80666e-08,
-    (float)1.60192e-08,
-    (float)1.50644e-08,
-    (float)9.43941e-08,
-    (float)1.24937e-08,
-    (float)2.69566e-08,
-    (float)6.78652e-09,
-    (float)1.17888e-08,
-    (float)6.09146e-08,
-    (float)2.12638e-08,
-    (float)3.44254e-08,
-    (float)2.14527e-08,
-    (float)9.82359e-09,
-    (float)7.32948e-08,
-    (float)3.90514e-08,
-    (float)1.39478e-08,
-    (float)1.14168e-08,
-    (float)2.66199e-08,
-    (float)6.53938e-08,
-    (float)5.76213e-08,
-    (float)5.45904e-09,
-    (float)1.64242e-08,
-    (float)6.24973e-08,
-    (float)4.17697e-08,
-    (float)5.97448e-08,
-    (float)1.72298e-08,
-    (float)3.67382e-08,
-    (float)5.70961e-08,
-    (float)7.23755e-08,
-    (float)4.96399e-08,
-    (float)3.23095e-09,
-    (float)1.55508e-08,
-    (float)5.59619e-08,
-    (float)8.67635e-08,
-    (float)6.28722e-08,
-    (float)2.57974e-08,
-    (float)0.665061,
-    (float)0.128561,
-    (float)0.154778,
-    (float)0.0332527,
-    (float)0.0129683,
-    (float)0.000865381,
-    (float)0.000929171,
-    (float)0.00126588,
-    (float)0.0014545,
-    (float)0.000232374,
-    (float)1.17129e-05,
-    (float)0.000191246,
-    (float)5.75633e-05,
-    (float)9.7515e-05,
-    (float)9.4074e-06,
-    (float)3.74884e-05,
-    (float)6.83467e-05,
-    (float)5.44158e-05,
-    (float)1.52488e-05,
-    (float)5.06563e-06,
-    (float)9.89099e-07,
-    (float)2.51948e-05,
-    (float)1.85849e-06,
-    (float)1.91644e-06,
-    (float)7.8732e-06,
-    (float)2.3882e-06,
-    (float)5.71007e-06,
-    (float)7.98871e-07,
-    (float)4.67903e-08,
-    (float)5.84844e-06,
-    (float)2.45252e-06,
-    (float)6.01166e-06,
-    (float)1.64756e-06,
-    (float)5.77619e-07,
-    (float)9.38806e-07,
-    (float)4.05299e-07,
-    (float)5.22244e-07,
-    (float)3.30231e-07,
-    (float)1.29346e-06,
-    (float)1.06482e-06,
-    (float)2.63225e-06,
-    (float)4.54491e-07,
-    (float)1.9132e-07,
-    (float)3.89849e-07,
-    (float)1.03398e-06,
-    (float)8.82183e-07,
-    (float)5.62645e-09,
-    (float)4.02147e-08,
-    (float)1.20117e-06,
-    (float)4.14378e-07,
-    (float)2.53036e-07,
-    (float)8.7818e-08,
-    (float)5.07599e-07,
-    (float)1.00786e-06,
-    (float)2.70589e-07,
-    (float)4.28393e-08,
-    (float)3.65104e-07,
-    (float)4.92505e-07,
-    (float)4.5616e-07,
-    (float)5.74111e-08,
-    (float)8.36737e-09,
-    (float)4.59113e-07,
-    (float)1.95753e-07,
-    (float)1.29979e-07,
-    (float)1.00992e-07,
-    (float)3.30943e-07,
-    (float)4.3328e-07,
-    (float)4.25515e-07,
-    (float)5.30633e-08,
-    (float)2.89715e-08,
-    (float)1.6628e-07,
-    (float)7.84045e-08,
-    (float)5.63534e-08,
-    (float)7.72496e-08,
-    (float)1.78155e-07,
-    (float)2.61295e-07,
-    (float)1.61685e-07,
-    (float)7.15137e-09,
-    (float)5.53772e-08,
-    (float)1.51693e-07,
-    (float)1.50952e-07,
-    (float)3.71477e-08,
-    (float)1.18613e-08,
-    (float)3.22336e-08,
-    (float)1.17634e-07,
-    (float)7.03101e-09,
-    (float)8.59177e-09,
-    (float)8.55218e-08,
-    (float)9.23015e-08,
-    (float)7.30557e-08,
-    (float)1.69101e-08,
-    (float)5.24517e-09,
-    (float)3.62997e-08,
-    (float)5.29882e-08,
-    (float)3.39097e-08,
-    (float)2.16004e-08,
-    (float)3.32666e-10,
-    (float)4.3318e-08,
-    (float)1.94299e-08,
-    (float)1.47238e-08,
-    (float)2.23302e-08,
-    (float)2.16804e-08,
-    (float)5.97366e-08,
-    (float)5.13447e-08,
-    (float)3.38293e-08,
-    (float)6.33021e-09,
-    (float)3.37918e-09,
-    (float)5.05139e-08,
-    (float)1.39842e-08,
-    (float)3.15652e-09,
-    (float)6.61384e-09,
-    (float)7.08104e-08,
-    (float)2.74375e-08,
-    (float)2.30995e-08,
-    (float)9.66464e-09,
-    (float)5.21179e-08,
-    (float)1.08689e-07,
-    (float)9.72551e-08,
-    (float)2.56158e-08,
-    (float)2.87495e-08,
-    (float)4.38986e-08,
-    (float)3.27294e-08,
-    (float)7.33152e-09,
-    (float)1.36773e-08,
-    (float)1.06191e-07,
-    (float)8.16219e-08,
-    (float)6.50721e-08,
-    (float)1.31921e-08,
-    (float)0.716135,
-    (float)0.104311,
-    (float)0.146615,
-    (float)0.0214006,
-    (float)0.00699377,
-    (float)0.000230328,
-    (float)0.00182393,
-    (float)0.00112105,
-    (float)0.000752535,
-    (float)4.0075e-05,
-    (float)4.4118e-05,
-    (float)0.000232343,
-    (float)3.36311e-05,
-    (float)1.23537e-05,
-    (float)4.13722e-05,
-    (float)8.89486e-05,
-    (float)2.9631e-05,
-    (float)8.78612e-06,
-    (float)9.70503e-07,
-    (float)2.5988e-05,
-    (float)3.97833e-06,
-    (float)4.07282e-06,
-    (float)6.02873e-06,
-    (float)4.41915e-06,
-    (float)4.60823e-06,
-    (float)1.41763e-06,
-    (float)8.27794e-08,
-    (float)6.21638e-06,
-    (float)1.72957e-06,
-    (float)5.09351e-06,
-    (float)1.6768e-06,
-    (float)1.62325e-07,
-    (float)8.04266e-07,
-    (float)6.49452e-07,
-    (float)3.21728e-07,
-    (float)3.9315e-07,
-    (float)1.62133e-06,
-    (float)1.32618e-06,
-    (float)1.5365e-06,
-    (float)1.23158e-07,
-    (float)2.40427e-07,
-    (float)7.93257e-07,
-    (float)6.0915e-07,
-    (float)2.32477e-07,
-    (float)5.15815e-07,
-    (float)2.41414e-07,
-    (float)1.12497e-06,
-    (float)5.12326e-08,
-    (float)1.74381e-07,
-    (float)6.59693e-07,
-    (float)6.29013e-07,
-    (float)3.23556e-07,
-    (float)1.8741e-07,
-    (float)2.44412e-07,
-    (float)7.10661e-07,
-    (float)1.02251e-07,
-    (float)2.88085e-08,
-    (float)4.55895e-07,
-    (float)1.60183e-07,
-    (float)2.304e-07,
-    (float)1.48389e-07,
-    (float)2.85546e-07,
-    (float)5.23301e-07,
-    (float)2.22864e-07,
-    (float)2.74735e-08,
-    (float)1.85642e-07,
-    (float)1.07009e-07,
-    (float)8.60441e-08,
-    (float)5.0157e-08,
-    (float)2.61832e-07,
-    (float)1.82748e-07,
-    (float)2.30781e-07,
-    (float)2.1222e-10,
-    (float)3.67296e-08,
-    (float)2.67117e-07,
-    (float)5.49841e-08,
-    (float)4.6388e-08,
-    (float)8.71935e-08,
-    (float)9.08041e-08,
-    (float)8.72757e-08,
-    (float)5.99936e-09,
-    (float)3.16573e-08,
-    (float)2.04638e-07,
-    (float)2.49523e-08,
-    (float)5.2796e-08,
-    (float)4.14117e-08,
-    (float)3.82148e-08,
-    (float)7.36061e-08,
-    (float)7.50679e-09,
-    (float)8.66932e-09,
-    (float)7.99276e-08,
-    (float)3.12818e-09,
-    (float)9.45679e-08,
-    (float)2.19747e-08,
-    (float)4.97904e-08,
-    (float)5.92465e-08,
-    (float)1.69598e-08,
-    (float)3.07547e-08,
-    (float)2.07021e-09,
-    (float)1.82129e-08,
-    (float)3.4189e-08,
-    (float)1.67382e-08,
-    (float)8.53275e-10,
-    (float)1.76727e-08,
-    (float)4.48719e-08,
-    (float)5.86408e-08,
-    (float)1.87958e-08,
-    (float)2.63668e-08,
-    (float)2.64262e-08,
-    (float)6.34524e-08,
-    (float)2.56046e-08,
-    (float)2.15319e-08,
-    (float)3.07336e-08,
-    (float)7.08985e-08,
-    (float)2.64531e-08,
-    (float)6.2311e-09,
-    (float)2.09134e-08,
-    (float)7.13653e-08,
-    (float)1.37219e-08,
-    (float)3.6854e-09,
-    (float)8.5777e-08,
-    (float)6.84204e-08,
-    (float)7.65451e-08,
-    (float)1.41382e-08,
-    (float)3.13181e-08,
-    (float)6.2052e-08,
-    (float)4.66446e-08,
-    (float)1.93816e-10,
-    (float)0.761861,
-    (float)0.0831039,
-    (float)0.134894,
-    (float)0.0129808,
-    (float)0.00292151,
-    (float)0.00033422,
-    (float)0.00237271,
-    (float)0.000717455,
-    (float)0.000216537,
-    (float)8.0249e-05,
-    (float)0.000141687,
-    (float)0.000133673,
-    (float)5.16129e-06,
-    (float)4.89151e-05,
-    (float)5.03815e-05,
-    (float)5.43427e-05,
-    (float)1.21659e-06,
-    (float)1.32426e-05,
-    (float)8.27187e-06,
-    (float)1.29178e-05,
-    (float)4.43279e-06,
-    (float)4.7059e-06,
-    (float)3.64438e-06,
-    (float)3.52467e-06,
-    (float)3.18194e-07,
-    (float)5.22439e-06,
-    (float)1.51393e-06,
-    (float)4.7819e-06,
-    (float)1.80833e-06,
-    (float)2.3225e-07,
-    (float)6.45526e-07,
-    (float)6.54542e-07,
-    (float)3.35873e-07,
-    (float)6.63904e-07,
-    (float)9.95534e-07,
-    (float)1.65896e-06,
-    (float)7.86075e-07,
-    (float)1.66595e-07,
-    (float)2.22501e-07,
-    (float)8.26935e-07,
-    (float)4.15595e-07,
-    (float)4.03617e-08,
-    (float)7.36024e-07,
-    (float)5.92541e-07,
-    (float)3.54114e-07,
-    (float)8.04526e-08,
-    (float)7.27125e-07,
-    (float)4.97552e-07,
-    (float)1.6156e-07,
-    (float)7.95133e-08,
-    (float)7.45808e-07,
-    (float)4.07023e-07,
-    (float)4.66168e-08,
-    (float)4.45427e-08,
-    (float)5.1155e-07,
-    (float)2.59049e-07,
-    (float)2.98118e-08,
-    (float)1.46935e-07,
-    (float)6.99e-07,
-    (float)2.57743e-07,
-    (float)4.15568e-08,
-    (float)1.4949e-07,
-    (float)1.13696e-07,
-    (float)1.45097e-07,
-    (float)9.43964e-08,
-    (float)2.1582e-07,
-    (float)2.73524e-07,
-    (float)1.16594e-07,
-    (float)1.42647e-08,
-    (float)1.67911e-07,
-    (float)1.60045e-07,
-    (float)3.70038e-08,
-    (float)4.72207e-08,
-    (float)1.69882e-07,
-    (float)7.24508e-08,
-    (float)1.48399e-08,
-    (float)4.0894e-08,
-    (float)1.38495e-07,
-    (float)9.56783e-08,
-    (float)1.40133e-08,
-    (float)4.08107e-08,
-    (float)7.8751e-08,
-    (float)6.07371e-08,
-    (float)1.62762e-10,
-    (float)5.21206e-08,
-    (float)4.11774e-08,
-    (float)4.83112e-08,
-    (float)5.74771e-08,
-    (float)2.86093e-08,
-    (float)6.74115e-08,
-    (float)3.94115e-08,
-    (float)1.3795e-08,
-    (float)3.26136e-08,
-    (float)5.00334e-09,
-    (float)2.40782e-08,
-    (float)1.44171e-08,
-    (float)1.6104e-08,
-    (float)4.02698e-09,
-    (float)6.51203e-08,
-    (float)3.33349e-08,
-    (float)1.88172e-08,
-    (float)2.13549e-08,
-    (float)4.71532e-08,
-    (float)2.52913e-08,
-    (float)1.17099e-09,
-    (float)6.53191e-09,
-    (float)7.88455e-08,
-    (float)1.42624e-08,
-    (float)2.60141e-09,
-    (float)2.5937e-08,
-    (float)5.71346e-08,
-    (float)6.14985e-09,
-    (float)8.58284e-09,
-    (float)6.57162e-08,
-    (float)7.55921e-08,
-    (float)1.75399e-08,
-    (float)3.17852e-09,
-    (float)4.9891e-08,
-    (float)2.91226e-08,
-    (float)4.52853e-09,
-    (float)2.73262e-08,
-    (float)9.13871e-08,
-    (float)5.98482e-08,
-    (float)6.46867e-09,
-    (float)1.00979e-08,
-    (float)9.70197e-08,
-    (float)2.48072e-08,
-    (float)8.88564e-10,
-    (float)0.80246,
-    (float)0.0649865,
-    (float)0.120626,
-    (float)0.0073452,
-    (float)0.000697139,
-    (float)0.000595,
-    (float)0.00238521,
-    (float)0.0003209,
-    (float)4.65718e-06,
-    (float)0.000167399,
-    (float)0.000151991,
-    (float)3.17219e-05,
-    (float)1.96905e-05,
-    (float)9.5931e-05,
-    (float)2.52305e-05,
-    (float)6.48527e-06,
-    (float)7.30399e-06,
-    (float)2.46697e-05,
-    (float)7.22133e-06,
-    (float)8.93982e-07,
-    (float)2.6303e-06,
-    (float)9.12044e-06,
-    (float)3.94344e-07,
-    (float)2.60311e-06,
-    (float)1.81328e-06,
-    (float)5.66958e-06,
-    (float)1.72039e-06,
-    (float)3.91259e-07,
-    (float)7.30622e-07,
-    (float)4.76455e-07,
-    (float)2.98714e-07,
-    (float)1.07207e-06,
-    (float)3.85522e-07,
-    (float)1.8226e-06,
-    (float)4.42884e-07,
-    (float)2.65581e-07,
-    (float)1.30389e-07,
-    (float)5.45573e-07,
-    (float)5.00091e-07,
-    (float)2.81756e-07,
-    (float)3.32952e-07,
-    (float)6.86933e-07,
-    (float)1.44644e-07,
-    (float)2.42243e-07,
-    (float)8.02628e-07,
-    (float)1.32043e-07,
-    (float)4.81821e-08,
-    (float)5.1738e-07,
-    (float)5.12208e-07,
-    (float)1.56567e-07,
-    (float)2.0228e-07,
-    (float)1.13128e-07,
-    (float)3.87419e-07,
-    (float)4.42019e-08,
-    (float)4.93427e-07,
-    (float)4.46126e-07,
-    (float)1.95302e-07,
-    (float)5.99961e-10,
-    (float)2.8601e-07,
-    (float)1.80674e-07,
-    (float)3.07246e-08,
-    (float)8.51642e-08,
-    (float)5.07154e-07,
-    (float)1.07744e-07,
-    (float)5.20437e-10,
-    (float)2.04906e-07,
-    (float)7.73648e-08,
-    (float)8.41451e-08,
-    (float)1.22537e-07,
-    (float)1.40681e-07,
-    (float)6.29901e-08,
-    (float)1.87849e-09,
-    (float)5.71013e-08,
-    (float)2.45771e-07,
-    (float)1.24925e-08,
-    (float)9.63883e-10,
-    (float)1.01134e-07,
-    (float)4.77244e-08,
-    (float)1.91065e-08,
-    (float)6.67014e-08,
-    (float)1.98811e-08,
-    (float)7.15382e-08,
-    (float)2.38949e-08,
-    (float)6.99324e-08,
-    (float)1.03762e-07,
-    (float)1.45014e-08,
-    (float)6.80585e-09,
-    (float)1.70406e-08,
-    (float)3.07062e-08,
-    (float)1.97549e-08,
-    (float)1.42838e-08,
-    (float)1.84796e-08,
-    (float)1.14884e-08,
-    (float)5.84002e-08,
-    (float)6.07447e-08,
-    (float)2.37302e-08,
-    (float)4.30993e-08,
-    (float)6.83063e-09,
-    (float)2.0487e-09,
-    (float)1.73164e-08,
-    (float)7.46131e-08,
-    (float)4.41571e-08,
-    (float)2.87485e-08,
-    (float)2.95141e-09,
-    (float)4.31947e-08,
-    (float)6.42486e-09,
-    (float)2.50699e-08,
-    (float)4.67113e-08,
-    (float)3.56194e-08,
-    (float)7.94631e-09,
-    (float)6.04047e-08,
-    (float)2.29344e-08,
-    (float)2.48569e-08,
-    (float)1.89227e-08,
-    (float)4.02478e-08,
-    (float)5.91822e-08,
-    (float)6.42593e-09,
-    (float)1.67353e-08,
-    (float)8.03048e-08,
-    (float)3.33328e-08,
-    (float)1.52221e-09,
-    (float)5.11892e-08,
-    (float)2.93461e-08,
-    (float)3.7124e-09,
-    (float)1.05705e-08,
-    (float)1.00119e-07,
-    (float)2.5992e-08,
-    (float)1.64065e-08,
-    (float)0.838353,
-    (float)0.0498188,
-    (float)0.104733,
-    (float)0.0038103,
-    (float)3.69119e-06,
-    (float)0.000733923,
-    (float)0.00192503,
-    (float)8.34104e-05,
-    (float)6.93576e-05,
-    (float)0.000174643,
-    (float)7.63559e-05,
-    (float)1.95977e-05,
-    (float)5.47354e-05,
-    (float)6.76583e-05,
-    (float)1.35947e-06,
-    (float)1.0525e-05,
-    (float)1.79541e-05,
-    (float)6.29607e-06,
-    (float)2.12284e-06,
-    (float)1.29059e-05,
-    (float)8.04783e-08,
-    (float)4.05913e-07,
-    (float)2.35197e-06,
-    (float)7.04031e-06,
-    (float)1.81247e-06,
-    (float)2.94033e-07,
-    (float)8.32383e-07,
-    (float)7.05947e-07,
-    (float)2.38919e-07,
-    (float)1.12096e-06,
-    (float)9.93941e-08,
-    (float)1.57236e-06,
-    (float)3.74777e-07,
-    (float)3.68454e-07,
-    (float)2.21817e-08,
-    (float)2.92709e-07,
-    (float)4.35756e-07,
-    (float)4.40965e-07,
-    (float)7.82629e-08,
-    (float)5.47779e-07,
-    (float)1.01501e-07,
-    (float)3.73887e-07,
-    (float)4.57118e-07,
-    (float)4.57707e-09,
-    (float)1.47313e-08,
-    (float)6.80018e-07,
-    (float)2.36871e-07,
-    (float)2.43218e-08,
-    (float)3.5332e-07,
-    (float)1.07091e-07,
-    (float)7.02386e-08,
-    (float)3.7074e-07,
-    (float)4.56059e-07,
-    (float)2.07098e-07,
-    (float)3.30012e-08,
-    (float)7.5012e-08,
-    (float)2.08467e-07,
-    (float)5.65667e-08,
-    (float)3.41608e-07,
-    (float)1.87186e-07,
-    (float)7.3794e-08,
-    (float)3.43529e-08,
-    (float)1.86152e-07,
-    (float)1.37155e-07,
-    (float)4.78294e-08,
-    (float)1.02972e-07,
-    (float)1.48e-07,
-    (float)7.87156e-09,
-    (float)9.88411e-08,
-    (float)1.46327e-07,
-    (float)2.08347e-08,
-    (float)2.90661e-08,
-    (float)9.48397e-08,
-    (float)7.62466e-08,
-    (float)2.09274e-08,
-    (float)6.17024e-08,
-    (float)3.09321e-08,
-    (float)2.79594e-08,
-    (float)6.32705e-08,
-    (float)6.40935e-08,
-    (float)4.08054e-08,
-    (float)3.60298e-10,
-    (float)1.49277e-08,
-    (float)4.17061e-08,
-    (float)5.2e-09,
-    (float)1.5113e-08,
-    (float)1.60653e-08,
-    (float)1.25001e-08,
-    (float)2.68078e-08,
-    (float)4.74094e-08,
-    (float)2.69818e-08,
-    (float)5.48643e-09,
-    (float)4.92362e-09,
-    (float)3.6652e-09,
-    (float)1.55261e-09,
-    (float)4.409e-08,
-    (float)2.32547e-08,
-    (float)3.72464e-09,
-    (float)2.03718e-09,
-    (float)2.17694e-08,
-    (float)5.62348e-09,
-    (float)2.16624e-08,
-    (float)2.81296e-08,
-    (float)1.20668e-09,
-    (float)4.02464e-10,
-    (float)4.84843e-08,
-    (float)5.31633e-09,
-    (float)2.55632e-09,
-    (float)3.51659e-08,
-    (float)2.6541e-08,
-    (float)1.87616e-09,
-    (float)1.93878e-08,
-    (float)4.21992e-08,
-    (float)6.91157e-09,
-    (float)9.48332e-09,
-    (float)3.34615e-08,
-    (float)1.64087e-08,
-    (float)2.93653e-09,
-    (float)4.63417e-08,
-    (float)2.68028e-08,
-    (float)2.67218e-09,
-    (float)1.5073e-08,
-    (float)7.13471e-08,
-    (float)1.16313e-08,
-    (float)3.00835e-09,
-    (float)2.91412e-08,
-    (float)4.19632e-08,
-    (float)3.10683e-09,
-    (float)0.869755,
-    (float)0.0373803,
-    (float)0.0882287,
-    (float)0.00177105,
-    (float)0.000368621,
-    (float)0.000691726,
-    (float)0.00122864,
-    (float)1.46587e-05,
-    (float)0.000233306,
-    (float)0.000107837,
-    (float)7.86671e-06,
-    (float)5.90981e-05,
-    (float)5.99138e-05,
-    (float)1.58765e-05,
-    (float)8.77401e-06,
-    (float)2.10109e-05,
-    (float)1.12362e-05,
-    (float)3.30578e-06,
-    (float)5.5249e-07,
-    (float)7.70479e-06,
-    (float)1.54667e-06,
-    (float)5.50492e-06,
-    (float)2.91319e-06,
-    (float)7.41875e-07,
-    (float)1.00542e-06,
-    (float)1.64997e-06,
-    (float)2.35061e-07,
-    (float)7.64919e-07,
-    (float)6.71174e-08,
-    (float)1.5311e-06,
-    (float)4.55734e-07,
-    (float)5.33131e-07,
-    (float)1.10686e-09,
-    (float)1.40248e-07,
-    (float)3.64062e-07,
-    (float)3.65316e-07,
-    (float)1.1525e-07,
-    (float)4.32493e-07,
-    (float)8.59318e-08,
-    (float)3.73837e-07,
-    (float)2.96552e-07,
-    (float)1.62476e-08,
-    (float)1.79132e-08,
-    (float)5.1897e-07,
-    (float)1.87791e-07,
-    (float)1.41051e-07,
-    (float)2.0295e-07,
-    (float)6.10504e-08,
-    (float)9.99886e-10,
-    (float)6.03844e-07,
-    (float)2.59738e-07,
-    (float)5.70706e-08,
-    (float)1.49596e-07,
-    (float)3.29309e-08,
-    (float)2.32057e-08,
-    (float)3.27951e-07,
-    (float)3.31712e-07,
-    (float)4.32628e-08,
-    (float)6.84731e-08,
-    (float)9.77636e-08,
-    (float)7.73629e-08,
-    (float)1.01564e-07,
-    (float)2.38248e-07,
-    (float)5.05405e-08,
-    (float)2.16635e-08,
-    (float)6.28781e-08,
-    (float)1.75288e-07,
-    (float)3.27998e-08,
-    (float)6.43751e-08,
-    (float)1.12416e-07,
-    (float)1.02424e-08,
-    (float)1.02806e-08,
-    (float)1.29191e-07,
-    (float)2.96281e-08,
-    (float)4.34632e-08,
-    (float)9.87748e-08,
-    (float)2.37384e-08,
-    (float)1.31024e-09,
-    (float)2.23754e-08,
-    (float)4.22373e-08,
-    (float)2.61684e-08,
-    (float)3.33101e-08,
-    (float)1.1771e-08,
-    (float)8.37827e-10,
-    (float)4.49293e-08,
-    (float)6.56037e-08,
-    (float)1.27933e-08,
-    (float)6.6943e-10,
-    (float)2.03774e-09,
-    (float)3.3642e-09,
-    (float)2.37998e-08,
-    (float)2.84642e-08,
-    (float)6.25572e-09,
-    (float)4.92549e-09,
-    (float)2.17857e-08,
-    (float)1.43495e-09,
-    (float)1.60243e-10,
-    (float)1.34315e-08,
-    (float)9.07668e-09,
-    (float)1.81317e-08,
-    (float)1.68892e-08,
-    (float)6.37225e-09,
-    (float)2.07188e-09,
-    (float)3.36018e-08,
-    (float)1.56993e-08,
-    (float)9.3659e-09,
-    (float)1.6525e-09,
-    (float)3.02396e-08,
-    (float)1.84271e-09,
-    (float)2.64222e-08,
-    (float)1.37811e-08,
-    (float)4.58346e-09,
-    (float)1.94828e-08,
-    (float)2.59397e-08,
-    (float)1.0731e-08,
-    (float)3.71189e-08,
-    (float)4.56887e-08,
-    (float)9.12556e-09,
-    (float)6.14058e-09,
-    (float)2.31989e-08,
-    (float)2.36992e-08,
-    (float)8.59866e-09,
-    (float)6.28841e-08,
-    (float)6.46893e-09,
-    (float)8.23283e-09,
-    (float)2.91408e-08,
-    (float)4.56999e-08,
-    (float)3.88478e-10,
-    (float)0.897083,
-    (float)0.027373,
-    (float)0.0718791,
-    (float)0.000715243,
-    (float)0.00126681,
-    (float)0.00052692,
-    (float)0.000565772,
-    (float)3.81325e-05,
-    (float)0.000324367,
-    (float)3.80188e-05,
-    (float)1.31663e-05,
-    (float)7.28392e-05,
-    (float)2.72137e-05,
-    (float)1.05911e-06,
-    (float)2.90585e-05,
-    (float)7.98517e-06,
-    (float)9.19522e-07,
-    (float)1.45218e-05,
-    (float)5.80874e-07,
-    (float)4.61551e-08,
-    (float)4.71687e-06,
-    (float)4.37514e-06,
-    (float)1.53777e-06,
-    (float)1.86312e-06,
-    (float)6.76177e-08,
-    (float)2.15241e-08,
-    (float)2.29064e-07,
-    (float)1.92591e-06,
-    (float)5.36449e-07,
-    (float)5.05812e-07,
-    (float)4.35398e-08,
-    (float)5.01649e-08,
-    (float)2.30428e-07,
-    (float)3.27665e-07,
-    (float)2.52587e-07,
-    (float)3.71085e-07,
-    (float)1.06039e-07,
-    (float)1.92246e-07,
-    (float)1.56871e-07,
-    (float)5.59791e-08,
-    (float)1.02752e-07,
-    (float)3.38952e-07,
-    (float)2.13119e-07,
-    (float)1.63095e-07,
-    (float)8.57541e-08,
-    (float)6.50873e-08,
-    (float)3.44471e-08,
-    (float)5.02264e-07,
-    (float)1.68648e-07,
-    (float)7.32564e-08,
-    (float)1.47032e-07,
-    (float)6.05789e-09,
-    (float)2.32492e-09,
-    (float)4.67146e-07,
-    (float)1.25007e-07,
-    (float)1.10769e-08,
-    (float)1.7491e-07,
-    (float)2.53053e-08,
-    (float)4.01628e-09,
-    (float)2.15923e-07,
-    (float)1.00969e-07,
-    (float)2.60925e-08,
-    (float)1.90451e-07,
-    (float)2.47039e-08,
-    (float)7.91683e-09,
-    (float)1.19299e-07,
-    (float)5.52861e-08,
-    (float)5.23311e-08,
-    (float)1.65814e-07,
-    (float)4.57701e-09,
-    (float)1.58743e-09,
-    (float)1.04465e-07,
-    (float)5.29764e-08,
-    (float)1.47144e-08,
-    (float)6.64131e-08,
-    (float)2.85401e-08,
-    (float)1.82926e-09,
-    (float)3.11399e-08,
-    (float)3.20609e-08,
-    (float)5.66736e-09,
-    (float)5.53177e-08,
-    (float)5.11459e-08,
-    (float)9.39062e-09,
-    (float)1.04526e-08,
-    (float)3.63139e-09,
-    (float)1.01439e-09,
-    (float)3.44772e-08,
-    (float)2.46116e-08,
-    (float)2.18955e-09,
-    (float)1.20925e-08,
-    (float)1.29933e-08,
-    (float)2.45857e-09,
-    (float)9.66674e-09,
-    (float)1.1831e-08,
-    (float)8.27412e-09,
-    (float)6.79961e-09,
-    (float)1.18999e-08,
-    (float)1.86714e-10,
-    (float)7.47213e-09,
-    (float)1.40179e-08,
-    (float)7.61814e-09,
-    (float)9.1006e-09,
-    (float)1.4812e-08,
-    (float)6.49631e-09,
-    (float)8.82437e-09,
-    (float)8.25461e-09,
-    (float)4.0634e-09,
-    (float)1.67478e-08,
-    (float)7.963e-09,
-    (float)3.1492e-09,
-    (float)2.01766e-08,
-    (float)4.202e-08,
-    (float)5.45723e-09,
-    (float)6.80264e-09,
-    (float)1.23094e-08,
-    (float)1.28231e-08,
-    (float)8.63845e-09,
-    (float)2.1469e-08,
-    (float)1.77899e-08,
-    (float)3.78965e-08,
-    (float)1.92689e-08,
-    (float)8.38628e-09,
-    (float)1.27425e-08,
-    (float)1.89159e-08,
-    (float)7.09543e-09,
-    (float)2.92035e-08,
-    (float)2.10562e-08,
-    (float)1.30255e-08,
-    (float)0.920606,
-    (float)0.0194775,
-    (float)0.0564254,
-    (float)0.000246607,
-    (float)0.00222831,
-    (float)0.000326203,
-    (float)0.000137277,
-    (float)7.25806e-05,
-    (float)0.000278171,
-    (float)1.13424e-05,
-    (float)6.95137e-05,
-    (float)4.52811e-05,
-    (float)2.219e-06,
-    (float)1.132e-05,
-    (float)2.69572e-05,
-    (float)1.45375e-06,
-    (float)2.08008e-06,
-    (float)9.02301e-06,
-    (float)1.8019e-06,
-    (float)5.2008e-06,
-    (float)4.61436e-06,
-    (float)3.12063e-08,
-    (float)1.09363e-07,
-    (float)1.36034e-06,
-    (float)4.09561e-07,
-    (float)2.37182e-06,
-    (float)5.26892e-07,
-    (float)1.29793e-07,
-    (float)2.48276e-07,
-    (float)2.94414e-07,
-    (float)1.2732e-07,
-    (float)5.08408e-07,
-    (float)3.14077e-07,
-    (float)1.82307e-07,
-    (float)1.61288e-07,
-    (float)1.11202e-07,
-    (float)1.31595e-07,
-    (float)1.33127e-07,
-    (float)1.55223e-07,
-    (float)1.65458e-07,
-    (float)2.40411e-07,
-    (float)1.04113e-07,
-    (float)4.77671e-08,
-    (float)8.53345e-08,
-    (float)1.17668e-07,
-    (float)3.28568e-07,
-    (float)1.74918e-07,
-    (float)9.29813e-08,
-    (float)7.91696e-08,
-    (float)2.2077e-08,
-    (float)6.25079e-08,
-    (float)3.60386e-07,
-    (float)4.35247e-08,
-    (float)7.76861e-08,
-    (float)1.59693e-07,
-    (float)2.37148e-08,
-    (float)4.37168e-08,
-    (float)1.23282e-07,
-    (float)1.07132e-08,
-    (float)1.63641e-07,
-    (float)1.42416e-07,
-    (float)5.47476e-09,
-    (float)7.39577e-08,
-    (float)5.87692e-08,
-    (float)4.10969e-10,
-    (float)1.08255e-07,
-    (float)9.69931e-08,
-    (float)3.78007e-08,
-    (float)7.94047e-08,
-    (float)4.84062e-08,
-    (float)4.16477e-09,
-    (float)2.41422e-08,
-    (float)3.60362e-08,
-    (float)5.12073e-08,
-    (float)7.56781e-08,
-    (float)2.95645e-09,
-    (float)1.71902e-08,
-    (float)5.21812e-08,
-    (float)1.81588e-08,
-    (float)1.9445e-08,
-    (float)2.75708e-08,
-    (float)1.17945e-08,
-    (float)3.2178e-08,
-    (float)2.62436e-08,
-    (float)1.7377e-10,
-    (float)2.18938e-08,
-    (float)1.52287e-08,
-    (float)9.59848e-09,
-    (float)9.93864e-09,
-    (float)1.80451e-08,
-    (float)1.01281e-08,
-    (float)1.69583e-08,
-    (float)3.79343e-09,
-    (float)1.40494e-09,
-    (float)1.09613e-08,
-    (float)1.7162e-08,
-    (float)2.00993e-08,
-    (float)2.31214e-09,
-    (float)9.10266e-09,
-    (float)4.55904e-09,
-    (float)1.14696e-08,
-    (float)1.0248e-08,
-    (float)2.16052e-08,
-    (float)3.42866e-09,
-    (float)1.42468e-08,
-    (float)8.53623e-09,
-    (float)2.39939e-08,
-    (float)3.07233e-09,
-    (float)1.48289e-08,
-    (float)4.76857e-09,
-    (float)2.34228e-08,
-    (float)1.71993e-08,
-    (float)4.41212e-09,
-    (float)8.76766e-09,
-    (float)3.20565e-08,
-    (float)1.0188e-08,
-    (float)6.85822e-09,
-    (float)3.68346e-08,
-    (float)1.04749e-08,
-    (float)9.76845e-09,
-    (float)5.76991e-09,
-    (float)2.22595e-08,
-    (float)1.27449e-08,
-    (float)3.04566e-08,
-    (float)3.28428e-09,
-    (float)3.5353e-08,
-    (float)7.93937e-09,
-    (float)1.34468e-08,
-    (float)0.94063,
-    (float)0.0133932,
-    (float)0.0423853,
-    (float)9.12974e-05,
-    (float)0.00290794,
-    (float)0.000159948,
-    (float)1.19477e-06,
-    (float)7.76419e-05,
-    (float)0.000145417,
-    (float)1.96697e-05,
-    (float)0.000104903,
-    (float)1.21775e-05,
-    (float)1.50899e-05,
-    (float)1.19354e-05,
-    (float)7.25704e-06,
-    (float)9.47881e-06,
-    (float)4.12773e-06,
-    (float)4.29297e-07,
-    (float)7.23599e-06,
-    (float)3.22301e-06,
-    (float)1.06213e-06,
-    (float)2.96008e-06,
-    (float)8.38983e-08,
-    (float)6.28689e-07,
-    (float)8.00265e-07,
-    (float)6.10417e-07,
-    (float)6.53772e-07,
-    (float)8.68188e-07,
-    (float)3.42833e-08,
-    (float)4.26982e-07,
-    (float)1.19802e-07,
-    (float)9.29209e-09,
-    (float)3.18983e-07,
-    (float)2.31232e-07,
-    (float)1.03264e-07,
-    (float)1.91001e-07,
-    (float)1.11584e-07,
-    (float)5.40147e-08,
-    (float)2.52157e-07,
-    (float)1.58896e-08,
-    (float)8.11038e-08,
-    (float)1.26451e-07,
-    (float)1.76112e-07,
-    (float)1.57825e-07,
-    (float)2.04186e-07,
-    (float)6.20464e-08,
-    (float)3.3104e-08,
-    (float)2.23559e-08,
-    (float)1.7236e-07,
-    (float)2.08227e-07,
-    (float)2.32486e-08,
-    (float)9.75835e-08,
-    (float)1.10838e-07,
-    (float)3.57373e-08,
-    (float)9.26734e-08,
-    (float)3.30589e-08,
-    (float)5.55674e-09,
-    (float)1.93211e-07,
-    (float)5.63938e-08,
-    (float)4.64222e-08,
-    (float)1.2002e-07,
-    (float)2.92607e-08,
-    (float)1.08115e-08,
-    (float)8.87769e-08,
-    (float)2.24302e-08,
-    (float)1.09117e-07,
-    (float)7.93437e-08,
-    (float)3.49224e-08,
-    (float)5.63201e-08,
-    (float)4.07194e-09,
-    (float)1.13694e-08,
-    (float)5.61157e-08,
-    (float)1.10945e-08,
-    (float)5.63649e-08,
-    (float)7.95282e-08,
-    (float)2.29426e-08,
-    (float)2.12518e-08,
-    (float)3.13233e-09,
-    (float)2.67085e-09,
-    (float)3.52619e-08,
-    (float)3.17085e-08,
-    (float)3.1176e-08,
-    (float)3.15343e-08,
-    (float)1.13605e-08,
-    (float)7.92902e-09,
-    (float)3.18597e-09,
-    (float)2.12678e-09,
-    (float)3.86219e-08,
-    (float)1.09667e-08,
-    (float)6.34899e-09,
-    (float)2.3143e-08,
-    (float)5.47684e-09,
-    (float)3.2892e-09,
-    (float)1.69945e-08,
-    (float)6.54368e-09,
-    (float)7.42378e-09,
-    (float)1.50015e-08,
-    (float)7.29474e-09,
-    (float)7.15492e-09,
-    (float)3.7608e-09,
-    (float)1.54911e-08,
-    (float)6.81735e-09,
-    (float)2.20345e-08,
-    (float)1.14581e-08,
-    (float)4.01615e-09,
-    (float)4.8526e-09,
-    (float)2.26111e-08,
-    (float)3.00053e-09,
-    (float)5.1384e-09,
-    (float)1.52298e-08,
-    (float)1.73192e-08,
-    (float)5.11551e-09,
-    (float)1.27887e-08,
-    (float)1.61006e-08,
-    (float)8.32077e-09,
-    (float)5.37645e-09,
-    (float)1.50538e-08,
-    (float)1.10277e-08,
-    (float)1.36731e-08,
-    (float)1.97003e-08,
-    (float)8.54294e-09,
-    (float)1.27985e-08,
-    (float)1.53495e-08,
-    (float)1.11462e-08,
-    (float)1.3145e-08,
-    (float)1.63031e-08,
-    (float)1.15663e-08,
-    (float)1.93304e-08,
-    (float)0.957382,
-    (float)0.00881984,
-    (float)0.0301761,
-    (float)6.94631e-05,
-    (float)0.0031317,
-    (float)5.54474e-05,
-    (float)8.5645e-05,
-    (float)5.5814e-05,
-    (float)3.17509e-05,
-    (float)3.11719e-05,
-    (float)8.16772e-05,
-    (float)1.48645e-07,
-    (float)4.11262e-05,
-    (float)3.56395e-06,
-    (float)4.27987e-07,
-    (float)1.09501e-05,
-    (float)1.10485e-06,
-    (float)2.55739e-06,
-    (float)8.15174e-06,
-    (float)1.18336e-07,
-    (float)2.74817e-07,
-    (float)1.42645e-06,
-    (float)7.12333e-07,
-    (float)2.13449e-06,
-    (float)9.64791e-07,
-    (float)6.082e-07,
-    (float)7.03353e-08,
-    (float)6.50045e-08,
-    (float)2.37609e-08,
-    (float)3.02361e-07,
-    (float)4.79118e-07,
-    (float)5.21376e-07,
-    (float)4.8559e-08,
-    (float)1.16e-07,
-    (float)1.50671e-08,
-    (float)8.59953e-09,
-    (float)2.17235e-07,
-    (float)7.15621e-08,
-    (float)1.66754e-07,
-    (float)1.4854e-07,
-    (float)1.20335e-07,
-    (float)6.28706e-08,
-    (float)2.43627e-07,
-    (float)1.37585e-08,
-    (float)1.77379e-08,
-    (float)2.23522e-08,
-    (float)2.53116e-07,
-    (float)1.24336e-07,
-    (float)3.03059e-08,
-    (float)6.91254e-08,
-    (float)7.56914e-08,
-    (float)2.56586e-08,
-    (float)1.06533e-07,
-    (float)9.00674e-09,
-    (float)4.49953e-08,
-    (float)1.41654e-07,
-    (float)2.75469e-08,
-    (float)4.91359e-08,
-    (float)1.03181e-07,
-    (float)6.80784e-08,
-    (float)1.88535e-08,
-    (float)2.17915e-08,
-    (float)5.96646e-08,
-    (float)6.97839e-08,
-    (float)2.3191e-08,
-    (float)7.42598e-08,
-    (float)5.70787e-08,
-    (float)4.09387e-08,
-    (float)3.67233e-08,
-    (float)3.29907e-09,
-    (float)2.22229e-08,
-    (float)6.1837e-08,
-    (float)2.90736e-08,
-    (float)4.48879e-08,
-    (float)2.60478e-08,
-    (float)3.44768e-08,
-    (float)3.89866e-08,
-    (float)1.51408e-09,
-    (float)2.05835e-08,
-    (float)2.3234e-08,
-    (float)6.28296e-09,
-    (float)1.57034e-08,
-    (float)2.20466e-08,
-    (float)3.54536e-08,
-    (float)3.4271e-08,
-    (float)6.54131e-09,
-    (float)1.23147e-08,
-    (float)3.67028e-09,
-    (float)3.05476e-09,
-    (float)1.96369e-08,
-    (float)5.74145e-09,
-    (float)1.46863e-08,
-    (float)2.12674e-08,
-    (float)1.67419e-08,
-    (float)8.49089e-09,
-    (float)6.43779e-09,
-    (float)2.44066e-09,
-    (float)1.87793e-08,
-    (float)6.55045e-09,
-    (float)8.63719e-09,
-    (float)5.87994e-09,
-    (float)2.19069e-08,
-    (float)1.06221e-08,
-    (float)7.56706e-09,
-    (float)7.50131e-09,
-    (float)1.69446e-08,
-    (float)4.34664e-09,
-    (float)6.60165e-09,
-    (float)9.4981e-09,
-    (float)1.68211e-08,
-    (float)6.40065e-09,
-    (float)1.25575e-08,
-    (float)2.37837e-08,
-    (float)1.14647e-08,
-    (float)5.19396e-09,
-    (float)2.79999e-09,
-    (float)1.26591e-08,
-    (float)1.37121e-08,
-    (float)2.25823e-08,
-    (float)9.36686e-09,
-    (float)1.28013e-08,
-    (float)9.51058e-09,
-    (float)1.89462e-08,
-    (float)1.65029e-09,
-    (float)1.59333e-08,
-    (float)1.24201e-08,
-    (float)1.91162e-08,
-    (float)5.94666e-09,
-    (float)0.9711,
-    (float)0.00548627,
-    (float)0.0200333,
-    (float)8.23274e-05,
-    (float)0.00287533,
-    (float)9.5338e-06,
-    (float)0.000246196,
-    (float)2.78505e-05,
-    (float)2.22895e-06,
-    (float)2.81706e-05,
-    (float)2.9766e-05,
-    (float)3.03972e-06,
-    (float)4.07931e-05,
-    (float)1.37645e-06,
-    (float)8.13693e-06,
-    (float)3.96228e-06,
-    (float)4.81572e-06,
-    (float)2.96391e-06,
-    (float)2.09824e-06,
-    (float)2.59589e-06,
-    (float)2.78105e-07,
-    (float)5.54745e-07,
-    (float)2.18232e-06,
-    (float)2.14814e-07,
-    (float)4.68816e-07,
-    (float)8.28556e-07,
-    (float)3.79074e-08,
-    (float)7.4223e-07,
-    (float)3.64711e-07,
-    (float)3.72474e-07,
-    (float)1.58885e-08,
-    (float)2.27693e-08,
-    (float)3.26483e-08,
-    (float)9.84714e-08,
-    (float)1.67949e-07,
-    (float)2.66846e-07,
-    (float)1.91227e-07,
-    (float)1.19787e-07,
-    (float)3.32836e-08,
-    (float)3.54817e-08,
-    (float)2.51526e-07,
-    (float)1.14757e-08,
-    (float)3.52113e-08,
-    (float)6.14308e-08,
-    (float)2.65712e-07,
-    (float)7.94487e-08,
-    (float)4.51708e-08,
-    (float)4.057e-08,
-    (float)5.05051e-08,
-    (float)1.09289e-08,
-    (float)1.10923e-07,
-    (float)7.88455e-09,
-    (float)8.22287e-08,
-    (float)9.26267e-08,
-    (float)3.48539e-08,
-    (float)3.41028e-08,
-    (float)9.79616e-08,
-    (float)5.95775e-08,
-    (float)1.39125e-08,
-    (float)2.66693e-09,
-    (float)1.11853e-07,
-    (float)1.92201e-08,
-    (float)2.27458e-08,
-    (float)6.04537e-08,
-    (float)5.0606e-08,
-    (float)5.39719e-08,
-    (float)1.72522e-08,
-    (float)2.16164e-08,
-    (float)5.28065e-08,
-    (float)1.64829e-08,
-    (float)2.66584e-08,
-    (float)1.17807e-08,
-    (float)1.38181e-08,
-    (float)6.40402e-08,
-    (float)2.56027e-08,
-    (float)3.35365e-08,
-    (float)3.49167e-08,
-    (float)4.94005e-09,
-    (float)8.85767e-09,
-    (float)1.91421e-09,
-    (float)2.60402e-08,
-    (float)2.31702e-08,
-    (float)8.36496e-09,
-    (float)3.55382e-08,
-    (float)1.83132e-08,
-    (float)2.08775e-08,
-    (float)1.37877e-08,
-    (float)1.11806e-08,
-    (float)1.21687e-08,
-    (float)5.85797e-09,
-    (float)4.05266e-09,
-    (float)1.14425e-08,
-    (float)3.36264e-09,
-    (float)4.71017e-08,
-    (float)1.38059e-08,
-    (float)4.5094e-09,
-    (float)1.0068e-08,
-    (float)1.50743e-08,
-    (float)2.60602e-09,
-    (float)4.30538e-09,
-    (float)6.50357e-09,
-    (float)2.67512e-08,
-    (float)3.15238e-09,
-    (float)1.47185e-08,
-    (float)1.3538e-08,
-    (float)8.07379e-09,
-    (float)6.20548e-09,
-    (float)1.34747e-08,
-    (float)1.08242e-08,
-    (float)1.21128e-08,
-    (float)4.47434e-09,
-    (float)7.12164e-09,
-    (float)8.75803e-09,
-    (float)1.93676e-08,
-    (float)2.35548e-08,
-    (float)3.28413e-09,
-    (float)9.47688e-09,
-    (float)1.52733e-08,
-    (float)9.32542e-09,
-    (float)3.85885e-09,
-    (float)1.56833e-08,
-    (float)9.36629e-09,
-    (float)1.34731e-08,
-    (float)6.6181e-09,
-    (float)2.76614e-08,
-    (float)7.25516e-09,
-    (float)9.36807e-09,
-    (float)4.97099e-09,
-    (float)0.981961,
-    (float)0.00315474,
-    (float)0.0120639,
-    (float)8.50744e-05,
-    (float)0.0022594,
-    (float)1.95093e-08,
-    (float)0.000345959,
-    (float)9.96715e-06,
-    (float)4.29649e-05,
-    (float)1.52239e-05,
-    (float)2.8424e-06,
-    (float)4.9584e-06,
-    (float)1.65544e-05,
-    (float)4.65545e-06,
-    (float)8.4579e-06,
-    (float)8.2448e-07,
-    (float)1.18672e-05,
-    (float)3.63333e-07,
-    (float)2.96706e-07,
-    (float)2.06635e-06,
-    (float)5.80972e-07,
-    (float)1.2591e-06,
-    (float)1.12918e-06,
-    (float)8.69556e-07,
-    (float)2.03874e-07,
-    (float)1.76352e-07,
-    (float)3.88231e-07,
-    (float)1.5096e-07,
-    (float)2.74367e-07,
-    (float)3.87474e-07,
-    (float)8.7297e-08,
-    (float)2.53721e-07,
-    (float)8.83653e-08,
-    (float)3.45114e-07,
-    (float)6.14188e-08,
-    (float)4.86604e-08,
-    (float)4.70758e-08,
-    (float)4.37389e-08,
-    (float)1.64394e-07,
-    (float)8.84554e-08,
-    (float)1.10083e-07,
-    (float)8.63108e-08,
-    (float)1.56791e-07,
-    (float)8.48447e-08,
-    (float)6.94836e-08,
-    (float)2.54863e-08,
-    (float)2.50009e-08,
-    (float)2.66272e-08,
-    (float)7.89362e-08,
-    (float)2.48412e-08,
-    (float)8.88558e-08,
-    (float)5.64466e-08,
-    (float)1.75449e-08,
-    (float)5.02184e-08,
-    (float)1.01922e-07,
-    (float)2.73659e-08,
-    (float)1.0262e-08,
-    (float)1.19012e-08,
-    (float)9.03643e-08,
-    (float)9.21799e-09,
-    (float)2.83458e-08,
-    (float)3.93551e-08,
-    (float)5.60288e-08,
-    (float)4.67237e-08,
-    (float)7.53326e-09,
-    (float)3.91582e-08,
-    (float)5.03872e-08,
-    (float)1.47172e-08,
-    (float)1.89636e-08,
-    (float)2.96353e-10,
-    (float)2.89375e-08,
-    (float)1.91315e-08,
-    (float)3.17365e-08,
-    (float)4.43994e-08,
-    (float)1.19861e-08,
-    (float)2.48547e-08,
-    (float)1.60524e-08,
-    (float)2.24414e-08,
-    (float)2.8711e-08,
-    (float)3.13768e-09,
-    (float)1.27347e-08,
-    (float)9.53229e-09,
-    (float)2.10668e-08,
-    (float)1.11674e-08,
-    (float)6.73452e-09,
-    (float)3.45005e-08,
-    (float)1.41226e-08,
-    (float)1.83675e-08,
-    (float)9.61579e-09,
-    (float)1.29169e-08,
-    (float)1.56237e-08,
-    (float)4.95447e-09,
-    (float)1.51973e-08,
-    (float)1.48467e-09,
-    (float)5.57758e-09,
-    (float)1.68062e-08,
-    (float)7.15885e-09,
-    (float)2.20217e-08,
-    (float)1.31794e-08,
-    (float)1.5998e-08,
-    (float)1.32039e-08,
-    (float)2.95065e-09,
-    (float)9.15341e-09,
-    (float)4.09171e-09,
-    (float)1.07617e-08,
-    (float)1.20981e-08,
-    (float)3.0053e-09,
-    (float)9.56074e-09,
-    (float)1.05799e-08,
-    (float)2.36166e-08,
-    (float)7.76204e-09,
-    (float)1.17509e-08,
-    (float)1.24619e-08,
-    (float)6.85413e-09,
-    (float)7.62659e-09,
-    (float)5.14508e-09,
-    (float)7.1687e-09,
-    (float)1.19785e-08,
-    (float)4.80472e-09,
-    (float)1.8324e-08,
-    (float)1.0725e-08,
-    (float)1.17964e-08,
-    (float)1.02254e-08,
-    (float)1.07481e-08,
-    (float)9.32247e-09,
-    (float)1.02587e-08,
-    (float)6.00712e-09,
-    (float)1.31997e-08,
-    (float)0.990135,
-    (float)0.00160975,
-    (float)0.00624943,
-    (float)6.81243e-05,
-    (float)0.00147225,
-    (float)3.94045e-06,
-    (float)0.000319981,
-    (float)4.07228e-06,
-    (float)8.73308e-05,
-    (float)4.87056e-06,
-    (float)1.35744e-05,
-    (float)2.48419e-06,
-    (float)1.04592e-06,
-    (float)4.93297e-06,
-    (float)1.42022e-06,
-    (float)1.21555e-06,
-    (float)8.14728e-06,
-    (float)9.74594e-07,
-    (float)1.22455e-06,
-    (float)5.13365e-07,
-    (float)3.09301e-06,
-    (float)2.89405e-07,
-    (float)4.36789e-07,
-    (float)7.89575e-07,
-    (float)1.18905e-07,
-    (float)4.63799e-07,
-    (float)2.49744e-07,
-    (float)5.70483e-07,
-    (float)5.16863e-08,
-    (float)1.39263e-07,
-    (float)8.19576e-08,
-    (float)1.38423e-07,
-    (float)1.33707e-08,
-    (float)1.68857e-07,
-    (float)1.83961e-07,
-    (float)6.19632e-08,
-    (float)7.68955e-08,
-    (float)2.6311e-07,
-    (float)1.3989e-07,
-    (float)6.22882e-08,
-    (float)6.03448e-08,
-    (float)1.35296e-07,
-    (float)7.78522e-08,
-    (float)2.07015e-08,
-    (float)2.91714e-09,
-    (float)5.26494e-08,
-    (float)5.71623e-08,
-    (float)5.17492e-08,
-    (float)7.67986e-08,
-    (float)3.84255e-08,
-    (float)6.28588e-09,
-    (float)6.64342e-08,
-    (float)8.42683e-08,
-    (float)1.31222e-08,
-    (float)1.15131e-08,
-    (float)3.59881e-08,
-    (float)6.78562e-08,
-    (float)9.47845e-09,
-    (float)2.74738e-08,
-    (float)3.72009e-08,
-    (float)6.45395e-08,
-    (float)2.87839e-08,
-    (float)2.17803e-08,
-    (float)3.20154e-08,
-    (float)3.78166e-08,
-    (float)2.03468e-08,
-    (float)8.57638e-09,
-    (float)4.6454e-09,
-    (float)2.42109e-08,
-    (float)9.22279e-09,
-    (float)5.32586e-08,
-    (float)1.46775e-08,
-    (float)1.72309e-08,
-    (float)1.50662e-08,
-    (float)3.90969e-08,
-    (float)2.5724e-08,
-    (float)1.62007e-08,
-    (float)2.05545e-08,
-    (float)5.07685e-09,
-    (float)3.83888e-09,
-    (float)2.6955e-08,
-    (float)4.02416e-09,
-    (float)1.75007e-08,
-    (float)5.01026e-09,
-    (float)1.98426e-08,
-    (float)4.12355e-09,
-    (float)3.51053e-08,
-    (float)2.00732e-08,
-    (float)5.46868e-09,
-    (float)1.2247e-08,
-    (float)1.99411e-08,
-    (float)1.09595e-08,
-    (float)3.30594e-09,
-    (float)8.59494e-09,
-    (float)2.07535e-08,
-    (float)1.40892e-09,
-    (float)1.1824e-08,
-    (float)5.33908e-09,
-    (float)1.38192e-08,
-    (float)2.37109e-09,
-    (float)1.58787e-08,
-    (float)2.17318e-08,
-    (float)9.0226e-09,
-    (float)1.59165e-08,
-    (float)7.47592e-09,
-    (float)1.4906e-08,
-    (float)9.01578e-09,
-    (float)5.64267e-09,
-    (float)1.27839e-08,
-    (float)6.461e-09,
-    (float)4.4153e-09,
-    (float)9.21792e-09,
-    (float)1.17819e-08,
-    (float)9.79043e-09,
-    (float)2.83221e-09,
-    (float)2.46596e-08,
-    (float)7.75077e-09,
-    (float)1.26097e-08,
-    (float)4.3383e-09,
-    (float)1.37538e-08,
-    (float)4.28015e-09,
-    (float)1.15592e-08,
-    (float)9.06736e-09,
-    (float)1.37996e-08,
-    (float)2.51644e-09,
-    (float)1.47107e-08,
-    (float)5.77569e-09,
-    (float)1.88756e-08,
-    (float)0.995776,
-    (float)0.000670582,
-    (float)0.00245451,
-    (float)3.99364e-05,
-    (float)0.000725999,
-    (float)6.74809e-06,
-    (float)0.000191964,
-    (float)3.34317e-06,
-    (float)8.10958e-05,
-    (float)1.59328e-06,
-    (float)2.82283e-05,
-    (float)4.7803e-07,
-    (float)3.40123e-06,
-    (float)2.56225e-06,
-    (float)2.66482e-06,
-    (float)5.02342e-07,
-    (float)9.68336e-07,
-    (float)1.63081e-06,
-    (float)1.15997e-08,
-    (float)3.10589e-07,
-    (float)1.86875e-06,
-    (float)6.15441e-07,
-    (float)4.68684e-07,
-    (float)1.30492e-07,
-    (float)6.57393e-07,
-    (float)2.12847e-07,
-    (float)3.50507e-07,
-    (float)2.44675e-07,
-    (float)1.32896e-07,
-    (float)1.10723e-07,
-    (float)4.40944e-08,
-    (float)3.55056e-07,
-    (float)9.50901e-08,
-    (float)7.12418e-08,
-    (float)3.50299e-08,
-    (float)2.60213e-07,
-    (float)4.22197e-08,
-    (float)3.96873e-08,
-    (float)5.59155e-08,
-    (float)1.1119e-07,
-    (float)5.67997e-08,
-    (float)4.52312e-08,
-    (float)2.2689e-08,
-    (float)4.95062e-08,
-    (float)5.14455e-08,
-    (float)7.14529e-08,
-    (float)3.88217e-08,
-    (float)3.48689e-08,
-    (float)1.94854e-08,
-    (float)8.02311e-08,
-    (float)4.58825e-08,
-    (float)1.93399e-08,
-    (float)1.86294e-08,
-    (float)5.39784e-08,
-    (float)3.13412e-08,
-    (float)1.3499e-08,
-    (float)1.51613e-08,
-    (float)3.3627e-08,
-    (float)3.84206e-08,
-    (float)1.54429e-08,
-    (float)1.76715e-08,
-    (float)2.81328e-08,
-    (float)3.32965e-08,
-    (float)2.10232e-08,
-    (float)8.00238e-09,
-    (float)1.10008e-08,
-    (float)1.49944e-08,
-    (float)2.37822e-08,
-    (float)2.90354e-08,
-    (float)5.44148e-09,
-    (float)1.30035e-08,
-    (float)1.87138e-08,
-    (float)2.79068e-08,
-    (float)1.03269e-08,
-    (float)2.59404e-08,
-    (float)1.76614e-08,
-    (float)8.79553e-09,
-    (float)1.02913e-08,
-    (float)1.41302e-08,
-    (float)1.34486e-08,
-    (float)9.54973e-09,
-    (float)8.36251e-09,
-    (float)1.53488e-09,
-    (float)3.89188e-09,
-    (float)2.79199e-08,
-    (float)6.94946e-09,
-    (float)9.9837e-09,
-    (float)6.41377e-09,
-    (float)1.62965e-08,
-    (float)7.42754e-09,
-    (float)2.02523e-08,
-    (float)1.19198e-08,
-    (float)1.39105e-08,
-    (float)1.36257e-08,
-    (float)3.69537e-09,
-    (float)5.96691e-09,
-    (float)8.98205e-09,
-    (float)1.09694e-08,
-    (float)8.75596e-09,
-    (float)4.23752e-09,
-    (float)2.12933e-09,
-    (float)2.43137e-09,
-    (float)1.80094e-08,
-    (float)4.88435e-09,
-    (float)9.36435e-09,
-    (float)6.53166e-09,
-    (float)1.2497e-08,
-    (float)9.55781e-09,
-    (float)9.74197e-09,
-    (float)9.92025e-09,
-    (float)7.97333e-09,
-    (float)1.58102e-08,
-    (float)6.51896e-09,
-    (float)1.24744e-08,
-    (float)2.93207e-09,
-    (float)7.29173e-09,
-    (float)9.38575e-09,
-    (float)4.78904e-09,
-    (float)6.3756e-09,
-    (float)2.03639e-09,
-    (float)8.33978e-09,
-    (float)5.51137e-09,
-    (float)7.87024e-09,
-    (float)1.16207e-08,
-    (float)7.28327e-09,
-    (float)1.1361e-08,
-    (float)7.41871e-09,
-    (float)1.7072e-08,
-    (float)0.999006,
-    (float)0.000181014,
-    (float)0.000471257,
-    (float)1.41128e-05,
-    (float)0.000199559,
-    (float)4.71415e-06,
-    (float)5.30457e-05,
-    (float)2.10553e-06,
-    (float)3.19851e-05,
-    (float)1.36442e-06,
-    (float)1.78068e-05,
-    (float)4.22518e-07,
-    (float)3.70381e-06,
-    (float)1.1416e-06,
-    (float)5.87152e-06,
-    (float)9.25013e-08,
-    (float)1.03596e-07,
-    (float)8.64351e-07,
-    (float)1.17536e-06,
-    (float)6.6053e-08,
-    (float)1.85605e-07,
-    (float)5.53896e-07,
-    (float)8.04752e-08,
-    (float)7.47082e-08,
-    (float)8.70588e-08,
-    (float)2.88487e-07,
-    (float)4.6815e-08,
-    (float)8.77963e-08,
-    (float)5.075e-08,
-    (float)1.35376e-07,
-    (float)2.54724e-08,
-    (float)1.40136e-07,
-    (float)1.55967e-07,
-    (float)7.07504e-08,
-    (float)9.07113e-09,
-    (float)1.59791e-07,
-    (float)1.42223e-07,
-    (float)4.18806e-08,
-    (float)4.19038e-08,
-    (float)1.19605e-07,
-    (float)4.3914e-08,
-    (float)2.86154e-08,
-    (float)3.33156e-08,
-    (float)6.25559e-08,
-    (float)8.27192e-09,
-    (float)3.8956e-08,
-    (float)2.30468e-08,
-    (float)4.02631e-08,
-    (float)1.07809e-08,
-    (float)4.32835e-08,
-    (float)2.15356e-08,
-    (float)3.98202e-08,
-    (float)6.85543e-09,
-    (float)2.37949e-08,
-    (float)7.25995e-09,
-    (float)4.06267e-08,
-    (float)2.82849e-08,
-    (float)9.94674e-09,
-    (float)7.905e-09,
-    (float)3.21878e-08,
-    (float)3.22023e-08,
-    (float)1.39476e-08,
-    (float)7.21892e-09,
-    (float)1.19329e-08,
-    (float)1.18244e-08,
-    (float)2.74376e-08,
-    (float)1.64269e-08,
-    (float)4.45385e-09,
-    (float)9.17338e-09,
-    (float)2.7401e-08,
-    (float)9.72424e-09,
-    (float)5.69061e-09,
-    (float)1.80662e-08,
-    (float)1.79737e-08,
-    (float)6.77712e-09,
-    (float)6.89791e-09,
-    (float)1.21982e-08,
-    (float)1.40585e-08,
-    (float)8.09176e-09,
-    (float)6.68144e-09,
-    (float)8.94039e-09,
-    (float)1.10123e-08,
-    (float)7.06358e-09,
-    (float)1.20763e-08,
-    (float)6.09504e-09,
-    (float)3.69208e-09,
-    (float)4.99875e-09,
-    (float)1.50861e-08,
-    (float)7.24734e-09,
-    (float)2.56453e-09,
-    (float)1.63264e-08,
-    (float)9.49209e-09,
-    (float)4.86587e-09,
-    (float)4.83503e-09,
-    (float)1.86036e-08,
-    (float)6.25996e-09,
-    (float)8.83968e-09,
-    (float)7.20407e-09,
-    (float)1.15492e-08,
-    (float)4.48375e-09,
-    (float)4.58219e-09,
-    (float)9.35479e-09,
-    (float)6.06394e-09,
-    (float)4.53296e-09,
-    (float)5.3555e-09,
-    (float)8.43794e-09,
-    (float)1.88167e-09,
-    (float)6.67538e-09,
-    (float)1.10632e-08,
-    (float)4.58206e-09,
-    (float)6.44105e-09,
-    (float)5.94346e-09,
-    (float)9.24108e-09,
-    (float)2.93116e-09,
-    (float)9.93639e-09,
-    (float)5.32759e-09,
-    (float)1.28472e-08,
-    (float)3.51423e-09,
-    (float)1.47708e-08,
-    (float)4.73746e-09,
-    (float)1.20667e-08,
-    (float)4.61376e-09,
-    (float)5.42173e-09,
-    (float)4.43298e-09,
-    (float)5.9151e-09,
-    (float)6.29999e-09,
-    (float)4.86609e-09,
-    (float)4.81719e-09,
-    (float)0.999947,
-    (float)1.10948e-05,
-    (float)2.04515e-05,
-    (float)1.60009e-06,
-    (float)1.73474e-06,
-    (float)1.01403e-06,
-    (float)6.18327e-06,
-    (float)4.27207e-07,
-    (float)1.25531e-06,
-    (float)5.51526e-07,
-    (float)2.30396e-06,
-    (float)3.62752e-07,
-    (float)7.61411e-07,
-    (float)3.88397e-07,
-    (float)8.09853e-07,
-    (float)3.51123e-07,
-    (float)4.87556e-07,
-    (float)2.48269e-07,
-    (float)2.46945e-07,
-    (float)2.37158e-07,
-    (float)2.88472e-07,
-    (float)1.18002e-07,
-    (float)4.91376e-08,
-    (float)8.30209e-08,
-    (float)1.14755e-07,
-    (float)7.0279e-08,
-    (float)1.83437e-08,
-    (float)4.7095e-09,
-    (float)2.43721e-08,
-    (float)1.28114e-07,
-    (float)6.3342e-08,
-    (float)7.08155e-09,
-    (float)1.89336e-09,
-    (float)1.66279e-07,
-    (float)8.91336e-08,
-    (float)1.18547e-08,
-    (float)5.78677e-11,
-    (float)1.12256e-07,
-    (float)5.18706e-08,
-    (float)6.93689e-11,
-    (float)8.54581e-09,
-    (float)2.77818e-08,
-    (float)9.61884e-09,
-    (float)2.15787e-08,
-    (float)3.62648e-08,
-    (float)5.28279e-09,
-    (float)4.88238e-10,
-    (float)4.33706e-08,
-    (float)3.53054e-08,
-    (float)1.24869e-08,
-    (float)3.74045e-09,
-    (float)2.19751e-08,
-    (float)9.50672e-09,
-    (float)2.03933e-08,
-    (float)2.28934e-08,
-    (float)3.42655e-09,
-    (float)3.49665e-09,
-    (float)1.99084e-08,
-    (float)2.67511e-08,
-    (float)4.72286e-09,
-    (float)2.43867e-09,
-    (float)5.57231e-09,
-    (float)1.17311e-08,
-    (float)1.64031e-08,
-    (float)6.43549e-09,
-    (float)9.24233e-10,
-    (float)1.08617e-08,
-    (float)1.77336e-08,
-    (float)2.57926e-09,
-    (float)2.27025e-09,
-    (float)1.35472e-08,
-    (float)1.39039e-08,
-    (float)2.54937e-09,
-    (float)3.55787e-09,
-    (float)8.84255e-09,
-    (float)6.28831e-09,
-    (float)5.53125e-09,
-    (float)9.99839e-09,
-    (float)8.62487e-09,
-    (float)2.41361e-09,
-    (float)5.21687e-09,
-    (float)1.01015e-08,
-    (float)4.94321e-09,
-    (float)2.91527e-09,
-    (float)5.99785e-09,
-    (float)6.983e-09,
-    (float)4.90114e-09,
-    (float)3.68765e-09,
-    (float)7.02709e-09,
-    (float)4.12859e-09,
-    (float)5.019e-09,
-    (float)9.02942e-09,
-    (float)7.59818e-09,
-    (float)4.71396e-10,
-    (float)1.66285e-09,
-    (float)1.09173e-08,
-    (float)6.64582e-09,
-    (float)3.02938e-09,
-    (float)3.97208e-09,
-    (float)2.98904e-09,
-    (float)5.58985e-09,
-    (float)4.86283e-09,
-    (float)1.94364e-09,
-    (float)4.56141e-09,
-    (float)7.00618e-09,
-    (float)3.83988e-09,
-    (float)4.91817e-09,
-    (float)3.61444e-09,
-    (float)2.6914e-09,
-    (float)3.02442e-09,
-    (float)3.13832e-09,
-    (float)5.92451e-09,
-    (float)4.77086e-09,
-    (float)3.18563e-09,
-    (float)5.51525e-09,
-    (float)4.16974e-09,
-    (float)1.91537e-09,
-    (float)2.98125e-09,
-    (float)3.00349e-09,
-    (float)4.83965e-09,
-    (float)3.71894e-09,
-    (float)5.0688e-09,
-    (float)6.68309e-09,
-    (float)1.85816e-09,
-    (float)3.81907e-09,
-    (float)7.50436e-09,
-    (float)2.31051e-09,
-    (float)1.19396e-09,
-    (float)0.999947,
-    (float)1.10948e-05,
-    (float)2.04515e-05,
-    (float)1.60009e-06,
-    (float)1.73474e-06,
-    (float)1.01403e-06,
-    (float)6.18327e-06,
-    (float)4.27207e-07,
-    (float)1.25531e-06,
-    (float)5.51526e-07,
-    (float)2.30396e-06,
-    (float)3.62752e-07,
-    (float)7.61411e-07,
-    (float)3.88397e-07,
-    (float)8.09853e-07,
-    (float)3.51123e-07,
-    (float)4.87556e-07,
-    (float)2.48269e-07,
-    (float)2.46945e-07,
-    (float)2.37158e-07,
-    (float)2.88472e-07,
-    (float)1.18002e-07,
-    (float)4.91376e-08,
-    (float)8.30209e-08,
-    (float)1.14755e-07,
-    (float)7.0279e-08,
-    (float)1.83437e-08,
-    (float)4.7095e-09,
-    (float)2.43721e-08,
-    (float)1.28114e-07,
-    (float)6.3342e-08,
-    (float)7.08155e-09,
-    (float)1.89336e-09,
-    (float)1.66279e-07,
-    (float)8.91336e-08,
-    (float)1.18547e-08,
-    (float)5.78677e-11,
-    (float)1.12256e-07,
-    (float)5.18706e-08,
-    (float)6.93689e-11,
-    (float)8.54581e-09,
-    (float)2.77818e-08,
-    (float)9.61884e-09,
-    (float)2.15787e-08,
-    (float)3.62648e-08,
-    (float)5.28279e-09,
-    (float)4.88238e-10,
-    (float)4.33706e-08,
-    (float)3.53054e-08,
-    (float)1.24869e-08,
-    (float)3.74045e-09,
-    (float)2.19751e-08,
-    (float)9.50672e-09,
-    (float)2.03933e-08,
-    (float)2.28934e-08,
-    (float)3.42655e-09,
-    (float)3.49665e-09,
-    (float)1.99084e-08,
-    (float)2.67511e-08,
-    (float)4.72286e-09,
-    (float)2.43867e-09,
-    (float)5.57231e-09,
-    (float)1.17311e-08,
-    (float)1.64031e-08,
-    (float)6.43549e-09,
-    (float)9.24233e-10,
-    (float)1.08617e-08,
-    (float)1.77336e-08,
-    (float)2.57926e-09,
-    (float)2.27025e-09,
-    (float)1.35472e-08,
-    (float)1.39039e-08,
-    (float)2.54937e-09,
-    (float)3.55787e-09,
-    (float)8.84255e-09,
-    (float)6.28831e-09,
-    (float)5.53125e-09,
-    (float)9.99839e-09,
-    (float)8.62487e-09,
-    (float)2.41361e-09,
-    (float)5.21687e-09,
-    (float)1.01015e-08,
-    (float)4.94321e-09,
-    (float)2.91527e-09,
-    (float)5.99785e-09,
-    (float)6.983e-09,
-    (float)4.90114e-09,
-    (float)3.68765e-09,
-    (float)7.02709e-09,
-    (float)4.12859e-09,
-    (float)5.019e-09,
-    (float)9.02942e-09,
-    (float)7.59818e-09,
-    (float)4.71396e-10,
-    (float)1.66285e-09,
-    (float)1.09173e-08,
-    (float)6.64582e-09,
-    (float)3.02938e-09,
-    (float)3.97208e-09,
-    (float)2.98904e-09,
-    (float)5.58985e-09,
-    (float)4.86283e-09,
-    (float)1.94364e-09,
-    (float)4.56141e-09,
-    (float)7.00618e-09,
-    (float)3.83988e-09,
-    (float)4.91817e-09,
-    (float)3.61444e-09,
-    (float)2.6914e-09,
-    (float)3.02442e-09,
-    (float)3.13832e-09,
-    (float)5.92451e-09,
-    (float)4.77086e-09,
-    (float)3.18563e-09,
-    (float)5.51525e-09,
-    (float)4.16974e-09,
-    (float)1.91537e-09,
-    (float)2.98125e-09,
-    (float)3.00349e-09,
-    (float)4.83965e-09,
-    (float)3.71894e-09,
-    (float)5.0688e-09,
-    (float)6.68309e-09,
-    (float)1.85816e-09,
-    (float)3.81907e-09,
-    (float)7.50436e-09,
-    (float)2.31051e-09,
-    (float)1.19396e-09,
-    (float)0.999677,
-    (float)3.37336e-05,
-    (float)6.36161e-05,
-    (float)0.00011079,
-    (float)3.82638e-05,
-    (float)1.18979e-05,
-    (float)1.07342e-06,
-    (float)1.56448e-05,
-    (float)1.8473e-05,
-    (float)3.98058e-06,
-    (float)8.93222e-06,
-    (float)7.09011e-07,
-    (float)3.35119e-06,
-    (float)5.48862e-07,
-    (float)2.26987e-06,
-    (float)1.73268e-06,
-    (float)5.47175e-07,
-    (float)1.46254e-06,
-    (float)1.40965e-06,
-    (float)2.53107e-07,
-    (float)3.02724e-08,
-    (float)3.38072e-07,
-    (float)8.76973e-07,
-    (float)1.42493e-07,
-    (float)6.1421e-08,
-    (float)2.45334e-07,
-    (float)2.51089e-07,
-    (float)5.70172e-08,
-    (float)1.99346e-07,
-    (float)7.67473e-08,
-    (float)8.53392e-08,
-    (float)1.48069e-07,
-    (float)3.66297e-08,
-    (float)1.29792e-07,
-    (float)1.32103e-07,
-    (float)5.31299e-09,
-    (float)1.57429e-07,
-    (float)5.07856e-09,
-    (float)1.44622e-07,
-    (float)2.30539e-08,
-    (float)1.24256e-08,
-    (float)2.11348e-08,
-    (float)1.34247e-08,
-    (float)3.80678e-08,
-    (float)1.18373e-08,
-    (float)3.52042e-09,
-    (float)3.98567e-08,
-    (float)2.05735e-08,
-    (float)3.87466e-08,
-    (float)1.10237e-08,
-    (float)1.60469e-08,
-    (float)3.15529e-08,
-    (float)7.91935e-08,
-    (float)9.87632e-09,
-    (float)1.63177e-09,
-    (float)4.59517e-08,
-    (float)2.69881e-08,
-    (float)1.78025e-08,
-    (float)8.72713e-09,
-    (float)3.06384e-08,
-    (float)3.23321e-08,
-    (float)9.62807e-09,
-    (float)2.21624e-08,
-    (float)8.12615e-09,
-    (float)1.22311e-08,
-    (float)2.26861e-08,
-    (float)1.10644e-08,
-    (float)8.73962e-09,
-    (float)6.3655e-09,
-    (float)1.62575e-08,
-    (float)1.85483e-08,
-    (float)7.7921e-09,
-    (float)2.36538e-09,
-    (float)2.71263e-09,
-    (float)2.00528e-08,
-    (float)6.85833e-09,
-    (float)6.37562e-09,
-    (float)1.29148e-08,
-    (float)2.47941e-09,
-    (float)6.38019e-09,
-    (float)1.0741e-08,
-    (float)2.32171e-08,
-    (float)4.46918e-09,
-    (float)1.70774e-09,
-    (float)1.74707e-08,
-    (float)9.78256e-09,
-    (float)1.2548e-08,
-    (float)8.94658e-09,
-    (float)1.17808e-08,
-    (float)8.60749e-09,
-    (float)9.88508e-09,
-    (float)9.3389e-09,
-    (float)2.01062e-09,
-    (float)1.27302e-08,
-    (float)1.33553e-08,
-    (float)1.04516e-08,
-    (float)6.60273e-09,
-    (float)1.76887e-09,
-    (float)1.23059e-08,
-    (float)7.67149e-09,
-    (float)8.14123e-09,
-    (float)7.13115e-09,
-    (float)1.56816e-09,
-    (float)8.31858e-09,
-    (float)5.13026e-09,
-    (float)2.87292e-09,
-    (float)1.93894e-09,
-    (float)6.35858e-09,
-    (float)1.28393e-08,
-    (float)3.06552e-09,
-    (float)2.89145e-09,
-    (float)4.96557e-09,
-    (float)3.35478e-09,
-    (float)1.9927e-09,
-    (float)4.68718e-09,
-    (float)6.09825e-09,
-    (float)3.95026e-09,
-    (float)8.39003e-09,
-    (float)6.64154e-09,
-    (float)5.7492e-09,
-    (float)2.8271e-09,
-    (float)6.93425e-09,
-    (float)1.79206e-08,
-    (float)2.73646e-09,
-    (float)5.88119e-09,
-    (float)1.20128e-08,
-    (float)4.58282e-09,
-    (float)1.05736e-08,
-    (float)0.998725,
-    (float)7.12091e-05,
-    (float)0.000253331,
-    (float)0.000539378,
-    (float)0.000160071,
-    (float)5.64203e-05,
-    (float)2.51797e-05,
-    (float)5.47196e-05,
-    (float)5.04315e-05,
-    (float)7.71678e-06,
-    (float)2.39792e-05,
-    (float)1.82943e-06,
-    (float)9.79579e-06,
-    (float)2.75938e-06,
-    (float)3.34405e-06,
-    (float)4.35862e-06,
-    (float)3.19704e-07,
-    (float)1.37541e-06,
-    (float)1.68746e-06,
-    (float)1.65519e-06,
-    (float)4.23778e-08,
-    (float)2.44232e-07,
-    (float)1.26465e-06,
-    (float)4.58072e-07,
-    (float)9.34222e-08,
-    (float)6.6861e-08,
-    (float)3.68108e-07,
-    (float)3.39775e-07,
-    (float)1.11209e-07,
-    (float)8.85479e-08,
-    (float)4.43299e-09,
-    (float)6.38597e-08,
-    (float)1.61144e-07,
-    (float)2.47338e-08,
-    (float)1.75891e-10,
-    (float)1.2924e-10,
-    (float)1.22917e-07,
-    (float)2.07169e-07,
-    (float)2.65093e-08,
-    (float)1.85676e-08,
-    (float)1.65348e-07,
-    (float)1.2154e-07,
-    (float)3.62474e-09,
-    (float)1.02902e-07,
-    (float)2.11244e-08,
-    (float)4.57341e-08,
-    (float)7.78418e-08,
-    (float)2.13299e-08,
-    (float)9.55417e-08,
-    (float)3.33293e-11,
-    (float)2.38054e-08,
-    (float)6.30887e-08,
-    (float)2.20695e-08,
-    (float)2.41953e-08,
-    (float)3.73306e-09,
-    (float)4.05505e-08,
-    (float)1.0812e-08,
-    (float)1.13175e-08,
-    (float)4.25965e-08,
-    (float)9.2857e-10,
-    (float)1.13259e-08,
-    (float)1.40386e-08,
-    (float)3.23162e-08,
-    (float)2.39369e-08,
-    (float)1.00257e-09,
-    (float)2.9522e-08,
-    (float)1.1959e-08,
-    (float)2.51471e-08,
-    (float)4.28521e-08,
-    (float)2.42229e-09,
-    (float)1.86678e-08,
-    (float)3.31979e-08,
-    (float)1.11189e-08,
-    (float)2.44404e-08,
-    (float)2.81171e-08,
-    (float)7.46108e-09,
-    (float)1.2915e-08,
-    (float)9.47e-09,
-    (float)8.45883e-09,
-    (float)2.39747e-08,
-    (float)3.44251e-09,
-    (float)9.94197e-09,
-    (float)8.815e-10,
-    (float)8.45645e-10,
-    (float)2.12771e-08,
-    (float)3.85673e-09,
-    (float)3.2671e-09,
-    (float)4.28775e-09,
-    (float)5.78016e-09,
-    (float)9.67905e-09,
-    (float)3.95473e-09,
-    (float)1.11489e-08,
-    (float)5.64128e-09,
-    (float)1.0575e-08,
-    (float)9.09381e-09,
-    (float)1.84051e-09,
-    (float)1.37203e-08,
-    (float)1.13647e-08,
-    (float)1.30124e-08,
-    (float)1.55058e-08,
-    (float)5.19061e-09,
-    (float)7.87782e-09,
-    (float)9.54552e-09,
-    (float)1.46777e-08,
-    (float)1.01286e-08,
-    (float)6.52466e-09,
-    (float)9.16811e-09,
-    (float)7.1043e-09,
-    (float)4.18906e-09,
-    (float)5.15764e-09,
-    (float)3.60944e-09,
-    (float)3.26174e-09,
-    (float)8.97932e-09,
-    (float)1.43396e-09,
-    (float)3.67188e-09,
-    (float)5.26449e-09,
-    (float)1.52662e-09,
-    (float)6.34e-09,
-    (float)5.74617e-09,
-    (float)5.83835e-09,
-    (float)6.52647e-09,
-    (float)4.82545e-09,
-    (float)9.34124e-09,
-    (float)3.63884e-09,
-    (float)8.51044e-09,
-    (float)1.15689e-08,
-    (float)7.84687e-09,
-    (float)9.77124e-09,
-    (float)0.997082,
-    (float)0.000118116,
-    (float)0.000614213,
-    (float)0.00136125,
-    (float)0.000341407,
-    (float)0.00012494,
-    (float)9.15574e-05,
-    (float)9.15181e-05,
-    (float)8.72914e-05,
-    (float)1.03008e-05,
-    (float)3.58553e-05,
-    (float)4.50403e-06,
-    (float)1.1369e-05,
-    (float)5.01752e-06,
-    (float)5.40418e-06,
-    (float)2.49883e-06,
-    (float)9.4679e-07,
-    (float)7.21165e-07,
-    (float)2.84467e-07,
-    (float)4.70952e-06,
-    (float)1.34528e-07,
-    (float)3.18255e-08,
-    (float)1.33377e-06,
-    (float)3.06271e-07,
-    (float)2.37721e-07,
-    (float)2.02957e-07,
-    (float)6.12605e-08,
-    (float)4.18594e-07,
-    (float)7.67138e-08,
-    (float)2.15046e-07,
-    (float)1.94424e-08,
-    (float)1.8929e-07,
-    (float)1.10647e-07,
-    (float)1.04287e-07,
-    (float)3.2691e-07,
-    (float)9.12343e-09,
-    (float)1.77562e-07,
-    (float)3.2281e-07,
-    (float)1.43573e-07,
-    (float)1.58206e-07,
-    (float)3.67069e-09,
-    (float)2.4436e-07,
-    (float)4.13297e-08,
-    (float)9.54033e-10,
-    (float)2.06263e-08,
-    (float)3.13016e-08,
-    (float)4.16565e-08,
-    (float)2.28099e-08,
-    (float)7.19238e-09,
-    (float)4.38279e-08,
-    (float)1.14137e-08,
-    (float)8.50788e-08,
-    (float)3.46092e-08,
-    (float)3.00076e-08,
-    (float)7.21731e-08,
-    (float)5.60206e-08,
-    (float)9.04102e-08,
-    (float)6.52169e-09,
-    (float)1.5455e-08,
-    (float)6.04773e-08,
-    (float)5.0895e-08,
-    (float)2.75129e-08,
-    (float)4.40194e-08,
-    (float)1.22822e-08,
-    (float)2.59362e-08,
-    (float)3.51762e-08,
-    (float)1.06628e-09,
-    (float)2.27158e-08,
-    (float)7.63345e-09,
-    (float)1.99192e-10,
-    (float)2.77546e-08,
-    (float)1.69172e-08,
-    (float)2.42579e-09,
-    (float)5.90683e-09,
-    (float)2.19984e-08,
-    (float)1.30586e-08,
-    (float)1.41819e-08,
-    (float)2.47508e-08,
-    (float)1.60047e-08,
-    (float)2.33212e-08,
-    (float)1.76779e-08,
-    (float)4.96227e-09,
-    (float)4.49716e-08,
-    (float)8.96474e-09,
-    (float)1.92045e-08,
-    (float)9.34463e-09,
-    (float)4.94272e-09,
-    (float)2.3379e-08,
-    (float)4.97196e-09,
-    (float)1.5149e-08,
-    (float)5.25678e-09,
-    (float)1.14674e-09,
-    (float)6.70534e-09,
-    (float)3.09323e-09,
-    (float)8.0561e-09,
-    (float)1.17556e-09,
-    (float)4.97968e-09,
-    (float)1.43533e-08,
-    (float)7.55905e-10,
-    (float)4.54938e-09,
-    (float)6.18574e-09,
-    (float)1.63488e-08,
-    (float)2.07427e-08,
-    (float)2.83235e-09,
-    (float)1.28951e-08,
-    (float)7.25341e-09,
-    (float)1.23097e-08,
-    (float)1.35487e-08,
-    (float)9.23517e-09,
-    (float)8.96894e-09,
-    (float)5.63449e-09,
-    (float)1.28966e-08,
-    (float)4.77384e-09,
-    (float)1.64771e-09,
-    (float)3.49481e-09,
-    (float)6.86161e-09,
-    (float)9.69801e-09,
-    (float)3.34154e-09,
-    (float)3.86117e-10,
-    (float)6.47634e-09,
-    (float)5.2591e-09,
-    (float)7.18051e-09,
-    (float)5.57508e-09,
-    (float)8.59149e-09,
-    (float)1.33459e-08,
-    (float)8.00448e-09,
-    (float)7.49891e-09,
-    (float)7.84893e-09,
-    (float)0.994738,
-    (float)0.000169529,
-    (float)0.00117394,
-    (float)0.00263896,
-    (float)0.000552659,
-    (float)0.000204747,
-    (float)0.000203564,
-    (float)0.000102272,
-    (float)0.000118113,
-    (float)1.40736e-05,
-    (float)3.49588e-05,
-    (float)9.76848e-06,
-    (float)9.08511e-06,
-    (float)4.35661e-06,
-    (float)9.06652e-06,
-    (float)1.15447e-07,
-    (float)8.90071e-07,
-    (float)6.72305e-07,
-    (float)1.12796e-06,
-    (float)5.49281e-06,
-    (float)6.10386e-07,
-    (float)4.65863e-07,
-    (float)5.72761e-07,
-    (float)1.06013e-07,
-    (float)1.79796e-07,
-    (float)8.29178e-07,
-    (float)4.1329e-07,
-    (float)2.32943e-08,
-    (float)2.48759e-07,
-    (float)8.71004e-07,
-    (float)2.06771e-07,
-    (float)5.3412e-07,
-    (float)1.97028e-07,
-    (float)2.6956e-08,
-    (float)3.97554e-07,
-    (float)4.82881e-08,
-    (float)4.41438e-08,
-    (float)5.23038e-08,
-    (float)5.65e-08,
-    (float)8.75627e-09,
-    (float)1.54837e-07,
-    (float)1.48055e-07,
-    (float)7.54508e-08,
-    (float)9.17202e-08,
-    (float)2.00905e-07,
-    (float)1.04998e-08,
-    (float)1.36589e-07,
-    (float)3.33381e-08,
-    (float)5.89151e-08,
-    (float)7.47065e-08,
-    (float)4.50929e-08,
-    (float)1.38339e-07,
-    (float)6.34105e-09,
-    (float)4.80318e-08,
-    (float)8.58054e-10,
-    (float)6.83649e-08,
-    (float)3.56597e-08,
-    (float)4.1838e-08,
-    (float)5.73923e-08,
-    (float)2.05303e-08,
-    (float)2.82587e-09,
-    (float)2.62274e-08,
-    (float)1.38019e-08,
-    (float)3.24529e-08,
-    (float)1.1318e-08,
-    (float)4.4924e-08,
-    (float)3.57742e-08,
-    (float)2.58237e-08,
-    (float)5.64742e-08,
-    (float)5.77935e-09,
-    (float)4.95496e-08,
-    (float)1.91387e-08,
-    (float)1.958e-08,
-    (float)4.48343e-08,
-    (float)1.13004e-09,
-    (float)1.52081e-08,
-    (float)5.2272e-09,
-    (float)1.07235e-08,
-    (float)8.82669e-09,
-    (float)7.20726e-10,
-    (float)9.86946e-09,
-    (float)2.82692e-09,
-    (float)1.55802e-08,
-    (float)1.01424e-08,
-    (float)1.02502e-09,
-    (float)3.2339e-08,
-    (float)6.85122e-09,
-    (float)1.96752e-08,
-    (float)1.02818e-08,
-    (float)6.91812e-09,
-    (float)1.36724e-08,
-    (float)1.0353e-08,
-    (float)2.11987e-08,
-    (float)9.60847e-09,
-    (float)7.48088e-09,
-    (float)4.23577e-09,
-    (float)3.81574e-09,
-    (float)1.34371e-08,
-    (float)5.59682e-10,
-    (float)2.24128e-09,
-    (float)7.7913e-09,
-    (float)3.19961e-09,
-    (float)3.97176e-09,
-    (float)2.91144e-09,
-    (float)1.04105e-08,
-    (float)9.49719e-09,
-    (float)1.51426e-08,
-    (float)1.38397e-08,
-    (float)7.22504e-09,
-    (float)1.22626e-08,
-    (float)9.78898e-09,
-    (float)9.23618e-09,
-    (float)8.684e-09,
-    (float)3.427e-09,
-    (float)3.25681e-09,
-    (float)4.20326e-09,
-    (float)4.38099e-09,
-    (float)3.47942e-09,
-    (float)1.98252e-09,
-    (float)5.73919e-09,
-    (float)4.17958e-09,
-    (float)6.95145e-09,
-    (float)5.26783e-09,
-    (float)5.59789e-09,
-    (float)1.10139e-08,
-    (float)7.03804e-09,
-    (float)9.44491e-09,
-    (float)1.37238e-08,
-    (float)0.991677,
-    (float)0.000220932,
-    (float)0.00195761,
-    (float)0.00442568,
-    (float)0.00076649,
-    (float)0.000281511,
-    (float)0.000352833,
-    (float)7.8452e-05,
-    (float)0.000134556,
-    (float)1.89947e-05,
-    (float)2.37604e-05,
-    (float)1.73172e-05,
-    (float)7.39908e-06,
-    (float)3.41367e-06,
-    (float)1.1486e-05,
-    (float)2.28508e-06,
-    (float)4.69815e-08,
-    (float)5.27463e-07,
-    (float)5.24551e-06,
-    (float)2.56383e-06,
-    (float)8.67599e-07,
-    (float)9.66577e-07,
-    (float)1.23287e-06,
-    (float)1.95061e-07,
-    (float)3.54417e-07,
-    (float)1.7802e-06,
-    (float)1.12791e-06,
-    (float)1.98258e-07,
-    (float)1.18547e-08,
-    (float)9.4607e-07,
-    (float)5.36469e-07,
-    (float)7.05408e-08,
-    (float)1.83276e-07,
-    (float)2.36621e-08,
-    (float)2.67023e-08,
-    (float)1.94789e-08,
-    (float)8.43886e-08,
-    (float)3.4867e-07,
-    (float)6.2416e-08,
-    (float)6.01536e-08,
-    (float)3.50518e-07,
-    (float)3.16763e-07,
-    (float)1.91997e-07,
-    (float)1.46756e-08,
-    (float)1.53092e-07,
-    (float)2.03822e-07,
-    (float)1.10322e-08,
-    (float)2.92012e-09,
-    (float)1.34783e-07,
-    (float)5.30336e-08,
-    (float)1.35797e-08,
-    (float)2.96144e-08,
-    (float)6.27597e-08,
-    (float)5.49712e-09,
-    (float)1.40917e-07,
-    (float)7.44659e-09,
-    (float)3.20841e-08,
-    (float)3.37831e-08,
-    (float)5.36441e-08,
-    (float)7.29491e-08,
-    (float)1.29989e-07,
-    (float)5.26345e-08,
-    (float)8.41345e-09,
-    (float)6.96629e-08,
-    (float)4.69822e-08,
-    (float)7.80912e-09,
-    (float)1.79363e-08,
-    (float)6.11824e-09,
-    (float)6.66609e-09,
-    (float)2.52501e-08,
-    (float)4.86989e-09,
-    (float)3.13327e-08,
-    (float)5.38204e-09,
-    (float)3.66654e-08,
-    (float)2.53503e-08,
-    (float)2.02998e-08,
-    (float)5.58454e-08,
-    (float)3.89195e-09,
-    (float)2.54145e-08,
-    (float)1.69654e-08,
-    (float)1.5771e-08,
-    (float)1.65524e-08,
-    (float)1.1534e-08,
-    (float)3.50117e-09,
-    (float)9.25905e-10,
-    (float)1.60015e-08,
-    (float)1.40694e-08,
-    (float)1.77704e-09,
-    (float)1.55467e-08,
-    (float)7.50421e-09,
-    (float)1.70877e-08,
-    (float)5.16205e-09,
-    (float)1.00632e-08,
-    (float)1.08384e-08,
-    (float)7.53794e-09,
-    (float)2.39994e-08,
-    (float)3.84421e-09,
-    (float)1.86083e-08,
-    (float)7.9506e-09,
-    (float)3.72788e-10,
-    (float)1.84006e-08,
-    (float)2.54338e-09,
-    (float)5.32768e-09,
-    (float)2.46577e-09,
-    (float)8.92862e-09,
-    (float)1.10916e-08,
-    (float)8.6843e-10,
-    (float)7.38183e-09,
-    (float)1.26851e-08,
-    (float)1.26315e-08,
-    (float)2.24186e-08,
-    (float)9.78657e-10,
-    (float)1.14102e-08,
-    (float)9.50161e-09,
-    (float)8.53627e-09,
-    (float)4.50114e-09,
-    (float)3.4317e-09,
-    (float)4.97369e-09,
-    (float)1.22527e-09,
-    (float)1.46452e-09,
-    (float)5.37974e-09,
-    (float)1.29157e-09,
-    (float)9.22426e-09,
-    (float)6.65855e-09,
-    (float)1.02875e-08,
-    (float)1.12334e-08,
-    (float)1.30391e-08,
-    (float)7.63352e-09,
-    (float)0.987893,
-    (float)0.000266641,
-    (float)0.0029924,
-    (float)0.00674744,
-    (float)0.000960983,
-    (float)0.000340507,
-    (float)0.000512408,
-    (float)3.39988e-05,
-    (float)0.000132518,
-    (float)2.06986e-05,
-    (float)1.82235e-05,
-    (float)2.46358e-05,
-    (float)6.76707e-06,
-    (float)8.63664e-06,
-    (float)8.86831e-06,
-    (float)6.87529e-06,
-    (float)1.40301e-06,
-    (float)4.19438e-07,
-    (float)6.8458e-06,
-    (float)5.96555e-07,
-    (float)7.63862e-07,
-    (float)2.56729e-07,
-    (float)5.9841e-06,
-    (float)7.81288e-08,
-    (float)3.5614e-07,
-    (float)2.3368e-06,
-    (float)4.18869e-07,
-    (float)1.94462e-07,
-    (float)6.12931e-08,
-    (float)1.33654e-07,
-    (float)1.43643e-07,
-    (float)3.21829e-08,
-    (float)9.06839e-07,
-    (float)1.91591e-07,
-    (float)5.09764e-07,
-    (float)2.70095e-07,
-    (float)1.96099e-08,
-    (float)5.5678e-07,
-    (float)2.09465e-08,
-    (float)6.05929e-08,
-    (float)7.42505e-08,
-    (float)1.76924e-07,
-    (float)1.05318e-07,
-    (float)7.78385e-08,
-    (float)3.3679e-07,
-    (float)1.00382e-07,
-    (float)7.17451e-08,
-    (float)1.43878e-07,
-    (float)6.45242e-08,
-    (float)3.61128e-08,
-    (float)1.48811e-08,
-    (float)1.46088e-07,
-    (float)1.40544e-08,
-    (float)8.34006e-08,
-    (float)1.61759e-07,
-    (float)1.68469e-09,
-    (float)1.44378e-07,
-    (float)1.88045e-08,
-    (float)1.5327e-08,
-    (float)3.44388e-08,
-    (float)5.02687e-09,
-    (float)1.17519e-09,
-    (float)2.25837e-08,
-    (float)1.08843e-07,
-    (float)2.16534e-08,
-    (float)2.53079e-09,
-    (float)7.91831e-08,
-    (float)5.33424e-08,
-    (float)3.47733e-08,
-    (float)2.92459e-08,
-    (float)3.6428e-08,
-    (float)8.33509e-09,
-    (float)2.04809e-08,
-    (float)1.8944e-08,
-    (float)9.06575e-09,
-    (float)8.65407e-09,
-    (float)1.9384e-08,
-    (float)5.90056e-09,
-    (float)1.41563e-08,
-    (float)4.3568e-08,
-    (float)1.02785e-09,
-    (float)2.13595e-08,
-    (float)2.63309e-08,
-    (float)2.62555e-08,
-    (float)7.32285e-09,
-    (float)1.94198e-08,
-    (float)1.47971e-08,
-    (float)6.03691e-09,
-    (float)6.79638e-09,
-    (float)8.23962e-09,
-    (float)8.34296e-10,
-    (float)6.80236e-09,
-    (float)8.47033e-10,
-    (float)2.19533e-08,
-    (float)8.47325e-10,
-    (float)2.37684e-08,
-    (float)6.8312e-09,
-    (float)7.01727e-09,
-    (float)2.28794e-08,
-    (float)5.94065e-09,
-    (float)1.13161e-08,
-    (float)7.23924e-09,
-    (float)5.38727e-10,
-    (float)1.7061e-09,
-    (float)4.28655e-09,
-    (float)1.86186e-08,
-    (float)1.95581e-09,
-    (float)4.80487e-09,
-    (float)1.20176e-08,
-    (float)4.29235e-09,
-    (float)5.0783e-09,
-    (float)5.08899e-09,
-    (float)1.42424e-08,
-    (float)1.06885e-08,
-    (float)8.15572e-09,
-    (float)8.77803e-09,
-    (float)1.38567e-09,
-    (float)1.32126e-08,
-    (float)4.26328e-09,
-    (float)3.52979e-09,
-    (float)1.33008e-09,
-    (float)1.92589e-09,
-    (float)3.4994e-09,
-    (float)2.85078e-09,
-    (float)6.10047e-09,
-    (float)1.49672e-08,
-    (float)3.49174e-09,
-    (float)1.96674e-08,
-    (float)0.983363,
-    (float)0.000305479,
-    (float)0.0042989,
-    (float)0.00961665,
-    (float)0.00112991,
-    (float)0.000369707,
-    (float)0.000650932,
-    (float)2.99403e-06,
-    (float)0.000111843,
-    (float)1.51902e-05,
-    (float)3.52636e-05,
-    (float)2.95862e-05,
-    (float)4.80514e-06,
-    (float)2.01335e-05,
-    (float)2.93823e-06,
-    (float)9.32165e-06,
-    (float)4.42339e-06,
-    (float)4.4981e-06,
-    (float)3.63255e-06,
-    (float)1.06008e-06,
-    (float)1.55734e-06,
-    (float)1.17776e-06,
-    (float)8.09035e-06,
-    (float)4.86537e-07,
-    (float)1.21798e-07,
-    (float)4.65491e-07,
-    (float)1.36761e-08,
-    (float)8.98524e-08,
-    (float)7.11803e-07,
-    (float)9.2284e-07,
-    (float)8.72598e-08,
-    (float)3.54607e-08,
-    (float)1.75408e-06,
-    (float)4.30473e-07,
-    (float)2.36958e-07,
-    (float)1.52907e-07,
-    (float)2.1126e-07,
-    (float)8.6921e-11,
-    (float)4.03668e-09,
-    (float)2.19843e-07,
-    (float)3.21584e-07,
-    (float)4.46144e-08,
-    (float)4.6001e-09,
-    (float)2.08861e-07,
-    (float)1.42319e-07,
-    (float)3.78805e-07,
-    (float)3.31025e-08,
-    (float)1.56676e-07,
-    (float)1.90171e-07,
-    (float)1.89205e-07,
-    (float)3.71091e-08,
-    (float)6.36342e-08,
-    (float)3.89224e-08,
-    (float)5.47366e-09,
-    (float)1.67258e-08,
-    (float)6.84682e-09,
-    (float)1.00488e-08,
-    (float)1.44865e-07,
-    (float)2.76221e-09,
-    (float)1.82468e-07,
-    (float)8.49756e-11,
-    (float)3.48736e-08,
-    (float)6.87712e-08,
-    (float)2.86989e-08,
-    (float)2.79407e-08,
-    (float)9.2878e-09,
-    (float)7.59305e-08,
-    (float)1.10611e-08,
-    (float)5.71276e-09,
-    (float)3.9388e-08,
-    (float)2.64679e-08,
-    (float)3.07922e-08,
-    (float)2.11054e-08,
-    (float)4.28313e-08,
-    (float)1.09549e-08,
-    (float)1.96823e-08,
-    (float)3.76071e-08,
-    (float)5.33175e-09,
-    (float)1.93847e-08,
-    (float)1.19277e-08,
-    (float)3.59754e-09,
-    (float)1.25121e-09,
-    (float)2.73031e-08,
-    (float)1.10265e-08,
-    (float)2.61191e-08,
-    (float)9.73917e-09,
-    (float)2.17571e-08,
-    (float)1.07486e-08,
-    (float)8.84528e-09,
-    (float)2.01843e-08,
-    (float)5.99051e-09,
-    (float)1.87831e-09,
-    (float)1.1622e-09,
-    (float)7.06129e-09,
-    (float)5.11658e-09,
-    (float)1.15298e-09,
-    (float)1.58745e-08,
-    (float)4.12325e-09,
-    (float)1.50248e-08,
-    (float)4.20002e-09,
-    (float)5.66913e-09,
-    (float)1.47482e-08,
-    (float)6.34566e-09,
-    (float)1.60775e-08,
-    (float)2.00386e-09,
-    (float)6.49689e-09,
-    (float)2.16158e-09,
-    (float)2.17525e-09,
-    (float)2.35518e-09,
-    (float)1.71751e-09,
-    (float)1.17744e-08,
-    (float)3.99462e-09,
-    (float)6.66726e-09,
-    (float)9.83159e-09,
-    (float)5.67719e-09,
-    (float)4.9197e-09,
-    (float)7.33135e-09,
-    (float)9.3321e-09,
-    (float)2.70896e-09,
-    (float)4.08434e-09,
-    (float)5.10639e-10,
-    (float)1.04466e-09,
-    (float)5.43406e-09,
-    (float)7.83606e-09,
-    (float)4.34908e-09,
-    (float)4.56364e-09,
-    (float)7.66214e-09,
-    (float)2.74774e-09,
-    (float)0.978048,
-    (float)0.000332377,
-    (float)0.00590517,
-    (float)0.013031,
-    (float)0.00127649,
-    (float)0.000363965,
-    (float)0.000731255,
-    (float)2.85188e-05,
-    (float)8.1844e-05,
-    (float)5.22445e-06,
-    (float)7.59835e-05,
-    (float)3.32254e-05,
-    (float)2.35497e-06,
-    (float)2.72114e-05,
-    (float)2.19445e-06,
-    (float)1.05139e-05,
-    (float)4.52548e-06,
-    (float)1.45287e-05,
-    (float)3.10425e-07,
-    (float)5.14625e-07,
-    (float)2.32697e-06,
-    (float)5.00974e-06,
-    (float)3.9358e-06,
-    (float)5.71594e-07,
-    (float)1.41644e-07,
-    (float)1.44976e-06,
-    (float)7.70882e-08,
-    (float)6.73886e-07,
-    (float)2.5803e-06,
-    (float)7.06568e-07,
-    (float)4.8416e-07,
-    (float)6.45865e-08,
-    (float)3.87125e-07,
-    (float)2.53698e-07,
-    (float)1.62134e-07,
-    (float)9.83311e-07,
-    (float)3.79848e-07,
-    (float)2.61537e-07,
-    (float)2.89218e-07,
-    (float)5.31968e-09,
-    (float)2.36366e-07,
-    (float)3.72443e-08,
-    (float)2.59118e-07,
-    (float)4.87927e-08,
-    (float)2.38755e-07,
-    (float)2.82501e-07,
-    (float)1.61932e-07,
-    (float)1.63605e-07,
-    (float)1.55834e-07,
-    (float)6.65459e-08,
-    (float)4.54822e-08,
-    (float)1.05524e-07,
-    (float)1.77572e-07,
-    (float)3.42618e-08,
-    (float)1.56863e-07,
-    (float)5.81199e-08,
-    (float)4.66602e-08,
-    (float)3.70558e-08,
-    (float)3.71971e-08,
-    (float)3.00342e-08,
-    (float)7.27495e-08,
-    (float)3.45595e-08,
-    (float)1.35708e-07,
-    (float)1.13526e-09,
-    (float)3.02621e-08,
-    (float)3.07348e-08,
-    (float)3.37374e-08,
-    (float)6.37037e-08,
-    (float)6.20905e-08,
-    (float)6.27997e-08,
-    (float)1.81349e-08,
-    (float)1.64408e-08,
-    (float)3.1408e-08,
-    (float)1.03149e-08,
-    (float)4.60483e-08,
-    (float)2.16414e-08,
-    (float)6.38268e-08,
-    (float)1.07568e-08,
-    (float)5.27161e-09,
-    (float)5.55936e-08,
-    (float)1.31805e-08,
-    (float)2.289e-08,
-    (float)3.27046e-10,
-    (float)1.04073e-08,
-    (float)2.30896e-09,
-    (float)9.62158e-09,
-    (float)2.81994e-08,
-    (float)4.48181e-08,
-    (float)1.39014e-09,
-    (float)2.52516e-08,
-    (float)1.24691e-08,
-    (float)9.10827e-09,
-    (float)9.84544e-09,
-    (float)1.71432e-08,
-    (float)1.00243e-08,
-    (float)4.18269e-09,
-    (float)5.72305e-09,
-    (float)7.44544e-09,
-    (float)2.19556e-10,
-    (float)9.29502e-09,
-    (float)2.56019e-09,
-    (float)3.72905e-08,
-    (float)1.2189e-09,
-    (float)1.43704e-08,
-    (float)7.38917e-09,
-    (float)1.39892e-09,
-    (float)1.26089e-08,
-    (float)3.77915e-09,
-    (float)9.84276e-09,
-    (float)3.62394e-09,
-    (float)1.54762e-09,
-    (float)1.21679e-08,
-    (float)4.08065e-09,
-    (float)1.3587e-08,
-    (float)1.93749e-08,
-    (float)9.83152e-09,
-    (float)5.96088e-09,
-    (float)2.51597e-09,
-    (float)9.99506e-09,
-    (float)8.84088e-09,
-    (float)3.59453e-09,
-    (float)7.57824e-09,
-    (float)5.28506e-10,
-    (float)3.56933e-09,
-    (float)8.48087e-09,
-    (float)4.87231e-09,
-    (float)2.00541e-08,
-    (float)6.53344e-10,
-    (float)0.971937,
-    (float)0.000349647,
-    (float)0.00782675,
-    (float)0.0169352,
-    (float)0.00142492,
-    (float)0.00032642,
-    (float)0.000731019,
-    (float)0.000146377,
-    (float)5.69846e-05,
-    (float)6.25156e-06,
-    (float)0.000118308,
-    (float)4.00048e-05,
-    (float)2.54062e-06,
-    (float)1.99546e-05,
-    (float)1.18483e-05,
-    (float)1.45119e-05,
-    (float)3.10246e-06,
-    (float)2.11593e-05,
-    (float)4.58918e-07,
-    (float)4.5405e-07,
-    (float)5.40476e-07,
-    (float)6.99712e-06,
-    (float)5.23923e-07,
-    (float)3.28836e-07,
-    (float)1.73505e-06,
-    (float)5.81316e-06,
-    (float)8.43021e-07,
-    (float)4.22369e-07,
-    (float)1.42645e-06,
-    (float)2.06483e-07,
-    (float)2.1789e-07,
-    (float)5.45812e-07,
-    (float)4.31594e-07,
-    (float)6.08098e-08,
-    (float)4.1458e-07,
-    (float)1.6347e-06,
-    (float)4.15502e-07,
-    (float)2.75938e-07,
-    (float)7.85213e-08,
-    (float)5.79581e-07,
-    (float)9.36267e-08,
-    (float)5.70746e-08,
-    (float)3.84555e-07,
-    (float)8.40165e-08,
-    (float)4.52373e-09,
-    (float)3.75524e-08,
-    (float)1.82159e-08,
-    (float)6.38405e-08,
-    (float)4.64797e-07,
-    (float)2.77123e-07,
-    (float)2.80237e-07,
-    (float)4.17834e-08,
-    (float)1.03299e-07,
-    (float)9.06357e-08,
-    (float)3.93383e-08,
-    (float)7.05403e-08,
-    (float)6.28717e-08,
-    (float)1.05367e-07,
-    (float)2.91599e-08,
-    (float)2.96556e-08,
-    (float)3.42634e-08,
-    (float)6.49414e-08,
-    (float)1.15356e-07,
-    (float)2.8741e-08,
-    (float)1.15755e-07,
-    (float)7.05108e-08,
-    (float)1.91831e-09,
-    (float)1.13739e-08,
-    (float)2.63702e-08,
-    (float)2.78949e-08,
-    (float)5.78193e-08,
-    (float)8.26821e-08,
-    (float)4.55189e-08,
-    (float)2.70487e-08,
-    (float)8.33077e-10,
-    (float)4.45112e-08,
-    (float)2.01547e-09,
-    (float)6.12715e-08,
-    (float)2.78857e-08,
-    (float)4.9056e-08,
-    (float)1.50595e-08,
-    (float)1.51958e-08,
-    (float)1.93488e-08,
-    (float)2.39872e-08,
-    (float)8.93369e-09,
-    (float)5.06915e-09,
-    (float)2.35824e-08,
-    (float)9.40036e-09,
-    (float)1.48484e-08,
-    (float)3.81587e-09,
-    (float)3.25559e-08,
-    (float)2.34372e-09,
-    (float)4.02874e-08,
-    (float)1.37363e-08,
-    (float)2.53287e-08,
-    (float)5.08801e-09,
-    (float)2.83919e-11,
-    (float)1.16891e-08,
-    (float)5.09906e-10,
-    (float)5.37875e-09,
-    (float)7.26694e-11,
-    (float)1.20436e-08,
-    (float)1.25435e-08,
-    (float)1.52199e-08,
-    (float)1.60036e-08,
-    (float)1.66512e-09,
-    (float)1.7101e-08,
-    (float)5.25841e-09,
-    (float)1.5091e-08,
-    (float)7.84246e-10,
-    (float)1.93471e-09,
-    (float)3.12672e-09,
-    (float)8.63079e-09,
-    (float)4.62493e-09,
-    (float)3.50404e-09,
-    (float)1.18074e-08,
-    (float)8.36579e-09,
-    (float)5.11575e-09,
-    (float)1.93244e-08,
-    (float)1.47471e-08,
-    (float)4.00664e-09,
-    (float)1.38412e-08,
-    (float)6.22483e-09,
-    (float)7.49796e-09,
-    (float)3.01539e-09,
-    (float)4.96161e-09,
-    (float)6.1236e-09,
-    (float)1.42337e-08,
-    (float)0.96498,
-    (float)0.000357044,
-    (float)0.0100632,
-    (float)0.0212972,
-    (float)0.00160741,
-    (float)0.000283874,
-    (float)0.000636788,
-    (float)0.000365419,
-    (float)5.73591e-05,
-    (float)4.33042e-05,
-    (float)0.000132429,
-    (float)5.2657e-05,
-    (float)6.71842e-06,
-    (float)1.02513e-05,
-    (float)2.35077e-05,
-    (float)2.20953e-05,
-    (float)7.83165e-06,
-    (float)1.45234e-05,
-    (float)1.78827e-06,
-    (float)2.29601e-06,
-    (float)3.0569e-06,
-    (float)4.11419e-06,
-    (float)2.9809e-07,
-    (float)3.48586e-06,
-    (float)4.80459e-06,
-    (float)4.73088e-06,
-    (float)1.55865e-06,
-    (float)4.31175e-07,
-    (float)9.24185e-08,
-    (float)8.02644e-09,
-    (float)1.06734e-06,
-    (float)2.07799e-06,
-    (float)3.1071e-07,
-    (float)4.4072e-07,
-    (float)4.32303e-07,
-    (float)2.33409e-07,
-    (float)1.6333e-07,
-    (float)1.05427e-06,
-    (float)1.20837e-06,
-    (float)2.76258e-07,
-    (float)1.7423e-07,
-    (float)1.31981e-08,
-    (float)1.61548e-07,
-    (float)6.84766e-08,
-    (float)4.75206e-08,
-    (float)6.26391e-07,
-    (float)2.13311e-08,
-    (float)4.47823e-08,
-    (float)1.70953e-07,
-    (float)4.25498e-08,
-    (float)2.27814e-08,
-    (float)3.03629e-07,
-    (float)4.12321e-07,
-    (float)2.0589e-07,
-    (float)4.35744e-08,
-    (float)6.99119e-08,
-    (float)1.56487e-07,
-    (float)4.11778e-08,
-    (float)5.52509e-08,
-    (float)1.30249e-07,
-    (float)1.00735e-07,
-    (float)7.71608e-09,
-    (float)1.30323e-08,
-    (float)1.04895e-08,
-    (float)3.39927e-08,
-    (float)2.17642e-07,
-    (float)2.57756e-08,
-    (float)1.73146e-07,
-    (float)2.24679e-08,
-    (float)8.0017e-09,
-    (float)3.2159e-09,
-    (float)2.91194e-08,
-    (float)1.4185e-08,
-    (float)1.45891e-07,
-    (float)3.52442e-08,
-    (float)7.09908e-08,
-    (float)3.99173e-09,
-    (float)2.02207e-08,
-    (float)1.63491e-08,
-    (float)3.73127e-08,
-    (float)7.82365e-08,
-    (float)3.44597e-08,
-    (float)2.208e-08,
-    (float)1.2153e-08,
-    (float)4.03383e-08,
-    (float)5.63409e-09,
-    (float)7.95308e-09,
-    (float)4.44825e-08,
-    (float)1.95347e-08,
-    (float)2.08445e-08,
-    (float)1.35136e-09,
-    (float)8.11421e-09,
-    (float)4.23266e-09,
-    (float)1.73781e-08,
-    (float)2.24829e-08,
-    (float)6.88667e-08,
-    (float)7.10677e-09,
-    (float)8.5051e-09,
-    (float)1.35195e-08,
-    (float)7.96043e-09,
-    (float)8.05345e-09,
-    (float)1.17495e-08,
-    (float)8.34294e-09,
-    (float)1.84985e-08,
-    (float)1.06838e-08,
-    (float)4.54079e-09,
-    (float)6.12881e-09,
-    (float)2.17134e-09,
-    (float)1.63311e-08,
-    (float)2.70478e-08,
-    (float)7.54255e-09,
-    (float)7.30581e-09,
-    (float)4.66894e-09,
-    (float)1.2479e-08,
-    (float)8.77017e-10,
-    (float)1.30133e-08,
-    (float)4.03366e-09,
-    (float)2.85936e-08,
-    (float)5.13875e-09,
-    (float)8.29946e-09,
-    (float)1.30757e-08,
-    (float)4.58437e-09,
-    (float)1.19028e-08,
-    (float)9.19592e-09,
-    (float)2.89137e-08,
-    (float)8.06643e-09,
-    (float)8.00951e-09,
-    (float)2.03626e-10,
-    (float)0.957159,
-    (float)0.000358827,
-    (float)0.012633,
-    (float)0.0259964,
-    (float)0.00186403,
-    (float)0.000280712,
-    (float)0.000478076,
-    (float)0.000668501,
-    (float)9.46476e-05,
-    (float)0.000141221,
-    (float)0.000104442,
-    (float)6.49745e-05,
-    (float)1.03535e-05,
-    (float)2.51337e-05,
-    (float)2.38605e-05,
-    (float)2.73612e-05,
-    (float)1.48724e-05,
-    (float)2.15579e-06,
-    (float)3.26514e-06,
-    (float)1.89502e-06,
-    (float)1.60065e-05,
-    (float)1.16106e-06,
-    (float)2.34288e-07,
-    (float)4.66369e-06,
-    (float)6.34218e-06,
-    (float)9.40548e-07,
-    (float)1.72969e-08,
-    (float)3.94227e-06,
-    (float)2.07126e-06,
-    (float)1.0972e-06,
-    (float)3.33029e-07,
-    (float)1.061e-06,
-    (float)4.51243e-07,
-    (float)9.20297e-07,
-    (float)8.97905e-07,
-    (float)4.65463e-08,
-    (float)5.09135e-08,
-    (float)8.71764e-07,
-    (float)5.87232e-07,
-    (float)1.46772e-07,
-    (float)9.83655e-07,
-    (float)5.71307e-07,
-    (float)3.25957e-07,
-    (float)2.82326e-07,
-    (float)1.75726e-08,
-    (float)8.55126e-09,
-    (float)1.3325e-08,
-    (float)1.69406e-07,
-    (float)3.34716e-07,
-    (float)1.16455e-08,
-    (float)2.11715e-09,
-    (float)2.33964e-07,
-    (float)7.28304e-08,
-    (float)2.21838e-07,
-    (float)1.94012e-07,
-    (float)3.58661e-07,
-    (float)1.22426e-07,
-    (float)4.44366e-08,
-    (float)1.00513e-08,
-    (float)1.26206e-07,
-    (float)9.48553e-08,
-    (float)5.40026e-08,
-    (float)1.13791e-07,
-    (float)5.35323e-08,
-    (float)3.18766e-08,
-    (float)2.43826e-08,
-    (float)7.91151e-09,
-    (float)5.60005e-09,
-    (float)1.97368e-07,
-    (float)1.53329e-08,
-    (float)1.45356e-07,
-    (float)3.94338e-09,
-    (float)4.86279e-08,
-    (float)1.15871e-08,
-    (float)1.05824e-08,
-    (float)4.18552e-08,
-    (float)6.02715e-08,
-    (float)8.31896e-09,
-    (float)4.3885e-08,
-    (float)5.65112e-08,
-    (float)2.72242e-08,
-    (float)2.2034e-08,
-    (float)8.74391e-09,
-    (float)3.06901e-08,
-    (float)1.02724e-08,
-    (float)6.18446e-08,
-    (float)2.57648e-08,
-    (float)3.43744e-08,
-    (float)9.18973e-09,
-    (float)4.08937e-09,
-    (float)4.40439e-09,
-    (float)1.84681e-08,
-    (float)6.62876e-09,
-    (float)2.65088e-08,
-    (float)1.17981e-08,
-    (float)6.2945e-09,
-    (float)1.98702e-08,
-    (float)3.4117e-09,
-    (float)1.87227e-08,
-    (float)8.14775e-09,
-    (float)3.6427e-08,
-    (float)1.38495e-08,
-    (float)3.91864e-09,
-    (float)4.27132e-09,
-    (float)4.41707e-09,
-    (float)2.03298e-09,
-    (float)7.10274e-09,
-    (float)1.11564e-08,
-    (float)8.81566e-09,
-    (float)1.62026e-08,
-    (float)1.80825e-09,
-    (float)3.61975e-09,
-    (float)2.84171e-12,
-    (float)4.28013e-09,
-    (float)1.13166e-08,
-    (float)2.15135e-08,
-    (float)2.00893e-09,
-    (float)1.22866e-08,
-    (float)3.40356e-09,
-    (float)2.02957e-09,
-    (float)2.74417e-09,
-    (float)1.7801e-10,
-    (float)2.03996e-08,
-    (float)7.31849e-09,
-    (float)2.04196e-09,
-    (float)1.88462e-08,
-    (float)6.25558e-09,
-    (float)5.26006e-09,
-    (float)0.94836,
-    (float)0.000358234,
-    (float)0.0155358,
-    (float)0.0309793,
-    (float)0.00223962,
-    (float)0.00038912,
-    (float)0.00029812,
-    (float)0.00101743,
-    (float)0.000166848,
-    (float)0.000314339,
-    (float)6.05276e-05,
-    (float)7.11608e-05,
-    (float)6.85371e-06,
-    (float)7.87731e-05,
-    (float)1.22697e-05,
-    (float)2.42292e-05,
-    (float)1.13826e-05,
-    (float)1.71613e-06,
-    (float)1.1088e-05,
-    (float)1.00175e-06,
-    (float)2.44577e-05,
-    (float)1.50503e-06,
-    (float)1.69096e-06,
-    (float)1.97105e-06,
-    (float)4.79443e-06,
-    (float)4.78714e-08,
-    (float)4.0543e-06,
-    (float)6.24826e-06,
-    (float)1.93851e-06,
-    (float)1.31403e-06,
-    (float)1.83646e-06,
-    (float)7.83306e-08,
-    (float)1.87068e-07,
-    (float)1.73689e-06,
-    (float)7.08803e-07,
-    (float)2.82943e-07,
-    (float)4.4756e-07,
-    (float)6.89605e-07,
-    (float)1.40482e-08,
-    (float)7.5109e-08,
-    (float)1.66408e-06,
-    (float)6.79587e-07,
-    (float)5.66537e-08,
-    (float)7.54319e-07,
-    (float)3.78485e-07,
-    (float)2.09646e-07,
-    (float)2.93413e-07,
-    (float)3.72099e-08,
-    (float)2.32176e-08,
-    (float)2.02958e-08,
-    (float)3.57412e-07,
-    (float)9.73046e-08,
-    (float)2.39735e-08,
-    (float)6.18763e-08,
-    (float)1.3984e-07,
-    (float)6.79263e-08,
-    (float)4.61116e-07,
-    (float)2.7958e-07,
-    (float)2.61379e-07,
-    (float)1.2919e-07,
-    (float)6.26703e-08,
-    (float)4.83791e-08,
-    (float)4.15751e-08,
-    (float)1.89383e-07,
-    (float)4.55817e-08,
-    (float)4.39945e-08,
-    (float)1.31719e-08,
-    (float)1.15085e-07,
-    (float)4.53108e-08,
-    (float)9.68822e-09,
-    (float)1.94854e-08,
-    (float)1.24475e-07,
-    (float)3.41221e-08,
-    (float)1.58399e-07,
-    (float)2.70412e-08,
-    (float)1.10578e-07,
-    (float)2.9974e-08,
-    (float)3.27645e-09,
-    (float)1.68721e-08,
-    (float)4.58819e-09,
-    (float)1.44443e-08,
-    (float)1.14346e-07,
-    (float)1.85823e-08,
-    (float)7.75323e-09,
-    (float)1.51782e-08,
-    (float)3.30257e-08,
-    (float)7.08086e-09,
-    (float)4.82607e-08,
-    (float)5.80268e-08,
-    (float)6.16428e-08,
-    (float)3.04041e-08,
-    (float)1.98029e-08,
-    (float)2.1891e-08,
-    (float)5.76246e-09,
-    (float)7.45963e-09,
-    (float)2.06289e-10,
-    (float)1.24276e-08,
-    (float)3.07053e-09,
-    (float)1.3159e-08,
-    (float)2.90622e-09,
-    (float)1.63537e-09,
-    (float)2.3081e-08,
-    (float)1.65914e-08,
-    (float)7.66845e-09,
-    (float)1.52392e-08,
-    (float)2.54758e-08,
-    (float)4.83476e-08,
-    (float)1.54926e-09,
-    (float)1.76584e-09,
-    (float)8.70899e-09,
-    (float)9.34121e-10,
-    (float)1.05885e-08,
-    (float)6.99446e-09,
-    (float)1.77989e-09,
-    (float)7.54727e-10,
-    (float)9.80119e-09,
-    (float)6.93154e-09,
-    (float)5.01113e-09,
-    (float)8.13104e-09,
-    (float)3.66867e-08,
-    (float)1.53996e-08,
-    (float)1.69522e-09,
-    (float)1.86055e-08,
-    (float)7.79963e-09,
-    (float)1.35539e-09,
-    (float)1.46614e-09,
-    (float)5.28886e-09,
-    (float)9.29581e-11,
-    (float)0.938534,
-    (float)0.0003654,
-    (float)0.0187544,
-    (float)0.0361225,
-    (float)0.00276668,
-    (float)0.000711216,
-    (float)0.00017256,
-    (float)0.00136732,
-    (float)0.000246265,
-    (float)0.000554162,
-    (float)5.39205e-05,
-    (float)7.59871e-05,
-    (float)3.77196e-07,
-    (float)0.00014594,
-    (float)4.55392e-06,
-    (float)1.32046e-05,
-    (float)5.76658e-07,
-    (float)9.5477e-06,
-    (float)2.88042e-05,
-    (float)7.1146e-06,
-    (float)1.49273e-05,
-    (float)9.1626e-07,
-    (float)2.61329e-06,
-    (float)8.55769e-06,
-    (float)2.73094e-06,
-    (float)4.08475e-07,
-    (float)8.05362e-06,
-    (float)4.96434e-06,
-    (float)2.84341e-07,
-    (float)4.75892e-07,
-    (float)6.78549e-06,
-    (float)1.00665e-06,
-    (float)7.62802e-07,
-    (float)7.64233e-08,
-    (float)2.00527e-07,
-    (float)3.14323e-07,
-    (float)2.80126e-06,
-    (float)2.05397e-07,
-    (float)1.08152e-07,
-    (float)7.33731e-08,
-    (float)5.04172e-07,
-    (float)2.11863e-08,
-    (float)3.21804e-07,
-    (float)2.08627e-06,
-    (float)4.47288e-07,
-    (float)1.28771e-07,
-    (float)6.25339e-07,
-    (float)3.19294e-07,
-    (float)2.08511e-07,
-    (float)1.82995e-07,
-    (float)3.72563e-08,
-    (float)1.02584e-08,
-    (float)5.66345e-08,
-    (float)4.68118e-07,
-    (float)1.25314e-08,
-    (float)2.04996e-08,
-    (float)1.49538e-07,
-    (float)1.77918e-08,
-    (float)3.16282e-08,
-    (float)6.30933e-07,
-    (float)2.40277e-07,
-    (float)1.93212e-07,
-    (float)7.01866e-08,
-    (float)1.69563e-07,
-    (float)1.08193e-07,
-    (float)5.6493e-08,
-    (float)1.2473e-07,
-    (float)4.36758e-08,
-    (float)1.4098e-08,
-    (float)1.73198e-08,
-    (float)1.47587e-07,
-    (float)8.14312e-08,
-    (float)4.14376e-08,
-    (float)1.58785e-09,
-    (float)1.04987e-08,
-    (float)1.52829e-08,
-    (float)2.42002e-07,
-    (float)4.48222e-08,
-    (float)8.18339e-08,
-    (float)1.70715e-08,
-    (float)3.34777e-08,
-    (float)6.85707e-08,
-    (float)1.36543e-10,
-    (float)2.79051e-08,
-    (float)4.95806e-08,
-    (float)3.25073e-08,
-    (float)3.52386e-08,
-    (float)4.96484e-08,
-    (float)4.06561e-09,
-    (float)5.28569e-08,
-    (float)1.50886e-08,
-    (float)2.98046e-09,
-    (float)3.09852e-08,
-    (float)8.07805e-08,
-    (float)7.15853e-08,
-    (float)4.33848e-09,
-    (float)1.36563e-08,
-    (float)2.4415e-08,
-    (float)1.68013e-08,
-    (float)3.34291e-08,
-    (float)1.84653e-09,
-    (float)3.93446e-09,
-    (float)2.45668e-09,
-    (float)7.36138e-09,
-    (float)2.49659e-08,
-    (float)1.17111e-08,
-    (float)1.02292e-08,
-    (float)1.99887e-08,
-    (float)1.33344e-09,
-    (float)2.03845e-08,
-    (float)4.47226e-08,
-    (float)4.13306e-08,
-    (float)4.35325e-09,
-    (float)4.52788e-09,
-    (float)3.69693e-08,
-    (float)3.18727e-09,
-    (float)8.06305e-09,
-    (float)9.5311e-09,
-    (float)6.89084e-10,
-    (float)4.9549e-10,
-    (float)2.08992e-08,
-    (float)5.22892e-09,
-    (float)1.00461e-08,
-    (float)2.3065e-09,
-    (float)5.39274e-09,
-    (float)3.76867e-09,
-    (float)2.31995e-08,
-    (float)3.57337e-08,
-    (float)0.927587,
-    (float)0.000391511,
-    (float)0.0222586,
-    (float)0.0413074,
-    (float)0.00347082,
-    (float)0.00136817,
-    (float)0.000190382,
-    (float)0.00170889,
-    (float)0.000285884,
-    (float)0.000825675,
-    (float)0.000137384,
-    (float)0.000112112,
-    (float)2.00475e-05,
-    (float)0.000176419,
-    (float)8.58022e-06,
-    (float)2.94913e-06,
-    (float)1.22922e-05,
-    (float)7.63051e-06,
-    (float)4.16077e-05,
-    (float)1.46879e-05,
-    (float)4.199e-06,
-    (float)1.77174e-06,
-    (float)2.83395e-07,
-    (float)1.86462e-05,
-    (float)5.93903e-06,
-    (float)3.57164e-06,
-    (float)3.23406e-06,
-    (float)2.90631e-06,
-    (float)2.8336e-07,
-    (float)7.53314e-06,
-    (float)5.17157e-06,
-    (float)5.81877e-07,
-    (float)8.25898e-08,
-    (float)4.28807e-06,
-    (float)1.33161e-06,
-    (float)1.92666e-07,
-    (float)5.92162e-07,
-    (float)1.20692e-08,
-    (float)1.68669e-07,
-    (float)2.38702e-06,
-    (float)1.22051e-07,
-    (float)5.97455e-08,
-    (float)1.59092e-07,
-    (float)5.07881e-07,
-    (float)2.25309e-08,
-    (float)8.05674e-07,
-    (float)2.00784e-06,
-    (float)2.15099e-07,
-    (float)3.03021e-07,
-    (float)5.4685e-07,
-    (float)2.45146e-07,
-    (float)2.74893e-07,
-    (float)9.87944e-08,
-    (float)2.55125e-08,
-    (float)6.26394e-08,
-    (float)2.16214e-07,
-    (float)3.41796e-07,
-    (float)9.62558e-09,
-    (float)1.75859e-08,
-    (float)1.01336e-07,
-    (float)5.42231e-08,
-    (float)8.61149e-08,
-    (float)5.58162e-07,
-    (float)5.50848e-08,
-    (float)2.39294e-07,
-    (float)9.76396e-08,
-    (float)3.05564e-07,
-    (float)7.77702e-08,
-    (float)6.43311e-08,
-    (float)8.9381e-10,
-    (float)4.21763e-08,
-    (float)1.41522e-07,
-    (float)7.39885e-08,
-    (float)3.31201e-08,
-    (float)2.79239e-08,
-    (float)7.66225e-08,
-    (float)9.17018e-08,
-    (float)4.05034e-08,
-    (float)3.26524e-08,
-    (float)8.2093e-08,
-    (float)3.29559e-08,
-    (float)4.39602e-08,
-    (float)1.06029e-07,
-    (float)3.03562e-08,
-    (float)6.3669e-08,
-    (float)4.3935e-09,
-    (float)1.87651e-08,
-    (float)4.88808e-09,
-    (float)8.36656e-09,
-    (float)9.65191e-08,
-    (float)9.9879e-09,
-    (float)2.26697e-08,
-    (float)5.01935e-08,
-    (float)2.13162e-08,
-    (float)1.7505e-08,
-    (float)4.77533e-08,
-    (float)2.80864e-08,
-    (float)3.02393e-10,
-    (float)4.67377e-08,
-    (float)4.31942e-08,
-    (float)3.78019e-08,
-    (float)8.0952e-09,
-    (float)1.17178e-08,
-    (float)4.11035e-09,
-    (float)1.36093e-08,
-    (float)1.63346e-08,
-    (float)4.34427e-09,
-    (float)3.06151e-09,
-    (float)1.4007e-09,
-    (float)2.15772e-08,
-    (float)7.59529e-09,
-    (float)8.745e-09,
-    (float)1.61323e-08,
-    (float)5.99121e-09,
-    (float)9.85667e-09,
-    (float)2.36384e-08,
-    (float)1.2994e-08,
-    (float)1.10226e-09,
-    (float)4.17528e-09,
-    (float)1.5376e-08,
-    (float)1.41302e-08,
-    (float)1.69921e-08,
-    (float)5.89726e-09,
-    (float)9.32323e-10,
-    (float)1.1671e-09,
-    (float)1.50592e-08,
-    (float)1.71038e-09,
-    (float)7.8816e-09,
-    (float)0.915338,
-    (float)0.000446753,
-    (float)0.0260551,
-    (float)0.0464105,
-    (float)0.00436089,
-    (float)0.00249215,
-    (float)0.000446167,
-    (float)0.00208535,
-    (float)0.000246945,
-    (float)0.00106797,
-    (float)0.000323171,
-    (float)0.000219533,
-    (float)0.000130116,
-    (float)0.000148041,
-    (float)1.4279e-05,
-    (float)9.7921e-08,
-    (float)6.77298e-05,
-    (float)3.21148e-07,
-    (float)3.10961e-05,
-    (float)1.05733e-05,
-    (float)5.33694e-06,
-    (float)1.75895e-05,
-    (float)3.08039e-06,
-    (float)1.59302e-05,
-    (float)4.16864e-06,
-    (float)6.64049e-06,
-    (float)4.4806e-06,
-    (float)5.19659e-06,
-    (float)2.24644e-06,
-    (float)7.78498e-06,
-    (float)2.50566e-06,
-    (float)3.3317e-07,
-    (float)6.20236e-06,
-    (float)4.23874e-06,
-    (float)1.67751e-06,
-    (float)5.61981e-07,
-    (float)1.54763e-06,
-    (float)1.25872e-06,
-    (float)1.37286e-07,
-    (float)1.22342e-06,
-    (float)1.71845e-07,
-    (float)3.96696e-07,
-    (float)1.61285e-06,
-    (float)2.93099e-07,
-    (float)1.31911e-08,
-    (float)3.24389e-07,
-    (float)4.28476e-07,
-    (float)3.28397e-08,
-    (float)1.70664e-06,
-    (float)1.34285e-06,
-    (float)5.35646e-08,
-    (float)9.83239e-07,
-    (float)6.40713e-07,
-    (float)1.37401e-07,
-    (float)2.59862e-07,
-    (float)1.0418e-08,
-    (float)5.15021e-08,
-    (float)1.78852e-07,
-    (float)3.32727e-07,
-    (float)5.79908e-08,
-    (float)1.78763e-08,
-    (float)1.87834e-07,
-    (float)1.79899e-08,
-    (float)3.63255e-08,
-    (float)2.11691e-07,
-    (float)1.72577e-07,
-    (float)4.57486e-08,
-    (float)5.55516e-07,
-    (float)2.22528e-07,
-    (float)1.81533e-07,
-    (float)1.90485e-07,
-    (float)1.35738e-07,
-    (float)1.08636e-07,
-    (float)6.4086e-08,
-    (float)1.12204e-07,
-    (float)1.4006e-08,
-    (float)3.969e-08,
-    (float)7.99346e-08,
-    (float)5.67258e-08,
-    (float)3.39137e-08,
-    (float)2.71331e-08,
-    (float)8.53336e-08,
-    (float)5.72136e-08,
-    (float)5.27395e-08,
-    (float)4.97286e-08,
-    (float)7.16704e-08,
-    (float)3.82482e-08,
-    (float)1.62768e-07,
-    (float)3.92179e-08,
-    (float)9.16464e-08,
-    (float)3.06331e-08,
-    (float)5.48917e-09,
-    (float)5.00806e-08,
-    (float)3.26805e-09,
-    (float)4.44998e-08,
-    (float)5.06984e-08,
-    (float)3.17045e-08,
-    (float)6.81469e-08,
-    (float)2.64214e-08,
-    (float)1.59431e-09,
-    (float)1.86905e-08,
-    (float)1.54694e-08,
-    (float)2.33022e-09,
-    (float)6.24592e-08,
-    (float)3.78267e-08,
-    (float)3.04558e-08,
-    (float)1.38286e-08,
-    (float)4.69099e-08,
-    (float)4.9922e-08,
-    (float)4.28279e-09,
-    (float)3.62021e-08,
-    (float)4.47455e-09,
-    (float)8.53569e-09,
-    (float)3.30417e-08,
-    (float)2.97187e-09,
-    (float)1.30697e-08,
-    (float)1.16881e-08,
-    (float)4.2164e-09,
-    (float)2.50979e-09,
-    (float)3.0331e-09,
-    (float)1.14252e-08,
-    (float)1.77236e-08,
-    (float)6.16733e-10,
-    (float)2.32248e-08,
-    (float)1.7667e-08,
-    (float)2.7879e-08,
-    (float)3.2931e-08,
-    (float)1.66413e-09,
-    (float)0.901654,
-    (float)0.000547764,
-    (float)0.0300562,
-    (float)0.051317,
-    (float)0.00542981,
-    (float)0.00420207,
-    (float)0.00103146,
-    (float)0.00259511,
-    (float)0.000133828,
-    (float)0.00121365,
-    (float)0.000586725,
-    (float)0.000398452,
-    (float)0.000413861,
-    (float)8.47564e-05,
-    (float)2.4364e-05,
-    (float)1.02464e-05,
-    (float)0.000134181,
-    (float)5.22326e-06,
-    (float)8.23763e-06,
-    (float)7.7199e-06,
-    (float)4.74485e-06,
-    (float)3.28404e-05,
-    (float)1.35588e-05,
-    (float)1.38504e-05,
-    (float)6.84264e-07,
-    (float)2.60653e-06,
-    (float)8.86739e-06,
-    (float)9.97158e-06,
-    (float)9.78296e-06,
-    (float)1.12694e-06,
-    (float)3.87603e-06,
-    (float)2.24329e-06,
-    (float)1.0345e-05,
-    (float)1.32324e-06,
-    (float)3.80848e-07,
-    (float)7.03856e-06,
-    (float)1.98588e-06,
-    (float)1.79864e-06,
-    (float)1.56319e-06,
-    (float)9.43304e-07,
-    (float)7.85183e-07,
-    (float)2.45618e-07,
-    (float)7.48238e-07,
-    (float)3.73077e-07,
-    (float)1.1915e-06,
-    (float)5.6133e-07,
-    (float)6.7566e-07,
-    (float)9.28277e-08,
-    (float)4.14935e-07,
-    (float)3.61895e-07,
-    (float)1.62113e-07,
-    (float)2.13266e-06,
-    (float)5.91043e-07,
-    (float)8.28837e-08,
-    (float)2.00161e-06,
-    (float)3.92177e-07,
-    (float)9.94916e-08,
-    (float)1.86321e-07,
-    (float)1.07976e-07,
-    (float)2.47579e-07,
-    (float)1.82142e-07,
-    (float)7.22886e-08,
-    (float)4.99167e-08,
-    (float)1.32711e-07,
-    (float)2.94939e-07,
-    (float)5.642e-08,
-    (float)2.57779e-08,
-    (float)5.85782e-08,
-    (float)6.46898e-09,
-    (float)4.85841e-08,
-    (float)7.89509e-07,
-    (float)6.97518e-09,
-    (float)1.81351e-07,
-    (float)3.94907e-07,
-    (float)2.06964e-07,
-    (float)2.28529e-07,
-    (float)4.21149e-08,
-    (float)1.03923e-07,
-    (float)3.28819e-08,
-    (float)8.22691e-08,
-    (float)2.60303e-08,
-    (float)2.97596e-08,
-    (float)5.90777e-08,
-    (float)2.18486e-08,
-    (float)1.19697e-08,
-    (float)4.13223e-08,
-    (float)1.24143e-07,
-    (float)3.94665e-08,
-    (float)6.43415e-08,
-    (float)1.14746e-07,
-    (float)6.40276e-08,
-    (float)4.91871e-08,
-    (float)9.094e-08,
-    (float)1.19401e-07,
-    (float)2.52652e-08,
-    (float)9.53279e-08,
-    (float)1.43421e-08,
-    (float)4.83206e-08,
-    (float)2.40413e-08,
-    (float)6.57112e-09,
-    (float)1.57632e-08,
-    (float)2.06738e-09,
-    (float)3.35886e-08,
-    (float)5.27692e-08,
-    (float)2.25788e-08,
-    (float)1.35787e-08,
-    (float)6.49733e-09,
-    (float)1.28214e-08,
-    (float)2.87238e-08,
-    (float)2.61293e-08,
-    (float)1.15001e-08,
-    (float)6.75625e-08,
-    (float)2.14621e-08,
-    (float)2.94961e-08,
-    (float)1.02795e-08,
-    (float)4.18113e-08,
-    (float)6.83047e-08,
-    (float)6.04728e-09,
-    (float)2.54611e-08,
-    (float)9.69637e-09,
-    (float)1.9947e-08,
-    (float)4.02823e-09,
-    (float)2.31448e-08,
-    (float)2.09393e-08,
-    (float)3.07904e-09,
-    (float)1.54748e-08,
-    (float)2.31236e-09,
-    (float)2.62093e-09,
-    (float)0.886267,
-    (float)0.000708335,
-    (float)0.0342414,
-    (float)0.0559367,
-    (float)0.00663189,
-    (float)0.00660855,
-    (float)0.0020334,
-    (float)0.00338193,
-    (float)3.30715e-05,
-    (float)0.00118232,
-    (float)0.000885284,
-    (float)0.000578169,
-    (float)0.000915789,
-    (float)4.33944e-05,
-    (float)9.03248e-05,
-    (float)8.07156e-05,
-    (float)0.000153172,
-    (float)1.15496e-05,
-    (float)7.78461e-06,
-    (float)3.26789e-05,
-    (float)5.38817e-06,
-    (float)1.90753e-05,
-    (float)1.55897e-05,
-    (float)2.06928e-05,
-    (float)1.39205e-05,
-    (float)1.63427e-06,
-    (float)1.23599e-05,
-    (float)2.73007e-06,
-    (float)1.18774e-05,
-    (float)9.77625e-07,
-    (float)1.08232e-05,
-    (float)8.40701e-06,
-    (float)2.75717e-06,
-    (float)2.91619e-06,
-    (float)3.73052e-06,
-    (float)1.00071e-05,
-    (float)3.61231e-07,
-    (float)1.19905e-06,
-    (float)7.76193e-06,
-    (float)1.54233e-06,
-    (float)5.22002e-07,
-    (float)2.26268e-06,
-    (float)1.71886e-06,
-    (float)5.57394e-07,
-    (float)3.1003e-07,
-    (float)3.51244e-07,
-    (float)1.48631e-07,
-    (float)2.40251e-06,
-    (float)1.35829e-08,
-    (float)4.39354e-07,
-    (float)6.563e-07,
-    (float)1.72132e-07,
-    (float)3.10473e-07,
-    (float)4.13501e-07,
-    (float)1.35008e-06,
-    (float)1.33284e-07,
-    (float)9.77917e-07,
-    (float)2.47793e-06,
-    (float)1.24767e-07,
-    (float)4.44515e-07,
-    (float)8.6669e-07,
-    (float)6.53339e-08,
-    (float)2.38132e-07,
-    (float)1.10708e-08,
-    (float)5.17243e-08,
-    (float)2.50023e-07,
-    (float)3.65739e-07,
-    (float)3.56509e-08,
-    (float)3.01929e-08,
-    (float)4.0075e-07,
-    (float)3.40226e-08,
-    (float)8.37481e-09,
-    (float)2.51525e-10,
-    (float)1.30016e-07,
-    (float)6.42664e-08,
-    (float)5.92369e-07,
-    (float)2.91052e-07,
-    (float)4.47023e-08,
-    (float)5.85686e-07,
-    (float)1.64866e-07,
-    (float)1.92619e-07,
-    (float)1.26396e-07,
-    (float)1.07636e-07,
-    (float)1.04971e-07,
-    (float)5.54108e-08,
-    (float)3.86651e-08,
-    (float)1.80745e-08,
-    (float)6.04671e-08,
-    (float)1.846e-07,
-    (float)1.83576e-08,
-    (float)1.23246e-08,
-    (float)2.43793e-09,
-    (float)7.16266e-08,
-    (float)1.49146e-07,
-    (float)1.67852e-07,
-    (float)1.14436e-08,
-    (float)6.53695e-08,
-    (float)8.92095e-08,
-    (float)1.36065e-07,
-    (float)7.36508e-08,
-    (float)2.27609e-08,
-    (float)1.67375e-07,
-    (float)4.7481e-08,
-    (float)3.62712e-08,
-    (float)3.23833e-10,
-    (float)3.58772e-08,
-    (float)5.9253e-08,
-    (float)2.69626e-08,
-    (float)3.13176e-09,
-    (float)1.709e-08,
-    (float)1.69152e-09,
-    (float)1.44336e-07,
-    (float)5.3738e-08,
-    (float)8.7363e-09,
-    (float)5.5407e-08,
-    (float)2.24241e-09,
-    (float)2.82786e-08,
-    (float)3.76065e-08,
-    (float)1.10655e-08,
-    (float)6.51654e-08,
-    (float)4.09622e-08,
-    (float)3.49511e-08,
-    (float)3.39278e-08,
-    (float)2.27796e-08,
-    (float)9.85818e-08,
-    (float)2.63648e-08,
-    (float)5.25665e-09,
-    (float)4.27855e-09,
-    (float)0.868838,
-    (float)0.000948286,
-    (float)0.0385466,
-    (float)0.0601039,
-    (float)0.0079439,
-    (float)0.00973303,
-    (float)0.00350202,
-    (float)0.00466667,
-    (float)0.000124769,
-    (float)0.000964648,
-    (float)0.0012711,
-    (float)0.000632623,
-    (float)0.00159365,
-    (float)5.99577e-05,
-    (float)0.000269828,
-    (float)0.000350792,
-    (float)0.000102492,
-    (float)7.1616e-06,
-    (float)4.20032e-05,
-    (float)7.47971e-05,
-    (float)1.93328e-05,
-    (float)5.26395e-06,
-    (float)8.04404e-06,
-    (float)2.07003e-05,
-    (float)1.56003e-05,
-    (float)8.88438e-06,
-    (float)2.88992e-05,
-    (float)6.76438e-06,
-    (float)1.96059e-06,
-    (float)4.06393e-06,
-    (float)5.06931e-06,
-    (float)1.59754e-05,
-    (float)8.73185e-07,
-    (float)1.15903e-05,
-    (float)7.57435e-06,
-    (float)4.99655e-06,
-    (float)2.67698e-06,
-    (float)7.01625e-06,
-    (float)7.0911e-06,
-    (float)2.91968e-07,
-    (float)4.36817e-06,
-    (float)5.79075e-06,
-    (float)2.58033e-06,
-    (float)2.31191e-07,
-    (float)2.54875e-06,
-    (float)3.24762e-06,
-    (float)2.563e-07,
-    (float)1.77568e-07,
-    (float)5.36589e-07,
-    (float)2.40666e-07,
-    (float)1.91503e-06,
-    (float)3.30471e-07,
-    (float)2.19045e-07,
-    (float)1.19747e-06,
-    (float)6.62184e-07,
-    (float)3.85979e-07,
-    (float)3.08187e-07,
-    (float)7.40423e-07,
-    (float)2.94815e-07,
-    (float)1.58415e-06,
-    (float)1.29543e-06,
-    (float)3.23552e-09,
-    (float)2.52794e-06,
-    (float)9.88799e-07,
-    (float)1.84704e-08,
-    (float)7.08462e-07,
-    (float)1.58329e-07,
-    (float)1.86126e-07,
-    (float)1.49767e-07,
-    (float)3.69294e-08,
-    (float)2.00923e-07,
-    (float)3.21313e-07,
-    (float)2.70525e-07,
-    (float)5.57669e-08,
-    (float)1.99992e-07,
-    (float)3.79067e-07,
-    (float)1.3958e-07,
-    (float)6.47441e-08,
-    (float)4.4299e-08,
-    (float)2.88863e-08,
-    (float)5.79967e-08,
-    (float)8.95757e-07,
-    (float)3.55191e-08,
-    (float)2.31182e-07,
-    (float)6.47733e-07,
-    (float)7.77692e-08,
-    (float)2.29551e-07,
-    (float)6.71444e-08,
-    (float)2.93471e-07,
-    (float)1.80336e-07,
-    (float)5.01676e-09,
-    (float)1.86938e-08,
-    (float)4.57185e-08,
-    (float)2.20896e-07,
-    (float)1.26413e-07,
-    (float)6.95213e-08,
-    (float)1.87916e-07,
-    (float)4.81928e-08,
-    (float)1.54702e-08,
-    (float)1.18608e-08,
-    (float)2.29014e-07,
-    (float)1.7369e-07,
-    (float)1.9918e-07,
-    (float)1.40477e-07,
-    (float)2.80156e-08,
-    (float)7.93231e-08,
-    (float)1.10582e-07,
-    (float)7.4419e-08,
-    (float)5.03236e-09,
-    (float)1.72393e-07,
-    (float)3.99415e-08,
-    (float)5.22761e-08,
-    (float)7.47613e-09,
-    (float)4.84556e-08,
-    (float)1.01758e-07,
-    (float)3.46736e-08,
-    (float)4.56395e-09,
-    (float)1.47048e-08,
-    (float)9.49587e-09,
-    (float)1.93963e-07,
-    (float)9.62088e-08,
-    (float)7.8482e-08,
-    (float)1.80276e-07,
-    (float)3.76264e-08,
-    (float)2.99103e-09,
-    (float)3.61612e-08,
-    (float)1.22792e-07,
-    (float)2.53371e-08,
-    (float)0.848887,
-    (float)0.00128207,
-    (float)0.0429322,
-    (float)0.0637557,
-    (float)0.00929262,
-    (float)0.0135414,
-    (float)0.00548028,
-    (float)0.00664969,
-    (float)0.000662462,
-    (float)0.000590361,
-    (float)0.00193281,
-    (float)0.000473262,
-    (float)0.00222293,
-    (float)0.000118796,
-    (float)0.000526117,
-    (float)0.000985594,
-    (float)4.40936e-05,
-    (float)5.60095e-05,
-    (float)0.000152156,
-    (float)8.47246e-05,
-    (float)2.17127e-05,
-    (float)4.67172e-05,
-    (float)1.60416e-05,
-    (float)2.11179e-05,
-    (float)4.25992e-07,
-    (float)3.81795e-06,
-    (float)3.77945e-05,
-    (float)1.64501e-05,
-    (float)1.72643e-06,
-    (float)2.37103e-05,
-    (float)5.41151e-06,
-    (float)8.44478e-06,
-    (float)4.44469e-07,
-    (float)5.07362e-06,
-    (float)1.42756e-05,
-    (float)6.87362e-06,
-    (float)1.18157e-05,
-    (float)5.79438e-06,
-    (float)8.71442e-06,
-    (float)4.76159e-06,
-    (float)9.34383e-06,
-    (float)3.91618e-06,
-    (float)9.40629e-07,
-    (float)1.0206e-05,
-    (float)2.15783e-06,
-    (float)1.59932e-06,
-    (float)4.2948e-06,
-    (float)1.84859e-06,
-    (float)2.85964e-06,
-    (float)8.21718e-07,
-    (float)1.61803e-06,
-    (float)9.00836e-07,
-    (float)2.39998e-07,
-    (float)1.07047e-06,
-    (float)1.65075e-07,
-    (float)1.27155e-06,
-    (float)3.40741e-07,
-    (float)8.95886e-07,
-    (float)9.00815e-07,
-    (float)7.87635e-08,
-    (float)1.30637e-06,
-    (float)7.22447e-07,
-    (float)9.00206e-07,
-    (float)9.04741e-07,
-    (float)6.21013e-07,
-    (float)3.0413e-06,
-    (float)4.30312e-07,
-    (float)7.09468e-07,
-    (float)3.06944e-06,
-    (float)1.94503e-07,
-    (float)4.95107e-07,
-    (float)7.3122e-07,
-    (float)4.62268e-08,
-    (float)2.88388e-07,
-    (float)1.00047e-08,
-    (float)1.03773e-07,
-    (float)1.97162e-07,
-    (float)2.66507e-07,
-    (float)3.77571e-08,
-    (float)3.38099e-08,
-    (float)6.33269e-07,
-    (float)2.61229e-08,
-    (float)1.37877e-07,
-    (float)2.60239e-07,
-    (float)2.54073e-07,
-    (float)5.63026e-08,
-    (float)2.69086e-07,
-    (float)5.11025e-07,
-    (float)9.17163e-09,
-    (float)1.42091e-06,
-    (float)2.503e-07,
-    (float)1.00063e-07,
-    (float)9.82247e-07,
-    (float)1.40819e-07,
-    (float)2.57558e-07,
-    (float)1.43694e-07,
-    (float)2.23909e-07,
-    (float)1.36551e-07,
-    (float)2.86732e-08,
-    (float)6.28475e-09,
-    (float)8.24483e-09,
-    (float)1.34352e-07,
-    (float)1.1516e-07,
-    (float)7.71749e-08,
-    (float)1.71125e-07,
-    (float)6.69933e-09,
-    (float)6.75601e-08,
-    (float)9.69264e-09,
-    (float)2.62966e-07,
-    (float)6.45269e-08,
-    (float)1.79848e-07,
-    (float)4.22779e-07,
-    (float)1.66293e-09,
-    (float)3.86367e-07,
-    (float)1.92026e-07,
-    (float)1.53005e-07,
-    (float)2.30344e-07,
-    (float)2.80448e-07,
-    (float)1.2255e-07,
-    (float)1.20752e-07,
-    (float)9.64665e-08,
-    (float)2.02418e-08,
-    (float)1.94046e-07,
-    (float)2.65216e-08,
-    (float)1.00821e-07,
-    (float)8.20248e-08,
-    (float)3.43464e-08,
-    (float)1.78697e-08,
-    (float)0.826075,
-    (float)0.00172304,
-    (float)0.047213,
-    (float)0.066777,
-    (float)0.0106207,
-    (float)0.0178949,
-    (float)0.00796075,
-    (float)0.00942721,
-    (float)0.00188511,
-    (float)0.000217393,
-    (float)0.00322466,
-    (float)0.000179507,
-    (float)0.00252335,
-    (float)0.000244123,
-    (float)0.000687975,
-    (float)0.00197393,
-    (float)3.33268e-05,
-    (float)0.000265439,
-    (float)0.000495241,
-    (float)7.25045e-05,
-    (float)3.5488e-05,
-    (float)0.000124155,
-    (float)2.24866e-05,
-    (float)2.14952e-05,
-    (float)4.10565e-05,
-    (float)2.88888e-06,
-    (float)2.06761e-05,
-    (float)2.48015e-06,
-    (float)1.9736e-06,
-    (float)3.20108e-05,
-    (float)2.08727e-05,
-    (float)9.87831e-06,
-    (float)1.43147e-05,
-    (float)4.96265e-06,
-    (float)1.31558e-05,
-    (float)3.00445e-07,
-    (float)3.83564e-06,
-    (float)7.93573e-06,
-    (float)1.33472e-05,
-    (float)1.32978e-05,
-    (float)1.46369e-06,
-    (float)1.35746e-05,
-    (float)9.61197e-06,
-    (float)5.90342e-06,
-    (float)3.66956e-06,
-    (float)4.8754e-06,
-    (float)9.6888e-06,
-    (float)4.5611e-07,
-    (float)1.65461e-06,
-    (float)6.95163e-06,
-    (float)2.37847e-06,
-    (float)4.38557e-08,
-    (float)2.60907e-06,
-    (float)4.28085e-06,
-    (float)4.87978e-07,
-    (float)1.57469e-07,
-    (float)2.2742e-06,
-    (float)4.28683e-07,
-    (float)9.61353e-07,
-    (float)3.06042e-07,
-    (float)9.49189e-08,
-    (float)1.395e-06,
-    (float)3.07429e-07,
-    (float)2.15764e-07,
-    (float)7.3412e-07,
-    (float)9.39048e-07,
-    (float)9.86502e-07,
-    (float)3.26069e-07,
-    (float)1.66792e-06,
-    (float)9.32718e-07,
-    (float)1.21346e-06,
-    (float)1.76615e-06,
-    (float)1.20022e-07,
-    (float)3.05172e-06,
-    (float)8.77658e-07,
-    (float)1.96073e-08,
-    (float)2.34644e-06,
-    (float)1.09187e-07,
-    (float)1.31845e-08,
-    (float)2.60241e-07,
-    (float)4.4056e-09,
-    (float)2.32758e-07,
-    (float)1.43715e-07,
-    (float)2.75029e-08,
-    (float)1.9269e-07,
-    (float)3.23664e-07,
-    (float)1.4764e-07,
-    (float)1.2347e-08,
-    (float)5.57227e-07,
-    (float)6.4897e-08,
-    (float)3.02848e-07,
-    (float)4.82371e-07,
-    (float)2.42905e-07,
-    (float)2.84428e-07,
-    (float)9.30314e-09,
-    (float)6.80947e-07,
-    (float)1.28121e-08,
-    (float)7.85245e-07,
-    (float)4.41785e-07,
-    (float)1.79444e-07,
-    (float)9.89776e-07,
-    (float)9.00079e-08,
-    (float)2.96521e-07,
-    (float)2.60668e-07,
-    (float)1.78037e-07,
-    (float)6.15996e-08,
-    (float)1.22539e-08,
-    (float)2.82485e-08,
-    (float)2.16967e-08,
-    (float)2.64584e-08,
-    (float)1.63811e-07,
-    (float)2.87856e-08,
-    (float)2.25531e-07,
-    (float)3.26079e-07,
-    (float)6.03234e-08,
-    (float)3.14074e-07,
-    (float)2.02407e-08,
-    (float)1.00086e-07,
-    (float)9.41049e-08,
-    (float)1.56511e-07,
-    (float)2.23163e-08,
-    (float)2.24528e-07,
-    (float)1.57156e-07,
-    (float)1.81517e-07,
-    (float)3.35133e-07,
-    (float)8.04015e-08,
-    (float)3.07849e-07,
-    (float)1.85809e-07,
-    (float)0.799188,
-    (float)0.00227229,
-    (float)0.0514178,
-    (float)0.0689775,
-    (float)0.0119512,
-    (float)0.0226115,
-    (float)0.010895,
-    (float)0.0131923,
-    (float)0.0039335,
-    (float)8.90495e-05,
-    (float)0.00573023,
-    (float)2.76064e-05,
-    (float)0.00230306,
-    (float)0.000661469,
-    (float)0.000569088,
-    (float)0.00302128,
-    (float)4.33293e-05,
-    (float)0.000599536,
-    (float)0.00124787,
-    (float)0.000174173,
-    (float)0.000258382,
-    (float)0.000264885,
-    (float)3.61641e-05,
-    (float)6.25622e-05,
-    (float)0.000118605,
-    (float)7.35019e-06,
-    (float)1.2516e-05,
-    (float)3.11188e-05,
-    (float)1.31261e-05,
-    (float)1.04614e-05,
-    (float)4.15414e-06,
-    (float)1.45887e-05,
-    (float)1.94868e-05,
-    (float)1.42721e-05,
-    (float)2.85705e-05,
-    (float)1.23588e-05,
-    (float)3.06844e-06,
-    (float)2.05613e-05,
-    (float)5.24014e-07,
-    (float)3.48147e-06,
-    (float)3.78094e-06,
-    (float)1.10739e-05,
-    (float)1.33467e-05,
-    (float)1.273e-06,
-    (float)1.709e-05,
-    (float)1.17635e-05,
-    (float)6.27868e-06,
-    (float)8.6206e-06,
-    (float)8.77986e-06,
-    (float)6.37857e-06,
-    (float)1.95944e-06,
-    (float)8.03922e-06,
-    (float)2.98533e-06,
-    (float)1.73157e-06,
-    (float)4.95768e-06,
-    (float)1.37857e-06,
-    (float)3.54381e-06,
-    (float)2.20766e-06,
-    (float)2.22889e-06,
-    (float)3.20201e-06,
-    (float)4.63335e-07,
-    (float)2.69621e-06,
-    (float)1.19152e-06,
-    (float)3.12345e-07,
-    (float)1.46707e-06,
-    (float)1.29523e-07,
-    (float)1.01934e-06,
-    (float)4.25612e-07,
-    (float)1.83688e-07,
-    (float)9.6361e-07,
-    (float)1.3224e-07,
-    (float)1.18379e-06,
-    (float)1.24923e-06,
-    (float)4.11441e-07,
-    (float)2.38323e-06,
-    (float)9.80735e-07,
-    (float)1.4809e-06,
-    (float)1.46504e-06,
-    (float)4.99997e-07,
-    (float)2.24504e-06,
-    (float)1.38897e-07,
-    (float)1.51188e-06,
-    (float)1.34661e-06,
-    (float)2.64357e-07,
-    (float)1.81854e-06,
-    (float)2.7307e-07,
-    (float)2.07829e-07,
-    (float)4.83833e-07,
-    (float)6.2049e-08,
-    (float)2.35149e-07,
-    (float)5.41877e-08,
-    (float)3.53711e-08,
-    (float)4.77126e-07,
-    (float)2.18761e-07,
-    (float)2.24965e-07,
-    (float)7.06687e-08,
-    (float)2.4899e-07,
-    (float)1.97638e-07,
-    (float)1.86517e-07,
-    (float)8.43567e-07,
-    (float)9.65096e-08,
-    (float)6.63433e-07,
-    (float)4.72254e-07,
-    (float)5.30803e-07,
-    (float)3.45005e-07,
-    (float)3.39487e-08,
-    (float)6.44453e-07,
-    (float)2.65336e-08,
-    (float)8.18939e-07,
-    (float)1.97582e-07,
-    (float)1.96147e-07,
-    (float)7.91066e-07,
-    (float)4.12624e-10,
-    (float)5.08409e-08,
-    (float)1.04827e-07,
-    (float)5.3448e-08,
-    (float)1.6719e-07,
-    (float)3.94256e-08,
-    (float)1.43646e-08,
-    (float)3.85181e-07,
-    (float)2.26731e-08,
-    (float)1.93857e-07,
-    (float)2.73901e-08,
-    (float)1.8311e-07,
-    (float)2.3821e-07,
-    (float)2.77971e-07,
-    (float)6.21695e-07,
-    (float)9.2937e-08,
-    (float)0.766576,
-    (float)0.00294631,
-    (float)0.0555118,
-    (float)0.070148,
-    (float)0.0132612,
-    (float)0.0273933,
-    (float)0.014151,
-    (float)0.0180405,
-    (float)0.00671612,
-    (float)0.000471238,
-    (float)0.0101775,
-    (float)0.000398997,
-    (float)0.00165312,
-    (float)0.0020371,
-    (float)0.000219958,
-    (float)0.00372095,
-    (float)2.40695e-05,
-    (float)0.000784376,
-    (float)0.00232342,
-    (float)0.000379974,
-    (float)0.000883718,
-    (float)0.00060846,
-    (float)0.000221359,
-    (float)0.000492934,
-    (float)0.000135048,
-    (float)7.34262e-06,
-    (float)0.000135561,
-    (float)8.10233e-05,
-    (float)2.46451e-05,
-    (float)2.34726e-05,
-    (float)1.92142e-05,
-    (float)3.187e-05,
-    (float)1.76584e-06,
-    (float)3.38855e-07,
-    (float)3.05969e-05,
-    (float)8.96989e-06,
-    (float)1.83771e-06,
-    (float)4.24879e-05,
-    (float)1.88961e-05,
-    (float)3.34264e-06,
-    (float)2.88445e-05,
-    (float)7.50814e-06,
-    (float)8.31826e-06,
-    (float)5.70161e-06,
-    (float)2.85842e-06,
-    (float)1.13174e-05,
-    (float)6.06039e-06,
-    (float)1.19587e-05,
-    (float)7.62088e-06,
-    (float)1.75985e-05,
-    (float)1.71744e-05,
-    (float)3.87444e-06,
-    (float)1.49726e-05,
-    (float)1.60624e-05,
-    (float)5.10194e-06,
-    (float)4.34161e-06,
-    (float)1.18063e-05,
-    (float)6.29305e-06,
-    (float)5.37078e-07,
-    (float)5.57091e-06,
-    (float)5.12091e-06,
-    (float)4.83695e-06,
-    (float)1.06165e-06,
-    (float)2.9038e-06,
-    (float)9.28319e-06,
-    (float)4.06523e-07,
-    (float)2.00441e-06,
-    (float)7.00213e-06,
-    (float)5.4165e-07,
-    (float)2.24276e-06,
-    (float)2.53831e-06,
-    (float)7.6405e-07,
-    (float)1.50238e-06,
-    (float)8.43938e-07,
-    (float)8.56639e-07,
-    (float)8.98817e-07,
-    (float)6.65859e-07,
-    (float)3.35221e-07,
-    (float)5.92148e-07,
-    (float)1.80189e-06,
-    (float)1.47278e-06,
-    (float)1.18899e-07,
-    (float)4.0527e-06,
-    (float)2.69435e-06,
-    (float)5.76868e-07,
-    (float)4.10012e-06,
-    (float)1.51937e-06,
-    (float)1.91264e-06,
-    (float)1.58902e-06,
-    (float)9.90454e-07,
-    (float)2.56624e-06,
-    (float)5.05843e-07,
-    (float)2.43784e-06,
-    (float)1.87766e-06,
-    (float)6.11725e-07,
-    (float)2.24392e-06,
-    (float)1.06788e-06,
-    (float)5.2437e-07,
-    (float)3.87934e-07,
-    (float)5.42751e-07,
-    (float)1.23492e-06,
-    (float)1.23665e-07,
-    (float)6.93668e-07,
-    (float)1.2044e-06,
-    (float)3.07362e-07,
-    (float)9.50013e-07,
-    (float)1.44562e-07,
-    (float)4.33253e-07,
-    (float)1.60376e-07,
-    (float)3.90744e-07,
-    (float)1.58221e-06,
-    (float)4.06621e-07,
-    (float)1.40895e-06,
-    (float)1.21412e-06,
-    (float)1.68503e-06,
-    (float)1.18749e-06,
-    (float)3.43748e-08,
-    (float)1.35646e-06,
-    (float)2.58674e-07,
-    (float)1.01753e-06,
-    (float)4.25826e-07,
-    (float)2.62746e-07,
-    (float)1.99282e-06,
-    (float)2.36234e-07,
-    (float)5.01759e-07,
-    (float)1.10316e-06,
-    (float)2.86092e-07,
-    (float)3.84983e-07,
-    (float)0.727408,
-    (float)0.00368325,
-    (float)0.0592152,
-    (float)0.0703106,
-    (float)0.014441,
-    (float)0.031789,
-    (float)0.0175307,
-    (float)0.0236621,
-    (float)0.00985299,
-    (float)0.00152186,
-    (float)0.0169734,
-    (float)0.00156519,
-    (float)0.000948514,
-    (float)0.00543659,
-    (float)6.4037e-05,
-    (float)0.00396312,
-    (float)0.000336037,
-    (float)0.000499062,
-    (float)0.00342296,
-    (float)0.000369536,
-    (float)0.00149439,
-    (float)0.00117547,
-    (float)0.000577491,
-    (float)0.00163839,
-    (float)0.000125615,
-    (float)0.000176975,
-    (float)0.000896053,
-    (float)3.42729e-05,
-    (float)1.29079e-05,
-    (float)0.000273108,
-    (float)2.0611e-05,
-    (float)3.50642e-05,
-    (float)7.08077e-05,
-    (float)5.48929e-06,
-    (float)2.876e-05,
-    (float)1.30725e-05,
-    (float)8.94093e-06,
-    (float)1.94669e-05,
-    (float)1.85246e-06,
-    (float)8.75289e-06,
-    (float)2.03797e-05,
-    (float)1.4959e-05,
-    (float)2.16962e-05,
-    (float)1.70496e-05,
-    (float)1.23748e-05,
-    (float)3.21049e-05,
-    (float)5.87488e-06,
-    (float)3.33532e-06,
-    (float)2.33079e-05,
-    (float)4.03404e-07,
-    (float)3.29385e-06,
-    (float)8.59971e-06,
-    (float)9.85676e-06,
-    (float)9.55122e-06,
-    (float)3.54614e-06,
-    (float)1.70201e-05,
-    (float)1.35254e-05,
-    (float)7.76301e-06,
-    (float)1.46048e-05,
-    (float)1.19899e-05,
-    (float)9.97327e-06,
-    (float)1.04685e-05,
-    (float)8.03653e-06,
-    (float)6.20142e-06,
-    (float)8.50068e-06,
-    (float)4.99802e-06,
-    (float)9.6957e-07,
-    (float)5.94429e-06,
-    (float)4.69342e-06,
-    (float)1.86397e-06,
-    (float)1.79758e-06,
-    (float)3.87466e-06,
-    (float)7.16765e-06,
-    (float)9.88782e-08,
-    (float)1.83285e-06,
-    (float)7.42268e-06,
-    (float)3.02956e-07,
-    (float)1.29038e-06,
-    (float)3.40165e-06,
-    (float)2.82079e-07,
-    (float)1.12396e-06,
-    (float)1.22123e-06,
-    (float)5.17721e-07,
-    (float)8.67664e-07,
-    (float)6.77432e-07,
-    (float)1.94155e-07,
-    (float)1.22431e-06,
-    (float)2.68005e-07,
-    (float)2.6724e-07,
-    (float)7.45328e-07,
-    (float)1.4823e-06,
-    (float)1.92831e-06,
-    (float)1.17755e-08,
-    (float)4.29043e-06,
-    (float)2.46593e-06,
-    (float)7.58761e-07,
-    (float)4.70294e-06,
-    (float)9.79384e-07,
-    (float)2.44546e-06,
-    (float)1.91939e-06,
-    (float)7.89306e-08,
-    (float)2.77079e-06,
-    (float)2.03951e-07,
-    (float)1.33726e-06,
-    (float)1.41647e-06,
-    (float)3.29758e-07,
-    (float)2.60047e-06,
-    (float)3.42406e-07,
-    (float)7.43026e-08,
-    (float)1.58906e-06,
-    (float)7.74833e-08,
-    (float)1.33887e-07,
-    (float)2.73599e-07,
-    (float)1.83167e-07,
-    (float)4.20013e-07,
-    (float)2.14065e-07,
-    (float)8.02549e-07,
-    (float)1.40279e-07,
-    (float)4.38373e-07,
-    (float)4.97219e-07,
-    (float)1.04038e-07,
-    (float)7.52054e-07,
-    (float)3.90736e-08,
-    (float)1.08339e-06,
-    (float)7.30498e-07,
-    (float)1.31458e-06,
-    (float)2.08247e-06,
-    (float)4.0235e-07,
-    (float)0.677557,
-    (float)0.00442807,
-    (float)0.0624599,
-    (float)0.0690458,
-    (float)0.0156054,
-    (float)0.0354702,
-    (float)0.0207874,
-    (float)0.0300878,
-    (float)0.0127984,
-    (float)0.0032106,
-    (float)0.0265276,
-    (float)0.00348083,
-    (float)0.000598359,
-    (float)0.0121578,
-    (float)0.00079662,
-    (float)0.00427572,
-    (float)0.00215866,
-    (float)3.79329e-05,
-    (float)0.00491682,
-    (float)0.000122705,
-    (float)0.00129814,
-    (float)0.00221625,
-    (float)0.000598963,
-    (float)0.002814,
-    (float)0.000258402,
-    (float)0.000476425,
-    (float)0.00257652,
-    (float)3.7265e-05,
-    (float)0.00024651,
-    (float)0.00124845,
-    (float)0.000131366,
-    (float)0.000250139,
-    (float)0.000358707,
-    (float)3.71985e-05,
-    (float)0.00018504,
-    (float)9.23101e-05,
-    (float)5.49456e-06,
-    (float)7.30339e-05,
-    (float)2.44279e-05,
-    (float)2.80446e-05,
-    (float)1.74098e-05,
-    (float)2.27242e-06,
-    (float)2.78762e-05,
-    (float)1.8939e-06,
-    (float)9.80229e-07,
-    (float)2.65498e-05,
-    (float)9.00162e-06,
-    (float)4.08082e-07,
-    (float)2.97256e-05,
-    (float)1.95253e-05,
-    (float)7.1065e-06,
-    (float)2.37352e-05,
-    (float)1.6184e-05,
-    (float)1.67817e-05,
-    (float)9.59868e-06,
-    (float)7.97548e-06,
-    (float)1.96797e-05,
-    (float)1.216e-06,
-    (float)4.09687e-06,
-    (float)1.49535e-05,
-    (float)6.13222e-06,
-    (float)4.90773e-06,
-    (float)7.92612e-06,
-    (float)1.49999e-05,
-    (float)9.75429e-06,
-    (float)3.74357e-06,
-    (float)1.65213e-05,
-    (float)1.57433e-05,
-    (float)4.10986e-06,
-    (float)1.23288e-05,
-    (float)1.54132e-05,
-    (float)6.42856e-06,
-    (float)1.11591e-05,
-    (float)7.41795e-06,
-    (float)4.73041e-06,
-    (float)1.35884e-05,
-    (float)1.5347e-06,
-    (float)4.0591e-07,
-    (float)1.12824e-05,
-    (float)1.81014e-06,
-    (float)3.22642e-06,
-    (float)3.85701e-06,
-    (float)1.65323e-06,
-    (float)1.05156e-05,
-    (float)1.17145e-07,
-    (float)6.61337e-07,
-    (float)1.00983e-05,
-    (float)2.93023e-07,
-    (float)1.98507e-06,
-    (float)4.19658e-06,
-    (float)2.65594e-07,
-    (float)2.15068e-06,
-    (float)9.24549e-07,
-    (float)6.76567e-07,
-    (float)1.00426e-06,
-    (float)2.6981e-07,
-    (float)9.37982e-07,
-    (float)1.59791e-06,
-    (float)2.92437e-07,
-    (float)4.76149e-07,
-    (float)1.88105e-06,
-    (float)1.20611e-06,
-    (float)9.13806e-07,
-    (float)5.11551e-07,
-    (float)3.38871e-06,
-    (float)1.68772e-06,
-    (float)1.86051e-07,
-    (float)5.04704e-06,
-    (float)1.57588e-06,
-    (float)2.50979e-06,
-    (float)3.88126e-06,
-    (float)6.4239e-07,
-    (float)4.79183e-06,
-    (float)1.96641e-06,
-    (float)1.29887e-07,
-    (float)3.56173e-06,
-    (float)1.23481e-06,
-    (float)1.26612e-06,
-    (float)1.46876e-06,
-    (float)4.34376e-07,
-    (float)1.79589e-06,
-    (float)1.88196e-06,
-    (float)1.45159e-07,
-    (float)4.51225e-07,
-    (float)2.1772e-06,
-    (float)6.25727e-07,
-    (float)1.89687e-07,
-    (float)1.66956e-06,
-    (float)0.610675,
-    (float)0.00510661,
-    (float)0.0650729,
-    (float)0.0654721,
-    (float)0.0168083,
-    (float)0.0380022,
-    (float)0.0232497,
-    (float)0.037131,
-    (float)0.0148004,
-    (float)0.005093,
-    (float)0.0387319,
-    (float)0.00567821,
-    (float)0.000778911,
-    (float)0.0230162,
-    (float)0.00303382,
-    (float)0.00562788,
-    (float)0.00707253,
-    (float)0.000577789,
-    (float)0.00844494,
-    (float)0.000631542,
-    (float)0.00031893,
-    (float)0.00541698,
-    (float)0.000141957,
-    (float)0.00262984,
-    (float)0.00134973,
-    (float)0.000377069,
-    (float)0.00404203,
-    (float)4.73761e-05,
-    (float)0.000560876,
-    (float)0.0028714,
-    (float)0.000364729,
-    (float)0.00117255,
-    (float)0.00100687,
-    (float)0.000368805,
-    (float)0.00146431,
-    (float)0.000129464,
-    (float)8.79858e-05,
-    (float)0.00105654,
-    (float)2.67435e-06,
-    (float)9.00145e-06,
-    (float)0.000481971,
-    (float)7.88226e-06,
-    (float)5.43973e-05,
-    (float)0.000151935,
-    (float)9.46172e-06,
-    (float)5.55884e-05,
-    (float)3.28768e-05,
-    (float)2.20044e-05,
-    (float)2.85309e-05,
-    (float)3.28275e-06,
-    (float)2.58237e-05,
-    (float)9.83437e-06,
-    (float)2.12346e-06,
-    (float)2.86019e-05,
-    (float)5.39082e-06,
-    (float)8.55747e-07,
-    (float)3.53946e-05,
-    (float)1.16189e-05,
-    (float)1.61874e-06,
-    (float)3.40595e-05,
-    (float)1.50831e-05,
-    (float)1.19579e-05,
-    (float)2.32611e-05,
-    (float)1.11224e-05,
-    (float)2.34624e-05,
-    (float)1.06024e-05,
-    (float)6.45072e-06,
-    (float)2.954e-05,
-    (float)2.68034e-06,
-    (float)3.43396e-06,
-    (float)2.95293e-05,
-    (float)1.88623e-06,
-    (float)3.95215e-06,
-    (float)2.25678e-05,
-    (float)4.7521e-06,
-    (float)1.08496e-05,
-    (float)1.11381e-05,
-    (float)6.74316e-06,
-    (float)2.11691e-05,
-    (float)4.14346e-06,
-    (float)8.13173e-06,
-    (float)2.30329e-05,
-    (float)6.93441e-06,
-    (float)1.70088e-05,
-    (float)1.08751e-05,
-    (float)8.79111e-06,
-    (float)3.18123e-05,
-    (float)5.66455e-07,
-    (float)3.80301e-06,
-    (float)3.28053e-05,
-    (float)1.56651e-06,
-    (float)5.2836e-06,
-    (float)1.62531e-05,
-    (float)2.13238e-06,
-    (float)1.49436e-05,
-    (float)2.63338e-06,
-    (float)1.03954e-07,
-    (float)1.59506e-05,
-    (float)6.13766e-07,
-    (float)5.65787e-06,
-    (float)6.62347e-06,
-    (float)6.01964e-07,
-    (float)1.26362e-05,
-    (float)8.56389e-07,
-    (float)8.73998e-07,
-    (float)1.04542e-05,
-    (float)8.28953e-08,
-    (float)2.93486e-06,
-    (float)5.75895e-06,
-    (float)2.39167e-07,
-    (float)2.84581e-06,
-    (float)4.58318e-06,
-    (float)2.10276e-06,
-    (float)3.05321e-06,
-    (float)3.59579e-06,
-    (float)2.94548e-06,
-    (float)7.44883e-06,
-    (float)2.90878e-06,
-    (float)8.5577e-07,
-    (float)9.93231e-06,
-    (float)3.65565e-06,
-    (float)9.29732e-07,
-    (float)6.34438e-06,
-    (float)3.01569e-06,
-    (float)4.52755e-06,
-    (float)1.61306e-06,
-    (float)9.87002e-07,
-    (float)6.8251e-06,
-    (float)0.518966,
-    (float)0.0053938,
-    (float)0.066146,
-    (float)0.0587344,
-    (float)0.0180396,
-    (float)0.0387591,
-    (float)0.0241705,
-    (float)0.0440202,
-    (float)0.0151411,
-    (float)0.00650013,
-    (float)0.0521322,
-    (float)0.00737294,
-    (float)0.0011759,
-    (float)0.0369749,
-    (float)0.0068024,
-    (float)0.00844583,
-    (float)0.0153439,
-    (float)0.00359265,
-    (float)0.0159355,
-    (float)0.00297913,
-    (float)0.000270766,
-    (float)0.0143751,
-    (float)0.000125052,
-    (float)0.00129774,
-    (float)0.00693732,
-    (float)0.000105247,
-    (float)0.00439393,
-    (float)0.00140849,
-    (float)0.00013815,
-    (float)0.00481402,
-    (float)0.000128569,
-    (float)0.00123176,
-    (float)0.0024306,
-    (float)0.000344884,
-    (float)0.00288808,
-    (float)0.000400372,
-    (float)0.000275558,
-    (float)0.00324334,
-    (float)2.50248e-05,
-    (float)0.000342611,
-    (float)0.00208188,
-    (float)0.000265806,
-    (float)0.000800555,
-    (float)0.000746089,
-    (float)0.000230409,
-    (float)0.0010759,
-    (float)0.000114038,
-    (float)5.16927e-05,
-    (float)0.00086914,
-    (float)8.32255e-06,
-    (float)1.2409e-06,
-    (float)0.000469428,
-    (float)3.16203e-05,
-    (float)3.81068e-05,
-    (float)0.000175706,
-    (float)3.70684e-05,
-    (float)5.74557e-05,
-    (float)4.58032e-05,
-    (float)2.38749e-05,
-    (float)3.9043e-05,
-    (float)1.40697e-05,
-    (float)1.50743e-05,
-    (float)1.23001e-05,
-    (float)8.8382e-06,
-    (float)1.7144e-05,
-    (float)3.13375e-06,
-    (float)5.93592e-06,
-    (float)1.80645e-05,
-    (float)6.84778e-06,
-    (float)1.35242e-05,
-    (float)1.25938e-05,
-    (float)7.60666e-06,
-    (float)2.98475e-05,
-    (float)6.76978e-06,
-    (float)4.41085e-06,
-    (float)4.1858e-05,
-    (float)3.51507e-06,
-    (float)4.48656e-06,
-    (float)4.62588e-05,
-    (float)1.40893e-06,
-    (float)8.64293e-06,
-    (float)4.8496e-05,
-    (float)5.58323e-07,
-    (float)1.48042e-05,
-    (float)4.82787e-05,
-    (float)1.97319e-06,
-    (float)2.40686e-05,
-    (float)3.85448e-05,
-    (float)4.93292e-06,
-    (float)3.6526e-05,
-    (float)1.96493e-05,
-    (float)6.63266e-06,
-    (float)4.34923e-05,
-    (float)5.51536e-06,
-    (float)9.71783e-06,
-    (float)3.26494e-05,
-    (float)5.21873e-06,
-    (float)2.15488e-05,
-    (float)1.03359e-05,
-    (float)1.21731e-05,
-    (float)3.37375e-05,
-    (float)3.18684e-07,
-    (float)2.47396e-05,
-    (float)2.78524e-05,
-    (float)5.86602e-06,
-    (float)4.60604e-05,
-    (float)1.09007e-05,
-    (float)9.64324e-06,
-    (float)5.85285e-05,
-    (float)4.69869e-06,
-    (float)1.08158e-05,
-    (float)4.33454e-05,
-    (float)7.0864e-06,
-    (float)1.77234e-05,
-    (float)1.60194e-05,
-    (float)4.06512e-06,
-    (float)2.05329e-05,
-    (float)1.94512e-06,
-    (float)1.08339e-07,
-    (float)1.13368e-05,
-    (float)1.60691e-07,
-    (float)1.44505e-06,
-    (float)2.95566e-06,
-    (float)6.30665e-07,
-    (float)1.48131e-06,
-    (float)2.34149e-06,
-    (float)2.08164e-06,
-    (float)1.00015e-09,
-    (float)0.386893,
-    (float)0.00482426,
-    (float)0.064973,
-    (float)0.0478813,
-    (float)0.018656,
-    (float)0.0371161,
-    (float)0.0233193,
-    (float)0.0489824,
-    (float)0.0130615,
-    (float)0.00706629,
-    (float)0.0635373,
-    (float)0.0074111,
-    (float)0.0012403,
-    (float)0.0500714,
-    (float)0.0108729,
-    (float)0.0122224,
-    (float)0.0237533,
-    (float)0.00884202,
-    (float)0.0277476,
-    (float)0.00578894,
-    (float)0.00245675,
-    (float)0.0316629,
-    (float)0.00119694,
-    (float)0.000944417,
-    (float)0.0217385,
-    (float)0.00187068,
-    (float)0.00627847,
-    (float)0.00851596,
-    (float)0.00106103,
-    (float)0.0111646,
-    (float)0.00135827,
-    (float)4.76512e-05,
-    (float)0.00985615,
-    (float)5.7217e-06,
-    (float)0.00161007,
-    (float)0.00475463,
-    (float)6.70319e-05,
-    (float)0.00408533,
-    (float)0.00100389,
-    (float)8.50589e-05,
-    (float)0.00435123,
-    (float)6.42153e-05,
-    (float)0.000971612,
-    (float)0.0023663,
-    (float)0.000161031,
-    (float)0.00246225,
-    (float)0.000496007,
-    (float)9.07648e-05,
-    (float)0.00301204,
-    (float)4.15996e-06,
-    (float)0.000230887,
-    (float)0.00213962,
-    (float)0.000217805,
-    (float)0.0008635,
-    (float)0.000846526,
-    (float)0.000256607,
-    (float)0.00145773,
-    (float)0.000131626,
-    (float)7.37914e-05,
-    (float)0.00145686,
-    (float)7.31793e-05,
-    (float)1.74285e-05,
-    (float)0.000947285,
-    (float)0.000200363,
-    (float)0.000168452,
-    (float)0.000404509,
-    (float)0.000196636,
-    (float)0.000326262,
-    (float)0.000128925,
-    (float)8.56848e-05,
-    (float)0.0003269,
-    (float)8.32842e-05,
-    (float)7.82064e-06,
-    (float)0.000201056,
-    (float)8.84354e-05,
-    (float)5.81878e-06,
-    (float)8.31814e-05,
-    (float)5.54827e-05,
-    (float)2.08552e-05,
-    (float)3.40738e-05,
-    (float)1.67117e-05,
-    (float)1.58729e-05,
-    (float)1.89395e-05,
-    (float)4.15171e-06,
-    (float)6.49446e-06,
-    (float)7.29214e-06,
-    (float)5.2887e-06,
-    (float)5.13204e-06,
-    (float)1.71805e-06,
-    (float)5.27579e-06,
-    (float)4.98482e-06,
-    (float)3.32335e-06,
-    (float)4.51365e-06,
-    (float)2.99857e-06,
-    (float)4.40346e-06,
-    (float)3.40451e-06,
-    (float)2.96602e-06,
-    (float)4.03833e-06,
-    (float)1.6518e-06,
-    (float)5.29653e-06,
-    (float)6.01421e-06,
-    (float)1.2537e-06,
-    (float)9.71196e-06,
-    (float)1.32562e-05,
-    (float)4.71802e-06,
-    (float)1.44773e-05,
-    (float)2.26239e-05,
-    (float)1.87906e-05,
-    (float)2.01766e-05,
-    (float)2.05623e-05,
-    (float)4.19779e-05,
-    (float)3.77874e-05,
-    (float)5.24775e-06,
-    (float)5.06327e-05,
-    (float)6.40216e-05,
-    (float)5.62467e-06,
-    (float)3.48464e-05,
-    (float)6.34972e-05,
-    (float)3.39346e-05,
-    (float)2.67601e-05,
-    (float)2.59278e-05,
-    (float)5.16803e-05,
-    (float)4.47788e-05,
-    (float)4.94265e-07,
-    (float)3.26029e-05,
-    (float)5.22857e-05,
-    (float)2.27638e-05,
-    (float)1.45254e-05,
-    (float)0.187617,
-    (float)0.00285152,
-    (float)0.0581672,
-    (float)0.0284159,
-    (float)0.0184033,
-    (float)0.0317902,
-    (float)0.0174774,
-    (float)0.0493763,
-    (float)0.00850024,
-    (float)0.00525682,
-    (float)0.0675551,
-    (float)0.00463497,
-    (float)0.000861132,
-    (float)0.0558229,
-    (float)0.0116942,
-    (float)0.0159937,
-    (float)0.0270132,
-    (float)0.0117632,
-    (float)0.0400133,
-    (float)0.00591803,
-    (float)0.00381966,
-    (float)0.0513812,
-    (float)0.0020504,
-    (float)0.00100842,
-    (float)0.0408919,
-    (float)0.00627178,
-    (float)0.011258,
-    (float)0.0193009,
-    (float)0.00624655,
-    (float)0.0262902,
-    (float)0.00406177,
-    (float)0.00163851,
-    (float)0.0315044,
-    (float)0.000801056,
-    (float)0.000922082,
-    (float)0.0231404,
-    (float)0.00239175,
-    (float)0.00727883,
-    (float)0.0100634,
-    (float)0.00192813,
-    (float)0.0144292,
-    (float)0.00195218,
-    (float)0.000159225,
-    (float)0.0151629,
-    (float)0.000251976,
-    (float)0.00104066,
-    (float)0.00964339,
-    (float)0.000575932,
-    (float)0.00453337,
-    (float)0.00349757,
-    (float)0.000222451,
-    (float)0.00684873,
-    (float)0.000525058,
-    (float)0.000129028,
-    (float)0.00577257,
-    (float)9.65127e-05,
-    (float)0.00138228,
-    (float)0.00282366,
-    (float)0.000144409,
-    (float)0.00294603,
-    (float)0.000643104,
-    (float)0.00010973,
-    (float)0.00315571,
-    (float)4.50085e-05,
-    (float)0.000567914,
-    (float)0.00192607,
-    (float)0.000127633,
-    (float)0.00150151,
-    (float)0.000556512,
-    (float)0.00011651,
-    (float)0.002061,
-    (float)3.89509e-05,
-    (float)0.000151825,
-    (float)0.00166645,
-    (float)0.000201378,
-    (float)0.000594275,
-    (float)0.000728376,
-    (float)0.000322601,
-    (float)0.00122968,
-    (float)0.000123992,
-    (float)0.000149632,
-    (float)0.00144695,
-    (float)0.000191538,
-    (float)5.14974e-05,
-    (float)0.00101712,
-    (float)0.000491858,
-    (float)0.000337521,
-    (float)0.000387834,
-    (float)0.000484204,
-    (float)0.000764403,
-    (float)0.000137766,
-    (float)0.000183505,
-    (float)0.000860922,
-    (float)0.000306548,
-    (float)3.96349e-06,
-    (float)0.000558393,
-    (float)0.000469804,
-    (float)0.000127787,
-    (float)0.000218556,
-    (float)0.000359266,
-    (float)0.000322975,
-    (float)0.000120513,
-    (float)0.000121571,
-    (float)0.000335386,
-    (float)0.0001823,
-    (float)3.08707e-06,
-    (float)0.000196041,
-    (float)0.000192715,
-    (float)2.91964e-05,
-    (float)7.84237e-05,
-    (float)0.000109777,
-    (float)7.14965e-05,
-    (float)4.32889e-05,
-    (float)2.87428e-05,
-    (float)6.36274e-05,
-    (float)3.78352e-05,
-    (float)2.71911e-06,
-    (float)3.37114e-05,
-    (float)2.36301e-05,
-    (float)7.42034e-06,
-    (float)1.45627e-05,
-    (float)8.96599e-06,
-    (float)1.09865e-05,
-    (float)7.64585e-06,
-    (float)4.4578e-06,
-    (float)8.48122e-06,
-    (float)6.27315e-06,
-    (float)4.66298e-06,
-    (float)0.000684993,
-    (float)0.00192902,
-    (float)0.0350133,
-    (float)0.00376401,
-    (float)0.0132494,
-    (float)0.0202208,
-    (float)0.00461521,
-    (float)0.033332,
-    (float)0.00473423,
-    (float)0.00105122,
-    (float)0.0467344,
-    (float)9.16902e-05,
-    (float)0.00166133,
-    (float)0.0399481,
-    (float)0.00371911,
-    (float)0.0148729,
-    (float)0.0199304,
-    (float)0.00452325,
-    (float)0.0343303,
-    (float)0.00388049,
-    (float)0.000845616,
-    (float)0.0446866,
-    (float)0.000160621,
-    (float)0.00165102,
-    (float)0.0371971,
-    (float)0.00353485,
-    (float)0.0139977,
-    (float)0.0182997,
-    (float)0.00412351,
-    (float)0.0318774,
-    (float)0.00337571,
-    (float)0.000659246,
-    (float)0.0404618,
-    (float)0.000253365,
-    (float)0.00172451,
-    (float)0.0324289,
-    (float)0.00315586,
-    (float)0.0129609,
-    (float)0.0153333,
-    (float)0.00327696,
-    (float)0.0279569,
-    (float)0.00272923,
-    (float)0.000372907,
-    (float)0.0340276,
-    (float)0.00032936,
-    (float)0.00187744,
-    (float)0.0260904,
-    (float)0.00249378,
-    (float)0.0115246,
-    (float)0.0117813,
-    (float)0.00220002,
-    (float)0.0229328,
-    (float)0.00210031,
-    (float)0.000116029,
-    (float)0.0263803,
-    (float)0.000378265,
-    (float)0.00196228,
-    (float)0.0193449,
-    (float)0.00171914,
-    (float)0.00956893,
-    (float)0.00846959,
-    (float)0.00125381,
-    (float)0.0174681,
-    (float)0.00165203,
-    (float)9.44266e-06,
-    (float)0.0189887,
-    (float)0.000471221,
-    (float)0.00187802,
-    (float)0.0134173,
-    (float)0.00116129,
-    (float)0.00739324,
-    (float)0.00587081,
-    (float)0.000702163,
-    (float)0.0124838,
-    (float)0.00143777,
-    (float)5.05901e-05,
-    (float)0.0129702,
-    (float)0.00070907,
-    (float)0.00165448,
-    (float)0.00894129,
-    (float)0.00100843,
-    (float)0.00547657,
-    (float)0.00405437,
-    (float)0.000535676,
-    (float)0.00866451,
-    (float)0.00143912,
-    (float)0.00013946,
-    (float)0.00866389,
-    (float)0.00111394,
-    (float)0.00142667,
-    (float)0.00586359,
-    (float)0.00114,
-    (float)0.0041329,
-    (float)0.00289157,
-    (float)0.000518791,
-    (float)0.00611186,
-    (float)0.00162021,
-    (float)0.000202693,
-    (float)0.00578169,
-    (float)0.00156596,
-    (float)0.00134032,
-    (float)0.00384424,
-    (float)0.00125219,
-    (float)0.00336356,
-    (float)0.00227551,
-    (float)0.000432928,
-    (float)0.00447335,
-    (float)0.00193141,
-    (float)0.000280925,
-    (float)0.00387539,
-    (float)0.00186823,
-    (float)0.00145615,
-    (float)0.00265999,
-    (float)0.00113103,
-    (float)0.00294761,
-    (float)0.00217848,
-    (float)0.000271756,
-    (float)0.00334791,
-    (float)0.00229589,
-    (float)0.000477059,
-    (float)0.00270598,
-    (float)0.0018976,
-    (float)0.00170136,
-    (float)0.00227998,
-    (float)0.000808414,
-    (float)0.00263618,
-    (float)0.00256677,
-    (float)0.000187693,
-};
-HarmData sweep4_coeff = { harm_data, 120, 128 };
@@ -1,15366 +0,0 @@
-#include <StdAfx.h>
-/*file generated by write_harm_data.m*/
-#include "HarmData.h"
-static float harm_data[120*128]={
-    (float)3.27754e-06,
-    (float)4.67466e-05,
-    (float)0.999397,
-    (float)6.59608e-05,
-    (float)2.19042e-05,
-    (float)7.16762e-06,
-    (float)9.27421e-06,
-    (float)8.25373e-06,
-    (float)0.000224206,
-    (float)4.47289e-06,
-    (float)2.64773e-06,
-    (float)6.06368e-06,
-    (float)4.63596e-06,
-    (float)1.15226e-05,
-    (float)6.62592e-05,
-    (float)3.34987e-06,
-    (float)7.74752e-07,
-    (float)1.32547e-06,
-    (float)9.29359e-06,
-    (float)7.72578e-06,
-    (float)3.3092e-05,
-    (float)1.35504e-06,
-    (float)4.16805e-07,
-    (float)3.01989e-06,
-    (float)4.32626e-06,
-    (float)1.18994e-05,
-    (float)7.90857e-06,
-    (float)2.55396e-06,
-    (float)4.1761e-07,
-    (float)1.55036e-06,
-    (float)6.15758e-06,
-    (float)3.3335e-06,
-    (float)1.28659e-06,
-    (float)1.73875e-07,
-    (float)1.34835e-07,
-    (float)1.01484e-06,
-    (float)7.41594e-07,
-    (float)2.62083e-06,
-    (float)4.0345e-07,
-    (float)5.64527e-07,
-    (float)1.03958e-07,
-    (float)5.94269e-07,
-    (float)4.60646e-07,
-    (float)4.85656e-08,
-    (float)2.86922e-07,
-    (float)6.69482e-08,
-    (float)5.10232e-07,
-    (float)5.79374e-07,
-    (float)8.851e-07,
-    (float)1.17544e-07,
-    (float)4.70994e-08,
-    (float)7.43673e-08,
-    (float)3.90004e-08,
-    (float)2.61822e-07,
-    (float)6.30199e-07,
-    (float)1.45689e-06,
-    (float)4.32659e-07,
-    (float)1.29125e-07,
-    (float)5.01517e-07,
-    (float)4.63221e-07,
-    (float)1.48403e-06,
-    (float)3.91567e-07,
-    (float)1.62066e-07,
-    (float)6.90908e-08,
-    (float)3.42521e-08,
-    (float)5.18284e-08,
-    (float)9.54653e-08,
-    (float)2.47236e-07,
-    (float)4.60298e-08,
-    (float)4.41714e-08,
-    (float)9.41767e-08,
-    (float)1.91003e-07,
-    (float)1.12379e-07,
-    (float)7.63468e-08,
-    (float)1.02437e-07,
-    (float)7.80393e-08,
-    (float)4.63288e-08,
-    (float)1.48468e-07,
-    (float)3.8031e-07,
-    (float)2.31528e-07,
-    (float)8.01262e-08,
-    (float)1.60687e-07,
-    (float)7.39386e-08,
-    (float)5.764e-07,
-    (float)2.00674e-07,
-    (float)1.75627e-08,
-    (float)3.9782e-08,
-    (float)1.95606e-08,
-    (float)3.24901e-08,
-    (float)3.38012e-08,
-    (float)1.34716e-07,
-    (float)5.58412e-08,
-    (float)4.43329e-08,
-    (float)3.46567e-08,
-    (float)3.90792e-08,
-    (float)1.28759e-07,
-    (float)4.81641e-08,
-    (float)1.56114e-07,
-    (float)8.44313e-08,
-    (float)1.70877e-07,
-    (float)3.70649e-08,
-    (float)5.17553e-08,
-    (float)9.57956e-08,
-    (float)4.62109e-08,
-    (float)5.78302e-08,
-    (float)1.29658e-08,
-    (float)1.57296e-07,
-    (float)5.02659e-08,
-    (float)1.28589e-07,
-    (float)2.32344e-09,
-    (float)1.19484e-08,
-    (float)1.51152e-08,
-    (float)2.14489e-08,
-    (float)1.96519e-07,
-    (float)3.69387e-08,
-    (float)6.0813e-08,
-    (float)9.23102e-08,
-    (float)1.00186e-07,
-    (float)8.45201e-08,
-    (float)5.19913e-08,
-    (float)2.83626e-09,
-    (float)3.01065e-08,
-    (float)9.03183e-08,
-    (float)2.99588e-08,
-    (float)3.18401e-08,
-    (float)7.26538e-08,
-    (float)4.37342e-08,
-    (float)9.483e-08,
-    (float)1.0779e-05,
-    (float)0.000513473,
-    (float)0.998842,
-    (float)0.000112187,
-    (float)2.09952e-05,
-    (float)7.18622e-07,
-    (float)0.000138968,
-    (float)4.31989e-05,
-    (float)0.000101236,
-    (float)6.79121e-06,
-    (float)3.48825e-06,
-    (float)1.26768e-06,
-    (float)1.43086e-05,
-    (float)1.02746e-05,
-    (float)3.58732e-05,
-    (float)4.79379e-06,
-    (float)1.48955e-06,
-    (float)2.00332e-06,
-    (float)1.07538e-05,
-    (float)5.60335e-06,
-    (float)4.68981e-05,
-    (float)1.87854e-06,
-    (float)1.59332e-06,
-    (float)4.52539e-06,
-    (float)3.97512e-06,
-    (float)1.16829e-05,
-    (float)8.27757e-06,
-    (float)3.1428e-06,
-    (float)6.54481e-07,
-    (float)1.884e-06,
-    (float)7.48715e-06,
-    (float)2.83272e-06,
-    (float)6.9219e-07,
-    (float)1.51852e-07,
-    (float)3.20266e-07,
-    (float)9.47057e-07,
-    (float)1.44563e-06,
-    (float)2.53035e-06,
-    (float)5.90833e-07,
-    (float)1.09288e-06,
-    (float)7.73852e-08,
-    (float)9.77538e-07,
-    (float)9.10696e-07,
-    (float)7.7318e-09,
-    (float)1.8382e-07,
-    (float)2.90386e-08,
-    (float)5.66962e-07,
-    (float)7.57506e-07,
-    (float)7.70906e-07,
-    (float)2.80314e-08,
-    (float)2.41488e-08,
-    (float)1.56388e-08,
-    (float)8.87495e-09,
-    (float)3.25859e-07,
-    (float)6.96624e-07,
-    (float)1.5186e-06,
-    (float)1.32612e-07,
-    (float)1.91567e-07,
-    (float)2.81077e-07,
-    (float)5.64597e-07,
-    (float)2.00684e-06,
-    (float)3.00898e-07,
-    (float)2.11831e-07,
-    (float)5.62096e-08,
-    (float)7.85978e-09,
-    (float)1.35621e-07,
-    (float)4.45137e-07,
-    (float)3.46243e-07,
-    (float)1.81481e-08,
-    (float)8.49885e-08,
-    (float)1.25704e-07,
-    (float)1.29307e-07,
-    (float)4.55738e-08,
-    (float)4.0038e-08,
-    (float)1.24486e-07,
-    (float)1.34442e-07,
-    (float)7.65782e-08,
-    (float)1.89121e-07,
-    (float)3.82244e-07,
-    (float)1.57988e-07,
-    (float)2.63723e-08,
-    (float)8.79681e-08,
-    (float)3.67813e-08,
-    (float)6.0435e-07,
-    (float)3.07859e-07,
-    (float)1.0489e-07,
-    (float)6.59199e-08,
-    (float)1.26075e-07,
-    (float)7.43193e-08,
-    (float)1.00491e-07,
-    (float)8.96808e-08,
-    (float)6.67378e-09,
-    (float)4.63806e-08,
-    (float)9.06844e-09,
-    (float)6.5216e-08,
-    (float)2.73365e-07,
-    (float)3.4635e-08,
-    (float)1.539e-07,
-    (float)3.76492e-08,
-    (float)1.87797e-07,
-    (float)7.1391e-08,
-    (float)1.11676e-07,
-    (float)1.9661e-07,
-    (float)1.97052e-08,
-    (float)4.69958e-08,
-    (float)2.80785e-08,
-    (float)1.00667e-07,
-    (float)3.36108e-09,
-    (float)1.19454e-07,
-    (float)4.55294e-09,
-    (float)5.80215e-08,
-    (float)5.58944e-08,
-    (float)1.05416e-08,
-    (float)1.99645e-07,
-    (float)8.58183e-10,
-    (float)1.49712e-07,
-    (float)6.39025e-08,
-    (float)8.09518e-08,
-    (float)1.10161e-07,
-    (float)1.06229e-07,
-    (float)7.27003e-09,
-    (float)1.84691e-08,
-    (float)1.1297e-07,
-    (float)9.55118e-08,
-    (float)2.8604e-08,
-    (float)8.39751e-08,
-    (float)4.28367e-08,
-    (float)6.45318e-08,
-    (float)7.09477e-05,
-    (float)0.00302571,
-    (float)0.995848,
-    (float)0.000171063,
-    (float)2.05023e-05,
-    (float)9.78996e-06,
-    (float)0.000454731,
-    (float)0.000110579,
-    (float)2.78592e-05,
-    (float)9.86196e-06,
-    (float)2.56017e-05,
-    (float)1.62303e-07,
-    (float)2.66294e-05,
-    (float)9.24605e-06,
-    (float)1.42655e-05,
-    (float)7.10873e-06,
-    (float)5.29377e-06,
-    (float)2.96035e-06,
-    (float)1.52729e-05,
-    (float)4.10803e-06,
-    (float)5.7486e-05,
-    (float)2.34266e-06,
-    (float)3.59262e-06,
-    (float)6.35289e-06,
-    (float)3.91648e-06,
-    (float)1.11442e-05,
-    (float)9.13494e-06,
-    (float)3.94612e-06,
-    (float)1.08158e-06,
-    (float)2.49022e-06,
-    (float)8.30068e-06,
-    (float)2.33517e-06,
-    (float)4.01271e-07,
-    (float)2.13282e-07,
-    (float)7.27393e-07,
-    (float)1.13361e-06,
-    (float)2.19117e-06,
-    (float)2.17826e-06,
-    (float)7.41267e-07,
-    (float)1.66452e-06,
-    (float)9.42991e-08,
-    (float)1.5328e-06,
-    (float)1.35542e-06,
-    (float)5.50296e-08,
-    (float)1.69517e-07,
-    (float)1.97467e-09,
-    (float)6.60961e-07,
-    (float)7.10322e-07,
-    (float)6.3912e-07,
-    (float)1.72383e-09,
-    (float)9.62482e-08,
-    (float)1.64259e-08,
-    (float)1.45458e-08,
-    (float)2.78023e-07,
-    (float)6.82362e-07,
-    (float)1.315e-06,
-    (float)4.56621e-08,
-    (float)2.37299e-07,
-    (float)1.23409e-07,
-    (float)7.41761e-07,
-    (float)2.06847e-06,
-    (float)1.10027e-07,
-    (float)3.87361e-07,
-    (float)3.62245e-08,
-    (float)6.17348e-08,
-    (float)4.38491e-07,
-    (float)6.85696e-07,
-    (float)2.93738e-07,
-    (float)7.20012e-09,
-    (float)1.41346e-07,
-    (float)7.99496e-08,
-    (float)1.36648e-07,
-    (float)1.20264e-07,
-    (float)7.97118e-08,
-    (float)2.31424e-07,
-    (float)8.93348e-08,
-    (float)1.0219e-07,
-    (float)1.78523e-07,
-    (float)2.4334e-07,
-    (float)4.45017e-08,
-    (float)8.03138e-09,
-    (float)3.66575e-08,
-    (float)2.83126e-08,
-    (float)6.81358e-07,
-    (float)2.91983e-07,
-    (float)1.51937e-07,
-    (float)1.04389e-07,
-    (float)2.57318e-07,
-    (float)1.24044e-07,
-    (float)1.54307e-07,
-    (float)5.72395e-08,
-    (float)2.19932e-09,
-    (float)5.12037e-08,
-    (float)1.27109e-08,
-    (float)6.39969e-08,
-    (float)3.33753e-07,
-    (float)1.43456e-08,
-    (float)1.53128e-07,
-    (float)1.25025e-08,
-    (float)2.2705e-07,
-    (float)7.58691e-08,
-    (float)2.17302e-07,
-    (float)2.54685e-07,
-    (float)8.95747e-09,
-    (float)5.96303e-08,
-    (float)1.15873e-08,
-    (float)1.06262e-07,
-    (float)6.09336e-09,
-    (float)7.28558e-08,
-    (float)2.49249e-08,
-    (float)1.26373e-07,
-    (float)9.20078e-08,
-    (float)3.07174e-08,
-    (float)1.82422e-07,
-    (float)2.28793e-10,
-    (float)1.23874e-07,
-    (float)5.26851e-08,
-    (float)8.22012e-08,
-    (float)7.05881e-08,
-    (float)6.26408e-08,
-    (float)2.86729e-08,
-    (float)6.69711e-09,
-    (float)1.42064e-07,
-    (float)1.42978e-07,
-    (float)7.40649e-08,
-    (float)4.50282e-08,
-    (float)1.85659e-08,
-    (float)1.28845e-07,
-    (float)0.000185798,
-    (float)0.0082176,
-    (float)0.989787,
-    (float)0.000240518,
-    (float)1.99337e-05,
-    (float)3.79601e-05,
-    (float)0.000958077,
-    (float)0.000216958,
-    (float)6.2182e-07,
-    (float)1.33467e-05,
-    (float)6.63646e-05,
-    (float)1.67405e-06,
-    (float)3.82379e-05,
-    (float)9.31446e-06,
-    (float)3.07309e-06,
-    (float)1.06182e-05,
-    (float)9.9517e-06,
-    (float)4.08057e-06,
-    (float)2.20546e-05,
-    (float)3.32082e-06,
-    (float)6.31289e-05,
-    (float)2.43005e-06,
-    (float)6.70762e-06,
-    (float)8.16276e-06,
-    (float)3.44836e-06,
-    (float)1.0423e-05,
-    (float)9.7571e-06,
-    (float)4.51693e-06,
-    (float)1.34852e-06,
-    (float)3.03674e-06,
-    (float)8.34915e-06,
-    (float)1.57261e-06,
-    (float)2.46273e-07,
-    (float)2.35552e-07,
-    (float)1.21248e-06,
-    (float)1.40714e-06,
-    (float)2.98467e-06,
-    (float)1.5808e-06,
-    (float)7.62165e-07,
-    (float)2.08453e-06,
-    (float)2.36478e-07,
-    (float)2.26918e-06,
-    (float)1.75537e-06,
-    (float)1.24733e-07,
-    (float)2.34625e-07,
-    (float)2.19425e-08,
-    (float)6.02699e-07,
-    (float)6.58925e-07,
-    (float)3.57623e-07,
-    (float)6.96381e-08,
-    (float)1.97922e-07,
-    (float)2.33426e-08,
-    (float)3.99608e-08,
-    (float)2.76426e-07,
-    (float)4.29112e-07,
-    (float)8.94608e-07,
-    (float)7.01749e-09,
-    (float)2.60575e-07,
-    (float)2.80343e-08,
-    (float)8.96505e-07,
-    (float)1.65221e-06,
-    (float)6.26777e-09,
-    (float)5.77335e-07,
-    (float)8.01013e-08,
-    (float)2.83058e-07,
-    (float)8.13011e-07,
-    (float)6.80676e-07,
-    (float)1.39266e-07,
-    (float)6.23071e-08,
-    (float)1.7659e-07,
-    (float)8.11814e-08,
-    (float)3.1262e-07,
-    (float)3.38379e-07,
-    (float)1.34132e-07,
-    (float)2.69612e-07,
-    (float)8.06539e-08,
-    (float)5.96609e-08,
-    (float)1.02093e-07,
-    (float)8.93071e-08,
-    (float)3.33048e-08,
-    (float)1.15321e-08,
-    (float)1.11239e-08,
-    (float)8.12275e-08,
-    (float)5.52672e-07,
-    (float)1.74603e-07,
-    (float)9.5105e-08,
-    (float)1.66806e-07,
-    (float)3.51276e-07,
-    (float)2.09355e-07,
-    (float)7.27223e-08,
-    (float)4.888e-08,
-    (float)1.10194e-08,
-    (float)3.80461e-08,
-    (float)3.91051e-08,
-    (float)3.08829e-08,
-    (float)1.95966e-07,
-    (float)2.82804e-08,
-    (float)1.35385e-07,
-    (float)1.85457e-08,
-    (float)3.07864e-07,
-    (float)5.1243e-08,
-    (float)2.0423e-07,
-    (float)1.95123e-07,
-    (float)6.34029e-09,
-    (float)5.94914e-08,
-    (float)3.6999e-09,
-    (float)1.16024e-07,
-    (float)7.01315e-09,
-    (float)7.87283e-08,
-    (float)6.65162e-08,
-    (float)2.02778e-07,
-    (float)9.31374e-08,
-    (float)2.30084e-08,
-    (float)8.31988e-08,
-    (float)1.2238e-08,
-    (float)7.30046e-08,
-    (float)5.92614e-08,
-    (float)7.0427e-08,
-    (float)3.64995e-08,
-    (float)5.90387e-08,
-    (float)2.77091e-08,
-    (float)8.3145e-09,
-    (float)1.294e-07,
-    (float)1.52069e-07,
-    (float)1.54579e-07,
-    (float)7.63076e-08,
-    (float)1.2164e-08,
-    (float)1.79944e-07,
-    (float)0.000357268,
-    (float)0.0168027,
-    (float)0.979957,
-    (float)0.000314594,
-    (float)1.92842e-05,
-    (float)8.73311e-05,
-    (float)0.00164391,
-    (float)0.000369761,
-    (float)1.43344e-05,
-    (float)1.80737e-05,
-    (float)0.000122777,
-    (float)5.44381e-06,
-    (float)4.59337e-05,
-    (float)1.06156e-05,
-    (float)2.05175e-06,
-    (float)1.40897e-05,
-    (float)1.37443e-05,
-    (float)5.12224e-06,
-    (float)3.10923e-05,
-    (float)2.40062e-06,
-    (float)6.42589e-05,
-    (float)2.32487e-06,
-    (float)1.09925e-05,
-    (float)9.54916e-06,
-    (float)3.18879e-06,
-    (float)9.09388e-06,
-    (float)1.04722e-05,
-    (float)4.97559e-06,
-    (float)1.33317e-06,
-    (float)3.72122e-06,
-    (float)8.24819e-06,
-    (float)9.20765e-07,
-    (float)3.36344e-07,
-    (float)2.79249e-07,
-    (float)1.7141e-06,
-    (float)1.74303e-06,
-    (float)3.49065e-06,
-    (float)1.06718e-06,
-    (float)6.54766e-07,
-    (float)2.37929e-06,
-    (float)3.31051e-07,
-    (float)3.0278e-06,
-    (float)2.23723e-06,
-    (float)1.43216e-07,
-    (float)4.06978e-07,
-    (float)1.00868e-07,
-    (float)6.01776e-07,
-    (float)5.10897e-07,
-    (float)1.61576e-07,
-    (float)1.97989e-07,
-    (float)2.83316e-07,
-    (float)3.98281e-08,
-    (float)4.97026e-08,
-    (float)2.28117e-07,
-    (float)1.50104e-07,
-    (float)6.68088e-07,
-    (float)6.82121e-10,
-    (float)3.43062e-07,
-    (float)1.45204e-08,
-    (float)8.86034e-07,
-    (float)9.52482e-07,
-    (float)1.03617e-08,
-    (float)6.53231e-07,
-    (float)1.5491e-07,
-    (float)7.16219e-07,
-    (float)8.9634e-07,
-    (float)4.86443e-07,
-    (float)1.54654e-07,
-    (float)1.57062e-07,
-    (float)2.15637e-07,
-    (float)2.62926e-07,
-    (float)4.3859e-07,
-    (float)4.37501e-07,
-    (float)1.16527e-07,
-    (float)2.49664e-07,
-    (float)6.04217e-08,
-    (float)6.08027e-08,
-    (float)6.00509e-08,
-    (float)1.39944e-07,
-    (float)1.06618e-07,
-    (float)1.69893e-08,
-    (float)1.15912e-08,
-    (float)9.41753e-08,
-    (float)3.06475e-07,
-    (float)5.47939e-08,
-    (float)4.31578e-08,
-    (float)1.83907e-07,
-    (float)4.16982e-07,
-    (float)3.14852e-07,
-    (float)6.83848e-08,
-    (float)3.5728e-08,
-    (float)5.23058e-08,
-    (float)5.70386e-08,
-    (float)7.84742e-08,
-    (float)3.64589e-08,
-    (float)8.46787e-08,
-    (float)4.91297e-08,
-    (float)9.79632e-08,
-    (float)1.4559e-08,
-    (float)3.81853e-07,
-    (float)3.57343e-08,
-    (float)1.48124e-07,
-    (float)1.49573e-07,
-    (float)1.41002e-08,
-    (float)7.03745e-08,
-    (float)5.17864e-08,
-    (float)1.5782e-07,
-    (float)1.52595e-08,
-    (float)7.36398e-08,
-    (float)5.22655e-08,
-    (float)1.97188e-07,
-    (float)7.94669e-08,
-    (float)4.42041e-09,
-    (float)3.51271e-08,
-    (float)5.6484e-08,
-    (float)1.08555e-07,
-    (float)1.09074e-07,
-    (float)2.29626e-08,
-    (float)4.7159e-08,
-    (float)1.36228e-07,
-    (float)8.47814e-09,
-    (float)6.53541e-09,
-    (float)5.67749e-08,
-    (float)9.85423e-08,
-    (float)1.64058e-07,
-    (float)1.31483e-07,
-    (float)1.14543e-08,
-    (float)2.95542e-07,
-    (float)0.000582603,
-    (float)0.0297059,
-    (float)0.965461,
-    (float)0.000395274,
-    (float)1.88634e-05,
-    (float)0.00016139,
-    (float)0.00251152,
-    (float)0.000561557,
-    (float)6.24811e-05,
-    (float)2.38987e-05,
-    (float)0.000192272,
-    (float)9.65697e-06,
-    (float)4.64305e-05,
-    (float)1.38896e-05,
-    (float)1.09709e-05,
-    (float)1.69181e-05,
-    (float)1.48738e-05,
-    (float)6.12292e-06,
-    (float)4.04526e-05,
-    (float)1.55564e-06,
-    (float)5.98409e-05,
-    (float)2.31503e-06,
-    (float)1.47198e-05,
-    (float)1.07259e-05,
-    (float)2.87164e-06,
-    (float)7.77037e-06,
-    (float)1.06048e-05,
-    (float)5.26434e-06,
-    (float)1.27195e-06,
-    (float)4.36784e-06,
-    (float)7.95349e-06,
-    (float)4.80952e-07,
-    (float)4.00105e-07,
-    (float)2.87388e-07,
-    (float)2.12613e-06,
-    (float)2.09439e-06,
-    (float)3.81732e-06,
-    (float)6.09739e-07,
-    (float)4.82183e-07,
-    (float)2.18642e-06,
-    (float)4.36036e-07,
-    (float)4.09593e-06,
-    (float)2.34836e-06,
-    (float)1.15565e-07,
-    (float)4.43287e-07,
-    (float)2.39442e-07,
-    (float)7.26763e-07,
-    (float)2.57287e-07,
-    (float)7.41302e-08,
-    (float)2.51125e-07,
-    (float)3.81618e-07,
-    (float)8.9713e-08,
-    (float)4.37132e-08,
-    (float)1.60061e-07,
-    (float)7.07317e-08,
-    (float)5.8793e-07,
-    (float)3.04287e-09,
-    (float)3.80201e-07,
-    (float)3.41999e-08,
-    (float)6.28649e-07,
-    (float)5.30009e-07,
-    (float)4.4973e-08,
-    (float)5.5722e-07,
-    (float)4.07969e-07,
-    (float)9.82003e-07,
-    (float)6.68884e-07,
-    (float)3.23886e-07,
-    (float)1.32587e-07,
-    (float)1.08117e-07,
-    (float)1.9935e-07,
-    (float)5.20198e-07,
-    (float)5.67213e-07,
-    (float)2.51577e-07,
-    (float)4.55498e-08,
-    (float)1.86393e-07,
-    (float)9.04752e-08,
-    (float)2.29984e-07,
-    (float)4.27638e-08,
-    (float)1.96754e-07,
-    (float)1.16735e-07,
-    (float)4.89383e-08,
-    (float)7.57928e-09,
-    (float)4.32198e-08,
-    (float)1.17449e-07,
-    (float)1.79055e-08,
-    (float)7.33129e-08,
-    (float)1.47359e-07,
-    (float)4.25504e-07,
-    (float)3.32167e-07,
-    (float)7.0749e-08,
-    (float)4.47733e-08,
-    (float)7.54443e-08,
-    (float)7.05292e-08,
-    (float)4.40743e-08,
-    (float)2.58497e-08,
-    (float)7.89148e-08,
-    (float)4.47909e-08,
-    (float)2.79401e-08,
-    (float)8.76452e-10,
-    (float)3.29793e-07,
-    (float)6.52368e-08,
-    (float)1.006e-07,
-    (float)1.45546e-07,
-    (float)7.59966e-08,
-    (float)3.41003e-08,
-    (float)7.63283e-08,
-    (float)1.19509e-07,
-    (float)6.30109e-08,
-    (float)9.33002e-08,
-    (float)1.32036e-08,
-    (float)2.05691e-07,
-    (float)5.43927e-08,
-    (float)1.84772e-09,
-    (float)2.75314e-08,
-    (float)9.96883e-08,
-    (float)1.7719e-07,
-    (float)9.07574e-08,
-    (float)7.47911e-09,
-    (float)4.94111e-08,
-    (float)1.07254e-07,
-    (float)8.32383e-09,
-    (float)3.01722e-09,
-    (float)2.12009e-08,
-    (float)8.29314e-08,
-    (float)1.39548e-07,
-    (float)5.53759e-08,
-    (float)5.10317e-08,
-    (float)3.36786e-07,
-    (float)0.000860758,
-    (float)0.0478445,
-    (float)0.945415,
-    (float)0.000476168,
-    (float)1.90672e-05,
-    (float)0.000260504,
-    (float)0.00353084,
-    (float)0.000799882,
-    (float)0.000139106,
-    (float)3.08682e-05,
-    (float)0.000269795,
-    (float)1.4359e-05,
-    (float)4.15181e-05,
-    (float)1.93738e-05,
-    (float)2.85034e-05,
-    (float)1.96097e-05,
-    (float)1.38132e-05,
-    (float)7.29706e-06,
-    (float)4.90218e-05,
-    (float)1.06088e-06,
-    (float)5.23102e-05,
-    (float)2.23775e-06,
-    (float)1.7836e-05,
-    (float)1.1506e-05,
-    (float)2.63209e-06,
-    (float)6.64967e-06,
-    (float)1.02361e-05,
-    (float)5.31192e-06,
-    (float)1.11362e-06,
-    (float)5.1405e-06,
-    (float)7.33857e-06,
-    (float)1.52157e-07,
-    (float)4.85839e-07,
-    (float)3.48748e-07,
-    (float)2.58848e-06,
-    (float)2.59786e-06,
-    (float)3.88874e-06,
-    (float)3.57153e-07,
-    (float)2.59486e-07,
-    (float)1.9393e-06,
-    (float)5.70209e-07,
-    (float)5.4938e-06,
-    (float)2.30926e-06,
-    (float)1.87827e-07,
-    (float)4.21617e-07,
-    (float)4.33021e-07,
-    (float)1.02861e-06,
-    (float)8.04478e-08,
-    (float)1.48577e-08,
-    (float)3.02902e-07,
-    (float)3.82668e-07,
-    (float)1.27595e-07,
-    (float)4.60335e-08,
-    (float)1.29084e-07,
-    (float)9.35599e-08,
-    (float)4.45592e-07,
-    (float)1.14945e-08,
-    (float)3.56446e-07,
-    (float)3.42361e-08,
-    (float)3.7899e-07,
-    (float)2.51758e-07,
-    (float)1.18176e-07,
-    (float)4.05683e-07,
-    (float)7.28793e-07,
-    (float)1.18806e-06,
-    (float)4.15827e-07,
-    (float)2.83443e-07,
-    (float)1.3403e-07,
-    (float)3.73324e-08,
-    (float)2.52939e-07,
-    (float)7.83254e-07,
-    (float)6.16736e-07,
-    (float)4.60156e-08,
-    (float)6.03864e-08,
-    (float)1.43418e-07,
-    (float)1.73782e-07,
-    (float)6.64982e-07,
-    (float)1.02879e-07,
-    (float)1.93519e-07,
-    (float)6.5165e-08,
-    (float)9.13869e-08,
-    (float)1.91805e-08,
-    (float)6.7836e-08,
-    (float)8.15599e-08,
-    (float)3.51776e-08,
-    (float)9.30393e-08,
-    (float)9.77064e-08,
-    (float)2.61399e-07,
-    (float)3.03555e-07,
-    (float)7.61028e-08,
-    (float)6.71309e-08,
-    (float)1.21022e-07,
-    (float)8.6257e-08,
-    (float)4.46098e-09,
-    (float)2.4191e-08,
-    (float)4.3592e-08,
-    (float)4.06492e-08,
-    (float)3.17362e-09,
-    (float)4.15501e-08,
-    (float)2.24021e-07,
-    (float)1.03407e-07,
-    (float)1.23857e-07,
-    (float)1.50972e-07,
-    (float)2.37044e-07,
-    (float)3.67611e-08,
-    (float)6.45983e-08,
-    (float)5.14171e-08,
-    (float)9.31009e-08,
-    (float)1.04594e-07,
-    (float)2.62837e-08,
-    (float)2.27945e-07,
-    (float)4.48336e-08,
-    (float)8.5125e-09,
-    (float)4.02899e-08,
-    (float)1.24235e-07,
-    (float)2.52913e-07,
-    (float)4.39587e-08,
-    (float)7.29577e-09,
-    (float)5.48518e-08,
-    (float)6.04502e-08,
-    (float)1.71543e-08,
-    (float)3.50636e-08,
-    (float)5.55758e-09,
-    (float)1.17591e-07,
-    (float)7.42345e-08,
-    (float)2.50468e-08,
-    (float)1.58088e-07,
-    (float)2.76855e-07,
-    (float)0.00118421,
-    (float)0.0722165,
-    (float)0.918881,
-    (float)0.000552046,
-    (float)1.93786e-05,
-    (float)0.000385339,
-    (float)0.00467438,
-    (float)0.00108153,
-    (float)0.000236456,
-    (float)4.02148e-05,
-    (float)0.000349259,
-    (float)1.80965e-05,
-    (float)3.14438e-05,
-    (float)2.85973e-05,
-    (float)5.22687e-05,
-    (float)2.02871e-05,
-    (float)1.12298e-05,
-    (float)8.53185e-06,
-    (float)5.4669e-05,
-    (float)4.8353e-07,
-    (float)4.31543e-05,
-    (float)1.84548e-06,
-    (float)2.0322e-05,
-    (float)1.20011e-05,
-    (float)2.98007e-06,
-    (float)5.57758e-06,
-    (float)9.40824e-06,
-    (float)5.21628e-06,
-    (float)9.5808e-07,
-    (float)5.80076e-06,
-    (float)6.95735e-06,
-    (float)1.58366e-08,
-    (float)6.2263e-07,
-    (float)5.20901e-07,
-    (float)3.41337e-06,
-    (float)2.76465e-06,
-    (float)3.89445e-06,
-    (float)2.41302e-07,
-    (float)1.59185e-07,
-    (float)1.62479e-06,
-    (float)9.08843e-07,
-    (float)6.60144e-06,
-    (float)2.26255e-06,
-    (float)2.81201e-07,
-    (float)5.29587e-07,
-    (float)6.25301e-07,
-    (float)1.60807e-06,
-    (float)4.72612e-09,
-    (float)3.08752e-09,
-    (float)3.587e-07,
-    (float)3.56365e-07,
-    (float)9.14069e-08,
-    (float)5.6014e-08,
-    (float)7.83209e-08,
-    (float)1.39046e-07,
-    (float)3.55852e-07,
-    (float)1.65253e-08,
-    (float)3.01175e-07,
-    (float)3.26387e-08,
-    (float)3.17902e-07,
-    (float)1.22291e-07,
-    (float)2.16858e-07,
-    (float)2.79898e-07,
-    (float)8.74793e-07,
-    (float)1.10297e-06,
-    (float)1.91277e-07,
-    (float)2.66637e-07,
-    (float)7.33197e-08,
-    (float)3.61694e-08,
-    (float)4.14944e-07,
-    (float)8.32273e-07,
-    (float)6.33036e-07,
-    (float)7.09485e-08,
-    (float)1.54655e-07,
-    (float)8.79122e-08,
-    (float)2.1321e-07,
-    (float)1.07009e-06,
-    (float)1.54536e-07,
-    (float)1.93858e-07,
-    (float)2.93852e-08,
-    (float)1.26172e-07,
-    (float)8.08415e-08,
-    (float)1.88307e-07,
-    (float)1.54108e-07,
-    (float)4.55395e-08,
-    (float)9.55985e-08,
-    (float)1.05542e-07,
-    (float)1.4205e-07,
-    (float)2.23289e-07,
-    (float)8.44309e-08,
-    (float)5.0011e-08,
-    (float)2.16552e-07,
-    (float)7.24283e-08,
-    (float)1.78247e-08,
-    (float)6.83389e-08,
-    (float)1.71896e-08,
-    (float)8.91416e-08,
-    (float)4.57655e-08,
-    (float)7.92968e-08,
-    (float)1.98544e-07,
-    (float)7.64326e-08,
-    (float)1.20727e-07,
-    (float)1.04198e-07,
-    (float)3.81759e-07,
-    (float)8.38039e-08,
-    (float)1.79811e-08,
-    (float)1.96493e-08,
-    (float)1.80233e-07,
-    (float)1.51528e-07,
-    (float)1.13111e-07,
-    (float)2.25939e-07,
-    (float)4.34399e-08,
-    (float)6.95137e-08,
-    (float)2.9907e-08,
-    (float)1.17893e-07,
-    (float)2.28058e-07,
-    (float)7.30206e-09,
-    (float)6.57005e-09,
-    (float)3.37005e-08,
-    (float)5.70959e-08,
-    (float)3.56197e-08,
-    (float)1.03055e-07,
-    (float)2.11057e-08,
-    (float)1.81414e-07,
-    (float)1.70118e-08,
-    (float)2.25249e-08,
-    (float)2.16098e-07,
-    (float)1.15475e-07,
-    (float)0.00153982,
-    (float)0.103782,
-    (float)0.885001,
-    (float)0.000626792,
-    (float)1.92034e-05,
-    (float)0.000533558,
-    (float)0.00589885,
-    (float)0.00139305,
-    (float)0.000341326,
-    (float)4.90637e-05,
-    (float)0.000423824,
-    (float)1.93005e-05,
-    (float)1.82207e-05,
-    (float)4.06418e-05,
-    (float)7.80418e-05,
-    (float)1.95154e-05,
-    (float)7.26733e-06,
-    (float)9.30568e-06,
-    (float)5.56738e-05,
-    (float)1.57225e-07,
-    (float)3.30275e-05,
-    (float)1.41908e-06,
-    (float)2.0443e-05,
-    (float)1.21853e-05,
-    (float)3.84498e-06,
-    (float)4.52156e-06,
-    (float)7.97604e-06,
-    (float)5.08818e-06,
-    (float)8.57468e-07,
-    (float)6.09131e-06,
-    (float)6.60901e-06,
-    (float)2.06281e-08,
-    (float)6.60603e-07,
-    (float)9.51019e-07,
-    (float)3.9906e-06,
-    (float)2.47522e-06,
-    (float)3.61765e-06,
-    (float)3.89233e-07,
-    (float)9.99201e-08,
-    (float)1.06351e-06,
-    (float)1.0266e-06,
-    (float)7.13054e-06,
-    (float)2.07457e-06,
-    (float)5.62226e-07,
-    (float)3.526e-07,
-    (float)7.42521e-07,
-    (float)2.23056e-06,
-    (float)3.54224e-08,
-    (float)1.35206e-08,
-    (float)2.76758e-07,
-    (float)3.67387e-07,
-    (float)8.59809e-08,
-    (float)9.36613e-08,
-    (float)5.77217e-08,
-    (float)1.76034e-07,
-    (float)3.95739e-07,
-    (float)2.58448e-08,
-    (float)3.19971e-07,
-    (float)3.41949e-08,
-    (float)2.80748e-07,
-    (float)9.18803e-08,
-    (float)2.2604e-07,
-    (float)2.28604e-07,
-    (float)8.30975e-07,
-    (float)8.05718e-07,
-    (float)4.22985e-08,
-    (float)2.73109e-07,
-    (float)2.15112e-08,
-    (float)1.74846e-07,
-    (float)5.21517e-07,
-    (float)5.38266e-07,
-    (float)3.83783e-07,
-    (float)2.02937e-07,
-    (float)2.72142e-07,
-    (float)1.75948e-07,
-    (float)4.17252e-07,
-    (float)1.01214e-06,
-    (float)1.29985e-07,
-    (float)2.78272e-07,
-    (float)1.88188e-08,
-    (float)1.55141e-07,
-    (float)1.57615e-07,
-    (float)2.7827e-07,
-    (float)1.79154e-07,
-    (float)3.0725e-08,
-    (float)1.04437e-07,
-    (float)1.5314e-07,
-    (float)1.32537e-07,
-    (float)1.32392e-07,
-    (float)1.64656e-07,
-    (float)3.35447e-08,
-    (float)1.92056e-07,
-    (float)7.41465e-08,
-    (float)2.24587e-08,
-    (float)1.57765e-07,
-    (float)2.7559e-08,
-    (float)1.34384e-07,
-    (float)6.40362e-08,
-    (float)5.04166e-08,
-    (float)1.87878e-07,
-    (float)5.03956e-08,
-    (float)5.69227e-08,
-    (float)2.90586e-08,
-    (float)3.6067e-07,
-    (float)1.37246e-07,
-    (float)2.26313e-08,
-    (float)3.73261e-08,
-    (float)2.71771e-07,
-    (float)2.07188e-07,
-    (float)1.13113e-07,
-    (float)1.2531e-07,
-    (float)5.8672e-08,
-    (float)1.03241e-07,
-    (float)9.24087e-09,
-    (float)1.41017e-07,
-    (float)1.12827e-07,
-    (float)6.94068e-09,
-    (float)7.88116e-09,
-    (float)1.87383e-08,
-    (float)1.17266e-07,
-    (float)3.14243e-08,
-    (float)1.5574e-07,
-    (float)7.20448e-08,
-    (float)1.25605e-07,
-    (float)6.38586e-09,
-    (float)1.29931e-08,
-    (float)1.91132e-07,
-    (float)7.10718e-08,
-    (float)0.00191953,
-    (float)0.143334,
-    (float)0.843083,
-    (float)0.000693758,
-    (float)1.95065e-05,
-    (float)0.000699542,
-    (float)0.00712782,
-    (float)0.00172986,
-    (float)0.000445908,
-    (float)5.65938e-05,
-    (float)0.000487469,
-    (float)1.81546e-05,
-    (float)6.87824e-06,
-    (float)5.67375e-05,
-    (float)0.000104251,
-    (float)1.85935e-05,
-    (float)3.78662e-06,
-    (float)1.00976e-05,
-    (float)5.32438e-05,
-    (float)2.87649e-07,
-    (float)2.29947e-05,
-    (float)9.2383e-07,
-    (float)1.96626e-05,
-    (float)1.1967e-05,
-    (float)5.08854e-06,
-    (float)3.3701e-06,
-    (float)6.08021e-06,
-    (float)4.66829e-06,
-    (float)6.42485e-07,
-    (float)6.13535e-06,
-    (float)6.11854e-06,
-    (float)1.58197e-07,
-    (float)6.24875e-07,
-    (float)1.66802e-06,
-    (float)4.12982e-06,
-    (float)2.0588e-06,
-    (float)3.20573e-06,
-    (float)8.0933e-07,
-    (float)1.24969e-07,
-    (float)6.45346e-07,
-    (float)1.01424e-06,
-    (float)7.40461e-06,
-    (float)1.81307e-06,
-    (float)1.10248e-06,
-    (float)2.01623e-07,
-    (float)8.33198e-07,
-    (float)2.82831e-06,
-    (float)1.4659e-07,
-    (float)9.46464e-08,
-    (float)2.00632e-07,
-    (float)3.52054e-07,
-    (float)8.63972e-08,
-    (float)1.82242e-07,
-    (float)8.32332e-08,
-    (float)2.31343e-07,
-    (float)4.50342e-07,
-    (float)4.5184e-08,
-    (float)2.7374e-07,
-    (float)1.20926e-07,
-    (float)2.13505e-07,
-    (float)4.99534e-08,
-    (float)2.32952e-07,
-    (float)2.43998e-07,
-    (float)8.34649e-07,
-    (float)4.03622e-07,
-    (float)7.73907e-09,
-    (float)2.72907e-07,
-    (float)4.9468e-08,
-    (float)3.66327e-07,
-    (float)5.54685e-07,
-    (float)1.80624e-07,
-    (float)1.66121e-07,
-    (float)3.43812e-07,
-    (float)3.63667e-07,
-    (float)5.0233e-07,
-    (float)6.28261e-07,
-    (float)6.55338e-07,
-    (float)8.06665e-08,
-    (float)3.79224e-07,
-    (float)1.60199e-08,
-    (float)3.27348e-07,
-    (float)1.80444e-07,
-    (float)3.12382e-07,
-    (float)1.2452e-07,
-    (float)1.90673e-08,
-    (float)1.76473e-07,
-    (float)2.84087e-07,
-    (float)1.78791e-07,
-    (float)5.78282e-08,
-    (float)1.4579e-07,
-    (float)7.25829e-08,
-    (float)8.78554e-08,
-    (float)6.57396e-08,
-    (float)3.78144e-08,
-    (float)2.64006e-07,
-    (float)9.49859e-08,
-    (float)8.60277e-08,
-    (float)4.37476e-08,
-    (float)1.42127e-08,
-    (float)9.74351e-08,
-    (float)2.05633e-08,
-    (float)9.95461e-09,
-    (float)4.73526e-08,
-    (float)2.73788e-07,
-    (float)1.54898e-07,
-    (float)6.04895e-08,
-    (float)1.04289e-07,
-    (float)4.10718e-07,
-    (float)3.14995e-07,
-    (float)6.08995e-08,
-    (float)2.84283e-08,
-    (float)5.8293e-08,
-    (float)1.00932e-07,
-    (float)4.37984e-08,
-    (float)1.20103e-07,
-    (float)1.23799e-08,
-    (float)9.75362e-09,
-    (float)1.37531e-08,
-    (float)7.28446e-09,
-    (float)2.03917e-07,
-    (float)5.73158e-08,
-    (float)1.68802e-07,
-    (float)1.29702e-07,
-    (float)6.40625e-08,
-    (float)1.14695e-08,
-    (float)5.09781e-08,
-    (float)1.16145e-07,
-    (float)8.04822e-08,
-    (float)0.0022957,
-    (float)0.191369,
-    (float)0.792764,
-    (float)0.000746601,
-    (float)1.99303e-05,
-    (float)0.000880831,
-    (float)0.00830022,
-    (float)0.00206728,
-    (float)0.000541289,
-    (float)6.54945e-05,
-    (float)0.000535388,
-    (float)1.43872e-05,
-    (float)4.96927e-07,
-    (float)7.62952e-05,
-    (float)0.000127632,
-    (float)1.55743e-05,
-    (float)1.19219e-06,
-    (float)1.02204e-05,
-    (float)4.66595e-05,
-    (float)1.40936e-06,
-    (float)1.44939e-05,
-    (float)5.57397e-07,
-    (float)1.80821e-05,
-    (float)1.16322e-05,
-    (float)6.28861e-06,
-    (float)2.25863e-06,
-    (float)4.12571e-06,
-    (float)4.30151e-06,
-    (float)5.79535e-07,
-    (float)6.06983e-06,
-    (float)5.68221e-06,
-    (float)3.1899e-07,
-    (float)6.6938e-07,
-    (float)2.41883e-06,
-    (float)4.31415e-06,
-    (float)1.59385e-06,
-    (float)3.0565e-06,
-    (float)1.07137e-06,
-    (float)2.53287e-07,
-    (float)4.19293e-07,
-    (float)1.19934e-06,
-    (float)7.24604e-06,
-    (float)1.70534e-06,
-    (float)1.50033e-06,
-    (float)1.59157e-07,
-    (float)8.71214e-07,
-    (float)3.59783e-06,
-    (float)2.79252e-07,
-    (float)2.56608e-07,
-    (float)2.14474e-07,
-    (float)3.55273e-07,
-    (float)7.63449e-08,
-    (float)3.95963e-07,
-    (float)4.3651e-08,
-    (float)3.01755e-07,
-    (float)4.31572e-07,
-    (float)5.87097e-08,
-    (float)2.42289e-07,
-    (float)1.76782e-07,
-    (float)1.66941e-07,
-    (float)3.43946e-08,
-    (float)3.35112e-07,
-    (float)4.1269e-07,
-    (float)7.29296e-07,
-    (float)2.66498e-07,
-    (float)4.63061e-08,
-    (float)2.53081e-07,
-    (float)1.24662e-07,
-    (float)3.85981e-07,
-    (float)4.19698e-07,
-    (float)5.31339e-08,
-    (float)1.32678e-07,
-    (float)3.21568e-07,
-    (float)5.89682e-07,
-    (float)8.60157e-07,
-    (float)7.26363e-07,
-    (float)2.79635e-07,
-    (float)9.63465e-08,
-    (float)3.88892e-07,
-    (float)1.87307e-08,
-    (float)4.89835e-07,
-    (float)1.51431e-07,
-    (float)2.01759e-07,
-    (float)8.48958e-08,
-    (float)1.78582e-08,
-    (float)2.97315e-07,
-    (float)4.38612e-07,
-    (float)2.03709e-07,
-    (float)7.51597e-08,
-    (float)1.04883e-07,
-    (float)1.62739e-07,
-    (float)3.16283e-08,
-    (float)4.47417e-08,
-    (float)1.0837e-07,
-    (float)2.04215e-07,
-    (float)1.51588e-07,
-    (float)1.66467e-08,
-    (float)9.12156e-08,
-    (float)9.64999e-09,
-    (float)1.75257e-08,
-    (float)3.75438e-08,
-    (float)8.42828e-09,
-    (float)1.02126e-07,
-    (float)3.26686e-07,
-    (float)8.25107e-08,
-    (float)1.38122e-07,
-    (float)1.57836e-07,
-    (float)4.58495e-07,
-    (float)4.65568e-07,
-    (float)1.05588e-08,
-    (float)1.74847e-08,
-    (float)6.22018e-08,
-    (float)1.03389e-07,
-    (float)1.06234e-07,
-    (float)7.32076e-08,
-    (float)4.33495e-09,
-    (float)3.81313e-08,
-    (float)4.0542e-08,
-    (float)9.03884e-09,
-    (float)1.96529e-07,
-    (float)8.77272e-08,
-    (float)1.22422e-07,
-    (float)1.11127e-07,
-    (float)1.20367e-08,
-    (float)3.14627e-08,
-    (float)1.16068e-07,
-    (float)9.65255e-08,
-    (float)1.30876e-07,
-    (float)0.00264877,
-    (float)0.247808,
-    (float)0.734299,
-    (float)0.000779666,
-    (float)2.02049e-05,
-    (float)0.00105964,
-    (float)0.00932906,
-    (float)0.00238723,
-    (float)0.000614672,
-    (float)7.34976e-05,
-    (float)0.000560483,
-    (float)9.91065e-06,
-    (float)2.57648e-06,
-    (float)9.63186e-05,
-    (float)0.000143195,
-    (float)1.18989e-05,
-    (float)1.22943e-07,
-    (float)9.57423e-06,
-    (float)3.6217e-05,
-    (float)3.69423e-06,
-    (float)8.45373e-06,
-    (float)3.05321e-07,
-    (float)1.53551e-05,
-    (float)1.12708e-05,
-    (float)6.78593e-06,
-    (float)1.41112e-06,
-    (float)2.62728e-06,
-    (float)4.23028e-06,
-    (float)5.43665e-07,
-    (float)5.63983e-06,
-    (float)5.17504e-06,
-    (float)3.98083e-07,
-    (float)7.11266e-07,
-    (float)3.15512e-06,
-    (float)4.05991e-06,
-    (float)8.11374e-07,
-    (float)2.57439e-06,
-    (float)1.20914e-06,
-    (float)4.54853e-07,
-    (float)7.14519e-07,
-    (float)1.02784e-06,
-    (float)5.92443e-06,
-    (float)1.29919e-06,
-    (float)1.92656e-06,
-    (float)1.62492e-07,
-    (float)1.19742e-06,
-    (float)3.77248e-06,
-    (float)3.46321e-07,
-    (float)5.48261e-07,
-    (float)2.75025e-07,
-    (float)4.60601e-07,
-    (float)1.28839e-07,
-    (float)5.21586e-07,
-    (float)1.27227e-08,
-    (float)2.69607e-07,
-    (float)3.13742e-07,
-    (float)7.90429e-08,
-    (float)3.41324e-07,
-    (float)2.37528e-07,
-    (float)1.86282e-07,
-    (float)2.27672e-08,
-    (float)4.54983e-07,
-    (float)7.91111e-07,
-    (float)4.64731e-07,
-    (float)2.19062e-07,
-    (float)6.86754e-08,
-    (float)2.38666e-07,
-    (float)1.81352e-07,
-    (float)1.75234e-07,
-    (float)1.92398e-07,
-    (float)1.79665e-07,
-    (float)1.44435e-07,
-    (float)2.61376e-07,
-    (float)6.99901e-07,
-    (float)8.65852e-07,
-    (float)6.07329e-07,
-    (float)2.8094e-08,
-    (float)1.8274e-07,
-    (float)2.38409e-07,
-    (float)4.75906e-08,
-    (float)5.81012e-07,
-    (float)1.10699e-07,
-    (float)1.18578e-07,
-    (float)9.21611e-08,
-    (float)3.25116e-08,
-    (float)3.06614e-07,
-    (float)5.3692e-07,
-    (float)2.02388e-07,
-    (float)1.71285e-07,
-    (float)1.25097e-07,
-    (float)2.76288e-07,
-    (float)5.51359e-08,
-    (float)1.17969e-08,
-    (float)1.68211e-07,
-    (float)1.16157e-07,
-    (float)8.10456e-08,
-    (float)5.55501e-08,
-    (float)4.99335e-08,
-    (float)4.3035e-08,
-    (float)6.61141e-09,
-    (float)8.54145e-08,
-    (float)9.52013e-09,
-    (float)6.26303e-08,
-    (float)2.74173e-07,
-    (float)4.71537e-08,
-    (float)1.93012e-07,
-    (float)1.77615e-07,
-    (float)3.26933e-07,
-    (float)4.26176e-07,
-    (float)4.68529e-08,
-    (float)1.35331e-08,
-    (float)7.14588e-08,
-    (float)1.3268e-07,
-    (float)1.05586e-07,
-    (float)3.68485e-08,
-    (float)2.097e-08,
-    (float)4.26608e-08,
-    (float)3.93639e-08,
-    (float)1.15813e-08,
-    (float)1.0024e-07,
-    (float)1.49017e-07,
-    (float)8.86954e-08,
-    (float)6.28406e-08,
-    (float)1.11506e-08,
-    (float)3.35709e-08,
-    (float)1.99733e-07,
-    (float)9.79875e-08,
-    (float)1.29003e-07,
-    (float)0.00295252,
-    (float)0.311884,
-    (float)0.668602,
-    (float)0.000791394,
-    (float)2.05233e-05,
-    (float)0.00122376,
-    (float)0.0101255,
-    (float)0.00266399,
-    (float)0.000663573,
-    (float)7.90797e-05,
-    (float)0.000561665,
-    (float)5.17996e-06,
-    (float)1.5126e-05,
-    (float)0.000114179,
-    (float)0.000151694,
-    (float)8.08005e-06,
-    (float)5.63339e-07,
-    (float)8.73743e-06,
-    (float)2.48691e-05,
-    (float)6.88674e-06,
-    (float)4.0415e-06,
-    (float)1.61838e-07,
-    (float)1.19875e-05,
-    (float)1.06961e-05,
-    (float)6.84951e-06,
-    (float)8.319e-07,
-    (float)1.50445e-06,
-    (float)3.82474e-06,
-    (float)4.58934e-07,
-    (float)4.99173e-06,
-    (float)4.42663e-06,
-    (float)4.83292e-07,
-    (float)6.5819e-07,
-    (float)4.3926e-06,
-    (float)3.80368e-06,
-    (float)3.14263e-07,
-    (float)1.98934e-06,
-    (float)1.43948e-06,
-    (float)7.57263e-07,
-    (float)1.37684e-06,
-    (float)9.53705e-07,
-    (float)4.66134e-06,
-    (float)9.87295e-07,
-    (float)2.39935e-06,
-    (float)3.25855e-07,
-    (float)1.65583e-06,
-    (float)3.64909e-06,
-    (float)4.45913e-07,
-    (float)9.0668e-07,
-    (float)3.35764e-07,
-    (float)6.85773e-07,
-    (float)2.56027e-07,
-    (float)5.68875e-07,
-    (float)1.89425e-09,
-    (float)2.33066e-07,
-    (float)2.48823e-07,
-    (float)7.06756e-08,
-    (float)4.81896e-07,
-    (float)2.88055e-07,
-    (float)1.88654e-07,
-    (float)3.74297e-08,
-    (float)4.20195e-07,
-    (float)1.11715e-06,
-    (float)2.49453e-07,
-    (float)1.75587e-07,
-    (float)1.02786e-07,
-    (float)1.83284e-07,
-    (float)1.92004e-07,
-    (float)5.54522e-08,
-    (float)5.39522e-08,
-    (float)3.26514e-07,
-    (float)1.20776e-07,
-    (float)2.7068e-07,
-    (float)8.06378e-07,
-    (float)6.32818e-07,
-    (float)3.69135e-07,
-    (float)1.867e-08,
-    (float)2.93422e-07,
-    (float)7.39649e-08,
-    (float)1.17361e-07,
-    (float)4.63287e-07,
-    (float)9.53536e-08,
-    (float)1.96729e-07,
-    (float)6.58509e-08,
-    (float)9.50037e-08,
-    (float)2.35777e-07,
-    (float)5.8177e-07,
-    (float)1.98247e-07,
-    (float)2.59528e-07,
-    (float)2.88816e-07,
-    (float)3.20785e-07,
-    (float)8.55662e-08,
-    (float)6.15668e-09,
-    (float)1.48096e-07,
-    (float)1.22063e-07,
-    (float)9.96283e-09,
-    (float)1.85397e-07,
-    (float)2.60419e-09,
-    (float)6.28284e-08,
-    (float)1.34803e-08,
-    (float)1.0446e-07,
-    (float)6.75913e-08,
-    (float)6.40382e-08,
-    (float)1.35634e-07,
-    (float)2.89121e-08,
-    (float)1.84049e-07,
-    (float)1.73017e-07,
-    (float)2.29878e-07,
-    (float)2.58831e-07,
-    (float)9.5269e-08,
-    (float)3.28068e-08,
-    (float)9.77504e-08,
-    (float)1.82841e-07,
-    (float)9.22907e-08,
-    (float)2.10275e-08,
-    (float)2.91478e-08,
-    (float)3.29663e-08,
-    (float)4.28475e-08,
-    (float)1.44544e-08,
-    (float)6.76443e-08,
-    (float)2.06518e-07,
-    (float)6.83287e-08,
-    (float)2.23342e-08,
-    (float)8.52619e-08,
-    (float)4.6246e-08,
-    (float)3.50131e-07,
-    (float)8.50174e-08,
-    (float)1.02323e-07,
-    (float)0.00317422,
-    (float)0.382219,
-    (float)0.597191,
-    (float)0.000780833,
-    (float)2.02928e-05,
-    (float)0.00136738,
-    (float)0.0106302,
-    (float)0.00286619,
-    (float)0.000682207,
-    (float)8.34701e-05,
-    (float)0.000538212,
-    (float)1.44809e-06,
-    (float)3.81931e-05,
-    (float)0.000128484,
-    (float)0.000152258,
-    (float)4.52512e-06,
-    (float)2.14485e-06,
-    (float)8.17866e-06,
-    (float)1.44639e-05,
-    (float)1.05904e-05,
-    (float)1.49267e-06,
-    (float)3.52526e-07,
-    (float)8.79086e-06,
-    (float)1.03907e-05,
-    (float)6.31102e-06,
-    (float)5.70889e-07,
-    (float)9.03932e-07,
-    (float)3.58876e-06,
-    (float)5.38352e-07,
-    (float)4.24072e-06,
-    (float)3.29676e-06,
-    (float)4.72886e-07,
-    (float)6.6254e-07,
-    (float)5.23199e-06,
-    (float)3.79519e-06,
-    (float)1.24865e-07,
-    (float)1.32248e-06,
-    (float)1.31144e-06,
-    (float)1.08579e-06,
-    (float)1.802e-06,
-    (float)1.08049e-06,
-    (float)3.39513e-06,
-    (float)7.38944e-07,
-    (float)2.39801e-06,
-    (float)6.60237e-07,
-    (float)1.7178e-06,
-    (float)3.33346e-06,
-    (float)4.45015e-07,
-    (float)1.21035e-06,
-    (float)5.62998e-07,
-    (float)8.63432e-07,
-    (float)3.28429e-07,
-    (float)5.34132e-07,
-    (float)1.26095e-08,
-    (float)2.79426e-07,
-    (float)1.46351e-07,
-    (float)7.02561e-08,
-    (float)5.79524e-07,
-    (float)3.55564e-07,
-    (float)1.6524e-07,
-    (float)5.21544e-08,
-    (float)4.3493e-07,
-    (float)1.28278e-06,
-    (float)1.85992e-07,
-    (float)1.48057e-07,
-    (float)2.17773e-07,
-    (float)1.77722e-07,
-    (float)1.33992e-07,
-    (float)7.09449e-08,
-    (float)9.31946e-08,
-    (float)3.68164e-07,
-    (float)4.51599e-08,
-    (float)2.34392e-07,
-    (float)8.17056e-07,
-    (float)2.80672e-07,
-    (float)2.49301e-07,
-    (float)6.84683e-08,
-    (float)3.43868e-07,
-    (float)4.4979e-08,
-    (float)1.65563e-07,
-    (float)3.05089e-07,
-    (float)9.06143e-08,
-    (float)3.0942e-07,
-    (float)6.96559e-08,
-    (float)1.19442e-07,
-    (float)1.99608e-07,
-    (float)4.56966e-07,
-    (float)2.06102e-07,
-    (float)2.21769e-07,
-    (float)4.56427e-07,
-    (float)2.82041e-07,
-    (float)8.34567e-08,
-    (float)6.01587e-08,
-    (float)1.13461e-07,
-    (float)1.85083e-07,
-    (float)8.19552e-09,
-    (float)2.34569e-07,
-    (float)6.40651e-08,
-    (float)3.67655e-08,
-    (float)4.21786e-08,
-    (float)4.86333e-08,
-    (float)1.01107e-07,
-    (float)1.83442e-07,
-    (float)2.50889e-08,
-    (float)6.28317e-08,
-    (float)1.50806e-07,
-    (float)1.50717e-07,
-    (float)1.9472e-07,
-    (float)6.81859e-08,
-    (float)1.67353e-07,
-    (float)4.73104e-08,
-    (float)1.2844e-07,
-    (float)2.25498e-07,
-    (float)9.31226e-08,
-    (float)2.49707e-08,
-    (float)1.97252e-08,
-    (float)2.3038e-08,
-    (float)2.3232e-08,
-    (float)3.58326e-08,
-    (float)7.31939e-08,
-    (float)2.0534e-07,
-    (float)1.08462e-07,
-    (float)2.39628e-09,
-    (float)1.35558e-07,
-    (float)5.04892e-08,
-    (float)3.03526e-07,
-    (float)9.42264e-08,
-    (float)3.48105e-08,
-    (float)0.00329902,
-    (float)0.456578,
-    (float)0.522397,
-    (float)0.000746607,
-    (float)1.93141e-05,
-    (float)0.00146677,
-    (float)0.0107922,
-    (float)0.00299344,
-    (float)0.000667599,
-    (float)8.44763e-05,
-    (float)0.000489517,
-    (float)1.38234e-06,
-    (float)6.93662e-05,
-    (float)0.000139179,
-    (float)0.000142685,
-    (float)2.06057e-06,
-    (float)4.0539e-06,
-    (float)8.18177e-06,
-    (float)6.50482e-06,
-    (float)1.47579e-05,
-    (float)4.25999e-07,
-    (float)9.29241e-07,
-    (float)6.05123e-06,
-    (float)1.02535e-05,
-    (float)5.21351e-06,
-    (float)5.29892e-07,
-    (float)9.27059e-07,
-    (float)3.29177e-06,
-    (float)5.79997e-07,
-    (float)3.57483e-06,
-    (float)2.31806e-06,
-    (float)3.06094e-07,
-    (float)7.27038e-07,
-    (float)5.43304e-06,
-    (float)3.53481e-06,
-    (float)1.13008e-07,
-    (float)8.48839e-07,
-    (float)8.6086e-07,
-    (float)1.17414e-06,
-    (float)2.08732e-06,
-    (float)1.04323e-06,
-    (float)2.12828e-06,
-    (float)5.55511e-07,
-    (float)1.93685e-06,
-    (float)9.66186e-07,
-    (float)1.89204e-06,
-    (float)2.43183e-06,
-    (float)4.86743e-07,
-    (float)1.30241e-06,
-    (float)8.39624e-07,
-    (float)1.28933e-06,
-    (float)3.9861e-07,
-    (float)3.63974e-07,
-    (float)2.48747e-08,
-    (float)2.8854e-07,
-    (float)7.22544e-08,
-    (float)6.56817e-08,
-    (float)5.21735e-07,
-    (float)4.12193e-07,
-    (float)1.17e-07,
-    (float)1.03909e-07,
-    (float)6.47295e-07,
-    (float)1.34662e-06,
-    (float)2.26097e-07,
-    (float)2.0747e-07,
-    (float)2.76872e-07,
-    (float)2.48583e-07,
-    (float)2.99243e-08,
-    (float)1.12115e-07,
-    (float)2.0622e-07,
-    (float)2.03751e-07,
-    (float)1.20176e-08,
-    (float)2.16065e-07,
-    (float)6.51916e-07,
-    (float)1.76754e-07,
-    (float)1.55653e-07,
-    (float)3.10736e-08,
-    (float)2.99872e-07,
-    (float)4.13508e-08,
-    (float)2.15686e-07,
-    (float)1.6114e-07,
-    (float)1.15535e-07,
-    (float)3.25957e-07,
-    (float)6.26909e-08,
-    (float)1.4534e-07,
-    (float)1.76415e-07,
-    (float)2.52607e-07,
-    (float)1.61702e-07,
-    (float)1.59593e-07,
-    (float)4.19108e-07,
-    (float)2.39675e-07,
-    (float)3.86314e-08,
-    (float)1.44424e-07,
-    (float)1.92886e-07,
-    (float)2.39529e-07,
-    (float)3.96234e-08,
-    (float)1.61753e-07,
-    (float)1.37411e-07,
-    (float)2.85298e-08,
-    (float)2.92134e-08,
-    (float)2.88169e-08,
-    (float)8.22237e-08,
-    (float)2.24603e-07,
-    (float)2.92146e-08,
-    (float)9.73086e-08,
-    (float)2.31284e-07,
-    (float)2.44578e-07,
-    (float)1.42897e-07,
-    (float)1.22543e-08,
-    (float)1.84121e-07,
-    (float)5.36341e-08,
-    (float)1.1869e-07,
-    (float)1.86176e-07,
-    (float)9.35628e-08,
-    (float)4.95875e-08,
-    (float)2.07145e-08,
-    (float)2.74118e-08,
-    (float)1.6771e-08,
-    (float)6.62328e-08,
-    (float)7.74752e-08,
-    (float)1.63104e-07,
-    (float)1.08933e-07,
-    (float)7.83734e-09,
-    (float)8.19193e-08,
-    (float)5.42396e-08,
-    (float)1.3868e-07,
-    (float)8.35136e-08,
-    (float)2.91335e-08,
-    (float)0.00331137,
-    (float)0.532501,
-    (float)0.446724,
-    (float)0.000699277,
-    (float)1.85964e-05,
-    (float)0.00151381,
-    (float)0.0105958,
-    (float)0.00301478,
-    (float)0.000625924,
-    (float)8.09124e-05,
-    (float)0.000425562,
-    (float)5.66632e-06,
-    (float)0.000104092,
-    (float)0.000143358,
-    (float)0.000128222,
-    (float)8.03452e-07,
-    (float)5.59129e-06,
-    (float)9.34213e-06,
-    (float)2.17767e-06,
-    (float)1.90147e-05,
-    (float)4.03884e-08,
-    (float)1.80496e-06,
-    (float)4.09713e-06,
-    (float)9.90595e-06,
-    (float)3.85795e-06,
-    (float)6.88927e-07,
-    (float)1.1902e-06,
-    (float)2.96757e-06,
-    (float)5.07497e-07,
-    (float)2.85266e-06,
-    (float)1.43587e-06,
-    (float)1.13956e-07,
-    (float)8.33974e-07,
-    (float)5.82236e-06,
-    (float)3.15721e-06,
-    (float)4.4781e-07,
-    (float)4.5809e-07,
-    (float)4.06637e-07,
-    (float)1.07215e-06,
-    (float)2.53294e-06,
-    (float)1.26429e-06,
-    (float)1.13993e-06,
-    (float)4.06408e-07,
-    (float)1.38902e-06,
-    (float)1.18196e-06,
-    (float)2.12193e-06,
-    (float)1.7516e-06,
-    (float)5.90993e-07,
-    (float)1.30659e-06,
-    (float)1.05425e-06,
-    (float)1.58079e-06,
-    (float)3.82085e-07,
-    (float)2.68116e-07,
-    (float)1.93181e-08,
-    (float)2.93252e-07,
-    (float)1.34347e-08,
-    (float)2.94747e-08,
-    (float)3.32762e-07,
-    (float)4.12614e-07,
-    (float)1.01578e-07,
-    (float)1.98103e-07,
-    (float)8.69412e-07,
-    (float)1.14967e-06,
-    (float)2.30015e-07,
-    (float)2.29498e-07,
-    (float)3.34407e-07,
-    (float)4.09344e-07,
-    (float)2.67438e-08,
-    (float)1.24338e-07,
-    (float)3.13709e-07,
-    (float)5.7621e-08,
-    (float)3.69441e-08,
-    (float)1.88516e-07,
-    (float)4.79638e-07,
-    (float)3.16653e-07,
-    (float)5.11678e-08,
-    (float)2.06875e-08,
-    (float)2.06556e-07,
-    (float)4.89002e-08,
-    (float)2.02986e-07,
-    (float)1.47959e-07,
-    (float)1.89001e-07,
-    (float)2.62583e-07,
-    (float)6.79558e-08,
-    (float)8.68089e-08,
-    (float)1.22335e-07,
-    (float)1.48168e-07,
-    (float)7.61324e-08,
-    (float)1.44342e-07,
-    (float)3.62199e-07,
-    (float)1.59166e-07,
-    (float)1.51054e-08,
-    (float)1.9782e-07,
-    (float)3.14634e-07,
-    (float)2.39522e-07,
-    (float)1.14868e-07,
-    (float)4.60773e-08,
-    (float)1.19846e-07,
-    (float)2.7035e-08,
-    (float)5.77051e-08,
-    (float)8.57696e-08,
-    (float)7.59598e-08,
-    (float)1.71359e-07,
-    (float)4.95378e-08,
-    (float)7.93428e-08,
-    (float)3.47471e-07,
-    (float)3.25059e-07,
-    (float)7.408e-08,
-    (float)1.76778e-08,
-    (float)1.31232e-07,
-    (float)9.3808e-08,
-    (float)6.63212e-08,
-    (float)9.81437e-08,
-    (float)1.22849e-07,
-    (float)7.0233e-08,
-    (float)1.51288e-08,
-    (float)3.31099e-08,
-    (float)2.72368e-08,
-    (float)1.15723e-07,
-    (float)6.44524e-08,
-    (float)1.37183e-07,
-    (float)1.10952e-07,
-    (float)1.54357e-08,
-    (float)4.42014e-08,
-    (float)3.72373e-08,
-    (float)7.93367e-08,
-    (float)8.36729e-08,
-    (float)3.08554e-08,
-    (float)0.00321082,
-    (float)0.607047,
-    (float)0.373077,
-    (float)0.000637372,
-    (float)1.77907e-05,
-    (float)0.00150662,
-    (float)0.0100661,
-    (float)0.00293352,
-    (float)0.000561915,
-    (float)7.41066e-05,
-    (float)0.000354215,
-    (float)1.47353e-05,
-    (float)0.000138931,
-    (float)0.000140029,
-    (float)0.000109302,
-    (float)3.41515e-07,
-    (float)6.59399e-06,
-    (float)1.30816e-05,
-    (float)1.24631e-06,
-    (float)2.22492e-05,
-    (float)3.5027e-08,
-    (float)2.94262e-06,
-    (float)2.72346e-06,
-    (float)1.02149e-05,
-    (float)2.81195e-06,
-    (float)1.05181e-06,
-    (float)1.52924e-06,
-    (float)2.68093e-06,
-    (float)4.06336e-07,
-    (float)2.38086e-06,
-    (float)7.06884e-07,
-    (float)2.3939e-08,
-    (float)9.07104e-07,
-    (float)5.92743e-06,
-    (float)2.81715e-06,
-    (float)9.38333e-07,
-    (float)1.8506e-07,
-    (float)1.2594e-07,
-    (float)8.37396e-07,
-    (float)2.67618e-06,
-    (float)1.63026e-06,
-    (float)6.1854e-07,
-    (float)2.63938e-07,
-    (float)8.21837e-07,
-    (float)1.25573e-06,
-    (float)1.96939e-06,
-    (float)1.35063e-06,
-    (float)5.40299e-07,
-    (float)1.2231e-06,
-    (float)1.27362e-06,
-    (float)1.65112e-06,
-    (float)3.46972e-07,
-    (float)1.88066e-07,
-    (float)3.71963e-08,
-    (float)3.47586e-07,
-    (float)1.41213e-08,
-    (float)1.92335e-08,
-    (float)1.62248e-07,
-    (float)3.97401e-07,
-    (float)5.11312e-08,
-    (float)3.29036e-07,
-    (float)1.06208e-06,
-    (float)8.68896e-07,
-    (float)2.41663e-07,
-    (float)1.65966e-07,
-    (float)4.09615e-07,
-    (float)5.67746e-07,
-    (float)1.3479e-07,
-    (float)6.66384e-08,
-    (float)3.45748e-07,
-    (float)2.05574e-08,
-    (float)8.54849e-08,
-    (float)3.26701e-07,
-    (float)2.52381e-07,
-    (float)4.56745e-07,
-    (float)3.09042e-08,
-    (float)2.78057e-08,
-    (float)1.77301e-07,
-    (float)1.77911e-08,
-    (float)1.95124e-07,
-    (float)2.19726e-07,
-    (float)2.38851e-07,
-    (float)2.31909e-07,
-    (float)6.83293e-08,
-    (float)3.75629e-08,
-    (float)9.01181e-08,
-    (float)1.01331e-07,
-    (float)4.67258e-08,
-    (float)1.51068e-07,
-    (float)3.17845e-07,
-    (float)9.30288e-08,
-    (float)4.18727e-08,
-    (float)1.36148e-07,
-    (float)4.638e-07,
-    (float)2.06607e-07,
-    (float)1.69724e-07,
-    (float)1.01492e-08,
-    (float)6.10464e-08,
-    (float)6.13063e-08,
-    (float)6.35035e-08,
-    (float)9.82108e-08,
-    (float)1.49361e-07,
-    (float)9.66329e-08,
-    (float)5.14345e-08,
-    (float)3.11536e-08,
-    (float)3.49295e-07,
-    (float)3.92298e-07,
-    (float)9.19197e-09,
-    (float)5.29976e-08,
-    (float)9.79258e-08,
-    (float)1.59734e-07,
-    (float)4.49824e-08,
-    (float)5.06232e-08,
-    (float)1.64127e-07,
-    (float)8.34495e-08,
-    (float)2.69162e-08,
-    (float)2.85458e-08,
-    (float)5.21042e-08,
-    (float)1.28395e-07,
-    (float)4.99144e-08,
-    (float)1.35159e-07,
-    (float)6.43909e-08,
-    (float)6.79083e-08,
-    (float)2.48184e-08,
-    (float)1.84307e-08,
-    (float)9.16844e-08,
-    (float)6.14009e-08,
-    (float)1.18216e-07,
-    (float)0.00301528,
-    (float)0.677531,
-    (float)0.304072,
-    (float)0.000561289,
-    (float)1.64899e-05,
-    (float)0.00143839,
-    (float)0.00923945,
-    (float)0.0027724,
-    (float)0.000482303,
-    (float)6.43176e-05,
-    (float)0.000278214,
-    (float)2.74952e-05,
-    (float)0.000166807,
-    (float)0.000130637,
-    (float)8.68642e-05,
-    (float)5.43153e-07,
-    (float)6.5162e-06,
-    (float)1.86661e-05,
-    (float)3.43518e-06,
-    (float)2.35644e-05,
-    (float)7.33562e-08,
-    (float)4.2456e-06,
-    (float)1.88473e-06,
-    (float)1.10657e-05,
-    (float)2.05133e-06,
-    (float)1.44422e-06,
-    (float)1.94264e-06,
-    (float)2.255e-06,
-    (float)2.34581e-07,
-    (float)2.13818e-06,
-    (float)2.59627e-07,
-    (float)3.66172e-09,
-    (float)9.90373e-07,
-    (float)5.48922e-06,
-    (float)2.42879e-06,
-    (float)1.35135e-06,
-    (float)1.06701e-07,
-    (float)1.87816e-09,
-    (float)5.10497e-07,
-    (float)2.37749e-06,
-    (float)1.76784e-06,
-    (float)3.56757e-07,
-    (float)3.95016e-07,
-    (float)3.62721e-07,
-    (float)1.10164e-06,
-    (float)1.59879e-06,
-    (float)8.61863e-07,
-    (float)5.74435e-07,
-    (float)8.19669e-07,
-    (float)1.55376e-06,
-    (float)1.62815e-06,
-    (float)3.23272e-07,
-    (float)5.23638e-08,
-    (float)8.01949e-08,
-    (float)4.96458e-07,
-    (float)1.63838e-08,
-    (float)4.23203e-08,
-    (float)6.78724e-08,
-    (float)3.6277e-07,
-    (float)1.69912e-09,
-    (float)3.8904e-07,
-    (float)9.74229e-07,
-    (float)6.32717e-07,
-    (float)3.5685e-07,
-    (float)5.47829e-08,
-    (float)3.4952e-07,
-    (float)7.69862e-07,
-    (float)2.02854e-07,
-    (float)3.61099e-08,
-    (float)2.20683e-07,
-    (float)2.91747e-08,
-    (float)9.31036e-08,
-    (float)5.00888e-07,
-    (float)1.4147e-07,
-    (float)3.65091e-07,
-    (float)2.07283e-08,
-    (float)5.07716e-08,
-    (float)1.05817e-07,
-    (float)2.68247e-08,
-    (float)1.63159e-07,
-    (float)2.15418e-07,
-    (float)2.76306e-07,
-    (float)1.61247e-07,
-    (float)8.58876e-08,
-    (float)3.04247e-08,
-    (float)9.56137e-08,
-    (float)8.62822e-08,
-    (float)3.82076e-08,
-    (float)1.3922e-07,
-    (float)2.66519e-07,
-    (float)2.97087e-08,
-    (float)2.86463e-08,
-    (float)1.21326e-07,
-    (float)4.16413e-07,
-    (float)1.80848e-07,
-    (float)1.32418e-07,
-    (float)5.9212e-08,
-    (float)1.18361e-07,
-    (float)8.87421e-08,
-    (float)1.27344e-08,
-    (float)3.48267e-08,
-    (float)1.81007e-07,
-    (float)1.07576e-07,
-    (float)7.63108e-09,
-    (float)1.22963e-09,
-    (float)2.74031e-07,
-    (float)2.63022e-07,
-    (float)8.28455e-10,
-    (float)5.72187e-08,
-    (float)1.1807e-07,
-    (float)2.97595e-07,
-    (float)3.7945e-08,
-    (float)3.19268e-08,
-    (float)1.98398e-07,
-    (float)9.56456e-08,
-    (float)5.08211e-08,
-    (float)1.89176e-09,
-    (float)5.71141e-08,
-    (float)1.04617e-07,
-    (float)3.6075e-08,
-    (float)9.58819e-08,
-    (float)3.85549e-08,
-    (float)1.30599e-07,
-    (float)1.90127e-08,
-    (float)1.46379e-08,
-    (float)4.42423e-08,
-    (float)6.87463e-08,
-    (float)2.02652e-07,
-    (float)0.00273956,
-    (float)0.742065,
-    (float)0.24147,
-    (float)0.000482866,
-    (float)1.57618e-05,
-    (float)0.00131986,
-    (float)0.00819821,
-    (float)0.00252296,
-    (float)0.000394151,
-    (float)5.31297e-05,
-    (float)0.000209383,
-    (float)4.16674e-05,
-    (float)0.000184694,
-    (float)0.000113846,
-    (float)6.53689e-05,
-    (float)1.10044e-06,
-    (float)5.79818e-06,
-    (float)2.52186e-05,
-    (float)7.39544e-06,
-    (float)2.28423e-05,
-    (float)6.57458e-08,
-    (float)5.37587e-06,
-    (float)1.64581e-06,
-    (float)1.17428e-05,
-    (float)1.60094e-06,
-    (float)1.5396e-06,
-    (float)2.29453e-06,
-    (float)2.04159e-06,
-    (float)1.24614e-07,
-    (float)1.91178e-06,
-    (float)3.67144e-08,
-    (float)4.40317e-08,
-    (float)1.06769e-06,
-    (float)4.7978e-06,
-    (float)2.21389e-06,
-    (float)1.80126e-06,
-    (float)1.06459e-07,
-    (float)5.97361e-08,
-    (float)2.33065e-07,
-    (float)1.91682e-06,
-    (float)1.67446e-06,
-    (float)1.77162e-07,
-    (float)5.96009e-07,
-    (float)1.49117e-07,
-    (float)8.78135e-07,
-    (float)1.12097e-06,
-    (float)4.75189e-07,
-    (float)6.69534e-07,
-    (float)5.73812e-07,
-    (float)1.70708e-06,
-    (float)1.44587e-06,
-    (float)2.33167e-07,
-    (float)1.01463e-08,
-    (float)1.17153e-07,
-    (float)5.09912e-07,
-    (float)7.7437e-09,
-    (float)6.27481e-08,
-    (float)1.28813e-08,
-    (float)2.58218e-07,
-    (float)4.2648e-08,
-    (float)2.87627e-07,
-    (float)8.45015e-07,
-    (float)3.667e-07,
-    (float)5.50227e-07,
-    (float)1.58326e-08,
-    (float)3.00209e-07,
-    (float)7.69057e-07,
-    (float)2.4002e-07,
-    (float)1.16333e-07,
-    (float)1.28039e-07,
-    (float)6.04978e-08,
-    (float)6.02249e-08,
-    (float)5.05257e-07,
-    (float)9.6977e-08,
-    (float)2.51019e-07,
-    (float)1.24094e-08,
-    (float)6.15735e-08,
-    (float)5.47779e-08,
-    (float)6.73589e-08,
-    (float)1.06561e-07,
-    (float)1.76286e-07,
-    (float)2.89216e-07,
-    (float)1.42863e-07,
-    (float)6.21325e-08,
-    (float)3.53459e-08,
-    (float)1.20122e-07,
-    (float)7.3393e-08,
-    (float)4.13709e-08,
-    (float)1.02649e-07,
-    (float)1.1799e-07,
-    (float)1.97865e-08,
-    (float)2.09146e-08,
-    (float)1.41584e-07,
-    (float)3.1173e-07,
-    (float)1.86964e-07,
-    (float)6.88931e-08,
-    (float)7.83477e-08,
-    (float)2.00763e-07,
-    (float)7.9536e-08,
-    (float)5.09716e-09,
-    (float)7.01346e-09,
-    (float)9.80565e-08,
-    (float)1.24242e-07,
-    (float)1.33705e-09,
-    (float)5.50212e-09,
-    (float)1.78092e-07,
-    (float)7.96155e-08,
-    (float)2.95539e-09,
-    (float)5.24081e-08,
-    (float)1.72243e-07,
-    (float)2.96681e-07,
-    (float)3.23257e-08,
-    (float)6.27039e-08,
-    (float)1.74519e-07,
-    (float)1.24974e-07,
-    (float)4.10391e-08,
-    (float)3.09771e-09,
-    (float)6.266e-08,
-    (float)3.84215e-08,
-    (float)6.42847e-08,
-    (float)3.79388e-08,
-    (float)6.24711e-08,
-    (float)1.30197e-07,
-    (float)8.75456e-09,
-    (float)4.92785e-08,
-    (float)2.40256e-08,
-    (float)9.54966e-08,
-    (float)1.70443e-07,
-    (float)0.00240068,
-    (float)0.799074,
-    (float)0.186662,
-    (float)0.000404081,
-    (float)1.52675e-05,
-    (float)0.0011649,
-    (float)0.00703907,
-    (float)0.00221761,
-    (float)0.000308542,
-    (float)4.18108e-05,
-    (float)0.000151253,
-    (float)5.63427e-05,
-    (float)0.000191312,
-    (float)9.37633e-05,
-    (float)4.71636e-05,
-    (float)1.70064e-06,
-    (float)4.91781e-06,
-    (float)3.26193e-05,
-    (float)1.15148e-05,
-    (float)2.11067e-05,
-    (float)5.32887e-08,
-    (float)6.25871e-06,
-    (float)1.72681e-06,
-    (float)1.27148e-05,
-    (float)1.50644e-06,
-    (float)1.4684e-06,
-    (float)2.5771e-06,
-    (float)1.94656e-06,
-    (float)8.67897e-08,
-    (float)1.78793e-06,
-    (float)1.76297e-08,
-    (float)9.93581e-08,
-    (float)1.19798e-06,
-    (float)4.13506e-06,
-    (float)2.03848e-06,
-    (float)2.11958e-06,
-    (float)1.65399e-07,
-    (float)2.31403e-07,
-    (float)6.88445e-08,
-    (float)1.55308e-06,
-    (float)1.54925e-06,
-    (float)9.61096e-08,
-    (float)7.87281e-07,
-    (float)4.47973e-08,
-    (float)6.17976e-07,
-    (float)7.77475e-07,
-    (float)2.23874e-07,
-    (float)7.13663e-07,
-    (float)4.3062e-07,
-    (float)1.67562e-06,
-    (float)1.24102e-06,
-    (float)1.63808e-07,
-    (float)5.70096e-08,
-    (float)1.60337e-07,
-    (float)4.44595e-07,
-    (float)6.29111e-09,
-    (float)9.72485e-08,
-    (float)3.76996e-08,
-    (float)1.56023e-07,
-    (float)2.00469e-07,
-    (float)2.04053e-07,
-    (float)6.84299e-07,
-    (float)2.02308e-07,
-    (float)7.51355e-07,
-    (float)5.97402e-08,
-    (float)3.01115e-07,
-    (float)6.80446e-07,
-    (float)2.89943e-07,
-    (float)3.16371e-07,
-    (float)9.62902e-08,
-    (float)1.0336e-07,
-    (float)4.89421e-08,
-    (float)4.34692e-07,
-    (float)8.18641e-08,
-    (float)1.93884e-07,
-    (float)3.58843e-09,
-    (float)8.54759e-08,
-    (float)2.68638e-08,
-    (float)9.82361e-08,
-    (float)8.71852e-08,
-    (float)1.24811e-07,
-    (float)3.17421e-07,
-    (float)1.10796e-07,
-    (float)8.0276e-08,
-    (float)3.22346e-08,
-    (float)1.26224e-07,
-    (float)7.79533e-08,
-    (float)2.88979e-08,
-    (float)9.05204e-08,
-    (float)5.09356e-08,
-    (float)2.73049e-08,
-    (float)1.39828e-08,
-    (float)1.51155e-07,
-    (float)2.27038e-07,
-    (float)1.92744e-07,
-    (float)6.53572e-08,
-    (float)8.70934e-08,
-    (float)2.62879e-07,
-    (float)6.50636e-08,
-    (float)3.72183e-08,
-    (float)3.00439e-08,
-    (float)3.67268e-08,
-    (float)1.41304e-07,
-    (float)1.1376e-08,
-    (float)2.09743e-08,
-    (float)1.25643e-07,
-    (float)8.89138e-09,
-    (float)1.6794e-08,
-    (float)3.63151e-08,
-    (float)2.04539e-07,
-    (float)2.44085e-07,
-    (float)2.8638e-08,
-    (float)1.13577e-07,
-    (float)1.268e-07,
-    (float)1.75696e-07,
-    (float)4.59368e-08,
-    (float)2.57172e-08,
-    (float)6.48548e-08,
-    (float)6.27628e-09,
-    (float)1.01604e-07,
-    (float)4.21925e-09,
-    (float)9.78004e-08,
-    (float)9.42522e-08,
-    (float)5.90794e-09,
-    (float)9.257e-08,
-    (float)1.59501e-08,
-    (float)1.35739e-07,
-    (float)1.11011e-07,
-    (float)0.00203059,
-    (float)0.847783,
-    (float)0.140299,
-    (float)0.000327246,
-    (float)1.43478e-05,
-    (float)0.000977859,
-    (float)0.00582449,
-    (float)0.00188927,
-    (float)0.000229862,
-    (float)3.03898e-05,
-    (float)0.000101823,
-    (float)6.74459e-05,
-    (float)0.000184347,
-    (float)7.2363e-05,
-    (float)3.20723e-05,
-    (float)1.88392e-06,
-    (float)3.63522e-06,
-    (float)3.93539e-05,
-    (float)1.49019e-05,
-    (float)1.76938e-05,
-    (float)4.90029e-08,
-    (float)6.59345e-06,
-    (float)2.2244e-06,
-    (float)1.38609e-05,
-    (float)1.3423e-06,
-    (float)1.15162e-06,
-    (float)2.87503e-06,
-    (float)1.83159e-06,
-    (float)9.44773e-08,
-    (float)1.82097e-06,
-    (float)1.06062e-07,
-    (float)1.4322e-07,
-    (float)1.2572e-06,
-    (float)3.42257e-06,
-    (float)1.87424e-06,
-    (float)2.09346e-06,
-    (float)2.00334e-07,
-    (float)4.12544e-07,
-    (float)4.54869e-09,
-    (float)1.13896e-06,
-    (float)1.33359e-06,
-    (float)1.01149e-07,
-    (float)8.85129e-07,
-    (float)3.57265e-08,
-    (float)2.93245e-07,
-    (float)4.2255e-07,
-    (float)1.37673e-07,
-    (float)6.37412e-07,
-    (float)2.5239e-07,
-    (float)1.70942e-06,
-    (float)8.07527e-07,
-    (float)9.78923e-08,
-    (float)1.30414e-07,
-    (float)1.72087e-07,
-    (float)4.93241e-07,
-    (float)2.64732e-08,
-    (float)1.17642e-07,
-    (float)5.56508e-08,
-    (float)9.53656e-08,
-    (float)3.46e-07,
-    (float)1.83114e-07,
-    (float)3.87931e-07,
-    (float)1.6391e-07,
-    (float)6.4517e-07,
-    (float)1.06259e-07,
-    (float)3.49434e-07,
-    (float)4.39892e-07,
-    (float)2.18183e-07,
-    (float)3.951e-07,
-    (float)8.32331e-08,
-    (float)1.89198e-07,
-    (float)3.74031e-08,
-    (float)2.14031e-07,
-    (float)7.71382e-08,
-    (float)1.49413e-07,
-    (float)1.03472e-08,
-    (float)1.19269e-07,
-    (float)2.10134e-08,
-    (float)7.80269e-08,
-    (float)7.06053e-08,
-    (float)1.03475e-07,
-    (float)2.63065e-07,
-    (float)1.474e-07,
-    (float)1.05874e-07,
-    (float)1.9309e-08,
-    (float)8.22072e-08,
-    (float)6.75667e-08,
-    (float)2.7431e-08,
-    (float)1.19955e-07,
-    (float)3.74005e-08,
-    (float)3.86158e-08,
-    (float)3.73186e-08,
-    (float)1.12437e-07,
-    (float)1.55364e-07,
-    (float)1.31546e-07,
-    (float)5.78792e-08,
-    (float)1.32413e-07,
-    (float)2.06352e-07,
-    (float)2.73916e-08,
-    (float)4.53379e-08,
-    (float)2.44633e-08,
-    (float)4.59352e-08,
-    (float)9.65603e-08,
-    (float)3.47117e-09,
-    (float)2.34493e-08,
-    (float)6.75542e-08,
-    (float)1.99643e-09,
-    (float)2.41567e-08,
-    (float)4.2051e-08,
-    (float)1.7271e-07,
-    (float)1.08945e-07,
-    (float)2.72294e-08,
-    (float)1.22612e-07,
-    (float)9.89552e-08,
-    (float)1.98744e-07,
-    (float)5.83062e-08,
-    (float)4.60838e-08,
-    (float)6.67789e-08,
-    (float)1.46758e-09,
-    (float)9.38321e-08,
-    (float)3.67602e-09,
-    (float)1.21924e-07,
-    (float)4.04191e-08,
-    (float)1.44787e-08,
-    (float)8.59877e-08,
-    (float)1.52623e-08,
-    (float)1.17391e-07,
-    (float)4.49634e-08,
-    (float)0.00164671,
-    (float)0.888256,
-    (float)0.10216,
-    (float)0.000260178,
-    (float)1.29093e-05,
-    (float)0.000778994,
-    (float)0.00464659,
-    (float)0.00154675,
-    (float)0.000161447,
-    (float)1.92617e-05,
-    (float)6.37321e-05,
-    (float)7.40931e-05,
-    (float)0.000167011,
-    (float)5.12751e-05,
-    (float)2.04762e-05,
-    (float)1.64765e-06,
-    (float)2.54664e-06,
-    (float)4.41043e-05,
-    (float)1.6747e-05,
-    (float)1.40587e-05,
-    (float)8.25929e-08,
-    (float)6.36351e-06,
-    (float)2.93667e-06,
-    (float)1.43869e-05,
-    (float)1.22192e-06,
-    (float)9.05724e-07,
-    (float)3.08746e-06,
-    (float)1.84005e-06,
-    (float)2.17893e-07,
-    (float)1.77653e-06,
-    (float)2.21751e-07,
-    (float)2.13633e-07,
-    (float)1.26597e-06,
-    (float)2.8374e-06,
-    (float)1.88836e-06,
-    (float)1.8559e-06,
-    (float)1.77478e-07,
-    (float)5.57745e-07,
-    (float)2.42026e-08,
-    (float)9.07351e-07,
-    (float)9.57909e-07,
-    (float)9.50067e-08,
-    (float)7.90027e-07,
-    (float)6.1304e-08,
-    (float)1.0863e-07,
-    (float)2.09502e-07,
-    (float)7.96989e-08,
-    (float)4.68821e-07,
-    (float)1.79341e-07,
-    (float)1.60548e-06,
-    (float)4.78147e-07,
-    (float)6.33087e-08,
-    (float)2.23855e-07,
-    (float)1.87609e-07,
-    (float)4.63014e-07,
-    (float)7.68536e-08,
-    (float)9.14793e-08,
-    (float)6.04742e-08,
-    (float)4.96534e-08,
-    (float)5.19981e-07,
-    (float)1.21258e-07,
-    (float)1.28854e-07,
-    (float)1.68696e-07,
-    (float)4.38017e-07,
-    (float)1.10482e-07,
-    (float)4.07642e-07,
-    (float)2.73205e-07,
-    (float)1.25048e-07,
-    (float)3.29386e-07,
-    (float)7.36361e-08,
-    (float)2.24394e-07,
-    (float)6.47505e-08,
-    (float)5.93588e-08,
-    (float)8.20392e-08,
-    (float)1.0082e-07,
-    (float)3.09729e-08,
-    (float)1.48768e-07,
-    (float)2.88114e-08,
-    (float)7.53265e-08,
-    (float)6.91364e-08,
-    (float)1.15451e-07,
-    (float)1.85432e-07,
-    (float)1.79051e-07,
-    (float)1.04193e-07,
-    (float)2.31534e-08,
-    (float)5.23909e-08,
-    (float)5.3335e-08,
-    (float)2.79124e-08,
-    (float)1.16109e-07,
-    (float)3.74402e-08,
-    (float)2.848e-08,
-    (float)6.92619e-08,
-    (float)9.81028e-08,
-    (float)6.35707e-08,
-    (float)9.30382e-08,
-    (float)4.09269e-08,
-    (float)2.14605e-07,
-    (float)1.51388e-07,
-    (float)1.43124e-08,
-    (float)4.85836e-08,
-    (float)7.91599e-09,
-    (float)6.55683e-08,
-    (float)4.15033e-08,
-    (float)3.71031e-09,
-    (float)3.2285e-08,
-    (float)2.14133e-08,
-    (float)7.81355e-09,
-    (float)1.29744e-08,
-    (float)8.86524e-08,
-    (float)1.12604e-07,
-    (float)3.69219e-08,
-    (float)2.78464e-08,
-    (float)7.31326e-08,
-    (float)1.39168e-07,
-    (float)1.46311e-07,
-    (float)7.97533e-08,
-    (float)7.76425e-08,
-    (float)4.70562e-08,
-    (float)7.57907e-09,
-    (float)4.76226e-08,
-    (float)3.11918e-08,
-    (float)8.67759e-08,
-    (float)1.95525e-08,
-    (float)2.33314e-08,
-    (float)6.45026e-08,
-    (float)4.68914e-08,
-    (float)5.32198e-08,
-    (float)2.62455e-08,
-    (float)0.00127251,
-    (float)0.920848,
-    (float)0.0717563,
-    (float)0.000200544,
-    (float)1.16131e-05,
-    (float)0.000585345,
-    (float)0.00356027,
-    (float)0.00121363,
-    (float)0.000107014,
-    (float)1.07345e-05,
-    (float)3.75871e-05,
-    (float)7.66869e-05,
-    (float)0.0001427,
-    (float)3.2883e-05,
-    (float)1.27511e-05,
-    (float)1.34684e-06,
-    (float)1.86425e-06,
-    (float)4.67175e-05,
-    (float)1.71708e-05,
-    (float)1.06229e-05,
-    (float)1.09475e-07,
-    (float)5.82659e-06,
-    (float)3.54599e-06,
-    (float)1.43734e-05,
-    (float)1.1156e-06,
-    (float)6.76397e-07,
-    (float)3.27078e-06,
-    (float)1.93134e-06,
-    (float)3.7898e-07,
-    (float)1.67191e-06,
-    (float)3.50654e-07,
-    (float)3.18971e-07,
-    (float)1.20728e-06,
-    (float)2.39789e-06,
-    (float)1.91103e-06,
-    (float)1.61235e-06,
-    (float)1.58664e-07,
-    (float)7.05235e-07,
-    (float)9.04276e-08,
-    (float)8.50547e-07,
-    (float)6.58883e-07,
-    (float)8.3006e-08,
-    (float)7.08387e-07,
-    (float)9.20852e-08,
-    (float)3.71673e-08,
-    (float)1.40276e-07,
-    (float)4.08983e-08,
-    (float)3.80947e-07,
-    (float)1.26235e-07,
-    (float)1.44597e-06,
-    (float)2.41221e-07,
-    (float)3.33372e-08,
-    (float)3.3399e-07,
-    (float)1.83249e-07,
-    (float)4.50224e-07,
-    (float)1.63957e-07,
-    (float)6.9522e-08,
-    (float)9.74537e-08,
-    (float)3.32946e-08,
-    (float)6.29198e-07,
-    (float)1.28131e-07,
-    (float)2.0721e-08,
-    (float)1.86117e-07,
-    (float)2.61036e-07,
-    (float)8.16364e-08,
-    (float)4.84298e-07,
-    (float)1.82183e-07,
-    (float)1.09291e-07,
-    (float)2.34346e-07,
-    (float)6.5622e-08,
-    (float)2.25766e-07,
-    (float)1.3815e-07,
-    (float)2.11569e-08,
-    (float)1.03264e-07,
-    (float)7.61855e-08,
-    (float)5.46508e-08,
-    (float)1.55018e-07,
-    (float)2.11937e-08,
-    (float)8.08463e-08,
-    (float)7.99074e-08,
-    (float)1.45282e-07,
-    (float)1.20254e-07,
-    (float)1.73617e-07,
-    (float)7.72597e-08,
-    (float)2.51871e-08,
-    (float)4.33151e-08,
-    (float)3.95642e-08,
-    (float)4.06057e-08,
-    (float)1.16381e-07,
-    (float)4.69188e-08,
-    (float)2.55758e-08,
-    (float)1.00008e-07,
-    (float)8.71527e-08,
-    (float)2.11658e-08,
-    (float)6.37418e-08,
-    (float)1.85587e-08,
-    (float)2.55964e-07,
-    (float)1.03345e-07,
-    (float)2.83118e-08,
-    (float)6.58572e-08,
-    (float)3.34156e-09,
-    (float)8.154e-08,
-    (float)1.13024e-08,
-    (float)1.48489e-08,
-    (float)4.82847e-08,
-    (float)7.03118e-09,
-    (float)2.53499e-08,
-    (float)6.34231e-09,
-    (float)1.20616e-07,
-    (float)5.85446e-08,
-    (float)5.1273e-09,
-    (float)1.85568e-08,
-    (float)4.16332e-08,
-    (float)1.78142e-07,
-    (float)1.08499e-07,
-    (float)8.46063e-08,
-    (float)1.10516e-07,
-    (float)3.36081e-08,
-    (float)1.76056e-08,
-    (float)2.26837e-08,
-    (float)8.89765e-08,
-    (float)6.70492e-08,
-    (float)2.93492e-08,
-    (float)2.02298e-08,
-    (float)4.48634e-08,
-    (float)8.23024e-08,
-    (float)9.47255e-09,
-    (float)9.60475e-09,
-    (float)0.000928918,
-    (float)0.946306,
-    (float)0.0482709,
-    (float)0.000148968,
-    (float)1.05228e-05,
-    (float)0.000403373,
-    (float)0.00259486,
-    (float)0.000911352,
-    (float)6.59639e-05,
-    (float)4.67405e-06,
-    (float)2.04261e-05,
-    (float)7.24812e-05,
-    (float)0.000112848,
-    (float)1.88842e-05,
-    (float)7.91603e-06,
-    (float)8.87761e-07,
-    (float)1.51724e-06,
-    (float)4.5411e-05,
-    (float)1.57269e-05,
-    (float)7.23311e-06,
-    (float)1.01527e-07,
-    (float)5.05089e-06,
-    (float)4.40935e-06,
-    (float)1.36664e-05,
-    (float)9.09647e-07,
-    (float)3.87638e-07,
-    (float)3.41087e-06,
-    (float)1.98317e-06,
-    (float)6.01011e-07,
-    (float)1.67077e-06,
-    (float)4.72915e-07,
-    (float)3.16138e-07,
-    (float)1.07554e-06,
-    (float)2.11582e-06,
-    (float)1.89887e-06,
-    (float)1.19467e-06,
-    (float)1.61872e-07,
-    (float)6.80662e-07,
-    (float)1.58572e-07,
-    (float)7.95098e-07,
-    (float)4.58986e-07,
-    (float)1.32317e-07,
-    (float)5.73535e-07,
-    (float)1.12304e-07,
-    (float)8.28626e-08,
-    (float)9.8847e-08,
-    (float)8.28596e-08,
-    (float)2.82848e-07,
-    (float)1.09204e-07,
-    (float)1.38846e-06,
-    (float)7.53833e-08,
-    (float)2.23552e-08,
-    (float)3.43069e-07,
-    (float)1.26659e-07,
-    (float)4.31184e-07,
-    (float)1.74424e-07,
-    (float)4.02714e-08,
-    (float)1.91482e-07,
-    (float)2.10696e-08,
-    (float)5.15004e-07,
-    (float)1.26071e-07,
-    (float)1.07901e-08,
-    (float)1.85385e-07,
-    (float)9.34215e-08,
-    (float)4.15896e-08,
-    (float)4.39669e-07,
-    (float)1.57168e-07,
-    (float)1.32562e-07,
-    (float)1.23405e-07,
-    (float)8.20198e-08,
-    (float)1.29698e-07,
-    (float)1.34713e-07,
-    (float)4.3992e-08,
-    (float)1.01957e-07,
-    (float)1.18284e-07,
-    (float)7.80151e-08,
-    (float)7.91495e-08,
-    (float)2.61274e-08,
-    (float)7.53919e-08,
-    (float)7.1526e-08,
-    (float)1.61307e-07,
-    (float)7.20264e-08,
-    (float)1.33438e-07,
-    (float)5.79996e-08,
-    (float)9.92891e-09,
-    (float)4.98427e-08,
-    (float)4.28117e-08,
-    (float)4.44728e-08,
-    (float)9.53233e-08,
-    (float)2.6654e-08,
-    (float)6.34069e-08,
-    (float)9.78675e-08,
-    (float)8.57313e-08,
-    (float)2.78228e-08,
-    (float)3.80815e-08,
-    (float)3.79333e-08,
-    (float)1.50403e-07,
-    (float)7.06898e-08,
-    (float)3.60033e-08,
-    (float)4.93442e-08,
-    (float)2.97087e-08,
-    (float)4.81904e-08,
-    (float)7.96262e-09,
-    (float)3.13803e-08,
-    (float)1.12247e-08,
-    (float)5.22499e-09,
-    (float)1.50811e-08,
-    (float)8.71323e-09,
-    (float)1.43856e-07,
-    (float)1.79475e-08,
-    (float)9.9926e-09,
-    (float)1.86744e-08,
-    (float)3.37328e-08,
-    (float)2.11902e-07,
-    (float)4.4451e-08,
-    (float)8.3796e-08,
-    (float)8.98888e-08,
-    (float)2.01477e-08,
-    (float)3.32019e-08,
-    (float)1.28928e-08,
-    (float)7.96005e-08,
-    (float)5.08213e-08,
-    (float)2.45406e-08,
-    (float)6.26865e-09,
-    (float)3.62803e-08,
-    (float)9.06666e-08,
-    (float)1.10914e-08,
-    (float)2.03492e-09,
-    (float)0.000627459,
-    (float)0.96557,
-    (float)0.0307,
-    (float)0.000108208,
-    (float)9.30284e-06,
-    (float)0.000246101,
-    (float)0.00178064,
-    (float)0.000643988,
-    (float)3.60535e-05,
-    (float)9.88681e-07,
-    (float)1.03413e-05,
-    (float)6.24653e-05,
-    (float)8.26906e-05,
-    (float)8.92805e-06,
-    (float)4.84451e-06,
-    (float)4.83632e-07,
-    (float)1.256e-06,
-    (float)4.10403e-05,
-    (float)1.35193e-05,
-    (float)4.70154e-06,
-    (float)8.28612e-08,
-    (float)4.21432e-06,
-    (float)4.9812e-06,
-    (float)1.22686e-05,
-    (float)7.138e-07,
-    (float)2.39046e-07,
-    (float)3.54063e-06,
-    (float)1.92682e-06,
-    (float)7.47273e-07,
-    (float)1.53856e-06,
-    (float)5.77744e-07,
-    (float)3.59894e-07,
-    (float)8.58254e-07,
-    (float)1.75931e-06,
-    (float)1.82684e-06,
-    (float)8.7539e-07,
-    (float)1.29807e-07,
-    (float)6.32578e-07,
-    (float)1.61119e-07,
-    (float)7.50747e-07,
-    (float)3.25106e-07,
-    (float)1.98411e-07,
-    (float)3.6109e-07,
-    (float)1.10688e-07,
-    (float)1.55815e-07,
-    (float)8.51404e-08,
-    (float)1.6132e-07,
-    (float)2.04104e-07,
-    (float)1.32651e-07,
-    (float)1.27552e-06,
-    (float)8.80846e-09,
-    (float)2.40188e-08,
-    (float)2.87978e-07,
-    (float)9.04897e-08,
-    (float)4.15876e-07,
-    (float)1.84939e-07,
-    (float)1.70681e-08,
-    (float)3.08749e-07,
-    (float)3.25463e-08,
-    (float)3.15394e-07,
-    (float)1.10458e-07,
-    (float)2.61237e-08,
-    (float)1.49436e-07,
-    (float)5.73151e-09,
-    (float)3.73479e-09,
-    (float)3.38059e-07,
-    (float)1.35369e-07,
-    (float)1.59466e-07,
-    (float)6.76633e-08,
-    (float)1.23473e-07,
-    (float)3.71498e-08,
-    (float)1.04518e-07,
-    (float)6.60637e-08,
-    (float)8.35908e-08,
-    (float)1.75874e-07,
-    (float)8.11316e-08,
-    (float)2.41033e-08,
-    (float)3.68647e-08,
-    (float)5.20417e-08,
-    (float)6.96643e-08,
-    (float)1.41213e-07,
-    (float)4.21334e-08,
-    (float)1.179e-07,
-    (float)5.15453e-08,
-    (float)4.42486e-09,
-    (float)3.98466e-08,
-    (float)3.43744e-08,
-    (float)5.65346e-08,
-    (float)8.73857e-08,
-    (float)2.47598e-08,
-    (float)9.05203e-08,
-    (float)1.19609e-07,
-    (float)4.91504e-08,
-    (float)3.17265e-08,
-    (float)1.79527e-08,
-    (float)6.63524e-08,
-    (float)7.1534e-08,
-    (float)3.68533e-08,
-    (float)3.60296e-08,
-    (float)3.14683e-08,
-    (float)1.04578e-07,
-    (float)1.64215e-08,
-    (float)8.84618e-09,
-    (float)3.1084e-08,
-    (float)6.60824e-11,
-    (float)1.13264e-08,
-    (float)1.57658e-09,
-    (float)4.02167e-08,
-    (float)1.13038e-07,
-    (float)7.47036e-09,
-    (float)2.17493e-08,
-    (float)1.11836e-08,
-    (float)5.41251e-08,
-    (float)1.5338e-07,
-    (float)2.07349e-08,
-    (float)5.75529e-08,
-    (float)7.43311e-08,
-    (float)2.98791e-08,
-    (float)2.90012e-08,
-    (float)2.29801e-08,
-    (float)3.53558e-08,
-    (float)5.89235e-08,
-    (float)1.89624e-08,
-    (float)3.9013e-09,
-    (float)3.09077e-08,
-    (float)6.77462e-08,
-    (float)3.09046e-08,
-    (float)2.20994e-10,
-    (float)0.000380362,
-    (float)0.979564,
-    (float)0.0180783,
-    (float)7.53167e-05,
-    (float)8.35343e-06,
-    (float)0.000123025,
-    (float)0.00112578,
-    (float)0.000420937,
-    (float)1.65694e-05,
-    (float)4.21646e-08,
-    (float)5.78862e-06,
-    (float)4.859e-05,
-    (float)5.49297e-05,
-    (float)3.44386e-06,
-    (float)3.25542e-06,
-    (float)3.89562e-07,
-    (float)9.45983e-07,
-    (float)3.431e-05,
-    (float)1.12065e-05,
-    (float)3.03955e-06,
-    (float)6.23609e-08,
-    (float)3.642e-06,
-    (float)4.88763e-06,
-    (float)1.01866e-05,
-    (float)4.85466e-07,
-    (float)1.52872e-07,
-    (float)3.6162e-06,
-    (float)1.71903e-06,
-    (float)7.39887e-07,
-    (float)1.35179e-06,
-    (float)6.04408e-07,
-    (float)4.41712e-07,
-    (float)6.52015e-07,
-    (float)1.28028e-06,
-    (float)1.74787e-06,
-    (float)6.69479e-07,
-    (float)1.06815e-07,
-    (float)6.19737e-07,
-    (float)1.13932e-07,
-    (float)6.8864e-07,
-    (float)2.00698e-07,
-    (float)2.65161e-07,
-    (float)2.17311e-07,
-    (float)1.09685e-07,
-    (float)2.12412e-07,
-    (float)9.73013e-08,
-    (float)2.4476e-07,
-    (float)1.50365e-07,
-    (float)1.54521e-07,
-    (float)1.19031e-06,
-    (float)1.11064e-08,
-    (float)2.12522e-08,
-    (float)2.53036e-07,
-    (float)5.75045e-08,
-    (float)4.2047e-07,
-    (float)1.64426e-07,
-    (float)2.15698e-08,
-    (float)4.05148e-07,
-    (float)3.7112e-08,
-    (float)1.35597e-07,
-    (float)9.56802e-08,
-    (float)4.11683e-08,
-    (float)9.74339e-08,
-    (float)1.37365e-08,
-    (float)1.57567e-08,
-    (float)2.08878e-07,
-    (float)1.19989e-07,
-    (float)1.80822e-07,
-    (float)3.94199e-08,
-    (float)1.71791e-07,
-    (float)4.87417e-09,
-    (float)7.85051e-08,
-    (float)8.87931e-08,
-    (float)7.09393e-08,
-    (float)2.34913e-07,
-    (float)6.81229e-08,
-    (float)3.82822e-09,
-    (float)3.78754e-08,
-    (float)2.56143e-08,
-    (float)4.06919e-08,
-    (float)1.14793e-07,
-    (float)3.10142e-08,
-    (float)1.1836e-07,
-    (float)6.91171e-08,
-    (float)3.99147e-10,
-    (float)2.90137e-08,
-    (float)1.60725e-08,
-    (float)6.08597e-08,
-    (float)7.10698e-08,
-    (float)2.71092e-08,
-    (float)7.33884e-08,
-    (float)1.23352e-07,
-    (float)3.19721e-08,
-    (float)3.65206e-08,
-    (float)1.47692e-08,
-    (float)7.01848e-08,
-    (float)3.35913e-08,
-    (float)2.15863e-08,
-    (float)3.67352e-08,
-    (float)2.60188e-08,
-    (float)1.33929e-07,
-    (float)9.39464e-09,
-    (float)1.05446e-08,
-    (float)2.36408e-08,
-    (float)2.95765e-09,
-    (float)1.46708e-08,
-    (float)2.59534e-09,
-    (float)7.20826e-08,
-    (float)7.76632e-08,
-    (float)4.5193e-09,
-    (float)3.97423e-08,
-    (float)6.45197e-09,
-    (float)4.7048e-08,
-    (float)8.69224e-08,
-    (float)1.71813e-08,
-    (float)4.17579e-08,
-    (float)6.81784e-08,
-    (float)3.85838e-08,
-    (float)2.8772e-08,
-    (float)3.59759e-08,
-    (float)1.91827e-08,
-    (float)5.65916e-08,
-    (float)1.44553e-08,
-    (float)1.3595e-08,
-    (float)3.06522e-08,
-    (float)2.88534e-08,
-    (float)5.24828e-08,
-    (float)1.79048e-10,
-    (float)0.000192787,
-    (float)0.989206,
-    (float)0.00947421,
-    (float)4.9675e-05,
-    (float)7.33634e-06,
-    (float)4.00177e-05,
-    (float)0.000630454,
-    (float)0.000247161,
-    (float)5.63748e-06,
-    (float)1.5261e-06,
-    (float)4.19765e-06,
-    (float)3.23153e-05,
-    (float)3.10053e-05,
-    (float)2.39595e-06,
-    (float)2.70554e-06,
-    (float)5.92561e-07,
-    (float)7.04358e-07,
-    (float)2.52645e-05,
-    (float)8.99418e-06,
-    (float)2.04205e-06,
-    (float)4.75292e-08,
-    (float)3.19545e-06,
-    (float)4.54532e-06,
-    (float)7.42784e-06,
-    (float)3.16435e-07,
-    (float)1.26298e-07,
-    (float)3.74622e-06,
-    (float)1.40539e-06,
-    (float)6.77211e-07,
-    (float)1.12243e-06,
-    (float)6.09824e-07,
-    (float)4.29795e-07,
-    (float)4.46071e-07,
-    (float)8.51426e-07,
-    (float)1.54717e-06,
-    (float)5.37687e-07,
-    (float)1.11939e-07,
-    (float)4.83268e-07,
-    (float)3.92981e-08,
-    (float)5.50903e-07,
-    (float)1.48308e-07,
-    (float)3.63639e-07,
-    (float)1.35033e-07,
-    (float)5.94829e-08,
-    (float)1.9041e-07,
-    (float)9.45951e-08,
-    (float)3.4168e-07,
-    (float)1.11974e-07,
-    (float)1.69586e-07,
-    (float)1.06298e-06,
-    (float)2.89404e-08,
-    (float)3.27144e-08,
-    (float)1.92738e-07,
-    (float)5.25689e-08,
-    (float)3.51519e-07,
-    (float)1.1822e-07,
-    (float)3.40211e-08,
-    (float)3.83673e-07,
-    (float)3.12153e-08,
-    (float)3.48508e-08,
-    (float)9.09522e-08,
-    (float)3.86225e-08,
-    (float)4.05895e-08,
-    (float)4.02393e-08,
-    (float)3.04108e-08,
-    (float)1.12438e-07,
-    (float)1.37021e-07,
-    (float)1.54302e-07,
-    (float)3.93445e-08,
-    (float)1.71263e-07,
-    (float)1.40066e-08,
-    (float)5.09653e-08,
-    (float)7.89645e-08,
-    (float)5.51795e-08,
-    (float)2.16556e-07,
-    (float)4.04411e-08,
-    (float)5.99078e-09,
-    (float)3.61985e-08,
-    (float)8.01265e-09,
-    (float)2.8937e-08,
-    (float)7.65594e-08,
-    (float)3.94011e-08,
-    (float)1.35078e-07,
-    (float)8.10436e-08,
-    (float)1.17694e-08,
-    (float)2.28473e-08,
-    (float)2.23339e-09,
-    (float)4.81939e-08,
-    (float)4.0028e-08,
-    (float)2.42912e-08,
-    (float)3.93321e-08,
-    (float)8.4929e-08,
-    (float)3.7124e-08,
-    (float)1.80892e-08,
-    (float)4.89935e-08,
-    (float)4.84325e-08,
-    (float)1.94797e-08,
-    (float)2.39828e-08,
-    (float)1.77075e-08,
-    (float)5.21529e-08,
-    (float)8.22074e-08,
-    (float)1.22174e-08,
-    (float)1.64517e-08,
-    (float)1.0366e-08,
-    (float)4.32464e-09,
-    (float)1.29284e-08,
-    (float)1.3269e-08,
-    (float)9.14816e-08,
-    (float)3.5222e-08,
-    (float)3.50139e-09,
-    (float)2.42861e-08,
-    (float)7.48825e-09,
-    (float)3.43571e-08,
-    (float)4.37477e-08,
-    (float)2.33411e-08,
-    (float)3.16123e-08,
-    (float)6.24435e-08,
-    (float)5.09019e-08,
-    (float)2.24711e-08,
-    (float)4.06628e-08,
-    (float)1.31594e-08,
-    (float)4.29837e-08,
-    (float)2.42738e-08,
-    (float)2.0591e-08,
-    (float)2.70441e-08,
-    (float)1.34205e-08,
-    (float)3.35216e-08,
-    (float)7.72266e-09,
-    (float)6.6832e-05,
-    (float)0.99533,
-    (float)0.00404996,
-    (float)3.11292e-05,
-    (float)6.23195e-06,
-    (float)2.92282e-06,
-    (float)0.000288867,
-    (float)0.000120484,
-    (float)7.91311e-07,
-    (float)5.20187e-06,
-    (float)4.12099e-06,
-    (float)1.69168e-05,
-    (float)1.3683e-05,
-    (float)4.92073e-06,
-    (float)2.74182e-06,
-    (float)1.01349e-06,
-    (float)5.31499e-07,
-    (float)1.59397e-05,
-    (float)7.40157e-06,
-    (float)1.51548e-06,
-    (float)7.66939e-08,
-    (float)2.91093e-06,
-    (float)3.93914e-06,
-    (float)4.73418e-06,
-    (float)3.22408e-07,
-    (float)1.48196e-07,
-    (float)3.81439e-06,
-    (float)1.00922e-06,
-    (float)5.4963e-07,
-    (float)9.62034e-07,
-    (float)6.61692e-07,
-    (float)4.09212e-07,
-    (float)2.93983e-07,
-    (float)3.66981e-07,
-    (float)1.34804e-06,
-    (float)4.19193e-07,
-    (float)1.30057e-07,
-    (float)3.27912e-07,
-    (float)1.87606e-08,
-    (float)3.33398e-07,
-    (float)1.27234e-07,
-    (float)4.52217e-07,
-    (float)1.08215e-07,
-    (float)1.93086e-08,
-    (float)1.32819e-07,
-    (float)9.71838e-08,
-    (float)4.24915e-07,
-    (float)1.02211e-07,
-    (float)1.9182e-07,
-    (float)9.66644e-07,
-    (float)3.82228e-08,
-    (float)5.35932e-08,
-    (float)1.34279e-07,
-    (float)5.6422e-08,
-    (float)2.75603e-07,
-    (float)6.46405e-08,
-    (float)4.8291e-08,
-    (float)3.25934e-07,
-    (float)3.14561e-08,
-    (float)2.01159e-08,
-    (float)7.82338e-08,
-    (float)3.98289e-08,
-    (float)8.31055e-09,
-    (float)5.76669e-08,
-    (float)2.88637e-08,
-    (float)3.7696e-08,
-    (float)1.78282e-07,
-    (float)1.22155e-07,
-    (float)4.77802e-08,
-    (float)1.67843e-07,
-    (float)1.82892e-08,
-    (float)3.20928e-08,
-    (float)5.0021e-08,
-    (float)4.1192e-08,
-    (float)1.90565e-07,
-    (float)1.99431e-08,
-    (float)1.42179e-08,
-    (float)3.72721e-08,
-    (float)1.56349e-08,
-    (float)3.13947e-08,
-    (float)5.00358e-08,
-    (float)5.29539e-08,
-    (float)1.40793e-07,
-    (float)8.34019e-08,
-    (float)2.43552e-08,
-    (float)2.48229e-08,
-    (float)2.13432e-09,
-    (float)3.64896e-08,
-    (float)2.17731e-08,
-    (float)2.72295e-08,
-    (float)3.08678e-08,
-    (float)4.68756e-08,
-    (float)5.10172e-08,
-    (float)8.71923e-09,
-    (float)1.01758e-07,
-    (float)2.44224e-08,
-    (float)1.11766e-08,
-    (float)2.96367e-08,
-    (float)1.62475e-09,
-    (float)9.33238e-08,
-    (float)4.52019e-08,
-    (float)2.20941e-08,
-    (float)2.12953e-08,
-    (float)4.31433e-09,
-    (float)2.22444e-08,
-    (float)1.51381e-08,
-    (float)2.56615e-08,
-    (float)7.59767e-08,
-    (float)1.05106e-08,
-    (float)9.50761e-10,
-    (float)1.01534e-08,
-    (float)1.30641e-08,
-    (float)3.40481e-08,
-    (float)3.38254e-08,
-    (float)3.76212e-08,
-    (float)4.35146e-08,
-    (float)4.97706e-08,
-    (float)5.28673e-08,
-    (float)1.27236e-08,
-    (float)3.01857e-08,
-    (float)1.01612e-08,
-    (float)2.09403e-08,
-    (float)3.89898e-08,
-    (float)2.00719e-08,
-    (float)2.54594e-08,
-    (float)6.90095e-09,
-    (float)7.21846e-09,
-    (float)3.45652e-08,
-    (float)6.08618e-06,
-    (float)0.998646,
-    (float)0.00110438,
-    (float)1.79372e-05,
-    (float)5.29331e-06,
-    (float)1.53546e-05,
-    (float)8.54658e-05,
-    (float)4.0261e-05,
-    (float)3.68099e-07,
-    (float)1.05584e-05,
-    (float)4.67515e-06,
-    (float)5.46259e-06,
-    (float)3.41032e-06,
-    (float)1.00617e-05,
-    (float)3.05306e-06,
-    (float)1.49821e-06,
-    (float)5.77023e-07,
-    (float)7.9736e-06,
-    (float)6.45138e-06,
-    (float)1.35793e-06,
-    (float)1.78382e-07,
-    (float)2.86173e-06,
-    (float)3.13433e-06,
-    (float)2.51119e-06,
-    (float)3.94694e-07,
-    (float)2.06109e-07,
-    (float)3.67658e-06,
-    (float)7.52925e-07,
-    (float)3.5491e-07,
-    (float)8.80846e-07,
-    (float)6.16358e-07,
-    (float)3.50298e-07,
-    (float)1.80829e-07,
-    (float)4.67973e-08,
-    (float)1.04902e-06,
-    (float)3.31868e-07,
-    (float)1.04385e-07,
-    (float)1.71977e-07,
-    (float)5.47819e-08,
-    (float)1.71584e-07,
-    (float)1.60193e-07,
-    (float)5.07082e-07,
-    (float)1.02852e-07,
-    (float)5.80263e-09,
-    (float)9.37226e-08,
-    (float)1.34849e-07,
-    (float)4.94613e-07,
-    (float)7.19839e-08,
-    (float)2.00467e-07,
-    (float)8.33397e-07,
-    (float)4.76185e-08,
-    (float)5.68746e-08,
-    (float)9.4304e-08,
-    (float)5.72577e-08,
-    (float)2.04466e-07,
-    (float)2.13404e-08,
-    (float)6.76745e-08,
-    (float)2.0362e-07,
-    (float)3.55446e-08,
-    (float)6.81371e-08,
-    (float)6.86523e-08,
-    (float)5.48229e-08,
-    (float)1.66842e-09,
-    (float)4.5433e-08,
-    (float)1.67334e-08,
-    (float)2.75217e-08,
-    (float)2.21869e-07,
-    (float)9.37819e-08,
-    (float)5.66762e-08,
-    (float)1.25485e-07,
-    (float)1.93237e-08,
-    (float)2.19577e-08,
-    (float)2.35335e-08,
-    (float)3.68346e-08,
-    (float)1.76018e-07,
-    (float)1.8698e-08,
-    (float)3.26512e-08,
-    (float)5.72417e-08,
-    (float)2.26468e-08,
-    (float)4.02444e-08,
-    (float)2.6108e-08,
-    (float)6.01965e-08,
-    (float)1.04957e-07,
-    (float)6.04095e-08,
-    (float)2.61537e-08,
-    (float)3.12698e-08,
-    (float)1.31483e-08,
-    (float)3.07887e-08,
-    (float)2.17142e-08,
-    (float)2.9933e-08,
-    (float)2.35851e-08,
-    (float)2.55726e-08,
-    (float)3.84909e-08,
-    (float)7.41262e-09,
-    (float)1.07174e-07,
-    (float)9.9689e-09,
-    (float)9.80327e-09,
-    (float)2.73253e-08,
-    (float)6.43327e-10,
-    (float)9.75383e-08,
-    (float)3.93289e-08,
-    (float)2.80765e-08,
-    (float)2.65338e-08,
-    (float)4.24743e-10,
-    (float)3.42343e-08,
-    (float)2.02941e-08,
-    (float)2.00099e-08,
-    (float)5.14773e-08,
-    (float)4.67446e-09,
-    (float)3.67806e-10,
-    (float)7.33346e-09,
-    (float)1.44671e-08,
-    (float)4.08849e-08,
-    (float)2.26976e-08,
-    (float)5.49405e-08,
-    (float)4.51506e-08,
-    (float)2.74924e-08,
-    (float)4.13951e-08,
-    (float)7.69849e-09,
-    (float)2.45669e-08,
-    (float)8.21798e-09,
-    (float)2.44387e-08,
-    (float)4.50795e-08,
-    (float)1.25916e-08,
-    (float)3.56765e-08,
-    (float)5.38191e-09,
-    (float)3.88317e-09,
-    (float)4.05206e-08,
-    (float)1.04617e-05,
-    (float)0.999771,
-    (float)3.59802e-05,
-    (float)9.10399e-06,
-    (float)4.45297e-06,
-    (float)8.06086e-05,
-    (float)4.15498e-06,
-    (float)3.57202e-06,
-    (float)2.61202e-06,
-    (float)1.7194e-05,
-    (float)5.31272e-06,
-    (float)9.76246e-07,
-    (float)2.18218e-07,
-    (float)1.67479e-05,
-    (float)3.6218e-06,
-    (float)1.86678e-06,
-    (float)1.15249e-06,
-    (float)2.32863e-06,
-    (float)6.23382e-06,
-    (float)1.31714e-06,
-    (float)3.48978e-07,
-    (float)2.98919e-06,
-    (float)2.51438e-06,
-    (float)8.62639e-07,
-    (float)4.74311e-07,
-    (float)2.79658e-07,
-    (float)3.42119e-06,
-    (float)8.8269e-07,
-    (float)2.66468e-07,
-    (float)8.07816e-07,
-    (float)4.8427e-07,
-    (float)2.22564e-07,
-    (float)1.4573e-07,
-    (float)7.57399e-08,
-    (float)6.96192e-07,
-    (float)3.01096e-07,
-    (float)5.58434e-08,
-    (float)2.69796e-08,
-    (float)1.82401e-07,
-    (float)7.66346e-08,
-    (float)2.48879e-07,
-    (float)4.84309e-07,
-    (float)9.28325e-08,
-    (float)7.77942e-08,
-    (float)4.39344e-08,
-    (float)1.6007e-07,
-    (float)4.92935e-07,
-    (float)6.14107e-08,
-    (float)2.05045e-07,
-    (float)6.34335e-07,
-    (float)2.86034e-08,
-    (float)6.12266e-08,
-    (float)6.52196e-08,
-    (float)5.26514e-08,
-    (float)1.21848e-07,
-    (float)8.76147e-09,
-    (float)5.14176e-08,
-    (float)7.70815e-08,
-    (float)7.80493e-08,
-    (float)1.15582e-07,
-    (float)8.22822e-08,
-    (float)8.18944e-08,
-    (float)8.55784e-09,
-    (float)2.11478e-08,
-    (float)5.92924e-09,
-    (float)3.25398e-08,
-    (float)2.2005e-07,
-    (float)7.51468e-08,
-    (float)6.41378e-08,
-    (float)5.14919e-08,
-    (float)1.41058e-08,
-    (float)2.40515e-08,
-    (float)9.71816e-09,
-    (float)3.81678e-08,
-    (float)1.58532e-07,
-    (float)2.46917e-08,
-    (float)5.03599e-08,
-    (float)8.05268e-08,
-    (float)2.29913e-08,
-    (float)4.65629e-08,
-    (float)1.1546e-08,
-    (float)5.00317e-08,
-    (float)5.65364e-08,
-    (float)3.85651e-08,
-    (float)1.97527e-08,
-    (float)3.04989e-08,
-    (float)4.94711e-08,
-    (float)2.2903e-08,
-    (float)3.72363e-08,
-    (float)3.27128e-08,
-    (float)1.95795e-08,
-    (float)2.79834e-08,
-    (float)9.20736e-09,
-    (float)1.30325e-08,
-    (float)7.31159e-08,
-    (float)8.70869e-09,
-    (float)2.04125e-08,
-    (float)1.56235e-08,
-    (float)9.14053e-09,
-    (float)5.30166e-08,
-    (float)4.44371e-08,
-    (float)3.1063e-08,
-    (float)1.60079e-08,
-    (float)3.08806e-09,
-    (float)1.95142e-08,
-    (float)3.95597e-08,
-    (float)2.01503e-08,
-    (float)3.06566e-08,
-    (float)6.47516e-09,
-    (float)4.26907e-10,
-    (float)1.37203e-08,
-    (float)1.19419e-08,
-    (float)2.98982e-08,
-    (float)2.2551e-08,
-    (float)5.3084e-08,
-    (float)3.66799e-08,
-    (float)1.59309e-08,
-    (float)2.23179e-08,
-    (float)2.09781e-09,
-    (float)1.82531e-08,
-    (float)1.10179e-08,
-    (float)4.7423e-08,
-    (float)3.35154e-08,
-    (float)1.21272e-08,
-    (float)3.92127e-08,
-    (float)3.72279e-09,
-    (float)7.24467e-09,
-    (float)1.86678e-08,
-    (float)1.04617e-05,
-    (float)0.999771,
-    (float)3.59802e-05,
-    (float)9.10399e-06,
-    (float)4.45297e-06,
-    (float)8.06086e-05,
-    (float)4.15498e-06,
-    (float)3.57202e-06,
-    (float)2.61202e-06,
-    (float)1.7194e-05,
-    (float)5.31272e-06,
-    (float)9.76246e-07,
-    (float)2.18218e-07,
-    (float)1.67479e-05,
-    (float)3.6218e-06,
-    (float)1.86678e-06,
-    (float)1.15249e-06,
-    (float)2.32863e-06,
-    (float)6.23382e-06,
-    (float)1.31714e-06,
-    (float)3.48978e-07,
-    (float)2.98919e-06,
-    (float)2.51438e-06,
-    (float)8.62639e-07,
-    (float)4.74311e-07,
-    (float)2.79658e-07,
-    (float)3.42119e-06,
-    (float)8.8269e-07,
-    (float)2.66468e-07,
-    (float)8.07816e-07,
-    (float)4.8427e-07,
-    (float)2.22564e-07,
-    (float)1.4573e-07,
-    (float)7.57399e-08,
-    (float)6.96192e-07,
-    (float)3.01096e-07,
-    (float)5.58434e-08,
-    (float)2.69796e-08,
-    (float)1.82401e-07,
-    (float)7.66346e-08,
-    (float)2.48879e-07,
-    (float)4.84309e-07,
-    (float)9.28325e-08,
-    (float)7.77942e-08,
-    (float)4.39344e-08,
-    (float)1.6007e-07,
-    (float)4.92935e-07,
-    (float)6.14107e-08,
-    (float)2.05045e-07,
-    (float)6.34335e-07,
-    (float)2.86034e-08,
-    (float)6.12266e-08,
-    (float)6.52196e-08,
-    (float)5.26514e-08,
-    (float)1.21848e-07,
-    (float)8.76147e-09,
-    (float)5.14176e-08,
-    (float)7.70815e-08,
-    (float)7.80493e-08,
-    (float)1.15582e-07,
-    (float)8.22822e-08,
-    (float)8.18944e-08,
-    (float)8.55784e-09,
-    (float)2.11478e-08,
-    (float)5.92924e-09,
-    (float)3.25398e-08,
-    (float)2.2005e-07,
-    (float)7.51468e-08,
-    (float)6.41378e-08,
-    (float)5.14919e-08,
-    (float)1.41058e-08,
-    (float)2.40515e-08,
-    (float)9.71816e-09,
-    (float)3.81678e-08,
-    (float)1.58532e-07,
-    (float)2.46917e-08,
-    (float)5.03599e-08,
-    (float)8.05268e-08,
-    (float)2.29913e-08,
-    (float)4.65629e-08,
-    (float)1.1546e-08,
-    (float)5.00317e-08,
-    (float)5.65364e-08,
-    (float)3.85651e-08,
-    (float)1.97527e-08,
-    (float)3.04989e-08,
-    (float)4.94711e-08,
-    (float)2.2903e-08,
-    (float)3.72363e-08,
-    (float)3.27128e-08,
-    (float)1.95795e-08,
-    (float)2.79834e-08,
-    (float)9.20736e-09,
-    (float)1.30325e-08,
-    (float)7.31159e-08,
-    (float)8.70869e-09,
-    (float)2.04125e-08,
-    (float)1.56235e-08,
-    (float)9.14053e-09,
-    (float)5.30166e-08,
-    (float)4.44371e-08,
-    (float)3.1063e-08,
-    (float)1.60079e-08,
-    (float)3.08806e-09,
-    (float)1.95142e-08,
-    (float)3.95597e-08,
-    (float)2.01503e-08,
-    (float)3.06566e-08,
-    (float)6.47516e-09,
-    (float)4.26907e-10,
-    (float)1.37203e-08,
-    (float)1.19419e-08,
-    (float)2.98982e-08,
-    (float)2.2551e-08,
-    (float)5.3084e-08,
-    (float)3.66799e-08,
-    (float)1.59309e-08,
-    (float)2.23179e-08,
-    (float)2.09781e-09,
-    (float)1.82531e-08,
-    (float)1.10179e-08,
-    (float)4.7423e-08,
-    (float)3.35154e-08,
-    (float)1.21272e-08,
-    (float)3.92127e-08,
-    (float)3.72279e-09,
-    (float)7.24467e-09,
-    (float)1.86678e-08,
-    (float)0.00044477,
-    (float)0.998323,
-    (float)0.00027385,
-    (float)6.49736e-05,
-    (float)0.000494142,
-    (float)6.00565e-05,
-    (float)0.000106316,
-    (float)3.55964e-05,
-    (float)2.17733e-05,
-    (float)5.09801e-05,
-    (float)5.68923e-06,
-    (float)1.15158e-05,
-    (float)2.35419e-05,
-    (float)2.04447e-05,
-    (float)3.53792e-06,
-    (float)1.13713e-05,
-    (float)9.27991e-06,
-    (float)1.53814e-06,
-    (float)1.71866e-06,
-    (float)2.10372e-06,
-    (float)9.26314e-07,
-    (float)2.50731e-06,
-    (float)8.48778e-06,
-    (float)3.42979e-06,
-    (float)1.58485e-06,
-    (float)8.3405e-07,
-    (float)2.24446e-06,
-    (float)3.22766e-09,
-    (float)1.29262e-06,
-    (float)1.19804e-07,
-    (float)1.45421e-06,
-    (float)1.21861e-06,
-    (float)6.31723e-07,
-    (float)1.874e-07,
-    (float)6.631e-07,
-    (float)1.53126e-07,
-    (float)1.32311e-07,
-    (float)6.89225e-08,
-    (float)9.0223e-08,
-    (float)3.03746e-07,
-    (float)9.6375e-08,
-    (float)3.12542e-07,
-    (float)3.95177e-07,
-    (float)3.04335e-08,
-    (float)3.49262e-07,
-    (float)5.52274e-08,
-    (float)9.09052e-08,
-    (float)1.64715e-07,
-    (float)5.98025e-07,
-    (float)2.61097e-07,
-    (float)1.68492e-07,
-    (float)5.38325e-08,
-    (float)4.5133e-07,
-    (float)4.28065e-08,
-    (float)9.3056e-08,
-    (float)1.44625e-07,
-    (float)2.23286e-07,
-    (float)1.17681e-07,
-    (float)1.33749e-07,
-    (float)2.51301e-08,
-    (float)2.09494e-08,
-    (float)1.45532e-07,
-    (float)5.43922e-08,
-    (float)5.83911e-08,
-    (float)1.51773e-07,
-    (float)2.01845e-08,
-    (float)8.44556e-08,
-    (float)4.53734e-08,
-    (float)2.10474e-07,
-    (float)1.12749e-07,
-    (float)5.20388e-08,
-    (float)4.29451e-08,
-    (float)8.23809e-08,
-    (float)1.05527e-08,
-    (float)2.85122e-09,
-    (float)2.95513e-08,
-    (float)9.15974e-09,
-    (float)6.97845e-08,
-    (float)6.28887e-08,
-    (float)1.0133e-07,
-    (float)1.64132e-07,
-    (float)3.61993e-08,
-    (float)4.28825e-08,
-    (float)1.3927e-08,
-    (float)4.57823e-09,
-    (float)5.77597e-08,
-    (float)3.37815e-08,
-    (float)6.64135e-08,
-    (float)4.68321e-08,
-    (float)9.6669e-08,
-    (float)5.45902e-08,
-    (float)5.10498e-08,
-    (float)5.32719e-08,
-    (float)1.66687e-09,
-    (float)5.07655e-08,
-    (float)1.90282e-08,
-    (float)1.40107e-08,
-    (float)1.17997e-07,
-    (float)1.70496e-08,
-    (float)2.30983e-08,
-    (float)6.57908e-09,
-    (float)9.73941e-09,
-    (float)5.80587e-08,
-    (float)1.82421e-08,
-    (float)6.28048e-08,
-    (float)3.27991e-08,
-    (float)1.10239e-08,
-    (float)5.02995e-09,
-    (float)2.75967e-08,
-    (float)4.71629e-08,
-    (float)4.36053e-08,
-    (float)1.43506e-08,
-    (float)1.93026e-08,
-    (float)1.79204e-08,
-    (float)1.8313e-08,
-    (float)1.22349e-08,
-    (float)1.90023e-08,
-    (float)5.40926e-08,
-    (float)3.66124e-08,
-    (float)1.13326e-07,
-    (float)4.61525e-08,
-    (float)6.46596e-09,
-    (float)2.23212e-08,
-    (float)1.5381e-08,
-    (float)4.10366e-08,
-    (float)2.71419e-08,
-    (float)2.0852e-08,
-    (float)2.71728e-08,
-    (float)0.00154591,
-    (float)0.993811,
-    (float)0.00100858,
-    (float)0.000217892,
-    (float)0.00230804,
-    (float)0.000129872,
-    (float)0.000321745,
-    (float)0.000182832,
-    (float)0.000111024,
-    (float)0.000132154,
-    (float)1.12026e-05,
-    (float)4.43288e-05,
-    (float)5.81093e-05,
-    (float)2.7427e-05,
-    (float)1.08148e-05,
-    (float)1.54671e-05,
-    (float)1.9062e-05,
-    (float)3.86511e-06,
-    (float)9.76727e-07,
-    (float)3.60442e-06,
-    (float)7.93473e-07,
-    (float)2.60103e-06,
-    (float)5.14655e-06,
-    (float)3.02759e-06,
-    (float)4.6048e-06,
-    (float)1.66563e-06,
-    (float)1.0234e-06,
-    (float)1.18269e-06,
-    (float)2.1615e-06,
-    (float)9.46878e-08,
-    (float)2.19954e-06,
-    (float)6.28495e-07,
-    (float)7.08123e-07,
-    (float)5.24522e-08,
-    (float)5.66731e-08,
-    (float)1.2157e-08,
-    (float)1.06852e-08,
-    (float)9.68243e-07,
-    (float)3.43624e-07,
-    (float)3.76715e-07,
-    (float)1.48593e-07,
-    (float)1.42724e-07,
-    (float)1.48122e-07,
-    (float)4.00747e-07,
-    (float)5.43461e-07,
-    (float)2.77496e-07,
-    (float)6.20694e-07,
-    (float)1.16716e-07,
-    (float)1.89576e-07,
-    (float)6.0537e-07,
-    (float)9.61251e-08,
-    (float)1.84873e-07,
-    (float)5.20459e-07,
-    (float)1.67165e-08,
-    (float)2.61715e-07,
-    (float)4.32539e-08,
-    (float)2.34085e-08,
-    (float)1.4047e-07,
-    (float)1.17325e-09,
-    (float)7.08107e-08,
-    (float)6.04104e-08,
-    (float)1.60926e-07,
-    (float)6.67885e-08,
-    (float)4.92426e-08,
-    (float)3.71822e-07,
-    (float)3.8479e-08,
-    (float)3.42566e-09,
-    (float)6.37133e-08,
-    (float)3.1309e-08,
-    (float)1.09619e-07,
-    (float)5.88073e-08,
-    (float)4.30631e-07,
-    (float)1.35679e-07,
-    (float)1.187e-08,
-    (float)7.8216e-08,
-    (float)3.09556e-08,
-    (float)7.53661e-08,
-    (float)8.00173e-08,
-    (float)6.4696e-08,
-    (float)2.47918e-08,
-    (float)1.17152e-08,
-    (float)2.44296e-08,
-    (float)3.73475e-08,
-    (float)1.72394e-07,
-    (float)1.09476e-07,
-    (float)4.30931e-08,
-    (float)4.03401e-08,
-    (float)1.56195e-08,
-    (float)7.73304e-09,
-    (float)1.12388e-08,
-    (float)3.26085e-08,
-    (float)3.80013e-08,
-    (float)6.38085e-08,
-    (float)3.15623e-08,
-    (float)9.07769e-08,
-    (float)7.33033e-08,
-    (float)2.04861e-09,
-    (float)8.30407e-08,
-    (float)1.71357e-08,
-    (float)2.86378e-08,
-    (float)6.90576e-08,
-    (float)5.88378e-08,
-    (float)6.10208e-08,
-    (float)1.77631e-09,
-    (float)1.26821e-08,
-    (float)5.69167e-08,
-    (float)3.32742e-08,
-    (float)4.75239e-08,
-    (float)5.03111e-08,
-    (float)4.58368e-08,
-    (float)5.99987e-09,
-    (float)1.6646e-08,
-    (float)6.23494e-08,
-    (float)1.37441e-08,
-    (float)3.16342e-08,
-    (float)4.81824e-08,
-    (float)2.93214e-09,
-    (float)5.99932e-09,
-    (float)1.89005e-08,
-    (float)1.9089e-08,
-    (float)6.87486e-08,
-    (float)1.33455e-08,
-    (float)6.58873e-08,
-    (float)3.76789e-08,
-    (float)4.09318e-08,
-    (float)3.96477e-08,
-    (float)8.0422e-09,
-    (float)6.22181e-08,
-    (float)0.00334217,
-    (float)0.986238,
-    (float)0.00226468,
-    (float)0.000483866,
-    (float)0.00566582,
-    (float)0.00026862,
-    (float)0.000583192,
-    (float)0.000416956,
-    (float)0.000254605,
-    (float)0.00018338,
-    (float)2.2874e-05,
-    (float)8.23462e-05,
-    (float)5.61057e-05,
-    (float)3.64675e-05,
-    (float)2.20313e-05,
-    (float)6.72528e-06,
-    (float)2.00006e-05,
-    (float)8.9869e-06,
-    (float)1.64047e-06,
-    (float)1.22472e-06,
-    (float)1.27884e-06,
-    (float)2.82307e-06,
-    (float)5.42451e-07,
-    (float)2.31336e-06,
-    (float)7.19233e-06,
-    (float)3.28703e-06,
-    (float)2.22954e-06,
-    (float)1.55806e-06,
-    (float)1.39584e-06,
-    (float)1.11632e-06,
-    (float)7.2985e-07,
-    (float)1.58116e-06,
-    (float)1.10614e-06,
-    (float)2.07375e-07,
-    (float)8.93819e-07,
-    (float)7.68035e-07,
-    (float)3.74046e-08,
-    (float)6.61256e-07,
-    (float)8.76315e-07,
-    (float)8.43106e-07,
-    (float)3.22988e-07,
-    (float)5.00763e-08,
-    (float)3.55709e-07,
-    (float)1.67615e-07,
-    (float)2.14997e-07,
-    (float)5.08666e-07,
-    (float)7.5507e-08,
-    (float)1.7886e-07,
-    (float)5.43698e-09,
-    (float)7.63497e-08,
-    (float)2.66664e-07,
-    (float)7.43191e-07,
-    (float)2.69317e-07,
-    (float)4.98939e-07,
-    (float)1.17372e-07,
-    (float)2.52438e-07,
-    (float)1.66606e-07,
-    (float)1.53378e-07,
-    (float)1.49376e-07,
-    (float)2.58793e-07,
-    (float)2.94592e-07,
-    (float)2.24597e-07,
-    (float)6.27738e-08,
-    (float)4.54566e-08,
-    (float)1.87453e-08,
-    (float)4.34631e-08,
-    (float)1.24504e-07,
-    (float)1.70524e-07,
-    (float)3.68637e-08,
-    (float)9.87016e-08,
-    (float)7.17584e-09,
-    (float)3.4441e-09,
-    (float)9.67012e-08,
-    (float)7.16062e-09,
-    (float)2.86679e-07,
-    (float)1.19379e-07,
-    (float)5.01405e-08,
-    (float)9.7867e-08,
-    (float)2.15078e-08,
-    (float)8.91172e-08,
-    (float)7.80343e-08,
-    (float)1.01395e-07,
-    (float)7.55852e-08,
-    (float)4.3151e-08,
-    (float)1.25365e-07,
-    (float)1.6352e-09,
-    (float)1.44328e-07,
-    (float)1.62896e-07,
-    (float)3.10753e-08,
-    (float)7.24997e-08,
-    (float)5.45538e-08,
-    (float)7.10437e-09,
-    (float)1.20073e-09,
-    (float)8.6973e-10,
-    (float)2.53173e-08,
-    (float)3.12692e-08,
-    (float)1.60576e-08,
-    (float)4.83263e-08,
-    (float)8.73866e-08,
-    (float)2.22799e-08,
-    (float)5.20414e-08,
-    (float)2.20104e-08,
-    (float)4.84606e-08,
-    (float)1.19424e-08,
-    (float)2.42977e-08,
-    (float)1.22783e-07,
-    (float)1.09891e-08,
-    (float)3.12232e-08,
-    (float)3.64022e-08,
-    (float)5.03316e-08,
-    (float)8.43314e-08,
-    (float)1.85885e-08,
-    (float)4.35656e-08,
-    (float)3.674e-08,
-    (float)2.76635e-09,
-    (float)2.53474e-08,
-    (float)5.9851e-08,
-    (float)3.39487e-08,
-    (float)5.51941e-09,
-    (float)8.06639e-09,
-    (float)4.16396e-08,
-    (float)1.19503e-08,
-    (float)1.92175e-08,
-    (float)5.5457e-08,
-    (float)2.5545e-08,
-    (float)3.67589e-08,
-    (float)3.97104e-08,
-    (float)1.2046e-07,
-    (float)0.00586962,
-    (float)0.975629,
-    (float)0.00405578,
-    (float)0.000876952,
-    (float)0.0107191,
-    (float)0.000447672,
-    (float)0.000819363,
-    (float)0.000674065,
-    (float)0.000417027,
-    (float)0.000166065,
-    (float)3.80728e-05,
-    (float)0.000102218,
-    (float)2.34149e-05,
-    (float)4.56452e-05,
-    (float)3.13579e-05,
-    (float)2.32851e-06,
-    (float)1.6398e-05,
-    (float)1.14681e-05,
-    (float)4.54937e-06,
-    (float)5.91098e-06,
-    (float)4.91779e-07,
-    (float)1.88334e-06,
-    (float)2.19776e-06,
-    (float)9.79258e-07,
-    (float)4.67291e-06,
-    (float)4.04728e-06,
-    (float)3.71453e-06,
-    (float)1.88287e-06,
-    (float)3.07613e-06,
-    (float)1.91561e-06,
-    (float)3.44707e-07,
-    (float)4.00751e-06,
-    (float)1.27793e-06,
-    (float)7.89442e-07,
-    (float)6.48747e-07,
-    (float)8.34555e-07,
-    (float)3.48695e-07,
-    (float)3.32172e-08,
-    (float)1.41244e-07,
-    (float)5.494e-07,
-    (float)2.08198e-07,
-    (float)1.25262e-07,
-    (float)3.04388e-07,
-    (float)4.42254e-07,
-    (float)1.02504e-07,
-    (float)9.33523e-08,
-    (float)7.2995e-07,
-    (float)5.24897e-07,
-    (float)4.87733e-07,
-    (float)8.23553e-07,
-    (float)2.679e-07,
-    (float)1.06864e-08,
-    (float)2.61589e-07,
-    (float)1.06957e-07,
-    (float)6.88471e-07,
-    (float)1.30457e-07,
-    (float)5.04664e-08,
-    (float)6.45362e-07,
-    (float)2.56363e-08,
-    (float)2.06747e-08,
-    (float)3.57731e-10,
-    (float)4.54059e-08,
-    (float)8.97763e-08,
-    (float)1.11648e-07,
-    (float)3.64135e-07,
-    (float)1.58069e-07,
-    (float)6.36794e-08,
-    (float)1.21191e-07,
-    (float)1.08583e-07,
-    (float)1.94622e-07,
-    (float)4.50942e-08,
-    (float)4.14078e-08,
-    (float)1.41932e-07,
-    (float)5.66554e-08,
-    (float)5.20535e-08,
-    (float)1.4505e-07,
-    (float)1.69661e-07,
-    (float)4.81719e-08,
-    (float)5.18658e-08,
-    (float)3.98384e-08,
-    (float)4.10368e-08,
-    (float)2.3759e-09,
-    (float)2.36496e-08,
-    (float)4.62788e-08,
-    (float)6.98867e-08,
-    (float)5.57903e-08,
-    (float)6.91554e-08,
-    (float)1.77695e-07,
-    (float)1.71433e-08,
-    (float)7.90345e-08,
-    (float)1.24026e-07,
-    (float)3.04141e-08,
-    (float)8.15814e-08,
-    (float)3.74933e-08,
-    (float)3.03365e-08,
-    (float)4.65022e-08,
-    (float)9.70514e-10,
-    (float)1.77866e-08,
-    (float)6.81147e-08,
-    (float)9.75562e-10,
-    (float)2.88706e-08,
-    (float)6.02468e-08,
-    (float)1.93654e-08,
-    (float)7.77126e-08,
-    (float)1.45233e-08,
-    (float)1.02086e-07,
-    (float)2.27319e-08,
-    (float)7.15402e-09,
-    (float)8.86066e-08,
-    (float)3.7782e-08,
-    (float)2.89114e-08,
-    (float)1.85315e-09,
-    (float)2.53803e-08,
-    (float)6.44567e-08,
-    (float)2.1275e-08,
-    (float)5.17681e-08,
-    (float)6.97887e-08,
-    (float)1.05752e-08,
-    (float)4.17793e-09,
-    (float)1.4482e-08,
-    (float)3.36405e-08,
-    (float)7.39778e-09,
-    (float)1.77385e-08,
-    (float)3.78665e-08,
-    (float)4.02994e-08,
-    (float)1.76836e-08,
-    (float)4.51882e-08,
-    (float)1.31891e-07,
-    (float)0.00915323,
-    (float)0.961992,
-    (float)0.00639169,
-    (float)0.00140957,
-    (float)0.0175586,
-    (float)0.000645611,
-    (float)0.000964907,
-    (float)0.000887709,
-    (float)0.000558741,
-    (float)9.78792e-05,
-    (float)5.20101e-05,
-    (float)8.89656e-05,
-    (float)1.32116e-06,
-    (float)4.89525e-05,
-    (float)3.42691e-05,
-    (float)1.60939e-05,
-    (float)1.76105e-05,
-    (float)6.33591e-06,
-    (float)8.28522e-06,
-    (float)1.63492e-05,
-    (float)1.29336e-06,
-    (float)9.12081e-07,
-    (float)3.44714e-06,
-    (float)3.39073e-07,
-    (float)1.96444e-06,
-    (float)3.2106e-06,
-    (float)3.92874e-06,
-    (float)9.18368e-06,
-    (float)3.88126e-06,
-    (float)1.45391e-06,
-    (float)1.48161e-06,
-    (float)2.30906e-06,
-    (float)8.42036e-08,
-    (float)4.13173e-07,
-    (float)7.81422e-07,
-    (float)1.07336e-06,
-    (float)7.33842e-07,
-    (float)2.26367e-07,
-    (float)7.83033e-07,
-    (float)2.70221e-09,
-    (float)1.07327e-07,
-    (float)8.49647e-07,
-    (float)1.74721e-06,
-    (float)5.7952e-07,
-    (float)3.32439e-07,
-    (float)3.40398e-07,
-    (float)5.0956e-08,
-    (float)2.28029e-07,
-    (float)2.89561e-07,
-    (float)2.01461e-07,
-    (float)2.048e-07,
-    (float)3.41421e-07,
-    (float)2.78024e-07,
-    (float)3.86944e-07,
-    (float)2.50343e-07,
-    (float)1.53765e-07,
-    (float)5.91065e-07,
-    (float)2.62803e-07,
-    (float)2.17453e-07,
-    (float)4.19418e-08,
-    (float)7.4037e-07,
-    (float)1.00523e-07,
-    (float)1.66787e-07,
-    (float)1.72526e-07,
-    (float)1.54743e-07,
-    (float)7.96438e-08,
-    (float)5.2298e-08,
-    (float)1.5286e-07,
-    (float)1.10506e-07,
-    (float)3.97372e-09,
-    (float)7.31167e-08,
-    (float)7.1283e-08,
-    (float)2.21793e-07,
-    (float)1.70577e-08,
-    (float)3.47068e-09,
-    (float)1.14607e-07,
-    (float)7.91239e-08,
-    (float)8.05684e-08,
-    (float)1.5506e-07,
-    (float)3.86883e-07,
-    (float)8.2591e-08,
-    (float)7.3836e-09,
-    (float)2.09113e-08,
-    (float)4.9101e-08,
-    (float)5.10118e-09,
-    (float)2.99115e-09,
-    (float)2.88265e-08,
-    (float)7.99063e-08,
-    (float)4.3233e-08,
-    (float)2.61207e-08,
-    (float)2.58725e-07,
-    (float)4.09863e-08,
-    (float)2.06561e-08,
-    (float)1.50265e-08,
-    (float)5.7984e-08,
-    (float)1.09809e-07,
-    (float)8.58662e-09,
-    (float)5.72765e-08,
-    (float)1.37464e-07,
-    (float)3.63833e-09,
-    (float)1.62005e-09,
-    (float)2.46067e-08,
-    (float)4.13746e-08,
-    (float)3.98518e-08,
-    (float)2.58176e-08,
-    (float)5.5034e-08,
-    (float)8.5427e-08,
-    (float)4.9669e-09,
-    (float)3.91595e-08,
-    (float)4.73615e-08,
-    (float)4.87193e-08,
-    (float)3.51907e-08,
-    (float)1.54382e-08,
-    (float)1.13503e-07,
-    (float)8.83015e-09,
-    (float)1.40696e-08,
-    (float)3.10008e-08,
-    (float)4.22585e-08,
-    (float)3.76016e-08,
-    (float)6.06357e-09,
-    (float)5.33024e-08,
-    (float)2.99679e-08,
-    (float)7.48994e-08,
-    (float)4.83336e-08,
-    (float)4.01551e-08,
-    (float)3.42068e-08,
-    (float)3.09334e-08,
-    (float)3.17553e-08,
-    (float)0.0132209,
-    (float)0.945423,
-    (float)0.00924294,
-    (float)0.00209695,
-    (float)0.0261376,
-    (float)0.000855502,
-    (float)0.000990173,
-    (float)0.00098108,
-    (float)0.000644733,
-    (float)4.08112e-05,
-    (float)5.69761e-05,
-    (float)4.8253e-05,
-    (float)2.75784e-05,
-    (float)4.1696e-05,
-    (float)3.41757e-05,
-    (float)3.74007e-05,
-    (float)2.55781e-05,
-    (float)3.26001e-06,
-    (float)8.90028e-06,
-    (float)1.9279e-05,
-    (float)1.29719e-05,
-    (float)4.19151e-07,
-    (float)5.7316e-07,
-    (float)1.63963e-06,
-    (float)4.02525e-06,
-    (float)1.77769e-06,
-    (float)2.59252e-06,
-    (float)1.28688e-05,
-    (float)7.83852e-07,
-    (float)1.09994e-06,
-    (float)3.3062e-08,
-    (float)1.82796e-06,
-    (float)1.4943e-06,
-    (float)5.63704e-07,
-    (float)3.14261e-06,
-    (float)3.54594e-06,
-    (float)8.27774e-08,
-    (float)2.22808e-07,
-    (float)6.8991e-07,
-    (float)7.97194e-07,
-    (float)1.12741e-07,
-    (float)1.52409e-07,
-    (float)1.21168e-06,
-    (float)1.75743e-08,
-    (float)2.21737e-07,
-    (float)3.81789e-07,
-    (float)5.50403e-07,
-    (float)1.78558e-07,
-    (float)2.01568e-07,
-    (float)5.37846e-07,
-    (float)5.02514e-07,
-    (float)5.19626e-07,
-    (float)5.53524e-07,
-    (float)5.49403e-08,
-    (float)6.95023e-07,
-    (float)1.48626e-07,
-    (float)1.05615e-07,
-    (float)8.73746e-07,
-    (float)3.3589e-08,
-    (float)3.61993e-07,
-    (float)2.1275e-07,
-    (float)3.22612e-08,
-    (float)1.19337e-07,
-    (float)3.62164e-07,
-    (float)3.82426e-08,
-    (float)1.21552e-07,
-    (float)1.50238e-07,
-    (float)2.60711e-07,
-    (float)2.60017e-07,
-    (float)2.2955e-07,
-    (float)6.5876e-08,
-    (float)6.11052e-08,
-    (float)4.16175e-08,
-    (float)4.88578e-08,
-    (float)5.93454e-08,
-    (float)2.32001e-07,
-    (float)3.4918e-09,
-    (float)1.12604e-09,
-    (float)3.96392e-08,
-    (float)5.28804e-08,
-    (float)8.00897e-08,
-    (float)4.77607e-08,
-    (float)4.27049e-07,
-    (float)1.4989e-07,
-    (float)3.00198e-08,
-    (float)1.18108e-08,
-    (float)4.10659e-08,
-    (float)3.39825e-08,
-    (float)6.11082e-09,
-    (float)1.62616e-08,
-    (float)7.94473e-08,
-    (float)1.66469e-08,
-    (float)4.8848e-08,
-    (float)2.23968e-07,
-    (float)3.78396e-08,
-    (float)1.08102e-07,
-    (float)3.13537e-08,
-    (float)4.95041e-08,
-    (float)1.44175e-07,
-    (float)1.67866e-08,
-    (float)7.77603e-08,
-    (float)6.1912e-08,
-    (float)1.93811e-08,
-    (float)1.58624e-08,
-    (float)1.48337e-09,
-    (float)6.19063e-08,
-    (float)6.92045e-08,
-    (float)1.39221e-08,
-    (float)5.79397e-08,
-    (float)2.75743e-08,
-    (float)4.91111e-09,
-    (float)4.69781e-08,
-    (float)8.33893e-09,
-    (float)1.30693e-07,
-    (float)4.90668e-09,
-    (float)9.07835e-08,
-    (float)7.39805e-08,
-    (float)1.27016e-08,
-    (float)2.09356e-08,
-    (float)6.42415e-08,
-    (float)2.10451e-08,
-    (float)1.14378e-08,
-    (float)1.04057e-09,
-    (float)8.00143e-08,
-    (float)2.92894e-08,
-    (float)2.70982e-08,
-    (float)8.59933e-08,
-    (float)4.8844e-08,
-    (float)0.0181078,
-    (float)0.925955,
-    (float)0.0125972,
-    (float)0.00294615,
-    (float)0.0363384,
-    (float)0.00107899,
-    (float)0.000898669,
-    (float)0.000925105,
-    (float)0.000656818,
-    (float)7.51626e-05,
-    (float)5.54654e-05,
-    (float)8.12069e-06,
-    (float)9.44102e-05,
-    (float)2.51268e-05,
-    (float)3.97721e-05,
-    (float)4.13064e-05,
-    (float)3.47234e-05,
-    (float)2.03495e-05,
-    (float)5.87459e-06,
-    (float)1.22971e-05,
-    (float)2.98342e-05,
-    (float)1.30682e-07,
-    (float)1.79809e-06,
-    (float)9.62692e-07,
-    (float)4.60737e-06,
-    (float)1.54373e-06,
-    (float)5.0921e-07,
-    (float)4.26761e-06,
-    (float)9.95319e-07,
-    (float)1.45248e-06,
-    (float)6.30123e-06,
-    (float)4.59081e-06,
-    (float)3.02841e-06,
-    (float)1.72184e-06,
-    (float)2.91614e-06,
-    (float)1.14201e-06,
-    (float)7.39938e-07,
-    (float)9.65238e-08,
-    (float)7.48788e-07,
-    (float)1.36125e-06,
-    (float)1.23264e-07,
-    (float)5.5821e-07,
-    (float)1.10549e-08,
-    (float)4.01644e-08,
-    (float)2.32025e-07,
-    (float)2.15036e-06,
-    (float)1.74857e-07,
-    (float)8.43115e-07,
-    (float)3.85237e-07,
-    (float)1.05084e-07,
-    (float)2.3289e-07,
-    (float)3.1617e-07,
-    (float)3.0982e-07,
-    (float)5.81334e-07,
-    (float)1.57633e-07,
-    (float)2.47706e-07,
-    (float)8.64002e-11,
-    (float)3.89061e-07,
-    (float)2.91852e-07,
-    (float)2.51966e-07,
-    (float)8.20919e-07,
-    (float)3.909e-07,
-    (float)1.56791e-07,
-    (float)2.60569e-07,
-    (float)2.98758e-08,
-    (float)3.73007e-07,
-    (float)6.39825e-08,
-    (float)1.80915e-08,
-    (float)1.34604e-08,
-    (float)8.70184e-08,
-    (float)1.64453e-07,
-    (float)2.26369e-07,
-    (float)3.7165e-07,
-    (float)9.17149e-08,
-    (float)8.96689e-08,
-    (float)1.22612e-08,
-    (float)2.77581e-08,
-    (float)1.47788e-07,
-    (float)2.24172e-07,
-    (float)5.44781e-08,
-    (float)4.56778e-08,
-    (float)9.09769e-09,
-    (float)5.82103e-08,
-    (float)4.65073e-10,
-    (float)2.45677e-08,
-    (float)3.24792e-07,
-    (float)2.59747e-07,
-    (float)2.16687e-07,
-    (float)5.36408e-09,
-    (float)1.84616e-08,
-    (float)6.57676e-08,
-    (float)9.77276e-09,
-    (float)1.24113e-08,
-    (float)4.0597e-08,
-    (float)2.72098e-08,
-    (float)4.09882e-08,
-    (float)1.19787e-08,
-    (float)4.15656e-08,
-    (float)3.34236e-07,
-    (float)1.45553e-08,
-    (float)5.94927e-08,
-    (float)3.49463e-08,
-    (float)7.30696e-08,
-    (float)1.27847e-07,
-    (float)5.25877e-10,
-    (float)5.47191e-08,
-    (float)9.19571e-08,
-    (float)9.94858e-09,
-    (float)2.51208e-08,
-    (float)3.51331e-08,
-    (float)5.25803e-08,
-    (float)1.70308e-07,
-    (float)3.73481e-08,
-    (float)4.40755e-08,
-    (float)2.34758e-08,
-    (float)1.87606e-08,
-    (float)4.29233e-08,
-    (float)6.23826e-09,
-    (float)5.0902e-08,
-    (float)7.26576e-08,
-    (float)1.68784e-08,
-    (float)8.14011e-10,
-    (float)9.16025e-09,
-    (float)5.49703e-08,
-    (float)9.43088e-08,
-    (float)4.12598e-08,
-    (float)1.64651e-08,
-    (float)1.05537e-07,
-    (float)0.0238406,
-    (float)0.903775,
-    (float)0.0164043,
-    (float)0.00396365,
-    (float)0.0478696,
-    (float)0.00135043,
-    (float)0.000749498,
-    (float)0.000718357,
-    (float)0.000588226,
-    (float)0.000249398,
-    (float)5.10042e-05,
-    (float)8.83214e-06,
-    (float)0.000147473,
-    (float)9.8567e-06,
-    (float)5.45327e-05,
-    (float)2.20247e-05,
-    (float)4.19366e-05,
-    (float)5.78341e-05,
-    (float)3.6194e-06,
-    (float)9.95451e-06,
-    (float)2.74718e-05,
-    (float)1.90966e-07,
-    (float)7.42475e-06,
-    (float)1.32916e-06,
-    (float)1.06344e-06,
-    (float)9.11658e-07,
-    (float)3.80456e-07,
-    (float)1.28643e-06,
-    (float)3.47668e-06,
-    (float)1.49936e-06,
-    (float)1.38625e-05,
-    (float)2.14198e-06,
-    (float)6.58384e-07,
-    (float)1.04626e-06,
-    (float)1.18819e-06,
-    (float)7.51895e-07,
-    (float)2.25721e-06,
-    (float)9.75441e-07,
-    (float)3.04731e-06,
-    (float)9.95305e-08,
-    (float)6.37499e-08,
-    (float)1.19199e-07,
-    (float)1.18724e-06,
-    (float)5.56401e-07,
-    (float)3.35332e-08,
-    (float)4.77262e-07,
-    (float)6.67777e-07,
-    (float)3.69556e-07,
-    (float)7.50317e-07,
-    (float)4.09037e-08,
-    (float)2.94373e-07,
-    (float)3.69902e-07,
-    (float)4.45165e-08,
-    (float)1.722e-07,
-    (float)5.99214e-07,
-    (float)2.87654e-07,
-    (float)7.3915e-07,
-    (float)3.73809e-07,
-    (float)1.26615e-08,
-    (float)8.52509e-08,
-    (float)2.61097e-08,
-    (float)1.64746e-07,
-    (float)3.87158e-07,
-    (float)3.0251e-07,
-    (float)6.03123e-07,
-    (float)5.78052e-08,
-    (float)1.89012e-07,
-    (float)2.06603e-08,
-    (float)4.80001e-07,
-    (float)5.35597e-08,
-    (float)2.01849e-08,
-    (float)1.19898e-08,
-    (float)1.07069e-07,
-    (float)6.04358e-08,
-    (float)1.28304e-07,
-    (float)1.40528e-07,
-    (float)1.1518e-07,
-    (float)1.09935e-07,
-    (float)4.18157e-08,
-    (float)4.18375e-08,
-    (float)1.62545e-07,
-    (float)7.11389e-08,
-    (float)5.28752e-08,
-    (float)1.85304e-08,
-    (float)1.68293e-08,
-    (float)2.91407e-08,
-    (float)1.2968e-08,
-    (float)2.44725e-08,
-    (float)6.3828e-08,
-    (float)1.08391e-07,
-    (float)3.312e-07,
-    (float)1.49758e-08,
-    (float)7.32139e-09,
-    (float)4.89939e-09,
-    (float)1.87458e-08,
-    (float)1.67373e-08,
-    (float)1.3742e-09,
-    (float)1.54087e-08,
-    (float)3.43276e-08,
-    (float)4.99461e-09,
-    (float)8.98549e-08,
-    (float)7.45166e-08,
-    (float)3.55214e-08,
-    (float)8.64621e-08,
-    (float)7.83124e-09,
-    (float)1.12653e-07,
-    (float)2.08414e-08,
-    (float)6.02321e-08,
-    (float)3.139e-08,
-    (float)8.13608e-09,
-    (float)3.52844e-09,
-    (float)1.13494e-11,
-    (float)8.27369e-08,
-    (float)6.7874e-08,
-    (float)1.38085e-08,
-    (float)5.76043e-08,
-    (float)5.95352e-08,
-    (float)8.53714e-09,
-    (float)1.28382e-08,
-    (float)8.01013e-09,
-    (float)6.46646e-08,
-    (float)8.55565e-09,
-    (float)3.81309e-08,
-    (float)2.11719e-08,
-    (float)1.14209e-08,
-    (float)1.59584e-08,
-    (float)2.18321e-08,
-    (float)7.67606e-08,
-    (float)0.0304427,
-    (float)0.878878,
-    (float)0.0206118,
-    (float)0.00516364,
-    (float)0.060469,
-    (float)0.00172413,
-    (float)0.00065318,
-    (float)0.000450405,
-    (float)0.000455726,
-    (float)0.000543046,
-    (float)6.23417e-05,
-    (float)8.23551e-05,
-    (float)0.000136974,
-    (float)1.02331e-05,
-    (float)7.05599e-05,
-    (float)8.81476e-06,
-    (float)4.59691e-05,
-    (float)8.60814e-05,
-    (float)5.07551e-06,
-    (float)1.82084e-05,
-    (float)7.85873e-06,
-    (float)2.19957e-06,
-    (float)6.55526e-06,
-    (float)1.54657e-05,
-    (float)4.76091e-07,
-    (float)4.69496e-08,
-    (float)1.09392e-06,
-    (float)6.86827e-06,
-    (float)1.95393e-06,
-    (float)1.24437e-06,
-    (float)6.15612e-06,
-    (float)1.51212e-06,
-    (float)2.54479e-07,
-    (float)5.41427e-06,
-    (float)2.81926e-06,
-    (float)2.04323e-06,
-    (float)2.00512e-06,
-    (float)1.6985e-06,
-    (float)3.985e-07,
-    (float)3.02918e-06,
-    (float)1.52455e-07,
-    (float)8.12707e-07,
-    (float)5.37985e-07,
-    (float)3.2955e-07,
-    (float)1.22633e-07,
-    (float)1.8468e-07,
-    (float)1.66084e-07,
-    (float)6.46737e-08,
-    (float)5.9686e-07,
-    (float)7.27937e-07,
-    (float)1.30259e-06,
-    (float)4.54656e-07,
-    (float)2.29769e-07,
-    (float)1.19594e-07,
-    (float)5.46063e-08,
-    (float)4.77571e-08,
-    (float)1.36934e-08,
-    (float)4.65331e-07,
-    (float)3.22736e-07,
-    (float)6.07739e-07,
-    (float)4.47489e-07,
-    (float)3.5694e-08,
-    (float)3.18935e-07,
-    (float)1.14665e-08,
-    (float)3.93819e-08,
-    (float)5.18521e-07,
-    (float)8.20196e-08,
-    (float)4.52221e-07,
-    (float)6.62439e-08,
-    (float)5.93923e-08,
-    (float)5.07035e-08,
-    (float)5.14668e-07,
-    (float)9.0474e-08,
-    (float)3.7935e-08,
-    (float)9.65974e-08,
-    (float)1.5159e-07,
-    (float)3.37755e-08,
-    (float)4.45724e-08,
-    (float)7.8956e-08,
-    (float)1.13547e-07,
-    (float)2.30607e-07,
-    (float)3.97498e-08,
-    (float)2.94168e-08,
-    (float)1.60588e-07,
-    (float)2.11021e-08,
-    (float)6.49267e-08,
-    (float)9.3433e-08,
-    (float)7.71788e-09,
-    (float)2.74769e-08,
-    (float)2.97486e-09,
-    (float)2.49774e-08,
-    (float)4.61703e-09,
-    (float)3.92972e-08,
-    (float)1.99071e-07,
-    (float)1.83678e-07,
-    (float)2.65008e-08,
-    (float)4.21454e-09,
-    (float)4.6131e-09,
-    (float)3.99886e-08,
-    (float)9.36734e-09,
-    (float)5.83342e-09,
-    (float)1.52823e-08,
-    (float)3.69985e-08,
-    (float)4.08423e-08,
-    (float)2.62973e-08,
-    (float)5.67496e-08,
-    (float)7.39523e-08,
-    (float)3.49113e-08,
-    (float)3.52315e-08,
-    (float)1.29414e-08,
-    (float)6.4425e-08,
-    (float)2.56801e-09,
-    (float)8.37808e-08,
-    (float)2.39983e-09,
-    (float)8.22864e-09,
-    (float)7.13421e-08,
-    (float)5.49261e-08,
-    (float)6.52295e-08,
-    (float)1.12798e-08,
-    (float)4.04407e-08,
-    (float)3.86027e-08,
-    (float)1.07498e-08,
-    (float)2.7902e-08,
-    (float)2.04799e-08,
-    (float)3.48205e-08,
-    (float)5.01842e-08,
-    (float)3.68608e-09,
-    (float)6.58181e-08,
-    (float)0.0379034,
-    (float)0.851451,
-    (float)0.0251608,
-    (float)0.00655152,
-    (float)0.0736763,
-    (float)0.00228958,
-    (float)0.000750558,
-    (float)0.000265919,
-    (float)0.000287373,
-    (float)0.000864379,
-    (float)0.00010449,
-    (float)0.00023483,
-    (float)6.73322e-05,
-    (float)3.05786e-05,
-    (float)7.13139e-05,
-    (float)3.63811e-05,
-    (float)4.18361e-05,
-    (float)7.8742e-05,
-    (float)5.222e-06,
-    (float)2.44631e-05,
-    (float)1.26814e-05,
-    (float)4.91048e-06,
-    (float)1.06605e-06,
-    (float)3.22014e-05,
-    (float)3.77143e-06,
-    (float)1.82947e-06,
-    (float)1.36628e-07,
-    (float)4.34728e-06,
-    (float)2.42331e-07,
-    (float)8.05204e-07,
-    (float)3.11739e-07,
-    (float)3.81692e-06,
-    (float)1.3768e-06,
-    (float)9.70459e-06,
-    (float)2.84441e-06,
-    (float)1.26871e-07,
-    (float)3.12751e-06,
-    (float)1.40202e-06,
-    (float)9.43418e-07,
-    (float)3.40741e-06,
-    (float)1.29811e-07,
-    (float)6.83024e-07,
-    (float)1.20228e-06,
-    (float)5.04727e-07,
-    (float)2.74299e-07,
-    (float)5.40485e-07,
-    (float)9.01874e-07,
-    (float)1.29062e-07,
-    (float)5.00904e-08,
-    (float)1.86718e-07,
-    (float)7.29829e-07,
-    (float)3.91439e-08,
-    (float)1.63028e-07,
-    (float)1.05402e-06,
-    (float)5.36755e-07,
-    (float)3.59333e-07,
-    (float)3.34229e-07,
-    (float)1.07664e-09,
-    (float)9.80231e-08,
-    (float)1.28069e-07,
-    (float)3.35683e-07,
-    (float)4.1504e-07,
-    (float)3.60679e-07,
-    (float)3.50607e-07,
-    (float)3.8219e-09,
-    (float)5.96419e-07,
-    (float)1.57952e-07,
-    (float)4.10319e-08,
-    (float)5.25633e-07,
-    (float)1.18179e-08,
-    (float)5.22124e-07,
-    (float)1.48428e-07,
-    (float)1.49196e-07,
-    (float)6.02825e-08,
-    (float)2.50444e-07,
-    (float)1.33251e-07,
-    (float)1.26906e-07,
-    (float)8.65233e-08,
-    (float)1.36466e-07,
-    (float)7.91479e-08,
-    (float)2.92255e-08,
-    (float)7.19047e-08,
-    (float)8.65966e-08,
-    (float)1.96792e-07,
-    (float)4.6402e-08,
-    (float)5.64123e-08,
-    (float)3.374e-08,
-    (float)9.60419e-10,
-    (float)1.44457e-07,
-    (float)7.44958e-08,
-    (float)5.39742e-08,
-    (float)2.83047e-10,
-    (float)5.7415e-09,
-    (float)3.76894e-08,
-    (float)6.0401e-08,
-    (float)2.56507e-08,
-    (float)1.45359e-08,
-    (float)1.32996e-07,
-    (float)1.49607e-07,
-    (float)7.837e-08,
-    (float)2.92036e-08,
-    (float)1.78396e-08,
-    (float)2.73174e-09,
-    (float)2.34806e-09,
-    (float)2.25615e-08,
-    (float)7.41841e-09,
-    (float)7.096e-08,
-    (float)5.47703e-08,
-    (float)9.55642e-08,
-    (float)3.32859e-08,
-    (float)5.3482e-09,
-    (float)1.1946e-08,
-    (float)1.51891e-07,
-    (float)2.63351e-08,
-    (float)6.06078e-08,
-    (float)1.31178e-08,
-    (float)4.10361e-09,
-    (float)8.62948e-08,
-    (float)3.35669e-08,
-    (float)8.99933e-08,
-    (float)1.26599e-08,
-    (float)3.76355e-08,
-    (float)5.93934e-09,
-    (float)4.56048e-08,
-    (float)3.31153e-08,
-    (float)5.58776e-09,
-    (float)3.67053e-08,
-    (float)7.11213e-08,
-    (float)0.046223,
-    (float)0.821637,
-    (float)0.0299838,
-    (float)0.00810167,
-    (float)0.0870389,
-    (float)0.00312325,
-    (float)0.0012298,
-    (float)0.000370357,
-    (float)0.000132189,
-    (float)0.00107035,
-    (float)0.00018547,
-    (float)0.000437652,
-    (float)1.66554e-05,
-    (float)5.68212e-05,
-    (float)4.48514e-05,
-    (float)9.56811e-05,
-    (float)2.7855e-05,
-    (float)4.2284e-05,
-    (float)2.07458e-06,
-    (float)1.93353e-05,
-    (float)6.42166e-05,
-    (float)5.46006e-06,
-    (float)6.40324e-06,
-    (float)2.22397e-05,
-    (float)4.65541e-06,
-    (float)4.23066e-06,
-    (float)5.2674e-06,
-    (float)2.79828e-07,
-    (float)1.99106e-07,
-    (float)5.23766e-07,
-    (float)6.59186e-06,
-    (float)1.3183e-06,
-    (float)1.30848e-06,
-    (float)3.46998e-06,
-    (float)3.50768e-06,
-    (float)3.22499e-06,
-    (float)4.42446e-06,
-    (float)2.20508e-06,
-    (float)6.54191e-08,
-    (float)1.95089e-06,
-    (float)1.34879e-06,
-    (float)3.89717e-07,
-    (float)3.9296e-06,
-    (float)7.37701e-07,
-    (float)2.59027e-07,
-    (float)1.90146e-07,
-    (float)1.12789e-07,
-    (float)6.94012e-07,
-    (float)2.95927e-08,
-    (float)6.99462e-07,
-    (float)2.73356e-08,
-    (float)9.90704e-08,
-    (float)2.19847e-07,
-    (float)1.21455e-06,
-    (float)1.78733e-07,
-    (float)2.54813e-07,
-    (float)6.34303e-07,
-    (float)2.96732e-07,
-    (float)3.78503e-07,
-    (float)4.11787e-07,
-    (float)2.16822e-08,
-    (float)1.57271e-07,
-    (float)2.88227e-07,
-    (float)3.11838e-07,
-    (float)4.87705e-07,
-    (float)1.28627e-07,
-    (float)1.55848e-07,
-    (float)9.24619e-08,
-    (float)6.85825e-07,
-    (float)2.30338e-07,
-    (float)3.61826e-09,
-    (float)3.12209e-07,
-    (float)2.58213e-08,
-    (float)5.82565e-07,
-    (float)9.90289e-08,
-    (float)2.52218e-07,
-    (float)2.68168e-08,
-    (float)1.35819e-07,
-    (float)5.97174e-08,
-    (float)2.23661e-07,
-    (float)4.0686e-08,
-    (float)9.50382e-08,
-    (float)3.25789e-08,
-    (float)1.86853e-07,
-    (float)4.96415e-08,
-    (float)1.01842e-07,
-    (float)9.98523e-08,
-    (float)6.64569e-08,
-    (float)9.85225e-08,
-    (float)7.42409e-08,
-    (float)2.29256e-08,
-    (float)3.91196e-08,
-    (float)6.68452e-08,
-    (float)3.5694e-08,
-    (float)1.60914e-07,
-    (float)1.10599e-08,
-    (float)8.20223e-09,
-    (float)3.1487e-08,
-    (float)8.16547e-08,
-    (float)5.87758e-08,
-    (float)5.22799e-08,
-    (float)3.89607e-08,
-    (float)9.54896e-08,
-    (float)9.87826e-09,
-    (float)2.57558e-07,
-    (float)9.40471e-09,
-    (float)1.62339e-08,
-    (float)8.65507e-09,
-    (float)1.00867e-09,
-    (float)4.86553e-08,
-    (float)2.96846e-08,
-    (float)3.72839e-08,
-    (float)4.56038e-08,
-    (float)1.96919e-08,
-    (float)4.17429e-08,
-    (float)8.73467e-09,
-    (float)7.33516e-08,
-    (float)4.21542e-08,
-    (float)1.63184e-08,
-    (float)2.0558e-08,
-    (float)1.40803e-08,
-    (float)1.07793e-07,
-    (float)1.71388e-08,
-    (float)4.47204e-08,
-    (float)1.07546e-08,
-    (float)5.2245e-08,
-    (float)7.82972e-08,
-    (float)7.37867e-08,
-    (float)0.0554748,
-    (float)0.789552,
-    (float)0.0349751,
-    (float)0.00984501,
-    (float)0.099956,
-    (float)0.00434614,
-    (float)0.0022444,
-    (float)0.00100487,
-    (float)3.85546e-05,
-    (float)0.00105689,
-    (float)0.000286868,
-    (float)0.000644054,
-    (float)9.40842e-05,
-    (float)6.49531e-05,
-    (float)1.19282e-05,
-    (float)0.000130345,
-    (float)7.79393e-06,
-    (float)2.08491e-05,
-    (float)1.01523e-05,
-    (float)1.39942e-05,
-    (float)0.000111686,
-    (float)3.78591e-06,
-    (float)1.9807e-05,
-    (float)6.19434e-06,
-    (float)3.45005e-06,
-    (float)2.47613e-06,
-    (float)1.69499e-05,
-    (float)5.93966e-06,
-    (float)1.58855e-06,
-    (float)1.76057e-09,
-    (float)4.45604e-06,
-    (float)1.85974e-07,
-    (float)1.58646e-06,
-    (float)2.46052e-06,
-    (float)2.95849e-06,
-    (float)2.73214e-06,
-    (float)2.36642e-06,
-    (float)3.14604e-06,
-    (float)4.16317e-06,
-    (float)2.63732e-06,
-    (float)1.76138e-06,
-    (float)7.26143e-07,
-    (float)1.6862e-06,
-    (float)3.33043e-07,
-    (float)1.07904e-06,
-    (float)2.13582e-06,
-    (float)1.54974e-06,
-    (float)7.88403e-08,
-    (float)6.50085e-08,
-    (float)4.71815e-08,
-    (float)1.03399e-06,
-    (float)2.63566e-07,
-    (float)4.26714e-07,
-    (float)2.18349e-08,
-    (float)1.73704e-07,
-    (float)7.27882e-08,
-    (float)9.02405e-07,
-    (float)5.2543e-07,
-    (float)5.94788e-07,
-    (float)4.85403e-07,
-    (float)1.63031e-07,
-    (float)2.04338e-07,
-    (float)6.49996e-07,
-    (float)5.97313e-08,
-    (float)1.14594e-07,
-    (float)2.85569e-07,
-    (float)1.88272e-07,
-    (float)6.57356e-07,
-    (float)1.97193e-08,
-    (float)6.31384e-08,
-    (float)6.66193e-07,
-    (float)3.14544e-07,
-    (float)1.05961e-07,
-    (float)2.42913e-07,
-    (float)1.08605e-07,
-    (float)1.93256e-08,
-    (float)4.80416e-07,
-    (float)4.89842e-08,
-    (float)6.02128e-07,
-    (float)5.59011e-08,
-    (float)6.58419e-08,
-    (float)5.47023e-08,
-    (float)2.76865e-07,
-    (float)1.30357e-07,
-    (float)9.13055e-08,
-    (float)5.67443e-08,
-    (float)6.00896e-08,
-    (float)5.68352e-09,
-    (float)7.28891e-08,
-    (float)2.0577e-07,
-    (float)6.87975e-08,
-    (float)7.15787e-08,
-    (float)3.64086e-08,
-    (float)3.144e-08,
-    (float)1.32585e-07,
-    (float)1.57373e-08,
-    (float)2.70081e-08,
-    (float)6.97751e-08,
-    (float)1.01805e-08,
-    (float)9.66811e-08,
-    (float)4.86833e-08,
-    (float)5.82458e-09,
-    (float)4.47626e-08,
-    (float)5.16615e-08,
-    (float)7.00805e-08,
-    (float)2.35557e-09,
-    (float)1.89098e-08,
-    (float)1.47582e-08,
-    (float)1.60985e-07,
-    (float)1.35235e-07,
-    (float)7.85221e-08,
-    (float)2.5784e-08,
-    (float)3.63415e-08,
-    (float)2.45527e-08,
-    (float)5.37842e-08,
-    (float)1.52341e-08,
-    (float)2.50371e-08,
-    (float)7.08523e-09,
-    (float)1.10289e-07,
-    (float)1.09731e-07,
-    (float)1.3838e-07,
-    (float)2.30438e-08,
-    (float)7.73927e-08,
-    (float)3.15879e-08,
-    (float)5.3833e-08,
-    (float)1.51637e-07,
-    (float)9.26648e-08,
-    (float)3.86644e-09,
-    (float)0.0655828,
-    (float)0.755513,
-    (float)0.0400539,
-    (float)0.011758,
-    (float)0.111868,
-    (float)0.00601797,
-    (float)0.00396393,
-    (float)0.00239836,
-    (float)5.07656e-05,
-    (float)0.000806565,
-    (float)0.000367224,
-    (float)0.000788673,
-    (float)0.000343287,
-    (float)4.45817e-05,
-    (float)3.05709e-05,
-    (float)8.95521e-05,
-    (float)5.3299e-07,
-    (float)3.10466e-05,
-    (float)4.70163e-05,
-    (float)2.10784e-05,
-    (float)8.39019e-05,
-    (float)6.86838e-06,
-    (float)1.67649e-05,
-    (float)3.30869e-05,
-    (float)5.16134e-06,
-    (float)4.5786e-06,
-    (float)1.36427e-05,
-    (float)6.98235e-06,
-    (float)7.99684e-06,
-    (float)1.35056e-06,
-    (float)5.42558e-07,
-    (float)4.03036e-07,
-    (float)1.15434e-06,
-    (float)5.08956e-06,
-    (float)1.12215e-07,
-    (float)6.37465e-07,
-    (float)2.28134e-06,
-    (float)2.13875e-06,
-    (float)6.70462e-06,
-    (float)4.01466e-08,
-    (float)1.00658e-06,
-    (float)3.26833e-06,
-    (float)1.63856e-06,
-    (float)1.49472e-06,
-    (float)1.12017e-06,
-    (float)1.86422e-06,
-    (float)8.73429e-08,
-    (float)2.10495e-06,
-    (float)3.88211e-07,
-    (float)1.29099e-06,
-    (float)1.37807e-07,
-    (float)3.15919e-08,
-    (float)2.00411e-07,
-    (float)6.20561e-07,
-    (float)5.30624e-07,
-    (float)1.5436e-07,
-    (float)4.88435e-08,
-    (float)1.10765e-07,
-    (float)2.38799e-07,
-    (float)2.17842e-07,
-    (float)4.16357e-07,
-    (float)1.18267e-06,
-    (float)2.52937e-07,
-    (float)2.55047e-07,
-    (float)1.43837e-08,
-    (float)4.36909e-07,
-    (float)1.33337e-07,
-    (float)2.31816e-07,
-    (float)1.3196e-07,
-    (float)5.39615e-08,
-    (float)2.28677e-07,
-    (float)1.96558e-07,
-    (float)2.90456e-07,
-    (float)3.08537e-07,
-    (float)1.53965e-07,
-    (float)9.90623e-09,
-    (float)5.4964e-07,
-    (float)6.28769e-08,
-    (float)3.13068e-08,
-    (float)1.16851e-07,
-    (float)1.21281e-08,
-    (float)2.41469e-07,
-    (float)2.42162e-07,
-    (float)2.11769e-07,
-    (float)3.65297e-08,
-    (float)9.57787e-08,
-    (float)1.44448e-09,
-    (float)2.02053e-07,
-    (float)4.37856e-08,
-    (float)2.76451e-09,
-    (float)3.43147e-08,
-    (float)3.31994e-08,
-    (float)9.75646e-08,
-    (float)1.57063e-07,
-    (float)5.65931e-08,
-    (float)5.71423e-09,
-    (float)4.34701e-08,
-    (float)7.93666e-08,
-    (float)2.20689e-08,
-    (float)2.97776e-08,
-    (float)1.60496e-08,
-    (float)1.16029e-08,
-    (float)5.22717e-08,
-    (float)4.08441e-08,
-    (float)2.11308e-08,
-    (float)6.1838e-08,
-    (float)2.95671e-08,
-    (float)1.50449e-08,
-    (float)1.26834e-08,
-    (float)4.39512e-09,
-    (float)8.75196e-08,
-    (float)3.51498e-08,
-    (float)8.69824e-08,
-    (float)3.3353e-08,
-    (float)4.05672e-08,
-    (float)6.98831e-08,
-    (float)9.49661e-08,
-    (float)5.98551e-08,
-    (float)2.43074e-08,
-    (float)2.11371e-08,
-    (float)1.06309e-08,
-    (float)1.02575e-08,
-    (float)6.24295e-09,
-    (float)3.71994e-08,
-    (float)1.91511e-08,
-    (float)3.69896e-09,
-    (float)2.38582e-08,
-    (float)8.43898e-08,
-    (float)0.0765887,
-    (float)0.719411,
-    (float)0.0451239,
-    (float)0.01385,
-    (float)0.122363,
-    (float)0.00822628,
-    (float)0.00645818,
-    (float)0.00476926,
-    (float)0.000216009,
-    (float)0.000496747,
-    (float)0.000378539,
-    (float)0.00083962,
-    (float)0.000674014,
-    (float)1.06059e-05,
-    (float)0.000164659,
-    (float)1.51132e-05,
-    (float)1.90707e-05,
-    (float)4.3273e-05,
-    (float)9.59579e-05,
-    (float)2.74873e-05,
-    (float)1.94803e-05,
-    (float)1.86251e-05,
-    (float)2.61525e-06,
-    (float)8.01735e-05,
-    (float)1.07165e-05,
-    (float)2.03292e-05,
-    (float)5.57206e-06,
-    (float)2.1294e-06,
-    (float)1.01724e-05,
-    (float)4.24378e-06,
-    (float)4.88019e-06,
-    (float)4.84493e-06,
-    (float)5.91108e-07,
-    (float)6.96979e-07,
-    (float)6.7766e-07,
-    (float)3.003e-06,
-    (float)3.55403e-06,
-    (float)7.29004e-07,
-    (float)3.09882e-07,
-    (float)3.05823e-06,
-    (float)5.92277e-07,
-    (float)7.34252e-06,
-    (float)5.4447e-07,
-    (float)1.42842e-07,
-    (float)3.4223e-06,
-    (float)7.71023e-07,
-    (float)9.83814e-07,
-    (float)1.30069e-06,
-    (float)1.14961e-06,
-    (float)1.29277e-07,
-    (float)3.19638e-06,
-    (float)2.66162e-08,
-    (float)5.76081e-07,
-    (float)2.70867e-07,
-    (float)8.13377e-08,
-    (float)4.23669e-07,
-    (float)2.39811e-07,
-    (float)7.91309e-07,
-    (float)2.18502e-07,
-    (float)1.22379e-07,
-    (float)1.21385e-07,
-    (float)3.89942e-07,
-    (float)3.85795e-08,
-    (float)1.37412e-07,
-    (float)1.58485e-06,
-    (float)3.91127e-08,
-    (float)4.23929e-07,
-    (float)1.5825e-07,
-    (float)2.33545e-07,
-    (float)2.3903e-07,
-    (float)4.34092e-07,
-    (float)6.3454e-09,
-    (float)3.12372e-08,
-    (float)1.72314e-07,
-    (float)2.91339e-07,
-    (float)4.91141e-07,
-    (float)5.08783e-08,
-    (float)1.23631e-07,
-    (float)4.7023e-07,
-    (float)4.84019e-07,
-    (float)3.39728e-08,
-    (float)2.46138e-07,
-    (float)1.33206e-08,
-    (float)7.35753e-08,
-    (float)7.48157e-08,
-    (float)2.27932e-07,
-    (float)2.66384e-07,
-    (float)3.72011e-07,
-    (float)4.1944e-08,
-    (float)1.39468e-07,
-    (float)1.62973e-08,
-    (float)3.94997e-08,
-    (float)9.66327e-08,
-    (float)2.04643e-07,
-    (float)2.74589e-08,
-    (float)3.28189e-08,
-    (float)8.09669e-08,
-    (float)1.33672e-07,
-    (float)3.06008e-08,
-    (float)3.05119e-08,
-    (float)1.10711e-07,
-    (float)1.86954e-08,
-    (float)3.41722e-08,
-    (float)2.11477e-08,
-    (float)4.90389e-08,
-    (float)4.52332e-08,
-    (float)5.51928e-08,
-    (float)4.22749e-08,
-    (float)2.42911e-08,
-    (float)7.36899e-08,
-    (float)8.43032e-08,
-    (float)3.21209e-08,
-    (float)3.9818e-08,
-    (float)4.48876e-09,
-    (float)2.53889e-08,
-    (float)9.89148e-08,
-    (float)5.64057e-09,
-    (float)1.39451e-08,
-    (float)1.3673e-08,
-    (float)2.70253e-08,
-    (float)1.0295e-07,
-    (float)3.93543e-08,
-    (float)2.17006e-08,
-    (float)1.13631e-07,
-    (float)5.47251e-09,
-    (float)2.21401e-08,
-    (float)3.21182e-08,
-    (float)7.75851e-09,
-    (float)0.0883153,
-    (float)0.681705,
-    (float)0.050175,
-    (float)0.0160421,
-    (float)0.130847,
-    (float)0.010988,
-    (float)0.0097891,
-    (float)0.00822098,
-    (float)0.00057438,
-    (float)0.000465854,
-    (float)0.000290966,
-    (float)0.000781627,
-    (float)0.000859637,
-    (float)1.71145e-06,
-    (float)0.000443567,
-    (float)2.65708e-05,
-    (float)5.72194e-05,
-    (float)2.39251e-05,
-    (float)0.00010558,
-    (float)1.52687e-05,
-    (float)5.5529e-06,
-    (float)4.0507e-05,
-    (float)5.68621e-06,
-    (float)6.13223e-05,
-    (float)2.10616e-05,
-    (float)3.21895e-05,
-    (float)2.17647e-05,
-    (float)7.43707e-06,
-    (float)9.41136e-06,
-    (float)3.77446e-06,
-    (float)1.30417e-06,
-    (float)1.37301e-05,
-    (float)5.9539e-07,
-    (float)1.54032e-06,
-    (float)8.35107e-07,
-    (float)2.16421e-06,
-    (float)6.17346e-07,
-    (float)8.02648e-07,
-    (float)3.51995e-06,
-    (float)3.35241e-06,
-    (float)7.80911e-07,
-    (float)5.01177e-07,
-    (float)3.84075e-06,
-    (float)7.06034e-07,
-    (float)4.32002e-06,
-    (float)1.47802e-06,
-    (float)5.41395e-07,
-    (float)2.75671e-06,
-    (float)1.69385e-06,
-    (float)6.79366e-07,
-    (float)1.25094e-06,
-    (float)1.11033e-06,
-    (float)2.96914e-07,
-    (float)3.33038e-06,
-    (float)2.7859e-07,
-    (float)3.33264e-07,
-    (float)3.62454e-07,
-    (float)2.98264e-07,
-    (float)2.7308e-07,
-    (float)4.18941e-08,
-    (float)5.15202e-07,
-    (float)4.51832e-07,
-    (float)2.55019e-07,
-    (float)1.20314e-07,
-    (float)7.42994e-08,
-    (float)2.10712e-07,
-    (float)1.07245e-07,
-    (float)4.5631e-07,
-    (float)3.80163e-07,
-    (float)7.60882e-07,
-    (float)2.31097e-07,
-    (float)1.80214e-07,
-    (float)2.92847e-07,
-    (float)4.78895e-07,
-    (float)3.11059e-07,
-    (float)1.38402e-07,
-    (float)4.95791e-08,
-    (float)4.80301e-08,
-    (float)1.29489e-08,
-    (float)3.7171e-07,
-    (float)6.99779e-08,
-    (float)4.13945e-07,
-    (float)1.06135e-07,
-    (float)1.75236e-07,
-    (float)4.51455e-07,
-    (float)1.09503e-07,
-    (float)3.98886e-08,
-    (float)1.88766e-07,
-    (float)4.87532e-08,
-    (float)4.05264e-09,
-    (float)1.14886e-07,
-    (float)5.26759e-09,
-    (float)3.23771e-07,
-    (float)5.3888e-08,
-    (float)1.08723e-07,
-    (float)6.28146e-08,
-    (float)1.16257e-07,
-    (float)3.74064e-08,
-    (float)5.78352e-08,
-    (float)3.99502e-08,
-    (float)1.40956e-08,
-    (float)5.48658e-08,
-    (float)2.9887e-08,
-    (float)9.67035e-08,
-    (float)2.36563e-08,
-    (float)1.68804e-07,
-    (float)1.3449e-08,
-    (float)4.97728e-08,
-    (float)8.26645e-09,
-    (float)3.19164e-08,
-    (float)5.41154e-08,
-    (float)1.52956e-08,
-    (float)2.69416e-08,
-    (float)5.08129e-09,
-    (float)1.01232e-08,
-    (float)2.68848e-08,
-    (float)1.6519e-07,
-    (float)4.70397e-08,
-    (float)1.12037e-07,
-    (float)5.74387e-08,
-    (float)1.44927e-08,
-    (float)6.75434e-11,
-    (float)2.47267e-08,
-    (float)8.71606e-08,
-    (float)2.82143e-08,
-    (float)2.52787e-08,
-    (float)3.40257e-08,
-    (float)5.3902e-08,
-    (float)0.100888,
-    (float)0.642357,
-    (float)0.0549644,
-    (float)0.0184028,
-    (float)0.136975,
-    (float)0.0142679,
-    (float)0.0138684,
-    (float)0.0127678,
-    (float)0.0011642,
-    (float)0.00120225,
-    (float)0.000159966,
-    (float)0.000653234,
-    (float)0.000730262,
-    (float)3.50136e-05,
-    (float)0.000809626,
-    (float)0.000209731,
-    (float)8.61821e-05,
-    (float)3.93894e-05,
-    (float)5.05021e-05,
-    (float)1.79872e-06,
-    (float)4.52641e-05,
-    (float)6.51253e-05,
-    (float)2.60466e-05,
-    (float)6.63817e-06,
-    (float)3.19813e-05,
-    (float)2.43281e-05,
-    (float)3.30761e-05,
-    (float)1.74128e-05,
-    (float)3.68053e-05,
-    (float)4.64304e-06,
-    (float)4.47022e-06,
-    (float)8.91177e-06,
-    (float)1.73336e-06,
-    (float)1.17029e-06,
-    (float)8.53722e-06,
-    (float)1.42851e-06,
-    (float)1.48379e-06,
-    (float)2.20118e-08,
-    (float)3.27566e-06,
-    (float)1.27593e-07,
-    (float)1.0547e-06,
-    (float)3.83364e-06,
-    (float)2.80063e-06,
-    (float)6.63185e-07,
-    (float)1.16579e-06,
-    (float)3.63175e-06,
-    (float)2.38467e-06,
-    (float)9.40929e-07,
-    (float)1.57842e-06,
-    (float)2.50221e-06,
-    (float)1.35048e-06,
-    (float)1.53305e-06,
-    (float)1.57662e-06,
-    (float)1.09557e-06,
-    (float)6.78279e-07,
-    (float)9.59916e-07,
-    (float)2.14455e-06,
-    (float)2.99128e-07,
-    (float)1.50534e-06,
-    (float)1.65517e-07,
-    (float)4.7521e-07,
-    (float)7.36692e-09,
-    (float)4.54294e-08,
-    (float)2.79744e-07,
-    (float)3.6014e-07,
-    (float)6.20617e-07,
-    (float)2.95792e-07,
-    (float)8.78852e-08,
-    (float)1.40402e-07,
-    (float)2.45792e-07,
-    (float)1.89288e-08,
-    (float)3.14331e-07,
-    (float)9.49521e-07,
-    (float)3.98689e-08,
-    (float)3.8524e-08,
-    (float)6.5664e-07,
-    (float)1.69596e-07,
-    (float)5.04267e-07,
-    (float)2.00863e-07,
-    (float)2.33909e-07,
-    (float)1.36915e-08,
-    (float)2.7327e-07,
-    (float)9.44131e-08,
-    (float)9.1845e-09,
-    (float)1.44565e-07,
-    (float)1.9964e-07,
-    (float)4.71636e-07,
-    (float)9.45978e-08,
-    (float)4.18787e-08,
-    (float)5.44425e-07,
-    (float)5.69664e-07,
-    (float)1.72686e-08,
-    (float)4.54569e-07,
-    (float)1.32753e-07,
-    (float)7.33001e-08,
-    (float)1.23374e-08,
-    (float)1.27279e-07,
-    (float)4.65953e-08,
-    (float)2.96504e-07,
-    (float)2.66044e-08,
-    (float)2.97618e-07,
-    (float)4.93648e-08,
-    (float)6.43744e-08,
-    (float)1.17304e-07,
-    (float)7.3404e-08,
-    (float)1.31943e-07,
-    (float)1.12234e-07,
-    (float)7.23445e-08,
-    (float)1.17455e-08,
-    (float)6.69843e-09,
-    (float)5.8218e-08,
-    (float)2.16014e-07,
-    (float)5.29778e-09,
-    (float)1.21089e-07,
-    (float)1.46576e-07,
-    (float)1.66255e-08,
-    (float)2.04779e-08,
-    (float)1.89556e-09,
-    (float)1.12766e-08,
-    (float)6.83153e-08,
-    (float)2.85296e-08,
-    (float)1.09381e-08,
-    (float)2.11702e-08,
-    (float)1.8895e-08,
-    (float)1.21816e-07,
-    (float)4.63329e-08,
-    (float)9.79053e-08,
-    (float)1.93211e-07,
-    (float)0.113963,
-    (float)0.601812,
-    (float)0.0594826,
-    (float)0.0208458,
-    (float)0.140439,
-    (float)0.0179994,
-    (float)0.0185325,
-    (float)0.0182856,
-    (float)0.00201428,
-    (float)0.00319576,
-    (float)0.000163783,
-    (float)0.000502906,
-    (float)0.0003215,
-    (float)7.66691e-05,
-    (float)0.00112021,
-    (float)0.000481761,
-    (float)8.82421e-05,
-    (float)0.000227,
-    (float)7.57872e-07,
-    (float)3.65503e-05,
-    (float)4.39302e-05,
-    (float)6.67117e-05,
-    (float)2.01799e-05,
-    (float)2.39943e-05,
-    (float)3.38623e-05,
-    (float)1.64541e-05,
-    (float)8.11443e-06,
-    (float)2.1338e-05,
-    (float)6.13797e-05,
-    (float)5.50147e-06,
-    (float)1.57794e-05,
-    (float)2.51414e-05,
-    (float)1.51677e-06,
-    (float)3.85296e-06,
-    (float)7.29316e-06,
-    (float)9.81083e-07,
-    (float)3.35031e-06,
-    (float)3.587e-06,
-    (float)1.27616e-06,
-    (float)1.97886e-06,
-    (float)6.50815e-07,
-    (float)2.48858e-06,
-    (float)8.42977e-09,
-    (float)1.81082e-06,
-    (float)4.15514e-06,
-    (float)1.1496e-06,
-    (float)3.95312e-07,
-    (float)3.34325e-06,
-    (float)1.44428e-06,
-    (float)3.41548e-06,
-    (float)6.36766e-07,
-    (float)4.42092e-07,
-    (float)4.47565e-06,
-    (float)1.98381e-07,
-    (float)6.48504e-07,
-    (float)2.68085e-06,
-    (float)1.08513e-06,
-    (float)8.46226e-07,
-    (float)9.3624e-07,
-    (float)1.48195e-06,
-    (float)4.02387e-08,
-    (float)2.48407e-06,
-    (float)8.73076e-09,
-    (float)5.35733e-07,
-    (float)6.70587e-07,
-    (float)1.76615e-07,
-    (float)1.85575e-07,
-    (float)4.95668e-08,
-    (float)2.70783e-07,
-    (float)6.76749e-07,
-    (float)9.42668e-08,
-    (float)6.16557e-07,
-    (float)6.05041e-08,
-    (float)2.45687e-07,
-    (float)1.12366e-07,
-    (float)2.58213e-07,
-    (float)3.15049e-07,
-    (float)2.15518e-07,
-    (float)4.07701e-07,
-    (float)2.43624e-07,
-    (float)5.46311e-07,
-    (float)4.16803e-08,
-    (float)1.33901e-07,
-    (float)1.06095e-07,
-    (float)3.0826e-07,
-    (float)3.78713e-07,
-    (float)1.49382e-07,
-    (float)1.10913e-07,
-    (float)3.26601e-08,
-    (float)2.87777e-08,
-    (float)1.63521e-07,
-    (float)2.03678e-08,
-    (float)1.43739e-07,
-    (float)1.23278e-07,
-    (float)1.81837e-07,
-    (float)2.0599e-07,
-    (float)1.57961e-08,
-    (float)1.24337e-07,
-    (float)3.52636e-07,
-    (float)2.5359e-08,
-    (float)2.26977e-07,
-    (float)4.61477e-08,
-    (float)8.67243e-08,
-    (float)2.73256e-08,
-    (float)9.48604e-08,
-    (float)3.79296e-09,
-    (float)1.12624e-07,
-    (float)1.04907e-07,
-    (float)1.6056e-07,
-    (float)9.20126e-08,
-    (float)6.48185e-08,
-    (float)1.2683e-07,
-    (float)1.84379e-08,
-    (float)5.09718e-08,
-    (float)9.47335e-08,
-    (float)1.82648e-08,
-    (float)1.24453e-08,
-    (float)6.43922e-08,
-    (float)1.0585e-08,
-    (float)3.41619e-08,
-    (float)7.56629e-08,
-    (float)7.83482e-09,
-    (float)1.05384e-07,
-    (float)9.82466e-08,
-    (float)1.14768e-08,
-    (float)2.315e-08,
-    (float)2.48196e-08,
-    (float)7.11339e-09,
-    (float)0.127638,
-    (float)0.559977,
-    (float)0.0636667,
-    (float)0.0233349,
-    (float)0.141015,
-    (float)0.0220351,
-    (float)0.023556,
-    (float)0.0245533,
-    (float)0.00311655,
-    (float)0.0068045,
-    (float)0.000637453,
-    (float)0.000377897,
-    (float)6.28567e-05,
-    (float)5.92774e-05,
-    (float)0.00121246,
-    (float)0.000587229,
-    (float)6.81243e-05,
-    (float)0.000631309,
-    (float)7.93232e-05,
-    (float)0.000140098,
-    (float)3.21279e-05,
-    (float)3.24487e-05,
-    (float)1.65268e-06,
-    (float)7.88655e-05,
-    (float)2.89361e-05,
-    (float)1.66138e-05,
-    (float)2.24466e-05,
-    (float)1.75533e-05,
-    (float)3.55368e-05,
-    (float)6.87215e-07,
-    (float)9.26281e-06,
-    (float)6.73948e-05,
-    (float)4.87564e-07,
-    (float)1.81163e-05,
-    (float)1.82872e-05,
-    (float)1.34086e-06,
-    (float)5.04333e-06,
-    (float)4.72069e-06,
-    (float)1.91538e-07,
-    (float)4.68285e-06,
-    (float)1.98127e-06,
-    (float)5.75282e-07,
-    (float)2.36565e-06,
-    (float)2.27928e-06,
-    (float)7.76328e-07,
-    (float)1.07563e-07,
-    (float)3.58813e-06,
-    (float)3.2559e-06,
-    (float)7.73476e-07,
-    (float)5.07162e-07,
-    (float)5.35757e-06,
-    (float)4.80065e-07,
-    (float)7.64953e-07,
-    (float)3.6656e-06,
-    (float)5.73305e-07,
-    (float)1.79197e-06,
-    (float)1.43803e-06,
-    (float)9.61098e-07,
-    (float)1.67171e-06,
-    (float)1.35896e-06,
-    (float)1.44245e-06,
-    (float)5.49242e-07,
-    (float)1.22448e-06,
-    (float)4.10087e-07,
-    (float)2.40863e-06,
-    (float)2.06241e-08,
-    (float)4.58709e-07,
-    (float)1.64897e-06,
-    (float)5.35498e-07,
-    (float)3.15342e-07,
-    (float)2.57986e-07,
-    (float)7.40479e-08,
-    (float)1.78974e-07,
-    (float)7.00291e-08,
-    (float)2.50182e-07,
-    (float)3.2809e-07,
-    (float)4.90241e-07,
-    (float)2.14155e-07,
-    (float)9.64258e-08,
-    (float)1.45497e-07,
-    (float)1.15572e-07,
-    (float)5.67373e-09,
-    (float)5.36909e-08,
-    (float)6.35687e-07,
-    (float)4.48209e-08,
-    (float)5.00125e-08,
-    (float)5.58538e-07,
-    (float)5.86901e-09,
-    (float)5.65375e-07,
-    (float)3.80136e-08,
-    (float)1.77568e-07,
-    (float)2.4613e-07,
-    (float)4.72066e-07,
-    (float)8.66391e-08,
-    (float)2.30859e-08,
-    (float)1.72853e-07,
-    (float)8.63543e-08,
-    (float)3.03464e-08,
-    (float)7.75603e-08,
-    (float)5.91951e-09,
-    (float)3.48669e-07,
-    (float)1.4496e-08,
-    (float)8.97813e-08,
-    (float)3.50143e-07,
-    (float)2.25569e-08,
-    (float)7.59603e-08,
-    (float)2.27526e-07,
-    (float)2.05784e-08,
-    (float)1.46392e-08,
-    (float)8.54028e-09,
-    (float)6.2346e-08,
-    (float)4.34465e-08,
-    (float)1.66301e-07,
-    (float)1.22261e-09,
-    (float)1.237e-07,
-    (float)2.21176e-07,
-    (float)1.05749e-07,
-    (float)3.8139e-08,
-    (float)4.15512e-08,
-    (float)1.02217e-07,
-    (float)1.01196e-08,
-    (float)3.73202e-08,
-    (float)2.338e-08,
-    (float)4.02863e-08,
-    (float)8.93863e-08,
-    (float)8.438e-09,
-    (float)5.32675e-09,
-    (float)1.17978e-07,
-    (float)0.141553,
-    (float)0.516856,
-    (float)0.0673104,
-    (float)0.0258663,
-    (float)0.138761,
-    (float)0.0261583,
-    (float)0.0286476,
-    (float)0.0313941,
-    (float)0.0044345,
-    (float)0.0120705,
-    (float)0.00211434,
-    (float)0.000315974,
-    (float)0.000702154,
-    (float)3.90852e-07,
-    (float)0.00101903,
-    (float)0.000369237,
-    (float)4.8736e-05,
-    (float)0.0010656,
-    (float)0.000294383,
-    (float)0.000276455,
-    (float)0.000199615,
-    (float)1.91603e-06,
-    (float)8.13564e-05,
-    (float)4.73325e-05,
-    (float)2.35228e-05,
-    (float)1.57626e-06,
-    (float)9.81035e-05,
-    (float)7.5936e-06,
-    (float)4.29434e-06,
-    (float)2.81809e-05,
-    (float)1.95368e-06,
-    (float)3.81736e-05,
-    (float)5.51779e-06,
-    (float)1.39604e-05,
-    (float)5.03221e-05,
-    (float)4.88169e-06,
-    (float)2.73238e-05,
-    (float)1.44903e-05,
-    (float)3.0787e-06,
-    (float)8.92194e-06,
-    (float)3.62082e-06,
-    (float)3.15569e-07,
-    (float)4.41451e-06,
-    (float)2.27701e-06,
-    (float)1.09107e-06,
-    (float)1.46126e-06,
-    (float)4.09136e-06,
-    (float)1.97386e-07,
-    (float)1.4894e-07,
-    (float)5.57026e-06,
-    (float)6.32302e-07,
-    (float)1.53582e-06,
-    (float)3.45249e-06,
-    (float)3.48311e-06,
-    (float)8.32454e-07,
-    (float)2.28868e-06,
-    (float)3.46914e-06,
-    (float)2.02348e-06,
-    (float)1.00997e-06,
-    (float)1.10556e-06,
-    (float)3.36041e-06,
-    (float)9.86407e-09,
-    (float)6.09871e-07,
-    (float)3.40105e-06,
-    (float)1.23977e-07,
-    (float)1.21491e-06,
-    (float)2.17074e-06,
-    (float)1.48881e-06,
-    (float)7.52326e-07,
-    (float)1.46658e-06,
-    (float)1.34618e-06,
-    (float)9.42311e-08,
-    (float)2.77013e-06,
-    (float)4.99123e-08,
-    (float)4.20344e-07,
-    (float)1.30616e-06,
-    (float)2.31837e-07,
-    (float)1.21333e-08,
-    (float)3.09969e-07,
-    (float)2.74854e-07,
-    (float)4.83275e-07,
-    (float)6.97485e-08,
-    (float)1.00065e-06,
-    (float)2.86906e-07,
-    (float)5.39016e-07,
-    (float)4.73773e-07,
-    (float)5.56844e-08,
-    (float)2.08218e-07,
-    (float)2.70712e-07,
-    (float)9.21564e-08,
-    (float)1.5151e-07,
-    (float)9.02517e-07,
-    (float)3.49196e-07,
-    (float)5.20651e-09,
-    (float)1.26787e-06,
-    (float)2.46856e-07,
-    (float)5.57816e-07,
-    (float)3.10992e-07,
-    (float)3.52444e-07,
-    (float)5.20214e-07,
-    (float)4.06615e-07,
-    (float)1.84953e-07,
-    (float)6.8308e-08,
-    (float)4.33555e-07,
-    (float)2.01896e-08,
-    (float)3.70143e-09,
-    (float)2.19944e-07,
-    (float)4.48964e-08,
-    (float)3.54108e-07,
-    (float)1.60349e-07,
-    (float)2.59888e-07,
-    (float)7.96247e-07,
-    (float)1.77166e-08,
-    (float)4.82959e-07,
-    (float)7.52098e-07,
-    (float)2.00005e-07,
-    (float)1.66432e-07,
-    (float)5.94552e-07,
-    (float)2.03601e-07,
-    (float)1.42088e-08,
-    (float)1.13165e-07,
-    (float)1.78896e-07,
-    (float)8.58817e-08,
-    (float)1.54523e-08,
-    (float)1.92742e-07,
-    (float)2.99012e-07,
-    (float)1.31925e-07,
-    (float)3.80209e-07,
-    (float)0.155306,
-    (float)0.473192,
-    (float)0.070684,
-    (float)0.028265,
-    (float)0.133584,
-    (float)0.0302286,
-    (float)0.0333417,
-    (float)0.0381715,
-    (float)0.00587878,
-    (float)0.0185937,
-    (float)0.00509413,
-    (float)0.000305318,
-    (float)0.00303242,
-    (float)0.000179933,
-    (float)0.000573605,
-    (float)2.96513e-05,
-    (float)5.02929e-05,
-    (float)0.00112345,
-    (float)0.000427239,
-    (float)0.000379413,
-    (float)0.000575318,
-    (float)6.64277e-05,
-    (float)0.000359677,
-    (float)3.67171e-05,
-    (float)1.09666e-05,
-    (float)5.40162e-05,
-    (float)7.99958e-05,
-    (float)4.63695e-06,
-    (float)2.54148e-06,
-    (float)9.43131e-05,
-    (float)3.76501e-06,
-    (float)2.69064e-07,
-    (float)3.0728e-05,
-    (float)2.66506e-06,
-    (float)1.63097e-05,
-    (float)1.15166e-05,
-    (float)2.96809e-05,
-    (float)2.21122e-05,
-    (float)8.98546e-06,
-    (float)4.32848e-05,
-    (float)5.78197e-06,
-    (float)7.90763e-06,
-    (float)1.68004e-05,
-    (float)1.20118e-06,
-    (float)3.08877e-06,
-    (float)4.04765e-06,
-    (float)4.43316e-07,
-    (float)3.30175e-06,
-    (float)1.17235e-06,
-    (float)4.92361e-07,
-    (float)2.81066e-06,
-    (float)1.62155e-06,
-    (float)1.11467e-06,
-    (float)2.54656e-07,
-    (float)3.96434e-06,
-    (float)2.19817e-06,
-    (float)7.44068e-07,
-    (float)2.26373e-06,
-    (float)5.26338e-06,
-    (float)1.63919e-06,
-    (float)4.49164e-09,
-    (float)6.32836e-06,
-    (float)4.91763e-07,
-    (float)8.94186e-07,
-    (float)2.6749e-06,
-    (float)8.87853e-07,
-    (float)8.72387e-07,
-    (float)5.58382e-07,
-    (float)1.60063e-06,
-    (float)1.0153e-06,
-    (float)5.86772e-07,
-    (float)2.98508e-06,
-    (float)1.63732e-07,
-    (float)1.37537e-06,
-    (float)1.83537e-06,
-    (float)1.56319e-06,
-    (float)7.61597e-07,
-    (float)3.87043e-07,
-    (float)2.38543e-06,
-    (float)6.15211e-08,
-    (float)9.85481e-07,
-    (float)4.44411e-07,
-    (float)4.30957e-07,
-    (float)1.75909e-07,
-    (float)4.74861e-08,
-    (float)5.77974e-08,
-    (float)1.89891e-07,
-    (float)2.00504e-07,
-    (float)4.8777e-07,
-    (float)7.08425e-08,
-    (float)9.81123e-07,
-    (float)3.34507e-07,
-    (float)2.03284e-07,
-    (float)6.11241e-07,
-    (float)4.51389e-08,
-    (float)2.11852e-07,
-    (float)6.96757e-08,
-    (float)1.35975e-07,
-    (float)7.01041e-08,
-    (float)2.00726e-07,
-    (float)6.08838e-08,
-    (float)9.61073e-08,
-    (float)4.90186e-07,
-    (float)1.34371e-07,
-    (float)1.18593e-07,
-    (float)6.04069e-07,
-    (float)6.21468e-09,
-    (float)6.73792e-07,
-    (float)1.05813e-07,
-    (float)1.49234e-07,
-    (float)2.26238e-07,
-    (float)2.89645e-07,
-    (float)1.88206e-08,
-    (float)6.98216e-08,
-    (float)1.1811e-07,
-    (float)3.06489e-07,
-    (float)2.49952e-08,
-    (float)3.2159e-07,
-    (float)1.97389e-07,
-    (float)2.35746e-07,
-    (float)3.01642e-07,
-    (float)9.04753e-08,
-    (float)4.85588e-07,
-    (float)2.8243e-08,
-    (float)4.9773e-07,
-    (float)2.5505e-07,
-    (float)3.91948e-07,
-    (float)3.94745e-07,
-    (float)0.168877,
-    (float)0.428268,
-    (float)0.0732098,
-    (float)0.0306397,
-    (float)0.125755,
-    (float)0.0338258,
-    (float)0.0374487,
-    (float)0.0446722,
-    (float)0.00732885,
-    (float)0.0256591,
-    (float)0.0101945,
-    (float)0.000350986,
-    (float)0.0074634,
-    (float)0.0012884,
-    (float)0.000182686,
-    (float)0.000323727,
-    (float)0.000205359,
-    (float)0.000719527,
-    (float)0.000255039,
-    (float)0.00044018,
-    (float)0.000775166,
-    (float)0.000207578,
-    (float)0.000721493,
-    (float)0.000256156,
-    (float)4.4591e-06,
-    (float)0.000375898,
-    (float)1.32296e-06,
-    (float)1.34506e-05,
-    (float)5.51996e-05,
-    (float)7.41719e-05,
-    (float)2.35816e-06,
-    (float)2.54498e-05,
-    (float)6.45821e-05,
-    (float)6.21614e-06,
-    (float)1.80065e-05,
-    (float)2.1895e-05,
-    (float)1.13153e-05,
-    (float)1.38154e-06,
-    (float)7.90257e-06,
-    (float)4.21791e-05,
-    (float)4.83594e-07,
-    (float)8.77217e-06,
-    (float)5.59924e-05,
-    (float)3.12102e-08,
-    (float)1.53955e-05,
-    (float)2.92934e-05,
-    (float)1.24669e-06,
-    (float)9.27654e-06,
-    (float)9.30416e-06,
-    (float)1.48707e-06,
-    (float)2.08017e-06,
-    (float)4.18023e-06,
-    (float)7.64177e-07,
-    (float)8.33391e-07,
-    (float)3.74763e-06,
-    (float)6.03356e-07,
-    (float)3.36332e-07,
-    (float)5.06244e-06,
-    (float)2.78064e-07,
-    (float)3.55388e-07,
-    (float)4.87701e-06,
-    (float)1.08438e-07,
-    (float)1.65253e-06,
-    (float)2.64682e-06,
-    (float)1.74699e-06,
-    (float)1.29683e-06,
-    (float)3.2223e-06,
-    (float)2.54827e-06,
-    (float)9.54943e-07,
-    (float)3.94176e-06,
-    (float)1.01092e-06,
-    (float)1.37429e-06,
-    (float)1.83506e-06,
-    (float)3.50309e-07,
-    (float)1.30879e-06,
-    (float)4.35998e-07,
-    (float)7.36617e-07,
-    (float)2.23319e-06,
-    (float)5.40855e-07,
-    (float)2.17817e-06,
-    (float)1.27474e-06,
-    (float)1.01395e-06,
-    (float)2.13955e-06,
-    (float)4.17861e-07,
-    (float)5.33793e-07,
-    (float)2.99414e-07,
-    (float)1.65069e-06,
-    (float)1.9591e-08,
-    (float)3.6186e-07,
-    (float)1.32323e-06,
-    (float)7.29474e-07,
-    (float)4.60141e-07,
-    (float)4.6407e-07,
-    (float)5.90687e-07,
-    (float)1.78567e-08,
-    (float)1.50477e-07,
-    (float)2.73406e-07,
-    (float)1.15739e-07,
-    (float)5.91249e-07,
-    (float)8.81868e-07,
-    (float)1.22979e-07,
-    (float)1.22996e-06,
-    (float)5.64105e-07,
-    (float)3.16438e-07,
-    (float)5.47337e-07,
-    (float)2.44727e-08,
-    (float)1.10313e-07,
-    (float)1.49569e-07,
-    (float)1.60369e-07,
-    (float)9.24606e-08,
-    (float)3.831e-07,
-    (float)4.59782e-07,
-    (float)2.85047e-07,
-    (float)1.82544e-07,
-    (float)5.03382e-07,
-    (float)2.70705e-08,
-    (float)3.57384e-08,
-    (float)1.10928e-07,
-    (float)3.37853e-07,
-    (float)1.87552e-07,
-    (float)3.54504e-07,
-    (float)4.2202e-07,
-    (float)4.44954e-07,
-    (float)6.08026e-07,
-    (float)5.50489e-08,
-    (float)2.9987e-07,
-    (float)2.00236e-07,
-    (float)2.24422e-08,
-    (float)0.180619,
-    (float)0.382855,
-    (float)0.0753785,
-    (float)0.0325578,
-    (float)0.115891,
-    (float)0.0369125,
-    (float)0.0403343,
-    (float)0.0505785,
-    (float)0.00859678,
-    (float)0.0320613,
-    (float)0.0176478,
-    (float)0.000404864,
-    (float)0.0135771,
-    (float)0.00429508,
-    (float)0.000143599,
-    (float)0.00222461,
-    (float)0.00088407,
-    (float)0.000271718,
-    (float)4.16596e-06,
-    (float)0.000543687,
-    (float)0.000446998,
-    (float)0.000168106,
-    (float)0.000957241,
-    (float)0.000443584,
-    (float)2.46568e-05,
-    (float)0.000943092,
-    (float)0.000131187,
-    (float)2.72984e-05,
-    (float)0.000407482,
-    (float)8.62316e-06,
-    (float)5.9845e-05,
-    (float)7.04774e-05,
-    (float)4.08181e-05,
-    (float)2.05571e-05,
-    (float)5.96495e-05,
-    (float)2.49433e-05,
-    (float)2.81648e-06,
-    (float)5.98886e-05,
-    (float)3.73949e-06,
-    (float)4.20062e-06,
-    (float)2.29592e-05,
-    (float)9.33609e-07,
-    (float)1.80386e-05,
-    (float)6.48153e-06,
-    (float)1.5173e-05,
-    (float)2.75775e-05,
-    (float)4.02353e-06,
-    (float)3.70437e-05,
-    (float)1.72505e-05,
-    (float)5.76698e-06,
-    (float)3.61423e-05,
-    (float)4.43555e-06,
-    (float)6.52713e-06,
-    (float)1.89704e-05,
-    (float)7.19037e-07,
-    (float)3.69163e-06,
-    (float)6.70026e-06,
-    (float)8.21532e-07,
-    (float)1.16861e-06,
-    (float)2.74561e-06,
-    (float)6.76491e-07,
-    (float)7.53799e-07,
-    (float)3.14585e-06,
-    (float)8.01344e-07,
-    (float)5.30864e-07,
-    (float)5.61246e-06,
-    (float)8.84155e-07,
-    (float)2.13615e-07,
-    (float)6.02634e-06,
-    (float)9.78733e-07,
-    (float)1.50628e-06,
-    (float)2.62062e-06,
-    (float)2.92611e-06,
-    (float)2.01613e-06,
-    (float)7.68981e-07,
-    (float)4.07548e-06,
-    (float)1.30066e-06,
-    (float)1.76952e-06,
-    (float)2.16251e-06,
-    (float)1.06749e-06,
-    (float)1.51972e-06,
-    (float)5.38083e-07,
-    (float)7.40894e-07,
-    (float)4.64407e-07,
-    (float)2.91353e-07,
-    (float)1.53362e-06,
-    (float)1.7239e-07,
-    (float)1.09634e-06,
-    (float)2.20225e-06,
-    (float)7.65253e-07,
-    (float)2.84026e-06,
-    (float)7.08117e-07,
-    (float)1.61883e-06,
-    (float)2.54183e-06,
-    (float)4.79476e-07,
-    (float)1.24194e-06,
-    (float)6.6293e-07,
-    (float)1.84607e-06,
-    (float)2.74206e-07,
-    (float)1.99952e-07,
-    (float)1.88443e-06,
-    (float)7.85865e-08,
-    (float)7.52195e-07,
-    (float)9.3256e-07,
-    (float)6.26662e-08,
-    (float)9.40911e-07,
-    (float)1.80246e-07,
-    (float)2.89468e-08,
-    (float)4.64253e-07,
-    (float)2.28898e-07,
-    (float)2.80925e-07,
-    (float)1.5107e-08,
-    (float)5.2634e-07,
-    (float)3.67991e-07,
-    (float)3.04474e-07,
-    (float)3.53965e-07,
-    (float)9.69353e-08,
-    (float)6.068e-07,
-    (float)5.97341e-08,
-    (float)1.03863e-07,
-    (float)3.9634e-07,
-    (float)1.77455e-07,
-    (float)8.61321e-07,
-    (float)9.43654e-08,
-    (float)1.10062e-06,
-    (float)1.16105e-06,
-    (float)4.51158e-07,
-    (float)1.79277e-06,
-    (float)0.190067,
-    (float)0.336078,
-    (float)0.0765601,
-    (float)0.0341903,
-    (float)0.103979,
-    (float)0.0390954,
-    (float)0.041996,
-    (float)0.0555307,
-    (float)0.00947678,
-    (float)0.0368399,
-    (float)0.027516,
-    (float)0.000432345,
-    (float)0.0202318,
-    (float)0.0102655,
-    (float)0.000767132,
-    (float)0.00632931,
-    (float)0.00280036,
-    (float)0.000732305,
-    (float)0.000745097,
-    (float)0.000868873,
-    (float)0.000130431,
-    (float)2.10333e-05,
-    (float)0.000889129,
-    (float)0.00018377,
-    (float)1.71751e-05,
-    (float)0.00118863,
-    (float)0.000311883,
-    (float)4.08254e-05,
-    (float)0.000961304,
-    (float)0.000160478,
-    (float)0.000209764,
-    (float)0.000364042,
-    (float)3.76702e-05,
-    (float)0.000236159,
-    (float)4.25791e-05,
-    (float)1.30109e-05,
-    (float)0.000100782,
-    (float)5.47917e-05,
-    (float)5.41184e-06,
-    (float)2.06368e-05,
-    (float)8.20068e-05,
-    (float)2.00429e-06,
-    (float)1.2374e-05,
-    (float)4.46642e-05,
-    (float)7.22026e-06,
-    (float)7.37001e-06,
-    (float)1.28496e-05,
-    (float)2.07836e-05,
-    (float)7.85123e-07,
-    (float)3.71136e-06,
-    (float)4.11109e-05,
-    (float)3.67828e-07,
-    (float)8.45881e-06,
-    (float)4.84955e-05,
-    (float)8.8375e-07,
-    (float)1.77303e-05,
-    (float)3.40313e-05,
-    (float)2.51202e-06,
-    (float)1.96706e-05,
-    (float)1.43424e-05,
-    (float)4.80342e-06,
-    (float)1.28939e-05,
-    (float)3.52518e-06,
-    (float)4.82006e-06,
-    (float)5.5035e-06,
-    (float)1.02324e-06,
-    (float)2.09334e-06,
-    (float)1.98801e-06,
-    (float)1.54474e-06,
-    (float)6.00593e-07,
-    (float)1.21276e-06,
-    (float)2.24723e-06,
-    (float)8.3707e-07,
-    (float)2.62007e-06,
-    (float)2.51596e-06,
-    (float)1.81234e-07,
-    (float)5.08245e-06,
-    (float)1.49965e-06,
-    (float)4.68077e-07,
-    (float)4.11926e-06,
-    (float)1.98004e-06,
-    (float)2.11823e-06,
-    (float)7.28285e-07,
-    (float)5.02389e-06,
-    (float)2.20419e-06,
-    (float)7.55983e-07,
-    (float)5.36129e-06,
-    (float)2.18238e-06,
-    (float)2.52397e-06,
-    (float)2.22823e-06,
-    (float)2.2941e-06,
-    (float)1.84568e-06,
-    (float)7.39627e-07,
-    (float)1.31548e-06,
-    (float)4.06255e-07,
-    (float)5.94824e-07,
-    (float)1.43113e-06,
-    (float)2.24351e-07,
-    (float)1.28671e-06,
-    (float)1.71042e-06,
-    (float)9.71756e-07,
-    (float)3.21937e-06,
-    (float)2.52993e-07,
-    (float)2.20688e-06,
-    (float)2.75888e-06,
-    (float)7.50775e-07,
-    (float)2.1522e-06,
-    (float)4.08113e-07,
-    (float)3.21187e-06,
-    (float)5.73346e-07,
-    (float)5.00684e-07,
-    (float)3.19296e-06,
-    (float)1.00936e-07,
-    (float)1.66335e-06,
-    (float)1.27856e-06,
-    (float)2.70666e-07,
-    (float)1.4093e-06,
-    (float)3.29308e-07,
-    (float)5.0888e-09,
-    (float)4.71387e-07,
-    (float)1.52973e-07,
-    (float)4.38518e-07,
-    (float)1.80582e-08,
-    (float)8.01114e-07,
-    (float)8.70655e-07,
-    (float)7.20099e-07,
-    (float)1.42437e-06,
-    (float)7.11657e-07,
-    (float)0.19567,
-    (float)0.288046,
-    (float)0.0768969,
-    (float)0.0350794,
-    (float)0.090466,
-    (float)0.0403212,
-    (float)0.0418176,
-    (float)0.0591642,
-    (float)0.00985589,
-    (float)0.0385712,
-    (float)0.0391847,
-    (float)0.000423563,
-    (float)0.0253541,
-    (float)0.0197135,
-    (float)0.00215679,
-    (float)0.0122219,
-    (float)0.0067598,
-    (float)0.00295946,
-    (float)0.00416774,
-    (float)0.0016379,
-    (float)0.00134863,
-    (float)0.00109138,
-    (float)0.000583791,
-    (float)0.000112818,
-    (float)0.000328036,
-    (float)0.000683657,
-    (float)8.0644e-05,
-    (float)0.000213958,
-    (float)0.000835534,
-    (float)0.000257176,
-    (float)0.000430061,
-    (float)0.000642921,
-    (float)0.00016462,
-    (float)0.000703833,
-    (float)0.000242923,
-    (float)2.10442e-05,
-    (float)0.000630921,
-    (float)2.2906e-05,
-    (float)9.71489e-06,
-    (float)0.000296643,
-    (float)1.71278e-05,
-    (float)4.42855e-05,
-    (float)7.5293e-05,
-    (float)3.65059e-05,
-    (float)3.97272e-05,
-    (float)5.02384e-05,
-    (float)1.64583e-05,
-    (float)1.64635e-05,
-    (float)6.44567e-05,
-    (float)1.77649e-06,
-    (float)4.82131e-06,
-    (float)4.30861e-05,
-    (float)6.49508e-06,
-    (float)1.38882e-06,
-    (float)1.61752e-05,
-    (float)2.2098e-05,
-    (float)2.47326e-07,
-    (float)2.88221e-06,
-    (float)4.08589e-05,
-    (float)6.16065e-07,
-    (float)1.8655e-06,
-    (float)5.09557e-05,
-    (float)6.62501e-07,
-    (float)8.34061e-06,
-    (float)4.63798e-05,
-    (float)5.96935e-07,
-    (float)1.51351e-05,
-    (float)3.11904e-05,
-    (float)3.09543e-06,
-    (float)1.74755e-05,
-    (float)1.32777e-05,
-    (float)7.02762e-06,
-    (float)1.42283e-05,
-    (float)2.08845e-06,
-    (float)6.76098e-06,
-    (float)8.01541e-06,
-    (float)3.50912e-07,
-    (float)2.24475e-06,
-    (float)3.21246e-06,
-    (float)1.14957e-06,
-    (float)1.05876e-06,
-    (float)9.32237e-07,
-    (float)3.54913e-07,
-    (float)3.57041e-06,
-    (float)1.36959e-06,
-    (float)7.62249e-07,
-    (float)2.61411e-06,
-    (float)4.30775e-06,
-    (float)1.48101e-06,
-    (float)2.02612e-07,
-    (float)5.73524e-06,
-    (float)2.81643e-07,
-    (float)1.48152e-06,
-    (float)2.84608e-06,
-    (float)4.96506e-07,
-    (float)2.85628e-06,
-    (float)1.34048e-06,
-    (float)2.20046e-06,
-    (float)1.18167e-06,
-    (float)4.93963e-06,
-    (float)2.12568e-06,
-    (float)2.08623e-07,
-    (float)6.47502e-06,
-    (float)2.30836e-06,
-    (float)1.2248e-06,
-    (float)2.48478e-06,
-    (float)3.44064e-06,
-    (float)1.37499e-06,
-    (float)1.76667e-08,
-    (float)2.65619e-06,
-    (float)3.62278e-07,
-    (float)5.73454e-07,
-    (float)2.4497e-06,
-    (float)3.03759e-07,
-    (float)3.19971e-07,
-    (float)4.04188e-06,
-    (float)1.30503e-06,
-    (float)1.45437e-06,
-    (float)2.7024e-06,
-    (float)2.33961e-06,
-    (float)4.14282e-06,
-    (float)6.16207e-08,
-    (float)2.3003e-06,
-    (float)3.1987e-06,
-    (float)1.8352e-06,
-    (float)6.16702e-07,
-    (float)3.31691e-07,
-    (float)4.17959e-06,
-    (float)0.193835,
-    (float)0.237774,
-    (float)0.0766765,
-    (float)0.0346666,
-    (float)0.0762001,
-    (float)0.0406565,
-    (float)0.0394863,
-    (float)0.0615629,
-    (float)0.0096863,
-    (float)0.036498,
-    (float)0.0516155,
-    (float)0.000390744,
-    (float)0.0269052,
-    (float)0.0320424,
-    (float)0.00407876,
-    (float)0.018281,
-    (float)0.0130297,
-    (float)0.00665982,
-    (float)0.0115975,
-    (float)0.00299694,
-    (float)0.00482856,
-    (float)0.00647344,
-    (float)0.000263996,
-    (float)0.00184331,
-    (float)0.00303904,
-    (float)7.89157e-05,
-    (float)0.000314059,
-    (float)0.00130121,
-    (float)0.000116264,
-    (float)3.88142e-05,
-    (float)0.000808472,
-    (float)0.000174394,
-    (float)6.45076e-05,
-    (float)0.000911539,
-    (float)0.000235167,
-    (float)2.74156e-05,
-    (float)0.00104736,
-    (float)0.00022315,
-    (float)5.6034e-05,
-    (float)0.00085397,
-    (float)0.000150108,
-    (float)0.000235061,
-    (float)0.00041561,
-    (float)6.62214e-05,
-    (float)0.000378151,
-    (float)8.18612e-05,
-    (float)9.21923e-06,
-    (float)0.000318423,
-    (float)1.5916e-06,
-    (float)7.01696e-06,
-    (float)0.000149405,
-    (float)2.70242e-05,
-    (float)3.41872e-05,
-    (float)4.56702e-05,
-    (float)2.79326e-05,
-    (float)4.37379e-05,
-    (float)3.02806e-05,
-    (float)8.81009e-06,
-    (float)3.06986e-05,
-    (float)3.64248e-05,
-    (float)5.07807e-06,
-    (float)1.2768e-05,
-    (float)2.69513e-05,
-    (float)2.00044e-05,
-    (float)2.34074e-06,
-    (float)9.55548e-06,
-    (float)3.58491e-05,
-    (float)1.40722e-08,
-    (float)6.11924e-07,
-    (float)4.21196e-05,
-    (float)3.32773e-07,
-    (float)2.5323e-06,
-    (float)4.07544e-05,
-    (float)7.08418e-07,
-    (float)8.34268e-06,
-    (float)3.67653e-05,
-    (float)8.91184e-07,
-    (float)1.45977e-05,
-    (float)3.08763e-05,
-    (float)1.1697e-06,
-    (float)2.25778e-05,
-    (float)1.97576e-05,
-    (float)2.94443e-06,
-    (float)3.00546e-05,
-    (float)6.02373e-06,
-    (float)4.12806e-06,
-    (float)3.0053e-05,
-    (float)2.58312e-08,
-    (float)2.35459e-06,
-    (float)1.97942e-05,
-    (float)1.99918e-06,
-    (float)1.42056e-06,
-    (float)7.56486e-06,
-    (float)2.28594e-06,
-    (float)3.78372e-06,
-    (float)2.02733e-06,
-    (float)7.84239e-08,
-    (float)4.76295e-06,
-    (float)2.51199e-06,
-    (float)1.72758e-06,
-    (float)2.25963e-06,
-    (float)3.98547e-06,
-    (float)4.21494e-06,
-    (float)2.23985e-06,
-    (float)4.49712e-06,
-    (float)2.17883e-06,
-    (float)7.36361e-06,
-    (float)2.61096e-06,
-    (float)2.56061e-07,
-    (float)1.15646e-05,
-    (float)1.64682e-07,
-    (float)3.96813e-06,
-    (float)8.35073e-06,
-    (float)1.27017e-06,
-    (float)9.95824e-06,
-    (float)1.75861e-06,
-    (float)4.0865e-06,
-    (float)1.14496e-05,
-    (float)4.03711e-07,
-    (float)3.64653e-06,
-    (float)7.04827e-06,
-    (float)3.14214e-06,
-    (float)2.04797e-06,
-    (float)2.10453e-06,
-    (float)2.21816e-06,
-    (float)1.74246e-06,
-    (float)1.16899e-06,
-    (float)2.17178e-07,
-    (float)0.179285,
-    (float)0.183573,
-    (float)0.0743759,
-    (float)0.0324127,
-    (float)0.0612424,
-    (float)0.039371,
-    (float)0.0349258,
-    (float)0.0621176,
-    (float)0.00876907,
-    (float)0.0308043,
-    (float)0.0627925,
-    (float)0.000379325,
-    (float)0.0243034,
-    (float)0.0449552,
-    (float)0.00629748,
-    (float)0.0230685,
-    (float)0.0203999,
-    (float)0.0107373,
-    (float)0.0231773,
-    (float)0.0045893,
-    (float)0.00921011,
-    (float)0.0192889,
-    (float)8.201e-05,
-    (float)0.00554929,
-    (float)0.0119275,
-    (float)0.000658103,
-    (float)0.00330308,
-    (float)0.00523742,
-    (float)0.000996618,
-    (float)0.00236314,
-    (float)0.00170928,
-    (float)0.000459003,
-    (float)0.00163265,
-    (float)0.00057634,
-    (float)5.20381e-05,
-    (float)0.00100131,
-    (float)0.000361462,
-    (float)2.04648e-05,
-    (float)0.000669056,
-    (float)0.000361357,
-    (float)8.22931e-05,
-    (float)0.000656389,
-    (float)0.000350565,
-    (float)6.60629e-05,
-    (float)0.000815365,
-    (float)0.00026059,
-    (float)1.57444e-05,
-    (float)0.000884396,
-    (float)0.000163294,
-    (float)4.82997e-05,
-    (float)0.00068335,
-    (float)0.000106772,
-    (float)0.000196825,
-    (float)0.000332,
-    (float)5.44203e-05,
-    (float)0.000329199,
-    (float)7.71656e-05,
-    (float)7.85229e-06,
-    (float)0.00031411,
-    (float)1.54275e-06,
-    (float)8.15827e-06,
-    (float)0.000180777,
-    (float)1.07606e-05,
-    (float)5.21066e-05,
-    (float)5.82658e-05,
-    (float)1.1709e-05,
-    (float)8.11049e-05,
-    (float)1.8468e-05,
-    (float)5.01402e-06,
-    (float)6.05214e-05,
-    (float)2.87048e-05,
-    (float)2.11117e-05,
-    (float)1.98907e-05,
-    (float)3.01001e-05,
-    (float)5.15308e-05,
-    (float)5.17346e-06,
-    (float)1.40924e-05,
-    (float)5.98565e-05,
-    (float)1.82378e-05,
-    (float)1.34791e-05,
-    (float)3.75073e-05,
-    (float)2.46665e-05,
-    (float)3.66317e-05,
-    (float)1.24803e-05,
-    (float)1.33399e-05,
-    (float)5.55345e-05,
-    (float)2.31933e-06,
-    (float)3.03451e-06,
-    (float)5.43326e-05,
-    (float)9.68976e-07,
-    (float)2.78103e-06,
-    (float)4.4702e-05,
-    (float)1.5968e-06,
-    (float)6.41388e-06,
-    (float)3.96615e-05,
-    (float)2.90658e-06,
-    (float)1.28686e-05,
-    (float)3.84218e-05,
-    (float)3.83155e-06,
-    (float)2.57403e-05,
-    (float)3.32336e-05,
-    (float)5.51753e-06,
-    (float)4.20798e-05,
-    (float)2.08247e-05,
-    (float)8.39768e-06,
-    (float)5.18934e-05,
-    (float)8.42507e-06,
-    (float)1.06537e-05,
-    (float)4.5409e-05,
-    (float)3.52056e-06,
-    (float)1.32121e-05,
-    (float)2.49439e-05,
-    (float)2.94831e-06,
-    (float)1.57252e-05,
-    (float)6.50978e-06,
-    (float)1.73044e-06,
-    (float)1.24978e-05,
-    (float)1.07701e-06,
-    (float)2.39993e-06,
-    (float)4.57542e-06,
-    (float)3.33266e-06,
-    (float)4.33457e-06,
-    (float)2.07318e-06,
-    (float)6.22302e-06,
-    (float)2.40449e-06,
-    (float)5.9769e-06,
-    (float)7.99705e-06,
-    (float)6.99605e-08,
-    (float)0.145297,
-    (float)0.124608,
-    (float)0.0703369,
-    (float)0.0276208,
-    (float)0.0456056,
-    (float)0.0369884,
-    (float)0.0279602,
-    (float)0.0601633,
-    (float)0.00754533,
-    (float)0.0214509,
-    (float)0.0706583,
-    (float)0.000445879,
-    (float)0.0167386,
-    (float)0.0555512,
-    (float)0.00803284,
-    (float)0.0240317,
-    (float)0.0267088,
-    (float)0.012861,
-    (float)0.0356504,
-    (float)0.0056662,
-    (float)0.01052,
-    (float)0.0381307,
-    (float)0.0001148,
-    (float)0.00755631,
-    (float)0.0278746,
-    (float)0.00299204,
-    (float)0.009019,
-    (float)0.0129687,
-    (float)0.00475114,
-    (float)0.0121947,
-    (float)0.00306443,
-    (float)0.00328409,
-    (float)0.0121133,
-    (float)8.72798e-05,
-    (float)0.00159123,
-    (float)0.00841243,
-    (float)0.000273219,
-    (float)0.00137542,
-    (float)0.00411119,
-    (float)0.00046214,
-    (float)0.00181981,
-    (float)0.00143748,
-    (float)0.000182049,
-    (float)0.00181224,
-    (float)0.000415382,
-    (float)5.70182e-06,
-    (float)0.00134419,
-    (float)0.000158285,
-    (float)4.98877e-05,
-    (float)0.000891313,
-    (float)0.000123865,
-    (float)0.000117483,
-    (float)0.000651908,
-    (float)0.000147151,
-    (float)0.000122574,
-    (float)0.00056905,
-    (float)0.000166266,
-    (float)0.000110757,
-    (float)0.000520521,
-    (float)0.000158489,
-    (float)0.000147184,
-    (float)0.000410237,
-    (float)0.000129878,
-    (float)0.000247802,
-    (float)0.000243984,
-    (float)7.72082e-05,
-    (float)0.000349525,
-    (float)0.000113584,
-    (float)2.10028e-05,
-    (float)0.000357428,
-    (float)6.84772e-05,
-    (float)1.69562e-05,
-    (float)0.000247582,
-    (float)6.6791e-05,
-    (float)8.75568e-05,
-    (float)9.65153e-05,
-    (float)4.52859e-05,
-    (float)0.000173845,
-    (float)1.12295e-05,
-    (float)6.23201e-06,
-    (float)0.000180813,
-    (float)1.6796e-05,
-    (float)1.16478e-05,
-    (float)9.57442e-05,
-    (float)3.82582e-05,
-    (float)7.2847e-05,
-    (float)1.46439e-05,
-    (float)1.98837e-05,
-    (float)0.000112519,
-    (float)1.24333e-05,
-    (float)3.62104e-07,
-    (float)7.57122e-05,
-    (float)4.48055e-05,
-    (float)3.02878e-05,
-    (float)1.79514e-05,
-    (float)3.51589e-05,
-    (float)7.07503e-05,
-    (float)1.62816e-05,
-    (float)3.23473e-06,
-    (float)5.86912e-05,
-    (float)4.58589e-05,
-    (float)1.14147e-05,
-    (float)1.71176e-05,
-    (float)4.03024e-05,
-    (float)4.6104e-05,
-    (float)6.27715e-06,
-    (float)9.23589e-06,
-    (float)4.89592e-05,
-    (float)2.23441e-05,
-    (float)5.9354e-06,
-    (float)2.05926e-05,
-    (float)2.15036e-05,
-    (float)2.65782e-05,
-    (float)7.49581e-06,
-    (float)5.00033e-06,
-    (float)2.85506e-05,
-    (float)1.72435e-05,
-    (float)4.06348e-06,
-    (float)1.05403e-05,
-    (float)2.05343e-05,
-    (float)1.8097e-05,
-    (float)5.56111e-06,
-    (float)8.10395e-06,
-    (float)2.13123e-05,
-    (float)2.12203e-05,
-    (float)8.91314e-08,
-    (float)8.74682e-06,
-    (float)3.17973e-05,
-    (float)0.0722279,
-    (float)0.0564115,
-    (float)0.0589007,
-    (float)0.0166412,
-    (float)0.0289653,
-    (float)0.0312572,
-    (float)0.0167737,
-    (float)0.0522058,
-    (float)0.00611109,
-    (float)0.00970929,
-    (float)0.0683635,
-    (float)0.000490658,
-    (float)0.00730131,
-    (float)0.0566813,
-    (float)0.00775232,
-    (float)0.0215442,
-    (float)0.0278324,
-    (float)0.0108201,
-    (float)0.0435209,
-    (float)0.00548669,
-    (float)0.00656468,
-    (float)0.0538482,
-    (float)0.000380224,
-    (float)0.00531043,
-    (float)0.0433267,
-    (float)0.00526458,
-    (float)0.0148473,
-    (float)0.0211651,
-    (float)0.00755251,
-    (float)0.0290773,
-    (float)0.00441909,
-    (float)0.00458528,
-    (float)0.0347628,
-    (float)0.000246607,
-    (float)0.00329869,
-    (float)0.0270812,
-    (float)0.00277419,
-    (float)0.00812205,
-    (float)0.0132197,
-    (float)0.00396101,
-    (float)0.015176,
-    (float)0.00314693,
-    (float)0.00228044,
-    (float)0.0176002,
-    (float)0.000230502,
-    (float)0.00131002,
-    (float)0.0135192,
-    (float)0.000966311,
-    (float)0.00307744,
-    (float)0.00689625,
-    (float)0.00135363,
-    (float)0.00573883,
-    (float)0.00215524,
-    (float)0.000680861,
-    (float)0.00666939,
-    (float)0.000445528,
-    (float)0.000209098,
-    (float)0.00533845,
-    (float)0.000358698,
-    (float)0.000621773,
-    (float)0.00314016,
-    (float)0.000406776,
-    (float)0.00138318,
-    (float)0.00148879,
-    (float)0.00021218,
-    (float)0.00177722,
-    (float)0.000728678,
-    (float)2.48285e-05,
-    (float)0.00165555,
-    (float)0.00049153,
-    (float)2.3081e-05,
-    (float)0.00129101,
-    (float)0.000375657,
-    (float)0.000150436,
-    (float)0.000962012,
-    (float)0.000239001,
-    (float)0.000285759,
-    (float)0.000732544,
-    (float)0.000118986,
-    (float)0.000387486,
-    (float)0.000539515,
-    (float)5.40587e-05,
-    (float)0.000459287,
-    (float)0.00035948,
-    (float)3.61167e-05,
-    (float)0.000485706,
-    (float)0.000222612,
-    (float)4.72623e-05,
-    (float)0.000450795,
-    (float)0.000150337,
-    (float)7.46515e-05,
-    (float)0.000364778,
-    (float)0.000133084,
-    (float)0.000114032,
-    (float)0.000254223,
-    (float)0.000132493,
-    (float)0.000175678,
-    (float)0.000156558,
-    (float)9.81935e-05,
-    (float)0.000249576,
-    (float)0.000121001,
-    (float)3.03294e-05,
-    (float)0.000268943,
-    (float)0.000156273,
-    (float)1.47677e-05,
-    (float)0.000184241,
-    (float)0.000179967,
-    (float)0.000116179,
-    (float)7.29011e-05,
-    (float)0.000109065,
-    (float)0.000239314,
-    (float)6.50889e-05,
-    (float)1.10331e-05,
-    (float)0.000220014,
-    (float)0.000139829,
-    (float)3.31356e-05,
-    (float)7.67051e-05,
-    (float)0.000144243,
-    (float)0.000156242,
-    (float)5.48847e-06,
-    (float)4.84338e-05,
-    (float)0.000192979,
-    (float)8.18324e-05,
-    (float)4.01512e-06,
-    (float)8.15881e-05,
-    (float)0.000148767,
-    (float)8.47592e-05,
-    (float)6.03947e-08,
-    (float)0.000684993,
-    (float)0.00192902,
-    (float)0.0350133,
-    (float)0.00376401,
-    (float)0.0132494,
-    (float)0.0202208,
-    (float)0.00461521,
-    (float)0.033332,
-    (float)0.00473423,
-    (float)0.00105122,
-    (float)0.0467344,
-    (float)9.16902e-05,
-    (float)0.00166133,
-    (float)0.0399481,
-    (float)0.00371911,
-    (float)0.0148729,
-    (float)0.0199304,
-    (float)0.00452325,
-    (float)0.0343303,
-    (float)0.00388049,
-    (float)0.000845616,
-    (float)0.0446866,
-    (float)0.000160621,
-    (float)0.00165102,
-    (float)0.0371971,
-    (float)0.00353485,
-    (float)0.0139977,
-    (float)0.0182997,
-    (float)0.00412351,
-    (float)0.0318774,
-    (float)0.00337571,
-    (float)0.000659246,
-    (float)0.0404618,
-    (float)0.000253365,
-    (float)0.00172451,
-    (float)0.0324289,
-    (float)0.00315586,
-    (float)0.0129609,
-    (float)0.0153333,
-    (float)0.00327696,
-    (float)0.0279569,
-    (float)0.00272923,
-    (float)0.000372907,
-    (float)0.0340276,
-    (float)0.00032936,
-    (float)0.00187744,
-    (float)0.0260904,
-    (float)0.00249378,
-    (float)0.0115246,
-    (float)0.0117813,
-    (float)0.00220002,
-    (float)0.0229328,
-    (float)0.00210031,
-    (float)0.000116029,
-    (float)0.0263803,
-    (float)0.000378265,
-    (float)0.00196228,
-    (float)0.0193449,
-    (float)0.00171914,
-    (float)0.00956893,
-    (float)0.00846959,
-    (float)0.00125381,
-    (float)0.0174681,
-    (float)0.00165203,
-    (float)9.44266e-06,
-    (float)0.0189887,
-    (float)0.000471221,
-    (float)0.00187802,
-    (float)0.0134173,
-    (float)0.00116129,
-    (float)0.00739324,
-    (float)0.00587081,
-    (float)0.000702163,
-    (float)0.0124838,
-    (float)0.00143777,
-    (float)5.05901e-05,
-    (float)0.0129702,
-    (float)0.00070907,
-    (float)0.00165448,
-    (float)0.00894129,
-    (float)0.00100843,
-    (float)0.00547657,
-    (float)0.00405437,
-    (float)0.000535676,
-    (float)0.00866451,
-    (float)0.00143912,
-    (float)0.00013946,
-    (float)0.00866389,
-    (float)0.00111394,
-    (float)0.00142667,
-    (float)0.00586359,
-    (float)0.00114,
-    (float)0.0041329,
-    (float)0.00289157,
-    (float)0.000518791,
-    (float)0.00611186,
-    (float)0.00162021,
-    (float)0.000202693,
-    (float)0.00578169,
-    (float)0.00156596,
-    (float)0.00134032,
-    (float)0.00384424,
-    (float)0.00125219,
-    (float)0.00336356,
-    (float)0.00227551,
-    (float)0.000432928,
-    (float)0.00447335,
-    (float)0.00193141,
-    (float)0.000280925,
-    (float)0.00387539,
-    (float)0.00186823,
-    (float)0.00145615,
-    (float)0.00265999,
-    (float)0.00113103,
-    (float)0.00294761,
-    (float)0.00217848,
-    (float)0.000271756,
-    (float)0.00334791,
-    (float)0.00229589,
-    (float)0.000477059,
-    (float)0.00270598,
-    (float)0.0018976,
-    (float)0.00170136,
-    (float)0.00227998,
-    (float)0.000808414,
-    (float)0.00263618,
-    (float)0.00256677,
-    (float)0.000187693,
-    (float)0.000684993,
-    (float)0.00192902,
-    (float)0.0350133,
-    (float)0.00376401,
-    (float)0.0132494,
-    (float)0.0202208,
-    (float)0.00461521,
-    (float)0.033332,
-    (float)0.00473423,
-    (float)0.00105122,
-    (float)0.0467344,
-    (float)9.16902e-05,
-    (float)0.00166133,
-    (float)0.0399481,
-    (float)0.00371911,
-    (float)0.0148729,
-    (float)0.0199304,
-    (float)0.00452325,
-    (float)0.0343303,
-    (float)0.00388049,
-    (float)0.000845616,
-    (float)0.0446866,
-    (float)0.000160621,
-    (float)0.00165102,
-    (float)0.0371971,
-    (float)0.00353485,
-    (float)0.0139977,
-    (float)0.0182997,
-    (float)0.00412351,
-    (float)0.0318774,
-    (float)0.00337571,
-    (float)0.000659246,
-    (float)0.0404618,
-    (float)0.000253365,
-    (float)0.00172451,
-    (float)0.0324289,
-    (float)0.00315586,
-    (float)0.0129609,
-    (float)0.0153333,
-    (float)0.00327696,
-    (float)0.0279569,
-    (float)0.00272923,
-    (float)0.000372907,
-    (float)0.0340276,
-    (float)0.00032936,
-    (float)0.00187744,
-    (float)0.0260904,
-    (float)0.00249378,
-    (float)0.0115246,
-    (float)0.0117813,
-    (float)0.00220002,
-    (float)0.0229328,
-    (float)0.00210031,
-    (float)0.000116029,
-    (float)0.0263803,
-    (float)0.000378265,
-    (float)0.00196228,
-    (float)0.0193449,
-    (float)0.00171914,
-    (float)0.00956893,
-    (float)0.00846959,
-    (float)0.00125381,
-    (float)0.0174681,
-    (float)0.00165203,
-    (float)9.44266e-06,
-    (float)0.0189887,
-    (float)0.000471221,
-    (float)0.00187802,
-    (float)0.0134173,
-    (float)0.00116129,
-    (float)0.00739324,
-    (float)0.00587081,
-    (float)0.000702163,
-    (float)0.0124838,
-    (float)0.00143777,
-    (float)5.05901e-05,
-    (float)0.0129702,
-    (float)0.00070907,
-    (float)0.00165448,
-    (float)0.00894129,
-    (float)0.00100843,
-    (float)0.00547657,
-    (float)0.00405437,
-    (float)0.000535676,
-    (float)0.00866451,
-    (float)0.00143912,
-    (float)0.00013946,
-    (float)0.00866389,
-    (float)0.00111394,
-    (float)0.00142667,
-    (float)0.00586359,
-    (float)0.00114,
-    (float)0.0041329,
-    (float)0.00289157,
-    (float)0.000518791,
-    (float)0.00611186,
-    (float)0.00162021,
-    (float)0.000202693,
-    (float)0.00578169,
-    (float)0.00156596,
-    (float)0.00134032,
-    (float)0.00384424,
-    (float)0.00125219,
-    (float)0.00336356,
-    (float)0.00227551,
-    (float)0.000432928,
-    (float)0.00447335,
-    (float)0.00193141,
-    (float)0.000280925,
-    (float)0.00387539,
-    (float)0.00186823,
-    (float)0.00145615,
-    (float)0.00265999,
-    (float)0.00113103,
-    (float)0.00294761,
-    (float)0.00217848,
-    (float)0.000271756,
-    (float)0.00334791,
-    (float)0.00229589,
-    (float)0.000477059,
-    (float)0.00270598,
-    (float)0.0018976,
-    (float)0.00170136,
-    (float)0.00227998,
-    (float)0.000808414,
-    (float)0.00263618,
-    (float)0.00256677,
-    (float)0.000187693,
-    (float)0.187617,
-    (float)0.00285152,
-    (float)0.0581672,
-    (float)0.0284159,
-    (float)0.0184033,
-    (float)0.0317902,
-    (float)0.0174774,
-    (float)0.0493763,
-    (float)0.00850024,
-    (float)0.00525682,
-    (float)0.0675551,
-    (float)0.00463497,
-    (float)0.000861132,
-    (float)0.0558229,
-    (float)0.0116942,
-    (float)0.0159937,
-    (float)0.0270132,
-    (float)0.0117632,
-    (float)0.0400133,
-    (float)0.00591803,
-    (float)0.00381966,
-    (float)0.0513812,
-    (float)0.0020504,
-    (float)0.00100842,
-    (float)0.0408919,
-    (float)0.00627178,
-    (float)0.011258,
-    (float)0.0193009,
-    (float)0.00624655,
-    (float)0.0262902,
-    (float)0.00406177,
-    (float)0.00163851,
-    (float)0.0315044,
-    (float)0.000801056,
-    (float)0.000922082,
-    (float)0.0231404,
-    (float)0.00239175,
-    (float)0.00727883,
-    (float)0.0100634,
-    (float)0.00192813,
-    (float)0.0144292,
-    (float)0.00195218,
-    (float)0.000159225,
-    (float)0.0151629,
-    (float)0.000251976,
-    (float)0.00104066,
-    (float)0.00964339,
-    (float)0.000575932,
-    (float)0.00453337,
-    (float)0.00349757,
-    (float)0.000222451,
-    (float)0.00684873,
-    (float)0.000525058,
-    (float)0.000129028,
-    (float)0.00577257,
-    (float)9.65127e-05,
-    (float)0.00138228,
-    (float)0.00282366,
-    (float)0.000144409,
-    (float)0.00294603,
-    (float)0.000643104,
-    (float)0.00010973,
-    (float)0.00315571,
-    (float)4.50085e-05,
-    (float)0.000567914,
-    (float)0.00192607,
-    (float)0.000127633,
-    (float)0.00150151,
-    (float)0.000556512,
-    (float)0.00011651,
-    (float)0.002061,
-    (float)3.89509e-05,
-    (float)0.000151825,
-    (float)0.00166645,
-    (float)0.000201378,
-    (float)0.000594275,
-    (float)0.000728376,
-    (float)0.000322601,
-    (float)0.00122968,
-    (float)0.000123992,
-    (float)0.000149632,
-    (float)0.00144695,
-    (float)0.000191538,
-    (float)5.14974e-05,
-    (float)0.00101712,
-    (float)0.000491858,
-    (float)0.000337521,
-    (float)0.000387834,
-    (float)0.000484204,
-    (float)0.000764403,
-    (float)0.000137766,
-    (float)0.000183505,
-    (float)0.000860922,
-    (float)0.000306548,
-    (float)3.96349e-06,
-    (float)0.000558393,
-    (float)0.000469804,
-    (float)0.000127787,
-    (float)0.000218556,
-    (float)0.000359266,
-    (float)0.000322975,
-    (float)0.000120513,
-    (float)0.000121571,
-    (float)0.000335386,
-    (float)0.0001823,
-    (float)3.08707e-06,
-    (float)0.000196041,
-    (float)0.000192715,
-    (float)2.91964e-05,
-    (float)7.84237e-05,
-    (float)0.000109777,
-    (float)7.14965e-05,
-    (float)4.32889e-05,
-    (float)2.87428e-05,
-    (float)6.36274e-05,
-    (float)3.78352e-05,
-    (float)2.71911e-06,
-    (float)3.37114e-05,
-    (float)2.36301e-05,
-    (float)7.42034e-06,
-    (float)1.45627e-05,
-    (float)8.96599e-06,
-    (float)1.09865e-05,
-    (float)7.64585e-06,
-    (float)4.4578e-06,
-    (float)8.48122e-06,
-    (float)6.27315e-06,
-    (float)4.66298e-06,
-    (float)0.386893,
-    (float)0.00482426,
-    (float)0.064973,
-    (float)0.0478813,
-    (float)0.018656,
-    (float)0.0371161,
-    (float)0.0233193,
-    (float)0.0489824,
-    (float)0.0130615,
-    (float)0.00706629,
-    (float)0.0635373,
-    (float)0.0074111,
-    (float)0.0012403,
-    (float)0.0500714,
-    (float)0.0108729,
-    (float)0.0122224,
-    (float)0.0237533,
-    (float)0.00884202,
-    (float)0.0277476,
-    (float)0.00578894,
-    (float)0.00245675,
-    (float)0.0316629,
-    (float)0.00119694,
-    (float)0.000944417,
-    (float)0.0217385,
-    (float)0.00187068,
-    (float)0.00627847,
-    (float)0.00851596,
-    (float)0.00106103,
-    (float)0.0111646,
-    (float)0.00135827,
-    (float)4.76512e-05,
-    (float)0.00985615,
-    (float)5.7217e-06,
-    (float)0.00161007,
-    (float)0.00475463,
-    (float)6.70319e-05,
-    (float)0.00408533,
-    (float)0.00100389,
-    (float)8.50589e-05,
-    (float)0.00435123,
-    (float)6.42153e-05,
-    (float)0.000971612,
-    (float)0.0023663,
-    (float)0.000161031,
-    (float)0.00246225,
-    (float)0.000496007,
-    (float)9.07648e-05,
-    (float)0.00301204,
-    (float)4.15996e-06,
-    (float)0.000230887,
-    (float)0.00213962,
-    (float)0.000217805,
-    (float)0.0008635,
-    (float)0.000846526,
-    (float)0.000256607,
-    (float)0.00145773,
-    (float)0.000131626,
-    (float)7.37914e-05,
-    (float)0.00145686,
-    (float)7.31793e-05,
-    (float)1.74285e-05,
-    (float)0.000947285,
-    (float)0.000200363,
-    (float)0.000168452,
-    (float)0.000404509,
-    (float)0.000196636,
-    (float)0.000326262,
-    (float)0.000128925,
-    (float)8.56848e-05,
-    (float)0.0003269,
-    (float)8.32842e-05,
-    (float)7.82064e-06,
-    (float)0.000201056,
-    (float)8.84354e-05,
-    (float)5.81878e-06,
-    (float)8.31814e-05,
-    (float)5.54827e-05,
-    (float)2.08552e-05,
-    (float)3.40738e-05,
-    (float)1.67117e-05,
-    (float)1.58729e-05,
-    (float)1.89395e-05,
-    (float)4.15171e-06,
-    (float)6.49446e-06,
-    (float)7.29214e-06,
-    (float)5.2887e-06,
-    (float)5.13204e-06,
-    (float)1.71805e-06,
-    (float)5.27579e-06,
-    (float)4.98482e-06,
-    (float)3.32335e-06,
-    (float)4.51365e-06,
-    (float)2.99857e-06,
-    (float)4.40346e-06,
-    (float)3.40451e-06,
-    (float)2.96602e-06,
-    (float)4.03833e-06,
-    (float)1.6518e-06,
-    (float)5.29653e-06,
-    (float)6.01421e-06,
-    (float)1.2537e-06,
-    (float)9.71196e-06,
-    (float)1.32562e-05,
-    (float)4.71802e-06,
-    (float)1.44773e-05,
-    (float)2.26239e-05,
-    (float)1.87906e-05,
-    (float)2.01766e-05,
-    (float)2.05623e-05,
-    (float)4.19779e-05,
-    (float)3.77874e-05,
-    (float)5.24775e-06,
-    (float)5.06327e-05,
-    (float)6.40216e-05,
-    (float)5.62467e-06,
-    (float)3.48464e-05,
-    (float)6.34972e-05,
-    (float)3.39346e-05,
-    (float)2.67601e-05,
-    (float)2.59278e-05,
-    (float)5.16803e-05,
-    (float)4.47788e-05,
-    (float)4.94265e-07,
-    (float)3.26029e-05,
-    (float)5.22857e-05,
-    (float)2.27638e-05,
-    (float)1.45254e-05,
-    (float)0.518966,
-    (float)0.0053938,
-    (float)0.066146,
-    (float)0.0587344,
-    (float)0.0180396,
-    (float)0.0387591,
-    (float)0.0241705,
-    (float)0.0440202,
-    (float)0.0151411,
-    (float)0.00650013,
-    (float)0.0521322,
-    (float)0.00737294,
-    (float)0.0011759,
-    (float)0.0369749,
-    (float)0.0068024,
-    (float)0.00844583,
-    (float)0.0153439,
-    (float)0.00359265,
-    (float)0.0159355,
-    (float)0.00297913,
-    (float)0.000270766,
-    (float)0.0143751,
-    (float)0.000125052,
-    (float)0.00129774,
-    (float)0.00693732,
-    (float)0.000105247,
-    (float)0.00439393,
-    (float)0.00140849,
-    (float)0.00013815,
-    (float)0.00481402,
-    (float)0.000128569,
-    (float)0.00123176,
-    (float)0.0024306,
-    (float)0.000344884,
-    (float)0.00288808,
-    (float)0.000400372,
-    (float)0.000275558,
-    (float)0.00324334,
-    (float)2.50248e-05,
-    (float)0.000342611,
-    (float)0.00208188,
-    (float)0.000265806,
-    (float)0.000800555,
-    (float)0.000746089,
-    (float)0.000230409,
-    (float)0.0010759,
-    (float)0.000114038,
-    (float)5.16927e-05,
-    (float)0.00086914,
-    (float)8.32255e-06,
-    (float)1.2409e-06,
-    (float)0.000469428,
-    (float)3.16203e-05,
-    (float)3.81068e-05,
-    (float)0.000175706,
-    (float)3.70684e-05,
-    (float)5.74557e-05,
-    (float)4.58032e-05,
-    (float)2.38749e-05,
-    (float)3.9043e-05,
-    (float)1.40697e-05,
-    (float)1.50743e-05,
-    (float)1.23001e-05,
-    (float)8.8382e-06,
-    (float)1.7144e-05,
-    (float)3.13375e-06,
-    (float)5.93592e-06,
-    (float)1.80645e-05,
-    (float)6.84778e-06,
-    (float)1.35242e-05,
-    (float)1.25938e-05,
-    (float)7.60666e-06,
-    (float)2.98475e-05,
-    (float)6.76978e-06,
-    (float)4.41085e-06,
-    (float)4.1858e-05,
-    (float)3.51507e-06,
-    (float)4.48656e-06,
-    (float)4.62588e-05,
-    (float)1.40893e-06,
-    (float)8.64293e-06,
-    (float)4.8496e-05,
-    (float)5.58323e-07,
-    (float)1.48042e-05,
-    (float)4.82787e-05,
-    (float)1.97319e-06,
-    (float)2.40686e-05,
-    (float)3.85448e-05,
-    (float)4.93292e-06,
-    (float)3.6526e-05,
-    (float)1.96493e-05,
-    (float)6.63266e-06,
-    (float)4.34923e-05,
-    (float)5.51536e-06,
-    (float)9.71783e-06,
-    (float)3.26494e-05,
-    (float)5.21873e-06,
-    (float)2.15488e-05,
-    (float)1.03359e-05,
-    (float)1.21731e-05,
-    (float)3.37375e-05,
-    (float)3.18684e-07,
-    (float)2.47396e-05,
-    (float)2.78524e-05,
-    (float)5.86602e-06,
-    (float)4.60604e-05,
-    (float)1.09007e-05,
-    (float)9.64324e-06,
-    (float)5.85285e-05,
-    (float)4.69869e-06,
-    (float)1.08158e-05,
-    (float)4.33454e-05,
-    (float)7.0864e-06,
-    (float)1.77234e-05,
-    (float)1.60194e-05,
-    (float)4.06512e-06,
-    (float)2.05329e-05,
-    (float)1.94512e-06,
-    (float)1.08339e-07,
-    (float)1.13368e-05,
-    (float)1.60691e-07,
-    (float)1.44505e-06,
-    (float)2.95566e-06,
-    (float)6.30665e-07,
-    (float)1.48131e-06,
-    (float)2.34149e-06,
-    (float)2.08164e-06,
-    (float)1.00015e-09,
-    (float)0.610675,
-    (float)0.00510661,
-    (float)0.0650729,
-    (float)0.0654721,
-    (float)0.0168083,
-    (float)0.0380022,
-    (float)0.0232497,
-    (float)0.037131,
-    (float)0.0148004,
-    (float)0.005093,
-    (float)0.0387319,
-    (float)0.00567821,
-    (float)0.000778911,
-    (float)0.0230162,
-    (float)0.00303382,
-    (float)0.00562788,
-    (float)0.00707253,
-    (float)0.000577789,
-    (float)0.00844494,
-    (float)0.000631542,
-    (float)0.00031893,
-    (float)0.00541698,
-    (float)0.000141957,
-    (float)0.00262984,
-    (float)0.00134973,
-    (float)0.000377069,
-    (float)0.00404203,
-    (float)4.73761e-05,
-    (float)0.000560876,
-    (float)0.0028714,
-    (float)0.000364729,
-    (float)0.00117255,
-    (float)0.00100687,
-    (float)0.000368805,
-    (float)0.00146431,
-    (float)0.000129464,
-    (float)8.79858e-05,
-    (float)0.00105654,
-    (float)2.67435e-06,
-    (float)9.00145e-06,
-    (float)0.000481971,
-    (float)7.88226e-06,
-    (float)5.43973e-05,
-    (float)0.000151935,
-    (float)9.46172e-06,
-    (float)5.55884e-05,
-    (float)3.28768e-05,
-    (float)2.20044e-05,
-    (float)2.85309e-05,
-    (float)3.28275e-06,
-    (float)2.58237e-05,
-    (float)9.83437e-06,
-    (float)2.12346e-06,
-    (float)2.86019e-05,
-    (float)5.39082e-06,
-    (float)8.55747e-07,
-    (float)3.53946e-05,
-    (float)1.16189e-05,
-    (float)1.61874e-06,
-    (float)3.40595e-05,
-    (float)1.50831e-05,
-    (float)1.19579e-05,
-    (float)2.32611e-05,
-    (float)1.11224e-05,
-    (float)2.34624e-05,
-    (float)1.06024e-05,
-    (float)6.45072e-06,
-    (float)2.954e-05,
-    (float)2.68034e-06,
-    (float)3.43396e-06,
-    (float)2.95293e-05,
-    (float)1.88623e-06,
-    (float)3.95215e-06,
-    (float)2.25678e-05,
-    (float)4.7521e-06,
-    (float)1.08496e-05,
-    (float)1.11381e-05,
-    (float)6.74316e-06,
-    (float)2.11691e-05,
-    (float)4.14346e-06,
-    (float)8.13173e-06,
-    (float)2.30329e-05,
-    (float)6.93441e-06,
-    (float)1.70088e-05,
-    (float)1.08751e-05,
-    (float)8.79111e-06,
-    (float)3.18123e-05,
-    (float)5.66455e-07,
-    (float)3.80301e-06,
-    (float)3.28053e-05,
-    (float)1.56651e-06,
-    (float)5.2836e-06,
-    (float)1.62531e-05,
-    (float)2.13238e-06,
-    (float)1.49436e-05,
-    (float)2.63338e-06,
-    (float)1.03954e-07,
-    (float)1.59506e-05,
-    (float)6.13766e-07,
-    (float)5.65787e-06,
-    (float)6.62347e-06,
-    (float)6.01964e-07,
-    (float)1.26362e-05,
-    (float)8.56389e-07,
-    (float)8.73998e-07,
-    (float)1.04542e-05,
-    (float)8.28953e-08,
-    (float)2.93486e-06,
-    (float)5.75895e-06,
-    (float)2.39167e-07,
-    (float)2.84581e-06,
-    (float)4.58318e-06,
-    (float)2.10276e-06,
-    (float)3.05321e-06,
-    (float)3.59579e-06,
-    (float)2.94548e-06,
-    (float)7.44883e-06,
-    (float)2.90878e-06,
-    (float)8.5577e-07,
-    (float)9.93231e-06,
-    (float)3.65565e-06,
-    (float)9.29732e-07,
-    (float)6.34438e-06,
-    (float)3.01569e-06,
-    (float)4.52755e-06,
-    (float)1.61306e-06,
-    (float)9.87002e-07,
-    (float)6.8251e-06,
-    (float)0.677557,
-    (float)0.00442807,
-    (float)0.0624599,
-    (float)0.0690458,
-    (float)0.0156054,
-    (float)0.0354702,
-    (float)0.0207874,
-    (float)0.0300878,
-    (float)0.0127984,
-    (float)0.0032106,
-    (float)0.0265276,
-    (float)0.00348083,
-    (float)0.000598359,
-    (float)0.0121578,
-    (float)0.00079662,
-    (float)0.00427572,
-    (float)0.00215866,
-    (float)3.79329e-05,
-    (float)0.00491682,
-    (float)0.000122705,
-    (float)0.00129814,
-    (float)0.00221625,
-    (float)0.000598963,
-    (float)0.002814,
-    (float)0.000258402,
-    (float)0.000476425,
-    (float)0.00257652,
-    (float)3.7265e-05,
-    (float)0.00024651,
-    (float)0.00124845,
-    (float)0.000131366,
-    (float)0.000250139,
-    (float)0.000358707,
-    (float)3.71985e-05,
-    (float)0.00018504,
-    (float)9.23101e-05,
-    (float)5.49456e-06,
-    (float)7.30339e-05,
-    (float)2.44279e-05,
-    (float)2.80446e-05,
-    (float)1.74098e-05,
-    (float)2.27242e-06,
-    (float)2.78762e-05,
-    (float)1.8939e-06,
-    (float)9.80229e-07,
-    (float)2.65498e-05,
-    (float)9.00162e-06,
-    (float)4.08082e-07,
-    (float)2.97256e-05,
-    (float)1.95253e-05,
-    (float)7.1065e-06,
-    (float)2.37352e-05,
-    (float)1.6184e-05,
-    (float)1.67817e-05,
-    (float)9.59868e-06,
-    (float)7.97548e-06,
-    (float)1.96797e-05,
-    (float)1.216e-06,
-    (float)4.09687e-06,
-    (float)1.49535e-05,
-    (float)6.13222e-06,
-    (float)4.90773e-06,
-    (float)7.92612e-06,
-    (float)1.49999e-05,
-    (float)9.75429e-06,
-    (float)3.74357e-06,
-    (float)1.65213e-05,
-    (float)1.57433e-05,
-    (float)4.10986e-06,
-    (float)1.23288e-05,
-    (float)1.54132e-05,
-    (float)6.42856e-06,
-    (float)1.11591e-05,
-    (float)7.41795e-06,
-    (float)4.73041e-06,
-    (float)1.35884e-05,
-    (float)1.5347e-06,
-    (float)4.0591e-07,
-    (float)1.12824e-05,
-    (float)1.81014e-06,
-    (float)3.22642e-06,
-    (float)3.85701e-06,
-    (float)1.65323e-06,
-    (float)1.05156e-05,
-    (float)1.17145e-07,
-    (float)6.61337e-07,
-    (float)1.00983e-05,
-    (float)2.93023e-07,
-    (float)1.98507e-06,
-    (float)4.19658e-06,
-    (float)2.65594e-07,
-    (float)2.15068e-06,
-    (float)9.24549e-07,
-    (float)6.76567e-07,
-    (float)1.00426e-06,
-    (float)2.6981e-07,
-    (float)9.37982e-07,
-    (float)1.59791e-06,
-    (float)2.92437e-07,
-    (float)4.76149e-07,
-    (float)1.88105e-06,
-    (float)1.20611e-06,
-    (float)9.13806e-07,
-    (float)5.11551e-07,
-    (float)3.38871e-06,
-    (float)1.68772e-06,
-    (float)1.86051e-07,
-    (float)5.04704e-06,
-    (float)1.57588e-06,
-    (float)2.50979e-06,
-    (float)3.88126e-06,
-    (float)6.4239e-07,
-    (float)4.79183e-06,
-    (float)1.96641e-06,
-    (float)1.29887e-07,
-    (float)3.56173e-06,
-    (float)1.23481e-06,
-    (float)1.26612e-06,
-    (float)1.46876e-06,
-    (float)4.34376e-07,
-    (float)1.79589e-06,
-    (float)1.88196e-06,
-    (float)1.45159e-07,
-    (float)4.51225e-07,
-    (float)2.1772e-06,
-    (float)6.25727e-07,
-    (float)1.89687e-07,
-    (float)1.66956e-06,
-    (float)0.727408,
-    (float)0.00368325,
-    (float)0.0592152,
-    (float)0.0703106,
-    (float)0.014441,
-    (float)0.031789,
-    (float)0.0175307,
-    (float)0.0236621,
-    (float)0.00985299,
-    (float)0.00152186,
-    (float)0.0169734,
-    (float)0.00156519,
-    (float)0.000948514,
-    (float)0.00543659,
-    (float)6.4037e-05,
-    (float)0.00396312,
-    (float)0.000336037,
-    (float)0.000499062,
-    (float)0.00342296,
-    (float)0.000369536,
-    (float)0.00149439,
-    (float)0.00117547,
-    (float)0.000577491,
-    (float)0.00163839,
-    (float)0.000125615,
-    (float)0.000176975,
-    (float)0.000896053,
-    (float)3.42729e-05,
-    (float)1.29079e-05,
-    (float)0.000273108,
-    (float)2.0611e-05,
-    (float)3.50642e-05,
-    (float)7.08077e-05,
-    (float)5.48929e-06,
-    (float)2.876e-05,
-    (float)1.30725e-05,
-    (float)8.94093e-06,
-    (float)1.94669e-05,
-    (float)1.85246e-06,
-    (float)8.75289e-06,
-    (float)2.03797e-05,
-    (float)1.4959e-05,
-    (float)2.16962e-05,
-    (float)1.70496e-05,
-    (float)1.23748e-05,
-    (float)3.21049e-05,
-    (float)5.87488e-06,
-    (float)3.33532e-06,
-    (float)2.33079e-05,
-    (float)4.03404e-07,
-    (float)3.29385e-06,
-    (float)8.59971e-06,
-    (float)9.85676e-06,
-    (float)9.55122e-06,
-    (float)3.54614e-06,
-    (float)1.70201e-05,
-    (float)1.35254e-05,
-    (float)7.76301e-06,
-    (float)1.46048e-05,
-    (float)1.19899e-05,
-    (float)9.97327e-06,
-    (float)1.04685e-05,
-    (float)8.03653e-06,
-    (float)6.20142e-06,
-    (float)8.50068e-06,
-    (float)4.99802e-06,
-    (float)9.6957e-07,
-    (float)5.94429e-06,
-    (float)4.69342e-06,
-    (float)1.86397e-06,
-    (float)1.79758e-06,
-    (float)3.87466e-06,
-    (float)7.16765e-06,
-    (float)9.88782e-08,
-    (float)1.83285e-06,
-    (float)7.42268e-06,
-    (float)3.02956e-07,
-    (float)1.29038e-06,
-    (float)3.40165e-06,
-    (float)2.82079e-07,
-    (float)1.12396e-06,
-    (float)1.22123e-06,
-    (float)5.17721e-07,
-    (float)8.67664e-07,
-    (float)6.77432e-07,
-    (float)1.94155e-07,
-    (float)1.22431e-06,
-    (float)2.68005e-07,
-    (float)2.6724e-07,
-    (float)7.45328e-07,
-    (float)1.4823e-06,
-    (float)1.92831e-06,
-    (float)1.17755e-08,
-    (float)4.29043e-06,
-    (float)2.46593e-06,
-    (float)7.58761e-07,
-    (float)4.70294e-06,
-    (float)9.79384e-07,
-    (float)2.44546e-06,
-    (float)1.91939e-06,
-    (float)7.89306e-08,
-    (float)2.77079e-06,
-    (float)2.03951e-07,
-    (float)1.33726e-06,
-    (float)1.41647e-06,
-    (float)3.29758e-07,
-    (float)2.60047e-06,
-    (float)3.42406e-07,
-    (float)7.43026e-08,
-    (float)1.58906e-06,
-    (float)7.74833e-08,
-    (float)1.33887e-07,
-    (float)2.73599e-07,
-    (float)1.83167e-07,
-    (float)4.20013e-07,
-    (float)2.14065e-07,
-    (float)8.02549e-07,
-    (float)1.40279e-07,
-    (float)4.38373e-07,
-    (float)4.97219e-07,
-    (float)1.04038e-07,
-    (float)7.52054e-07,
-    (float)3.90736e-08,
-    (float)1.08339e-06,
-    (float)7.30498e-07,
-    (float)1.31458e-06,
-    (float)2.08247e-06,
-    (float)4.0235e-07,
-    (float)0.766576,
-    (float)0.00294631,
-    (float)0.0555118,
-    (float)0.070148,
-    (float)0.0132612,
-    (float)0.0273933,
-    (float)0.014151,
-    (float)0.0180405,
-    (float)0.00671612,
-    (float)0.000471238,
-    (float)0.0101775,
-    (float)0.000398997,
-    (float)0.00165312,
-    (float)0.0020371,
-    (float)0.000219958,
-    (float)0.00372095,
-    (float)2.40695e-05,
-    (float)0.000784376,
-    (float)0.00232342,
-    (float)0.000379974,
-    (float)0.000883718,
-    (float)0.00060846,
-    (float)0.000221359,
-    (float)0.000492934,
-    (float)0.000135048,
-    (float)7.34262e-06,
-    (float)0.000135561,
-    (float)8.10233e-05,
-    (float)2.46451e-05,
-    (float)2.34726e-05,
-    (float)1.92142e-05,
-    (float)3.187e-05,
-    (float)1.76584e-06,
-    (float)3.38855e-07,
-    (float)3.05969e-05,
-    (float)8.96989e-06,
-    (float)1.83771e-06,
-    (float)4.24879e-05,
-    (float)1.88961e-05,
-    (float)3.34264e-06,
-    (float)2.88445e-05,
-    (float)7.50814e-06,
-    (float)8.31826e-06,
-    (float)5.70161e-06,
-    (float)2.85842e-06,
-    (float)1.13174e-05,
-    (float)6.06039e-06,
-    (float)1.19587e-05,
-    (float)7.62088e-06,
-    (float)1.75985e-05,
-    (float)1.71744e-05,
-    (float)3.87444e-06,
-    (float)1.49726e-05,
-    (float)1.60624e-05,
-    (float)5.10194e-06,
-    (float)4.34161e-06,
-    (float)1.18063e-05,
-    (float)6.29305e-06,
-    (float)5.37078e-07,
-    (float)5.57091e-06,
-    (float)5.12091e-06,
-    (float)4.83695e-06,
-    (float)1.06165e-06,
-    (float)2.9038e-06,
-    (float)9.28319e-06,
-    (float)4.06523e-07,
-    (float)2.00441e-06,
-    (float)7.00213e-06,
-    (float)5.4165e-07,
-    (float)2.24276e-06,
-    (float)2.53831e-06,
-    (float)7.6405e-07,
-    (float)1.50238e-06,
-    (float)8.43938e-07,
-    (float)8.56639e-07,
-    (float)8.98817e-07,
-    (float)6.65859e-07,
-    (float)3.35221e-07,
-    (float)5.92148e-07,
-    (float)1.80189e-06,
-    (float)1.47278e-06,
-    (float)1.18899e-07,
-    (float)4.0527e-06,
-    (float)2.69435e-06,
-    (float)5.76868e-07,
-    (float)4.10012e-06,
-    (float)1.51937e-06,
-    (float)1.91264e-06,
-    (float)1.58902e-06,
-    (float)9.90454e-07,
-    (float)2.56624e-06,
-    (float)5.05843e-07,
-    (float)2.43784e-06,
-    (float)1.87766e-06,
-    (float)6.11725e-07,
-    (float)2.24392e-06,
-    (float)1.06788e-06,
-    (float)5.2437e-07,
-    (float)3.87934e-07,
-    (float)5.42751e-07,
-    (float)1.23492e-06,
-    (float)1.23665e-07,
-    (float)6.93668e-07,
-    (float)1.2044e-06,
-    (float)3.07362e-07,
-    (float)9.50013e-07,
-    (float)1.44562e-07,
-    (float)4.33253e-07,
-    (float)1.60376e-07,
-    (float)3.90744e-07,
-    (float)1.58221e-06,
-    (float)4.06621e-07,
-    (float)1.40895e-06,
-    (float)1.21412e-06,
-    (float)1.68503e-06,
-    (float)1.18749e-06,
-    (float)3.43748e-08,
-    (float)1.35646e-06,
-    (float)2.58674e-07,
-    (float)1.01753e-06,
-    (float)4.25826e-07,
-    (float)2.62746e-07,
-    (float)1.99282e-06,
-    (float)2.36234e-07,
-    (float)5.01759e-07,
-    (float)1.10316e-06,
-    (float)2.86092e-07,
-    (float)3.84983e-07,
-    (float)0.799188,
-    (float)0.00227229,
-    (float)0.0514178,
-    (float)0.0689775,
-    (float)0.0119512,
-    (float)0.0226115,
-    (float)0.010895,
-    (float)0.0131923,
-    (float)0.0039335,
-    (float)8.90495e-05,
-    (float)0.00573023,
-    (float)2.76064e-05,
-    (float)0.00230306,
-    (float)0.000661469,
-    (float)0.000569088,
-    (float)0.00302128,
-    (float)4.33293e-05,
-    (float)0.000599536,
-    (float)0.00124787,
-    (float)0.000174173,
-    (float)0.000258382,
-    (float)0.000264885,
-    (float)3.61641e-05,
-    (float)6.25622e-05,
-    (float)0.000118605,
-    (float)7.35019e-06,
-    (float)1.2516e-05,
-    (float)3.11188e-05,
-    (float)1.31261e-05,
-    (float)1.04614e-05,
-    (float)4.15414e-06,
-    (float)1.45887e-05,
-    (float)1.94868e-05,
-    (float)1.42721e-05,
-    (float)2.85705e-05,
-    (float)1.23588e-05,
-    (float)3.06844e-06,
-    (float)2.05613e-05,
-    (float)5.24014e-07,
-    (float)3.48147e-06,
-    (float)3.78094e-06,
-    (float)1.10739e-05,
-    (float)1.33467e-05,
-    (float)1.273e-06,
-    (float)1.709e-05,
-    (float)1.17635e-05,
-    (float)6.27868e-06,
-    (float)8.6206e-06,
-    (float)8.77986e-06,
-    (float)6.37857e-06,
-    (float)1.95944e-06,
-    (float)8.03922e-06,
-    (float)2.98533e-06,
-    (float)1.73157e-06,
-    (float)4.95768e-06,
-    (float)1.37857e-06,
-    (float)3.54381e-06,
-    (float)2.20766e-06,
-    (float)2.22889e-06,
-    (float)3.20201e-06,
-    (float)4.63335e-07,
-    (float)2.69621e-06,
-    (float)1.19152e-06,
-    (float)3.12345e-07,
-    (float)1.46707e-06,
-    (float)1.29523e-07,
-    (float)1.01934e-06,
-    (float)4.25612e-07,
-    (float)1.83688e-07,
-    (float)9.6361e-07,
-    (float)1.3224e-07,
-    (float)1.18379e-06,
-    (float)1.24923e-06,
-    (float)4.11441e-07,
-    (float)2.38323e-06,
-    (float)9.80735e-07,
-    (float)1.4809e-06,
-    (float)1.46504e-06,
-    (float)4.99997e-07,
-    (float)2.24504e-06,
-    (float)1.38897e-07,
-    (float)1.51188e-06,
-    (float)1.34661e-06,
-    (float)2.64357e-07,
-    (float)1.81854e-06,
-    (float)2.7307e-07,
-    (float)2.07829e-07,
-    (float)4.83833e-07,
-    (float)6.2049e-08,
-    (float)2.35149e-07,
-    (float)5.41877e-08,
-    (float)3.53711e-08,
-    (float)4.77126e-07,
-    (float)2.18761e-07,
-    (float)2.24965e-07,
-    (float)7.06687e-08,
-    (float)2.4899e-07,
-    (float)1.97638e-07,
-    (float)1.86517e-07,
-    (float)8.43567e-07,
-    (float)9.65096e-08,
-    (float)6.63433e-07,
-    (float)4.72254e-07,
-    (float)5.30803e-07,
-    (float)3.45005e-07,
-    (float)3.39487e-08,
-    (float)6.44453e-07,
-    (float)2.65336e-08,
-    (float)8.18939e-07,
-    (float)1.97582e-07,
-    (float)1.96147e-07,
-    (float)7.91066e-07,
-    (float)4.12624e-10,
-    (float)5.08409e-08,
-    (float)1.04827e-07,
-    (float)5.3448e-08,
-    (float)1.6719e-07,
-    (float)3.94256e-08,
-    (float)1.43646e-08,
-    (float)3.85181e-07,
-    (float)2.26731e-08,
-    (float)1.93857e-07,
-    (float)2.73901e-08,
-    (float)1.8311e-07,
-    (float)2.3821e-07,
-    (float)2.77971e-07,
-    (float)6.21695e-07,
-    (float)9.2937e-08,
-    (float)0.826075,
-    (float)0.00172304,
-    (float)0.047213,
-    (float)0.066777,
-    (float)0.0106207,
-    (float)0.0178949,
-    (float)0.00796075,
-    (float)0.00942721,
-    (float)0.00188511,
-    (float)0.000217393,
-    (float)0.00322466,
-    (float)0.000179507,
-    (float)0.00252335,
-    (float)0.000244123,
-    (float)0.000687975,
-    (float)0.00197393,
-    (float)3.33268e-05,
-    (float)0.000265439,
-    (float)0.000495241,
-    (float)7.25045e-05,
-    (float)3.5488e-05,
-    (float)0.000124155,
-    (float)2.24866e-05,
-    (float)2.14952e-05,
-    (float)4.10565e-05,
-    (float)2.88888e-06,
-    (float)2.06761e-05,
-    (float)2.48015e-06,
-    (float)1.9736e-06,
-    (float)3.20108e-05,
-    (float)2.08727e-05,
-    (float)9.87831e-06,
-    (float)1.43147e-05,
-    (float)4.96265e-06,
-    (float)1.31558e-05,
-    (float)3.00445e-07,
-    (float)3.83564e-06,
-    (float)7.93573e-06,
-    (float)1.33472e-05,
-    (float)1.32978e-05,
-    (float)1.46369e-06,
-    (float)1.35746e-05,
-    (float)9.61197e-06,
-    (float)5.90342e-06,
-    (float)3.66956e-06,
-    (float)4.8754e-06,
-    (float)9.6888e-06,
-    (float)4.5611e-07,
-    (float)1.65461e-06,
-    (float)6.95163e-06,
-    (float)2.37847e-06,
-    (float)4.38557e-08,
-    (float)2.60907e-06,
-    (float)4.28085e-06,
-    (float)4.87978e-07,
-    (float)1.57469e-07,
-    (float)2.2742e-06,
-    (float)4.28683e-07,
-    (float)9.61353e-07,
-    (float)3.06042e-07,
-    (float)9.49189e-08,
-    (float)1.395e-06,
-    (float)3.07429e-07,
-    (float)2.15764e-07,
-    (float)7.3412e-07,
-    (float)9.39048e-07,
-    (float)9.86502e-07,
-    (float)3.26069e-07,
-    (float)1.66792e-06,
-    (float)9.32718e-07,
-    (float)1.21346e-06,
-    (float)1.76615e-06,
-    (float)1.20022e-07,
-    (float)3.05172e-06,
-    (float)8.77658e-07,
-    (float)1.96073e-08,
-    (float)2.34644e-06,
-    (float)1.09187e-07,
-    (float)1.31845e-08,
-    (float)2.60241e-07,
-    (float)4.4056e-09,
-    (float)2.32758e-07,
-    (float)1.43715e-07,
-    (float)2.75029e-08,
-    (float)1.9269e-07,
-    (float)3.23664e-07,
-    (float)1.4764e-07,
-    (float)1.2347e-08,
-    (float)5.57227e-07,
-    (float)6.4897e-08,
-    (float)3.02848e-07,
-    (float)4.82371e-07,
-    (float)2.42905e-07,
-    (float)2.84428e-07,
-    (float)9.30314e-09,
-    (float)6.80947e-07,
-    (float)1.28121e-08,
-    (float)7.85245e-07,
-    (float)4.41785e-07,
-    (float)1.79444e-07,
-    (float)9.89776e-07,
-    (float)9.00079e-08,
-    (float)2.96521e-07,
-    (float)2.60668e-07,
-    (float)1.78037e-07,
-    (float)6.15996e-08,
-    (float)1.22539e-08,
-    (float)2.82485e-08,
-    (float)2.16967e-08,
-    (float)2.64584e-08,
-    (float)1.63811e-07,
-    (float)2.87856e-08,
-    (float)2.25531e-07,
-    (float)3.26079e-07,
-    (float)6.03234e-08,
-    (float)3.14074e-07,
-    (float)2.02407e-08,
-    (float)1.00086e-07,
-    (float)9.41049e-08,
-    (float)1.56511e-07,
-    (float)2.23163e-08,
-    (float)2.24528e-07,
-    (float)1.57156e-07,
-    (float)1.81517e-07,
-    (float)3.35133e-07,
-    (float)8.04015e-08,
-    (float)3.07849e-07,
-    (float)1.85809e-07,
-    (float)0.848887,
-    (float)0.00128207,
-    (float)0.0429322,
-    (float)0.0637557,
-    (float)0.00929262,
-    (float)0.0135414,
-    (float)0.00548028,
-    (float)0.00664969,
-    (float)0.000662462,
-    (float)0.000590361,
-    (float)0.00193281,
-    (float)0.000473262,
-    (float)0.00222293,
-    (float)0.000118796,
-    (float)0.000526117,
-    (float)0.000985594,
-    (float)4.40936e-05,
-    (float)5.60095e-05,
-    (float)0.000152156,
-    (float)8.47246e-05,
-    (float)2.17127e-05,
-    (float)4.67172e-05,
-    (float)1.60416e-05,
-    (float)2.11179e-05,
-    (float)4.25992e-07,
-    (float)3.81795e-06,
-    (float)3.77945e-05,
-    (float)1.64501e-05,
-    (float)1.72643e-06,
-    (float)2.37103e-05,
-    (float)5.41151e-06,
-    (float)8.44478e-06,
-    (float)4.44469e-07,
-    (float)5.07362e-06,
-    (float)1.42756e-05,
-    (float)6.87362e-06,
-    (float)1.18157e-05,
-    (float)5.79438e-06,
-    (float)8.71442e-06,
-    (float)4.76159e-06,
-    (float)9.34383e-06,
-    (float)3.91618e-06,
-    (float)9.40629e-07,
-    (float)1.0206e-05,
-    (float)2.15783e-06,
-    (float)1.59932e-06,
-    (float)4.2948e-06,
-    (float)1.84859e-06,
-    (float)2.85964e-06,
-    (float)8.21718e-07,
-    (float)1.61803e-06,
-    (float)9.00836e-07,
-    (float)2.39998e-07,
-    (float)1.07047e-06,
-    (float)1.65075e-07,
-    (float)1.27155e-06,
-    (float)3.40741e-07,
-    (float)8.95886e-07,
-    (float)9.00815e-07,
-    (float)7.87635e-08,
-    (float)1.30637e-06,
-    (float)7.22447e-07,
-    (float)9.00206e-07,
-    (float)9.04741e-07,
-    (float)6.21013e-07,
-    (float)3.0413e-06,
-    (float)4.30312e-07,
-    (float)7.09468e-07,
-    (float)3.06944e-06,
-    (float)1.94503e-07,
-    (float)4.95107e-07,
-    (float)7.3122e-07,
-    (float)4.62268e-08,
-    (float)2.88388e-07,
-    (float)1.00047e-08,
-    (float)1.03773e-07,
-    (float)1.97162e-07,
-    (float)2.66507e-07,
-    (float)3.77571e-08,
-    (float)3.38099e-08,
-    (float)6.33269e-07,
-    (float)2.61229e-08,
-    (float)1.37877e-07,
-    (float)2.60239e-07,
-    (float)2.54073e-07,
-    (float)5.63026e-08,
-    (float)2.69086e-07,
-    (float)5.11025e-07,
-    (float)9.17163e-09,
-    (float)1.42091e-06,
-    (float)2.503e-07,
-    (float)1.00063e-07,
-    (float)9.82247e-07,
-    (float)1.40819e-07,
-    (float)2.57558e-07,
-    (float)1.43694e-07,
-    (float)2.23909e-07,
-    (float)1.36551e-07,
-    (float)2.86732e-08,
-    (float)6.28475e-09,
-    (float)8.24483e-09,
-    (float)1.34352e-07,
-    (float)1.1516e-07,
-    (float)7.71749e-08,
-    (float)1.71125e-07,
-    (float)6.69933e-09,
-    (float)6.75601e-08,
-    (float)9.69264e-09,
-    (float)2.62966e-07,
-    (float)6.45269e-08,
-    (float)1.79848e-07,
-    (float)4.22779e-07,
-    (float)1.66293e-09,
-    (float)3.86367e-07,
-    (float)1.92026e-07,
-    (float)1.53005e-07,
-    (float)2.30344e-07,
-    (float)2.80448e-07,
-    (float)1.2255e-07,
-    (float)1.20752e-07,
-    (float)9.64665e-08,
-    (float)2.02418e-08,
-    (float)1.94046e-07,
-    (float)2.65216e-08,
-    (float)1.00821e-07,
-    (float)8.20248e-08,
-    (float)3.43464e-08,
-    (float)1.78697e-08,
-    (float)0.868838,
-    (float)0.000948286,
-    (float)0.0385466,
-    (float)0.0601039,
-    (float)0.0079439,
-    (float)0.00973303,
-    (float)0.00350202,
-    (float)0.00466667,
-    (float)0.000124769,
-    (float)0.000964648,
-    (float)0.0012711,
-    (float)0.000632623,
-    (float)0.00159365,
-    (float)5.99577e-05,
-    (float)0.000269828,
-    (float)0.000350792,
-    (float)0.000102492,
-    (float)7.1616e-06,
-    (float)4.20032e-05,
-    (float)7.47971e-05,
-    (float)1.93328e-05,
-    (float)5.26395e-06,
-    (float)8.04404e-06,
-    (float)2.07003e-05,
-    (float)1.56003e-05,
-    (float)8.88438e-06,
-    (float)2.88992e-05,
-    (float)6.76438e-06,
-    (float)1.96059e-06,
-    (float)4.06393e-06,
-    (float)5.06931e-06,
-    (float)1.59754e-05,
-    (float)8.73185e-07,
-    (float)1.15903e-05,
-    (float)7.57435e-06,
-    (float)4.99655e-06,
-    (float)2.67698e-06,
-    (float)7.01625e-06,
-    (float)7.0911e-06,
-    (float)2.91968e-07,
-    (float)4.36817e-06,
-    (float)5.79075e-06,
-    (float)2.58033e-06,
-    (float)2.31191e-07,
-    (float)2.54875e-06,
-    (float)3.24762e-06,
-    (float)2.563e-07,
-    (float)1.77568e-07,
-    (float)5.36589e-07,
-    (float)2.40666e-07,
-    (float)1.91503e-06,
-    (float)3.30471e-07,
-    (float)2.19045e-07,
-    (float)1.19747e-06,
-    (float)6.62184e-07,
-    (float)3.85979e-07,
-    (float)3.08187e-07,
-    (float)7.40423e-07,
-    (float)2.94815e-07,
-    (float)1.58415e-06,
-    (float)1.29543e-06,
-    (float)3.23552e-09,
-    (float)2.52794e-06,
-    (float)9.88799e-07,
-    (float)1.84704e-08,
-    (float)7.08462e-07,
-    (float)1.58329e-07,
-    (float)1.86126e-07,
-    (float)1.49767e-07,
-    (float)3.69294e-08,
-    (float)2.00923e-07,
-    (float)3.21313e-07,
-    (float)2.70525e-07,
-    (float)5.57669e-08,
-    (float)1.99992e-07,
-    (float)3.79067e-07,
-    (float)1.3958e-07,
-    (float)6.47441e-08,
-    (float)4.4299e-08,
-    (float)2.88863e-08,
-    (float)5.79967e-08,
-    (float)8.95757e-07,
-    (float)3.55191e-08,
-    (float)2.31182e-07,
-    (float)6.47733e-07,
-    (float)7.77692e-08,
-    (float)2.29551e-07,
-    (float)6.71444e-08,
-    (float)2.93471e-07,
-    (float)1.80336e-07,
-    (float)5.01676e-09,
-    (float)1.86938e-08,
-    (float)4.57185e-08,
-    (float)2.20896e-07,
-    (float)1.26413e-07,
-    (float)6.95213e-08,
-    (float)1.87916e-07,
-    (float)4.81928e-08,
-    (float)1.54702e-08,
-    (float)1.18608e-08,
-    (float)2.29014e-07,
-    (float)1.7369e-07,
-    (float)1.9918e-07,
-    (float)1.40477e-07,
-    (float)2.80156e-08,
-    (float)7.93231e-08,
-    (float)1.10582e-07,
-    (float)7.4419e-08,
-    (float)5.03236e-09,
-    (float)1.72393e-07,
-    (float)3.99415e-08,
-    (float)5.22761e-08,
-    (float)7.47613e-09,
-    (float)4.84556e-08,
-    (float)1.01758e-07,
-    (float)3.46736e-08,
-    (float)4.56395e-09,
-    (float)1.47048e-08,
-    (float)9.49587e-09,
-    (float)1.93963e-07,
-    (float)9.62088e-08,
-    (float)7.8482e-08,
-    (float)1.80276e-07,
-    (float)3.76264e-08,
-    (float)2.99103e-09,
-    (float)3.61612e-08,
-    (float)1.22792e-07,
-    (float)2.53371e-08,
-    (float)0.886267,
-    (float)0.000708335,
-    (float)0.0342414,
-    (float)0.0559367,
-    (float)0.00663189,
-    (float)0.00660855,
-    (float)0.0020334,
-    (float)0.00338193,
-    (float)3.30715e-05,
-    (float)0.00118232,
-    (float)0.000885284,
-    (float)0.000578169,
-    (float)0.000915789,
-    (float)4.33944e-05,
-    (float)9.03248e-05,
-    (float)8.07156e-05,
-    (float)0.000153172,
-    (float)1.15496e-05,
-    (float)7.78461e-06,
-    (float)3.26789e-05,
-    (float)5.38817e-06,
-    (float)1.90753e-05,
-    (float)1.55897e-05,
-    (float)2.06928e-05,
-    (float)1.39205e-05,
-    (float)1.63427e-06,
-    (float)1.23599e-05,
-    (float)2.73007e-06,
-    (float)1.18774e-05,
-    (float)9.77625e-07,
-    (float)1.08232e-05,
-    (float)8.40701e-06,
-    (float)2.75717e-06,
-    (float)2.91619e-06,
-    (float)3.73052e-06,
-    (float)1.00071e-05,
-    (float)3.61231e-07,
-    (float)1.19905e-06,
-    (float)7.76193e-06,
-    (float)1.54233e-06,
-    (float)5.22002e-07,
-    (float)2.26268e-06,
-    (float)1.71886e-06,
-    (float)5.57394e-07,
-    (float)3.1003e-07,
-    (float)3.51244e-07,
-    (float)1.48631e-07,
-    (float)2.40251e-06,
-    (float)1.35829e-08,
-    (float)4.39354e-07,
-    (float)6.563e-07,
-    (float)1.72132e-07,
-    (float)3.10473e-07,
-    (float)4.13501e-07,
-    (float)1.35008e-06,
-    (float)1.33284e-07,
-    (float)9.77917e-07,
-    (float)2.47793e-06,
-    (float)1.24767e-07,
-    (float)4.44515e-07,
-    (float)8.6669e-07,
-    (float)6.53339e-08,
-    (float)2.38132e-07,
-    (float)1.10708e-08,
-    (float)5.17243e-08,
-    (float)2.50023e-07,
-    (float)3.65739e-07,
-    (float)3.56509e-08,
-    (float)3.01929e-08,
-    (float)4.0075e-07,
-    (float)3.40226e-08,
-    (float)8.37481e-09,
-    (float)2.51525e-10,
-    (float)1.30016e-07,
-    (float)6.42664e-08,
-    (float)5.92369e-07,
-    (float)2.91052e-07,
-    (float)4.47023e-08,
-    (float)5.85686e-07,
-    (float)1.64866e-07,
-    (float)1.92619e-07,
-    (float)1.26396e-07,
-    (float)1.07636e-07,
-    (float)1.04971e-07,
-    (float)5.54108e-08,
-    (float)3.86651e-08,
-    (float)1.80745e-08,
-    (float)6.04671e-08,
-    (float)1.846e-07,
-    (float)1.83576e-08,
-    (float)1.23246e-08,
-    (float)2.43793e-09,
-    (float)7.16266e-08,
-    (float)1.49146e-07,
-    (float)1.67852e-07,
-    (float)1.14436e-08,
-    (float)6.53695e-08,
-    (float)8.92095e-08,
-    (float)1.36065e-07,
-    (float)7.36508e-08,
-    (float)2.27609e-08,
-    (float)1.67375e-07,
-    (float)4.7481e-08,
-    (float)3.62712e-08,
-    (float)3.23833e-10,
-    (float)3.58772e-08,
-    (float)5.9253e-08,
-    (float)2.69626e-08,
-    (float)3.13176e-09,
-    (float)1.709e-08,
-    (float)1.69152e-09,
-    (float)1.44336e-07,
-    (float)5.3738e-08,
-    (float)8.7363e-09,
-    (float)5.5407e-08,
-    (float)2.24241e-09,
-    (float)2.82786e-08,
-    (float)3.76065e-08,
-    (float)1.10655e-08,
-    (float)6.51654e-08,
-    (float)4.09622e-08,
-    (float)3.49511e-08,
-    (float)3.39278e-08,
-    (float)2.27796e-08,
-    (float)9.85818e-08,
-    (float)2.63648e-08,
-    (float)5.25665e-09,
-    (float)4.27855e-09,
-    (float)0.901654,
-    (float)0.000547764,
-    (float)0.0300562,
-    (float)0.051317,
-    (float)0.00542981,
-    (float)0.00420207,
-    (float)0.00103146,
-    (float)0.00259511,
-    (float)0.000133828,
-    (float)0.00121365,
-    (float)0.000586725,
-    (float)0.000398452,
-    (float)0.000413861,
-    (float)8.47564e-05,
-    (float)2.4364e-05,
-    (float)1.02464e-05,
-    (float)0.000134181,
-    (float)5.22326e-06,
-    (float)8.23763e-06,
-    (float)7.7199e-06,
-    (float)4.74485e-06,
-    (float)3.28404e-05,
-    (float)1.35588e-05,
-    (float)1.38504e-05,
-    (float)6.84264e-07,
-    (float)2.60653e-06,
-    (float)8.86739e-06,
-    (float)9.97158e-06,
-    (float)9.78296e-06,
-    (float)1.12694e-06,
-    (float)3.87603e-06,
-    (float)2.24329e-06,
-    (float)1.0345e-05,
-    (float)1.32324e-06,
-    (float)3.80848e-07,
-    (float)7.03856e-06,
-    (float)1.98588e-06,
-    (float)1.79864e-06,
-    (float)1.56319e-06,
-    (float)9.43304e-07,
-    (float)7.85183e-07,
-    (float)2.45618e-07,
-    (float)7.48238e-07,
-    (float)3.73077e-07,
-    (float)1.1915e-06,
-    (float)5.6133e-07,
-    (float)6.7566e-07,
-    (float)9.28277e-08,
-    (float)4.14935e-07,
-    (float)3.61895e-07,
-    (float)1.62113e-07,
-    (float)2.13266e-06,
-    (float)5.91043e-07,
-    (float)8.28837e-08,
-    (float)2.00161e-06,
-    (float)3.92177e-07,
-    (float)9.94916e-08,
-    (float)1.86321e-07,
-    (float)1.07976e-07,
-    (float)2.47579e-07,
-    (float)1.82142e-07,
-    (float)7.22886e-08,
-    (float)4.99167e-08,
-    (float)1.32711e-07,
-    (float)2.94939e-07,
-    (float)5.642e-08,
-    (float)2.57779e-08,
-    (float)5.85782e-08,
-    (float)6.46898e-09,
-    (float)4.85841e-08,
-    (float)7.89509e-07,
-    (float)6.97518e-09,
-    (float)1.81351e-07,
-    (float)3.94907e-07,
-    (float)2.06964e-07,
-    (float)2.28529e-07,
-    (float)4.21149e-08,
-    (float)1.03923e-07,
-    (float)3.28819e-08,
-    (float)8.22691e-08,
-    (float)2.60303e-08,
-    (float)2.97596e-08,
-    (float)5.90777e-08,
-    (float)2.18486e-08,
-    (float)1.19697e-08,
-    (float)4.13223e-08,
-    (float)1.24143e-07,
-    (float)3.94665e-08,
-    (float)6.43415e-08,
-    (float)1.14746e-07,
-    (float)6.40276e-08,
-    (float)4.91871e-08,
-    (float)9.094e-08,
-    (float)1.19401e-07,
-    (float)2.52652e-08,
-    (float)9.53279e-08,
-    (float)1.43421e-08,
-    (float)4.83206e-08,
-    (float)2.40413e-08,
-    (float)6.57112e-09,
-    (float)1.57632e-08,
-    (float)2.06738e-09,
-    (float)3.35886e-08,
-    (float)5.27692e-08,
-    (float)2.25788e-08,
-    (float)1.35787e-08,
-    (float)6.49733e-09,
-    (float)1.28214e-08,
-    (float)2.87238e-08,
-    (float)2.61293e-08,
-    (float)1.15001e-08,
-    (float)6.75625e-08,
-    (float)2.14621e-08,
-    (float)2.94961e-08,
-    (float)1.02795e-08,
-    (float)4.18113e-08,
-    (float)6.83047e-08,
-    (float)6.04728e-09,
-    (float)2.54611e-08,
-    (float)9.69637e-09,
-    (float)1.9947e-08,
-    (float)4.02823e-09,
-    (float)2.31448e-08,
-    (float)2.09393e-08,
-    (float)3.07904e-09,
-    (float)1.54748e-08,
-    (float)2.31236e-09,
-    (float)2.62093e-09,
-    (float)0.915338,
-    (float)0.000446753,
-    (float)0.0260551,
-    (float)0.0464105,
-    (float)0.00436089,
-    (float)0.00249215,
-    (float)0.000446167,
-    (float)0.00208535,
-    (float)0.000246945,
-    (float)0.00106797,
-    (float)0.000323171,
-    (float)0.000219533,
-    (float)0.000130116,
-    (float)0.000148041,
-    (float)1.4279e-05,
-    (float)9.7921e-08,
-    (float)6.77298e-05,
-    (float)3.21148e-07,
-    (float)3.10961e-05,
-    (float)1.05733e-05,
-    (float)5.33694e-06,
-    (float)1.75895e-05,
-    (float)3.08039e-06,
-    (float)1.59302e-05,
-    (float)4.16864e-06,
-    (float)6.64049e-06,
-    (float)4.4806e-06,
-    (float)5.19659e-06,
-    (float)2.24644e-06,
-    (float)7.78498e-06,
-    (float)2.50566e-06,
-    (float)3.3317e-07,
-    (float)6.20236e-06,
-    (float)4.23874e-06,
-    (float)1.67751e-06,
-    (float)5.61981e-07,
-    (float)1.54763e-06,
-    (float)1.25872e-06,
-    (float)1.37286e-07,
-    (float)1.22342e-06,
-    (float)1.71845e-07,
-    (float)3.96696e-07,
-    (float)1.61285e-06,
-    (float)2.93099e-07,
-    (float)1.31911e-08,
-    (float)3.24389e-07,
-    (float)4.28476e-07,
-    (float)3.28397e-08,
-    (float)1.70664e-06,
-    (float)1.34285e-06,
-    (float)5.35646e-08,
-    (float)9.83239e-07,
-    (float)6.40713e-07,
-    (float)1.37401e-07,
-    (float)2.59862e-07,
-    (float)1.0418e-08,
-    (float)5.15021e-08,
-    (float)1.78852e-07,
-    (float)3.32727e-07,
-    (float)5.79908e-08,
-    (float)1.78763e-08,
-    (float)1.87834e-07,
-    (float)1.79899e-08,
-    (float)3.63255e-08,
-    (float)2.11691e-07,
-    (float)1.72577e-07,
-    (float)4.57486e-08,
-    (float)5.55516e-07,
-    (float)2.22528e-07,
-    (float)1.81533e-07,
-    (float)1.90485e-07,
-    (float)1.35738e-07,
-    (float)1.08636e-07,
-    (float)6.4086e-08,
-    (float)1.12204e-07,
-    (float)1.4006e-08,
-    (float)3.969e-08,
-    (float)7.99346e-08,
-    (float)5.67258e-08,
-    (float)3.39137e-08,
-    (float)2.71331e-08,
-    (float)8.53336e-08,
-    (float)5.72136e-08,
-    (float)5.27395e-08,
-    (float)4.97286e-08,
-    (float)7.16704e-08,
-    (float)3.82482e-08,
-    (float)1.62768e-07,
-    (float)3.92179e-08,
-    (float)9.16464e-08,
-    (float)3.06331e-08,
-    (float)5.48917e-09,
-    (float)5.00806e-08,
-    (float)3.26805e-09,
-    (float)4.44998e-08,
-    (float)5.06984e-08,
-    (float)3.17045e-08,
-    (float)6.81469e-08,
-    (float)2.64214e-08,
-    (float)1.59431e-09,
-    (float)1.86905e-08,
-    (float)1.54694e-08,
-    (float)2.33022e-09,
-    (float)6.24592e-08,
-    (float)3.78267e-08,
-    (float)3.04558e-08,
-    (float)1.38286e-08,
-    (float)4.69099e-08,
-    (float)4.9922e-08,
-    (float)4.28279e-09,
-    (float)3.62021e-08,
-    (float)4.47455e-09,
-    (float)8.53569e-09,
-    (float)3.30417e-08,
-    (float)2.97187e-09,
-    (float)1.30697e-08,
-    (float)1.16881e-08,
-    (float)4.2164e-09,
-    (float)2.50979e-09,
-    (float)3.0331e-09,
-    (float)1.14252e-08,
-    (float)1.77236e-08,
-    (float)6.16733e-10,
-    (float)2.32248e-08,
-    (float)1.7667e-08,
-    (float)2.7879e-08,
-    (float)3.2931e-08,
-    (float)1.66413e-09,
-    (float)0.927587,
-    (float)0.000391511,
-    (float)0.0222586,
-    (float)0.0413074,
-    (float)0.00347082,
-    (float)0.00136817,
-    (float)0.000190382,
-    (float)0.00170889,
-    (float)0.000285884,
-    (float)0.000825675,
-    (float)0.000137384,
-    (float)0.000112112,
-    (float)2.00475e-05,
-    (float)0.000176419,
-    (float)8.58022e-06,
-    (float)2.94913e-06,
-    (float)1.22922e-05,
-    (float)7.63051e-06,
-    (float)4.16077e-05,
-    (float)1.46879e-05,
-    (float)4.199e-06,
-    (float)1.77174e-06,
-    (float)2.83395e-07,
-    (float)1.86462e-05,
-    (float)5.93903e-06,
-    (float)3.57164e-06,
-    (float)3.23406e-06,
-    (float)2.90631e-06,
-    (float)2.8336e-07,
-    (float)7.53314e-06,
-    (float)5.17157e-06,
-    (float)5.81877e-07,
-    (float)8.25898e-08,
-    (float)4.28807e-06,
-    (float)1.33161e-06,
-    (float)1.92666e-07,
-    (float)5.92162e-07,
-    (float)1.20692e-08,
-    (float)1.68669e-07,
-    (float)2.38702e-06,
-    (float)1.22051e-07,
-    (float)5.97455e-08,
-    (float)1.59092e-07,
-    (float)5.07881e-07,
-    (float)2.25309e-08,
-    (float)8.05674e-07,
-    (float)2.00784e-06,
-    (float)2.15099e-07,
-    (float)3.03021e-07,
-    (float)5.4685e-07,
-    (float)2.45146e-07,
-    (float)2.74893e-07,
-    (float)9.87944e-08,
-    (float)2.55125e-08,
-    (float)6.26394e-08,
-    (float)2.16214e-07,
-    (float)3.41796e-07,
-    (float)9.62558e-09,
-    (float)1.75859e-08,
-    (float)1.01336e-07,
-    (float)5.42231e-08,
-    (float)8.61149e-08,
-    (float)5.58162e-07,
-    (float)5.50848e-08,
-    (float)2.39294e-07,
-    (float)9.76396e-08,
-    (float)3.05564e-07,
-    (float)7.77702e-08,
-    (float)6.43311e-08,
-    (float)8.9381e-10,
-    (float)4.21763e-08,
-    (float)1.41522e-07,
-    (float)7.39885e-08,
-    (float)3.31201e-08,
-    (float)2.79239e-08,
-    (float)7.66225e-08,
-    (float)9.17018e-08,
-    (float)4.05034e-08,
-    (float)3.26524e-08,
-    (float)8.2093e-08,
-    (float)3.29559e-08,
-    (float)4.39602e-08,
-    (float)1.06029e-07,
-    (float)3.03562e-08,
-    (float)6.3669e-08,
-    (float)4.3935e-09,
-    (float)1.87651e-08,
-    (float)4.88808e-09,
-    (float)8.36656e-09,
-    (float)9.65191e-08,
-    (float)9.9879e-09,
-    (float)2.26697e-08,
-    (float)5.01935e-08,
-    (float)2.13162e-08,
-    (float)1.7505e-08,
-    (float)4.77533e-08,
-    (float)2.80864e-08,
-    (float)3.02393e-10,
-    (float)4.67377e-08,
-    (float)4.31942e-08,
-    (float)3.78019e-08,
-    (float)8.0952e-09,
-    (float)1.17178e-08,
-    (float)4.11035e-09,
-    (float)1.36093e-08,
-    (float)1.63346e-08,
-    (float)4.34427e-09,
-    (float)3.06151e-09,
-    (float)1.4007e-09,
-    (float)2.15772e-08,
-    (float)7.59529e-09,
-    (float)8.745e-09,
-    (float)1.61323e-08,
-    (float)5.99121e-09,
-    (float)9.85667e-09,
-    (float)2.36384e-08,
-    (float)1.2994e-08,
-    (float)1.10226e-09,
-    (float)4.17528e-09,
-    (float)1.5376e-08,
-    (float)1.41302e-08,
-    (float)1.69921e-08,
-    (float)5.89726e-09,
-    (float)9.32323e-10,
-    (float)1.1671e-09,
-    (float)1.50592e-08,
-    (float)1.71038e-09,
-    (float)7.8816e-09,
-    (float)0.938534,
-    (float)0.0003654,
-    (float)0.0187544,
-    (float)0.0361225,
-    (float)0.00276668,
-    (float)0.000711216,
-    (float)0.00017256,
-    (float)0.00136732,
-    (float)0.000246265,
-    (float)0.000554162,
-    (float)5.39205e-05,
-    (float)7.59871e-05,
-    (float)3.77196e-07,
-    (float)0.00014594,
-    (float)4.55392e-06,
-    (float)1.32046e-05,
-    (float)5.76658e-07,
-    (float)9.5477e-06,
-    (float)2.88042e-05,
-    (float)7.1146e-06,
-    (float)1.49273e-05,
-    (float)9.1626e-07,
-    (float)2.61329e-06,
-    (float)8.55769e-06,
-    (float)2.73094e-06,
-    (float)4.08475e-07,
-    (float)8.05362e-06,
-    (float)4.96434e-06,
-    (float)2.84341e-07,
-    (float)4.75892e-07,
-    (float)6.78549e-06,
-    (float)1.00665e-06,
-    (float)7.62802e-07,
-    (float)7.64233e-08,
-    (float)2.00527e-07,
-    (float)3.14323e-07,
-    (float)2.80126e-06,
-    (float)2.05397e-07,
-    (float)1.08152e-07,
-    (float)7.33731e-08,
-    (float)5.04172e-07,
-    (float)2.11863e-08,
-    (float)3.21804e-07,
-    (float)2.08627e-06,
-    (float)4.47288e-07,
-    (float)1.28771e-07,
-    (float)6.25339e-07,
-    (float)3.19294e-07,
-    (float)2.08511e-07,
-    (float)1.82995e-07,
-    (float)3.72563e-08,
-    (float)1.02584e-08,
-    (float)5.66345e-08,
-    (float)4.68118e-07,
-    (float)1.25314e-08,
-    (float)2.04996e-08,
-    (float)1.49538e-07,
-    (float)1.77918e-08,
-    (float)3.16282e-08,
-    (float)6.30933e-07,
-    (float)2.40277e-07,
-    (float)1.93212e-07,
-    (float)7.01866e-08,
-    (float)1.69563e-07,
-    (float)1.08193e-07,
-    (float)5.6493e-08,
-    (float)1.2473e-07,
-    (float)4.36758e-08,
-    (float)1.4098e-08,
-    (float)1.73198e-08,
-    (float)1.47587e-07,
-    (float)8.14312e-08,
-    (float)4.14376e-08,
-    (float)1.58785e-09,
-    (float)1.04987e-08,
-    (float)1.52829e-08,
-    (float)2.42002e-07,
-    (float)4.48222e-08,
-    (float)8.18339e-08,
-    (float)1.70715e-08,
-    (float)3.34777e-08,
-    (float)6.85707e-08,
-    (float)1.36543e-10,
-    (float)2.79051e-08,
-    (float)4.95806e-08,
-    (float)3.25073e-08,
-    (float)3.52386e-08,
-    (float)4.96484e-08,
-    (float)4.06561e-09,
-    (float)5.28569e-08,
-    (float)1.50886e-08,
-    (float)2.98046e-09,
-    (float)3.09852e-08,
-    (float)8.07805e-08,
-    (float)7.15853e-08,
-    (float)4.33848e-09,
-    (float)1.36563e-08,
-    (float)2.4415e-08,
-    (float)1.68013e-08,
-    (float)3.34291e-08,
-    (float)1.84653e-09,
-    (float)3.93446e-09,
-    (float)2.45668e-09,
-    (float)7.36138e-09,
-    (float)2.49659e-08,
-    (float)1.17111e-08,
-    (float)1.02292e-08,
-    (float)1.99887e-08,
-    (float)1.33344e-09,
-    (float)2.03845e-08,
-    (float)4.47226e-08,
-    (float)4.13306e-08,
-    (float)4.35325e-09,
-    (float)4.52788e-09,
-    (float)3.69693e-08,
-    (float)3.18727e-09,
-    (float)8.06305e-09,
-    (float)9.5311e-09,
-    (float)6.89084e-10,
-    (float)4.9549e-10,
-    (float)2.08992e-08,
-    (float)5.22892e-09,
-    (float)1.00461e-08,
-    (float)2.3065e-09,
-    (float)5.39274e-09,
-    (float)3.76867e-09,
-    (float)2.31995e-08,
-    (float)3.57337e-08,
-    (float)0.94836,
-    (float)0.000358234,
-    (float)0.0155358,
-    (float)0.0309793,
-    (float)0.00223962,
-    (float)0.00038912,
-    (float)0.00029812,
-    (float)0.00101743,
-    (float)0.000166848,
-    (float)0.000314339,
-    (float)6.05276e-05,
-    (float)7.11608e-05,
-    (float)6.85371e-06,
-    (float)7.87731e-05,
-    (float)1.22697e-05,
-    (float)2.42292e-05,
-    (float)1.13826e-05,
-    (float)1.71613e-06,
-    (float)1.1088e-05,
-    (float)1.00175e-06,
-    (float)2.44577e-05,
-    (float)1.50503e-06,
-    (float)1.69096e-06,
-    (float)1.97105e-06,
-    (float)4.79443e-06,
-    (float)4.78714e-08,
-    (float)4.0543e-06,
-    (float)6.24826e-06,
-    (float)1.93851e-06,
-    (float)1.31403e-06,
-    (float)1.83646e-06,
-    (float)7.83306e-08,
-    (float)1.87068e-07,
-    (float)1.73689e-06,
-    (float)7.08803e-07,
-    (float)2.82943e-07,
-    (float)4.4756e-07,
-    (float)6.89605e-07,
-    (float)1.40482e-08,
-    (float)7.5109e-08,
-    (float)1.66408e-06,
-    (float)6.79587e-07,
-    (float)5.66537e-08,
-    (float)7.54319e-07,
-    (float)3.78485e-07,
-    (float)2.09646e-07,
-    (float)2.93413e-07,
-    (float)3.72099e-08,
-    (float)2.32176e-08,
-    (float)2.02958e-08,
-    (float)3.57412e-07,
-    (float)9.73046e-08,
-    (float)2.39735e-08,
-    (float)6.18763e-08,
-    (float)1.3984e-07,
-    (float)6.79263e-08,
-    (float)4.61116e-07,
-    (float)2.7958e-07,
-    (float)2.61379e-07,
-    (float)1.2919e-07,
-    (float)6.26703e-08,
-    (float)4.83791e-08,
-    (float)4.15751e-08,
-    (float)1.89383e-07,
-    (float)4.55817e-08,
-    (float)4.39945e-08,
-    (float)1.31719e-08,
-    (float)1.15085e-07,
-    (float)4.53108e-08,
-    (float)9.68822e-09,
-    (float)1.94854e-08,
-    (float)1.24475e-07,
-    (float)3.41221e-08,
-    (float)1.58399e-07,
-    (float)2.70412e-08,
-    (float)1.10578e-07,
-    (float)2.9974e-08,
-    (float)3.27645e-09,
-    (float)1.68721e-08,
-    (float)4.58819e-09,
-    (float)1.44443e-08,
-    (float)1.14346e-07,
-    (float)1.85823e-08,
-    (float)7.75323e-09,
-    (float)1.51782e-08,
-    (float)3.30257e-08,
-    (float)7.08086e-09,
-    (float)4.82607e-08,
-    (float)5.80268e-08,
-    (float)6.16428e-08,
-    (float)3.04041e-08,
-    (float)1.98029e-08,
-    (float)2.1891e-08,
-    (float)5.76246e-09,
-    (float)7.45963e-09,
-    (float)2.06289e-10,
-    (float)1.24276e-08,
-    (float)3.07053e-09,
-    (float)1.3159e-08,
-    (float)2.90622e-09,
-    (float)1.63537e-09,
-    (float)2.3081e-08,
-    (float)1.65914e-08,
-    (float)7.66845e-09,
-    (float)1.52392e-08,
-    (float)2.54758e-08,
-    (float)4.83476e-08,
-    (float)1.54926e-09,
-    (float)1.76584e-09,
-    (float)8.70899e-09,
-    (float)9.34121e-10,
-    (float)1.05885e-08,
-    (float)6.99446e-09,
-    (float)1.77989e-09,
-    (float)7.54727e-10,
-    (float)9.80119e-09,
-    (float)6.93154e-09,
-    (float)5.01113e-09,
-    (float)8.13104e-09,
-    (float)3.66867e-08,
-    (float)1.53996e-08,
-    (float)1.69522e-09,
-    (float)1.86055e-08,
-    (float)7.79963e-09,
-    (float)1.35539e-09,
-    (float)1.46614e-09,
-    (float)5.28886e-09,
-    (float)9.29581e-11,
-    (float)0.957159,
-    (float)0.000358827,
-    (float)0.012633,
-    (float)0.0259964,
-    (float)0.00186403,
-    (float)0.000280712,
-    (float)0.000478076,
-    (float)0.000668501,
-    (float)9.46476e-05,
-    (float)0.000141221,
-    (float)0.000104442,
-    (float)6.49745e-05,
-    (float)1.03535e-05,
-    (float)2.51337e-05,
-    (float)2.38605e-05,
-    (float)2.73612e-05,
-    (float)1.48724e-05,
-    (float)2.15579e-06,
-    (float)3.26514e-06,
-    (float)1.89502e-06,
-    (float)1.60065e-05,
-    (float)1.16106e-06,
-    (float)2.34288e-07,
-    (float)4.66369e-06,
-    (float)6.34218e-06,
-    (float)9.40548e-07,
-    (float)1.72969e-08,
-    (float)3.94227e-06,
-    (float)2.07126e-06,
-    (float)1.0972e-06,
-    (float)3.33029e-07,
-    (float)1.061e-06,
-    (float)4.51243e-07,
-    (float)9.20297e-07,
-    (float)8.97905e-07,
-    (float)4.65463e-08,
-    (float)5.09135e-08,
-    (float)8.71764e-07,
-    (float)5.87232e-07,
-    (float)1.46772e-07,
-    (float)9.83655e-07,
-    (float)5.71307e-07,
-    (float)3.25957e-07,
-    (float)2.82326e-07,
-    (float)1.75726e-08,
-    (float)8.55126e-09,
-    (float)1.3325e-08,
-    (float)1.69406e-07,
-    (float)3.34716e-07,
-    (float)1.16455e-08,
-    (float)2.11715e-09,
-    (float)2.33964e-07,
-    (float)7.28304e-08,
-    (float)2.21838e-07,
-    (float)1.94012e-07,
-    (float)3.58661e-07,
-    (float)1.22426e-07,
-    (float)4.44366e-08,
-    (float)1.00513e-08,
-    (float)1.26206e-07,
-    (float)9.48553e-08,
-    (float)5.40026e-08,
-    (float)1.13791e-07,
-    (float)5.35323e-08,
-    (float)3.18766e-08,
-    (float)2.43826e-08,
-    (float)7.91151e-09,
-    (float)5.60005e-09,
-    (float)1.97368e-07,
-    (float)1.53329e-08,
-    (float)1.45356e-07,
-    (float)3.94338e-09,
-    (float)4.86279e-08,
-    (float)1.15871e-08,
-    (float)1.05824e-08,
-    (float)4.18552e-08,
-    (float)6.02715e-08,
-    (float)8.31896e-09,
-    (float)4.3885e-08,
-    (float)5.65112e-08,
-    (float)2.72242e-08,
-    (float)2.2034e-08,
-    (float)8.74391e-09,
-    (float)3.06901e-08,
-    (float)1.02724e-08,
-    (float)6.18446e-08,
-    (float)2.57648e-08,
-    (float)3.43744e-08,
-    (float)9.18973e-09,
-    (float)4.08937e-09,
-    (float)4.40439e-09,
-    (float)1.84681e-08,
-    (float)6.62876e-09,
-    (float)2.65088e-08,
-    (float)1.17981e-08,
-    (float)6.2945e-09,
-    (float)1.98702e-08,
-    (float)3.4117e-09,
-    (float)1.87227e-08,
-    (float)8.14775e-09,
-    (float)3.6427e-08,
-    (float)1.38495e-08,
-    (float)3.91864e-09,
-    (float)4.27132e-09,
-    (float)4.41707e-09,
-    (float)2.03298e-09,
-    (float)7.10274e-09,
-    (float)1.11564e-08,
-    (float)8.81566e-09,
-    (float)1.62026e-08,
-    (float)1.80825e-09,
-    (float)3.61975e-09,
-    (float)2.84171e-12,
-    (float)4.28013e-09,
-    (float)1.13166e-08,
-    (float)2.15135e-08,
-    (float)2.00893e-09,
-    (float)1.22866e-08,
-    (float)3.40356e-09,
-    (float)2.02957e-09,
-    (float)2.74417e-09,
-    (float)1.7801e-10,
-    (float)2.03996e-08,
-    (float)7.31849e-09,
-    (float)2.04196e-09,
-    (float)1.88462e-08,
-    (float)6.25558e-09,
-    (float)5.26006e-09,
-    (float)0.96498,
-    (float)0.000357044,
-    (float)0.0100632,
-    (float)0.0212972,
-    (float)0.00160741,
-    (float)0.000283874,
-    (float)0.000636788,
-    (float)0.000365419,
-    (float)5.73591e-05,
-    (float)4.33042e-05,
-    (float)0.000132429,
-    (float)5.2657e-05,
-    (float)6.71842e-06,
-    (float)1.02513e-05,
-    (float)2.35077e-05,
-    (float)2.20953e-05,
-    (float)7.83165e-06,
-    (float)1.45234e-05,
-    (float)1.78827e-06,
-    (float)2.29601e-06,
-    (float)3.0569e-06,
-    (float)4.11419e-06,
-    (float)2.9809e-07,
-    (float)3.48586e-06,
-    (float)4.80459e-06,
-    (float)4.73088e-06,
-    (float)1.55865e-06,
-    (float)4.31175e-07,
-    (float)9.24185e-08,
-    (float)8.02644e-09,
-    (float)1.06734e-06,
-    (float)2.07799e-06,
-    (float)3.1071e-07,
-    (float)4.4072e-07,
-    (float)4.32303e-07,
-    (float)2.33409e-07,
-    (float)1.6333e-07,
-    (float)1.05427e-06,
-    (float)1.20837e-06,
-    (float)2.76258e-07,
-    (float)1.7423e-07,
-    (float)1.31981e-08,
-    (float)1.61548e-07,
-    (float)6.84766e-08,
-    (float)4.75206e-08,
-    (float)6.26391e-07,
-    (float)2.13311e-08,
-    (float)4.47823e-08,
-    (float)1.70953e-07,
-    (float)4.25498e-08,
-    (float)2.27814e-08,
-    (float)3.03629e-07,
-    (float)4.12321e-07,
-    (float)2.0589e-07,
-    (float)4.35744e-08,
-    (float)6.99119e-08,
-    (float)1.56487e-07,
-    (float)4.11778e-08,
-    (float)5.52509e-08,
-    (float)1.30249e-07,
-    (float)1.00735e-07,
-    (float)7.71608e-09,
-    (float)1.30323e-08,
-    (float)1.04895e-08,
-    (float)3.39927e-08,
-    (float)2.17642e-07,
-    (float)2.57756e-08,
-    (float)1.73146e-07,
-    (float)2.24679e-08,
-    (float)8.0017e-09,
-    (float)3.2159e-09,
-    (float)2.91194e-08,
-    (float)1.4185e-08,
-    (float)1.45891e-07,
-    (float)3.52442e-08,
-    (float)7.09908e-08,
-    (float)3.99173e-09,
-    (float)2.02207e-08,
-    (float)1.63491e-08,
-    (float)3.73127e-08,
-    (float)7.82365e-08,
-    (float)3.44597e-08,
-    (float)2.208e-08,
-    (float)1.2153e-08,
-    (float)4.03383e-08,
-    (float)5.63409e-09,
-    (float)7.95308e-09,
-    (float)4.44825e-08,
-    (float)1.95347e-08,
-    (float)2.08445e-08,
-    (float)1.35136e-09,
-    (float)8.11421e-09,
-    (float)4.23266e-09,
-    (float)1.73781e-08,
-    (float)2.24829e-08,
-    (float)6.88667e-08,
-    (float)7.10677e-09,
-    (float)8.5051e-09,
-    (float)1.35195e-08,
-    (float)7.96043e-09,
-    (float)8.05345e-09,
-    (float)1.17495e-08,
-    (float)8.34294e-09,
-    (float)1.84985e-08,
-    (float)1.06838e-08,
-    (float)4.54079e-09,
-    (float)6.12881e-09,
-    (float)2.17134e-09,
-    (float)1.63311e-08,
-    (float)2.70478e-08,
-    (float)7.54255e-09,
-    (float)7.30581e-09,
-    (float)4.66894e-09,
-    (float)1.2479e-08,
-    (float)8.77017e-10,
-    (float)1.30133e-08,
-    (float)4.03366e-09,
-    (float)2.85936e-08,
-    (float)5.13875e-09,
-    (float)8.29946e-09,
-    (float)1.30757e-08,
-    (float)4.58437e-09,
-    (float)1.19028e-08,
-    (float)9.19592e-09,
-    (float)2.89137e-08,
-    (float)8.06643e-09,
-    (float)8.00951e-09,
-    (float)2.03626e-10,
-    (float)0.971937,
-    (float)0.000349647,
-    (float)0.00782675,
-    (float)0.0169352,
-    (float)0.00142492,
-    (float)0.00032642,
-    (float)0.000731019,
-    (float)0.000146377,
-    (float)5.69846e-05,
-    (float)6.25156e-06,
-    (float)0.000118308,
-    (float)4.00048e-05,
-    (float)2.54062e-06,
-    (float)1.99546e-05,
-    (float)1.18483e-05,
-    (float)1.45119e-05,
-    (float)3.10246e-06,
-    (float)2.11593e-05,
-    (float)4.58918e-07,
-    (float)4.5405e-07,
-    (float)5.40476e-07,
-    (float)6.99712e-06,
-    (float)5.23923e-07,
-    (float)3.28836e-07,
-    (float)1.73505e-06,
-    (float)5.81316e-06,
-    (float)8.43021e-07,
-    (float)4.22369e-07,
-    (float)1.42645e-06,
-    (float)2.06483e-07,
-    (float)2.1789e-07,
-    (float)5.45812e-07,
-    (float)4.31594e-07,
-    (float)6.08098e-08,
-    (float)4.1458e-07,
-    (float)1.6347e-06,
-    (float)4.15502e-07,
-    (float)2.75938e-07,
-    (float)7.85213e-08,
-    (float)5.79581e-07,
-    (float)9.36267e-08,
-    (float)5.70746e-08,
-    (float)3.84555e-07,
-    (float)8.40165e-08,
-    (float)4.52373e-09,
-    (float)3.75524e-08,
-    (float)1.82159e-08,
-    (float)6.38405e-08,
-    (float)4.64797e-07,
-    (float)2.77123e-07,
-    (float)2.80237e-07,
-    (float)4.17834e-08,
-    (float)1.03299e-07,
-    (float)9.06357e-08,
-    (float)3.93383e-08,
-    (float)7.05403e-08,
-    (float)6.28717e-08,
-    (float)1.05367e-07,
-    (float)2.91599e-08,
-    (float)2.96556e-08,
-    (float)3.42634e-08,
-    (float)6.49414e-08,
-    (float)1.15356e-07,
-    (float)2.8741e-08,
-    (float)1.15755e-07,
-    (float)7.05108e-08,
-    (float)1.91831e-09,
-    (float)1.13739e-08,
-    (float)2.63702e-08,
-    (float)2.78949e-08,
-    (float)5.78193e-08,
-    (float)8.26821e-08,
-    (float)4.55189e-08,
-    (float)2.70487e-08,
-    (float)8.33077e-10,
-    (float)4.45112e-08,
-    (float)2.01547e-09,
-    (float)6.12715e-08,
-    (float)2.78857e-08,
-    (float)4.9056e-08,
-    (float)1.50595e-08,
-    (float)1.51958e-08,
-    (float)1.93488e-08,
-    (float)2.39872e-08,
-    (float)8.93369e-09,
-    (float)5.06915e-09,
-    (float)2.35824e-08,
-    (float)9.40036e-09,
-    (float)1.48484e-08,
-    (float)3.81587e-09,
-    (float)3.25559e-08,
-    (float)2.34372e-09,
-    (float)4.02874e-08,
-    (float)1.37363e-08,
-    (float)2.53287e-08,
-    (float)5.08801e-09,
-    (float)2.83919e-11,
-    (float)1.16891e-08,
-    (float)5.09906e-10,
-    (float)5.37875e-09,
-    (float)7.26694e-11,
-    (float)1.20436e-08,
-    (float)1.25435e-08,
-    (float)1.52199e-08,
-    (float)1.60036e-08,
-    (float)1.66512e-09,
-    (float)1.7101e-08,
-    (float)5.25841e-09,
-    (float)1.5091e-08,
-    (float)7.84246e-10,
-    (float)1.93471e-09,
-    (float)3.12672e-09,
-    (float)8.63079e-09,
-    (float)4.62493e-09,
-    (float)3.50404e-09,
-    (float)1.18074e-08,
-    (float)8.36579e-09,
-    (float)5.11575e-09,
-    (float)1.93244e-08,
-    (float)1.47471e-08,
-    (float)4.00664e-09,
-    (float)1.38412e-08,
-    (float)6.22483e-09,
-    (float)7.49796e-09,
-    (float)3.01539e-09,
-    (float)4.96161e-09,
-    (float)6.1236e-09,
-    (float)1.42337e-08,
-    (float)0.978048,
-    (float)0.000332377,
-    (float)0.00590517,
-    (float)0.013031,
-    (float)0.00127649,
-    (float)0.000363965,
-    (float)0.000731255,
-    (float)2.85188e-05,
-    (float)8.1844e-05,
-    (float)5.22445e-06,
-    (float)7.59835e-05,
-    (float)3.32254e-05,
-    (float)2.35497e-06,
-    (float)2.72114e-05,
-    (float)2.19445e-06,
-    (float)1.05139e-05,
-    (float)4.52548e-06,
-    (float)1.45287e-05,
-    (float)3.10425e-07,
-    (float)5.14625e-07,
-    (float)2.32697e-06,
-    (float)5.00974e-06,
-    (float)3.9358e-06,
-    (float)5.71594e-07,
-    (float)1.41644e-07,
-    (float)1.44976e-06,
-    (float)7.70882e-08,
-    (float)6.73886e-07,
-    (float)2.5803e-06,
-    (float)7.06568e-07,
-    (float)4.8416e-07,
-    (float)6.45865e-08,
-    (float)3.87125e-07,
-    (float)2.53698e-07,
-    (float)1.62134e-07,
-    (float)9.83311e-07,
-    (float)3.79848e-07,
-    (float)2.61537e-07,
-    (float)2.89218e-07,
-    (float)5.31968e-09,
-    (float)2.36366e-07,
-    (float)3.72443e-08,
-    (float)2.59118e-07,
-    (float)4.87927e-08,
-    (float)2.38755e-07,
-    (float)2.82501e-07,
-    (float)1.61932e-07,
-    (float)1.63605e-07,
-    (float)1.55834e-07,
-    (float)6.65459e-08,
-    (float)4.54822e-08,
-    (float)1.05524e-07,
-    (float)1.77572e-07,
-    (float)3.42618e-08,
-    (float)1.56863e-07,
-    (float)5.81199e-08,
-    (float)4.66602e-08,
-    (float)3.70558e-08,
-    (float)3.71971e-08,
-    (float)3.00342e-08,
-    (float)7.27495e-08,
-    (float)3.45595e-08,
-    (float)1.35708e-07,
-    (float)1.13526e-09,
-    (float)3.02621e-08,
-    (float)3.07348e-08,
-    (float)3.37374e-08,
-    (float)6.37037e-08,
-    (float)6.20905e-08,
-    (float)6.27997e-08,
-    (float)1.81349e-08,
-    (float)1.64408e-08,
-    (float)3.1408e-08,
-    (float)1.03149e-08,
-    (float)4.60483e-08,
-    (float)2.16414e-08,
-    (float)6.38268e-08,
-    (float)1.07568e-08,
-    (float)5.27161e-09,
-    (float)5.55936e-08,
-    (float)1.31805e-08,
-    (float)2.289e-08,
-    (float)3.27046e-10,
-    (float)1.04073e-08,
-    (float)2.30896e-09,
-    (float)9.62158e-09,
-    (float)2.81994e-08,
-    (float)4.48181e-08,
-    (float)1.39014e-09,
-    (float)2.52516e-08,
-    (float)1.24691e-08,
-    (float)9.10827e-09,
-    (float)9.84544e-09,
-    (float)1.71432e-08,
-    (float)1.00243e-08,
-    (float)4.18269e-09,
-    (float)5.72305e-09,
-    (float)7.44544e-09,
-    (float)2.19556e-10,
-    (float)9.29502e-09,
-    (float)2.56019e-09,
-    (float)3.72905e-08,
-    (float)1.2189e-09,
-    (float)1.43704e-08,
-    (float)7.38917e-09,
-    (float)1.39892e-09,
-    (float)1.26089e-08,
-    (float)3.77915e-09,
-    (float)9.84276e-09,
-    (float)3.62394e-09,
-    (float)1.54762e-09,
-    (float)1.21679e-08,
-    (float)4.08065e-09,
-    (float)1.3587e-08,
-    (float)1.93749e-08,
-    (float)9.83152e-09,
-    (float)5.96088e-09,
-    (float)2.51597e-09,
-    (float)9.99506e-09,
-    (float)8.84088e-09,
-    (float)3.59453e-09,
-    (float)7.57824e-09,
-    (float)5.28506e-10,
-    (float)3.56933e-09,
-    (float)8.48087e-09,
-    (float)4.87231e-09,
-    (float)2.00541e-08,
-    (float)6.53344e-10,
-    (float)0.983363,
-    (float)0.000305479,
-    (float)0.0042989,
-    (float)0.00961665,
-    (float)0.00112991,
-    (float)0.000369707,
-    (float)0.000650932,
-    (float)2.99403e-06,
-    (float)0.000111843,
-    (float)1.51902e-05,
-    (float)3.52636e-05,
-    (float)2.95862e-05,
-    (float)4.80514e-06,
-    (float)2.01335e-05,
-    (float)2.93823e-06,
-    (float)9.32165e-06,
-    (float)4.42339e-06,
-    (float)4.4981e-06,
-    (float)3.63255e-06,
-    (float)1.06008e-06,
-    (float)1.55734e-06,
-    (float)1.17776e-06,
-    (float)8.09035e-06,
-    (float)4.86537e-07,
-    (float)1.21798e-07,
-    (float)4.65491e-07,
-    (float)1.36761e-08,
-    (float)8.98524e-08,
-    (float)7.11803e-07,
-    (float)9.2284e-07,
-    (float)8.72598e-08,
-    (float)3.54607e-08,
-    (float)1.75408e-06,
-    (float)4.30473e-07,
-    (float)2.36958e-07,
-    (float)1.52907e-07,
-    (float)2.1126e-07,
-    (float)8.6921e-11,
-    (float)4.03668e-09,
-    (float)2.19843e-07,
-    (float)3.21584e-07,
-    (float)4.46144e-08,
-    (float)4.6001e-09,
-    (float)2.08861e-07,
-    (float)1.42319e-07,
-    (float)3.78805e-07,
-    (float)3.31025e-08,
-    (float)1.56676e-07,
-    (float)1.90171e-07,
-    (float)1.89205e-07,
-    (float)3.71091e-08,
-    (float)6.36342e-08,
-    (float)3.89224e-08,
-    (float)5.47366e-09,
-    (float)1.67258e-08,
-    (float)6.84682e-09,
-    (float)1.00488e-08,
-    (float)1.44865e-07,
-    (float)2.76221e-09,
-    (float)1.82468e-07,
-    (float)8.49756e-11,
-    (float)3.48736e-08,
-    (float)6.87712e-08,
-    (float)2.86989e-08,
-    (float)2.79407e-08,
-    (float)9.2878e-09,
-    (float)7.59305e-08,
-    (float)1.10611e-08,
-    (float)5.71276e-09,
-    (float)3.9388e-08,
-    (float)2.64679e-08,
-    (float)3.07922e-08,
-    (float)2.11054e-08,
-    (float)4.28313e-08,
-    (float)1.09549e-08,
-    (float)1.96823e-08,
-    (float)3.76071e-08,
-    (float)5.33175e-09,
-    (float)1.93847e-08,
-    (float)1.19277e-08,
-    (float)3.59754e-09,
-    (float)1.25121e-09,
-    (float)2.73031e-08,
-    (float)1.10265e-08,
-    (float)2.61191e-08,
-    (float)9.73917e-09,
-    (float)2.17571e-08,
-    (float)1.07486e-08,
-    (float)8.84528e-09,
-    (float)2.01843e-08,
-    (float)5.99051e-09,
-    (float)1.87831e-09,
-    (float)1.1622e-09,
-    (float)7.06129e-09,
-    (float)5.11658e-09,
-    (float)1.15298e-09,
-    (float)1.58745e-08,
-    (float)4.12325e-09,
-    (float)1.50248e-08,
-    (float)4.20002e-09,
-    (float)5.66913e-09,
-    (float)1.47482e-08,
-    (float)6.34566e-09,
-    (float)1.60775e-08,
-    (float)2.00386e-09,
-    (float)6.49689e-09,
-    (float)2.16158e-09,
-    (float)2.17525e-09,
-    (float)2.35518e-09,
-    (float)1.71751e-09,
-    (float)1.17744e-08,
-    (float)3.99462e-09,
-    (float)6.66726e-09,
-    (float)9.83159e-09,
-    (float)5.67719e-09,
-    (float)4.9197e-09,
-    (float)7.33135e-09,
-    (float)9.3321e-09,
-    (float)2.70896e-09,
-    (float)4.08434e-09,
-    (float)5.10639e-10,
-    (float)1.04466e-09,
-    (float)5.43406e-09,
-    (float)7.83606e-09,
-    (float)4.34908e-09,
-    (float)4.56364e-09,
-    (float)7.66214e-09,
-    (float)2.74774e-09,
-    (float)0.987893,
-    (float)0.000266641,
-    (float)0.0029924,
-    (float)0.00674744,
-    (float)0.000960983,
-    (float)0.000340507,
-    (float)0.000512408,
-    (float)3.39988e-05,
-    (float)0.000132518,
-    (float)2.06986e-05,
-    (float)1.82235e-05,
-    (float)2.46358e-05,
-    (float)6.76707e-06,
-    (float)8.63664e-06,
-    (float)8.86831e-06,
-    (float)6.87529e-06,
-    (float)1.40301e-06,
-    (float)4.19438e-07,
-    (float)6.8458e-06,
-    (float)5.96555e-07,
-    (float)7.63862e-07,
-    (float)2.56729e-07,
-    (float)5.9841e-06,
-    (float)7.81288e-08,
-    (float)3.5614e-07,
-    (float)2.3368e-06,
-    (float)4.18869e-07,
-    (float)1.94462e-07,
-    (float)6.12931e-08,
-    (float)1.33654e-07,
-    (float)1.43643e-07,
-    (float)3.21829e-08,
-    (float)9.06839e-07,
-    (float)1.91591e-07,
-    (float)5.09764e-07,
-    (float)2.70095e-07,
-    (float)1.96099e-08,
-    (float)5.5678e-07,
-    (float)2.09465e-08,
-    (float)6.05929e-08,
-    (float)7.42505e-08,
-    (float)1.76924e-07,
-    (float)1.05318e-07,
-    (float)7.78385e-08,
-    (float)3.3679e-07,
-    (float)1.00382e-07,
-    (float)7.17451e-08,
-    (float)1.43878e-07,
-    (float)6.45242e-08,
-    (float)3.61128e-08,
-    (float)1.48811e-08,
-    (float)1.46088e-07,
-    (float)1.40544e-08,
-    (float)8.34006e-08,
-    (float)1.61759e-07,
-    (float)1.68469e-09,
-    (float)1.44378e-07,
-    (float)1.88045e-08,
-    (float)1.5327e-08,
-    (float)3.44388e-08,
-    (float)5.02687e-09,
-    (float)1.17519e-09,
-    (float)2.25837e-08,
-    (float)1.08843e-07,
-    (float)2.16534e-08,
-    (float)2.53079e-09,
-    (float)7.91831e-08,
-    (float)5.33424e-08,
-    (float)3.47733e-08,
-    (float)2.92459e-08,
-    (float)3.6428e-08,
-    (float)8.33509e-09,
-    (float)2.04809e-08,
-    (float)1.8944e-08,
-    (float)9.06575e-09,
-    (float)8.65407e-09,
-    (float)1.9384e-08,
-    (float)5.90056e-09,
-    (float)1.41563e-08,
-    (float)4.3568e-08,
-    (float)1.02785e-09,
-    (float)2.13595e-08,
-    (float)2.63309e-08,
-    (float)2.62555e-08,
-    (float)7.32285e-09,
-    (float)1.94198e-08,
-    (float)1.47971e-08,
-    (float)6.03691e-09,
-    (float)6.79638e-09,
-    (float)8.23962e-09,
-    (float)8.34296e-10,
-    (float)6.80236e-09,
-    (float)8.47033e-10,
-    (float)2.19533e-08,
-    (float)8.47325e-10,
-    (float)2.37684e-08,
-    (float)6.8312e-09,
-    (float)7.01727e-09,
-    (float)2.28794e-08,
-    (float)5.94065e-09,
-    (float)1.13161e-08,
-    (float)7.23924e-09,
-    (float)5.38727e-10,
-    (float)1.7061e-09,
-    (float)4.28655e-09,
-    (float)1.86186e-08,
-    (float)1.95581e-09,
-    (float)4.80487e-09,
-    (float)1.20176e-08,
-    (float)4.29235e-09,
-    (float)5.0783e-09,
-    (float)5.08899e-09,
-    (float)1.42424e-08,
-    (float)1.06885e-08,
-    (float)8.15572e-09,
-    (float)8.77803e-09,
-    (float)1.38567e-09,
-    (float)1.32126e-08,
-    (float)4.26328e-09,
-    (float)3.52979e-09,
-    (float)1.33008e-09,
-    (float)1.92589e-09,
-    (float)3.4994e-09,
-    (float)2.85078e-09,
-    (float)6.10047e-09,
-    (float)1.49672e-08,
-    (float)3.49174e-09,
-    (float)1.96674e-08,
-    (float)0.991677,
-    (float)0.000220932,
-    (float)0.00195761,
-    (float)0.00442568,
-    (float)0.00076649,
-    (float)0.000281511,
-    (float)0.000352833,
-    (float)7.8452e-05,
-    (float)0.000134556,
-    (float)1.89947e-05,
-    (float)2.37604e-05,
-    (float)1.73172e-05,
-    (float)7.39908e-06,
-    (float)3.41367e-06,
-    (float)1.1486e-05,
-    (float)2.28508e-06,
-    (float)4.69815e-08,
-    (float)5.27463e-07,
-    (float)5.24551e-06,
-    (float)2.56383e-06,
-    (float)8.67599e-07,
-    (float)9.66577e-07,
-    (float)1.23287e-06,
-    (float)1.95061e-07,
-    (float)3.54417e-07,
-    (float)1.7802e-06,
-    (float)1.12791e-06,
-    (float)1.98258e-07,
-    (float)1.18547e-08,
-    (float)9.4607e-07,
-    (float)5.36469e-07,
-    (float)7.05408e-08,
-    (float)1.83276e-07,
-    (float)2.36621e-08,
-    (float)2.67023e-08,
-    (float)1.94789e-08,
-    (float)8.43886e-08,
-    (float)3.4867e-07,
-    (float)6.2416e-08,
-    (float)6.01536e-08,
-    (float)3.50518e-07,
-    (float)3.16763e-07,
-    (float)1.91997e-07,
-    (float)1.46756e-08,
-    (float)1.53092e-07,
-    (float)2.03822e-07,
-    (float)1.10322e-08,
-    (float)2.92012e-09,
-    (float)1.34783e-07,
-    (float)5.30336e-08,
-    (float)1.35797e-08,
-    (float)2.96144e-08,
-    (float)6.27597e-08,
-    (float)5.49712e-09,
-    (float)1.40917e-07,
-    (float)7.44659e-09,
-    (float)3.20841e-08,
-    (float)3.37831e-08,
-    (float)5.36441e-08,
-    (float)7.29491e-08,
-    (float)1.29989e-07,
-    (float)5.26345e-08,
-    (float)8.41345e-09,
-    (float)6.96629e-08,
-    (float)4.69822e-08,
-    (float)7.80912e-09,
-    (float)1.79363e-08,
-    (float)6.11824e-09,
-    (float)6.66609e-09,
-    (float)2.52501e-08,
-    (float)4.86989e-09,
-    (float)3.13327e-08,
-    (float)5.38204e-09,
-    (float)3.66654e-08,
-    (float)2.53503e-08,
-    (float)2.02998e-08,
-    (float)5.58454e-08,
-    (float)3.89195e-09,
-    (float)2.54145e-08,
-    (float)1.69654e-08,
-    (float)1.5771e-08,
-    (float)1.65524e-08,
-    (float)1.1534e-08,
-    (float)3.50117e-09,
-    (float)9.25905e-10,
-    (float)1.60015e-08,
-    (float)1.40694e-08,
-    (float)1.77704e-09,
-    (float)1.55467e-08,
-    (float)7.50421e-09,
-    (float)1.70877e-08,
-    (float)5.16205e-09,
-    (float)1.00632e-08,
-    (float)1.08384e-08,
-    (float)7.53794e-09,
-    (float)2.39994e-08,
-    (float)3.84421e-09,
-    (float)1.86083e-08,
-    (float)7.9506e-09,
-    (float)3.72788e-10,
-    (float)1.84006e-08,
-    (float)2.54338e-09,
-    (float)5.32768e-09,
-    (float)2.46577e-09,
-    (float)8.92862e-09,
-    (float)1.10916e-08,
-    (float)8.6843e-10,
-    (float)7.38183e-09,
-    (float)1.26851e-08,
-    (float)1.26315e-08,
-    (float)2.24186e-08,
-    (float)9.78657e-10,
-    (float)1.14102e-08,
-    (float)9.50161e-09,
-    (float)8.53627e-09,
-    (float)4.50114e-09,
-    (float)3.4317e-09,
-    (float)4.97369e-09,
-    (float)1.22527e-09,
-    (float)1.46452e-09,
-    (float)5.37974e-09,
-    (float)1.29157e-09,
-    (float)9.22426e-09,
-    (float)6.65855e-09,
-    (float)1.02875e-08,
-    (float)1.12334e-08,
-    (float)1.30391e-08,
-    (float)7.63352e-09,
-    (float)0.994738,
-    (float)0.000169529,
-    (float)0.00117394,
-    (float)0.00263896,
-    (float)0.000552659,
-    (float)0.000204747,
-    (float)0.000203564,
-    (float)0.000102272,
-    (float)0.000118113,
-    (float)1.40736e-05,
-    (float)3.49588e-05,
-    (float)9.76848e-06,
-    (float)9.08511e-06,
-    (float)4.35661e-06,
-    (float)9.06652e-06,
-    (float)1.15447e-07,
-    (float)8.90071e-07,
-    (float)6.72305e-07,
-    (float)1.12796e-06,
-    (float)5.49281e-06,
-    (float)6.10386e-07,
-    (float)4.65863e-07,
-    (float)5.72761e-07,
-    (float)1.06013e-07,
-    (float)1.79796e-07,
-    (float)8.29178e-07,
-    (float)4.1329e-07,
-    (float)2.32943e-08,
-    (float)2.48759e-07,
-    (float)8.71004e-07,
-    (float)2.06771e-07,
-    (float)5.3412e-07,
-    (float)1.97028e-07,
-    (float)2.6956e-08,
-    (float)3.97554e-07,
-    (float)4.82881e-08,
-    (float)4.41438e-08,
-    (float)5.23038e-08,
-    (float)5.65e-08,
-    (float)8.75627e-09,
-    (float)1.54837e-07,
-    (float)1.48055e-07,
-    (float)7.54508e-08,
-    (float)9.17202e-08,
-    (float)2.00905e-07,
-    (float)1.04998e-08,
-    (float)1.36589e-07,
-    (float)3.33381e-08,
-    (float)5.89151e-08,
-    (float)7.47065e-08,
-    (float)4.50929e-08,
-    (float)1.38339e-07,
-    (float)6.34105e-09,
-    (float)4.80318e-08,
-    (float)8.58054e-10,
-    (float)6.83649e-08,
-    (float)3.56597e-08,
-    (float)4.1838e-08,
-    (float)5.73923e-08,
-    (float)2.05303e-08,
-    (float)2.82587e-09,
-    (float)2.62274e-08,
-    (float)1.38019e-08,
-    (float)3.24529e-08,
-    (float)1.1318e-08,
-    (float)4.4924e-08,
-    (float)3.57742e-08,
-    (float)2.58237e-08,
-    (float)5.64742e-08,
-    (float)5.77935e-09,
-    (float)4.95496e-08,
-    (float)1.91387e-08,
-    (float)1.958e-08,
-    (float)4.48343e-08,
-    (float)1.13004e-09,
-    (float)1.52081e-08,
-    (float)5.2272e-09,
-    (float)1.07235e-08,
-    (float)8.82669e-09,
-    (float)7.20726e-10,
-    (float)9.86946e-09,
-    (float)2.82692e-09,
-    (float)1.55802e-08,
-    (float)1.01424e-08,
-    (float)1.02502e-09,
-    (float)3.2339e-08,
-    (float)6.85122e-09,
-    (float)1.96752e-08,
-    (float)1.02818e-08,
-    (float)6.91812e-09,
-    (float)1.36724e-08,
-    (float)1.0353e-08,
-    (float)2.11987e-08,
-    (float)9.60847e-09,
-    (float)7.48088e-09,
-    (float)4.23577e-09,
-    (float)3.81574e-09,
-    (float)1.34371e-08,
-    (float)5.59682e-10,
-    (float)2.24128e-09,
-    (float)7.7913e-09,
-    (float)3.19961e-09,
-    (float)3.97176e-09,
-    (float)2.91144e-09,
-    (float)1.04105e-08,
-    (float)9.49719e-09,
-    (float)1.51426e-08,
-    (float)1.38397e-08,
-    (float)7.22504e-09,
-    (float)1.22626e-08,
-    (float)9.78898e-09,
-    (float)9.23618e-09,
-    (float)8.684e-09,
-    (float)3.427e-09,
-    (float)3.25681e-09,
-    (float)4.20326e-09,
-    (float)4.38099e-09,
-    (float)3.47942e-09,
-    (float)1.98252e-09,
-    (float)5.73919e-09,
-    (float)4.17958e-09,
-    (float)6.95145e-09,
-    (float)5.26783e-09,
-    (float)5.59789e-09,
-    (float)1.10139e-08,
-    (float)7.03804e-09,
-    (float)9.44491e-09,
-    (float)1.37238e-08,
-    (float)0.997082,
-    (float)0.000118116,
-    (float)0.000614213,
-    (float)0.00136125,
-    (float)0.000341407,
-    (float)0.00012494,
-    (float)9.15574e-05,
-    (float)9.15181e-05,
-    (float)8.72914e-05,
-    (float)1.03008e-05,
-    (float)3.58553e-05,
-    (float)4.50403e-06,
-    (float)1.1369e-05,
-    (float)5.01752e-06,
-    (float)5.40418e-06,
-    (float)2.49883e-06,
-    (float)9.4679e-07,
-    (float)7.21165e-07,
-    (float)2.84467e-07,
-    (float)4.70952e-06,
-    (float)1.34528e-07,
-    (float)3.18255e-08,
-    (float)1.33377e-06,
-    (float)3.06271e-07,
-    (float)2.37721e-07,
-    (float)2.02957e-07,
-    (float)6.12605e-08,
-    (float)4.18594e-07,
-    (float)7.67138e-08,
-    (float)2.15046e-07,
-    (float)1.94424e-08,
-    (float)1.8929e-07,
-    (float)1.10647e-07,
-    (float)1.04287e-07,
-    (float)3.2691e-07,
-    (float)9.12343e-09,
-    (float)1.77562e-07,
-    (float)3.2281e-07,
-    (float)1.43573e-07,
-    (float)1.58206e-07,
-    (float)3.67069e-09,
-    (float)2.4436e-07,
-    (float)4.13297e-08,
-    (float)9.54033e-10,
-    (float)2.06263e-08,
-    (float)3.13016e-08,
-    (float)4.16565e-08,
-    (float)2.28099e-08,
-    (float)7.19238e-09,
-    (float)4.38279e-08,
-    (float)1.14137e-08,
-    (float)8.50788e-08,
-    (float)3.46092e-08,
-    (float)3.00076e-08,
-    (float)7.21731e-08,
-    (float)5.60206e-08,
-    (float)9.04102e-08,
-    (float)6.52169e-09,
-    (float)1.5455e-08,
-    (float)6.04773e-08,
-    (float)5.0895e-08,
-    (float)2.75129e-08,
-    (float)4.40194e-08,
-    (float)1.22822e-08,
-    (float)2.59362e-08,
-    (float)3.51762e-08,
-    (float)1.06628e-09,
-    (float)2.27158e-08,
-    (float)7.63345e-09,
-    (float)1.99192e-10,
-    (float)2.77546e-08,
-    (float)1.69172e-08,
-    (float)2.42579e-09,
-    (float)5.90683e-09,
-    (float)2.19984e-08,
-    (float)1.30586e-08,
-    (float)1.41819e-08,
-    (float)2.47508e-08,
-    (float)1.60047e-08,
-    (float)2.33212e-08,
-    (float)1.76779e-08,
-    (float)4.96227e-09,
-    (float)4.49716e-08,
-    (float)8.96474e-09,
-    (float)1.92045e-08,
-    (float)9.34463e-09,
-    (float)4.94272e-09,
-    (float)2.3379e-08,
-    (float)4.97196e-09,
-    (float)1.5149e-08,
-    (float)5.25678e-09,
-    (float)1.14674e-09,
-    (float)6.70534e-09,
-    (float)3.09323e-09,
-    (float)8.0561e-09,
-    (float)1.17556e-09,
-    (float)4.97968e-09,
-    (float)1.43533e-08,
-    (float)7.55905e-10,
-    (float)4.54938e-09,
-    (float)6.18574e-09,
-    (float)1.63488e-08,
-    (float)2.07427e-08,
-    (float)2.83235e-09,
-    (float)1.28951e-08,
-    (float)7.25341e-09,
-    (float)1.23097e-08,
-    (float)1.35487e-08,
-    (float)9.23517e-09,
-    (float)8.96894e-09,
-    (float)5.63449e-09,
-    (float)1.28966e-08,
-    (float)4.77384e-09,
-    (float)1.64771e-09,
-    (float)3.49481e-09,
-    (float)6.86161e-09,
-    (float)9.69801e-09,
-    (float)3.34154e-09,
-    (float)3.86117e-10,
-    (float)6.47634e-09,
-    (float)5.2591e-09,
-    (float)7.18051e-09,
-    (float)5.57508e-09,
-    (float)8.59149e-09,
-    (float)1.33459e-08,
-    (float)8.00448e-09,
-    (float)7.49891e-09,
-    (float)7.84893e-09,
-    (float)0.998725,
-    (float)7.12091e-05,
-    (float)0.000253331,
-    (float)0.000539378,
-    (float)0.000160071,
-    (float)5.64203e-05,
-    (float)2.51797e-05,
-    (float)5.47196e-05,
-    (float)5.04315e-05,
-    (float)7.71678e-06,
-    (float)2.39792e-05,
-    (float)1.82943e-06,
-    (float)9.79579e-06,
-    (float)2.75938e-06,
-    (float)3.34405e-06,
-    (float)4.35862e-06,
-    (float)3.19704e-07,
-    (float)1.37541e-06,
-    (float)1.68746e-06,
-    (float)1.65519e-06,
-    (float)4.23778e-08,
-    (float)2.44232e-07,
-    (float)1.26465e-06,
-    (float)4.58072e-07,
-    (float)9.34222e-08,
-    (float)6.6861e-08,
-    (float)3.68108e-07,
-    (float)3.39775e-07,
-    (float)1.11209e-07,
-    (float)8.85479e-08,
-    (float)4.43299e-09,
-    (float)6.38597e-08,
-    (float)1.61144e-07,
-    (float)2.47338e-08,
-    (float)1.75891e-10,
-    (float)1.2924e-10,
-    (float)1.22917e-07,
-    (float)2.07169e-07,
-    (float)2.65093e-08,
-    (float)1.85676e-08,
-    (float)1.65348e-07,
-    (float)1.2154e-07,
-    (float)3.62474e-09,
-    (float)1.02902e-07,
-    (float)2.11244e-08,
-    (float)4.57341e-08,
-    (float)7.78418e-08,
-    (float)2.13299e-08,
-    (float)9.55417e-08,
-    (float)3.33293e-11,
-    (float)2.38054e-08,
-    (float)6.30887e-08,
-    (float)2.20695e-08,
-    (float)2.41953e-08,
-    (float)3.73306e-09,
-    (float)4.05505e-08,
-    (float)1.0812e-08,
-    (float)1.13175e-08,
-    (float)4.25965e-08,
-    (float)9.2857e-10,
-    (float)1.13259e-08,
-    (float)1.40386e-08,
-    (float)3.23162e-08,
-    (float)2.39369e-08,
-    (float)1.00257e-09,
-    (float)2.9522e-08,
-    (float)1.1959e-08,
-    (float)2.51471e-08,
-    (float)4.28521e-08,
-    (float)2.42229e-09,
-    (float)1.86678e-08,
-    (float)3.31979e-08,
-    (float)1.11189e-08,
-    (float)2.44404e-08,
-    (float)2.81171e-08,
-    (float)7.46108e-09,
-    (float)1.2915e-08,
-    (float)9.47e-09,
-    (float)8.45883e-09,
-    (float)2.39747e-08,
-    (float)3.44251e-09,
-    (float)9.94197e-09,
-    (float)8.815e-10,
-    (float)8.45645e-10,
-    (float)2.12771e-08,
-    (float)3.85673e-09,
-    (float)3.2671e-09,
-    (float)4.28775e-09,
-    (float)5.78016e-09,
-    (float)9.67905e-09,
-    (float)3.95473e-09,
-    (float)1.11489e-08,
-    (float)5.64128e-09,
-    (float)1.0575e-08,
-    (float)9.09381e-09,
-    (float)1.84051e-09,
-    (float)1.37203e-08,
-    (float)1.13647e-08,
-    (float)1.30124e-08,
-    (float)1.55058e-08,
-    (float)5.19061e-09,
-    (float)7.87782e-09,
-    (float)9.54552e-09,
-    (float)1.46777e-08,
-    (float)1.01286e-08,
-    (float)6.52466e-09,
-    (float)9.16811e-09,
-    (float)7.1043e-09,
-    (float)4.18906e-09,
-    (float)5.15764e-09,
-    (float)3.60944e-09,
-    (float)3.26174e-09,
-    (float)8.97932e-09,
-    (float)1.43396e-09,
-    (float)3.67188e-09,
-    (float)5.26449e-09,
-    (float)1.52662e-09,
-    (float)6.34e-09,
-    (float)5.74617e-09,
-    (float)5.83835e-09,
-    (float)6.52647e-09,
-    (float)4.82545e-09,
-    (float)9.34124e-09,
-    (float)3.63884e-09,
-    (float)8.51044e-09,
-    (float)1.15689e-08,
-    (float)7.84687e-09,
-    (float)9.77124e-09,
-    (float)0.999677,
-    (float)3.37336e-05,
-    (float)6.36161e-05,
-    (float)0.00011079,
-    (float)3.82638e-05,
-    (float)1.18979e-05,
-    (float)1.07342e-06,
-    (float)1.56448e-05,
-    (float)1.8473e-05,
-    (float)3.98058e-06,
-    (float)8.93222e-06,
-    (float)7.09011e-07,
-    (float)3.35119e-06,
-    (float)5.48862e-07,
-    (float)2.26987e-06,
-    (float)1.73268e-06,
-    (float)5.47175e-07,
-    (float)1.46254e-06,
-    (float)1.40965e-06,
-    (float)2.53107e-07,
-    (float)3.02724e-08,
-    (float)3.38072e-07,
-    (float)8.76973e-07,
-    (float)1.42493e-07,
-    (float)6.1421e-08,
-    (float)2.45334e-07,
-    (float)2.51089e-07,
-    (float)5.70172e-08,
-    (float)1.99346e-07,
-    (float)7.67473e-08,
-    (float)8.53392e-08,
-    (float)1.48069e-07,
-    (float)3.66297e-08,
-    (float)1.29792e-07,
-    (float)1.32103e-07,
-    (float)5.31299e-09,
-    (float)1.57429e-07,
-    (float)5.07856e-09,
-    (float)1.44622e-07,
-    (float)2.30539e-08,
-    (float)1.24256e-08,
-    (float)2.11348e-08,
-    (float)1.34247e-08,
-    (float)3.80678e-08,
-    (float)1.18373e-08,
-    (float)3.52042e-09,
-    (float)3.98567e-08,
-    (float)2.05735e-08,
-    (float)3.87466e-08,
-    (float)1.10237e-08,
-    (float)1.60469e-08,
-    (float)3.15529e-08,
-    (float)7.91935e-08,
-    (float)9.87632e-09,
-    (float)1.63177e-09,
-    (float)4.59517e-08,
-    (float)2.69881e-08,
-    (float)1.78025e-08,
-    (float)8.72713e-09,
-    (float)3.06384e-08,
-    (float)3.23321e-08,
-    (float)9.62807e-09,
-    (float)2.21624e-08,
-    (float)8.12615e-09,
-    (float)1.22311e-08,
-    (float)2.26861e-08,
-    (float)1.10644e-08,
-    (float)8.73962e-09,
-    (float)6.3655e-09,
-    (float)1.62575e-08,
-    (float)1.85483e-08,
-    (float)7.7921e-09,
-    (float)2.36538e-09,
-    (float)2.71263e-09,
-    (float)2.00528e-08,
-    (float)6.85833e-09,
-    (float)6.37562e-09,
-    (float)1.29148e-08,
-    (float)2.47941e-09,
-    (float)6.38019e-09,
-    (float)1.0741e-08,
-    (float)2.32171e-08,
-    (float)4.46918e-09,
-    (float)1.70774e-09,
-    (float)1.74707e-08,
-    (float)9.78256e-09,
-    (float)1.2548e-08,
-    (float)8.94658e-09,
-    (float)1.17808e-08,
-    (float)8.60749e-09,
-    (float)9.88508e-09,
-    (float)9.3389e-09,
-    (float)2.01062e-09,
-    (float)1.27302e-08,
-    (float)1.33553e-08,
-    (float)1.04516e-08,
-    (float)6.60273e-09,
-    (float)1.76887e-09,
-    (float)1.23059e-08,
-    (float)7.67149e-09,
-    (float)8.14123e-09,
-    (float)7.13115e-09,
-    (float)1.56816e-09,
-    (float)8.31858e-09,
-    (float)5.13026e-09,
-    (float)2.87292e-09,
-    (float)1.93894e-09,
-    (float)6.35858e-09,
-    (float)1.28393e-08,
-    (float)3.06552e-09,
-    (float)2.89145e-09,
-    (float)4.96557e-09,
-    (float)3.35478e-09,
-    (float)1.9927e-09,
-    (float)4.68718e-09,
-    (float)6.09825e-09,
-    (float)3.95026e-09,
-    (float)8.39003e-09,
-    (float)6.64154e-09,
-    (float)5.7492e-09,
-    (float)2.8271e-09,
-    (float)6.93425e-09,
-    (float)1.79206e-08,
-    (float)2.73646e-09,
-    (float)5.88119e-09,
-    (float)1.20128e-08,
-    (float)4.58282e-09,
-    (float)1.05736e-08,
-    (float)0.999947,
-    (float)1.10948e-05,
-    (float)2.04515e-05,
-    (float)1.60009e-06,
-    (float)1.73474e-06,
-    (float)1.01403e-06,
-    (float)6.18327e-06,
-    (float)4.27207e-07,
-    (float)1.25531e-06,
-    (float)5.51526e-07,
-    (float)2.30396e-06,
-    (float)3.62752e-07,
-    (float)7.61411e-07,
-    (float)3.88397e-07,
-    (float)8.09853e-07,
-    (float)3.51123e-07,
-    (float)4.87556e-07,
-    (float)2.48269e-07,
-    (float)2.46945e-07,
-    (float)2.37158e-07,
-    (float)2.88472e-07,
-    (float)1.18002e-07,
-    (float)4.91376e-08,
-    (float)8.30209e-08,
-    (float)1.14755e-07,
-    (float)7.0279e-08,
-    (float)1.83437e-08,
-    (float)4.7095e-09,
-    (float)2.43721e-08,
-    (float)1.28114e-07,
-    (float)6.3342e-08,
-    (float)7.08155e-09,
-    (float)1.89336e-09,
-    (float)1.66279e-07,
-    (float)8.91336e-08,
-    (float)1.18547e-08,
-    (float)5.78677e-11,
-    (float)1.12256e-07,
-    (float)5.18706e-08,
-    (float)6.93689e-11,
-    (float)8.54581e-09,
-    (float)2.77818e-08,
-    (float)9.61884e-09,
-    (float)2.15787e-08,
-    (float)3.62648e-08,
-    (float)5.28279e-09,
-    (float)4.88238e-10,
-    (float)4.33706e-08,
-    (float)3.53054e-08,
-    (float)1.24869e-08,
-    (float)3.74045e-09,
-    (float)2.19751e-08,
-    (float)9.50672e-09,
-    (float)2.03933e-08,
-    (float)2.28934e-08,
-    (float)3.42655e-09,
-    (float)3.49665e-09,
-    (float)1.99084e-08,
-    (float)2.67511e-08,
-    (float)4.72286e-09,
-    (float)2.43867e-09,
-    (float)5.57231e-09,
-    (float)1.17311e-08,
-    (float)1.64031e-08,
-    (float)6.43549e-09,
-    (float)9.24233e-10,
-    (float)1.08617e-08,
-    (float)1.77336e-08,
-    (float)2.57926e-09,
-    (float)2.27025e-09,
-    (float)1.35472e-08,
-    (float)1.39039e-08,
-    (float)2.54937e-09,
-    (float)3.55787e-09,
-    (float)8.84255e-09,
-    (float)6.28831e-09,
-    (float)5.53125e-09,
-    (float)9.99839e-09,
-    (float)8.62487e-09,
-    (float)2.41361e-09,
-    (float)5.21687e-09,
-    (float)1.01015e-08,
-    (float)4.94321e-09,
-    (float)2.91527e-09,
-    (float)5.99785e-09,
-    (float)6.983e-09,
-    (float)4.90114e-09,
-    (float)3.68765e-09,
-    (float)7.02709e-09,
-    (float)4.12859e-09,
-    (float)5.019e-09,
-    (float)9.02942e-09,
-    (float)7.59818e-09,
-    (float)4.71396e-10,
-    (float)1.66285e-09,
-    (float)1.09173e-08,
-    (float)6.64582e-09,
-    (float)3.02938e-09,
-    (float)3.97208e-09,
-    (float)2.98904e-09,
-    (float)5.58985e-09,
-    (float)4.86283e-09,
-    (float)1.94364e-09,
-    (float)4.56141e-09,
-    (float)7.00618e-09,
-    (float)3.83988e-09,
-    (float)4.91817e-09,
-    (float)3.61444e-09,
-    (float)2.6914e-09,
-    (float)3.02442e-09,
-    (float)3.13832e-09,
-    (float)5.92451e-09,
-    (float)4.77086e-09,
-    (float)3.18563e-09,
-    (float)5.51525e-09,
-    (float)4.16974e-09,
-    (float)1.91537e-09,
-    (float)2.98125e-09,
-    (float)3.00349e-09,
-    (float)4.83965e-09,
-    (float)3.71894e-09,
-    (float)5.0688e-09,
-    (float)6.68309e-09,
-    (float)1.85816e-09,
-    (float)3.81907e-09,
-    (float)7.50436e-09,
-    (float)2.31051e-09,
-    (float)1.19396e-09,
-    (float)0.999947,
-    (float)1.10948e-05,
-    (float)2.04515e-05,
-    (float)1.60009e-06,
-    (float)1.73474e-06,
-    (float)1.01403e-06,
-    (float)6.18327e-06,
-    (float)4.27207e-07,
-    (float)1.25531e-06,
-    (float)5.51526e-07,
-    (float)2.30396e-06,
-    (float)3.62752e-07,
-    (float)7.61411e-07,
-    (float)3.88397e-07,
-    (float)8.09853e-07,
-    (float)3.51123e-07,
-    (float)4.87556e-07,
-    (float)2.48269e-07,
-    (float)2.46945e-07,
-    (float)2.37158e-07,
-    (float)2.88472e-07,
-    (float)1.18002e-07,
-    (float)4.91376e-08,
-    (float)8.30209e-08,
-    (float)1.14755e-07,
-    (float)7.0279e-08,
-    (float)1.83437e-08,
-    (float)4.7095e-09,
-    (float)2.43721e-08,
-    (float)1.28114e-07,
-    (float)6.3342e-08,
-    (float)7.08155e-09,
-    (float)1.89336e-09,
-    (float)1.66279e-07,
-    (float)8.91336e-08,
-    (float)1.18547e-08,
-    (float)5.78677e-11,
-    (float)1.12256e-07,
-    (float)5.18706e-08,
-    (float)6.93689e-11,
-    (float)8.54581e-09,
-    (float)2.77818e-08,
-    (float)9.61884e-09,
-    (float)2.15787e-08,
-    (float)3.62648e-08,
-    (float)5.28279e-09,
-    (float)4.88238e-10,
-    (float)4.33706e-08,
-    (float)3.53054e-08,
-    (float)1.24869e-08,
-    (float)3.74045e-09,
-    (float)2.19751e-08,
-    (float)9.50672e-09,
-    (float)2.03933e-08,
-    (float)2.28934e-08,
-    (float)3.42655e-09,
-    (float)3.49665e-09,
-    (float)1.99084e-08,
-    (float)2.67511e-08,
-    (float)4.72286e-09,
-    (float)2.43867e-09,
-    (float)5.57231e-09,
-    (float)1.17311e-08,
-    (float)1.64031e-08,
-    (float)6.43549e-09,
-    (float)9.24233e-10,
-    (float)1.08617e-08,
-    (float)1.77336e-08,
-    (float)2.57926e-09,
-    (float)2.27025e-09,
-    (float)1.35472e-08,
-    (float)1.39039e-08,
-    (float)2.54937e-09,
-    (float)3.55787e-09,
-    (float)8.84255e-09,
-    (float)6.28831e-09,
-    (float)5.53125e-09,
-    (float)9.99839e-09,
-    (float)8.62487e-09,
-    (float)2.41361e-09,
-    (float)5.21687e-09,
-    (float)1.01015e-08,
-    (float)4.94321e-09,
-    (float)2.91527e-09,
-    (float)5.99785e-09,
-    (float)6.983e-09,
-    (float)4.90114e-09,
-    (float)3.68765e-09,
-    (float)7.02709e-09,
-    (float)4.12859e-09,
-    (float)5.019e-09,
-    (float)9.02942e-09,
-    (float)7.59818e-09,
-    (float)4.71396e-10,
-    (float)1.66285e-09,
-    (float)1.09173e-08,
-    (float)6.64582e-09,
-    (float)3.02938e-09,
-    (float)3.97208e-09,
-    (float)2.98904e-09,
-    (float)5.58985e-09,
-    (float)4.86283e-09,
-    (float)1.94364e-09,
-    (float)4.56141e-09,
-    (float)7.00618e-09,
-    (float)3.83988e-09,
-    (float)4.91817e-09,
-    (float)3.61444e-09,
-    (float)2.6914e-09,
-    (float)3.02442e-09,
-    (float)3.13832e-09,
-    (float)5.92451e-09,
-    (float)4.77086e-09,
-    (float)3.18563e-09,
-    (float)5.51525e-09,
-    (float)4.16974e-09,
-    (float)1.91537e-09,
-    (float)2.98125e-09,
-    (float)3.00349e-09,
-    (float)4.83965e-09,
-    (float)3.71894e-09,
-    (float)5.0688e-09,
-    (float)6.68309e-09,
-    (float)1.85816e-09,
-    (float)3.81907e-09,
-    (float)7.50436e-09,
-    (float)2.31051e-09,
-    (float)1.19396e-09,
-    (float)0.99893,
-    (float)0.000190503,
-    (float)0.000584374,
-    (float)6.94143e-05,
-    (float)0.000197881,
-    (float)3.89106e-06,
-    (float)1.20293e-06,
-    (float)1.37727e-06,
-    (float)5.10389e-06,
-    (float)3.65007e-06,
-    (float)9.92923e-07,
-    (float)2.03645e-06,
-    (float)3.05569e-06,
-    (float)1.04787e-06,
-    (float)3.70043e-07,
-    (float)2.67677e-07,
-    (float)2.20248e-07,
-    (float)2.97019e-08,
-    (float)6.99141e-07,
-    (float)7.81247e-07,
-    (float)3.14355e-07,
-    (float)7.81757e-08,
-    (float)2.47614e-07,
-    (float)2.00981e-07,
-    (float)2.02873e-08,
-    (float)4.9068e-08,
-    (float)4.05313e-08,
-    (float)1.1737e-07,
-    (float)4.7546e-08,
-    (float)5.22641e-09,
-    (float)3.01796e-08,
-    (float)2.32867e-07,
-    (float)7.67846e-09,
-    (float)4.28581e-09,
-    (float)3.72402e-09,
-    (float)2.85451e-07,
-    (float)1.25415e-08,
-    (float)7.64097e-09,
-    (float)1.37361e-08,
-    (float)1.01713e-07,
-    (float)1.0974e-08,
-    (float)2.75807e-09,
-    (float)3.90865e-09,
-    (float)3.83001e-08,
-    (float)6.59976e-09,
-    (float)3.93654e-08,
-    (float)3.03415e-08,
-    (float)4.20463e-09,
-    (float)1.57419e-08,
-    (float)5.03392e-08,
-    (float)1.788e-08,
-    (float)9.51743e-09,
-    (float)1.96353e-08,
-    (float)1.69107e-08,
-    (float)1.77004e-08,
-    (float)2.15333e-08,
-    (float)2.70523e-08,
-    (float)4.6789e-10,
-    (float)1.13898e-08,
-    (float)2.83052e-08,
-    (float)1.5167e-08,
-    (float)3.39038e-09,
-    (float)4.45055e-09,
-    (float)6.45751e-09,
-    (float)2.68374e-08,
-    (float)1.26405e-08,
-    (float)3.05506e-09,
-    (float)3.84939e-09,
-    (float)1.74815e-08,
-    (float)7.70684e-09,
-    (float)2.47353e-09,
-    (float)1.21779e-08,
-    (float)1.81417e-08,
-    (float)4.36065e-09,
-    (float)1.86385e-09,
-    (float)5.78459e-09,
-    (float)1.65376e-08,
-    (float)6.67932e-09,
-    (float)2.44637e-09,
-    (float)1.08022e-08,
-    (float)5.37116e-09,
-    (float)4.97807e-09,
-    (float)1.24185e-08,
-    (float)6.43233e-09,
-    (float)1.97032e-09,
-    (float)3.82802e-09,
-    (float)6.91899e-09,
-    (float)7.74398e-09,
-    (float)6.80692e-09,
-    (float)8.38755e-09,
-    (float)2.80026e-09,
-    (float)6.56572e-09,
-    (float)4.72668e-09,
-    (float)6.72186e-09,
-    (float)3.25583e-09,
-    (float)3.544e-09,
-    (float)7.77318e-09,
-    (float)1.07504e-08,
-    (float)7.40782e-10,
-    (float)2.83901e-09,
-    (float)6.08054e-09,
-    (float)7.4982e-09,
-    (float)6.89748e-09,
-    (float)2.93429e-09,
-    (float)1.78228e-09,
-    (float)1.13519e-08,
-    (float)3.05639e-09,
-    (float)2.02346e-09,
-    (float)4.68772e-09,
-    (float)5.27785e-09,
-    (float)3.11634e-09,
-    (float)5.60345e-09,
-    (float)4.49129e-09,
-    (float)5.45482e-09,
-    (float)1.37072e-09,
-    (float)3.19493e-09,
-    (float)7.88432e-09,
-    (float)3.60775e-09,
-    (float)5.43755e-09,
-    (float)2.99759e-09,
-    (float)7.33702e-09,
-    (float)6.18332e-09,
-    (float)3.10056e-09,
-    (float)2.62475e-09,
-    (float)6.09856e-09,
-    (float)3.01538e-09,
-    (float)5.91048e-09,
-    (float)3.34582e-09,
-    (float)0.995294,
-    (float)0.000719226,
-    (float)0.00289629,
-    (float)0.000260144,
-    (float)0.000727457,
-    (float)1.6256e-05,
-    (float)2.53155e-06,
-    (float)7.95926e-06,
-    (float)1.31792e-05,
-    (float)1.42118e-05,
-    (float)1.04289e-05,
-    (float)5.3602e-06,
-    (float)7.03824e-06,
-    (float)2.1217e-06,
-    (float)1.01688e-06,
-    (float)1.25147e-06,
-    (float)1.64054e-06,
-    (float)1.01781e-06,
-    (float)2.17315e-06,
-    (float)2.11337e-06,
-    (float)1.32325e-06,
-    (float)7.0983e-07,
-    (float)4.04609e-07,
-    (float)1.13473e-06,
-    (float)2.32375e-08,
-    (float)8.37694e-07,
-    (float)1.51439e-07,
-    (float)4.45892e-07,
-    (float)2.38988e-07,
-    (float)2.11984e-07,
-    (float)1.37398e-07,
-    (float)8.69128e-07,
-    (float)5.92518e-08,
-    (float)1.99977e-07,
-    (float)2.64771e-07,
-    (float)7.13492e-07,
-    (float)1.19123e-07,
-    (float)4.66278e-08,
-    (float)3.26359e-07,
-    (float)3.12458e-07,
-    (float)1.14777e-07,
-    (float)8.35738e-08,
-    (float)1.46632e-07,
-    (float)1.9781e-07,
-    (float)1.43737e-07,
-    (float)8.60463e-08,
-    (float)2.17616e-07,
-    (float)4.33645e-08,
-    (float)1.89997e-07,
-    (float)2.03847e-07,
-    (float)1.07458e-07,
-    (float)5.85192e-08,
-    (float)1.76262e-07,
-    (float)1.19621e-07,
-    (float)1.35073e-07,
-    (float)8.0556e-08,
-    (float)1.18377e-07,
-    (float)4.87001e-08,
-    (float)1.25447e-07,
-    (float)1.54137e-07,
-    (float)5.21472e-08,
-    (float)6.44097e-08,
-    (float)9.43914e-08,
-    (float)8.50493e-08,
-    (float)1.07254e-07,
-    (float)6.48409e-08,
-    (float)4.16697e-08,
-    (float)1.05091e-07,
-    (float)8.47326e-08,
-    (float)7.22397e-08,
-    (float)5.4355e-08,
-    (float)7.38007e-08,
-    (float)6.79092e-08,
-    (float)5.15856e-08,
-    (float)6.1615e-08,
-    (float)8.6741e-08,
-    (float)6.65867e-08,
-    (float)4.77379e-08,
-    (float)3.42706e-08,
-    (float)7.84023e-08,
-    (float)5.67203e-08,
-    (float)4.03165e-08,
-    (float)6.73268e-08,
-    (float)4.38187e-08,
-    (float)3.31568e-08,
-    (float)8.35217e-08,
-    (float)5.13228e-08,
-    (float)4.14839e-08,
-    (float)4.72088e-08,
-    (float)4.83738e-08,
-    (float)4.61845e-08,
-    (float)5.76251e-08,
-    (float)5.57621e-08,
-    (float)4.20953e-08,
-    (float)3.78562e-08,
-    (float)3.83844e-08,
-    (float)3.77832e-08,
-    (float)4.34643e-08,
-    (float)3.95559e-08,
-    (float)4.44333e-08,
-    (float)6.66761e-08,
-    (float)2.79547e-08,
-    (float)3.69007e-08,
-    (float)4.63898e-08,
-    (float)3.85119e-08,
-    (float)5.31581e-08,
-    (float)5.02359e-08,
-    (float)2.72537e-08,
-    (float)6.03881e-08,
-    (float)3.09824e-08,
-    (float)3.03179e-08,
-    (float)3.01685e-08,
-    (float)3.87891e-08,
-    (float)4.19904e-08,
-    (float)4.37999e-08,
-    (float)4.49939e-08,
-    (float)3.81619e-08,
-    (float)3.38429e-08,
-    (float)4.82579e-08,
-    (float)4.00296e-08,
-    (float)3.57495e-08,
-    (float)4.7063e-08,
-    (float)3.20205e-08,
-    (float)4.09066e-08,
-    (float)3.62833e-08,
-    (float)4.49337e-08,
-    (float)3.15094e-08,
-    (float)4.08833e-08,
-    (float)0.988621,
-    (float)0.00161481,
-    (float)0.00735501,
-    (float)0.00056284,
-    (float)0.0015825,
-    (float)3.61518e-05,
-    (float)1.03046e-05,
-    (float)3.10003e-05,
-    (float)2.79623e-05,
-    (float)3.60348e-05,
-    (float)3.42656e-05,
-    (float)9.78786e-06,
-    (float)9.47432e-06,
-    (float)4.47307e-06,
-    (float)1.45979e-06,
-    (float)4.72167e-06,
-    (float)4.64972e-06,
-    (float)4.51382e-06,
-    (float)4.29756e-06,
-    (float)4.53901e-06,
-    (float)2.08956e-06,
-    (float)3.00452e-06,
-    (float)3.61568e-07,
-    (float)3.67549e-06,
-    (float)2.18369e-09,
-    (float)2.66181e-06,
-    (float)6.39679e-07,
-    (float)6.96667e-07,
-    (float)6.17079e-07,
-    (float)7.65227e-07,
-    (float)4.28698e-07,
-    (float)1.74431e-06,
-    (float)3.26789e-07,
-    (float)6.66989e-07,
-    (float)1.43061e-06,
-    (float)7.74684e-07,
-    (float)5.33974e-07,
-    (float)2.04433e-07,
-    (float)1.22545e-06,
-    (float)5.6119e-07,
-    (float)3.92656e-07,
-    (float)3.33799e-07,
-    (float)6.62577e-07,
-    (float)3.3685e-07,
-    (float)4.40879e-07,
-    (float)1.62522e-07,
-    (float)6.04735e-07,
-    (float)2.67325e-07,
-    (float)3.8379e-07,
-    (float)5.87008e-07,
-    (float)2.51447e-07,
-    (float)2.90081e-07,
-    (float)4.98661e-07,
-    (float)3.27231e-07,
-    (float)2.46167e-07,
-    (float)3.52142e-07,
-    (float)2.65707e-07,
-    (float)3.41791e-07,
-    (float)2.51518e-07,
-    (float)3.72143e-07,
-    (float)1.34941e-07,
-    (float)2.31411e-07,
-    (float)3.10803e-07,
-    (float)2.39572e-07,
-    (float)2.22195e-07,
-    (float)2.21664e-07,
-    (float)1.70203e-07,
-    (float)3.33827e-07,
-    (float)1.95986e-07,
-    (float)1.30406e-07,
-    (float)2.52412e-07,
-    (float)1.97845e-07,
-    (float)2.07845e-07,
-    (float)1.88163e-07,
-    (float)1.76661e-07,
-    (float)2.04478e-07,
-    (float)1.46866e-07,
-    (float)1.27367e-07,
-    (float)2.08382e-07,
-    (float)2.04797e-07,
-    (float)1.60658e-07,
-    (float)1.11324e-07,
-    (float)1.78949e-07,
-    (float)1.50442e-07,
-    (float)1.00751e-07,
-    (float)2.14501e-07,
-    (float)1.66384e-07,
-    (float)9.42752e-08,
-    (float)2.00129e-07,
-    (float)1.30515e-07,
-    (float)1.13368e-07,
-    (float)1.62093e-07,
-    (float)1.24402e-07,
-    (float)1.34544e-07,
-    (float)1.56741e-07,
-    (float)1.2425e-07,
-    (float)1.31837e-07,
-    (float)1.03368e-07,
-    (float)1.12734e-07,
-    (float)1.35464e-07,
-    (float)1.40024e-07,
-    (float)1.18087e-07,
-    (float)1.16133e-07,
-    (float)1.65532e-07,
-    (float)1.09806e-07,
-    (float)8.3146e-08,
-    (float)1.48034e-07,
-    (float)1.27372e-07,
-    (float)1.13792e-07,
-    (float)1.53721e-07,
-    (float)7.73416e-08,
-    (float)1.37715e-07,
-    (float)1.12176e-07,
-    (float)7.00727e-08,
-    (float)1.32032e-07,
-    (float)1.3858e-07,
-    (float)1.10462e-07,
-    (float)1.29455e-07,
-    (float)1.17875e-07,
-    (float)1.27841e-07,
-    (float)9.04539e-08,
-    (float)1.05944e-07,
-    (float)1.53347e-07,
-    (float)9.04086e-08,
-    (float)1.37201e-07,
-    (float)1.04388e-07,
-    (float)9.71328e-08,
-    (float)1.21152e-07,
-    (float)0.978476,
-    (float)0.00288692,
-    (float)0.0143881,
-    (float)0.000962548,
-    (float)0.00273656,
-    (float)6.54909e-05,
-    (float)3.24547e-05,
-    (float)9.81927e-05,
-    (float)5.29283e-05,
-    (float)6.82686e-05,
-    (float)7.06412e-05,
-    (float)1.49936e-05,
-    (float)7.89774e-06,
-    (float)1.00051e-05,
-    (float)2.1567e-06,
-    (float)1.25432e-05,
-    (float)8.52784e-06,
-    (float)9.93358e-06,
-    (float)6.04518e-06,
-    (float)8.87226e-06,
-    (float)2.22751e-06,
-    (float)7.16718e-06,
-    (float)1.28194e-06,
-    (float)7.56156e-06,
-    (float)4.86997e-07,
-    (float)4.30174e-06,
-    (float)2.15475e-06,
-    (float)7.5356e-07,
-    (float)1.77347e-06,
-    (float)1.23366e-06,
-    (float)1.36844e-06,
-    (float)2.42274e-06,
-    (float)1.19267e-06,
-    (float)8.42871e-07,
-    (float)3.45591e-06,
-    (float)5.8765e-07,
-    (float)1.40281e-06,
-    (float)8.77899e-07,
-    (float)2.27281e-06,
-    (float)1.05046e-06,
-    (float)7.84516e-07,
-    (float)9.44296e-07,
-    (float)1.28535e-06,
-    (float)7.33864e-07,
-    (float)7.0019e-07,
-    (float)6.98868e-07,
-    (float)8.83424e-07,
-    (float)9.09368e-07,
-    (float)4.4589e-07,
-    (float)1.17757e-06,
-    (float)4.60236e-07,
-    (float)7.17493e-07,
-    (float)9.51822e-07,
-    (float)7.04476e-07,
-    (float)4.26439e-07,
-    (float)8.7952e-07,
-    (float)5.32116e-07,
-    (float)6.31631e-07,
-    (float)5.78322e-07,
-    (float)5.04227e-07,
-    (float)4.96074e-07,
-    (float)5.00957e-07,
-    (float)6.61395e-07,
-    (float)4.10615e-07,
-    (float)4.72792e-07,
-    (float)4.40755e-07,
-    (float)4.70248e-07,
-    (float)4.65212e-07,
-    (float)4.79868e-07,
-    (float)3.01074e-07,
-    (float)5.65659e-07,
-    (float)3.89912e-07,
-    (float)3.15467e-07,
-    (float)4.46669e-07,
-    (float)3.45694e-07,
-    (float)3.62135e-07,
-    (float)4.07586e-07,
-    (float)3.25808e-07,
-    (float)4.00394e-07,
-    (float)3.9843e-07,
-    (float)2.25622e-07,
-    (float)3.30022e-07,
-    (float)3.95546e-07,
-    (float)3.35559e-07,
-    (float)2.55683e-07,
-    (float)3.49899e-07,
-    (float)2.80938e-07,
-    (float)2.16962e-07,
-    (float)3.3711e-07,
-    (float)3.19097e-07,
-    (float)2.30675e-07,
-    (float)3.67944e-07,
-    (float)2.885e-07,
-    (float)2.12114e-07,
-    (float)3.18009e-07,
-    (float)2.49442e-07,
-    (float)2.88291e-07,
-    (float)3.37343e-07,
-    (float)2.34272e-07,
-    (float)2.45095e-07,
-    (float)2.54989e-07,
-    (float)1.96384e-07,
-    (float)2.39694e-07,
-    (float)2.81354e-07,
-    (float)2.43307e-07,
-    (float)2.41944e-07,
-    (float)2.74775e-07,
-    (float)2.20516e-07,
-    (float)2.16823e-07,
-    (float)2.89163e-07,
-    (float)2.57093e-07,
-    (float)2.57836e-07,
-    (float)2.86002e-07,
-    (float)2.09821e-07,
-    (float)2.28547e-07,
-    (float)2.66685e-07,
-    (float)2.07609e-07,
-    (float)2.29092e-07,
-    (float)2.74135e-07,
-    (float)2.00322e-07,
-    (float)1.81983e-07,
-    (float)2.36012e-07,
-    (float)2.35042e-07,
-    (float)2.3944e-07,
-    (float)2.56494e-07,
-    (float)2.44315e-07,
-    (float)2.37321e-07,
-    (float)2.56532e-07,
-    (float)0.964374,
-    (float)0.00453796,
-    (float)0.0244671,
-    (float)0.00144374,
-    (float)0.00414514,
-    (float)0.000114833,
-    (float)8.26315e-05,
-    (float)0.000256189,
-    (float)9.16092e-05,
-    (float)0.00010486,
-    (float)0.000111952,
-    (float)2.21754e-05,
-    (float)4.23143e-06,
-    (float)2.28188e-05,
-    (float)4.00498e-06,
-    (float)2.53595e-05,
-    (float)1.29485e-05,
-    (float)1.46185e-05,
-    (float)6.59901e-06,
-    (float)1.56339e-05,
-    (float)3.67381e-06,
-    (float)1.31672e-05,
-    (float)4.66417e-06,
-    (float)1.08412e-05,
-    (float)3.14413e-06,
-    (float)4.12925e-06,
-    (float)5.81465e-06,
-    (float)6.48576e-07,
-    (float)4.52539e-06,
-    (float)1.66397e-06,
-    (float)2.82175e-06,
-    (float)2.65483e-06,
-    (float)2.65374e-06,
-    (float)7.90077e-07,
-    (float)5.61423e-06,
-    (float)1.07175e-06,
-    (float)2.32915e-06,
-    (float)3.0527e-06,
-    (float)2.46958e-06,
-    (float)2.20037e-06,
-    (float)1.16646e-06,
-    (float)2.34086e-06,
-    (float)1.81343e-06,
-    (float)1.63089e-06,
-    (float)1.01413e-06,
-    (float)1.92591e-06,
-    (float)1.02337e-06,
-    (float)1.52608e-06,
-    (float)7.33864e-07,
-    (float)1.70837e-06,
-    (float)1.13301e-06,
-    (float)1.02203e-06,
-    (float)1.73185e-06,
-    (float)1.03767e-06,
-    (float)1.00057e-06,
-    (float)1.36518e-06,
-    (float)1.14029e-06,
-    (float)7.89709e-07,
-    (float)1.42132e-06,
-    (float)7.37854e-07,
-    (float)1.08312e-06,
-    (float)8.6414e-07,
-    (float)9.4372e-07,
-    (float)7.3937e-07,
-    (float)7.48906e-07,
-    (float)8.78802e-07,
-    (float)8.60015e-07,
-    (float)7.74203e-07,
-    (float)6.69036e-07,
-    (float)7.16656e-07,
-    (float)7.22292e-07,
-    (float)8.08957e-07,
-    (float)5.33705e-07,
-    (float)9.52749e-07,
-    (float)6.3051e-07,
-    (float)5.65409e-07,
-    (float)7.04176e-07,
-    (float)6.04215e-07,
-    (float)6.2381e-07,
-    (float)7.19001e-07,
-    (float)4.76138e-07,
-    (float)5.99658e-07,
-    (float)6.58075e-07,
-    (float)3.77255e-07,
-    (float)5.55677e-07,
-    (float)5.89173e-07,
-    (float)5.42149e-07,
-    (float)4.13924e-07,
-    (float)5.73988e-07,
-    (float)5.18043e-07,
-    (float)4.48221e-07,
-    (float)5.36716e-07,
-    (float)5.56309e-07,
-    (float)4.3855e-07,
-    (float)5.90204e-07,
-    (float)4.7544e-07,
-    (float)3.61772e-07,
-    (float)5.81108e-07,
-    (float)4.26776e-07,
-    (float)4.47313e-07,
-    (float)4.70494e-07,
-    (float)3.82753e-07,
-    (float)4.13376e-07,
-    (float)4.36705e-07,
-    (float)3.26299e-07,
-    (float)4.95537e-07,
-    (float)4.74611e-07,
-    (float)4.29666e-07,
-    (float)4.58558e-07,
-    (float)4.45849e-07,
-    (float)4.56339e-07,
-    (float)3.70349e-07,
-    (float)5.015e-07,
-    (float)4.56508e-07,
-    (float)3.78239e-07,
-    (float)4.27059e-07,
-    (float)4.03041e-07,
-    (float)3.42779e-07,
-    (float)4.54523e-07,
-    (float)3.35524e-07,
-    (float)4.01011e-07,
-    (float)4.70615e-07,
-    (float)3.45528e-07,
-    (float)4.00395e-07,
-    (float)4.21966e-07,
-    (float)4.62875e-07,
-    (float)4.28931e-07,
-    (float)4.21358e-07,
-    (float)0.945827,
-    (float)0.00655184,
-    (float)0.0380734,
-    (float)0.00199068,
-    (float)0.00575075,
-    (float)0.000206721,
-    (float)0.000177509,
-    (float)0.000565388,
-    (float)0.000149035,
-    (float)0.000136167,
-    (float)0.000143843,
-    (float)3.34477e-05,
-    (float)5.47179e-06,
-    (float)4.8922e-05,
-    (float)6.92458e-06,
-    (float)3.98549e-05,
-    (float)1.90407e-05,
-    (float)1.65812e-05,
-    (float)6.59193e-06,
-    (float)2.43236e-05,
-    (float)9.04677e-06,
-    (float)1.96949e-05,
-    (float)1.17248e-05,
-    (float)1.07791e-05,
-    (float)9.8293e-06,
-    (float)2.37621e-06,
-    (float)1.20333e-05,
-    (float)7.14978e-07,
-    (float)8.11465e-06,
-    (float)3.20008e-06,
-    (float)4.11008e-06,
-    (float)3.26073e-06,
-    (float)4.00065e-06,
-    (float)1.65664e-06,
-    (float)6.91203e-06,
-    (float)2.98918e-06,
-    (float)2.33661e-06,
-    (float)7.07288e-06,
-    (float)1.88207e-06,
-    (float)3.78129e-06,
-    (float)2.16916e-06,
-    (float)3.82562e-06,
-    (float)2.906e-06,
-    (float)2.61664e-06,
-    (float)1.86486e-06,
-    (float)3.11137e-06,
-    (float)1.78375e-06,
-    (float)1.77116e-06,
-    (float)2.26195e-06,
-    (float)1.69995e-06,
-    (float)2.38104e-06,
-    (float)1.20215e-06,
-    (float)2.71165e-06,
-    (float)1.50381e-06,
-    (float)1.57415e-06,
-    (float)2.19421e-06,
-    (float)2.01559e-06,
-    (float)1.19234e-06,
-    (float)2.10614e-06,
-    (float)1.39358e-06,
-    (float)1.26743e-06,
-    (float)1.94261e-06,
-    (float)1.01631e-06,
-    (float)1.59119e-06,
-    (float)1.18428e-06,
-    (float)1.34796e-06,
-    (float)1.29163e-06,
-    (float)1.17266e-06,
-    (float)1.00462e-06,
-    (float)1.47913e-06,
-    (float)1.11134e-06,
-    (float)1.13874e-06,
-    (float)1.04841e-06,
-    (float)1.00679e-06,
-    (float)1.21844e-06,
-    (float)7.71461e-07,
-    (float)1.32364e-06,
-    (float)1.00468e-06,
-    (float)8.60013e-07,
-    (float)9.71369e-07,
-    (float)8.81663e-07,
-    (float)8.03816e-07,
-    (float)1.27484e-06,
-    (float)7.0453e-07,
-    (float)8.73886e-07,
-    (float)1.0253e-06,
-    (float)5.17794e-07,
-    (float)9.59498e-07,
-    (float)9.19505e-07,
-    (float)7.90345e-07,
-    (float)7.28223e-07,
-    (float)8.04615e-07,
-    (float)6.993e-07,
-    (float)7.3732e-07,
-    (float)6.66483e-07,
-    (float)9.78583e-07,
-    (float)7.13199e-07,
-    (float)7.16616e-07,
-    (float)8.03288e-07,
-    (float)5.4426e-07,
-    (float)8.62284e-07,
-    (float)7.18785e-07,
-    (float)7.38919e-07,
-    (float)7.45179e-07,
-    (float)6.26227e-07,
-    (float)6.16302e-07,
-    (float)8.43606e-07,
-    (float)4.7857e-07,
-    (float)7.49189e-07,
-    (float)8.02706e-07,
-    (float)5.20698e-07,
-    (float)6.70163e-07,
-    (float)5.57041e-07,
-    (float)7.23004e-07,
-    (float)7.08669e-07,
-    (float)6.9066e-07,
-    (float)6.62122e-07,
-    (float)6.92106e-07,
-    (float)5.37301e-07,
-    (float)8.12916e-07,
-    (float)6.23377e-07,
-    (float)6.8363e-07,
-    (float)7.38168e-07,
-    (float)5.20599e-07,
-    (float)7.23014e-07,
-    (float)5.27345e-07,
-    (float)6.48232e-07,
-    (float)7.59752e-07,
-    (float)0.922416,
-    (float)0.00890779,
-    (float)0.0556402,
-    (float)0.00257729,
-    (float)0.00747725,
-    (float)0.000381454,
-    (float)0.000330329,
-    (float)0.00109152,
-    (float)0.000227453,
-    (float)0.000152586,
-    (float)0.000151025,
-    (float)5.30531e-05,
-    (float)2.09758e-05,
-    (float)9.37083e-05,
-    (float)9.02116e-06,
-    (float)4.77041e-05,
-    (float)2.71056e-05,
-    (float)1.70288e-05,
-    (float)9.86064e-06,
-    (float)3.23828e-05,
-    (float)1.78374e-05,
-    (float)2.4372e-05,
-    (float)2.45577e-05,
-    (float)7.25937e-06,
-    (float)1.95834e-05,
-    (float)2.245e-06,
-    (float)1.88021e-05,
-    (float)3.01563e-06,
-    (float)9.92036e-06,
-    (float)6.74833e-06,
-    (float)4.53304e-06,
-    (float)5.78403e-06,
-    (float)4.14618e-06,
-    (float)4.68174e-06,
-    (float)6.30887e-06,
-    (float)6.12438e-06,
-    (float)1.77938e-06,
-    (float)1.05099e-05,
-    (float)2.66883e-06,
-    (float)4.85437e-06,
-    (float)5.69334e-06,
-    (float)4.43346e-06,
-    (float)4.70498e-06,
-    (float)3.22667e-06,
-    (float)3.65793e-06,
-    (float)3.70678e-06,
-    (float)4.01994e-06,
-    (float)1.78731e-06,
-    (float)4.22558e-06,
-    (float)2.10571e-06,
-    (float)2.84365e-06,
-    (float)2.36158e-06,
-    (float)2.91454e-06,
-    (float)2.72442e-06,
-    (float)2.10861e-06,
-    (float)3.3488e-06,
-    (float)2.38699e-06,
-    (float)2.29792e-06,
-    (float)2.37776e-06,
-    (float)2.82945e-06,
-    (float)1.68259e-06,
-    (float)3.0342e-06,
-    (float)1.79635e-06,
-    (float)1.88497e-06,
-    (float)2.34606e-06,
-    (float)1.62082e-06,
-    (float)2.03767e-06,
-    (float)1.71591e-06,
-    (float)1.66844e-06,
-    (float)1.78351e-06,
-    (float)1.81947e-06,
-    (float)1.1126e-06,
-    (float)1.95985e-06,
-    (float)1.47885e-06,
-    (float)1.51541e-06,
-    (float)1.54338e-06,
-    (float)1.48011e-06,
-    (float)1.52477e-06,
-    (float)1.26396e-06,
-    (float)1.64156e-06,
-    (float)1.46192e-06,
-    (float)1.46146e-06,
-    (float)1.28052e-06,
-    (float)1.36746e-06,
-    (float)1.10752e-06,
-    (float)1.64773e-06,
-    (float)1.05893e-06,
-    (float)1.12108e-06,
-    (float)1.42791e-06,
-    (float)8.65812e-07,
-    (float)1.08061e-06,
-    (float)1.25056e-06,
-    (float)1.10107e-06,
-    (float)9.34648e-07,
-    (float)1.20417e-06,
-    (float)9.08813e-07,
-    (float)1.28731e-06,
-    (float)1.03166e-06,
-    (float)1.20235e-06,
-    (float)1.22993e-06,
-    (float)1.00268e-06,
-    (float)1.12513e-06,
-    (float)9.99478e-07,
-    (float)1.17303e-06,
-    (float)9.95695e-07,
-    (float)1.05841e-06,
-    (float)8.19908e-07,
-    (float)1.01583e-06,
-    (float)8.39335e-07,
-    (float)1.04794e-06,
-    (float)8.36759e-07,
-    (float)8.99061e-07,
-    (float)1.10218e-06,
-    (float)7.93005e-07,
-    (float)1.03791e-06,
-    (float)9.80717e-07,
-    (float)1.13842e-06,
-    (float)9.63504e-07,
-    (float)1.09433e-06,
-    (float)9.05941e-07,
-    (float)1.16678e-06,
-    (float)9.26336e-07,
-    (float)9.49383e-07,
-    (float)1.10862e-06,
-    (float)7.33979e-07,
-    (float)9.53291e-07,
-    (float)8.39433e-07,
-    (float)9.62484e-07,
-    (float)0.893722,
-    (float)0.0115434,
-    (float)0.0775978,
-    (float)0.00319142,
-    (float)0.00923952,
-    (float)0.000707772,
-    (float)0.000549891,
-    (float)0.00189438,
-    (float)0.000329982,
-    (float)0.00015373,
-    (float)0.000131056,
-    (float)8.27528e-05,
-    (float)5.52159e-05,
-    (float)0.000159608,
-    (float)1.09092e-05,
-    (float)4.49333e-05,
-    (float)4.04902e-05,
-    (float)1.68843e-05,
-    (float)2.0839e-05,
-    (float)3.86117e-05,
-    (float)2.70592e-05,
-    (float)2.41766e-05,
-    (float)4.16525e-05,
-    (float)5.27816e-06,
-    (float)3.01961e-05,
-    (float)7.59479e-06,
-    (float)2.11215e-05,
-    (float)1.10046e-05,
-    (float)8.46463e-06,
-    (float)1.3207e-05,
-    (float)3.82145e-06,
-    (float)1.0409e-05,
-    (float)4.81194e-06,
-    (float)9.0761e-06,
-    (float)5.76947e-06,
-    (float)8.01574e-06,
-    (float)2.6751e-06,
-    (float)1.15156e-05,
-    (float)6.32339e-06,
-    (float)4.50096e-06,
-    (float)1.12068e-05,
-    (float)3.95329e-06,
-    (float)6.78764e-06,
-    (float)4.92628e-06,
-    (float)5.58447e-06,
-    (float)5.18124e-06,
-    (float)5.60157e-06,
-    (float)3.08881e-06,
-    (float)4.95064e-06,
-    (float)4.37852e-06,
-    (float)2.54101e-06,
-    (float)5.10813e-06,
-    (float)2.96243e-06,
-    (float)3.84221e-06,
-    (float)2.96673e-06,
-    (float)4.15488e-06,
-    (float)3.29129e-06,
-    (float)3.17815e-06,
-    (float)3.80222e-06,
-    (float)3.53902e-06,
-    (float)3.00292e-06,
-    (float)3.01358e-06,
-    (float)3.3455e-06,
-    (float)2.2758e-06,
-    (float)3.76759e-06,
-    (float)2.39493e-06,
-    (float)2.47811e-06,
-    (float)2.65643e-06,
-    (float)2.14886e-06,
-    (float)2.65204e-06,
-    (float)2.46861e-06,
-    (float)1.95662e-06,
-    (float)2.37335e-06,
-    (float)2.4308e-06,
-    (float)1.50754e-06,
-    (float)2.61726e-06,
-    (float)2.13423e-06,
-    (float)1.95002e-06,
-    (float)2.06849e-06,
-    (float)1.90076e-06,
-    (float)1.93657e-06,
-    (float)1.93398e-06,
-    (float)2.03763e-06,
-    (float)1.87219e-06,
-    (float)1.77866e-06,
-    (float)1.64917e-06,
-    (float)1.82854e-06,
-    (float)1.53189e-06,
-    (float)2.06532e-06,
-    (float)1.51823e-06,
-    (float)1.50369e-06,
-    (float)1.73854e-06,
-    (float)1.27477e-06,
-    (float)1.58478e-06,
-    (float)1.77699e-06,
-    (float)1.51997e-06,
-    (float)1.42275e-06,
-    (float)1.5765e-06,
-    (float)1.2338e-06,
-    (float)1.7746e-06,
-    (float)1.40305e-06,
-    (float)1.48439e-06,
-    (float)1.59736e-06,
-    (float)1.2044e-06,
-    (float)1.49245e-06,
-    (float)1.43559e-06,
-    (float)1.48809e-06,
-    (float)1.37464e-06,
-    (float)1.50094e-06,
-    (float)1.14365e-06,
-    (float)1.39221e-06,
-    (float)1.35942e-06,
-    (float)1.47239e-06,
-    (float)1.35211e-06,
-    (float)1.25093e-06,
-    (float)1.45855e-06,
-    (float)1.10234e-06,
-    (float)1.5932e-06,
-    (float)1.30659e-06,
-    (float)1.40966e-06,
-    (float)1.37777e-06,
-    (float)1.22389e-06,
-    (float)1.27356e-06,
-    (float)1.48744e-06,
-    (float)1.28087e-06,
-    (float)1.34478e-06,
-    (float)1.56255e-06,
-    (float)8.84565e-07,
-    (float)0.859355,
-    (float)0.0144107,
-    (float)0.104301,
-    (float)0.00381656,
-    (float)0.0109506,
-    (float)0.00128997,
-    (float)0.000837156,
-    (float)0.00302076,
-    (float)0.00045764,
-    (float)0.000151035,
-    (float)9.87763e-05,
-    (float)0.000126446,
-    (float)0.000104375,
-    (float)0.000238438,
-    (float)1.56994e-05,
-    (float)3.25491e-05,
-    (float)6.17529e-05,
-    (float)1.69665e-05,
-    (float)3.94283e-05,
-    (float)4.60864e-05,
-    (float)3.39434e-05,
-    (float)1.92324e-05,
-    (float)5.90143e-05,
-    (float)9.38376e-06,
-    (float)3.97445e-05,
-    (float)2.3369e-05,
-    (float)1.62346e-05,
-    (float)2.48004e-05,
-    (float)5.10523e-06,
-    (float)2.15585e-05,
-    (float)5.4673e-06,
-    (float)1.38517e-05,
-    (float)8.00377e-06,
-    (float)1.16873e-05,
-    (float)7.55898e-06,
-    (float)7.44049e-06,
-    (float)7.68303e-06,
-    (float)1.02255e-05,
-    (float)1.14256e-05,
-    (float)3.33457e-06,
-    (float)1.52406e-05,
-    (float)6.08298e-06,
-    (float)7.39555e-06,
-    (float)1.05061e-05,
-    (float)6.26773e-06,
-    (float)7.75711e-06,
-    (float)6.30344e-06,
-    (float)5.41588e-06,
-    (float)5.8596e-06,
-    (float)7.8097e-06,
-    (float)2.79753e-06,
-    (float)6.7773e-06,
-    (float)4.85554e-06,
-    (float)3.36146e-06,
-    (float)6.18853e-06,
-    (float)4.07332e-06,
-    (float)4.57532e-06,
-    (float)4.09529e-06,
-    (float)4.98887e-06,
-    (float)4.33552e-06,
-    (float)4.30468e-06,
-    (float)3.88931e-06,
-    (float)4.71161e-06,
-    (float)3.88966e-06,
-    (float)3.81152e-06,
-    (float)4.21734e-06,
-    (float)2.72207e-06,
-    (float)4.36583e-06,
-    (float)3.32402e-06,
-    (float)3.20508e-06,
-    (float)3.53235e-06,
-    (float)2.56139e-06,
-    (float)3.23116e-06,
-    (float)3.43775e-06,
-    (float)2.27679e-06,
-    (float)3.20652e-06,
-    (float)3.27052e-06,
-    (float)1.64474e-06,
-    (float)3.15093e-06,
-    (float)2.95217e-06,
-    (float)2.24674e-06,
-    (float)2.81956e-06,
-    (float)2.17152e-06,
-    (float)2.29206e-06,
-    (float)2.88011e-06,
-    (float)2.23031e-06,
-    (float)2.59922e-06,
-    (float)2.64333e-06,
-    (float)1.86801e-06,
-    (float)2.56186e-06,
-    (float)2.3098e-06,
-    (float)2.36519e-06,
-    (float)2.26739e-06,
-    (float)1.87994e-06,
-    (float)2.16106e-06,
-    (float)1.96828e-06,
-    (float)1.82309e-06,
-    (float)2.32059e-06,
-    (float)1.89391e-06,
-    (float)1.48438e-06,
-    (float)2.12964e-06,
-    (float)1.67076e-06,
-    (float)2.2688e-06,
-    (float)1.99266e-06,
-    (float)1.57845e-06,
-    (float)2.26922e-06,
-    (float)1.83433e-06,
-    (float)1.96622e-06,
-    (float)2.44937e-06,
-    (float)1.81177e-06,
-    (float)1.66419e-06,
-    (float)2.37981e-06,
-    (float)1.44025e-06,
-    (float)1.98633e-06,
-    (float)2.18372e-06,
-    (float)1.30434e-06,
-    (float)1.79669e-06,
-    (float)1.52756e-06,
-    (float)1.77757e-06,
-    (float)1.94258e-06,
-    (float)1.6409e-06,
-    (float)1.52632e-06,
-    (float)2.03838e-06,
-    (float)1.66188e-06,
-    (float)1.89709e-06,
-    (float)2.28829e-06,
-    (float)1.66825e-06,
-    (float)1.94265e-06,
-    (float)0.819282,
-    (float)0.0174146,
-    (float)0.135838,
-    (float)0.00443042,
-    (float)0.0125424,
-    (float)0.00226232,
-    (float)0.00117591,
-    (float)0.00445346,
-    (float)0.000599024,
-    (float)0.000173213,
-    (float)0.000100514,
-    (float)0.000189417,
-    (float)0.000148909,
-    (float)0.000304446,
-    (float)3.06698e-05,
-    (float)2.47206e-05,
-    (float)9.6543e-05,
-    (float)1.31822e-05,
-    (float)5.63242e-05,
-    (float)5.51481e-05,
-    (float)4.08884e-05,
-    (float)1.43402e-05,
-    (float)6.99422e-05,
-    (float)1.89543e-05,
-    (float)4.28663e-05,
-    (float)5.1409e-05,
-    (float)7.80694e-06,
-    (float)3.90724e-05,
-    (float)6.82102e-06,
-    (float)2.50919e-05,
-    (float)1.47884e-05,
-    (float)1.45621e-05,
-    (float)1.34799e-05,
-    (float)1.02867e-05,
-    (float)1.29162e-05,
-    (float)6.58226e-06,
-    (float)1.65041e-05,
-    (float)8.06164e-06,
-    (float)1.23886e-05,
-    (float)5.81766e-06,
-    (float)1.44823e-05,
-    (float)1.24825e-05,
-    (float)6.88402e-06,
-    (float)1.59082e-05,
-    (float)6.91335e-06,
-    (float)1.02614e-05,
-    (float)9.67206e-06,
-    (float)8.05894e-06,
-    (float)8.15774e-06,
-    (float)8.70968e-06,
-    (float)5.51264e-06,
-    (float)6.35458e-06,
-    (float)9.32078e-06,
-    (float)3.21939e-06,
-    (float)8.03494e-06,
-    (float)5.9255e-06,
-    (float)4.16104e-06,
-    (float)6.70842e-06,
-    (float)5.64093e-06,
-    (float)5.21939e-06,
-    (float)5.35802e-06,
-    (float)5.91813e-06,
-    (float)4.80674e-06,
-    (float)6.14796e-06,
-    (float)4.53364e-06,
-    (float)5.21171e-06,
-    (float)5.53411e-06,
-    (float)4.2574e-06,
-    (float)5.11238e-06,
-    (float)3.88072e-06,
-    (float)4.52489e-06,
-    (float)4.20227e-06,
-    (float)4.04999e-06,
-    (float)4.05353e-06,
-    (float)3.25358e-06,
-    (float)3.69334e-06,
-    (float)3.94567e-06,
-    (float)3.11384e-06,
-    (float)3.48646e-06,
-    (float)3.93557e-06,
-    (float)2.46565e-06,
-    (float)3.51422e-06,
-    (float)3.91543e-06,
-    (float)2.69462e-06,
-    (float)3.5304e-06,
-    (float)3.11989e-06,
-    (float)2.76597e-06,
-    (float)3.88955e-06,
-    (float)2.99721e-06,
-    (float)2.79491e-06,
-    (float)3.32835e-06,
-    (float)2.47268e-06,
-    (float)2.80951e-06,
-    (float)3.17804e-06,
-    (float)2.50342e-06,
-    (float)2.52639e-06,
-    (float)2.68598e-06,
-    (float)2.29815e-06,
-    (float)2.69576e-06,
-    (float)2.57678e-06,
-    (float)2.35713e-06,
-    (float)2.65823e-06,
-    (float)2.24767e-06,
-    (float)2.56992e-06,
-    (float)2.65053e-06,
-    (float)2.74787e-06,
-    (float)2.4084e-06,
-    (float)2.40058e-06,
-    (float)2.79035e-06,
-    (float)2.45478e-06,
-    (float)2.5144e-06,
-    (float)2.5404e-06,
-    (float)2.41201e-06,
-    (float)2.05654e-06,
-    (float)2.67871e-06,
-    (float)2.23222e-06,
-    (float)2.06603e-06,
-    (float)2.64928e-06,
-    (float)1.9052e-06,
-    (float)2.30651e-06,
-    (float)2.41615e-06,
-    (float)2.16627e-06,
-    (float)2.33686e-06,
-    (float)2.60628e-06,
-    (float)2.09033e-06,
-    (float)2.4218e-06,
-    (float)2.82217e-06,
-    (float)1.97922e-06,
-    (float)0.773371,
-    (float)0.0204458,
-    (float)0.172294,
-    (float)0.0050241,
-    (float)0.0139308,
-    (float)0.00380796,
-    (float)0.00154682,
-    (float)0.00617227,
-    (float)0.000751315,
-    (float)0.000253163,
-    (float)0.000212646,
-    (float)0.000276068,
-    (float)0.000174215,
-    (float)0.000330098,
-    (float)5.99949e-05,
-    (float)3.54415e-05,
-    (float)0.000153666,
-    (float)5.76159e-06,
-    (float)6.37785e-05,
-    (float)6.88054e-05,
-    (float)4.78749e-05,
-    (float)1.83976e-05,
-    (float)7.30462e-05,
-    (float)3.24888e-05,
-    (float)3.72711e-05,
-    (float)8.30193e-05,
-    (float)4.52002e-06,
-    (float)4.94193e-05,
-    (float)2.33802e-05,
-    (float)2.03484e-05,
-    (float)3.13454e-05,
-    (float)1.11494e-05,
-    (float)2.03407e-05,
-    (float)1.06538e-05,
-    (float)1.91659e-05,
-    (float)8.44329e-06,
-    (float)2.11559e-05,
-    (float)1.0612e-05,
-    (float)9.06701e-06,
-    (float)1.57931e-05,
-    (float)1.16419e-05,
-    (float)1.72887e-05,
-    (float)6.77881e-06,
-    (float)1.73191e-05,
-    (float)1.21017e-05,
-    (float)1.10919e-05,
-    (float)1.56902e-05,
-    (float)8.42694e-06,
-    (float)1.20153e-05,
-    (float)9.79827e-06,
-    (float)9.1543e-06,
-    (float)8.22459e-06,
-    (float)1.10162e-05,
-    (float)5.73785e-06,
-    (float)7.49381e-06,
-    (float)1.065e-05,
-    (float)3.86335e-06,
-    (float)9.61367e-06,
-    (float)7.31602e-06,
-    (float)5.32379e-06,
-    (float)7.70832e-06,
-    (float)6.96256e-06,
-    (float)6.24976e-06,
-    (float)6.72235e-06,
-    (float)6.94371e-06,
-    (float)5.16555e-06,
-    (float)7.58053e-06,
-    (float)5.46625e-06,
-    (float)5.58693e-06,
-    (float)6.81068e-06,
-    (float)4.58161e-06,
-    (float)5.74122e-06,
-    (float)5.0651e-06,
-    (float)5.06465e-06,
-    (float)5.01354e-06,
-    (float)5.08059e-06,
-    (float)4.60455e-06,
-    (float)3.97705e-06,
-    (float)5.11965e-06,
-    (float)4.66746e-06,
-    (float)4.01968e-06,
-    (float)4.17983e-06,
-    (float)4.37721e-06,
-    (float)3.39341e-06,
-    (float)4.0998e-06,
-    (float)4.8517e-06,
-    (float)3.20841e-06,
-    (float)3.86755e-06,
-    (float)3.727e-06,
-    (float)3.32679e-06,
-    (float)4.57902e-06,
-    (float)3.44664e-06,
-    (float)3.18736e-06,
-    (float)3.92477e-06,
-    (float)3.36293e-06,
-    (float)3.56376e-06,
-    (float)4.24673e-06,
-    (float)3.07816e-06,
-    (float)2.91458e-06,
-    (float)3.87384e-06,
-    (float)3.09878e-06,
-    (float)3.4999e-06,
-    (float)3.37334e-06,
-    (float)2.48492e-06,
-    (float)3.18203e-06,
-    (float)3.15481e-06,
-    (float)3.01277e-06,
-    (float)3.06591e-06,
-    (float)3.03717e-06,
-    (float)2.61748e-06,
-    (float)2.93171e-06,
-    (float)3.68042e-06,
-    (float)2.9385e-06,
-    (float)3.06105e-06,
-    (float)3.03176e-06,
-    (float)2.97299e-06,
-    (float)3.31216e-06,
-    (float)3.74941e-06,
-    (float)2.82611e-06,
-    (float)2.54955e-06,
-    (float)3.74104e-06,
-    (float)2.67981e-06,
-    (float)3.16027e-06,
-    (float)3.33248e-06,
-    (float)2.22386e-06,
-    (float)2.83899e-06,
-    (float)3.01998e-06,
-    (float)2.74182e-06,
-    (float)0.721881,
-    (float)0.0234004,
-    (float)0.213368,
-    (float)0.0055947,
-    (float)0.015056,
-    (float)0.0061603,
-    (float)0.0019309,
-    (float)0.00806799,
-    (float)0.000905679,
-    (float)0.000423279,
-    (float)0.000533919,
-    (float)0.000398303,
-    (float)0.000171214,
-    (float)0.000286917,
-    (float)0.000103807,
-    (float)6.68328e-05,
-    (float)0.000234234,
-    (float)1.47583e-06,
-    (float)6.02232e-05,
-    (float)8.57298e-05,
-    (float)4.91049e-05,
-    (float)3.37349e-05,
-    (float)7.62125e-05,
-    (float)5.10036e-05,
-    (float)2.37387e-05,
-    (float)0.000102465,
-    (float)1.00991e-05,
-    (float)5.47378e-05,
-    (float)6.08535e-05,
-    (float)9.70495e-06,
-    (float)4.84504e-05,
-    (float)1.04933e-05,
-    (float)2.43146e-05,
-    (float)2.26227e-05,
-    (float)2.06122e-05,
-    (float)1.31799e-05,
-    (float)1.72732e-05,
-    (float)1.80362e-05,
-    (float)6.87078e-06,
-    (float)2.80493e-05,
-    (float)9.77424e-06,
-    (float)1.44234e-05,
-    (float)1.38757e-05,
-    (float)1.43859e-05,
-    (float)2.06028e-05,
-    (float)1.00523e-05,
-    (float)1.87148e-05,
-    (float)1.24503e-05,
-    (float)1.54576e-05,
-    (float)1.53188e-05,
-    (float)1.08369e-05,
-    (float)1.33126e-05,
-    (float)1.10199e-05,
-    (float)1.10809e-05,
-    (float)8.18082e-06,
-    (float)1.31255e-05,
-    (float)6.40854e-06,
-    (float)8.53904e-06,
-    (float)1.25192e-05,
-    (float)4.18969e-06,
-    (float)1.01833e-05,
-    (float)8.85403e-06,
-    (float)6.19405e-06,
-    (float)8.56247e-06,
-    (float)8.04126e-06,
-    (float)6.60234e-06,
-    (float)8.17959e-06,
-    (float)8.43704e-06,
-    (float)5.60677e-06,
-    (float)9.57804e-06,
-    (float)6.10867e-06,
-    (float)6.51505e-06,
-    (float)9.65024e-06,
-    (float)4.69363e-06,
-    (float)6.91479e-06,
-    (float)6.84087e-06,
-    (float)5.26449e-06,
-    (float)6.39317e-06,
-    (float)6.10029e-06,
-    (float)4.92629e-06,
-    (float)4.67022e-06,
-    (float)5.73568e-06,
-    (float)4.86385e-06,
-    (float)4.99555e-06,
-    (float)4.2741e-06,
-    (float)4.74098e-06,
-    (float)4.83779e-06,
-    (float)4.0396e-06,
-    (float)5.77545e-06,
-    (float)4.12647e-06,
-    (float)4.23986e-06,
-    (float)5.45439e-06,
-    (float)4.37208e-06,
-    (float)5.29882e-06,
-    (float)4.4929e-06,
-    (float)3.98723e-06,
-    (float)5.29287e-06,
-    (float)4.64123e-06,
-    (float)3.74276e-06,
-    (float)4.91007e-06,
-    (float)3.82791e-06,
-    (float)3.07059e-06,
-    (float)5.31216e-06,
-    (float)3.28383e-06,
-    (float)3.0545e-06,
-    (float)4.40629e-06,
-    (float)2.75172e-06,
-    (float)3.95648e-06,
-    (float)4.13449e-06,
-    (float)2.75274e-06,
-    (float)3.98913e-06,
-    (float)4.33005e-06,
-    (float)3.12299e-06,
-    (float)4.44013e-06,
-    (float)4.61056e-06,
-    (float)2.99669e-06,
-    (float)4.71107e-06,
-    (float)4.35844e-06,
-    (float)3.48153e-06,
-    (float)4.44589e-06,
-    (float)3.54185e-06,
-    (float)3.74687e-06,
-    (float)3.78697e-06,
-    (float)3.63632e-06,
-    (float)3.49971e-06,
-    (float)3.05921e-06,
-    (float)3.516e-06,
-    (float)3.6026e-06,
-    (float)0.665635,
-    (float)0.0261032,
-    (float)0.258426,
-    (float)0.00610773,
-    (float)0.015885,
-    (float)0.00952072,
-    (float)0.00227598,
-    (float)0.00997976,
-    (float)0.00105971,
-    (float)0.000699157,
-    (float)0.00113844,
-    (float)0.00055276,
-    (float)0.000159309,
-    (float)0.000185588,
-    (float)0.000161684,
-    (float)0.000100464,
-    (float)0.000310564,
-    (float)1.3039e-05,
-    (float)6.2744e-05,
-    (float)0.000111644,
-    (float)3.53276e-05,
-    (float)5.26149e-05,
-    (float)7.90777e-05,
-    (float)7.52156e-05,
-    (float)1.46883e-05,
-    (float)0.000100578,
-    (float)2.55936e-05,
-    (float)4.6266e-05,
-    (float)0.000102676,
-    (float)3.54564e-06,
-    (float)5.63322e-05,
-    (float)3.04445e-05,
-    (float)1.96332e-05,
-    (float)4.00696e-05,
-    (float)1.65057e-05,
-    (float)1.87638e-05,
-    (float)1.80402e-05,
-    (float)2.70219e-05,
-    (float)8.02463e-06,
-    (float)2.83489e-05,
-    (float)1.63199e-05,
-    (float)8.72502e-06,
-    (float)3.01855e-05,
-    (float)1.12851e-05,
-    (float)1.98396e-05,
-    (float)1.45361e-05,
-    (float)1.65153e-05,
-    (float)2.07701e-05,
-    (float)1.53192e-05,
-    (float)1.83097e-05,
-    (float)1.2183e-05,
-    (float)1.94252e-05,
-    (float)1.34999e-05,
-    (float)1.28783e-05,
-    (float)1.41598e-05,
-    (float)1.08994e-05,
-    (float)1.2932e-05,
-    (float)8.59836e-06,
-    (float)1.40982e-05,
-    (float)8.01401e-06,
-    (float)9.50366e-06,
-    (float)1.35316e-05,
-    (float)6.41426e-06,
-    (float)1.0692e-05,
-    (float)9.89548e-06,
-    (float)8.93418e-06,
-    (float)9.20894e-06,
-    (float)9.2495e-06,
-    (float)8.00117e-06,
-    (float)8.79861e-06,
-    (float)1.03451e-05,
-    (float)6.10176e-06,
-    (float)9.9251e-06,
-    (float)7.53295e-06,
-    (float)6.56238e-06,
-    (float)1.04832e-05,
-    (float)5.56875e-06,
-    (float)6.9259e-06,
-    (float)8.3033e-06,
-    (float)6.19861e-06,
-    (float)6.38781e-06,
-    (float)7.43611e-06,
-    (float)5.57599e-06,
-    (float)5.27278e-06,
-    (float)7.87275e-06,
-    (float)5.14012e-06,
-    (float)5.76398e-06,
-    (float)6.06097e-06,
-    (float)4.86188e-06,
-    (float)6.46786e-06,
-    (float)5.34228e-06,
-    (float)5.34772e-06,
-    (float)5.28956e-06,
-    (float)5.10061e-06,
-    (float)5.5985e-06,
-    (float)5.62854e-06,
-    (float)5.19281e-06,
-    (float)4.49189e-06,
-    (float)5.5113e-06,
-    (float)5.27953e-06,
-    (float)5.05961e-06,
-    (float)4.91145e-06,
-    (float)4.62299e-06,
-    (float)5.11318e-06,
-    (float)4.64065e-06,
-    (float)5.31149e-06,
-    (float)4.56041e-06,
-    (float)4.1486e-06,
-    (float)5.15111e-06,
-    (float)4.4195e-06,
-    (float)4.64582e-06,
-    (float)4.90758e-06,
-    (float)3.90033e-06,
-    (float)4.20166e-06,
-    (float)5.39131e-06,
-    (float)4.13881e-06,
-    (float)3.98283e-06,
-    (float)5.17054e-06,
-    (float)3.83711e-06,
-    (float)4.33592e-06,
-    (float)5.37904e-06,
-    (float)3.93362e-06,
-    (float)4.24375e-06,
-    (float)4.86131e-06,
-    (float)4.19698e-06,
-    (float)4.86547e-06,
-    (float)4.71575e-06,
-    (float)3.81195e-06,
-    (float)0.605211,
-    (float)0.0284467,
-    (float)0.306687,
-    (float)0.00657995,
-    (float)0.0164134,
-    (float)0.0141623,
-    (float)0.00257413,
-    (float)0.0117709,
-    (float)0.00125688,
-    (float)0.00106779,
-    (float)0.00207982,
-    (float)0.000738157,
-    (float)0.000190376,
-    (float)8.35731e-05,
-    (float)0.000231927,
-    (float)0.000111211,
-    (float)0.000342404,
-    (float)4.79586e-05,
-    (float)8.1348e-05,
-    (float)0.000155519,
-    (float)1.20112e-05,
-    (float)6.96428e-05,
-    (float)8.36209e-05,
-    (float)8.98538e-05,
-    (float)1.92341e-05,
-    (float)9.04191e-05,
-    (float)5.79526e-05,
-    (float)3.04512e-05,
-    (float)0.000121174,
-    (float)7.02779e-06,
-    (float)5.75123e-05,
-    (float)7.66764e-05,
-    (float)1.20168e-05,
-    (float)5.24929e-05,
-    (float)1.7658e-05,
-    (float)2.34812e-05,
-    (float)3.16275e-05,
-    (float)2.6513e-05,
-    (float)1.2456e-05,
-    (float)2.0652e-05,
-    (float)2.94828e-05,
-    (float)6.39107e-06,
-    (float)3.53948e-05,
-    (float)1.48849e-05,
-    (float)1.24428e-05,
-    (float)2.98512e-05,
-    (float)1.35494e-05,
-    (float)2.25171e-05,
-    (float)1.64884e-05,
-    (float)1.87996e-05,
-    (float)1.96781e-05,
-    (float)2.05291e-05,
-    (float)1.79865e-05,
-    (float)1.27602e-05,
-    (float)2.34354e-05,
-    (float)1.26788e-05,
-    (float)1.4919e-05,
-    (float)1.56993e-05,
-    (float)1.13647e-05,
-    (float)1.51528e-05,
-    (float)1.00686e-05,
-    (float)1.43321e-05,
-    (float)9.55388e-06,
-    (float)1.07752e-05,
-    (float)1.38559e-05,
-    (float)8.42559e-06,
-    (float)1.10237e-05,
-    (float)9.92581e-06,
-    (float)1.12049e-05,
-    (float)9.51139e-06,
-    (float)9.63549e-06,
-    (float)9.75541e-06,
-    (float)8.99246e-06,
-    (float)1.13385e-05,
-    (float)7.3911e-06,
-    (float)1.01953e-05,
-    (float)9.25158e-06,
-    (float)8.15402e-06,
-    (float)1.12958e-05,
-    (float)6.63329e-06,
-    (float)8.07114e-06,
-    (float)9.67948e-06,
-    (float)7.66521e-06,
-    (float)7.19441e-06,
-    (float)8.04261e-06,
-    (float)6.92815e-06,
-    (float)6.09496e-06,
-    (float)8.79191e-06,
-    (float)5.66772e-06,
-    (float)5.7234e-06,
-    (float)6.9301e-06,
-    (float)5.56543e-06,
-    (float)6.99433e-06,
-    (float)5.51344e-06,
-    (float)5.37758e-06,
-    (float)6.21817e-06,
-    (float)6.34052e-06,
-    (float)6.10135e-06,
-    (float)6.07721e-06,
-    (float)5.91772e-06,
-    (float)5.6466e-06,
-    (float)7.81737e-06,
-    (float)6.13702e-06,
-    (float)5.16124e-06,
-    (float)6.60468e-06,
-    (float)6.35597e-06,
-    (float)6.3572e-06,
-    (float)5.56491e-06,
-    (float)5.68764e-06,
-    (float)5.24173e-06,
-    (float)5.53086e-06,
-    (float)6.06274e-06,
-    (float)4.5168e-06,
-    (float)4.56743e-06,
-    (float)5.11435e-06,
-    (float)5.21745e-06,
-    (float)4.78887e-06,
-    (float)4.90877e-06,
-    (float)4.42239e-06,
-    (float)4.74247e-06,
-    (float)6.42088e-06,
-    (float)4.91155e-06,
-    (float)4.97481e-06,
-    (float)5.62391e-06,
-    (float)5.644e-06,
-    (float)6.4318e-06,
-    (float)5.72066e-06,
-    (float)5.20913e-06,
-    (float)0.541913,
-    (float)0.0303029,
-    (float)0.356969,
-    (float)0.0070007,
-    (float)0.0166108,
-    (float)0.0202894,
-    (float)0.0028245,
-    (float)0.0132166,
-    (float)0.00157521,
-    (float)0.00148618,
-    (float)0.00331082,
-    (float)0.000925684,
-    (float)0.000315976,
-    (float)8.91833e-05,
-    (float)0.000325565,
-    (float)8.90366e-05,
-    (float)0.000292697,
-    (float)9.90504e-05,
-    (float)0.000103715,
-    (float)0.000219553,
-    (float)1.90181e-06,
-    (float)9.05587e-05,
-    (float)9.21988e-05,
-    (float)7.49018e-05,
-    (float)3.81494e-05,
-    (float)8.30829e-05,
-    (float)9.95825e-05,
-    (float)1.5795e-05,
-    (float)0.000109811,
-    (float)2.94894e-05,
-    (float)4.63707e-05,
-    (float)0.000116007,
-    (float)6.03239e-06,
-    (float)5.69257e-05,
-    (float)4.87333e-05,
-    (float)2.11755e-05,
-    (float)4.63936e-05,
-    (float)1.95165e-05,
-    (float)1.98051e-05,
-    (float)2.67806e-05,
-    (float)3.45646e-05,
-    (float)8.40158e-06,
-    (float)2.65223e-05,
-    (float)3.01633e-05,
-    (float)7.09965e-06,
-    (float)3.89883e-05,
-    (float)1.60639e-05,
-    (float)1.58441e-05,
-    (float)3.10375e-05,
-    (float)1.55408e-05,
-    (float)2.36122e-05,
-    (float)2.11428e-05,
-    (float)1.91073e-05,
-    (float)1.92937e-05,
-    (float)2.46045e-05,
-    (float)1.72128e-05,
-    (float)1.43846e-05,
-    (float)2.58431e-05,
-    (float)1.16877e-05,
-    (float)1.62909e-05,
-    (float)1.82594e-05,
-    (float)1.0905e-05,
-    (float)1.6604e-05,
-    (float)1.1323e-05,
-    (float)1.38792e-05,
-    (float)1.28202e-05,
-    (float)1.073e-05,
-    (float)1.36106e-05,
-    (float)1.11518e-05,
-    (float)1.14462e-05,
-    (float)1.13399e-05,
-    (float)1.32294e-05,
-    (float)9.76351e-06,
-    (float)1.04579e-05,
-    (float)1.28258e-05,
-    (float)9.32609e-06,
-    (float)1.21212e-05,
-    (float)9.45275e-06,
-    (float)9.76661e-06,
-    (float)1.16975e-05,
-    (float)8.71636e-06,
-    (float)1.06894e-05,
-    (float)8.59765e-06,
-    (float)8.34525e-06,
-    (float)1.07857e-05,
-    (float)8.48273e-06,
-    (float)6.94125e-06,
-    (float)9.06404e-06,
-    (float)8.80876e-06,
-    (float)6.19465e-06,
-    (float)8.75256e-06,
-    (float)7.35532e-06,
-    (float)5.9875e-06,
-    (float)8.76753e-06,
-    (float)6.61645e-06,
-    (float)6.92745e-06,
-    (float)7.40449e-06,
-    (float)6.14878e-06,
-    (float)7.91115e-06,
-    (float)7.57898e-06,
-    (float)5.73747e-06,
-    (float)7.42074e-06,
-    (float)8.03206e-06,
-    (float)5.68477e-06,
-    (float)7.78506e-06,
-    (float)7.2846e-06,
-    (float)5.23164e-06,
-    (float)8.19599e-06,
-    (float)6.82279e-06,
-    (float)5.41706e-06,
-    (float)7.0288e-06,
-    (float)6.33315e-06,
-    (float)5.99795e-06,
-    (float)6.44314e-06,
-    (float)5.76544e-06,
-    (float)5.93284e-06,
-    (float)6.65415e-06,
-    (float)5.31634e-06,
-    (float)6.20396e-06,
-    (float)6.64851e-06,
-    (float)5.20973e-06,
-    (float)6.76528e-06,
-    (float)6.24649e-06,
-    (float)5.75615e-06,
-    (float)6.91632e-06,
-    (float)6.04563e-06,
-    (float)6.14198e-06,
-    (float)6.88737e-06,
-    (float)0.477078,
-    (float)0.0315532,
-    (float)0.407863,
-    (float)0.00736116,
-    (float)0.0165695,
-    (float)0.0280135,
-    (float)0.00300747,
-    (float)0.0142481,
-    (float)0.00213016,
-    (float)0.00188873,
-    (float)0.00473257,
-    (float)0.00108532,
-    (float)0.000586437,
-    (float)0.000312503,
-    (float)0.000450841,
-    (float)7.52341e-05,
-    (float)0.000166694,
-    (float)0.000153967,
-    (float)0.00010199,
-    (float)0.000259848,
-    (float)2.38073e-05,
-    (float)0.000128676,
-    (float)0.000110279,
-    (float)3.4911e-05,
-    (float)7.25973e-05,
-    (float)7.5163e-05,
-    (float)0.000120854,
-    (float)1.78387e-05,
-    (float)8.6339e-05,
-    (float)7.99598e-05,
-    (float)3.06883e-05,
-    (float)0.000116545,
-    (float)1.52179e-05,
-    (float)5.25165e-05,
-    (float)9.55541e-05,
-    (float)1.58065e-05,
-    (float)5.11967e-05,
-    (float)3.37487e-05,
-    (float)2.83233e-05,
-    (float)3.88521e-05,
-    (float)2.44711e-05,
-    (float)1.78643e-05,
-    (float)2.38147e-05,
-    (float)4.00379e-05,
-    (float)8.4115e-06,
-    (float)2.8404e-05,
-    (float)3.20016e-05,
-    (float)9.97551e-06,
-    (float)3.90247e-05,
-    (float)1.84983e-05,
-    (float)1.80533e-05,
-    (float)3.27484e-05,
-    (float)1.82405e-05,
-    (float)2.25025e-05,
-    (float)2.41098e-05,
-    (float)2.10805e-05,
-    (float)1.81516e-05,
-    (float)2.60869e-05,
-    (float)1.82056e-05,
-    (float)1.40933e-05,
-    (float)2.84141e-05,
-    (float)1.23685e-05,
-    (float)1.51311e-05,
-    (float)2.28479e-05,
-    (float)1.12073e-05,
-    (float)1.67436e-05,
-    (float)1.46053e-05,
-    (float)1.27787e-05,
-    (float)1.57422e-05,
-    (float)1.29853e-05,
-    (float)1.22802e-05,
-    (float)1.29814e-05,
-    (float)1.36929e-05,
-    (float)1.07117e-05,
-    (float)1.37925e-05,
-    (float)1.18894e-05,
-    (float)9.29431e-06,
-    (float)1.49788e-05,
-    (float)1.0538e-05,
-    (float)9.81913e-06,
-    (float)1.22961e-05,
-    (float)9.93202e-06,
-    (float)1.15581e-05,
-    (float)1.08067e-05,
-    (float)9.42591e-06,
-    (float)1.02355e-05,
-    (float)1.10821e-05,
-    (float)1.01358e-05,
-    (float)9.03722e-06,
-    (float)9.58527e-06,
-    (float)9.43252e-06,
-    (float)1.04309e-05,
-    (float)8.697e-06,
-    (float)7.61782e-06,
-    (float)9.74289e-06,
-    (float)8.26822e-06,
-    (float)7.98301e-06,
-    (float)8.2968e-06,
-    (float)6.95192e-06,
-    (float)7.62769e-06,
-    (float)8.34279e-06,
-    (float)7.25357e-06,
-    (float)6.56249e-06,
-    (float)7.20768e-06,
-    (float)7.49367e-06,
-    (float)7.96635e-06,
-    (float)7.02201e-06,
-    (float)6.42017e-06,
-    (float)8.33147e-06,
-    (float)8.01039e-06,
-    (float)7.47629e-06,
-    (float)7.62638e-06,
-    (float)7.10035e-06,
-    (float)8.24424e-06,
-    (float)8.98403e-06,
-    (float)7.17576e-06,
-    (float)6.66788e-06,
-    (float)8.55432e-06,
-    (float)7.98912e-06,
-    (float)6.99155e-06,
-    (float)6.96712e-06,
-    (float)6.43236e-06,
-    (float)7.60296e-06,
-    (float)7.21359e-06,
-    (float)5.93615e-06,
-    (float)6.22094e-06,
-    (float)6.5757e-06,
-    (float)6.80415e-06,
-    (float)0.412264,
-    (float)0.0321444,
-    (float)0.457794,
-    (float)0.00764449,
-    (float)0.0163192,
-    (float)0.03738,
-    (float)0.00316743,
-    (float)0.0147689,
-    (float)0.00311739,
-    (float)0.00221569,
-    (float)0.00615938,
-    (float)0.00118735,
-    (float)0.00098212,
-    (float)0.000826605,
-    (float)0.000610579,
-    (float)0.000147535,
-    (float)3.88051e-05,
-    (float)0.000209097,
-    (float)5.53695e-05,
-    (float)0.000237959,
-    (float)6.77377e-05,
-    (float)0.000153899,
-    (float)0.000145878,
-    (float)8.93129e-06,
-    (float)0.000130947,
-    (float)6.62622e-05,
-    (float)8.95264e-05,
-    (float)4.71968e-05,
-    (float)6.67646e-05,
-    (float)0.000128812,
-    (float)2.09601e-05,
-    (float)8.8084e-05,
-    (float)5.98283e-05,
-    (float)4.49379e-05,
-    (float)0.00010696,
-    (float)1.47925e-05,
-    (float)5.51995e-05,
-    (float)7.25417e-05,
-    (float)2.71507e-05,
-    (float)4.7669e-05,
-    (float)2.68012e-05,
-    (float)3.41236e-05,
-    (float)3.33762e-05,
-    (float)2.6139e-05,
-    (float)1.98177e-05,
-    (float)2.25558e-05,
-    (float)4.06895e-05,
-    (float)1.09025e-05,
-    (float)2.74454e-05,
-    (float)3.361e-05,
-    (float)1.40982e-05,
-    (float)3.62912e-05,
-    (float)2.02114e-05,
-    (float)2.15868e-05,
-    (float)3.38473e-05,
-    (float)1.93469e-05,
-    (float)2.36899e-05,
-    (float)2.59108e-05,
-    (float)2.34332e-05,
-    (float)1.99678e-05,
-    (float)2.50489e-05,
-    (float)2.08043e-05,
-    (float)1.58042e-05,
-    (float)2.89154e-05,
-    (float)1.46679e-05,
-    (float)1.42841e-05,
-    (float)2.57846e-05,
-    (float)1.24944e-05,
-    (float)1.6021e-05,
-    (float)1.71519e-05,
-    (float)1.25495e-05,
-    (float)1.66009e-05,
-    (float)1.3179e-05,
-    (float)1.19288e-05,
-    (float)1.40754e-05,
-    (float)1.43053e-05,
-    (float)1.12983e-05,
-    (float)1.27946e-05,
-    (float)1.39214e-05,
-    (float)1.04032e-05,
-    (float)1.50327e-05,
-    (float)1.24697e-05,
-    (float)9.61599e-06,
-    (float)1.53613e-05,
-    (float)1.19718e-05,
-    (float)1.08837e-05,
-    (float)1.3134e-05,
-    (float)1.08439e-05,
-    (float)1.18021e-05,
-    (float)1.2411e-05,
-    (float)9.96551e-06,
-    (float)9.95935e-06,
-    (float)1.16946e-05,
-    (float)1.00746e-05,
-    (float)8.92164e-06,
-    (float)9.47101e-06,
-    (float)8.69954e-06,
-    (float)9.81247e-06,
-    (float)8.64456e-06,
-    (float)6.69009e-06,
-    (float)9.34582e-06,
-    (float)8.94941e-06,
-    (float)6.79514e-06,
-    (float)8.43063e-06,
-    (float)8.41728e-06,
-    (float)7.5891e-06,
-    (float)9.0496e-06,
-    (float)8.40811e-06,
-    (float)7.73261e-06,
-    (float)9.26111e-06,
-    (float)9.16719e-06,
-    (float)8.57892e-06,
-    (float)8.8315e-06,
-    (float)8.96047e-06,
-    (float)9.20764e-06,
-    (float)9.21837e-06,
-    (float)8.40903e-06,
-    (float)8.26043e-06,
-    (float)9.17563e-06,
-    (float)8.31374e-06,
-    (float)7.65354e-06,
-    (float)7.99935e-06,
-    (float)7.39239e-06,
-    (float)7.94593e-06,
-    (float)7.6735e-06,
-    (float)6.25873e-06,
-    (float)7.06433e-06,
-    (float)8.05974e-06,
-    (float)0.348881,
-    (float)0.0320402,
-    (float)0.505308,
-    (float)0.0078555,
-    (float)0.0158592,
-    (float)0.0483449,
-    (float)0.00333283,
-    (float)0.0147497,
-    (float)0.00476564,
-    (float)0.0024421,
-    (float)0.00739578,
-    (float)0.00125769,
-    (float)0.00144358,
-    (float)0.00161315,
-    (float)0.000768142,
-    (float)0.000378106,
-    (float)3.02235e-05,
-    (float)0.000284961,
-    (float)1.5929e-05,
-    (float)0.000140289,
-    (float)0.000110775,
-    (float)0.000124209,
-    (float)0.000171531,
-    (float)2.26169e-05,
-    (float)0.000193056,
-    (float)7.56349e-05,
-    (float)3.6875e-05,
-    (float)0.000115426,
-    (float)4.89314e-05,
-    (float)0.000124851,
-    (float)3.61017e-05,
-    (float)5.92463e-05,
-    (float)0.000120444,
-    (float)3.28962e-05,
-    (float)8.13025e-05,
-    (float)4.81237e-05,
-    (float)5.28353e-05,
-    (float)8.91696e-05,
-    (float)1.97718e-05,
-    (float)5.44038e-05,
-    (float)5.58007e-05,
-    (float)3.69326e-05,
-    (float)4.39375e-05,
-    (float)2.317e-05,
-    (float)4.06211e-05,
-    (float)2.98515e-05,
-    (float)2.64735e-05,
-    (float)2.54981e-05,
-    (float)2.12926e-05,
-    (float)4.12124e-05,
-    (float)1.61292e-05,
-    (float)2.54898e-05,
-    (float)3.68494e-05,
-    (float)1.86082e-05,
-    (float)3.37243e-05,
-    (float)2.33798e-05,
-    (float)2.48139e-05,
-    (float)3.39432e-05,
-    (float)1.9427e-05,
-    (float)2.58073e-05,
-    (float)2.68766e-05,
-    (float)2.29712e-05,
-    (float)2.17048e-05,
-    (float)2.34178e-05,
-    (float)2.27284e-05,
-    (float)1.63018e-05,
-    (float)2.6198e-05,
-    (float)1.79337e-05,
-    (float)1.38138e-05,
-    (float)2.72524e-05,
-    (float)1.4053e-05,
-    (float)1.45414e-05,
-    (float)2.1707e-05,
-    (float)1.36465e-05,
-    (float)1.70133e-05,
-    (float)1.54173e-05,
-    (float)1.31994e-05,
-    (float)1.69591e-05,
-    (float)1.45329e-05,
-    (float)1.21533e-05,
-    (float)1.43097e-05,
-    (float)1.56153e-05,
-    (float)1.1003e-05,
-    (float)1.37457e-05,
-    (float)1.47511e-05,
-    (float)9.29508e-06,
-    (float)1.513e-05,
-    (float)1.33617e-05,
-    (float)8.68038e-06,
-    (float)1.47087e-05,
-    (float)1.18058e-05,
-    (float)1.00405e-05,
-    (float)1.3444e-05,
-    (float)1.00705e-05,
-    (float)1.04144e-05,
-    (float)1.32262e-05,
-    (float)9.97344e-06,
-    (float)9.37354e-06,
-    (float)1.2241e-05,
-    (float)1.02243e-05,
-    (float)9.69762e-06,
-    (float)1.11331e-05,
-    (float)8.43206e-06,
-    (float)1.05875e-05,
-    (float)1.17488e-05,
-    (float)6.71217e-06,
-    (float)9.94943e-06,
-    (float)1.17957e-05,
-    (float)6.7871e-06,
-    (float)9.54007e-06,
-    (float)1.02282e-05,
-    (float)6.91093e-06,
-    (float)9.97024e-06,
-    (float)9.42471e-06,
-    (float)6.95302e-06,
-    (float)9.57246e-06,
-    (float)9.13036e-06,
-    (float)7.85189e-06,
-    (float)9.69859e-06,
-    (float)8.19433e-06,
-    (float)7.94112e-06,
-    (float)1.12268e-05,
-    (float)8.26191e-06,
-    (float)7.16734e-06,
-    (float)1.171e-05,
-    (float)8.70459e-06,
-    (float)7.7459e-06,
-    (float)1.12672e-05,
-    (float)0.288546,
-    (float)0.0312378,
-    (float)0.548695,
-    (float)0.00799643,
-    (float)0.0152961,
-    (float)0.0606424,
-    (float)0.00352261,
-    (float)0.0143179,
-    (float)0.00728755,
-    (float)0.00253941,
-    (float)0.00831099,
-    (float)0.0013876,
-    (float)0.00185903,
-    (float)0.00256984,
-    (float)0.000879761,
-    (float)0.000786493,
-    (float)0.000244333,
-    (float)0.000394837,
-    (float)9.23492e-05,
-    (float)2.84235e-05,
-    (float)0.00014142,
-    (float)3.97363e-05,
-    (float)0.000141811,
-    (float)5.5264e-05,
-    (float)0.000201616,
-    (float)9.18195e-05,
-    (float)1.17154e-05,
-    (float)0.000215792,
-    (float)3.61285e-05,
-    (float)6.38584e-05,
-    (float)0.000108684,
-    (float)3.45063e-05,
-    (float)0.000133471,
-    (float)4.14775e-05,
-    (float)4.86812e-05,
-    (float)0.000112679,
-    (float)4.86728e-05,
-    (float)6.60483e-05,
-    (float)4.70854e-05,
-    (float)6.4578e-05,
-    (float)6.89769e-05,
-    (float)2.51104e-05,
-    (float)5.95593e-05,
-    (float)4.46617e-05,
-    (float)4.37205e-05,
-    (float)4.40561e-05,
-    (float)1.9279e-05,
-    (float)4.94245e-05,
-    (float)2.90261e-05,
-    (float)1.90889e-05,
-    (float)3.46303e-05,
-    (float)2.07041e-05,
-    (float)3.30011e-05,
-    (float)2.27572e-05,
-    (float)2.21755e-05,
-    (float)3.44831e-05,
-    (float)2.38245e-05,
-    (float)2.93061e-05,
-    (float)2.39063e-05,
-    (float)2.99938e-05,
-    (float)3.25256e-05,
-    (float)1.79353e-05,
-    (float)3.2162e-05,
-    (float)2.77745e-05,
-    (float)2.14146e-05,
-    (float)2.88892e-05,
-    (float)2.165e-05,
-    (float)2.58736e-05,
-    (float)2.33099e-05,
-    (float)2.02495e-05,
-    (float)2.30043e-05,
-    (float)1.83625e-05,
-    (float)2.34106e-05,
-    (float)1.74105e-05,
-    (float)1.53623e-05,
-    (float)2.26033e-05,
-    (float)1.51619e-05,
-    (float)1.61542e-05,
-    (float)1.59018e-05,
-    (float)1.4337e-05,
-    (float)1.80987e-05,
-    (float)1.10799e-05,
-    (float)1.27835e-05,
-    (float)1.60307e-05,
-    (float)1.22894e-05,
-    (float)1.26939e-05,
-    (float)1.18747e-05,
-    (float)1.41461e-05,
-    (float)1.34688e-05,
-    (float)1.17511e-05,
-    (float)1.35492e-05,
-    (float)1.22578e-05,
-    (float)1.46188e-05,
-    (float)1.34563e-05,
-    (float)1.12357e-05,
-    (float)1.48653e-05,
-    (float)1.35743e-05,
-    (float)1.303e-05,
-    (float)1.30205e-05,
-    (float)1.15824e-05,
-    (float)1.38783e-05,
-    (float)1.27185e-05,
-    (float)1.01026e-05,
-    (float)1.11448e-05,
-    (float)1.21604e-05,
-    (float)1.09672e-05,
-    (float)9.01989e-06,
-    (float)9.52653e-06,
-    (float)1.02548e-05,
-    (float)9.77159e-06,
-    (float)8.45421e-06,
-    (float)7.19243e-06,
-    (float)9.73412e-06,
-    (float)1.0144e-05,
-    (float)6.70464e-06,
-    (float)8.37865e-06,
-    (float)1.02875e-05,
-    (float)9.22211e-06,
-    (float)9.3587e-06,
-    (float)8.52612e-06,
-    (float)1.03669e-05,
-    (float)1.1675e-05,
-    (float)9.05162e-06,
-    (float)1.01167e-05,
-    (float)1.15949e-05,
-    (float)1.12251e-05,
-    (float)1.10679e-05,
-    (float)1.05607e-05,
-    (float)0.232807,
-    (float)0.0297955,
-    (float)0.586951,
-    (float)0.00796907,
-    (float)0.0146393,
-    (float)0.0737714,
-    (float)0.00372695,
-    (float)0.0135567,
-    (float)0.0108437,
-    (float)0.00256375,
-    (float)0.00877239,
-    (float)0.00174675,
-    (float)0.00213252,
-    (float)0.00348536,
-    (float)0.000878296,
-    (float)0.00127142,
-    (float)0.00068321,
-    (float)0.000499321,
-    (float)0.000374322,
-    (float)1.63922e-05,
-    (float)0.000186282,
-    (float)5.87633e-06,
-    (float)7.29742e-05,
-    (float)7.34912e-05,
-    (float)0.000101388,
-    (float)9.71935e-05,
-    (float)2.34031e-05,
-    (float)0.000245373,
-    (float)4.4951e-05,
-    (float)1.62807e-05,
-    (float)0.000222664,
-    (float)1.76331e-05,
-    (float)7.54115e-05,
-    (float)0.000112153,
-    (float)2.28214e-05,
-    (float)0.000123493,
-    (float)5.12689e-05,
-    (float)3.71587e-05,
-    (float)0.000101296,
-    (float)5.62956e-05,
-    (float)4.96905e-05,
-    (float)4.73868e-05,
-    (float)7.17944e-05,
-    (float)4.86761e-05,
-    (float)2.61815e-05,
-    (float)6.93459e-05,
-    (float)3.18283e-05,
-    (float)4.12224e-05,
-    (float)5.25621e-05,
-    (float)1.50129e-05,
-    (float)5.31818e-05,
-    (float)3.40406e-05,
-    (float)1.4021e-05,
-    (float)4.61361e-05,
-    (float)2.38735e-05,
-    (float)2.51101e-05,
-    (float)3.20242e-05,
-    (float)2.41271e-05,
-    (float)3.10574e-05,
-    (float)2.53989e-05,
-    (float)2.95229e-05,
-    (float)2.60827e-05,
-    (float)2.91244e-05,
-    (float)3.20733e-05,
-    (float)1.72601e-05,
-    (float)3.49273e-05,
-    (float)2.92856e-05,
-    (float)1.49207e-05,
-    (float)3.41066e-05,
-    (float)2.26817e-05,
-    (float)1.94012e-05,
-    (float)2.81057e-05,
-    (float)1.73436e-05,
-    (float)2.25416e-05,
-    (float)2.18727e-05,
-    (float)1.71415e-05,
-    (float)2.00054e-05,
-    (float)1.78706e-05,
-    (float)1.93195e-05,
-    (float)1.57874e-05,
-    (float)1.70079e-05,
-    (float)1.81844e-05,
-    (float)1.42378e-05,
-    (float)1.90878e-05,
-    (float)1.34643e-05,
-    (float)1.44176e-05,
-    (float)2.07284e-05,
-    (float)1.02063e-05,
-    (float)1.44842e-05,
-    (float)1.85298e-05,
-    (float)1.11448e-05,
-    (float)1.45633e-05,
-    (float)1.4322e-05,
-    (float)1.32263e-05,
-    (float)1.43526e-05,
-    (float)1.23216e-05,
-    (float)1.34342e-05,
-    (float)1.30453e-05,
-    (float)1.31129e-05,
-    (float)1.22347e-05,
-    (float)1.17537e-05,
-    (float)1.37716e-05,
-    (float)1.07267e-05,
-    (float)1.19959e-05,
-    (float)1.28236e-05,
-    (float)9.32664e-06,
-    (float)1.28626e-05,
-    (float)1.13565e-05,
-    (float)8.83957e-06,
-    (float)1.26384e-05,
-    (float)1.01488e-05,
-    (float)9.56226e-06,
-    (float)1.1731e-05,
-    (float)9.30292e-06,
-    (float)1.01241e-05,
-    (float)1.14816e-05,
-    (float)9.42617e-06,
-    (float)9.38797e-06,
-    (float)1.17684e-05,
-    (float)1.0659e-05,
-    (float)8.37215e-06,
-    (float)1.17603e-05,
-    (float)1.16648e-05,
-    (float)8.53393e-06,
-    (float)1.16067e-05,
-    (float)1.12596e-05,
-    (float)9.81915e-06,
-    (float)1.15435e-05,
-    (float)0.182276,
-    (float)0.0278061,
-    (float)0.618863,
-    (float)0.00787035,
-    (float)0.0138648,
-    (float)0.0874494,
-    (float)0.00399349,
-    (float)0.0125674,
-    (float)0.0155635,
-    (float)0.00257678,
-    (float)0.00881791,
-    (float)0.00261464,
-    (float)0.00223703,
-    (float)0.00423687,
-    (float)0.000860315,
-    (float)0.0017044,
-    (float)0.00127092,
-    (float)0.000553218,
-    (float)0.000845351,
-    (float)0.000177317,
-    (float)0.000253558,
-    (float)0.000176696,
-    (float)3.75349e-05,
-    (float)8.5836e-05,
-    (float)5.24384e-06,
-    (float)7.69338e-05,
-    (float)3.42338e-05,
-    (float)0.000150142,
-    (float)5.56448e-05,
-    (float)9.40265e-06,
-    (float)0.000274302,
-    (float)1.79137e-05,
-    (float)1.93649e-05,
-    (float)0.000237958,
-    (float)8.16237e-06,
-    (float)7.13637e-05,
-    (float)0.000126843,
-    (float)1.78138e-05,
-    (float)0.000111348,
-    (float)6.19603e-05,
-    (float)3.01083e-05,
-    (float)9.74283e-05,
-    (float)6.17306e-05,
-    (float)3.81061e-05,
-    (float)5.14317e-05,
-    (float)7.93295e-05,
-    (float)3.69031e-05,
-    (float)2.46009e-05,
-    (float)8.08656e-05,
-    (float)2.60185e-05,
-    (float)3.27168e-05,
-    (float)6.33924e-05,
-    (float)1.32975e-05,
-    (float)5.01326e-05,
-    (float)4.10187e-05,
-    (float)9.68056e-06,
-    (float)5.36285e-05,
-    (float)2.69274e-05,
-    (float)1.72017e-05,
-    (float)4.1343e-05,
-    (float)2.39579e-05,
-    (float)2.62365e-05,
-    (float)2.74318e-05,
-    (float)2.71243e-05,
-    (float)2.73589e-05,
-    (float)2.47823e-05,
-    (float)3.09011e-05,
-    (float)2.01664e-05,
-    (float)3.08578e-05,
-    (float)3.15325e-05,
-    (float)1.33513e-05,
-    (float)3.54966e-05,
-    (float)2.75118e-05,
-    (float)1.43203e-05,
-    (float)3.35211e-05,
-    (float)2.03198e-05,
-    (float)2.06318e-05,
-    (float)2.81344e-05,
-    (float)1.48508e-05,
-    (float)2.3757e-05,
-    (float)2.32443e-05,
-    (float)1.48024e-05,
-    (float)2.03999e-05,
-    (float)1.94567e-05,
-    (float)1.73667e-05,
-    (float)1.54724e-05,
-    (float)1.74297e-05,
-    (float)1.66185e-05,
-    (float)1.35049e-05,
-    (float)1.84245e-05,
-    (float)1.16839e-05,
-    (float)1.33728e-05,
-    (float)2.02708e-05,
-    (float)7.84736e-06,
-    (float)1.30343e-05,
-    (float)1.85349e-05,
-    (float)8.70224e-06,
-    (float)1.34314e-05,
-    (float)1.33957e-05,
-    (float)1.1419e-05,
-    (float)1.50018e-05,
-    (float)1.00592e-05,
-    (float)1.23656e-05,
-    (float)1.53863e-05,
-    (float)1.12843e-05,
-    (float)1.19468e-05,
-    (float)1.39033e-05,
-    (float)1.36717e-05,
-    (float)1.15983e-05,
-    (float)1.34936e-05,
-    (float)1.374e-05,
-    (float)1.05844e-05,
-    (float)1.55169e-05,
-    (float)1.25753e-05,
-    (float)8.60497e-06,
-    (float)1.67245e-05,
-    (float)1.19154e-05,
-    (float)7.83214e-06,
-    (float)1.4768e-05,
-    (float)1.08286e-05,
-    (float)9.26893e-06,
-    (float)1.20085e-05,
-    (float)8.81026e-06,
-    (float)1.04332e-05,
-    (float)1.12413e-05,
-    (float)7.87403e-06,
-    (float)9.29123e-06,
-    (float)1.15779e-05,
-    (float)0.138083,
-    (float)0.0253745,
-    (float)0.643955,
-    (float)0.00763955,
-    (float)0.0130368,
-    (float)0.10093,
-    (float)0.0042634,
-    (float)0.0115163,
-    (float)0.021327,
-    (float)0.00262816,
-    (float)0.00852958,
-    (float)0.00422601,
-    (float)0.002185,
-    (float)0.00470227,
-    (float)0.000973732,
-    (float)0.00191734,
-    (float)0.00183786,
-    (float)0.000509412,
-    (float)0.00132013,
-    (float)0.000470896,
-    (float)0.000298708,
-    (float)0.000583715,
-    (float)0.000102614,
-    (float)0.000115031,
-    (float)0.000102333,
-    (float)8.49282e-05,
-    (float)3.15974e-05,
-    (float)1.71395e-05,
-    (float)7.85257e-05,
-    (float)9.39282e-06,
-    (float)0.000155432,
-    (float)3.85638e-05,
-    (float)3.47938e-06,
-    (float)0.000269959,
-    (float)9.84581e-06,
-    (float)1.89895e-05,
-    (float)0.000250591,
-    (float)8.86105e-06,
-    (float)5.68507e-05,
-    (float)0.000152485,
-    (float)2.23038e-05,
-    (float)8.85154e-05,
-    (float)7.56777e-05,
-    (float)3.43122e-05,
-    (float)8.62998e-05,
-    (float)5.68872e-05,
-    (float)3.86288e-05,
-    (float)5.45963e-05,
-    (float)7.16793e-05,
-    (float)3.5229e-05,
-    (float)2.50658e-05,
-    (float)8.37553e-05,
-    (float)2.64139e-05,
-    (float)2.01184e-05,
-    (float)7.54646e-05,
-    (float)1.63061e-05,
-    (float)3.3855e-05,
-    (float)5.36635e-05,
-    (float)1.09256e-05,
-    (float)4.74846e-05,
-    (float)3.47527e-05,
-    (float)1.41643e-05,
-    (float)4.67843e-05,
-    (float)2.60808e-05,
-    (float)2.30051e-05,
-    (float)3.47618e-05,
-    (float)2.66511e-05,
-    (float)2.96593e-05,
-    (float)2.30229e-05,
-    (float)3.0414e-05,
-    (float)2.84559e-05,
-    (float)2.07888e-05,
-    (float)3.28725e-05,
-    (float)2.08482e-05,
-    (float)2.63932e-05,
-    (float)3.21547e-05,
-    (float)1.3825e-05,
-    (float)3.14238e-05,
-    (float)2.78871e-05,
-    (float)1.31605e-05,
-    (float)3.05276e-05,
-    (float)2.10362e-05,
-    (float)1.77381e-05,
-    (float)2.53695e-05,
-    (float)1.50041e-05,
-    (float)2.10685e-05,
-    (float)2.00121e-05,
-    (float)1.33447e-05,
-    (float)1.89023e-05,
-    (float)1.63728e-05,
-    (float)1.58669e-05,
-    (float)1.3625e-05,
-    (float)1.4402e-05,
-    (float)1.82939e-05,
-    (float)1.01601e-05,
-    (float)1.42445e-05,
-    (float)1.68005e-05,
-    (float)1.02729e-05,
-    (float)1.58995e-05,
-    (float)1.25746e-05,
-    (float)1.20897e-05,
-    (float)1.7572e-05,
-    (float)1.01845e-05,
-    (float)1.3489e-05,
-    (float)1.67598e-05,
-    (float)1.16928e-05,
-    (float)1.41788e-05,
-    (float)1.33993e-05,
-    (float)1.46473e-05,
-    (float)1.44337e-05,
-    (float)1.06063e-05,
-    (float)1.5649e-05,
-    (float)1.36366e-05,
-    (float)1.10755e-05,
-    (float)1.41043e-05,
-    (float)1.13986e-05,
-    (float)1.36699e-05,
-    (float)1.18732e-05,
-    (float)9.16831e-06,
-    (float)1.49015e-05,
-    (float)1.02829e-05,
-    (float)8.96226e-06,
-    (float)1.33623e-05,
-    (float)9.31181e-06,
-    (float)1.05199e-05,
-    (float)1.07603e-05,
-    (float)9.25658e-06,
-    (float)1.15244e-05,
-    (float)0.100703,
-    (float)0.0226019,
-    (float)0.66191,
-    (float)0.00732373,
-    (float)0.0121622,
-    (float)0.113561,
-    (float)0.0045233,
-    (float)0.0105352,
-    (float)0.0278456,
-    (float)0.00276543,
-    (float)0.00810019,
-    (float)0.00672415,
-    (float)0.00208349,
-    (float)0.00494026,
-    (float)0.00149955,
-    (float)0.00188645,
-    (float)0.00229889,
-    (float)0.000470581,
-    (float)0.00158757,
-    (float)0.000790259,
-    (float)0.000268062,
-    (float)0.0010421,
-    (float)0.000228092,
-    (float)0.000135696,
-    (float)0.000457224,
-    (float)0.000132497,
-    (float)3.99604e-05,
-    (float)8.96367e-05,
-    (float)0.000134735,
-    (float)3.96776e-06,
-    (float)1.33793e-05,
-    (float)0.000100588,
-    (float)5.90694e-07,
-    (float)0.000112448,
-    (float)4.76116e-05,
-    (float)6.4933e-06,
-    (float)0.000216498,
-    (float)1.63702e-05,
-    (float)2.23441e-05,
-    (float)0.00022908,
-    (float)1.58427e-05,
-    (float)4.86412e-05,
-    (float)0.00016496,
-    (float)3.11448e-05,
-    (float)7.2263e-05,
-    (float)9.10945e-05,
-    (float)4.4823e-05,
-    (float)7.64868e-05,
-    (float)5.2286e-05,
-    (float)4.95879e-05,
-    (float)5.80641e-05,
-    (float)5.05512e-05,
-    (float)4.69322e-05,
-    (float)3.26016e-05,
-    (float)6.33943e-05,
-    (float)4.0224e-05,
-    (float)1.90362e-05,
-    (float)6.78308e-05,
-    (float)3.14322e-05,
-    (float)2.29394e-05,
-    (float)5.79714e-05,
-    (float)2.3187e-05,
-    (float)3.57108e-05,
-    (float)4.08798e-05,
-    (float)1.98019e-05,
-    (float)4.47962e-05,
-    (float)2.64499e-05,
-    (float)2.23242e-05,
-    (float)4.24257e-05,
-    (float)2.00281e-05,
-    (float)2.86053e-05,
-    (float)3.12647e-05,
-    (float)2.00936e-05,
-    (float)3.35465e-05,
-    (float)2.02803e-05,
-    (float)2.23401e-05,
-    (float)3.24804e-05,
-    (float)1.64099e-05,
-    (float)2.40051e-05,
-    (float)2.54897e-05,
-    (float)1.93684e-05,
-    (float)2.43943e-05,
-    (float)1.75837e-05,
-    (float)2.34852e-05,
-    (float)2.30988e-05,
-    (float)1.44685e-05,
-    (float)2.42593e-05,
-    (float)1.96767e-05,
-    (float)1.7267e-05,
-    (float)2.17364e-05,
-    (float)1.52656e-05,
-    (float)2.16989e-05,
-    (float)1.8353e-05,
-    (float)1.25137e-05,
-    (float)2.27674e-05,
-    (float)1.57214e-05,
-    (float)1.31351e-05,
-    (float)1.96122e-05,
-    (float)1.38753e-05,
-    (float)1.5716e-05,
-    (float)1.51314e-05,
-    (float)1.28137e-05,
-    (float)1.68077e-05,
-    (float)1.21882e-05,
-    (float)1.30396e-05,
-    (float)1.47684e-05,
-    (float)1.13238e-05,
-    (float)1.42636e-05,
-    (float)1.14108e-05,
-    (float)1.15145e-05,
-    (float)1.48226e-05,
-    (float)9.64173e-06,
-    (float)1.20349e-05,
-    (float)1.33357e-05,
-    (float)1.04562e-05,
-    (float)1.26948e-05,
-    (float)1.06927e-05,
-    (float)1.25503e-05,
-    (float)1.28761e-05,
-    (float)9.11169e-06,
-    (float)1.42931e-05,
-    (float)1.19733e-05,
-    (float)9.76398e-06,
-    (float)1.47922e-05,
-    (float)1.04347e-05,
-    (float)1.19501e-05,
-    (float)1.39624e-05,
-    (float)9.65797e-06,
-    (float)0.0699135,
-    (float)0.0196339,
-    (float)0.672378,
-    (float)0.00693399,
-    (float)0.0111946,
-    (float)0.125028,
-    (float)0.00475559,
-    (float)0.00960496,
-    (float)0.0349251,
-    (float)0.00301398,
-    (float)0.0076223,
-    (float)0.0101804,
-    (float)0.00205989,
-    (float)0.00506446,
-    (float)0.00271015,
-    (float)0.0017198,
-    (float)0.00270924,
-    (float)0.000674595,
-    (float)0.00156193,
-    (float)0.00112953,
-    (float)0.000227398,
-    (float)0.00128953,
-    (float)0.00037733,
-    (float)0.000119572,
-    (float)0.000861631,
-    (float)0.000172485,
-    (float)5.57899e-05,
-    (float)0.00041653,
-    (float)0.000181475,
-    (float)1.73968e-05,
-    (float)0.000110893,
-    (float)0.000191897,
-    (float)9.46667e-06,
-    (float)5.2793e-06,
-    (float)0.000147613,
-    (float)1.67075e-05,
-    (float)4.91652e-05,
-    (float)8.11343e-05,
-    (float)2.58967e-05,
-    (float)0.000136846,
-    (float)3.44783e-05,
-    (float)3.71432e-05,
-    (float)0.000182598,
-    (float)2.30447e-05,
-    (float)5.38016e-05,
-    (float)0.000164239,
-    (float)3.62527e-05,
-    (float)7.23792e-05,
-    (float)0.000110417,
-    (float)5.37913e-05,
-    (float)8.2806e-05,
-    (float)5.95264e-05,
-    (float)6.22686e-05,
-    (float)7.68235e-05,
-    (float)3.30315e-05,
-    (float)6.04864e-05,
-    (float)5.69431e-05,
-    (float)3.09073e-05,
-    (float)5.31335e-05,
-    (float)3.54912e-05,
-    (float)3.91613e-05,
-    (float)4.34584e-05,
-    (float)2.26923e-05,
-    (float)4.36203e-05,
-    (float)3.49648e-05,
-    (float)2.26182e-05,
-    (float)3.8031e-05,
-    (float)2.85084e-05,
-    (float)3.15283e-05,
-    (float)2.62111e-05,
-    (float)2.43311e-05,
-    (float)4.07342e-05,
-    (float)1.60374e-05,
-    (float)2.31063e-05,
-    (float)4.25077e-05,
-    (float)1.2687e-05,
-    (float)2.54578e-05,
-    (float)3.51686e-05,
-    (float)1.54836e-05,
-    (float)3.03229e-05,
-    (float)2.38289e-05,
-    (float)1.99597e-05,
-    (float)3.44107e-05,
-    (float)1.6001e-05,
-    (float)2.2237e-05,
-    (float)3.3996e-05,
-    (float)1.54028e-05,
-    (float)2.19027e-05,
-    (float)2.81797e-05,
-    (float)1.95246e-05,
-    (float)2.06836e-05,
-    (float)2.03314e-05,
-    (float)2.2816e-05,
-    (float)1.94971e-05,
-    (float)1.54404e-05,
-    (float)2.17341e-05,
-    (float)1.75861e-05,
-    (float)1.5693e-05,
-    (float)1.71475e-05,
-    (float)1.42573e-05,
-    (float)1.85131e-05,
-    (float)1.25607e-05,
-    (float)1.07418e-05,
-    (float)1.94419e-05,
-    (float)1.02826e-05,
-    (float)9.56576e-06,
-    (float)1.64792e-05,
-    (float)9.74677e-06,
-    (float)1.17317e-05,
-    (float)1.16522e-05,
-    (float)9.42868e-06,
-    (float)1.50737e-05,
-    (float)8.76238e-06,
-    (float)9.1585e-06,
-    (float)1.63189e-05,
-    (float)9.57188e-06,
-    (float)1.00344e-05,
-    (float)1.43236e-05,
-    (float)1.24215e-05,
-    (float)1.24515e-05,
-    (float)1.13155e-05,
-    (float)1.44763e-05,
-    (float)1.46731e-05,
-    (float)1.04245e-05,
-    (float)1.49183e-05,
-    (float)1.45733e-05,
-    (float)1.22834e-05,
-    (float)1.47983e-05,
-    (float)0.0455608,
-    (float)0.0167102,
-    (float)0.676401,
-    (float)0.00638837,
-    (float)0.0102341,
-    (float)0.134557,
-    (float)0.00479957,
-    (float)0.00882214,
-    (float)0.0418784,
-    (float)0.00324524,
-    (float)0.00722413,
-    (float)0.0143319,
-    (float)0.00215644,
-    (float)0.00517752,
-    (float)0.00474217,
-    (float)0.00160466,
-    (float)0.00312999,
-    (float)0.00142093,
-    (float)0.00138024,
-    (float)0.00153946,
-    (float)0.000387288,
-    (float)0.00123431,
-    (float)0.000587867,
-    (float)0.00011271,
-    (float)0.00101788,
-    (float)0.00019012,
-    (float)4.54639e-05,
-    (float)0.00071427,
-    (float)0.000128829,
-    (float)2.80205e-05,
-    (float)0.000395797,
-    (float)0.000185996,
-    (float)3.05779e-05,
-    (float)0.000149247,
-    (float)0.000224064,
-    (float)4.48049e-05,
-    (float)2.1479e-05,
-    (float)0.000202125,
-    (float)5.9882e-05,
-    (float)3.84346e-06,
-    (float)0.000140389,
-    (float)6.88119e-05,
-    (float)4.72093e-05,
-    (float)7.57842e-05,
-    (float)7.30113e-05,
-    (float)9.51641e-05,
-    (float)3.47091e-05,
-    (float)7.78117e-05,
-    (float)0.000113772,
-    (float)2.37678e-05,
-    (float)8.59031e-05,
-    (float)9.93376e-05,
-    (float)3.31866e-05,
-    (float)9.45656e-05,
-    (float)6.66923e-05,
-    (float)4.77934e-05,
-    (float)9.75134e-05,
-    (float)3.41418e-05,
-    (float)5.7453e-05,
-    (float)9.08996e-05,
-    (float)1.50573e-05,
-    (float)5.80063e-05,
-    (float)7.61424e-05,
-    (float)1.24032e-05,
-    (float)5.1295e-05,
-    (float)5.74347e-05,
-    (float)1.96452e-05,
-    (float)4.20001e-05,
-    (float)4.1142e-05,
-    (float)2.74533e-05,
-    (float)3.39923e-05,
-    (float)3.22288e-05,
-    (float)2.94833e-05,
-    (float)2.87174e-05,
-    (float)3.16904e-05,
-    (float)2.50236e-05,
-    (float)2.5649e-05,
-    (float)3.61688e-05,
-    (float)1.78092e-05,
-    (float)2.38135e-05,
-    (float)4.00594e-05,
-    (float)1.25221e-05,
-    (float)2.29074e-05,
-    (float)3.89104e-05,
-    (float)1.15676e-05,
-    (float)2.30896e-05,
-    (float)3.19297e-05,
-    (float)1.41433e-05,
-    (float)2.41832e-05,
-    (float)2.22825e-05,
-    (float)1.75542e-05,
-    (float)2.49794e-05,
-    (float)1.44632e-05,
-    (float)1.95303e-05,
-    (float)2.39245e-05,
-    (float)1.1264e-05,
-    (float)1.95297e-05,
-    (float)2.04064e-05,
-    (float)1.24058e-05,
-    (float)1.84042e-05,
-    (float)1.54854e-05,
-    (float)1.52649e-05,
-    (float)1.71947e-05,
-    (float)1.13032e-05,
-    (float)1.69359e-05,
-    (float)1.62718e-05,
-    (float)9.60083e-06,
-    (float)1.61232e-05,
-    (float)1.53975e-05,
-    (float)1.0524e-05,
-    (float)1.35904e-05,
-    (float)1.43473e-05,
-    (float)1.261e-05,
-    (float)1.11241e-05,
-    (float)1.33923e-05,
-    (float)1.38406e-05,
-    (float)1.00496e-05,
-    (float)1.30298e-05,
-    (float)1.31643e-05,
-    (float)1.06533e-05,
-    (float)1.33682e-05,
-    (float)1.09071e-05,
-    (float)1.22265e-05,
-    (float)1.4033e-05,
-    (float)8.5022e-06,
-    (float)1.36995e-05,
-    (float)1.43233e-05,
-    (float)7.48399e-06,
-    (float)0.027505,
-    (float)0.0137605,
-    (float)0.673517,
-    (float)0.00582466,
-    (float)0.00917726,
-    (float)0.141918,
-    (float)0.00473759,
-    (float)0.00809144,
-    (float)0.0483205,
-    (float)0.00345654,
-    (float)0.00691878,
-    (float)0.018829,
-    (float)0.00236077,
-    (float)0.00539885,
-    (float)0.00747442,
-    (float)0.00162015,
-    (float)0.00373988,
-    (float)0.00285577,
-    (float)0.00120358,
-    (float)0.00224473,
-    (float)0.00102879,
-    (float)0.000988097,
-    (float)0.00112479,
-    (float)0.000361245,
-    (float)0.000846727,
-    (float)0.000440735,
-    (float)0.000141639,
-    (float)0.000697623,
-    (float)0.00013,
-    (float)7.87349e-05,
-    (float)0.000517491,
-    (float)6.47758e-05,
-    (float)6.9559e-05,
-    (float)0.000326654,
-    (float)0.000109814,
-    (float)8.2863e-05,
-    (float)0.000162446,
-    (float)0.000165257,
-    (float)0.000106032,
-    (float)5.50948e-05,
-    (float)0.000183029,
-    (float)0.000128302,
-    (float)1.42685e-05,
-    (float)0.000157621,
-    (float)0.00014123,
-    (float)2.62929e-05,
-    (float)0.000106704,
-    (float)0.000142133,
-    (float)6.29355e-05,
-    (float)5.43489e-05,
-    (float)0.000133763,
-    (float)9.65242e-05,
-    (float)1.91889e-05,
-    (float)0.000121273,
-    (float)0.000111005,
-    (float)7.80214e-06,
-    (float)0.000109108,
-    (float)0.00010334,
-    (float)1.52384e-05,
-    (float)9.96496e-05,
-    (float)7.85989e-05,
-    (float)3.12272e-05,
-    (float)9.35217e-05,
-    (float)4.84763e-05,
-    (float)4.5663e-05,
-    (float)8.83012e-05,
-    (float)2.44122e-05,
-    (float)5.22084e-05,
-    (float)8.09231e-05,
-    (float)1.28318e-05,
-    (float)4.96726e-05,
-    (float)6.94437e-05,
-    (float)1.35752e-05,
-    (float)4.11967e-05,
-    (float)5.42234e-05,
-    (float)2.14691e-05,
-    (float)3.16587e-05,
-    (float)3.79214e-05,
-    (float)2.96296e-05,
-    (float)2.48783e-05,
-    (float)2.41891e-05,
-    (float)3.29253e-05,
-    (float)2.20959e-05,
-    (float)1.57925e-05,
-    (float)3.00574e-05,
-    (float)2.21899e-05,
-    (float)1.32634e-05,
-    (float)2.32965e-05,
-    (float)2.30596e-05,
-    (float)1.46764e-05,
-    (float)1.66152e-05,
-    (float)2.32714e-05,
-    (float)1.68044e-05,
-    (float)1.31266e-05,
-    (float)2.26893e-05,
-    (float)1.7079e-05,
-    (float)1.36178e-05,
-    (float)2.19437e-05,
-    (float)1.48953e-05,
-    (float)1.65527e-05,
-    (float)2.15158e-05,
-    (float)1.15364e-05,
-    (float)1.94809e-05,
-    (float)2.11445e-05,
-    (float)9.04219e-06,
-    (float)2.0685e-05,
-    (float)2.00375e-05,
-    (float)8.79283e-06,
-    (float)1.98736e-05,
-    (float)1.76665e-05,
-    (float)1.06222e-05,
-    (float)1.77814e-05,
-    (float)1.43272e-05,
-    (float)1.31011e-05,
-    (float)1.53722e-05,
-    (float)1.09154e-05,
-    (float)1.47036e-05,
-    (float)1.34013e-05,
-    (float)8.49665e-06,
-    (float)1.46898e-05,
-    (float)1.20081e-05,
-    (float)7.48345e-06,
-    (float)1.34714e-05,
-    (float)1.12229e-05,
-    (float)7.42916e-06,
-    (float)1.20301e-05,
-    (float)1.11889e-05,
-    (float)7.53854e-06,
-    (float)0.0149783,
-    (float)0.0110193,
-    (float)0.665215,
-    (float)0.00517739,
-    (float)0.00809093,
-    (float)0.146825,
-    (float)0.00444791,
-    (float)0.00737389,
-    (float)0.0536797,
-    (float)0.0034613,
-    (float)0.00660319,
-    (float)0.0231315,
-    (float)0.00250132,
-    (float)0.00557514,
-    (float)0.0105522,
-    (float)0.00172373,
-    (float)0.00436342,
-    (float)0.00487651,
-    (float)0.00117212,
-    (float)0.00312935,
-    (float)0.00226657,
-    (float)0.000819161,
-    (float)0.00202899,
-    (float)0.00109377,
-    (float)0.000606142,
-    (float)0.00116422,
-    (float)0.000587249,
-    (float)0.000471692,
-    (float)0.000570218,
-    (float)0.000373354,
-    (float)0.000369385,
-    (float)0.000225697,
-    (float)0.000279368,
-    (float)0.000274648,
-    (float)7.24137e-05,
-    (float)0.000233202,
-    (float)0.000182876,
-    (float)3.81404e-05,
-    (float)0.000208527,
-    (float)0.000102322,
-    (float)5.75095e-05,
-    (float)0.000196046,
-    (float)4.52651e-05,
-    (float)8.45488e-05,
-    (float)0.000190294,
-    (float)2.02533e-05,
-    (float)9.54889e-05,
-    (float)0.000185913,
-    (float)2.73074e-05,
-    (float)8.48762e-05,
-    (float)0.000178128,
-    (float)5.74727e-05,
-    (float)5.92913e-05,
-    (float)0.000164085,
-    (float)9.66151e-05,
-    (float)3.06911e-05,
-    (float)0.000143289,
-    (float)0.000131264,
-    (float)1.04979e-05,
-    (float)0.000117543,
-    (float)0.000151393,
-    (float)4.40849e-06,
-    (float)9.12437e-05,
-    (float)0.000151736,
-    (float)1.2322e-05,
-    (float)6.85113e-05,
-    (float)0.000133317,
-    (float)2.96418e-05,
-    (float)5.19994e-05,
-    (float)0.000102238,
-    (float)4.95048e-05,
-    (float)4.22951e-05,
-    (float)6.71558e-05,
-    (float)6.52874e-05,
-    (float)3.80589e-05,
-    (float)3.63805e-05,
-    (float)7.26828e-05,
-    (float)3.67261e-05,
-    (float)1.56205e-05,
-    (float)7.06834e-05,
-    (float)3.5505e-05,
-    (float)6.77175e-06,
-    (float)6.13672e-05,
-    (float)3.23733e-05,
-    (float)8.01123e-06,
-    (float)4.86695e-05,
-    (float)2.67111e-05,
-    (float)1.50263e-05,
-    (float)3.67124e-05,
-    (float)1.93726e-05,
-    (float)2.28762e-05,
-    (float)2.83388e-05,
-    (float)1.22033e-05,
-    (float)2.77005e-05,
-    (float)2.43004e-05,
-    (float)7.11259e-06,
-    (float)2.7867e-05,
-    (float)2.35109e-05,
-    (float)5.2269e-06,
-    (float)2.40406e-05,
-    (float)2.39032e-05,
-    (float)6.41284e-06,
-    (float)1.84611e-05,
-    (float)2.35124e-05,
-    (float)9.40784e-06,
-    (float)1.37271e-05,
-    (float)2.13035e-05,
-    (float)1.24766e-05,
-    (float)1.15904e-05,
-    (float)1.74428e-05,
-    (float)1.42006e-05,
-    (float)1.23209e-05,
-    (float)1.30081e-05,
-    (float)1.40336e-05,
-    (float)1.47906e-05,
-    (float)9.23428e-06,
-    (float)1.25927e-05,
-    (float)1.72404e-05,
-    (float)6.83617e-06,
-    (float)1.11354e-05,
-    (float)1.82064e-05,
-    (float)5.82487e-06,
-    (float)1.08599e-05,
-    (float)1.718e-05,
-    (float)5.65588e-06,
-    (float)1.22432e-05,
-    (float)1.47634e-05,
-    (float)5.6908e-06,
-    (float)0.00748919,
-    (float)0.00853766,
-    (float)0.651299,
-    (float)0.00455444,
-    (float)0.00698534,
-    (float)0.149048,
-    (float)0.00403196,
-    (float)0.0066306,
-    (float)0.0575171,
-    (float)0.00329597,
-    (float)0.00622368,
-    (float)0.026678,
-    (float)0.00252696,
-    (float)0.00563725,
-    (float)0.0134088,
-    (float)0.00182642,
-    (float)0.00488498,
-    (float)0.00702022,
-    (float)0.00124627,
-    (float)0.00403204,
-    (float)0.00380595,
-    (float)0.000802686,
-    (float)0.00316,
-    (float)0.00218429,
-    (float)0.000487985,
-    (float)0.00234413,
-    (float)0.00138181,
-    (float)0.000280911,
-    (float)0.00164001,
-    (float)0.000990454,
-    (float)0.000154704,
-    (float)0.00107911,
-    (float)0.000790778,
-    (float)8.30805e-05,
-    (float)0.000669195,
-    (float)0.000668578,
-    (float)4.43482e-05,
-    (float)0.000398285,
-    (float)0.000569873,
-    (float)2.33374e-05,
-    (float)0.00024082,
-    (float)0.000474462,
-    (float)1.13988e-05,
-    (float)0.000165219,
-    (float)0.000379794,
-    (float)5.02893e-06,
-    (float)0.000140611,
-    (float)0.000290598,
-    (float)3.85633e-06,
-    (float)0.000141175,
-    (float)0.000212647,
-    (float)8.63304e-06,
-    (float)0.000148098,
-    (float)0.000149717,
-    (float)1.96843e-05,
-    (float)0.000149863,
-    (float)0.000102697,
-    (float)3.61772e-05,
-    (float)0.000141468,
-    (float)6.99638e-05,
-    (float)5.609e-05,
-    (float)0.000123976,
-    (float)4.8932e-05,
-    (float)7.63207e-05,
-    (float)0.000101591,
-    (float)3.63498e-05,
-    (float)9.33354e-05,
-    (float)7.95091e-05,
-    (float)2.91631e-05,
-    (float)0.000103934,
-    (float)6.2234e-05,
-    (float)2.50704e-05,
-    (float)0.000105984,
-    (float)5.24727e-05,
-    (float)2.27502e-05,
-    (float)9.89229e-05,
-    (float)5.06399e-05,
-    (float)2.17552e-05,
-    (float)8.39053e-05,
-    (float)5.4996e-05,
-    (float)2.21729e-05,
-    (float)6.35858e-05,
-    (float)6.23099e-05,
-    (float)2.41762e-05,
-    (float)4.15991e-05,
-    (float)6.88599e-05,
-    (float)2.7631e-05,
-    (float)2.18055e-05,
-    (float)7.148e-05,
-    (float)3.18915e-05,
-    (float)7.47357e-06,
-    (float)6.83712e-05,
-    (float)3.58473e-05,
-    (float)6.11336e-07,
-    (float)5.94975e-05,
-    (float)3.81814e-05,
-    (float)1.61427e-06,
-    (float)4.64148e-05,
-    (float)3.78262e-05,
-    (float)9.29979e-06,
-    (float)3.16547e-05,
-    (float)3.43098e-05,
-    (float)2.12421e-05,
-    (float)1.79852e-05,
-    (float)2.79543e-05,
-    (float)3.43786e-05,
-    (float)7.68873e-06,
-    (float)1.9828e-05,
-    (float)4.5717e-05,
-    (float)2.06584e-06,
-    (float)1.14836e-05,
-    (float)5.29816e-05,
-    (float)1.24793e-06,
-    (float)4.57499e-06,
-    (float)5.50336e-05,
-    (float)4.28014e-06,
-    (float)5.853e-07,
-    (float)5.18128e-05,
-    (float)9.49344e-06,
-    (float)4.73724e-07,
-    (float)4.42216e-05,
-    (float)1.49846e-05,
-    (float)4.50785e-06,
-    (float)3.3832e-05,
-    (float)1.90553e-05,
-    (float)1.2231e-05,
-    (float)2.25392e-05,
-    (float)2.05489e-05,
-    (float)0.00452264,
-    (float)0.0063171,
-    (float)0.635471,
-    (float)0.00396526,
-    (float)0.00586389,
-    (float)0.149121,
-    (float)0.00346495,
-    (float)0.00582222,
-    (float)0.0596542,
-    (float)0.00287265,
-    (float)0.00568892,
-    (float)0.0289902,
-    (float)0.00226688,
-    (float)0.0054148,
-    (float)0.0154284,
-    (float)0.00169577,
-    (float)0.00500581,
-    (float)0.00863193,
-    (float)0.00119212,
-    (float)0.00448865,
-    (float)0.0050183,
-    (float)0.000776102,
-    (float)0.00390053,
-    (float)0.00305967,
-    (float)0.000456332,
-    (float)0.00328293,
-    (float)0.00200495,
-    (float)0.000231231,
-    (float)0.00267629,
-    (float)0.00144738,
-    (float)9.10508e-05,
-    (float)0.00211582,
-    (float)0.00115369,
-    (float)2.03921e-05,
-    (float)0.00162837,
-    (float)0.000987727,
-    (float)8.97867e-07,
-    (float)0.00123067,
-    (float)0.000872127,
-    (float)1.38197e-05,
-    (float)0.000929009,
-    (float)0.00076676,
-    (float)4.21753e-05,
-    (float)0.000720075,
-    (float)0.000655162,
-    (float)7.23159e-05,
-    (float)0.00059279,
-    (float)0.00053526,
-    (float)9.48108e-05,
-    (float)0.000530697,
-    (float)0.000412716,
-    (float)0.000104653,
-    (float)0.000514571,
-    (float)0.000296187,
-    (float)0.000100871,
-    (float)0.000524917,
-    (float)0.00019409,
-    (float)8.56925e-05,
-    (float)0.000544092,
-    (float)0.000112634,
-    (float)6.34374e-05,
-    (float)0.000557886,
-    (float)5.48862e-05,
-    (float)3.93312e-05,
-    (float)0.00055648,
-    (float)2.06507e-05,
-    (float)1.84032e-05,
-    (float)0.000534764,
-    (float)6.93291e-06,
-    (float)4.60715e-06,
-    (float)0.000492071,
-    (float)8.76929e-06,
-    (float)2.4755e-07,
-    (float)0.000431443,
-    (float)2.02286e-05,
-    (float)5.74682e-06,
-    (float)0.000358552,
-    (float)3.54109e-05,
-    (float)1.97411e-05,
-    (float)0.000280451,
-    (float)4.93036e-05,
-    (float)3.94515e-05,
-    (float)0.000204331,
-    (float)5.8389e-05,
-    (float)6.12497e-05,
-    (float)0.000136421,
-    (float)6.09399e-05,
-    (float)8.13177e-05,
-    (float)8.11789e-05,
-    (float)5.69872e-05,
-    (float)9.62977e-05,
-    (float)4.0859e-05,
-    (float)4.79931e-05,
-    (float)0.00010383,
-    (float)1.54626e-05,
-    (float)3.63096e-05,
-    (float)0.000102901,
-    (float)3.0612e-06,
-    (float)2.45375e-05,
-    (float)9.3944e-05,
-    (float)3.94544e-07,
-    (float)1.49127e-05,
-    (float)7.86871e-05,
-    (float)3.61843e-06,
-    (float)8.84136e-06,
-    (float)5.97747e-05,
-    (float)9.05862e-06,
-    (float)6.66716e-06,
-    (float)4.02369e-05,
-    (float)1.38327e-05,
-    (float)7.70788e-06,
-    (float)2.29096e-05,
-    (float)1.62348e-05,
-    (float)1.05354e-05,
-    (float)9.91933e-06,
-    (float)1.58292e-05,
-    (float)1.34236e-05,
-    (float)2.33423e-06,
-    (float)1.32593e-05,
-    (float)1.48519e-05,
-    (float)4.97314e-08,
-    (float)9.8386e-06,
-    (float)1.39415e-05,
-    (float)1.92786e-06,
-    (float)7.03194e-06,
-    (float)1.07204e-05,
-    (float)6.15308e-06,
-    (float)5.95778e-06,
-};
-HarmData sweep5_coeff = { harm_data, 120, 128 };
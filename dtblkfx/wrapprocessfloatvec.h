@@ -126,6 +126,23 @@ struct PZero
   inline void process(float* x, long n) { memset(x, 0, n * sizeof(float)); }
 };
 
+//------------------------------------------------------------------------------------------
+struct PPeak
+// find the biggest magnitude in x
+{
+  float peak;
+  PPeak() { peak = 0.0f; }
+  void setLen(long n) {}
+  inline void process(float* x, long n)
+  {
+    for (long i = 0; i < n; i++) {
+      float t = fabsf(x[i]);
+      if (t > peak)
+        peak = t;
+    }
+  }
+};
+
 //------------------------------------------------------------------------------------------
 struct PCopyOut
     : public PZero
@@ -156,6 +173,21 @@ struct PAddOut
   }
 };
 
+//------------------------------------------------------------------------------------------
+struct PCopyIn
+    : public PZero
+// copy a non-fifo buffer into FIFO "x"
+// src => x
+{
+  const float* src;
+  PCopyIn(const float* src_ = NULL) { src = src_; }
+  void process(float* x, long n)
+  {
+    memcpy(x, src, n * sizeof(float));
+    src += n;
+  }
+};
+
 //------------------------------------------------------------------------------------------
 template <class INTERP_PROC, int REVERSE = 0>
 struct PLinInterp
@@ -14,7 +14,9 @@
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
 
 #include <stdio.h>
@@ -26,9 +28,12 @@
 #include <vstsdk/public.sdk/source/vst2.x/audioeffectx.h>
 #include <vstsdk/public.sdk/source/vst2.x/aeffeditor.h>
 
+// the command line tool can be built without the GUI (see CMakeLists.txt)
+#ifndef DTBLKFX_HEADLESS
 #include <vstgui/vstgui.h>
 #include <vstgui/vstcontrols.h>
 #include <vstgui/aeffguieditor.h>
+#endif
 
 using namespace std;
 
@@ -0,0 +1,162 @@
+/**************************************************************************************************
+"bench-fft" command: time the fft of all channels done one channel at a time against the batched
+plans for every fft size
+
+Buffers are laid out the same way as a DtBlkFx x1 & x2 set. Each run is a forward &
+inverse transform of every channel, "separate" uses g_fft_plan & g_ifft_plan once per channel
+(inverse into channel 0 like DtBlkFx does without batching), "batched" uses g_fft_batch_plan &
+g_ifft_batch_plan once.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "HeadlessHost.h"
+#include "ToolCmds.h"
+#include "rfftw_float.h"
+
+using namespace std;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+//-------------------------------------------------------------------------------------------------
+int BenchFFTUsage()
+{
+  cerr << "usage: dtblkfx_tool bench-fft [options]\n"
+          "  -min-sz <n>     smallest fft size to run (default 256)\n"
+          "  -max-sz <n>     largest fft size to run (default 80640)\n"
+          "  -time <sec>     minimum time spent on each measurement (default 0.05)\n"
+          "  -csv            comma separated output\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+struct FFTBench {
+  int plan;
+  double min_sec;
+  ScopeFFTWfMalloc<float> x; // time-domain, FFT_BATCH_TIME_DIST per channel
+  ScopeFFTWfMalloc<cplxf> y; // frequency-domain, FFT_BATCH_FREQ_DIST per channel
+
+  FFTBench() : x(FFT_BATCH_N * FFT_BATCH_TIME_DIST), y(FFT_BATCH_N * FFT_BATCH_FREQ_DIST) {}
+
+  float* X(int ch) { return x + ch * FFT_BATCH_TIME_DIST; }
+  fftwf_complex* Y(int ch) { return to_fftwf_complex(y + ch * FFT_BATCH_FREQ_DIST + 32); }
+
+  // fill the input of all channels (c2r scales by n so this is done before every run)
+  void fill()
+  {
+    int n = g_fft_sz[plan];
+    for (int ch = 0; ch < FFT_BATCH_N; ch++)
+      for (int i = 0; i < n; i++)
+        X(ch)[i] = (float)(((i + ch * 31) * 7919) % 1000) * 1e-3f - 0.5f;
+  }
+
+  // average seconds per run
+  template <class FN> double time(FN fn)
+  {
+    double total = 0.0;
+    long runs = 0;
+    while (total < min_sec || runs < 3) {
+      fill();
+      Clock::time_point t0 = Clock::now();
+      fn();
+      total += chrono::duration<double>(Clock::now() - t0).count();
+      runs++;
+    }
+    return total / runs;
+  }
+
+  double timeSeparate()
+  {
+    return time([this] {
+      for (int ch = 0; ch < FFT_BATCH_N; ch++) {
+        FFTWf::execute_dft_r2c(g_fft_plan[plan], X(ch), Y(ch));
+        FFTWf::execute_dft_c2r(g_ifft_plan[plan], Y(ch), X(0));
+      }
+    });
+  }
+
+  double timeBatched()
+  {
+    return time([this] {
+      FFTWf::execute_dft_r2c(g_fft_batch_plan[plan], X(0), Y(0));
+      FFTWf::execute_dft_c2r(g_ifft_batch_plan[plan], Y(0), X(0));
+    });
+  }
+};
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+int BenchFFTCmd(int argc, char** argv)
+{
+  long min_sz = MIN_FFT_SZ;
+  long max_sz = MAX_FFT_SZ;
+  double min_sec = 0.05;
+  bool csv = false;
+
+  for (int i = 0; i < argc; i++) {
+    const char* a = argv[i];
+    bool has_val = i + 1 < argc;
+    if (strcmp(a, "-min-sz") == 0 && has_val)
+      min_sz = atol(argv[++i]);
+    else if (strcmp(a, "-max-sz") == 0 && has_val)
+      max_sz = atol(argv[++i]);
+    else if (strcmp(a, "-time") == 0 && has_val)
+      min_sec = atof(argv[++i]);
+    else if (strcmp(a, "-csv") == 0)
+      csv = true;
+    else
+      return BenchFFTUsage();
+  }
+
+  if (FFT_BATCH_N < 2) {
+    cerr << "no batched plans in this build (FFT_BATCH_N is 1)\n";
+    return 1;
+  }
+
+  FFTBench bench;
+  bench.min_sec = min_sec;
+
+  if (csv)
+    printf("fft_n,separate_us,batched_us,speedup\n");
+  else
+    printf("%7s %12s %12s %8s\n", "fft_n", "separate us", "batched us", "speedup");
+
+  SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+
+  for (int plan = 0; plan < NUM_FFT_SZ; plan++) {
+    if (g_fft_sz[plan] < min_sz || g_fft_sz[plan] > max_sz)
+      continue;
+    if (!WarmFFTWfPlan(plan))
+      throw 0;
+
+    bench.plan = plan;
+    double sep_sec = bench.timeSeparate();
+    double batch_sec = bench.timeBatched();
+
+    const char* fmt = csv ? "%d,%.3f,%.3f,%.3f\n" : "%7d %12.2f %12.2f %8.2f\n";
+    printf(fmt,
+           g_fft_sz[plan],
+           sep_sec * 1e6,
+           batch_sec * 1e6,
+           batch_sec > 0.0 ? sep_sec / batch_sec : 0.0);
+    fflush(stdout);
+  }
+  return 0;
+}
@@ -0,0 +1,244 @@
+/**************************************************************************************************
+"bench-fx" command: time every 1.0 effect in isolation for every fft size
+
+Each effect is run through FxState1_0::process() on a synthetic spectrum (harmonic series with a
+1/f envelope over a noise floor) covering the full frequency range, the same way procFFT runs a
+slot. The spectrum is restored before every run and the restore is not timed.
+
+Results are reported as ns per bin (bins = fft_n/2+1, all channels processed per run), bins per
+second and the cost relative to one fftw r2c+c2r pair of the same size.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "HeadlessHost.h"
+#include "ToolCmds.h"
+#include "rfftw_float.h"
+
+using namespace std;
+
+namespace {
+
+enum { AUDIO_CHANNELS = DtBlkFx::AUDIO_CHANNELS };
+
+typedef chrono::steady_clock Clock;
+
+//-------------------------------------------------------------------------------------------------
+int BenchFxUsage()
+{
+  cerr << "usage: dtblkfx_tool bench-fx [options]\n"
+          "  -fx <name>      only run effects whose name contains <name>\n"
+          "  -min-sz <n>     smallest fft size to run (default 256)\n"
+          "  -max-sz <n>     largest fft size to run (default 80640)\n"
+          "  -time <sec>     minimum time spent on each measurement (default 0.05)\n"
+          "  -val <0..1>     effect value param (default 0.5)\n"
+          "  -csv            comma separated output\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void MakeSpectrum(vector<cplxf>& dst, int bins, int ch)
+// fill "dst" with a synthetic spectrum: harmonics of a fundamental at ~110Hz (at 44.1k, 4096
+// bins) with a 1/f envelope over a -80dB noise floor
+{
+  dst.resize(bins);
+  long rnd = 0x1234567 + ch * 77;
+  float fund = bins * (10.0f / 2049.0f);
+  if (fund < 2.0f)
+    fund = 2.0f;
+  for (int i = 0; i < bins; i++) {
+    rnd = prbs32(rnd);
+    float noise = 1e-4f * (float)(rnd & 0xffff) / 65536.0f;
+    float h = (float)i / fund;
+    float dist = h - floorf(h + 0.5f);
+    float harm = (fabsf(dist) * fund < 1.5f && h >= 0.5f) ? 1.0f / h : 0.0f;
+    dst[i] = g_sincos_table[rnd >> 8] * (harm + noise);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+struct FxBench {
+  DtBlkFx* b;
+  double min_sec;
+  float val;
+
+  // source spectra for each channel
+  vector<cplxf> src[AUDIO_CHANNELS];
+
+  void setSize(int plan)
+  {
+    if (!WarmFFTWfPlan(plan))
+      throw 0;
+    b->_plan = plan;
+    b->_freq_fft_n = g_fft_sz[plan];
+    b->_time_fft_n = g_fft_sz[plan];
+    b->_data_pre_x0_n = 0;
+
+    int bins = b->_freq_fft_n / 2 + 1;
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+      MakeSpectrum(src[ch], bins, ch);
+      b->_chan[ch].total_in_pwr = b->_chan[ch].total_out_pwr = GetPwr(&src[ch][0], bins);
+    }
+  }
+
+  void restore()
+  {
+    int bins = b->_freq_fft_n / 2 + 1;
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+      Copy(b->FFTdata(ch), &src[ch][0], bins);
+  }
+
+  // set the temporaries of an fx slot the same way as FxState1_0::prepare() would
+  void prepareSlot(FxState1_0& s, FxRun1_0* fx, float amp_param)
+  {
+    s.temp.fft_fx = fx;
+    s.temp.amp_param = amp_param;
+    s.temp.amp = BlkFxParam::getEffectAmpMult(amp_param, fx->ampMixMode());
+    s.temp.val = val;
+    float freq_param[2] = {0.0f, 1.0f};
+    for (int i = 0; i < 2; i++) {
+      s.temp.freq_param[i] = freq_param[i];
+      s.temp.fbin[i] = b->getFFTBin(freq_param[i]);
+      s.temp.bin[i] = RndToInt(s.temp.fbin[i]);
+    }
+  }
+
+  // average seconds per run of effect "fx"
+  double timeFx(FxRun1_0* fx)
+  {
+    // slot 0 is left empty so that effects looking at the previous slot (masks) see nothing
+    prepareSlot(b->_fx1_0[0], GetFxRun1_0(-1), 0.5f);
+    prepareSlot(b->_fx1_0[1], fx, BlkFxParam::getAmpParam(-6.0f));
+
+    double total = 0.0;
+    long runs = 0;
+    while (total < min_sec || runs < 3) {
+      restore();
+      Clock::time_point t0 = Clock::now();
+      b->_fx1_0[1].process();
+      total += chrono::duration<double>(Clock::now() - t0).count();
+      runs++;
+    }
+    return total / runs;
+  }
+
+  // average seconds per r2c+c2r pair (single channel)
+  double timeFFTPair()
+  {
+    float* x0 = b->_chan[0].x0;
+    float* x2 = b->_chan[0].x2;
+    for (int i = 0; i < b->_freq_fft_n; i++)
+      x0[i] = (float)((i * 7919) % 1000) * 1e-3f - 0.5f;
+
+    double total = 0.0;
+    long runs = 0;
+    while (total < min_sec || runs < 3) {
+      Clock::time_point t0 = Clock::now();
+      FFTWf::execute_dft_r2c(g_fft_plan[b->_plan], x0, to_fftwf_complex(b->FFTdata(0)));
+      FFTWf::execute_dft_c2r(g_ifft_plan[b->_plan], to_fftwf_complex(b->FFTdata(0)), x2);
+      total += chrono::duration<double>(Clock::now() - t0).count();
+      runs++;
+    }
+    return total / runs;
+  }
+};
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+int BenchFxCmd(int argc, char** argv)
+{
+  const char* fx_filter = NULL;
+  long min_sz = MIN_FFT_SZ;
+  long max_sz = MAX_FFT_SZ;
+  double min_sec = 0.05;
+  float val = 0.5f;
+  bool csv = false;
+
+  for (int i = 0; i < argc; i++) {
+    const char* a = argv[i];
+    bool has_val = i + 1 < argc;
+    if (strcmp(a, "-fx") == 0 && has_val)
+      fx_filter = argv[++i];
+    else if (strcmp(a, "-min-sz") == 0 && has_val)
+      min_sz = atol(argv[++i]);
+    else if (strcmp(a, "-max-sz") == 0 && has_val)
+      max_sz = atol(argv[++i]);
+    else if (strcmp(a, "-time") == 0 && has_val)
+      min_sec = atof(argv[++i]);
+    else if (strcmp(a, "-val") == 0 && has_val)
+      val = limit_range((float)atof(argv[++i]), 0.0f, 1.0f);
+    else if (strcmp(a, "-csv") == 0)
+      csv = true;
+    else
+      return BenchFxUsage();
+  }
+
+  HeadlessInstance inst(44100.0f, 512);
+
+  FxBench bench;
+  bench.b = inst.fx;
+  bench.min_sec = min_sec;
+  bench.val = val;
+
+  // gather the distinct effects (the table has some duplicate "no fx" entries)
+  vector<FxRun1_0*> fx_list;
+  for (int i = 0; i < g_num_fx_1_0; i++) {
+    FxRun1_0* fx = GetFxRun1_0(i);
+    if (find(fx_list.begin(), fx_list.end(), fx) != fx_list.end())
+      continue;
+    if (fx_filter && !strstr(fx->name(), fx_filter))
+      continue;
+    fx_list.push_back(fx);
+  }
+
+  if (csv)
+    printf("fx,fft_n,ns_per_bin,mbins_per_sec,x_fft_pair\n");
+  else
+    printf("%-16s %7s %10s %10s %10s\n", "fx", "fft_n", "ns/bin", "Mbins/s", "x fftpair");
+
+  SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+
+  for (int plan = 0; plan < NUM_FFT_SZ; plan++) {
+    if (g_fft_sz[plan] < min_sz || g_fft_sz[plan] > max_sz)
+      continue;
+
+    bench.setSize(plan);
+    double fft_pair_sec = bench.timeFFTPair();
+    double bins = (double)(g_fft_sz[plan] / 2 + 1);
+
+    for (int i = 0; i < (int)fx_list.size(); i++) {
+      double sec = bench.timeFx(fx_list[i]);
+      const char* fmt = csv ? "%s,%d,%.3f,%.2f,%.3f\n" : "%-16s %7d %10.3f %10.2f %10.3f\n";
+      printf(fmt,
+             fx_list[i]->name(),
+             g_fft_sz[plan],
+             sec * 1e9 / bins,
+             sec > 0.0 ? bins / sec * 1e-6 : 0.0,
+             sec / fft_pair_sec);
+    }
+    if (!csv)
+      printf("%-16s %7d %10.3f %10.2f %10.3f\n",
+             "(r2c+c2r)",
+             g_fft_sz[plan],
+             fft_pair_sec * 1e9 / bins,
+             bins / fft_pair_sec * 1e-6,
+             1.0);
+    fflush(stdout);
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+/**************************************************************************************************
+dtblkfx_tool: command line front end for running the DtBlkFx engine without a VST host
+
+usage: dtblkfx_tool <command> [args...]
+run with no args to get a list of commands, "<command> -h" for help on a command
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <iostream>
+#include <sstream>
+#include <string.h>
+
+#include "HeadlessHost.h"
+#include "ToolCmds.h"
+
+using namespace std;
+
+//-------------------------------------------------------------------------------------------------
+struct {
+  const char* name;
+  ToolCmdFn fn;
+  const char* help;
+} g_tool_cmds[] = {
+    {"render", RenderCmd, "render a wav file through a preset"},
+    {"bench-fx", BenchFxCmd, "time each effect for each fft size"},
+    {"bench-fft", BenchFFTCmd, "time separate vs batched channel ffts for each fft size"},
+    {"kernels", KernelsCmd, "check & time the vector spectrum kernels"},
+    {"stress", StressCmd, "run many instances on many threads & check the output"},
+    {"harm-tables", HarmTablesCmd, "check or write the compressed harmonic tables"},
+    {"wisdom", WisdomCmd, "measure fftw plans & save the wisdom file"},
+    {"governor", GovernorCmd, "check the overlap steps dropped by the quality governor"},
+};
+
+//-------------------------------------------------------------------------------------------------
+static void Usage()
+{
+  cerr << "usage: dtblkfx_tool <command> [args...]\n"
+          "commands (run a command with -h for help):\n";
+  for (size_t i = 0; i < NUM_ELEMENTS(g_tool_cmds); i++)
+    cerr << "  " << g_tool_cmds[i].name << "\t" << g_tool_cmds[i].help << "\n";
+}
+
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  if (argc < 2) {
+    Usage();
+    return 1;
+  }
+
+  for (size_t i = 0; i < NUM_ELEMENTS(g_tool_cmds); i++) {
+    if (strcmp(argv[1], g_tool_cmds[i].name) != 0)
+      continue;
+
+    ostringstream err_str;
+    if (!HeadlessInit(argv[0], &err_str)) {
+      cerr << "init failed: " << err_str.str() << "\n";
+      return 1;
+    }
+
+    try {
+      return g_tool_cmds[i].fn(argc - 2, argv + 2);
+    }
+    // allocation failures are thrown as 0
+    catch (...) {
+      cerr << argv[1] << " failed (out of memory?)\n";
+      return 1;
+    }
+  }
+
+  cerr << "unknown command: " << argv[1] << "\n";
+  Usage();
+  return 1;
+}
@@ -0,0 +1,80 @@
+/**************************************************************************************************
+"governor" command: check that every overlap step the quality governor drops gives fewer fft blks
+
+For each fft size & overlap part (see BlkFxParam::getOverlapPart) the samples moved forward between
+blks (BlkFxParam::getBlkShiftFwd) must never get smaller as CpuGovernor::overlapDrop goes up. The
+shift at full overlap is printed for each drop.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <iostream>
+#include <stdio.h>
+
+#include "BlkFxParam.h"
+#include "CpuGovernor.h"
+#include "ToolCmds.h"
+#include "rfftw_float.h"
+
+using namespace std;
+
+//-------------------------------------------------------------------------------------------------
+int GovernorCmd(int argc, char** argv)
+{
+  if (argc > 0) {
+    cerr << "usage: dtblkfx_tool governor\n";
+    return 1;
+  }
+
+  // overlap parts checked between 0 & 1
+  const int OVERLAP_STEPS = 1024;
+
+  int n_fail = 0;
+  printf("%8s", "fft size");
+  for (int drop = 0; drop <= CpuGovernor::MAX_OVERLAP_DROP; drop++)
+    printf(" %6s%d", "drop ", drop);
+  printf("\n");
+
+  for (int plan = 0; plan < NUM_FFT_SZ; plan++) {
+    int fft_n = g_fft_sz[plan];
+    for (int i = 0; i <= OVERLAP_STEPS; i++) {
+      float overlap = (float)i / OVERLAP_STEPS;
+      long prev_fwd_n = 0;
+      for (int drop = 0; drop <= CpuGovernor::MAX_OVERLAP_DROP; drop++) {
+        long fwd_n = BlkFxParam::getBlkShiftFwd(CpuGovernor::dropOverlap(overlap, drop), fft_n);
+        if (fwd_n < prev_fwd_n) {
+          if (!n_fail)
+            printf("fft size %d overlap %g: drop %d moves %ld samples, drop %d moved %ld\n",
+                   fft_n,
+                   overlap,
+                   drop,
+                   fwd_n,
+                   drop - 1,
+                   prev_fwd_n);
+          n_fail++;
+        }
+        prev_fwd_n = fwd_n;
+      }
+    }
+
+    // shift at full overlap
+    printf("%8d", fft_n);
+    for (int drop = 0; drop <= CpuGovernor::MAX_OVERLAP_DROP; drop++)
+      printf(" %7ld", BlkFxParam::getBlkShiftFwd(CpuGovernor::dropOverlap(1.0f, drop), fft_n));
+    printf("\n");
+  }
+
+  printf("check overlap drop: %s", n_fail ? "FAILED" : "ok");
+  if (n_fail)
+    printf(" (%d shifts got smaller)", n_fail);
+  printf("\n");
+  return n_fail ? 1 : 0;
+}
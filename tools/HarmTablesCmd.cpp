@@ -0,0 +1,271 @@
+/**************************************************************************************************
+"harm-tables" command: check the decoded harmonic tables & write the compressed tables
+
+With no args the decoded tables are checked against the hashes stored with them. The original
+tables (sweep1_coeff.cpp ... sweep5_coeff.cpp, one "(float)<value>," per line) can be passed with
+"-ref" to compare every value, e.g. after "git show <rev>:dtblkfx/sweep1_coeff.cpp > sweep1.cpp".
+"-write" encodes the original tables into HarmDataZ.cpp, see HarmData.cpp for the format.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "HarmData.h"
+#include "ToolCmds.h"
+#include "zlib.h"
+
+using namespace std;
+
+namespace {
+
+enum {
+  TABLE_N = HARM_SWEEP_N * HARM_N,
+  TOTAL_N = NUM_HARM_TABLES * TABLE_N,
+
+  // base64 chars per line & lines per string in HarmDataZ.cpp (compilers limit string length)
+  LINE_CHARS = 92,
+  STRING_LINES = 160
+};
+
+const char* const g_table_names[NUM_HARM_TABLES] = {
+    "Triangles", "Squares", "Saws", "Pointy", "Sweep"};
+
+//-------------------------------------------------------------------------------------------------
+int HarmTablesUsage()
+{
+  cerr << "usage: dtblkfx_tool harm-tables [options]\n"
+          "  -ref <files>          compare with the original tables (sweep1_coeff.cpp ...\n"
+          "                        sweep5_coeff.cpp, all 5 in order)\n"
+          "  -write <out> <files>  encode the original tables & write them to <out>\n"
+          "                        (HarmDataZ.cpp)\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ ParseValue(const char* s, unsigned* code, float* value)
+// "s" is a decimal float literal with up to 6 significant digits
+{
+  unsigned long long mant = 0;
+  int frac_n = 0;
+  bool frac = false;
+  const char* p = s;
+  for (; *p && *p != 'e' && *p != 'E'; p++) {
+    if (*p == '.')
+      frac = true;
+    else if (*p >= '0' && *p <= '9') {
+      if (mant >= 100000000000ull)
+        return false;
+      mant = mant * 10 + (*p - '0');
+      frac_n += frac;
+    }
+    else
+      return false;
+  }
+  if (!mant)
+    return false;
+
+  // normalise to 6 digits
+  int exp10 = (*p ? atoi(p + 1) : 0) - frac_n + 5;
+  for (; mant < 100000; mant *= 10)
+    exp10--;
+  for (; mant >= 1000000; mant /= 10) {
+    if (mant % 10)
+      return false;
+    exp10++;
+  }
+  if (exp10 < -17 || exp10 > 0)
+    return false;
+
+  // must decode to what the compiler made of the literal
+  *code = HarmValueCode((unsigned)mant, exp10);
+  *value = (float)strtod(s, NULL);
+  float decoded = HarmCodeToValue(*code);
+  return memcmp(&decoded, value, sizeof(float)) == 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ ReadTable(const char* path, unsigned* code, float* value)
+// read TABLE_N values from an original table file
+{
+  ifstream f(path);
+  if (!f) {
+    cerr << "can't open " << path << "\n";
+    return false;
+  }
+  stringstream ss;
+  ss << f.rdbuf();
+  string text = ss.str();
+
+  const char* tag = "(float)";
+  int n = 0;
+  for (size_t i = text.find(tag); i != string::npos; i = text.find(tag, i)) {
+    i += strlen(tag);
+    size_t end = text.find(',', i);
+    if (end == string::npos || n >= TABLE_N)
+      break;
+    string s = text.substr(i, end - i);
+    if (!ParseValue(s.c_str(), code + n, value + n)) {
+      cerr << path << ": can't encode value " << n << " \"" << s << "\" exactly\n";
+      return false;
+    }
+    n++;
+  }
+  if (n != TABLE_N || text.find(tag, text.rfind(',')) != string::npos) {
+    cerr << path << ": expected " << (int)TABLE_N << " values\n";
+    return false;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ ReadTables(char** paths, vector<unsigned>& code, vector<float>& value)
+{
+  code.resize(TOTAL_N);
+  value.resize(TOTAL_N);
+  for (int i = 0; i < NUM_HARM_TABLES; i++) {
+    if (!ReadTable(paths[i], &code[i * TABLE_N], &value[i * TABLE_N]))
+      return false;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+void Base64Encode(const vector<unsigned char>& src, string& dst)
+{
+  static const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (size_t i = 0; i < src.size(); i += 3) {
+    unsigned v = src[i] << 16;
+    if (i + 1 < src.size())
+      v |= src[i + 1] << 8;
+    if (i + 2 < src.size())
+      v |= src[i + 2];
+    dst += chars[v >> 18];
+    dst += chars[(v >> 12) & 63];
+    dst += i + 1 < src.size() ? chars[(v >> 6) & 63] : '=';
+    dst += i + 2 < src.size() ? chars[v & 63] : '=';
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+int Write(const char* out_path, char** ref_paths)
+{
+  vector<unsigned> code;
+  vector<float> value;
+  if (!ReadTables(ref_paths, code, value))
+    return 1;
+
+  // difference from the same harmonic of the previous waveform, zig-zag, split into byte planes
+  vector<unsigned char> planes(TOTAL_N * 4);
+  for (int i = 0; i < TOTAL_N; i++) {
+    unsigned prev = i % TABLE_N < HARM_N ? 0 : code[i - HARM_N];
+    int d = (int)(code[i] - prev);
+    unsigned zz = ((unsigned)d << 1) ^ (unsigned)(d >> 31);
+    for (int j = 0; j < 4; j++)
+      planes[i + j * TOTAL_N] = (unsigned char)(zz >> (j * 8));
+  }
+
+  vector<unsigned char> z(compressBound((uLong)planes.size()));
+  uLongf z_n = (uLongf)z.size();
+  if (compress2(&z[0], &z_n, &planes[0], (uLong)planes.size(), Z_BEST_COMPRESSION) != Z_OK) {
+    cerr << "compress failed\n";
+    return 1;
+  }
+  z.resize(z_n);
+  string z64;
+  Base64Encode(z, z64);
+
+  ofstream f(out_path);
+  if (!f) {
+    cerr << "can't write " << out_path << "\n";
+    return 1;
+  }
+  f << "// harmonic tables for the HarmMatch effects, see HarmData.cpp for the format\n"
+       "// written by \"dtblkfx_tool harm-tables -write\", don't edit\n"
+       "#include <StdAfx.h>\n"
+       "\n"
+       "#include \"HarmData.h\"\n"
+       "\n"
+       "const long g_harm_z_n = "
+    << z_n << ";\n\nconst unsigned g_harm_hash[NUM_HARM_TABLES] = {\n    ";
+  for (int i = 0; i < NUM_HARM_TABLES; i++) {
+    char hex[16];
+    sprintf(hex, "0x%08x", HarmDataHash(&value[i * TABLE_N], TABLE_N));
+    f << (i ? ", " : "") << hex;
+  }
+  f << "};\n\nconst char* const g_harm_z64[] = {\n";
+  for (size_t i = 0; i < z64.size(); i += LINE_CHARS) {
+    bool last_line = (i / LINE_CHARS + 1) % STRING_LINES == 0 || i + LINE_CHARS >= z64.size();
+    f << "    \"" << z64.substr(i, LINE_CHARS) << "\"" << (last_line ? ",\n" : "\n");
+  }
+  f << "    NULL};\n";
+
+  printf("wrote %s: %d values, %lu bytes compressed (%.2f bits per value)\n",
+         out_path,
+         (int)TOTAL_N,
+         (unsigned long)z_n,
+         z_n * 8.0 / TOTAL_N);
+  return 0;
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+int HarmTablesCmd(int argc, char** argv)
+{
+  char** ref_paths = NULL;
+  if (argc == NUM_HARM_TABLES + 1 && strcmp(argv[0], "-ref") == 0)
+    ref_paths = argv + 1;
+  else if (argc == NUM_HARM_TABLES + 2 && strcmp(argv[0], "-write") == 0)
+    return Write(argv[1], argv + 2);
+  else if (argc != 0)
+    return HarmTablesUsage();
+
+  vector<unsigned> ref_code;
+  vector<float> ref_value;
+  if (ref_paths && !ReadTables(ref_paths, ref_code, ref_value))
+    return 1;
+
+  int n_fail = 0;
+  for (int i = 0; i < NUM_HARM_TABLES; i++) {
+    const HarmData& t = GetHarmData(i);
+    int n = t.n_tables * t.n_harms;
+    bool ok = n == TABLE_N && HarmDataHash(t.data, n) == g_harm_hash[i];
+
+    // first value that differs from the original
+    int diff = -1;
+    if (ref_paths && n == TABLE_N) {
+      const float* ref = &ref_value[i * TABLE_N];
+      for (diff = 0; diff < n && memcmp(t.data + diff, ref + diff, sizeof(float)) == 0; diff++) {
+      }
+      if (diff < n) {
+        cerr << g_table_names[i] << " value " << diff << " is " << t.data[diff] << ", expected "
+             << ref[diff] << "\n";
+        ok = false;
+      }
+    }
+    printf("%-10s %3d x %3d %s%s\n",
+           g_table_names[i],
+           t.n_tables,
+           t.n_harms,
+           ok ? "ok" : "FAILED",
+           ref_paths && ok ? " (matches original)" : "");
+    n_fail += !ok;
+  }
+  return n_fail ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+/**************************************************************************************************
+Minimal VST host used to run DtBlkFx from the command line
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "HarmData.h"
+#include "HeadlessHost.h"
+#include "rfftw_float.h"
+
+using namespace std;
+
+// from DtBlkFxMain.cpp
+extern CharArray<4096> g_plugin_path;
+extern vector<VstProgram<BlkFxParam::TOTAL_NUM>> g_blk_fx_presets;
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ HeadlessInit(const char* argv0, ostream* err)
+{
+  // plugin path is the directory containing the executable (including trailing slash)
+  Clear(g_plugin_path);
+  g_plugin_path << argv0;
+  int i = g_plugin_path.strlen() - 1;
+  while (i >= 0 && g_plugin_path[i] != '\\' && g_plugin_path[i] != '/' && g_plugin_path[i] != ':')
+    g_plugin_path[i--] = 0;
+
+#ifdef _WIN32
+  vector<string> paths;
+  paths.push_back(g_plugin_path.toString() + "dtblkfx\\");
+  paths.push_back(g_plugin_path);
+  if (!LoadFFTWfDll(paths, err))
+    return false;
+#endif
+
+  // use the same wisdom as the plugin but don't measure anything (see the "wisdom" command)
+  try {
+    InitFFTWfPlans(FFTW_PLAN_ESTIMATE, HeadlessWisdomPath().c_str());
+  }
+  catch (...) {
+    *err << "failed to create fftw plans";
+    return false;
+  }
+
+  try {
+    InitHarmData();
+  }
+  catch (...) {
+    *err << "failed to decode the harmonic tables";
+    return false;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+string HeadlessWisdomPath()
+{
+#ifdef _WIN32
+  return g_plugin_path.toString() + "dtblkfx\\" FFTW_WISDOM_FILE_NAME;
+#else
+  return g_plugin_path.toString() + "dtblkfx/" FFTW_WISDOM_FILE_NAME;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ HeadlessLoadPresets(const char* path, ostream* err)
+{
+  _Ptr<FILE> f = fopen(path, "r");
+  if (!f) {
+    *err << path << " could not be opened";
+    return false;
+  }
+
+  g_blk_fx_presets.clear();
+
+  // same as LoadPresets in DtBlkFxMain.cpp
+  CharArray<8192> line;
+  while (fgets(line, line.size(), f))
+    g_blk_fx_presets.push_back(VstProgram<BlkFxParam::TOTAL_NUM>(line));
+
+  fclose(f);
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+void HeadlessSetPreset(const char* line)
+{
+  g_blk_fx_presets.clear();
+  g_blk_fx_presets.push_back(VstProgram<BlkFxParam::TOTAL_NUM>(line));
+}
+
+//-------------------------------------------------------------------------------------------------
+int HeadlessFindProgram(const char* idx_or_name)
+{
+  // try a number first
+  char* end = NULL;
+  long idx = strtol(idx_or_name, &end, 10);
+  if (end != idx_or_name && *end == 0)
+    return idx >= 0 && idx < (long)g_blk_fx_presets.size() ? idx : -1;
+
+  // otherwise look for the name
+  for (int i = 0; i < (int)g_blk_fx_presets.size(); i++)
+    if (strcmp(g_blk_fx_presets[i].getName(), idx_or_name) == 0)
+      return i;
+
+  return -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+int HeadlessNumPrograms() { return (int)g_blk_fx_presets.size(); }
+
+//-------------------------------------------------------------------------------------------------
+HeadlessInstance::HeadlessInstance(float sample_rate, long block_size, double tempo_)
+{
+  samp_pos = 0;
+  tempo = tempo_;
+  process_level = kVstProcessLevelOffline;
+  memset(&time_info, 0, sizeof(time_info));
+
+  fx = new DtBlkFx(&hostCallback);
+
+  // let the callback find us
+  fx->getAeffect()->user = this;
+
+  // same order as a host: effSetSampleRate, effSetBlockSize, effMainsChanged
+  fx->setSampleRate(sample_rate);
+  fx->setBlockSize(block_size);
+  fx->resume();
+}
+
+//-------------------------------------------------------------------------------------------------
+HeadlessInstance::~HeadlessInstance()
+{
+  fx->suspend();
+  delete fx;
+}
+
+//-------------------------------------------------------------------------------------------------
+void HeadlessInstance::process(float** in, float** out, long n)
+{
+  fx->processReplacing(in, out, n);
+  samp_pos += n;
+}
+
+//-------------------------------------------------------------------------------------------------
+VstIntPtr VSTCALLBACK HeadlessInstance::hostCallback(AEffect* effect, VstInt32 opcode,
+                                                     VstInt32 index, VstIntPtr value, void* ptr,
+                                                     float opt)
+{
+  switch (opcode) {
+    case audioMasterVersion:
+      return kVstVersion;
+
+    case audioMasterGetCurrentProcessLevel: {
+      HeadlessInstance* h = effect ? (HeadlessInstance*)effect->user : NULL;
+      return h ? h->process_level : kVstProcessLevelUnknown;
+    }
+
+    case audioMasterGetTime: {
+      // "user" isn't set until the constructor has returned
+      HeadlessInstance* h = effect ? (HeadlessInstance*)effect->user : NULL;
+      if (!h)
+        return 0;
+
+      double sr = h->fx->getSampleRate();
+      VstTimeInfo& ti = h->time_info;
+      ti.samplePos = (double)h->samp_pos;
+      ti.sampleRate = sr;
+      ti.tempo = h->tempo;
+      ti.ppqPos = ti.samplePos / sr * h->tempo / 60.0;
+      ti.timeSigNumerator = 4;
+      ti.timeSigDenominator = 4;
+      ti.flags = kVstTransportPlaying | kVstTempoValid | kVstPpqPosValid | kVstTimeSigValid;
+      return (VstIntPtr)&ti;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+#ifndef _DT_HEADLESS_HOST_H_
+#define _DT_HEADLESS_HOST_H_
+/**************************************************************************************************
+Minimal VST host used to run DtBlkFx from the command line (no GUI, no audio device)
+
+The plugin sources are linked directly into the tool so DtBlkFx can be constructed without going
+through VSTPluginMain. Since the images are never loaded GlobalInitOk() stays false and the
+constructor skips creating the editor.
+
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include <ostream>
+#include <string>
+
+#include "DtBlkFx.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// one time init: set g_plugin_path from "argv0", load fftw & create the plans
+bool /*true=success*/ HeadlessInit(const char* argv0, std::ostream* err);
+
+// default fftw wisdom file (same place as the plugin keeps it relative to the executable)
+std::string HeadlessWisdomPath();
+
+// load a presets file (same format as <plugin dir>dtblkfx/stereo_presets.txt) into the global
+// presets, must be called before creating any instances
+bool /*true=success*/ HeadlessLoadPresets(const char* path, std::ostream* err);
+
+// set the global presets to a single "<name>:<param> <param> ..." line
+void HeadlessSetPreset(const char* line);
+
+// find a program by index or by name, return -1 if not found
+int HeadlessFindProgram(const char* idx_or_name);
+
+// number of programs in the global presets
+int HeadlessNumPrograms();
+
+//-------------------------------------------------------------------------------------------------
+class HeadlessInstance
+//
+// a DtBlkFx instance plus the transport state that we report back to it through
+// audioMasterGetTime
+//
+{
+public:
+  HeadlessInstance(float sample_rate, long block_size, double tempo = 120.0);
+  ~HeadlessInstance();
+
+  // select program (the same as a host would through effSetProgram)
+  void setProgram(int program) { fx->setProgram(program); }
+
+  // process "n" samples (n must be <= block size), advances the transport
+  void process(float** in, float** out, long n);
+
+  DtBlkFx* fx;
+
+  // current transport position
+  long samp_pos;
+  double tempo;
+  VstTimeInfo time_info;
+
+  // reported through audioMasterGetCurrentProcessLevel (default offline)
+  VstInt32 process_level;
+
+protected:
+  // host callback passed to the plugin
+  static VstIntPtr VSTCALLBACK hostCallback(AEffect* effect, VstInt32 opcode, VstInt32 index,
+                                            VstIntPtr value, void* ptr, float opt);
+
+  // can't copy or assign
+  HeadlessInstance(const HeadlessInstance&) {}
+  void operator=(const HeadlessInstance&) {}
+};
+
+#endif
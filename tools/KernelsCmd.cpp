@@ -0,0 +1,284 @@
+/**************************************************************************************************
+"kernels" command: check each spectrum kernel set that the cpu supports against the scalar set &
+time them
+
+The check runs every kernel over random spectra of many lengths (to cover the scalar remainder of
+the vector versions) starting at a few offsets (so loads aren't aligned). The vector versions sum
+in a different order so sums are compared with a relative tolerance, normTo & scaleBins must match
+exactly.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <chrono>
+#include <iostream>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "SpecKernels.h"
+#include "ToolCmds.h"
+
+using namespace std;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+// relative tolerance for sums & min/max
+const float TOLERANCE = 1e-5f;
+
+//-------------------------------------------------------------------------------------------------
+int KernelsUsage()
+{
+  cerr << "usage: dtblkfx_tool kernels [options]\n"
+          "  -n <bins>       spectrum length for timing (default 4097)\n"
+          "  -time <sec>     minimum time spent on each measurement (default 0.05)\n"
+          "  -check-only     don't time the kernels\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void FillRandom(vector<cplxf>& x, unsigned seed)
+{
+  for (size_t i = 0; i < x.size(); i++) {
+    seed = seed * 1664525u + 1013904223u;
+    float re = (float)(seed >> 8) * (1.0f / 16777216.0f) - 0.5f;
+    seed = seed * 1664525u + 1013904223u;
+    float im = (float)(seed >> 8) * (1.0f / 16777216.0f) - 0.5f;
+    x[i] = cplxf(re, im);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+bool Near(float a, float b)
+{
+  return fabsf(a - b) <= TOLERANCE * (fabsf(a) + fabsf(b)) + 1e-30f;
+}
+
+//-------------------------------------------------------------------------------------------------
+bool Near(const vector<cplxf>& a, const vector<cplxf>& b)
+{
+  for (size_t i = 0; i < a.size(); i++)
+    if (!Near(a[i].real(), b[i].real()) || !Near(a[i].imag(), b[i].imag()))
+      return false;
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+int /*num failures*/ CheckKernels(const SpecKernels* k, const SpecKernels* ref)
+{
+  int n_fail = 0;
+  const char* failed = NULL;
+
+  for (long n = 0; n < 300; n += n < 70 ? 1 : 23) {
+    for (long off = 0; off < 3; off++) {
+      failed = NULL;
+
+      // one spare each side of the range to check nothing outside it is touched
+      vector<cplxf> a(n + 4), b;
+      FillRandom(a, (unsigned)(n * 3 + off));
+      b = a;
+      cplxf* xa = &a[off + 1];
+      cplxf* xb = &b[off + 1];
+
+      if (!Near(ref->pwr(xa, n), k->pwr(xb, n)))
+        failed = "pwr";
+
+      ref->scale(xa, n, 1.7f);
+      k->scale(xb, n, 1.7f);
+      if (!Near(a, b))
+        failed = "scale";
+
+      if (!Near(ref->scalePwr(xa, n, 0.3f), k->scalePwr(xb, n, 0.3f)) || !Near(a, b))
+        failed = "scalePwr";
+
+      float ref_lim[2] = {1e30f, 1e-30f}, lim[2] = {1e30f, 1e-30f};
+      ref->minMaxPwr(xa, n, &ref_lim[0], &ref_lim[1]);
+      k->minMaxPwr(xb, n, &lim[0], &lim[1]);
+      if (!Near(ref_lim[0], lim[0]) || !Near(ref_lim[1], lim[1]))
+        failed = "minMaxPwr";
+
+      // clip about half the bins
+      float thresh = n ? (ref_lim[0] + ref_lim[1]) * 0.5f : 1.0f;
+      float ref_pwr[2], pwr[2];
+      ref->clipPwr(xa, n, thresh, &ref_pwr[0], &ref_pwr[1]);
+      k->clipPwr(xb, n, thresh, &pwr[0], &pwr[1]);
+      if (!Near(ref_pwr[0], pwr[0]) || !Near(ref_pwr[1], pwr[1]) || !Near(a, b))
+        failed = "clipPwr";
+
+      vector<float> ref_norm(n + 1), norm(n + 1);
+      ref->normTo(xa, n, &ref_norm[0]);
+      k->normTo(xa, n, &norm[0]);
+      if (memcmp(&ref_norm[0], &norm[0], n * sizeof(float)) != 0)
+        failed = "normTo";
+
+      ref_lim[0] = lim[0] = 1e30f;
+      ref_lim[1] = lim[1] = 1e-30f;
+      ref->minMax(&ref_norm[0], n, &ref_lim[0], &ref_lim[1]);
+      k->minMax(&ref_norm[0], n, &lim[0], &lim[1]);
+      if (ref_lim[0] != lim[0] || ref_lim[1] != lim[1])
+        failed = "minMax";
+
+      if (!Near(ref->sum(&ref_norm[0], n), k->sum(&ref_norm[0], n)))
+        failed = "sum";
+
+      // gains from the norms (a & b are the same here after clipPwr)
+      b = a;
+      ref->scaleBins(xa, n, &ref_norm[0]);
+      k->scaleBins(xb, n, &ref_norm[0]);
+      if (memcmp(&a[0], &b[0], a.size() * sizeof(cplxf)) != 0)
+        failed = "scaleBins";
+
+      if (failed) {
+        cerr << k->name << ": " << failed << " doesn't match " << ref->name << " (n=" << n
+             << " offset=" << off << ")\n";
+        n_fail++;
+      }
+    }
+  }
+  return n_fail;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <class FN> double /*ns per bin*/ TimeKernel(long n, double min_sec, FN fn)
+{
+  double total = 0.0;
+  long runs = 0;
+  while (total < min_sec || runs < 3) {
+    Clock::time_point t0 = Clock::now();
+    for (int i = 0; i < 16; i++)
+      fn();
+    total += chrono::duration<double>(Clock::now() - t0).count();
+    runs += 16;
+  }
+  return total * 1e9 / ((double)runs * n);
+}
+
+// stops the compiler throwing away results
+volatile float g_sink;
+
+//-------------------------------------------------------------------------------------------------
+void BenchKernels(const SpecKernels* k, long n, double min_sec)
+{
+  vector<cplxf> x(n);
+  FillRandom(x, 1);
+  cplxf* p = &x[0];
+  float lim[2];
+  vector<float> pwr(n);
+
+  // scale by s & then 1/s so the data doesn't drift
+  double pwr_ns = TimeKernel(n, min_sec, [&] { g_sink = k->pwr(p, n); });
+  double scale_ns = TimeKernel(n, min_sec, [&] {
+    k->scale(p, n, 2.0f);
+    k->scale(p, n, 0.5f);
+  }) * 0.5;
+  double scale_pwr_ns = TimeKernel(n, min_sec, [&] {
+    g_sink = k->scalePwr(p, n, 2.0f);
+    g_sink = k->scalePwr(p, n, 0.5f);
+  }) * 0.5;
+  double min_max_ns = TimeKernel(n, min_sec, [&] {
+    lim[0] = 1e30f;
+    lim[1] = 1e-30f;
+    k->minMaxPwr(p, n, &lim[0], &lim[1]);
+  });
+  // thresh above all the bins so the data isn't changed
+  double clip_ns = TimeKernel(n, min_sec, [&] { k->clipPwr(p, n, 1e30f, &lim[0], &lim[1]); });
+  double norm_to_ns = TimeKernel(n, min_sec, [&] { k->normTo(p, n, &pwr[0]); });
+  double min_max_f_ns = TimeKernel(n, min_sec, [&] {
+    lim[0] = 1e30f;
+    lim[1] = 1e-30f;
+    k->minMax(&pwr[0], n, &lim[0], &lim[1]);
+  });
+  double sum_ns = TimeKernel(n, min_sec, [&] { g_sink = k->sum(&pwr[0], n); });
+  vector<float> gain(n, 2.0f), inv_gain(n, 0.5f);
+  double scale_bins_ns = TimeKernel(n, min_sec, [&] {
+    k->scaleBins(p, n, &gain[0]);
+    k->scaleBins(p, n, &inv_gain[0]);
+  }) * 0.5;
+
+  printf("%-8s %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+         k->name,
+         pwr_ns,
+         scale_ns,
+         scale_pwr_ns,
+         min_max_ns,
+         clip_ns,
+         norm_to_ns,
+         min_max_f_ns,
+         sum_ns,
+         scale_bins_ns);
+  fflush(stdout);
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+int KernelsCmd(int argc, char** argv)
+{
+  long n = 4097;
+  double min_sec = 0.05;
+  bool check_only = false;
+
+  for (int i = 0; i < argc; i++) {
+    const char* a = argv[i];
+    bool has_val = i + 1 < argc;
+    if (strcmp(a, "-n") == 0 && has_val)
+      n = atol(argv[++i]);
+    else if (strcmp(a, "-time") == 0 && has_val)
+      min_sec = atof(argv[++i]);
+    else if (strcmp(a, "-check-only") == 0)
+      check_only = true;
+    else
+      return KernelsUsage();
+  }
+  if (n < 1)
+    return KernelsUsage();
+
+  printf("in use: %s\n", g_spec_kernels->name);
+
+  SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+
+  const SpecKernels* ref = GetSpecKernels(SPEC_KERNELS_SCALAR);
+  int n_fail = 0;
+  for (int level = SPEC_KERNELS_SCALAR + 1; level < NUM_SPEC_KERNEL_LEVELS; level++) {
+    const SpecKernels* k = GetSpecKernels(level);
+    if (!k)
+      continue;
+    int f = CheckKernels(k, ref);
+    printf("check %s: %s\n", k->name, f ? "FAILED" : "ok");
+    n_fail += f;
+  }
+
+  if (!check_only) {
+    printf("\nns per bin, n=%ld\n", n);
+    printf("%-8s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n",
+           "",
+           "pwr",
+           "scale",
+           "scalePwr",
+           "minMaxPwr",
+           "clipPwr",
+           "normTo",
+           "minMax",
+           "sum",
+           "scaleBins");
+    for (int level = 0; level < NUM_SPEC_KERNEL_LEVELS; level++) {
+      const SpecKernels* k = GetSpecKernels(level);
+      if (k)
+        BenchKernels(k, n, min_sec);
+    }
+  }
+
+  return n_fail ? 1 : 0;
+}
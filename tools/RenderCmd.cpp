@@ -0,0 +1,300 @@
+/**************************************************************************************************
+"render" command: stream a wav file through DtBlkFx::processReplacing in host sized blocks
+
+The input is split into blocks of the requested host block size exactly as a host would pass
+them, so the per-block timings reported at the end can be used to reproduce CPU spikes seen in a
+real session (e.g. a large fft blk landing in a single small host buffer).
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+#include "HeadlessHost.h"
+#include "ToolCmds.h"
+#include "WavFile.h"
+
+using namespace std;
+
+//-------------------------------------------------------------------------------------------------
+static int RenderUsage()
+{
+  cerr << "usage: dtblkfx_tool render [options] <in.wav> <out.wav>\n"
+          "  -presets <file>   presets file, one \"<name>:<param> <param> ...\" per line\n"
+          "  -program <n|name> program index or name from the presets file (default 0)\n"
+          "  -preset <line>    use a single \"<name>:<param> <param> ...\" line instead\n"
+          "  -block <n>        host block size passed to processReplacing (default 512)\n"
+          "  -tempo <bpm>      tempo reported to the plugin (default 120)\n"
+          "  -tail <sec>       seconds of silence to render after the input (default 0)\n"
+          "  -bits <n>         output 16, 24 or 32 (float) bits (default 32)\n"
+          "  -stages           report time spent in each processing stage\n"
+          "  -par-chans        run per-channel work on the shared channel pool\n"
+          "  -pipeline         mix each fft blk while the next one is processed\n"
+          "  -max-delay <msec> longest delay the buffers are sized for\n"
+          "  -huge-pages       back the fft & output buffers with huge pages if available\n"
+          "  -async <n>        process fft blks on a worker thread with <n> samples of headroom\n"
+          "                    (output is shifted back by <n> to line up with a normal render)\n"
+          "  -realtime         report the realtime process level & feed blocks in real time\n"
+          "                    (otherwise offline, the async worker is waited for)\n"
+          "  -governor         drop fft size & overlap when processing can't keep up (needs\n"
+          "                    -realtime, never applies offline)\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void PrintStageTimes(DtBlkFx* b)
+// per-stage table from the stats published by the plugin
+{
+  StageTimes t;
+  b->getStageTimes(&t);
+  double ms_per_tick = 1e3 / StageTicksPerSec();
+  double process_total = (double)t.stage[STAGE_PROCESS].total;
+
+  fprintf(stderr,
+          "%lu fft blks (%lu silent, %lu degraded by the governor)\n",
+          (unsigned long)t.blks,
+          (unsigned long)t.silent_blks,
+          (unsigned long)t.degraded_blks);
+  fprintf(stderr,
+          "%-16s %9s %10s %10s %10s %7s\n",
+          "stage",
+          "calls",
+          "total ms",
+          "avg ms",
+          "max ms",
+          "%");
+  for (int i = 0; i < NUM_STAGES; i++) {
+    const StageTimes::Stage& s = t.stage[i];
+    if (!s.n)
+      continue;
+    fprintf(stderr,
+            "%-16s %9lu %10.2f %10.4f %10.4f %7.2f\n",
+            StageName(i),
+            (unsigned long)s.n,
+            s.total * ms_per_tick,
+            s.total * ms_per_tick / s.n,
+            s.max * ms_per_tick,
+            process_total > 0.0 ? 100.0 * s.total / process_total : 0.0);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+int RenderCmd(int argc, char** argv)
+{
+  enum { AUDIO_CHANNELS = DtBlkFx::AUDIO_CHANNELS };
+
+  const char* presets_path = NULL;
+  const char* program_str = "0";
+  const char* preset_line = NULL;
+  long block_n = 512;
+  double tempo = 120.0;
+  double tail_sec = 0.0;
+  int bits = 32;
+  bool stages = false;
+  bool par_chans = false;
+  bool pipeline = false;
+  double max_delay_msec = 0.0;
+  bool huge_pages = false;
+  long async_n = 0;
+  bool realtime = false;
+  bool governor = false;
+  const char* in_path = NULL;
+  const char* out_path = NULL;
+
+  for (int i = 0; i < argc; i++) {
+    const char* a = argv[i];
+    bool has_val = i + 1 < argc;
+    if (strcmp(a, "-presets") == 0 && has_val)
+      presets_path = argv[++i];
+    else if (strcmp(a, "-program") == 0 && has_val)
+      program_str = argv[++i];
+    else if (strcmp(a, "-preset") == 0 && has_val)
+      preset_line = argv[++i];
+    else if (strcmp(a, "-block") == 0 && has_val)
+      block_n = atol(argv[++i]);
+    else if (strcmp(a, "-tempo") == 0 && has_val)
+      tempo = atof(argv[++i]);
+    else if (strcmp(a, "-tail") == 0 && has_val)
+      tail_sec = atof(argv[++i]);
+    else if (strcmp(a, "-bits") == 0 && has_val)
+      bits = atoi(argv[++i]);
+    else if (strcmp(a, "-stages") == 0)
+      stages = true;
+    else if (strcmp(a, "-par-chans") == 0)
+      par_chans = true;
+    else if (strcmp(a, "-pipeline") == 0)
+      pipeline = true;
+    else if (strcmp(a, "-max-delay") == 0 && has_val)
+      max_delay_msec = atof(argv[++i]);
+    else if (strcmp(a, "-huge-pages") == 0)
+      huge_pages = true;
+    else if (strcmp(a, "-async") == 0 && has_val)
+      async_n = atol(argv[++i]);
+    else if (strcmp(a, "-realtime") == 0)
+      realtime = true;
+    else if (strcmp(a, "-governor") == 0)
+      governor = true;
+    else if (a[0] == '-')
+      return RenderUsage();
+    else if (!in_path)
+      in_path = a;
+    else if (!out_path)
+      out_path = a;
+    else
+      return RenderUsage();
+  }
+  if (!in_path || !out_path || block_n < 1 || tempo <= 0.0 || async_n < 0)
+    return RenderUsage();
+
+  ostringstream err_str;
+
+  // presets must be in place before the instance is created (number of programs is fixed then)
+  if (preset_line)
+    HeadlessSetPreset(preset_line);
+  else if (!presets_path || !HeadlessLoadPresets(presets_path, &err_str)) {
+    cerr << (presets_path ? err_str.str() : string("need -presets or -preset")) << "\n";
+    return 1;
+  }
+
+  int program = preset_line ? 0 : HeadlessFindProgram(program_str);
+  if (program < 0) {
+    cerr << "program \"" << program_str << "\" not found in " << presets_path << "\n";
+    return 1;
+  }
+
+  WavData in;
+  if (!ReadWav(in_path, &in, &err_str)) {
+    cerr << err_str.str() << "\n";
+    return 1;
+  }
+
+  // map input channels to plugin channels (repeat the last input channel if there aren't enough)
+  long in_n = in.numFrames();
+  long total_n = in_n + (long)(tail_sec * in.sample_rate);
+  WavData out;
+  out.sample_rate = in.sample_rate;
+  out.resize(AUDIO_CHANNELS, total_n);
+
+  vector<float> silence(block_n);
+  vector<float> in_tmp[AUDIO_CHANNELS];
+  vector<float> out_tmp[AUDIO_CHANNELS];
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+    in_tmp[ch].resize(block_n);
+    out_tmp[ch].resize(block_n);
+  }
+
+  HeadlessInstance inst((float)in.sample_rate, block_n, tempo);
+  if (realtime)
+    inst.process_level = kVstProcessLevelRealtime;
+  if (async_n > 0 || pipeline || max_delay_msec > 0.0 || huge_pages) {
+    inst.fx->suspend();
+    inst.fx->setAsyncHeadroom(async_n);
+    inst.fx->setBlkPipeline(pipeline);
+    inst.fx->setHugePages(huge_pages);
+    if (max_delay_msec > 0.0)
+      inst.fx->setMaxDelayMsec((float)max_delay_msec);
+    inst.fx->resume();
+  }
+  inst.setProgram(program);
+  inst.fx->setStageTiming(stages);
+  inst.fx->setParallelChans(par_chans);
+  inst.fx->setGovernor(governor);
+
+  cerr << "rendering " << in_path << " (" << in_n << " samples, " << in.numChannels()
+       << " channels, " << in.sample_rate << "Hz) with program " << program << " \""
+       << inst.fx->currProgram().getName() << "\", block size " << block_n << "\n";
+  cerr << "instance memory " << (double)inst.fx->getMemBytes() / (1024.0 * 1024.0) << " MB"
+       << (inst.fx->isHugePages() ? " (huge pages)" : "") << "\n";
+
+  typedef chrono::steady_clock Clock;
+  double total_sec = 0.0;
+  double worst_sec = 0.0;
+  long worst_pos = 0;
+  Clock::time_point rt_start = Clock::now();
+
+  // blocks processed at reduced quality & the worst drops seen
+  long degraded_n = 0;
+  int max_plan_drop = 0;
+  int max_overlap_drop = 0;
+
+  // run on for the async headroom so that the output can be shifted back
+  for (long pos = 0; pos < total_n + async_n; pos += block_n) {
+    long n = min(block_n, total_n + async_n - pos);
+
+    // wait for this block's turn
+    if (realtime)
+      this_thread::sleep_until(rt_start + chrono::duration<double>((double)pos / in.sample_rate));
+
+    // gather input (hosts are allowed to pass the same buffer for in & out so we copy to keep
+    // the input intact)
+    float* in_ptr[AUDIO_CHANNELS];
+    float* out_ptr[AUDIO_CHANNELS];
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+      int in_ch = min(ch, in.numChannels() - 1);
+      long avail = limit_range(in_n - pos, 0L, n);
+      if (avail > 0)
+        Copy(&in_tmp[ch][0], &in.chan[in_ch][pos], avail);
+      Copy(&in_tmp[ch][0] + avail, &silence[0], n - avail);
+      in_ptr[ch] = &in_tmp[ch][0];
+      out_ptr[ch] = &out_tmp[ch][0];
+    }
+
+    Clock::time_point t0 = Clock::now();
+    inst.process(in_ptr, out_ptr, n);
+    double sec = chrono::duration<double>(Clock::now() - t0).count();
+
+    // output (less the async headroom)
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+      long skip = limit_range(async_n - pos, 0L, n);
+      if (n > skip)
+        Copy(&out.chan[ch][pos + skip - async_n], &out_tmp[ch][skip], n - skip);
+    }
+
+    if (inst.fx->isGovernorDegraded()) {
+      degraded_n++;
+      max_plan_drop = max(max_plan_drop, inst.fx->getGovernorPlanDrop());
+      max_overlap_drop = max(max_overlap_drop, inst.fx->getGovernorOverlapDrop());
+    }
+
+    total_sec += sec;
+    if (sec > worst_sec) {
+      worst_sec = sec;
+      worst_pos = pos;
+    }
+  }
+
+  if (!WriteWav(out_path, out, bits, &err_str)) {
+    cerr << err_str.str() << "\n";
+    return 1;
+  }
+
+  double audio_sec = (double)total_n / in.sample_rate;
+  double block_sec = (double)block_n / in.sample_rate;
+  cerr << "processed " << audio_sec << "s of audio in " << total_sec << "s ("
+       << (total_sec > 0.0 ? audio_sec / total_sec : 0.0) << "x real time)\n"
+       << "worst block: " << worst_sec * 1e3 << "ms at sample " << worst_pos << " ("
+       << 100.0 * worst_sec / block_sec << "% of the " << block_sec * 1e3 << "ms budget)\n";
+
+  if (async_n > 0)
+    cerr << "async worker was late in " << inst.fx->getAsyncXRuns() << " blocks\n";
+  if (governor)
+    cerr << "governor degraded " << degraded_n << " blocks (fft halved up to " << max_plan_drop
+         << " times, overlap halved up to " << max_overlap_drop << " times)\n";
+  if (stages)
+    PrintStageTimes(inst.fx);
+  return 0;
+}
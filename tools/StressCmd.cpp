@@ -0,0 +1,310 @@
+/**************************************************************************************************
+"stress" command: run many instances on many threads at once & check that each one produces
+exactly the same output as it does when it is run on its own
+
+Each instance gets a different program (cycling through the presets) & its own random seed. The
+reference renders are done first one instance at a time, then all instances are created &
+rendered again spread over the threads, every thread stepping through its instances one host
+block at a time so that all instances are mid-render together. Any shared state that is changed
+while processing shows up as a mismatch.
+
+With -async the second pass runs every instance on its async worker (output shifted back by the
+headroom) so it is also checked against a plain render, at the -tempo given.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <chrono>
+#include <iostream>
+#include <math.h>
+#include <memory>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "HeadlessHost.h"
+#include "ToolCmds.h"
+
+using namespace std;
+
+namespace {
+
+enum { AUDIO_CHANNELS = DtBlkFx::AUDIO_CHANNELS };
+
+typedef chrono::steady_clock Clock;
+
+//-------------------------------------------------------------------------------------------------
+int StressUsage()
+{
+  cerr << "usage: dtblkfx_tool stress [options]\n"
+          "  -presets <file>   presets file, one \"<name>:<param> <param> ...\" per line\n"
+          "                    (instance i uses program i modulo the number of programs)\n"
+          "  -preset <line>    use a single \"<name>:<param> <param> ...\" for all instances\n"
+          "  -instances <n>    number of instances (default 2 per thread)\n"
+          "  -threads <n>      number of threads (default number of cpus)\n"
+          "  -sec <sec>        seconds of audio per instance (default 4)\n"
+          "  -block <n>        host block size (default 512)\n"
+          "  -rate <hz>        sample rate (default 44100)\n"
+          "  -tempo <bpm>      tempo reported to the plugin (default 120)\n"
+          "  -par-chans        run per-channel work on the shared channel pool\n"
+          "  -pipeline         mix each fft blk while the next one is processed\n"
+          "  -async <n>        render all at once on async workers with <n> samples of headroom\n"
+          "                    (checked against the one at a time renders without it)\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+struct StressJob {
+  int program;
+  unsigned seed;
+  bool par_chans;
+  bool pipeline;
+  double tempo;
+
+  // async worker headroom (0=off), the output is shifted back by this
+  long async_n;
+
+  // input (same for all jobs) & output for each channel
+  const vector<float>* in;
+  vector<float> out[AUDIO_CHANNELS];
+
+  unique_ptr<HeadlessInstance> inst;
+  long pos;
+
+  // input after the end & output before the async headroom is done
+  vector<float> silence, discard;
+
+  void create(float sample_rate, long block_n)
+  {
+    inst.reset(new HeadlessInstance(sample_rate, block_n, tempo));
+    inst->setProgram(program);
+    inst->fx->setRandSeed(seed);
+    inst->fx->setParallelChans(par_chans);
+    if (pipeline || async_n > 0) {
+      inst->fx->suspend();
+      inst->fx->setBlkPipeline(pipeline);
+      inst->fx->setAsyncHeadroom(async_n);
+      inst->fx->resume();
+    }
+    pos = 0;
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+      out[ch].assign(in[ch].size(), 0.0f);
+    silence.assign(block_n, 0.0f);
+    discard.resize(block_n);
+  }
+
+  // process the next block, return false when done
+  bool step(long block_n)
+  {
+    // run on for the async headroom
+    long total_n = (long)in[0].size();
+    long n = min(block_n, total_n + async_n - pos);
+    if (n <= 0)
+      return false;
+
+    // split the block at the end of the input or the start of the output (the plugin only
+    // gets whole blocks when neither is crossed)
+    if (pos < total_n && pos + n > total_n)
+      n = total_n - pos;
+    else if (pos < async_n && pos + n > async_n)
+      n = async_n - pos;
+
+    // the input is shared by all the jobs (the plugin doesn't write to its inputs)
+    float* in_ptr[AUDIO_CHANNELS];
+    float* out_ptr[AUDIO_CHANNELS];
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+      in_ptr[ch] = pos < total_n ? const_cast<float*>(&in[ch][pos]) : &silence[0];
+      out_ptr[ch] = pos >= async_n ? &out[ch][pos - async_n] : &discard[0];
+    }
+    inst->process(in_ptr, out_ptr, n);
+    pos += n;
+    return true;
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+void FillInput(vector<float>* in, long n, float sample_rate)
+// a swept sine plus noise that is different in each channel
+{
+  unsigned r = 1;
+  for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+    in[ch].resize(n);
+    double phase = 0.0;
+    for (long i = 0; i < n; i++) {
+      double hz = 50.0 * pow(200.0, (double)i / n) * (1 + ch);
+      phase += 2.0 * 3.14159265358979 * hz / sample_rate;
+      r = CtrRand32(r + (unsigned)i);
+      in[ch][i] = 0.4f * (float)sin(phase) + 0.1f * ((float)(r >> 8) / 16777216.0f - 0.5f);
+    }
+  }
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+int StressCmd(int argc, char** argv)
+{
+  const char* presets_path = NULL;
+  const char* preset_line = NULL;
+  int n_threads = (int)thread::hardware_concurrency();
+  int n_instances = 0;
+  double sec = 4.0;
+  long block_n = 512;
+  float sample_rate = 44100.0f;
+  bool par_chans = false;
+  bool pipeline = false;
+  double tempo = 120.0;
+  long async_n = 0;
+
+  for (int i = 0; i < argc; i++) {
+    const char* a = argv[i];
+    bool has_val = i + 1 < argc;
+    if (strcmp(a, "-presets") == 0 && has_val)
+      presets_path = argv[++i];
+    else if (strcmp(a, "-preset") == 0 && has_val)
+      preset_line = argv[++i];
+    else if (strcmp(a, "-instances") == 0 && has_val)
+      n_instances = atoi(argv[++i]);
+    else if (strcmp(a, "-threads") == 0 && has_val)
+      n_threads = atoi(argv[++i]);
+    else if (strcmp(a, "-sec") == 0 && has_val)
+      sec = atof(argv[++i]);
+    else if (strcmp(a, "-block") == 0 && has_val)
+      block_n = atol(argv[++i]);
+    else if (strcmp(a, "-rate") == 0 && has_val)
+      sample_rate = (float)atof(argv[++i]);
+    else if (strcmp(a, "-par-chans") == 0)
+      par_chans = true;
+    else if (strcmp(a, "-pipeline") == 0)
+      pipeline = true;
+    else if (strcmp(a, "-tempo") == 0 && has_val)
+      tempo = atof(argv[++i]);
+    else if (strcmp(a, "-async") == 0 && has_val)
+      async_n = atol(argv[++i]);
+    else
+      return StressUsage();
+  }
+  if (n_threads < 1)
+    n_threads = 1;
+  if (n_instances < 1)
+    n_instances = n_threads * 2;
+  if (sec <= 0.0 || block_n < 1 || sample_rate <= 0.0f || tempo <= 0.0 || async_n < 0)
+    return StressUsage();
+
+  // presets must be in place before the instances are created
+  ostringstream err_str;
+  if (preset_line)
+    HeadlessSetPreset(preset_line);
+  else if (!presets_path || !HeadlessLoadPresets(presets_path, &err_str)) {
+    cerr << (presets_path ? err_str.str() : string("need -presets or -preset")) << "\n";
+    return 1;
+  }
+  int n_programs = HeadlessNumPrograms();
+  if (n_programs < 1) {
+    cerr << "no programs in " << presets_path << "\n";
+    return 1;
+  }
+
+  vector<float> in[AUDIO_CHANNELS];
+  FillInput(in, (long)(sec * sample_rate), sample_rate);
+
+  vector<StressJob> jobs(n_instances);
+  for (int i = 0; i < n_instances; i++) {
+    jobs[i].program = i % n_programs;
+    jobs[i].seed = CtrRand32((unsigned)i);
+    jobs[i].par_chans = par_chans;
+    jobs[i].pipeline = pipeline;
+    jobs[i].tempo = tempo;
+    jobs[i].async_n = 0;
+    jobs[i].in = in;
+  }
+
+  // reference renders, one instance at a time
+  cerr << "rendering " << n_instances << " instances one at a time\n";
+  vector<vector<float>> ref(n_instances * AUDIO_CHANNELS);
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < n_instances; i++) {
+    StressJob& j = jobs[i];
+    j.create(sample_rate, block_n);
+    while (j.step(block_n)) {
+    }
+    j.inst.reset();
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++)
+      ref[i * AUDIO_CHANNELS + ch].swap(j.out[ch]);
+  }
+  double serial_sec = chrono::duration<double>(Clock::now() - t0).count();
+
+  // the same again, all at once
+  cerr << "rendering " << n_instances << " instances on " << n_threads << " threads";
+  if (async_n > 0)
+    cerr << " with async workers";
+  cerr << "\n";
+  for (int i = 0; i < n_instances; i++)
+    jobs[i].async_n = async_n;
+  t0 = Clock::now();
+  vector<thread> threads;
+  for (int t = 0; t < n_threads; t++) {
+    threads.push_back(thread([&, t] {
+      SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+      for (int i = t; i < n_instances; i += n_threads)
+        jobs[i].create(sample_rate, block_n);
+
+      // interleave this thread's instances block by block
+      for (bool busy = true; busy;) {
+        busy = false;
+        for (int i = t; i < n_instances; i += n_threads)
+          busy |= jobs[i].step(block_n);
+      }
+
+      for (int i = t; i < n_instances; i += n_threads)
+        jobs[i].inst.reset();
+    }));
+  }
+  for (int t = 0; t < n_threads; t++)
+    threads[t].join();
+  double parallel_sec = chrono::duration<double>(Clock::now() - t0).count();
+
+  // compare bit for bit
+  int n_fail = 0;
+  for (int i = 0; i < n_instances; i++) {
+    for (int ch = 0; ch < AUDIO_CHANNELS; ch++) {
+      const vector<float>& a = ref[i * AUDIO_CHANNELS + ch];
+      const vector<float>& b = jobs[i].out[ch];
+      long n = (long)a.size();
+      long diff = 0;
+      while (diff < n && memcmp(&a[diff], &b[diff], sizeof(float)) == 0)
+        diff++;
+      if (diff < n) {
+        cerr << "instance " << i << " (program " << jobs[i].program << ") channel " << ch
+             << " differs from sample " << diff << "\n";
+        n_fail++;
+        break;
+      }
+    }
+  }
+
+  double audio_sec = sec * n_instances;
+  printf("serial %.2fs (%.1fx real time), %d threads %.2fs (%.1fx real time), speedup %.2f\n",
+         serial_sec,
+         serial_sec > 0.0 ? audio_sec / serial_sec : 0.0,
+         n_threads,
+         parallel_sec,
+         parallel_sec > 0.0 ? audio_sec / parallel_sec : 0.0,
+         parallel_sec > 0.0 ? serial_sec / parallel_sec : 0.0);
+  printf("%s: %d of %d instances match\n",
+         n_fail ? "FAILED" : "ok",
+         n_instances - n_fail,
+         n_instances);
+  return n_fail ? 1 : 0;
+}
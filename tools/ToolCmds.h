@@ -0,0 +1,44 @@
+#ifndef _DT_TOOL_CMDS_H_
+#define _DT_TOOL_CMDS_H_
+/**************************************************************************************************
+Commands available from dtblkfx_tool, see DtBlkFxTool.cpp
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+// each command is passed the args following the command name, return value is the exit code
+// (global init has already been done when the command is called)
+typedef int (*ToolCmdFn)(int argc, char** argv);
+
+// render a wav file through a preset (RenderCmd.cpp)
+int RenderCmd(int argc, char** argv);
+
+// time each 1.0 effect for each fft size (BenchFxCmd.cpp)
+int BenchFxCmd(int argc, char** argv);
+
+// time separate against batched ffts of all channels for each fft size (BenchFFTCmd.cpp)
+int BenchFFTCmd(int argc, char** argv);
+
+// check the vector spectrum kernels against the scalar ones & time them (KernelsCmd.cpp)
+int KernelsCmd(int argc, char** argv);
+
+// run many instances concurrently & check they match single-threaded renders (StressCmd.cpp)
+int StressCmd(int argc, char** argv);
+
+// check the decoded harmonic tables & write the compressed tables (HarmTablesCmd.cpp)
+int HarmTablesCmd(int argc, char** argv);
+
+// measure fftw plans & save the wisdom file (WisdomCmd.cpp)
+int WisdomCmd(int argc, char** argv);
+
+// check that each overlap step dropped by the quality governor gives fewer blks (GovernorCmd.cpp)
+int GovernorCmd(int argc, char** argv);
+
+#endif
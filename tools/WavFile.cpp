@@ -0,0 +1,275 @@
+/**************************************************************************************************
+Minimal RIFF/WAVE reading & writing for the command line tools
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "WavFile.h"
+
+using namespace std;
+
+enum {
+  WAVE_FORMAT_PCM = 1,
+  WAVE_FORMAT_IEEE_FLOAT = 3,
+  WAVE_FORMAT_EXTENSIBLE = 0xfffe,
+};
+
+//-------------------------------------------------------------------------------------------------
+struct ScopeFile {
+  FILE* f;
+  ScopeFile(const char* path, const char* mode) { f = fopen(path, mode); }
+  ~ScopeFile()
+  {
+    if (f)
+      fclose(f);
+  }
+  operator FILE*() { return f; }
+};
+
+//-------------------------------------------------------------------------------------------------
+// little endian access that doesn't care about host byte order or alignment
+inline unsigned long GetLE(const unsigned char* p, int n_bytes)
+{
+  unsigned long v = 0;
+  for (int i = n_bytes - 1; i >= 0; i--)
+    v = (v << 8) | p[i];
+  return v;
+}
+
+inline void PutLE(unsigned char* p, unsigned long v, int n_bytes)
+{
+  for (int i = 0; i < n_bytes; i++, v >>= 8)
+    p[i] = (unsigned char)v;
+}
+
+//-------------------------------------------------------------------------------------------------
+static float /*-1..1*/ DecodeSamp(const unsigned char* p, int bytes, bool is_float)
+{
+  if (is_float) {
+    if (bytes == 4) {
+      unsigned long v = GetLE(p, 4);
+      unsigned int v32 = (unsigned int)v;
+      float f;
+      memcpy(&f, &v32, 4);
+      return f;
+    }
+    // 8 byte double
+    unsigned long long v = GetLE(p + 4, 4);
+    v = (v << 32) | GetLE(p, 4);
+    double d;
+    memcpy(&d, &v, 8);
+    return (float)d;
+  }
+
+  // 8 bit is unsigned, everything else is signed
+  if (bytes == 1)
+    return (p[0] - 128) * (1.0f / 128.0f);
+
+  // sign extend
+  long v = (long)GetLE(p, bytes);
+  int shift = 32 - bytes * 8;
+  v = (long)(int)((unsigned int)v << shift) >> shift;
+  return (float)v * ldexpf(1.0f, 1 - bytes * 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ ReadWav(const char* path, WavData* wav, ostream* err)
+{
+  ScopeFile f(path, "rb");
+  if (!f) {
+    *err << path << " could not be opened";
+    return false;
+  }
+
+  unsigned char hdr[12];
+  if (fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) != 0 ||
+      memcmp(hdr + 8, "WAVE", 4) != 0) {
+    *err << path << " is not a wav file";
+    return false;
+  }
+
+  int format = 0, n_chan = 0, bits = 0;
+  long sample_rate = 0;
+  bool got_fmt = false;
+
+  // go through chunks until we find the data
+  while (1) {
+    unsigned char chunk[8];
+    if (fread(chunk, 1, 8, f) != 8) {
+      *err << path << " has no data chunk";
+      return false;
+    }
+    unsigned long chunk_n = GetLE(chunk + 4, 4);
+
+    if (memcmp(chunk, "fmt ", 4) == 0) {
+      unsigned char fmt[40];
+      memset(fmt, 0, sizeof(fmt));
+      unsigned long rd_n = chunk_n < sizeof(fmt) ? chunk_n : sizeof(fmt);
+      if (chunk_n < 16 || fread(fmt, 1, rd_n, f) != rd_n) {
+        *err << path << " has a bad fmt chunk";
+        return false;
+      }
+      format = (int)GetLE(fmt, 2);
+      n_chan = (int)GetLE(fmt + 2, 2);
+      sample_rate = (long)GetLE(fmt + 4, 4);
+      bits = (int)GetLE(fmt + 14, 2);
+
+      // extensible format, the real format is the first 2 bytes of the sub-format guid
+      if (format == WAVE_FORMAT_EXTENSIBLE && chunk_n >= 26)
+        format = (int)GetLE(fmt + 24, 2);
+
+      // skip whatever we didn't read (plus pad byte)
+      fseek(f, (long)(chunk_n - rd_n + (chunk_n & 1)), SEEK_CUR);
+      got_fmt = true;
+      continue;
+    }
+
+    if (memcmp(chunk, "data", 4) != 0) {
+      // skip unknown chunk (plus pad byte)
+      fseek(f, (long)(chunk_n + (chunk_n & 1)), SEEK_CUR);
+      continue;
+    }
+
+    // found the data
+    if (!got_fmt) {
+      *err << path << " has data before the fmt chunk";
+      return false;
+    }
+    bool is_float = format == WAVE_FORMAT_IEEE_FLOAT;
+    bool pcm_ok = format == WAVE_FORMAT_PCM && bits >= 8 && bits <= 32 && bits % 8 == 0;
+    bool float_ok = is_float && (bits == 32 || bits == 64);
+    if (!(pcm_ok || float_ok) || n_chan < 1) {
+      *err << path << " has an unsupported format" << " (format=" << format << " bits=" << bits
+           << " channels=" << n_chan << ")";
+      return false;
+    }
+
+    int samp_bytes = bits / 8;
+    int frame_bytes = samp_bytes * n_chan;
+
+    // some writers leave the data size as 0 or 0xffffffff when streaming, read to end of file
+    long n_frames = (long)(chunk_n / frame_bytes);
+    if (chunk_n == 0 || chunk_n == 0xffffffffUL) {
+      long pos = ftell(f);
+      fseek(f, 0, SEEK_END);
+      n_frames = (ftell(f) - pos) / frame_bytes;
+      fseek(f, pos, SEEK_SET);
+    }
+
+    wav->sample_rate = (int)sample_rate;
+    wav->resize(n_chan, n_frames);
+
+    // convert in moderate sized pieces
+    vector<unsigned char> buf(frame_bytes * 4096);
+    long frame = 0;
+    while (frame < n_frames) {
+      long n = n_frames - frame;
+      if (n > 4096)
+        n = 4096;
+      long got = (long)fread(&buf[0], frame_bytes, n, f);
+      const unsigned char* p = &buf[0];
+      for (long i = 0; i < got; i++)
+        for (int c = 0; c < n_chan; c++, p += samp_bytes)
+          wav->chan[c][frame + i] = DecodeSamp(p, samp_bytes, is_float);
+      frame += got;
+      if (got < n)
+        break;
+    }
+
+    // truncated file, just return what we got
+    if (frame < n_frames)
+      wav->resize(n_chan, frame);
+
+    return true;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+bool /*true=success*/ WriteWav(const char* path, const WavData& wav, int bits, ostream* err)
+{
+  if (bits != 16 && bits != 24 && bits != 32) {
+    *err << "can't write " << bits << " bit wav files";
+    return false;
+  }
+
+  ScopeFile f(path, "wb");
+  if (!f) {
+    *err << path << " could not be created";
+    return false;
+  }
+
+  int n_chan = wav.numChannels();
+  long n_frames = wav.numFrames();
+  int samp_bytes = bits / 8;
+  int frame_bytes = samp_bytes * n_chan;
+  unsigned long data_n = (unsigned long)n_frames * frame_bytes;
+
+  unsigned char hdr[44];
+  memcpy(hdr, "RIFF", 4);
+  PutLE(hdr + 4, 36 + data_n + (data_n & 1), 4);
+  memcpy(hdr + 8, "WAVEfmt ", 8);
+  PutLE(hdr + 16, 16, 4);
+  PutLE(hdr + 20, bits == 32 ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM, 2);
+  PutLE(hdr + 22, n_chan, 2);
+  PutLE(hdr + 24, wav.sample_rate, 4);
+  PutLE(hdr + 28, (unsigned long)wav.sample_rate * frame_bytes, 4);
+  PutLE(hdr + 32, frame_bytes, 2);
+  PutLE(hdr + 34, bits, 2);
+  memcpy(hdr + 36, "data", 4);
+  PutLE(hdr + 40, data_n, 4);
+
+  if (fwrite(hdr, 1, 44, f) != 44) {
+    *err << path << " write failed";
+    return false;
+  }
+
+  // convert in moderate sized pieces
+  vector<unsigned char> buf(frame_bytes * 4096);
+  float int_scale = (float)(1L << (bits - 1));
+  long int_max = (1L << (bits - 1)) - 1;
+  for (long frame = 0; frame < n_frames; frame += 4096) {
+    long n = n_frames - frame;
+    if (n > 4096)
+      n = 4096;
+    unsigned char* p = &buf[0];
+    for (long i = 0; i < n; i++) {
+      for (int c = 0; c < n_chan; c++, p += samp_bytes) {
+        float v = wav.chan[c][frame + i];
+        if (bits == 32) {
+          unsigned int v32;
+          memcpy(&v32, &v, 4);
+          PutLE(p, v32, 4);
+        }
+        else {
+          // round & clip
+          long iv = (long)floorf(v * int_scale + 0.5f);
+          if (iv > int_max)
+            iv = int_max;
+          if (iv < -int_max - 1)
+            iv = -int_max - 1;
+          PutLE(p, (unsigned long)iv, samp_bytes);
+        }
+      }
+    }
+    if (fwrite(&buf[0], frame_bytes, n, f) != (size_t)n) {
+      *err << path << " write failed";
+      return false;
+    }
+  }
+
+  // pad byte to keep the riff chunk even
+  if (data_n & 1)
+    fputc(0, f);
+
+  return true;
+}
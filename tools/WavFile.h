@@ -0,0 +1,49 @@
+#ifndef _DT_WAV_FILE_H_
+#define _DT_WAV_FILE_H_
+/**************************************************************************************************
+Minimal RIFF/WAVE reading & writing for the command line tools
+
+Reads 8/16/24/32 bit integer PCM and 32/64 bit float (including WAVE_FORMAT_EXTENSIBLE), writes
+16/24 bit integer PCM or 32 bit float. Data is held de-interleaved as floats in the range -1..1.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+
+#include <ostream>
+#include <vector>
+
+//-------------------------------------------------------------------------------------------------
+struct WavData {
+  int sample_rate;
+
+  // de-interleaved samples, one vector per channel (all the same length)
+  std::vector<std::vector<float>> chan;
+
+  WavData() { sample_rate = 44100; }
+
+  int numChannels() const { return (int)chan.size(); }
+  long numFrames() const { return chan.empty() ? 0 : (long)chan[0].size(); }
+
+  // set the number of channels & frames, new data is zero
+  void resize(int n_chan, long n_frames)
+  {
+    chan.resize(n_chan);
+    for (int i = 0; i < n_chan; i++)
+      chan[i].resize(n_frames);
+  }
+};
+
+// read a wav file, error message written to "err"
+bool /*true=success*/ ReadWav(const char* path, WavData* wav, std::ostream* err);
+
+// write a wav file with "bits" of 16, 24 or 32 (float), error message written to "err"
+bool /*true=success*/ WriteWav(const char* path, const WavData& wav, int bits, std::ostream* err);
+
+#endif
@@ -0,0 +1,134 @@
+/**************************************************************************************************
+"wisdom" command: measure fftw plans for every fft size & save them to the wisdom file that the
+plugin loads
+
+The plugin does this itself on first load (if it can write to its data dir) but it can take a
+while, this lets it be done ahead of time or with more effort (-patient). The time for an r2c+c2r
+pair is reported for each size before & after planning.
+
+This program is free software; you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation; either version 2 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+General Public License for more details.
+
+***************************************************************************************************/
+#include <StdAfx.h>
+
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "HeadlessHost.h"
+#include "ToolCmds.h"
+#include "rfftw_float.h"
+
+using namespace std;
+
+//-------------------------------------------------------------------------------------------------
+static int WisdomUsage()
+{
+  cerr << "usage: dtblkfx_tool wisdom [options]\n"
+          "  -measure      measure plans (default)\n"
+          "  -patient      try harder (can take many minutes)\n"
+          "  -file <path>  wisdom file (default " << HeadlessWisdomPath() << ")\n"
+          "  -fresh        discard the existing wisdom file first\n"
+          "  -time <sec>   minimum time spent timing each size (default 0.05)\n";
+  return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+static double /*sec*/ TimeFFTPair(int plan, float* x, cplxf* y, double min_sec)
+// average time for an r2c+c2r pair using the current plans
+{
+  typedef chrono::steady_clock Clock;
+  for (int i = 0; i < g_fft_sz[plan]; i++)
+    x[i] = (float)((i * 7919) % 1000) * 1e-3f - 0.5f;
+
+  double total = 0.0;
+  long runs = 0;
+  while (total < min_sec || runs < 3) {
+    Clock::time_point t0 = Clock::now();
+    FFTWf::execute_dft_r2c(g_fft_plan[plan], x, to_fftwf_complex(y));
+    FFTWf::execute_dft_c2r(g_ifft_plan[plan], to_fftwf_complex(y), x);
+    total += chrono::duration<double>(Clock::now() - t0).count();
+    runs++;
+
+    // c2r scales by n, keep the data in range
+    for (int i = 0; i < g_fft_sz[plan]; i++)
+      x[i] *= 1.0f / g_fft_sz[plan];
+  }
+  return total / runs;
+}
+
+//-------------------------------------------------------------------------------------------------
+int WisdomCmd(int argc, char** argv)
+{
+  FFTWfPlanMode mode = FFTW_PLAN_MEASURE;
+  string path = HeadlessWisdomPath();
+  bool fresh = false;
+  double min_sec = 0.05;
+
+  for (int i = 0; i < argc; i++) {
+    const char* a = argv[i];
+    bool has_val = i + 1 < argc;
+    if (strcmp(a, "-measure") == 0)
+      mode = FFTW_PLAN_MEASURE;
+    else if (strcmp(a, "-patient") == 0)
+      mode = FFTW_PLAN_PATIENT;
+    else if (strcmp(a, "-file") == 0 && has_val)
+      path = argv[++i];
+    else if (strcmp(a, "-fresh") == 0)
+      fresh = true;
+    else if (strcmp(a, "-time") == 0 && has_val)
+      min_sec = atof(argv[++i]);
+    else
+      return WisdomUsage();
+  }
+
+  if (fresh)
+    remove(path.c_str());
+
+  ScopeFFTWfMalloc<float> x(MAX_FFT_SZ);
+  ScopeFFTWfMalloc<cplxf> y(MAX_FFT_SZ / 2 + 1);
+
+  SCOPE_NO_FP_EXCEPTIONS_OR_DENORMALS;
+
+  // plans as the plugin would create them (estimated or from the existing wisdom)
+  double before_sec[NUM_FFT_SZ];
+  for (int i = 0; i < NUM_FFT_SZ; i++) {
+    if (!WarmFFTWfPlan(i))
+      throw 0;
+    before_sec[i] = TimeFFTPair(i, x, y, min_sec);
+  }
+
+  cerr << "planning (" << (mode == FFTW_PLAN_PATIENT ? "patient" : "measure") << "), wisdom file "
+       << path << "\n";
+
+  typedef chrono::steady_clock Clock;
+  Clock::time_point t0 = Clock::now();
+  int measured = CreateFFTWfPlans(mode, path.c_str());
+  double plan_sec = chrono::duration<double>(Clock::now() - t0).count();
+
+  if (mode != FFTW_PLAN_ESTIMATE && !measured)
+    cerr << "nothing measured: all plans were already in the wisdom file or it can't be written"
+         << " (use -fresh to start again)\n";
+  else
+    cerr << measured << " plans measured in " << plan_sec << "s\n";
+
+  printf("%7s %12s %12s %8s\n", "fft_n", "before us", "after us", "speedup");
+  for (int i = 0; i < NUM_FFT_SZ; i++) {
+    double after_sec = TimeFFTPair(i, x, y, min_sec);
+    printf("%7d %12.2f %12.2f %8.2f\n",
+           g_fft_sz[i],
+           before_sec[i] * 1e6,
+           after_sec * 1e6,
+           after_sec > 0.0 ? before_sec[i] / after_sec : 0.0);
+    fflush(stdout);
+  }
+  return 0;
+}